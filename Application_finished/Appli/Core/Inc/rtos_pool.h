@@ -0,0 +1,108 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file           : rtos_pool.h
+  * @brief          : Header for rtos_pool.c file.
+  *                   Static control blocks of the RTOS objects created by the
+  *                   TouchGFX HAL, GPU2D and the video decoders.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __RTOS_POOL_H
+#define __RTOS_POOL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include "cmsis_os2.h"
+
+/* Exported constants --------------------------------------------------------*/
+/**
+  * @brief  Control blocks of the pool, each the size of the largest of a semaphore,
+  *         mutex, queue or event group of FreeRTOS.
+  */
+#ifndef RTOS_POOL_BLOCKS
+#define RTOS_POOL_BLOCKS        16U
+#endif
+
+/**
+  * @brief  Bytes of the pool holding the messages of the queues.
+  */
+#ifndef RTOS_POOL_QUEUE_BYTES
+#define RTOS_POOL_QUEUE_BYTES   64U
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief  Use of the pool and of the FreeRTOS heap.
+  */
+typedef struct
+{
+  uint32_t BlocksUsed;      /* Control blocks handed out                           */
+  uint32_t QueueBytesUsed;  /* Message bytes handed out                            */
+  uint32_t Fallbacks;       /* Objects allocated from the heap, the pool being full */
+  uint32_t HeapSize;        /* configTOTAL_HEAP_SIZE                               */
+  uint32_t HeapFree;        /* Bytes free in the heap now                          */
+  uint32_t HeapMinFree;     /* Fewest bytes ever free in the heap                  */
+} RTOS_POOL_StatsTypeDef;
+
+/* Exported functions prototypes ---------------------------------------------*/
+/**
+  * @brief  Creates a semaphore with a control block of the pool.
+  * @param  MaxCount Maximum number of tokens.
+  * @param  InitialCount Initial number of tokens.
+  * @param  Name Name of the semaphore, or NULL.
+  * @retval The semaphore, or NULL
+  */
+osSemaphoreId_t RTOS_POOL_SemaphoreNew(uint32_t MaxCount, uint32_t InitialCount, const char *Name);
+
+/**
+  * @brief  Creates a mutex with a control block of the pool.
+  * @param  Name Name of the mutex, or NULL.
+  * @retval The mutex, or NULL
+  */
+osMutexId_t RTOS_POOL_MutexNew(const char *Name);
+
+/**
+  * @brief  Creates a message queue with a control block and message storage of the pool.
+  * @param  MsgCount Maximum number of messages.
+  * @param  MsgSize Size of a message in bytes.
+  * @param  Name Name of the queue, or NULL.
+  * @retval The queue, or NULL
+  */
+osMessageQueueId_t RTOS_POOL_MessageQueueNew(uint32_t MsgCount, uint32_t MsgSize, const char *Name);
+
+/**
+  * @brief  Creates an event flags object with a control block of the pool.
+  * @param  Name Name of the event flags, or NULL.
+  * @retval The event flags, or NULL
+  */
+osEventFlagsId_t RTOS_POOL_EventFlagsNew(const char *Name);
+
+/**
+  * @brief  Gets the use of the pool and of the FreeRTOS heap.
+  * @param  Stats Filled with the use.
+  * @retval None
+  */
+void RTOS_POOL_GetStats(RTOS_POOL_StatsTypeDef *Stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __RTOS_POOL_H */
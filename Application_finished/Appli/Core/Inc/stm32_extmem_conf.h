@@ -0,0 +1,87 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file           : stm32_extmem_conf.h
+  * @version        : 1.0.0
+  * @brief          : External memory manager configuration of the application.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2023 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM32_EXTMEM_CONF__H__
+#define __STM32_EXTMEM_CONF__H__
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32h7rsxx_hal.h"
+
+/*
+  @brief management of the driver layer enable
+  The boot loader owns the NOR flash and the PSRAM, the application only reads the
+  SD card, once HAL_SD_MODULE_ENABLED is set in stm32h7rsxx_hal_conf.h
+*/
+
+#define EXTMEM_DRIVER_NOR_SFDP   0
+#define EXTMEM_DRIVER_PSRAM      0
+#if defined(HAL_SD_MODULE_ENABLED)
+#define EXTMEM_DRIVER_SDCARD     1
+#else
+#define EXTMEM_DRIVER_SDCARD     0
+#endif /* HAL_SD_MODULE_ENABLED */
+#define EXTMEM_DRIVER_USER       0
+
+/*
+  @brief management of the sal layer enable
+*/
+#define EXTMEM_SAL_XSPI   0
+#define EXTMEM_SAL_SD     EXTMEM_DRIVER_SDCARD
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32_extmem.h"
+#include "stm32_extmem_type.h"
+
+/* USER CODE BEGIN INCLUDE */
+
+/* USER CODE END INCLUDE */
+
+/* Exported constants --------------------------------------------------------*/
+/** @defgroup EXTMEM_CONF_Exported_constants EXTMEM_CONF exported constants
+  * @{
+  */
+enum {
+  EXTMEMORY_1  = 0, /*!< ID=0 for the SD card, see SDCardDataReader.hpp */
+};
+
+/* Exported configuration --------------------------------------------------------*/
+/** @defgroup EXTMEM_CONF_Exported_configuration EXTMEM_CONF exported configuration definition
+  * @{
+  */
+
+extern EXTMEM_DefinitionTypeDef extmem_list_config[1];
+#if defined(EXTMEM_C)
+EXTMEM_DefinitionTypeDef extmem_list_config[1];
+#endif /* EXTMEM_C */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __STM32_EXTMEM_CONF__H__ */
@@ -62,6 +62,9 @@ void JPEG_IRQHandler(void);
 void GPU2D_IRQHandler(void);
 void GPU2D_ER_IRQHandler(void);
 /* USER CODE BEGIN EFP */
+void HPDMA1_Channel2_IRQHandler(void);
+void HPDMA1_Channel3_IRQHandler(void);
+void HPDMA1_Channel4_IRQHandler(void);
 
 /* USER CODE END EFP */
 
@@ -50,6 +50,7 @@
 /* Private function prototypes -----------------------------------------------*/
 /* USER CODE BEGIN FunctionPrototypes */
 extern portBASE_TYPE IdleTaskHook(void* p);
+extern void IdleSuspendSleep(void);
 /* USER CODE END FunctionPrototypes */
 
 /* Hook prototypes */
@@ -69,6 +70,8 @@ void vApplicationIdleHook( void )
    memory allocated by the kernel to any task that has since been deleted. */
   
    vTaskSetApplicationTaskTag(NULL, IdleTaskHook);
+   /* Sleeps until the next interrupt while the TouchGFX tick loop is suspended */
+   IdleSuspendSleep();
 }
 /* USER CODE END 2 */
 
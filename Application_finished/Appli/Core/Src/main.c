@@ -28,6 +28,7 @@
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
+typedef StaticTask_t osStaticThreadDef_t;
 /* USER CODE BEGIN PTD */
 
 /* USER CODE END PTD */
@@ -60,20 +61,77 @@ LTDC_HandleTypeDef hltdc;
 
 /* Definitions for defaultTask */
 osThreadId_t defaultTaskHandle;
+uint32_t defaultTaskBuffer[ 128 ];
+osStaticThreadDef_t defaultTaskControlBlock;
 const osThreadAttr_t defaultTask_attributes = {
   .name = "defaultTask",
-  .stack_size = 128 * 4,
+  .cb_mem = &defaultTaskControlBlock,
+  .cb_size = sizeof(defaultTaskControlBlock),
+  .stack_mem = &defaultTaskBuffer[0],
+  .stack_size = sizeof(defaultTaskBuffer),
   .priority = (osPriority_t) osPriorityNormal,
 };
 /* Definitions for TouchGFXTask */
 osThreadId_t TouchGFXTaskHandle;
+uint32_t TouchGFXTaskBuffer[ 4096 ];
+osStaticThreadDef_t TouchGFXTaskControlBlock;
 const osThreadAttr_t TouchGFXTask_attributes = {
   .name = "TouchGFXTask",
-  .stack_size = 4096 * 4,
+  .cb_mem = &TouchGFXTaskControlBlock,
+  .cb_size = sizeof(TouchGFXTaskControlBlock),
+  .stack_mem = &TouchGFXTaskBuffer[0],
+  .stack_size = sizeof(TouchGFXTaskBuffer),
   .priority = (osPriority_t) osPriorityNormal,
 };
 /* USER CODE BEGIN PV */
-
+/* Definitions for videoTask, decoding video frames ahead of the TouchGFX task */
+osThreadId_t videoTaskHandle;
+uint32_t videoTaskBuffer[ 1000 ];
+osStaticThreadDef_t videoTaskControlBlock;
+const osThreadAttr_t videoTask_attributes = {
+  .name = "videoTask",
+  .cb_mem = &videoTaskControlBlock,
+  .cb_size = sizeof(videoTaskControlBlock),
+  .stack_mem = &videoTaskBuffer[0],
+  .stack_size = sizeof(videoTaskBuffer),
+  .priority = (osPriority_t) osPriorityLow,
+};
+/* Definitions for modelTask, computing the model state out of the TouchGFX task */
+osThreadId_t modelTaskHandle;
+uint32_t modelTaskBuffer[ 1024 ];
+osStaticThreadDef_t modelTaskControlBlock;
+const osThreadAttr_t modelTask_attributes = {
+  .name = "modelTask",
+  .cb_mem = &modelTaskControlBlock,
+  .cb_size = sizeof(modelTaskControlBlock),
+  .stack_mem = &modelTaskBuffer[0],
+  .stack_size = sizeof(modelTaskBuffer),
+  .priority = (osPriority_t) osPriorityBelowNormal,
+};
+/* Definitions for jpegTask, decoding still images with the JPEG codec */
+osThreadId_t jpegTaskHandle;
+uint32_t jpegTaskBuffer[ 512 ];
+osStaticThreadDef_t jpegTaskControlBlock;
+const osThreadAttr_t jpegTask_attributes = {
+  .name = "jpegTask",
+  .cb_mem = &jpegTaskControlBlock,
+  .cb_size = sizeof(jpegTaskControlBlock),
+  .stack_mem = &jpegTaskBuffer[0],
+  .stack_size = sizeof(jpegTaskBuffer),
+  .priority = (osPriority_t) osPriorityLow,
+};
+/* Definitions for captureTask, streaming the areas drawn over SWO, see ScreenCapture */
+osThreadId_t captureTaskHandle;
+uint32_t captureTaskBuffer[ 384 ];
+osStaticThreadDef_t captureTaskControlBlock;
+const osThreadAttr_t captureTask_attributes = {
+  .name = "captureTask",
+  .cb_mem = &captureTaskControlBlock,
+  .cb_size = sizeof(captureTaskControlBlock),
+  .stack_mem = &captureTaskBuffer[0],
+  .stack_size = sizeof(captureTaskBuffer),
+  .priority = (osPriority_t) osPriorityLow,
+};
 /* USER CODE END PV */
 
 /* Private function prototypes -----------------------------------------------*/
@@ -92,6 +150,13 @@ void StartDefaultTask(void *argument);
 extern void TouchGFX_Task(void *argument);
 
 /* USER CODE BEGIN PFP */
+extern void videoTaskFunc(void *argument);
+extern void ModelWorker_Task(void *argument);
+extern void JPEGImageLoader_Task(void *argument);
+extern void ScreenCapture_Task(void *argument);
+extern void MPUProfile_Apply(void);
+extern void StartupTrace_Mark(const char *name);
+static int LTDC_AdoptBootSplash(void);
 
 /* USER CODE END PFP */
 
@@ -108,6 +173,8 @@ int main(void)
 {
 
   /* USER CODE BEGIN 1 */
+  /* Includes the mapping of the external memories, the jump and the C runtime startup */
+  StartupTrace_Mark("BOOT_Application");
 
   /* USER CODE END 1 */
 
@@ -131,10 +198,14 @@ int main(void)
   HAL_Init();
 
   /* USER CODE BEGIN Init */
+  StartupTrace_Mark("MPU_Config, caches, HAL_Init");
+  /* Cache policy of the PSRAM selected by TOUCHGFX_MPU_PROFILE, before it is used */
+  MPUProfile_Apply();
 
   /* USER CODE END Init */
 
   /* USER CODE BEGIN SysInit */
+  StartupTrace_Mark("MPUProfile_Apply");
 
   /* USER CODE END SysInit */
 
@@ -184,6 +255,10 @@ int main(void)
 
   /* USER CODE BEGIN RTOS_THREADS */
   /* add threads, ... */
+  videoTaskHandle = osThreadNew(videoTaskFunc, NULL, &videoTask_attributes);
+  modelTaskHandle = osThreadNew(ModelWorker_Task, NULL, &modelTask_attributes);
+  jpegTaskHandle = osThreadNew(JPEGImageLoader_Task, NULL, &jpegTask_attributes);
+  captureTaskHandle = osThreadNew(ScreenCapture_Task, NULL, &captureTask_attributes);
   /* USER CODE END RTOS_THREADS */
 
   /* USER CODE BEGIN RTOS_EVENTS */
@@ -442,6 +517,7 @@ static void MX_ICACHE_GPU2D_Init(void)
     Error_Handler();
   }
   /* USER CODE BEGIN ICACHE_GPU2D_Init 2 */
+  StartupTrace_Mark("MX_GPIO_Init .. MX_ICACHE_GPU2D_Init");
 
   /* USER CODE END ICACHE_GPU2D_Init 2 */
 
@@ -482,6 +558,12 @@ static void MX_LTDC_Init(void)
 {
 
   /* USER CODE BEGIN LTDC_Init 0 */
+  /* The boot loader left LTDC running with its splash, which stays until TouchGFX shows
+     its first frame. The configuration below would reload the layer at once */
+  if (LTDC_AdoptBootSplash())
+  {
+    return;
+  }
 
   /* USER CODE END LTDC_Init 0 */
 
@@ -605,6 +687,60 @@ static void MX_GPIO_Init(void)
 }
 
 /* USER CODE BEGIN 4 */
+/**
+  * @brief  Takes over LTDC as the boot loader left it, scanning out its splash.
+  *         The display timing is read back from LTDC, the layer configuration is the
+  *         one TouchGFX renders with and is applied with its first frame, see
+  *         TouchGFXHAL::setTFTFrameBuffer().
+  * @retval 1 if LTDC was running and is adopted, 0 if it must be initialized
+  */
+static int LTDC_AdoptBootSplash(void)
+{
+  if ((LTDC->GCR & LTDC_GCR_LTDCEN) == 0U)
+  {
+    return 0;
+  }
+
+  hltdc.Instance = LTDC;
+  hltdc.Init.HSPolarity = LTDC->GCR & LTDC_GCR_HSPOL;
+  hltdc.Init.VSPolarity = LTDC->GCR & LTDC_GCR_VSPOL;
+  hltdc.Init.DEPolarity = LTDC->GCR & LTDC_GCR_DEPOL;
+  hltdc.Init.PCPolarity = LTDC->GCR & LTDC_GCR_PCPOL;
+  hltdc.Init.HorizontalSync = (LTDC->SSCR & LTDC_SSCR_HSW) >> 16U;
+  hltdc.Init.VerticalSync = LTDC->SSCR & LTDC_SSCR_VSH;
+  hltdc.Init.AccumulatedHBP = (LTDC->BPCR & LTDC_BPCR_AHBP) >> 16U;
+  hltdc.Init.AccumulatedVBP = LTDC->BPCR & LTDC_BPCR_AVBP;
+  hltdc.Init.AccumulatedActiveW = (LTDC->AWCR & LTDC_AWCR_AAW) >> 16U;
+  hltdc.Init.AccumulatedActiveH = LTDC->AWCR & LTDC_AWCR_AAH;
+  hltdc.Init.TotalWidth = (LTDC->TWCR & LTDC_TWCR_TOTALW) >> 16U;
+  hltdc.Init.TotalHeigh = LTDC->TWCR & LTDC_TWCR_TOTALH;
+  hltdc.Init.Backcolor.Blue = (uint8_t)(LTDC->BCCR & 0xFFU);
+  hltdc.Init.Backcolor.Green = (uint8_t)((LTDC->BCCR >> 8U) & 0xFFU);
+  hltdc.Init.Backcolor.Red = (uint8_t)((LTDC->BCCR >> 16U) & 0xFFU);
+
+  hltdc.LayerCfg[0].WindowX0 = 0;
+  hltdc.LayerCfg[0].WindowX1 = hltdc.Init.AccumulatedActiveW - hltdc.Init.AccumulatedHBP;
+  hltdc.LayerCfg[0].WindowY0 = 0;
+  hltdc.LayerCfg[0].WindowY1 = hltdc.Init.AccumulatedActiveH - hltdc.Init.AccumulatedVBP;
+  hltdc.LayerCfg[0].PixelFormat = LTDC_PIXEL_FORMAT_RGB565;
+  hltdc.LayerCfg[0].Alpha = 255;
+  hltdc.LayerCfg[0].Alpha0 = 0;
+  hltdc.LayerCfg[0].BlendingFactor1 = LTDC_BLENDING_FACTOR1_CA;
+  hltdc.LayerCfg[0].BlendingFactor2 = LTDC_BLENDING_FACTOR2_CA;
+  hltdc.LayerCfg[0].FBStartAdress = LTDC_Layer1->CFBAR;
+  hltdc.LayerCfg[0].ImageWidth = hltdc.LayerCfg[0].WindowX1;
+  hltdc.LayerCfg[0].ImageHeight = hltdc.LayerCfg[0].WindowY1;
+  hltdc.LayerCfg[0].Backcolor.Blue = 0;
+  hltdc.LayerCfg[0].Backcolor.Green = 0;
+  hltdc.LayerCfg[0].Backcolor.Red = 0;
+
+  /* Selects the clock and the pins the boot loader already uses */
+  HAL_LTDC_MspInit(&hltdc);
+  __HAL_LTDC_ENABLE_IT(&hltdc, LTDC_IT_TE | LTDC_IT_FU);
+  hltdc.ErrorCode = HAL_LTDC_ERROR_NONE;
+  hltdc.State = HAL_LTDC_STATE_READY;
+  return 1;
+}
 
 /* USER CODE END 4 */
 
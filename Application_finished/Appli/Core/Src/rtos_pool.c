@@ -0,0 +1,142 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file           : rtos_pool.c
+  * @brief          : Static control blocks of the RTOS objects created by the
+  *                   TouchGFX HAL, GPU2D and the video decoders.
+  *
+  *                   These objects are created once and never deleted. Taking their
+  *                   control blocks from a static pool, instead of the FreeRTOS
+  *                   heap, makes their placement known at link time and leaves the
+  *                   heap to the application. An object is only allocated from the
+  *                   heap when the pool is exhausted, and counted as a fallback.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+/* Includes ------------------------------------------------------------------*/
+#include "rtos_pool.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "event_groups.h"
+#include <string.h>
+
+/* Private typedef -----------------------------------------------------------*/
+typedef union
+{
+  StaticSemaphore_t Semaphore;
+  StaticQueue_t Queue;
+  StaticEventGroup_t EventGroup;
+} RTOS_POOL_BlockTypeDef;
+
+/* Private variables ---------------------------------------------------------*/
+static RTOS_POOL_BlockTypeDef rtos_pool_blocks[RTOS_POOL_BLOCKS];
+static uint32_t rtos_pool_queue_storage[RTOS_POOL_QUEUE_BYTES / sizeof(uint32_t)];
+static uint32_t rtos_pool_blocks_used;
+static uint32_t rtos_pool_queue_bytes_used;
+static uint32_t rtos_pool_fallbacks;
+
+/* Private functions ---------------------------------------------------------*/
+/**
+  * @brief  Takes a control block and, if Bytes is not 0, message storage from the pool.
+  * @param  Bytes Message storage needed, 0 if none.
+  * @param  Storage Set to the message storage.
+  * @retval The control block, or NULL if the pool is exhausted
+  */
+static void *RTOS_POOL_Take(uint32_t Bytes, void **Storage)
+{
+  void *block = NULL;
+  const uint32_t words = (Bytes + sizeof(uint32_t) - 1U) / sizeof(uint32_t);
+
+  taskENTER_CRITICAL();
+  if ((rtos_pool_blocks_used < RTOS_POOL_BLOCKS)
+      && ((rtos_pool_queue_bytes_used / sizeof(uint32_t)) + words <= RTOS_POOL_QUEUE_BYTES / sizeof(uint32_t)))
+  {
+    block = &rtos_pool_blocks[rtos_pool_blocks_used++];
+    if (Storage != NULL)
+    {
+      *Storage = &rtos_pool_queue_storage[rtos_pool_queue_bytes_used / sizeof(uint32_t)];
+    }
+    rtos_pool_queue_bytes_used += words * sizeof(uint32_t);
+  }
+  else
+  {
+    rtos_pool_fallbacks++;
+  }
+  taskEXIT_CRITICAL();
+
+  return block;
+}
+
+/* Exported functions --------------------------------------------------------*/
+osSemaphoreId_t RTOS_POOL_SemaphoreNew(uint32_t MaxCount, uint32_t InitialCount, const char *Name)
+{
+  osSemaphoreAttr_t attr;
+
+  memset(&attr, 0, sizeof(attr));
+  attr.name = Name;
+  attr.cb_mem = RTOS_POOL_Take(0U, NULL);
+  attr.cb_size = (attr.cb_mem != NULL) ? sizeof(StaticSemaphore_t) : 0U;
+  return osSemaphoreNew(MaxCount, InitialCount, &attr);
+}
+
+osMutexId_t RTOS_POOL_MutexNew(const char *Name)
+{
+  osMutexAttr_t attr;
+
+  memset(&attr, 0, sizeof(attr));
+  attr.name = Name;
+  attr.cb_mem = RTOS_POOL_Take(0U, NULL);
+  attr.cb_size = (attr.cb_mem != NULL) ? sizeof(StaticSemaphore_t) : 0U;
+  return osMutexNew(&attr);
+}
+
+osMessageQueueId_t RTOS_POOL_MessageQueueNew(uint32_t MsgCount, uint32_t MsgSize, const char *Name)
+{
+  osMessageQueueAttr_t attr;
+  void *storage = NULL;
+
+  memset(&attr, 0, sizeof(attr));
+  attr.name = Name;
+  attr.cb_mem = RTOS_POOL_Take(MsgCount * MsgSize, &storage);
+  if (attr.cb_mem != NULL)
+  {
+    attr.cb_size = sizeof(StaticQueue_t);
+    attr.mq_mem = storage;
+    attr.mq_size = MsgCount * MsgSize;
+  }
+  return osMessageQueueNew(MsgCount, MsgSize, &attr);
+}
+
+osEventFlagsId_t RTOS_POOL_EventFlagsNew(const char *Name)
+{
+  osEventFlagsAttr_t attr;
+
+  memset(&attr, 0, sizeof(attr));
+  attr.name = Name;
+  attr.cb_mem = RTOS_POOL_Take(0U, NULL);
+  attr.cb_size = (attr.cb_mem != NULL) ? sizeof(StaticEventGroup_t) : 0U;
+  return osEventFlagsNew(&attr);
+}
+
+void RTOS_POOL_GetStats(RTOS_POOL_StatsTypeDef *Stats)
+{
+  Stats->BlocksUsed = rtos_pool_blocks_used;
+  Stats->QueueBytesUsed = rtos_pool_queue_bytes_used;
+  Stats->Fallbacks = rtos_pool_fallbacks;
+  Stats->HeapSize = configTOTAL_HEAP_SIZE;
+  Stats->HeapFree = xPortGetFreeHeapSize();
+  Stats->HeapMinFree = xPortGetMinimumEverFreeHeapSize();
+}
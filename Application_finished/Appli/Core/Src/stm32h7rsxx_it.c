@@ -41,11 +41,19 @@
 
 /* Private variables ---------------------------------------------------------*/
 /* USER CODE BEGIN PV */
+extern I2C_HandleTypeDef hi2c1;
 
 /* USER CODE END PV */
 
 /* Private function prototypes -----------------------------------------------*/
 /* USER CODE BEGIN PFP */
+extern void PrefetchVideoDataReader_IRQHandler(void);
+extern void STM32TouchController_DMA_IRQHandler(void);
+extern void AsyncFontDataReader_IRQHandler(void);
+extern void SDCardDataReader_IRQHandler(void);
+extern void AssetUploadQueue_IRQHandler(void);
+extern void CortexMMCUInstrumentation_InterruptEntered(IRQn_Type irqn);
+extern void CortexMMCUInstrumentation_InterruptExited(IRQn_Type irqn);
 
 /* USER CODE END PFP */
 
@@ -227,11 +235,11 @@ void HPDMA1_Channel1_IRQHandler(void)
 void LTDC_IRQHandler(void)
 {
   /* USER CODE BEGIN LTDC_IRQn 0 */
-
+  CortexMMCUInstrumentation_InterruptEntered(LTDC_IRQn);
   /* USER CODE END LTDC_IRQn 0 */
   HAL_LTDC_IRQHandler(&hltdc);
   /* USER CODE BEGIN LTDC_IRQn 1 */
-
+  CortexMMCUInstrumentation_InterruptExited(LTDC_IRQn);
   /* USER CODE END LTDC_IRQn 1 */
 }
 
@@ -241,11 +249,11 @@ void LTDC_IRQHandler(void)
 void DMA2D_IRQHandler(void)
 {
   /* USER CODE BEGIN DMA2D_IRQn 0 */
-
+  CortexMMCUInstrumentation_InterruptEntered(DMA2D_IRQn);
   /* USER CODE END DMA2D_IRQn 0 */
   HAL_DMA2D_IRQHandler(&hdma2d);
   /* USER CODE BEGIN DMA2D_IRQn 1 */
-
+  CortexMMCUInstrumentation_InterruptExited(DMA2D_IRQn);
   /* USER CODE END DMA2D_IRQn 1 */
 }
 
@@ -255,11 +263,11 @@ void DMA2D_IRQHandler(void)
 void JPEG_IRQHandler(void)
 {
   /* USER CODE BEGIN JPEG_IRQn 0 */
-
+  CortexMMCUInstrumentation_InterruptEntered(JPEG_IRQn);
   /* USER CODE END JPEG_IRQn 0 */
   HAL_JPEG_IRQHandler(&hjpeg);
   /* USER CODE BEGIN JPEG_IRQn 1 */
-
+  CortexMMCUInstrumentation_InterruptExited(JPEG_IRQn);
   /* USER CODE END JPEG_IRQn 1 */
 }
 
@@ -269,11 +277,11 @@ void JPEG_IRQHandler(void)
 void GPU2D_IRQHandler(void)
 {
   /* USER CODE BEGIN GPU2D_IRQn 0 */
-
+  CortexMMCUInstrumentation_InterruptEntered(GPU2D_IRQn);
   /* USER CODE END GPU2D_IRQn 0 */
   HAL_GPU2D_IRQHandler(&hgpu2d);
   /* USER CODE BEGIN GPU2D_IRQn 1 */
-
+  CortexMMCUInstrumentation_InterruptExited(GPU2D_IRQn);
   /* USER CODE END GPU2D_IRQn 1 */
 }
 
@@ -292,5 +300,60 @@ void GPU2D_ER_IRQHandler(void)
 }
 
 /* USER CODE BEGIN 1 */
+/**
+  * @brief This function handles HPDMA1 Channel 2 global interrupt, used for video prefetching.
+  */
+void HPDMA1_Channel2_IRQHandler(void)
+{
+  PrefetchVideoDataReader_IRQHandler();
+}
+
+/**
+  * @brief This function handles HPDMA1 Channel 3 global interrupt, used for reading glyph data.
+  */
+void HPDMA1_Channel3_IRQHandler(void)
+{
+  AsyncFontDataReader_IRQHandler();
+}
+
+/**
+  * @brief This function handles HPDMA1 Channel 4 global interrupt, used for uploading assets.
+  */
+void HPDMA1_Channel4_IRQHandler(void)
+{
+  AssetUploadQueue_IRQHandler();
+}
+
+/**
+  * @brief This function handles SDMMC1 global interrupt, used for reading assets from the SD card.
+  */
+void SDMMC1_IRQHandler(void)
+{
+  SDCardDataReader_IRQHandler();
+}
+
+/**
+  * @brief This function handles GPDMA1 Channel 0 global interrupt, used for touch reports.
+  */
+void GPDMA1_Channel0_IRQHandler(void)
+{
+  STM32TouchController_DMA_IRQHandler();
+}
+
+/**
+  * @brief This function handles I2C1 event interrupt.
+  */
+void I2C1_EV_IRQHandler(void)
+{
+  HAL_I2C_EV_IRQHandler(&hi2c1);
+}
+
+/**
+  * @brief This function handles I2C1 error interrupt.
+  */
+void I2C1_ER_IRQHandler(void)
+{
+  HAL_I2C_ER_IRQHandler(&hi2c1);
+}
 
 /* USER CODE END 1 */
@@ -15,6 +15,8 @@ public:
 
     using ConstFont::getGlyph;
 
+    virtual const GlyphNode* getGlyph(Unicode::UnicodeChar unicode, const uint8_t*& pixelData, uint8_t& bitsPerPixel) const;
+
     virtual const uint8_t* getPixelData(const GlyphNode* glyph) const;
 
     virtual int8_t getKerning(Unicode::UnicodeChar prevChar, const GlyphNode* glyph) const;
@@ -33,13 +35,30 @@ protected:
     GeneratedFont()
         : ConstFont(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0), glyphData(0), kerningData(0), gsubTable(0), arabicTable(0)
     {
+        clearLookupCache();
     }
 
+    void clearLookupCache();
+
     const void* glyphData;          ///< The glyphs
     const KerningNode* kerningData; ///< The kerning
     const uint16_t* gsubTable;      ///< The GSUB tables
 
     const FontContextualFormsTable* arabicTable; ///< Contextual forms
+
+private:
+    static const uint16_t GLYPH_CACHE_SIZE = 32;
+
+    struct CachedGlyph
+    {
+        Unicode::UnicodeChar unicode;
+        const GlyphNode* glyph; ///< 0 if free
+    };
+
+    mutable CachedGlyph glyphCache[GLYPH_CACHE_SIZE]; ///< Glyphs found, by the low bits of the Unicode
+    mutable Unicode::UnicodeChar kerningPrevChar;     ///< The last pair looked up for kerning
+    mutable Unicode::UnicodeChar kerningChar;         ///< 0 if none
+    mutable int8_t kerningDistance;
 };
 
 class FusedFont : public GeneratedFont
@@ -111,8 +130,11 @@ public:
 private:
 
     const VectorFontNode* find(Unicode::UnicodeChar unicode) const;
+    const VectorFontNode* search(Unicode::UnicodeChar unicode) const;
     const GlyphNode* getGlyphNode(const VectorFontNode* node) const;
 
+    static const uint16_t NODE_CACHE_SIZE = 32;
+
     float scaleFactor;
     const VectorFontNode* vectorNodes;
     const uint16_t* const* vectorTable;
@@ -120,6 +142,10 @@ private:
     const uint16_t* gsubTable;
     const FontContextualFormsTable* arabicTable;
     uint16_t numberOfGlyphs;
+    mutable const VectorFontNode* nodeCache[NODE_CACHE_SIZE]; ///< Nodes found, by the low bits of the Unicode
+    mutable Unicode::UnicodeChar kerningPrevChar;             ///< The last pair looked up for kerning
+    mutable Unicode::UnicodeChar kerningChar;                 ///< 0 if none
+    mutable int8_t kerningDistance;
 
     static GlyphNode glyphNode;
 };
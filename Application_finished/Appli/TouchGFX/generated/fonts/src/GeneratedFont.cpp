@@ -3,6 +3,31 @@
 
 #include <fonts/GeneratedFont.hpp>
 #include <math.h>
+#include <string.h>
+
+namespace
+{
+// The kerning pairs of a glyph are sorted by the Unicode of the previous character
+template <typename T>
+const T* findKerningNode(const T* pairs, uint16_t size, touchgfx::Unicode::UnicodeChar prevChar)
+{
+    uint16_t low = 0;
+    uint16_t high = size;
+    while (low < high)
+    {
+        const uint16_t mid = (low + high) / 2;
+        if (pairs[mid].unicodePrevChar < prevChar)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+    return (low < size && pairs[low].unicodePrevChar == prevChar) ? pairs + low : 0;
+}
+} // namespace
 
 namespace touchgfx
 {
@@ -13,6 +38,34 @@ GeneratedFont::GeneratedFont(const GlyphNode* glyphs, uint16_t numGlyphs, uint16
       gsubTable(gsubData),
       arabicTable(formsTable)
 {
+    clearLookupCache();
+}
+
+void GeneratedFont::clearLookupCache()
+{
+    memset(glyphCache, 0, sizeof(glyphCache));
+    kerningPrevChar = 0;
+    kerningChar = 0;
+    kerningDistance = 0;
+}
+
+const GlyphNode* GeneratedFont::getGlyph(Unicode::UnicodeChar unicode, const uint8_t*& pixelData, uint8_t& bitsPerPixel) const
+{
+    // Text repeats few characters, most are found without searching the glyph table
+    CachedGlyph& cached = glyphCache[unicode % GLYPH_CACHE_SIZE];
+    if (cached.glyph != 0 && cached.unicode == unicode)
+    {
+        pixelData = getPixelData(cached.glyph);
+        bitsPerPixel = getBitsPerPixel();
+        return cached.glyph;
+    }
+    const GlyphNode* const glyph = ConstFont::getGlyph(unicode, pixelData, bitsPerPixel);
+    if (glyph != 0)
+    {
+        cached.unicode = unicode;
+        cached.glyph = glyph;
+    }
+    return glyph;
 }
 
 const uint8_t* GeneratedFont::getPixelData(const GlyphNode* glyph) const
@@ -28,19 +81,16 @@ int8_t GeneratedFont::getKerning(Unicode::UnicodeChar prevChar, const GlyphNode*
         return 0;
     }
 
-    const KerningNode* kerndata = kerningData + glyph->kerningTablePos();
-    for (uint16_t i = glyph->kerningTableSize; i > 0; i--, kerndata++)
+    if (glyph->unicode == kerningChar && prevChar == kerningPrevChar)
     {
-        if (prevChar == kerndata->unicodePrevChar)
-        {
-            return kerndata->distance;
-        }
-        if (prevChar < kerndata->unicodePrevChar)
-        {
-            break;
-        }
+        return kerningDistance;
     }
-    return 0;
+
+    const KerningNode* const kerndata = findKerningNode(kerningData + glyph->kerningTablePos(), glyph->kerningTableSize, prevChar);
+    kerningPrevChar = prevChar;
+    kerningChar = glyph->unicode;
+    kerningDistance = kerndata ? kerndata->distance : 0;
+    return kerningDistance;
 }
 
 const GlyphNode* FusedFont::getGlyph(Unicode::UnicodeChar unicode, const uint8_t*& pixelData, uint8_t& bitsPerPixel) const
@@ -71,8 +121,10 @@ GeneratedVectorFont::GeneratedVectorFont(uint16_t baseline, float scale, const V
         fontData.fallbackChar,
         fontData.ellipsisChar),
    scaleFactor(scale), vectorNodes(vectorGlyphs), vectorTable(glyphData), kerningTable(kerning),
-   arabicTable(formsTable), numberOfGlyphs(fontData.numberOfGlyphs)
+   arabicTable(formsTable), numberOfGlyphs(fontData.numberOfGlyphs),
+   kerningPrevChar(0), kerningChar(0), kerningDistance(0)
 {
+    memset(nodeCache, 0, sizeof(nodeCache));
     if (gsubData[0] != 0)
     {
         gsubTable = gsubData;
@@ -172,23 +224,40 @@ int8_t GeneratedVectorFont::getKerning(Unicode::UnicodeChar prevChar, const Glyp
         return 0;
     }
 
-    const VectorKerningNode* kerndata = kerningTable + glyph->kerningTablePos();
-    for (uint16_t i = glyph->kerningTableSize; i > 0; i--, kerndata++)
+    if (glyph->unicode == kerningChar && prevChar == kerningPrevChar)
     {
-        if (prevChar == kerndata->unicodePrevChar)
-        {
-            const float scaledDistance = kerndata->distance * scaleFactor;
-            return (int)(scaledDistance >= 0.0f ? (scaledDistance + 0.5f) : (scaledDistance - 0.5f));
-        }
-        if (prevChar < kerndata->unicodePrevChar)
-        {
-            break;
-        }
+        return kerningDistance;
     }
-    return 0;
+
+    const VectorKerningNode* const kerndata = findKerningNode(kerningTable + glyph->kerningTablePos(), glyph->kerningTableSize, prevChar);
+    kerningPrevChar = prevChar;
+    kerningChar = glyph->unicode;
+    kerningDistance = 0;
+    if (kerndata)
+    {
+        const float scaledDistance = kerndata->distance * scaleFactor;
+        kerningDistance = (int)(scaledDistance >= 0.0f ? (scaledDistance + 0.5f) : (scaledDistance - 0.5f));
+    }
+    return kerningDistance;
 }
 
 const VectorFontNode* GeneratedVectorFont::find(Unicode::UnicodeChar unicode) const
+{
+    // Text repeats few characters, most are found without searching the glyph table
+    const VectorFontNode*& cached = nodeCache[unicode % NODE_CACHE_SIZE];
+    if (cached != 0 && cached->unicode == unicode)
+    {
+        return cached;
+    }
+    const VectorFontNode* const node = search(unicode);
+    if (node != 0)
+    {
+        cached = node;
+    }
+    return node;
+}
+
+const VectorFontNode* GeneratedVectorFont::search(Unicode::UnicodeChar unicode) const
 {
     // Some fonts does not have a glyphList. Cannot be searched...
     if (vectorNodes == 0)
@@ -0,0 +1,186 @@
+#ifndef ANIMATIONSCHEDULER_HPP
+#define ANIMATIONSCHEDULER_HPP
+
+#include <touchgfx/Callback.hpp>
+#include <touchgfx/Drawable.hpp>
+
+/** Number of animations which can run at the same time. */
+#ifndef ANIMATION_SCHEDULER_SLOTS
+#define ANIMATION_SCHEDULER_SLOTS 64
+#endif
+
+/** Number of segments of the easing tables, a power of two. */
+#ifndef ANIMATION_EASING_STEPS
+#define ANIMATION_EASING_STEPS 64
+#endif
+
+/**
+ * Moves and fades widgets, evaluating all the animations of a tick in one loop.
+ *
+ * MoveAnimator and FadeAnimator are mixins ticked one by one: every animated widget is a
+ * timer widget of the Application, which calls its handleTickEvent(), which calls an
+ * EasingEquation, then moveTo() invalidates the old and the new rectangle of the widget
+ * separately. With fifty animations, the tick spends its time on the calls. The scheduler
+ * keeps the animations in arrays, a field per array, and one tick runs over them in a
+ * loop: the easing is read from a table of ANIMATION_EASING_STEPS segments built once from
+ * EasingEquations, in the manner of the NemaGFX easing functions, and interpolated in
+ * fixed point. A widget moved by a few pixels is invalidated once, with the rectangle
+ * covering its old and its new position. Animations done are removed from the arrays
+ * before their callbacks are called, so a callback may start the next animation.
+ *
+ * FrontendApplication ticks the scheduler after its TimerRegistry and clears it when the
+ * screen changes. A widget can be moved and faded at the same time; starting a move of a
+ * widget already moving replaces the move, likewise for fades. The widget must be
+ * canceled with cancel() before it is destroyed, if it may still be animated.
+ */
+class AnimationScheduler
+{
+public:
+    /** The easings of the tables, named after their EasingEquations. */
+    enum Easing
+    {
+        LINEAR,
+        QUAD_IN,
+        QUAD_OUT,
+        QUAD_IN_OUT,
+        CUBIC_IN,
+        CUBIC_OUT,
+        CUBIC_IN_OUT,
+        SINE_IN,
+        SINE_OUT,
+        SINE_IN_OUT,
+        BACK_OUT,
+        BOUNCE_OUT,
+        NUMBER_OF_EASINGS
+    };
+
+    /** Called with the widget when its animation is done. */
+    typedef touchgfx::GenericCallback<const touchgfx::Drawable&> DoneCallback;
+
+    AnimationScheduler();
+
+    /**
+     * Moves a widget to a position within its parent.
+     *
+     * @param [in] widget   The widget.
+     * @param      endX     The x coordinate at the end.
+     * @param      endY     The y coordinate at the end.
+     * @param      duration The number of ticks of the animation, 0 to move at once.
+     * @param      easing   The easing of both coordinates.
+     * @param      delay    The number of ticks before the animation starts.
+     * @param [in] done     Called when the widget is at the end, may be 0.
+     *
+     * @return false if all the slots are taken, the widget is not moved then.
+     */
+    bool move(touchgfx::Drawable& widget, int16_t endX, int16_t endY, uint16_t duration, Easing easing = LINEAR, uint16_t delay = 0, DoneCallback* done = 0);
+
+    /**
+     * Fades a widget with setAlpha() and getAlpha(), such as an Image or a TextArea.
+     *
+     * @param [in] widget   The widget.
+     * @param      endAlpha The alpha at the end.
+     * @param      duration The number of ticks of the animation, 0 to set the alpha at once.
+     * @param      easing   The easing of the alpha.
+     * @param      delay    The number of ticks before the animation starts.
+     * @param [in] done     Called when the widget has the alpha, may be 0.
+     *
+     * @return false if all the slots are taken, the alpha is not changed then.
+     */
+    template <class T>
+    bool fade(T& widget, uint8_t endAlpha, uint16_t duration, Easing easing = LINEAR, uint16_t delay = 0, DoneCallback* done = 0)
+    {
+        return startFade(widget, &setAlphaOf<T>, widget.getAlpha(), endAlpha, duration, easing, delay, done);
+    }
+
+    /**
+     * Stops the animations of a widget where they are. No callback is called.
+     *
+     * @param widget The widget.
+     */
+    void cancel(const touchgfx::Drawable& widget);
+
+    /**
+     * Tells if a widget is animated.
+     *
+     * @param widget The widget.
+     *
+     * @return true if the widget is moved or faded.
+     */
+    bool isAnimating(const touchgfx::Drawable& widget) const;
+
+    /** Advances all the animations by a tick and calls the callbacks of those done. */
+    void tick();
+
+    /** Stops all the animations. No callback is called. */
+    void clear()
+    {
+        count = 0;
+    }
+
+    /**
+     * Gets the number of animations running.
+     *
+     * @return The number of animations.
+     */
+    uint16_t getNumberOfAnimations() const
+    {
+        return count;
+    }
+
+    /**
+     * Gets the scheduler of the FrontendApplication.
+     *
+     * @return The scheduler.
+     */
+    static AnimationScheduler* getInstance()
+    {
+        return instance;
+    }
+
+private:
+    typedef void (*SetAlpha)(touchgfx::Drawable& widget, uint8_t alpha);
+
+    enum Kind
+    {
+        MOVE,
+        FADE
+    };
+
+    template <class T>
+    static void setAlphaOf(touchgfx::Drawable& widget, uint8_t alpha)
+    {
+        T& typed = static_cast<T&>(widget);
+        if (typed.getAlpha() != alpha)
+        {
+            typed.setAlpha(alpha);
+            widget.invalidate();
+        }
+    }
+
+    bool startFade(touchgfx::Drawable& widget, SetAlpha setAlpha, uint8_t startAlpha, uint8_t endAlpha, uint16_t duration, Easing easing, uint16_t delay, DoneCallback* done);
+    int add(touchgfx::Drawable& widget, Kind kind);
+    void remove(int index);
+    int32_t ease(uint8_t easing, uint16_t elapsed, uint16_t duration) const;
+    static void moveWidget(touchgfx::Drawable& widget, int16_t x, int16_t y);
+
+    // The animations, a field per array, count of them used
+    touchgfx::Drawable* widgets[ANIMATION_SCHEDULER_SLOTS];
+    SetAlpha setters[ANIMATION_SCHEDULER_SLOTS]; ///< Sets the alpha of a fade, 0 for a move
+    DoneCallback* callbacks[ANIMATION_SCHEDULER_SLOTS];
+    int16_t fromX[ANIMATION_SCHEDULER_SLOTS];    ///< Start x, or start alpha of a fade
+    int16_t fromY[ANIMATION_SCHEDULER_SLOTS];
+    int16_t deltaX[ANIMATION_SCHEDULER_SLOTS];   ///< Distance in x, or alpha change of a fade
+    int16_t deltaY[ANIMATION_SCHEDULER_SLOTS];
+    uint16_t elapsed[ANIMATION_SCHEDULER_SLOTS];
+    uint16_t durations[ANIMATION_SCHEDULER_SLOTS];
+    uint16_t delays[ANIMATION_SCHEDULER_SLOTS];
+    uint8_t easings[ANIMATION_SCHEDULER_SLOTS];
+    uint16_t count;
+
+    /** The easings from 0 to 1 in Q14, ANIMATION_EASING_STEPS + 1 points each. */
+    int16_t tables[NUMBER_OF_EASINGS][ANIMATION_EASING_STEPS + 1];
+
+    static AnimationScheduler* instance;
+};
+
+#endif // ANIMATIONSCHEDULER_HPP
@@ -0,0 +1,59 @@
+#ifndef BAKEDBACKGROUND_HPP
+#define BAKEDBACKGROUND_HPP
+
+#include <touchgfx/containers/Container.hpp>
+#include <touchgfx/widgets/Image.hpp>
+
+/**
+ * Draws the static layers at the bottom of a screen from one bitmap baked by
+ * gcc/mkbake.py.
+ *
+ * A screen like Screen1 stacks a background Box and full screen images below its animated
+ * widgets, and every invalidated area draws them all, back to front. mkbake.py composes
+ * the bottom run of Box and Image widgets of each screen in the TouchGFX project that no
+ * interaction, mixin or user code changes into an opaque PNG in assets/images/baked, and
+ * writes the list of those widgets in gui/<screen>_screen/<Screen>Baked.hpp. bake() puts
+ * the bitmap in front of them: it is opaque, so JSMOC or an OcclusionCuller leaves them
+ * out of the draw chain, and one bitmap is drawn instead. The widgets stay in the
+ * container, for code that refers to them and for hit-testing.
+ *
+ * A baked widget that is changed at runtime is not drawn: call unbake() first.
+ */
+class BakedBackground : public touchgfx::Image
+{
+public:
+    BakedBackground();
+
+    /**
+     * Puts the baked bitmap in front of the widgets baked in it.
+     *
+     * @param [in,out] screen The container of the screen.
+     * @param          bitmap The baked bitmap.
+     * @param          layers The widgets baked, bottom first.
+     * @param          count  The number of widgets.
+     *
+     * @return false if the widgets are not the first children of the container, in order,
+     *         or the bitmap is not opaque, in which case the widgets are drawn.
+     */
+    bool bake(touchgfx::Container& screen, const touchgfx::Bitmap& bitmap, touchgfx::Drawable* const* layers, uint16_t count);
+
+    /**
+     * Removes the baked bitmap, so the widgets baked in it are drawn again.
+     */
+    void unbake();
+
+    /**
+     * Tells if the bitmap is drawn in place of the widgets.
+     *
+     * @return true if baked.
+     */
+    bool isBaked() const
+    {
+        return container != 0;
+    }
+
+private:
+    touchgfx::Container* container;
+};
+
+#endif // BAKEDBACKGROUND_HPP
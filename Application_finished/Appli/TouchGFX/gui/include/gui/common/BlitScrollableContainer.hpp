@@ -0,0 +1,93 @@
+#ifndef BLITSCROLLABLECONTAINER_HPP
+#define BLITSCROLLABLECONTAINER_HPP
+
+#include <touchgfx/containers/ScrollableContainer.hpp>
+
+/**
+ * A ScrollableContainer that scrolls by moving what the previous frame shows, and only
+ * draws the strips the scroll uncovers.
+ *
+ * ScrollableContainer moves its children with moveRelative(), which invalidates the old and
+ * new area of every child, so every drag step and every tick of a flick draws the whole
+ * viewport. A BlitScrollableContainer keeps the distance scrolled since the last frame
+ * instead. When the frame is drawn, FrontendApplication calls blitPendingScrolls(), which
+ * copies the viewport of the latest completed frame into the framebuffer being rendered,
+ * moved by that distance, with TouchGFXHAL::copyPreviousFrame(): one GPU2D or DMA2D
+ * copy. Then the uncovered strips, and where the copy moved any area that is redrawn
+ * anyway, are added to the dirty areas of the frame.
+ *
+ * The copy comes from the latest frame, not from the framebuffer being rendered, so it
+ * does not matter how many frames old the framebuffer is. The stale areas of the
+ * framebuffer that the copy already covers are dropped, and the moved viewport is damage
+ * of the frame for the framebuffers that miss it, see FrameDamageHistory.
+ *
+ * The pixels moved are those of the viewport, so the first child must be opaque over the
+ * whole viewport, like a Box as background of the content, and no other drawable may
+ * cover the container. Otherwise, in the simulator, and when the framebuffers cannot be
+ * copied, the container scrolls as a ScrollableContainer.
+ */
+class BlitScrollableContainer : public touchgfx::ScrollableContainer
+{
+public:
+    /** Scrolls of all containers since the last reset. */
+    struct Stats
+    {
+        uint32_t blits;     ///< Scrolls drawn by copying the previous frame
+        uint32_t fallbacks; ///< Scrolls that drew the whole viewport
+        uint32_t copied;    ///< Pixels copied
+        uint32_t uncovered; ///< Pixels of the strips drawn
+        uint32_t skipped;   ///< Stale areas of the framebuffer not brought up to date again
+    };
+
+    BlitScrollableContainer();
+
+    virtual ~BlitScrollableContainer();
+
+    virtual void moveChildrenRelative(int16_t deltaX, int16_t deltaY);
+
+    virtual void invalidateRect(touchgfx::Rect& invalidatedArea) const;
+
+    /**
+     * Copies the scrolled viewports of the previous frame and adds the areas left to draw.
+     * Called by FrontendApplication once the dirty areas of the frame are known, before
+     * anything is drawn.
+     *
+     * @param [in,out] dirtyAreas The areas to draw in the frame.
+     * @param [in,out] staleAreas The areas outdated in the framebuffer, from older frames.
+     * @param [in,out] movedAreas The areas whose pixels the copies moved.
+     */
+    static void blitPendingScrolls(touchgfx::Vector<touchgfx::Rect, 8>& dirtyAreas, touchgfx::Vector<touchgfx::Rect, 8>& staleAreas, touchgfx::Vector<touchgfx::Rect, 8>& movedAreas);
+
+    /**
+     * Gets the scroll statistics.
+     *
+     * @return The scroll statistics.
+     */
+    static const Stats& getStats()
+    {
+        return stats;
+    }
+
+    /**
+     * Resets the scroll statistics.
+     */
+    static void resetStats();
+
+private:
+    bool canBlit() const;
+    touchgfx::Rect viewport() const;
+    void blit(touchgfx::Vector<touchgfx::Rect, 8>& dirtyAreas, touchgfx::Vector<touchgfx::Rect, 8>& staleAreas, touchgfx::Vector<touchgfx::Rect, 8>& movedAreas, touchgfx::Rect& blitted);
+    void unlink();
+
+    touchgfx::Rect pendingViewport; ///< The viewport in the latest frame, in absolute coordinates
+    int16_t pendingX;               ///< Distance scrolled since the latest frame
+    int16_t pendingY;
+    bool pending;       ///< Copied in the next frame
+    bool scrollingSelf; ///< Invalidations come from moving the children
+    BlitScrollableContainer* nextPending;
+
+    static BlitScrollableContainer* firstPending;
+    static Stats stats;
+};
+
+#endif // BLITSCROLLABLECONTAINER_HPP
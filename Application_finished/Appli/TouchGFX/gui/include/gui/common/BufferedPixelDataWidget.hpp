@@ -0,0 +1,110 @@
+#ifndef BUFFEREDPIXELDATAWIDGET_HPP
+#define BUFFEREDPIXELDATAWIDGET_HPP
+
+#include <gui/common/TimerRegistry.hpp>
+#include <touchgfx/widgets/PixelDataWidget.hpp>
+
+/**
+ * Most buffers a BufferedPixelDataWidget cycles through.
+ */
+#ifndef BUFFERED_PIXEL_DATA_MAX_BUFFERS
+#define BUFFERED_PIXEL_DATA_MAX_BUFFERS 3
+#endif
+
+/**
+ * A PixelDataWidget whose pixels are written by another task, such as a camera, a remote
+ * framebuffer or a plotting engine, straight into the buffer drawn next.
+ *
+ * PixelDataWidget draws one buffer owned by the caller, so a producer must either write
+ * the buffer while it is drawn or write another one and copy it over between two frames.
+ * This widget cycles through two or three buffers of the size of the widget. The producer
+ * takes the buffer to write with acquire(), and hands it over with publish(). At the
+ * start of the next frame the widget draws the buffer published last, and the buffer it
+ * drew before is free for the producer again: TouchGFXHAL::beginFrame() has waited for
+ * GPU2D to complete the previous frame, the last one to read it, before the widgets tick.
+ *
+ * With two buffers the producer gets no buffer between publishing one and the frame that
+ * shows it, so it runs at the frame rate at most. With three buffers it never waits, and a
+ * buffer published while another is still waiting for a frame replaces it, which is then
+ * dropped and free again.
+ *
+ * Only the GUI task changes the buffer drawn, and only the producer the buffer published,
+ * so neither needs a lock, but there must be a single producer. publish() cleans the
+ * buffer from the data cache, as the CPU wrote it and GPU2D reads the memory. A producer
+ * writing the buffer with DMA must not leave lines of it in the data cache.
+ */
+class BufferedPixelDataWidget : public touchgfx::PixelDataWidget
+{
+public:
+    /** Buffers handed over by all buffered pixel data widgets since the last reset. */
+    struct Stats
+    {
+        uint32_t published; ///< Buffers published by the producers
+        uint32_t flipped;   ///< Buffers drawn for the first time at the start of a frame
+        uint32_t dropped;   ///< Buffers replaced by a newer one before they were drawn
+        uint32_t starved;   ///< Calls to acquire() that found no free buffer
+    };
+
+    BufferedPixelDataWidget();
+
+    /**
+     * Sets the buffers, each large enough for the pixels of the widget in the format of
+     * setBitmapFormat(), and draws the first one until a buffer is published. Called from
+     * the GUI task before the producer starts.
+     *
+     * @param [in] first  The first buffer, drawn until a buffer is published.
+     * @param [in] second The second buffer.
+     * @param [in] third  (Optional) The third buffer, 0 for double buffering.
+     */
+    void setBuffers(uint8_t* first, uint8_t* second, uint8_t* third = 0);
+
+    /**
+     * Takes a buffer for the producer to write, neither drawn nor published. The buffer
+     * acquired last and not published yet is returned again.
+     *
+     * @return The buffer, or 0 if none is free.
+     */
+    uint8_t* acquire();
+
+    /**
+     * Hands the buffer acquired over, to be drawn from the start of the next frame.
+     */
+    void publish();
+
+    /**
+     * Draws the buffer published last, if it is not drawn yet.
+     */
+    virtual void handleTickEvent();
+
+    /**
+     * Gets the statistics of the widgets.
+     *
+     * @return The statistics.
+     */
+    static const Stats& getStats()
+    {
+        return stats;
+    }
+
+    /**
+     * Resets the statistics of the widgets.
+     */
+    static void resetStats();
+
+private:
+    static const uint8_t NONE = 0xFF;
+
+    uint32_t bufferBytes() const;
+
+    uint8_t* buffers[BUFFERED_PIXEL_DATA_MAX_BUFFERS];
+    uint8_t count;
+    uint8_t front;                 ///< Buffer drawn, only written by the GUI task
+    uint8_t acquired;              ///< Buffer written, only used by the producer
+    volatile uint32_t latest;      ///< Publications << 8 | buffer, only written by the producer
+    volatile uint32_t flippedTo;   ///< Publications drawn, only written by the GUI task
+    TimerRegistry::Timer timer;
+
+    static Stats stats;
+};
+
+#endif // BUFFEREDPIXELDATAWIDGET_HPP
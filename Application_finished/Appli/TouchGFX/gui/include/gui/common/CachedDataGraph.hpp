@@ -0,0 +1,377 @@
+#ifndef CACHEDDATAGRAPH_HPP
+#define CACHEDDATAGRAPH_HPP
+
+#include <touchgfx/widgets/graph/Graph.hpp>
+#include <touchgfx/widgets/graph/GraphScroll.hpp>
+#include <touchgfx/widgets/graph/GraphWrapAndClear.hpp>
+#include <touchgfx/widgets/graph/GraphWrapAndOverwrite.hpp>
+
+/**
+ * The state of the screen coordinates cached by a graph, which of them are current and the
+ * graph area they were computed for.
+ */
+class GraphScreenCache
+{
+public:
+    /** Conversions of all cached graphs since the last reset. */
+    struct Stats
+    {
+        uint32_t batches; ///< Times the x or y coordinates of a whole graph were converted
+        uint32_t points;  ///< Coordinates converted in those batches
+        uint32_t updates; ///< Coordinates converted one at a time as data points were added
+    };
+
+    GraphScreenCache()
+        : xValid(false), yValid(false), bypassed(false), areaWidth(0), areaHeight(0), paddingLeft(0), paddingTop(0)
+    {
+    }
+
+    /** Marks the x coordinates stale, they are converted again when next looked up. */
+    void invalidateX()
+    {
+        xValid = false;
+    }
+
+    /** Marks the y coordinates stale, they are converted again when next looked up. */
+    void invalidateY()
+    {
+        yValid = false;
+    }
+
+    /**
+     * Marks the coordinates stale if the graph area or its padding changed since they were
+     * converted. setGraphAreaMargin() and setGraphAreaPadding() are not virtual, so the
+     * graph checks before it is drawn.
+     *
+     * @param graph The graph.
+     */
+    void checkArea(const touchgfx::AbstractDataGraph& graph);
+
+    /**
+     * Tells if the x coordinates are current.
+     *
+     * @return true if current.
+     */
+    bool isXValid() const
+    {
+        return xValid;
+    }
+
+    /**
+     * Tells if the y coordinates are current.
+     *
+     * @return true if current.
+     */
+    bool isYValid() const
+    {
+        return yValid;
+    }
+
+    /**
+     * Tells if the coordinates are looked up while the data changes, and must be converted
+     * from the data instead.
+     *
+     * @return true while the data changes.
+     */
+    bool isBypassed() const
+    {
+        return bypassed;
+    }
+
+    /**
+     * Starts or ends a change of the data.
+     *
+     * @param bypass true at the start of the change.
+     */
+    void setBypassed(bool bypass)
+    {
+        bypassed = bypass;
+    }
+
+    /**
+     * Marks the x coordinates current after converting them.
+     *
+     * @param count Number of coordinates converted.
+     */
+    void xConverted(uint16_t count)
+    {
+        xValid = true;
+        stats.batches++;
+        stats.points += count;
+    }
+
+    /**
+     * Marks the y coordinates current after converting them.
+     *
+     * @param count Number of coordinates converted.
+     */
+    void yConverted(uint16_t count)
+    {
+        yValid = true;
+        stats.batches++;
+        stats.points += count;
+    }
+
+    /** Counts a coordinate converted as its data point was added. */
+    static void countUpdate()
+    {
+        stats.updates++;
+    }
+
+    /**
+     * Gets the conversion statistics.
+     *
+     * @return The conversion statistics.
+     */
+    static const Stats& getStats()
+    {
+        return stats;
+    }
+
+    /** Resets the conversion statistics. */
+    static void resetStats();
+
+private:
+    bool xValid;
+    bool yValid;
+    bool bypassed;
+    int16_t areaWidth; ///< Of the graph area, padding excluded, the coordinates are for
+    int16_t areaHeight;
+    int16_t paddingLeft;
+    int16_t paddingTop;
+
+    static Stats stats;
+};
+
+/**
+ * A graph that converts its data points to screen coordinates in batches and keeps them,
+ * instead of converting every point again whenever it is looked up.
+ *
+ * The graph elements ask the graph for the screen coordinates of every visible point each
+ * time they are drawn or invalidated, a line, an area and dots on the same graph each
+ * once per invalidated rectangle, and every lookup is a scaled conversion with a 64-bit
+ * division. A cached graph converts all its points once into an array of Q5 coordinates
+ * that every element on the graph reads, the canvas and vector elements alike, and only
+ * converts them again when the data, the range, the scale or the graph area changes. The
+ * coordinates are the graph's own conversions, so they are the same to the bit as without
+ * the cache, and the invalidated areas match what is drawn.
+ *
+ * The labels and grid lines convert their tick values, not data points, and are not
+ * cached.
+ *
+ * @tparam T        The graph.
+ * @tparam CAPACITY The capacity of the graph.
+ */
+template <class T, int16_t CAPACITY>
+class CachedDataGraph : public T
+{
+public:
+    virtual void setWidth(int16_t width)
+    {
+        T::setWidth(width);
+        cache.invalidateX();
+    }
+
+    virtual void setHeight(int16_t height)
+    {
+        T::setHeight(height);
+        cache.invalidateY();
+    }
+
+    virtual void setGraphRangeXScaled(int min, int max)
+    {
+        T::setGraphRangeXScaled(min, max);
+        cache.invalidateX();
+    }
+
+    virtual void setGraphRangeYScaled(int min, int max)
+    {
+        T::setGraphRangeYScaled(min, max);
+        cache.invalidateY();
+    }
+
+    virtual void setScaleX(int scale, bool updateData = false)
+    {
+        T::setScaleX(scale, updateData);
+        cache.invalidateX();
+    }
+
+    virtual void setScaleY(int scale, bool updateData = false)
+    {
+        T::setScaleY(scale, updateData);
+        cache.invalidateY();
+    }
+
+    virtual void clear()
+    {
+        T::clear();
+        cache.invalidateY();
+    }
+
+protected:
+    virtual void setupDrawChain(const touchgfx::Rect& invalidatedArea, touchgfx::Drawable** nextPreviousElement)
+    {
+        cache.checkArea(*this);
+        T::setupDrawChain(invalidatedArea, nextPreviousElement);
+    }
+
+    mutable GraphScreenCache cache;
+    mutable touchgfx::CWRUtil::Q5 screenX[CAPACITY];
+    mutable touchgfx::CWRUtil::Q5 screenY[CAPACITY];
+};
+
+/**
+ * A touchgfx::GraphScroll, touchgfx::GraphWrapAndClear or touchgfx::GraphWrapAndOverwrite
+ * with cached screen coordinates, such as CachedDynamicGraph<touchgfx::GraphScroll, 100>.
+ *
+ * The x coordinate of a point only depends on its index, so the x coordinates are kept by
+ * index and only converted again when the x range or the width changes. The y coordinates
+ * are kept by the slot of the value in the data, so a point added converts one coordinate:
+ * when a full scrolling graph moves every point one index to the left, the points keep
+ * their slots and coordinates.
+ *
+ * @tparam G        The graph.
+ * @tparam CAPACITY The capacity of the graph.
+ */
+template <template <int16_t> class G, int16_t CAPACITY>
+class CachedDynamicGraph : public CachedDataGraph<G<CAPACITY>, CAPACITY>
+{
+    typedef CachedDataGraph<G<CAPACITY>, CAPACITY> Base;
+
+protected:
+    virtual int16_t addValue(int value)
+    {
+        // The elements invalidate the point as it is added, from the data
+        Base::cache.setBypassed(true);
+        const int16_t slot = Base::addValue(value); // The slot of the value in yValues
+        Base::cache.setBypassed(false);
+        if (Base::cache.isYValid() && slot >= 0)
+        {
+            Base::screenY[slot] = Base::valueToScreenYQ5(this->yValues[slot]);
+            GraphScreenCache::countUpdate();
+        }
+        return slot;
+    }
+
+    virtual touchgfx::CWRUtil::Q5 indexToScreenXQ5(int16_t index) const
+    {
+        if (Base::cache.isBypassed())
+        {
+            return Base::indexToScreenXQ5(index);
+        }
+        if (!Base::cache.isXValid())
+        {
+            for (int16_t i = 0; i < CAPACITY; i++)
+            {
+                Base::screenX[i] = Base::indexToScreenXQ5(i);
+            }
+            Base::cache.xConverted(CAPACITY);
+        }
+        return Base::screenX[index];
+    }
+
+    virtual touchgfx::CWRUtil::Q5 indexToScreenYQ5(int16_t index) const
+    {
+        if (Base::cache.isBypassed())
+        {
+            return Base::indexToScreenYQ5(index);
+        }
+        if (!Base::cache.isYValid())
+        {
+            // The used slots are the first ones, also once a scrolling graph is full
+            const int16_t used = this->usedCapacity;
+            for (int16_t slot = 0; slot < used; slot++)
+            {
+                Base::screenY[slot] = Base::valueToScreenYQ5(this->yValues[slot]);
+            }
+            Base::cache.yConverted(used);
+        }
+        return Base::screenY[this->dataIndex(index)];
+    }
+};
+
+/**
+ * A touchgfx::Graph with cached screen coordinates.
+ *
+ * The points are kept sorted by x, so a point added or deleted moves the points after it
+ * to other indices. The coordinates are then converted again, all at once, when they are
+ * next looked up, which is at most once per frame however many points were added.
+ *
+ * @tparam CAPACITY The capacity of the graph.
+ */
+template <int16_t CAPACITY>
+class CachedGraph : public CachedDataGraph<touchgfx::Graph<CAPACITY>, CAPACITY>
+{
+    typedef CachedDataGraph<touchgfx::Graph<CAPACITY>, CAPACITY> Base;
+
+protected:
+    virtual int16_t addValue(int xvalue, int yvalue)
+    {
+        Base::cache.setBypassed(true);
+        const int16_t index = Base::addValue(xvalue, yvalue);
+        dataChanged();
+        return index;
+    }
+
+    virtual int16_t deleteValue(int xvalue)
+    {
+        Base::cache.setBypassed(true);
+        const int16_t index = Base::deleteValue(xvalue);
+        dataChanged();
+        return index;
+    }
+
+    virtual int16_t deleteIndex(int index)
+    {
+        Base::cache.setBypassed(true);
+        const int16_t deleted = Base::deleteIndex(index);
+        dataChanged();
+        return deleted;
+    }
+
+    virtual touchgfx::CWRUtil::Q5 indexToScreenXQ5(int16_t index) const
+    {
+        if (Base::cache.isBypassed())
+        {
+            return Base::indexToScreenXQ5(index);
+        }
+        if (!Base::cache.isXValid())
+        {
+            const int16_t used = this->usedCapacity;
+            for (int16_t i = 0; i < used; i++)
+            {
+                Base::screenX[i] = Base::valueToScreenXQ5(this->xValues[i]);
+            }
+            Base::cache.xConverted(used);
+        }
+        return Base::screenX[index];
+    }
+
+    virtual touchgfx::CWRUtil::Q5 indexToScreenYQ5(int16_t index) const
+    {
+        if (Base::cache.isBypassed())
+        {
+            return Base::indexToScreenYQ5(index);
+        }
+        if (!Base::cache.isYValid())
+        {
+            const int16_t used = this->usedCapacity;
+            for (int16_t i = 0; i < used; i++)
+            {
+                Base::screenY[i] = Base::valueToScreenYQ5(this->yValues[i]);
+            }
+            Base::cache.yConverted(used);
+        }
+        return Base::screenY[index];
+    }
+
+private:
+    void dataChanged()
+    {
+        Base::cache.setBypassed(false);
+        Base::cache.invalidateX();
+        Base::cache.invalidateY();
+    }
+};
+
+#endif // CACHEDDATAGRAPH_HPP
@@ -0,0 +1,194 @@
+#ifndef CACHEDLISTITEM_HPP
+#define CACHEDLISTITEM_HPP
+
+#include <gui/common/DynamicBitmapArena.hpp>
+#include <touchgfx/containers/Container.hpp>
+#include <touchgfx/widgets/Widget.hpp>
+
+/**
+ * Largest bitmap in bytes a list item is rendered into. Larger items are always drawn from
+ * their children.
+ */
+#ifndef LIST_ITEM_CACHE_MAX_BYTES
+#define LIST_ITEM_CACHE_MAX_BYTES (256 * 1024)
+#endif
+
+/**
+ * The rendered image of a list item, drawn in its place while the content of the item is
+ * unchanged. Used by CachedListItem.
+ *
+ * The item is rendered into a bitmap in DynamicBitmapArena the tick after it was drawn from
+ * its children, if its content did not change since. Items whose first child is opaque over
+ * the whole item, like a Box as background, are rendered in the framebuffer format and
+ * drawn opaque. Other items are rendered into ARGB8888 and blended, which needs GPU2D, see
+ * TouchGFXHAL::canDrawInDynamicBitmap(), so in the simulator and while rendering in
+ * software they are always drawn from their children.
+ */
+class ListItemCache : public touchgfx::Widget
+{
+public:
+    /** Drawing of all list items since the last reset. */
+    struct Stats
+    {
+        uint32_t blits;    ///< Draws from the bitmap
+        uint32_t live;     ///< Draws from the children
+        uint32_t renders;  ///< Times an item was rendered into its bitmap
+        uint32_t noMemory; ///< Renders that found no room for the bitmap
+    };
+
+    /**
+     * Constructor.
+     *
+     * @param [in] owner The item the cache draws.
+     */
+    explicit ListItemCache(touchgfx::Container& owner);
+
+    virtual ~ListItemCache();
+
+    /**
+     * Enables or disables the bitmap, enabled by default. Disabling it releases the bitmap.
+     *
+     * @param enable true to render the item once its content is unchanged.
+     */
+    void setCaching(bool enable);
+
+    /**
+     * Tells if the item is drawn from the bitmap.
+     *
+     * @return true if the bitmap matches the content and size of the item.
+     */
+    bool isCached() const;
+
+    /** Tells the cache the content of the item changed. */
+    void contentChanged() const
+    {
+        stale = true;
+        changes++;
+    }
+
+    /**
+     * Puts the cache in the draw chain, in place of the children of the item.
+     *
+     * @param          invalidatedArea     The area to draw, relative to the item.
+     * @param [in,out] nextPreviousElement The draw chain.
+     */
+    virtual void setupDrawChain(const touchgfx::Rect& invalidatedArea, touchgfx::Drawable** nextPreviousElement);
+
+    /**
+     * Counts a draw of the item from its children, and renders it at the next tick if the
+     * content is unchanged by then.
+     */
+    void drawnLive() const;
+
+    virtual void draw(const touchgfx::Rect& invalidatedArea) const;
+
+    virtual touchgfx::Rect getSolidRect() const;
+
+    virtual void handleTickEvent();
+
+    /**
+     * Gets the drawing statistics.
+     *
+     * @return The drawing statistics.
+     */
+    static const Stats& getStats()
+    {
+        return stats;
+    }
+
+    /**
+     * Resets the drawing statistics.
+     */
+    static void resetStats();
+
+private:
+    bool isOpaque() const;
+    touchgfx::Bitmap::BitmapFormat renderFormat() const;
+    bool canRender() const;
+    void render();
+    void release();
+    void bitmapMoved(touchgfx::BitmapId oldId, touchgfx::BitmapId newId);
+
+    touchgfx::Container& item;
+    touchgfx::Callback<ListItemCache, touchgfx::BitmapId, touchgfx::BitmapId> bitmapMovedCallback;
+    touchgfx::BitmapId bitmap;
+    mutable uint32_t changes;        ///< Content changes so far
+    mutable uint32_t pendingChanges; ///< Content changes when drawn live, rendered if unchanged a tick later
+    mutable bool stale;              ///< The content changed since the item was rendered
+    mutable bool ticking;
+    bool caching;
+    bool rendering; ///< Drawing the children into the bitmap
+    bool opaque;    ///< The bitmap is in the framebuffer format
+
+    static Stats stats;
+};
+
+/**
+ * A list item drawn as one blit of its rendered image, for the items of ScrollList,
+ * ScrollWheel and DrawableList.
+ *
+ * DrawableList only calls the update callback for the items it recycles, but every item in
+ * view is drawn again from its children in every frame of a scroll. Wrapping the item type,
+ * as in DrawableListItems<CachedListItem<MenuItem>, 8>, draws every item whose content did
+ * not change since the previous tick from its image in DynamicBitmapArena: the scroll moves
+ * images, a GPU2D blit per item, and only recycled items and items whose children were
+ * invalidated are drawn from their children, and rendered again the tick after.
+ *
+ * Moving the item does not change its content, so moves must be done with moveTo(), as
+ * DrawableList does.
+ *
+ * @tparam T The item, a Container.
+ */
+template <class T>
+class CachedListItem : public T
+{
+public:
+    CachedListItem()
+        : T(), cache(*this), movingSelf(false)
+    {
+    }
+
+    virtual void moveTo(int16_t x, int16_t y)
+    {
+        movingSelf = true;
+        T::moveTo(x, y);
+        movingSelf = false;
+    }
+
+    virtual void invalidateRect(touchgfx::Rect& invalidatedArea) const
+    {
+        if (!movingSelf)
+        {
+            cache.contentChanged();
+        }
+        T::invalidateRect(invalidatedArea);
+    }
+
+    /**
+     * Gets the cache of the item.
+     *
+     * @return The cache.
+     */
+    ListItemCache& getCache()
+    {
+        return cache;
+    }
+
+protected:
+    virtual void setupDrawChain(const touchgfx::Rect& invalidatedArea, touchgfx::Drawable** nextPreviousElement)
+    {
+        if (cache.isCached())
+        {
+            cache.setupDrawChain(invalidatedArea, nextPreviousElement);
+            return;
+        }
+        cache.drawnLive();
+        T::setupDrawChain(invalidatedArea, nextPreviousElement);
+    }
+
+private:
+    ListItemCache cache;
+    bool movingSelf; ///< Invalidations come from moving, not from the children
+};
+
+#endif // CACHEDLISTITEM_HPP
@@ -0,0 +1,99 @@
+#ifndef CACHEDMODALWINDOW_HPP
+#define CACHEDMODALWINDOW_HPP
+
+#include <gui/common/DynamicBitmapArena.hpp>
+#include <gui/common/TimerRegistry.hpp>
+#include <touchgfx/Callback.hpp>
+#include <touchgfx/containers/ModalWindow.hpp>
+#include <touchgfx/widgets/Image.hpp>
+
+/**
+ * A ModalWindow that draws the dimmed screen behind it from a bitmap captured when it
+ * opens.
+ *
+ * ModalWindow covers the screen with a semi-transparent Box, so every area invalidated
+ * while it is open, even inside the window, draws the widgets behind it and blends the
+ * shade over them. show() instead renders the container the window is in, with the shade
+ * over it and without the window, into a bitmap in DynamicBitmapArena in the framebuffer
+ * format, and draws that opaque bitmap in place of the shade until hide(). Areas
+ * invalidated while the window is open are copied from the bitmap, the widgets behind
+ * are not drawn and nothing is blended.
+ *
+ * The bitmap does not follow changes behind the window: call backgroundChanged() to
+ * capture it again in the next tick. Changing the shade does so as well. Capturing needs
+ * GPU2D, see TouchGFXHAL::canDrawInDynamicBitmap(). In the simulator, while rendering in
+ * software, or without room in the arena, the shade is drawn as by ModalWindow.
+ */
+class CachedModalWindow : public touchgfx::ModalWindow
+{
+public:
+    /** Rendering of all cached modal windows since the last reset. */
+    struct Stats
+    {
+        uint32_t captures;    ///< Dimmed backgrounds captured
+        uint32_t unavailable; ///< Captures not done without GPU2D
+        uint32_t noMemory;    ///< Captures that found no room for their bitmap
+    };
+
+    CachedModalWindow();
+
+    virtual ~CachedModalWindow();
+
+    /**
+     * Sets the container the window is in, usually the root container of the screen,
+     * which is rendered behind the window.
+     *
+     * @param [in] container The container.
+     */
+    void setBackgroundContainer(touchgfx::Container& container);
+
+    virtual void setShadeAlpha(uint8_t alpha);
+
+    virtual void setShadeColor(touchgfx::colortype color);
+
+    /** Shows the window and captures the dimmed background. */
+    virtual void show();
+
+    /** Hides the window and releases the dimmed background. */
+    virtual void hide();
+
+    /**
+     * Captures the dimmed background again in the next tick, after the screen behind the
+     * window changed.
+     */
+    void backgroundChanged();
+
+    /** Captures the dimmed background when it is out of date. */
+    virtual void handleTickEvent();
+
+    /**
+     * Gets the rendering statistics.
+     *
+     * @return The rendering statistics.
+     */
+    static const Stats& getStats()
+    {
+        return stats;
+    }
+
+    /**
+     * Resets the rendering statistics.
+     */
+    static void resetStats();
+
+private:
+    bool canRender() const;
+    bool capture();
+    void release();
+    void bitmapMoved(touchgfx::BitmapId oldId, touchgfx::BitmapId newId);
+
+    touchgfx::Image dimmed;     ///< The captured background, in place of the shade
+    TimerRegistry::Timer timer; ///< Runs while the dimmed background is out of date
+    touchgfx::Callback<CachedModalWindow, touchgfx::BitmapId, touchgfx::BitmapId> bitmapMovedCallback;
+    touchgfx::Container* background;
+    touchgfx::BitmapId cached;
+
+    static Stats stats;
+};
+
+#endif // CACHEDMODALWINDOW_HPP
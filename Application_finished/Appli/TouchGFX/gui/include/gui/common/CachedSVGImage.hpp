@@ -0,0 +1,116 @@
+#ifndef CACHEDSVGIMAGE_HPP
+#define CACHEDSVGIMAGE_HPP
+
+#include <gui/common/DynamicBitmapArena.hpp>
+#include <touchgfx/widgets/SVGImage.hpp>
+
+/**
+ * Largest bitmap in bytes an SVG is rasterized into, four per pixel of the widget. Larger
+ * images are drawn from their paths.
+ */
+#ifndef CACHED_SVG_IMAGE_MAX_BYTES
+#define CACHED_SVG_IMAGE_MAX_BYTES (256 * 1024)
+#endif
+
+/**
+ * An SVGImage drawn from a bitmap while its scale, rotation and position do not change.
+ *
+ * The imageconverter stores SVGs as the commands and points of their paths, so SVGImage
+ * does not parse anything, but GPU2D still has to fill and stroke every path each time the
+ * image is drawn. A CachedSVGImage that was drawn unchanged for a tick rasterizes the SVG
+ * once into an ARGB8888 bitmap in DynamicBitmapArena, and from then on is drawn with a
+ * single blit, as cheap as an image. As long as the transformation changes from one tick
+ * to the next, the paths are drawn as by SVGImage, and the bitmap is not rendered again
+ * until the image is still.
+ *
+ * Rasterizing needs GPU2D, see TouchGFXHAL::canDrawInDynamicBitmap(), so the simulator and
+ * the software renderers always draw the paths.
+ */
+class CachedSVGImage : public touchgfx::SVGImage
+{
+public:
+    /** Drawing of all cached SVG images since the last reset. */
+    struct Stats
+    {
+        uint32_t blits;      ///< Draws from the bitmap
+        uint32_t paths;      ///< Draws from the paths
+        uint32_t rasterized; ///< Times an SVG was rasterized
+        uint32_t noMemory;   ///< Rasterizations that found no room for the bitmap
+    };
+
+    CachedSVGImage();
+
+    virtual ~CachedSVGImage();
+
+    virtual void setSVG(uint16_t id);
+
+    /**
+     * Enables or disables the bitmap, enabled by default. Disabling it releases the bitmap.
+     *
+     * @param enable true to rasterize the SVG once it is still.
+     */
+    void setCaching(bool enable);
+
+    /**
+     * Tells if the image is drawn from a bitmap.
+     *
+     * @return true if the bitmap matches the current transformation.
+     */
+    bool isRasterized() const;
+
+    virtual void draw(const touchgfx::Rect& invalidatedArea) const;
+
+    virtual void handleTickEvent();
+
+    /**
+     * Gets the drawing statistics.
+     *
+     * @return The drawing statistics.
+     */
+    static const Stats& getStats()
+    {
+        return stats;
+    }
+
+    /**
+     * Resets the drawing statistics.
+     */
+    static void resetStats();
+
+private:
+    /** Everything the rasterized pixels depend on. */
+    struct Key
+    {
+        uint16_t svgId;
+        int16_t width;
+        int16_t height;
+        float scaleX;
+        float scaleY;
+        float rotation;
+        float rotationCenterX;
+        float rotationCenterY;
+        float imagePositionX;
+        float imagePositionY;
+
+        bool operator==(const Key& other) const;
+    };
+
+    Key currentKey() const;
+    bool canRasterize() const;
+    void rasterize();
+    void release();
+    void schedule() const;
+    void bitmapMoved(touchgfx::BitmapId oldId, touchgfx::BitmapId newId);
+
+    touchgfx::Callback<CachedSVGImage, touchgfx::BitmapId, touchgfx::BitmapId> bitmapMovedCallback;
+    touchgfx::BitmapId bitmap;
+    Key rasterizedKey;      ///< The transformation the bitmap was rendered with
+    mutable Key pendingKey; ///< The transformation drawn from paths, rasterized if still a tick later
+    mutable bool ticking;
+    bool caching;
+    bool rasterizing; ///< Drawing the paths into the bitmap
+
+    static Stats stats;
+};
+
+#endif // CACHEDSVGIMAGE_HPP
@@ -0,0 +1,133 @@
+#ifndef CACHEDSWIPECONTAINER_HPP
+#define CACHEDSWIPECONTAINER_HPP
+
+#include <gui/common/DynamicBitmapArena.hpp>
+#include <touchgfx/containers/SwipeContainer.hpp>
+#include <touchgfx/widgets/Widget.hpp>
+
+/**
+ * Ticks without a change to the pages, and without the pages moving, before the current
+ * and adjacent pages are rendered into their bitmaps, one page per tick.
+ */
+#ifndef CACHED_SWIPE_IDLE_TICKS
+#define CACHED_SWIPE_IDLE_TICKS 10
+#endif
+
+/**
+ * A SwipeContainer that draws a swipe as blits of its pages rendered into bitmaps, instead
+ * of drawing the current and the next page from their widgets in every frame.
+ *
+ * Once the container is idle for CACHED_SWIPE_IDLE_TICKS, the current page and the pages
+ * on either side are rendered into bitmaps in DynamicBitmapArena, one page per tick. While
+ * the pages are dragged or animated, and the bitmaps of the pages in view are up to date,
+ * the pages are drawn as one GPU2D blit per page in view, two during a swipe. At rest the
+ * pages are drawn from their widgets as usual.
+ *
+ * Invalidating a part of a page marks its bitmap out of date, and the page is drawn from
+ * its widgets until it is rendered again. Pages out of view may not pass their
+ * invalidations on, so a page that changes while out of view must be reported with
+ * pageChanged(). Pages whose first child is opaque over the whole page, like a Box or an
+ * Image as background, are rendered in the framebuffer format. Other pages are rendered
+ * into ARGB8888, which needs GPU2D, see TouchGFXHAL::canDrawInDynamicBitmap(), so in the
+ * simulator and while rendering in software they are always drawn from their widgets.
+ */
+class CachedSwipeContainer : public touchgfx::SwipeContainer
+{
+public:
+    /** Drawing of all containers since the last reset. */
+    struct Stats
+    {
+        uint32_t blits;    ///< Pages drawn from their bitmap
+        uint32_t live;     ///< Frames of a swipe drawn from the widgets of the pages
+        uint32_t renders;  ///< Pages rendered into their bitmap
+        uint32_t noMemory; ///< Renders that found no room for the bitmap
+    };
+
+    CachedSwipeContainer();
+
+    virtual ~CachedSwipeContainer();
+
+    virtual void handleTickEvent();
+    virtual void handleClickEvent(const touchgfx::ClickEvent& event);
+    virtual void handleDragEvent(const touchgfx::DragEvent& event);
+    virtual void handleGestureEvent(const touchgfx::GestureEvent& event);
+    virtual void remove(touchgfx::Drawable& page);
+    virtual void invalidateRect(touchgfx::Rect& invalidatedArea) const;
+
+    /**
+     * Marks the bitmap of a page out of date.
+     *
+     * @param page The index of the page that changed.
+     */
+    void pageChanged(uint8_t page);
+
+    /**
+     * Gets the drawing statistics.
+     *
+     * @return The drawing statistics.
+     */
+    static const Stats& getStats()
+    {
+        return stats;
+    }
+
+    /**
+     * Resets the drawing statistics.
+     */
+    static void resetStats();
+
+protected:
+    virtual void setupDrawChain(const touchgfx::Rect& invalidatedArea, touchgfx::Drawable** nextPreviousElement);
+
+private:
+    /** A page rendered into a bitmap. */
+    struct Texture
+    {
+        touchgfx::BitmapId bitmap;
+        int16_t page; ///< The index of the page, or -1
+        bool stale;   ///< The page changed since it was rendered
+    };
+
+    /** Draws the bitmaps in place of the pages. */
+    class Textures : public touchgfx::Widget
+    {
+    public:
+        explicit Textures(CachedSwipeContainer& owner);
+
+        virtual void setupDrawChain(const touchgfx::Rect& invalidatedArea, touchgfx::Drawable** nextPreviousElement);
+        virtual void draw(const touchgfx::Rect& invalidatedArea) const;
+        virtual touchgfx::Rect getSolidRect() const;
+
+    private:
+        const CachedSwipeContainer& container;
+    };
+
+    static const uint8_t NUM_TEXTURES = 3; ///< The current page and the pages on either side
+
+    touchgfx::Drawable* layout() const;
+    touchgfx::Drawable* page(int16_t index) const;
+    touchgfx::Rect pageRect(const touchgfx::Drawable& drawable) const;
+    bool atRest() const;
+    const Texture* find(int16_t index) const;
+    bool isCached(int16_t index) const;
+    bool drawnFromTextures() const;
+    void changed(const touchgfx::Rect& area) const;
+    bool isOpaque(touchgfx::Drawable& drawable) const;
+    bool canRender(touchgfx::Drawable& drawable, touchgfx::Bitmap::BitmapFormat format) const;
+    void renderNext();
+    void render(Texture& texture, int16_t index);
+    void release(Texture& texture);
+    void bitmapMoved(touchgfx::BitmapId oldId, touchgfx::BitmapId newId);
+
+    Textures textures;
+    touchgfx::Callback<CachedSwipeContainer, touchgfx::BitmapId, touchgfx::BitmapId> bitmapMovedCallback;
+    mutable Texture cache[NUM_TEXTURES];
+    mutable uint16_t idleTicks; ///< Ticks since the pages last changed or moved
+    mutable bool noMemory;      ///< A render found no room, not tried again until something changes
+    bool pressed;
+    bool movingSelf; ///< Invalidations come from moving the pages, not from their content
+
+    static Stats stats;
+};
+
+#endif // CACHEDSWIPECONTAINER_HPP
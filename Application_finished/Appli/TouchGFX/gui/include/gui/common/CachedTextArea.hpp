@@ -0,0 +1,99 @@
+#ifndef CACHEDTEXTAREA_HPP
+#define CACHEDTEXTAREA_HPP
+
+#include <gui/common/DynamicBitmapArena.hpp>
+#include <touchgfx/widgets/TextArea.hpp>
+
+/**
+ * Largest mask in bytes a text area is rendered into, one per pixel of the widget. Larger
+ * text areas are drawn glyph by glyph every time.
+ */
+#ifndef TEXT_CACHE_MAX_BYTES
+#define TEXT_CACHE_MAX_BYTES (64 * 1024)
+#endif
+
+/**
+ * A TextArea for a static text that is rendered once into an A8 mask and then drawn with
+ * one blit.
+ *
+ * A TextArea over an animated widget, like a label over textureMapper1 of Screen1, draws
+ * its string glyph by glyph every time anything under it changes: LCD::drawString() lays
+ * the text out again and every glyph is a blit or a glyph atlas quad. Once its text has
+ * been drawn twice in a row unchanged, this text area renders the coverage of all its
+ * glyphs into a mask in DynamicBitmapArena, one byte per pixel of the widget, with
+ * TouchGFXHAL::renderStringMask(), and from then on is drawn with
+ * TouchGFXHAL::drawA8Mask(), a single GPU2D blit colorized with the color and alpha of the
+ * widget.
+ *
+ * The mask is rendered again when the text, the language, the font or the layout of the
+ * text changes, which is compared through a signature, see signature(). The color and the
+ * alpha are applied by the blit, so changing them does not render the mask again, nor does
+ * moving the widget. Only unrotated text areas entirely on the display in the rotate0
+ * orientation, with 4bpp or 8bpp bitmap fonts, are rendered into a mask. Others, and the
+ * simulator, draw as TextArea.
+ */
+class CachedTextArea : public touchgfx::TextArea
+{
+public:
+    /** Drawing of all cached text areas since the last reset. */
+    struct Stats
+    {
+        uint32_t blits;    ///< Draws from a mask
+        uint32_t renders;  ///< Times a text was rendered into a mask
+        uint32_t uncached; ///< Draws glyph by glyph
+        uint32_t noMemory; ///< Renders that found no room for the mask
+    };
+
+    CachedTextArea();
+
+    virtual ~CachedTextArea();
+
+    /**
+     * Enables or disables the mask, enabled by default. Disabling it releases the mask.
+     *
+     * @param enable true to draw the text from a mask once it is unchanged.
+     */
+    void setCaching(bool enable);
+
+    /**
+     * Tells if the text is drawn from the mask.
+     *
+     * @return true if the mask matches the text and layout of the widget.
+     */
+    bool isCached() const;
+
+    virtual void draw(const touchgfx::Rect& area) const;
+
+    /**
+     * Gets the drawing statistics.
+     *
+     * @return The drawing statistics.
+     */
+    static const Stats& getStats()
+    {
+        return stats;
+    }
+
+    /**
+     * Resets the drawing statistics.
+     */
+    static void resetStats();
+
+private:
+    uint32_t signature() const;
+    bool canCache() const;
+    bool render(uint32_t textSignature) const;
+    void release() const;
+    void bitmapMoved(touchgfx::BitmapId oldId, touchgfx::BitmapId newId);
+
+    mutable touchgfx::Callback<CachedTextArea, touchgfx::BitmapId, touchgfx::BitmapId> bitmapMovedCallback;
+    mutable touchgfx::BitmapId bitmap;
+    mutable uint32_t renderedSignature; ///< The text the mask was rendered with
+    mutable uint32_t pendingSignature;  ///< The text of the previous draw
+    mutable uint32_t rejectedSignature; ///< A text that cannot be rendered into a mask
+    bool caching;
+
+    static Stats stats;
+};
+
+#endif // CACHEDTEXTAREA_HPP
@@ -0,0 +1,173 @@
+#ifndef CANVASBUFFERPOOL_HPP
+#define CANVASBUFFERPOOL_HPP
+
+#include <touchgfx/canvas_widget_renderer/CanvasWidgetRenderer.hpp>
+#include <touchgfx/hal/HAL.hpp>
+#include <touchgfx/widgets/canvas/Circle.hpp>
+
+/**
+ * Size in bytes of the CanvasWidgetRenderer buffer in internal RAM that canvas widgets are
+ * normally drawn with, 8 bytes per Cell.
+ */
+#ifndef CANVAS_BUFFER_SIZE
+#define CANVAS_BUFFER_SIZE (12 * 1024)
+#endif
+
+/**
+ * Size in bytes of the scratch buffer in PSRAM that canvas widgets whose outline did not
+ * fit in the normal buffer are drawn with, 0 for none.
+ */
+#ifndef CANVAS_SCRATCH_SIZE
+#define CANVAS_SCRATCH_SIZE (256 * 1024)
+#endif
+
+/**
+ * Set to 1 to measure the Cells every canvas widget draw uses. The buffer is filled before
+ * and scanned after each draw, so only worth it while sizing CANVAS_BUFFER_SIZE.
+ */
+#ifndef CANVAS_BUFFER_AUTO_TUNE
+#define CANVAS_BUFFER_AUTO_TUNE 0
+#endif
+
+/**
+ * The buffers that canvas widgets are drawn with, and what drawing them cost.
+ *
+ * When the outline of a canvas widget does not fit in the CanvasWidgetRenderer buffer,
+ * CanvasWidget::draw() halves the area and draws it again, until every slice fits. Each
+ * slice goes over the whole outline again, so a large Circle drawn in four slices costs
+ * four times as much, and nothing but the simulator memory report tells. Widgets drawn as
+ * PooledCanvasWidget count the slices they are drawn in. A widget that needed more than
+ * one is drawn with the scratch buffer in PSRAM from then on, in one pass, while the others
+ * keep the faster buffer in internal RAM.
+ *
+ * With CANVAS_BUFFER_AUTO_TUNE, the peak number of Cells of every widget and of all
+ * widgets is measured, and widgets that need more Cells than the normal buffer holds are
+ * drawn with the scratch buffer before they ever split.
+ */
+class CanvasBufferPool
+{
+public:
+    /** Canvas widget draws since the last reset. */
+    struct Stats
+    {
+        uint32_t draws;        ///< Calls to CanvasWidget::draw()
+        uint32_t passes;       ///< Outlines rendered, one per slice
+        uint32_t extraPasses;  ///< Passes more than one per draw
+        uint32_t scratchDraws; ///< Draws with the scratch buffer
+        uint32_t incomplete;   ///< Passes that did not fit on a single line
+        uint32_t peakCells;    ///< Most Cells used by a pass, with CANVAS_BUFFER_AUTO_TUNE
+    };
+
+    /** What drawing one widget cost. */
+    struct Usage
+    {
+        Usage()
+            : draws(0), extraPasses(0), peakCells(0), passes(0), useScratch(false)
+        {
+        }
+
+        uint32_t draws;
+        uint32_t extraPasses; ///< Passes more than one per draw
+        uint32_t peakCells;   ///< Most Cells used by a pass, with CANVAS_BUFFER_AUTO_TUNE
+        uint16_t passes;      ///< Passes of the draw in progress
+        bool useScratch;      ///< Drawn with the scratch buffer
+    };
+
+    /**
+     * Sets up the normal buffer as the CanvasWidgetRenderer buffer.
+     */
+    static void init();
+
+    /**
+     * Picks the buffer to draw a widget with. Called before CanvasWidget::draw().
+     *
+     * @param [in,out] usage The usage of the widget.
+     */
+    static void beginDraw(Usage& usage);
+
+    /**
+     * Counts a pass over the outline of the widget being drawn.
+     *
+     * @param [in,out] usage The usage of the widget.
+     * @param          done  false if the outline did not fit.
+     * @param          lines The height of the area of the pass.
+     */
+    static void pass(Usage& usage, bool done, int16_t lines);
+
+    /**
+     * Measures the buffer use and restores the normal buffer. Called after
+     * CanvasWidget::draw().
+     *
+     * @param [in,out] usage The usage of the widget.
+     */
+    static void endDraw(Usage& usage);
+
+    /**
+     * Gets the draw statistics.
+     *
+     * @return The draw statistics.
+     */
+    static const Stats& getStats()
+    {
+        return stats;
+    }
+
+    /**
+     * Resets the draw statistics.
+     */
+    static void resetStats();
+
+    /**
+     * Prints the draw statistics with touchgfx_printf() and resets them.
+     */
+    static void report();
+
+private:
+    static uint32_t measureCells();
+
+    static Stats stats;
+    static bool drawing; ///< A widget is being drawn, draws are not nested
+};
+
+/**
+ * A canvas widget that counts the passes it is drawn in, and is drawn with the scratch
+ * buffer of CanvasBufferPool once its outline has not fit in the normal buffer.
+ *
+ * @tparam T The canvas widget, for instance touchgfx::Circle.
+ */
+template <class T>
+class PooledCanvasWidget : public T
+{
+public:
+    virtual void draw(const touchgfx::Rect& invalidatedArea) const
+    {
+        CanvasBufferPool::beginDraw(usage);
+        T::draw(invalidatedArea);
+        CanvasBufferPool::endDraw(usage);
+    }
+
+    virtual bool drawCanvasWidget(const touchgfx::Rect& invalidatedArea) const
+    {
+        const bool done = T::drawCanvasWidget(invalidatedArea);
+        CanvasBufferPool::pass(usage, done, touchgfx::HAL::DISPLAY_ROTATION == touchgfx::rotate0 ? invalidatedArea.height : invalidatedArea.width);
+        return done;
+    }
+
+    /**
+     * Gets what drawing the widget has cost so far.
+     *
+     * @return The usage of the widget.
+     */
+    const CanvasBufferPool::Usage& getUsage() const
+    {
+        return usage;
+    }
+
+private:
+    mutable CanvasBufferPool::Usage usage;
+};
+
+/** A Circle, as used by the gauges, drawn as a PooledCanvasWidget. */
+typedef PooledCanvasWidget<touchgfx::Circle> PooledCircle;
+
+#endif // CANVASBUFFERPOOL_HPP
@@ -0,0 +1,288 @@
+#ifndef COVERAGECACHE_HPP
+#define COVERAGECACHE_HPP
+
+#include <gui/common/DynamicBitmapArena.hpp>
+#include <touchgfx/widgets/canvas/AbstractPainter.hpp>
+#include <touchgfx/widgets/canvas/AbstractPainterColor.hpp>
+#include <touchgfx/widgets/canvas/AbstractShape.hpp>
+#include <touchgfx/widgets/canvas/Circle.hpp>
+#include <touchgfx/widgets/canvas/Line.hpp>
+
+/**
+ * Largest mask in bytes the coverage of a canvas widget is kept in, one per pixel of the
+ * widget. Larger widgets are rasterized every time they are drawn.
+ */
+#ifndef COVERAGE_CACHE_MAX_BYTES
+#define COVERAGE_CACHE_MAX_BYTES (128 * 1024)
+#endif
+
+/**
+ * The coverage of a canvas widget, rasterized once into an A8 mask in DynamicBitmapArena.
+ *
+ * Circle, Line and Shape build their outline and run the Rasterizer over it each time they
+ * are drawn, also when only a widget above them changed. The outline only depends on the
+ * geometry, and a widget painted with a single color is that color drawn through its
+ * coverage. A widget whose geometry did not change from one draw to the next renders its
+ * coverage once into a mask, one byte per pixel, and is then drawn with
+ * TouchGFXHAL::drawA8Mask(), one GPU2D blit, until its geometry or size changes again. The
+ * color and the alpha of the widget are applied by the blit, so changing them costs
+ * nothing. Moving the widget does not change the mask either.
+ *
+ * The geometry is compared through a signature of everything the outline depends on, see
+ * signature(). Only widgets entirely on the display are rasterized into a mask, as the
+ * mask must cover the whole widget, and only in the rotate0 orientation. The simulator
+ * draws the outline every time.
+ */
+class CoverageMask
+{
+public:
+    /** Drawing of all coverage masks since the last reset. */
+    struct Stats
+    {
+        uint32_t blits;      ///< Draws from a mask
+        uint32_t rasterized; ///< Times the coverage was rendered into a mask
+        uint32_t tooComplex; ///< Outlines that did not fit the CanvasWidgetRenderer buffer
+        uint32_t noMemory;   ///< Rasterizations that found no room for the mask
+    };
+
+    CoverageMask();
+
+    ~CoverageMask();
+
+    /**
+     * Tells if the mask matches the geometry of the widget.
+     *
+     * @param signature The signature of the geometry.
+     *
+     * @return true if the widget can be drawn from the mask.
+     */
+    bool isValid(uint32_t signature) const
+    {
+        return bitmap != touchgfx::BITMAP_INVALID && signature == rasterizedSignature;
+    }
+
+    /**
+     * Tells if the coverage of the widget should be rasterized now. A geometry is
+     * rasterized on the second draw in a row it is seen in, so animated widgets are not
+     * rasterized twice per draw.
+     *
+     * @param signature The signature of the geometry.
+     *
+     * @return true if the geometry did not change since the previous draw.
+     */
+    bool shouldRasterize(uint32_t signature);
+
+    /**
+     * Prepares the mask of a widget to render its coverage into.
+     *
+     * @param widget    The widget.
+     * @param signature The signature of its geometry.
+     *
+     * @return The painter to draw the widget with, 0 if there is no room for the mask.
+     */
+    const touchgfx::AbstractPainter* beginRasterize(const touchgfx::CanvasWidget& widget, uint32_t signature);
+
+    /**
+     * Finishes rendering the coverage into the mask.
+     *
+     * @param done false if the outline did not fit the CanvasWidgetRenderer buffer.
+     *
+     * @return true if the mask is valid.
+     */
+    bool endRasterize(bool done);
+
+    /**
+     * Draws the widget from the mask.
+     *
+     * @param widget          The widget.
+     * @param invalidatedArea The area of the widget to draw.
+     * @param color           The color of the widget.
+     *
+     * @return false if nothing was drawn.
+     */
+    bool draw(const touchgfx::CanvasWidget& widget, const touchgfx::Rect& invalidatedArea, touchgfx::colortype color) const;
+
+    /**
+     * Deletes the mask.
+     */
+    void release();
+
+    /**
+     * Tells if the coverage of a widget can be kept in a mask.
+     *
+     * @param widget The widget.
+     *
+     * @return true if the widget fits the mask and is entirely on the display.
+     */
+    static bool canCache(const touchgfx::CanvasWidget& widget);
+
+    /**
+     * Gets the signature of the geometry of a circle.
+     *
+     * @param circle The circle.
+     *
+     * @return The signature.
+     */
+    static uint32_t signature(const touchgfx::Circle& circle);
+
+    /**
+     * Gets the signature of the geometry of a line.
+     *
+     * @param line The line.
+     *
+     * @return The signature.
+     */
+    static uint32_t signature(const touchgfx::Line& line);
+
+    /**
+     * Gets the signature of the geometry of a shape.
+     *
+     * @param shape The shape.
+     *
+     * @return The signature.
+     */
+    static uint32_t signature(const touchgfx::AbstractShape& shape);
+
+    /**
+     * Gets the drawing statistics.
+     *
+     * @return The drawing statistics.
+     */
+    static const Stats& getStats()
+    {
+        return stats;
+    }
+
+    /**
+     * Resets the drawing statistics.
+     */
+    static void resetStats();
+
+private:
+    /** Writes the coverage of every span into the mask instead of the framebuffer. */
+    class MaskPainter : public touchgfx::AbstractPainter
+    {
+    public:
+        MaskPainter()
+            : mask(0), stride(0)
+        {
+        }
+
+        void setMask(uint8_t* pixels, uint16_t width)
+        {
+            mask = pixels;
+            stride = width;
+        }
+
+        virtual void paint(uint8_t* destination, int16_t offset, int16_t widgetX, int16_t widgetY, int16_t count, uint8_t alpha) const;
+
+    private:
+        uint8_t* mask;
+        uint16_t stride;
+    };
+
+    void bitmapMoved(touchgfx::BitmapId oldId, touchgfx::BitmapId newId);
+
+    touchgfx::Callback<CoverageMask, touchgfx::BitmapId, touchgfx::BitmapId> bitmapMovedCallback;
+    touchgfx::BitmapId bitmap;
+    MaskPainter painter;
+    uint32_t rasterizedSignature; ///< The geometry the mask was rendered with
+    uint32_t pendingSignature;    ///< The geometry of the previous draw
+    uint32_t rejectedSignature;   ///< A geometry too complex to render in one pass
+    uint32_t rasterizingSignature;
+
+    static Stats stats;
+};
+
+/**
+ * A canvas widget painted with a single color that is drawn from a CoverageMask while its
+ * geometry does not change.
+ *
+ * The painter must be set with setColorPainter(), for instance a PainterRGB565. Widgets
+ * with another painter, or whose painter was replaced with setPainter(), are drawn as T.
+ *
+ * @tparam T The canvas widget, touchgfx::Circle, touchgfx::Line or a touchgfx::Shape.
+ */
+template <class T>
+class CoverageCached : public T
+{
+public:
+    CoverageCached()
+        : T(), colorPainter(0), painter(0), caching(true)
+    {
+    }
+
+    /**
+     * Sets the painter of the widget, whose color the mask is drawn with.
+     *
+     * @tparam P A painter that is also a touchgfx::AbstractPainterColor.
+     * @param [in] newPainter The painter.
+     */
+    template <class P>
+    void setColorPainter(P& newPainter)
+    {
+        T::setPainter(newPainter);
+        painter = &newPainter;
+        colorPainter = &newPainter;
+    }
+
+    /**
+     * Enables or disables the mask, enabled by default. Disabling it releases the mask.
+     *
+     * @param enable true to draw the widget from a mask once its geometry is still.
+     */
+    void setCaching(bool enable)
+    {
+        caching = enable;
+        if (!enable)
+        {
+            mask.release();
+        }
+    }
+
+    virtual void draw(const touchgfx::Rect& invalidatedArea) const
+    {
+        if (caching && painter != 0 && T::getPainter() == painter && CoverageMask::canCache(*this))
+        {
+            const uint32_t signature = CoverageMask::signature(*this);
+            if ((mask.isValid(signature) || (mask.shouldRasterize(signature) && rasterize(signature)))
+                    && mask.draw(*this, invalidatedArea, colorPainter->getColor()))
+            {
+                return;
+            }
+        }
+        T::draw(invalidatedArea);
+    }
+
+private:
+    bool rasterize(uint32_t signature) const
+    {
+        const touchgfx::AbstractPainter* const maskPainter = mask.beginRasterize(*this, signature);
+        if (maskPainter == 0)
+        {
+            return false;
+        }
+        // The coverage is rendered opaque, the alpha is applied by the blit
+        CoverageCached* const self = const_cast<CoverageCached*>(this);
+        const uint8_t widgetAlpha = T::getAlpha();
+        self->T::setPainter(*maskPainter);
+        self->T::setAlpha(255);
+        const bool done = T::drawCanvasWidget(touchgfx::Rect(0, 0, T::getWidth(), T::getHeight()));
+        self->T::setAlpha(widgetAlpha);
+        self->T::setPainter(*painter);
+        return mask.endRasterize(done);
+    }
+
+    mutable CoverageMask mask;
+    const touchgfx::AbstractPainterColor* colorPainter;
+    const touchgfx::AbstractPainter* painter;
+    bool caching;
+};
+
+/** A Circle drawn from its coverage while its geometry does not change. */
+typedef CoverageCached<touchgfx::Circle> CoverageCachedCircle;
+
+/** A Line drawn from its coverage while its geometry does not change. */
+typedef CoverageCached<touchgfx::Line> CoverageCachedLine;
+
+#endif // COVERAGECACHE_HPP
@@ -0,0 +1,63 @@
+#ifndef DIRTYAREACOALESCER_HPP
+#define DIRTYAREACOALESCER_HPP
+
+#include <touchgfx/hal/Types.hpp>
+
+/**
+ * Width and height in pixels of the tile grid that dirty areas are aligned to before they
+ * are merged. Aligned areas that touch or overlap share tile edges and can be merged
+ * without gaps. A tile width of 16 pixels keeps every RGB565 line segment a multiple of
+ * 32 bytes. Set both to 1 to disable the alignment.
+ */
+#ifndef DIRTY_AREA_TILE_WIDTH
+#define DIRTY_AREA_TILE_WIDTH 16
+#endif
+#ifndef DIRTY_AREA_TILE_HEIGHT
+#define DIRTY_AREA_TILE_HEIGHT 16
+#endif
+
+/**
+ * Number of extra pixels that may be drawn to save one draw pass. Every dirty area is
+ * drawn separately, which walks the widget tree and rebuilds every intersecting texture
+ * mapper quad once more. Two areas are merged when their bounding box covers at most this
+ * many pixels more than the two areas together.
+ */
+#ifndef DIRTY_AREA_MERGE_SLACK
+#define DIRTY_AREA_MERGE_SLACK 4096
+#endif
+
+/**
+ * Reduces the dirty areas of a frame to a small set of tile aligned areas.
+ *
+ * Overlapping widgets, like the two rotating texture mappers on Screen1, invalidate
+ * overlapping areas. Drawing these one by one samples the shared pixels several times
+ * per frame. The coalescer aligns the areas to the tile grid and merges them until no
+ * pair of areas can be merged within DIRTY_AREA_MERGE_SLACK. The result always covers
+ * the original areas.
+ */
+class DirtyAreaCoalescer
+{
+public:
+    /**
+     * Aligns and merges the given dirty areas in place.
+     *
+     * @param [in,out] areas The dirty areas of the frame.
+     * @param          bounds The area that may be drawn, normally the display.
+     */
+    static void coalesce(touchgfx::Vector<touchgfx::Rect, 8>& areas, const touchgfx::Rect& bounds);
+
+    /**
+     * Adds an area to a list of areas, unless one of them includes it. When the list is
+     * full the area is merged with the area that grows the least, as Application does.
+     *
+     * @param [in,out] areas The areas.
+     * @param          area  The area to add.
+     */
+    static void add(touchgfx::Vector<touchgfx::Rect, 8>& areas, const touchgfx::Rect& area);
+
+private:
+    static void alignToTiles(touchgfx::Rect& area, const touchgfx::Rect& bounds);
+    static bool shouldMerge(const touchgfx::Rect& a, const touchgfx::Rect& b);
+};
+
+#endif // DIRTYAREACOALESCER_HPP
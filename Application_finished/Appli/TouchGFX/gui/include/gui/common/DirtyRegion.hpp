@@ -0,0 +1,146 @@
+#ifndef DIRTYREGION_HPP
+#define DIRTYREGION_HPP
+
+#include <gui/common/DirtyAreaCoalescer.hpp>
+
+/**
+ * Set to 0 to keep the dirty areas in the 8 rectangles of Application, merged by
+ * DirtyAreaCoalescer, instead of in a DirtyRegion.
+ */
+#ifndef DIRTY_REGION_ENGINE
+#define DIRTY_REGION_ENGINE 1
+#endif
+
+/**
+ * Most tiles of the grid horizontally and vertically, the display divided by the tile size
+ * of DirtyAreaCoalescer.
+ */
+#ifndef DIRTY_REGION_MAX_COLUMNS
+#define DIRTY_REGION_MAX_COLUMNS 64
+#endif
+#ifndef DIRTY_REGION_MAX_ROWS
+#define DIRTY_REGION_MAX_ROWS 64
+#endif
+
+/**
+ * Most rectangles considered while reducing the region to the areas that are drawn.
+ */
+#ifndef DIRTY_REGION_CANDIDATES
+#define DIRTY_REGION_CANDIDATES 32
+#endif
+
+/**
+ * The dirty area of a frame, as the tiles of a grid.
+ *
+ * Application keeps at most 8 dirty rectangles, and merges the new one with another when
+ * all are taken. With the two texture mappers on Screen1 turning in opposite directions,
+ * the unions soon cover most of the display. A DirtyRegion instead marks the tiles every
+ * invalidated area touches, so nothing is merged while the frame is collected. The tiles
+ * are then turned into rectangles, tile rows with the same columns stacked, and the pair
+ * of rectangles costing the fewest extra pixels is merged until there are at most 8 of
+ * them and no merge costs less than DIRTY_AREA_MERGE_SLACK, the cost of one more pass.
+ */
+class DirtyRegion
+{
+public:
+    /** Pixels drawn since the last reset. */
+    struct Stats
+    {
+        uint32_t frames;      ///< Frames with dirty areas
+        uint32_t areas;       ///< Areas drawn
+        uint32_t invalidated; ///< Pixels of the tiles invalidated
+        uint32_t redrawn;     ///< Pixels drawn, including the previous frame's
+        uint32_t merges;      ///< Rectangles merged
+    };
+
+    DirtyRegion();
+
+    /**
+     * Sets the area the region covers, normally the display.
+     *
+     * @param area The area.
+     */
+    void setBounds(const touchgfx::Rect& area);
+
+    /**
+     * Gets the area the region covers.
+     *
+     * @return The area.
+     */
+    const touchgfx::Rect& getBounds() const
+    {
+        return bounds;
+    }
+
+    /**
+     * Marks the tiles of an area dirty.
+     *
+     * @param area The area.
+     */
+    void add(const touchgfx::Rect& area);
+
+    /**
+     * Tells if any tile is dirty.
+     *
+     * @return true if no tile is dirty.
+     */
+    bool isEmpty() const
+    {
+        return bottom <= top;
+    }
+
+    /**
+     * Replaces the given areas with the areas to draw the dirty tiles with, and clears the
+     * region.
+     *
+     * @param [out] areas The areas to draw.
+     */
+    void takeAreas(touchgfx::Vector<touchgfx::Rect, 8>& areas);
+
+    /**
+     * Marks all tiles clean.
+     */
+    void clear();
+
+    /**
+     * Counts the pixels of areas that are drawn.
+     *
+     * @param areas The areas.
+     */
+    void countRedrawn(const touchgfx::Vector<touchgfx::Rect, 8>& areas);
+
+    /**
+     * Gets the draw statistics.
+     *
+     * @return The draw statistics.
+     */
+    const Stats& getStats() const
+    {
+        return stats;
+    }
+
+    /**
+     * Resets the draw statistics.
+     */
+    void resetStats();
+
+    /**
+     * Prints the draw statistics with touchgfx_printf() and resets them.
+     */
+    void report();
+
+private:
+    uint16_t collect(touchgfx::Rect* rects);
+    int32_t mergeCheapest(touchgfx::Rect* rects, uint16_t& count, int32_t maxCost);
+    static int32_t mergeCost(const touchgfx::Rect& a, const touchgfx::Rect& b);
+
+    uint8_t tiles[DIRTY_REGION_MAX_ROWS][DIRTY_REGION_MAX_COLUMNS];
+    touchgfx::Rect bounds;
+    uint16_t columns;
+    uint16_t rows;
+    uint16_t top;    ///< First dirty row
+    uint16_t bottom; ///< Row after the last dirty row
+    Stats stats;
+};
+
+#endif // DIRTYREGION_HPP
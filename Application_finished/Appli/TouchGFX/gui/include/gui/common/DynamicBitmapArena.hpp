@@ -0,0 +1,124 @@
+#ifndef DYNAMICBITMAPARENA_HPP
+#define DYNAMICBITMAPARENA_HPP
+
+#include <touchgfx/Bitmap.hpp>
+#include <touchgfx/Callback.hpp>
+
+/**
+ * Size in bytes of the arena in PSRAM that dynamic bitmaps are allocated from.
+ */
+#ifndef DYNAMIC_BITMAP_ARENA_SIZE
+#define DYNAMIC_BITMAP_ARENA_SIZE (2 * 1024 * 1024)
+#endif
+
+/**
+ * Most bitmaps in the arena at a time, at most TOUCHGFX_DYNAMIC_BITMAPS.
+ */
+#ifndef DYNAMIC_BITMAP_ARENA_BITMAPS
+#define DYNAMIC_BITMAP_ARENA_BITMAPS 16
+#endif
+
+/**
+ * Most bytes moved by one call to compact(), about 1 ms of memmove() in PSRAM.
+ */
+#ifndef DYNAMIC_BITMAP_ARENA_COMPACT_BYTES
+#define DYNAMIC_BITMAP_ARENA_COMPACT_BYTES (256 * 1024)
+#endif
+
+/**
+ * Dynamic bitmaps with their pixels in an arena in PSRAM, kept compact.
+ *
+ * Bitmap::dynamicBitmapCreate() takes the pixels of a bitmap from the bitmap cache, which
+ * fragments as bitmaps of different sizes are created and deleted, until a snapshot no
+ * longer fits although there is room enough in total. The arena places the pixels of
+ * bitmaps created with dynamicBitmapCreateExternal() instead. Sizes are rounded up to size
+ * classes, steps of a power of two and one and a half times a power of two, so the room of
+ * a deleted bitmap is likely to fit the next one of about the same size, and bitmaps are
+ * placed in the smallest gap they fit in.
+ *
+ * compact() moves bitmaps down to close the gaps between them. A bitmap gets a new
+ * BitmapId when it moves, so only bitmaps created with a callback to tell their owner
+ * are moved. FrontendApplication calls compact() in frames where nothing is drawn.
+ */
+class DynamicBitmapArena
+{
+public:
+    /** Called with the old and the new id of a bitmap that was moved. */
+    typedef touchgfx::GenericCallback<touchgfx::BitmapId, touchgfx::BitmapId> MovedCallback;
+
+    /** Arena use since the last reset, and the state of the arena. */
+    struct Stats
+    {
+        uint32_t created;     ///< Bitmaps created
+        uint32_t failed;      ///< Bitmaps that did not fit
+        uint32_t moved;       ///< Bitmaps moved by compaction
+        uint32_t movedBytes;  ///< Bytes moved by compaction
+        uint32_t usedBytes;   ///< Bytes taken by bitmaps
+        uint32_t largestFree; ///< Largest gap, the largest bitmap that can be created
+    };
+
+    /**
+     * Creates a dynamic bitmap in the arena.
+     *
+     * @param width   The width.
+     * @param height  The height.
+     * @param format  The format, RGB565, RGB888, ARGB8888 or L8 without palette.
+     * @param moved   (Optional) Called when the bitmap moves, 0 if it must not move.
+     *
+     * @return The bitmap, or BITMAP_INVALID if it does not fit.
+     */
+    static touchgfx::BitmapId create(uint16_t width, uint16_t height, touchgfx::Bitmap::BitmapFormat format, MovedCallback* moved = 0);
+
+    /**
+     * Deletes a bitmap created in the arena.
+     *
+     * @param id The bitmap.
+     */
+    static void destroy(touchgfx::BitmapId id);
+
+    /**
+     * Moves bitmaps to close the gaps between them, at most
+     * DYNAMIC_BITMAP_ARENA_COMPACT_BYTES per call. The bitmaps moved must not be drawn
+     * while this runs.
+     */
+    static void compact();
+
+    /**
+     * Gets the fragmentation of the free room.
+     *
+     * @return The part of the free bytes outside the largest gap, in per mille.
+     */
+    static uint16_t getFragmentation();
+
+    /**
+     * Gets the arena statistics.
+     *
+     * @return The arena statistics.
+     */
+    static const Stats& getStats();
+
+    /**
+     * Resets the arena statistics.
+     */
+    static void resetStats();
+
+private:
+    /** The pixels of a bitmap. */
+    struct Block
+    {
+        uint32_t offset;
+        uint32_t size; ///< 0 if free
+        touchgfx::BitmapId id;
+        MovedCallback* moved;
+    };
+
+    static uint32_t sizeClass(uint32_t bytes);
+    static bool findGap(uint32_t bytes, uint32_t& offset);
+    static uint32_t largestGap();
+    static uint16_t next(uint32_t from);
+
+    static Block blocks[DYNAMIC_BITMAP_ARENA_BITMAPS];
+    static Stats stats;
+};
+
+#endif // DYNAMICBITMAPARENA_HPP
@@ -0,0 +1,76 @@
+#ifndef DYNAMICRESOLUTIONTEXTUREMAPPER_HPP
+#define DYNAMICRESOLUTIONTEXTUREMAPPER_HPP
+
+#include <gui/common/FastTextureMapper.hpp>
+#include <touchgfx/Callback.hpp>
+
+/**
+ * A FastTextureMapper that is rendered at a lower resolution and scaled up while the frames
+ * are too heavy to keep up with the display.
+ *
+ * When TouchGFXHAL::getDynamicResolution() lowers the scale, the mapper is rendered once
+ * per change into an ARGB8888 bitmap in DynamicBitmapArena, at the scale of its size, with
+ * its projected corners scaled. GPU2D then maps the bitmap with a quarter of the pixels at
+ * 50 percent, and every invalidated area of the mapper is one bilinear GPU2D blit of the
+ * bitmap, scaled up to the size of the mapper. The bitmap is rendered again when the
+ * corners, the bitmap, the alpha or the scale change, so areas invalidated by other
+ * widgets are redrawn without mapping the texture.
+ *
+ * At full resolution, in the simulator, while rendering in software, or without room in
+ * the arena, the mapper is drawn as a FastTextureMapper.
+ */
+class DynamicResolutionTextureMapper : public FastTextureMapper
+{
+public:
+    /** Drawing of all dynamic resolution mappers since the last reset. */
+    struct Stats
+    {
+        uint32_t scaledDraws; ///< Areas drawn from the bitmap
+        uint32_t fullDraws;   ///< Areas drawn at full resolution
+        uint32_t renders;     ///< Times a mapper was rendered into its bitmap
+        uint32_t noMemory;    ///< Renders that found no room for the bitmap
+    };
+
+    DynamicResolutionTextureMapper();
+
+    virtual ~DynamicResolutionTextureMapper();
+
+    virtual void draw(const touchgfx::Rect& invalidatedArea) const;
+
+    virtual touchgfx::Rect getSolidRect() const;
+
+    /**
+     * Gets the drawing statistics.
+     *
+     * @return The drawing statistics.
+     */
+    static const Stats& getStats()
+    {
+        return stats;
+    }
+
+    /** Resets the drawing statistics. */
+    static void resetStats();
+
+private:
+    static const int CORNER_VALUES = 12;
+
+    uint8_t getScalePercent() const;
+    bool prepare(uint8_t percent) const;
+    bool isRendered(uint16_t width, uint16_t height) const;
+    void getCorners(float* corners) const;
+    void setCorners(const float* corners);
+    void release() const;
+    void bitmapMoved(touchgfx::BitmapId oldId, touchgfx::BitmapId newId);
+
+    mutable touchgfx::Callback<DynamicResolutionTextureMapper, touchgfx::BitmapId, touchgfx::BitmapId> bitmapMovedCallback;
+    mutable touchgfx::BitmapId scaled;            ///< The mapper rendered at a lower scale
+    mutable float renderedCorners[CORNER_VALUES]; ///< Projected corners when rendered
+    mutable touchgfx::BitmapId renderedBitmap;
+    mutable uint8_t renderedAlpha;
+    mutable bool rendering; ///< Drawing the mapper into the bitmap
+
+    static Stats stats;
+};
+
+#endif // DYNAMICRESOLUTIONTEXTUREMAPPER_HPP
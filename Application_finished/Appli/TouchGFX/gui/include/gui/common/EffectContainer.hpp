@@ -0,0 +1,222 @@
+#ifndef EFFECTCONTAINER_HPP
+#define EFFECTCONTAINER_HPP
+
+#include <gui/common/TimerRegistry.hpp>
+#include <touchgfx/Callback.hpp>
+#include <touchgfx/containers/Container.hpp>
+#include <touchgfx/widgets/Widget.hpp>
+
+/**
+ * Factor the background is scaled down by before it is blurred, and the shadow is
+ * computed at.
+ */
+#ifndef EFFECT_CONTAINER_SCALE
+#define EFFECT_CONTAINER_SCALE 4
+#endif
+
+/**
+ * Most texels blended on either side of a texel by one pass of the blur. A larger radius
+ * is clamped to it.
+ */
+#ifndef EFFECT_CONTAINER_MAX_TAPS
+#define EFFECT_CONTAINER_MAX_TAPS 4
+#endif
+
+/**
+ * Number of horizontal and vertical passes of box blur. Two passes are close to a
+ * gaussian blur.
+ */
+#ifndef EFFECT_CONTAINER_PASSES
+#define EFFECT_CONTAINER_PASSES 2
+#endif
+
+/**
+ * A container drawn on a frosted glass backdrop, the blurred content behind it, with a
+ * soft drop shadow, for the panel of a ModalWindow or a SlideMenu.
+ *
+ * The region of the background container behind the effect container is rendered into a
+ * bitmap in DynamicBitmapArena, scaled down by EFFECT_CONTAINER_SCALE in one bilinear
+ * GPU2D blit, and blurred by EFFECT_CONTAINER_PASSES separable box blurs at the reduced
+ * size. Each box blur is a horizontal then a vertical pass, each pass a few blits of the
+ * bitmap shifted by one texel and blended with a falling alpha, so the texels end up the
+ * average of their neighbours. The backdrop is then drawn in every frame as one bilinear
+ * blit scaled up to the container, under a fill of the tint color, and the children on
+ * top.
+ *
+ * The blurred bitmap is kept until backgroundChanged() is called, the container does not
+ * see the invalidations of the background. It is rendered again in the next tick, so
+ * backgroundChanged() can be called for every change of a frame.
+ *
+ * The shadow is the blurred rectangle of the container, computed once on the CPU into a
+ * small ARGB8888 bitmap, at the reduced size, and drawn scaled up by getShadow(), a
+ * widget that must be added to the parent before the container. It is placed by
+ * setShadow(), which must be called again when the container moves or is resized.
+ *
+ * Blurring and scaling need GPU2D, see TouchGFXHAL::canDrawInDynamicBitmap(). In the
+ * simulator, while rendering in software, or without room in the arena, the backdrop is
+ * the fill of the tint color over the background, and the shadow is not drawn.
+ */
+class EffectContainer : public touchgfx::Container
+{
+public:
+    /** Rendering of all effect containers since the last reset. */
+    struct Stats
+    {
+        uint32_t blurs;       ///< Backdrops blurred
+        uint32_t shadows;     ///< Shadows computed
+        uint32_t fallbacks;   ///< Areas of backdrops drawn as the tint alone
+        uint32_t unavailable; ///< Blurs not done without GPU2D
+        uint32_t noMemory;    ///< Blurs and shadows that found no room for their bitmaps
+    };
+
+    EffectContainer();
+
+    virtual ~EffectContainer();
+
+    /**
+     * Sets the container whose content is blurred behind the effect container, usually
+     * the root container of the screen. The effect container may be inside it.
+     *
+     * @param [in] container The background.
+     */
+    void setBackground(touchgfx::Container& container);
+
+    /**
+     * Sets the frosted glass backdrop.
+     *
+     * @param radius    Radius of the blur in pixels, 0 for the tint alone.
+     * @param tint      The color drawn over the blurred background.
+     * @param tintAlpha The alpha of the tint.
+     */
+    void setBlur(uint8_t radius, touchgfx::colortype tint, uint8_t tintAlpha);
+
+    /**
+     * Sets the drop shadow and places getShadow() below the container.
+     *
+     * @param offsetX Horizontal offset of the shadow.
+     * @param offsetY Vertical offset of the shadow.
+     * @param radius  Radius of the blur of the edges in pixels, 0 to remove the shadow.
+     * @param color   The color of the shadow.
+     * @param alpha   The alpha of the shadow under the container.
+     */
+    void setShadow(int16_t offsetX, int16_t offsetY, uint8_t radius, touchgfx::colortype color, uint8_t alpha);
+
+    /**
+     * Gets the widget drawing the shadow, to be added to the parent before the container.
+     *
+     * @return The shadow.
+     */
+    touchgfx::Widget& getShadow()
+    {
+        return shadow;
+    }
+
+    /**
+     * Renders the backdrop again in the next tick, after the background or the place of
+     * the container changed.
+     */
+    void backgroundChanged();
+
+    /** Blurs the backdrop when it is out of date. */
+    virtual void handleTickEvent();
+
+    /**
+     * Gets the rendering statistics.
+     *
+     * @return The rendering statistics.
+     */
+    static const Stats& getStats()
+    {
+        return stats;
+    }
+
+    /**
+     * Resets the rendering statistics.
+     */
+    static void resetStats();
+
+protected:
+    virtual void setupDrawChain(const touchgfx::Rect& invalidatedArea, touchgfx::Drawable** nextPreviousElement);
+
+private:
+    /** Draws the blurred background and the tint, in place of a first child. */
+    class Backdrop : public touchgfx::Widget
+    {
+    public:
+        explicit Backdrop(EffectContainer& owner);
+
+        virtual void setupDrawChain(const touchgfx::Rect& invalidatedArea, touchgfx::Drawable** nextPreviousElement);
+        virtual void draw(const touchgfx::Rect& invalidatedArea) const;
+        virtual touchgfx::Rect getSolidRect() const;
+
+    private:
+        const EffectContainer& container;
+    };
+
+    /** Draws the shadow scaled up. */
+    class Shadow : public touchgfx::Widget
+    {
+    public:
+        explicit Shadow(EffectContainer& owner);
+
+        virtual void draw(const touchgfx::Rect& invalidatedArea) const;
+        virtual touchgfx::Rect getSolidRect() const;
+
+    private:
+        const EffectContainer& container;
+    };
+
+    /** One pass of the blur, rendered into a bitmap with drawDrawableInDynamicBitmap(). */
+    class Pass : public touchgfx::Widget
+    {
+    public:
+        enum Mode
+        {
+            SCALE_DOWN, ///< The source scaled to the size of the pass
+            HORIZONTAL, ///< The source blurred horizontally
+            VERTICAL    ///< The source blurred vertically
+        };
+
+        Pass();
+
+        virtual void draw(const touchgfx::Rect& invalidatedArea) const;
+        virtual touchgfx::Rect getSolidRect() const;
+
+        Mode mode;
+        touchgfx::BitmapId source;
+        uint8_t taps;      ///< Texels blended on either side
+        mutable bool done; ///< Every blit was drawn
+    };
+
+    bool canRender() const;
+    bool blur();
+    bool prepare(touchgfx::BitmapId& bitmap, uint16_t width, uint16_t height, touchgfx::Bitmap::BitmapFormat format);
+    bool renderPass(Pass::Mode mode, touchgfx::BitmapId source, touchgfx::BitmapId target, uint8_t taps);
+    void capture(touchgfx::BitmapId target, const touchgfx::Rect& area);
+    bool computeShadow();
+    void release(touchgfx::BitmapId& bitmap);
+    void bitmapMoved(touchgfx::BitmapId oldId, touchgfx::BitmapId newId);
+
+    Backdrop backdrop;
+    Shadow shadow;
+    Pass pass;
+    TimerRegistry::Timer timer; ///< Runs while the backdrop is out of date
+    touchgfx::Callback<EffectContainer, touchgfx::BitmapId, touchgfx::BitmapId> bitmapMovedCallback;
+    touchgfx::Container* background;
+    touchgfx::BitmapId blurred[2]; ///< Ping-pong targets of the passes
+    touchgfx::BitmapId shadowBitmap;
+    uint8_t result;                ///< The bitmap of blurred holding the backdrop
+    bool ready;                    ///< The backdrop is blurred and up to date
+    uint8_t blurRadius;
+    touchgfx::colortype tintColor;
+    uint8_t tintAlpha;
+    int16_t shadowX;
+    int16_t shadowY;
+    uint8_t shadowRadius;
+    touchgfx::colortype shadowColor;
+    uint8_t shadowAlpha;
+
+    static Stats stats;
+};
+
+#endif // EFFECTCONTAINER_HPP
@@ -0,0 +1,81 @@
+#ifndef FASTLINE_HPP
+#define FASTLINE_HPP
+
+#include <touchgfx/widgets/canvas/AbstractPainterColor.hpp>
+#include <touchgfx/widgets/canvas/Line.hpp>
+
+/**
+ * A touchgfx::Line that draws the lines of grids and charts without CanvasWidgetRenderer.
+ *
+ * Line builds a four point outline for every line and rasterizes it, also when the line
+ * is a plain rectangle. With a painter of a single color, set with setColorPainter():
+ * - Horizontal and vertical lines with butt or square caps are rectangles, filled with
+ *   LCD::fillRect(). Edges between pixels are filled as a row or column with the alpha of
+ *   their coverage, so the line looks as rasterized, in at most nine fills, or one when
+ *   the line lies on whole pixels.
+ * - Other lines at most 1 pixel wide are drawn into the framebuffer by the CPU, two
+ *   pixels per column or row, as lines by Xiaolin Wu. The coverage of a column is the line
+ *   width across it, so thin and steep lines keep their weight.
+ *
+ * Wider diagonal lines, lines with round caps, other painters and other framebuffer
+ * formats than RGB565 and RGB888 are drawn by Line.
+ */
+class FastLine : public touchgfx::Line
+{
+public:
+    /** Lines drawn since the last reset. */
+    struct Stats
+    {
+        uint32_t rectangles; ///< Drawn with fillRect()
+        uint32_t fills;      ///< Calls to fillRect() for those
+        uint32_t thin;       ///< Drawn as thin lines by the CPU
+        uint32_t outlines;   ///< Rasterized by Line
+    };
+
+    FastLine()
+        : Line(), colorPainter(0), painter(0)
+    {
+    }
+
+    /**
+     * Sets a painter with a single color, such as touchgfx::PainterRGB565, which makes the
+     * fast paths available.
+     *
+     * @param newPainter The painter.
+     */
+    template <class Painter>
+    void setColorPainter(const Painter& newPainter)
+    {
+        setPainter(newPainter);
+        colorPainter = &newPainter;
+        painter = &newPainter;
+    }
+
+    virtual bool drawCanvasWidget(const touchgfx::Rect& invalidatedArea) const;
+
+    /**
+     * Gets the drawing statistics.
+     *
+     * @return The drawing statistics.
+     */
+    static const Stats& getStats()
+    {
+        return stats;
+    }
+
+    /**
+     * Resets the drawing statistics.
+     */
+    static void resetStats();
+
+private:
+    void fillCoverage(float left, float top, float right, float bottom, const touchgfx::Rect& invalidatedArea, touchgfx::colortype color) const;
+    bool drawThin(float x0, float y0, float x1, float y1, float width, const touchgfx::Rect& invalidatedArea, touchgfx::colortype color) const;
+
+    const touchgfx::AbstractPainterColor* colorPainter;
+    const touchgfx::AbstractPainter* painter; ///< The same painter, to tell if it was replaced
+
+    static Stats stats;
+};
+
+#endif // FASTLINE_HPP
@@ -0,0 +1,36 @@
+#ifndef FASTPAINTERRGB565_HPP
+#define FASTPAINTERRGB565_HPP
+
+#include <touchgfx/widgets/canvas/PainterRGB565.hpp>
+
+/**
+ * Spans of at least this many pixels are painted by the ChromART (DMA2D) implementation of
+ * PainterRGB565, shorter spans by the CPU.
+ */
+#ifndef FAST_PAINTER_DMA2D_MIN_PIXELS
+#define FAST_PAINTER_DMA2D_MIN_PIXELS 48
+#endif
+
+/**
+ * A PainterRGB565 that paints the short spans of an outline on the CPU.
+ *
+ * CanvasWidgetRenderer paints an outline as spans of equal coverage, most of them one or
+ * two pixels long along the edges. On target, PainterRGB565 hands every span to DMA2D,
+ * waiting for the previous span and programming the registers for a few pixels. This
+ * painter blends short spans itself, two pixels per 32 bit word: the red, green and blue
+ * fields of both pixels are multiplied in separate 16 bit lanes of one word, and divided
+ * by 255 in the lanes, exactly as the software blend of PainterRGB565. Long spans,
+ * typically the inside of filled shapes, are still painted by DMA2D.
+ */
+class FastPainterRGB565 : public touchgfx::PainterRGB565
+{
+public:
+    FastPainterRGB565(touchgfx::colortype color = 0)
+        : PainterRGB565(color)
+    {
+    }
+
+    virtual void paint(uint8_t* destination, int16_t offset, int16_t widgetX, int16_t widgetY, int16_t count, uint8_t alpha) const;
+};
+
+#endif // FASTPAINTERRGB565_HPP
@@ -0,0 +1,94 @@
+#ifndef FASTTEXTUREMAPPER_HPP
+#define FASTTEXTUREMAPPER_HPP
+
+#include <touchgfx/widgets/TextureMapper.hpp>
+
+/**
+ * Number of horizontal bands the area of a transformed bitmap is invalidated in, see
+ * FastTextureMapper::invalidateContent(). 1 invalidates the bounding box.
+ */
+#ifndef FAST_TEXTURE_MAPPER_BANDS
+#define FAST_TEXTURE_MAPPER_BANDS 8
+#endif
+
+/**
+ * A TextureMapper that transforms its corners without matrices while it only rotates around
+ * the z axis.
+ *
+ * TextureMapper::applyTransformation() multiplies seven Matrix4x4 together, with a sinf()
+ * and a cosf() per axis, every time an angle or the scale changes. Rotated around the z axis
+ * only, the corners are the rotated and scaled offsets from the origo, all at the same
+ * depth, so setAngles() and setScale() compute them directly, with the sine and cosine
+ * interpolated from a quarter wave table. The error of the interpolation is below 5e-6,
+ * far below a pixel. Rotations around the x or y axis, and changes to the origo, the camera
+ * or the bitmap, still go through TextureMapper.
+ *
+ * TextureMapper invalidates the bounding box of the transformed bitmap before and after
+ * every change, and a square bitmap turned by 45 degrees covers half of its bounding box.
+ * invalidateContent() cuts the quad into FAST_TEXTURE_MAPPER_BANDS bands of rows and
+ * invalidates the part of each band the quad covers, so the corners of the bounding box,
+ * where neither the old nor the new quad is, are left out of the dirty region.
+ */
+class FastTextureMapper : public touchgfx::TextureMapper
+{
+public:
+    /** Transformations since the last reset. */
+    struct Stats
+    {
+        uint32_t fast; ///< Corners computed for a rotation around the z axis
+        uint32_t full; ///< Transformations left to TextureMapper
+    };
+
+    FastTextureMapper();
+
+    /**
+     * Copies the position, bitmap, transformation and rendering settings of a texture
+     * mapper, for instance one generated by the designer that this mapper replaces.
+     *
+     * @param mapper The texture mapper.
+     */
+    void copyFrom(const touchgfx::TextureMapper& mapper);
+
+    virtual void setAngles(float newXAngle, float newYAngle, float newZAngle);
+
+    virtual void setScale(float newScale);
+
+    /**
+     * Invalidates the area covered by the transformed bitmap, as a band of rows at a time.
+     */
+    virtual void invalidateContent() const;
+
+    /**
+     * Gets the sine and cosine of an angle from the table.
+     *
+     * @param       angle  The angle in radians.
+     * @param [out] sine   The sine.
+     * @param [out] cosine The cosine.
+     */
+    static void sinCos(float angle, float& sine, float& cosine);
+
+    /**
+     * Gets the transformation statistics.
+     *
+     * @return The transformation statistics.
+     */
+    static const Stats& getStats()
+    {
+        return stats;
+    }
+
+    /** Resets the transformation statistics. */
+    static void resetStats();
+
+private:
+    static const int QUARTER_STEPS = 256;
+
+    void rotateAroundZ();
+    static float sinStep(int32_t step);
+
+    static float quarterSine[QUARTER_STEPS + 1];
+    static bool tableReady;
+    static Stats stats;
+};
+
+#endif // FASTTEXTUREMAPPER_HPP
@@ -0,0 +1,111 @@
+#ifndef FRAMEDAMAGEHISTORY_HPP
+#define FRAMEDAMAGEHISTORY_HPP
+
+#include <touchgfx/hal/Types.hpp>
+
+/**
+ * Number of latest frames whose damage is kept. A framebuffer that is older than one
+ * frame more than this is brought up to date as a whole. Two frames cover triple
+ * buffering.
+ */
+#ifndef FRAME_DAMAGE_HISTORY
+#define FRAME_DAMAGE_HISTORY 2
+#endif
+
+/**
+ * The areas changed in the latest frames, to bring a framebuffer that missed them up to
+ * date.
+ *
+ * With double buffering the framework draws the dirty areas of the previous frame again,
+ * from the widgets, into the framebuffer it renders to, and a framebuffer that missed
+ * more frames is redrawn wherever it was drawn since. The history instead keeps the
+ * damage of each frame, the areas whose pixels changed, separately from the areas drawn
+ * to catch up. With the age of the framebuffer being rendered, see
+ * TouchGFXHAL::getClientFrameBufferAge(), the stale areas are exactly the damage of the
+ * frames it missed. These are copied from the latest frame with
+ * TouchGFXHAL::copyPreviousFrame(), a DMA2D or GPU2D copy instead of drawing the widgets
+ * again, and are only drawn when the copy is not possible.
+ *
+ * With TOUCHGFX_TILE_HASH, the stale areas are cut to the tiles whose pixels differ from
+ * the latest frame, compared by CRC in TouchGFXHAL::isTileUnchanged(), before they are
+ * copied or drawn.
+ */
+class FrameDamageHistory
+{
+public:
+    /** Stale areas brought up to date since the last reset. */
+    struct Stats
+    {
+        uint32_t copied;       ///< Areas copied from the latest frame
+        uint32_t copiedPixels; ///< Pixels in those areas
+        uint32_t redrawn;      ///< Areas drawn as they could not be copied
+        uint32_t covered;      ///< Areas left out as the frame draws them anyway
+        uint32_t unchanged;    ///< Tiles of stale areas left out as they were up to date
+        uint32_t skipped;      ///< Stale areas left out as all their tiles were up to date
+    };
+
+    FrameDamageHistory();
+
+    /**
+     * Gets the areas outdated in the framebuffer being rendered.
+     *
+     * @param       frame  The number of the frame being rendered.
+     * @param       age    The age of the framebuffer, 0 if unknown.
+     * @param       bounds The area of the display.
+     * @param [out] stale  The damage of the frames the framebuffer missed, the whole display
+     *                     when it is older than the history.
+     */
+    void getStaleAreas(uint32_t frame, uint8_t age, const touchgfx::Rect& bounds, touchgfx::Vector<touchgfx::Rect, 8>& stale) const;
+
+    /**
+     * Cuts the stale areas to the bounding boxes of their tiles that differ from the latest
+     * frame, and removes those with no such tile. Does nothing without TOUCHGFX_TILE_HASH.
+     *
+     * @param [in,out] stale The stale areas.
+     */
+    void skipUnchangedTiles(touchgfx::Vector<touchgfx::Rect, 8>& stale);
+
+    /**
+     * Brings the stale areas of the framebuffer being rendered up to date, before the
+     * dirty areas are drawn.
+     *
+     * @param          stale       The stale areas.
+     * @param          dirtyAreas  The areas drawn in the frame.
+     * @param          movedAreas  The areas whose pixels were moved in the frame, not copied
+     *                             again unmoved.
+     * @param [in,out] redrawAreas The areas the framework draws again, the stale areas that
+     *                             could not be copied are added.
+     */
+    void update(const touchgfx::Vector<touchgfx::Rect, 8>& stale, const touchgfx::Vector<touchgfx::Rect, 8>& dirtyAreas, const touchgfx::Vector<touchgfx::Rect, 8>& movedAreas, touchgfx::Vector<touchgfx::Rect, 8>& redrawAreas);
+
+    /**
+     * Records the damage of the frame being rendered.
+     *
+     * @param frame      The number of the frame being rendered.
+     * @param dirtyAreas The areas drawn in the frame.
+     * @param movedAreas The areas whose pixels were moved in the frame.
+     */
+    void add(uint32_t frame, const touchgfx::Vector<touchgfx::Rect, 8>& dirtyAreas, const touchgfx::Vector<touchgfx::Rect, 8>& movedAreas);
+
+    /**
+     * Gets the statistics.
+     *
+     * @return The statistics.
+     */
+    const Stats& getStats() const
+    {
+        return stats;
+    }
+
+    /**
+     * Resets the statistics.
+     */
+    void resetStats();
+
+private:
+    touchgfx::Vector<touchgfx::Rect, 8> damage[FRAME_DAMAGE_HISTORY];
+    uint32_t damageFrame[FRAME_DAMAGE_HISTORY]; ///< Number of the frame of each damage, 0 if none
+    Stats stats;
+};
+
+#endif // FRAMEDAMAGEHISTORY_HPP
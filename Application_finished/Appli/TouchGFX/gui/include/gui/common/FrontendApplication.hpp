@@ -2,6 +2,22 @@
 #define FRONTENDAPPLICATION_HPP
 
 #include <gui_generated/common/FrontendApplicationBase.hpp>
+#include <gui/common/AnimationScheduler.hpp>
+#include <gui/common/DirtyRegion.hpp>
+#include <gui/common/FrameDamageHistory.hpp>
+#include <gui/common/NavigationPrefetch.hpp>
+#include <gui/common/ProgressivePaint.hpp>
+#include <gui/common/TimerRegistry.hpp>
+#include <gui/common/WarmScreens.hpp>
+
+/**
+ * Set to 1 to show the screens in portrait, on a panel mounted turned by 90 degrees. The
+ * screens must be laid out for the display turned, and are drawn into the landscape
+ * framebuffer by GPU2D, see HybridLCDGPU2D.
+ */
+#ifndef DISPLAY_PORTRAIT
+#define DISPLAY_PORTRAIT 0
+#endif
 
 class FrontendHeap;
 
@@ -16,9 +32,166 @@ public:
     virtual void handleTickEvent()
     {
         model.tick();
+        timerRegistry.tick();
+        animationScheduler.tick();
+        progressivePaint.tick();
         FrontendApplicationBase::handleTickEvent();
     }
+
+    /**
+     * Goes to Screen1 without transition, keeping it constructed when it is left, see
+     * WarmScreens. Same as gotoScreen1ScreenNoTransition() when WARM_SCREENS is 0.
+     */
+    void gotoScreen1ScreenWarm();
+
+    /**
+     * Stops the timers of the TimerRegistry and the animations of the AnimationScheduler,
+     * and shows what ProgressivePaint still defers, before the transition. Leaves the current screen through WarmScreens, so a screen
+     * kept warm is not destroyed by a generated goto function. The dirty region is fitted
+     * to the display after it, which a requested orientation turns.
+     */
+    virtual void handlePendingScreenTransition();
+
+    /**
+     * Gets the screens kept constructed after they are left.
+     *
+     * @return The warm screens.
+     */
+    WarmScreens& getWarmScreens()
+    {
+        return warmScreens;
+    }
+
+    /**
+     * Gets the registry of the timers ticked before the screen, see TimerRegistry.
+     *
+     * @return The timer registry.
+     */
+    TimerRegistry& getTimerRegistry()
+    {
+        return timerRegistry;
+    }
+
+    /**
+     * Gets the scheduler of the animations ticked after the timers, see AnimationScheduler.
+     *
+     * @return The animation scheduler.
+     */
+    AnimationScheduler& getAnimationScheduler()
+    {
+        return animationScheduler;
+    }
+
+    /**
+     * Gets the drawables deferred past the first frame of the screen, see
+     * ProgressivePaint.
+     *
+     * @return The progressive paint.
+     */
+    ProgressivePaint& getProgressivePaint()
+    {
+        return progressivePaint;
+    }
+
+    /**
+     * Gets the prefetch of the assets of the screen likely entered next, see
+     * NavigationPrefetch.
+     *
+     * @return The navigation prefetch.
+     */
+    NavigationPrefetch& getNavigationPrefetch()
+    {
+        return navigationPrefetch;
+    }
+
+    /**
+     * Delivers the drag received in this tick, if any, before the click, so a release
+     * follows the last move.
+     */
+    virtual void handleClickEvent(const ClickEvent& event);
+
+    /**
+     * Merges the drag with the other drags of the tick. HAL::tick() samples the touch after
+     * Application::handleTickEvent(), and the merged drag is delivered to the screen before
+     * the frame is drawn, by drawCachedAreas(), or before the next click or gesture. The
+     * screen hands drags to the drawable the press landed on, so a drag never walks the
+     * widget tree; merging bounds the drag handlers to one call per frame however often
+     * the touch is sampled.
+     */
+    virtual void handleDragEvent(const DragEvent& event);
+
+    /**
+     * Delivers the drag received in this tick, if any, before the swipe.
+     */
+    virtual void handleGestureEvent(const GestureEvent& event);
+
+    /**
+     * Merges the dirty areas of the frame with DirtyRegion, or with DirtyAreaCoalescer
+     * without DIRTY_REGION_ENGINE, before drawing them, so overlapping invalidations are
+     * drawn once. When the HAL skips the frame of a late tick, nothing is drawn and the
+     * dirty areas are left for the next tick. Scrolled BlitScrollableContainers copy
+     * their viewports before the areas are drawn. On target, the areas the framebuffer
+     * being rendered missed are taken from FrameDamageHistory instead of the dirty areas of
+     * the previous frame, and copied from the latest frame where possible. A frame where
+     * nothing is drawn prefetches an asset of the screen likely entered next.
+     */
+    virtual void drawCachedAreas();
+
+#if DIRTY_REGION_ENGINE
+    /**
+     * Marks the area in the DirtyRegion of the frame, which drawCachedAreas() reduces to
+     * the areas drawn.
+     */
+    virtual void invalidateArea(Rect area);
+
+    /**
+     * Gets the dirty region, with the statistics on pixels invalidated and redrawn.
+     *
+     * @return The dirty region.
+     */
+    DirtyRegion& getDirtyRegion()
+    {
+        return dirtyRegion;
+    }
+#endif
+
+    /**
+     * Gets the damage of the latest frames, with the statistics on stale areas copied and
+     * redrawn.
+     *
+     * @return The damage history.
+     */
+    FrameDamageHistory& getDamageHistory()
+    {
+        return damageHistory;
+    }
+
 private:
+    void deliverDrag();
+    void gotoScreen1ScreenWarmImpl();
+    /**
+     * Moves the soak test on to its next scene, entering Screen1 again alternately kept
+     * warm and constructed anew, see TouchGFXHAL::startSoakTest().
+     */
+    void nextSoakScene();
+
+    bool dragPending;   ///< A drag was received in this tick and not yet delivered
+    int16_t dragFromX;  ///< Where the first drag of the tick started
+    int16_t dragFromY;
+    int16_t dragToX;    ///< Where the last drag of the tick ended
+    int16_t dragToY;
+#if DIRTY_REGION_ENGINE
+    DirtyRegion dirtyRegion;
+#endif
+    FrameDamageHistory damageHistory;
+    WarmScreens warmScreens;
+    TimerRegistry timerRegistry;
+    AnimationScheduler animationScheduler;
+    ProgressivePaint progressivePaint;
+    NavigationPrefetch navigationPrefetch;
+    Callback<FrontendApplication> warmTransitionCallback;
+    Callback<FrontendApplication> soakSceneCallback;
+    uint32_t soakScenes; ///< Scenes the soak test moved on to
 };
 
 #endif // FRONTENDAPPLICATION_HPP
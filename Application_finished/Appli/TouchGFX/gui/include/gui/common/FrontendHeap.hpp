@@ -2,6 +2,7 @@
 #define FRONTENDHEAP_HPP
 
 #include <gui_generated/common/FrontendHeapBase.hpp>
+#include <gui/common/TextureTransition.hpp>
 
 class FrontendHeap : public FrontendHeapBase
 {
@@ -17,7 +18,8 @@ public:
                             > UserDefinedPresenterTypes;
 
     /* List any user-defined transition types here*/
-    typedef touchgfx::meta::TypeList< touchgfx::meta::Nil, //Replace this with first user-defined type
+    /* All texture transitions have the size of TextureTransition */
+    typedef touchgfx::meta::TypeList< TextureSlideTransition<touchgfx::EAST>,
                             touchgfx::meta::Nil  //List must always end with meta::Nil !
                             > UserDefinedTransitionTypes;
 
@@ -57,12 +59,18 @@ public:
         return instance;
     }
 
-    touchgfx::Partition< CombinedPresenterTypes, 1 > presenters;
-    touchgfx::Partition< CombinedViewTypes, 1 > views;
+    /* Slot 0 for the screen entered by the generated goto functions, one more per screen kept warm */
+    touchgfx::Partition< CombinedPresenterTypes, 1 + WARM_SCREENS > presenters;
+    touchgfx::Partition< CombinedViewTypes, 1 + WARM_SCREENS > views;
     touchgfx::Partition< CombinedTransitionTypes, 1 > transitions;
     Model model;
     FrontendApplication app;
 
+    virtual void gotoStartScreen(FrontendApplication& app)
+    {
+        app.gotoScreen1ScreenWarm();
+    }
+
 private:
     FrontendHeap() : FrontendHeapBase(presenters, views, transitions, app),
                      app(model, *this)
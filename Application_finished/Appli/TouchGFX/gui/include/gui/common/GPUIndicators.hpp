@@ -0,0 +1,208 @@
+#ifndef GPUINDICATORS_HPP
+#define GPUINDICATORS_HPP
+
+#include <gui/common/TextureMapperBatch.hpp>
+#include <gui/common/TimerRegistry.hpp>
+#include <gui/common/VectorCanvasWidget.hpp>
+#include <touchgfx/containers/clock/AnalogClock.hpp>
+#include <touchgfx/containers/progress_indicators/CircleProgress.hpp>
+#include <touchgfx/widgets/Gauge.hpp>
+
+/**
+ * A needle, a bitmap rotated around a pivot in the plane of the display, drawn as one
+ * texture mapped quad.
+ *
+ * Gauge and AnalogClock turn their needles with TextureMapper, which multiplies its
+ * matrices again on every change of the angle and invalidates the bounding box of the
+ * whole widget area the needle may cover. The offset from the pivot to the center of the
+ * bitmap is kept when the needle is set, so an angle costs a sine and cosine from the table
+ * of FastTextureMapper and four corners, and only the bounds of the quad before and after
+ * are invalidated. The quad is drawn by TouchGFXHAL::drawTextureQuads(), or by
+ * LCD::drawTextureMapQuad() in the simulator, see TextureMapperBatch.
+ */
+class GPUNeedle : public TextureMapperBatch<1>
+{
+public:
+    GPUNeedle();
+
+    /**
+     * Sets the bitmap of the needle and the point it turns around.
+     *
+     * @param bitmap The bitmap, pointing up at angle 0.
+     * @param x      The x coordinate of the pivot in the bitmap.
+     * @param y      The y coordinate of the pivot in the bitmap.
+     */
+    void setNeedle(const touchgfx::Bitmap& bitmap, int16_t x, int16_t y);
+
+    /**
+     * Sets where the pivot of the needle is in the widget.
+     *
+     * @param x The x coordinate, relative to the widget.
+     * @param y The y coordinate, relative to the widget.
+     */
+    void setPivot(int16_t x, int16_t y);
+
+    /**
+     * Turns the needle, invalidating the area it covered before and covers after.
+     *
+     * @param radians The angle, clockwise, as TextureMapper::updateZAngle().
+     */
+    void updateAngle(float radians);
+
+    /**
+     * Gets the angle of the needle.
+     *
+     * @return The angle in radians.
+     */
+    float getAngle() const
+    {
+        return angle;
+    }
+
+private:
+    void place(bool invalidating);
+
+    float offsetX; ///< From the pivot to the center of the bitmap, at angle 0
+    float offsetY;
+    int16_t pivotX;
+    int16_t pivotY;
+    float angle;
+};
+
+/**
+ * A Gauge whose needle is a GPUNeedle and whose arc is a VectorCircle.
+ *
+ * Gauge keeps its TextureMapper and Circle, which set the values, out of the widget
+ * tree: setValue() copies the angle of the needle and the end of the arc to the GPU2D
+ * widgets, and the arc is invalidated over the sector that changed, by updateArcEnd(). The
+ * arc is drawn as a vector path once given a painter with setArcColorPainter(); with any
+ * other painter, set with getArc(), it is drawn by CanvasWidgetRenderer.
+ */
+class GPUGauge : public touchgfx::Gauge
+{
+public:
+    GPUGauge();
+
+    /**
+     * Sets the bitmap of the needle and its rotation point, as Gauge::setNeedle().
+     *
+     * @param bitmapId        The bitmap.
+     * @param rotationCenterX The x coordinate of the rotation point in the bitmap.
+     * @param rotationCenterY The y coordinate of the rotation point in the bitmap.
+     */
+    void setNeedle(const touchgfx::BitmapId bitmapId, int16_t rotationCenterX, int16_t rotationCenterY);
+
+    /**
+     * Sets a painter with a single color for the arc, which draws it as a vector path.
+     *
+     * @param painter The painter.
+     */
+    template <class Painter>
+    void setArcColorPainter(const Painter& painter)
+    {
+        arc.setPainter(painter);
+        vectorArc.setColorPainter(painter);
+    }
+
+    /**
+     * Sets the position of the arc, as Gauge::setArcPosition().
+     *
+     * @param x      The x coordinate.
+     * @param y      The y coordinate.
+     * @param width  The width.
+     * @param height The height.
+     */
+    void setArcPosition(int16_t x, int16_t y, int16_t width, int16_t height);
+
+    /**
+     * Shows or hides the arc, as Gauge::setArcVisible().
+     *
+     * @param show true to show the arc.
+     */
+    void setArcVisible(bool show = true);
+
+    virtual void setWidth(int16_t width);
+    virtual void setHeight(int16_t height);
+    virtual void setCenter(int x, int y);
+    virtual void setStartEndAngle(int startAngle, int endAngle);
+    virtual void setValue(int value);
+    virtual void setAlpha(uint8_t newAlpha);
+
+protected:
+    void syncArc();
+
+    GPUNeedle gpuNeedle;
+    VectorCircle vectorArc;
+};
+
+/**
+ * A CircleProgress whose arc is a VectorCircle, drawn as a vector path by GPU2D once given
+ * a painter with setColorPainter().
+ *
+ * The Circle of CircleProgress is kept out of the widget tree and sets the values; the
+ * VectorCircle follows it and invalidates the sector that changed with updateArcEnd().
+ */
+class GPUCircleProgress : public touchgfx::CircleProgress
+{
+public:
+    GPUCircleProgress();
+
+    /**
+     * Sets a painter with a single color, which draws the arc as a vector path.
+     *
+     * @param painter The painter.
+     */
+    template <class Painter>
+    void setColorPainter(const Painter& painter)
+    {
+        circle.setPainter(painter);
+        vectorCircle.setColorPainter(painter);
+    }
+
+    virtual void setProgressIndicatorPosition(int16_t x, int16_t y, int16_t width, int16_t height);
+    virtual void setPainter(touchgfx::AbstractPainter& painter);
+    virtual void setCenter(int x, int y);
+    virtual void setRadius(int r);
+    virtual void setLineWidth(int width);
+    virtual void setCapPrecision(int precision);
+    virtual void setStartEndAngle(int startAngle, int endAngle);
+    virtual void setAlpha(uint8_t newAlpha);
+    virtual void setValue(int value);
+
+protected:
+    void syncCircle();
+
+    VectorCircle vectorCircle;
+};
+
+/**
+ * An AnalogClock whose hands are GPUNeedles.
+ *
+ * The AnimationTextureMapper hands of AnalogClock are kept out of the widget tree and
+ * keep computing the angles, animated or not; every tick a hand animates, and when the
+ * time changes, the angles are copied to the needles.
+ */
+class GPUAnalogClock : public touchgfx::AnalogClock
+{
+public:
+    GPUAnalogClock();
+
+    virtual void setAlpha(uint8_t newAlpha);
+
+    virtual void handleTickEvent();
+
+protected:
+    virtual void updateClock();
+
+    virtual void setupHand(touchgfx::TextureMapper& hand, const touchgfx::BitmapId bitmapId, int16_t rotationCenterX, int16_t rotationCenterY);
+
+    /** Copies the angles of the hands to the needles. */
+    void syncHands();
+
+    GPUNeedle hourNeedle;
+    GPUNeedle minuteNeedle;
+    GPUNeedle secondNeedle;
+    TimerRegistry::Timer timer; ///< Runs while a hand animates
+};
+
+#endif // GPUINDICATORS_HPP
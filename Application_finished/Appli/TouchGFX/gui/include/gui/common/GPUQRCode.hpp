@@ -0,0 +1,133 @@
+#ifndef GPUQRCODE_HPP
+#define GPUQRCODE_HPP
+
+#include <gui/common/DynamicBitmapArena.hpp>
+#include <touchgfx/widgets/QRCode.hpp>
+
+/**
+ * Longest payload in bytes kept by GPUQRCode to tell whether a payload was encoded last.
+ * Longer payloads are always encoded.
+ */
+#ifndef GPU_QRCODE_PAYLOAD_BYTES
+#define GPU_QRCODE_PAYLOAD_BYTES 256
+#endif
+
+/**
+ * A QRCode drawn from a bitmap of its modules, one pixel per module, scaled by GPU2D.
+ *
+ * QRCode::draw() reads the module bits of the symbol and writes every module as a block
+ * of scale by scale pixels with the CPU, each time any part of it is drawn. This QR code
+ * writes the modules into an RGB565 bitmap in DynamicBitmapArena once, in the two colors,
+ * when the payload is encoded, and is drawn with one nearest neighbour blit of the bitmap
+ * scaled to the widget, see TouchGFXHAL::drawScaledBitmap(). Encoding a payload equal to
+ * the one shown, as a payment screen refreshing its code does, neither encodes again nor
+ * writes the bitmap.
+ *
+ * The encoding, buffer, color and version functions hide those of QRCode, which are not
+ * virtual, so the QR code must be set up through a GPUQRCode. The simulator, and a QR code
+ * whose bitmap found no room, are drawn by QRCode::draw().
+ */
+class GPUQRCode : public touchgfx::QRCode
+{
+public:
+    /** Encoding and drawing of all GPU QR codes since the last reset. */
+    struct Stats
+    {
+        uint32_t encoded;   ///< Payloads encoded
+        uint32_t unchanged; ///< Payloads equal to the one encoded, not encoded again
+        uint32_t blits;     ///< Draws from the bitmap
+        uint32_t noMemory;  ///< Bitmaps that found no room
+    };
+
+    GPUQRCode();
+
+    virtual ~GPUQRCode();
+
+    /**
+     * Sets the buffers of the symbol, see QRCode::setBuffers().
+     *
+     * @param [in] qrBuffer   The buffer of the symbol.
+     * @param [in] tempBuffer The buffer the symbol is encoded in.
+     */
+    void setBuffers(uint8_t* qrBuffer, uint8_t* tempBuffer);
+
+    /**
+     * Encodes a text, unless it is the text encoded last, and writes the modules into the
+     * bitmap.
+     *
+     * @param text The null terminated text.
+     *
+     * @return true if the symbol holds the text.
+     */
+    bool convertStringToQRCode(const char* text);
+
+    /**
+     * Encodes binary data, unless it is the data encoded last, and writes the modules into
+     * the bitmap.
+     *
+     * @param data   The data.
+     * @param length The length of the data in bytes.
+     *
+     * @return true if the symbol holds the data.
+     */
+    bool convertBinaryDataToQRCode(const uint8_t* data, size_t length);
+
+    /**
+     * Sets the version, and the size, of the symbol. The payload must be encoded again.
+     *
+     * @param version The version, from 1 to 40.
+     */
+    void setQRCodeVersion(uint8_t version);
+
+    /**
+     * Sets the error correction of the symbol. The payload must be encoded again.
+     *
+     * @param level The error correction level.
+     */
+    void setErrorCorrectionLevel(ECCLevel level);
+
+    /**
+     * Sets the colors of the modules, and writes them into the bitmap.
+     *
+     * @param colorBlack The color of the dark modules.
+     * @param colorWhite The color of the light modules.
+     */
+    void setColors(touchgfx::colortype colorBlack, touchgfx::colortype colorWhite);
+
+    virtual void draw(const touchgfx::Rect& invalidatedArea) const;
+
+    /**
+     * Gets the encoding and drawing of all GPU QR codes since the last reset.
+     *
+     * @return The statistics.
+     */
+    static const Stats& getStats()
+    {
+        return stats;
+    }
+
+    /** Resets the statistics. */
+    static void resetStats();
+
+private:
+    /** Encodes the payload, unless it is the payload encoded last. */
+    bool convert(const void* payload, size_t length, bool binary);
+    /** Writes the modules of the symbol into the bitmap, creating it if needed. */
+    void writeModules();
+    void release();
+    void bitmapMoved(touchgfx::BitmapId oldId, touchgfx::BitmapId newId);
+
+    touchgfx::Callback<GPUQRCode, touchgfx::BitmapId, touchgfx::BitmapId> bitmapMovedCallback;
+    touchgfx::BitmapId modules; ///< One pixel per module, BITMAP_INVALID if none
+    uint8_t* symbol;            ///< The buffer of the symbol
+    uint8_t payload[GPU_QRCODE_PAYLOAD_BYTES]; ///< The payload encoded last
+    size_t payloadLength;
+    bool encoded;       ///< The symbol holds the payload
+    bool binaryPayload; ///< The payload was encoded as binary data, not text
+    uint16_t dark;      ///< RGB565 of the dark modules
+    uint16_t light;     ///< RGB565 of the light modules
+
+    static Stats stats;
+};
+
+#endif // GPUQRCODE_HPP
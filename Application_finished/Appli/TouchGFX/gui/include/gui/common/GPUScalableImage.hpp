@@ -0,0 +1,72 @@
+#ifndef GPUSCALABLEIMAGE_HPP
+#define GPUSCALABLEIMAGE_HPP
+
+#include <touchgfx/containers/ZoomAnimationImage.hpp>
+#include <touchgfx/widgets/ScalableImage.hpp>
+
+/**
+ * A ScalableImage drawn with one GPU2D blit, the bitmap fitted to the widget.
+ *
+ * ScalableImage draws its bitmap as two texture mapped triangles, each one set up on the
+ * CPU by the texture mapper of its format and scaling algorithm. TouchGFXHAL::
+ * drawScaledBitmap() binds the bitmap once and lets GPU2D fit it to the widget, sampling
+ * the nearest texel for NEAREST_NEIGHBOR and filtering bilinearly for
+ * BILINEAR_INTERPOLATION. A bitmap drawn at less than half its size is sampled from its
+ * TextureMipChain level, if it has one.
+ *
+ * The simulator, the software renderers and the formats GPU2D does not sample as a single
+ * texture, such as L8 and compressed bitmaps, are drawn by ScalableImage.
+ */
+class GPUScalableImage : public touchgfx::ScalableImage
+{
+public:
+    GPUScalableImage(const touchgfx::Bitmap& bmp = touchgfx::Bitmap());
+
+    virtual void draw(const touchgfx::Rect& invalidatedArea) const;
+};
+
+/**
+ * A ZoomAnimationImage which can zoom continuously, drawing its large bitmap scaled by
+ * GPU2D every tick.
+ *
+ * ZoomAnimationImage switches from an Image of the small bitmap, to a ScalableImage of the
+ * large bitmap, to an Image of the large bitmap as it grows, and the image visibly jumps
+ * from one sampling to the other at the sizes of the bitmaps. With setContinuousZoom(),
+ * the large bitmap is always drawn by a GPUScalableImage, in every frame of the animation
+ * and at rest, with the scaling mode of the widget as its filter.
+ */
+class GPUZoomAnimationImage : public touchgfx::ZoomAnimationImage
+{
+public:
+    GPUZoomAnimationImage();
+
+    /**
+     * Draws the large bitmap scaled at every size, or the bitmaps as ZoomAnimationImage
+     * does.
+     *
+     * @param continuous true to always draw the large bitmap scaled by GPU2D.
+     */
+    void setContinuousZoom(bool continuous);
+
+    /**
+     * Tells if the large bitmap is drawn scaled at every size.
+     *
+     * @return true if zooming continuously.
+     */
+    bool isContinuousZoom() const
+    {
+        return continuousZoom;
+    }
+
+    virtual void setScalingMode(touchgfx::ScalableImage::ScalingAlgorithm mode);
+
+    virtual void setAlpha(uint8_t newAlpha);
+
+protected:
+    virtual void updateRenderingMethod();
+
+    GPUScalableImage gpuImage; ///< Draws the large bitmap when zooming continuously
+    bool continuousZoom;
+};
+
+#endif // GPUSCALABLEIMAGE_HPP
@@ -0,0 +1,36 @@
+#ifndef GPUTILEDIMAGE_HPP
+#define GPUTILEDIMAGE_HPP
+
+#include <touchgfx/widgets/TiledImage.hpp>
+
+/**
+ * A TiledImage drawn from one GPU2D texture, in one blit when the bitmap wraps.
+ *
+ * TiledImage calls drawPartialBitmap() for every tile the invalidated area crosses, and a
+ * small pattern behind a full screen costs dozens of blits, each one binding the bitmap
+ * again. TouchGFXHAL::drawTiledBitmap() binds the bitmap once. A bitmap with a power of
+ * two width and height is bound with repeat addressing and the area is drawn with a single
+ * blit at the offset; other sizes are drawn with a blit per tile.
+ *
+ * scroll() moves the pattern, for animated backgrounds: only the offset changes, the
+ * widget is redrawn with the same single blit.
+ *
+ * The simulator and the software renderers draw as TiledImage.
+ */
+class GPUTiledImage : public touchgfx::TiledImage
+{
+public:
+    GPUTiledImage(const touchgfx::Bitmap& bmp = touchgfx::Bitmap());
+
+    /**
+     * Moves the pattern and invalidates the widget.
+     *
+     * @param dx Pixels to move the pattern right, negative to move it left.
+     * @param dy Pixels to move the pattern down, negative to move it up.
+     */
+    void scroll(int16_t dx, int16_t dy);
+
+    virtual void draw(const touchgfx::Rect& invalidatedArea) const;
+};
+
+#endif // GPUTILEDIMAGE_HPP
@@ -0,0 +1,131 @@
+#ifndef GRADIENTCACHE_HPP
+#define GRADIENTCACHE_HPP
+
+#include <touchgfx/hal/VectorRenderer.hpp>
+#include <touchgfx/widgets/canvas/AbstractPainterLinearGradient.hpp>
+
+/**
+ * Number of gradient ramps kept, 4 KB each.
+ */
+#ifndef GRADIENT_CACHE_RAMPS
+#define GRADIENT_CACHE_RAMPS 8
+#endif
+
+/**
+ * Most stops of a cached gradient. Gradients with more stops are not drawn.
+ */
+#ifndef GRADIENT_CACHE_STOPS
+#define GRADIENT_CACHE_STOPS 8
+#endif
+
+/**
+ * The color ramps of the gradients drawn, kept in internal RAM and shared by all painters.
+ *
+ * The linear gradient painters and CWRVectorRenderer look up the color of every pixel in a
+ * ramp of 1024 ARGB8888 colors, which SVG images have in flash. A gradient set up by code
+ * has its ramp computed from the stops, 1024 interpolations, and a gauge animating its
+ * gradient line would do that every frame for the same stops. Ramps are kept by the stops
+ * they were computed from, so every painter and widget with the same stops shares one.
+ * When all ramps are in use, the least recently used one is computed again.
+ *
+ * While TouchGFXHAL::getQualityGovernor() has lowered the quality, new ramps only
+ * interpolate every QualityGovernor::Settings::gradientStep entries and repeat the colors in
+ * between. Such a ramp is computed again at full quality the first time it is used after
+ * the quality is raised.
+ */
+class GradientCache
+{
+public:
+    /** Lookups since the last reset. */
+    struct Stats
+    {
+        uint32_t hits;    ///< Ramps found
+        uint32_t builds;  ///< Ramps computed
+        uint32_t evicted; ///< Ramps replaced to make room
+    };
+
+    /**
+     * Gets the ramp of a gradient, computing it the first time.
+     *
+     * @param       stops         The number of stops, at least 1.
+     * @param       stopPositions The positions of the stops from 0 to 1, ascending.
+     * @param       stopColors    The ARGB8888 colors of the stops.
+     * @param [out] solid         True if all colors are opaque.
+     *
+     * @return The 1024 ARGB8888 colors, or 0 if there are too many stops.
+     */
+    static const uint32_t* getRamp(uint32_t stops, const float* stopPositions, const uint32_t* stopColors, bool& solid);
+
+    /**
+     * Sets the ramp of a gradient as the texture of a linear gradient painter.
+     *
+     * @param [in,out] painter       The painter.
+     * @param          stops         The number of stops.
+     * @param          stopPositions The positions of the stops from 0 to 1, ascending.
+     * @param          stopColors    The ARGB8888 colors of the stops.
+     *
+     * @return false if there are too many stops.
+     */
+    static bool setGradient(touchgfx::AbstractPainterLinearGradient& painter, uint32_t stops, const float* stopPositions, const uint32_t* stopColors);
+
+    /**
+     * Sets a linear gradient on a vector renderer with the ramp of its stops as palette.
+     *
+     * @param [in,out] renderer      The renderer.
+     * @param          x0            The x coordinate of the first color.
+     * @param          y0            The y coordinate of the first color.
+     * @param          x1            The x coordinate of the last color.
+     * @param          y1            The y coordinate of the last color.
+     * @param          stops         The number of stops.
+     * @param          stopPositions The positions of the stops from 0 to 1, ascending.
+     * @param          stopColors    The ARGB8888 colors of the stops.
+     * @param          width         The width of the box to fill.
+     * @param          height        The height of the box to fill.
+     *
+     * @return false if there are too many stops.
+     */
+    static bool setLinearGradient(touchgfx::VectorRenderer& renderer, float x0, float y0, float x1, float y1, uint32_t stops, const float* stopPositions, const uint32_t* stopColors, float width, float height);
+
+    /**
+     * Removes all ramps.
+     */
+    static void clear();
+
+    /**
+     * Gets the lookup statistics.
+     *
+     * @return The lookup statistics.
+     */
+    static const Stats& getStats()
+    {
+        return stats;
+    }
+
+    /**
+     * Resets the lookup statistics.
+     */
+    static void resetStats();
+
+private:
+    static const uint16_t RAMP_SIZE = 1024;
+
+    /** A computed ramp and the stops it was computed from. */
+    struct Entry
+    {
+        uint32_t stops; ///< 0 if free
+        float positions[GRADIENT_CACHE_STOPS];
+        uint32_t colors[GRADIENT_CACHE_STOPS];
+        uint32_t lastUsed;
+        uint16_t step; ///< Entries between interpolated colors
+        bool solid;
+    };
+
+    static void build(uint32_t* ramp, uint32_t stops, const float* stopPositions, const uint32_t* stopColors, uint16_t step);
+
+    static Entry entries[GRADIENT_CACHE_RAMPS];
+    static uint32_t ramps[GRADIENT_CACHE_RAMPS][RAMP_SIZE];
+    static uint32_t clock;
+    static Stats stats;
+};
+
+#endif // GRADIENTCACHE_HPP
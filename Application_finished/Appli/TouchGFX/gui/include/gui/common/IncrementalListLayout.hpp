@@ -0,0 +1,151 @@
+#ifndef INCREMENTALLISTLAYOUT_HPP
+#define INCREMENTALLISTLAYOUT_HPP
+
+#include <touchgfx/containers/Container.hpp>
+
+/**
+ * A ListLayout that moves only the children after the one added, inserted or removed.
+ *
+ * ListLayout::add() walks the children to the end of the list to append one, and insert()
+ * and remove() walk all the children twice, once to move them and once to link or unlink
+ * the drawable, so building a list of n rows visits n * n / 2 drawables and every row
+ * inserted into a long list visits all of them again. IncrementalListLayout keeps its last
+ * child and the end of the list, so add() is constant time, insert() after a given child
+ * visits only the children after it, and remove() visits the list once.
+ *
+ * The children are positioned like in ListLayout, one after the other to the ::SOUTH or
+ * to the ::EAST, and the layout is as wide, or as high, as its widest, or highest, child.
+ * A child resized after it was added must be passed to relayout().
+ *
+ * By default the layout invalidates nothing, like ListLayout, and the caller invalidates
+ * the list. With setInvalidateMovedRange() the layout invalidates the range of the list
+ * that changed itself, from the drawable added, inserted or removed to the end of the
+ * list, before and after the change, so a row appended invalidates that row only.
+ */
+class IncrementalListLayout : public touchgfx::Container
+{
+public:
+    /** Children laid out by all incremental list layouts since the last reset. */
+    struct Stats
+    {
+        uint32_t added;    ///< Drawables appended
+        uint32_t inserted; ///< Drawables inserted
+        uint32_t removed;  ///< Drawables removed
+        uint32_t moved;    ///< Children moved by the drawables inserted, removed or resized
+        uint32_t visited;  ///< Children visited to find a drawable removed
+    };
+
+    explicit IncrementalListLayout(const touchgfx::Direction d = touchgfx::SOUTH);
+
+    /**
+     * Sets the direction the children are laid out in, and lays them out again.
+     *
+     * @param d ::SOUTH or ::EAST.
+     */
+    void setDirection(const touchgfx::Direction d);
+
+    /**
+     * Gets the direction the children are laid out in.
+     *
+     * @return ::SOUTH or ::EAST.
+     */
+    touchgfx::Direction getDirection() const
+    {
+        return direction;
+    }
+
+    /**
+     * Makes add(), insert(), remove() and relayout() invalidate the range of the list that
+     * moved.
+     *
+     * @param invalidate true to invalidate the range that moved, false to leave the
+     *                   invalidation to the caller.
+     */
+    void setInvalidateMovedRange(bool invalidate)
+    {
+        invalidateMoved = invalidate;
+    }
+
+    /** Appends a drawable after the last child, in constant time. */
+    virtual void add(touchgfx::Drawable& d);
+
+    /**
+     * Inserts a drawable after a child, moving the children after it.
+     *
+     * @param [in]     previous The child to insert after, 0 to insert first.
+     * @param [in,out] d        The drawable.
+     */
+    virtual void insert(touchgfx::Drawable* previous, touchgfx::Drawable& d);
+
+    /** Removes a child, moving the children after it back. */
+    virtual void remove(touchgfx::Drawable& d);
+
+    virtual void removeAll();
+
+    /**
+     * Lays the children out again from a child on, after it was resized.
+     *
+     * @param [in] from The first child moved or resized, 0 for all the children.
+     */
+    void relayout(touchgfx::Drawable* from);
+
+    /**
+     * Gets the last child, in constant time.
+     *
+     * @return The last child, or 0 if the list is empty.
+     */
+    touchgfx::Drawable* getLastListChild() const
+    {
+        return lastChild;
+    }
+
+    /**
+     * Gets the statistics of the layouts.
+     *
+     * @return The statistics.
+     */
+    static const Stats& getStats()
+    {
+        return stats;
+    }
+
+    /**
+     * Resets the statistics of the layouts.
+     */
+    static void resetStats();
+
+private:
+    /** Reaches the links that Container, a friend of Drawable, maintains. */
+    struct Access : public touchgfx::Container
+    {
+        static void link(touchgfx::Drawable& d, touchgfx::Drawable* parent, touchgfx::Drawable* next)
+        {
+            d.*(&Access::parent) = parent;
+            d.*(&Access::nextSibling) = next;
+        }
+
+        static void setNext(touchgfx::Drawable& d, touchgfx::Drawable* next)
+        {
+            d.*(&Access::nextSibling) = next;
+        }
+    };
+
+    int16_t length(const touchgfx::Drawable& d) const;
+    int16_t breadth(const touchgfx::Drawable& d) const;
+    int16_t end(const touchgfx::Drawable& d) const;
+    void place(touchgfx::Drawable& d, int16_t coord);
+    int16_t moveFrom(touchgfx::Drawable* d, int16_t coord, int16_t& breadthMax);
+    void resize(int16_t newOffset, int16_t newBreadth);
+    void invalidateFrom(int16_t coord);
+    void changed();
+
+    touchgfx::Direction direction;
+    touchgfx::Drawable* lastChild;
+    int16_t offset;       ///< End of the last child
+    int16_t widest;       ///< Width, or height, of the widest, or highest, child
+    bool invalidateMoved; ///< Changes invalidate the range that moved
+
+    static Stats stats;
+};
+
+#endif // INCREMENTALLISTLAYOUT_HPP
@@ -0,0 +1,287 @@
+#ifndef INDEXEDCONTAINER_HPP
+#define INDEXEDCONTAINER_HPP
+
+#include <touchgfx/containers/Container.hpp>
+#include <string.h>
+
+/** Number of columns and rows of the grid an IndexedContainer divides its area into. */
+#ifndef INDEXED_CONTAINER_GRID
+#define INDEXED_CONTAINER_GRID 8
+#endif
+
+/**
+ * Calls the protected Drawable::setupDrawChain() of another drawable, as Container, a
+ * friend of Drawable, does for its children.
+ */
+struct DrawChainAccess : public touchgfx::Drawable
+{
+    static void setup(touchgfx::Drawable& drawable, const touchgfx::Rect& invalidatedArea, touchgfx::Drawable** nextPreviousElement)
+    {
+        (drawable.*(&DrawChainAccess::setupDrawChain))(invalidatedArea, nextPreviousElement);
+    }
+};
+
+/**
+ * A Container that finds the children at a point or in a rectangle with a uniform grid,
+ * instead of visiting every child.
+ *
+ * Container::getLastChild(), for the hit test of a press, and Container::setupDrawChain(),
+ * for every area drawn, scan all the children. A screen with hundreds of drawables in one
+ * container spends more time in those scans than in drawing a small area. The
+ * IndexedContainer divides its area into INDEXED_CONTAINER_GRID x INDEXED_CONTAINER_GRID
+ * cells and keeps, for every cell, the set of children that overlap it, as a bit per child
+ * in z-order. A point visits the children of one cell, a rectangle those of the cells it
+ * covers, in the order Container visits them, so the drawables found and the draw chain
+ * are the same.
+ *
+ * The index is rebuilt before the first lookup after children are added, inserted or
+ * removed, after the container is resized and after childGeometryChanged() is called.
+ * Drawables do not tell their parent when they move, so a child moved or resized after the
+ * screen is set up must be declared as IndexedChild<T>, or the code moving it must call
+ * childGeometryChanged() on the container; otherwise it is hit and drawn where it was.
+ * With more than MAX_CHILDREN children the container scans them as Container does.
+ *
+ * @tparam MAX_CHILDREN The most children indexed.
+ */
+template <uint16_t MAX_CHILDREN>
+class IndexedContainer : public touchgfx::Container
+{
+public:
+    IndexedContainer()
+        : count(0), cellWidth(1), cellHeight(1), stale(true), overflow(false)
+    {
+    }
+
+    virtual void add(touchgfx::Drawable& d)
+    {
+        touchgfx::Container::add(d);
+        stale = true;
+    }
+
+    virtual void remove(touchgfx::Drawable& d)
+    {
+        touchgfx::Container::remove(d);
+        stale = true;
+    }
+
+    virtual void removeAll()
+    {
+        touchgfx::Container::removeAll();
+        stale = true;
+    }
+
+    virtual void insert(touchgfx::Drawable* previous, touchgfx::Drawable& d)
+    {
+        touchgfx::Container::insert(previous, d);
+        stale = true;
+    }
+
+    virtual void setWidth(int16_t width)
+    {
+        touchgfx::Container::setWidth(width);
+        stale = true;
+    }
+
+    virtual void setHeight(int16_t height)
+    {
+        touchgfx::Container::setHeight(height);
+        stale = true;
+    }
+
+    /** Marks the index to be rebuilt, as a child moved or was resized. */
+    virtual void childGeometryChanged()
+    {
+        touchgfx::Container::childGeometryChanged();
+        stale = true;
+    }
+
+    virtual void getLastChild(int16_t x, int16_t y, touchgfx::Drawable** last)
+    {
+        update();
+        if (overflow || x < 0 || y < 0 || x >= getWidth() || y >= getHeight())
+        {
+            touchgfx::Container::getLastChild(x, y, last);
+            return;
+        }
+        if (!isVisible())
+        {
+            return;
+        }
+        if (isTouchable())
+        {
+            *last = this;
+        }
+        const uint32_t* const bits = cells[y / cellHeight][x / cellWidth];
+        for (uint16_t word = 0; word < WORDS; word++)
+        {
+            uint16_t index = word * 32;
+            for (uint32_t set = bits[word]; set != 0; set >>= 1, index++)
+            {
+                if (!(set & 1U))
+                {
+                    continue;
+                }
+                touchgfx::Drawable* const d = children[index];
+                if (d->getRect().intersect(x, y))
+                {
+                    d->getLastChild(x - d->getX(), y - d->getY(), last);
+                }
+            }
+        }
+    }
+
+protected:
+    virtual void setupDrawChain(const touchgfx::Rect& invalidatedArea, touchgfx::Drawable** nextPreviousElement)
+    {
+        update();
+        if (overflow)
+        {
+            touchgfx::Container::setupDrawChain(invalidatedArea, nextPreviousElement);
+            return;
+        }
+        resetDrawChainCache();
+        const touchgfx::Rect area = invalidatedArea & touchgfx::Rect(0, 0, getWidth(), getHeight());
+        if (area.isEmpty())
+        {
+            return;
+        }
+
+        // The children of all the cells covered, each once
+        uint32_t bits[WORDS];
+        memset(bits, 0, sizeof(bits));
+        for (int row = area.y / cellHeight; row <= (area.bottom() - 1) / cellHeight; row++)
+        {
+            for (int column = area.x / cellWidth; column <= (area.right() - 1) / cellWidth; column++)
+            {
+                for (uint16_t word = 0; word < WORDS; word++)
+                {
+                    bits[word] |= cells[row][column][word];
+                }
+            }
+        }
+        for (uint16_t word = 0; word < WORDS; word++)
+        {
+            uint16_t index = word * 32;
+            for (uint32_t set = bits[word]; set != 0; set >>= 1, index++)
+            {
+                if (!(set & 1U))
+                {
+                    continue;
+                }
+                touchgfx::Drawable* const d = children[index];
+                if (d->isVisible())
+                {
+                    touchgfx::Rect drawableRegion = d->getRect() & invalidatedArea;
+                    if (!drawableRegion.isEmpty())
+                    {
+                        drawableRegion.x -= d->getX();
+                        drawableRegion.y -= d->getY();
+                        DrawChainAccess::setup(*d, drawableRegion, nextPreviousElement);
+                    }
+                }
+            }
+        }
+    }
+
+private:
+    static const uint16_t WORDS = (MAX_CHILDREN + 31) / 32;
+
+    void update()
+    {
+        if (!stale)
+        {
+            return;
+        }
+        stale = false;
+        memset(cells, 0, sizeof(cells));
+        count = 0;
+        overflow = false;
+        cellWidth = (getWidth() + INDEXED_CONTAINER_GRID - 1) / INDEXED_CONTAINER_GRID;
+        cellHeight = (getHeight() + INDEXED_CONTAINER_GRID - 1) / INDEXED_CONTAINER_GRID;
+        if (cellWidth < 1 || cellHeight < 1)
+        {
+            cellWidth = cellHeight = 1;
+            overflow = true;
+            return;
+        }
+
+        const touchgfx::Rect bounds(0, 0, getWidth(), getHeight());
+        for (touchgfx::Drawable* d = getFirstChild(); d != 0; d = d->getNextSibling())
+        {
+            if (count == MAX_CHILDREN)
+            {
+                overflow = true;
+                return;
+            }
+            const uint16_t index = count++;
+            children[index] = d;
+            // Outside the container a child is neither hit nor drawn
+            const touchgfx::Rect r = d->getRect() & bounds;
+            if (r.isEmpty())
+            {
+                continue;
+            }
+            for (int row = r.y / cellHeight; row <= (r.bottom() - 1) / cellHeight; row++)
+            {
+                for (int column = r.x / cellWidth; column <= (r.right() - 1) / cellWidth; column++)
+                {
+                    cells[row][column][index / 32] |= 1U << (index % 32);
+                }
+            }
+        }
+    }
+
+    touchgfx::Drawable* children[MAX_CHILDREN];              ///< The children in z-order
+    uint32_t cells[INDEXED_CONTAINER_GRID][INDEXED_CONTAINER_GRID][WORDS]; ///< The children overlapping each cell
+    uint16_t count;
+    int16_t cellWidth;
+    int16_t cellHeight;
+    bool stale;     ///< The index is rebuilt before the next lookup
+    bool overflow;  ///< Too many children, or no area, the children are scanned
+};
+
+/**
+ * A child of an IndexedContainer that tells its parent when it moves or is resized, so
+ * the index follows it. Move animations and moveTo() work on it as on T.
+ *
+ * @tparam T The drawable.
+ */
+template <class T>
+class IndexedChild : public T
+{
+public:
+    virtual void setX(int16_t x)
+    {
+        T::setX(x);
+        geometryChanged();
+    }
+
+    virtual void setY(int16_t y)
+    {
+        T::setY(y);
+        geometryChanged();
+    }
+
+    virtual void setWidth(int16_t width)
+    {
+        T::setWidth(width);
+        geometryChanged();
+    }
+
+    virtual void setHeight(int16_t height)
+    {
+        T::setHeight(height);
+        geometryChanged();
+    }
+
+private:
+    void geometryChanged()
+    {
+        if (T::getParent() != 0)
+        {
+            T::getParent()->childGeometryChanged();
+        }
+    }
+};
+
+#endif // INDEXEDCONTAINER_HPP
@@ -0,0 +1,239 @@
+#ifndef LRUFONTCACHE_HPP
+#define LRUFONTCACHE_HPP
+
+#include <fonts/FontCache.hpp>
+#include <fonts/GeneratedFont.hpp>
+
+/**
+ * Number of glyphs the cache keeps track of, whatever the size of its memory.
+ */
+#ifndef LRU_FONT_CACHE_GLYPHS
+#define LRU_FONT_CACHE_GLYPHS 256
+#endif
+
+/**
+ * Number of glyphs missing from the cache that are looked up in one pass over the glyph
+ * table of the font data. Strings with more missing characters take several passes.
+ */
+#ifndef LRU_FONT_CACHE_PASS_GLYPHS
+#define LRU_FONT_CACHE_PASS_GLYPHS 32
+#endif
+
+class LRUCachedFont;
+
+/**
+ * A font cache that evicts the least recently used glyphs to make room for new ones.
+ *
+ * The generated touchgfx::FontCache only adds glyphs until its memory is full, and clear()
+ * is the only way to get memory back. This cache reads the same binary font data through a
+ * touchgfx::FontDataReader, but keeps every font in its own list of glyphs ordered by use.
+ * cacheString() only reads the glyphs of a string that are not cached yet. When they do not
+ * fit, the glyphs used longest ago, over all fonts, are evicted and the remaining glyphs
+ * are moved together, so switching language only replaces the glyphs that differ.
+ *
+ * Glyphs of the string being cached are never evicted for that string. Glyphs move when
+ * memory is compacted, so cacheString() must not be called while a frame is drawn, as with
+ * the generated cache. GSUB and contextual forms tables are not cached, the tables of the
+ * flash font are used.
+ */
+class LRUFontCache
+{
+public:
+    /** Lookups and memory use since the last reset. */
+    struct Stats
+    {
+        uint32_t hits;        ///< Glyphs found by LRUCachedFont when drawing
+        uint32_t misses;      ///< Glyphs not found when drawing
+        uint32_t loaded;      ///< Glyphs read from the font data
+        uint32_t evicted;     ///< Glyphs evicted to make room
+        uint32_t compactions; ///< Times memory was compacted
+    };
+
+    LRUFontCache();
+
+    /**
+     * Sets the reader that the binary font data is read with.
+     *
+     * @param [in] reader The reader.
+     */
+    void setReader(touchgfx::FontDataReader* reader);
+
+    /**
+     * Sets the memory that glyphs are cached in, and removes all glyphs.
+     *
+     * @param [in] memory The memory, 4 byte aligned.
+     * @param      size   Size of the memory in bytes.
+     */
+    void setMemory(uint8_t* memory, uint32_t size);
+
+    /**
+     * Removes all glyphs.
+     */
+    void clear();
+
+    /**
+     * Makes a font that draws the glyphs of a typed text from this cache.
+     *
+     * @param      t    A typed text with the font.
+     * @param [out] font The font to initialize.
+     */
+    void initializeCachedFont(touchgfx::TypedText t, LRUCachedFont* font);
+
+    /**
+     * Makes sure all characters of a string are in the cache. Only the glyphs that are not
+     * cached yet are read, evicting the least recently used glyphs if needed.
+     *
+     * @param t      A typed text with the font to cache the glyphs of.
+     * @param string The characters.
+     *
+     * @return false if not all glyphs fit in the cache.
+     */
+    bool cacheString(touchgfx::TypedText t, const touchgfx::Unicode::UnicodeChar* string);
+
+    /**
+     * Finds a cached glyph and marks it as the most recently used glyph of its font.
+     *
+     * @param unicode The character.
+     * @param font    The font.
+     *
+     * @return The glyph node, followed by the pixel data, or 0 if not cached.
+     */
+    const touchgfx::GlyphNode* getGlyph(touchgfx::Unicode::UnicodeChar unicode, touchgfx::FontId font);
+
+    /**
+     * Tells if a glyph node is in the cache memory.
+     *
+     * @param glyph The glyph node.
+     *
+     * @return true if the node is followed by its pixel data.
+     */
+    bool contains(const touchgfx::GlyphNode* glyph) const
+    {
+        const uint8_t* const node = reinterpret_cast<const uint8_t*>(glyph);
+        return node >= memory && node < memory + memorySize;
+    }
+
+    /**
+     * Gets the number of bytes taken by cached glyphs.
+     *
+     * @return Bytes used.
+     */
+    uint32_t getMemoryUsage() const
+    {
+        return usedBytes;
+    }
+
+    /**
+     * Gets the lookup statistics.
+     *
+     * @return The lookup statistics.
+     */
+    const Stats& getStats() const
+    {
+        return stats;
+    }
+
+    /**
+     * Resets the lookup statistics.
+     */
+    void resetStats();
+
+private:
+    static const uint16_t NONE = 0xFFFF;
+
+    /** A cached glyph. */
+    struct Slot
+    {
+        uint32_t offset;   ///< Block in memory
+        uint32_t lastUsed; ///< Value of clock when last used
+        uint16_t size;     ///< Bytes of the block
+        uint16_t prev;     ///< More recently used glyph of the font
+        uint16_t next;     ///< Less recently used glyph of the font, or next free slot
+        touchgfx::Unicode::UnicodeChar unicode;
+        uint8_t font;
+    };
+
+    /** Start of a block in memory, followed by the glyph node and the pixel data. */
+    struct BlockHeader
+    {
+        uint16_t slot; ///< Slot of the glyph, NONE once evicted
+        uint16_t size; ///< Bytes of the block
+    };
+
+    /** Glyphs of a font, the most recently used first. */
+    struct FontList
+    {
+        uint16_t first;
+        uint16_t last;
+    };
+
+    uint16_t find(touchgfx::Unicode::UnicodeChar unicode, touchgfx::FontId font) const;
+    void touch(uint16_t slot);
+    void unlink(uint16_t slot);
+    void linkFirst(uint16_t slot);
+    void evict(uint16_t slot);
+    bool allocate(uint32_t bytes, uint32_t protectFrom, uint32_t& offset);
+    void compact();
+    touchgfx::GlyphNode* nodeAt(uint32_t offset) const
+    {
+        return reinterpret_cast<touchgfx::GlyphNode*>(memory + offset + sizeof(BlockHeader));
+    }
+    bool loadGlyphs(touchgfx::FontId font, uint8_t bpp, uint8_t byteAlignRow, const touchgfx::Unicode::UnicodeChar* missing, uint16_t count, uint32_t protectFrom);
+    uint32_t glyphBytes(const touchgfx::GlyphNode& node, uint8_t bpp, uint8_t byteAlignRow) const;
+
+    Slot slots[LRU_FONT_CACHE_GLYPHS];
+    FontList fonts[MAX(TypographyFontIndex::NUMBER_OF_FONTS, 1)];
+    uint16_t freeSlots;
+    uint8_t* memory;
+    uint32_t memorySize;
+    uint32_t top;       ///< First byte after the last block
+    uint32_t usedBytes; ///< Bytes of the blocks that are not evicted
+    uint32_t clock;     ///< Counts glyph uses
+    touchgfx::FontDataReader* reader;
+    Stats stats;
+};
+
+/**
+ * A font drawing the glyphs of a flash font from an LRUFontCache, for the characters the
+ * flash font does not hold.
+ */
+class LRUCachedFont : public touchgfx::GeneratedFont
+{
+public:
+    LRUCachedFont(const struct touchgfx::BinaryFontData* data, touchgfx::FontId id, LRUFontCache* cache, const touchgfx::GeneratedFont* flashFont);
+
+    LRUCachedFont()
+        : GeneratedFont(), fontId(0), cache(0), flashFont(0)
+    {
+    }
+
+    using GeneratedFont::getGlyph;
+
+    virtual const touchgfx::GlyphNode* getGlyph(touchgfx::Unicode::UnicodeChar unicode, const uint8_t*& pixelData, uint8_t& bitsPerPixel) const;
+
+    virtual const uint8_t* getPixelData(const touchgfx::GlyphNode* glyph) const;
+
+    virtual int8_t getKerning(touchgfx::Unicode::UnicodeChar prevChar, const touchgfx::GlyphNode* glyph) const;
+
+    touchgfx::FontId getFontId() const
+    {
+        return fontId;
+    }
+
+    virtual const uint16_t* getGSUBTable() const
+    {
+        return flashFont->getGSUBTable();
+    }
+
+    virtual const touchgfx::FontContextualFormsTable* getContextualFormsTable() const
+    {
+        return flashFont->getContextualFormsTable();
+    }
+
+private:
+    touchgfx::FontId fontId;
+    LRUFontCache* cache;
+    const touchgfx::GeneratedFont* flashFont;
+};
+
+#endif // LRUFONTCACHE_HPP
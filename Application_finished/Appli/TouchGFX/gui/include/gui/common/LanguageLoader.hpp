@@ -0,0 +1,145 @@
+#ifndef LANGUAGELOADER_HPP
+#define LANGUAGELOADER_HPP
+
+#include <touchgfx/Texts.hpp>
+#include <touchgfx/hal/FlashDataReader.hpp>
+#include <texts/TextKeysAndLanguages.hpp>
+
+class LRUFontCache;
+
+/**
+ * Loads the texts of one language at a time from external flash into RAM.
+ *
+ * The generated Texts keep every language linked in, and each text drawn is read from XIP
+ * flash at a random address. With binary translations, each language is a blob of texts,
+ * indices and typed texts, placed in external flash by the application and registered with
+ * setSource(). setLanguage() copies the blob of the language into the memory given to
+ * setMemory(), through a touchgfx::FlashDataReader if the flash is not memory mapped,
+ * and installs it with Texts::setTranslation(). Only the data of that language is read,
+ * and text lookups then read RAM. The blob of the previous language is overwritten and its
+ * translation removed, so a language is only shown through this loader.
+ *
+ * With an LRUFontCache, the glyphs of all texts of the new language are cached as well, and
+ * the glyphs the languages share stay cached. Texts laid out by ShapedTextCache are removed,
+ * as they point to the texts of the previous language.
+ *
+ * Languages without a source, and any language when the blob does not fit, are set with
+ * Texts::setLanguage() from the texts linked in.
+ */
+class LanguageLoader
+{
+public:
+    /** Language switches since the last reset. */
+    struct Stats
+    {
+        uint32_t loads;       ///< Languages copied into RAM
+        uint32_t bytesLoaded; ///< Bytes copied
+        uint32_t linkedIn;    ///< Languages set from the texts linked in
+        uint32_t tooLarge;    ///< Blobs that did not fit in the memory
+    };
+
+    LanguageLoader();
+
+    /**
+     * Sets the memory the texts of the current language are kept in.
+     *
+     * @param [in] memory The memory, 4 byte aligned.
+     * @param      size   Size of the memory in bytes, at least the size of the largest blob.
+     */
+    void setMemory(uint8_t* memory, uint32_t size);
+
+    /**
+     * Sets the reader the blobs are read with, for flash that is not memory mapped.
+     *
+     * @param [in] reader The reader, 0 to copy the blobs with memcpy().
+     */
+    void setReader(touchgfx::FlashDataReader* reader);
+
+    /**
+     * Sets the font cache the glyphs of a new language are cached in.
+     *
+     * @param [in] cache The cache, 0 for none.
+     */
+    void setFontCache(LRUFontCache* cache);
+
+    /**
+     * Sets the binary translation of a language in external flash.
+     *
+     * @param id   The language.
+     * @param blob The translation generated by the text converter, 4 byte aligned.
+     * @param size Size of the translation in bytes.
+     */
+    void setSource(touchgfx::LanguageId id, const void* blob, uint32_t size);
+
+    /**
+     * Loads the texts of a language into RAM and makes it the current language.
+     *
+     * @param id The language.
+     *
+     * @return false if the texts linked in are used, as the language has no source or its
+     *         blob does not fit in the memory.
+     */
+    bool setLanguage(touchgfx::LanguageId id);
+
+    /**
+     * Gets the language whose texts are in RAM.
+     *
+     * @return The language, or NUMBER_OF_LANGUAGES if none.
+     */
+    touchgfx::LanguageId getLoadedLanguage() const
+    {
+        return loaded;
+    }
+
+    /**
+     * Gets the size of the texts in RAM.
+     *
+     * @return Bytes of the blob of the loaded language, 0 if none.
+     */
+    uint32_t getLoadedBytes() const
+    {
+        return loadedBytes;
+    }
+
+    /**
+     * Gets the language switch statistics.
+     *
+     * @return The statistics.
+     */
+    const Stats& getStats() const
+    {
+        return stats;
+    }
+
+    /** Resets the language switch statistics. */
+    void resetStats();
+
+private:
+    /** The first words of a binary translation. */
+    struct TranslationHeader
+    {
+        uint32_t offsetToTexts;
+        uint32_t offsetToIndices;
+        uint32_t offsetToTypedTexts;
+    };
+
+    struct Source
+    {
+        const void* blob; ///< 0 if none
+        uint32_t size;
+    };
+
+    void unload();
+    void cacheGlyphs();
+
+    Source sources[NUMBER_OF_LANGUAGES];
+    uint8_t* memory;
+    uint32_t memorySize;
+    touchgfx::FlashDataReader* reader;
+    LRUFontCache* fontCache;
+    touchgfx::LanguageId loaded;
+    uint32_t loadedBytes;
+    Stats stats;
+};
+
+#endif // LANGUAGELOADER_HPP
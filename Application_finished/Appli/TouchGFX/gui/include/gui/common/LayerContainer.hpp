@@ -0,0 +1,132 @@
+#ifndef LAYERCONTAINER_HPP
+#define LAYERCONTAINER_HPP
+
+#include <gui/common/DynamicBitmapArena.hpp>
+#include <touchgfx/containers/CacheableContainer.hpp>
+
+/**
+ * Ticks a container must move with unchanged content before it is drawn as a layer.
+ */
+#ifndef LAYER_PROMOTE_TICKS
+#define LAYER_PROMOTE_TICKS 2
+#endif
+
+/**
+ * Ticks without moving or fading before the layer of a container is released.
+ */
+#ifndef LAYER_RELEASE_TICKS
+#define LAYER_RELEASE_TICKS 30
+#endif
+
+/**
+ * Ticks in a row with changed content before a container stops being drawn as a layer, as
+ * rendering the layer again costs more than drawing the children in place.
+ */
+#ifndef LAYER_DEMOTE_TICKS
+#define LAYER_DEMOTE_TICKS 3
+#endif
+
+/**
+ * A container that draws itself as a single bitmap while it slides or fades.
+ *
+ * CacheableContainer draws its children once into a dynamic bitmap and then only the
+ * bitmap, but the bitmap must be set up and updated by hand. A LayerContainer promotes
+ * itself: when it has moved for LAYER_PROMOTE_TICKS ticks without its children changing,
+ * or is faded, its children are rendered into a layer in DynamicBitmapArena, and the container is
+ * drawn as one GPU2D blit with its alpha from then on. Changes to the children render the
+ * invalidated part of the layer again. The layer is released when the container has been
+ * still for LAYER_RELEASE_TICKS ticks, or its content keeps changing.
+ *
+ * A container whose first child is opaque over the whole container, like a Box as
+ * background, is drawn into a layer in the framebuffer format, RGB565, and the layer is
+ * drawn opaque. Other containers, such as the window of a ModalWindow with rounded
+ * corners or a dialog of buttons and texts, get an ARGB8888 layer, cleared to transparent
+ * pixels before the children are drawn into it, where GPU2D can draw into ARGB8888
+ * dynamic bitmaps. A fade of such a dialog then costs one blended blit per frame, the
+ * alpha of the container applied to the layer with the constant color of GPU2D, instead
+ * of drawing every child with the alpha. The simulator only promotes opaque containers.
+ * Moves and fades must be done with moveTo() and setAlpha(), as MoveAnimator and
+ * FadeAnimator do.
+ */
+class LayerContainer : public touchgfx::CacheableContainer
+{
+public:
+    /** Layer use of all containers since the last reset. */
+    struct Stats
+    {
+        uint32_t promotions;  ///< Layers set up
+        uint32_t renders;     ///< Times children were rendered into a layer
+        uint32_t demotions;   ///< Layers released as the content kept changing
+        uint32_t noMemory;    ///< Promotions that found no room for the layer
+        uint32_t translucent; ///< Promotions into an ARGB8888 layer
+    };
+
+    LayerContainer();
+
+    virtual ~LayerContainer();
+
+    virtual void moveTo(int16_t x, int16_t y);
+
+    /**
+     * Sets the alpha the container is drawn with, promoting it to a layer if it is not
+     * opaque.
+     *
+     * @param newAlpha The alpha.
+     */
+    void setAlpha(uint8_t newAlpha);
+
+    virtual void invalidateRect(touchgfx::Rect& invalidatedArea) const;
+
+    virtual void handleTickEvent();
+
+    /**
+     * Tells if the container is drawn as a layer.
+     *
+     * @return true if the container is drawn as a layer.
+     */
+    bool isLayer() const
+    {
+        return layer != touchgfx::BITMAP_INVALID;
+    }
+
+    /**
+     * Gets the layer statistics.
+     *
+     * @return The layer statistics.
+     */
+    static const Stats& getStats()
+    {
+        return stats;
+    }
+
+    /**
+     * Resets the layer statistics.
+     */
+    static void resetStats();
+
+private:
+    void animated();
+    bool promote();
+    void release();
+    bool isOpaque();
+    bool canBlendLayer() const;
+    void clearLayer(const touchgfx::Rect& area);
+    void layerMoved(touchgfx::BitmapId oldId, touchgfx::BitmapId newId);
+
+    touchgfx::Callback<LayerContainer, touchgfx::BitmapId, touchgfx::BitmapId> layerMovedCallback;
+    touchgfx::BitmapId layer;
+    mutable touchgfx::Rect changed; ///< Part of the content invalidated since the last tick
+    int16_t lastX;
+    int16_t lastY;
+    uint8_t lastAlpha;
+    uint16_t movingTicks;
+    uint16_t stillTicks;
+    uint16_t changingTicks;
+    bool ticking;
+    bool movingSelf;       ///< Invalidations come from moving, not from the children
+    bool translucentLayer; ///< The layer is ARGB8888, cleared before the children are drawn
+
+    static Stats stats;
+};
+
+#endif // LAYERCONTAINER_HPP
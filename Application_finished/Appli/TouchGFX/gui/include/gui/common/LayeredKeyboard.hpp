@@ -0,0 +1,155 @@
+#ifndef LAYEREDKEYBOARD_HPP
+#define LAYEREDKEYBOARD_HPP
+
+#include <gui/common/DynamicBitmapArena.hpp>
+#include <touchgfx/widgets/Keyboard.hpp>
+#include <touchgfx/widgets/Widget.hpp>
+
+/**
+ * Number of layouts, with their key mappings, whose layers LayeredKeyboard keeps. Switching
+ * back to a kept layout, as the shift and number keys do, does not render it again.
+ */
+#ifndef LAYERED_KEYBOARD_LAYOUTS
+#define LAYERED_KEYBOARD_LAYOUTS 2
+#endif
+
+/**
+ * A Keyboard drawn from two pre-rendered layers of its layout, the keys released and the
+ * keys pressed.
+ *
+ * Keyboard draws the bitmap of its layout, then the label of every key in the invalidated
+ * area with LCD::drawString(), and a pressed key as an Image of its highlight bitmap with
+ * the label drawn again over it. This keyboard renders each layout once, with its key
+ * mapping, into two bitmaps in DynamicBitmapArena with drawDrawableInDynamicBitmap(): the
+ * layout with all the labels, and the layout with every key highlighted and labelled. It
+ * is then drawn as blits of those: a pressed key is the part of the pressed layer under
+ * its highlight, the rest of the keyboard the released layer. Pressing and releasing a key
+ * invalidates only the key, as Keyboard does, and redraws it with two blits and no text.
+ *
+ * The entered text is drawn over the layers as by Keyboard. Layouts with transparent
+ * pixels get ARGB8888 layers, others RGB565 layers, which hide what is behind them.
+ *
+ * setLayout() and setKeymappingList() hide those of Keyboard, which are not virtual, so the
+ * keyboard must be set up through a LayeredKeyboard. Rendering the layers needs GPU2D, see
+ * TouchGFXHAL::canDrawInDynamicBitmap(), so the simulator, and layouts whose layers found
+ * no room, are drawn by Keyboard.
+ */
+class LayeredKeyboard : public touchgfx::Keyboard
+{
+public:
+    /** Layers of all the layered keyboards since the last reset. */
+    struct Stats
+    {
+        uint32_t rendered; ///< Layouts rendered into layers
+        uint32_t reused;   ///< Layouts set again while their layers were kept
+        uint32_t noMemory; ///< Layouts whose layers found no room
+        uint32_t keys;     ///< Pressed keys drawn from the pressed layer
+    };
+
+    LayeredKeyboard();
+
+    virtual ~LayeredKeyboard();
+
+    /**
+     * Sets the layout, and draws the keyboard from its layers, rendering them if they are
+     * not kept.
+     *
+     * @param newLayout The layout.
+     */
+    void setLayout(const Layout* newLayout);
+
+    /**
+     * Sets the key mapping, and draws the keyboard from the layers of the layout with it,
+     * rendering them if they are not kept.
+     *
+     * @param newKeyMappingList The key mapping.
+     */
+    void setKeymappingList(const KeyMappingList* newKeyMappingList);
+
+    /**
+     * Tells if the keyboard is drawn from layers.
+     *
+     * @return true if the layers of the layout and key mapping are rendered.
+     */
+    bool isLayered() const
+    {
+        return current != 0;
+    }
+
+    /** Releases the layers of all the layouts. */
+    void releaseLayers();
+
+    virtual void draw(const touchgfx::Rect& invalidatedArea) const;
+
+    virtual touchgfx::Rect getSolidRect() const;
+
+    /**
+     * Gets the layers of all the layered keyboards since the last reset.
+     *
+     * @return The statistics.
+     */
+    static const Stats& getStats()
+    {
+        return stats;
+    }
+
+    /** Resets the statistics. */
+    static void resetStats();
+
+protected:
+    /**
+     * Draws the keyboard under its children when layered, so the entered text is drawn
+     * over the layers.
+     */
+    virtual void setupDrawChain(const touchgfx::Rect& invalidatedArea, touchgfx::Drawable** nextPreviousElement);
+
+private:
+    /** The layers of a layout with a key mapping. */
+    struct Layers
+    {
+        const Layout* layout;          ///< 0 if the entry is free
+        const KeyMappingList* mapping;
+        touchgfx::BitmapId released;
+        touchgfx::BitmapId pressed;
+        uint32_t lastUsed;
+    };
+
+    /** Draws a layer of the layout when rendered into a bitmap. */
+    class LayerPainter : public touchgfx::Widget
+    {
+    public:
+        LayerPainter()
+            : Widget(), keyboard(0), pressed(false)
+        {
+        }
+
+        virtual void draw(const touchgfx::Rect& invalidatedArea) const;
+
+        virtual touchgfx::Rect getSolidRect() const
+        {
+            return touchgfx::Rect();
+        }
+
+        const LayeredKeyboard* keyboard;
+        bool pressed; ///< The keys are drawn highlighted
+    };
+
+    /** Finds or renders the layers of the layout and key mapping, and draws from them. */
+    void selectLayers();
+    bool render(Layers& layers);
+    void release(Layers& layers);
+    /** Draws the layout, highlighted if pressed, with the labels, placed at x, y. */
+    void drawLayer(const touchgfx::Rect& invalidatedArea, int16_t x, int16_t y, bool pressed) const;
+    void drawHighlight(touchgfx::BitmapId highlight, const touchgfx::Rect& keyArea, const touchgfx::Rect& invalidatedArea, int16_t x, int16_t y) const;
+    void bitmapMoved(touchgfx::BitmapId oldId, touchgfx::BitmapId newId);
+
+    touchgfx::Callback<LayeredKeyboard, touchgfx::BitmapId, touchgfx::BitmapId> bitmapMovedCallback;
+    Layers layers[LAYERED_KEYBOARD_LAYOUTS];
+    Layers* current; ///< The layers drawn, 0 when drawn by Keyboard
+    LayerPainter painter;
+    uint32_t uses;
+
+    static Stats stats;
+};
+
+#endif // LAYEREDKEYBOARD_HPP
@@ -0,0 +1,183 @@
+#ifndef NAVIGATIONPREFETCH_HPP
+#define NAVIGATIONPREFETCH_HPP
+
+#include <touchgfx/Bitmap.hpp>
+#include <touchgfx/TypedText.hpp>
+#include <string.h>
+
+/**
+ * Most bitmaps and most texts prefetched for a screen. Further assets are loaded from
+ * flash when the screen draws them, as without prefetching.
+ */
+#ifndef NAVIGATION_PREFETCH_BITMAPS
+#define NAVIGATION_PREFETCH_BITMAPS 8
+#endif
+
+#ifndef NAVIGATION_PREFETCH_TEXTS
+#define NAVIGATION_PREFETCH_TEXTS 8
+#endif
+
+/**
+ * Transitions from a screen to another counted before that screen is predicted to follow.
+ */
+#ifndef NAVIGATION_PREFETCH_MIN_TRANSITIONS
+#define NAVIGATION_PREFETCH_MIN_TRANSITIONS 2
+#endif
+
+/**
+ * Characters of a text whose glyphs are looked up per idle frame.
+ */
+#ifndef NAVIGATION_PREFETCH_GLYPHS_PER_FRAME
+#define NAVIGATION_PREFETCH_GLYPHS_PER_FRAME 32
+#endif
+
+/**
+ * Loads the assets of the screen likely entered next into RAM while the current screen is
+ * idle.
+ *
+ * The first frame of a screen draws all its bitmaps and glyphs, and those not in the RAM
+ * caches yet are read from the memory-mapped flash on XSPI2, or the bitmap cache fills in
+ * the following frames. Every screen calls entered() in setupScreen(), also when resumed
+ * warm, and the screen-to-screen transitions are counted. The screen a screen was most
+ * often left for, counted at least NAVIGATION_PREFETCH_MIN_TRANSITIONS times, is predicted
+ * to follow it, and its assets, given by its view with addBitmap() and addText(), are
+ * prefetched in the frames where nothing is drawn, one asset per frame: a bitmap is asked
+ * of TextureCache::prefetch(), which copies it into the free space of the bitmap cache at
+ * the start of the next frame, and the glyphs of a text are copied into GlyphAtlas. The
+ * first frame of the predicted screen then samples them from RAM.
+ *
+ * Nothing is evicted for a prefetch: the assets of the current screen stay cached, and a
+ * prefetched bitmap the next screen does not draw goes cold like the others. A screen that
+ * clears the bitmap cache in tearDownScreen() drops the prefetched bitmaps with it. In the
+ * simulator the transitions are counted, but nothing is prefetched.
+ *
+ * The assets are given once, the first time a screen is set up, so a screen is only
+ * prefetched after it was entered once.
+ */
+class NavigationPrefetch
+{
+public:
+    /** The screens, named as their views. */
+    enum Screen
+    {
+        SCREEN1,
+        NUMBER_OF_SCREENS
+    };
+
+    /** Transitions and prefetches since the last reset. */
+    struct Stats
+    {
+        uint32_t transitions; ///< Screens entered after another or the same screen
+        uint32_t predicted;   ///< Of those, entered as predicted
+        uint32_t bitmaps;     ///< Bitmaps asked of the bitmap cache
+        uint32_t glyphs;      ///< Glyphs put into or found in the glyph atlas
+        uint32_t idleFrames;  ///< Frames that prefetched an asset
+    };
+
+    NavigationPrefetch();
+
+    /**
+     * Counts the transition from the previous screen and starts the prefetch of the
+     * screen predicted to follow. Called in setupScreen().
+     *
+     * @param screen The screen entered.
+     */
+    void entered(Screen screen);
+
+    /**
+     * Adds a bitmap the screen draws in its first frame, ignored if already added.
+     *
+     * @param screen The screen.
+     * @param id     The bitmap.
+     *
+     * @return false if the screen has NAVIGATION_PREFETCH_BITMAPS bitmaps.
+     */
+    bool addBitmap(Screen screen, touchgfx::BitmapId id);
+
+    /**
+     * Adds a text the screen draws in its first frame, ignored if already added. Only the
+     * text of the typed text is prefetched, not the characters filled into its wildcards.
+     *
+     * @param screen The screen.
+     * @param id     The typed text.
+     *
+     * @return false if the screen has NAVIGATION_PREFETCH_TEXTS texts.
+     */
+    bool addText(Screen screen, touchgfx::TypedTextId id);
+
+    /**
+     * Tells if the assets of a screen are given, so its view adds them only once.
+     *
+     * @param screen The screen.
+     *
+     * @return true if assets were added for the screen.
+     */
+    bool hasAssets(Screen screen) const;
+
+    /**
+     * Prefetches the next asset of the predicted screen. Called by FrontendApplication in
+     * a frame where nothing is drawn.
+     */
+    void idle();
+
+    /**
+     * Gets the screen predicted to follow the current one.
+     *
+     * @return The screen, NUMBER_OF_SCREENS if none.
+     */
+    Screen getPrediction() const
+    {
+        return predicted;
+    }
+
+    /**
+     * Gets the navigation prefetch of the FrontendApplication.
+     *
+     * @return The navigation prefetch.
+     */
+    static NavigationPrefetch* getInstance()
+    {
+        return instance;
+    }
+
+    /**
+     * Gets the statistics.
+     *
+     * @return The statistics.
+     */
+    const Stats& getStats() const
+    {
+        return stats;
+    }
+
+    /** Resets the statistics. */
+    void resetStats()
+    {
+        memset(&stats, 0, sizeof(stats));
+    }
+
+private:
+    struct Assets
+    {
+        touchgfx::BitmapId bitmaps[NAVIGATION_PREFETCH_BITMAPS];
+        touchgfx::TypedTextId texts[NAVIGATION_PREFETCH_TEXTS];
+        uint8_t numBitmaps;
+        uint8_t numTexts;
+    };
+
+    Screen predict(Screen from) const;
+    uint16_t prefetchGlyphs(touchgfx::TypedTextId id, uint16_t from);
+
+    uint16_t transitions[NUMBER_OF_SCREENS][NUMBER_OF_SCREENS]; ///< By the screen left, then the screen entered
+    Assets assets[NUMBER_OF_SCREENS];
+    Screen current;   ///< NUMBER_OF_SCREENS before the first screen
+    Screen predicted; ///< NUMBER_OF_SCREENS if none
+    uint8_t nextBitmap; ///< Of the predicted screen, prefetched from here on
+    uint8_t nextText;
+    uint16_t nextChar;  ///< In the text being prefetched
+    Stats stats;
+
+    static NavigationPrefetch* instance;
+};
+
+#endif // NAVIGATIONPREFETCH_HPP
@@ -0,0 +1,222 @@
+#ifndef NUMERICTEXTAREA_HPP
+#define NUMERICTEXTAREA_HPP
+
+#include <touchgfx/TypedText.hpp>
+#include <touchgfx/Unicode.hpp>
+#include <touchgfx/widgets/Widget.hpp>
+
+/**
+ * Largest number of cells of a NumericTextArea: the sign, the digits and the decimal point.
+ */
+#ifndef NUMERIC_TEXT_MAX_CELLS
+#define NUMERIC_TEXT_MAX_CELLS 12
+#endif
+
+/**
+ * Number of fonts whose digit widths are kept by NumericTextArea. A font beyond is measured
+ * again by every text area it is set on.
+ */
+#ifndef NUMERIC_TEXT_FONTS
+#define NUMERIC_TEXT_FONTS 8
+#endif
+
+/**
+ * A readout of a number drawn in fixed cells, one per character, in place of a
+ * TextAreaWithOneWildcard and its Unicode::snprintf().
+ *
+ * A TextAreaWithOneWildcard showing a number formats the whole string into its buffer
+ * with Unicode::snprintf(), and invalidates the whole text area, whenever the number
+ * changes; LCD::drawString() then walks the template and the wildcard and lays out every
+ * glyph again. A dashboard updating dozens of readouts every frame redraws all their
+ * digits.
+ *
+ * This text area lays out its cells once, for its font and format: a cell for the sign,
+ * one per digit and one for the decimal point, the digit cells as wide as the widest
+ * digit of the font, so digits line up as tabular figures. The widths of the digits of a
+ * font are measured once and kept for the other text areas of that font. setValue()
+ * writes the digits of the number into the cells without formatting a string, and
+ * invalidates only the cells whose character changed: a counter going from 1229 to 1230
+ * redraws two cells. Every cell is drawn on its own by LCD::drawString(), centered in
+ * the cell.
+ *
+ * Leading zeros are blank unless zero padded, the minus sign is drawn left of the first
+ * digit shown. A value with more digits than the format is clamped to the largest value
+ * shown.
+ */
+class NumericTextArea : public touchgfx::Widget
+{
+public:
+    /** Updates of all the numeric text areas since the last reset. */
+    struct Stats
+    {
+        uint32_t values;   ///< Values set
+        uint32_t changed;  ///< Values which changed at least a cell
+        uint32_t cells;    ///< Cells invalidated by those
+        uint32_t measured; ///< Fonts measured
+    };
+
+    NumericTextArea();
+
+    /**
+     * Sets the text whose font the number is drawn with. Only the font of the text is
+     * used.
+     *
+     * @param t The typed text.
+     */
+    void setTypedText(const touchgfx::TypedText& t);
+
+    /**
+     * Gets the text whose font the number is drawn with.
+     *
+     * @return The typed text.
+     */
+    const touchgfx::TypedText& getTypedText() const
+    {
+        return typedText;
+    }
+
+    /**
+     * Sets the number of digits and decimals shown.
+     *
+     * @param numberOfDigits The digits, including the decimals, at most
+     *                       NUMERIC_TEXT_MAX_CELLS - 2.
+     * @param numberOfDecimals The digits after the decimal point, 0 for an integer.
+     * @param zeroPad          true to show the leading zeros.
+     */
+    void setFormat(uint8_t numberOfDigits, uint8_t numberOfDecimals = 0, bool zeroPad = false);
+
+    /**
+     * Sets the number, in units of the last decimal, and invalidates the cells it changes.
+     *
+     * @param newValue The number, 1234 for 12.34 with two decimals.
+     */
+    void setValue(int32_t newValue);
+
+    /**
+     * Gets the number.
+     *
+     * @return The number, as clamped to the format.
+     */
+    int32_t getValue() const
+    {
+        return value;
+    }
+
+    /**
+     * Sets where the cells are placed in the widget.
+     *
+     * @param align LEFT, CENTER or RIGHT.
+     */
+    void setAlignment(touchgfx::Alignment align)
+    {
+        alignment = align;
+    }
+
+    /**
+     * Gets where the cells are placed in the widget.
+     *
+     * @return The alignment.
+     */
+    touchgfx::Alignment getAlignment() const
+    {
+        return alignment;
+    }
+
+    /**
+     * Sets the color of the text.
+     *
+     * @param newColor The color.
+     */
+    void setColor(touchgfx::colortype newColor)
+    {
+        color = newColor;
+    }
+
+    /**
+     * Gets the color of the text.
+     *
+     * @return The color.
+     */
+    touchgfx::colortype getColor() const
+    {
+        return color;
+    }
+
+    /**
+     * Sets the opacity of the text.
+     *
+     * @param newAlpha The opacity, 255 for solid.
+     */
+    void setAlpha(uint8_t newAlpha)
+    {
+        alpha = newAlpha;
+    }
+
+    /**
+     * Gets the opacity of the text.
+     *
+     * @return The opacity.
+     */
+    uint8_t getAlpha() const
+    {
+        return alpha;
+    }
+
+    /** Sets the size of the widget to that of the cells, as high as the font. */
+    void resizeToCells();
+
+    virtual void draw(const touchgfx::Rect& invalidatedArea) const;
+
+    virtual touchgfx::Rect getSolidRect() const;
+
+    /**
+     * Gets the updates of all the numeric text areas since the last reset.
+     *
+     * @return The statistics.
+     */
+    static const Stats& getStats()
+    {
+        return stats;
+    }
+
+    /** Resets the statistics. */
+    static void resetStats();
+
+private:
+    /** Widths of the characters of a font. */
+    struct FontMetrics
+    {
+        touchgfx::FontId font;
+        uint16_t digit; ///< The widest digit or minus sign
+        uint16_t point;
+    };
+
+    static FontMetrics measure(touchgfx::FontId font);
+
+    /** Places the cells for the font and the format, and shows the value in them. */
+    void layout();
+    /** Writes the characters of the value in the cells. */
+    void format(touchgfx::Unicode::UnicodeChar* chars) const;
+    /** The area of a cell, relative to the widget. */
+    touchgfx::Rect getCell(uint8_t cell) const;
+
+    touchgfx::TypedText typedText;
+    touchgfx::colortype color;
+    int32_t value;
+    uint8_t alpha;
+    touchgfx::Alignment alignment;
+    uint8_t digits;
+    uint8_t decimals;
+    bool zeroPadded;
+    uint8_t cells;                                           ///< Cells laid out
+    uint16_t cellsWidth;                                     ///< Width of all the cells
+    uint16_t cellX[NUMERIC_TEXT_MAX_CELLS];                  ///< Left of the cell from the first cell
+    uint16_t cellWidth[NUMERIC_TEXT_MAX_CELLS];
+    touchgfx::Unicode::UnicodeChar text[NUMERIC_TEXT_MAX_CELLS]; ///< Character shown in the cell, 0 if blank
+
+    static FontMetrics metrics[NUMERIC_TEXT_FONTS];
+    static uint8_t measuredFonts;
+    static Stats stats;
+};
+
+#endif // NUMERICTEXTAREA_HPP
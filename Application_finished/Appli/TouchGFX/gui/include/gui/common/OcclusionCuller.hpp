@@ -0,0 +1,60 @@
+#ifndef OCCLUSIONCULLER_HPP
+#define OCCLUSIONCULLER_HPP
+
+#include <touchgfx/containers/Container.hpp>
+
+/**
+ * Most widgets one OcclusionCuller hides.
+ */
+#ifndef OCCLUSION_CULLER_MAX_WIDGETS
+#define OCCLUSION_CULLER_MAX_WIDGETS 8
+#endif
+
+/**
+ * Set to 0 to draw every widget in every invalidated area, back to front, instead of
+ * culling what is behind opaque widgets. Only meant to measure what culling saves, with the
+ * pixel counts of HybridLCDGPU2D.
+ */
+#ifndef OCCLUSION_DRAWING
+#define OCCLUSION_DRAWING 1
+#endif
+
+/**
+ * Hides the widgets of a container that are entirely behind an opaque widget.
+ *
+ * Screen draws with JSMOC, which splits every invalidated area around the solid rects of
+ * the widgets in it, so pixels behind an opaque widget are not drawn. It does so in every
+ * area of every frame, for every widget in the draw chain, also for a widget that can never
+ * show, like the Box behind the full screen background image of Screen1. Such widgets are
+ * hidden, which keeps them out of the draw chain. The culler only looks at the widgets as
+ * they are when cull() is called, so it must be called again, after restore(), when a
+ * widget in front moves, changes bitmap, alpha or visibility.
+ */
+class OcclusionCuller
+{
+public:
+    OcclusionCuller();
+
+    /**
+     * Hides the children of a container that are inside the solid rect of one of the
+     * visible children in front of them.
+     *
+     * @param [in,out] container The container.
+     *
+     * @return The number of widgets hidden.
+     */
+    uint16_t cull(touchgfx::Container& container);
+
+    /**
+     * Shows the widgets hidden by cull() again.
+     */
+    void restore();
+
+private:
+    static bool isCovered(touchgfx::Drawable& widget);
+
+    touchgfx::Drawable* hidden[OCCLUSION_CULLER_MAX_WIDGETS];
+    uint16_t numHidden;
+};
+
+#endif // OCCLUSIONCULLER_HPP
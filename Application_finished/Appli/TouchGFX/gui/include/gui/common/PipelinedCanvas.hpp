@@ -0,0 +1,277 @@
+#ifndef PIPELINEDCANVAS_HPP
+#define PIPELINEDCANVAS_HPP
+
+#include <touchgfx/widgets/canvas/AbstractPainter.hpp>
+#include <touchgfx/widgets/canvas/AbstractPainterBitmap.hpp>
+#include <touchgfx/widgets/canvas/AbstractPainterColor.hpp>
+#include <touchgfx/widgets/canvas/AbstractShape.hpp>
+#include <touchgfx/widgets/canvas/CanvasWidget.hpp>
+#include <touchgfx/widgets/canvas/Circle.hpp>
+#include <touchgfx/widgets/canvas/Line.hpp>
+
+/**
+ * Size in bytes of each of the two coverage strips, one byte per pixel. A widget area
+ * larger than a strip is rasterized in bands of as many rows as fit.
+ */
+#ifndef CANVAS_PIPELINE_STRIP_BYTES
+#define CANVAS_PIPELINE_STRIP_BYTES (16 * 1024)
+#endif
+
+/**
+ * Rasterizes canvas widgets on the CPU into A8 coverage strips that GPU2D blends into the
+ * framebuffer, one strip while the CPU rasterizes the next.
+ *
+ * A canvas widget drawn with CanvasWidgetRenderer has the CPU run the Rasterizer over the
+ * outline and then blend every span into the framebuffer through the painter, one after
+ * the other. Here the spans of a band of the widget are written into a strip, one byte of
+ * coverage per pixel, and the strip is drawn with TouchGFXHAL::drawA8Mask(), colorized
+ * with the color of the painter, after which GPU2D is kicked, see
+ * HybridLCDGPU2D::kickGPU2D(). The next band, or the next pipelined widget, is rasterized
+ * into the other strip while GPU2D blends the first, and a strip is only written again
+ * once GPU2D is done with it. Outlines that the vector renderer cannot draw, or that are
+ * drawn with CanvasWidgetRenderer for compatibility, keep the Rasterizer of TouchGFX.
+ *
+ * Single color painters are blended by GPU2D, and bitmap painters have the strip fill the
+ * shape with the bitmap through TouchGFXHAL::drawMaskedBitmap(), GPU2D sampling the
+ * texels instead of the painter fetching them from flash pixel by pixel, see
+ * PipelinedCanvasWidget. The simulator, and other orientations than rotate0, draw on the
+ * CPU as usual.
+ */
+class CanvasPipeline
+{
+public:
+    /** Strips rasterized since the last reset. */
+    struct Stats
+    {
+        uint32_t strips;    ///< Bands rasterized into a strip and blended by GPU2D
+        uint32_t waits;     ///< Strips that GPU2D was still to finish when needed again
+        uint32_t fallbacks; ///< Bands drawn on the CPU, too complex or not drawn by GPU2D
+        uint32_t bitmaps;   ///< Strips filled with a bitmap, included in strips
+    };
+
+    /**
+     * Tells if widgets are rasterized into strips.
+     *
+     * @return true on target, in the rotate0 orientation.
+     */
+    static bool isAvailable();
+
+    /**
+     * Gets the number of rows of a band that fit in a strip.
+     *
+     * @param width The width of the band.
+     *
+     * @return The number of rows, 0 if not even one row fits.
+     */
+    static uint16_t stripRows(uint16_t width)
+    {
+        return width == 0 ? 0 : (uint16_t)MIN((uint32_t)CANVAS_PIPELINE_STRIP_BYTES / width, 0xFFFFU);
+    }
+
+    /**
+     * Prepares the next strip for a band of a widget, waiting for GPU2D if it has not
+     * blended what was last rasterized into it.
+     *
+     * @param band The band, relative to the widget, at most stripRows() rows.
+     *
+     * @return The painter to draw the widget with.
+     */
+    static const touchgfx::AbstractPainter& begin(const touchgfx::Rect& band);
+
+    /**
+     * Has GPU2D blend the strip with a color, and kicks it.
+     *
+     * @param widget The widget.
+     * @param done   false if the outline did not fit the CanvasWidgetRenderer buffer.
+     * @param color  The color of the widget.
+     * @param alpha  The alpha of the widget.
+     *
+     * @return false if nothing was drawn, and the band must be drawn on the CPU.
+     */
+    static bool end(const touchgfx::CanvasWidget& widget, bool done, touchgfx::colortype color, uint8_t alpha);
+
+    /**
+     * Tells if a bitmap painter is filled by GPU2D through the strips.
+     *
+     * @param painter The painter.
+     *
+     * @return false for a tiled painter, or a bitmap GPU2D cannot sample.
+     */
+    static bool canFill(const touchgfx::AbstractPainterBitmap& painter);
+
+    /**
+     * Has GPU2D fill the strip with the bitmap of a painter, and kicks it.
+     *
+     * @param widget  The widget.
+     * @param done    false if the outline did not fit the CanvasWidgetRenderer buffer.
+     * @param painter The bitmap painter of the widget, see canFill().
+     * @param alpha   The alpha of the widget.
+     *
+     * @return false if nothing was drawn, and the band must be drawn on the CPU.
+     */
+    static bool end(const touchgfx::CanvasWidget& widget, bool done, touchgfx::AbstractPainterBitmap& painter, uint8_t alpha);
+
+    /**
+     * Gets the strip statistics.
+     *
+     * @return The strip statistics.
+     */
+    static const Stats& getStats()
+    {
+        return stats;
+    }
+
+    /**
+     * Resets the strip statistics.
+     */
+    static void resetStats();
+
+private:
+    /** Writes the coverage of every span into the strip instead of the framebuffer. */
+    class StripPainter : public touchgfx::AbstractPainter
+    {
+    public:
+        StripPainter()
+            : strip(0), band()
+        {
+        }
+
+        void setStrip(uint8_t* pixels, const touchgfx::Rect& area)
+        {
+            strip = pixels;
+            band = area;
+        }
+
+        virtual void paint(uint8_t* destination, int16_t offset, int16_t widgetX, int16_t widgetY, int16_t count, uint8_t alpha) const;
+
+    private:
+        uint8_t* strip;
+        touchgfx::Rect band;
+    };
+
+    static StripPainter painter;
+    static touchgfx::Rect band;
+    static uint32_t kicks[2]; ///< The kick that blends each strip, 0 once waited for
+    static uint8_t current;   ///< The strip rasterized into
+    static bool kick(bool drawn);
+
+    static Stats stats;
+};
+
+/**
+ * A canvas widget painted with a single color or a bitmap whose bands are rasterized by
+ * the CPU and blended by GPU2D, see CanvasPipeline.
+ *
+ * The painter must be set with setColorPainter(), for instance a PainterRGB565, or with
+ * setBitmapPainter(), for instance a PainterRGB565Bitmap or a PainterARGB8888L8Bitmap.
+ * Widgets with another painter, such as a gradient painter, or whose painter was replaced
+ * with setPainter(), are drawn as T, and so are tiled bitmap painters and bitmaps GPU2D
+ * cannot sample, see CanvasPipeline::canFill().
+ *
+ * @tparam T The canvas widget, touchgfx::Circle, touchgfx::Line or a touchgfx::Shape.
+ */
+template <class T>
+class PipelinedCanvasWidget : public T
+{
+public:
+    PipelinedCanvasWidget()
+        : T(), colorPainter(0), bitmapPainter(0), painter(0), pipelining(true)
+    {
+    }
+
+    /**
+     * Sets the painter of the widget, whose color the strips are blended with.
+     *
+     * @tparam P A painter that is also a touchgfx::AbstractPainterColor.
+     * @param [in] newPainter The painter.
+     */
+    template <class P>
+    void setColorPainter(P& newPainter)
+    {
+        T::setPainter(newPainter);
+        painter = &newPainter;
+        colorPainter = &newPainter;
+        bitmapPainter = 0;
+    }
+
+    /**
+     * Sets the painter of the widget, whose bitmap GPU2D fills the strips with.
+     *
+     * @tparam P A painter that is also a touchgfx::AbstractPainterBitmap.
+     * @param [in] newPainter The painter.
+     */
+    template <class P>
+    void setBitmapPainter(P& newPainter)
+    {
+        T::setPainter(newPainter);
+        painter = &newPainter;
+        colorPainter = 0;
+        bitmapPainter = &newPainter;
+    }
+
+    /**
+     * Enables or disables the pipeline, enabled by default.
+     *
+     * @param enable true to blend the coverage with GPU2D.
+     */
+    void setPipelining(bool enable)
+    {
+        pipelining = enable;
+    }
+
+    virtual void draw(const touchgfx::Rect& invalidatedArea) const
+    {
+        if (!pipelining || painter == 0 || T::getPainter() != painter || !CanvasPipeline::isAvailable()
+                || (bitmapPainter != 0 && !CanvasPipeline::canFill(*bitmapPainter)))
+        {
+            T::draw(invalidatedArea);
+            return;
+        }
+        const touchgfx::Rect area = invalidatedArea & T::getMinimalRect();
+        const uint16_t rows = CanvasPipeline::stripRows(area.width);
+        if (area.isEmpty() || rows == 0)
+        {
+            T::draw(invalidatedArea);
+            return;
+        }
+        for (int16_t y = area.y; y < area.bottom(); y += rows)
+        {
+            const touchgfx::Rect band(area.x, y, area.width, (int16_t)MIN((int32_t)rows, (int32_t)(area.bottom() - y)));
+            if (!drawBand(band))
+            {
+                T::draw(band);
+            }
+        }
+    }
+
+private:
+    bool drawBand(const touchgfx::Rect& band) const
+    {
+        // The coverage is rasterized opaque, the alpha is applied by the blend
+        PipelinedCanvasWidget* const self = const_cast<PipelinedCanvasWidget*>(this);
+        const uint8_t widgetAlpha = T::getAlpha();
+        self->T::setPainter(CanvasPipeline::begin(band));
+        self->T::setAlpha(255);
+        const bool done = T::drawCanvasWidget(band);
+        self->T::setAlpha(widgetAlpha);
+        self->T::setPainter(*painter);
+        if (bitmapPainter != 0)
+        {
+            return CanvasPipeline::end(*this, done, *bitmapPainter, widgetAlpha);
+        }
+        return CanvasPipeline::end(*this, done, colorPainter->getColor(), widgetAlpha);
+    }
+
+    const touchgfx::AbstractPainterColor* colorPainter;
+    touchgfx::AbstractPainterBitmap* bitmapPainter; ///< Not const, for getOffset()
+    const touchgfx::AbstractPainter* painter;
+    bool pipelining;
+};
+
+/** A Circle rasterized by the CPU and blended by GPU2D. */
+typedef PipelinedCanvasWidget<touchgfx::Circle> PipelinedCircle;
+
+/** A Line rasterized by the CPU and blended by GPU2D. */
+typedef PipelinedCanvasWidget<touchgfx::Line> PipelinedLine;
+
+#endif // PIPELINEDCANVAS_HPP
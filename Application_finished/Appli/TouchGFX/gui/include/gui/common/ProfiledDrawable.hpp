@@ -0,0 +1,31 @@
+#ifndef PROFILEDDRAWABLE_HPP
+#define PROFILEDDRAWABLE_HPP
+
+#include <gui/common/TargetHardware.hpp>
+#include <touchgfx/hal/Types.hpp>
+
+/**
+ * A widget whose draws are timed by WidgetProfiler, in builds with TOUCHGFX_WIDGET_PROFILE.
+ *
+ * The draw chain calls draw() on every widget it draws, but the framework that builds the
+ * chain is a prebuilt library, so the draws are timed where the widget is declared:
+ * ProfiledDrawable<touchgfx::TextureMapper> instead of touchgfx::TextureMapper, in the
+ * view or the generated base of the screen that misses its frame time. A container is not
+ * drawn itself, its children are, so only widgets are wrapped. In the simulator and
+ * without TOUCHGFX_WIDGET_PROFILE the widget draws as T does.
+ *
+ * @tparam T The widget.
+ */
+template <class T>
+class ProfiledDrawable : public T
+{
+public:
+    virtual void draw(const touchgfx::Rect& invalidatedArea) const
+    {
+        const uint32_t start = TargetHardware::widgetDrawStarted();
+        T::draw(invalidatedArea);
+        TargetHardware::widgetDrawEnded(this, start);
+    }
+};
+
+#endif // PROFILEDDRAWABLE_HPP
@@ -0,0 +1,143 @@
+#ifndef PROGRESSIVEPAINT_HPP
+#define PROGRESSIVEPAINT_HPP
+
+#include <touchgfx/Drawable.hpp>
+#include <string.h>
+
+/**
+ * Most drawables a screen defers at a time. Further drawables are drawn in the first frame.
+ */
+#ifndef PROGRESSIVE_PAINT_DRAWABLES
+#define PROGRESSIVE_PAINT_DRAWABLES 32
+#endif
+
+/**
+ * Pixels of deferred drawables shown per frame after the first frame of a screen, a
+ * quarter of the 800x480 display by default. At least one drawable is shown per frame.
+ */
+#ifndef PROGRESSIVE_PAINT_PIXELS_PER_FRAME
+#define PROGRESSIVE_PAINT_PIXELS_PER_FRAME (96 * 1024)
+#endif
+
+/**
+ * Draws a screen over its first frames instead of all in the frame it is entered.
+ *
+ * A screen switch invalidates the whole display, and every widget of the new screen is
+ * drawn in the first frame: a screen with lists, graphs or vector icons misses the refresh
+ * and shows the previous screen a frame longer. The view defers its expensive drawables
+ * in setupScreen() with defer(): they are hidden, so the first frame only draws the
+ * backgrounds and the key widgets, and shown again and invalidated in the following
+ * frames, in the order of their stage, as many per frame as fit in
+ * PROGRESSIVE_PAINT_PIXELS_PER_FRAME. The cost of a drawable is the area it covers on the
+ * display unless given, so drawables outside the display are shown at no cost. Once all
+ * are shown the screen is what it would have been without deferring.
+ *
+ * Hiding keeps the deferred drawables consistent with the rest of the screen: they are
+ * left out of the draw chain and of RetainedDrawList, are not ticked by TimerRegistry and
+ * are not touched until shown. Only drawables visible when deferred are hidden. A
+ * drawable the screen shows or hides itself in its first frames, or that an
+ * OcclusionCuller counts as opaque, must not be deferred.
+ *
+ * FrontendApplication shows the deferred drawables in handleTickEvent(), from the tick
+ * after the first frame, and shows all those left, without invalidating them, before a
+ * screen transition, so a screen kept warm is complete when entered again.
+ */
+class ProgressivePaint
+{
+public:
+    /** Deferred drawing since the last reset. */
+    struct Stats
+    {
+        uint32_t deferred;  ///< Drawables hidden for the first frame
+        uint32_t shown;     ///< Drawables shown in a later frame
+        uint32_t frames;    ///< Frames that showed drawables
+        uint32_t lastTicks; ///< Ticks the last screen took to be complete
+        uint32_t maxTicks;  ///< Most ticks a screen took to be complete
+    };
+
+    ProgressivePaint();
+
+    /**
+     * Hides a drawable for the first frame of the screen, to be shown in a later frame.
+     * Called in setupScreen(), after the drawable is set up.
+     *
+     * @param [in] drawable The drawable, a widget or a container.
+     * @param      stage    Drawables of a lower stage are shown first, then in the order
+     *                      they were deferred.
+     * @param      cost     The cost in pixels counted against the budget of a frame, 0 for
+     *                      the area the drawable covers on the display.
+     *
+     * @return false if the drawable is drawn in the first frame, being hidden or past
+     *         PROGRESSIVE_PAINT_DRAWABLES.
+     */
+    bool defer(touchgfx::Drawable& drawable, uint8_t stage, uint32_t cost = 0);
+
+    /**
+     * Shows the next deferred drawables that fit in the budget of the frame. Called by
+     * FrontendApplication every tick.
+     */
+    void tick();
+
+    /**
+     * Shows all deferred drawables without invalidating them. Called by
+     * FrontendApplication before a screen transition.
+     */
+    void clear();
+
+    /**
+     * Tells if drawables are still to be shown.
+     *
+     * @return true while the screen is drawn progressively.
+     */
+    bool isPending() const
+    {
+        return next < count;
+    }
+
+    /**
+     * Gets the progressive paint of the FrontendApplication.
+     *
+     * @return The progressive paint.
+     */
+    static ProgressivePaint* getInstance()
+    {
+        return instance;
+    }
+
+    /**
+     * Gets the statistics.
+     *
+     * @return The statistics.
+     */
+    const Stats& getStats() const
+    {
+        return stats;
+    }
+
+    /** Resets the statistics. */
+    void resetStats()
+    {
+        memset(&stats, 0, sizeof(stats));
+    }
+
+private:
+    struct Entry
+    {
+        touchgfx::Drawable* drawable;
+        uint32_t cost;
+        uint8_t stage;
+    };
+
+    static uint32_t costOf(const Entry& entry);
+
+    Entry entries[PROGRESSIVE_PAINT_DRAWABLES]; ///< Sorted by stage, shown from next on
+    uint16_t count;
+    uint16_t next;
+    uint16_t held;  ///< Ticks left before the first drawables are shown
+    uint32_t ticks; ///< Ticks since the first drawable was deferred
+    Stats stats;
+
+    static ProgressivePaint* instance;
+};
+
+#endif // PROGRESSIVEPAINT_HPP
@@ -0,0 +1,93 @@
+#ifndef RECORDEDCONTAINER_HPP
+#define RECORDEDCONTAINER_HPP
+
+#include <gui/common/TargetHardware.hpp>
+#include <touchgfx/containers/Container.hpp>
+
+/**
+ * A Container whose children are drawn from GPU2D commands recorded when the container was
+ * last drawn the same way.
+ *
+ * LCDGPU2D encodes every bitmap, box and glyph into the command list again every time it
+ * is drawn, although a panel that only sits below an animation is drawn the same way in
+ * every frame. RecordedContainer<touchgfx::Container> puts itself in the draw chain in
+ * place of its children and draws them itself: the commands of the first draw are recorded
+ * into a command list fragment, see TargetHardware::beginFragment(), and later draws of the
+ * same area in the same framebuffer only branch to it.
+ *
+ * Any invalidation of the children, or of the container, changes the version of the
+ * recording, so the next draw records again. A child changed without being invalidated
+ * must be followed by a call to invalidateRecording(). The children must be drawn by GPU2D
+ * alone: bitmaps, boxes, texts and texture mappers, not widgets that write pixels with the
+ * CPU. In the simulator, while rendering in software and when no fragment is free, the
+ * children are drawn as usual.
+ *
+ * @tparam T The container.
+ */
+template <class T>
+class RecordedContainer : public T
+{
+public:
+    RecordedContainer()
+        : T(), version(0)
+    {
+    }
+
+    virtual ~RecordedContainer()
+    {
+        TargetHardware::discardFragments(this);
+    }
+
+    virtual void invalidateRect(touchgfx::Rect& invalidatedArea) const
+    {
+        version++;
+        T::invalidateRect(invalidatedArea);
+    }
+
+    /** Records the children again the next time they are drawn. */
+    void invalidateRecording()
+    {
+        version++;
+    }
+
+    virtual void draw(const touchgfx::Rect& invalidatedArea) const
+    {
+        touchgfx::Rect area = invalidatedArea;
+        T::translateRectToAbsolute(area);
+        switch (TargetHardware::beginFragment(this, version, area))
+        {
+        case TargetHardware::FRAGMENT_REPLAYED:
+            return;
+        case TargetHardware::FRAGMENT_RECORDING:
+            T::draw(invalidatedArea);
+            if (TargetHardware::endFragment())
+            {
+                return;
+            }
+            break;
+        case TargetHardware::FRAGMENT_UNAVAILABLE:
+            break;
+        }
+        T::draw(invalidatedArea);
+    }
+
+protected:
+    virtual void setupDrawChain(const touchgfx::Rect& invalidatedArea, touchgfx::Drawable** nextPreviousElement)
+    {
+        if (!TargetHardware::isAccelerated())
+        {
+            T::setupDrawChain(invalidatedArea, nextPreviousElement);
+            return;
+        }
+        if (T::isVisible())
+        {
+            // Drawn as one element, draw() draws the children
+            touchgfx::Drawable::setupDrawChain(invalidatedArea, nextPreviousElement);
+        }
+    }
+
+private:
+    mutable uint32_t version; ///< Changed with the look of the children
+};
+
+#endif // RECORDEDCONTAINER_HPP
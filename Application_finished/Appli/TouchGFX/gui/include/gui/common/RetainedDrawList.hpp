@@ -0,0 +1,143 @@
+#ifndef RETAINEDDRAWLIST_HPP
+#define RETAINEDDRAWLIST_HPP
+
+#include <touchgfx/Screen.hpp>
+
+/**
+ * Most drawables a RetainedDrawList holds. Screens with more are drawn by Screen.
+ */
+#ifndef RETAINED_DRAW_LIST_SIZE
+#define RETAINED_DRAW_LIST_SIZE 128
+#endif
+
+/**
+ * The draw chain of a screen, built once and kept until the widget tree changes.
+ *
+ * For every invalidated area, Screen walks the whole widget tree with setupDrawChain() to
+ * link the drawables in the area, translating the area into every container on the way,
+ * before JSMOC draws them. A screen drawn through a RetainedDrawList links all its visible
+ * drawables once, and keeps them with their absolute visible rects in a flat list, front
+ * to back. An invalidated area is then drawn by linking the entries whose rect it
+ * intersects and handing them to JSMOC, without going down the tree.
+ *
+ * The list is rebuilt when a drawable was added, removed, shown, hidden, moved or
+ * resized. Once per frame, as FrontendApplication calls frameStarted(), the tree is
+ * compared with the signature it had when the list was built, one read of every
+ * drawable. A screen that tells the list itself with invalidate() whenever it changes the
+ * tree can turn the check off with setValidation().
+ *
+ * A view uses the list by overriding Screen::draw(touchgfx::Rect&) to call draw(). Screens
+ * drawn with the painter's algorithm, and screens with more than RETAINED_DRAW_LIST_SIZE
+ * drawables, are drawn by Screen.
+ */
+class RetainedDrawList
+{
+public:
+    /** Use of all lists since the last reset. */
+    struct Stats
+    {
+        uint32_t builds;    ///< Lists built from the widget tree
+        uint32_t draws;     ///< Areas drawn from a list
+        uint32_t linked;    ///< Drawables linked for those areas
+        uint32_t fallbacks; ///< Areas drawn by Screen
+    };
+
+    RetainedDrawList();
+
+    /**
+     * Draws an invalidated area of a screen. Called by the draw(touchgfx::Rect&) of the
+     * screen, instead of Screen::draw().
+     *
+     * @param [in]     screen The screen.
+     * @param [in,out] rect   The area, in absolute coordinates.
+     */
+    void draw(touchgfx::Screen& screen, touchgfx::Rect& rect);
+
+    /**
+     * Makes the list rebuilt before the next area is drawn.
+     */
+    void invalidate()
+    {
+        valid = false;
+    }
+
+    /**
+     * Enables or disables comparing the widget tree with the list once per frame, enabled
+     * by default.
+     *
+     * @param enable false if the screen calls invalidate() on every change to its tree.
+     */
+    void setValidation(bool enable)
+    {
+        validation = enable;
+    }
+
+    /**
+     * Starts a frame, in which the widget trees are compared with the lists again. Called
+     * by FrontendApplication before the invalidated areas are drawn.
+     */
+    static void frameStarted()
+    {
+        frame++;
+    }
+
+    /**
+     * Gets the list statistics.
+     *
+     * @return The list statistics.
+     */
+    static const Stats& getStats()
+    {
+        return stats;
+    }
+
+    /**
+     * Resets the list statistics.
+     */
+    static void resetStats();
+
+private:
+    /** A drawable of the draw chain. */
+    struct Entry
+    {
+        touchgfx::Drawable* drawable;
+        touchgfx::Rect area; ///< The visible rect, in absolute coordinates
+    };
+
+    /** Reaches the draw chain that Screen and Container maintain. */
+    struct Access : public touchgfx::Container
+    {
+        static void buildChain(touchgfx::Container& container, const touchgfx::Rect& area, touchgfx::Drawable** head)
+        {
+            (container.*(&Access::setupDrawChain))(area, head);
+        }
+
+        static touchgfx::Drawable* next(touchgfx::Drawable& d)
+        {
+            return d.*(&Access::nextDrawChainElement);
+        }
+
+        static void link(touchgfx::Drawable& d, touchgfx::Drawable* next)
+        {
+            d.*(&Access::nextDrawChainElement) = next;
+        }
+    };
+
+    bool update(touchgfx::Screen& screen);
+    bool build(touchgfx::Screen& screen);
+    static uint32_t signature(touchgfx::Drawable& container, uint32_t hash);
+
+    Entry entries[RETAINED_DRAW_LIST_SIZE];
+    uint16_t count;
+    const touchgfx::Screen* owner;
+    uint32_t treeSignature; ///< The widget tree the list was built from
+    uint32_t checkedFrame;  ///< The frame the tree was last compared in
+    bool valid;
+    bool fits; ///< The tree fit in the list when it was built
+    bool validation;
+
+    static uint32_t frame;
+    static Stats stats;
+};
+
+#endif // RETAINEDDRAWLIST_HPP
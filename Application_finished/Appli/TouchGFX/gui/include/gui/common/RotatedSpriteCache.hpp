@@ -0,0 +1,121 @@
+#ifndef ROTATEDSPRITECACHE_HPP
+#define ROTATEDSPRITECACHE_HPP
+
+#include <touchgfx/widgets/TextureMapper.hpp>
+#include <touchgfx/widgets/Widget.hpp>
+
+/**
+ * Set to 1 to draw the rotating texture mappers of Screen1 from pre-rendered rotations.
+ * Mostly worth it on the software rendering path, where every texture mapped frame costs
+ * a full perspective mapping on the CPU.
+ */
+#ifndef ROTATED_SPRITE_CACHE
+#define ROTATED_SPRITE_CACHE 0
+#endif
+
+/**
+ * Angle in degrees that the rotation of a texture mapper is rounded to. A new rotation is
+ * rendered, and the widget redrawn, only when the rounded angle changes.
+ */
+#ifndef ROTATED_SPRITE_ANGLE_STEP
+#define ROTATED_SPRITE_ANGLE_STEP 1.0f
+#endif
+
+/**
+ * Size in bytes of the memory in PSRAM that Screen1 renders rotations into. Two slots of
+ * both texture mappers take 2.7 MB.
+ */
+#ifndef ROTATED_SPRITE_CACHE_SIZE
+#define ROTATED_SPRITE_CACHE_SIZE (3 * 1024 * 1024)
+#endif
+
+/**
+ * Number of pre-rendered rotations kept per texture mapper. At least two, so a rotation
+ * is never rendered over pixels that are still to be blitted in the same frame.
+ */
+#ifndef ROTATED_SPRITE_SLOTS
+#define ROTATED_SPRITE_SLOTS 2
+#endif
+
+/**
+ * Draws a TextureMapper rotating around the z axis from a small cache of pre-rendered
+ * rotations.
+ *
+ * The rotation is rounded to ROTATED_SPRITE_ANGLE_STEP. Every rounded angle is rendered
+ * once into an ARGB8888 slot, with the same nearest neighbor sampling as the texture
+ * mapper, and then blitted until the rounded angle changes. The texture mapper stays the
+ * widget that the angles are set on, but is hidden with alpha 0 and no longer invalidates
+ * anything, so frames in which the rounded angle does not change draw nothing at all.
+ *
+ * Texture mappers rotated around the x or y axis, or mapping a bitmap that is neither
+ * ARGB8888 nor RGB565, are drawn by the texture mapper itself.
+ */
+class RotatedSpriteCache : public touchgfx::Widget
+{
+public:
+    RotatedSpriteCache();
+
+    /**
+     * Takes over drawing a texture mapper. Must be inserted just after the texture mapper,
+     * so it is drawn in its place. Call again after changing anything but the angles of
+     * the texture mapper.
+     *
+     * @param [in] mapper The texture mapper, hidden as long as it is attached.
+     */
+    void attach(touchgfx::TextureMapper& mapper);
+
+    /**
+     * Gives the texture mapper back its alpha and hides this widget.
+     */
+    void detach();
+
+    /**
+     * Sets the memory that the rotations are rendered into, after attach(). Needs width *
+     * height * 4 bytes of the texture mapper per slot.
+     *
+     * @param [in] buffer The memory, 4 byte aligned.
+     * @param      size   Size of the memory in bytes.
+     *
+     * @return The bytes used, 0 if less than two slots fit.
+     */
+    uint32_t setBuffer(uint8_t* buffer, uint32_t size);
+
+    /**
+     * Follows the angles of the texture mapper. Call after changing them.
+     */
+    void update();
+
+    virtual void draw(const touchgfx::Rect& invalidatedArea) const;
+
+    virtual touchgfx::Rect getSolidRect() const
+    {
+        return touchgfx::Rect();
+    }
+
+private:
+    /** A pre-rendered rotation. */
+    struct Slot
+    {
+        uint8_t* pixels;
+        int32_t step;          ///< The rounded angle, in steps
+        touchgfx::Rect bounds; ///< Area rendered, relative to the widget
+        uint32_t lastUsed;
+        bool valid;
+    };
+
+    bool canDraw() const;
+    void useMapper(bool use);
+    void render(Slot& slot) const;
+
+    touchgfx::TextureMapper* mapper;
+    uint8_t mapperAlpha;
+    bool active;           ///< Drawn in place of the mapper
+    int32_t step;
+    float corners[6];      ///< x0, y0, x1, y1, x3, y3 of the mapper at the rounded angle
+    touchgfx::Rect bounds; ///< Bounding rectangle at the rounded angle
+    uint8_t slotCount;
+    mutable Slot slots[ROTATED_SPRITE_SLOTS];
+    mutable uint32_t uses;
+};
+
+#endif // ROTATEDSPRITECACHE_HPP
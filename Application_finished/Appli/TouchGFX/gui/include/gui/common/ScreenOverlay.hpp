@@ -0,0 +1,103 @@
+#ifndef SCREENOVERLAY_HPP
+#define SCREENOVERLAY_HPP
+
+#include <stdint.h>
+
+/**
+ * Places a function in the code overlay of a screen, copied from flash into ITCM by
+ * ScreenOverlay::load(). Only call it while the screen is loaded, from the code of the
+ * screen itself. Code shared by several screens stays in flash.
+ */
+#if !defined(SIMULATOR) && defined(__GNUC__)
+#define SCREEN_OVERLAY_FUNCTION(screen) __attribute__((section(".OverlayText." #screen), noinline))
+#else
+#define SCREEN_OVERLAY_FUNCTION(screen)
+#endif
+
+/**
+ * Places a constant in the data overlay of a screen, copied from flash into AXI SRAM by
+ * ScreenOverlay::load(). Same rules as SCREEN_OVERLAY_FUNCTION.
+ */
+#if !defined(SIMULATOR) && defined(__GNUC__)
+#define SCREEN_OVERLAY_CONST(screen) __attribute__((section(".OverlayRodata." #screen)))
+#else
+#define SCREEN_OVERLAY_CONST(screen)
+#endif
+
+/**
+ * The hot code and constants of the active screen, run from internal RAM.
+ *
+ * The application runs from external flash, and its code is too large for the 64 KB of
+ * ITCM. The code of a single screen is not, so the functions a screen calls every frame,
+ * its view, presenter and custom painters, are marked with SCREEN_OVERLAY_FUNCTION and
+ * linked into an OVERLAY of the GCC linker script: all screens share one area of ITCM
+ * after the resident time critical code, and one area of AXI SRAM for the constants
+ * marked with SCREEN_OVERLAY_CONST, each sized for the largest screen. A screen copies
+ * its overlay into them with load() on entry, before it calls any marked function.
+ *
+ * Every screen has one section in each OVERLAY statement, in the order of Id. The linker
+ * refuses calls from the overlay of one screen into that of another.
+ *
+ * The IAR and Keil builds have no overlays. The marked code stays in flash there, as in
+ * the simulator, and load() does nothing.
+ */
+class ScreenOverlay
+{
+public:
+    /** The screens with an overlay, in the order of the linker script. */
+    enum Id
+    {
+        SCREEN1,
+        NUMBER_OF_OVERLAYS
+    };
+
+    /** Overlays loaded since the last reset. */
+    struct Stats
+    {
+        uint32_t loads;      ///< Overlays copied into internal RAM
+        uint32_t textBytes;  ///< Bytes of code copied
+        uint32_t constBytes; ///< Bytes of constants copied
+    };
+
+    /**
+     * Copies the overlay of a screen from flash, unless it is loaded. Called by the
+     * setupScreen() of the screen, also when it is resumed warm, as another screen may
+     * have loaded its overlay in between.
+     *
+     * @param overlay The overlay of the screen.
+     *
+     * @return false if the build has no overlays.
+     */
+    static bool load(Id overlay);
+
+    /**
+     * Gets the overlay in internal RAM.
+     *
+     * @return The overlay, or NUMBER_OF_OVERLAYS if none is loaded.
+     */
+    static Id getLoaded()
+    {
+        return loaded;
+    }
+
+    /**
+     * Gets the overlay statistics.
+     *
+     * @return The overlay statistics.
+     */
+    static const Stats& getStats()
+    {
+        return stats;
+    }
+
+    /**
+     * Resets the overlay statistics.
+     */
+    static void resetStats();
+
+private:
+    static Id loaded;
+    static Stats stats;
+};
+
+#endif // SCREENOVERLAY_HPP
@@ -0,0 +1,30 @@
+#ifndef SHAPEDTEXTAREA_HPP
+#define SHAPEDTEXTAREA_HPP
+
+#include <touchgfx/widgets/TextArea.hpp>
+
+/**
+ * A TextArea for a static text that is laid out once and then drawn from the placed glyphs.
+ *
+ * TextArea::draw() has LCD::drawString() walk the text, look up every glyph with its
+ * kerning and break and align the lines every time any part of the widget is drawn. This
+ * text area draws through touchgfx::ShapedTextCache on target, which keeps the glyphs of
+ * the text as placed the first time it is drawn, by text, language and layout. Changing
+ * the text, language, size or any other layout setting lays the text out again the next
+ * time it is drawn.
+ *
+ * A static text has no wildcards. The simulator, and texts that cannot be kept, are drawn
+ * by TextArea::draw().
+ */
+class ShapedTextArea : public touchgfx::TextArea
+{
+public:
+    ShapedTextArea()
+        : TextArea()
+    {
+    }
+
+    virtual void draw(const touchgfx::Rect& area) const;
+};
+
+#endif // SHAPEDTEXTAREA_HPP
@@ -0,0 +1,164 @@
+#ifndef SPANBATCHPAINTER_HPP
+#define SPANBATCHPAINTER_HPP
+
+#include <gui/common/FastPainterRGB565.hpp>
+#include <touchgfx/widgets/canvas/PainterRGB565Bitmap.hpp>
+#include <touchgfx/widgets/canvas/PainterRGB565LinearGradient.hpp>
+
+/**
+ * Number of spans collected before they are painted.
+ */
+#ifndef SPAN_BATCH_SIZE
+#define SPAN_BATCH_SIZE 128
+#endif
+
+/**
+ * The spans that CanvasWidgetRenderer hands to a painter while an outline is rendered,
+ * collected to be painted together.
+ *
+ * Only one outline is rendered at a time, so all batching painters share one list.
+ */
+class SpanBatch
+{
+public:
+    /** A span of pixels with the same coverage. */
+    struct Span
+    {
+        uint8_t* destination;
+        int16_t offset;
+        int16_t widgetX;
+        int16_t widgetY;
+        int16_t count;
+        uint8_t alpha;
+    };
+
+    /** Spans painted since the last reset. */
+    struct Stats
+    {
+        uint32_t spans;   ///< Spans handed to the painters
+        uint32_t merged;  ///< Spans joined to the previous one
+        uint32_t batches; ///< Lists of spans painted
+    };
+
+    /**
+     * Adds a span, joined to the previous one when it continues it with the same coverage.
+     *
+     * @return false if the list is full and must be painted first.
+     */
+    static bool add(uint8_t* destination, int16_t offset, int16_t widgetX, int16_t widgetY, int16_t count, uint8_t alpha);
+
+    /**
+     * Gets the collected spans.
+     *
+     * @return The first span.
+     */
+    static const Span* getSpans()
+    {
+        return spans;
+    }
+
+    /**
+     * Gets the number of collected spans.
+     *
+     * @return The number of spans.
+     */
+    static uint16_t getCount()
+    {
+        return count;
+    }
+
+    /**
+     * Empties the list once it has been painted.
+     */
+    static void clear();
+
+    /**
+     * Gets the span statistics.
+     *
+     * @return The span statistics.
+     */
+    static const Stats& getStats()
+    {
+        return stats;
+    }
+
+    /**
+     * Resets the span statistics.
+     */
+    static void resetStats();
+
+private:
+    static Span spans[SPAN_BATCH_SIZE];
+    static uint16_t count;
+    static Stats stats;
+};
+
+/**
+ * A painter that collects the spans of an outline and paints them a list at a time.
+ *
+ * CanvasWidgetRenderer calls paint() once per span, most spans being one or two pixels
+ * along the edges of the outline. The spans are collected and painted by paintSpans() when
+ * the list is full and when the outline is done, see tearDown(). Spans continuing the
+ * previous one on the same line with the same coverage are painted as one, so the DMA2D
+ * implementation of PainterRGB565 gets fewer, longer jobs. paintSpans() paints every span
+ * with the paint() of the wrapped painter, bound at compile time.
+ *
+ * @tparam T The RGB565 painter.
+ */
+template <class T>
+class SpanBatchPainter : public T
+{
+public:
+    virtual void paint(uint8_t* destination, int16_t offset, int16_t widgetX, int16_t widgetY, int16_t count, uint8_t alpha) const
+    {
+        if (!SpanBatch::add(destination, offset, widgetX, widgetY, count, alpha))
+        {
+            flush();
+            SpanBatch::add(destination, offset, widgetX, widgetY, count, alpha);
+        }
+    }
+
+    virtual void tearDown() const
+    {
+        // Called by Canvas before the framebuffer is unlocked
+        flush();
+        T::tearDown();
+    }
+
+protected:
+    /**
+     * Paints a list of spans.
+     *
+     * @param spans The spans.
+     * @param count The number of spans.
+     */
+    virtual void paintSpans(const SpanBatch::Span* spans, uint16_t count) const
+    {
+        for (uint16_t i = 0; i < count; i++)
+        {
+            const SpanBatch::Span& span = spans[i];
+            T::paint(span.destination, span.offset, span.widgetX, span.widgetY, span.count, span.alpha);
+        }
+    }
+
+private:
+    void flush() const
+    {
+        if (SpanBatch::getCount() > 0)
+        {
+            paintSpans(SpanBatch::getSpans(), SpanBatch::getCount());
+            SpanBatch::clear();
+        }
+    }
+};
+
+/** A single color painter, short spans blended on the CPU and long spans on DMA2D. */
+typedef SpanBatchPainter<FastPainterRGB565> BatchedPainterRGB565;
+
+/** A bitmap painter. */
+typedef SpanBatchPainter<touchgfx::PainterRGB565Bitmap> BatchedPainterRGB565Bitmap;
+
+/** A linear gradient painter. */
+typedef SpanBatchPainter<touchgfx::PainterRGB565LinearGradient> BatchedPainterRGB565LinearGradient;
+
+#endif // SPANBATCHPAINTER_HPP
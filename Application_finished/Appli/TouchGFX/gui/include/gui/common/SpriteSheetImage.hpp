@@ -0,0 +1,174 @@
+#ifndef SPRITESHEETIMAGE_HPP
+#define SPRITESHEETIMAGE_HPP
+
+#include <gui/common/TimerRegistry.hpp>
+#include <touchgfx/Bitmap.hpp>
+#include <touchgfx/Callback.hpp>
+#include <touchgfx/widgets/Widget.hpp>
+
+/**
+ * An animation drawn from one bitmap holding all its frames, a sprite sheet, in place of
+ * an AnimatedImage and its bitmap per frame.
+ *
+ * AnimatedImage draws a different bitmap every frame, each one converted, aligned and
+ * placed in flash on its own, so an animation is spread over the flash with the padding
+ * and the headers of many bitmaps. The frames of a sprite sheet are laid out left to
+ * right and top to bottom in a grid of equal cells, in a single bitmap, and each frame is
+ * drawn with drawPartialBitmap() of its cell: one GPU2D blit of a part of the sheet, from
+ * the same texture every tick.
+ *
+ * The API follows AnimatedImage. The widget is ticked by the TimerRegistry of the
+ * FrontendApplication, every setUpdateTicksInterval() ticks, only while the animation
+ * runs.
+ */
+class SpriteSheetImage : public touchgfx::Widget
+{
+public:
+    SpriteSheetImage();
+
+    /**
+     * Sets the sprite sheet and the size of the widget to that of a frame. Shows the first
+     * frame.
+     *
+     * @param sheet   The bitmap holding the frames.
+     * @param columns The number of frames in a row of the sheet.
+     * @param frames  The number of frames, at most a full grid of the sheet.
+     */
+    void setSheet(const touchgfx::Bitmap& sheet, uint16_t columns, uint16_t frames);
+
+    /**
+     * Gets the sprite sheet.
+     *
+     * @return The bitmap holding the frames.
+     */
+    const touchgfx::Bitmap& getSheet() const
+    {
+        return sheet;
+    }
+
+    /**
+     * Shows a frame.
+     *
+     * @param frame The frame, from 0.
+     */
+    void setFrame(uint16_t frame);
+
+    /**
+     * Gets the frame shown.
+     *
+     * @return The frame, from 0.
+     */
+    uint16_t getFrame() const
+    {
+        return frame;
+    }
+
+    /**
+     * Gets the number of frames.
+     *
+     * @return The number of frames.
+     */
+    uint16_t getNumberOfFrames() const
+    {
+        return frames;
+    }
+
+    /**
+     * Starts or resumes the animation.
+     *
+     * @param rev   true to run from the last frame to the first.
+     * @param reset true to start from the first frame of the direction, the last if
+     *              reversed.
+     * @param loop  true to run until stopped.
+     */
+    void startAnimation(bool rev, bool reset = false, bool loop = false);
+
+    /** Stops the animation and shows the first frame of its direction. */
+    void stopAnimation();
+
+    /** Stops or resumes the animation, keeping the frame shown. */
+    void pauseAnimation();
+
+    /**
+     * Tells if the animation runs.
+     *
+     * @return true if the animation runs.
+     */
+    bool isAnimatedImageRunning() const
+    {
+        return running;
+    }
+
+    /**
+     * Tells if the animation runs from the last frame to the first.
+     *
+     * @return true if reversed.
+     */
+    bool isReverse() const
+    {
+        return reverse;
+    }
+
+    /**
+     * Sets the callback called when an animation not looping has shown its last frame.
+     *
+     * @param [in] callback The callback.
+     */
+    void setDoneAction(touchgfx::GenericCallback<const SpriteSheetImage&>& callback)
+    {
+        doneAction = &callback;
+    }
+
+    /**
+     * Sets the number of ticks between two frames.
+     *
+     * @param interval The number of ticks, at least 1.
+     */
+    void setUpdateTicksInterval(uint16_t interval);
+
+    /**
+     * Sets the opacity of the widget.
+     *
+     * @param newAlpha The opacity, 255 for solid.
+     */
+    void setAlpha(uint8_t newAlpha)
+    {
+        alpha = newAlpha;
+    }
+
+    /**
+     * Gets the opacity of the widget.
+     *
+     * @return The opacity.
+     */
+    uint8_t getAlpha() const
+    {
+        return alpha;
+    }
+
+    virtual void handleTickEvent();
+
+    virtual void draw(const touchgfx::Rect& invalidatedArea) const;
+
+    virtual touchgfx::Rect getSolidRect() const;
+
+private:
+    /** The cell of the current frame, in the sheet. */
+    touchgfx::Rect getCell() const;
+
+    touchgfx::Bitmap sheet;
+    TimerRegistry::Timer timer;
+    touchgfx::GenericCallback<const SpriteSheetImage&>* doneAction;
+    uint16_t columns;
+    uint16_t cellWidth;
+    uint16_t cellHeight;
+    uint16_t frames;
+    uint16_t frame;
+    uint16_t interval; ///< Ticks between two frames
+    uint8_t alpha;
+    bool reverse;
+    bool loop;
+    bool running;
+};
+
+#endif // SPRITESHEETIMAGE_HPP
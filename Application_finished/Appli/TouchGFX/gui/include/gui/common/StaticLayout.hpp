@@ -0,0 +1,132 @@
+#ifndef STATICLAYOUT_HPP
+#define STATICLAYOUT_HPP
+
+#include <touchgfx/containers/Container.hpp>
+
+/**
+ * Lays out the children of a container from constant tables, in one pass.
+ *
+ * A generated view positions every widget with setXY(), setWidth() and setHeight() and
+ * appends it with add(), which walks the children to the end of the list, so a screen
+ * with n widgets visits n * n / 2 drawables while it is constructed, and every insert()
+ * or remove() in setupScreen() walks the list again. StaticLayout takes the draw order as
+ * a table of the children, and optionally their positions as a table of Entry, both
+ * declared static const so they are placed in flash, and links the children with a
+ * single pass over them.
+ *
+ * The tables are written next to the view, in the order the generated code adds the
+ * widgets; TouchGFX Designer does not emit them.
+ */
+class StaticLayout
+{
+public:
+    /** Width or height of an Entry that keeps the size of the drawable, like an Image's. */
+    static const int16_t SAME_SIZE = -1;
+
+    /** Position of one child, relative to the container. */
+    struct Entry
+    {
+        int16_t x;
+        int16_t y;
+        int16_t width;  ///< SAME_SIZE to leave the width as is
+        int16_t height; ///< SAME_SIZE to leave the height as is
+    };
+
+    /**
+     * Appends children to a container, after the children it already has, positioning
+     * them first when a layout is given. The children must not have a parent.
+     *
+     * @param [in,out] container The container.
+     * @param          children  The children, in draw order.
+     * @param          layout    The position of every child, or 0 to keep their positions.
+     * @param          count     The number of children.
+     */
+    static void add(touchgfx::Container& container, touchgfx::Drawable* const* children, const Entry* layout, uint16_t count)
+    {
+        touchgfx::Drawable* last = container.getFirstChild();
+        while (last != 0 && last->getNextSibling() != 0)
+        {
+            last = last->getNextSibling();
+        }
+        link(container, last, children, layout, count);
+    }
+
+    /**
+     * Replaces the children of a container. The children removed are detached from it, as
+     * with remove(), and the ones given may be children of it already, in any order.
+     *
+     * @param [in,out] container The container.
+     * @param          children  The new children, in draw order.
+     * @param          layout    The position of every child, or 0 to keep their positions.
+     * @param          count     The number of children.
+     */
+    static void replace(touchgfx::Container& container, touchgfx::Drawable* const* children, const Entry* layout, uint16_t count)
+    {
+        touchgfx::Drawable* d = container.getFirstChild();
+        while (d != 0)
+        {
+            touchgfx::Drawable* const next = d->getNextSibling();
+            Access::detach(*d);
+            d = next;
+        }
+        Access::setFirstChild(container, 0);
+        link(container, 0, children, layout, count);
+    }
+
+private:
+    /** Reaches the links that Container, a friend of Drawable, maintains. */
+    struct Access : public touchgfx::Container
+    {
+        static void detach(touchgfx::Drawable& d)
+        {
+            d.*(&Access::parent) = 0;
+            d.*(&Access::nextSibling) = 0;
+        }
+
+        static void attach(touchgfx::Drawable& d, touchgfx::Drawable* parent, touchgfx::Drawable* next)
+        {
+            d.*(&Access::parent) = parent;
+            d.*(&Access::nextSibling) = next;
+        }
+
+        static void setFirstChild(touchgfx::Container& container, touchgfx::Drawable* first)
+        {
+            container.*(&Access::firstChild) = first;
+        }
+    };
+
+    static void link(touchgfx::Container& container, touchgfx::Drawable* last, touchgfx::Drawable* const* children, const Entry* layout, uint16_t count)
+    {
+        for (uint16_t i = 0; i < count; i++)
+        {
+            touchgfx::Drawable& d = *children[i];
+            if (layout != 0)
+            {
+                const Entry& entry = layout[i];
+                d.setXY(entry.x, entry.y);
+                if (entry.width != SAME_SIZE)
+                {
+                    d.setWidth(entry.width);
+                }
+                if (entry.height != SAME_SIZE)
+                {
+                    d.setHeight(entry.height);
+                }
+            }
+            Access::attach(d, &container, 0);
+            if (last == 0)
+            {
+                Access::setFirstChild(container, &d);
+            }
+            else
+            {
+                Access::attach(*last, &container, &d);
+            }
+            last = &d;
+        }
+        // The children changed without add(), an IndexedContainer rebuilds its index
+        container.childGeometryChanged();
+    }
+};
+
+#endif // STATICLAYOUT_HPP
@@ -0,0 +1,205 @@
+#ifndef STREAMINGGRAPH_HPP
+#define STREAMINGGRAPH_HPP
+
+#include <gui/common/DynamicBitmapArena.hpp>
+#include <touchgfx/hal/Types.hpp>
+#include <touchgfx/widgets/Widget.hpp>
+
+/**
+ * Widest graph in pixels, one column of minimum and maximum per pixel is kept.
+ */
+#ifndef STREAMING_GRAPH_MAX_WIDTH
+#define STREAMING_GRAPH_MAX_WIDTH 800
+#endif
+
+/**
+ * A scrolling graph of a signal sampled much faster than the display refreshes.
+ *
+ * GraphScroll keeps one value per point and draws its elements again over the whole graph
+ * area whenever a point is added. A streaming graph reduces the samples to the minimum and
+ * maximum of every pixel column, setSamplesPerColumn() samples each, and draws a column as
+ * a vertical span from the minimum to the maximum, joined to the previous column.
+ *
+ * The columns are rasterized into an RGB565 bitmap in DynamicBitmapArena that is used as
+ * a ring: a completed column overwrites the oldest one in the bitmap, and the graph is
+ * drawn as two blits, the older part of the ring left of the newer part. Scrolling thus
+ * moves no pixels on the CPU, and only the columns completed since the previous frame are
+ * rasterized. The whole bitmap is rasterized again when the range, the colors, the size
+ * or the samples per column change. Without room in the arena, the columns are drawn
+ * with one fill each.
+ *
+ * The newest samples are kept in a ring given by the subclass, so the columns can be
+ * computed again when the samples per column change.
+ */
+class StreamingGraphData : public touchgfx::Widget
+{
+public:
+    /** Drawing of all streaming graphs since the last reset. */
+    struct Stats
+    {
+        uint32_t samples;  ///< Samples added
+        uint32_t columns;  ///< Columns rasterized into the bitmaps
+        uint32_t rebuilds; ///< Times a whole bitmap was rasterized
+        uint32_t direct;   ///< Draws without a bitmap, one fill per column
+    };
+
+    /**
+     * Constructor.
+     *
+     * @param [in] buffer   The ring the newest samples are kept in.
+     * @param      capacity Number of samples in the ring.
+     */
+    StreamingGraphData(int16_t* buffer, uint16_t capacity);
+
+    virtual ~StreamingGraphData();
+
+    /**
+     * Sets the values drawn at the bottom and at the top of the graph.
+     *
+     * @param bottom The value at the bottom.
+     * @param top    The value at the top, larger than bottom.
+     */
+    void setRange(int16_t bottom, int16_t top);
+
+    /**
+     * Sets the number of samples reduced to one pixel column, 1 by default. The columns
+     * are computed again from the samples kept.
+     *
+     * @param samples The samples per column.
+     */
+    void setSamplesPerColumn(uint16_t samples);
+
+    /**
+     * Sets the colors of the signal and of the background.
+     *
+     * @param line       The color of the signal.
+     * @param background The color of the background.
+     */
+    void setColors(touchgfx::colortype line, touchgfx::colortype background);
+
+    /**
+     * Adds a sample.
+     *
+     * @param value The sample.
+     */
+    void addDataPoint(int16_t value)
+    {
+        addDataPoints(&value, 1);
+    }
+
+    /**
+     * Adds samples, oldest first. The graph is invalidated if a column was completed.
+     *
+     * @param values The samples.
+     * @param count  Number of samples.
+     */
+    void addDataPoints(const int16_t* values, uint16_t count);
+
+    /**
+     * Removes all samples and columns.
+     */
+    void clear();
+
+    /**
+     * Gets the number of samples kept.
+     *
+     * @return The number of samples, at most the capacity.
+     */
+    uint16_t getNumberOfSamples() const
+    {
+        return used;
+    }
+
+    /**
+     * Gets a kept sample.
+     *
+     * @param index The sample, 0 for the oldest.
+     *
+     * @return The sample.
+     */
+    int16_t getSample(uint16_t index) const
+    {
+        return samples[(head + capacity - used + index) % capacity];
+    }
+
+    virtual void draw(const touchgfx::Rect& invalidatedArea) const;
+
+    virtual touchgfx::Rect getSolidRect() const
+    {
+        return touchgfx::Rect(0, 0, getWidth(), getHeight());
+    }
+
+    /**
+     * Gets the drawing statistics.
+     *
+     * @return The drawing statistics.
+     */
+    static const Stats& getStats()
+    {
+        return stats;
+    }
+
+    /**
+     * Resets the drawing statistics.
+     */
+    static void resetStats();
+
+private:
+    void decimate(int16_t value);
+    void redrawAll();
+    int16_t columnCount() const
+    {
+        return MIN(getWidth(), (int16_t)STREAMING_GRAPH_MAX_WIDTH);
+    }
+    void span(uint32_t column, int16_t& top, int16_t& bottom) const;
+    int16_t valueToY(int16_t value) const;
+    bool prepareBitmap() const;
+    void rasterize(uint16_t* pixels, int16_t width, uint32_t column) const;
+    void drawPart(int16_t bitmapX, int16_t width, int16_t screenX, const touchgfx::Rect& invalidatedArea) const;
+    void drawDirect(const touchgfx::Rect& invalidatedArea) const;
+    void bitmapMoved(touchgfx::BitmapId oldId, touchgfx::BitmapId newId);
+
+    int16_t* samples;
+    uint16_t capacity;
+    uint16_t head; ///< Where the next sample goes
+    uint16_t used;
+    int16_t rangeBottom;
+    int16_t rangeTop;
+    uint16_t samplesPerColumn;
+    touchgfx::colortype lineColor;
+    touchgfx::colortype backgroundColor;
+
+    int16_t columnMin[STREAMING_GRAPH_MAX_WIDTH];
+    int16_t columnMax[STREAMING_GRAPH_MAX_WIDTH];
+    uint32_t numColumns; ///< Columns completed, column n is at n % STREAMING_GRAPH_MAX_WIDTH
+    int16_t partialMin;
+    int16_t partialMax;
+    uint16_t partialSamples;
+
+    mutable touchgfx::Callback<StreamingGraphData, touchgfx::BitmapId, touchgfx::BitmapId> bitmapMovedCallback;
+    mutable touchgfx::BitmapId bitmap;
+    mutable uint32_t rasterizedColumns; ///< Columns in the bitmap, all older ones included
+    mutable bool dirty;                 ///< The whole bitmap must be rasterized again
+
+    static Stats stats;
+};
+
+/**
+ * A streaming graph keeping the newest CAPACITY samples.
+ *
+ * @tparam CAPACITY Number of samples kept.
+ */
+template <uint16_t CAPACITY>
+class StreamingGraph : public StreamingGraphData
+{
+public:
+    StreamingGraph()
+        : StreamingGraphData(ring, CAPACITY)
+    {
+    }
+
+private:
+    int16_t ring[CAPACITY];
+};
+
+#endif // STREAMINGGRAPH_HPP
@@ -0,0 +1,28 @@
+// Generated by gcc/mktsvg.py. Please, do not edit!
+
+#ifndef TSVGDATABASE_HPP
+#define TSVGDATABASE_HPP
+
+#include <touchgfx/hal/Types.hpp>
+
+enum TSVGImages
+{
+    NUMBER_OF_TSVG_IMAGES = 0
+};
+
+namespace TSVGDatabase
+{
+/** A TSVG blob, and the size of the SVG it was compiled from. */
+struct TSVGData
+{
+    const uint8_t* data;
+    uint32_t size;   ///< Bytes of the blob
+    uint16_t width;  ///< Width of the SVG, 0 if not known
+    uint16_t height; ///< Height of the SVG, 0 if not known
+};
+
+const TSVGData* getInstance();
+uint16_t getInstanceSize();
+} // namespace TSVGDatabase
+
+#endif // TSVGDATABASE_HPP
@@ -0,0 +1,67 @@
+#ifndef TSVGIMAGE_HPP
+#define TSVGIMAGE_HPP
+
+#include <gui/common/TSVGDatabase.hpp>
+#include <touchgfx/widgets/SVGImage.hpp>
+
+/**
+ * An SVGImage drawn from an SVG precompiled to TSVG, with one nema_vg_draw_tsvg() call.
+ *
+ * SVGImage goes over the VGData of the imageconverter path by path, setting up a NemaVG
+ * path and paint for each, so an icon of a few dozen paths costs the CPU more than GPU2D.
+ * The TSVG blobs written into TSVGDatabase by gcc/mktsvg.py hold the paths, paints and
+ * gradients in the format NemaVG reads itself, and TouchGFXHAL::drawTSVG() draws one with
+ * the transformation of the SVGImage: scale, rotation and image position apply as they do
+ * to the SVG.
+ *
+ * An image drawn small on screen may have a simpler version, see setSmallTSVG(), with
+ * fewer paths and curves: the detail of the full image is below a pixel there, yet NemaVG
+ * would subdivide every curve of it. The size on screen also chooses the quality of
+ * NemaVG, see QualityGovernor::vectorQuality().
+ *
+ * The simulator and the software renderers cannot read TSVG, and draw the SVG set with
+ * setSVG() instead, the same image converted by the imageconverter, if one is set.
+ */
+class TSVGImage : public touchgfx::SVGImage
+{
+public:
+    TSVGImage();
+
+    /**
+     * Sets the TSVG drawn on GPU2D, and the size of the widget to that of the SVG if it is
+     * known and the widget has no size yet.
+     *
+     * @param id The TSVG, from the TSVGImages enum, or NUMBER_OF_TSVG_IMAGES for none.
+     */
+    void setTSVG(uint16_t id);
+
+    /**
+     * Gets the TSVG drawn on GPU2D.
+     *
+     * @return The TSVG, NUMBER_OF_TSVG_IMAGES if none.
+     */
+    uint16_t getTSVG() const
+    {
+        return tsvgId;
+    }
+
+    /**
+     * Sets a simpler version of the TSVG, drawn in its place while the image is no larger
+     * than a size on screen. It is scaled to the box of the TSVG set with setTSVG().
+     *
+     * @param id      The simpler TSVG, NUMBER_OF_TSVG_IMAGES for none.
+     * @param maxSize The larger side on screen, in pixels, up to which it is drawn.
+     */
+    void setSmallTSVG(uint16_t id, uint16_t maxSize);
+
+    virtual void draw(const touchgfx::Rect& invalidatedArea) const;
+
+private:
+    float screenSize(const touchgfx::Matrix3x3& transform, float width, float height) const;
+
+    uint16_t tsvgId;
+    uint16_t smallTsvgId;
+    uint16_t smallMaxSize;
+};
+
+#endif // TSVGIMAGE_HPP
@@ -0,0 +1,297 @@
+#ifndef TARGETHARDWARE_HPP
+#define TARGETHARDWARE_HPP
+
+#include <touchgfx/Bitmap.hpp>
+#include <touchgfx/Callback.hpp>
+#include <touchgfx/Matrix3x3.hpp>
+#include <touchgfx/Unicode.hpp>
+#include <touchgfx/hal/Types.hpp>
+#include <touchgfx/lcd/LCD.hpp>
+
+/**
+ * What the GUI uses of the board, without the headers of the target.
+ *
+ * The widgets draw through GPU2D and DMA2D, maintain the data cache around them, and feed
+ * the services of TouchGFXHAL. Calling TouchGFXHAL, DCacheMaintenance and the other
+ * classes of TouchGFX/target directly would tie every file of the GUI to the board, and to
+ * an #ifndef SIMULATOR around each call. These functions are all the GUI sees of them.
+ *
+ * target/TargetHardware.cpp forwards them to TouchGFXHAL and the classes it owns.
+ * simulator/TargetHardware.cpp has no accelerator: the draw functions return false, so
+ * the widgets draw with the CPU as they do without the target, and the rest does nothing.
+ */
+class TargetHardware
+{
+public:
+    /** The GPU2D screen transitions, see drawTransition(). */
+    enum TransitionEffect
+    {
+        TRANSITION_CUBE,       ///< The screens are faces of a cube turning
+        TRANSITION_INNER_CUBE, ///< The screens are faces of a cube turning, seen from inside
+        TRANSITION_STACK,      ///< The old screen shrinks back as the new one slides over it
+        TRANSITION_FADE_ZOOM   ///< The new screen fades in while the old one zooms out
+    };
+
+    /** What beginFragment() did. */
+    enum FragmentResult
+    {
+        FRAGMENT_REPLAYED,   ///< The recorded commands were added, the subtree must not be drawn
+        FRAGMENT_RECORDING,  ///< The subtree must be drawn, then endFragment() called
+        FRAGMENT_UNAVAILABLE ///< The subtree must be drawn as usual
+    };
+
+    /** Tells the bytes of a buffer in use, called with the context given to addMemoryBudget(). */
+    typedef void (*MemoryUsageFunction)(const void* context, uint32_t& used, uint32_t& peak);
+
+    /** Tells the value of a soak test channel, called with the context given to addSoakChannel(). */
+    typedef uint32_t (*SoakSampleFunction)(const void* context);
+
+    /** Computes the state of the model for a tick into a slot, see startModelWorker(). */
+    typedef void (*ModelWorkFunction)(void* context, void* slot, uint32_t tick);
+
+    /** Receives a message of a backend task, see drainModelMessages(). */
+    typedef void (*ModelMessageFunction)(void* context, uint16_t topic, const void* data, uint16_t size);
+
+    /**
+     * Tells if the target draws with GPU2D and DMA2D.
+     *
+     * @return false in the simulator, where every draw function returns false.
+     */
+    static bool isAccelerated();
+
+    /**
+     * Writes the data cache lines of a range written by the CPU to memory, before DMA2D
+     * or GPU2D reads it.
+     *
+     * @param data The first byte.
+     * @param size Bytes of the range.
+     */
+    static void cleanDCache(const void* data, uint32_t size);
+
+    /**
+     * Drops the data cache lines of a range written by DMA2D or GPU2D, before the CPU
+     * reads it.
+     *
+     * @param data The first byte.
+     * @param size Bytes of the range.
+     */
+    static void invalidateDCache(const void* data, uint32_t size);
+
+    /**
+     * Makes code copied into memory visible to the instruction fetches.
+     */
+    static void synchronizeCode();
+
+    /** @see TouchGFXHAL::canDrawInDynamicBitmap */
+    static bool canDrawInDynamicBitmap(touchgfx::Bitmap::BitmapFormat format);
+
+    /** @see TouchGFXHAL::setFrameBufferFormat */
+    static bool setFrameBufferFormat(touchgfx::Bitmap::BitmapFormat format);
+
+    /** @see TouchGFXHAL::drawScaledBitmap */
+    static bool drawScaledBitmap(const touchgfx::Bitmap& bitmap, const touchgfx::Rect& dest, const touchgfx::Rect& clip, uint8_t alpha, bool bilinear);
+
+    /** @see TouchGFXHAL::drawTiledBitmap */
+    static bool drawTiledBitmap(const touchgfx::Bitmap& bitmap, int16_t x, int16_t y, int16_t xOffset, int16_t yOffset, const touchgfx::Rect& clip, uint8_t alpha);
+
+    /** @see TouchGFXHAL::drawTextureQuads */
+    static bool drawTextureQuads(const touchgfx::Bitmap& bitmap, const float* corners, uint16_t count, int16_t x, int16_t y, const touchgfx::Rect& clip, uint8_t alpha, bool bilinear);
+
+    /** @see TouchGFXHAL::drawA8Mask */
+    static bool drawA8Mask(const uint8_t* mask, uint16_t width, uint16_t height, int16_t x, int16_t y, const touchgfx::Rect& clip, touchgfx::colortype color, uint8_t alpha);
+
+    /** @see TouchGFXHAL::canDrawMaskedBitmap */
+    static bool canDrawMaskedBitmap(const touchgfx::Bitmap& bitmap);
+
+    /** @see TouchGFXHAL::drawMaskedBitmap */
+    static bool drawMaskedBitmap(const uint8_t* mask, uint16_t width, uint16_t height, int16_t x, int16_t y, const touchgfx::Bitmap& bitmap, int16_t u, int16_t v, const touchgfx::Rect& clip, uint8_t alpha);
+
+    /** @see TouchGFXHAL::renderStringMask */
+    static bool renderStringMask(const touchgfx::Rect& widgetArea, const touchgfx::LCD::StringVisuals& visuals, const touchgfx::Unicode::UnicodeChar* text, uint8_t* mask);
+
+    /** @see TouchGFXHAL::drawTSVG */
+    static bool drawTSVG(const void* tsvg, const touchgfx::Matrix3x3& transform, const touchgfx::Rect& clip, float size);
+
+    /** @see TouchGFXHAL::drawTransition */
+    static bool drawTransition(TransitionEffect effect, bool vertical, bool reverse, const touchgfx::Bitmap& from, const touchgfx::Bitmap& to, float step, const touchgfx::Rect& clip);
+
+    /** @see TouchGFXHAL::kickGPU2D */
+    static uint32_t kickGPU2D();
+
+    /** @see TouchGFXHAL::waitForKick */
+    static void waitForKick(uint32_t kick);
+
+    /** @see TouchGFXHAL::beginFragment */
+    static FragmentResult beginFragment(const void* owner, uint32_t version, const touchgfx::Rect& area);
+
+    /** @see TouchGFXHAL::endFragment */
+    static bool endFragment();
+
+    /** @see TouchGFXHAL::discardFragments */
+    static void discardFragments(const void* owner);
+
+    /** @see TouchGFXHAL::copyPreviousFrame */
+    static bool copyPreviousFrame(const touchgfx::Rect& area, int16_t dx, int16_t dy);
+
+    /**
+     * Tells if the framebuffers are tracked by frame number, so the damage of the frames a
+     * framebuffer missed can be drawn instead of the areas of the previous frame.
+     *
+     * @return false if only the previous frame is known of.
+     */
+    static bool tracksFrameBufferAge();
+
+    /** @see TouchGFXHAL::getFrameNumber */
+    static uint32_t getFrameNumber();
+
+    /** @see TouchGFXHAL::getClientFrameBufferAge */
+    static uint8_t getClientFrameBufferAge();
+
+    /** @see TouchGFXHAL::isFrameSkipped */
+    static bool isFrameSkipped();
+
+    /**
+     * Gets the width and height of the tiles compared by isTileUnchanged().
+     *
+     * @return 0 without TOUCHGFX_TILE_HASH.
+     */
+    static uint16_t getTileSize();
+
+    /** @see TouchGFXHAL::isTileUnchanged */
+    static bool isTileUnchanged(uint16_t column, uint16_t row);
+
+    /** @see TouchGFXHAL::getTickDeltaUs */
+    static uint32_t getTickDeltaUs();
+
+    /** @see TouchGFXHAL::getRefreshPeriodUs */
+    static uint32_t getRefreshPeriodUs();
+
+    /** @see DynamicResolution::getScalePercent */
+    static uint8_t getScalePercent();
+
+    /** Waits for the uploads of the bitmaps copied into the bitmap cache, see AssetUploadQueue. */
+    static void waitForAssetUploads();
+
+    /** @see TextureCache::prefetch */
+    static bool prefetchTexture(touchgfx::BitmapId id);
+
+    /** @see TextureCache::cacheRotated */
+    static bool cacheTextureRotated(touchgfx::BitmapId id);
+
+    /** @see TextureCache::cachePremultiplied */
+    static touchgfx::BitmapId cacheTexturePremultiplied(touchgfx::BitmapId id);
+
+    /** @see TextureCache::clear */
+    static void clearTextureCache();
+
+    /** @see TextureMipChain::generate */
+    static bool generateMipChain(touchgfx::BitmapId id);
+
+    /** @see TextureMipChain::clear */
+    static void clearMipChain();
+
+    /**
+     * Scans a bitmap out below the framebuffer, see BackgroundLayer::pin().
+     *
+     * @param bitmap The bitmap.
+     *
+     * @return false without TOUCHGFX_BACKGROUND_LAYER, or if the layer cannot show it.
+     */
+    static bool pinBackgroundLayer(const touchgfx::Bitmap& bitmap);
+
+    /** @see BackgroundLayer::unpin */
+    static void unpinBackgroundLayer();
+
+    /** @see BackgroundLayer::getColorKey */
+    static touchgfx::colortype getBackgroundColorKey();
+
+    /**
+     * Tells if bitmaps can be shown above the framebuffer.
+     *
+     * @return false without TOUCHGFX_OVERLAY_LAYER.
+     */
+    static bool hasOverlayLayer();
+
+    /** @see OverlayLayer::show */
+    static bool showOverlayLayer(const touchgfx::Bitmap& bitmap, int16_t x, int16_t y);
+
+    /** @see OverlayLayer::hide */
+    static void hideOverlayLayer();
+
+    /**
+     * Looks up a glyph in the glyph atlas, which adds it if it is not there.
+     *
+     * @param glyphData The 4bpp glyph data, every row starting in a new byte.
+     * @param width     Width of the glyph.
+     * @param height    Height of the glyph.
+     *
+     * @return false if there is no atlas or no room for the glyph.
+     */
+    static bool prefetchGlyph(const uint8_t* glyphData, uint16_t width, uint16_t height);
+
+    /** @see ShapedTextCache::drawString */
+    static bool drawShapedString(touchgfx::TypedTextId id, const touchgfx::Rect& widgetArea, const touchgfx::Rect& invalidatedArea, const touchgfx::LCD::StringVisuals& visuals, const touchgfx::Unicode::UnicodeChar* text);
+
+    /** Forgets the texts laid out by drawShapedString(), when the glyphs or texts move. */
+    static void clearShapedText();
+
+    /** @see QualityGovernor::Settings::gradientStep */
+    static uint16_t getGradientStep();
+
+    /** @see TouchPredictor::disableForGesture */
+    static void disableTouchPrediction();
+
+    /** @see WidgetProfiler::drawStarted */
+    static uint32_t widgetDrawStarted();
+
+    /** @see WidgetProfiler::drawEnded */
+    static void widgetDrawEnded(const void* drawable, uint32_t start);
+
+    /**
+     * Registers a buffer with the memory budget, see MemoryBudget::add().
+     *
+     * @param name    Name of the buffer, kept.
+     * @param base    The first byte of the buffer.
+     * @param size    Bytes of the buffer.
+     * @param usage   Tells the bytes in use, 0 if all of the buffer is always used.
+     * @param context Given to usage.
+     */
+    static void addMemoryBudget(const char* name, const void* base, uint32_t size, MemoryUsageFunction usage = 0, const void* context = 0);
+
+    /** @see SoakTest::addChannel */
+    static void addSoakChannel(const char* name, SoakSampleFunction sample, const void* context, bool worseWhenHigher);
+
+    /** @see TouchGFXHAL::setSoakSceneCallback */
+    static void setSoakSceneCallback(touchgfx::GenericCallback<>* callback);
+
+    /** @see TouchGFXHAL::setBenchmarkSceneCallback */
+    static void setBenchmarkSceneCallback(touchgfx::GenericCallback<>* callback);
+
+    /**
+     * Opens the channel of the backend tasks and starts computing the states of the model,
+     * see ModelWorker::init().
+     *
+     * @param work     Computes a state.
+     * @param context  Given to work.
+     * @param slots    Three states.
+     * @param slotSize Bytes of a state.
+     */
+    static void startModelWorker(ModelWorkFunction work, void* context, void* slots, uint32_t slotSize);
+
+    /** @see ModelWorker::request */
+    static void requestModelState(uint32_t tick);
+
+    /** @see ModelWorker::acquire */
+    static const void* acquireModelState();
+
+    /**
+     * Receives the messages of the backend tasks since the last call, see
+     * ModelChannel::drain().
+     *
+     * @param receive Called for every message.
+     * @param context Given to receive.
+     */
+    static void drainModelMessages(ModelMessageFunction receive, void* context);
+};
+
+#endif // TARGETHARDWARE_HPP
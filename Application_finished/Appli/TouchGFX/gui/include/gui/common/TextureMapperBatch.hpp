@@ -0,0 +1,206 @@
+#ifndef TEXTUREMAPPERBATCH_HPP
+#define TEXTUREMAPPERBATCH_HPP
+
+#include <touchgfx/Bitmap.hpp>
+#include <touchgfx/widgets/TextureMapper.hpp>
+#include <touchgfx/widgets/Widget.hpp>
+
+/**
+ * Many rotated and scaled copies of one bitmap, drawn by one widget.
+ *
+ * A TextureMapper per copy is a drawable each: every one is visited, transformed with
+ * matrices, and set up as its own texture, blending and clip in the GPU2D command list.
+ * A batch keeps the position, angle and scale of every sprite, and the corners of every
+ * sprite, computed when the sprite is set with the sine table of FastTextureMapper. All
+ * sprites are drawn with TouchGFXHAL::drawTextureQuads(): one texture bind, then one quad
+ * command per sprite. The sprites are drawn in order, the last on top.
+ *
+ * The sprites rotate around their center, in the plane of the display, without the
+ * camera and perspective of TextureMapper. In the simulator and while rendering in
+ * software, every sprite is drawn with LCD::drawTextureMapQuad() instead.
+ */
+class TextureMapperBatchData : public touchgfx::Widget
+{
+public:
+    /** A copy of the bitmap. */
+    struct Sprite
+    {
+        float x;     ///< The center, relative to the widget
+        float y;     ///< The center, relative to the widget
+        float angle; ///< Rotation in radians, clockwise
+        float scale; ///< Scale, larger than 0
+    };
+
+    /** Draws since the last reset. */
+    struct Stats
+    {
+        uint32_t batches;    ///< Draws of all visible sprites in one GPU2D batch
+        uint32_t sprites;    ///< Sprites drawn in those batches
+        uint32_t fallbacks;  ///< Sprites drawn one at a time
+        uint32_t transforms; ///< Sprites whose corners were computed
+    };
+
+    /**
+     * Constructor.
+     *
+     * @param [in] spriteBuffer Memory for capacity sprites.
+     * @param [in] cornerBuffer Memory for eight floats per sprite.
+     * @param      capacity     Most sprites in the batch.
+     */
+    TextureMapperBatchData(Sprite* spriteBuffer, float* cornerBuffer, uint16_t capacity);
+
+    /**
+     * Sets the bitmap every sprite is a copy of, RGB565, RGB888 or ARGB8888.
+     *
+     * @param bitmap The bitmap.
+     */
+    void setBitmap(const touchgfx::Bitmap& bitmap);
+
+    /**
+     * Gets the bitmap.
+     *
+     * @return The bitmap.
+     */
+    touchgfx::Bitmap getBitmap() const
+    {
+        return bitmap;
+    }
+
+    /**
+     * Sets the number of sprites drawn, the first ones of the batch.
+     *
+     * @param count The number of sprites, at most the capacity.
+     */
+    void setNumberOfSprites(uint16_t count);
+
+    /**
+     * Gets the number of sprites drawn.
+     *
+     * @return The number of sprites.
+     */
+    uint16_t getNumberOfSprites() const
+    {
+        return numSprites;
+    }
+
+    /**
+     * Moves, rotates and scales a sprite. The area it covers is not invalidated.
+     *
+     * @param index The sprite.
+     * @param x     The center, relative to the widget.
+     * @param y     The center, relative to the widget.
+     * @param angle Rotation in radians.
+     * @param scale Scale.
+     */
+    void setSprite(uint16_t index, float x, float y, float angle, float scale);
+
+    /**
+     * Moves, rotates and scales a sprite, and invalidates the area it covered before and
+     * covers after.
+     *
+     * @param index The sprite.
+     * @param x     The center, relative to the widget.
+     * @param y     The center, relative to the widget.
+     * @param angle Rotation in radians.
+     * @param scale Scale.
+     */
+    void updateSprite(uint16_t index, float x, float y, float angle, float scale);
+
+    /**
+     * Gets a sprite.
+     *
+     * @param index The sprite.
+     *
+     * @return The sprite.
+     */
+    const Sprite& getSprite(uint16_t index) const
+    {
+        return sprites[index];
+    }
+
+    /**
+     * Sets the alpha of all sprites.
+     *
+     * @param newAlpha The alpha.
+     */
+    void setAlpha(uint8_t newAlpha)
+    {
+        alpha = newAlpha;
+    }
+
+    /**
+     * Gets the alpha of all sprites.
+     *
+     * @return The alpha.
+     */
+    uint8_t getAlpha() const
+    {
+        return alpha;
+    }
+
+    /**
+     * Sets how the bitmap is sampled, as for TextureMapper.
+     *
+     * @param algorithm The rendering algorithm.
+     */
+    void setRenderingAlgorithm(touchgfx::TextureMapper::RenderingAlgorithm algorithm)
+    {
+        renderingAlgorithm = algorithm;
+    }
+
+    virtual void draw(const touchgfx::Rect& invalidatedArea) const;
+
+    virtual touchgfx::Rect getSolidRect() const
+    {
+        return touchgfx::Rect();
+    }
+
+    /**
+     * Gets the draw statistics.
+     *
+     * @return The draw statistics.
+     */
+    static const Stats& getStats()
+    {
+        return stats;
+    }
+
+    /** Resets the draw statistics. */
+    static void resetStats();
+
+private:
+    void transform(uint16_t index);
+    touchgfx::Rect spriteBounds(uint16_t index) const;
+    void drawSprite(uint16_t index, const touchgfx::Rect& invalidatedArea) const;
+
+    Sprite* sprites;
+    float* corners; ///< Top left, top right, bottom right, bottom left of every sprite
+    uint16_t capacity;
+    uint16_t numSprites;
+    touchgfx::Bitmap bitmap;
+    uint8_t alpha;
+    touchgfx::TextureMapper::RenderingAlgorithm renderingAlgorithm;
+
+    static Stats stats;
+};
+
+/**
+ * A batch of texture mapped sprites.
+ *
+ * @tparam CAPACITY Most sprites in the batch.
+ */
+template <uint16_t CAPACITY>
+class TextureMapperBatch : public TextureMapperBatchData
+{
+public:
+    TextureMapperBatch()
+        : TextureMapperBatchData(spriteStorage, cornerStorage, CAPACITY)
+    {
+    }
+
+private:
+    Sprite spriteStorage[CAPACITY];
+    float cornerStorage[CAPACITY * 8];
+};
+
+#endif // TEXTUREMAPPERBATCH_HPP
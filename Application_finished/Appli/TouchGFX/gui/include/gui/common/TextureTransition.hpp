@@ -0,0 +1,273 @@
+#ifndef TEXTURETRANSITION_HPP
+#define TEXTURETRANSITION_HPP
+
+#include <touchgfx/Bitmap.hpp>
+#include <touchgfx/transitions/Transition.hpp>
+#include <touchgfx/widgets/Widget.hpp>
+
+/**
+ * Size in pixels of the blocks a TextureBlockTransition reveals the new screen in.
+ */
+#ifndef TEXTURE_TRANSITION_BLOCK_SIZE
+#define TEXTURE_TRANSITION_BLOCK_SIZE 40
+#endif
+
+/**
+ * Most blocks of a TextureBlockTransition, the blocks are made larger on displays that
+ * would need more.
+ */
+#ifndef TEXTURE_TRANSITION_MAX_BLOCKS
+#define TEXTURE_TRANSITION_MAX_BLOCKS 512
+#endif
+
+/**
+ * A screen transition drawn from snapshots of the old and the new screen.
+ *
+ * SlideTransition, CoverTransition and WipeTransition move the children of the new screen
+ * every tick, so the widget tree of the screen is drawn again in every frame, and
+ * BlockTransition draws it block by block. A TextureTransition copies the old screen from
+ * the framebuffer and renders the new screen once into bitmaps in DynamicBitmapArena.
+ * Until it is done, a single widget on top of the new screen hides the widget tree, and
+ * draws the visible parts of the two snapshots: one GPU2D blit per snapshot, with alpha
+ * when fading. Wipes, covers and blocks only invalidate the part of the screen that
+ * changed since the previous tick.
+ *
+ * The cube, stack and zoom effects are drawn on target by nema_transition() of NemaGFX,
+ * the two snapshots mapped onto a few quads in one GPU2D pass, and the whole screen is
+ * invalidated every tick. They fade instead in the simulator and while the software
+ * renderers are active.
+ *
+ * When the snapshots do not fit in the arena, the new screen is shown at once, as
+ * SlideTransition does without animation storage.
+ */
+class TextureTransition : public touchgfx::Transition
+{
+public:
+    /** How the new screen replaces the old one. */
+    enum Effect
+    {
+        SLIDE, ///< Both screens slide, the new one pushing the old one out
+        COVER, ///< The new screen slides in over the old one
+        WIPE,  ///< The new screen is uncovered from one edge, neither screen moves
+        BLOCK,      ///< The new screen is uncovered block by block
+        FADE,       ///< The new screen fades in over the old one
+        CUBE,       ///< The screens are faces of a cube turning, on GPU2D
+        INNER_CUBE, ///< The screens are faces of a cube turning, seen from inside, on GPU2D
+        STACK,      ///< The new screen slides over the old one shrinking back, on GPU2D
+        FADE_ZOOM   ///< The new screen fades in as the old one zooms out, on GPU2D
+    };
+
+    /**
+     * Constructor, copies the old screen from the framebuffer.
+     *
+     * @param effect    The effect.
+     * @param direction The direction the new screen moves or is uncovered in.
+     * @param duration  The duration in ticks.
+     */
+    TextureTransition(Effect effect, touchgfx::Direction direction, uint8_t duration);
+
+    virtual ~TextureTransition();
+
+    virtual void init();
+
+    virtual void handleTickEvent();
+
+    virtual void tearDown();
+
+private:
+    /** Draws the snapshots over the screen while the transition runs. */
+    class Layers : public touchgfx::Widget
+    {
+    public:
+        Layers(const TextureTransition& owner)
+            : transition(owner)
+        {
+        }
+
+        virtual void draw(const touchgfx::Rect& invalidatedArea) const
+        {
+            transition.drawLayers(invalidatedArea);
+        }
+
+        virtual touchgfx::Rect getSolidRect() const
+        {
+            return touchgfx::Rect(0, 0, getWidth(), getHeight());
+        }
+
+    private:
+        const TextureTransition& transition;
+    };
+
+    void drawLayers(const touchgfx::Rect& invalidatedArea) const;
+    void drawLayer(touchgfx::BitmapId id, const touchgfx::Rect& visible, int16_t dx, int16_t dy, const touchgfx::Rect& invalidatedArea, uint8_t alpha) const;
+    void drawBlocks(const touchgfx::Rect& invalidatedArea) const;
+    void drawGPU2D(const touchgfx::Rect& invalidatedArea) const;
+    void getLayout(int16_t visibleNew, touchgfx::Rect& oldVisible, int16_t& oldOffset, touchgfx::Rect& newVisible, int16_t& newOffset) const;
+    touchgfx::Rect segment(int16_t start, int16_t length) const;
+    touchgfx::Rect block(uint16_t index) const;
+    bool isRevealed(uint16_t index) const
+    {
+        return (revealed[index >> 3] & (1U << (index & 7))) != 0;
+    }
+    void setupBlocks();
+    void revealBlocks(uint16_t count);
+    void release();
+
+    Layers layers;
+    Effect effect;
+    touchgfx::Direction direction;
+    uint8_t duration;
+    uint8_t step;
+    int16_t progress; ///< Pixels of the new screen visible, alpha when fading, blocks revealed, permille on GPU2D
+    touchgfx::BitmapId oldLayer;
+    touchgfx::BitmapId newLayer;
+    bool added; ///< The layers are on top of the new screen
+    uint16_t blockSize;
+    uint16_t columns;
+    uint16_t numBlocks;
+    uint16_t blockStride; ///< Blocks between two revealed one after the other
+    uint8_t revealed[(TEXTURE_TRANSITION_MAX_BLOCKS + 7) / 8];
+};
+
+/**
+ * Slides the new screen in, pushing the old screen out.
+ *
+ * @tparam templateDirection The direction the screens move in.
+ * @tparam duration          The duration in ticks.
+ */
+template <touchgfx::Direction templateDirection, uint8_t duration = 20>
+class TextureSlideTransition : public TextureTransition
+{
+public:
+    TextureSlideTransition()
+        : TextureTransition(SLIDE, templateDirection, duration)
+    {
+    }
+};
+
+/**
+ * Slides the new screen in over the old screen.
+ *
+ * @tparam templateDirection The direction the new screen moves in.
+ * @tparam duration          The duration in ticks.
+ */
+template <touchgfx::Direction templateDirection, uint8_t duration = 20>
+class TextureCoverTransition : public TextureTransition
+{
+public:
+    TextureCoverTransition()
+        : TextureTransition(COVER, templateDirection, duration)
+    {
+    }
+};
+
+/**
+ * Uncovers the new screen from one edge.
+ *
+ * @tparam templateDirection The direction the edge between the screens moves in.
+ * @tparam duration          The duration in ticks.
+ */
+template <touchgfx::Direction templateDirection, uint8_t duration = 20>
+class TextureWipeTransition : public TextureTransition
+{
+public:
+    TextureWipeTransition()
+        : TextureTransition(WIPE, templateDirection, duration)
+    {
+    }
+};
+
+/**
+ * Uncovers the new screen block by block, in a scattered order.
+ *
+ * @tparam duration The duration in ticks.
+ */
+template <uint8_t duration = 20>
+class TextureBlockTransition : public TextureTransition
+{
+public:
+    TextureBlockTransition()
+        : TextureTransition(BLOCK, touchgfx::EAST, duration)
+    {
+    }
+};
+
+/**
+ * Fades the new screen in over the old screen.
+ *
+ * @tparam duration The duration in ticks.
+ */
+template <uint8_t duration = 20>
+class TextureFadeTransition : public TextureTransition
+{
+public:
+    TextureFadeTransition()
+        : TextureTransition(FADE, touchgfx::EAST, duration)
+    {
+    }
+};
+
+/**
+ * Turns the screens as the faces of a cube, with NemaGFX.
+ *
+ * @tparam templateDirection The direction the screens move in.
+ * @tparam duration          The duration in ticks.
+ */
+template <touchgfx::Direction templateDirection, uint8_t duration = 20>
+class TextureCubeTransition : public TextureTransition
+{
+public:
+    TextureCubeTransition()
+        : TextureTransition(CUBE, templateDirection, duration)
+    {
+    }
+};
+
+/**
+ * Turns the screens as the faces of a cube seen from inside, with NemaGFX.
+ *
+ * @tparam templateDirection The direction the screens move in.
+ * @tparam duration          The duration in ticks.
+ */
+template <touchgfx::Direction templateDirection, uint8_t duration = 20>
+class TextureInnerCubeTransition : public TextureTransition
+{
+public:
+    TextureInnerCubeTransition()
+        : TextureTransition(INNER_CUBE, templateDirection, duration)
+    {
+    }
+};
+
+/**
+ * Slides the new screen over the old one, which shrinks back, with NemaGFX.
+ *
+ * @tparam templateDirection The direction the new screen moves in.
+ * @tparam duration          The duration in ticks.
+ */
+template <touchgfx::Direction templateDirection, uint8_t duration = 20>
+class TextureStackTransition : public TextureTransition
+{
+public:
+    TextureStackTransition()
+        : TextureTransition(STACK, templateDirection, duration)
+    {
+    }
+};
+
+/**
+ * Fades the new screen in as the old one zooms out, with NemaGFX.
+ *
+ * @tparam duration The duration in ticks.
+ */
+template <uint8_t duration = 20>
+class TextureFadeZoomTransition : public TextureTransition
+{
+public:
+    TextureFadeZoomTransition()
+        : TextureTransition(FADE_ZOOM, touchgfx::EAST, duration)
+    {
+    }
+};
+
+#endif // TEXTURETRANSITION_HPP
@@ -0,0 +1,206 @@
+#ifndef TIMERREGISTRY_HPP
+#define TIMERREGISTRY_HPP
+
+#include <touchgfx/Drawable.hpp>
+#include <string.h>
+
+/**
+ * Number of slots of the timing wheel. A timer with a divisor up to this many ticks is
+ * visited only on the ticks it is due, a longer one once per turn of the wheel. A power of
+ * two.
+ */
+#ifndef TIMER_REGISTRY_SLOTS
+#define TIMER_REGISTRY_SLOTS 16
+#endif
+
+/**
+ * Sends tick events to widgets, without a limit on their number, every tick or every
+ * n-th tick.
+ *
+ * Application::registerTimerWidget() adds the widget to a Vector of MAX_TIMER_WIDGETS
+ * (32) drawables, searched linearly to register and unregister, and every widget
+ * registered is ticked every tick, even one that only animates every few ticks. The
+ * registry links a Timer, owned by the widget, into a timing wheel of TIMER_REGISTRY_SLOTS
+ * lists: starting and stopping a timer are constant time, and a tick only visits the
+ * timers due in its slot. A timer with divisor n calls handleTickEvent() of its widget n
+ * ticks after it is started, and every n ticks from then on.
+ *
+ * A widget that cannot be seen is not ticked, so its animation neither runs nor
+ * invalidates: one that is hidden, or has a hidden parent, or lies outside the area of
+ * one of its parents, such as the viewport of a ScrollableContainer or the current page
+ * of a SwipeContainer, or outside the display. Its timer keeps running, and the widget is
+ * ticked again on the first tick it is due on which it can be seen. A widget that must
+ * tick while it cannot be seen, for instance to load its content before it is scrolled
+ * in, calls Timer::setTickedWhenHidden().
+ *
+ * FrontendApplication ticks the registry before the screen, and stops all the timers
+ * when the screen changes, as Application does with its timer widgets. A Timer stops
+ * itself when it is destroyed. The widgets of the framework keep using
+ * Application::registerTimerWidget(), and are ticked whether they can be seen or not.
+ */
+class TimerRegistry
+{
+private:
+    struct Link
+    {
+        Link* prev;
+        Link* next;
+    };
+
+public:
+    /** The registration of a widget, a member of the widget or of its view. */
+    class Timer : private Link
+    {
+    public:
+        Timer()
+            : widget(0), divisor(0), rounds(0), whenHidden(false)
+        {
+            prev = 0;
+            next = 0;
+        }
+
+        ~Timer()
+        {
+            stop();
+        }
+
+        /**
+         * Starts or restarts ticking a widget, in the registry of the FrontendApplication.
+         *
+         * @param [in] tickedWidget The widget whose handleTickEvent() is called.
+         * @param      tickDivisor  Number of ticks between two calls, at least 1.
+         */
+        void start(touchgfx::Drawable& tickedWidget, uint16_t tickDivisor = 1)
+        {
+            TimerRegistry::getInstance()->start(*this, tickedWidget, tickDivisor);
+        }
+
+        /** Stops the timer, if running. */
+        void stop()
+        {
+            if (next != 0)
+            {
+                TimerRegistry::getInstance()->stop(*this);
+            }
+        }
+
+        /**
+         * Tells if the timer is running.
+         *
+         * @return true if the widget is ticked.
+         */
+        bool isRunning() const
+        {
+            return next != 0;
+        }
+
+        /**
+         * Sets whether the widget is ticked while it cannot be seen.
+         *
+         * @param ticked true to tick the widget when it is hidden or outside the display,
+         *               false to skip its ticks until it can be seen, the default.
+         */
+        void setTickedWhenHidden(bool ticked)
+        {
+            whenHidden = ticked;
+        }
+
+    private:
+        friend class TimerRegistry;
+
+        touchgfx::Drawable* widget;
+        uint16_t divisor; ///< Ticks between two calls
+        uint16_t rounds;  ///< Turns of the wheel left before the timer is due
+        bool whenHidden;  ///< Ticked while it cannot be seen
+    };
+
+    /** Ticks of the timers since the last reset. */
+    struct Stats
+    {
+        uint32_t ticked;     ///< Widgets ticked
+        uint32_t suppressed; ///< Ticks skipped as the widget could not be seen
+    };
+
+    TimerRegistry();
+
+    /**
+     * Starts or restarts a timer.
+     *
+     * @param [in,out] timer   The timer.
+     * @param [in]     widget  The widget whose handleTickEvent() is called.
+     * @param          divisor Number of ticks between two calls, at least 1.
+     */
+    void start(Timer& timer, touchgfx::Drawable& widget, uint16_t divisor = 1);
+
+    /**
+     * Calls the widgets due in this tick. Timers may be started and stopped from the
+     * widgets called.
+     */
+    void tick();
+
+    /** Stops all the timers. */
+    void clear();
+
+    /**
+     * Gets the number of timers running.
+     *
+     * @return The number of timers running.
+     */
+    uint16_t getNumberOfTimers() const
+    {
+        return count;
+    }
+
+    /**
+     * Gets the registry of the FrontendApplication.
+     *
+     * @return The registry.
+     */
+    static TimerRegistry* getInstance()
+    {
+        return instance;
+    }
+
+    /**
+     * Tells if a drawable can be seen: it and its parents are visible, and it lies inside
+     * the area of every parent and inside the display.
+     *
+     * @param drawable The drawable.
+     *
+     * @return true if some of the drawable can be seen.
+     */
+    static bool isOnScreen(const touchgfx::Drawable& drawable);
+
+    /**
+     * Gets the statistics of the registry.
+     *
+     * @return The statistics.
+     */
+    const Stats& getStats() const
+    {
+        return stats;
+    }
+
+    /** Resets the statistics of the registry. */
+    void resetStats()
+    {
+        memset(&stats, 0, sizeof(stats));
+    }
+
+private:
+    friend class Timer;
+
+    void stop(Timer& timer);
+    void schedule(Timer& timer, uint16_t delay);
+    static void link(Link& head, Link& link);
+    static void unlink(Link& link);
+
+    Link slots[TIMER_REGISTRY_SLOTS]; ///< The timers due in each slot, circular lists
+    uint32_t ticks;                   ///< Number of the latest tick
+    uint16_t count;
+    Stats stats;
+
+    static TimerRegistry* instance;
+};
+
+#endif // TIMERREGISTRY_HPP
@@ -0,0 +1,33 @@
+#ifndef UNPREDICTEDDRAG_HPP
+#define UNPREDICTEDDRAG_HPP
+
+#include <gui/common/TargetHardware.hpp>
+#include <touchgfx/events/ClickEvent.hpp>
+
+/**
+ * A widget dragged by the touch as sampled, without the extrapolation of TouchPredictor.
+ *
+ * The predictor moves a dragged touch ahead of the finger, to where it is expected to be
+ * when the frame is shown. That suits content dragged along, like a list or a swipe, but
+ * not a widget that must follow the finger exactly, such as a slider knob stopping on a
+ * precise value or a drawing canvas. Declare such a widget as UnpredictedDrag<T> instead
+ * of T: a gesture that presses it is reported as sampled until the finger is lifted. The
+ * widget must be touchable to be pressed. In the simulator the touch is never predicted.
+ *
+ * @tparam T The widget.
+ */
+template <class T>
+class UnpredictedDrag : public T
+{
+public:
+    virtual void handleClickEvent(const touchgfx::ClickEvent& event)
+    {
+        if (event.getType() == touchgfx::ClickEvent::PRESSED)
+        {
+            TargetHardware::disableTouchPrediction();
+        }
+        T::handleClickEvent(event);
+    }
+};
+
+#endif // UNPREDICTEDDRAG_HPP
@@ -0,0 +1,144 @@
+#ifndef UPDATEQUEUE_HPP
+#define UPDATEQUEUE_HPP
+
+#include <touchgfx/Callback.hpp>
+#include <string.h>
+
+/**
+ * Updates from a presenter to its view, applied once per frame.
+ *
+ * A presenter forwarding every change of the model as a call into the view has the
+ * widgets changed and invalidated for each change, even when the same value changes
+ * several times before the next frame. The presenter posts the changes here instead,
+ * each under a key, and the view drains the queue once in handleTickEvent(), before the
+ * frame is drawn.
+ *
+ * An update posted for a key already pending replaces the pending value and keeps its
+ * place, so the queue holds at most KEYS updates: it never allocates and never overflows.
+ * The updates are handed to the handler in the order their keys were first posted since
+ * the previous drain.
+ */
+template <typename Value, uint16_t KEYS>
+class UpdateQueue
+{
+public:
+    /** Applies an update, called by drain() with its key and its value. */
+    typedef touchgfx::GenericCallback<uint16_t, const Value&> Handler;
+
+    /** Updates since the last reset. */
+    struct Stats
+    {
+        uint32_t posted;    ///< Updates posted
+        uint32_t coalesced; ///< Updates that replaced a pending one of the same key
+        uint32_t applied;   ///< Updates handed to the handler
+        uint32_t drains;    ///< Drains which found updates
+    };
+
+    UpdateQueue()
+        : count(0)
+    {
+        memset(pending, 0, sizeof(pending));
+        resetStats();
+    }
+
+    /**
+     * Posts an update, replacing the pending update of the key.
+     *
+     * @param key   The key, below KEYS.
+     * @param value The value, copied.
+     *
+     * @return false if the key is out of range.
+     */
+    bool post(uint16_t key, const Value& value)
+    {
+        if (key >= KEYS)
+        {
+            return false;
+        }
+        values[key] = value;
+        stats.posted++;
+        if (pending[key])
+        {
+            stats.coalesced++;
+            return true;
+        }
+        pending[key] = true;
+        order[count++] = key;
+        return true;
+    }
+
+    /**
+     * Hands the pending updates to the handler and empties the queue. Updates posted by
+     * the handler are kept for the next drain.
+     *
+     * @param [in] handler Applies the updates.
+     *
+     * @return The number of updates handed over.
+     */
+    uint16_t drain(Handler& handler)
+    {
+        const uint16_t drained = count;
+        if (drained == 0)
+        {
+            return 0;
+        }
+        for (uint16_t i = 0; i < drained; i++)
+        {
+            const uint16_t key = order[i];
+            pending[key] = false;
+            // The handler may post the key again
+            const Value value = values[key];
+            if (handler.isValid())
+            {
+                handler.execute(key, value);
+            }
+        }
+        count -= drained;
+        memmove(order, order + drained, count * sizeof(order[0]));
+        stats.applied += drained;
+        stats.drains++;
+        return drained;
+    }
+
+    /** Drops the pending updates. */
+    void clear()
+    {
+        memset(pending, 0, sizeof(pending));
+        count = 0;
+    }
+
+    /**
+     * Tells if an update is pending.
+     *
+     * @return true if the queue is empty.
+     */
+    bool isEmpty() const
+    {
+        return count == 0;
+    }
+
+    /**
+     * Gets the statistics of the queue.
+     *
+     * @return The statistics.
+     */
+    const Stats& getStats() const
+    {
+        return stats;
+    }
+
+    /** Resets the statistics of the queue. */
+    void resetStats()
+    {
+        memset(&stats, 0, sizeof(stats));
+    }
+
+private:
+    Value values[KEYS];  ///< The latest value posted for each key
+    bool pending[KEYS];  ///< The key has an update in order
+    uint16_t order[KEYS]; ///< The keys pending, in the order they were first posted
+    uint16_t count;
+    Stats stats;
+};
+
+#endif // UPDATEQUEUE_HPP
@@ -0,0 +1,214 @@
+#ifndef VECTORCANVASWIDGET_HPP
+#define VECTORCANVASWIDGET_HPP
+
+#include <touchgfx/hal/VectorRenderer.hpp>
+#include <touchgfx/widgets/canvas/AbstractPainterColor.hpp>
+#include <touchgfx/widgets/canvas/Circle.hpp>
+#include <touchgfx/widgets/canvas/Line.hpp>
+
+/**
+ * Number of points a path of a vector canvas widget can hold. Shapes with more corners are
+ * drawn by CanvasWidgetRenderer.
+ */
+#ifndef VECTOR_CANVAS_POINTS
+#define VECTOR_CANVAS_POINTS 32
+#endif
+
+/**
+ * The path of a canvas widget, in coordinates relative to the widget.
+ */
+class VectorCanvasPath
+{
+public:
+    VectorCanvasPath()
+        : numCmds(0), numPoints(0), overflowed(false)
+    {
+    }
+
+    /** Starts a new subpath. */
+    void moveTo(float x, float y);
+
+    /** Adds a line from the current point. */
+    void lineTo(float x, float y);
+
+    /** Adds a cubic Bezier curve from the current point. */
+    void cubicTo(float x1, float y1, float x2, float y2, float x, float y);
+
+    /** Closes the current subpath. */
+    void close();
+
+    /**
+     * Adds a circular arc around cx, cy. Angles are in degrees, clockwise from 12 o'clock,
+     * as for touchgfx::Circle. Starts a new subpath at the start of the arc, unless
+     * connect is set, which adds a line to it instead.
+     */
+    void arc(float cx, float cy, float r, float startAngle, float endAngle, bool connect);
+
+    /**
+     * Tells if the whole path fit.
+     *
+     * @return true if no point was left out.
+     */
+    bool isValid() const
+    {
+        return !overflowed;
+    }
+
+    /**
+     * Tells if paths can be drawn with the vector renderer.
+     *
+     * @return true when rendering with GPU2D on target.
+     */
+    static bool canDraw();
+
+    /**
+     * Draws the path with the set up vector renderer.
+     *
+     * @param [in] renderer The renderer.
+     */
+    void draw(touchgfx::VectorRenderer& renderer) const;
+
+private:
+    bool reserve(uint16_t cmds, uint16_t points);
+
+    uint8_t cmds[VECTOR_CANVAS_POINTS];
+    float points[VECTOR_CANVAS_POINTS * 2];
+    uint16_t numCmds;
+    uint16_t numPoints; ///< Number of floats
+    bool overflowed;
+};
+
+/**
+ * A canvas widget drawn as a vector path with touchgfx::VectorRenderer, which on target is
+ * GPU2DVectorRenderer, instead of being rasterized by CanvasWidgetRenderer on the CPU.
+ *
+ * The path is filled or stroked in one color, so only painters with a single color can be
+ * drawn this way, set with setColorPainter(). Widgets with any other painter, in the
+ * simulator, while rendering in software, or whose path does not fit, are drawn by the
+ * canvas widget itself, which stays the reference for how they look.
+ *
+ * @tparam T The canvas widget. Subclasses build the path.
+ */
+template <class T>
+class VectorCanvasWidget : public T
+{
+public:
+    VectorCanvasWidget()
+        : T(), colorPainter(0)
+    {
+    }
+
+    /**
+     * Sets a painter with a single color, such as touchgfx::PainterRGB565, which makes the
+     * widget drawn as a vector path when possible.
+     *
+     * @param painter The painter.
+     */
+    template <class Painter>
+    void setColorPainter(const Painter& painter)
+    {
+        T::setPainter(painter);
+        colorPainter = &painter;
+    }
+
+    virtual bool drawCanvasWidget(const touchgfx::Rect& invalidatedArea) const
+    {
+        if (colorPainter != 0 && VectorCanvasPath::canDraw())
+        {
+            VectorCanvasPath path;
+            touchgfx::VectorRenderer::DrawMode mode = touchgfx::VectorRenderer::FILL_NON_ZERO;
+            if (!buildPath(path, mode) || !path.isValid())
+            {
+                // Nothing to draw
+                return true;
+            }
+            touchgfx::VectorRenderer* const renderer = touchgfx::VectorRenderer::getInstance();
+            renderer->setup(T::getAbsoluteRect(), invalidatedArea);
+            renderer->setTransformationMatrix(touchgfx::Matrix3x3());
+            renderer->setColor(touchgfx::colortype((uint32_t)colorPainter->getColor() | 0xFF000000U));
+            renderer->setAlpha(T::getAlpha());
+            renderer->setMode(mode);
+            setupStroke(*renderer);
+            path.draw(*renderer);
+            renderer->tearDown();
+            return true;
+        }
+        return T::drawCanvasWidget(invalidatedArea);
+    }
+
+protected:
+    /**
+     * Builds the path of the widget.
+     *
+     * @param [out] path The path, relative to the widget.
+     * @param [out] mode How the path is drawn, filled by default.
+     *
+     * @return false if there is nothing to draw.
+     */
+    virtual bool buildPath(VectorCanvasPath& path, touchgfx::VectorRenderer::DrawMode& mode) const = 0;
+
+    /**
+     * Sets up the stroke width, caps and joins of a stroked path.
+     *
+     * @param [in] renderer The renderer.
+     */
+    virtual void setupStroke(touchgfx::VectorRenderer& renderer) const
+    {
+        (void)renderer;
+    }
+
+private:
+    const touchgfx::AbstractPainterColor* colorPainter;
+};
+
+/**
+ * A touchgfx::Circle drawn as a vector path. Arcs are stroked with the line width of the
+ * circle, with round caps unless the cap precision is 180 degrees, and circles without a
+ * line width are filled, as pies when not whole.
+ */
+class VectorCircle : public VectorCanvasWidget<touchgfx::Circle>
+{
+protected:
+    virtual bool buildPath(VectorCanvasPath& path, touchgfx::VectorRenderer::DrawMode& mode) const;
+    virtual void setupStroke(touchgfx::VectorRenderer& renderer) const;
+};
+
+/**
+ * A touchgfx::Line drawn as a stroked vector path, with the line ending style as caps.
+ */
+class VectorLine : public VectorCanvasWidget<touchgfx::Line>
+{
+protected:
+    virtual bool buildPath(VectorCanvasPath& path, touchgfx::VectorRenderer::DrawMode& mode) const;
+    virtual void setupStroke(touchgfx::VectorRenderer& renderer) const;
+};
+
+/**
+ * A touchgfx::Shape drawn as a filled vector path, with the filling rule of the shape.
+ *
+ * @tparam T The shape, for instance touchgfx::Shape<4>.
+ */
+template <class T>
+class VectorShape : public VectorCanvasWidget<T>
+{
+protected:
+    virtual bool buildPath(VectorCanvasPath& path, touchgfx::VectorRenderer::DrawMode& mode) const
+    {
+        const int numPoints = this->getNumPoints();
+        if (numPoints == 0)
+        {
+            return false;
+        }
+        // The cache holds the corners scaled, rotated and moved to the origin
+        path.moveTo(this->getCacheX(0).template to<float>(), this->getCacheY(0).template to<float>());
+        for (int i = 1; i < numPoints; i++)
+        {
+            path.lineTo(this->getCacheX(i).template to<float>(), this->getCacheY(i).template to<float>());
+        }
+        path.close();
+        mode = (T::getFillingRule() == touchgfx::Rasterizer::FILL_EVEN_ODD) ? touchgfx::VectorRenderer::FILL_EVEN_ODD : touchgfx::VectorRenderer::FILL_NON_ZERO;
+        return true;
+    }
+};
+
+#endif // VECTORCANVASWIDGET_HPP
@@ -0,0 +1,240 @@
+#ifndef VECTORGRAPHELEMENTS_HPP
+#define VECTORGRAPHELEMENTS_HPP
+
+#include <gui/common/VectorCanvasWidget.hpp>
+#include <touchgfx/lcd/LCD.hpp>
+#include <touchgfx/widgets/graph/GraphElements.hpp>
+
+/**
+ * Number of points the path of a vector graph element can hold, shared by all elements as
+ * only one is drawn at a time. Visible data ranges with more points are drawn by
+ * CanvasWidgetRenderer.
+ */
+#ifndef VECTOR_GRAPH_POINTS
+#define VECTOR_GRAPH_POINTS 2048
+#endif
+
+/**
+ * The path of a graph element, in coordinates relative to the element. The points are in
+ * the same Q5 coordinates the elements pass to touchgfx::Canvas.
+ */
+class VectorGraphPath
+{
+public:
+    /** Paths drawn since the last reset. */
+    struct Stats
+    {
+        uint32_t paths;     ///< Paths drawn with the vector renderer
+        uint32_t points;    ///< Points in those paths
+        uint32_t fallbacks; ///< Draws left to CanvasWidgetRenderer as the path did not fit
+    };
+
+    VectorGraphPath()
+        : numCmds(0), numPoints(0), overflowed(false)
+    {
+    }
+
+    /** Starts a new subpath. */
+    void moveTo(touchgfx::CWRUtil::Q5 x, touchgfx::CWRUtil::Q5 y);
+
+    /** Adds a line from the current point. */
+    void lineTo(touchgfx::CWRUtil::Q5 x, touchgfx::CWRUtil::Q5 y);
+
+    /** Closes the current subpath. */
+    void close();
+
+    /**
+     * Tells if the whole path fit.
+     *
+     * @return true if no point was left out.
+     */
+    bool isValid() const
+    {
+        return !overflowed;
+    }
+
+    /**
+     * Tells if the path has anything to draw.
+     *
+     * @return true if a point was added.
+     */
+    bool isEmpty() const
+    {
+        return numPoints == 0;
+    }
+
+    /**
+     * Draws the path with the set up vector renderer.
+     *
+     * @param [in] renderer The renderer.
+     */
+    void draw(touchgfx::VectorRenderer& renderer) const;
+
+    /**
+     * Gets the path statistics.
+     *
+     * @return The path statistics.
+     */
+    static const Stats& getStats()
+    {
+        return stats;
+    }
+
+    /** Resets the path statistics. */
+    static void resetStats();
+
+    /** Counts a draw left to CanvasWidgetRenderer. */
+    static void countFallback()
+    {
+        stats.fallbacks++;
+    }
+
+private:
+    bool reserve(uint16_t cmds, uint16_t points);
+    void add(uint8_t cmd, touchgfx::CWRUtil::Q5 x, touchgfx::CWRUtil::Q5 y);
+
+    uint16_t numCmds;
+    uint16_t numPoints; ///< Number of floats
+    bool overflowed;
+    float bbox[4]; ///< Min x, min y, max x, max y
+
+    static Stats stats;
+};
+
+/**
+ * A graph element drawn as one vector path with touchgfx::VectorRenderer, which on target is
+ * GPU2DVectorRenderer, instead of one CanvasWidgetRenderer outline built a segment at a
+ * time on the CPU.
+ *
+ * The visible range of the graph is turned into a single path, so a graph with thousands
+ * of points is one GPU2D job. The outlines are those of the canvas graph element, in the
+ * same coordinates, so the anti-aliasing of NemaVG only differs from CanvasWidgetRenderer
+ * in the coverage of edge pixels. As VectorCanvasWidget, the element is drawn by
+ * CanvasWidgetRenderer when its painter was not set with setColorPainter(), in the
+ * simulator, while rendering in software, and when the path does not fit in
+ * VECTOR_GRAPH_POINTS.
+ *
+ * @tparam T The canvas graph element.
+ */
+template <class T>
+class VectorGraphElement : public T
+{
+public:
+    VectorGraphElement()
+        : T(), colorPainter(0)
+    {
+    }
+
+    /**
+     * Sets a painter with a single color, such as touchgfx::PainterRGB565, which makes the
+     * element drawn as a vector path when possible.
+     *
+     * @param painter The painter.
+     */
+    template <class Painter>
+    void setColorPainter(const Painter& painter)
+    {
+        T::setPainter(painter);
+        colorPainter = &painter;
+    }
+
+    virtual bool drawCanvasWidget(const touchgfx::Rect& invalidatedArea) const
+    {
+        if (colorPainter != 0 && VectorCanvasPath::canDraw())
+        {
+            const touchgfx::AbstractDataGraph* graph = T::getGraph();
+            VectorGraphPath path;
+            touchgfx::Rect clip = invalidatedArea;
+            touchgfx::VectorRenderer::DrawMode mode = touchgfx::VectorRenderer::FILL_NON_ZERO;
+            if (!buildPath(graph, invalidatedArea, path, mode, clip) || path.isEmpty() || clip.isEmpty())
+            {
+                // Nothing to draw
+                return true;
+            }
+            if (path.isValid())
+            {
+                const uint8_t alpha = touchgfx::LCD::div255(T::getAlpha() * graph->getAlpha());
+                if (alpha == 0)
+                {
+                    return true;
+                }
+                touchgfx::VectorRenderer* const renderer = touchgfx::VectorRenderer::getInstance();
+                renderer->setup(T::getAbsoluteRect(), clip);
+                renderer->setTransformationMatrix(touchgfx::Matrix3x3());
+                renderer->setColor(touchgfx::colortype((uint32_t)colorPainter->getColor() | 0xFF000000U));
+                renderer->setAlpha(alpha);
+                renderer->setMode(mode);
+                setupStroke(*renderer);
+                path.draw(*renderer);
+                renderer->tearDown();
+                return true;
+            }
+            VectorGraphPath::countFallback();
+        }
+        return T::drawCanvasWidget(invalidatedArea);
+    }
+
+protected:
+    /**
+     * Builds the path of the visible part of the element.
+     *
+     * @param       graph           The graph.
+     * @param       invalidatedArea The area to draw.
+     * @param [out] path            The path, relative to the element.
+     * @param [out] mode            How the path is drawn, filled by default.
+     * @param [out] clip            The area the path is clipped to, the area to draw by
+     *                              default.
+     *
+     * @return false if there is nothing to draw.
+     */
+    virtual bool buildPath(const touchgfx::AbstractDataGraph* graph, const touchgfx::Rect& invalidatedArea, VectorGraphPath& path, touchgfx::VectorRenderer::DrawMode& mode, touchgfx::Rect& clip) const = 0;
+
+    /**
+     * Sets up the stroke width, caps and joins of a stroked path.
+     *
+     * @param [in] renderer The renderer.
+     */
+    virtual void setupStroke(touchgfx::VectorRenderer& renderer) const
+    {
+        (void)renderer;
+    }
+
+private:
+    const touchgfx::AbstractPainterColor* colorPainter;
+};
+
+/**
+ * A touchgfx::GraphElementLine drawn as a stroked vector path. The canvas element traces
+ * both sides of every segment with flat ends, which is a stroke with butt caps and bevel
+ * joins.
+ */
+class VectorGraphElementLine : public VectorGraphElement<touchgfx::GraphElementLine>
+{
+protected:
+    virtual bool buildPath(const touchgfx::AbstractDataGraph* graph, const touchgfx::Rect& invalidatedArea, VectorGraphPath& path, touchgfx::VectorRenderer::DrawMode& mode, touchgfx::Rect& clip) const;
+    virtual void setupStroke(touchgfx::VectorRenderer& renderer) const;
+
+private:
+    void addIndexRange(const touchgfx::AbstractDataGraph* graph, int16_t indexMin, int16_t indexMax, VectorGraphPath& path) const;
+};
+
+/**
+ * A touchgfx::GraphElementArea drawn as a filled vector path, down to the baseline.
+ */
+class VectorGraphElementArea : public VectorGraphElement<touchgfx::GraphElementArea>
+{
+protected:
+    virtual bool buildPath(const touchgfx::AbstractDataGraph* graph, const touchgfx::Rect& invalidatedArea, VectorGraphPath& path, touchgfx::VectorRenderer::DrawMode& mode, touchgfx::Rect& clip) const;
+};
+
+/**
+ * A touchgfx::GraphElementDots drawn as one filled vector path with a subpath per dot, the
+ * same polygons the canvas element draws.
+ */
+class VectorGraphElementDots : public VectorGraphElement<touchgfx::GraphElementDots>
+{
+protected:
+    virtual bool buildPath(const touchgfx::AbstractDataGraph* graph, const touchgfx::Rect& invalidatedArea, VectorGraphPath& path, touchgfx::VectorRenderer::DrawMode& mode, touchgfx::Rect& clip) const;
+};
+
+#endif // VECTORGRAPHELEMENTS_HPP
@@ -0,0 +1,272 @@
+#ifndef WARMSCREENS_HPP
+#define WARMSCREENS_HPP
+
+#include <mvp/MVPApplication.hpp>
+#include <mvp/MVPHeap.hpp>
+#include <mvp/Presenter.hpp>
+#include <touchgfx/Screen.hpp>
+#include <touchgfx/transitions/Transition.hpp>
+#include <new>
+
+/**
+ * Number of screens kept constructed after they are left, besides the one in slot 0 of the
+ * FrontendHeap partitions. 0 destroys every screen that is left, as TouchGFX does.
+ */
+#ifndef WARM_SCREENS
+#define WARM_SCREENS 0
+#endif
+
+/**
+ * Keeps the screens most recently entered through makeTransition() constructed when they
+ * are left, so going back to one of them skips its constructors.
+ *
+ * touchgfx::makeTransition() destroys the view and presenter left and constructs the new
+ * ones in slot 0 of the FrontendHeap partitions, so a main/settings/main loop rebuilds
+ * both screens, their widget trees and their layout every time. With WARM_SCREENS slots
+ * more in the partitions, makeTransition() below constructs a screen in a slot of its own
+ * the first time it is entered and finds it there afterwards; the least recently used one
+ * is destroyed when another screen needs a slot. The screens entered by the generated
+ * goto functions still use slot 0 and are destroyed when left.
+ *
+ * A screen kept warm still gets tearDownScreen() and Presenter::deactivate() when it is
+ * left, and setupScreen() and Presenter::activate() when it is entered again, so what it
+ * registers there is undone and redone. isKeptWarm() and isResumed() tell it that the
+ * bitmaps, glyphs and widget state it set up can stay, which leaves only the redraw of the
+ * screen. Timer widgets are unregistered when any screen is left and must be registered
+ * again in setupScreen().
+ */
+class WarmScreens
+{
+public:
+    WarmScreens()
+        : uses(0)
+    {
+        for (uint16_t i = 0; i < SLOTS; i++)
+        {
+            slots[i].screen = 0;
+            slots[i].presenter = 0;
+            slots[i].type = 0;
+            slots[i].lastUsed = 0;
+        }
+    }
+
+    /**
+     * Replaces touchgfx::makeTransition() for a screen kept warm. The partitions of the
+     * heap must have 1 + WARM_SCREENS elements.
+     *
+     * @return The presenter of the screen entered.
+     */
+    template <class ScreenType, class PresenterType, class TransType, class ModelType>
+    PresenterType* makeTransition(touchgfx::Screen** currentScreen, touchgfx::Presenter** currentPresenter, touchgfx::MVPHeap& heap, touchgfx::Transition** currentTrans, ModelType* model)
+    {
+        assert(sizeof(ScreenType) <= heap.screenStorage.element_size() && "View allocation error: Check that all views are added to FrontendHeap::ViewTypes");
+        assert(sizeof(PresenterType) <= heap.presenterStorage.element_size() && "Presenter allocation error: Check that all presenters are added to FrontendHeap::PresenterTypes");
+        assert(sizeof(TransType) <= heap.transitionStorage.element_size() && "Transition allocation error: Check that all transitions are added to FrontendHeap::TransitionTypes");
+        assert(heap.screenStorage.capacity() > SLOTS && heap.presenterStorage.capacity() > SLOTS && "Warm screen error: Check that FrontendHeap has 1 + WARM_SCREENS views and presenters");
+
+        park(currentScreen, currentPresenter, currentTrans);
+
+        Slot* slot = find(typeOf<ScreenType>());
+        const bool resumed = slot != 0;
+        if (!resumed)
+        {
+            slot = evict();
+            const uint16_t index = (uint16_t)(slot - slots) + 1;
+            ScreenType* newScreen = new (&heap.screenStorage.at<ScreenType>(index)) ScreenType;
+            slot->presenter = new (&heap.presenterStorage.at<PresenterType>(index)) PresenterType(*newScreen);
+            slot->screen = newScreen;
+            slot->type = typeOf<ScreenType>();
+        }
+        slot->lastUsed = ++uses;
+
+        ScreenType* newScreen = static_cast<ScreenType*>(slot->screen);
+        PresenterType* newPresenter = static_cast<PresenterType*>(slot->presenter);
+        TransType* newTransition = new (&heap.transitionStorage.at<TransType>(0)) TransType;
+        *currentTrans = newTransition;
+        *currentPresenter = newPresenter;
+        *currentScreen = newScreen;
+        model->bind(newPresenter);
+        newPresenter->bind(model);
+        newScreen->bind(*newPresenter);
+
+        resumingFlag() = resumed;
+        newScreen->setupScreen();
+        resumingFlag() = false;
+        newPresenter->activate();
+        newScreen->bindTransition(*newTransition);
+        newTransition->init();
+        newTransition->invalidate();
+        return newPresenter;
+    }
+
+    /**
+     * Leaves the current screen: tears down the transition and the screen, and destroys the
+     * screen unless it is kept warm. The current pointers are cleared, so a following
+     * touchgfx::makeTransition() only constructs the new screen.
+     */
+    void park(touchgfx::Screen** currentScreen, touchgfx::Presenter** currentPresenter, touchgfx::Transition** currentTrans)
+    {
+        touchgfx::Application::getInstance()->clearAllTimerWidgets();
+        if (*currentTrans)
+        {
+            (*currentTrans)->tearDown();
+            (*currentTrans)->~Transition();
+        }
+        if (*currentScreen)
+        {
+            const bool warm = contains(*currentScreen);
+            keepingFlag() = warm;
+            (*currentScreen)->tearDownScreen();
+            keepingFlag() = false;
+            if (*currentPresenter)
+            {
+                (*currentPresenter)->deactivate();
+            }
+            if (!warm)
+            {
+                (*currentScreen)->~Screen();
+                if (*currentPresenter)
+                {
+                    (*currentPresenter)->~Presenter();
+                }
+            }
+        }
+        *currentTrans = 0;
+        *currentPresenter = 0;
+        *currentScreen = 0;
+    }
+
+    /**
+     * Tells if a screen is kept warm.
+     *
+     * @param screen The screen.
+     *
+     * @return true if the screen stays constructed when it is left.
+     */
+    bool contains(const touchgfx::Screen* screen) const
+    {
+        for (uint16_t i = 0; i < SLOTS; i++)
+        {
+            if (screen != 0 && slots[i].screen == screen)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Destroys the screens kept warm, except the current one, for instance to return their
+     * bitmaps and glyphs before a screen that needs all the caches.
+     *
+     * @param current The current screen.
+     */
+    void clear(const touchgfx::Screen* current)
+    {
+        for (uint16_t i = 0; i < SLOTS; i++)
+        {
+            if (slots[i].screen != 0 && slots[i].screen != current)
+            {
+                destroy(slots[i]);
+            }
+        }
+    }
+
+    /**
+     * Tells a screen in tearDownScreen() that it stays constructed, so what it cached for
+     * itself can stay.
+     *
+     * @return true while a screen kept warm is torn down.
+     */
+    static bool isKeptWarm()
+    {
+        return keepingFlag();
+    }
+
+    /**
+     * Tells a screen in setupScreen() that it was set up before and kept warm since, so
+     * what it built once is still in place.
+     *
+     * @return true while a screen kept warm is set up again.
+     */
+    static bool isResumed()
+    {
+        return resumingFlag();
+    }
+
+private:
+    static const uint16_t SLOTS = WARM_SCREENS > 0 ? WARM_SCREENS : 1;
+
+    struct Slot
+    {
+        touchgfx::Screen* screen;       ///< The screen, 0 if the slot is free
+        touchgfx::Presenter* presenter; ///< The presenter of the screen
+        const void* type;               ///< Identifies the type of the screen
+        uint32_t lastUsed;              ///< Value of uses when last entered
+    };
+
+    /** An address unique to a type, without RTTI. */
+    template <class T>
+    static const void* typeOf()
+    {
+        static const char id = 0;
+        return &id;
+    }
+
+    static bool& keepingFlag()
+    {
+        static bool keeping = false;
+        return keeping;
+    }
+
+    static bool& resumingFlag()
+    {
+        static bool resuming = false;
+        return resuming;
+    }
+
+    Slot* find(const void* type)
+    {
+        for (uint16_t i = 0; i < SLOTS; i++)
+        {
+            if (slots[i].screen != 0 && slots[i].type == type)
+            {
+                return &slots[i];
+            }
+        }
+        return 0;
+    }
+
+    /** A free slot, or the least recently used one emptied. */
+    Slot* evict()
+    {
+        Slot* oldest = &slots[0];
+        for (uint16_t i = 0; i < SLOTS; i++)
+        {
+            if (slots[i].screen == 0)
+            {
+                return &slots[i];
+            }
+            if (slots[i].lastUsed < oldest->lastUsed)
+            {
+                oldest = &slots[i];
+            }
+        }
+        destroy(*oldest);
+        return oldest;
+    }
+
+    static void destroy(Slot& slot)
+    {
+        slot.screen->~Screen();
+        slot.presenter->~Presenter();
+        slot.screen = 0;
+        slot.presenter = 0;
+        slot.type = 0;
+    }
+
+    Slot slots[SLOTS];
+    uint32_t uses; ///< Screens entered, orders the slots by use
+};
+
+#endif // WARMSCREENS_HPP
@@ -1,8 +1,20 @@
 #ifndef MODEL_HPP
 #define MODEL_HPP
 
+#include <stdint.h>
+
 class ModelListener;
 
+/**
+ * State of the model shown by the presenters. Computed by Model::work() for a tick,
+ * in modelTask on target, and read by the presenters in the TouchGFX task.
+ */
+struct ModelState
+{
+    uint32_t tick;     ///< The tick the state was computed for
+    uint32_t messages; ///< Backend messages received for this tick, after coalescing
+};
+
 class Model
 {
 public:
@@ -14,8 +26,30 @@ public:
     }
 
     void tick();
+
+    /**
+     * Computes the state for a tick. On target this runs in modelTask, see
+     * touchgfx::ModelWorker, concurrently with the TouchGFX task: it must only use data
+     * owned by the worker, and not touch widgets. The state given holds an older state.
+     */
+    void work(ModelState& next, uint32_t tick);
+
+    /**
+     * Receives a message of a backend task, from the batch drained by work(). On target
+     * the backend tasks send them through touchgfx::ModelChannel.
+     */
+    void receive(uint16_t topic, const void* data, uint16_t size);
+
+    /** The newest state computed, valid until the next tick. */
+    const ModelState& getState() const
+    {
+        return *state;
+    }
 protected:
     ModelListener* modelListener;
+    uint32_t ticks;
+    const ModelState* state;
+    uint32_t received; ///< Messages received since the last work(), owned by the worker
 };
 
 #endif // MODEL_HPP
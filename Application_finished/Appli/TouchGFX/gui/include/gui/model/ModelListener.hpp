@@ -14,6 +14,9 @@ public:
     {
         model = m;
     }
+
+    /** Called in the TouchGFX task when the model has a new state, see Model::getState(). */
+    virtual void modelStateChanged(const ModelState& state) {}
 protected:
     Model* model;
 };
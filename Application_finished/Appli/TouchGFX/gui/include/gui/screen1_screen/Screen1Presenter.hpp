@@ -11,6 +11,13 @@ class Screen1View;
 class Screen1Presenter : public touchgfx::Presenter, public ModelListener
 {
 public:
+    /** The updates posted to the view, applied once per frame, see UpdateQueue. */
+    enum Update
+    {
+        UPDATE_MODEL_STATE, ///< A ModelState
+        NUMBER_OF_UPDATES
+    };
+
     Screen1Presenter(Screen1View& v);
 
     /**
@@ -25,6 +32,12 @@ public:
      */
     virtual void deactivate();
 
+    /**
+     * Posts the state to the view, which applies it with the other updates of the tick
+     * before the frame is drawn.
+     */
+    virtual void modelStateChanged(const ModelState& state);
+
     virtual ~Screen1Presenter() {}
 
 private:
@@ -3,6 +3,16 @@
 
 #include <gui_generated/screen1_screen/Screen1ViewBase.hpp>
 #include <gui/screen1_screen/Screen1Presenter.hpp>
+#include <gui/common/FastTextureMapper.hpp>
+#include <gui/common/NavigationPrefetch.hpp>
+#include <gui/common/OcclusionCuller.hpp>
+#include <gui/common/ProgressivePaint.hpp>
+#include <gui/common/RetainedDrawList.hpp>
+#include <gui/common/RotatedSpriteCache.hpp>
+#include <gui/common/ScreenOverlay.hpp>
+#include <gui/common/StaticLayout.hpp>
+#include <gui/common/UpdateQueue.hpp>
+#include <gui/common/WarmScreens.hpp>
 
 class Screen1View : public Screen1ViewBase
 {
@@ -11,7 +21,62 @@ public:
     virtual ~Screen1View() {}
     virtual void setupScreen();
     virtual void tearDownScreen();
+
+    /**
+     * Rotates the texture mappers by 0.1 degree per display refresh since the previous tick,
+     * so the rotation keeps its speed when frames are lost.
+     */
+    virtual void handleTickEvent();
+
+    /**
+     * Draws an invalidated area from the retained draw list.
+     */
+    virtual void draw(touchgfx::Rect& rect);
+
+    /**
+     * Posts an update of the presenter, applied at the start of the next tick.
+     *
+     * @param update The update, one of Screen1Presenter::Update.
+     * @param state  The state the update carries.
+     */
+    void postUpdate(Screen1Presenter::Update update, const ModelState& state)
+    {
+        updates.post(update, state);
+    }
 protected:
+    /**
+     * Replaces the texture mappers of the generated view and attaches the sprite caches.
+     * Done once, the scene is kept while the screen is kept warm.
+     */
+    void buildScene();
+
+    /**
+     * Rewinds the texture mapper rotation, so every benchmark run renders the same frames.
+     */
+    void resetScene();
+
+    /**
+     * Shows the toggle button on the LTDC overlay layer, so toggling it does not redraw the
+     * background below it.
+     */
+    void updateOverlay();
+
+    /**
+     * Applies an update of the presenter, drained from the queue once per tick, so each
+     * widget changed is invalidated once whatever the number of updates posted.
+     */
+    void applyUpdate(uint16_t update, const ModelState& state);
+
+    touchgfx::Callback<Screen1View> sceneCallback;
+    touchgfx::Callback<Screen1View, uint16_t, const ModelState&> updateCallback;
+    UpdateQueue<ModelState, Screen1Presenter::NUMBER_OF_UPDATES> updates;
+    ModelState shownState;      ///< The model state the widgets show
+    FastTextureMapper mapper1;  ///< Replaces textureMapper1, only rotated around the z axis
+    FastTextureMapper mapper2;  ///< Replaces textureMapper2, only rotated around the z axis
+    RotatedSpriteCache sprite1; ///< Draws mapper1 when ROTATED_SPRITE_CACHE is enabled
+    RotatedSpriteCache sprite2; ///< Draws mapper2 when ROTATED_SPRITE_CACHE is enabled
+    OcclusionCuller culler;     ///< Hides the background Box behind image2
+    RetainedDrawList drawList;  ///< The draw chain, kept until the widget tree changes
 };
 
 #endif // SCREEN1VIEW_HPP
@@ -0,0 +1,221 @@
+#include <gui/common/AnimationScheduler.hpp>
+#include <touchgfx/EasingEquations.hpp>
+
+using namespace touchgfx;
+
+AnimationScheduler* AnimationScheduler::instance = 0;
+
+namespace
+{
+const int32_t ONE = 1 << 14; ///< 1 in the Q14 of the easing tables
+
+const EasingEquation equations[AnimationScheduler::NUMBER_OF_EASINGS] =
+{
+    &EasingEquations::linearEaseNone,
+    &EasingEquations::quadEaseIn,
+    &EasingEquations::quadEaseOut,
+    &EasingEquations::quadEaseInOut,
+    &EasingEquations::cubicEaseIn,
+    &EasingEquations::cubicEaseOut,
+    &EasingEquations::cubicEaseInOut,
+    &EasingEquations::sineEaseIn,
+    &EasingEquations::sineEaseOut,
+    &EasingEquations::sineEaseInOut,
+    &EasingEquations::backEaseOut,
+    &EasingEquations::bounceEaseOut
+};
+} // namespace
+
+AnimationScheduler::AnimationScheduler()
+    : count(0)
+{
+    for (uint16_t easing = 0; easing < NUMBER_OF_EASINGS; easing++)
+    {
+        for (uint16_t step = 0; step <= ANIMATION_EASING_STEPS; step++)
+        {
+            tables[easing][step] = equations[easing](step, 0, ONE, ANIMATION_EASING_STEPS);
+        }
+    }
+    instance = this;
+}
+
+bool AnimationScheduler::move(Drawable& widget, int16_t endX, int16_t endY, uint16_t duration, Easing easing, uint16_t delay, DoneCallback* done)
+{
+    const int index = add(widget, MOVE);
+    if (index < 0)
+    {
+        return false;
+    }
+    setters[index] = 0;
+    callbacks[index] = done;
+    fromX[index] = widget.getX();
+    fromY[index] = widget.getY();
+    deltaX[index] = endX - widget.getX();
+    deltaY[index] = endY - widget.getY();
+    elapsed[index] = 0;
+    durations[index] = duration;
+    delays[index] = delay;
+    easings[index] = easing < NUMBER_OF_EASINGS ? easing : LINEAR;
+    return true;
+}
+
+bool AnimationScheduler::startFade(Drawable& widget, SetAlpha setAlpha, uint8_t startAlpha, uint8_t endAlpha, uint16_t duration, Easing easing, uint16_t delay, DoneCallback* done)
+{
+    const int index = add(widget, FADE);
+    if (index < 0)
+    {
+        return false;
+    }
+    setters[index] = setAlpha;
+    callbacks[index] = done;
+    fromX[index] = startAlpha;
+    fromY[index] = 0;
+    deltaX[index] = endAlpha - startAlpha;
+    deltaY[index] = 0;
+    elapsed[index] = 0;
+    durations[index] = duration;
+    delays[index] = delay;
+    easings[index] = easing < NUMBER_OF_EASINGS ? easing : LINEAR;
+    return true;
+}
+
+void AnimationScheduler::cancel(const Drawable& widget)
+{
+    for (int i = count - 1; i >= 0; i--)
+    {
+        if (widgets[i] == &widget)
+        {
+            remove(i);
+        }
+    }
+}
+
+bool AnimationScheduler::isAnimating(const Drawable& widget) const
+{
+    for (uint16_t i = 0; i < count; i++)
+    {
+        if (widgets[i] == &widget)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void AnimationScheduler::tick()
+{
+    Drawable* doneWidgets[ANIMATION_SCHEDULER_SLOTS];
+    DoneCallback* doneCallbacks[ANIMATION_SCHEDULER_SLOTS];
+    uint16_t done = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        if (delays[i] > 0)
+        {
+            delays[i]--;
+            continue;
+        }
+        const uint16_t step = elapsed[i] < durations[i] ? ++elapsed[i] : durations[i];
+        const int32_t progress = step >= durations[i] ? ONE : ease(easings[i], step, durations[i]);
+        const int16_t x = fromX[i] + (int16_t)((deltaX[i] * progress + ONE / 2) >> 14);
+        if (setters[i] != 0)
+        {
+            // Back and bounce easings overshoot
+            setters[i](*widgets[i], (uint8_t)(x < 0 ? 0 : (x > 255 ? 255 : x)));
+        }
+        else
+        {
+            moveWidget(*widgets[i], x, fromY[i] + (int16_t)((deltaY[i] * progress + ONE / 2) >> 14));
+        }
+        if (step >= durations[i])
+        {
+            // Removed before the callbacks, which may start animations
+            doneWidgets[done] = widgets[i];
+            doneCallbacks[done] = callbacks[i];
+            done++;
+            remove(i);
+            i--;
+        }
+    }
+
+    for (uint16_t i = 0; i < done; i++)
+    {
+        if (doneCallbacks[i] != 0 && doneCallbacks[i]->isValid())
+        {
+            doneCallbacks[i]->execute(*doneWidgets[i]);
+        }
+    }
+}
+
+int AnimationScheduler::add(Drawable& widget, Kind kind)
+{
+    for (uint16_t i = 0; i < count; i++)
+    {
+        if (widgets[i] == &widget && (setters[i] != 0) == (kind == FADE))
+        {
+            return i;
+        }
+    }
+    if (count == ANIMATION_SCHEDULER_SLOTS)
+    {
+        return -1;
+    }
+    widgets[count] = &widget;
+    return count++;
+}
+
+void AnimationScheduler::remove(int index)
+{
+    // The last animation takes the slot, the order of the animations does not matter
+    count--;
+    widgets[index] = widgets[count];
+    setters[index] = setters[count];
+    callbacks[index] = callbacks[count];
+    fromX[index] = fromX[count];
+    fromY[index] = fromY[count];
+    deltaX[index] = deltaX[count];
+    deltaY[index] = deltaY[count];
+    elapsed[index] = elapsed[count];
+    durations[index] = durations[count];
+    delays[index] = delays[count];
+    easings[index] = easings[count];
+}
+
+int32_t AnimationScheduler::ease(uint8_t easing, uint16_t step, uint16_t duration) const
+{
+    // The position in the table in 16.10 fixed point
+    const uint32_t position = ((uint32_t)step * ANIMATION_EASING_STEPS << 10) / duration;
+    const uint32_t segment = position >> 10;
+    const int16_t* const table = tables[easing];
+    return table[segment] + (((table[segment + 1] - table[segment]) * (int32_t)(position & 1023)) >> 10);
+}
+
+void AnimationScheduler::moveWidget(Drawable& widget, int16_t x, int16_t y)
+{
+    const Rect from = widget.getRect();
+    if (x == from.x && y == from.y)
+    {
+        return;
+    }
+    widget.setXY(x, y);
+    const Drawable* const parent = widget.getParent();
+    if (parent == 0)
+    {
+        return;
+    }
+    const Rect to = widget.getRect();
+    if (from.intersect(to))
+    {
+        // One area for a small move instead of the two of moveTo()
+        Rect area = from;
+        area.expandToFit(to);
+        parent->invalidateRect(area);
+    }
+    else
+    {
+        Rect area = from;
+        parent->invalidateRect(area);
+        area = to;
+        parent->invalidateRect(area);
+    }
+}
@@ -0,0 +1,53 @@
+#include <gui/common/BakedBackground.hpp>
+
+using namespace touchgfx;
+
+BakedBackground::BakedBackground()
+    : Image(), container(0)
+{
+}
+
+bool BakedBackground::bake(Container& screen, const Bitmap& bitmap, Drawable* const* layers, uint16_t count)
+{
+    unbake();
+    if (count == 0)
+    {
+        return false;
+    }
+
+    // The bitmap was composed from the bottom of the screen up, anything in between would
+    // be drawn over
+    Drawable* child = screen.getFirstChild();
+    for (uint16_t i = 0; i < count; i++, child = child->getNextSibling())
+    {
+        if (child != layers[i])
+        {
+            return false;
+        }
+    }
+
+    // Only an opaque bitmap keeps the widgets behind it from being drawn
+    const Rect solid = bitmap.getSolidRect();
+    if (solid.width != bitmap.getWidth() || solid.height != bitmap.getHeight())
+    {
+        return false;
+    }
+
+    setBitmap(bitmap);
+    setXY(0, 0);
+    setVisible(true);
+    screen.insert(layers[count - 1], *this);
+    container = &screen;
+    invalidate();
+    return true;
+}
+
+void BakedBackground::unbake()
+{
+    if (container != 0)
+    {
+        invalidate();
+        container->remove(*this);
+        container = 0;
+    }
+}
@@ -0,0 +1,207 @@
+#include <gui/common/BlitScrollableContainer.hpp>
+#include <gui/common/DirtyAreaCoalescer.hpp>
+#include <gui/common/TargetHardware.hpp>
+#include <touchgfx/hal/HAL.hpp>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace touchgfx;
+
+BlitScrollableContainer* BlitScrollableContainer::firstPending = 0;
+BlitScrollableContainer::Stats BlitScrollableContainer::stats;
+
+BlitScrollableContainer::BlitScrollableContainer()
+    : ScrollableContainer(),
+      pendingViewport(),
+      pendingX(0),
+      pendingY(0),
+      pending(false),
+      scrollingSelf(false),
+      nextPending(0)
+{
+}
+
+BlitScrollableContainer::~BlitScrollableContainer()
+{
+    unlink();
+}
+
+void BlitScrollableContainer::moveChildrenRelative(int16_t deltaX, int16_t deltaY)
+{
+    if (!pending)
+    {
+        if (!canBlit())
+        {
+            ScrollableContainer::moveChildrenRelative(deltaX, deltaY);
+            return;
+        }
+        // Copied from where the viewport is in the latest frame
+        pendingViewport = viewport();
+        pendingX = 0;
+        pendingY = 0;
+        pending = true;
+        nextPending = firstPending;
+        firstPending = this;
+    }
+    scrollingSelf = true;
+    ScrollableContainer::moveChildrenRelative(deltaX, deltaY);
+    scrollingSelf = false;
+    pendingX += deltaX;
+    pendingY += deltaY;
+}
+
+void BlitScrollableContainer::invalidateRect(Rect& invalidatedArea) const
+{
+    if (scrollingSelf)
+    {
+        // The pixels are moved, not drawn
+        return;
+    }
+    ScrollableContainer::invalidateRect(invalidatedArea);
+}
+
+void BlitScrollableContainer::blitPendingScrolls(Vector<Rect, 8>& dirtyAreas, Vector<Rect, 8>& staleAreas, Vector<Rect, 8>& movedAreas)
+{
+    // Containers inside a container scrolled in the same frame draw their viewport
+    Rect blitted;
+    BlitScrollableContainer* container = firstPending;
+    while (container != 0)
+    {
+        BlitScrollableContainer* const next = container->nextPending;
+        container->blit(dirtyAreas, staleAreas, movedAreas, blitted);
+        container->unlink();
+        container = next;
+    }
+}
+
+void BlitScrollableContainer::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+bool BlitScrollableContainer::canBlit() const
+{
+    if (!TargetHardware::isAccelerated() || !isVisible())
+    {
+        return false;
+    }
+    // The background scrolls with the content, it must hide whatever is behind the container
+    const Drawable* const background = firstChild;
+    if (background == 0 || background == &xSlider || background == &ySlider || !background->isVisible())
+    {
+        return false;
+    }
+    Rect solid = background->getSolidRect();
+    solid.x += background->getX();
+    solid.y += background->getY();
+    return solid.includes(Rect(0, 0, getWidth(), getHeight()));
+}
+
+Rect BlitScrollableContainer::viewport() const
+{
+    Rect area = getAbsoluteRect();
+    for (const Drawable* d = getParent(); d != 0; d = d->getParent())
+    {
+        area = area & d->getAbsoluteRect();
+    }
+    return area & Rect(0, 0, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT);
+}
+
+void BlitScrollableContainer::blit(Vector<Rect, 8>& dirtyAreas, Vector<Rect, 8>& staleAreas, Vector<Rect, 8>& movedAreas, Rect& blitted)
+{
+    const Rect area = viewport();
+    const int16_t dx = pendingX;
+    const int16_t dy = pendingY;
+    const bool scrolled = dx != 0 || dy != 0;
+    if (area.isEmpty() || !isVisible())
+    {
+        return;
+    }
+
+    bool copied = area == pendingViewport
+                  && canBlit()
+                  && abs(dx) < area.width
+                  && abs(dy) < area.height
+                  && !area.intersect(blitted)
+                  && TargetHardware::copyPreviousFrame(area, dx, dy);
+    if (!copied)
+    {
+        DirtyAreaCoalescer::add(dirtyAreas, area);
+        if (scrolled)
+        {
+            stats.fallbacks++;
+        }
+        return;
+    }
+    blitted.expandToFit(area);
+
+    const Rect target = Rect(area.x + dx, area.y + dy, area.width, area.height) & area;
+    stats.copied += target.area();
+    if (scrolled)
+    {
+        // What is drawn anyway was also moved by the copy, to where it is drawn again
+        const uint16_t count = dirtyAreas.size();
+        for (uint16_t i = 0; i < count; i++)
+        {
+            Rect moved = dirtyAreas[i] & Rect(target.x - dx, target.y - dy, target.width, target.height);
+            moved.x += dx;
+            moved.y += dy;
+            DirtyAreaCoalescer::add(dirtyAreas, moved);
+        }
+
+        // The strips the scroll uncovered
+        Rect uncoveredX;
+        Rect uncoveredY;
+        if (dx > 0)
+        {
+            uncoveredX = Rect(area.x, area.y, dx, area.height);
+        }
+        else if (dx < 0)
+        {
+            uncoveredX = Rect(area.right() + dx, area.y, -dx, area.height);
+        }
+        if (dy > 0)
+        {
+            uncoveredY = Rect(area.x, area.y, area.width, dy);
+        }
+        else if (dy < 0)
+        {
+            uncoveredY = Rect(area.x, area.bottom() + dy, area.width, -dy);
+        }
+        DirtyAreaCoalescer::add(dirtyAreas, uncoveredX);
+        DirtyAreaCoalescer::add(dirtyAreas, uncoveredY);
+        // Changed pixels for the framebuffers that miss this frame
+        DirtyAreaCoalescer::add(movedAreas, target);
+        stats.uncovered += uncoveredX.area() + uncoveredY.area() - (uncoveredX & uncoveredY).area();
+        stats.blits++;
+    }
+
+    // The copy made these parts of the framebuffer as recent as the latest frame
+    for (uint16_t i = staleAreas.size(); i > 0; i--)
+    {
+        if (target.includes(staleAreas[i - 1]))
+        {
+            staleAreas.removeAt(i - 1);
+            stats.skipped++;
+        }
+    }
+}
+
+void BlitScrollableContainer::unlink()
+{
+    if (!pending)
+    {
+        return;
+    }
+    BlitScrollableContainer** link = &firstPending;
+    while (*link != 0 && *link != this)
+    {
+        link = &(*link)->nextPending;
+    }
+    if (*link == this)
+    {
+        *link = nextPending;
+    }
+    nextPending = 0;
+    pending = false;
+}
@@ -0,0 +1,109 @@
+#include <gui/common/BufferedPixelDataWidget.hpp>
+#include <gui/common/TargetHardware.hpp>
+#include <string.h>
+
+using namespace touchgfx;
+
+BufferedPixelDataWidget::Stats BufferedPixelDataWidget::stats;
+
+BufferedPixelDataWidget::BufferedPixelDataWidget()
+    : PixelDataWidget(), count(0), front(0), acquired(NONE), latest(0), flippedTo(0)
+{
+    memset(buffers, 0, sizeof(buffers));
+}
+
+void BufferedPixelDataWidget::setBuffers(uint8_t* first, uint8_t* second, uint8_t* third)
+{
+    buffers[0] = first;
+    buffers[1] = second;
+    buffers[2] = third;
+    count = (third != 0) ? 3 : 2;
+    front = 0;
+    acquired = NONE;
+    latest = 0;
+    flippedTo = 0;
+    setPixelData(first);
+    timer.start(*this);
+    // Keeps the buffers cycling, the producer of a hidden widget would starve
+    timer.setTickedWhenHidden(true);
+}
+
+uint8_t* BufferedPixelDataWidget::acquire()
+{
+    if (acquired != NONE)
+    {
+        return buffers[acquired];
+    }
+    // The buffer waiting for a frame is read before the buffer drawn: a frame starting in
+    // between draws the buffer that is already left out
+    const uint32_t published = latest;
+    const uint8_t pending = ((published >> 8) != flippedTo) ? (uint8_t)(published & 0xFF) : NONE;
+    const uint8_t drawn = front;
+    for (uint8_t i = 0; i < count; i++)
+    {
+        if (i != pending && i != drawn)
+        {
+            acquired = i;
+            return buffers[i];
+        }
+    }
+    stats.starved++;
+    return 0;
+}
+
+void BufferedPixelDataWidget::publish()
+{
+    if (acquired == NONE)
+    {
+        return;
+    }
+    // Written by the CPU, read by GPU2D or DMA2D past the data cache
+    TargetHardware::cleanDCache(buffers[acquired], bufferBytes());
+    const uint32_t previous = latest;
+    if ((previous >> 8) != flippedTo)
+    {
+        // Replaces a buffer no frame has drawn, which is free again
+        stats.dropped++;
+    }
+    latest = (((previous >> 8) + 1) << 8) | acquired;
+    acquired = NONE;
+    stats.published++;
+}
+
+void BufferedPixelDataWidget::handleTickEvent()
+{
+    const uint32_t published = latest;
+    if ((published >> 8) == flippedTo)
+    {
+        return;
+    }
+    // The buffer drawn until now was last read by the previous frame, which GPU2D has
+    // completed, so the producer may take it as soon as flippedTo is written
+    front = (uint8_t)(published & 0xFF);
+    setPixelData(buffers[front]);
+    flippedTo = published >> 8;
+    invalidate();
+    stats.flipped++;
+}
+
+void BufferedPixelDataWidget::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+uint32_t BufferedPixelDataWidget::bufferBytes() const
+{
+    const uint32_t pixels = (uint32_t)getWidth() * getHeight();
+    switch (getBitmapFormat())
+    {
+    case Bitmap::RGB565:
+        return pixels * 2;
+    case Bitmap::RGB888:
+        return pixels * 3;
+    case Bitmap::ARGB8888:
+        return pixels * 4;
+    default:
+        // The 8-bit formats, the others take less
+        return pixels;
+    }
+}
@@ -0,0 +1,31 @@
+#include <gui/common/CachedDataGraph.hpp>
+#include <string.h>
+
+using namespace touchgfx;
+
+GraphScreenCache::Stats GraphScreenCache::stats;
+
+void GraphScreenCache::checkArea(const AbstractDataGraph& graph)
+{
+    const int16_t width = graph.getGraphAreaWidth();
+    const int16_t height = graph.getGraphAreaHeight();
+    const int16_t left = graph.getGraphAreaPaddingLeft();
+    const int16_t top = graph.getGraphAreaPaddingTop();
+    if (width != areaWidth || left != paddingLeft)
+    {
+        areaWidth = width;
+        paddingLeft = left;
+        xValid = false;
+    }
+    if (height != areaHeight || top != paddingTop)
+    {
+        areaHeight = height;
+        paddingTop = top;
+        yValid = false;
+    }
+}
+
+void GraphScreenCache::resetStats()
+{
+    ::memset(&stats, 0, sizeof(stats));
+}
@@ -0,0 +1,220 @@
+#include <gui/common/CachedListItem.hpp>
+#include <gui/common/TargetHardware.hpp>
+#include <touchgfx/Application.hpp>
+#include <touchgfx/hal/HAL.hpp>
+#include <touchgfx/lcd/LCD.hpp>
+#include <string.h>
+
+using namespace touchgfx;
+
+namespace
+{
+uint32_t bytesPerPixel(Bitmap::BitmapFormat format)
+{
+    switch (format)
+    {
+    case Bitmap::ARGB8888:
+        return 4;
+    case Bitmap::RGB888:
+        return 3;
+    default:
+        return 2;
+    }
+}
+}
+
+ListItemCache::Stats ListItemCache::stats;
+
+ListItemCache::ListItemCache(Container& owner)
+    : Widget(),
+      item(owner),
+      bitmapMovedCallback(this, &ListItemCache::bitmapMoved),
+      bitmap(BITMAP_INVALID),
+      changes(0),
+      pendingChanges(0),
+      stale(true),
+      ticking(false),
+      caching(true),
+      rendering(false),
+      opaque(false)
+{
+    // Clipped and placed as a child of the item, without being one
+    parent = &owner;
+}
+
+ListItemCache::~ListItemCache()
+{
+    release();
+    if (ticking)
+    {
+        Application::getInstance()->unregisterTimerWidget(this);
+    }
+}
+
+void ListItemCache::setCaching(bool enable)
+{
+    caching = enable;
+    if (!enable)
+    {
+        release();
+    }
+}
+
+bool ListItemCache::isCached() const
+{
+    if (!caching || stale || bitmap == BITMAP_INVALID)
+    {
+        return false;
+    }
+    const Bitmap image(bitmap);
+    return image.getWidth() == item.getWidth() && image.getHeight() == item.getHeight();
+}
+
+void ListItemCache::setupDrawChain(const Rect& invalidatedArea, Drawable** nextPreviousElement)
+{
+    setPosition(0, 0, item.getWidth(), item.getHeight());
+    Widget::setupDrawChain(invalidatedArea, nextPreviousElement);
+}
+
+void ListItemCache::drawnLive() const
+{
+    if (rendering)
+    {
+        return;
+    }
+    stats.live++;
+    if (!caching || ticking || !canRender())
+    {
+        return;
+    }
+    // Compared with the changes at the next tick
+    pendingChanges = changes;
+    Application::getInstance()->registerTimerWidget(const_cast<ListItemCache*>(this));
+    ticking = true;
+}
+
+void ListItemCache::draw(const Rect& invalidatedArea) const
+{
+    const Rect area = invalidatedArea & Rect(0, 0, getWidth(), getHeight());
+    if (area.isEmpty())
+    {
+        return;
+    }
+    Rect abs(0, 0, 0, 0);
+    translateRectToAbsolute(abs);
+    HAL::lcd().drawPartialBitmap(Bitmap(bitmap), abs.x, abs.y, area, 255);
+    stats.blits++;
+}
+
+Rect ListItemCache::getSolidRect() const
+{
+    return opaque ? Rect(0, 0, getWidth(), getHeight()) : Rect();
+}
+
+void ListItemCache::handleTickEvent()
+{
+    if (changes != pendingChanges)
+    {
+        // Still changing, drawn from the children until it stops
+        pendingChanges = changes;
+        return;
+    }
+    Application::getInstance()->unregisterTimerWidget(this);
+    ticking = false;
+    render();
+}
+
+void ListItemCache::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+bool ListItemCache::isOpaque() const
+{
+    const Drawable* const background = item.getFirstChild();
+    if (background == 0 || !background->isVisible())
+    {
+        return false;
+    }
+    Rect solid = background->getSolidRect();
+    solid.x += background->getX();
+    solid.y += background->getY();
+    return solid.includes(Rect(0, 0, item.getWidth(), item.getHeight()));
+}
+
+Bitmap::BitmapFormat ListItemCache::renderFormat() const
+{
+    return isOpaque() ? HAL::lcd().framebufferFormat() : Bitmap::ARGB8888;
+}
+
+bool ListItemCache::canRender() const
+{
+    if (item.getWidth() <= 0 || item.getHeight() <= 0)
+    {
+        return false;
+    }
+    const Bitmap::BitmapFormat format = renderFormat();
+    if ((uint32_t)item.getWidth() * item.getHeight() * bytesPerPixel(format) > LIST_ITEM_CACHE_MAX_BYTES)
+    {
+        return false;
+    }
+    if (format != Bitmap::ARGB8888)
+    {
+        return true;
+    }
+    return HAL::DISPLAY_ROTATION == rotate0
+           && TargetHardware::canDrawInDynamicBitmap(Bitmap::ARGB8888);
+}
+
+void ListItemCache::render()
+{
+    if (!caching || !canRender() || isCached())
+    {
+        return;
+    }
+    const Bitmap::BitmapFormat format = renderFormat();
+    const Bitmap image(bitmap);
+    if (bitmap == BITMAP_INVALID || image.getFormat() != format || image.getWidth() != item.getWidth() || image.getHeight() != item.getHeight())
+    {
+        // A recycled item usually keeps its size and bitmap
+        release();
+        bitmap = DynamicBitmapArena::create(item.getWidth(), item.getHeight(), format, &bitmapMovedCallback);
+        if (bitmap == BITMAP_INVALID)
+        {
+            stats.noMemory++;
+            return;
+        }
+    }
+    opaque = format != Bitmap::ARGB8888;
+    if (opaque)
+    {
+        Bitmap::dynamicBitmapSetSolidRect(bitmap, Rect(0, 0, item.getWidth(), item.getHeight()));
+    }
+    else
+    {
+        // The children are blended over transparent pixels
+        uint8_t* const pixels = Bitmap::dynamicBitmapGetAddress(bitmap);
+        const uint32_t bytes = (uint32_t)item.getWidth() * item.getHeight() * 4;
+        memset(pixels, 0, bytes);
+        TargetHardware::cleanDCache(pixels, bytes);
+    }
+    rendering = true;
+    HAL::getInstance()->drawDrawableInDynamicBitmap(item, bitmap);
+    rendering = false;
+    stale = false;
+    stats.renders++;
+}
+
+void ListItemCache::release()
+{
+    if (bitmap != BITMAP_INVALID)
+    {
+        DynamicBitmapArena::destroy(bitmap);
+        bitmap = BITMAP_INVALID;
+    }
+}
+
+void ListItemCache::bitmapMoved(BitmapId /*oldId*/, BitmapId newId)
+{
+    bitmap = newId;
+}
@@ -0,0 +1,166 @@
+#include <gui/common/CachedModalWindow.hpp>
+#include <gui/common/TargetHardware.hpp>
+#include <touchgfx/hal/HAL.hpp>
+#include <touchgfx/lcd/LCD.hpp>
+#include <string.h>
+
+using namespace touchgfx;
+
+CachedModalWindow::Stats CachedModalWindow::stats;
+
+CachedModalWindow::CachedModalWindow()
+    : ModalWindow(),
+      bitmapMovedCallback(this, &CachedModalWindow::bitmapMoved),
+      background(0),
+      cached(BITMAP_INVALID)
+{
+    // Between the shade and the window, shown in place of the shade
+    dimmed.setVisible(false);
+    Container::insert(&backgroundShade, dimmed);
+}
+
+CachedModalWindow::~CachedModalWindow()
+{
+    release();
+}
+
+void CachedModalWindow::setBackgroundContainer(Container& container)
+{
+    background = &container;
+}
+
+void CachedModalWindow::setShadeAlpha(uint8_t alpha)
+{
+    ModalWindow::setShadeAlpha(alpha);
+    backgroundChanged();
+}
+
+void CachedModalWindow::setShadeColor(colortype color)
+{
+    ModalWindow::setShadeColor(color);
+    backgroundChanged();
+}
+
+void CachedModalWindow::show()
+{
+    ModalWindow::show();
+    if (!capture())
+    {
+        release();
+    }
+}
+
+void CachedModalWindow::hide()
+{
+    ModalWindow::hide();
+    timer.stop();
+    release();
+}
+
+void CachedModalWindow::backgroundChanged()
+{
+    if (isVisible())
+    {
+        // The previous capture is shown until the new one is taken
+        timer.start(*this);
+    }
+}
+
+void CachedModalWindow::handleTickEvent()
+{
+    timer.stop();
+    if (!capture())
+    {
+        release();
+    }
+    invalidate();
+}
+
+void CachedModalWindow::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+bool CachedModalWindow::canRender() const
+{
+    return HAL::DISPLAY_ROTATION == rotate0
+           && TargetHardware::canDrawInDynamicBitmap(HAL::lcd().framebufferFormat());
+}
+
+bool CachedModalWindow::capture()
+{
+    const Rect area = getAbsoluteRect();
+    if (background == 0 || !canRender() || area.isEmpty() || !background->getAbsoluteRect().includes(area))
+    {
+        stats.unavailable++;
+        return false;
+    }
+
+    const Bitmap::BitmapFormat format = HAL::lcd().framebufferFormat();
+    if (cached != BITMAP_INVALID)
+    {
+        const Bitmap image(cached);
+        if (image.getWidth() != area.width || image.getHeight() != area.height || image.getFormat() != format)
+        {
+            release();
+        }
+    }
+    if (cached == BITMAP_INVALID)
+    {
+        cached = DynamicBitmapArena::create(area.width, area.height, format, &bitmapMovedCallback);
+        if (cached == BITMAP_INVALID)
+        {
+            stats.noMemory++;
+            return false;
+        }
+    }
+
+    // The background is rendered at the origin of the bitmap with the shade over it and
+    // without the window, its children moved as in EffectContainer::capture()
+    const Rect origin = background->getAbsoluteRect();
+    const int16_t dx = origin.x - area.x;
+    const int16_t dy = origin.y - area.y;
+    for (Drawable* child = background->getFirstChild(); child != 0; child = child->getNextSibling())
+    {
+        child->setXY(child->getX() + dx, child->getY() + dy);
+    }
+    const bool windowVisible = windowContainer.isVisible();
+    windowContainer.setVisible(false);
+    dimmed.setVisible(false);
+    backgroundShade.setVisible(true);
+    HAL::getInstance()->drawDrawableInDynamicBitmap(*background, cached, Rect(0, 0, area.width, area.height));
+    windowContainer.setVisible(windowVisible);
+    for (Drawable* child = background->getFirstChild(); child != 0; child = child->getNextSibling())
+    {
+        child->setXY(child->getX() - dx, child->getY() - dy);
+    }
+
+    // Opaque, so nothing behind the window is drawn while it is open
+    Bitmap::dynamicBitmapSetSolidRect(cached, Rect(0, 0, area.width, area.height));
+    dimmed.setBitmap(Bitmap(cached));
+    dimmed.setXY(0, 0);
+    dimmed.setVisible(true);
+    backgroundShade.setVisible(false);
+    stats.captures++;
+    return true;
+}
+
+void CachedModalWindow::release()
+{
+    if (cached != BITMAP_INVALID)
+    {
+        DynamicBitmapArena::destroy(cached);
+        cached = BITMAP_INVALID;
+    }
+    dimmed.setVisible(false);
+    backgroundShade.setVisible(true);
+}
+
+void CachedModalWindow::bitmapMoved(BitmapId oldId, BitmapId newId)
+{
+    if (cached == oldId)
+    {
+        cached = newId;
+        dimmed.setBitmap(Bitmap(newId));
+    }
+}
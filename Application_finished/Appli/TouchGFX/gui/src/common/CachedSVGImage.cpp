@@ -0,0 +1,188 @@
+#include <gui/common/CachedSVGImage.hpp>
+#include <gui/common/TargetHardware.hpp>
+#include <touchgfx/Application.hpp>
+#include <touchgfx/hal/HAL.hpp>
+#include <touchgfx/lcd/LCD.hpp>
+#include <string.h>
+
+using namespace touchgfx;
+
+CachedSVGImage::Stats CachedSVGImage::stats;
+
+bool CachedSVGImage::Key::operator==(const Key& other) const
+{
+    return svgId == other.svgId
+           && width == other.width
+           && height == other.height
+           && scaleX == other.scaleX
+           && scaleY == other.scaleY
+           && rotation == other.rotation
+           && rotationCenterX == other.rotationCenterX
+           && rotationCenterY == other.rotationCenterY
+           && imagePositionX == other.imagePositionX
+           && imagePositionY == other.imagePositionY;
+}
+
+CachedSVGImage::CachedSVGImage()
+    : SVGImage(),
+      bitmapMovedCallback(this, &CachedSVGImage::bitmapMoved),
+      bitmap(BITMAP_INVALID),
+      ticking(false),
+      caching(true),
+      rasterizing(false)
+{
+    memset(&rasterizedKey, 0, sizeof(rasterizedKey));
+    memset(&pendingKey, 0, sizeof(pendingKey));
+}
+
+CachedSVGImage::~CachedSVGImage()
+{
+    release();
+    if (ticking)
+    {
+        Application::getInstance()->unregisterTimerWidget(this);
+    }
+}
+
+void CachedSVGImage::setSVG(uint16_t id)
+{
+    SVGImage::setSVG(id);
+    release();
+}
+
+void CachedSVGImage::setCaching(bool enable)
+{
+    caching = enable;
+    if (!enable)
+    {
+        release();
+    }
+}
+
+bool CachedSVGImage::isRasterized() const
+{
+    return bitmap != BITMAP_INVALID && rasterizedKey == currentKey();
+}
+
+void CachedSVGImage::draw(const Rect& invalidatedArea) const
+{
+    if (!rasterizing && isRasterized())
+    {
+        const Rect area = invalidatedArea & Rect(0, 0, getWidth(), getHeight());
+        if (!area.isEmpty())
+        {
+            Rect abs(0, 0, 0, 0);
+            translateRectToAbsolute(abs);
+            HAL::lcd().drawPartialBitmap(Bitmap(bitmap), abs.x, abs.y, area, 255);
+            stats.blits++;
+        }
+        return;
+    }
+
+    SVGImage::draw(invalidatedArea);
+    if (!rasterizing)
+    {
+        stats.paths++;
+        if (caching && canRasterize())
+        {
+            schedule();
+        }
+    }
+}
+
+void CachedSVGImage::handleTickEvent()
+{
+    const Key key = currentKey();
+    if (!(key == pendingKey))
+    {
+        // Still animated, drawn from the paths until it stops
+        pendingKey = key;
+        return;
+    }
+    Application::getInstance()->unregisterTimerWidget(this);
+    ticking = false;
+    rasterize();
+}
+
+void CachedSVGImage::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+CachedSVGImage::Key CachedSVGImage::currentKey() const
+{
+    Key key;
+    key.svgId = svgId;
+    key.width = getWidth();
+    key.height = getHeight();
+    key.scaleX = scaleX;
+    key.scaleY = scaleY;
+    key.rotation = rotation;
+    key.rotationCenterX = rotationCenterX;
+    key.rotationCenterY = rotationCenterY;
+    key.imagePositionX = imagePositionX;
+    key.imagePositionY = imagePositionY;
+    return key;
+}
+
+bool CachedSVGImage::canRasterize() const
+{
+    return svgId != SVG_INVALID
+           && getWidth() > 0
+           && getHeight() > 0
+           && (uint32_t)getWidth() * getHeight() * 4 <= CACHED_SVG_IMAGE_MAX_BYTES
+           && HAL::DISPLAY_ROTATION == rotate0
+           && TargetHardware::canDrawInDynamicBitmap(Bitmap::ARGB8888);
+}
+
+void CachedSVGImage::rasterize()
+{
+    if (!caching || !canRasterize() || isRasterized())
+    {
+        return;
+    }
+    release();
+    bitmap = DynamicBitmapArena::create(getWidth(), getHeight(), Bitmap::ARGB8888, &bitmapMovedCallback);
+    if (bitmap == BITMAP_INVALID)
+    {
+        stats.noMemory++;
+        return;
+    }
+
+    // The paths are blended over transparent pixels
+    uint8_t* const pixels = Bitmap::dynamicBitmapGetAddress(bitmap);
+    const uint32_t bytes = (uint32_t)getWidth() * getHeight() * 4;
+    memset(pixels, 0, bytes);
+    TargetHardware::cleanDCache(pixels, bytes);
+    rasterizing = true;
+    HAL::getInstance()->drawDrawableInDynamicBitmap(*this, bitmap);
+    rasterizing = false;
+    rasterizedKey = currentKey();
+    stats.rasterized++;
+}
+
+void CachedSVGImage::release()
+{
+    if (bitmap != BITMAP_INVALID)
+    {
+        DynamicBitmapArena::destroy(bitmap);
+        bitmap = BITMAP_INVALID;
+    }
+}
+
+void CachedSVGImage::schedule() const
+{
+    if (ticking)
+    {
+        return;
+    }
+    // Compared with the transformation at the next tick
+    pendingKey = currentKey();
+    Application::getInstance()->registerTimerWidget(const_cast<CachedSVGImage*>(this));
+    ticking = true;
+}
+
+void CachedSVGImage::bitmapMoved(BitmapId /*oldId*/, BitmapId newId)
+{
+    bitmap = newId;
+}
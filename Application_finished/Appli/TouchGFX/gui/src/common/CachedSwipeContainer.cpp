@@ -0,0 +1,421 @@
+#include <gui/common/CachedSwipeContainer.hpp>
+#include <gui/common/TargetHardware.hpp>
+#include <touchgfx/hal/HAL.hpp>
+#include <touchgfx/lcd/LCD.hpp>
+#include <string.h>
+
+using namespace touchgfx;
+
+namespace
+{
+uint32_t bytesPerPixel(Bitmap::BitmapFormat format)
+{
+    switch (format)
+    {
+    case Bitmap::ARGB8888:
+        return 4;
+    case Bitmap::RGB888:
+        return 3;
+    default:
+        return 2;
+    }
+}
+}
+
+CachedSwipeContainer::Stats CachedSwipeContainer::stats;
+
+CachedSwipeContainer::Textures::Textures(CachedSwipeContainer& owner)
+    : Widget(),
+      container(owner)
+{
+    // Clipped and placed as a child of the container, without being one
+    parent = &owner;
+}
+
+void CachedSwipeContainer::Textures::setupDrawChain(const Rect& invalidatedArea, Drawable** nextPreviousElement)
+{
+    setPosition(0, 0, container.getWidth(), container.getHeight());
+    Widget::setupDrawChain(invalidatedArea, nextPreviousElement);
+}
+
+void CachedSwipeContainer::Textures::draw(const Rect& invalidatedArea) const
+{
+    Rect abs(0, 0, 0, 0);
+    translateRectToAbsolute(abs);
+    for (uint8_t i = 0; i < NUM_TEXTURES; i++)
+    {
+        const Texture& texture = container.cache[i];
+        if (!container.isCached(texture.page))
+        {
+            continue;
+        }
+        const Rect rect = container.pageRect(*container.page(texture.page));
+        Rect area = invalidatedArea & rect & Rect(0, 0, getWidth(), getHeight());
+        if (area.isEmpty())
+        {
+            continue;
+        }
+        area.x -= rect.x;
+        area.y -= rect.y;
+        HAL::lcd().drawPartialBitmap(Bitmap(texture.bitmap), abs.x + rect.x, abs.y + rect.y, area, 255);
+        stats.blits++;
+    }
+}
+
+Rect CachedSwipeContainer::Textures::getSolidRect() const
+{
+    // Blended pages and the background beyond the end pages show what is behind
+    return Rect();
+}
+
+CachedSwipeContainer::CachedSwipeContainer()
+    : SwipeContainer(),
+      textures(*this),
+      bitmapMovedCallback(this, &CachedSwipeContainer::bitmapMoved),
+      idleTicks(0),
+      noMemory(false),
+      pressed(false),
+      movingSelf(false)
+{
+    for (uint8_t i = 0; i < NUM_TEXTURES; i++)
+    {
+        cache[i].bitmap = BITMAP_INVALID;
+        cache[i].page = -1;
+        cache[i].stale = true;
+    }
+}
+
+CachedSwipeContainer::~CachedSwipeContainer()
+{
+    for (uint8_t i = 0; i < NUM_TEXTURES; i++)
+    {
+        release(cache[i]);
+    }
+}
+
+void CachedSwipeContainer::handleTickEvent()
+{
+    movingSelf = true;
+    SwipeContainer::handleTickEvent();
+    movingSelf = false;
+
+    if (pressed || !atRest())
+    {
+        idleTicks = 0;
+        return;
+    }
+    if (idleTicks < CACHED_SWIPE_IDLE_TICKS)
+    {
+        idleTicks++;
+        return;
+    }
+    renderNext();
+}
+
+void CachedSwipeContainer::handleClickEvent(const ClickEvent& event)
+{
+    pressed = event.getType() == ClickEvent::PRESSED;
+    movingSelf = true;
+    SwipeContainer::handleClickEvent(event);
+    movingSelf = false;
+}
+
+void CachedSwipeContainer::handleDragEvent(const DragEvent& event)
+{
+    movingSelf = true;
+    SwipeContainer::handleDragEvent(event);
+    movingSelf = false;
+}
+
+void CachedSwipeContainer::handleGestureEvent(const GestureEvent& event)
+{
+    movingSelf = true;
+    SwipeContainer::handleGestureEvent(event);
+    movingSelf = false;
+}
+
+void CachedSwipeContainer::remove(Drawable& page)
+{
+    // The pages after it change index
+    for (uint8_t i = 0; i < NUM_TEXTURES; i++)
+    {
+        release(cache[i]);
+    }
+    SwipeContainer::remove(page);
+}
+
+void CachedSwipeContainer::invalidateRect(Rect& invalidatedArea) const
+{
+    if (!movingSelf)
+    {
+        changed(invalidatedArea);
+    }
+    SwipeContainer::invalidateRect(invalidatedArea);
+}
+
+void CachedSwipeContainer::pageChanged(uint8_t page)
+{
+    for (uint8_t i = 0; i < NUM_TEXTURES; i++)
+    {
+        if (cache[i].page == page)
+        {
+            cache[i].stale = true;
+        }
+    }
+    idleTicks = 0;
+    noMemory = false;
+}
+
+void CachedSwipeContainer::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+void CachedSwipeContainer::setupDrawChain(const Rect& invalidatedArea, Drawable** nextPreviousElement)
+{
+    if (atRest() || !isVisible())
+    {
+        SwipeContainer::setupDrawChain(invalidatedArea, nextPreviousElement);
+        return;
+    }
+    if (!drawnFromTextures())
+    {
+        stats.live++;
+        SwipeContainer::setupDrawChain(invalidatedArea, nextPreviousElement);
+        return;
+    }
+    // The bitmaps in place of the pages, then the page indicator
+    textures.setupDrawChain(invalidatedArea, nextPreviousElement);
+    Drawable* const pages = layout();
+    pages->setVisible(false);
+    SwipeContainer::setupDrawChain(invalidatedArea, nextPreviousElement);
+    pages->setVisible(true);
+}
+
+Drawable* CachedSwipeContainer::layout() const
+{
+    // The ListLayout of the pages is the first child of SwipeContainer
+    return firstChild;
+}
+
+Drawable* CachedSwipeContainer::page(int16_t index) const
+{
+    if (index < 0)
+    {
+        return 0;
+    }
+    Drawable* drawable = layout()->getFirstChild();
+    while (drawable != 0 && index > 0)
+    {
+        drawable = drawable->getNextSibling();
+        index--;
+    }
+    return drawable;
+}
+
+Rect CachedSwipeContainer::pageRect(const Drawable& drawable) const
+{
+    Rect rect = drawable.getRect();
+    rect.x += layout()->getX();
+    rect.y += layout()->getY();
+    return rect;
+}
+
+bool CachedSwipeContainer::atRest() const
+{
+    return layout()->getX() == -static_cast<int16_t>(getSelectedPage() * getWidth());
+}
+
+const CachedSwipeContainer::Texture* CachedSwipeContainer::find(int16_t index) const
+{
+    for (uint8_t i = 0; i < NUM_TEXTURES; i++)
+    {
+        if (cache[i].page == index && index >= 0)
+        {
+            return &cache[i];
+        }
+    }
+    return 0;
+}
+
+bool CachedSwipeContainer::isCached(int16_t index) const
+{
+    const Texture* const texture = find(index);
+    const Drawable* const drawable = page(index);
+    if (texture == 0 || drawable == 0 || texture->stale || texture->bitmap == BITMAP_INVALID)
+    {
+        return false;
+    }
+    const Bitmap image(texture->bitmap);
+    return image.getWidth() == drawable->getWidth() && image.getHeight() == drawable->getHeight();
+}
+
+bool CachedSwipeContainer::drawnFromTextures() const
+{
+    const Rect view(0, 0, getWidth(), getHeight());
+    int16_t index = 0;
+    for (Drawable* drawable = layout()->getFirstChild(); drawable != 0; drawable = drawable->getNextSibling(), index++)
+    {
+        if (drawable->isVisible() && pageRect(*drawable).intersect(view) && !isCached(index))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void CachedSwipeContainer::changed(const Rect& area) const
+{
+    for (uint8_t i = 0; i < NUM_TEXTURES; i++)
+    {
+        const Drawable* const drawable = page(cache[i].page);
+        if (drawable != 0 && pageRect(*drawable).intersect(area))
+        {
+            cache[i].stale = true;
+        }
+    }
+    idleTicks = 0;
+    noMemory = false;
+}
+
+bool CachedSwipeContainer::isOpaque(Drawable& drawable) const
+{
+    const Drawable* const background = drawable.getFirstChild();
+    if (background == 0)
+    {
+        // A page that is a single widget
+        return drawable.getSolidRect().includes(Rect(0, 0, drawable.getWidth(), drawable.getHeight()));
+    }
+    if (!background->isVisible())
+    {
+        return false;
+    }
+    Rect solid = background->getSolidRect();
+    solid.x += background->getX();
+    solid.y += background->getY();
+    return solid.includes(Rect(0, 0, drawable.getWidth(), drawable.getHeight()));
+}
+
+bool CachedSwipeContainer::canRender(Drawable& drawable, Bitmap::BitmapFormat format) const
+{
+    if (drawable.getWidth() <= 0 || drawable.getHeight() <= 0 || !drawable.isVisible())
+    {
+        return false;
+    }
+    if (format != Bitmap::ARGB8888)
+    {
+        return true;
+    }
+    return HAL::DISPLAY_ROTATION == rotate0
+           && TargetHardware::canDrawInDynamicBitmap(Bitmap::ARGB8888);
+}
+
+void CachedSwipeContainer::renderNext()
+{
+    const int16_t selected = getSelectedPage();
+    const int16_t wanted[NUM_TEXTURES] = { selected, static_cast<int16_t>(selected + 1), static_cast<int16_t>(selected - 1) };
+
+    // Pages no longer next to the current one give their bitmap to those that are
+    for (uint8_t i = 0; i < NUM_TEXTURES; i++)
+    {
+        const int16_t index = cache[i].page;
+        if (index >= 0 && (page(index) == 0 || (index != wanted[0] && index != wanted[1] && index != wanted[2])))
+        {
+            release(cache[i]);
+        }
+    }
+    if (noMemory)
+    {
+        return;
+    }
+
+    for (uint8_t w = 0; w < NUM_TEXTURES; w++)
+    {
+        if (page(wanted[w]) == 0 || isCached(wanted[w]))
+        {
+            continue;
+        }
+        Texture* texture = const_cast<Texture*>(find(wanted[w]));
+        for (uint8_t i = 0; texture == 0 && i < NUM_TEXTURES; i++)
+        {
+            if (cache[i].page < 0)
+            {
+                texture = &cache[i];
+            }
+        }
+        if (texture != 0)
+        {
+            // One page per tick
+            render(*texture, wanted[w]);
+            return;
+        }
+    }
+}
+
+void CachedSwipeContainer::render(Texture& texture, int16_t index)
+{
+    Drawable& drawable = *page(index);
+    const Bitmap::BitmapFormat format = isOpaque(drawable) ? HAL::lcd().framebufferFormat() : Bitmap::ARGB8888;
+    if (!canRender(drawable, format))
+    {
+        return;
+    }
+    const int16_t width = drawable.getWidth();
+    const int16_t height = drawable.getHeight();
+    const Bitmap image(texture.bitmap);
+    if (texture.bitmap == BITMAP_INVALID || image.getFormat() != format || image.getWidth() != width || image.getHeight() != height)
+    {
+        release(texture);
+        texture.bitmap = DynamicBitmapArena::create(width, height, format, &bitmapMovedCallback);
+        if (texture.bitmap == BITMAP_INVALID)
+        {
+            stats.noMemory++;
+            noMemory = true;
+            return;
+        }
+    }
+    texture.page = index;
+    if (format != Bitmap::ARGB8888)
+    {
+        Bitmap::dynamicBitmapSetSolidRect(texture.bitmap, Rect(0, 0, width, height));
+    }
+    else
+    {
+        // The page is blended over transparent pixels
+        uint8_t* const pixels = Bitmap::dynamicBitmapGetAddress(texture.bitmap);
+        const uint32_t bytes = (uint32_t)width * height * bytesPerPixel(format);
+        memset(pixels, 0, bytes);
+        TargetHardware::cleanDCache(pixels, bytes);
+    }
+
+    // Rendered where the current page is, so it is placed on the display as it is when in view
+    Drawable* const pages = layout();
+    const int16_t restX = pages->getX();
+    pages->setX(-drawable.getX());
+    HAL::getInstance()->drawDrawableInDynamicBitmap(drawable, texture.bitmap);
+    pages->setX(restX);
+    texture.stale = false;
+    stats.renders++;
+}
+
+void CachedSwipeContainer::release(Texture& texture)
+{
+    if (texture.bitmap != BITMAP_INVALID)
+    {
+        DynamicBitmapArena::destroy(texture.bitmap);
+        texture.bitmap = BITMAP_INVALID;
+    }
+    texture.page = -1;
+    texture.stale = true;
+}
+
+void CachedSwipeContainer::bitmapMoved(BitmapId oldId, BitmapId newId)
+{
+    for (uint8_t i = 0; i < NUM_TEXTURES; i++)
+    {
+        if (cache[i].bitmap == oldId)
+        {
+            cache[i].bitmap = newId;
+        }
+    }
+}
@@ -0,0 +1,193 @@
+#include <gui/common/CachedTextArea.hpp>
+#include <gui/common/TargetHardware.hpp>
+#include <touchgfx/Texts.hpp>
+#include <touchgfx/hal/HAL.hpp>
+#include <string.h>
+
+using namespace touchgfx;
+
+namespace
+{
+/** FNV-1a over the values the placement of the glyphs depends on. */
+class Signature
+{
+public:
+    Signature()
+        : hash(2166136261U)
+    {
+    }
+
+    void add(uint32_t value)
+    {
+        for (int i = 0; i < 4; i++)
+        {
+            hash = (hash ^ (value & 0xFFU)) * 16777619U;
+            value >>= 8;
+        }
+    }
+
+    uint32_t value() const
+    {
+        // 0 is kept for no text
+        return hash != 0 ? hash : 1;
+    }
+
+private:
+    uint32_t hash;
+};
+}
+
+CachedTextArea::Stats CachedTextArea::stats;
+
+CachedTextArea::CachedTextArea()
+    : TextArea(),
+      bitmapMovedCallback(this, &CachedTextArea::bitmapMoved),
+      bitmap(BITMAP_INVALID),
+      renderedSignature(0),
+      pendingSignature(0),
+      rejectedSignature(0),
+      caching(true)
+{
+}
+
+CachedTextArea::~CachedTextArea()
+{
+    release();
+}
+
+void CachedTextArea::setCaching(bool enable)
+{
+    caching = enable;
+    if (!enable)
+    {
+        release();
+    }
+}
+
+bool CachedTextArea::isCached() const
+{
+    return bitmap != BITMAP_INVALID && renderedSignature == signature();
+}
+
+void CachedTextArea::draw(const Rect& area) const
+{
+    if (caching && canCache())
+    {
+        const uint32_t textSignature = signature();
+        if (bitmap == BITMAP_INVALID || textSignature != renderedSignature)
+        {
+            // Rendered on the second draw in a row with the same text, so a text changed
+            // every frame is not rendered twice per draw
+            if (textSignature != rejectedSignature && textSignature == pendingSignature)
+            {
+                render(textSignature);
+            }
+            pendingSignature = textSignature;
+        }
+        if (bitmap != BITMAP_INVALID && textSignature == renderedSignature)
+        {
+            const Rect abs = getAbsoluteRect();
+            Rect clip = area & Rect(0, 0, getWidth(), getHeight());
+            translateRectToAbsolute(clip);
+            if (TargetHardware::drawA8Mask(Bitmap::dynamicBitmapGetAddress(bitmap), abs.width, abs.height, abs.x, abs.y, clip, color, alpha))
+            {
+                stats.blits++;
+                return;
+            }
+        }
+    }
+    stats.uncached++;
+    TextArea::draw(area);
+}
+
+void CachedTextArea::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+uint32_t CachedTextArea::signature() const
+{
+    if (!typedText.hasValidId())
+    {
+        return 0;
+    }
+    Signature signature;
+    // The text itself, as the same id is another text in another language
+    const Unicode::UnicodeChar* text = typedText.getText();
+    for (; text != 0 && *text != 0; text++)
+    {
+        signature.add(*text);
+    }
+    signature.add((uint32_t)(uintptr_t)typedText.getFont());
+    signature.add((uint32_t)typedText.getId());
+    signature.add((uint32_t)Texts::getLanguage());
+    signature.add((uint32_t)getWidth() | ((uint32_t)getHeight() << 16));
+    signature.add((uint32_t)(uint16_t)linespace);
+    signature.add((uint32_t)getAlignment() | ((uint32_t)typedText.getTextDirection() << 8) | ((uint32_t)rotation << 16));
+    signature.add((uint32_t)indentation | ((uint32_t)wideTextAction << 8));
+    return signature.value();
+}
+
+bool CachedTextArea::canCache() const
+{
+    const Rect abs = getAbsoluteRect();
+    return TargetHardware::isAccelerated()
+           && !abs.isEmpty()
+           && (uint32_t)abs.width * abs.height <= TEXT_CACHE_MAX_BYTES
+           && rotation == TEXT_ROTATE_0
+           && typedText.hasValidId()
+           && HAL::DISPLAY_ROTATION == rotate0
+           && Rect(0, 0, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT).includes(abs);
+}
+
+bool CachedTextArea::render(uint32_t textSignature) const
+{
+    const Font* const font = typedText.getFont();
+    if (font == 0)
+    {
+        return false;
+    }
+    const uint16_t width = getWidth();
+    const uint16_t height = getHeight();
+    if (bitmap == BITMAP_INVALID || Bitmap(bitmap).getWidth() != width || Bitmap(bitmap).getHeight() != height)
+    {
+        release();
+        // L8 without palette is one byte per pixel, read as A8 by GPU2D
+        bitmap = DynamicBitmapArena::create(width, height, Bitmap::L8, &bitmapMovedCallback);
+        if (bitmap == BITMAP_INVALID)
+        {
+            stats.noMemory++;
+            return false;
+        }
+    }
+    renderedSignature = 0;
+
+    uint8_t* const mask = Bitmap::dynamicBitmapGetAddress(bitmap);
+    const LCD::StringVisuals visuals(font, color, 255, getAlignment(), linespace, rotation, typedText.getTextDirection(), indentation, wideTextAction);
+    if (!TargetHardware::renderStringMask(getAbsoluteRect(), visuals, typedText.getText(), mask))
+    {
+        // Drawn glyph by glyph until the text changes
+        rejectedSignature = textSignature;
+        release();
+        return false;
+    }
+    TargetHardware::cleanDCache(mask, (uint32_t)width * height);
+    renderedSignature = textSignature;
+    stats.renders++;
+    return true;
+}
+
+void CachedTextArea::release() const
+{
+    if (bitmap != BITMAP_INVALID)
+    {
+        DynamicBitmapArena::destroy(bitmap);
+        bitmap = BITMAP_INVALID;
+    }
+    renderedSignature = 0;
+}
+
+void CachedTextArea::bitmapMoved(BitmapId /*oldId*/, BitmapId newId)
+{
+    bitmap = newId;
+}
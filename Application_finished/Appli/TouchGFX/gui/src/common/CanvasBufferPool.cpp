@@ -0,0 +1,138 @@
+#include <gui/common/CanvasBufferPool.hpp>
+#include <gui/common/TargetHardware.hpp>
+#include <touchgfx/Utils.hpp>
+#include <touchgfx/hal/Config.hpp>
+#include <string.h>
+
+using namespace touchgfx;
+
+namespace
+{
+const uint32_t SENTINEL = 0xA5A5A5A5U;
+
+uint32_t canvasBuffer[CANVAS_BUFFER_SIZE / 4];
+// Cells the normal buffer holds
+const uint32_t BUFFER_CELLS = CANVAS_BUFFER_SIZE / sizeof(Cell);
+#if CANVAS_SCRATCH_SIZE > 0
+// Only used for the few widgets that do not fit the normal buffer, so it may be slower
+LOCATION_PRAGMA_NOLOAD("TouchGFX_Framebuffer")
+uint32_t canvasScratch[CANVAS_SCRATCH_SIZE / 4] LOCATION_ATTRIBUTE_NOLOAD("TouchGFX_Framebuffer");
+#endif
+
+#if CANVAS_BUFFER_AUTO_TUNE
+void canvasBufferUsage(const void* /*context*/, uint32_t& /*used*/, uint32_t& peak)
+{
+    peak = MIN(CanvasBufferPool::getStats().peakCells * sizeof(Cell), sizeof(canvasBuffer));
+}
+#endif
+}
+
+CanvasBufferPool::Stats CanvasBufferPool::stats;
+bool CanvasBufferPool::drawing = false;
+
+void CanvasBufferPool::init()
+{
+    CanvasWidgetRenderer::setupBuffer(reinterpret_cast<uint8_t*>(canvasBuffer), sizeof(canvasBuffer));
+    resetStats();
+    // The use is only measured with CANVAS_BUFFER_AUTO_TUNE
+#if CANVAS_BUFFER_AUTO_TUNE
+    TargetHardware::addMemoryBudget("canvas buffer", canvasBuffer, sizeof(canvasBuffer), canvasBufferUsage);
+#else
+    TargetHardware::addMemoryBudget("canvas buffer", canvasBuffer, sizeof(canvasBuffer));
+#endif
+#if CANVAS_SCRATCH_SIZE > 0
+    TargetHardware::addMemoryBudget("canvas scratch", canvasScratch, sizeof(canvasScratch));
+#endif
+}
+
+void CanvasBufferPool::beginDraw(Usage& usage)
+{
+    drawing = true;
+    usage.passes = 0;
+    usage.draws++;
+    stats.draws++;
+#if CANVAS_SCRATCH_SIZE > 0
+    if (usage.useScratch)
+    {
+        CanvasWidgetRenderer::setupBuffer(reinterpret_cast<uint8_t*>(canvasScratch), sizeof(canvasScratch));
+        stats.scratchDraws++;
+    }
+#endif
+#if CANVAS_BUFFER_AUTO_TUNE
+    // Cells are allocated from the start of the buffer, the untouched end is what is left
+    memset(CanvasWidgetRenderer::getOutlineBuffer(), SENTINEL & 0xFF, CanvasWidgetRenderer::getOutlineBufferSize());
+#endif
+}
+
+void CanvasBufferPool::pass(Usage& usage, bool done, int16_t lines)
+{
+    if (!drawing)
+    {
+        return;
+    }
+    usage.passes++;
+    stats.passes++;
+    if (usage.passes > 1)
+    {
+        usage.extraPasses++;
+        stats.extraPasses++;
+    }
+    if (!done && lines <= 1)
+    {
+        stats.incomplete++;
+    }
+}
+
+void CanvasBufferPool::endDraw(Usage& usage)
+{
+    if (!drawing)
+    {
+        return;
+    }
+    drawing = false;
+#if CANVAS_BUFFER_AUTO_TUNE
+    const uint32_t cells = measureCells();
+    usage.peakCells = MAX(usage.peakCells, cells);
+    stats.peakCells = MAX(stats.peakCells, cells);
+#endif
+#if CANVAS_SCRATCH_SIZE > 0
+    if (usage.useScratch)
+    {
+        CanvasWidgetRenderer::setupBuffer(reinterpret_cast<uint8_t*>(canvasBuffer), sizeof(canvasBuffer));
+    }
+    // Split draws go over the outline once per slice, the scratch buffer reads it once
+    else if (usage.passes > 1 || usage.peakCells >= BUFFER_CELLS)
+    {
+        usage.useScratch = true;
+    }
+#endif
+}
+
+void CanvasBufferPool::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+void CanvasBufferPool::report()
+{
+    touchgfx_printf("canvas: draws=%u passes=%u extra_passes=%u scratch_draws=%u incomplete=%u peak_cells=%u/%u\n",
+                    (unsigned)stats.draws,
+                    (unsigned)stats.passes,
+                    (unsigned)stats.extraPasses,
+                    (unsigned)stats.scratchDraws,
+                    (unsigned)stats.incomplete,
+                    (unsigned)stats.peakCells,
+                    (unsigned)BUFFER_CELLS);
+    resetStats();
+}
+
+uint32_t CanvasBufferPool::measureCells()
+{
+    const uint32_t* const buffer = reinterpret_cast<const uint32_t*>(CanvasWidgetRenderer::getOutlineBuffer());
+    uint32_t words = CanvasWidgetRenderer::getOutlineBufferSize() / 4;
+    while (words > 0 && buffer[words - 1] == SENTINEL)
+    {
+        words--;
+    }
+    return (words * 4 + sizeof(Cell) - 1) / sizeof(Cell);
+}
@@ -0,0 +1,229 @@
+#include <gui/common/CoverageCache.hpp>
+#include <gui/common/TargetHardware.hpp>
+#include <touchgfx/hal/HAL.hpp>
+#include <string.h>
+
+using namespace touchgfx;
+
+namespace
+{
+/** FNV-1a over the values the outline depends on. */
+class Signature
+{
+public:
+    Signature(const Drawable& widget)
+        : hash(2166136261U)
+    {
+        add((int32_t)widget.getWidth());
+        add((int32_t)widget.getHeight());
+    }
+
+    void add(int32_t value)
+    {
+        for (int i = 0; i < 4; i++)
+        {
+            hash = (hash ^ ((uint32_t)value & 0xFFU)) * 16777619U;
+            value >>= 8;
+        }
+    }
+
+    void add(float value)
+    {
+        int32_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        add(bits);
+    }
+
+    uint32_t value() const
+    {
+        // 0 is kept for no geometry
+        return hash != 0 ? hash : 1;
+    }
+
+private:
+    uint32_t hash;
+};
+}
+
+CoverageMask::Stats CoverageMask::stats;
+
+CoverageMask::CoverageMask()
+    : bitmapMovedCallback(this, &CoverageMask::bitmapMoved),
+      bitmap(BITMAP_INVALID),
+      rasterizedSignature(0),
+      pendingSignature(0),
+      rejectedSignature(0),
+      rasterizingSignature(0)
+{
+}
+
+CoverageMask::~CoverageMask()
+{
+    release();
+}
+
+bool CoverageMask::shouldRasterize(uint32_t signature)
+{
+    if (signature == rejectedSignature)
+    {
+        return false;
+    }
+    if (signature != pendingSignature)
+    {
+        // Still animated, drawn from the outline until it stops
+        pendingSignature = signature;
+        return false;
+    }
+    return true;
+}
+
+const AbstractPainter* CoverageMask::beginRasterize(const CanvasWidget& widget, uint32_t signature)
+{
+    const uint16_t width = widget.getWidth();
+    const uint16_t height = widget.getHeight();
+    if (bitmap == BITMAP_INVALID || Bitmap(bitmap).getWidth() != width || Bitmap(bitmap).getHeight() != height)
+    {
+        release();
+        // L8 without palette is one byte per pixel, read as A8 by GPU2D
+        bitmap = DynamicBitmapArena::create(width, height, Bitmap::L8, &bitmapMovedCallback);
+        if (bitmap == BITMAP_INVALID)
+        {
+            stats.noMemory++;
+            return 0;
+        }
+    }
+    rasterizedSignature = 0;
+    rasterizingSignature = signature;
+
+    uint8_t* const pixels = Bitmap::dynamicBitmapGetAddress(bitmap);
+    // Clears the pixels the outline does not cover
+    ::memset(pixels, 0, (uint32_t)width * height);
+    painter.setMask(pixels, width);
+    return &painter;
+}
+
+bool CoverageMask::endRasterize(bool done)
+{
+    if (!done)
+    {
+        // Drawn from the outline, in slices, from now on
+        rejectedSignature = rasterizingSignature;
+        stats.tooComplex++;
+        release();
+        return false;
+    }
+    const Bitmap mask(bitmap);
+    TargetHardware::cleanDCache(Bitmap::dynamicBitmapGetAddress(bitmap), (uint32_t)mask.getWidth() * mask.getHeight());
+    rasterizedSignature = rasterizingSignature;
+    stats.rasterized++;
+    return true;
+}
+
+bool CoverageMask::draw(const CanvasWidget& widget, const Rect& invalidatedArea, colortype color) const
+{
+    const Rect abs = widget.getAbsoluteRect();
+    Rect clip = invalidatedArea & widget.getMinimalRect();
+    widget.translateRectToAbsolute(clip);
+    if (!TargetHardware::drawA8Mask(Bitmap::dynamicBitmapGetAddress(bitmap), abs.width, abs.height, abs.x, abs.y, clip, color, widget.getAlpha()))
+    {
+        return false;
+    }
+    stats.blits++;
+    return true;
+}
+
+void CoverageMask::release()
+{
+    if (bitmap != BITMAP_INVALID)
+    {
+        DynamicBitmapArena::destroy(bitmap);
+        bitmap = BITMAP_INVALID;
+    }
+    rasterizedSignature = 0;
+}
+
+bool CoverageMask::canCache(const CanvasWidget& widget)
+{
+    const Rect abs = widget.getAbsoluteRect();
+    return TargetHardware::isAccelerated()
+           && !abs.isEmpty()
+           && (uint32_t)abs.width * abs.height <= COVERAGE_CACHE_MAX_BYTES
+           && HAL::DISPLAY_ROTATION == rotate0
+           && Rect(0, 0, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT).includes(abs);
+}
+
+uint32_t CoverageMask::signature(const Circle& circle)
+{
+    Signature signature(circle);
+    float x;
+    float y;
+    float value;
+    circle.getCenter(x, y);
+    signature.add(x);
+    signature.add(y);
+    circle.getRadius(value);
+    signature.add(value);
+    circle.getLineWidth(value);
+    signature.add(value);
+    circle.getArc(x, y);
+    signature.add(x);
+    signature.add(y);
+    signature.add((int32_t)circle.getPrecision());
+    signature.add((int32_t)circle.getCapPrecision());
+    return signature.value();
+}
+
+uint32_t CoverageMask::signature(const Line& line)
+{
+    Signature signature(line);
+    float x;
+    float y;
+    line.getStart(x, y);
+    signature.add(x);
+    signature.add(y);
+    line.getEnd(x, y);
+    signature.add(x);
+    signature.add(y);
+    signature.add(line.getLineWidth<float>());
+    signature.add((int32_t)line.getLineEndingStyle());
+    return signature.value();
+}
+
+uint32_t CoverageMask::signature(const AbstractShape& shape)
+{
+    Signature signature(shape);
+    float x;
+    float y;
+    shape.getOrigin(x, y);
+    signature.add(x);
+    signature.add(y);
+    shape.getScale(x, y);
+    signature.add(x);
+    signature.add(y);
+    // getAngle() rounds to whole degrees, and its template is not const
+    const_cast<AbstractShape&>(shape).getAngle(x);
+    signature.add(x);
+    signature.add((int32_t)shape.getFillingRule());
+    const int points = shape.getNumPoints();
+    for (int i = 0; i < points; i++)
+    {
+        signature.add((int32_t)shape.getCornerX(i));
+        signature.add((int32_t)shape.getCornerY(i));
+    }
+    return signature.value();
+}
+
+void CoverageMask::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+void CoverageMask::MaskPainter::paint(uint8_t* /*destination*/, int16_t /*offset*/, int16_t widgetX, int16_t widgetY, int16_t count, uint8_t alpha) const
+{
+    memset(mask + (uint32_t)widgetY * stride + widgetX, alpha, count);
+}
+
+void CoverageMask::bitmapMoved(BitmapId /*oldId*/, BitmapId newId)
+{
+    bitmap = newId;
+}
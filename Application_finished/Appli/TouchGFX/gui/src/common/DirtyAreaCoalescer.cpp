@@ -0,0 +1,94 @@
+#include <gui/common/DirtyAreaCoalescer.hpp>
+
+using namespace touchgfx;
+
+void DirtyAreaCoalescer::coalesce(Vector<Rect, 8>& areas, const Rect& bounds)
+{
+    for (uint16_t i = 0; i < areas.size(); i++)
+    {
+        alignToTiles(areas[i], bounds);
+    }
+
+    // Merging grows an area, which may allow it to absorb areas
+    // that were already compared, so repeat until nothing changes.
+    bool merged = true;
+    while (merged)
+    {
+        merged = false;
+        for (uint16_t i = 0; i < areas.size(); i++)
+        {
+            uint16_t j = i + 1;
+            while (j < areas.size())
+            {
+                if (shouldMerge(areas[i], areas[j]))
+                {
+                    areas[i].expandToFit(areas[j]);
+                    areas.removeAt(j);
+                    merged = true;
+                }
+                else
+                {
+                    j++;
+                }
+            }
+        }
+    }
+}
+
+void DirtyAreaCoalescer::add(Vector<Rect, 8>& areas, const Rect& area)
+{
+    if (area.isEmpty())
+    {
+        return;
+    }
+    for (uint16_t i = 0; i < areas.size(); i++)
+    {
+        if (areas[i].includes(area))
+        {
+            return;
+        }
+    }
+    if (areas.size() < 8)
+    {
+        areas.add(area);
+        return;
+    }
+    uint16_t best = 0;
+    int32_t bestCost = 0;
+    for (uint16_t i = 0; i < areas.size(); i++)
+    {
+        Rect merged = areas[i];
+        merged.expandToFit(area);
+        const int32_t cost = merged.area() - areas[i].area();
+        if (i == 0 || cost < bestCost)
+        {
+            best = i;
+            bestCost = cost;
+        }
+    }
+    areas[best].expandToFit(area);
+}
+
+void DirtyAreaCoalescer::alignToTiles(Rect& area, const Rect& bounds)
+{
+    const int16_t left = area.x - (area.x % DIRTY_AREA_TILE_WIDTH);
+    const int16_t top = area.y - (area.y % DIRTY_AREA_TILE_HEIGHT);
+    const int16_t right = area.right() + (DIRTY_AREA_TILE_WIDTH - 1) - ((area.right() + (DIRTY_AREA_TILE_WIDTH - 1)) % DIRTY_AREA_TILE_WIDTH);
+    const int16_t bottom = area.bottom() + (DIRTY_AREA_TILE_HEIGHT - 1) - ((area.bottom() + (DIRTY_AREA_TILE_HEIGHT - 1)) % DIRTY_AREA_TILE_HEIGHT);
+
+    Rect aligned(left, top, right - left, bottom - top);
+    aligned &= bounds;
+    if (!aligned.isEmpty())
+    {
+        area = aligned;
+    }
+}
+
+bool DirtyAreaCoalescer::shouldMerge(const Rect& a, const Rect& b)
+{
+    Rect merged = a;
+    merged.expandToFit(b);
+
+    const int32_t covered = a.area() + b.area() - (a & b).area();
+    return merged.area() <= covered + DIRTY_AREA_MERGE_SLACK;
+}
@@ -0,0 +1,189 @@
+#include <gui/common/DirtyRegion.hpp>
+#include <touchgfx/Utils.hpp>
+#include <string.h>
+
+using namespace touchgfx;
+
+DirtyRegion::DirtyRegion()
+    : bounds(), columns(0), rows(0), top(0), bottom(0)
+{
+    memset(tiles, 0, sizeof(tiles));
+    resetStats();
+}
+
+void DirtyRegion::setBounds(const Rect& area)
+{
+    bounds = area;
+    columns = MIN((area.width + DIRTY_AREA_TILE_WIDTH - 1) / DIRTY_AREA_TILE_WIDTH, DIRTY_REGION_MAX_COLUMNS);
+    rows = MIN((area.height + DIRTY_AREA_TILE_HEIGHT - 1) / DIRTY_AREA_TILE_HEIGHT, DIRTY_REGION_MAX_ROWS);
+    clear();
+}
+
+void DirtyRegion::add(const Rect& area)
+{
+    Rect clipped = area & bounds;
+    if (clipped.isEmpty())
+    {
+        return;
+    }
+    const uint16_t left = (clipped.x - bounds.x) / DIRTY_AREA_TILE_WIDTH;
+    const uint16_t right = MIN((clipped.right() - bounds.x + DIRTY_AREA_TILE_WIDTH - 1) / DIRTY_AREA_TILE_WIDTH, (int)columns);
+    const uint16_t first = (clipped.y - bounds.y) / DIRTY_AREA_TILE_HEIGHT;
+    const uint16_t last = MIN((clipped.bottom() - bounds.y + DIRTY_AREA_TILE_HEIGHT - 1) / DIRTY_AREA_TILE_HEIGHT, (int)rows);
+    for (uint16_t row = first; row < last; row++)
+    {
+        memset(&tiles[row][left], 1, right - left);
+    }
+    if (isEmpty())
+    {
+        top = first;
+        bottom = last;
+    }
+    else
+    {
+        top = MIN(top, first);
+        bottom = MAX(bottom, last);
+    }
+}
+
+void DirtyRegion::takeAreas(Vector<Rect, 8>& areas)
+{
+    areas.clear();
+    if (isEmpty())
+    {
+        return;
+    }
+
+    Rect rects[DIRTY_REGION_CANDIDATES];
+    uint16_t count = collect(rects);
+    clear();
+
+    // Merging two rectangles draws the pixels between them, but saves a pass over the
+    // widgets, which costs about DIRTY_AREA_MERGE_SLACK pixels
+    while (count > areas.maxCapacity())
+    {
+        mergeCheapest(rects, count, 0x7FFFFFFF);
+    }
+    while (count > 1 && mergeCheapest(rects, count, DIRTY_AREA_MERGE_SLACK) <= DIRTY_AREA_MERGE_SLACK)
+    {
+    }
+
+    for (uint16_t i = 0; i < count; i++)
+    {
+        areas.add(rects[i]);
+    }
+    stats.frames++;
+    stats.areas += count;
+}
+
+void DirtyRegion::clear()
+{
+    for (uint16_t row = top; row < bottom; row++)
+    {
+        memset(tiles[row], 0, columns);
+    }
+    top = bottom = 0;
+}
+
+void DirtyRegion::countRedrawn(const Vector<Rect, 8>& areas)
+{
+    for (uint16_t i = 0; i < areas.size(); i++)
+    {
+        stats.redrawn += areas[i].area();
+    }
+}
+
+void DirtyRegion::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+void DirtyRegion::report()
+{
+    touchgfx_printf("dirty: frames=%u areas=%u invalidated=%u redrawn=%u merges=%u\n",
+                    (unsigned)stats.frames,
+                    (unsigned)stats.areas,
+                    (unsigned)stats.invalidated,
+                    (unsigned)stats.redrawn,
+                    (unsigned)stats.merges);
+    resetStats();
+}
+
+uint16_t DirtyRegion::collect(Rect* rects)
+{
+    uint16_t count = 0;
+    for (uint16_t row = top; row < bottom; row++)
+    {
+        uint16_t column = 0;
+        while (column < columns)
+        {
+            if (tiles[row][column] == 0)
+            {
+                column++;
+                continue;
+            }
+            const uint16_t start = column;
+            while (column < columns && tiles[row][column] != 0)
+            {
+                column++;
+            }
+            Rect run(bounds.x + start * DIRTY_AREA_TILE_WIDTH, bounds.y + row * DIRTY_AREA_TILE_HEIGHT, (column - start) * DIRTY_AREA_TILE_WIDTH, DIRTY_AREA_TILE_HEIGHT);
+            run &= bounds;
+            stats.invalidated += run.area();
+
+            // Runs with the same columns as a rectangle ending on the row above extend it
+            bool extended = false;
+            for (uint16_t i = 0; i < count && !extended; i++)
+            {
+                if (rects[i].x == run.x && rects[i].width == run.width && rects[i].bottom() == run.y)
+                {
+                    rects[i].height += run.height;
+                    extended = true;
+                }
+            }
+            if (!extended)
+            {
+                if (count == DIRTY_REGION_CANDIDATES)
+                {
+                    mergeCheapest(rects, count, 0x7FFFFFFF);
+                }
+                rects[count++] = run;
+            }
+        }
+    }
+    return count;
+}
+
+int32_t DirtyRegion::mergeCheapest(Rect* rects, uint16_t& count, int32_t maxCost)
+{
+    uint16_t a = 0;
+    uint16_t b = 1;
+    int32_t cheapest = mergeCost(rects[0], rects[1]);
+    for (uint16_t i = 0; i < count; i++)
+    {
+        for (uint16_t j = i + 1; j < count; j++)
+        {
+            const int32_t cost = mergeCost(rects[i], rects[j]);
+            if (cost < cheapest)
+            {
+                cheapest = cost;
+                a = i;
+                b = j;
+            }
+        }
+    }
+    if (cheapest <= maxCost)
+    {
+        rects[a].expandToFit(rects[b]);
+        rects[b] = rects[--count];
+        stats.merges++;
+    }
+    return cheapest;
+}
+
+int32_t DirtyRegion::mergeCost(const Rect& a, const Rect& b)
+{
+    Rect merged = a;
+    merged.expandToFit(b);
+    return merged.area() - (a.area() + b.area() - (a & b).area());
+}
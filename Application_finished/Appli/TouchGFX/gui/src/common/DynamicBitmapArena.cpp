@@ -0,0 +1,220 @@
+#include <gui/common/DynamicBitmapArena.hpp>
+#include <gui/common/TargetHardware.hpp>
+#include <touchgfx/hal/Config.hpp>
+#include <string.h>
+
+using namespace touchgfx;
+
+namespace
+{
+// Aligned to a line of the data cache, the size classes keep every bitmap aligned
+LOCATION_PRAGMA_32("TouchGFX_Framebuffer")
+uint32_t arena[DYNAMIC_BITMAP_ARENA_SIZE / 4] LOCATION_ATTRIBUTE_32("TouchGFX_Framebuffer");
+
+const uint16_t NONE = 0xFFFF;
+
+uint32_t pixelBytes(Bitmap::BitmapFormat format, uint32_t pixels)
+{
+    switch (format)
+    {
+    case Bitmap::RGB565:
+        return pixels * 2;
+    case Bitmap::RGB888:
+        return pixels * 3;
+    case Bitmap::ARGB8888:
+        return pixels * 4;
+    case Bitmap::L8:
+        return pixels;
+    default:
+        return 0;
+    }
+}
+}
+
+DynamicBitmapArena::Block DynamicBitmapArena::blocks[DYNAMIC_BITMAP_ARENA_BITMAPS];
+DynamicBitmapArena::Stats DynamicBitmapArena::stats;
+
+BitmapId DynamicBitmapArena::create(uint16_t width, uint16_t height, Bitmap::BitmapFormat format, MovedCallback* moved)
+{
+    const uint32_t bytes = pixelBytes(format, (uint32_t)width * height);
+    uint16_t slot = 0;
+    while (slot < DYNAMIC_BITMAP_ARENA_BITMAPS && blocks[slot].size != 0)
+    {
+        slot++;
+    }
+    uint32_t offset;
+    if (bytes == 0 || slot == DYNAMIC_BITMAP_ARENA_BITMAPS || !findGap(sizeClass(bytes), offset))
+    {
+        stats.failed++;
+        return BITMAP_INVALID;
+    }
+    const BitmapId id = Bitmap::dynamicBitmapCreateExternal(width, height, reinterpret_cast<uint8_t*>(arena) + offset, format);
+    if (id == BITMAP_INVALID)
+    {
+        // No dynamic bitmap left in the bitmap cache
+        stats.failed++;
+        return BITMAP_INVALID;
+    }
+    Block& block = blocks[slot];
+    block.offset = offset;
+    block.size = sizeClass(bytes);
+    block.id = id;
+    block.moved = moved;
+    stats.created++;
+    return id;
+}
+
+void DynamicBitmapArena::destroy(BitmapId id)
+{
+    for (uint16_t i = 0; i < DYNAMIC_BITMAP_ARENA_BITMAPS; i++)
+    {
+        if (blocks[i].size != 0 && blocks[i].id == id)
+        {
+            Bitmap::dynamicBitmapDelete(id);
+            blocks[i].size = 0;
+            return;
+        }
+    }
+}
+
+void DynamicBitmapArena::compact()
+{
+    uint32_t budget = DYNAMIC_BITMAP_ARENA_COMPACT_BYTES;
+    uint32_t to = 0;
+    for (uint16_t i = next(0); i != NONE; i = next(to))
+    {
+        Block& block = blocks[i];
+        if (block.offset > to && block.moved != 0 && block.moved->isValid() && block.size <= budget)
+        {
+            const Bitmap old(block.id);
+            const uint16_t width = old.getWidth();
+            const uint16_t height = old.getHeight();
+            const Bitmap::BitmapFormat format = old.getFormat();
+            const Rect solid = old.getSolidRect();
+
+            uint8_t* const base = reinterpret_cast<uint8_t*>(arena);
+            // The arena is cached when an MPUProfile makes PSRAM cacheable, and GPU2D may
+            // have drawn the bitmap
+            TargetHardware::invalidateDCache(base + block.offset, block.size);
+            memmove(base + to, base + block.offset, block.size);
+            TargetHardware::cleanDCache(base + to, block.size);
+            // The old id is free once deleted, so creating the bitmap again cannot fail
+            Bitmap::dynamicBitmapDelete(block.id);
+            const BitmapId id = Bitmap::dynamicBitmapCreateExternal(width, height, base + to, format);
+            Bitmap::dynamicBitmapSetSolidRect(id, solid);
+
+            const BitmapId oldId = block.id;
+            block.offset = to;
+            block.id = id;
+            budget -= block.size;
+            stats.moved++;
+            stats.movedBytes += block.size;
+            block.moved->execute(oldId, id);
+        }
+        to = block.offset + block.size;
+    }
+}
+
+uint16_t DynamicBitmapArena::getFragmentation()
+{
+    uint32_t used = 0;
+    for (uint16_t i = 0; i < DYNAMIC_BITMAP_ARENA_BITMAPS; i++)
+    {
+        used += blocks[i].size;
+    }
+    const uint32_t free = sizeof(arena) - used;
+    if (free == 0)
+    {
+        return 0;
+    }
+    return (uint16_t)((uint64_t)(free - largestGap()) * 1000U / free);
+}
+
+const DynamicBitmapArena::Stats& DynamicBitmapArena::getStats()
+{
+    stats.usedBytes = 0;
+    for (uint16_t i = 0; i < DYNAMIC_BITMAP_ARENA_BITMAPS; i++)
+    {
+        stats.usedBytes += blocks[i].size;
+    }
+    stats.largestFree = largestGap();
+    return stats;
+}
+
+void DynamicBitmapArena::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+uint32_t DynamicBitmapArena::sizeClass(uint32_t bytes)
+{
+    // Steps of 2^n and 1.5 * 2^n, at least 1 KB, waste at most a third
+    uint32_t size = 1024;
+    while (size < bytes)
+    {
+        if (size + size / 2 >= bytes)
+        {
+            return size + size / 2;
+        }
+        size *= 2;
+    }
+    return size;
+}
+
+bool DynamicBitmapArena::findGap(uint32_t bytes, uint32_t& offset)
+{
+    // Best fit, the smallest gap the bitmap fits in
+    uint32_t best = 0;
+    bool found = false;
+    uint32_t from = 0;
+    while (from < sizeof(arena))
+    {
+        const uint16_t i = next(from);
+        const uint32_t end = (i == NONE) ? sizeof(arena) : blocks[i].offset;
+        const uint32_t gap = end - from;
+        if (gap >= bytes && (!found || gap < best))
+        {
+            best = gap;
+            offset = from;
+            found = true;
+        }
+        if (i == NONE)
+        {
+            break;
+        }
+        from = blocks[i].offset + blocks[i].size;
+    }
+    return found;
+}
+
+uint32_t DynamicBitmapArena::largestGap()
+{
+    uint32_t largest = 0;
+    uint32_t from = 0;
+    while (from < sizeof(arena))
+    {
+        const uint16_t i = next(from);
+        const uint32_t end = (i == NONE) ? sizeof(arena) : blocks[i].offset;
+        largest = MAX(largest, end - from);
+        if (i == NONE)
+        {
+            break;
+        }
+        from = blocks[i].offset + blocks[i].size;
+    }
+    return largest;
+}
+
+uint16_t DynamicBitmapArena::next(uint32_t from)
+{
+    // The block at the lowest offset at or above from, the few blocks are kept unsorted
+    uint16_t found = NONE;
+    for (uint16_t i = 0; i < DYNAMIC_BITMAP_ARENA_BITMAPS; i++)
+    {
+        if (blocks[i].size != 0 && blocks[i].offset >= from && (found == NONE || blocks[i].offset < blocks[found].offset))
+        {
+            found = i;
+        }
+    }
+    return found;
+}
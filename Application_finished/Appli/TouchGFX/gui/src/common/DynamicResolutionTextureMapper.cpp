@@ -0,0 +1,200 @@
+#include <gui/common/DynamicResolutionTextureMapper.hpp>
+#include <gui/common/DynamicBitmapArena.hpp>
+#include <gui/common/TargetHardware.hpp>
+#include <touchgfx/hal/HAL.hpp>
+#include <string.h>
+
+using namespace touchgfx;
+
+DynamicResolutionTextureMapper::Stats DynamicResolutionTextureMapper::stats;
+
+DynamicResolutionTextureMapper::DynamicResolutionTextureMapper()
+    : FastTextureMapper(),
+      bitmapMovedCallback(this, &DynamicResolutionTextureMapper::bitmapMoved),
+      scaled(BITMAP_INVALID),
+      renderedBitmap(BITMAP_INVALID),
+      renderedAlpha(0),
+      rendering(false)
+{
+    memset(renderedCorners, 0, sizeof(renderedCorners));
+}
+
+DynamicResolutionTextureMapper::~DynamicResolutionTextureMapper()
+{
+    release();
+}
+
+void DynamicResolutionTextureMapper::draw(const Rect& invalidatedArea) const
+{
+    const uint8_t percent = rendering ? 100 : getScalePercent();
+    if (percent >= 100 && !rendering)
+    {
+        // Back at full resolution, the room is given back to the arena
+        release();
+    }
+    else if (percent < 100 && prepare(percent))
+    {
+        Rect dest(0, 0, getWidth(), getHeight());
+        translateRectToAbsolute(dest);
+        Rect clip = invalidatedArea;
+        translateRectToAbsolute(clip);
+        // The alpha of the mapper is in the bitmap already
+        if (TargetHardware::drawScaledBitmap(Bitmap(scaled), dest, clip, 255, true))
+        {
+            stats.scaledDraws++;
+            return;
+        }
+    }
+    if (!rendering)
+    {
+        stats.fullDraws++;
+    }
+    FastTextureMapper::draw(invalidatedArea);
+}
+
+Rect DynamicResolutionTextureMapper::getSolidRect() const
+{
+    // The edges of the bitmap scaled up are blended with what is below
+    return getScalePercent() < 100 ? Rect() : FastTextureMapper::getSolidRect();
+}
+
+void DynamicResolutionTextureMapper::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+uint8_t DynamicResolutionTextureMapper::getScalePercent() const
+{
+    return TargetHardware::getScalePercent();
+}
+
+bool DynamicResolutionTextureMapper::prepare(uint8_t percent) const
+{
+    if (getWidth() <= 0 || getHeight() <= 0)
+    {
+        return false;
+    }
+    const uint16_t width = (uint16_t)(((uint32_t)getWidth() * percent + 99) / 100);
+    const uint16_t height = (uint16_t)(((uint32_t)getHeight() * percent + 99) / 100);
+    if (isRendered(width, height))
+    {
+        return true;
+    }
+    if (HAL::DISPLAY_ROTATION != rotate0
+        || !TargetHardware::canDrawInDynamicBitmap(Bitmap::ARGB8888))
+    {
+        return false;
+    }
+
+    const Bitmap image(scaled);
+    if (scaled == BITMAP_INVALID || image.getWidth() != width || image.getHeight() != height)
+    {
+        release();
+        scaled = DynamicBitmapArena::create(width, height, Bitmap::ARGB8888, &bitmapMovedCallback);
+        if (scaled == BITMAP_INVALID)
+        {
+            stats.noMemory++;
+            return false;
+        }
+    }
+    // The mapper is blended over transparent pixels
+    uint8_t* const pixels = Bitmap::dynamicBitmapGetAddress(scaled);
+    const uint32_t bytes = (uint32_t)width * height * 4;
+    memset(pixels, 0, bytes);
+    TargetHardware::cleanDCache(pixels, bytes);
+
+    // The mapper is drawn at the origin of the bitmap, the projected corners scaled to its
+    // size, so GPU2D maps the texture to fewer pixels with the same perspective
+    DynamicResolutionTextureMapper& self = const_cast<DynamicResolutionTextureMapper&>(*this);
+    float corners[CORNER_VALUES];
+    getCorners(corners);
+    const int16_t fullWidth = rect.width;
+    const int16_t fullHeight = rect.height;
+    const float scaleX = (float)width / (float)fullWidth;
+    const float scaleY = (float)height / (float)fullHeight;
+    float scaledCorners[CORNER_VALUES];
+    for (int i = 0; i < CORNER_VALUES; i += 3)
+    {
+        scaledCorners[i] = corners[i] * scaleX;
+        scaledCorners[i + 1] = corners[i + 1] * scaleY;
+        scaledCorners[i + 2] = corners[i + 2];
+    }
+    self.setCorners(scaledCorners);
+    self.rect.width = width;
+    self.rect.height = height;
+    rendering = true;
+    HAL::getInstance()->drawDrawableInDynamicBitmap(self, scaled);
+    rendering = false;
+    self.rect.width = fullWidth;
+    self.rect.height = fullHeight;
+    self.setCorners(corners);
+
+    memcpy(renderedCorners, corners, sizeof(renderedCorners));
+    renderedBitmap = getBitmap().getId();
+    renderedAlpha = getAlpha();
+    stats.renders++;
+    return true;
+}
+
+bool DynamicResolutionTextureMapper::isRendered(uint16_t width, uint16_t height) const
+{
+    if (scaled == BITMAP_INVALID)
+    {
+        return false;
+    }
+    const Bitmap image(scaled);
+    if (image.getWidth() != width || image.getHeight() != height
+        || renderedBitmap != getBitmap().getId() || renderedAlpha != getAlpha())
+    {
+        return false;
+    }
+    float corners[CORNER_VALUES];
+    getCorners(corners);
+    return memcmp(corners, renderedCorners, sizeof(corners)) == 0;
+}
+
+void DynamicResolutionTextureMapper::getCorners(float* corners) const
+{
+    corners[0] = imageX0;
+    corners[1] = imageY0;
+    corners[2] = imageZ0;
+    corners[3] = imageX1;
+    corners[4] = imageY1;
+    corners[5] = imageZ1;
+    corners[6] = imageX2;
+    corners[7] = imageY2;
+    corners[8] = imageZ2;
+    corners[9] = imageX3;
+    corners[10] = imageY3;
+    corners[11] = imageZ3;
+}
+
+void DynamicResolutionTextureMapper::setCorners(const float* corners)
+{
+    imageX0 = corners[0];
+    imageY0 = corners[1];
+    imageZ0 = corners[2];
+    imageX1 = corners[3];
+    imageY1 = corners[4];
+    imageZ1 = corners[5];
+    imageX2 = corners[6];
+    imageY2 = corners[7];
+    imageZ2 = corners[8];
+    imageX3 = corners[9];
+    imageY3 = corners[10];
+    imageZ3 = corners[11];
+}
+
+void DynamicResolutionTextureMapper::release() const
+{
+    if (scaled != BITMAP_INVALID)
+    {
+        DynamicBitmapArena::destroy(scaled);
+        scaled = BITMAP_INVALID;
+    }
+}
+
+void DynamicResolutionTextureMapper::bitmapMoved(BitmapId /*oldId*/, BitmapId newId)
+{
+    scaled = newId;
+}
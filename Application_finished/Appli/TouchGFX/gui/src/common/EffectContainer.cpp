@@ -0,0 +1,418 @@
+#include <gui/common/EffectContainer.hpp>
+#include <gui/common/DynamicBitmapArena.hpp>
+#include <gui/common/TargetHardware.hpp>
+#include <touchgfx/Color.hpp>
+#include <touchgfx/hal/HAL.hpp>
+#include <touchgfx/lcd/LCD.hpp>
+#include <string.h>
+
+using namespace touchgfx;
+
+namespace
+{
+/** The part of an edge of the shadow a texel is in, from 0 outside to 1 inside. */
+float edgeProfile(int16_t texel, int16_t size, float ramp)
+{
+    const float fromOutside = (float)(texel < size - 1 - texel ? texel : size - 1 - texel) + 0.5f;
+    float f = fromOutside / ramp;
+    if (f >= 1.0f)
+    {
+        return 1.0f;
+    }
+    // Smoothstep, close to the profile of a gaussian blurred edge
+    return f * f * (3.0f - 2.0f * f);
+}
+}
+
+EffectContainer::Stats EffectContainer::stats;
+
+EffectContainer::Backdrop::Backdrop(EffectContainer& owner)
+    : Widget(),
+      container(owner)
+{
+    // Clipped and placed as a child of the container, without being one
+    parent = &owner;
+}
+
+void EffectContainer::Backdrop::setupDrawChain(const Rect& invalidatedArea, Drawable** nextPreviousElement)
+{
+    setPosition(0, 0, container.getWidth(), container.getHeight());
+    Widget::setupDrawChain(invalidatedArea, nextPreviousElement);
+}
+
+void EffectContainer::Backdrop::draw(const Rect& invalidatedArea) const
+{
+    Rect dest(0, 0, getWidth(), getHeight());
+    translateRectToAbsolute(dest);
+    Rect clip = invalidatedArea;
+    translateRectToAbsolute(clip);
+    bool blurred = false;
+    if (container.ready)
+    {
+        blurred = TargetHardware::drawScaledBitmap(Bitmap(container.blurred[container.result]), dest, clip, 255, true);
+    }
+    if (!blurred)
+    {
+        stats.fallbacks++;
+    }
+    if (container.tintAlpha > 0)
+    {
+        HAL::lcd().fillRect(clip, container.tintColor, container.tintAlpha);
+    }
+}
+
+Rect EffectContainer::Backdrop::getSolidRect() const
+{
+    if ((container.ready && container.canRender()) || container.tintAlpha == 255)
+    {
+        return Rect(0, 0, getWidth(), getHeight());
+    }
+    return Rect();
+}
+
+EffectContainer::Shadow::Shadow(EffectContainer& owner)
+    : Widget(),
+      container(owner)
+{
+    setVisible(false);
+}
+
+void EffectContainer::Shadow::draw(const Rect& invalidatedArea) const
+{
+    if (container.shadowBitmap == BITMAP_INVALID)
+    {
+        return;
+    }
+    Rect dest(0, 0, getWidth(), getHeight());
+    translateRectToAbsolute(dest);
+    Rect clip = invalidatedArea;
+    translateRectToAbsolute(clip);
+    // The color and the alpha are in the bitmap
+    TargetHardware::drawScaledBitmap(Bitmap(container.shadowBitmap), dest, clip, 255, true);
+}
+
+Rect EffectContainer::Shadow::getSolidRect() const
+{
+    return Rect();
+}
+
+EffectContainer::Pass::Pass()
+    : Widget(),
+      mode(SCALE_DOWN),
+      source(BITMAP_INVALID),
+      taps(1),
+      done(false)
+{
+}
+
+void EffectContainer::Pass::draw(const Rect& invalidatedArea) const
+{
+    Rect abs(0, 0, getWidth(), getHeight());
+    translateRectToAbsolute(abs);
+    const Bitmap bitmap(source);
+    if (mode == SCALE_DOWN)
+    {
+        Rect clip = invalidatedArea;
+        translateRectToAbsolute(clip);
+        done = TargetHardware::drawScaledBitmap(bitmap, abs, clip, 255, true);
+        return;
+    }
+
+    const int16_t width = bitmap.getWidth();
+    const int16_t height = bitmap.getHeight();
+    HAL::lcd().drawPartialBitmap(bitmap, abs.x, abs.y, Rect(0, 0, width, height), 255);
+    uint16_t blended = 1;
+    for (int16_t t = 1; t <= taps; t++)
+    {
+        for (int16_t side = -1; side <= 1; side += 2)
+        {
+            const int16_t dx = (mode == HORIZONTAL) ? t * side : 0;
+            const int16_t dy = (mode == VERTICAL) ? t * side : 0;
+            // The texels shifted onto the bitmap, those at its edges keep fewer neighbours
+            const Rect part(dx < 0 ? -dx : 0, dy < 0 ? -dy : 0, width - (dx < 0 ? -dx : dx), height - (dy < 0 ? -dy : dy));
+            if (part.isEmpty())
+            {
+                continue;
+            }
+            // The n-th copy blended with 1/n leaves every copy the same weight
+            blended++;
+            HAL::lcd().drawPartialBitmap(bitmap, abs.x + dx, abs.y + dy, part, (uint8_t)(255 / blended));
+        }
+    }
+}
+
+Rect EffectContainer::Pass::getSolidRect() const
+{
+    return Rect(0, 0, getWidth(), getHeight());
+}
+
+EffectContainer::EffectContainer()
+    : Container(),
+      backdrop(*this),
+      shadow(*this),
+      bitmapMovedCallback(this, &EffectContainer::bitmapMoved),
+      background(0),
+      shadowBitmap(BITMAP_INVALID),
+      result(0),
+      ready(false),
+      blurRadius(16),
+      tintColor(Color::getColorFromRGB(255, 255, 255)),
+      tintAlpha(64),
+      shadowX(0),
+      shadowY(0),
+      shadowRadius(0),
+      shadowColor(Color::getColorFromRGB(0, 0, 0)),
+      shadowAlpha(0)
+{
+    blurred[0] = blurred[1] = BITMAP_INVALID;
+}
+
+EffectContainer::~EffectContainer()
+{
+    release(blurred[0]);
+    release(blurred[1]);
+    release(shadowBitmap);
+}
+
+void EffectContainer::setBackground(Container& container)
+{
+    background = &container;
+    backgroundChanged();
+}
+
+void EffectContainer::setBlur(uint8_t radius, colortype tint, uint8_t alpha)
+{
+    blurRadius = radius;
+    tintColor = tint;
+    tintAlpha = alpha;
+    if (radius == 0)
+    {
+        ready = false;
+        release(blurred[0]);
+        release(blurred[1]);
+    }
+    else
+    {
+        backgroundChanged();
+    }
+    invalidate();
+}
+
+void EffectContainer::setShadow(int16_t offsetX, int16_t offsetY, uint8_t radius, colortype color, uint8_t alpha)
+{
+    shadow.invalidate();
+    shadowX = offsetX;
+    shadowY = offsetY;
+    shadowRadius = radius;
+    shadowColor = color;
+    shadowAlpha = alpha;
+    // The rectangle blurred reaches a radius beyond the container
+    shadow.setPosition(getX() + offsetX - radius, getY() + offsetY - radius, getWidth() + 2 * radius, getHeight() + 2 * radius);
+    shadow.setVisible(computeShadow());
+    shadow.invalidate();
+}
+
+void EffectContainer::backgroundChanged()
+{
+    if (blurRadius > 0 && background != 0)
+    {
+        // The previous backdrop is shown until the new one is blurred
+        timer.start(*this);
+    }
+}
+
+void EffectContainer::handleTickEvent()
+{
+    timer.stop();
+    const bool wasReady = ready;
+    ready = blur();
+    if (ready || wasReady)
+    {
+        invalidate();
+    }
+}
+
+void EffectContainer::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+void EffectContainer::setupDrawChain(const Rect& invalidatedArea, Drawable** nextPreviousElement)
+{
+    if (isVisible())
+    {
+        backdrop.setupDrawChain(invalidatedArea, nextPreviousElement);
+    }
+    Container::setupDrawChain(invalidatedArea, nextPreviousElement);
+}
+
+bool EffectContainer::canRender() const
+{
+    // As for the ARGB8888 pages of CachedSwipeContainer, only while GPU2D renders
+    return HAL::DISPLAY_ROTATION == rotate0
+           && TargetHardware::canDrawInDynamicBitmap(Bitmap::ARGB8888);
+}
+
+bool EffectContainer::blur()
+{
+    if (background == 0 || blurRadius == 0)
+    {
+        return false;
+    }
+    const Rect area = getAbsoluteRect();
+    if (!canRender() || area.isEmpty() || !background->getAbsoluteRect().includes(area))
+    {
+        stats.unavailable++;
+        return false;
+    }
+
+    const Bitmap::BitmapFormat format = HAL::lcd().framebufferFormat();
+    const uint16_t width = (uint16_t)((area.width + EFFECT_CONTAINER_SCALE - 1) / EFFECT_CONTAINER_SCALE);
+    const uint16_t height = (uint16_t)((area.height + EFFECT_CONTAINER_SCALE - 1) / EFFECT_CONTAINER_SCALE);
+    if (!prepare(blurred[0], width, height, format) || !prepare(blurred[1], width, height, format))
+    {
+        stats.noMemory++;
+        return false;
+    }
+    // Only needed until it is scaled down, created after the kept bitmaps
+    BitmapId full = DynamicBitmapArena::create(area.width, area.height, format);
+    if (full == BITMAP_INVALID)
+    {
+        stats.noMemory++;
+        return false;
+    }
+    capture(full, area);
+    const bool scaled = renderPass(Pass::SCALE_DOWN, full, blurred[0], 0);
+    DynamicBitmapArena::destroy(full);
+    if (!scaled)
+    {
+        stats.unavailable++;
+        return false;
+    }
+
+    int16_t taps = (blurRadius + EFFECT_CONTAINER_SCALE / 2) / EFFECT_CONTAINER_SCALE;
+    taps = taps < 1 ? 1 : (taps > EFFECT_CONTAINER_MAX_TAPS ? EFFECT_CONTAINER_MAX_TAPS : taps);
+    uint8_t current = 0;
+    for (int p = 0; p < EFFECT_CONTAINER_PASSES; p++)
+    {
+        renderPass(Pass::HORIZONTAL, blurred[current], blurred[current ^ 1], (uint8_t)taps);
+        current ^= 1;
+        renderPass(Pass::VERTICAL, blurred[current], blurred[current ^ 1], (uint8_t)taps);
+        current ^= 1;
+    }
+    result = current;
+    stats.blurs++;
+    return true;
+}
+
+bool EffectContainer::prepare(BitmapId& bitmap, uint16_t width, uint16_t height, Bitmap::BitmapFormat format)
+{
+    if (bitmap != BITMAP_INVALID)
+    {
+        const Bitmap image(bitmap);
+        if (image.getWidth() == width && image.getHeight() == height && image.getFormat() == format)
+        {
+            return true;
+        }
+        release(bitmap);
+    }
+    bitmap = DynamicBitmapArena::create(width, height, format, &bitmapMovedCallback);
+    return bitmap != BITMAP_INVALID;
+}
+
+bool EffectContainer::renderPass(Pass::Mode mode, BitmapId source, BitmapId target, uint8_t taps)
+{
+    const Bitmap image(target);
+    pass.mode = mode;
+    pass.source = source;
+    pass.taps = taps;
+    pass.done = true;
+    pass.setPosition(0, 0, image.getWidth(), image.getHeight());
+    HAL::getInstance()->drawDrawableInDynamicBitmap(pass, target);
+    return pass.done;
+}
+
+void EffectContainer::capture(BitmapId target, const Rect& area)
+{
+    // The background is rendered at the origin of the bitmap, its children are moved so
+    // the area behind the container lands there, as CachedSwipeContainer moves its pages
+    const Rect origin = background->getAbsoluteRect();
+    const int16_t dx = origin.x - area.x;
+    const int16_t dy = origin.y - area.y;
+    for (Drawable* child = background->getFirstChild(); child != 0; child = child->getNextSibling())
+    {
+        child->setXY(child->getX() + dx, child->getY() + dy);
+    }
+    // Neither the container nor its shadow is behind itself
+    const bool visible = isVisible();
+    const bool shadowVisible = shadow.isVisible();
+    setVisible(false);
+    shadow.setVisible(false);
+    HAL::getInstance()->drawDrawableInDynamicBitmap(*background, target, Rect(0, 0, area.width, area.height));
+    setVisible(visible);
+    shadow.setVisible(shadowVisible);
+    for (Drawable* child = background->getFirstChild(); child != 0; child = child->getNextSibling())
+    {
+        child->setXY(child->getX() - dx, child->getY() - dy);
+    }
+}
+
+bool EffectContainer::computeShadow()
+{
+    release(shadowBitmap);
+    if (shadowRadius == 0 || shadowAlpha == 0 || getWidth() <= 0 || getHeight() <= 0)
+    {
+        return false;
+    }
+    const int16_t width = (int16_t)((shadow.getWidth() + EFFECT_CONTAINER_SCALE - 1) / EFFECT_CONTAINER_SCALE);
+    const int16_t height = (int16_t)((shadow.getHeight() + EFFECT_CONTAINER_SCALE - 1) / EFFECT_CONTAINER_SCALE);
+    shadowBitmap = DynamicBitmapArena::create(width, height, Bitmap::ARGB8888, &bitmapMovedCallback);
+    if (shadowBitmap == BITMAP_INVALID)
+    {
+        stats.noMemory++;
+        return false;
+    }
+
+    // A blurred rectangle is the product of the profiles of its horizontal and vertical
+    // edges, each fading over twice the radius
+    float ramp = 2.0f * shadowRadius / EFFECT_CONTAINER_SCALE;
+    ramp = ramp < 1.0f ? 1.0f : ramp;
+    const uint32_t rgb = ((uint32_t)Color::getRed(shadowColor) << 16) | ((uint32_t)Color::getGreen(shadowColor) << 8) | Color::getBlue(shadowColor);
+    uint32_t* const pixels = reinterpret_cast<uint32_t*>(Bitmap::dynamicBitmapGetAddress(shadowBitmap));
+    for (int16_t y = 0; y < height; y++)
+    {
+        const float vertical = edgeProfile(y, height, ramp) * shadowAlpha;
+        for (int16_t x = 0; x < width; x++)
+        {
+            const uint32_t alpha = (uint32_t)(vertical * edgeProfile(x, width, ramp) + 0.5f);
+            pixels[y * width + x] = (alpha << 24) | rgb;
+        }
+    }
+    TargetHardware::cleanDCache(pixels, (uint32_t)width * height * 4U);
+    stats.shadows++;
+    return true;
+}
+
+void EffectContainer::release(BitmapId& bitmap)
+{
+    if (bitmap != BITMAP_INVALID)
+    {
+        DynamicBitmapArena::destroy(bitmap);
+        bitmap = BITMAP_INVALID;
+    }
+}
+
+void EffectContainer::bitmapMoved(BitmapId oldId, BitmapId newId)
+{
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        if (blurred[i] == oldId)
+        {
+            blurred[i] = newId;
+        }
+    }
+    if (shadowBitmap == oldId)
+    {
+        shadowBitmap = newId;
+    }
+}
@@ -0,0 +1,261 @@
+#include <gui/common/FastLine.hpp>
+#include <touchgfx/Color.hpp>
+#include <touchgfx/hal/HAL.hpp>
+#include <touchgfx/lcd/LCD.hpp>
+#include <math.h>
+#include <string.h>
+
+using namespace touchgfx;
+
+namespace
+{
+/** Pixels along one axis covered the same, see spans(). */
+struct Span
+{
+    int16_t start;
+    int16_t length;
+    float coverage;
+};
+
+/**
+ * Splits the pixels from a to b into the partly covered pixel at each end and the fully
+ * covered pixels between them.
+ */
+int spans(float a, float b, Span* out)
+{
+    const int first = (int)floorf(a);
+    const int last = (int)ceilf(b) - 1;
+    if (first >= last)
+    {
+        out[0].start = (int16_t)first;
+        out[0].length = 1;
+        out[0].coverage = b - a;
+        return 1;
+    }
+    int count = 0;
+    int start = first;
+    if (a > (float)first)
+    {
+        out[count].start = (int16_t)first;
+        out[count].length = 1;
+        out[count].coverage = (float)(first + 1) - a;
+        count++;
+        start++;
+    }
+    const int end = (int)floorf(b);
+    if (end > start)
+    {
+        out[count].start = (int16_t)start;
+        out[count].length = (int16_t)(end - start);
+        out[count].coverage = 1.0f;
+        count++;
+    }
+    if (b > (float)end)
+    {
+        out[count].start = (int16_t)end;
+        out[count].length = 1;
+        out[count].coverage = b - (float)end;
+        count++;
+    }
+    return count;
+}
+
+/** Blends pixels of a single color into the locked framebuffer. */
+class PixelBlender
+{
+public:
+    PixelBlender(uint8_t* frameBuffer, const Rect& widget, const Rect& invalidatedArea, colortype color, uint8_t widgetAlpha)
+        : framebuffer(frameBuffer),
+          stride(HAL::lcd().framebufferStride()),
+          rgb565(HAL::lcd().framebufferFormat() == Bitmap::RGB565),
+          origin(widget),
+          clip(invalidatedArea),
+          red(Color::getRed(color)),
+          green(Color::getGreen(color)),
+          blue(Color::getBlue(color)),
+          alpha(widgetAlpha)
+    {
+    }
+
+    /** Blends the pixel at x, y relative to the widget with the given coverage. */
+    void blend(int16_t x, int16_t y, float coverage) const
+    {
+        const uint8_t a = (uint8_t)(coverage * alpha + 0.5f);
+        if (a == 0 || !clip.intersect(x, y))
+        {
+            return;
+        }
+        const uint8_t ia = 0xFF - a;
+        uint8_t* const pixel = framebuffer + (origin.y + y) * stride;
+        if (rgb565)
+        {
+            uint16_t* const p = reinterpret_cast<uint16_t*>(pixel) + origin.x + x;
+            const uint16_t old = *p;
+            const uint8_t r = LCD::div255((red >> 3) * a + ((old >> 11) & 0x1F) * ia);
+            const uint8_t g = LCD::div255((green >> 2) * a + ((old >> 5) & 0x3F) * ia);
+            const uint8_t b = LCD::div255((blue >> 3) * a + (old & 0x1F) * ia);
+            *p = (uint16_t)((r << 11) | (g << 5) | b);
+        }
+        else
+        {
+            // RGB888 is stored blue first
+            uint8_t* const p = pixel + (origin.x + x) * 3;
+            p[0] = LCD::div255(blue * a + p[0] * ia);
+            p[1] = LCD::div255(green * a + p[1] * ia);
+            p[2] = LCD::div255(red * a + p[2] * ia);
+        }
+    }
+
+private:
+    uint8_t* framebuffer;
+    uint16_t stride;
+    bool rgb565;
+    Rect origin;
+    Rect clip;
+    uint8_t red;
+    uint8_t green;
+    uint8_t blue;
+    uint8_t alpha;
+};
+}
+
+FastLine::Stats FastLine::stats;
+
+bool FastLine::drawCanvasWidget(const Rect& invalidatedArea) const
+{
+    float x0;
+    float y0;
+    float x1;
+    float y1;
+    getStart(x0, y0);
+    getEnd(x1, y1);
+    const float width = getLineWidth<float>();
+    const LINE_ENDING_STYLE style = getLineEndingStyle();
+    // Widget coordinates are framebuffer coordinates in rotate0 only
+    if (colorPainter == 0 || getPainter() != painter || HAL::DISPLAY_ROTATION != rotate0 || width <= 0.0f || (x0 == x1 && y0 == y1)) //lint !e777
+    {
+        stats.outlines++;
+        return Line::drawCanvasWidget(invalidatedArea);
+    }
+
+    const colortype color = colorPainter->getColor();
+    if ((x0 == x1 || y0 == y1) && style != ROUND_CAP_ENDING) //lint !e777
+    {
+        const float half = width / 2.0f;
+        const float cap = (style == SQUARE_CAP_ENDING) ? half : 0.0f;
+        if (y0 == y1) //lint !e777
+        {
+            fillCoverage(MIN(x0, x1) - cap, y0 - half, MAX(x0, x1) + cap, y0 + half, invalidatedArea, color);
+        }
+        else
+        {
+            fillCoverage(x0 - half, MIN(y0, y1) - cap, x0 + half, MAX(y0, y1) + cap, invalidatedArea, color);
+        }
+        stats.rectangles++;
+        return true;
+    }
+
+    if (width <= 1.0f && drawThin(x0, y0, x1, y1, width, invalidatedArea, color))
+    {
+        stats.thin++;
+        return true;
+    }
+    stats.outlines++;
+    return Line::drawCanvasWidget(invalidatedArea);
+}
+
+void FastLine::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+void FastLine::fillCoverage(float left, float top, float right, float bottom, const Rect& invalidatedArea, colortype color) const
+{
+    Span columns[3];
+    Span rows[3];
+    const int numColumns = spans(left, right, columns);
+    const int numRows = spans(top, bottom, rows);
+    const Rect abs = getAbsoluteRect();
+    const uint8_t widgetAlpha = getAlpha();
+    for (int row = 0; row < numRows; row++)
+    {
+        for (int column = 0; column < numColumns; column++)
+        {
+            const uint8_t alpha = (uint8_t)(columns[column].coverage * rows[row].coverage * widgetAlpha + 0.5f);
+            Rect area = Rect(columns[column].start, rows[row].start, columns[column].length, rows[row].length) & invalidatedArea;
+            if (alpha == 0 || area.isEmpty())
+            {
+                continue;
+            }
+            area.x += abs.x;
+            area.y += abs.y;
+            HAL::lcd().fillRect(area, color, alpha);
+            stats.fills++;
+        }
+    }
+}
+
+bool FastLine::drawThin(float x0, float y0, float x1, float y1, float width, const Rect& invalidatedArea, colortype color) const
+{
+    const Bitmap::BitmapFormat format = HAL::lcd().framebufferFormat();
+    if (format != Bitmap::RGB565 && format != Bitmap::RGB888)
+    {
+        return false;
+    }
+
+    // Stepped along the major axis, one column (or row) at a time
+    const bool steep = fabsf(y1 - y0) > fabsf(x1 - x0);
+    if (steep)
+    {
+        float tmp = x0;
+        x0 = y0;
+        y0 = tmp;
+        tmp = x1;
+        x1 = y1;
+        y1 = tmp;
+    }
+    if (x0 > x1)
+    {
+        float tmp = x0;
+        x0 = x1;
+        x1 = tmp;
+        tmp = y0;
+        y0 = y1;
+        y1 = tmp;
+    }
+    const float gradient = (y1 - y0) / (x1 - x0);
+    const float secant = sqrtf(1.0f + gradient * gradient);
+    // The width of the line across a column
+    const float coverage = MIN(1.0f, width * secant);
+    // Caps add half the width along the line
+    const float cap = (getLineEndingStyle() == BUTT_CAP_ENDING) ? 0.0f : width / 2.0f / secant;
+    const float a = x0 - cap;
+    const float b = x1 + cap;
+
+    uint8_t* const framebuffer = reinterpret_cast<uint8_t*>(HAL::getInstance()->lockFrameBuffer());
+    const PixelBlender blender(framebuffer, getAbsoluteRect(), invalidatedArea, color, getAlpha());
+    const int first = (int)floorf(a);
+    const int last = (int)ceilf(b) - 1;
+    for (int major = first; major <= last; major++)
+    {
+        // The part of the column inside the ends of the line
+        const float along = MIN(b, (float)(major + 1)) - MAX(a, (float)major);
+        // The line at the center of the column, relative to the pixel centers
+        const float minor = y0 + gradient * ((float)major + 0.5f - x0) - 0.5f;
+        const int pixel = (int)floorf(minor);
+        const float fraction = minor - (float)pixel;
+        const float weight = along * coverage;
+        if (steep)
+        {
+            blender.blend((int16_t)pixel, (int16_t)major, (1.0f - fraction) * weight);
+            blender.blend((int16_t)(pixel + 1), (int16_t)major, fraction * weight);
+        }
+        else
+        {
+            blender.blend((int16_t)major, (int16_t)pixel, (1.0f - fraction) * weight);
+            blender.blend((int16_t)major, (int16_t)(pixel + 1), fraction * weight);
+        }
+    }
+    HAL::getInstance()->unlockFrameBuffer();
+    return true;
+}
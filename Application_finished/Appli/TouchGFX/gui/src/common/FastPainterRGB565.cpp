@@ -0,0 +1,87 @@
+#include <gui/common/FastPainterRGB565.hpp>
+
+using namespace touchgfx;
+
+namespace
+{
+// Red and blue are 5 bits, green 6 bits, one field per 16 bit lane
+const uint32_t LANES_5 = 0x001F001FU;
+const uint32_t LANES_6 = 0x003F003FU;
+
+/** Divides both 16 bit lanes by 255, exact for lanes up to 63 * 255. */
+inline uint32_t div255Lanes(uint32_t t)
+{
+    return (t + 0x00010001U + ((t >> 8) & 0x00FF00FFU)) >> 8;
+}
+
+/** Spreads a field of two RGB565 pixels to the low bits of the two lanes. */
+inline uint32_t lanes(uint32_t pixels, int shift, uint32_t mask)
+{
+    return (pixels >> shift) & mask;
+}
+}
+
+void FastPainterRGB565::paint(uint8_t* destination, int16_t offset, int16_t widgetX, int16_t widgetY, int16_t count, uint8_t alpha) const
+{
+    if (count >= FAST_PAINTER_DMA2D_MIN_PIXELS || count <= 0)
+    {
+        PainterRGB565::paint(destination, offset, widgetX, widgetY, count, alpha);
+        return;
+    }
+
+    uint16_t* framebuffer = reinterpret_cast<uint16_t*>(destination) + offset;
+    uint16_t* const lineEnd = framebuffer + count;
+    const uint16_t color = (uint16_t)color565;
+    if (alpha == 0xFF)
+    {
+        if ((reinterpret_cast<uintptr_t>(framebuffer) & 2U) != 0)
+        {
+            *framebuffer++ = color;
+        }
+        uint32_t* words = reinterpret_cast<uint32_t*>(framebuffer);
+        const uint32_t color2 = color | ((uint32_t)color << 16);
+        while (reinterpret_cast<uint16_t*>(words + 1) <= lineEnd)
+        {
+            *words++ = color2;
+        }
+        framebuffer = reinterpret_cast<uint16_t*>(words);
+        if (framebuffer < lineEnd)
+        {
+            *framebuffer = color;
+        }
+        return;
+    }
+
+    // The color times alpha is the same for every pixel
+    const uint32_t ialpha = 0xFFU - alpha;
+    const uint32_t color2 = color | ((uint32_t)color << 16);
+    const uint32_t red = lanes(color2, 11, LANES_5) * alpha;
+    const uint32_t green = lanes(color2, 5, LANES_6) * alpha;
+    const uint32_t blue = lanes(color2, 0, LANES_5) * alpha;
+
+    if ((reinterpret_cast<uintptr_t>(framebuffer) & 2U) != 0)
+    {
+        const uint32_t pixel = *framebuffer;
+        *framebuffer++ = (uint16_t)((div255Lanes(red + lanes(pixel, 11, LANES_5) * ialpha) & LANES_5) << 11
+                                    | (div255Lanes(green + lanes(pixel, 5, LANES_6) * ialpha) & LANES_6) << 5
+                                    | (div255Lanes(blue + (pixel & LANES_5) * ialpha) & LANES_5));
+    }
+    uint32_t* words = reinterpret_cast<uint32_t*>(framebuffer);
+    while (reinterpret_cast<uint16_t*>(words + 1) <= lineEnd)
+    {
+        // Both pixels of the word at once, the lanes never carry into each other
+        const uint32_t pixels = *words;
+        const uint32_t r = div255Lanes(red + lanes(pixels, 11, LANES_5) * ialpha) & LANES_5;
+        const uint32_t g = div255Lanes(green + lanes(pixels, 5, LANES_6) * ialpha) & LANES_6;
+        const uint32_t b = div255Lanes(blue + lanes(pixels, 0, LANES_5) * ialpha) & LANES_5;
+        *words++ = (r << 11) | (g << 5) | b;
+    }
+    framebuffer = reinterpret_cast<uint16_t*>(words);
+    if (framebuffer < lineEnd)
+    {
+        const uint32_t pixel = *framebuffer;
+        *framebuffer = (uint16_t)((div255Lanes(red + lanes(pixel, 11, LANES_5) * ialpha) & LANES_5) << 11
+                                  | (div255Lanes(green + lanes(pixel, 5, LANES_6) * ialpha) & LANES_6) << 5
+                                  | (div255Lanes(blue + (pixel & LANES_5) * ialpha) & LANES_5));
+    }
+}
@@ -0,0 +1,196 @@
+#include <gui/common/FastTextureMapper.hpp>
+#include <string.h>
+#include <math.h>
+
+using namespace touchgfx;
+
+float FastTextureMapper::quarterSine[FastTextureMapper::QUARTER_STEPS + 1];
+bool FastTextureMapper::tableReady = false;
+FastTextureMapper::Stats FastTextureMapper::stats;
+
+FastTextureMapper::FastTextureMapper()
+    : TextureMapper()
+{
+    if (!tableReady)
+    {
+        for (int i = 0; i <= QUARTER_STEPS; i++)
+        {
+            quarterSine[i] = sinf((float)i * (PI / 2.0f) / (float)QUARTER_STEPS);
+        }
+        tableReady = true;
+    }
+}
+
+void FastTextureMapper::copyFrom(const TextureMapper& mapper)
+{
+    // Before the position, as setting the bitmap resizes the widget to it
+    setBitmap(mapper.getBitmap());
+    setPosition(mapper.getX(), mapper.getY(), mapper.getWidth(), mapper.getHeight());
+    setVisible(mapper.isVisible());
+    setTouchable(mapper.isTouchable());
+    setAlpha(mapper.getAlpha());
+    setRenderingAlgorithm(mapper.getRenderingAlgorithm());
+    setBitmapPosition(mapper.getBitmapPositionX(), mapper.getBitmapPositionY());
+    setCameraDistance(mapper.getCameraDistance());
+    setOrigo(mapper.getOrigoX(), mapper.getOrigoY(), mapper.getOrigoZ());
+    setCamera(mapper.getCameraX(), mapper.getCameraY());
+    setScale(mapper.getScale());
+    setAngles(mapper.getXAngle(), mapper.getYAngle(), mapper.getZAngle());
+}
+
+void FastTextureMapper::setAngles(float newXAngle, float newYAngle, float newZAngle)
+{
+    if (newXAngle != 0.0f || newYAngle != 0.0f) //lint !e777
+    {
+        stats.full++;
+        TextureMapper::setAngles(newXAngle, newYAngle, newZAngle);
+        return;
+    }
+    xAngle = newXAngle;
+    yAngle = newYAngle;
+    zAngle = newZAngle;
+    rotateAroundZ();
+}
+
+void FastTextureMapper::setScale(float newScale)
+{
+    if (xAngle != 0.0f || yAngle != 0.0f) //lint !e777
+    {
+        stats.full++;
+        TextureMapper::setScale(newScale);
+        return;
+    }
+    scale = newScale;
+    rotateAroundZ();
+}
+
+void FastTextureMapper::invalidateContent() const
+{
+    if (alpha == 0)
+    {
+        return;
+    }
+    const float xs[4] = { imageX0, imageX1, imageX2, imageX3 };
+    const float ys[4] = { imageY0, imageY1, imageY2, imageY3 };
+    const float top = MIN(MIN(ys[0], ys[1]), MIN(ys[2], ys[3]));
+    const float bottom = MAX(MAX(ys[0], ys[1]), MAX(ys[2], ys[3]));
+    const Rect widget(0, 0, getWidth(), getHeight());
+    const float bandHeight = (bottom - top) / (float)FAST_TEXTURE_MAPPER_BANDS;
+    for (int band = 0; band < FAST_TEXTURE_MAPPER_BANDS; band++)
+    {
+        const float y0 = top + bandHeight * (float)band;
+        const float y1 = (band == FAST_TEXTURE_MAPPER_BANDS - 1) ? bottom : y0 + bandHeight;
+
+        // The quad is convex: in a band, it reaches furthest at a corner inside the band or
+        // where an edge crosses the top or bottom of the band
+        float left = 32767.0f;
+        float right = -32768.0f;
+        for (int i = 0; i < 4; i++)
+        {
+            const int j = (i + 1) & 3;
+            if (ys[i] >= y0 && ys[i] <= y1)
+            {
+                left = MIN(left, xs[i]);
+                right = MAX(right, xs[i]);
+            }
+            const float edgeTop = MIN(ys[i], ys[j]);
+            const float edgeBottom = MAX(ys[i], ys[j]);
+            if (edgeBottom <= edgeTop)
+            {
+                continue;
+            }
+            for (int side = 0; side < 2; side++)
+            {
+                const float y = side == 0 ? y0 : y1;
+                if (y >= edgeTop && y <= edgeBottom)
+                {
+                    const float x = xs[i] + (xs[j] - xs[i]) * (y - ys[i]) / (ys[j] - ys[i]);
+                    left = MIN(left, x);
+                    right = MAX(right, x);
+                }
+            }
+        }
+        if (right < left)
+        {
+            continue;
+        }
+        // One pixel around, as the bounding box of TextureMapper
+        const int16_t x = (int16_t)floorf(left) - 1;
+        const int16_t y = (int16_t)floorf(y0) - 1;
+        Rect area(x, y, (int16_t)ceilf(right) + 2 - x, (int16_t)ceilf(y1) + 2 - y);
+        area &= widget;
+        if (!area.isEmpty())
+        {
+            invalidateRect(area);
+        }
+    }
+}
+
+void FastTextureMapper::sinCos(float angle, float& sine, float& cosine)
+{
+    const float steps = angle * (float)(QUARTER_STEPS * 4) / (2.0f * PI);
+    const float whole = floorf(steps);
+    const float fraction = steps - whole;
+    const int32_t step = (int32_t)whole;
+    const float s0 = sinStep(step);
+    const float s1 = sinStep(step + 1);
+    const float c0 = sinStep(step + QUARTER_STEPS);
+    const float c1 = sinStep(step + QUARTER_STEPS + 1);
+    sine = s0 + (s1 - s0) * fraction;
+    cosine = c0 + (c1 - c0) * fraction;
+}
+
+void FastTextureMapper::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+void FastTextureMapper::rotateAroundZ()
+{
+    stats.fast++;
+
+    // As TextureMapper::applyTransformation(), the corners are one pixel outside the bitmap
+    const float left = xBitmapPosition - 1.0f - xOrigo;
+    const float top = yBitmapPosition - 1.0f - yOrigo;
+    const float right = left + (float)(Bitmap(bitmap).getWidth() + 1);
+    const float bottom = top + (float)(Bitmap(bitmap).getHeight() + 1);
+
+    float sine;
+    float cosine;
+    sinCos(zAngle, sine, cosine);
+    sine *= scale;
+    cosine *= scale;
+
+    // All corners are at the depth of the bitmap, so the perspective is one factor
+    const float z = (cameraDistance - zOrigo) * scale + zOrigo;
+    const float perspective = cameraDistance / z;
+    const float xCenter = xOrigo - xCamera;
+    const float yCenter = yOrigo - yCamera;
+
+    imageX0 = (xCenter + left * cosine - top * sine) * perspective + xCamera;
+    imageY0 = (yCenter + left * sine + top * cosine) * perspective + yCamera;
+    imageX1 = (xCenter + right * cosine - top * sine) * perspective + xCamera;
+    imageY1 = (yCenter + right * sine + top * cosine) * perspective + yCamera;
+    imageX2 = (xCenter + right * cosine - bottom * sine) * perspective + xCamera;
+    imageY2 = (yCenter + right * sine + bottom * cosine) * perspective + yCamera;
+    imageX3 = (xCenter + left * cosine - bottom * sine) * perspective + xCamera;
+    imageY3 = (yCenter + left * sine + bottom * cosine) * perspective + yCamera;
+    imageZ0 = imageZ1 = imageZ2 = imageZ3 = z;
+}
+
+float FastTextureMapper::sinStep(int32_t step)
+{
+    const int32_t index = step & (QUARTER_STEPS * 4 - 1);
+    const int32_t offset = index & (QUARTER_STEPS - 1);
+    switch (index / QUARTER_STEPS)
+    {
+    case 0:
+        return quarterSine[offset];
+    case 1:
+        return quarterSine[QUARTER_STEPS - offset];
+    case 2:
+        return -quarterSine[offset];
+    default:
+        return -quarterSine[QUARTER_STEPS - offset];
+    }
+}
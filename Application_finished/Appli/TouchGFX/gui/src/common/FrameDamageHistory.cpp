@@ -0,0 +1,123 @@
+#include <gui/common/FrameDamageHistory.hpp>
+#include <gui/common/DirtyAreaCoalescer.hpp>
+#include <gui/common/TargetHardware.hpp>
+#include <touchgfx/hal/HAL.hpp>
+#include <string.h>
+
+using namespace touchgfx;
+
+FrameDamageHistory::FrameDamageHistory()
+{
+    for (int i = 0; i < FRAME_DAMAGE_HISTORY; i++)
+    {
+        damageFrame[i] = 0;
+    }
+    resetStats();
+}
+
+void FrameDamageHistory::getStaleAreas(uint32_t frame, uint8_t age, const Rect& bounds, Vector<Rect, 8>& stale) const
+{
+    stale.clear();
+    for (uint32_t missed = 1; missed < age; missed++)
+    {
+        const uint32_t f = frame - missed;
+        const int slot = f % FRAME_DAMAGE_HISTORY;
+        if (f == 0 || f > frame || damageFrame[slot] != f)
+        {
+            // Older than the history
+            age = 0;
+            break;
+        }
+        for (uint16_t i = 0; i < damage[slot].size(); i++)
+        {
+            DirtyAreaCoalescer::add(stale, damage[slot][i]);
+        }
+    }
+    if (age == 0)
+    {
+        stale.clear();
+        stale.add(bounds);
+    }
+}
+
+void FrameDamageHistory::skipUnchangedTiles(Vector<Rect, 8>& stale)
+{
+    const int16_t size = TargetHardware::getTileSize();
+    if (size == 0)
+    {
+        return;
+    }
+    Vector<Rect, 8> changed;
+    for (uint16_t i = 0; i < stale.size(); i++)
+    {
+        const Rect& area = stale[i];
+        Rect kept;
+        for (int16_t row = area.y / size; row * size < area.bottom(); row++)
+        {
+            for (int16_t column = area.x / size; column * size < area.right(); column++)
+            {
+                if (TargetHardware::isTileUnchanged(column, row))
+                {
+                    stats.unchanged++;
+                    continue;
+                }
+                kept.expandToFit(Rect(column * size, row * size, size, size) & area);
+            }
+        }
+        if (kept.isEmpty())
+        {
+            stats.skipped++;
+            continue;
+        }
+        DirtyAreaCoalescer::add(changed, kept);
+    }
+    stale = changed;
+}
+
+void FrameDamageHistory::update(const Vector<Rect, 8>& stale, const Vector<Rect, 8>& dirtyAreas, const Vector<Rect, 8>& movedAreas, Vector<Rect, 8>& redrawAreas)
+{
+    for (uint16_t i = 0; i < stale.size(); i++)
+    {
+        const Rect& area = stale[i];
+        bool covered = false;
+        for (uint16_t j = 0; j < dirtyAreas.size() && !covered; j++)
+        {
+            covered = dirtyAreas[j].includes(area);
+        }
+        if (covered)
+        {
+            stats.covered++;
+            continue;
+        }
+        // An unmoved copy would undo a scroll copy, those are drawn
+        bool moved = false;
+        for (uint16_t j = 0; j < movedAreas.size() && !moved; j++)
+        {
+            moved = movedAreas[j].intersect(area);
+        }
+        if (!moved && TargetHardware::copyPreviousFrame(area, 0, 0))
+        {
+            stats.copied++;
+            stats.copiedPixels += area.area();
+            continue;
+        }
+        DirtyAreaCoalescer::add(redrawAreas, area);
+        stats.redrawn++;
+    }
+}
+
+void FrameDamageHistory::add(uint32_t frame, const Vector<Rect, 8>& dirtyAreas, const Vector<Rect, 8>& movedAreas)
+{
+    const int slot = frame % FRAME_DAMAGE_HISTORY;
+    damage[slot] = dirtyAreas;
+    for (uint16_t i = 0; i < movedAreas.size(); i++)
+    {
+        DirtyAreaCoalescer::add(damage[slot], movedAreas[i]);
+    }
+    damageFrame[slot] = frame;
+}
+
+void FrameDamageHistory::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
@@ -1,7 +1,201 @@
 #include <gui/common/FrontendApplication.hpp>
+#include <gui/common/BlitScrollableContainer.hpp>
+#include <gui/common/CanvasBufferPool.hpp>
+#include <gui/common/DirtyAreaCoalescer.hpp>
+#include <gui/common/DirtyRegion.hpp>
+#include <gui/common/DynamicBitmapArena.hpp>
+#include <gui/common/FrameDamageHistory.hpp>
+#include <gui/common/FrontendHeap.hpp>
+#include <gui/common/RetainedDrawList.hpp>
+#include <gui/common/TargetHardware.hpp>
+#include <touchgfx/transitions/NoTransition.hpp>
+#include <touchgfx/hal/HAL.hpp>
+
+namespace
+{
+uint32_t bitmapArenaFragmentation(const void* /*context*/)
+{
+    return DynamicBitmapArena::getFragmentation();
+}
+
+uint32_t bitmapArenaLargestFree(const void* /*context*/)
+{
+    return DynamicBitmapArena::getStats().largestFree;
+}
+}
 
 FrontendApplication::FrontendApplication(Model& m, FrontendHeap& heap)
-    : FrontendApplicationBase(m, heap)
+    : FrontendApplicationBase(m, heap), dragPending(false), dragFromX(0), dragFromY(0), dragToX(0), dragToY(0),
+      soakSceneCallback(this, &FrontendApplication::nextSoakScene), soakScenes(0)
 {
+    CanvasBufferPool::init();
+    TargetHardware::addSoakChannel("bitmap_frag_permille", bitmapArenaFragmentation, 0, true);
+    TargetHardware::addSoakChannel("bitmap_largest_free", bitmapArenaLargestFree, 0, false);
+    TargetHardware::setSoakSceneCallback(&soakSceneCallback);
+#if DISPLAY_PORTRAIT
+    // Replaces the orientation of the generated base, taken at the first transition
+    HAL::getInstance()->setDisplayOrientation(ORIENTATION_PORTRAIT);
+#endif
+#if DIRTY_REGION_ENGINE
+    dirtyRegion.setBounds(Rect(0, 0, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT));
+#endif
+}
 
+#if DIRTY_REGION_ENGINE
+void FrontendApplication::invalidateArea(Rect area)
+{
+    dirtyRegion.add(area);
+}
+#endif
+
+void FrontendApplication::gotoScreen1ScreenWarm()
+{
+#if WARM_SCREENS
+    warmTransitionCallback = Callback<FrontendApplication>(this, &FrontendApplication::gotoScreen1ScreenWarmImpl);
+    pendingScreenTransitionCallback = &warmTransitionCallback;
+#else
+    gotoScreen1ScreenNoTransition();
+#endif
+}
+
+void FrontendApplication::gotoScreen1ScreenWarmImpl()
+{
+    warmScreens.makeTransition<Screen1View, Screen1Presenter, NoTransition, Model>(&currentScreen, &currentPresenter, frontendHeap, &currentTransition, &model);
+}
+
+void FrontendApplication::nextSoakScene()
+{
+    // A warm screen keeps its bitmaps and buffers, a new one allocates them again
+    if ((soakScenes++ & 1U) == 0)
+    {
+        gotoScreen1ScreenWarm();
+    }
+    else
+    {
+        gotoScreen1ScreenNoTransition();
+    }
+}
+
+void FrontendApplication::handlePendingScreenTransition()
+{
+    if (pendingScreenTransitionCallback && pendingScreenTransitionCallback->isValid())
+    {
+        timerRegistry.clear();
+        animationScheduler.clear();
+        progressivePaint.clear();
+#if WARM_SCREENS
+        warmScreens.park(&currentScreen, &currentPresenter, &currentTransition);
+#endif
+    }
+    FrontendApplicationBase::handlePendingScreenTransition();
+#if DIRTY_REGION_ENGINE
+    if (dirtyRegion.getBounds().width != HAL::DISPLAY_WIDTH)
+    {
+        dirtyRegion.setBounds(Rect(0, 0, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT));
+    }
+#endif
+}
+
+void FrontendApplication::handleClickEvent(const ClickEvent& event)
+{
+    deliverDrag();
+    FrontendApplicationBase::handleClickEvent(event);
+}
+
+void FrontendApplication::handleDragEvent(const DragEvent& event)
+{
+    if (!dragPending)
+    {
+        dragFromX = event.getOldX();
+        dragFromY = event.getOldY();
+        dragPending = true;
+    }
+    dragToX = event.getNewX();
+    dragToY = event.getNewY();
+}
+
+void FrontendApplication::handleGestureEvent(const GestureEvent& event)
+{
+    deliverDrag();
+    FrontendApplicationBase::handleGestureEvent(event);
+}
+
+void FrontendApplication::deliverDrag()
+{
+    if (!dragPending)
+    {
+        return;
+    }
+    dragPending = false;
+    // Drags that came back to where they started move nothing
+    if (dragFromX != dragToX || dragFromY != dragToY)
+    {
+        FrontendApplicationBase::handleDragEvent(DragEvent(DragEvent::DRAGGED, dragFromX, dragFromY, dragToX, dragToY));
+    }
+}
+
+void FrontendApplication::drawCachedAreas()
+{
+    // The drag of this tick changes what is drawn, even in a skipped frame
+    deliverDrag();
+    // Bitmaps copied into the bitmap cache in beginFrame() were uploaded during the ticks
+    TargetHardware::waitForAssetUploads();
+    if (TargetHardware::isFrameSkipped())
+    {
+        return;
+    }
+    // Application would pass the requested redraw to invalidateArea() after the areas are taken
+    if (!redraw.isEmpty())
+    {
+        invalidateArea(redraw);
+        redraw = Rect();
+    }
+#if DIRTY_REGION_ENGINE
+    dirtyRegion.takeAreas(cachedDirtyAreas);
+#else
+    DirtyAreaCoalescer::coalesce(cachedDirtyAreas, Rect(0, 0, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT));
+#endif
+    // Scrolled viewports are copied from the latest frame before anything is drawn
+    Vector<Rect, 8> movedAreas;
+    if (!TargetHardware::tracksFrameBufferAge())
+    {
+        BlitScrollableContainer::blitPendingScrolls(cachedDirtyAreas, lastRects, movedAreas);
+    }
+    else
+    {
+        // The damage of the frames the framebuffer missed replaces the previous dirty areas
+        lastRects.clear();
+        const uint32_t frame = TargetHardware::getFrameNumber();
+        Vector<Rect, 8> staleAreas;
+        damageHistory.getStaleAreas(frame, TargetHardware::getClientFrameBufferAge(), Rect(0, 0, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT), staleAreas);
+        damageHistory.skipUnchangedTiles(staleAreas);
+        BlitScrollableContainer::blitPendingScrolls(cachedDirtyAreas, staleAreas, movedAreas);
+        if (!cachedDirtyAreas.isEmpty() || !movedAreas.isEmpty())
+        {
+            // Brought up to date only for a frame that is drawn, which completes it
+            damageHistory.update(staleAreas, cachedDirtyAreas, movedAreas, lastRects);
+            damageHistory.add(frame, cachedDirtyAreas, movedAreas);
+        }
+    }
+#if DIRTY_REGION_ENGINE
+    if (!cachedDirtyAreas.isEmpty())
+    {
+        dirtyRegion.countRedrawn(cachedDirtyAreas);
+        dirtyRegion.countRedrawn(lastRects);
+    }
+#endif
+    if (cachedDirtyAreas.isEmpty() && lastRects.isEmpty())
+    {
+        // Nothing is drawn, so no bitmap is in use
+        DynamicBitmapArena::compact();
+        // The frame is free for the assets of the screen likely entered next
+        navigationPrefetch.idle();
+    }
+    // Widget trees changed since the previous frame are linked again
+    RetainedDrawList::frameStarted();
+    FrontendApplicationBase::drawCachedAreas();
+#if DIRTY_REGION_ENGINE
+    // Like Application, which clears its areas once drawn
+    dirtyRegion.clear();
+#endif
 }
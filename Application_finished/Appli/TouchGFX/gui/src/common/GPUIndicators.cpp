@@ -0,0 +1,293 @@
+#include <gui/common/FastTextureMapper.hpp>
+#include <gui/common/GPUIndicators.hpp>
+
+using namespace touchgfx;
+
+namespace
+{
+/** Makes a VectorCircle draw what a Circle would. */
+void copyCircle(const Circle& from, VectorCircle& to)
+{
+    CWRUtil::Q5 x;
+    CWRUtil::Q5 y;
+    CWRUtil::Q5 value;
+    CWRUtil::Q5 end;
+    to.setPosition(from.getX(), from.getY(), from.getWidth(), from.getHeight());
+    from.getCenter(x, y);
+    to.setCenter(x, y);
+    from.getRadius(value);
+    to.setRadius(value);
+    from.getLineWidth(value);
+    to.setLineWidth(value);
+    from.getArc(value, end);
+    to.setArc(value, end);
+    to.setCapPrecision(from.getCapPrecision());
+    to.setAlpha(from.getAlpha());
+    to.setVisible(from.isVisible());
+    to.invalidate();
+}
+} // namespace
+
+GPUNeedle::GPUNeedle()
+    : TextureMapperBatch<1>(),
+      offsetX(0.0f),
+      offsetY(0.0f),
+      pivotX(0),
+      pivotY(0),
+      angle(0.0f)
+{
+    setRenderingAlgorithm(TextureMapper::BILINEAR_INTERPOLATION);
+}
+
+void GPUNeedle::setNeedle(const Bitmap& bitmap, int16_t x, int16_t y)
+{
+    setBitmap(bitmap);
+    setNumberOfSprites(bitmap.getId() != BITMAP_INVALID ? 1 : 0);
+    offsetX = (float)bitmap.getWidth() / 2.0f - x;
+    offsetY = (float)bitmap.getHeight() / 2.0f - y;
+    place(false);
+}
+
+void GPUNeedle::setPivot(int16_t x, int16_t y)
+{
+    pivotX = x;
+    pivotY = y;
+    place(false);
+}
+
+void GPUNeedle::updateAngle(float radians)
+{
+    if (radians != angle)
+    {
+        angle = radians;
+        place(true);
+    }
+}
+
+void GPUNeedle::place(bool invalidating)
+{
+    // The center of the bitmap turns around the pivot with the needle
+    float sine;
+    float cosine;
+    FastTextureMapper::sinCos(angle, sine, cosine);
+    const float x = pivotX + offsetX * cosine - offsetY * sine;
+    const float y = pivotY + offsetX * sine + offsetY * cosine;
+    if (invalidating)
+    {
+        updateSprite(0, x, y, angle, 1.0f);
+    }
+    else
+    {
+        setSprite(0, x, y, angle, 1.0f);
+    }
+}
+
+GPUGauge::GPUGauge()
+    : Gauge(), gpuNeedle(), vectorArc()
+{
+    // The framework widgets set the values, the GPU2D widgets draw them
+    Gauge::remove(arc);
+    Gauge::remove(needle);
+    vectorArc.setVisible(false);
+    Gauge::add(vectorArc);
+    Gauge::add(gpuNeedle);
+}
+
+void GPUGauge::setNeedle(const BitmapId bitmapId, int16_t rotationCenterX, int16_t rotationCenterY)
+{
+    Gauge::setNeedle(bitmapId, rotationCenterX, rotationCenterY);
+    gpuNeedle.setNeedle(Bitmap(bitmapId), rotationCenterX, rotationCenterY);
+    gpuNeedle.invalidate();
+}
+
+void GPUGauge::setArcPosition(int16_t x, int16_t y, int16_t width, int16_t height)
+{
+    Gauge::setArcPosition(x, y, width, height);
+    syncArc();
+}
+
+void GPUGauge::setArcVisible(bool show)
+{
+    Gauge::setArcVisible(show);
+    syncArc();
+}
+
+void GPUGauge::setWidth(int16_t width)
+{
+    Gauge::setWidth(width);
+    gpuNeedle.setWidth(width);
+}
+
+void GPUGauge::setHeight(int16_t height)
+{
+    Gauge::setHeight(height);
+    gpuNeedle.setHeight(height);
+}
+
+void GPUGauge::setCenter(int x, int y)
+{
+    Gauge::setCenter(x, y);
+    gpuNeedle.setPivot(x, y);
+    gpuNeedle.invalidate();
+    syncArc();
+}
+
+void GPUGauge::setStartEndAngle(int startAngle, int endAngle)
+{
+    Gauge::setStartEndAngle(startAngle, endAngle);
+    syncArc();
+    // Gauge::setStartEndAngle() sets the value of the Gauge only
+    GPUGauge::setValue(getValue());
+}
+
+void GPUGauge::setValue(int value)
+{
+    Gauge::setValue(value);
+    gpuNeedle.setRenderingAlgorithm(animationStep >= animationDuration ? algorithmSteady : algorithmMoving);
+    gpuNeedle.updateAngle(needle.getZAngle());
+    CWRUtil::Q5 end;
+    arc.getArcEnd(end);
+    vectorArc.updateArcEnd(end);
+}
+
+void GPUGauge::setAlpha(uint8_t newAlpha)
+{
+    Gauge::setAlpha(newAlpha);
+    gpuNeedle.setAlpha(newAlpha);
+    vectorArc.setAlpha(newAlpha);
+    invalidate();
+}
+
+void GPUGauge::syncArc()
+{
+    copyCircle(arc, vectorArc);
+}
+
+GPUCircleProgress::GPUCircleProgress()
+    : CircleProgress(), vectorCircle()
+{
+    progressIndicatorContainer.remove(circle);
+    progressIndicatorContainer.add(vectorCircle);
+    syncCircle();
+}
+
+void GPUCircleProgress::setProgressIndicatorPosition(int16_t x, int16_t y, int16_t width, int16_t height)
+{
+    CircleProgress::setProgressIndicatorPosition(x, y, width, height);
+    syncCircle();
+}
+
+void GPUCircleProgress::setPainter(AbstractPainter& painter)
+{
+    CircleProgress::setPainter(painter);
+    vectorCircle.setPainter(painter);
+}
+
+void GPUCircleProgress::setCenter(int x, int y)
+{
+    CircleProgress::setCenter(x, y);
+    syncCircle();
+}
+
+void GPUCircleProgress::setRadius(int r)
+{
+    CircleProgress::setRadius(r);
+    syncCircle();
+}
+
+void GPUCircleProgress::setLineWidth(int width)
+{
+    CircleProgress::setLineWidth(width);
+    syncCircle();
+}
+
+void GPUCircleProgress::setCapPrecision(int precision)
+{
+    CircleProgress::setCapPrecision(precision);
+    syncCircle();
+}
+
+void GPUCircleProgress::setStartEndAngle(int startAngle, int endAngle)
+{
+    CircleProgress::setStartEndAngle(startAngle, endAngle);
+    syncCircle();
+}
+
+void GPUCircleProgress::setAlpha(uint8_t newAlpha)
+{
+    CircleProgress::setAlpha(newAlpha);
+    vectorCircle.setAlpha(newAlpha);
+    vectorCircle.invalidate();
+}
+
+void GPUCircleProgress::setValue(int value)
+{
+    CircleProgress::setValue(value);
+    // Invalidates the sector between the old and the new end
+    CWRUtil::Q5 end;
+    circle.getArcEnd(end);
+    vectorCircle.updateArcEnd(end);
+}
+
+void GPUCircleProgress::syncCircle()
+{
+    copyCircle(circle, vectorCircle);
+}
+
+GPUAnalogClock::GPUAnalogClock()
+    : AnalogClock(), hourNeedle(), minuteNeedle(), secondNeedle(), timer()
+{
+}
+
+void GPUAnalogClock::setAlpha(uint8_t newAlpha)
+{
+    AnalogClock::setAlpha(newAlpha);
+    hourNeedle.setAlpha(newAlpha);
+    minuteNeedle.setAlpha(newAlpha);
+    secondNeedle.setAlpha(newAlpha);
+    invalidate();
+}
+
+void GPUAnalogClock::handleTickEvent()
+{
+    syncHands();
+    if (!hourHand.isTextureMapperAnimationRunning() && !minuteHand.isTextureMapperAnimationRunning() && !secondHand.isTextureMapperAnimationRunning())
+    {
+        timer.stop();
+    }
+}
+
+void GPUAnalogClock::updateClock()
+{
+    AnalogClock::updateClock();
+    syncHands();
+    if (animationEnabled())
+    {
+        // The hands animate in their own ticks, followed until they stop
+        timer.start(*this);
+    }
+}
+
+void GPUAnalogClock::setupHand(TextureMapper& hand, const BitmapId bitmapId, int16_t rotationCenterX, int16_t rotationCenterY)
+{
+    AnalogClock::setupHand(hand, bitmapId, rotationCenterX, rotationCenterY);
+    // The hand keeps its angle out of the widget tree
+    remove(hand);
+    GPUNeedle& needle = (&hand == &hourHand) ? hourNeedle : ((&hand == &minuteHand) ? minuteNeedle : secondNeedle);
+    remove(needle);
+    needle.setPosition(0, 0, getWidth(), getHeight());
+    needle.setNeedle(Bitmap(bitmapId), rotationCenterX, rotationCenterY);
+    needle.setPivot(clockRotationCenterX, clockRotationCenterY);
+    needle.setAlpha(getAlpha());
+    needle.updateAngle(hand.getZAngle());
+    // The hands are drawn hour, minute, second from the bottom, as they were set up
+    add(needle);
+    needle.invalidate();
+}
+
+void GPUAnalogClock::syncHands()
+{
+    hourNeedle.updateAngle(hourHand.getZAngle());
+    minuteNeedle.updateAngle(minuteHand.getZAngle());
+    secondNeedle.updateAngle(secondHand.getZAngle());
+}
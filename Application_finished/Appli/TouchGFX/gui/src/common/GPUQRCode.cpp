@@ -0,0 +1,172 @@
+#include <gui/common/GPUQRCode.hpp>
+#include <gui/common/TargetHardware.hpp>
+#include <touchgfx/hal/HAL.hpp>
+#include <touchgfx/widgets/utils/qrcodegen.hpp>
+#include <string.h>
+
+using namespace touchgfx;
+
+GPUQRCode::Stats GPUQRCode::stats;
+
+GPUQRCode::GPUQRCode()
+    : QRCode(),
+      bitmapMovedCallback(this, &GPUQRCode::bitmapMoved),
+      modules(BITMAP_INVALID),
+      symbol(0),
+      payloadLength(0),
+      encoded(false),
+      binaryPayload(false),
+      dark(0x0000),
+      light(0xFFFF)
+{
+}
+
+GPUQRCode::~GPUQRCode()
+{
+    release();
+}
+
+void GPUQRCode::setBuffers(uint8_t* qrBuffer, uint8_t* tempBuffer)
+{
+    QRCode::setBuffers(qrBuffer, tempBuffer);
+    symbol = qrBuffer;
+    encoded = false;
+    release();
+}
+
+bool GPUQRCode::convertStringToQRCode(const char* text)
+{
+    return convert(text, text != 0 ? strlen(text) : 0, false);
+}
+
+bool GPUQRCode::convertBinaryDataToQRCode(const uint8_t* data, size_t length)
+{
+    return convert(data, length, true);
+}
+
+void GPUQRCode::setQRCodeVersion(uint8_t version)
+{
+    QRCode::setQRCodeVersion(version);
+    encoded = false;
+    release();
+}
+
+void GPUQRCode::setErrorCorrectionLevel(ECCLevel level)
+{
+    QRCode::setErrorCorrectionLevel(level);
+    encoded = false;
+}
+
+void GPUQRCode::setColors(colortype colorBlack, colortype colorWhite)
+{
+    QRCode::setColors(colorBlack, colorWhite);
+    dark = ((colorBlack >> 8) & 0xF800) | ((colorBlack >> 5) & 0x07E0) | ((colorBlack >> 3) & 0x001F);
+    light = ((colorWhite >> 8) & 0xF800) | ((colorWhite >> 5) & 0x07E0) | ((colorWhite >> 3) & 0x001F);
+    if (modules != BITMAP_INVALID)
+    {
+        writeModules();
+    }
+}
+
+void GPUQRCode::draw(const Rect& invalidatedArea) const
+{
+    if (modules != BITMAP_INVALID)
+    {
+        // Every module is a square of pixels with nearest neighbour sampling
+        Rect dest(0, 0, getWidth(), getHeight());
+        translateRectToAbsolute(dest);
+        Rect clip = invalidatedArea;
+        translateRectToAbsolute(clip);
+        if (TargetHardware::drawScaledBitmap(Bitmap(modules), dest, clip, getAlpha(), false))
+        {
+            stats.blits++;
+            return;
+        }
+    }
+    QRCode::draw(invalidatedArea);
+}
+
+void GPUQRCode::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+bool GPUQRCode::convert(const void* data, size_t length, bool binary)
+{
+    if (encoded && binary == binaryPayload && length == payloadLength && memcmp(data, payload, length) == 0)
+    {
+        stats.unchanged++;
+        return true;
+    }
+
+    const bool ok = binary ? QRCode::convertBinaryDataToQRCode(static_cast<const uint8_t*>(data), length)
+                           : QRCode::convertStringToQRCode(static_cast<const char*>(data));
+    // A payload too long to keep is encoded every time
+    encoded = ok && length <= GPU_QRCODE_PAYLOAD_BYTES;
+    if (encoded)
+    {
+        memcpy(payload, data, length);
+        payloadLength = length;
+        binaryPayload = binary;
+    }
+    if (ok)
+    {
+        stats.encoded++;
+        writeModules();
+    }
+    else
+    {
+        // The symbol was cleared, QRCode draws nothing
+        release();
+    }
+    return ok;
+}
+
+void GPUQRCode::writeModules()
+{
+    if (symbol == 0 || symbol[0] == 0)
+    {
+        release();
+        return;
+    }
+    const int size = qrcodegen_getSize(symbol);
+    if (modules != BITMAP_INVALID && Bitmap(modules).getWidth() != size)
+    {
+        release();
+    }
+    if (modules == BITMAP_INVALID)
+    {
+        modules = DynamicBitmapArena::create(size, size, Bitmap::RGB565, &bitmapMovedCallback);
+        if (modules == BITMAP_INVALID)
+        {
+            stats.noMemory++;
+            return;
+        }
+    }
+
+    uint16_t* const pixels = reinterpret_cast<uint16_t*>(Bitmap::dynamicBitmapGetAddress(modules));
+    uint16_t* pixel = pixels;
+    for (int y = 0; y < size; y++)
+    {
+        for (int x = 0; x < size; x++)
+        {
+            *pixel++ = qrcodegen_getModule(symbol, x, y) ? dark : light;
+        }
+    }
+    // GPU2D reads the bitmap from memory
+    TargetHardware::cleanDCache(pixels, (uint32_t)size * size * 2);
+}
+
+void GPUQRCode::release()
+{
+    if (modules != BITMAP_INVALID)
+    {
+        DynamicBitmapArena::destroy(modules);
+        modules = BITMAP_INVALID;
+    }
+}
+
+void GPUQRCode::bitmapMoved(BitmapId /*oldId*/, BitmapId newId)
+{
+    modules = newId;
+}
@@ -0,0 +1,66 @@
+#include <gui/common/GPUScalableImage.hpp>
+#include <gui/common/TargetHardware.hpp>
+#include <touchgfx/hal/HAL.hpp>
+
+using namespace touchgfx;
+
+GPUScalableImage::GPUScalableImage(const Bitmap& bmp)
+    : ScalableImage(bmp)
+{
+}
+
+void GPUScalableImage::draw(const Rect& invalidatedArea) const
+{
+    Rect dest(0, 0, getWidth(), getHeight());
+    translateRectToAbsolute(dest);
+    Rect clip = invalidatedArea;
+    translateRectToAbsolute(clip);
+    if (TargetHardware::drawScaledBitmap(bitmap, dest, clip, alpha, currentScalingAlgorithm == BILINEAR_INTERPOLATION))
+    {
+        return;
+    }
+    ScalableImage::draw(invalidatedArea);
+}
+
+GPUZoomAnimationImage::GPUZoomAnimationImage()
+    : ZoomAnimationImage(),
+      gpuImage(),
+      continuousZoom(false)
+{
+    gpuImage.setVisible(false);
+    add(gpuImage);
+}
+
+void GPUZoomAnimationImage::setContinuousZoom(bool continuous)
+{
+    continuousZoom = continuous;
+    updateRenderingMethod();
+}
+
+void GPUZoomAnimationImage::setScalingMode(ScalableImage::ScalingAlgorithm mode)
+{
+    ZoomAnimationImage::setScalingMode(mode);
+    gpuImage.setScalingAlgorithm(mode);
+}
+
+void GPUZoomAnimationImage::setAlpha(uint8_t newAlpha)
+{
+    ZoomAnimationImage::setAlpha(newAlpha);
+    gpuImage.setAlpha(newAlpha);
+}
+
+void GPUZoomAnimationImage::updateRenderingMethod()
+{
+    if (!continuousZoom)
+    {
+        gpuImage.setVisible(false);
+        ZoomAnimationImage::updateRenderingMethod();
+        return;
+    }
+    image.setVisible(false);
+    scalableImage.setVisible(false);
+    gpuImage.setBitmap(largeBmp); // Updates width and height
+    gpuImage.setWidthHeight(*this);
+    gpuImage.setVisible(true);
+    Container::invalidate();
+}
@@ -0,0 +1,30 @@
+#include <gui/common/GPUTiledImage.hpp>
+#include <gui/common/TargetHardware.hpp>
+#include <touchgfx/hal/HAL.hpp>
+
+using namespace touchgfx;
+
+GPUTiledImage::GPUTiledImage(const Bitmap& bmp)
+    : TiledImage(bmp)
+{
+}
+
+void GPUTiledImage::scroll(int16_t dx, int16_t dy)
+{
+    // The offset is the pixel of the bitmap at the top left corner, normalized by TiledImage
+    setOffset(xOffset - dx, yOffset - dy);
+    invalidate();
+}
+
+void GPUTiledImage::draw(const Rect& invalidatedArea) const
+{
+    Rect origin(0, 0, 0, 0);
+    translateRectToAbsolute(origin);
+    Rect clip = invalidatedArea;
+    translateRectToAbsolute(clip);
+    if (TargetHardware::drawTiledBitmap(bitmap, origin.x, origin.y, xOffset, yOffset, clip, alpha))
+    {
+        return;
+    }
+    TiledImage::draw(invalidatedArea);
+}
@@ -0,0 +1,140 @@
+#include <gui/common/GradientCache.hpp>
+#include <gui/common/TargetHardware.hpp>
+#include <string.h>
+
+using namespace touchgfx;
+
+GradientCache::Entry GradientCache::entries[GRADIENT_CACHE_RAMPS];
+uint32_t GradientCache::ramps[GRADIENT_CACHE_RAMPS][RAMP_SIZE];
+uint32_t GradientCache::clock = 0;
+GradientCache::Stats GradientCache::stats;
+
+const uint32_t* GradientCache::getRamp(uint32_t stops, const float* stopPositions, const uint32_t* stopColors, bool& solid)
+{
+    if (stops == 0 || stops > GRADIENT_CACHE_STOPS)
+    {
+        return 0;
+    }
+    clock++;
+    const uint16_t step = TargetHardware::getGradientStep();
+
+    uint16_t oldest = 0;
+    for (uint16_t i = 0; i < GRADIENT_CACHE_RAMPS; i++)
+    {
+        Entry& entry = entries[i];
+        if (entry.stops == stops
+            && memcmp(entry.positions, stopPositions, stops * sizeof(float)) == 0
+            && memcmp(entry.colors, stopColors, stops * sizeof(uint32_t)) == 0)
+        {
+            entry.lastUsed = clock;
+            solid = entry.solid;
+            if (entry.step > step)
+            {
+                // Computed coarser while the frames were heavy
+                entry.step = step;
+                build(ramps[i], stops, stopPositions, stopColors, step);
+                stats.builds++;
+                return ramps[i];
+            }
+            stats.hits++;
+            return ramps[i];
+        }
+        if (entry.lastUsed < entries[oldest].lastUsed)
+        {
+            oldest = i;
+        }
+    }
+
+    Entry& entry = entries[oldest];
+    if (entry.stops != 0)
+    {
+        stats.evicted++;
+    }
+    entry.stops = stops;
+    memcpy(entry.positions, stopPositions, stops * sizeof(float));
+    memcpy(entry.colors, stopColors, stops * sizeof(uint32_t));
+    entry.lastUsed = clock;
+    entry.step = step;
+    entry.solid = true;
+    for (uint32_t i = 0; i < stops; i++)
+    {
+        entry.solid = entry.solid && (stopColors[i] >> 24) == 0xFF;
+    }
+    build(ramps[oldest], stops, stopPositions, stopColors, step);
+    stats.builds++;
+    solid = entry.solid;
+    return ramps[oldest];
+}
+
+bool GradientCache::setGradient(AbstractPainterLinearGradient& painter, uint32_t stops, const float* stopPositions, const uint32_t* stopColors)
+{
+    bool solid;
+    const uint32_t* const ramp = getRamp(stops, stopPositions, stopColors, solid);
+    if (ramp == 0)
+    {
+        return false;
+    }
+    painter.setGradientTexture(ramp, solid);
+    return true;
+}
+
+bool GradientCache::setLinearGradient(VectorRenderer& renderer, float x0, float y0, float x1, float y1, uint32_t stops, const float* stopPositions, const uint32_t* stopColors, float width, float height)
+{
+    bool solid;
+    const uint32_t* const ramp = getRamp(stops, stopPositions, stopColors, solid);
+    if (ramp == 0)
+    {
+        return false;
+    }
+    renderer.setLinearGradient(x0, y0, x1, y1, stops, stopPositions, stopColors, width, height, solid, ramp);
+    return true;
+}
+
+void GradientCache::clear()
+{
+    memset(entries, 0, sizeof(entries));
+}
+
+void GradientCache::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+void GradientCache::build(uint32_t* ramp, uint32_t stops, const float* stopPositions, const uint32_t* stopColors, uint16_t step)
+{
+    // Colors before the first stop and after the last are those of the stops
+    uint32_t stop = 0;
+    for (uint16_t i = 0; i < RAMP_SIZE; i++)
+    {
+        if (i % step != 0 && i != RAMP_SIZE - 1)
+        {
+            // Coarser ramps repeat the color of the last entry interpolated
+            ramp[i] = ramp[i - 1];
+            continue;
+        }
+        const float position = i / (float)(RAMP_SIZE - 1);
+        while (stop < stops && stopPositions[stop] <= position)
+        {
+            stop++;
+        }
+        if (stop == 0 || stop == stops)
+        {
+            ramp[i] = stopColors[stop == 0 ? 0 : stops - 1];
+            continue;
+        }
+
+        const float start = stopPositions[stop - 1];
+        const float range = stopPositions[stop] - start;
+        const uint32_t t = (uint32_t)((position - start) / range * 256.0f);
+        const uint32_t from = stopColors[stop - 1];
+        const uint32_t to = stopColors[stop];
+        uint32_t color = 0;
+        for (uint16_t shift = 0; shift < 32; shift += 8)
+        {
+            const int32_t c0 = (from >> shift) & 0xFF;
+            const int32_t c1 = (to >> shift) & 0xFF;
+            color |= (uint32_t)(c0 + (((c1 - c0) * (int32_t)t) >> 8)) << shift;
+        }
+        ramp[i] = color;
+    }
+}
@@ -0,0 +1,229 @@
+#include <gui/common/IncrementalListLayout.hpp>
+#include <string.h>
+
+using namespace touchgfx;
+
+IncrementalListLayout::Stats IncrementalListLayout::stats;
+
+IncrementalListLayout::IncrementalListLayout(const Direction d)
+    : Container(), direction(d), lastChild(0), offset(0), widest(0), invalidateMoved(false)
+{
+    assert((d == SOUTH || d == EAST) && "Chosen direction not supported");
+}
+
+void IncrementalListLayout::setDirection(const Direction d)
+{
+    assert((d == SOUTH || d == EAST) && "Chosen direction not supported");
+    if (direction != d)
+    {
+        invalidateFrom(0);
+        direction = d;
+        int16_t breadthMax = 0;
+        resize(moveFrom(firstChild, 0, breadthMax), breadthMax);
+        invalidateFrom(0);
+        changed();
+    }
+}
+
+void IncrementalListLayout::add(Drawable& d)
+{
+    assert(&d != this && "Cannot add Drawable to self");
+    assert(d.getParent() == 0 && "Cannot add Drawable multiple times");
+
+    const int16_t coord = offset;
+    place(d, coord);
+    Access::link(d, this, 0);
+    if (lastChild != 0)
+    {
+        Access::setNext(*lastChild, &d);
+    }
+    else
+    {
+        firstChild = &d;
+    }
+    lastChild = &d;
+    stats.added++;
+
+    resize(coord + length(d), MAX(widest, breadth(d)));
+    invalidateFrom(coord);
+    changed();
+}
+
+void IncrementalListLayout::insert(Drawable* previous, Drawable& d)
+{
+    if (previous == 0 ? firstChild == 0 : previous == lastChild)
+    {
+        add(d);
+        return;
+    }
+    assert(&d != this && "Cannot add Drawable to self");
+    assert(d.getParent() == 0 && "Cannot add Drawable multiple times");
+    assert((previous == 0 || previous->getParent() == this) && "Previous is not a child of the layout");
+
+    int16_t coord = 0;
+    if (previous == 0)
+    {
+        Access::link(d, this, firstChild);
+        firstChild = &d;
+    }
+    else
+    {
+        coord = end(*previous);
+        Access::link(d, this, previous->getNextSibling());
+        Access::setNext(*previous, &d);
+    }
+    place(d, coord);
+    stats.inserted++;
+
+    // Only the children after d move, the widest of the others is known
+    int16_t breadthMax = MAX(widest, breadth(d));
+    resize(moveFrom(d.getNextSibling(), coord + length(d), breadthMax), breadthMax);
+    invalidateFrom(coord);
+    changed();
+}
+
+void IncrementalListLayout::remove(Drawable& d)
+{
+    if (d.getParent() != this)
+    {
+        return;
+    }
+    const int16_t coord = (direction == SOUTH) ? d.getY() : d.getX();
+    invalidateFrom(coord);
+
+    // The widest child may be removed, the others are measured on the way
+    int16_t breadthMax = 0;
+    Drawable* previous = 0;
+    for (Drawable* child = firstChild; child != &d; child = child->getNextSibling())
+    {
+        breadthMax = MAX(breadthMax, breadth(*child));
+        previous = child;
+        stats.visited++;
+    }
+    Drawable* const next = d.getNextSibling();
+    if (previous != 0)
+    {
+        Access::setNext(*previous, next);
+    }
+    else
+    {
+        firstChild = next;
+    }
+    if (lastChild == &d)
+    {
+        lastChild = previous;
+    }
+    Access::link(d, 0, 0);
+    d.setXY(0, 0);
+    stats.removed++;
+
+    resize(moveFrom(next, coord, breadthMax), breadthMax);
+    changed();
+}
+
+void IncrementalListLayout::removeAll()
+{
+    invalidateFrom(0);
+    Container::removeAll();
+    lastChild = 0;
+    resize(0, 0);
+    changed();
+}
+
+void IncrementalListLayout::relayout(Drawable* from)
+{
+    if (from == 0)
+    {
+        from = firstChild;
+    }
+    assert((from == 0 || from->getParent() == this) && "Drawable is not a child of the layout");
+    const int16_t coord = (from == 0 || from == firstChild) ? 0 : ((direction == SOUTH) ? from->getY() : from->getX());
+    invalidateFrom(coord);
+
+    int16_t breadthMax = 0;
+    for (Drawable* child = firstChild; child != from; child = child->getNextSibling())
+    {
+        breadthMax = MAX(breadthMax, breadth(*child));
+    }
+    resize(moveFrom(from, coord, breadthMax), breadthMax);
+    invalidateFrom(coord);
+    changed();
+}
+
+void IncrementalListLayout::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+int16_t IncrementalListLayout::length(const Drawable& d) const
+{
+    return (direction == SOUTH) ? d.getHeight() : d.getWidth();
+}
+
+int16_t IncrementalListLayout::breadth(const Drawable& d) const
+{
+    return (direction == SOUTH) ? d.getWidth() : d.getHeight();
+}
+
+int16_t IncrementalListLayout::end(const Drawable& d) const
+{
+    return (direction == SOUTH) ? d.getY() + d.getHeight() : d.getX() + d.getWidth();
+}
+
+void IncrementalListLayout::place(Drawable& d, int16_t coord)
+{
+    if (direction == SOUTH)
+    {
+        d.setXY(0, coord);
+    }
+    else
+    {
+        d.setXY(coord, 0);
+    }
+}
+
+int16_t IncrementalListLayout::moveFrom(Drawable* d, int16_t coord, int16_t& breadthMax)
+{
+    for (; d != 0; d = d->getNextSibling())
+    {
+        place(*d, coord);
+        coord += length(*d);
+        breadthMax = MAX(breadthMax, breadth(*d));
+        stats.moved++;
+    }
+    return coord;
+}
+
+void IncrementalListLayout::resize(int16_t newOffset, int16_t newBreadth)
+{
+    offset = newOffset;
+    widest = newBreadth;
+    if (direction == SOUTH)
+    {
+        setWidthHeight(widest, offset);
+    }
+    else
+    {
+        setWidthHeight(offset, widest);
+    }
+}
+
+void IncrementalListLayout::invalidateFrom(int16_t coord)
+{
+    // Called before a change that shrinks the list and after one that grows it, so the
+    // range covers both
+    if (!invalidateMoved || offset <= coord || widest <= 0)
+    {
+        return;
+    }
+    Rect range = (direction == SOUTH) ? Rect(0, coord, widest, offset - coord) : Rect(coord, 0, offset - coord, widest);
+    invalidateRect(range);
+}
+
+void IncrementalListLayout::changed()
+{
+    if (parent)
+    {
+        parent->childGeometryChanged();
+    }
+}
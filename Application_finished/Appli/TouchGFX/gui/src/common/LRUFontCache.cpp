@@ -0,0 +1,422 @@
+#include <gui/common/LRUFontCache.hpp>
+#include <gui/common/TargetHardware.hpp>
+
+#include <string.h>
+#include <texts/TypedTextDatabase.hpp>
+
+using namespace touchgfx;
+
+namespace
+{
+void glyphsMoved()
+{
+    // Texts laid out with the moved glyphs point to them
+    TargetHardware::clearShapedText();
+}
+
+void memoryUsage(const void* context, uint32_t& used, uint32_t& /*peak*/)
+{
+    used = static_cast<const LRUFontCache*>(context)->getMemoryUsage();
+}
+}
+
+LRUFontCache::LRUFontCache()
+    : freeSlots(NONE), memory(0), memorySize(0), top(0), usedBytes(0), clock(0), reader(0)
+{
+    clear();
+    resetStats();
+}
+
+void LRUFontCache::setReader(FontDataReader* dataReader)
+{
+    reader = dataReader;
+}
+
+void LRUFontCache::setMemory(uint8_t* cacheMemory, uint32_t size)
+{
+    memory = cacheMemory;
+    // Blocks are 4 byte aligned
+    memorySize = size & ~3U;
+    clear();
+    TargetHardware::addMemoryBudget("font cache", memory, memorySize, memoryUsage, this);
+}
+
+void LRUFontCache::clear()
+{
+    for (uint16_t i = 0; i < LRU_FONT_CACHE_GLYPHS; i++)
+    {
+        slots[i].next = (i + 1 < LRU_FONT_CACHE_GLYPHS) ? i + 1 : NONE;
+    }
+    freeSlots = 0;
+    for (uint16_t f = 0; f < sizeof(fonts) / sizeof(fonts[0]); f++)
+    {
+        fonts[f].first = fonts[f].last = NONE;
+    }
+    top = 0;
+    usedBytes = 0;
+}
+
+void LRUFontCache::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+void LRUFontCache::initializeCachedFont(TypedText t, LRUCachedFont* font)
+{
+    BinaryFontData data;
+    if (reader != 0)
+    {
+        reader->open();
+        reader->setPosition(0);
+        reader->readData(&data, sizeof(data));
+        reader->close();
+    }
+    else
+    {
+        memset(&data, 0, sizeof(data));
+    }
+    const FontId fontId = t.getFontId();
+    const GeneratedFont* flashFont = static_cast<const GeneratedFont*>(TypedTextDatabase::getFonts()[fontId]);
+    *font = LRUCachedFont(&data, fontId, this, flashFont);
+}
+
+bool LRUFontCache::cacheString(TypedText t, const Unicode::UnicodeChar* string)
+{
+    const FontId fontId = t.getFontId();
+    const GeneratedFont* flashFont = static_cast<const GeneratedFont*>(t.getFont());
+    const uint32_t protectFrom = ++clock;
+
+    // Characters of the string that are neither in the flash font nor cached, sorted as
+    // the glyph table of the font data
+    Unicode::UnicodeChar missing[LRU_FONT_CACHE_PASS_GLYPHS];
+    uint16_t count = 0;
+    bool result = true;
+    for (; *string != 0; string++)
+    {
+        const Unicode::UnicodeChar ch = *string;
+        if (flashFont->find(ch) != 0)
+        {
+            continue;
+        }
+        const uint16_t slot = find(ch, fontId);
+        if (slot != NONE)
+        {
+            // Used by the string, so not evicted to make room for the rest of it
+            touch(slot);
+            continue;
+        }
+
+        uint16_t i = count;
+        while (i > 0 && missing[i - 1] > ch)
+        {
+            i--;
+        }
+        if (i > 0 && missing[i - 1] == ch)
+        {
+            continue;
+        }
+        memmove(&missing[i + 1], &missing[i], (count - i) * sizeof(missing[0]));
+        missing[i] = ch;
+        count++;
+
+        if (count == LRU_FONT_CACHE_PASS_GLYPHS)
+        {
+            result = loadGlyphs(fontId, flashFont->getBitsPerPixel(), flashFont->getByteAlignRow(), missing, count, protectFrom) && result;
+            count = 0;
+        }
+    }
+    if (count > 0)
+    {
+        result = loadGlyphs(fontId, flashFont->getBitsPerPixel(), flashFont->getByteAlignRow(), missing, count, protectFrom) && result;
+    }
+    return result;
+}
+
+const GlyphNode* LRUFontCache::getGlyph(Unicode::UnicodeChar unicode, FontId font)
+{
+    const uint16_t slot = find(unicode, font);
+    if (slot == NONE)
+    {
+        stats.misses++;
+        return 0;
+    }
+    stats.hits++;
+    clock++;
+    touch(slot);
+    return nodeAt(slots[slot].offset);
+}
+
+uint16_t LRUFontCache::find(Unicode::UnicodeChar unicode, FontId font) const
+{
+    // Recently used glyphs are found first
+    for (uint16_t slot = fonts[font].first; slot != NONE; slot = slots[slot].next)
+    {
+        if (slots[slot].unicode == unicode)
+        {
+            return slot;
+        }
+    }
+    return NONE;
+}
+
+void LRUFontCache::touch(uint16_t slot)
+{
+    slots[slot].lastUsed = clock;
+    if (fonts[slots[slot].font].first != slot)
+    {
+        unlink(slot);
+        linkFirst(slot);
+    }
+}
+
+void LRUFontCache::unlink(uint16_t slot)
+{
+    Slot& s = slots[slot];
+    FontList& list = fonts[s.font];
+    if (s.prev != NONE)
+    {
+        slots[s.prev].next = s.next;
+    }
+    else
+    {
+        list.first = s.next;
+    }
+    if (s.next != NONE)
+    {
+        slots[s.next].prev = s.prev;
+    }
+    else
+    {
+        list.last = s.prev;
+    }
+}
+
+void LRUFontCache::linkFirst(uint16_t slot)
+{
+    Slot& s = slots[slot];
+    FontList& list = fonts[s.font];
+    s.prev = NONE;
+    s.next = list.first;
+    if (list.first != NONE)
+    {
+        slots[list.first].prev = slot;
+    }
+    list.first = slot;
+    if (list.last == NONE)
+    {
+        list.last = slot;
+    }
+}
+
+void LRUFontCache::evict(uint16_t slot)
+{
+    unlink(slot);
+    reinterpret_cast<BlockHeader*>(memory + slots[slot].offset)->slot = NONE;
+    usedBytes -= slots[slot].size;
+    slots[slot].next = freeSlots;
+    freeSlots = slot;
+    stats.evicted++;
+    glyphsMoved();
+}
+
+bool LRUFontCache::allocate(uint32_t bytes, uint32_t protectFrom, uint32_t& offset)
+{
+    if (bytes > memorySize)
+    {
+        return false;
+    }
+    while (usedBytes + bytes > memorySize)
+    {
+        // The least recently used glyph of all fonts is the last of one of the lists
+        uint16_t oldest = NONE;
+        for (uint16_t f = 0; f < sizeof(fonts) / sizeof(fonts[0]); f++)
+        {
+            const uint16_t last = fonts[f].last;
+            if (last != NONE && (oldest == NONE || slots[last].lastUsed < slots[oldest].lastUsed))
+            {
+                oldest = last;
+            }
+        }
+        if (oldest == NONE || slots[oldest].lastUsed >= protectFrom)
+        {
+            // Everything left is used by the string being cached
+            return false;
+        }
+        evict(oldest);
+    }
+    if (top + bytes > memorySize)
+    {
+        compact();
+    }
+    offset = top;
+    top += bytes;
+    usedBytes += bytes;
+    return true;
+}
+
+void LRUFontCache::compact()
+{
+    uint32_t to = 0;
+    uint32_t from = 0;
+    while (from < top)
+    {
+        const BlockHeader header = *reinterpret_cast<const BlockHeader*>(memory + from);
+        if (header.slot != NONE)
+        {
+            if (to != from)
+            {
+                memmove(memory + to, memory + from, header.size);
+                slots[header.slot].offset = to;
+            }
+            to += header.size;
+        }
+        from += header.size;
+    }
+    top = to;
+    stats.compactions++;
+    glyphsMoved();
+}
+
+bool LRUFontCache::loadGlyphs(FontId font, uint8_t bpp, uint8_t byteAlignRow, const Unicode::UnicodeChar* missing, uint16_t count, uint32_t protectFrom)
+{
+    if (reader == 0)
+    {
+        return false;
+    }
+
+    reader->open();
+    BinaryFontData data;
+    reader->setPosition(0);
+    reader->readData(&data, sizeof(data));
+
+    // The glyph table is sorted, so one pass over it finds all missing characters
+    uint16_t loaded[LRU_FONT_CACHE_PASS_GLYPHS];
+    uint16_t numLoaded = 0;
+    bool result = true;
+    GlyphNode node;
+    node.unicode = 0; // Force reading of first glyph
+    uint16_t fileGlyph = 0;
+    reader->setPosition(data.offsetToTable);
+    for (uint16_t i = 0; i < count; i++)
+    {
+        while (fileGlyph < data.numberOfGlyphs && node.unicode < missing[i])
+        {
+            reader->readData(&node, sizeof(node));
+            fileGlyph++;
+        }
+        if (node.unicode != missing[i])
+        {
+            // Not in the font either, drawn as the fallback character
+            continue;
+        }
+
+        const uint32_t bytes = (sizeof(BlockHeader) + sizeof(GlyphNode) + glyphBytes(node, bpp, byteAlignRow) + 3) & ~3U;
+        uint32_t offset;
+        if (freeSlots == NONE || bytes > 0xFFFFU || !allocate(bytes, protectFrom, offset))
+        {
+            result = false;
+            break;
+        }
+        const uint16_t slot = freeSlots;
+        freeSlots = slots[slot].next;
+
+        Slot& s = slots[slot];
+        s.offset = offset;
+        s.size = (uint16_t)bytes;
+        s.unicode = node.unicode;
+        s.font = (uint8_t)font;
+        s.lastUsed = clock;
+        linkFirst(slot);
+
+        BlockHeader* const header = reinterpret_cast<BlockHeader*>(memory + offset);
+        header->slot = slot;
+        header->size = (uint16_t)bytes;
+        *nodeAt(offset) = node;
+        loaded[numLoaded++] = slot;
+    }
+
+    // Pixel data is read once all nodes are placed, as placing a node may move the others
+    for (uint16_t i = 0; i < numLoaded; i++)
+    {
+        GlyphNode* const cached = nodeAt(slots[loaded[i]].offset);
+        reader->setPosition(data.offsetToGlyphs + cached->dataOffset);
+        reader->readData(reinterpret_cast<uint8_t*>(cached) + sizeof(GlyphNode), glyphBytes(*cached, bpp, byteAlignRow));
+        stats.loaded++;
+    }
+    reader->close();
+    return result;
+}
+
+uint32_t LRUFontCache::glyphBytes(const GlyphNode& node, uint8_t bpp, uint8_t byteAlignRow) const
+{
+    if (byteAlignRow)
+    {
+        return (node.width() * bpp + 7) / 8 * node.height();
+    }
+    return (node.width() * node.height() * bpp + 7) / 8;
+}
+
+LRUCachedFont::LRUCachedFont(const struct BinaryFontData* data, FontId id, LRUFontCache* fontCache, const GeneratedFont* font)
+    : GeneratedFont(0, // GlyphNode*
+                    data->numberOfGlyphs,
+                    data->fontHeight,
+                    data->baseline,
+                    data->pixAboveTop,
+                    data->pixBelowBottom,
+                    data->bitsPerPixel,
+                    data->byteAlignRow,
+                    data->maxLeft,
+                    data->maxRight,
+                    0, // glyphDataPointer
+                    0, // Kerning table not used for cached font
+                    data->fallbackChar,
+                    data->ellipsisChar,
+                    0,  // lsubTablePointer
+                    0), // contextualFormsPointer
+      fontId(id),
+      cache(fontCache),
+      flashFont(font)
+{
+}
+
+const GlyphNode* LRUCachedFont::getGlyph(Unicode::UnicodeChar unicode, const uint8_t*& pixelData, uint8_t& bitsPerPixel) const
+{
+    const GlyphNode* n = flashFont->find(unicode);
+    if (n == 0 && cache != 0)
+    {
+        n = cache->getGlyph(unicode, fontId);
+    }
+
+    if (n == 0 && unicode != 0 && unicode != '\n')
+    {
+        const Unicode::UnicodeChar fallbackChar = flashFont->getFallbackChar();
+        n = flashFont->find(fallbackChar);
+        if (n == 0 && cache != 0)
+        {
+            n = cache->getGlyph(fallbackChar, fontId);
+        }
+    }
+
+    if (n != 0)
+    {
+        pixelData = getPixelData(n);
+        bitsPerPixel = getBitsPerPixel();
+        return n;
+    }
+    return 0;
+}
+
+const uint8_t* LRUCachedFont::getPixelData(const GlyphNode* glyph) const
+{
+    if (cache != 0 && cache->contains(glyph))
+    {
+        return reinterpret_cast<const uint8_t*>(glyph) + sizeof(GlyphNode);
+    }
+    return flashFont->getPixelData(glyph);
+}
+
+int8_t LRUCachedFont::getKerning(Unicode::UnicodeChar /*prevChar*/, const GlyphNode* /*glyph*/) const
+{
+    // Kerning is not supported by font caching
+    return 0;
+}
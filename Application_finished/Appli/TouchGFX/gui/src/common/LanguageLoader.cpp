@@ -0,0 +1,135 @@
+#include <gui/common/LanguageLoader.hpp>
+#include <gui/common/LRUFontCache.hpp>
+#include <gui/common/TargetHardware.hpp>
+
+#include <string.h>
+#include <touchgfx/TypedText.hpp>
+#include <texts/TypedTextDatabase.hpp>
+
+using namespace touchgfx;
+
+namespace
+{
+void memoryUsage(const void* context, uint32_t& used, uint32_t& /*peak*/)
+{
+    used = static_cast<const LanguageLoader*>(context)->getLoadedBytes();
+}
+}
+
+LanguageLoader::LanguageLoader()
+    : memory(0), memorySize(0), reader(0), fontCache(0), loaded(NUMBER_OF_LANGUAGES), loadedBytes(0)
+{
+    memset(sources, 0, sizeof(sources));
+    resetStats();
+}
+
+void LanguageLoader::setMemory(uint8_t* textMemory, uint32_t size)
+{
+    unload();
+    memory = textMemory;
+    memorySize = size;
+    TargetHardware::addMemoryBudget("language texts", memory, memorySize, memoryUsage, this);
+}
+
+void LanguageLoader::setReader(FlashDataReader* dataReader)
+{
+    reader = dataReader;
+}
+
+void LanguageLoader::setFontCache(LRUFontCache* cache)
+{
+    fontCache = cache;
+}
+
+void LanguageLoader::setSource(LanguageId id, const void* blob, uint32_t size)
+{
+    if (id >= NUMBER_OF_LANGUAGES)
+    {
+        return;
+    }
+    if (id == loaded)
+    {
+        unload();
+    }
+    sources[id].blob = blob;
+    sources[id].size = size;
+}
+
+bool LanguageLoader::setLanguage(LanguageId id)
+{
+    if (id >= NUMBER_OF_LANGUAGES)
+    {
+        return false;
+    }
+    if (id == loaded)
+    {
+        Texts::setLanguage(id);
+        return true;
+    }
+
+    const Source& source = sources[id];
+    const bool fits = source.blob != 0 && source.size >= sizeof(TranslationHeader) && source.size <= memorySize;
+    if (source.blob != 0 && !fits)
+    {
+        stats.tooLarge++;
+    }
+    // The blob in RAM is about to be overwritten
+    unload();
+    if (!fits)
+    {
+        stats.linkedIn++;
+        Texts::setLanguage(id);
+        cacheGlyphs();
+        return false;
+    }
+
+    if (reader != 0)
+    {
+        reader->copyData(source.blob, memory, source.size);
+    }
+    else
+    {
+        memcpy(memory, source.blob, source.size);
+    }
+    loaded = id;
+    stats.loads++;
+    stats.bytesLoaded += source.size;
+    loadedBytes = source.size;
+
+    Texts::setTranslation(id, memory);
+    Texts::setLanguage(id);
+    cacheGlyphs();
+    return true;
+}
+
+void LanguageLoader::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+void LanguageLoader::unload()
+{
+    if (loaded < NUMBER_OF_LANGUAGES)
+    {
+        Texts::setTranslation(loaded, 0);
+        loaded = NUMBER_OF_LANGUAGES;
+        loadedBytes = 0;
+    }
+    // Texts laid out in the previous language point to its texts
+    TargetHardware::clearShapedText();
+}
+
+void LanguageLoader::cacheGlyphs()
+{
+    if (fontCache == 0)
+    {
+        return;
+    }
+    // Only the glyphs that differ from the previous language are read
+    const uint16_t texts = TypedTextDatabase::getInstanceSize();
+    for (TypedTextId id = 0; id < texts; id++)
+    {
+        const TypedText text(id);
+        fontCache->cacheString(text, text.getText());
+    }
+}
@@ -0,0 +1,239 @@
+#include <gui/common/LayerContainer.hpp>
+#include <gui/common/TargetHardware.hpp>
+#include <touchgfx/Application.hpp>
+#include <touchgfx/hal/HAL.hpp>
+#include <touchgfx/lcd/LCD.hpp>
+#include <string.h>
+
+using namespace touchgfx;
+
+LayerContainer::Stats LayerContainer::stats;
+
+LayerContainer::LayerContainer()
+    : CacheableContainer(),
+      layerMovedCallback(this, &LayerContainer::layerMoved),
+      layer(BITMAP_INVALID),
+      changed(),
+      lastX(0),
+      lastY(0),
+      lastAlpha(255),
+      movingTicks(0),
+      stillTicks(0),
+      changingTicks(0),
+      ticking(false),
+      movingSelf(false),
+      translucentLayer(false)
+{
+}
+
+LayerContainer::~LayerContainer()
+{
+    release();
+    if (ticking)
+    {
+        Application::getInstance()->unregisterTimerWidget(this);
+    }
+}
+
+void LayerContainer::moveTo(int16_t x, int16_t y)
+{
+    movingSelf = true;
+    CacheableContainer::moveTo(x, y);
+    movingSelf = false;
+    animated();
+}
+
+void LayerContainer::setAlpha(uint8_t newAlpha)
+{
+    if (newAlpha == getAlpha())
+    {
+        return;
+    }
+    // Only drawn when the container is a layer
+    if (newAlpha < 255 && !isLayer())
+    {
+        promote();
+    }
+    CacheableContainer::setAlpha(newAlpha);
+    movingSelf = true;
+    invalidate();
+    movingSelf = false;
+    animated();
+}
+
+void LayerContainer::invalidateRect(Rect& invalidatedArea) const
+{
+    if (!movingSelf)
+    {
+        changed.expandToFit(invalidatedArea);
+    }
+    CacheableContainer::invalidateRect(invalidatedArea);
+}
+
+void LayerContainer::handleTickEvent()
+{
+    const bool moved = getX() != lastX || getY() != lastY || getAlpha() != lastAlpha;
+    lastX = getX();
+    lastY = getY();
+    lastAlpha = getAlpha();
+    const bool contentChanged = !changed.isEmpty();
+
+    if (contentChanged)
+    {
+        changingTicks++;
+        movingTicks = 0;
+        if (isLayer())
+        {
+            if (changingTicks >= LAYER_DEMOTE_TICKS && getAlpha() == 255)
+            {
+                stats.demotions++;
+                release();
+            }
+            else
+            {
+                // Children are drawn in the layer before the frame is drawn
+                if (translucentLayer)
+                {
+                    clearLayer(changed);
+                }
+                updateCache(changed);
+                stats.renders++;
+            }
+        }
+    }
+    else
+    {
+        changingTicks = 0;
+    }
+    changed = Rect();
+
+    if (moved)
+    {
+        stillTicks = 0;
+        if (!contentChanged && ++movingTicks >= LAYER_PROMOTE_TICKS && !isLayer())
+        {
+            promote();
+        }
+    }
+    else if (++stillTicks >= LAYER_RELEASE_TICKS && getAlpha() == 255)
+    {
+        release();
+        Application::getInstance()->unregisterTimerWidget(this);
+        ticking = false;
+        movingTicks = 0;
+    }
+}
+
+void LayerContainer::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+void LayerContainer::animated()
+{
+    stillTicks = 0;
+    if (!ticking)
+    {
+        Application::getInstance()->registerTimerWidget(this);
+        ticking = true;
+        lastX = getX();
+        lastY = getY();
+        lastAlpha = getAlpha();
+    }
+}
+
+bool LayerContainer::promote()
+{
+    if (isLayer())
+    {
+        return false;
+    }
+    const bool opaque = isOpaque();
+    if (!opaque && !canBlendLayer())
+    {
+        return false;
+    }
+    layer = DynamicBitmapArena::create(getWidth(), getHeight(), opaque ? HAL::lcd().framebufferFormat() : Bitmap::ARGB8888, &layerMovedCallback);
+    if (layer == BITMAP_INVALID)
+    {
+        stats.noMemory++;
+        return false;
+    }
+    translucentLayer = !opaque;
+    if (opaque)
+    {
+        Bitmap::dynamicBitmapSetSolidRect(layer, Rect(0, 0, getWidth(), getHeight()));
+    }
+    else
+    {
+        clearLayer(Rect(0, 0, getWidth(), getHeight()));
+        stats.translucent++;
+    }
+    setCacheBitmap(layer);
+    if (getCacheBitmap() == BITMAP_INVALID)
+    {
+        release();
+        return false;
+    }
+    enableCachedMode(true);
+    updateCache();
+    stats.promotions++;
+    stats.renders++;
+    return true;
+}
+
+void LayerContainer::release()
+{
+    if (layer == BITMAP_INVALID)
+    {
+        return;
+    }
+    enableCachedMode(false);
+    setCacheBitmap(BITMAP_INVALID);
+    DynamicBitmapArena::destroy(layer);
+    layer = BITMAP_INVALID;
+    // Drawn from the children again
+    invalidate();
+}
+
+bool LayerContainer::isOpaque()
+{
+    Drawable* const background = getFirstChild();
+    if (background == 0 || !background->isVisible())
+    {
+        return false;
+    }
+    Rect solid = background->getSolidRect();
+    solid.x += background->getX();
+    solid.y += background->getY();
+    return solid.includes(Rect(0, 0, getWidth(), getHeight()));
+}
+
+bool LayerContainer::canBlendLayer() const
+{
+    return HAL::DISPLAY_ROTATION == rotate0
+           && TargetHardware::canDrawInDynamicBitmap(Bitmap::ARGB8888);
+}
+
+void LayerContainer::clearLayer(const Rect& area)
+{
+    const Rect rect = area & Rect(0, 0, getWidth(), getHeight());
+    if (rect.isEmpty())
+    {
+        return;
+    }
+    // The children are blended over transparent pixels, as in a fresh layer
+    const uint32_t stride = (uint32_t)getWidth() * 4;
+    uint8_t* const first = Bitmap::dynamicBitmapGetAddress(layer) + rect.y * stride + rect.x * 4;
+    for (int16_t y = 0; y < rect.height; y++)
+    {
+        memset(first + y * stride, 0, rect.width * 4);
+    }
+    TargetHardware::cleanDCache(first, (rect.height - 1) * stride + rect.width * 4);
+}
+
+void LayerContainer::layerMoved(BitmapId /*oldId*/, BitmapId newId)
+{
+    layer = newId;
+    setCacheBitmap(newId);
+}
@@ -0,0 +1,332 @@
+#include <gui/common/LayeredKeyboard.hpp>
+#include <gui/common/TargetHardware.hpp>
+#include <touchgfx/FontManager.hpp>
+#include <touchgfx/hal/HAL.hpp>
+#include <touchgfx/lcd/LCD.hpp>
+#include <string.h>
+
+using namespace touchgfx;
+
+LayeredKeyboard::Stats LayeredKeyboard::stats;
+
+LayeredKeyboard::LayeredKeyboard()
+    : Keyboard(),
+      bitmapMovedCallback(this, &LayeredKeyboard::bitmapMoved),
+      current(0),
+      painter(),
+      uses(0)
+{
+    for (uint16_t i = 0; i < LAYERED_KEYBOARD_LAYOUTS; i++)
+    {
+        layers[i].layout = 0;
+        layers[i].mapping = 0;
+        layers[i].released = BITMAP_INVALID;
+        layers[i].pressed = BITMAP_INVALID;
+        layers[i].lastUsed = 0;
+    }
+    painter.keyboard = this;
+}
+
+LayeredKeyboard::~LayeredKeyboard()
+{
+    for (uint16_t i = 0; i < LAYERED_KEYBOARD_LAYOUTS; i++)
+    {
+        release(layers[i]);
+    }
+}
+
+void LayeredKeyboard::setLayout(const Layout* newLayout)
+{
+    Keyboard::setLayout(newLayout);
+    selectLayers();
+}
+
+void LayeredKeyboard::setKeymappingList(const KeyMappingList* newKeyMappingList)
+{
+    Keyboard::setKeymappingList(newKeyMappingList);
+    selectLayers();
+}
+
+void LayeredKeyboard::releaseLayers()
+{
+    for (uint16_t i = 0; i < LAYERED_KEYBOARD_LAYOUTS; i++)
+    {
+        release(layers[i]);
+    }
+    current = 0;
+    image.setVisible(true);
+    highlightImage.setAlpha(255);
+    invalidate();
+}
+
+void LayeredKeyboard::draw(const Rect& invalidatedArea) const
+{
+    if (current == 0)
+    {
+        Keyboard::draw(invalidatedArea);
+        return;
+    }
+    const Bitmap released(current->released);
+    const Rect area = invalidatedArea & Rect(0, 0, released.getWidth(), released.getHeight());
+    if (area.isEmpty())
+    {
+        return;
+    }
+    Rect origin(0, 0, 0, 0);
+    translateRectToAbsolute(origin);
+
+    Rect key;
+    if (highlightImage.isVisible())
+    {
+        key = highlightImage.getRect() & area;
+    }
+    if (key.isEmpty())
+    {
+        HAL::lcd().drawPartialBitmap(released, origin.x, origin.y, area, 255);
+        return;
+    }
+
+    // The pressed key from the pressed layer, the area around it from the released layer
+    HAL::lcd().drawPartialBitmap(Bitmap(current->pressed), origin.x, origin.y, key, 255);
+    stats.keys++;
+    const Rect around[4] =
+    {
+        Rect(area.x, area.y, area.width, key.y - area.y),
+        Rect(area.x, key.bottom(), area.width, area.bottom() - key.bottom()),
+        Rect(area.x, key.y, key.x - area.x, key.height),
+        Rect(key.right(), key.y, area.right() - key.right(), key.height)
+    };
+    for (int i = 0; i < 4; i++)
+    {
+        if (!around[i].isEmpty())
+        {
+            HAL::lcd().drawPartialBitmap(released, origin.x, origin.y, around[i], 255);
+        }
+    }
+}
+
+Rect LayeredKeyboard::getSolidRect() const
+{
+    if (current == 0)
+    {
+        return Keyboard::getSolidRect();
+    }
+    const Bitmap released(current->released);
+    if (released.getFormat() != Bitmap::RGB565)
+    {
+        return Rect();
+    }
+    return Rect(0, 0, released.getWidth(), released.getHeight());
+}
+
+void LayeredKeyboard::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+void LayeredKeyboard::setupDrawChain(const Rect& invalidatedArea, Drawable** nextPreviousElement)
+{
+    if (current == 0)
+    {
+        Keyboard::setupDrawChain(invalidatedArea, nextPreviousElement);
+        return;
+    }
+    // The labels are in the layers, the keyboard is drawn first and the children over it
+    Drawable::setupDrawChain(invalidatedArea, nextPreviousElement);
+    Container::setupDrawChain(invalidatedArea, nextPreviousElement);
+}
+
+void LayeredKeyboard::LayerPainter::draw(const Rect& invalidatedArea) const
+{
+    Rect origin(0, 0, 0, 0);
+    translateRectToAbsolute(origin);
+    keyboard->drawLayer(invalidatedArea, origin.x, origin.y, pressed);
+}
+
+void LayeredKeyboard::selectLayers()
+{
+    current = 0;
+    if (layout != 0)
+    {
+        uses++;
+        Layers* oldest = &layers[0];
+        for (uint16_t i = 0; i < LAYERED_KEYBOARD_LAYOUTS; i++)
+        {
+            if (layers[i].layout == layout && layers[i].mapping == keyMappingList)
+            {
+                current = &layers[i];
+                stats.reused++;
+                break;
+            }
+            if (layers[i].lastUsed < oldest->lastUsed)
+            {
+                oldest = &layers[i];
+            }
+        }
+        if (current == 0)
+        {
+            release(*oldest);
+            if (render(*oldest))
+            {
+                current = oldest;
+            }
+        }
+        if (current != 0)
+        {
+            current->lastUsed = uses;
+        }
+    }
+    // The layers hold the layout and the highlights, the images are kept for the key areas
+    image.setVisible(current == 0);
+    highlightImage.setAlpha(current == 0 ? 255 : 0);
+    invalidate();
+}
+
+bool LayeredKeyboard::render(Layers& entry)
+{
+    const Bitmap layoutBitmap(layout->bitmap);
+    const uint16_t width = layoutBitmap.getWidth();
+    const uint16_t height = layoutBitmap.getHeight();
+    const Bitmap::BitmapFormat format = layoutBitmap.hasTransparentPixels() ? Bitmap::ARGB8888 : Bitmap::RGB565;
+    if (width == 0
+        || height == 0
+        || HAL::DISPLAY_ROTATION != rotate0
+        || !TargetHardware::canDrawInDynamicBitmap(format))
+    {
+        return false;
+    }
+    entry.released = DynamicBitmapArena::create(width, height, format, &bitmapMovedCallback);
+    entry.pressed = DynamicBitmapArena::create(width, height, format, &bitmapMovedCallback);
+    if (entry.released == BITMAP_INVALID || entry.pressed == BITMAP_INVALID)
+    {
+        release(entry);
+        stats.noMemory++;
+        return false;
+    }
+    entry.layout = layout;
+    entry.mapping = keyMappingList;
+
+    painter.setPosition(0, 0, width, height);
+    const BitmapId targets[2] = { entry.released, entry.pressed };
+    for (int i = 0; i < 2; i++)
+    {
+        if (format == Bitmap::ARGB8888)
+        {
+            // The layout is blended over transparent pixels
+            uint8_t* const pixels = Bitmap::dynamicBitmapGetAddress(targets[i]);
+            const uint32_t bytes = (uint32_t)width * height * 4;
+            memset(pixels, 0, bytes);
+            TargetHardware::cleanDCache(pixels, bytes);
+        }
+        painter.pressed = i == 1;
+        HAL::getInstance()->drawDrawableInDynamicBitmap(painter, targets[i]);
+    }
+    stats.rendered++;
+    return true;
+}
+
+void LayeredKeyboard::release(Layers& entry)
+{
+    if (entry.released != BITMAP_INVALID)
+    {
+        DynamicBitmapArena::destroy(entry.released);
+    }
+    if (entry.pressed != BITMAP_INVALID)
+    {
+        DynamicBitmapArena::destroy(entry.pressed);
+    }
+    entry.layout = 0;
+    entry.mapping = 0;
+    entry.released = BITMAP_INVALID;
+    entry.pressed = BITMAP_INVALID;
+    entry.lastUsed = 0;
+}
+
+void LayeredKeyboard::drawLayer(const Rect& invalidatedArea, int16_t x, int16_t y, bool pressed) const
+{
+    const Bitmap layoutBitmap(layout->bitmap);
+    const Rect part = invalidatedArea & Rect(0, 0, layoutBitmap.getWidth(), layoutBitmap.getHeight());
+    if (!part.isEmpty())
+    {
+        HAL::lcd().drawPartialBitmap(layoutBitmap, x, y, part, 255);
+    }
+    if (pressed)
+    {
+        for (uint8_t i = 0; i < layout->numberOfKeys; i++)
+        {
+            drawHighlight(layout->keyArray[i].highlightBitmapId, layout->keyArray[i].keyArea, invalidatedArea, x, y);
+        }
+        for (uint8_t i = 0; i < layout->numberOfCallbackAreas; i++)
+        {
+            drawHighlight(layout->callbackAreaArray[i].highlightBitmapId, layout->callbackAreaArray[i].keyArea, invalidatedArea, x, y);
+        }
+    }
+
+    // The labels, as Keyboard::draw() places them
+    const Font* const font = FontManager::getFont(layout->keyFont);
+    if (font == 0)
+    {
+        return;
+    }
+    LCD::StringVisuals visuals;
+    visuals.font = font;
+    visuals.alignment = CENTER;
+    visuals.color = layout->keyFontColor;
+    Unicode::UnicodeChar character[2] = { 0, 0 };
+    const uint16_t fontHeight = font->getHeight();
+    for (uint8_t i = 0; i < layout->numberOfKeys; i++)
+    {
+        const Key& key = layout->keyArray[i];
+        if (!key.keyArea.intersect(invalidatedArea))
+        {
+            continue;
+        }
+        character[0] = getCharForKey(key.keyId);
+        if (character[0] == 0)
+        {
+            continue;
+        }
+        Rect keyArea = key.keyArea;
+        const uint16_t offset = (keyArea.height - fontHeight) / 2;
+        keyArea.y += offset;
+        keyArea.height -= offset;
+        Rect invalidatedAreaRelative = key.keyArea & invalidatedArea;
+        invalidatedAreaRelative.x -= keyArea.x;
+        invalidatedAreaRelative.y -= keyArea.y;
+        keyArea.x += x;
+        keyArea.y += y;
+        HAL::lcd().drawString(keyArea, invalidatedAreaRelative, visuals, character);
+    }
+}
+
+void LayeredKeyboard::drawHighlight(BitmapId highlight, const Rect& keyArea, const Rect& invalidatedArea, int16_t x, int16_t y) const
+{
+    if (highlight == BITMAP_INVALID)
+    {
+        return;
+    }
+    const Bitmap bitmap(highlight);
+    Rect part = Rect(keyArea.x, keyArea.y, bitmap.getWidth(), bitmap.getHeight()) & invalidatedArea;
+    if (part.isEmpty())
+    {
+        return;
+    }
+    part.x -= keyArea.x;
+    part.y -= keyArea.y;
+    HAL::lcd().drawPartialBitmap(bitmap, x + keyArea.x, y + keyArea.y, part, 255);
+}
+
+void LayeredKeyboard::bitmapMoved(BitmapId oldId, BitmapId newId)
+{
+    for (uint16_t i = 0; i < LAYERED_KEYBOARD_LAYOUTS; i++)
+    {
+        if (layers[i].released == oldId)
+        {
+            layers[i].released = newId;
+        }
+        if (layers[i].pressed == oldId)
+        {
+            layers[i].pressed = newId;
+        }
+    }
+}
@@ -0,0 +1,157 @@
+#include <gui/common/NavigationPrefetch.hpp>
+#include <gui/common/TargetHardware.hpp>
+#include <touchgfx/Font.hpp>
+#include <touchgfx/hal/HAL.hpp>
+
+using namespace touchgfx;
+
+NavigationPrefetch* NavigationPrefetch::instance = 0;
+
+NavigationPrefetch::NavigationPrefetch()
+    : current(NUMBER_OF_SCREENS), predicted(NUMBER_OF_SCREENS), nextBitmap(0), nextText(0), nextChar(0)
+{
+    ::memset(transitions, 0, sizeof(transitions));
+    ::memset(assets, 0, sizeof(assets));
+    resetStats();
+    instance = this;
+}
+
+void NavigationPrefetch::entered(Screen screen)
+{
+    if (current != NUMBER_OF_SCREENS)
+    {
+        stats.transitions++;
+        if (screen == predicted)
+        {
+            stats.predicted++;
+        }
+        uint16_t* const counts = transitions[current];
+        if (counts[screen] == 0xFFFF)
+        {
+            // Halved, so the other transitions keep their share
+            for (int to = 0; to < NUMBER_OF_SCREENS; to++)
+            {
+                counts[to] /= 2;
+            }
+        }
+        counts[screen]++;
+    }
+    current = screen;
+    predicted = predict(screen);
+    nextBitmap = 0;
+    nextText = 0;
+    nextChar = 0;
+}
+
+bool NavigationPrefetch::addBitmap(Screen screen, BitmapId id)
+{
+    Assets& screenAssets = assets[screen];
+    for (uint8_t i = 0; i < screenAssets.numBitmaps; i++)
+    {
+        if (screenAssets.bitmaps[i] == id)
+        {
+            return true;
+        }
+    }
+    if (id == BITMAP_INVALID || screenAssets.numBitmaps >= NAVIGATION_PREFETCH_BITMAPS)
+    {
+        return false;
+    }
+    screenAssets.bitmaps[screenAssets.numBitmaps++] = id;
+    return true;
+}
+
+bool NavigationPrefetch::addText(Screen screen, TypedTextId id)
+{
+    Assets& screenAssets = assets[screen];
+    for (uint8_t i = 0; i < screenAssets.numTexts; i++)
+    {
+        if (screenAssets.texts[i] == id)
+        {
+            return true;
+        }
+    }
+    if (id == TYPED_TEXT_INVALID || screenAssets.numTexts >= NAVIGATION_PREFETCH_TEXTS)
+    {
+        return false;
+    }
+    screenAssets.texts[screenAssets.numTexts++] = id;
+    return true;
+}
+
+bool NavigationPrefetch::hasAssets(Screen screen) const
+{
+    return assets[screen].numBitmaps > 0 || assets[screen].numTexts > 0;
+}
+
+void NavigationPrefetch::idle()
+{
+    if (predicted == NUMBER_OF_SCREENS || !TargetHardware::isAccelerated())
+    {
+        return;
+    }
+    const Assets& screenAssets = assets[predicted];
+    // Bitmaps cached already are skipped, the cache copies one bitmap per frame
+    while (nextBitmap < screenAssets.numBitmaps)
+    {
+        if (TargetHardware::prefetchTexture(screenAssets.bitmaps[nextBitmap++]))
+        {
+            stats.bitmaps++;
+            stats.idleFrames++;
+            return;
+        }
+    }
+    if (nextText < screenAssets.numTexts)
+    {
+        nextChar = prefetchGlyphs(screenAssets.texts[nextText], nextChar);
+        if (nextChar == 0)
+        {
+            nextText++;
+        }
+        stats.idleFrames++;
+    }
+}
+
+NavigationPrefetch::Screen NavigationPrefetch::predict(Screen from) const
+{
+    Screen to = NUMBER_OF_SCREENS;
+    uint16_t most = NAVIGATION_PREFETCH_MIN_TRANSITIONS - 1;
+    for (int screen = 0; screen < NUMBER_OF_SCREENS; screen++)
+    {
+        if (transitions[from][screen] > most)
+        {
+            most = transitions[from][screen];
+            to = static_cast<Screen>(screen);
+        }
+    }
+    return to;
+}
+
+uint16_t NavigationPrefetch::prefetchGlyphs(TypedTextId id, uint16_t from)
+{
+    const TypedText typedText(id);
+    const Font* const font = typedText.getFont();
+    const Unicode::UnicodeChar* const text = typedText.getText();
+    // Only A4 glyphs with byte aligned rows go into the atlas, see HybridLCDGPU2D
+    if (font == 0 || text == 0 || font->getBitsPerPixel() != 4 || font->getByteAlignRow() == 0)
+    {
+        return 0;
+    }
+    for (uint16_t i = from; i < from + NAVIGATION_PREFETCH_GLYPHS_PER_FRAME; i++)
+    {
+        const Unicode::UnicodeChar character = text[i];
+        if (character == 0)
+        {
+            return 0;
+        }
+        const uint8_t* glyphData = 0;
+        uint8_t bitsPerPixel = 0;
+        const GlyphNode* const glyph = font->getGlyph(character, glyphData, bitsPerPixel);
+        if (glyph != 0 && glyphData != 0 && glyph->width() > 0 && glyph->height() > 0
+                && TargetHardware::prefetchGlyph(glyphData, glyph->width(), glyph->height()))
+        {
+            stats.glyphs++;
+        }
+    }
+    return from + NAVIGATION_PREFETCH_GLYPHS_PER_FRAME;
+}
@@ -0,0 +1,229 @@
+#include <gui/common/NumericTextArea.hpp>
+#include <touchgfx/FontManager.hpp>
+#include <touchgfx/hal/HAL.hpp>
+#include <touchgfx/lcd/LCD.hpp>
+#include <string.h>
+
+using namespace touchgfx;
+
+NumericTextArea::FontMetrics NumericTextArea::metrics[NUMERIC_TEXT_FONTS];
+uint8_t NumericTextArea::measuredFonts = 0;
+NumericTextArea::Stats NumericTextArea::stats;
+
+NumericTextArea::NumericTextArea()
+    : Widget(),
+      typedText(),
+      color(0),
+      value(0),
+      alpha(255),
+      alignment(RIGHT),
+      digits(1),
+      decimals(0),
+      zeroPadded(false),
+      cells(0),
+      cellsWidth(0)
+{
+    memset(text, 0, sizeof(text));
+}
+
+void NumericTextArea::setTypedText(const TypedText& t)
+{
+    typedText = t;
+    layout();
+}
+
+void NumericTextArea::setFormat(uint8_t numberOfDigits, uint8_t numberOfDecimals, bool zeroPad)
+{
+    digits = MAX(1, MIN(numberOfDigits, NUMERIC_TEXT_MAX_CELLS - 2));
+    decimals = MIN(numberOfDecimals, digits - 1);
+    zeroPadded = zeroPad;
+    layout();
+}
+
+void NumericTextArea::setValue(int32_t newValue)
+{
+    stats.values++;
+    int32_t largest = 9;
+    for (uint8_t i = 1; i < digits; i++)
+    {
+        largest = largest * 10 + 9;
+    }
+    newValue = MAX(-largest, MIN(newValue, largest));
+    if (newValue == value)
+    {
+        return;
+    }
+    value = newValue;
+
+    Unicode::UnicodeChar chars[NUMERIC_TEXT_MAX_CELLS];
+    format(chars);
+    bool changed = false;
+    for (uint8_t i = 0; i < cells; i++)
+    {
+        if (chars[i] != text[i])
+        {
+            // The old character is cleared and the new one drawn in the same cell
+            text[i] = chars[i];
+            Rect cell = getCell(i);
+            invalidateRect(cell);
+            stats.cells++;
+            changed = true;
+        }
+    }
+    if (changed)
+    {
+        stats.changed++;
+    }
+}
+
+void NumericTextArea::resizeToCells()
+{
+    const Font* const font = typedText.getFont();
+    setWidthHeight(cellsWidth, font != 0 ? font->getHeight() : 0);
+}
+
+void NumericTextArea::draw(const Rect& invalidatedArea) const
+{
+    const Font* const font = typedText.getFont();
+    if (font == 0 || alpha == 0)
+    {
+        return;
+    }
+    const LCD::StringVisuals visuals(font, color, alpha, CENTER, 0, TEXT_ROTATE_0, TEXT_DIRECTION_LTR, 0);
+    for (uint8_t i = 0; i < cells; i++)
+    {
+        if (text[i] == 0)
+        {
+            continue;
+        }
+        const Rect cell = getCell(i);
+        const Rect part = invalidatedArea & cell;
+        if (part.isEmpty())
+        {
+            continue;
+        }
+        const Unicode::UnicodeChar character[2] = { text[i], 0 };
+        Rect absolute = cell;
+        translateRectToAbsolute(absolute);
+        HAL::lcd().drawString(absolute, Rect(part.x - cell.x, part.y - cell.y, part.width, part.height), visuals, character);
+    }
+}
+
+Rect NumericTextArea::getSolidRect() const
+{
+    return Rect();
+}
+
+void NumericTextArea::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+NumericTextArea::FontMetrics NumericTextArea::measure(FontId font)
+{
+    for (uint8_t i = 0; i < measuredFonts; i++)
+    {
+        if (metrics[i].font == font)
+        {
+            return metrics[i];
+        }
+    }
+
+    FontMetrics measured;
+    measured.font = font;
+    measured.digit = 0;
+    measured.point = 0;
+    const Font* const f = FontManager::getFont(font);
+    if (f != 0)
+    {
+        measured.digit = f->getCharWidth('-');
+        for (Unicode::UnicodeChar c = '0'; c <= '9'; c++)
+        {
+            measured.digit = MAX(measured.digit, f->getCharWidth(c));
+        }
+        measured.point = f->getCharWidth('.');
+        if (measured.point == 0)
+        {
+            measured.point = measured.digit;
+        }
+    }
+    stats.measured++;
+    if (measuredFonts < NUMERIC_TEXT_FONTS)
+    {
+        metrics[measuredFonts++] = measured;
+    }
+    return measured;
+}
+
+void NumericTextArea::layout()
+{
+    cells = 0;
+    cellsWidth = 0;
+    if (!typedText.hasValidId())
+    {
+        return;
+    }
+    const FontMetrics fontMetrics = measure(typedText.getFontId());
+
+    // The sign, the digits before the point, the point and the decimals
+    const uint8_t pointCell = decimals > 0 ? digits - decimals + 1 : NUMERIC_TEXT_MAX_CELLS;
+    cells = digits + 1 + (decimals > 0 ? 1 : 0);
+    for (uint8_t i = 0; i < cells; i++)
+    {
+        cellX[i] = cellsWidth;
+        cellWidth[i] = i == pointCell ? fontMetrics.point : fontMetrics.digit;
+        cellsWidth += cellWidth[i];
+    }
+    format(text);
+    invalidate();
+}
+
+void NumericTextArea::format(Unicode::UnicodeChar* chars) const
+{
+    memset(chars, 0, sizeof(Unicode::UnicodeChar) * NUMERIC_TEXT_MAX_CELLS);
+    if (cells == 0)
+    {
+        return;
+    }
+    const uint8_t pointCell = decimals > 0 ? digits - decimals + 1 : cells;
+    uint32_t magnitude = value < 0 ? 0U - (uint32_t)value : (uint32_t)value;
+
+    // From the last digit, at least one digit before the point
+    uint8_t digitsShown = 0;
+    uint8_t first = cells;
+    for (int16_t i = cells - 1; i >= 1; i--)
+    {
+        if (i == pointCell)
+        {
+            chars[i] = '.';
+            continue;
+        }
+        if (magnitude == 0 && digitsShown > decimals && !zeroPadded)
+        {
+            break;
+        }
+        chars[i] = (Unicode::UnicodeChar)('0' + magnitude % 10);
+        magnitude /= 10;
+        digitsShown++;
+        first = (uint8_t)i;
+    }
+    if (value < 0)
+    {
+        // Left of the first digit shown, in the sign cell when all the digits are
+        chars[first - 1] = '-';
+    }
+}
+
+Rect NumericTextArea::getCell(uint8_t cell) const
+{
+    int16_t x = 0;
+    if (alignment == CENTER)
+    {
+        x = (getWidth() - (int16_t)cellsWidth) / 2;
+    }
+    else if (alignment == RIGHT)
+    {
+        x = getWidth() - (int16_t)cellsWidth;
+    }
+    return Rect(x + cellX[cell], 0, cellWidth[cell], getHeight());
+}
@@ -0,0 +1,56 @@
+#include <gui/common/OcclusionCuller.hpp>
+
+using namespace touchgfx;
+
+OcclusionCuller::OcclusionCuller()
+    : numHidden(0)
+{
+}
+
+uint16_t OcclusionCuller::cull(Container& container)
+{
+    uint16_t count = 0;
+    for (Drawable* child = container.getFirstChild(); child != 0 && numHidden < OCCLUSION_CULLER_MAX_WIDGETS; child = child->getNextSibling())
+    {
+        if (child->isVisible() && isCovered(*child))
+        {
+            child->setVisible(false);
+            hidden[numHidden++] = child;
+            count++;
+        }
+    }
+    return count;
+}
+
+void OcclusionCuller::restore()
+{
+    while (numHidden > 0)
+    {
+        hidden[--numHidden]->setVisible(true);
+    }
+}
+
+bool OcclusionCuller::isCovered(Drawable& widget)
+{
+    const Rect area = widget.getRect();
+    if (area.isEmpty())
+    {
+        return false;
+    }
+    // Children are drawn in order, the later siblings are in front
+    for (Drawable* front = widget.getNextSibling(); front != 0; front = front->getNextSibling())
+    {
+        if (!front->isVisible())
+        {
+            continue;
+        }
+        Rect solid = front->getSolidRect();
+        solid.x += front->getX();
+        solid.y += front->getY();
+        if (solid.includes(area))
+        {
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,116 @@
+#include <gui/common/PipelinedCanvas.hpp>
+#include <gui/common/TargetHardware.hpp>
+#include <touchgfx/hal/HAL.hpp>
+#include <string.h>
+
+using namespace touchgfx;
+
+namespace
+{
+// Read by GPU2D while the CPU rasterizes into the other one, words for the alignment of
+// a GPU2D texture
+uint32_t strips[2][(CANVAS_PIPELINE_STRIP_BYTES + 3) / 4];
+}
+
+CanvasPipeline::StripPainter CanvasPipeline::painter;
+Rect CanvasPipeline::band;
+uint32_t CanvasPipeline::kicks[2] = { 0, 0 };
+uint8_t CanvasPipeline::current = 0;
+CanvasPipeline::Stats CanvasPipeline::stats;
+
+bool CanvasPipeline::isAvailable()
+{
+    return TargetHardware::isAccelerated() && HAL::DISPLAY_ROTATION == rotate0;
+}
+
+const AbstractPainter& CanvasPipeline::begin(const Rect& area)
+{
+    if (kicks[current] != 0)
+    {
+        // GPU2D may still read the strip for the band before last
+        TargetHardware::waitForKick(kicks[current]);
+        kicks[current] = 0;
+        stats.waits++;
+    }
+    band = area;
+    // Clears the pixels the outline does not cover
+    uint8_t* const strip = reinterpret_cast<uint8_t*>(strips[current]);
+    ::memset(strip, 0, (uint32_t)area.width * area.height);
+    painter.setStrip(strip, area);
+    return painter;
+}
+
+bool CanvasPipeline::end(const CanvasWidget& widget, bool done, colortype color, uint8_t alpha)
+{
+    if (!done)
+    {
+        // Drawn in slices by CanvasWidget::draw()
+        stats.fallbacks++;
+        return false;
+    }
+    const uint8_t* const strip = reinterpret_cast<const uint8_t*>(strips[current]);
+    TargetHardware::cleanDCache(strip, (uint32_t)band.width * band.height);
+    Rect abs = band;
+    widget.translateRectToAbsolute(abs);
+    return kick(TargetHardware::drawA8Mask(strip, band.width, band.height, abs.x, abs.y, abs, color, alpha));
+}
+
+bool CanvasPipeline::canFill(const AbstractPainterBitmap& painter)
+{
+    // A tiled bitmap would take a blit per repetition, the painter is faster
+    return !painter.getTiled()
+           && TargetHardware::canDrawMaskedBitmap(painter.getBitmap());
+}
+
+bool CanvasPipeline::end(const CanvasWidget& widget, bool done, AbstractPainterBitmap& painter, uint8_t alpha)
+{
+    if (!done)
+    {
+        stats.fallbacks++;
+        return false;
+    }
+    const uint8_t* const strip = reinterpret_cast<const uint8_t*>(strips[current]);
+    TargetHardware::cleanDCache(strip, (uint32_t)band.width * band.height);
+    Rect abs = band;
+    widget.translateRectToAbsolute(abs);
+    // The painter reads the texel at the widget coordinates plus the offset
+    int16_t xOffset;
+    int16_t yOffset;
+    painter.getOffset(xOffset, yOffset);
+    const bool drawn = TargetHardware::drawMaskedBitmap(strip, band.width, band.height, abs.x, abs.y, painter.getBitmap(), band.x + xOffset, band.y + yOffset, abs, alpha);
+    if (drawn)
+    {
+        stats.bitmaps++;
+    }
+    return kick(drawn);
+}
+
+bool CanvasPipeline::kick(bool drawn)
+{
+    if (!drawn)
+    {
+        stats.fallbacks++;
+        return false;
+    }
+    // GPU2D blends this strip while the next one is rasterized
+    kicks[current] = TargetHardware::kickGPU2D();
+    current ^= 1U;
+    stats.strips++;
+    return true;
+}
+
+void CanvasPipeline::resetStats()
+{
+    ::memset(&stats, 0, sizeof(stats));
+}
+
+void CanvasPipeline::StripPainter::paint(uint8_t* /*destination*/, int16_t /*offset*/, int16_t widgetX, int16_t widgetY, int16_t count, uint8_t alpha) const
+{
+    const int16_t x = MAX(widgetX, band.x);
+    const int16_t right = MIN((int16_t)(widgetX + count), band.right());
+    if (widgetY < band.y || widgetY >= band.bottom() || x >= right)
+    {
+        return;
+    }
+    ::memset(strip + (uint32_t)(widgetY - band.y) * band.width + (x - band.x), alpha, right - x);
+}
@@ -0,0 +1,104 @@
+#include <gui/common/ProgressivePaint.hpp>
+#include <touchgfx/hal/HAL.hpp>
+
+using namespace touchgfx;
+
+ProgressivePaint* ProgressivePaint::instance = 0;
+
+ProgressivePaint::ProgressivePaint()
+    : count(0), next(0), held(0), ticks(0)
+{
+    resetStats();
+    instance = this;
+}
+
+bool ProgressivePaint::defer(Drawable& drawable, uint8_t stage, uint32_t cost)
+{
+    if (next == count)
+    {
+        // The first drawable deferred since the screen was complete
+        count = 0;
+        next = 0;
+        ticks = 0;
+    }
+    if (!drawable.isVisible() || count >= PROGRESSIVE_PAINT_DRAWABLES)
+    {
+        return false;
+    }
+    // After the drawables of the same stage, so those are shown in the order deferred
+    uint16_t at = count;
+    while (at > next && entries[at - 1].stage > stage)
+    {
+        entries[at] = entries[at - 1];
+        at--;
+    }
+    entries[at].drawable = &drawable;
+    entries[at].cost = cost;
+    entries[at].stage = stage;
+    count++;
+    drawable.setVisible(false);
+    // The tick of the transition may come before the first frame is drawn
+    held = 1;
+    stats.deferred++;
+    return true;
+}
+
+void ProgressivePaint::tick()
+{
+    if (next == count)
+    {
+        return;
+    }
+    ticks++;
+    if (held > 0)
+    {
+        held--;
+        return;
+    }
+    uint32_t spent = 0;
+    while (next < count)
+    {
+        const Entry& entry = entries[next];
+        const uint32_t cost = costOf(entry);
+        if (spent > 0 && spent + cost > PROGRESSIVE_PAINT_PIXELS_PER_FRAME)
+        {
+            break;
+        }
+        entry.drawable->setVisible(true);
+        entry.drawable->invalidate();
+        spent += cost;
+        next++;
+        stats.shown++;
+    }
+    stats.frames++;
+    if (next == count)
+    {
+        stats.lastTicks = ticks;
+        if (ticks > stats.maxTicks)
+        {
+            stats.maxTicks = ticks;
+        }
+    }
+}
+
+void ProgressivePaint::clear()
+{
+    // The screen is left, or kept warm and shown complete when entered again
+    for (; next < count; next++)
+    {
+        entries[next].drawable->setVisible(true);
+    }
+    count = 0;
+    next = 0;
+    held = 0;
+}
+
+uint32_t ProgressivePaint::costOf(const Entry& entry)
+{
+    if (entry.cost > 0)
+    {
+        return entry.cost;
+    }
+    const Rect area = entry.drawable->getAbsoluteRect() & Rect(0, 0, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT);
+    return area.isEmpty() ? 0 : (uint32_t)area.width * area.height;
+}
@@ -0,0 +1,125 @@
+#include <gui/common/RetainedDrawList.hpp>
+#include <touchgfx/hal/HAL.hpp>
+#include <string.h>
+
+using namespace touchgfx;
+
+namespace
+{
+/** FNV-1a step over one value. */
+inline uint32_t mix(uint32_t hash, uint32_t value)
+{
+    for (int i = 0; i < 4; i++)
+    {
+        hash = (hash ^ (value & 0xFFU)) * 16777619U;
+        value >>= 8;
+    }
+    return hash;
+}
+}
+
+uint32_t RetainedDrawList::frame = 0;
+RetainedDrawList::Stats RetainedDrawList::stats;
+
+RetainedDrawList::RetainedDrawList()
+    : count(0), owner(0), treeSignature(0), checkedFrame(0), valid(false), fits(false), validation(true)
+{
+}
+
+void RetainedDrawList::draw(Screen& screen, Rect& rect)
+{
+    if (!screen.usingSMOC() || !update(screen))
+    {
+        stats.fallbacks++;
+        screen.Screen::draw(rect);
+        return;
+    }
+
+    // Linked back to front, so the head is the frontmost drawable, as by setupDrawChain()
+    Drawable* head = 0;
+    for (uint16_t i = count; i-- > 0;)
+    {
+        if (entries[i].area.intersect(rect))
+        {
+            Access::link(*entries[i].drawable, head);
+            head = entries[i].drawable;
+            stats.linked++;
+        }
+    }
+    stats.draws++;
+    if (head != 0)
+    {
+        screen.JSMOC(rect, head);
+    }
+}
+
+void RetainedDrawList::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+bool RetainedDrawList::update(Screen& screen)
+{
+    if (owner != &screen)
+    {
+        owner = &screen;
+        valid = false;
+    }
+    if (validation && (checkedFrame != frame || !valid))
+    {
+        checkedFrame = frame;
+        // Transitions move the root container
+        Container& root = screen.getRootContainer();
+        const uint32_t tree = signature(root, mix(2166136261U, ((uint32_t)(uint16_t)root.getX() << 16) | (uint16_t)root.getY()));
+        if (tree != treeSignature)
+        {
+            treeSignature = tree;
+            valid = false;
+        }
+    }
+    if (!valid)
+    {
+        // A tree too large is not tried again until it changes
+        fits = build(screen);
+        valid = true;
+    }
+    return fits;
+}
+
+bool RetainedDrawList::build(Screen& screen)
+{
+    count = 0;
+    stats.builds++;
+    Drawable* head = 0;
+    Access::buildChain(screen.getRootContainer(), Rect(0, 0, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT), &head);
+    for (Drawable* d = head; d != 0; d = Access::next(*d))
+    {
+        if (count == RETAINED_DRAW_LIST_SIZE)
+        {
+            count = 0;
+            return false;
+        }
+        Rect area(0, 0, d->getWidth(), d->getHeight());
+        d->getVisibleRect(area);
+        d->translateRectToAbsolute(area);
+        entries[count].drawable = d;
+        entries[count].area = area;
+        count++;
+    }
+    return true;
+}
+
+uint32_t RetainedDrawList::signature(Drawable& container, uint32_t hash)
+{
+    for (Drawable* d = container.getFirstChild(); d != 0; d = d->getNextSibling())
+    {
+        hash = mix(hash, (uint32_t)reinterpret_cast<uintptr_t>(d));
+        hash = mix(hash, ((uint32_t)(uint16_t)d->getX() << 16) | (uint16_t)d->getY());
+        hash = mix(hash, ((uint32_t)(uint16_t)d->getWidth() << 16) | (uint16_t)d->getHeight());
+        if (d->isVisible())
+        {
+            hash = signature(*d, mix(hash, 1));
+        }
+    }
+    return hash;
+}
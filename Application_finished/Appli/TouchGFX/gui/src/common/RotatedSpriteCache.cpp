@@ -0,0 +1,242 @@
+#include <gui/common/RotatedSpriteCache.hpp>
+#include <gui/common/TargetHardware.hpp>
+#include <touchgfx/hal/HAL.hpp>
+#include <math.h>
+
+using namespace touchgfx;
+
+namespace
+{
+const float STEP_RADIANS = ROTATED_SPRITE_ANGLE_STEP * 3.14159265f / 180.0f;
+}
+
+RotatedSpriteCache::RotatedSpriteCache()
+    : Widget(), mapper(0), mapperAlpha(255), active(false), step(0), bounds(), slotCount(0), uses(0)
+{
+    for (int i = 0; i < 6; i++)
+    {
+        corners[i] = 0.0f;
+    }
+    for (int i = 0; i < ROTATED_SPRITE_SLOTS; i++)
+    {
+        slots[i].pixels = 0;
+        slots[i].valid = false;
+    }
+    setVisible(false);
+}
+
+void RotatedSpriteCache::attach(TextureMapper& textureMapper)
+{
+    detach();
+    mapper = &textureMapper;
+    mapperAlpha = textureMapper.getAlpha();
+    setPosition(textureMapper);
+    for (int i = 0; i < slotCount; i++)
+    {
+        slots[i].valid = false;
+    }
+    update();
+}
+
+void RotatedSpriteCache::detach()
+{
+    useMapper(true);
+    mapper = 0;
+}
+
+uint32_t RotatedSpriteCache::setBuffer(uint8_t* buffer, uint32_t size)
+{
+    const uint32_t slotBytes = (uint32_t)getWidth() * getHeight() * 4;
+    slotCount = (slotBytes == 0) ? 0 : (uint8_t)MIN(size / slotBytes, (uint32_t)ROTATED_SPRITE_SLOTS);
+    if (slotCount < 2)
+    {
+        slotCount = 0;
+    }
+    for (int i = 0; i < slotCount; i++)
+    {
+        slots[i].pixels = buffer + i * slotBytes;
+        slots[i].valid = false;
+    }
+    update();
+    return slotCount * slotBytes;
+}
+
+void RotatedSpriteCache::update()
+{
+    if (mapper == 0)
+    {
+        return;
+    }
+    if (!canDraw())
+    {
+        useMapper(true);
+        return;
+    }
+
+    const int32_t newStep = (int32_t)lroundf(mapper->getZAngle() / STEP_RADIANS);
+    if (active && newStep == step)
+    {
+        return;
+    }
+
+    // Take the corners at the rounded angle, the mapper is hidden so this invalidates nothing
+    const float xAngle = mapper->getXAngle();
+    const float yAngle = mapper->getYAngle();
+    const float zAngle = mapper->getZAngle();
+    mapper->setAngles(xAngle, yAngle, newStep * STEP_RADIANS);
+    corners[0] = mapper->getX0();
+    corners[1] = mapper->getY0();
+    corners[2] = mapper->getX1();
+    corners[3] = mapper->getY1();
+    corners[4] = mapper->getX3();
+    corners[5] = mapper->getY3();
+    const float minX = floorf(MIN(MIN(mapper->getX0(), mapper->getX1()), MIN(mapper->getX2(), mapper->getX3())));
+    const float maxX = ceilf(MAX(MAX(mapper->getX0(), mapper->getX1()), MAX(mapper->getX2(), mapper->getX3())));
+    const float minY = floorf(MIN(MIN(mapper->getY0(), mapper->getY1()), MIN(mapper->getY2(), mapper->getY3())));
+    const float maxY = ceilf(MAX(MAX(mapper->getY0(), mapper->getY1()), MAX(mapper->getY2(), mapper->getY3())));
+    mapper->setAngles(xAngle, yAngle, zAngle);
+
+    invalidateRect(bounds);
+    bounds = Rect((int16_t)minX, (int16_t)minY, (int16_t)(maxX - minX), (int16_t)(maxY - minY)) & Rect(0, 0, getWidth(), getHeight());
+    step = newStep;
+    uses++;
+    useMapper(false);
+    invalidateRect(bounds);
+}
+
+void RotatedSpriteCache::draw(const Rect& invalidatedArea) const
+{
+    if (!active)
+    {
+        return;
+    }
+
+    Slot* slot = 0;
+    for (int i = 0; i < slotCount && slot == 0; i++)
+    {
+        if (slots[i].valid && slots[i].step == step)
+        {
+            slot = &slots[i];
+        }
+    }
+    if (slot == 0)
+    {
+        // Replace the least recently drawn rotation, never the one drawn last tick
+        slot = &slots[0];
+        for (int i = 1; i < slotCount; i++)
+        {
+            if (!slots[i].valid || (slot->valid && slots[i].lastUsed < slot->lastUsed))
+            {
+                slot = &slots[i];
+            }
+        }
+        render(*slot);
+    }
+    slot->lastUsed = uses;
+
+    const Rect area = invalidatedArea & slot->bounds;
+    if (area.isEmpty())
+    {
+        return;
+    }
+    HAL::lcd().blitCopy(slot->pixels, Bitmap::ARGB8888, getAbsoluteRect(), area, mapperAlpha, true);
+}
+
+bool RotatedSpriteCache::canDraw() const
+{
+    const Bitmap bitmap(mapper->getBitmap());
+    return slotCount >= 2
+           && mapperAlpha > 0
+           && mapper->getXAngle() == 0.0f //lint !e777
+           && mapper->getYAngle() == 0.0f //lint !e777
+           && bitmap.getData() != 0
+           && (bitmap.getFormat() == Bitmap::ARGB8888 || (bitmap.getFormat() == Bitmap::RGB565 && bitmap.getExtraData() == 0));
+}
+
+void RotatedSpriteCache::useMapper(bool use)
+{
+    if (mapper == 0 || active != use)
+    {
+        return;
+    }
+    active = !use;
+    if (use)
+    {
+        invalidate();
+        setVisible(false);
+        mapper->setAlpha(mapperAlpha);
+        mapper->invalidateContent();
+    }
+    else
+    {
+        mapper->invalidateContent();
+        mapper->setAlpha(0);
+        setVisible(true);
+    }
+}
+
+void RotatedSpriteCache::render(Slot& slot) const
+{
+    const Bitmap bitmap(mapper->getBitmap());
+    const int32_t width = bitmap.getWidth();
+    const int32_t height = bitmap.getHeight();
+    const int32_t stride = getWidth();
+    const bool argb8888 = (bitmap.getFormat() == Bitmap::ARGB8888);
+    const uint32_t* const argb8888Data = reinterpret_cast<const uint32_t*>(bitmap.getData());
+    const uint16_t* const rgb565Data = reinterpret_cast<const uint16_t*>(bitmap.getData());
+
+    // Corner 0 maps to texel (-1, -1), corner 1 to (width, -1) and corner 3 to (-1, height),
+    // so the texel of a pixel follows from its position along both edges
+    const float e1x = corners[2] - corners[0];
+    const float e1y = corners[3] - corners[1];
+    const float e2x = corners[4] - corners[0];
+    const float e2y = corners[5] - corners[1];
+    const float det = e1x * e2y - e1y * e2x;
+    slot.step = step;
+    slot.bounds = bounds;
+    slot.valid = true;
+    if (det == 0.0f) //lint !e777
+    {
+        slot.bounds = Rect();
+        return;
+    }
+    const float uPerA = (float)(width + 1);
+    const float vPerB = (float)(height + 1);
+    const float dUdx = e2y / det * uPerA;
+    const float dVdx = -e1y / det * vPerB;
+
+    for (int32_t y = bounds.y; y < bounds.bottom(); y++)
+    {
+        const float fx = bounds.x + 0.5f - corners[0];
+        const float fy = y + 0.5f - corners[1];
+        float u = (fx * e2y - fy * e2x) / det * uPerA - 1.0f;
+        float v = (e1x * fy - e1y * fx) / det * vPerB - 1.0f;
+        uint32_t* dst = reinterpret_cast<uint32_t*>(slot.pixels) + y * stride + bounds.x;
+        for (int32_t x = bounds.x; x < bounds.right(); x++)
+        {
+            uint32_t pixel = 0;
+            if (u >= 0.0f && v >= 0.0f && u < width && v < height)
+            {
+                const int32_t texel = (int32_t)v * width + (int32_t)u;
+                if (argb8888)
+                {
+                    pixel = argb8888Data[texel];
+                }
+                else
+                {
+                    const uint32_t rgb565 = rgb565Data[texel];
+                    const uint32_t red = (rgb565 >> 11) & 0x1FU;
+                    const uint32_t green = (rgb565 >> 5) & 0x3FU;
+                    const uint32_t blue = rgb565 & 0x1FU;
+                    pixel = 0xFF000000U | (((red << 3) | (red >> 2)) << 16) | (((green << 2) | (green >> 4)) << 8) | ((blue << 3) | (blue >> 2));
+                }
+            }
+            *dst++ = pixel;
+            u += dUdx;
+            v += dVdx;
+        }
+    }
+
+    // Written by the CPU, blitted by GPU2D or DMA2D
+    TargetHardware::cleanDCache(slot.pixels + bounds.y * stride * 4, (uint32_t)bounds.height * stride * 4);
+}
@@ -0,0 +1,71 @@
+#include <gui/common/ScreenOverlay.hpp>
+#include <gui/common/TargetHardware.hpp>
+#include <string.h>
+
+#if !defined(SIMULATOR) && defined(__GNUC__) && !defined(__ARMCC_VERSION)
+#define SCREEN_OVERLAYS_LINKED 1
+
+// Defined by the OVERLAY statements of STM32H7S7L8HXH_RAMxspi1_ROMxspi2_app.ld
+extern "C" uint8_t _sovltext[];
+extern "C" uint8_t _sovlrodata[];
+extern "C" const uint8_t __load_start_ovl_text_screen1[];
+extern "C" const uint8_t __load_stop_ovl_text_screen1[];
+extern "C" const uint8_t __load_start_ovl_rodata_screen1[];
+extern "C" const uint8_t __load_stop_ovl_rodata_screen1[];
+
+namespace
+{
+/** Where the code and the constants of a screen are stored in flash. */
+struct Image
+{
+    const uint8_t* textStart;
+    const uint8_t* textStop;
+    const uint8_t* rodataStart;
+    const uint8_t* rodataStop;
+};
+
+const Image IMAGES[ScreenOverlay::NUMBER_OF_OVERLAYS] =
+{
+    { __load_start_ovl_text_screen1, __load_stop_ovl_text_screen1, __load_start_ovl_rodata_screen1, __load_stop_ovl_rodata_screen1 }
+};
+}
+#else
+#define SCREEN_OVERLAYS_LINKED 0
+#endif
+
+ScreenOverlay::Id ScreenOverlay::loaded = ScreenOverlay::NUMBER_OF_OVERLAYS;
+ScreenOverlay::Stats ScreenOverlay::stats;
+
+bool ScreenOverlay::load(Id overlay)
+{
+#if SCREEN_OVERLAYS_LINKED
+    if (overlay >= NUMBER_OF_OVERLAYS)
+    {
+        return false;
+    }
+    if (overlay == loaded)
+    {
+        return true;
+    }
+    const Image& image = IMAGES[overlay];
+    const uint32_t textBytes = (uint32_t)(image.textStop - image.textStart);
+    const uint32_t constBytes = (uint32_t)(image.rodataStop - image.rodataStart);
+    memcpy(_sovltext, image.textStart, textBytes);
+    memcpy(_sovlrodata, image.rodataStart, constBytes);
+    // ITCM is not cached, the copied code only has to be written before it is fetched
+    TargetHardware::synchronizeCode();
+    loaded = overlay;
+    stats.loads++;
+    stats.textBytes += textBytes;
+    stats.constBytes += constBytes;
+    return true;
+#else
+    (void)overlay;
+    return false;
+#endif
+}
+
+void ScreenOverlay::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
@@ -0,0 +1,32 @@
+#include <gui/common/ShapedTextArea.hpp>
+#include <gui/common/TargetHardware.hpp>
+
+using namespace touchgfx;
+
+void ShapedTextArea::draw(const Rect& area) const
+{
+    if (typedText.hasValidId())
+    {
+        const Unicode::UnicodeChar* const text = typedText.getText();
+        Rect rectToDraw = area;
+        if (boundingArea.isValid(text))
+        {
+            rectToDraw &= boundingArea.getRect();
+        }
+        if (rectToDraw.isEmpty())
+        {
+            return;
+        }
+        const Font* fontToDraw = typedText.getFont();
+        if (fontToDraw == 0)
+        {
+            return;
+        }
+        const LCD::StringVisuals visuals(fontToDraw, color, alpha, getAlignment(), linespace, rotation, typedText.getTextDirection(), indentation, wideTextAction);
+        if (TargetHardware::drawShapedString(typedText.getId(), getAbsoluteRect(), rectToDraw, visuals, text))
+        {
+            return;
+        }
+    }
+    TextArea::draw(area);
+}
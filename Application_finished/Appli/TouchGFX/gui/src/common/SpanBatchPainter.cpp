@@ -0,0 +1,51 @@
+#include <gui/common/SpanBatchPainter.hpp>
+#include <string.h>
+
+SpanBatch::Span SpanBatch::spans[SPAN_BATCH_SIZE];
+uint16_t SpanBatch::count = 0;
+SpanBatch::Stats SpanBatch::stats;
+
+bool SpanBatch::add(uint8_t* destination, int16_t offset, int16_t widgetX, int16_t widgetY, int16_t pixels, uint8_t alpha)
+{
+    if (count > 0)
+    {
+        // The rasterizer paints an edge pixel and then the run after it
+        Span& last = spans[count - 1];
+        if (last.destination == destination
+            && last.widgetY == widgetY
+            && last.alpha == alpha
+            && last.offset + last.count == offset
+            && last.widgetX + last.count == widgetX
+            && last.count + pixels <= 0x7FFF)
+        {
+            last.count += pixels;
+            stats.spans++;
+            stats.merged++;
+            return true;
+        }
+    }
+    if (count == SPAN_BATCH_SIZE)
+    {
+        return false;
+    }
+    Span& span = spans[count++];
+    span.destination = destination;
+    span.offset = offset;
+    span.widgetX = widgetX;
+    span.widgetY = widgetY;
+    span.count = pixels;
+    span.alpha = alpha;
+    stats.spans++;
+    return true;
+}
+
+void SpanBatch::clear()
+{
+    count = 0;
+    stats.batches++;
+}
+
+void SpanBatch::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
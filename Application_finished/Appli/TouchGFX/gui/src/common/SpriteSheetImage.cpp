@@ -0,0 +1,153 @@
+#include <gui/common/SpriteSheetImage.hpp>
+#include <touchgfx/hal/HAL.hpp>
+
+using namespace touchgfx;
+
+SpriteSheetImage::SpriteSheetImage()
+    : Widget(),
+      sheet(),
+      timer(),
+      doneAction(0),
+      columns(1),
+      cellWidth(0),
+      cellHeight(0),
+      frames(0),
+      frame(0),
+      interval(1),
+      alpha(255),
+      reverse(false),
+      loop(false),
+      running(false)
+{
+}
+
+void SpriteSheetImage::setSheet(const Bitmap& bitmap, uint16_t sheetColumns, uint16_t sheetFrames)
+{
+    sheet = bitmap;
+    columns = sheetColumns > 0 ? sheetColumns : 1;
+    const uint16_t rows = (sheetFrames + columns - 1) / columns;
+    frames = sheetFrames;
+    frame = 0;
+    cellWidth = sheet.getWidth() / columns;
+    cellHeight = rows > 0 ? sheet.getHeight() / rows : 0;
+    setWidthHeight(cellWidth, cellHeight);
+}
+
+void SpriteSheetImage::setFrame(uint16_t newFrame)
+{
+    if (newFrame < frames && newFrame != frame)
+    {
+        frame = newFrame;
+        invalidate();
+    }
+}
+
+void SpriteSheetImage::startAnimation(bool rev, bool reset, bool loopAnimation)
+{
+    if (frames == 0)
+    {
+        return;
+    }
+    reverse = rev;
+    loop = loopAnimation;
+    if (reset)
+    {
+        setFrame(reverse ? frames - 1 : 0);
+    }
+    running = true;
+    timer.start(*this, interval);
+}
+
+void SpriteSheetImage::stopAnimation()
+{
+    timer.stop();
+    running = false;
+    if (frames > 0)
+    {
+        setFrame(reverse ? frames - 1 : 0);
+    }
+}
+
+void SpriteSheetImage::pauseAnimation()
+{
+    if (running)
+    {
+        timer.stop();
+        running = false;
+    }
+    else if (frames > 0)
+    {
+        running = true;
+        timer.start(*this, interval);
+    }
+}
+
+void SpriteSheetImage::setUpdateTicksInterval(uint16_t ticks)
+{
+    interval = ticks > 0 ? ticks : 1;
+    if (running)
+    {
+        timer.start(*this, interval);
+    }
+}
+
+void SpriteSheetImage::handleTickEvent()
+{
+    if (!running)
+    {
+        return;
+    }
+    const bool last = reverse ? (frame == 0) : (frame == frames - 1);
+    if (last && !loop)
+    {
+        timer.stop();
+        running = false;
+        if (doneAction != 0 && doneAction->isValid())
+        {
+            doneAction->execute(*this);
+        }
+        return;
+    }
+    if (last)
+    {
+        setFrame(reverse ? frames - 1 : 0);
+    }
+    else
+    {
+        setFrame(reverse ? frame - 1 : frame + 1);
+    }
+}
+
+void SpriteSheetImage::draw(const Rect& invalidatedArea) const
+{
+    if (frames == 0 || alpha == 0)
+    {
+        return;
+    }
+    const Rect cell = getCell();
+    // The sheet is placed so that the cell of the frame covers the widget
+    Rect origin(0, 0, 0, 0);
+    translateRectToAbsolute(origin);
+    Rect part = invalidatedArea & Rect(0, 0, cell.width, cell.height);
+    if (part.isEmpty())
+    {
+        return;
+    }
+    part.x += cell.x;
+    part.y += cell.y;
+    HAL::lcd().drawPartialBitmap(sheet, origin.x - cell.x, origin.y - cell.y, part, alpha);
+}
+
+Rect SpriteSheetImage::getSolidRect() const
+{
+    if (frames == 0 || alpha < 255 || sheet.hasTransparentPixels())
+    {
+        return Rect();
+    }
+    return Rect(0, 0, cellWidth, cellHeight);
+}
+
+Rect SpriteSheetImage::getCell() const
+{
+    return Rect((frame % columns) * cellWidth, (frame / columns) * cellHeight, cellWidth, cellHeight);
+}
@@ -0,0 +1,322 @@
+#include <gui/common/StreamingGraph.hpp>
+#include <gui/common/TargetHardware.hpp>
+#include <touchgfx/Color.hpp>
+#include <touchgfx/hal/HAL.hpp>
+#include <touchgfx/lcd/LCD.hpp>
+#include <string.h>
+
+using namespace touchgfx;
+
+namespace
+{
+uint16_t toRGB565(colortype color)
+{
+    return (uint16_t)(((Color::getRed(color) & 0xF8U) << 8) | ((Color::getGreen(color) & 0xFCU) << 3) | (Color::getBlue(color) >> 3));
+}
+}
+
+StreamingGraphData::Stats StreamingGraphData::stats;
+
+StreamingGraphData::StreamingGraphData(int16_t* buffer, uint16_t bufferCapacity)
+    : Widget(),
+      samples(buffer),
+      capacity(bufferCapacity),
+      head(0),
+      used(0),
+      rangeBottom(-100),
+      rangeTop(100),
+      samplesPerColumn(1),
+      lineColor(Color::getColorFromRGB(0xFF, 0xFF, 0xFF)),
+      backgroundColor(Color::getColorFromRGB(0, 0, 0)),
+      numColumns(0),
+      partialMin(0),
+      partialMax(0),
+      partialSamples(0),
+      bitmapMovedCallback(this, &StreamingGraphData::bitmapMoved),
+      bitmap(BITMAP_INVALID),
+      rasterizedColumns(0),
+      dirty(true)
+{
+}
+
+StreamingGraphData::~StreamingGraphData()
+{
+    if (bitmap != BITMAP_INVALID)
+    {
+        DynamicBitmapArena::destroy(bitmap);
+    }
+}
+
+void StreamingGraphData::setRange(int16_t bottom, int16_t top)
+{
+    rangeBottom = bottom;
+    rangeTop = (top > bottom) ? top : bottom + 1;
+    redrawAll();
+}
+
+void StreamingGraphData::setSamplesPerColumn(uint16_t count)
+{
+    samplesPerColumn = (count > 0) ? count : 1;
+    numColumns = 0;
+    partialSamples = 0;
+    for (uint16_t i = 0; i < used; i++)
+    {
+        decimate(getSample(i));
+    }
+    redrawAll();
+}
+
+void StreamingGraphData::setColors(colortype line, colortype background)
+{
+    lineColor = line;
+    backgroundColor = background;
+    redrawAll();
+}
+
+void StreamingGraphData::addDataPoints(const int16_t* values, uint16_t count)
+{
+    if (count == 0)
+    {
+        return;
+    }
+    stats.samples += count;
+
+    // Copied into the ring in at most two spans, only the newest samples if too many
+    const int16_t* source = values;
+    uint16_t remaining = count;
+    if (remaining > capacity)
+    {
+        source += remaining - capacity;
+        remaining = capacity;
+    }
+    while (remaining > 0)
+    {
+        const uint16_t chunk = MIN(remaining, (uint16_t)(capacity - head));
+        memcpy(samples + head, source, chunk * sizeof(int16_t));
+        head = (uint16_t)((head + chunk) % capacity);
+        source += chunk;
+        remaining -= chunk;
+    }
+    used = (uint16_t)MIN((uint32_t)used + count, (uint32_t)capacity);
+
+    const uint32_t before = numColumns;
+    for (uint16_t i = 0; i < count; i++)
+    {
+        decimate(values[i]);
+    }
+    if (numColumns != before)
+    {
+        invalidate();
+    }
+}
+
+void StreamingGraphData::clear()
+{
+    head = 0;
+    used = 0;
+    numColumns = 0;
+    partialSamples = 0;
+    redrawAll();
+}
+
+void StreamingGraphData::draw(const Rect& invalidatedArea) const
+{
+    if (!prepareBitmap())
+    {
+        stats.direct++;
+        drawDirect(invalidatedArea);
+        return;
+    }
+
+    const int16_t width = columnCount();
+    uint16_t* const pixels = reinterpret_cast<uint16_t*>(Bitmap::dynamicBitmapGetAddress(bitmap));
+    const uint32_t first = (numColumns > (uint32_t)width) ? numColumns - width : 0;
+    if (dirty || rasterizedColumns < first)
+    {
+        const uint16_t background = toRGB565(backgroundColor);
+        const uint32_t count = (uint32_t)width * getHeight();
+        for (uint32_t i = 0; i < count; i++)
+        {
+            pixels[i] = background;
+        }
+        rasterizedColumns = first;
+        dirty = false;
+        stats.rebuilds++;
+    }
+    if (rasterizedColumns < numColumns)
+    {
+        // The previous frame has been drawn, so no blit reads the bitmap any more
+        for (uint32_t column = rasterizedColumns; column < numColumns; column++)
+        {
+            rasterize(pixels, width, column);
+        }
+        stats.columns += numColumns - rasterizedColumns;
+        rasterizedColumns = numColumns;
+        TargetHardware::cleanDCache(pixels, (uint32_t)width * getHeight() * sizeof(uint16_t));
+    }
+
+    // The oldest column is where the next one goes, the older part of the ring is on the left
+    const int16_t split = (int16_t)(numColumns % width);
+    const int16_t left = getWidth() - width;
+    drawPart(split, width - split, left, invalidatedArea);
+    drawPart(0, split, left + width - split, invalidatedArea);
+    if (left > 0)
+    {
+        Rect margin = Rect(0, 0, left, getHeight()) & invalidatedArea;
+        if (!margin.isEmpty())
+        {
+            translateRectToAbsolute(margin);
+            HAL::lcd().fillRect(margin, backgroundColor, 255);
+        }
+    }
+}
+
+void StreamingGraphData::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+void StreamingGraphData::decimate(int16_t value)
+{
+    if (partialSamples == 0)
+    {
+        partialMin = value;
+        partialMax = value;
+    }
+    else
+    {
+        partialMin = MIN(partialMin, value);
+        partialMax = MAX(partialMax, value);
+    }
+    if (++partialSamples >= samplesPerColumn)
+    {
+        const uint32_t index = numColumns % STREAMING_GRAPH_MAX_WIDTH;
+        columnMin[index] = partialMin;
+        columnMax[index] = partialMax;
+        numColumns++;
+        partialSamples = 0;
+    }
+}
+
+void StreamingGraphData::redrawAll()
+{
+    dirty = true;
+    rasterizedColumns = 0;
+    invalidate();
+}
+
+void StreamingGraphData::span(uint32_t column, int16_t& top, int16_t& bottom) const
+{
+    const uint32_t index = column % STREAMING_GRAPH_MAX_WIDTH;
+    int16_t low = columnMin[index];
+    int16_t high = columnMax[index];
+    // Joined to the previous column, if it is still kept, so steep edges have no gaps
+    if (column > 0 && numColumns - (column - 1) <= STREAMING_GRAPH_MAX_WIDTH)
+    {
+        const uint32_t previous = (column - 1) % STREAMING_GRAPH_MAX_WIDTH;
+        low = MIN(low, columnMax[previous]);
+        high = MAX(high, columnMin[previous]);
+    }
+    top = valueToY(high);
+    bottom = valueToY(low);
+}
+
+int16_t StreamingGraphData::valueToY(int16_t value) const
+{
+    const int32_t clamped = MAX(MIN((int32_t)value, (int32_t)rangeTop), (int32_t)rangeBottom);
+    return (int16_t)(((int32_t)rangeTop - clamped) * (getHeight() - 1) / ((int32_t)rangeTop - rangeBottom));
+}
+
+bool StreamingGraphData::prepareBitmap() const
+{
+    const int16_t width = columnCount();
+    const int16_t height = getHeight();
+    if (width <= 0 || height <= 0)
+    {
+        return false;
+    }
+    if (bitmap != BITMAP_INVALID)
+    {
+        const Bitmap current(bitmap);
+        if (current.getWidth() == width && current.getHeight() == height)
+        {
+            return true;
+        }
+        DynamicBitmapArena::destroy(bitmap);
+        bitmap = BITMAP_INVALID;
+    }
+    bitmap = DynamicBitmapArena::create(width, height, Bitmap::RGB565, &bitmapMovedCallback);
+    if (bitmap == BITMAP_INVALID)
+    {
+        return false;
+    }
+    Bitmap::dynamicBitmapSetSolidRect(bitmap, Rect(0, 0, width, height));
+    dirty = true;
+    return true;
+}
+
+void StreamingGraphData::rasterize(uint16_t* pixels, int16_t width, uint32_t column) const
+{
+    int16_t top;
+    int16_t bottom;
+    span(column, top, bottom);
+    const uint16_t line = toRGB565(lineColor);
+    const uint16_t background = toRGB565(backgroundColor);
+    uint16_t* pixel = pixels + column % width;
+    for (int16_t y = 0; y < getHeight(); y++, pixel += width)
+    {
+        *pixel = (y >= top && y <= bottom) ? line : background;
+    }
+}
+
+void StreamingGraphData::drawPart(int16_t bitmapX, int16_t width, int16_t screenX, const Rect& invalidatedArea) const
+{
+    Rect area = Rect(screenX, 0, width, getHeight()) & invalidatedArea;
+    if (area.isEmpty())
+    {
+        return;
+    }
+    Rect abs(0, 0, 0, 0);
+    translateRectToAbsolute(abs);
+    // The part of the bitmap, drawn with its first column at screenX
+    const int16_t dx = screenX - bitmapX;
+    area.x -= dx;
+    HAL::lcd().drawPartialBitmap(Bitmap(bitmap), abs.x + dx, abs.y, area, 255);
+}
+
+void StreamingGraphData::drawDirect(const Rect& invalidatedArea) const
+{
+    Rect background = invalidatedArea & Rect(0, 0, getWidth(), getHeight());
+    if (background.isEmpty())
+    {
+        return;
+    }
+    translateRectToAbsolute(background);
+    HAL::lcd().fillRect(background, backgroundColor, 255);
+
+    const int16_t width = columnCount();
+    const uint32_t first = (numColumns > (uint32_t)width) ? numColumns - width : 0;
+    const int16_t right = getWidth();
+    for (uint32_t column = first; column < numColumns; column++)
+    {
+        const int16_t x = (int16_t)(right - (int16_t)(numColumns - column));
+        if (x < invalidatedArea.x || x >= invalidatedArea.right())
+        {
+            continue;
+        }
+        int16_t top;
+        int16_t bottom;
+        span(column, top, bottom);
+        Rect line = Rect(x, top, 1, bottom - top + 1) & invalidatedArea;
+        if (!line.isEmpty())
+        {
+            translateRectToAbsolute(line);
+            HAL::lcd().fillRect(line, lineColor, 255);
+        }
+    }
+}
+
+void StreamingGraphData::bitmapMoved(BitmapId /*oldId*/, BitmapId newId)
+{
+    bitmap = newId;
+}
@@ -0,0 +1,22 @@
+// Generated by gcc/mktsvg.py. Please, do not edit!
+
+#include <gui/common/TSVGDatabase.hpp>
+#include <touchgfx/hal/Config.hpp>
+
+namespace
+{
+const TSVGDatabase::TSVGData tsvgDatabase[] = { { 0, 0, 0, 0 } };
+} // namespace
+
+namespace TSVGDatabase
+{
+const TSVGData* getInstance()
+{
+    return tsvgDatabase;
+}
+
+uint16_t getInstanceSize()
+{
+    return NUMBER_OF_TSVG_IMAGES;
+}
+} // namespace TSVGDatabase
@@ -0,0 +1,87 @@
+#include <gui/common/TSVGImage.hpp>
+#include <gui/common/TargetHardware.hpp>
+#include <touchgfx/hal/HAL.hpp>
+#include <math.h>
+
+using namespace touchgfx;
+
+TSVGImage::TSVGImage()
+    : SVGImage(),
+      tsvgId(NUMBER_OF_TSVG_IMAGES),
+      smallTsvgId(NUMBER_OF_TSVG_IMAGES),
+      smallMaxSize(0)
+{
+}
+
+void TSVGImage::setTSVG(uint16_t id)
+{
+    tsvgId = id < TSVGDatabase::getInstanceSize() ? id : (uint16_t)NUMBER_OF_TSVG_IMAGES;
+    if (tsvgId == NUMBER_OF_TSVG_IMAGES)
+    {
+        return;
+    }
+    const TSVGDatabase::TSVGData& tsvg = TSVGDatabase::getInstance()[tsvgId];
+    if (getWidth() == 0 && getHeight() == 0 && tsvg.width > 0 && tsvg.height > 0)
+    {
+        setWidthHeight(tsvg.width, tsvg.height);
+    }
+}
+
+void TSVGImage::setSmallTSVG(uint16_t id, uint16_t maxSize)
+{
+    smallTsvgId = id < TSVGDatabase::getInstanceSize() ? id : (uint16_t)NUMBER_OF_TSVG_IMAGES;
+    smallMaxSize = maxSize;
+}
+
+void TSVGImage::draw(const Rect& invalidatedArea) const
+{
+    if (tsvgId != NUMBER_OF_TSVG_IMAGES)
+    {
+        Rect clip = invalidatedArea;
+        translateRectToAbsolute(clip);
+        Rect origin(0, 0, 0, 0);
+        translateRectToAbsolute(origin);
+        // The transformation of the SVG is relative to the widget
+        Matrix3x3 transform = getTransformationMatrix();
+        transform.translate((float)origin.x, (float)origin.y);
+        const TSVGDatabase::TSVGData* tsvg = &TSVGDatabase::getInstance()[tsvgId];
+        const float width = tsvg->width > 0 ? (float)tsvg->width : (float)getWidth();
+        const float height = tsvg->height > 0 ? (float)tsvg->height : (float)getHeight();
+        const float size = screenSize(transform, width, height);
+        if (smallTsvgId != NUMBER_OF_TSVG_IMAGES && size > 0.0f && size <= (float)smallMaxSize)
+        {
+            const TSVGDatabase::TSVGData& small = TSVGDatabase::getInstance()[smallTsvgId];
+            if (small.width > 0 && small.height > 0)
+            {
+                // Drawn in the box of the full image, so it stays in place
+                Matrix3x3 fit;
+                fit.scale(width / small.width, height / small.height);
+                transform = transform.multiply(fit);
+            }
+            tsvg = &small;
+        }
+        if (TargetHardware::drawTSVG(tsvg->data, transform, clip, size))
+        {
+            return;
+        }
+    }
+    if (svgId != SVG_INVALID)
+    {
+        SVGImage::draw(invalidatedArea);
+    }
+}
+
+float TSVGImage::screenSize(const Matrix3x3& transform, float width, float height) const
+{
+    if (width <= 0.0f || height <= 0.0f)
+    {
+        return 0.0f;
+    }
+    // The sides of the box transformed, rotated or skewed
+    const Matrix3x3::Point o = transform.affineTransform(0.0f, 0.0f);
+    const Matrix3x3::Point x = transform.affineTransform(width, 0.0f);
+    const Matrix3x3::Point y = transform.affineTransform(0.0f, height);
+    const float dx = fabsf(x.x - o.x) + fabsf(y.x - o.x);
+    const float dy = fabsf(x.y - o.y) + fabsf(y.y - o.y);
+    return MAX(dx, dy);
+}
@@ -0,0 +1,181 @@
+#include <gui/common/FastTextureMapper.hpp>
+#include <gui/common/TargetHardware.hpp>
+#include <gui/common/TextureMapperBatch.hpp>
+#include <touchgfx/TextureMapTypes.hpp>
+#include <touchgfx/Utils.hpp>
+#include <touchgfx/hal/HAL.hpp>
+#include <touchgfx/lcd/LCD.hpp>
+#include <touchgfx/transforms/DisplayTransformation.hpp>
+#include <math.h>
+#include <string.h>
+
+using namespace touchgfx;
+
+TextureMapperBatchData::Stats TextureMapperBatchData::stats;
+
+TextureMapperBatchData::TextureMapperBatchData(Sprite* spriteBuffer, float* cornerBuffer, uint16_t spriteCapacity)
+    : Widget(),
+      sprites(spriteBuffer),
+      corners(cornerBuffer),
+      capacity(spriteCapacity),
+      numSprites(0),
+      bitmap(),
+      alpha(255),
+      renderingAlgorithm(TextureMapper::NEAREST_NEIGHBOR)
+{
+    for (uint16_t i = 0; i < capacity; i++)
+    {
+        setSprite(i, 0.0f, 0.0f, 0.0f, 1.0f);
+    }
+}
+
+void TextureMapperBatchData::setBitmap(const Bitmap& newBitmap)
+{
+    bitmap = newBitmap;
+    for (uint16_t i = 0; i < capacity; i++)
+    {
+        transform(i);
+    }
+}
+
+void TextureMapperBatchData::setNumberOfSprites(uint16_t count)
+{
+    numSprites = MIN(count, capacity);
+}
+
+void TextureMapperBatchData::setSprite(uint16_t index, float x, float y, float angle, float scale)
+{
+    if (index >= capacity)
+    {
+        return;
+    }
+    Sprite& sprite = sprites[index];
+    sprite.x = x;
+    sprite.y = y;
+    sprite.angle = angle;
+    sprite.scale = scale;
+    transform(index);
+}
+
+void TextureMapperBatchData::updateSprite(uint16_t index, float x, float y, float angle, float scale)
+{
+    if (index >= capacity)
+    {
+        return;
+    }
+    Rect dirty = spriteBounds(index);
+    invalidateRect(dirty);
+    setSprite(index, x, y, angle, scale);
+    dirty = spriteBounds(index);
+    invalidateRect(dirty);
+}
+
+void TextureMapperBatchData::draw(const Rect& invalidatedArea) const
+{
+    if (alpha == 0 || numSprites == 0 || bitmap.getId() == BITMAP_INVALID)
+    {
+        return;
+    }
+    Rect origin(0, 0, 0, 0);
+    translateRectToAbsolute(origin);
+    Rect clip = invalidatedArea;
+    translateRectToAbsolute(clip);
+    if (TargetHardware::drawTextureQuads(bitmap, corners, numSprites, origin.x, origin.y, clip, alpha, renderingAlgorithm == TextureMapper::BILINEAR_INTERPOLATION))
+    {
+        stats.batches++;
+        stats.sprites += numSprites;
+        return;
+    }
+    for (uint16_t i = 0; i < numSprites; i++)
+    {
+        drawSprite(i, invalidatedArea);
+    }
+}
+
+void TextureMapperBatchData::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+void TextureMapperBatchData::transform(uint16_t index)
+{
+    stats.transforms++;
+    const Sprite& sprite = sprites[index];
+    const float halfWidth = (float)bitmap.getWidth() / 2.0f;
+    const float halfHeight = (float)bitmap.getHeight() / 2.0f;
+    float sine;
+    float cosine;
+    FastTextureMapper::sinCos(sprite.angle, sine, cosine);
+    sine *= sprite.scale;
+    cosine *= sprite.scale;
+
+    // The corners of the bitmap, from the top left, rotated around the center
+    const float u[4] = { -halfWidth, halfWidth, halfWidth, -halfWidth };
+    const float v[4] = { -halfHeight, -halfHeight, halfHeight, halfHeight };
+    float* const c = corners + index * 8;
+    for (int i = 0; i < 4; i++)
+    {
+        c[i * 2] = sprite.x + u[i] * cosine - v[i] * sine;
+        c[i * 2 + 1] = sprite.y + u[i] * sine + v[i] * cosine;
+    }
+}
+
+Rect TextureMapperBatchData::spriteBounds(uint16_t index) const
+{
+    const float* const c = corners + index * 8;
+    const float minX = floorf(MIN(MIN(c[0], c[2]), MIN(c[4], c[6])));
+    const float maxX = ceilf(MAX(MAX(c[0], c[2]), MAX(c[4], c[6])));
+    const float minY = floorf(MIN(MIN(c[1], c[3]), MIN(c[5], c[7])));
+    const float maxY = ceilf(MAX(MAX(c[1], c[3]), MAX(c[5], c[7])));
+    const Rect bounds((int16_t)minX, (int16_t)minY, (int16_t)(maxX - minX) + 1, (int16_t)(maxY - minY) + 1);
+    return bounds & Rect(0, 0, getWidth(), getHeight());
+}
+
+void TextureMapperBatchData::drawSprite(uint16_t index, const Rect& invalidatedArea) const
+{
+    // As TextureMapper::drawQuad(), one sweep as all corners are at the same depth
+    Rect dirtyArea = spriteBounds(index) & invalidatedArea;
+    if (dirtyArea.isEmpty())
+    {
+        return;
+    }
+    const uint16_t* const data = (const uint16_t*)bitmap.getData();
+    if (data == 0)
+    {
+        return;
+    }
+    stats.fallbacks++;
+    Rect dirtyAreaAbsolute = dirtyArea;
+    translateRectToAbsolute(dirtyAreaAbsolute);
+    Rect absoluteRect = getAbsoluteRect();
+    DisplayTransformation::transformDisplayToFrameBuffer(absoluteRect);
+    DisplayTransformation::transformDisplayToFrameBuffer(dirtyAreaAbsolute);
+
+    const float right = (float)bitmap.getWidth();
+    const float bottom = (float)bitmap.getHeight();
+    float u[4] = { 0.0f, right, right, 0.0f };
+    float v[4] = { 0.0f, 0.0f, bottom, bottom };
+    if (HAL::DISPLAY_ROTATION == rotate90)
+    {
+        // Bitmaps are stored rotated, as the framebuffer
+        const float ru[4] = { 0.0f, 0.0f, bottom, bottom };
+        const float rv[4] = { right, 0.0f, 0.0f, right };
+        memcpy(u, ru, sizeof(u));
+        memcpy(v, rv, sizeof(v));
+    }
+    const float* const c = corners + index * 8;
+    Point3D vertices[4];
+    for (int i = 0; i < 4; i++)
+    {
+        float x = c[i * 2];
+        float y = c[i * 2 + 1];
+        DisplayTransformation::transformDisplayToFrameBuffer(x, y, getRect());
+        const Point3D vertex = { floatToFixed28_4(x), floatToFixed28_4(y), 1.0f, u[i], v[i] };
+        vertices[i] = vertex;
+    }
+
+    const DrawingSurface dest = { 0, HAL::FRAME_BUFFER_WIDTH };
+    const TextureSurface src = { data, bitmap.getExtraData(), bitmap.getWidth(), bitmap.getHeight(), bitmap.getWidth() };
+    const RenderingVariant variant = (renderingAlgorithm == TextureMapper::NEAREST_NEIGHBOR) ? lookupNearestNeighborRenderVariant(bitmap) : lookupBilinearRenderVariant(bitmap);
+    HAL::lcd().drawTextureMapQuad(dest, vertices, src, absoluteRect, dirtyAreaAbsolute, variant, alpha, 0xFFFF);
+}
@@ -0,0 +1,350 @@
+#include <gui/common/DynamicBitmapArena.hpp>
+#include <gui/common/TargetHardware.hpp>
+#include <gui/common/TextureTransition.hpp>
+#include <touchgfx/EasingEquations.hpp>
+#include <touchgfx/containers/Container.hpp>
+#include <touchgfx/hal/HAL.hpp>
+#include <touchgfx/lcd/LCD.hpp>
+#include <string.h>
+
+using namespace touchgfx;
+
+namespace
+{
+uint16_t greatestCommonDivisor(uint16_t a, uint16_t b)
+{
+    while (b != 0)
+    {
+        const uint16_t r = a % b;
+        a = b;
+        b = r;
+    }
+    return a;
+}
+}
+
+TextureTransition::TextureTransition(Effect transitionEffect, Direction transitionDirection, uint8_t transitionDuration)
+    : Transition(),
+      layers(*this),
+      effect(transitionEffect),
+      direction(transitionDirection),
+      duration(transitionDuration > 0 ? transitionDuration : 1),
+      step(0),
+      progress(0),
+      oldLayer(BITMAP_INVALID),
+      newLayer(BITMAP_INVALID),
+      added(false),
+      blockSize(TEXTURE_TRANSITION_BLOCK_SIZE),
+      columns(0),
+      numBlocks(0),
+      blockStride(1)
+{
+    memset(revealed, 0, sizeof(revealed));
+
+    // The old screen is only left in the framebuffer, as in SlideTransition
+    const Rect screen(0, 0, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT);
+    oldLayer = DynamicBitmapArena::create(screen.width, screen.height, HAL::lcd().framebufferFormat());
+    if (oldLayer == BITMAP_INVALID)
+    {
+        done = true;
+        return;
+    }
+    HAL::lcd().copyFrameBufferRegionToMemory(screen, screen, oldLayer);
+}
+
+TextureTransition::~TextureTransition()
+{
+    release();
+}
+
+void TextureTransition::init()
+{
+    if (done)
+    {
+        return;
+    }
+    const Rect screen(0, 0, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT);
+    newLayer = DynamicBitmapArena::create(screen.width, screen.height, HAL::lcd().framebufferFormat());
+    if (newLayer == BITMAP_INVALID)
+    {
+        release();
+        done = true;
+        return;
+    }
+    // Rendered before the layers are added, the new screen is not drawn again until done
+    HAL::getInstance()->drawDrawableInDynamicBitmap(*screenContainer, newLayer);
+    layers.setPosition(screen.x, screen.y, screen.width, screen.height);
+    screenContainer->add(layers);
+    added = true;
+
+    if (effect == BLOCK)
+    {
+        setupBlocks();
+    }
+}
+
+void TextureTransition::handleTickEvent()
+{
+    if (done)
+    {
+        return;
+    }
+    step++;
+    if (step >= duration)
+    {
+        // The last frame is the new screen, drawn by its widgets from now on
+        release();
+        done = true;
+        screenContainer->invalidate();
+        return;
+    }
+
+    const bool fromLow = direction == EAST || direction == SOUTH;
+    const int16_t length = (direction == EAST || direction == WEST) ? HAL::DISPLAY_WIDTH : HAL::DISPLAY_HEIGHT;
+    switch (effect)
+    {
+    case BLOCK:
+        revealBlocks((uint16_t)((uint32_t)numBlocks * step / duration));
+        break;
+    case FADE:
+        progress = EasingEquations::linearEaseNone(step, 0, 255, duration);
+        layers.invalidate();
+        break;
+    case CUBE:
+    case INNER_CUBE:
+    case STACK:
+    case FADE_ZOOM:
+        progress = EasingEquations::cubicEaseInOut(step, 0, 1000, duration);
+        layers.invalidate();
+        break;
+    case SLIDE:
+        progress = EasingEquations::cubicEaseOut(step, 0, length, duration);
+        layers.invalidate();
+        break;
+    case COVER:
+    case WIPE:
+        {
+            // The old screen stays in place, only the new screen changes
+            const int16_t p = EasingEquations::cubicEaseOut(step, 0, length, duration);
+            Rect changed;
+            if (effect == COVER)
+            {
+                changed = segment(fromLow ? 0 : length - p, p);
+            }
+            else
+            {
+                changed = segment(fromLow ? progress : length - p, p - progress);
+            }
+            progress = p;
+            layers.invalidateRect(changed);
+        }
+        break;
+    }
+}
+
+void TextureTransition::tearDown()
+{
+    release();
+}
+
+void TextureTransition::drawLayers(const Rect& invalidatedArea) const
+{
+    const Rect screen(0, 0, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT);
+    switch (effect)
+    {
+    case BLOCK:
+        drawBlocks(invalidatedArea);
+        break;
+    case FADE:
+        drawLayer(oldLayer, screen, 0, 0, invalidatedArea, 255);
+        if (progress > 0)
+        {
+            drawLayer(newLayer, screen, 0, 0, invalidatedArea, (uint8_t)progress);
+        }
+        break;
+    case CUBE:
+    case INNER_CUBE:
+    case STACK:
+    case FADE_ZOOM:
+        drawGPU2D(invalidatedArea);
+        break;
+    case SLIDE:
+    case COVER:
+    case WIPE:
+        {
+            Rect oldVisible;
+            Rect newVisible;
+            int16_t oldOffset;
+            int16_t newOffset;
+            getLayout(progress, oldVisible, oldOffset, newVisible, newOffset);
+            const bool horizontal = direction == EAST || direction == WEST;
+            drawLayer(oldLayer, oldVisible, horizontal ? oldOffset : 0, horizontal ? 0 : oldOffset, invalidatedArea, 255);
+            drawLayer(newLayer, newVisible, horizontal ? newOffset : 0, horizontal ? 0 : newOffset, invalidatedArea, 255);
+        }
+        break;
+    }
+}
+
+void TextureTransition::drawLayer(BitmapId id, const Rect& visible, int16_t dx, int16_t dy, const Rect& invalidatedArea, uint8_t alpha) const
+{
+    Rect area = visible & invalidatedArea;
+    if (area.isEmpty())
+    {
+        return;
+    }
+    Rect abs(0, 0, 0, 0);
+    layers.translateRectToAbsolute(abs);
+    // The part of the snapshot, drawn dx, dy from where it was taken
+    area.x -= dx;
+    area.y -= dy;
+    HAL::lcd().drawPartialBitmap(Bitmap(id), abs.x + dx, abs.y + dy, area, alpha);
+}
+
+void TextureTransition::drawGPU2D(const Rect& invalidatedArea) const
+{
+    TargetHardware::TransitionEffect targetEffect = TargetHardware::TRANSITION_FADE_ZOOM;
+    switch (effect)
+    {
+    case CUBE:
+        targetEffect = TargetHardware::TRANSITION_CUBE;
+        break;
+    case INNER_CUBE:
+        targetEffect = TargetHardware::TRANSITION_INNER_CUBE;
+        break;
+    case STACK:
+        targetEffect = TargetHardware::TRANSITION_STACK;
+        break;
+    default:
+        break;
+    }
+    Rect clip = invalidatedArea;
+    layers.translateRectToAbsolute(clip);
+    const bool vertical = direction == NORTH || direction == SOUTH;
+    const bool reverse = direction == EAST || direction == SOUTH;
+    if (TargetHardware::drawTransition(targetEffect, vertical, reverse, Bitmap(oldLayer), Bitmap(newLayer), progress / 1000.0f, clip))
+    {
+        return;
+    }
+    // Without GPU2D the new screen fades in
+    const Rect screen(0, 0, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT);
+    drawLayer(oldLayer, screen, 0, 0, invalidatedArea, 255);
+    const uint8_t alpha = (uint8_t)(progress * 255 / 1000);
+    if (alpha > 0)
+    {
+        drawLayer(newLayer, screen, 0, 0, invalidatedArea, alpha);
+    }
+}
+
+void TextureTransition::drawBlocks(const Rect& invalidatedArea) const
+{
+    if (invalidatedArea.isEmpty())
+    {
+        return;
+    }
+    const uint16_t rows = (HAL::DISPLAY_HEIGHT + blockSize - 1) / blockSize;
+    const uint16_t firstRow = invalidatedArea.y / blockSize;
+    const uint16_t lastRow = MIN((invalidatedArea.bottom() - 1) / blockSize, rows - 1);
+    const uint16_t firstColumn = invalidatedArea.x / blockSize;
+    const uint16_t lastColumn = MIN((invalidatedArea.right() - 1) / blockSize, columns - 1);
+    for (uint16_t row = firstRow; row <= lastRow; row++)
+    {
+        // Neighbouring blocks of the same screen are one blit
+        uint16_t column = firstColumn;
+        while (column <= lastColumn)
+        {
+            const bool isNew = isRevealed(row * columns + column);
+            uint16_t end = column + 1;
+            while (end <= lastColumn && isRevealed(row * columns + end) == isNew)
+            {
+                end++;
+            }
+            const Rect run(column * blockSize, row * blockSize, (end - column) * blockSize, blockSize);
+            drawLayer(isNew ? newLayer : oldLayer, run, 0, 0, invalidatedArea, 255);
+            column = end;
+        }
+    }
+}
+
+void TextureTransition::getLayout(int16_t visibleNew, Rect& oldVisible, int16_t& oldOffset, Rect& newVisible, int16_t& newOffset) const
+{
+    const bool fromLow = direction == EAST || direction == SOUTH;
+    const int16_t length = (direction == EAST || direction == WEST) ? HAL::DISPLAY_WIDTH : HAL::DISPLAY_HEIGHT;
+    newVisible = segment(fromLow ? 0 : length - visibleNew, visibleNew);
+    oldVisible = segment(fromLow ? visibleNew : 0, length - visibleNew);
+    // Wiped screens stay in place, a covering screen moves, sliding screens both move
+    newOffset = (effect == WIPE) ? 0 : (fromLow ? visibleNew - length : length - visibleNew);
+    oldOffset = (effect == SLIDE) ? (fromLow ? visibleNew : -visibleNew) : 0;
+}
+
+Rect TextureTransition::segment(int16_t start, int16_t length) const
+{
+    if (direction == EAST || direction == WEST)
+    {
+        return Rect(start, 0, length, HAL::DISPLAY_HEIGHT);
+    }
+    return Rect(0, start, HAL::DISPLAY_WIDTH, length);
+}
+
+Rect TextureTransition::block(uint16_t index) const
+{
+    const Rect cell((index % columns) * blockSize, (index / columns) * blockSize, blockSize, blockSize);
+    return cell & Rect(0, 0, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT);
+}
+
+void TextureTransition::setupBlocks()
+{
+    blockSize = TEXTURE_TRANSITION_BLOCK_SIZE;
+    for (;;)
+    {
+        columns = (HAL::DISPLAY_WIDTH + blockSize - 1) / blockSize;
+        const uint16_t rows = (HAL::DISPLAY_HEIGHT + blockSize - 1) / blockSize;
+        if (columns * rows <= TEXTURE_TRANSITION_MAX_BLOCKS)
+        {
+            numBlocks = columns * rows;
+            break;
+        }
+        blockSize *= 2;
+    }
+    // A stride near the golden section of the blocks scatters them, and visits every block
+    // when it has no factor in common with the number of blocks
+    blockStride = (uint16_t)(numBlocks * 618U / 1000U);
+    while (blockStride > 1 && greatestCommonDivisor(numBlocks, blockStride) != 1)
+    {
+        blockStride--;
+    }
+    if (blockStride == 0)
+    {
+        blockStride = 1;
+    }
+    memset(revealed, 0, sizeof(revealed));
+}
+
+void TextureTransition::revealBlocks(uint16_t count)
+{
+    for (; progress < (int16_t)count; progress++)
+    {
+        const uint16_t index = (uint16_t)(((uint32_t)progress * blockStride) % numBlocks);
+        revealed[index >> 3] |= (uint8_t)(1U << (index & 7));
+        Rect changed = block(index);
+        layers.invalidateRect(changed);
+    }
+}
+
+void TextureTransition::release()
+{
+    if (added)
+    {
+        screenContainer->remove(layers);
+        added = false;
+    }
+    if (oldLayer != BITMAP_INVALID)
+    {
+        DynamicBitmapArena::destroy(oldLayer);
+        oldLayer = BITMAP_INVALID;
+    }
+    if (newLayer != BITMAP_INVALID)
+    {
+        DynamicBitmapArena::destroy(newLayer);
+        newLayer = BITMAP_INVALID;
+    }
+}
@@ -0,0 +1,134 @@
+#include <gui/common/TimerRegistry.hpp>
+#include <touchgfx/hal/HAL.hpp>
+
+TimerRegistry* TimerRegistry::instance = 0;
+
+TimerRegistry::TimerRegistry()
+    : ticks(0), count(0)
+{
+    for (uint16_t i = 0; i < TIMER_REGISTRY_SLOTS; i++)
+    {
+        slots[i].prev = &slots[i];
+        slots[i].next = &slots[i];
+    }
+    resetStats();
+    instance = this;
+}
+
+void TimerRegistry::start(Timer& timer, touchgfx::Drawable& widget, uint16_t divisor)
+{
+    timer.stop();
+    timer.widget = &widget;
+    timer.divisor = divisor > 0 ? divisor : 1;
+    schedule(timer, timer.divisor);
+    count++;
+}
+
+void TimerRegistry::stop(Timer& timer)
+{
+    unlink(timer);
+    count--;
+}
+
+void TimerRegistry::tick()
+{
+    ticks++;
+    Link& slot = slots[ticks % TIMER_REGISTRY_SLOTS];
+    if (slot.next == &slot)
+    {
+        return;
+    }
+
+    // Moved out of the slot first, so timers rescheduled into it wait for the next turn
+    Link due;
+    due.next = slot.next;
+    due.prev = slot.prev;
+    due.next->prev = &due;
+    due.prev->next = &due;
+    slot.next = &slot;
+    slot.prev = &slot;
+
+    while (due.next != &due)
+    {
+        Timer& timer = static_cast<Timer&>(*due.next);
+        unlink(timer);
+        if (timer.rounds > 0)
+        {
+            timer.rounds--;
+            link(slot, timer);
+            continue;
+        }
+        schedule(timer, timer.divisor);
+        if (!timer.whenHidden && !isOnScreen(*timer.widget))
+        {
+            // Resumes on the first tick due while it can be seen
+            stats.suppressed++;
+            continue;
+        }
+        stats.ticked++;
+        // May stop or restart any timer, including the ones still due
+        timer.widget->handleTickEvent();
+    }
+}
+
+void TimerRegistry::clear()
+{
+    for (uint16_t i = 0; i < TIMER_REGISTRY_SLOTS; i++)
+    {
+        Link& slot = slots[i];
+        while (slot.next != &slot)
+        {
+            unlink(*slot.next);
+        }
+    }
+    count = 0;
+}
+
+bool TimerRegistry::isOnScreen(const touchgfx::Drawable& drawable)
+{
+    if (!drawable.isVisible())
+    {
+        return false;
+    }
+    // The rect of the drawable clipped to each parent, in the coordinates of the parent
+    touchgfx::Rect area = drawable.getRect();
+    for (const touchgfx::Drawable* parent = drawable.getParent(); parent != 0; parent = parent->getParent())
+    {
+        if (!parent->isVisible())
+        {
+            return false;
+        }
+        area &= touchgfx::Rect(0, 0, parent->getWidth(), parent->getHeight());
+        if (area.isEmpty())
+        {
+            return false;
+        }
+        area.x += parent->getX();
+        area.y += parent->getY();
+    }
+    area &= touchgfx::Rect(0, 0, touchgfx::HAL::DISPLAY_WIDTH, touchgfx::HAL::DISPLAY_HEIGHT);
+    return !area.isEmpty();
+}
+
+void TimerRegistry::schedule(Timer& timer, uint16_t delay)
+{
+    // The slot of a tick is visited again TIMER_REGISTRY_SLOTS ticks later
+    timer.rounds = (delay - 1) / TIMER_REGISTRY_SLOTS;
+    link(slots[(ticks + delay) % TIMER_REGISTRY_SLOTS], timer);
+}
+
+void TimerRegistry::link(Link& head, Link& link)
+{
+    link.prev = head.prev;
+    link.next = &head;
+    head.prev->next = &link;
+    head.prev = &link;
+}
+
+void TimerRegistry::unlink(Link& link)
+{
+    link.prev->next = link.next;
+    link.next->prev = link.prev;
+    link.prev = 0;
+    link.next = 0;
+}
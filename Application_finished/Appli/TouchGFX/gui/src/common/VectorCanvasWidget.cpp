@@ -0,0 +1,247 @@
+#include <gui/common/VectorCanvasWidget.hpp>
+#include <gui/common/TargetHardware.hpp>
+#include <touchgfx/hal/HAL.hpp>
+#include <math.h>
+
+using namespace touchgfx;
+
+namespace
+{
+const float DEG_TO_RAD = 3.14159265f / 180.0f;
+}
+
+void VectorCanvasPath::moveTo(float x, float y)
+{
+    if (reserve(1, 2))
+    {
+        cmds[numCmds++] = VECTOR_PRIM_MOVE;
+        points[numPoints++] = x;
+        points[numPoints++] = y;
+    }
+}
+
+void VectorCanvasPath::lineTo(float x, float y)
+{
+    if (reserve(1, 2))
+    {
+        cmds[numCmds++] = VECTOR_PRIM_LINE;
+        points[numPoints++] = x;
+        points[numPoints++] = y;
+    }
+}
+
+void VectorCanvasPath::cubicTo(float x1, float y1, float x2, float y2, float x, float y)
+{
+    if (reserve(1, 6))
+    {
+        cmds[numCmds++] = VECTOR_PRIM_BEZIER_CUBIC;
+        points[numPoints++] = x1;
+        points[numPoints++] = y1;
+        points[numPoints++] = x2;
+        points[numPoints++] = y2;
+        points[numPoints++] = x;
+        points[numPoints++] = y;
+    }
+}
+
+void VectorCanvasPath::close()
+{
+    if (reserve(1, 0))
+    {
+        cmds[numCmds++] = VECTOR_PRIM_CLOSE;
+    }
+}
+
+void VectorCanvasPath::arc(float cx, float cy, float r, float startAngle, float endAngle, bool connect)
+{
+    // A point at angle a is (cx + r sin(a), cy - r cos(a)), its tangent (cos(a), sin(a))
+    float a0 = startAngle * DEG_TO_RAD;
+    const float sx = cx + r * sinf(a0);
+    const float sy = cy - r * cosf(a0);
+    if (connect)
+    {
+        lineTo(sx, sy);
+    }
+    else
+    {
+        moveTo(sx, sy);
+    }
+
+    // One cubic per quarter circle at most
+    const float sweep = (endAngle - startAngle) * DEG_TO_RAD;
+    const int segments = MAX(1, (int)ceilf(fabsf(sweep) / (90.0f * DEG_TO_RAD) - 0.001f));
+    const float step = sweep / segments;
+    const float k = r * 4.0f / 3.0f * tanf(step / 4.0f);
+    float x0 = sx;
+    float y0 = sy;
+    for (int i = 0; i < segments; i++)
+    {
+        const float a1 = a0 + step;
+        const float x1 = cx + r * sinf(a1);
+        const float y1 = cy - r * cosf(a1);
+        cubicTo(x0 + k * cosf(a0), y0 + k * sinf(a0), x1 - k * cosf(a1), y1 - k * sinf(a1), x1, y1);
+        x0 = x1;
+        y0 = y1;
+        a0 = a1;
+    }
+}
+
+bool VectorCanvasPath::canDraw()
+{
+    // The auxiliary LCD renders in software, see TouchGFXHAL::activateNeoChrom()
+    return TargetHardware::isAccelerated()
+           && HAL::DISPLAY_ROTATION == rotate0
+           && &HAL::lcd() != HAL::getInstance()->getAuxiliaryLCD()
+           && VectorRenderer::getInstance() != 0;
+}
+
+void VectorCanvasPath::draw(VectorRenderer& renderer) const
+{
+    float bbox[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    // Control points are included, the curves stay inside their hull
+    for (uint16_t i = 0; i + 1 < numPoints; i += 2)
+    {
+        const float x = points[i];
+        const float y = points[i + 1];
+        if (i == 0 || x < bbox[0])
+        {
+            bbox[0] = x;
+        }
+        if (i == 0 || y < bbox[1])
+        {
+            bbox[1] = y;
+        }
+        if (i == 0 || x > bbox[2])
+        {
+            bbox[2] = x;
+        }
+        if (i == 0 || y > bbox[3])
+        {
+            bbox[3] = y;
+        }
+    }
+    renderer.drawPath(cmds, numCmds, points, numPoints, bbox);
+}
+
+bool VectorCanvasPath::reserve(uint16_t cmdCount, uint16_t pointCount)
+{
+    if (numCmds + cmdCount > VECTOR_CANVAS_POINTS || numPoints + pointCount > VECTOR_CANVAS_POINTS * 2)
+    {
+        overflowed = true;
+        return false;
+    }
+    return true;
+}
+
+bool VectorCircle::buildPath(VectorCanvasPath& path, VectorRenderer::DrawMode& mode) const
+{
+    float cx;
+    float cy;
+    float radius;
+    float lineWidth;
+    float arcStart;
+    float arcEnd;
+    getCenter(cx, cy);
+    getRadius(radius);
+    getLineWidth(lineWidth);
+    getArc(arcStart, arcEnd);
+    if (arcStart > arcEnd)
+    {
+        const float tmp = arcStart;
+        arcStart = arcEnd;
+        arcEnd = tmp;
+    }
+    const bool whole = (arcEnd - arcStart >= 360.0f);
+    if (whole)
+    {
+        arcStart = 0.0f;
+        arcEnd = 360.0f;
+    }
+    if (arcEnd == arcStart) //lint !e777
+    {
+        return false;
+    }
+
+    if (lineWidth == 0.0f) //lint !e777
+    {
+        // Filled circle or pie
+        if (whole)
+        {
+            path.arc(cx, cy, radius, arcStart, arcEnd, false);
+        }
+        else
+        {
+            path.moveTo(cx, cy);
+            path.arc(cx, cy, radius, arcStart, arcEnd, true);
+        }
+        path.close();
+        mode = VectorRenderer::FILL_NON_ZERO;
+        return true;
+    }
+
+    // As Circle, a line wider than the circle fills it from the center
+    if (lineWidth > radius * 2.0f)
+    {
+        lineWidth = radius + lineWidth / 2.0f;
+        radius = lineWidth / 2.0f;
+    }
+    path.arc(cx, cy, radius, arcStart, arcEnd, false);
+    if (whole)
+    {
+        path.close();
+    }
+    mode = VectorRenderer::STROKE;
+    return true;
+}
+
+void VectorCircle::setupStroke(VectorRenderer& renderer) const
+{
+    float radius;
+    float lineWidth;
+    getRadius(radius);
+    getLineWidth(lineWidth);
+    if (lineWidth > radius * 2.0f)
+    {
+        lineWidth = radius + lineWidth / 2.0f;
+    }
+    renderer.setStrokeWidth(lineWidth);
+    // Circle draws a flat cap when its cap precision is 180 degrees
+    renderer.setStrokeLineCap(getCapPrecision() >= 180 ? VG_STROKE_LINECAP_BUTT : VG_STROKE_LINECAP_ROUND);
+    renderer.setStrokeLineJoin(VG_STROKE_LINEJOIN_ROUND);
+}
+
+bool VectorLine::buildPath(VectorCanvasPath& path, VectorRenderer::DrawMode& mode) const
+{
+    float x0;
+    float y0;
+    float x1;
+    float y1;
+    getStart(x0, y0);
+    getEnd(x1, y1);
+    if (getLineWidth<float>() == 0.0f) //lint !e777
+    {
+        return false;
+    }
+    path.moveTo(x0, y0);
+    path.lineTo(x1, y1);
+    mode = VectorRenderer::STROKE;
+    return true;
+}
+
+void VectorLine::setupStroke(VectorRenderer& renderer) const
+{
+    renderer.setStrokeWidth(getLineWidth<float>());
+    switch (getLineEndingStyle())
+    {
+    case ROUND_CAP_ENDING:
+        renderer.setStrokeLineCap(VG_STROKE_LINECAP_ROUND);
+        break;
+    case SQUARE_CAP_ENDING:
+        renderer.setStrokeLineCap(VG_STROKE_LINECAP_SQUARE);
+        break;
+    case BUTT_CAP_ENDING:
+    default:
+        renderer.setStrokeLineCap(VG_STROKE_LINECAP_BUTT);
+        break;
+    }
+}
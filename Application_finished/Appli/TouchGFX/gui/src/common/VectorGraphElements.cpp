@@ -0,0 +1,245 @@
+#include <gui/common/VectorGraphElements.hpp>
+#include <string.h>
+
+using namespace touchgfx;
+
+namespace
+{
+// Shared by all elements, the renderer has drawn a path when drawPath() returns
+uint8_t pathCmds[VECTOR_GRAPH_POINTS];
+float pathPoints[VECTOR_GRAPH_POINTS * 2];
+}
+
+VectorGraphPath::Stats VectorGraphPath::stats;
+
+void VectorGraphPath::moveTo(CWRUtil::Q5 x, CWRUtil::Q5 y)
+{
+    add(VECTOR_PRIM_MOVE, x, y);
+}
+
+void VectorGraphPath::lineTo(CWRUtil::Q5 x, CWRUtil::Q5 y)
+{
+    add(VECTOR_PRIM_LINE, x, y);
+}
+
+void VectorGraphPath::close()
+{
+    if (reserve(1, 0))
+    {
+        pathCmds[numCmds++] = VECTOR_PRIM_CLOSE;
+    }
+}
+
+void VectorGraphPath::draw(VectorRenderer& renderer) const
+{
+    stats.paths++;
+    stats.points += numPoints / 2;
+    renderer.drawPath(pathCmds, numCmds, pathPoints, numPoints, bbox);
+}
+
+void VectorGraphPath::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+bool VectorGraphPath::reserve(uint16_t cmdCount, uint16_t pointCount)
+{
+    if (numCmds + cmdCount > VECTOR_GRAPH_POINTS || numPoints + pointCount > VECTOR_GRAPH_POINTS * 2)
+    {
+        overflowed = true;
+        return false;
+    }
+    return true;
+}
+
+void VectorGraphPath::add(uint8_t cmd, CWRUtil::Q5 x, CWRUtil::Q5 y)
+{
+    if (!reserve(1, 2))
+    {
+        return;
+    }
+    const float fx = x.to<float>();
+    const float fy = y.to<float>();
+    if (numPoints == 0)
+    {
+        bbox[0] = bbox[2] = fx;
+        bbox[1] = bbox[3] = fy;
+    }
+    else
+    {
+        bbox[0] = MIN(bbox[0], fx);
+        bbox[1] = MIN(bbox[1], fy);
+        bbox[2] = MAX(bbox[2], fx);
+        bbox[3] = MAX(bbox[3], fy);
+    }
+    pathCmds[numCmds++] = cmd;
+    pathPoints[numPoints++] = fx;
+    pathPoints[numPoints++] = fy;
+}
+
+bool VectorGraphElementLine::buildPath(const AbstractDataGraph* graph, const Rect& invalidatedArea, VectorGraphPath& path, VectorRenderer::DrawMode& mode, Rect& clip) const
+{
+    // As GraphElementLine::drawCanvasWidget()
+    if (graph->getUsedCapacity() <= 1)
+    {
+        return false;
+    }
+    const CWRUtil::Q5 lineWidthQ5 = CWRUtil::toQ5(lineWidth);
+    const uint16_t lineWidthHalf = CWRUtil::Q5(((int)lineWidthQ5 + 1) / 2).ceil();
+    int16_t indexMin;
+    int16_t indexMax;
+    if (!xScreenRangeToIndexRange(graph, invalidatedArea.x - lineWidthHalf, invalidatedArea.right() + lineWidthHalf, indexMin, indexMax))
+    {
+        return false;
+    }
+    clip = Rect(0, graph->getGraphAreaPaddingTop(), graph->getGraphAreaWidthIncludingPadding(), graph->getGraphAreaHeight()) & invalidatedArea;
+
+    const int16_t gapIndex = graph->getGapBeforeIndex();
+    if (gapIndex <= 0 || gapIndex <= indexMin || gapIndex > indexMax)
+    {
+        addIndexRange(graph, indexMin, indexMax, path);
+    }
+    else
+    {
+        addIndexRange(graph, indexMin, gapIndex - 1, path);
+        addIndexRange(graph, gapIndex, indexMax, path);
+    }
+    mode = VectorRenderer::STROKE;
+    return true;
+}
+
+void VectorGraphElementLine::setupStroke(VectorRenderer& renderer) const
+{
+    renderer.setStrokeWidth((float)lineWidth);
+    renderer.setStrokeLineCap(VG_STROKE_LINECAP_BUTT);
+    renderer.setStrokeLineJoin(VG_STROKE_LINEJOIN_BEVEL);
+}
+
+void VectorGraphElementLine::addIndexRange(const AbstractDataGraph* graph, int16_t indexMin, int16_t indexMax, VectorGraphPath& path) const
+{
+    if (indexMin == indexMax)
+    {
+        return;
+    }
+    path.moveTo(roundQ5(indexToScreenXQ5(graph, indexMin)), roundQ5(indexToScreenYQ5(graph, indexMin)));
+    for (int16_t index = indexMin + 1; index <= indexMax; index++)
+    {
+        path.lineTo(roundQ5(indexToScreenXQ5(graph, index)), roundQ5(indexToScreenYQ5(graph, index)));
+    }
+}
+
+bool VectorGraphElementArea::buildPath(const AbstractDataGraph* graph, const Rect& invalidatedArea, VectorGraphPath& path, VectorRenderer::DrawMode& mode, Rect& clip) const
+{
+    // As GraphElementArea::drawCanvasWidget()
+    if (graph->getUsedCapacity() <= 1)
+    {
+        return false;
+    }
+    int16_t indexMin;
+    int16_t indexMax;
+    if (!xScreenRangeToIndexRange(graph, invalidatedArea.x, invalidatedArea.right(), indexMin, indexMax))
+    {
+        return false;
+    }
+
+    const int16_t gapIndex = graph->getGapBeforeIndex();
+    const int baseline = convertToGraphScaleY(graph, yBaseline, dataScale);
+    const CWRUtil::Q5 screenYbaseQ5 = roundQ5(valueToScreenYQ5(graph, baseline));
+    if (indexMin + 1 == gapIndex)
+    {
+        if (indexMin > 0)
+        {
+            indexMin--; // The last segment before the gap
+        }
+        else
+        {
+            indexMin++; // Not a single point
+        }
+    }
+    clip = Rect(graph->getGraphAreaPaddingLeft(), graph->getGraphAreaPaddingTop(), graph->getGraphAreaWidth(), graph->getGraphAreaHeight()) & invalidatedArea;
+
+    CWRUtil::Q5 screenXQ5 = roundQ5(indexToScreenXQ5(graph, indexMin));
+    path.moveTo(screenXQ5, screenYbaseQ5);
+    for (int16_t index = indexMin; index <= indexMax; index++)
+    {
+        if (index == gapIndex)
+        {
+            path.lineTo(screenXQ5, screenYbaseQ5);
+            screenXQ5 = roundQ5(indexToScreenXQ5(graph, index));
+            path.lineTo(screenXQ5, screenYbaseQ5);
+        }
+        else
+        {
+            screenXQ5 = roundQ5(indexToScreenXQ5(graph, index));
+        }
+        path.lineTo(screenXQ5, roundQ5(indexToScreenYQ5(graph, index)));
+    }
+    path.lineTo(screenXQ5, screenYbaseQ5);
+    path.close();
+    mode = VectorRenderer::FILL_NON_ZERO;
+    return true;
+}
+
+bool VectorGraphElementDots::buildPath(const AbstractDataGraph* graph, const Rect& invalidatedArea, VectorGraphPath& path, VectorRenderer::DrawMode& mode, Rect& clip) const
+{
+    // As GraphElementDots::drawCanvasWidget()
+    if (graph->getUsedCapacity() == 0)
+    {
+        return false;
+    }
+    const CWRUtil::Q5 dotWidthQ5 = CWRUtil::toQ5(dotWidth);
+    const CWRUtil::Q5 dotWidth3Q5 = CWRUtil::muldivQ5(dotWidthQ5, CWRUtil::toQ5(3), CWRUtil::toQ5(10));
+    const CWRUtil::Q5 dotWidth4Q5 = CWRUtil::muldivQ5(dotWidthQ5, CWRUtil::toQ5(4), CWRUtil::toQ5(10));
+    const CWRUtil::Q5 dotWidth7Q5 = CWRUtil::muldivQ5(dotWidthQ5, CWRUtil::toQ5(7), CWRUtil::toQ5(50));
+    const CWRUtil::Q5 dotWidth24Q5 = CWRUtil::muldivQ5(dotWidthQ5, CWRUtil::toQ5(24), CWRUtil::toQ5(50));
+    const CWRUtil::Q5 dotWidth2Q5 = CWRUtil::muldivQ5(dotWidthQ5, CWRUtil::toQ5(1), CWRUtil::toQ5(2));
+    const uint16_t dotWidthHalf = CWRUtil::Q5(((int)dotWidthQ5 + 1) / 2).ceil();
+    int16_t indexMin;
+    int16_t indexMax;
+    if (!xScreenRangeToIndexRange(graph, invalidatedArea.x - dotWidthHalf, invalidatedArea.right() + dotWidthHalf, indexMin, indexMax))
+    {
+        return false;
+    }
+    clip = invalidatedArea;
+
+    // Offsets of the corners from the center, a 20-gon for big dots and a 12-gon otherwise
+    const CWRUtil::Q5 zero = CWRUtil::toQ5(0);
+    const CWRUtil::Q5 big[20][2] = {
+        { -dotWidth2Q5, zero }, { -dotWidth24Q5, -dotWidth7Q5 }, { -dotWidth4Q5, -dotWidth3Q5 }, { -dotWidth3Q5, -dotWidth4Q5 }, { -dotWidth7Q5, -dotWidth24Q5 },
+        { zero, -dotWidth2Q5 }, { dotWidth7Q5, -dotWidth24Q5 }, { dotWidth3Q5, -dotWidth4Q5 }, { dotWidth4Q5, -dotWidth3Q5 }, { dotWidth24Q5, -dotWidth7Q5 },
+        { dotWidth2Q5, zero }, { dotWidth24Q5, dotWidth7Q5 }, { dotWidth4Q5, dotWidth3Q5 }, { dotWidth3Q5, dotWidth4Q5 }, { dotWidth7Q5, dotWidth24Q5 },
+        { zero, dotWidth2Q5 }, { -dotWidth7Q5, dotWidth24Q5 }, { -dotWidth3Q5, dotWidth4Q5 }, { -dotWidth4Q5, dotWidth3Q5 }, { -dotWidth24Q5, dotWidth7Q5 }
+    };
+    const CWRUtil::Q5 small[12][2] = {
+        { -dotWidth2Q5, zero }, { -dotWidth4Q5, -dotWidth3Q5 }, { -dotWidth3Q5, -dotWidth4Q5 },
+        { zero, -dotWidth2Q5 }, { dotWidth3Q5, -dotWidth4Q5 }, { dotWidth4Q5, -dotWidth3Q5 },
+        { dotWidth2Q5, zero }, { dotWidth4Q5, dotWidth3Q5 }, { dotWidth3Q5, dotWidth4Q5 },
+        { zero, dotWidth2Q5 }, { -dotWidth3Q5, dotWidth4Q5 }, { -dotWidth4Q5, dotWidth3Q5 }
+    };
+    const bool bigDots = (dotWidth > 6);
+    const CWRUtil::Q5(*corners)[2] = bigDots ? big : small;
+    const int numCorners = bigDots ? 20 : 12;
+
+    for (int16_t index = indexMin; index <= indexMax; index++)
+    {
+        if (isCenterInvisible(graph, index))
+        {
+            continue;
+        }
+        const CWRUtil::Q5 screenXcenterQ5 = roundQ5(indexToScreenXQ5(graph, index));
+        const CWRUtil::Q5 screenYcenterQ5 = roundQ5(indexToScreenYQ5(graph, index));
+        const Rect dirty(rectAround(screenXcenterQ5, screenYcenterQ5, dotWidthQ5) & invalidatedArea);
+        if (dirty.isEmpty())
+        {
+            continue;
+        }
+        path.moveTo(screenXcenterQ5 + corners[0][0], screenYcenterQ5 + corners[0][1]);
+        for (int i = 1; i < numCorners; i++)
+        {
+            path.lineTo(screenXcenterQ5 + corners[i][0], screenYcenterQ5 + corners[i][1]);
+        }
+        path.close();
+    }
+    mode = VectorRenderer::FILL_NON_ZERO;
+    return true;
+}
@@ -1,12 +1,55 @@
 #include <gui/model/Model.hpp>
 #include <gui/model/ModelListener.hpp>
+#include <gui/common/TargetHardware.hpp>
 
-Model::Model() : modelListener(0)
+namespace
 {
+// Handed between modelTask and the TouchGFX task, the simulator computes them when requested
+ModelState states[3];
 
+void workInModelTask(void* context, void* slot, uint32_t tick)
+{
+    static_cast<Model*>(context)->work(*static_cast<ModelState*>(slot), tick);
+}
+
+void receiveInModel(void* context, uint16_t topic, const void* data, uint16_t size)
+{
+    static_cast<Model*>(context)->receive(topic, data, size);
+}
+}
+
+Model::Model() : modelListener(0), ticks(0), state(&states[0]), received(0)
+{
+    TargetHardware::startModelWorker(workInModelTask, this, states, sizeof(ModelState));
 }
 
 void Model::tick()
 {
+    ticks++;
+    // The state for the next tick is computed while this one is drawn
+    const ModelState* const next = static_cast<const ModelState*>(TargetHardware::acquireModelState());
+    TargetHardware::requestModelState(ticks + 1);
+    if (next == 0)
+    {
+        return;
+    }
+    state = next;
+    if (modelListener != 0)
+    {
+        modelListener->modelStateChanged(*state);
+    }
+}
+
+void Model::work(ModelState& next, uint32_t tick)
+{
+    // All the messages since the last tick in one batch, so the screen changes once per frame
+    TargetHardware::drainModelMessages(receiveInModel, this);
+    next.tick = tick;
+    next.messages = received;
+    received = 0;
+}
 
+void Model::receive(uint16_t topic, const void* data, uint16_t size)
+{
+    received++;
 }
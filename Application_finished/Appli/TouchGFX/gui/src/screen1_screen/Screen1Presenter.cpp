@@ -16,3 +16,8 @@ void Screen1Presenter::deactivate()
 {
 
 }
+
+void Screen1Presenter::modelStateChanged(const ModelState& state)
+{
+    view.postUpdate(UPDATE_MODEL_STATE, state);
+}
@@ -1,16 +1,209 @@
 #include <gui/screen1_screen/Screen1View.hpp>
+#include <gui/common/TargetHardware.hpp>
+#include <touchgfx/Color.hpp>
+#include <touchgfx/hal/Config.hpp>
 
-Screen1View::Screen1View()
+#if ROTATED_SPRITE_CACHE
+LOCATION_PRAGMA_NOLOAD("TouchGFX_SpriteCache")
+uint32_t spriteCache[ROTATED_SPRITE_CACHE_SIZE / 4] LOCATION_ATTRIBUTE_NOLOAD("TouchGFX_SpriteCache");
+#endif
+
+Screen1View::Screen1View() :
+    sceneCallback(this, &Screen1View::resetScene),
+    updateCallback(this, &Screen1View::applyUpdate)
 {
+    shownState.tick = 0;
+    shownState.messages = 0;
 
 }
 
 void Screen1View::setupScreen()
 {
+    // Before the functions run from the overlay are called
+    ScreenOverlay::load(ScreenOverlay::SCREEN1);
     Screen1ViewBase::setupScreen();
+    if (!WarmScreens::isResumed())
+    {
+        buildScene();
+    }
+    TargetHardware::setBenchmarkSceneCallback(&sceneCallback);
+    // Redrawn every frame, RGB565 halves the PSRAM traffic of the texture mappers
+    TargetHardware::setFrameBufferFormat(touchgfx::Bitmap::RGB565);
+    // Both texture mappers keep rotating the logo, sample it from AXI SRAM instead of flash,
+    // premultiplied so GPU2D blends it without multiplying by alpha and filters it without
+    // a dark fringe. A resumed screen still draws the copy.
+#if !ROTATED_SPRITE_CACHE
+    const touchgfx::BitmapId logo = TargetHardware::cacheTexturePremultiplied(mapper1.getBitmap());
+#else
+    // The sprites are rendered from the logo with straight alpha
+    const touchgfx::BitmapId logo = touchgfx::BITMAP_INVALID;
+#endif
+    if (logo != touchgfx::BITMAP_INVALID)
+    {
+        mapper1.setBitmap(touchgfx::Bitmap(logo));
+        mapper2.setBitmap(touchgfx::Bitmap(logo));
+    }
+    else
+    {
+        TargetHardware::cacheTextureRotated(mapper1.getBitmap());
+    }
+    // Generated from the cached copy, sampled whenever the logo is drawn smaller than 1:1
+    TargetHardware::generateMipChain(mapper1.getBitmap());
+    // Scanned out from flash below the framebuffer, only the color key is drawn behind the widgets
+    if (TargetHardware::pinBackgroundLayer(image2.getBitmap()))
+    {
+        image2.setVisible(false);
+        __background.setColor(TargetHardware::getBackgroundColorKey());
+    }
+    if (TargetHardware::hasOverlayLayer())
+    {
+        // Still touchable, but only drawn on the overlay
+        toggleButton1.setAlpha(0);
+        updateOverlay();
+    }
+#if OCCLUSION_DRAWING
+    // Last, as the layers above decide what is opaque
+    culler.cull(getRootContainer());
+#else
+    useSMOCDrawing(false);
+#endif
+    // The first frame draws the background and the first logo, the second logo and the
+    // button follow. Not deferred when hidden behind its sprite.
+    ProgressivePaint* const progressive = ProgressivePaint::getInstance();
+    progressive->defer(mapper2, 0);
+    progressive->defer(toggleButton1, 1);
+    // The bitmaps of the first frame, loaded while another screen is idle before Screen1
+    // is entered again
+    NavigationPrefetch* const prefetch = NavigationPrefetch::getInstance();
+    if (!prefetch->hasAssets(NavigationPrefetch::SCREEN1))
+    {
+        prefetch->addBitmap(NavigationPrefetch::SCREEN1, image1.getBitmap());
+        prefetch->addBitmap(NavigationPrefetch::SCREEN1, image2.getBitmap());
+        // The logo in flash, the mappers may draw its premultiplied copy
+        prefetch->addBitmap(NavigationPrefetch::SCREEN1, textureMapper1.getBitmap());
+        prefetch->addBitmap(NavigationPrefetch::SCREEN1, toggleButton1.getCurrentlyDisplayedBitmap());
+    }
+    prefetch->entered(NavigationPrefetch::SCREEN1);
 }
 
 void Screen1View::tearDownScreen()
 {
+    culler.restore();
+    // A resumed screen is brought up to date by the next state of the model
+    updates.clear();
+    TargetHardware::setBenchmarkSceneCallback(0);
+    TargetHardware::hideOverlayLayer();
+    TargetHardware::unpinBackgroundLayer();
+    if (!image2.isVisible())
+    {
+        // Drawn again if the layer cannot be pinned when the screen is resumed
+        image2.setVisible(true);
+        __background.setColor(touchgfx::Color::getColorFromRGB(0, 0, 0));
+    }
+    // Kept warm, the widget tree stays built and the logo stays cached for the next visit
+    if (!WarmScreens::isKeptWarm())
+    {
+        TargetHardware::clearTextureCache();
+        TargetHardware::clearMipChain();
+    }
+#if ROTATED_SPRITE_CACHE
+    if (!WarmScreens::isKeptWarm())
+    {
+        sprite1.detach();
+        sprite2.detach();
+    }
+#endif
     Screen1ViewBase::tearDownScreen();
 }
+
+void Screen1View::buildScene()
+{
+    // Same settings, but the rotation is updated without matrices every tick
+    mapper1.copyFrom(textureMapper1);
+    mapper2.copyFrom(textureMapper2);
+    // The draw order, relinked in one pass instead of an insert() and a remove() each
+    touchgfx::Drawable* const children[] =
+    {
+        &__background,
+        &image1,
+        &image2,
+        &mapper1,
+#if ROTATED_SPRITE_CACHE
+        &sprite1, // Drawn in place of the texture mappers, which keep the angles but are hidden
+#endif
+        &mapper2,
+#if ROTATED_SPRITE_CACHE
+        &sprite2,
+#endif
+        &toggleButton1
+    };
+    StaticLayout::replace(getRootContainer(), children, 0, sizeof(children) / sizeof(children[0]));
+#if ROTATED_SPRITE_CACHE
+    sprite1.attach(mapper1);
+    sprite2.attach(mapper2);
+    const uint32_t used = sprite1.setBuffer(reinterpret_cast<uint8_t*>(spriteCache), sizeof(spriteCache));
+    sprite2.setBuffer(reinterpret_cast<uint8_t*>(spriteCache) + used, sizeof(spriteCache) - used);
+#endif
+}
+
+SCREEN_OVERLAY_FUNCTION(Screen1) void Screen1View::handleTickEvent()
+{
+    // The updates of the tick, before the widgets animate
+    updates.drain(updateCallback);
+    float refreshes = 1.0f;
+    const uint32_t period = TargetHardware::getRefreshPeriodUs();
+    if (period != 0)
+    {
+        refreshes = (float)TargetHardware::getTickDeltaUs() / (float)period;
+    }
+    const float step = 0.100f * refreshes;
+    mapper1.updateAngles(mapper1.getXAngle(), mapper1.getYAngle(), mapper1.getZAngle() + step);
+    mapper2.updateAngles(mapper2.getXAngle(), mapper2.getYAngle(), mapper2.getZAngle() - step);
+#if ROTATED_SPRITE_CACHE
+    sprite1.update();
+    sprite2.update();
+#endif
+    updateOverlay();
+}
+
+SCREEN_OVERLAY_FUNCTION(Screen1) void Screen1View::draw(touchgfx::Rect& rect)
+{
+    drawList.draw(*this, rect);
+}
+
+void Screen1View::applyUpdate(uint16_t update, const ModelState& state)
+{
+    switch (update)
+    {
+    case Screen1Presenter::UPDATE_MODEL_STATE:
+        // Nothing on the screen shows the model yet, widgets that do are updated here
+        shownState = state;
+        break;
+    default:
+        break;
+    }
+}
+
+void Screen1View::updateOverlay()
+{
+    if (!TargetHardware::hasOverlayLayer())
+    {
+        return;
+    }
+    const touchgfx::Rect area = toggleButton1.getAbsoluteRect();
+    if (!TargetHardware::showOverlayLayer(toggleButton1.getCurrentlyDisplayedBitmap(), area.x, area.y))
+    {
+        // Too large for the overlay, draw it in the framebuffer
+        toggleButton1.setAlpha(255);
+    }
+}
+
+SCREEN_OVERLAY_FUNCTION(Screen1) void Screen1View::resetScene()
+{
+    mapper1.updateAngles(0.0f, 0.0f, 0.0f);
+    mapper2.updateAngles(0.0f, 0.0f, 0.0f);
+#if ROTATED_SPRITE_CACHE
+    sprite1.update();
+    sprite2.update();
+#endif
+}
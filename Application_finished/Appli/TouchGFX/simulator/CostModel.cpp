@@ -0,0 +1,108 @@
+#include "CostModel.hpp"
+#include <stdio.h>
+#include <string.h>
+
+#ifdef __GNUC__
+#define fopen_s(pFile, filename, mode) (((*(pFile)) = fopen((filename), (mode))) == NULL)
+#endif
+
+namespace
+{
+const char* const backendNames[CostModel::NUMBER_OF_BACKENDS] = { "cpu", "gpu2d" };
+const char* const operationNames[DrawCounters::NUMBER_OF_OPERATIONS] = { "fill", "fill_blend", "copy", "blend", "clut", "glyph", "texture", "canvas" };
+
+// Cortex-M7 at 600 MHz drawing to the RGB565 framebuffer in PSRAM
+const CostModel::Table cpuTable = {
+    //  fill  fill_blend  copy  blend  clut  glyph  texture  canvas
+    { 300.0f, 300.0f, 350.0f, 350.0f, 400.0f, 450.0f, 1500.0f, 4000.0f },
+    { 3.0f, 12.0f, 4.5f, 16.0f, 13.0f, 10.0f, 45.0f, 30.0f }
+};
+
+// NeoChrom, a command list per operation, the CPU only rasterizing the canvas outlines
+const CostModel::Table gpu2dTable = {
+    //  fill  fill_blend  copy  blend  clut  glyph  texture  canvas
+    { 2500.0f, 2500.0f, 2600.0f, 2600.0f, 2800.0f, 1200.0f, 4000.0f, 4000.0f },
+    { 1.2f, 2.4f, 2.4f, 3.4f, 3.4f, 4.0f, 4.5f, 20.0f }
+};
+} // namespace
+
+CostModel::CostModel()
+    : budgetUs(16667)
+{
+    tables[CPU] = cpuTable;
+    tables[GPU2D] = gpu2dTable;
+}
+
+bool CostModel::load(const char* fileName)
+{
+    FILE* file = 0;
+    if (fopen_s(&file, fileName, "r"))
+    {
+        fprintf(stderr, "cost model: unable to open %s\n", fileName);
+        return false;
+    }
+
+    bool valid = true;
+    char line[128];
+    while (fgets(line, sizeof(line), file) != 0)
+    {
+        if (line[0] == '#' || line[0] == '\n' || line[0] == '\r')
+        {
+            continue;
+        }
+        char backend[16];
+        char operation[16];
+        float nsPerCall = 0.0f;
+        float nsPerPixel = 0.0f;
+        unsigned long budget = 0;
+        if (sscanf(line, "budget %lu", &budget) == 1)
+        {
+            budgetUs = (uint32_t)budget;
+            continue;
+        }
+        if (sscanf(line, "%15s %15s %f %f", backend, operation, &nsPerCall, &nsPerPixel) == 4)
+        {
+            int b = 0;
+            while (b < NUMBER_OF_BACKENDS && strcmp(backend, backendNames[b]) != 0)
+            {
+                b++;
+            }
+            int o = 0;
+            while (o < DrawCounters::NUMBER_OF_OPERATIONS && strcmp(operation, operationNames[o]) != 0)
+            {
+                o++;
+            }
+            if (b < NUMBER_OF_BACKENDS && o < DrawCounters::NUMBER_OF_OPERATIONS)
+            {
+                tables[b].nsPerCall[o] = nsPerCall;
+                tables[b].nsPerPixel[o] = nsPerPixel;
+                continue;
+            }
+        }
+        fprintf(stderr, "cost model: bad line in %s: %s", fileName, line);
+        valid = false;
+    }
+    fclose(file);
+    return valid;
+}
+
+uint32_t CostModel::estimateUs(Backend backend, const DrawCounters& counters) const
+{
+    const Table& table = tables[backend];
+    double ns = 0.0;
+    for (int o = 0; o < DrawCounters::NUMBER_OF_OPERATIONS; o++)
+    {
+        ns += counters.calls[o] * (double)table.nsPerCall[o] + counters.pixels[o] * (double)table.nsPerPixel[o];
+    }
+    return (uint32_t)(ns / 1000.0 + 0.5);
+}
+
+const char* CostModel::getBackendName(Backend backend)
+{
+    return backendNames[backend];
+}
+
+const char* CostModel::getOperationName(DrawCounters::Operation operation)
+{
+    return operationNames[operation];
+}
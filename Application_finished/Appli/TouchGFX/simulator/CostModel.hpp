@@ -0,0 +1,96 @@
+#ifndef COSTMODEL_HPP
+#define COSTMODEL_HPP
+
+#include <touchgfx/hal/Types.hpp>
+
+/**
+ * Draw work done in a frame, the number of operations and the pixels written by each
+ * kind of operation.
+ */
+struct DrawCounters
+{
+    enum Operation
+    {
+        FILL,       ///< Opaque fillRect()
+        FILL_BLEND, ///< fillRect() with alpha
+        COPY,       ///< Opaque RGB565 blit
+        BLEND,      ///< Blit with alpha, transparent pixels or an alpha channel
+        CLUT,       ///< Blit of an L8 bitmap
+        GLYPH,      ///< Glyph of a text
+        TEXTURE,    ///< Texture mapped quad or triangle
+        CANVAS,     ///< Canvas widget rendered by CanvasWidgetRenderer
+        NUMBER_OF_OPERATIONS
+    };
+
+    uint32_t calls[NUMBER_OF_OPERATIONS];
+    uint32_t pixels[NUMBER_OF_OPERATIONS];
+
+    void add(Operation operation, uint32_t pixelCount)
+    {
+        calls[operation]++;
+        pixels[operation] += pixelCount;
+    }
+};
+
+/**
+ * Estimates the time a frame takes to render on the STM32H7S78-DK from the draw work
+ * counted in the simulator.
+ *
+ * Each operation costs a fixed time per call, the setup of the blit or of the GPU2D
+ * command list, plus a time per pixel written. There is one table for LCD16bpp, where
+ * the CPU does all the work, and one for LCDGPU2D, where NeoChrom does the fills, blits,
+ * glyphs and texture mapping. The built-in tables are first estimates. To calibrate them,
+ * time each operation on the board and load the measured values with `--cost-table
+ * <file>`, one line per value:
+ *
+ *     # backend operation ns-per-call ns-per-pixel
+ *     gpu2d blend 2600 3.1
+ *     cpu glyph 450 9.5
+ *     budget 16667
+ *
+ * with backend `cpu` or `gpu2d`, operation one of `fill`, `fill_blend`, `copy`, `blend`,
+ * `clut`, `glyph`, `texture` and `canvas`, and `budget` the frame time in microseconds.
+ */
+class CostModel
+{
+public:
+    enum Backend
+    {
+        CPU,   ///< LCD16bpp
+        GPU2D, ///< LCDGPU2D
+        NUMBER_OF_BACKENDS
+    };
+
+    struct Table
+    {
+        float nsPerCall[DrawCounters::NUMBER_OF_OPERATIONS];
+        float nsPerPixel[DrawCounters::NUMBER_OF_OPERATIONS];
+    };
+
+    CostModel();
+
+    /**
+     * Replaces values of the tables with the ones of a file.
+     *
+     * @return false if the file could not be read or has an invalid line.
+     */
+    bool load(const char* fileName);
+
+    /** Gets the estimated time of the work on a backend, in microseconds. */
+    uint32_t estimateUs(Backend backend, const DrawCounters& counters) const;
+
+    /** Gets the time available for a frame, in microseconds. */
+    uint32_t getBudgetUs() const
+    {
+        return budgetUs;
+    }
+
+    static const char* getBackendName(Backend backend);
+    static const char* getOperationName(DrawCounters::Operation operation);
+
+private:
+    Table tables[NUMBER_OF_BACKENDS];
+    uint32_t budgetUs;
+};
+
+#endif // COSTMODEL_HPP
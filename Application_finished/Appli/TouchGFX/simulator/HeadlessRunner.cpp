@@ -0,0 +1,470 @@
+#include "HeadlessRunner.hpp"
+#include <touchgfx/Application.hpp>
+#include <touchgfx/Screen.hpp>
+#include <touchgfx/Font.hpp>
+#include <touchgfx/Utils.hpp>
+#include <touchgfx/widgets/canvas/CanvasWidget.hpp>
+#include <stdlib.h>
+#include <SDL2/SDL.h>
+#if defined(WIN32) || defined(_WIN32)
+#include <windows.h>
+#elif defined(__GNUC__)
+#include <sys/stat.h>
+#endif
+
+#ifdef __GNUC__
+#define fopen_s(pFile, filename, mode) (((*(pFile)) = fopen((filename), (mode))) == NULL)
+#endif
+
+using namespace touchgfx;
+
+namespace
+{
+uint32_t visiblePixels(Rect rect)
+{
+    rect &= Rect(0, 0, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT);
+    return rect.isEmpty() ? 0 : (uint32_t)rect.area();
+}
+
+DrawCounters::Operation blitOperation(Bitmap::BitmapFormat format, uint8_t alpha, bool hasTransparentPixels)
+{
+    if (format == Bitmap::L8)
+    {
+        return DrawCounters::CLUT;
+    }
+    if (alpha < 255 || hasTransparentPixels || format != Bitmap::RGB565)
+    {
+        return DrawCounters::BLEND;
+    }
+    return DrawCounters::COPY;
+}
+
+/** Leaves a primitive of the CountingLCD16bpp. */
+class Leave
+{
+public:
+    explicit Leave(int& depth)
+        : nesting(depth)
+    {
+    }
+
+    ~Leave()
+    {
+        nesting--;
+    }
+
+private:
+    int& nesting;
+};
+} // namespace
+
+CountingLCD16bpp::CountingLCD16bpp()
+    : depth(0)
+{
+    memset(&counters, 0, sizeof(counters));
+}
+
+bool CountingLCD16bpp::enter(DrawCounters::Operation operation, uint32_t pixels)
+{
+    if (depth++ == 0)
+    {
+        counters.add(operation, pixels);
+        return true;
+    }
+    return false;
+}
+
+void CountingLCD16bpp::drawPartialBitmap(const Bitmap& bitmap, int16_t x, int16_t y, const Rect& rect, uint8_t alpha, bool useOptimized)
+{
+    Rect part = rect & Rect(0, 0, bitmap.getWidth(), bitmap.getHeight());
+    part.x += x;
+    part.y += y;
+    enter(blitOperation(bitmap.getFormat(), alpha, bitmap.hasTransparentPixels()), visiblePixels(part));
+    Leave leave(depth);
+    LCD16bpp::drawPartialBitmap(bitmap, x, y, rect, alpha, useOptimized);
+}
+
+void CountingLCD16bpp::blitCopy(const uint16_t* sourceData, const Rect& source, const Rect& blitRect, uint8_t alpha, bool hasTransparentPixels)
+{
+    enter(blitOperation(Bitmap::RGB565, alpha, hasTransparentPixels), visiblePixels(blitRect));
+    Leave leave(depth);
+    LCD16bpp::blitCopy(sourceData, source, blitRect, alpha, hasTransparentPixels);
+}
+
+void CountingLCD16bpp::blitCopy(const uint8_t* sourceData, Bitmap::BitmapFormat sourceFormat, const Rect& source, const Rect& blitRect, uint8_t alpha, bool hasTransparentPixels)
+{
+    enter(blitOperation(sourceFormat, alpha, hasTransparentPixels), visiblePixels(blitRect));
+    Leave leave(depth);
+    LCD16bpp::blitCopy(sourceData, sourceFormat, source, blitRect, alpha, hasTransparentPixels);
+}
+
+void CountingLCD16bpp::fillRect(const Rect& rect, colortype color, uint8_t alpha)
+{
+    enter(alpha < 255 ? DrawCounters::FILL_BLEND : DrawCounters::FILL, visiblePixels(rect));
+    Leave leave(depth);
+    LCD16bpp::fillRect(rect, color, alpha);
+}
+
+void CountingLCD16bpp::drawTextureMapTriangle(const DrawingSurface& dest, const Point3D* vertices, const TextureSurface& texture, const Rect& absoluteRect, const Rect& dirtyAreaAbsolute, RenderingVariant renderVariant, uint8_t alpha, uint16_t subDivisionSize)
+{
+    enter(DrawCounters::TEXTURE, visiblePixels(absoluteRect & dirtyAreaAbsolute));
+    Leave leave(depth);
+    LCD16bpp::drawTextureMapTriangle(dest, vertices, texture, absoluteRect, dirtyAreaAbsolute, renderVariant, alpha, subDivisionSize);
+}
+
+void CountingLCD16bpp::drawTextureMapQuad(const DrawingSurface& dest, const Point3D* vertices, const TextureSurface& texture, const Rect& absoluteRect, const Rect& dirtyAreaAbsolute, RenderingVariant renderVariant, uint8_t alpha, uint16_t subDivisionSize)
+{
+    enter(DrawCounters::TEXTURE, visiblePixels(absoluteRect & dirtyAreaAbsolute));
+    Leave leave(depth);
+    LCD16bpp::drawTextureMapQuad(dest, vertices, texture, absoluteRect, dirtyAreaAbsolute, renderVariant, alpha, subDivisionSize);
+}
+
+void CountingLCD16bpp::drawGlyph(uint16_t* wbuf16, Rect widgetArea, int16_t x, int16_t y, uint16_t offsetX, uint16_t offsetY, const Rect& invalidatedArea, const GlyphNode* glyph, const uint8_t* glyphData, uint8_t byteAlignRow, colortype color, uint8_t bitsPerPixel, uint8_t alpha, TextRotation rotation)
+{
+    enter(DrawCounters::GLYPH, (uint32_t)(glyph->width() - offsetX) * (uint32_t)(glyph->height() - offsetY));
+    Leave leave(depth);
+    LCD16bpp::drawGlyph(wbuf16, widgetArea, x, y, offsetX, offsetY, invalidatedArea, glyph, glyphData, byteAlignRow, color, bitsPerPixel, alpha, rotation);
+}
+
+DrawCounters CountingLCD16bpp::takeCounters()
+{
+    const DrawCounters taken = counters;
+    memset(&counters, 0, sizeof(counters));
+    return taken;
+}
+
+bool ScriptTouchController::sampleTouch(int32_t& x, int32_t& y)
+{
+    if (pressed)
+    {
+        x = touchX;
+        y = touchY;
+    }
+    return pressed;
+}
+
+void HeadlessHAL::step()
+{
+    vSync();
+    backPorchExited();
+    frontPorchEntered();
+}
+
+void HeadlessHAL::flushFrameBuffer(const Rect& rect)
+{
+    if (flushed.size() < flushed.maxCapacity())
+    {
+        flushed.add(rect);
+    }
+    else
+    {
+        flushed[flushed.size() - 1].expandToFit(rect);
+    }
+    HALSDL2::flushFrameBuffer(rect);
+}
+
+bool HeadlessHAL::beginFrame()
+{
+    flushed.clear();
+    return HALSDL2::beginFrame();
+}
+
+void HeadlessHAL::endFrame()
+{
+    HALSDL2::endFrame();
+
+    report.frame = frames++;
+    report.flushedAreas = flushed.size();
+    report.flushedPixels = 0;
+    for (uint16_t i = 0; i < flushed.size(); i++)
+    {
+        report.flushedPixels += visiblePixels(flushed[i]);
+    }
+    report.counters = static_cast<CountingLCD16bpp&>(lcd()).takeCounters();
+    report.widgets = 0;
+    Screen* const screen = Application::getCurrentScreen();
+    if (screen != 0 && flushed.size() > 0)
+    {
+        countDrawnWidgets(&screen->getRootContainer());
+    }
+
+    if (costModel == 0)
+    {
+        return;
+    }
+    for (int b = 0; b < CostModel::NUMBER_OF_BACKENDS; b++)
+    {
+        report.estimateUs[b] = costModel->estimateUs((CostModel::Backend)b, report.counters);
+    }
+    if (reportOverBudget && report.estimateUs[CostModel::GPU2D] > costModel->getBudgetUs())
+    {
+        touchgfx_printf("frame %lu: estimated %lu us with GPU2D, %lu us with the CPU, over the budget of %lu us\n",
+                        (unsigned long)report.frame,
+                        (unsigned long)report.estimateUs[CostModel::GPU2D],
+                        (unsigned long)report.estimateUs[CostModel::CPU],
+                        (unsigned long)costModel->getBudgetUs());
+    }
+}
+
+void HeadlessHAL::countDrawnWidgets(Drawable* drawable)
+{
+    for (; drawable != 0; drawable = drawable->getNextSibling())
+    {
+        if (!drawable->isVisible())
+        {
+            continue;
+        }
+        Drawable* const child = drawable->getFirstChild();
+        if (child != 0)
+        {
+            countDrawnWidgets(child);
+            continue;
+        }
+
+        // The canvas widgets are rasterized by CanvasWidgetRenderer, counted by area
+        const bool canvas = dynamic_cast<CanvasWidget*>(drawable) != 0;
+        const Rect rect = drawable->getAbsoluteRect();
+        uint32_t canvasPixels = 0;
+        bool drawn = false;
+        for (uint16_t i = 0; i < flushed.size(); i++)
+        {
+            if (rect.intersect(flushed[i]))
+            {
+                drawn = true;
+                if (canvas)
+                {
+                    canvasPixels += visiblePixels(rect & flushed[i]);
+                }
+            }
+        }
+        if (drawn)
+        {
+            report.widgets++;
+            if (canvas)
+            {
+                report.counters.add(DrawCounters::CANVAS, canvasPixels);
+            }
+        }
+    }
+}
+
+HeadlessRunner::HeadlessRunner()
+    : frames(0), costModelEnabled(false), scriptFile(0), csvFile(0), dumpDir(0), costTableFile(0), script(0), linePending(false)
+{
+    line[0] = '\0';
+}
+
+void HeadlessRunner::parse(int argc, char** argv)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        const bool hasValue = i + 1 < argc;
+        if (strcmp(argv[i], "--headless") == 0 && hasValue)
+        {
+            frames = (uint32_t)strtoul(argv[++i], 0, 10);
+        }
+        else if (strcmp(argv[i], "--script") == 0 && hasValue)
+        {
+            scriptFile = argv[++i];
+        }
+        else if (strcmp(argv[i], "--csv") == 0 && hasValue)
+        {
+            csvFile = argv[++i];
+        }
+        else if (strcmp(argv[i], "--dump") == 0 && hasValue)
+        {
+            dumpDir = argv[++i];
+        }
+        else if (strcmp(argv[i], "--cost-table") == 0 && hasValue)
+        {
+            costTableFile = argv[++i];
+        }
+        else if (strcmp(argv[i], "--cost-model") == 0)
+        {
+            costModelEnabled = true;
+        }
+    }
+}
+
+bool HeadlessRunner::prepare(HeadlessHAL& hal)
+{
+    if (costTableFile != 0 && !costModel.load(costTableFile))
+    {
+        return false;
+    }
+    hal.setCostModel(&costModel, !isHeadless());
+
+    if (isHeadless())
+    {
+        // No window system is needed, SDL renders to memory
+        SDL_setenv("SDL_VIDEODRIVER", "dummy", 1);
+        SDL_SetHint(SDL_HINT_RENDER_DRIVER, "software");
+        hal.setWindowVisible(false, false);
+    }
+    else
+    {
+        touchgfx_enable_stdio();
+    }
+    return true;
+}
+
+int HeadlessRunner::run(HeadlessHAL& hal, ScriptTouchController& tc)
+{
+    if (scriptFile != 0 && fopen_s(&script, scriptFile, "r"))
+    {
+        fprintf(stderr, "headless: unable to open script %s\n", scriptFile);
+        return EXIT_FAILURE;
+    }
+    FILE* csv = stdout;
+    if (csvFile != 0 && fopen_s(&csv, csvFile, "w"))
+    {
+        fprintf(stderr, "headless: unable to open %s\n", csvFile);
+        return EXIT_FAILURE;
+    }
+    if (dumpDir != 0)
+    {
+#if defined(WIN32) || defined(_WIN32)
+        CreateDirectory(dumpDir, 0);
+#elif defined(__GNUC__)
+        mkdir(dumpDir, S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH);
+#endif
+    }
+
+    fprintf(csv, "frame,flushed_areas,flushed_pixels,widgets");
+    for (int o = 0; o < DrawCounters::NUMBER_OF_OPERATIONS; o++)
+    {
+        const char* const name = CostModel::getOperationName((DrawCounters::Operation)o);
+        fprintf(csv, ",%s,%s_pixels", name, name);
+    }
+    fprintf(csv, ",cpu_us,gpu2d_us\n");
+
+    uint64_t totalFlushed = 0;
+    uint64_t totalUs[CostModel::NUMBER_OF_BACKENDS] = { 0, 0 };
+    uint32_t overBudget = 0;
+    int result = EXIT_SUCCESS;
+    for (uint32_t frame = 0; frame < frames; frame++)
+    {
+        const bool dump = applyScript(frame, tc);
+        hal.step();
+
+        const FrameReport& report = hal.getFrameReport();
+        fprintf(csv, "%lu,%lu,%lu,%lu", (unsigned long)frame, (unsigned long)report.flushedAreas, (unsigned long)report.flushedPixels, (unsigned long)report.widgets);
+        for (int o = 0; o < DrawCounters::NUMBER_OF_OPERATIONS; o++)
+        {
+            fprintf(csv, ",%lu,%lu", (unsigned long)report.counters.calls[o], (unsigned long)report.counters.pixels[o]);
+        }
+        fprintf(csv, ",%lu,%lu\n", (unsigned long)report.estimateUs[CostModel::CPU], (unsigned long)report.estimateUs[CostModel::GPU2D]);
+
+        totalFlushed += report.flushedPixels;
+        totalUs[CostModel::CPU] += report.estimateUs[CostModel::CPU];
+        totalUs[CostModel::GPU2D] += report.estimateUs[CostModel::GPU2D];
+        if (report.estimateUs[CostModel::GPU2D] > costModel.getBudgetUs())
+        {
+            overBudget++;
+        }
+
+        if (dumpDir != 0 && (dump || frame + 1 == frames) && !dumpFrame(hal, frame))
+        {
+            result = EXIT_FAILURE;
+        }
+    }
+
+    fprintf(stderr, "headless: %lu frames, %llu pixels flushed, estimated %llu us with GPU2D, %llu us with the CPU, %lu frames over budget\n",
+            (unsigned long)frames, (unsigned long long)totalFlushed,
+            (unsigned long long)totalUs[CostModel::GPU2D], (unsigned long long)totalUs[CostModel::CPU], (unsigned long)overBudget);
+
+    if (csv != stdout)
+    {
+        fclose(csv);
+    }
+    if (script != 0)
+    {
+        fclose(script);
+    }
+    return result;
+}
+
+bool HeadlessRunner::applyScript(uint32_t frame, ScriptTouchController& tc)
+{
+    bool dump = false;
+    while (script != 0)
+    {
+        if (!linePending)
+        {
+            if (fgets(line, sizeof(line), script) == 0)
+            {
+                break;
+            }
+            if (line[0] == '#' || line[0] == '\n' || line[0] == '\r')
+            {
+                continue;
+            }
+            linePending = true;
+        }
+
+        unsigned long at = 0;
+        char event[16];
+        long x = 0;
+        long y = 0;
+        const int fields = sscanf(line, "%lu %15s %ld %ld", &at, event, &x, &y);
+        if (fields < 2)
+        {
+            fprintf(stderr, "headless: bad script line: %s", line);
+            linePending = false;
+            continue;
+        }
+        if (at > frame)
+        {
+            break;
+        }
+        linePending = false;
+
+        if (strcmp(event, "down") == 0 && fields == 4)
+        {
+            tc.press((int32_t)x, (int32_t)y);
+        }
+        else if (strcmp(event, "up") == 0)
+        {
+            tc.release();
+        }
+        else if (strcmp(event, "dump") == 0)
+        {
+            dump = true;
+        }
+        else
+        {
+            fprintf(stderr, "headless: bad script line: %s", line);
+        }
+    }
+    return dump;
+}
+
+bool HeadlessRunner::dumpFrame(HeadlessHAL& hal, uint32_t frame) const
+{
+    char path[512];
+    snprintf(path, sizeof(path), "%s/frame_%05lu.ppm", dumpDir, (unsigned long)frame);
+    FILE* file = 0;
+    if (fopen_s(&file, path, "wb"))
+    {
+        fprintf(stderr, "headless: unable to write %s\n", path);
+        return false;
+    }
+
+    const uint16_t* const frameBuffer = hal.getDrawnFrame();
+    const uint16_t stride = HAL::lcd().framebufferStride() / 2;
+    fprintf(file, "P6\n%d %d\n255\n", HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT);
+    for (int16_t y = 0; y < HAL::DISPLAY_HEIGHT; y++)
+    {
+        const uint16_t* pixel = frameBuffer + y * stride;
+        for (int16_t x = 0; x < HAL::DISPLAY_WIDTH; x++, pixel++)
+        {
+            const uint8_t red = (uint8_t)((*pixel >> 11) & 0x1F);
+            const uint8_t green = (uint8_t)((*pixel >> 5) & 0x3F);
+            const uint8_t blue = (uint8_t)(*pixel & 0x1F);
+            const uint8_t rgb[3] = { (uint8_t)((red << 3) | (red >> 2)), (uint8_t)((green << 2) | (green >> 4)), (uint8_t)((blue << 3) | (blue >> 2)) };
+            fwrite(rgb, 1, sizeof(rgb), file);
+        }
+    }
+    fclose(file);
+    return true;
+}
@@ -0,0 +1,226 @@
+#ifndef HEADLESSRUNNER_HPP
+#define HEADLESSRUNNER_HPP
+
+#include <platform/hal/simulator/sdl2/HALSDL2.hpp>
+#include <platform/driver/lcd/LCD16bpp.hpp>
+#include <platform/driver/touch/TouchController.hpp>
+#include <touchgfx/hal/Types.hpp>
+#include "CostModel.hpp"
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * An LCD16bpp counting the operations of its primitives and the pixels they write. The
+ * widgets draw through these, so the counters follow the draw work of a frame
+ * independently of the speed of the host. A primitive drawing through another one is
+ * counted once.
+ */
+class CountingLCD16bpp : public touchgfx::LCD16bpp
+{
+public:
+    CountingLCD16bpp();
+
+    virtual void drawPartialBitmap(const touchgfx::Bitmap& bitmap, int16_t x, int16_t y, const touchgfx::Rect& rect, uint8_t alpha = 255, bool useOptimized = true);
+    virtual void blitCopy(const uint16_t* sourceData, const touchgfx::Rect& source, const touchgfx::Rect& blitRect, uint8_t alpha, bool hasTransparentPixels);
+    virtual void blitCopy(const uint8_t* sourceData, touchgfx::Bitmap::BitmapFormat sourceFormat, const touchgfx::Rect& source, const touchgfx::Rect& blitRect, uint8_t alpha, bool hasTransparentPixels);
+    virtual void fillRect(const touchgfx::Rect& rect, touchgfx::colortype color, uint8_t alpha = 255);
+    virtual void drawTextureMapTriangle(const touchgfx::DrawingSurface& dest, const touchgfx::Point3D* vertices, const touchgfx::TextureSurface& texture, const touchgfx::Rect& absoluteRect, const touchgfx::Rect& dirtyAreaAbsolute, touchgfx::RenderingVariant renderVariant, uint8_t alpha = 255, uint16_t subDivisionSize = 12);
+    virtual void drawTextureMapQuad(const touchgfx::DrawingSurface& dest, const touchgfx::Point3D* vertices, const touchgfx::TextureSurface& texture, const touchgfx::Rect& absoluteRect, const touchgfx::Rect& dirtyAreaAbsolute, touchgfx::RenderingVariant renderVariant, uint8_t alpha = 255, uint16_t subDivisionSize = 12);
+
+    /** Gets the counters and resets them. */
+    DrawCounters takeCounters();
+
+protected:
+    virtual void drawGlyph(uint16_t* wbuf16, touchgfx::Rect widgetArea, int16_t x, int16_t y, uint16_t offsetX, uint16_t offsetY, const touchgfx::Rect& invalidatedArea, const touchgfx::GlyphNode* glyph, const uint8_t* glyphData, uint8_t byteAlignRow, touchgfx::colortype color, uint8_t bitsPerPixel, uint8_t alpha, touchgfx::TextRotation rotation);
+
+private:
+    bool enter(DrawCounters::Operation operation, uint32_t pixels);
+
+    DrawCounters counters;
+    int depth;
+};
+
+/**
+ * A touch controller reporting the touch set by the input script instead of the mouse.
+ */
+class ScriptTouchController : public touchgfx::TouchController
+{
+public:
+    ScriptTouchController()
+        : pressed(false), touchX(0), touchY(0)
+    {
+    }
+
+    virtual void init()
+    {
+    }
+
+    virtual bool sampleTouch(int32_t& x, int32_t& y);
+
+    void press(int32_t x, int32_t y)
+    {
+        pressed = true;
+        touchX = x;
+        touchY = y;
+    }
+
+    void release()
+    {
+        pressed = false;
+    }
+
+private:
+    bool pressed;
+    int32_t touchX;
+    int32_t touchY;
+};
+
+/** The draw work of a frame and its estimated time on the board. */
+struct FrameReport
+{
+    uint32_t frame;
+    uint32_t flushedAreas;  ///< Areas flushed, those invalidated and drawn
+    uint32_t flushedPixels; ///< Pixels in those areas
+    uint32_t widgets;       ///< Widgets drawn in those areas
+    DrawCounters counters;
+    uint32_t estimateUs[CostModel::NUMBER_OF_BACKENDS];
+};
+
+/**
+ * The simulator HAL of the profiling modes, used with a CountingLCD16bpp. It reports the
+ * draw work of each frame in a FrameReport, with the estimate of a CostModel.
+ *
+ * In the headless mode the HeadlessRunner steps it one virtual vsync at a time instead
+ * of the wall clock. In the interactive cost model mode it runs as the usual simulator,
+ * and prints the frames whose estimated time exceeds the budget of the cost model.
+ */
+class HeadlessHAL : public touchgfx::HALSDL2
+{
+public:
+    HeadlessHAL(touchgfx::DMA_Interface& dma, touchgfx::LCD& lcd, touchgfx::TouchController& touchCtrl, uint16_t width, uint16_t height)
+        : touchgfx::HALSDL2(dma, lcd, touchCtrl, width, height), costModel(0), reportOverBudget(false), frames(0)
+    {
+        memset(&report, 0, sizeof(report));
+    }
+
+    /**
+     * Sets the cost model estimating the frame times.
+     *
+     * @param model            The cost model.
+     * @param printOverBudget  true to print the frames over the budget of the model.
+     */
+    void setCostModel(const CostModel* model, bool printOverBudget)
+    {
+        costModel = model;
+        reportOverBudget = printOverBudget;
+    }
+
+    /** Runs one frame: a vsync, the tick of the application and its drawing. */
+    void step();
+
+    /** Gets the report of the last frame. */
+    const FrameReport& getFrameReport() const
+    {
+        return report;
+    }
+
+    /** Gets the frame last drawn, of DISPLAY_WIDTH x DISPLAY_HEIGHT RGB565 pixels. */
+    const uint16_t* getDrawnFrame()
+    {
+        return getClientFrameBuffer();
+    }
+
+    virtual void flushFrameBuffer(const touchgfx::Rect& rect);
+
+protected:
+    virtual bool beginFrame();
+    virtual void endFrame();
+
+private:
+    void countDrawnWidgets(touchgfx::Drawable* drawable);
+
+    const CostModel* costModel;
+    bool reportOverBudget;
+    uint32_t frames;
+    touchgfx::Vector<touchgfx::Rect, 64> flushed;
+    FrameReport report;
+};
+
+/**
+ * Profiling modes of the simulator.
+ *
+ * Benchmark mode, for CI: started with `--headless <frames>` on the command line, the
+ * simulator runs the given number of frames as fast as possible without a visible window,
+ * each one a virtual vsync of 16.67 ms, so the animations and the frames drawn do not
+ * depend on the load of the host. The optional `--script <file>` replays a recorded
+ * input script, one event per line, by frame:
+ *
+ *     # frame event [x y]
+ *     30 down 120 200
+ *     34 down 180 200
+ *     40 up
+ *     90 dump
+ *
+ * For each frame one CSV line goes to `--csv <file>`, or stdout: the areas flushed, their
+ * pixels, the widgets drawn in them, the draw counters of the LCD and the frame time
+ * estimated by the CostModel for the CPU and for GPU2D. A regression in the work done to
+ * render a frame shows there before it reaches the hardware. With `--dump <dir>`, the
+ * frames marked `dump` in the script, and the last frame, are written as binary PPM
+ * files, frame_NNNNN.ppm, to compare against golden images.
+ *
+ * Cost model mode, for designers: started with `--cost-model`, the simulator runs as
+ * usual and prints the frames whose estimated time on the board exceeds the frame
+ * budget. Both modes take the calibrated cost tables with `--cost-table <file>`.
+ */
+class HeadlessRunner
+{
+public:
+    HeadlessRunner();
+
+    /** Parses the options of the profiling modes. */
+    void parse(int argc, char** argv);
+
+    /** Is the simulator to run headless? */
+    bool isHeadless() const
+    {
+        return frames > 0;
+    }
+
+    /** Is the simulator to run with a HeadlessHAL and a CountingLCD16bpp? */
+    bool isProfiling() const
+    {
+        return isHeadless() || costModelEnabled;
+    }
+
+    /**
+     * Loads the cost tables and, in the headless mode, hides the window before SDL is
+     * initialized. Called before setupSimulator().
+     *
+     * @return false if the cost tables could not be loaded.
+     */
+    bool prepare(HeadlessHAL& hal);
+
+    /**
+     * Runs the frames of the headless mode and reports them.
+     *
+     * @return The exit code of the simulator.
+     */
+    int run(HeadlessHAL& hal, ScriptTouchController& tc);
+
+private:
+    bool applyScript(uint32_t frame, ScriptTouchController& tc);
+    bool dumpFrame(HeadlessHAL& hal, uint32_t frame) const;
+
+    uint32_t frames;
+    bool costModelEnabled;
+    const char* scriptFile;
+    const char* csvFile;
+    const char* dumpDir;
+    const char* costTableFile;
+    CostModel costModel;
+    FILE* script;
+    char line[128];
+    bool linePending;
+};
+
+#endif // HEADLESSRUNNER_HPP
@@ -0,0 +1,304 @@
+#include <gui/common/TargetHardware.hpp>
+
+using namespace touchgfx;
+
+namespace
+{
+// The model worker computes a state as soon as it is requested, there is no modelTask
+TargetHardware::ModelWorkFunction modelWork = 0;
+void* modelContext = 0;
+uint8_t* modelSlots = 0;
+uint32_t modelSlotSize = 0;
+int computedSlot = -1;
+int acquiredSlot = -1;
+} // namespace
+
+bool TargetHardware::isAccelerated()
+{
+    return false;
+}
+
+void TargetHardware::cleanDCache(const void* /*data*/, uint32_t /*size*/)
+{
+}
+
+void TargetHardware::invalidateDCache(const void* /*data*/, uint32_t /*size*/)
+{
+}
+
+void TargetHardware::synchronizeCode()
+{
+}
+
+bool TargetHardware::canDrawInDynamicBitmap(Bitmap::BitmapFormat /*format*/)
+{
+    return false;
+}
+
+bool TargetHardware::setFrameBufferFormat(Bitmap::BitmapFormat /*format*/)
+{
+    return false;
+}
+
+bool TargetHardware::drawScaledBitmap(const Bitmap& /*bitmap*/, const Rect& /*dest*/, const Rect& /*clip*/, uint8_t /*alpha*/, bool /*bilinear*/)
+{
+    return false;
+}
+
+bool TargetHardware::drawTiledBitmap(const Bitmap& /*bitmap*/, int16_t /*x*/, int16_t /*y*/, int16_t /*xOffset*/, int16_t /*yOffset*/, const Rect& /*clip*/, uint8_t /*alpha*/)
+{
+    return false;
+}
+
+bool TargetHardware::drawTextureQuads(const Bitmap& /*bitmap*/, const float* /*corners*/, uint16_t /*count*/, int16_t /*x*/, int16_t /*y*/, const Rect& /*clip*/, uint8_t /*alpha*/, bool /*bilinear*/)
+{
+    return false;
+}
+
+bool TargetHardware::drawA8Mask(const uint8_t* /*mask*/, uint16_t /*width*/, uint16_t /*height*/, int16_t /*x*/, int16_t /*y*/, const Rect& /*clip*/, colortype /*color*/, uint8_t /*alpha*/)
+{
+    return false;
+}
+
+bool TargetHardware::canDrawMaskedBitmap(const Bitmap& /*bitmap*/)
+{
+    return false;
+}
+
+bool TargetHardware::drawMaskedBitmap(const uint8_t* /*mask*/, uint16_t /*width*/, uint16_t /*height*/, int16_t /*x*/, int16_t /*y*/, const Bitmap& /*bitmap*/, int16_t /*u*/, int16_t /*v*/, const Rect& /*clip*/, uint8_t /*alpha*/)
+{
+    return false;
+}
+
+bool TargetHardware::renderStringMask(const Rect& /*widgetArea*/, const LCD::StringVisuals& /*visuals*/, const Unicode::UnicodeChar* /*text*/, uint8_t* /*mask*/)
+{
+    return false;
+}
+
+bool TargetHardware::drawTSVG(const void* /*tsvg*/, const Matrix3x3& /*transform*/, const Rect& /*clip*/, float /*size*/)
+{
+    return false;
+}
+
+bool TargetHardware::drawTransition(TransitionEffect /*effect*/, bool /*vertical*/, bool /*reverse*/, const Bitmap& /*from*/, const Bitmap& /*to*/, float /*step*/, const Rect& /*clip*/)
+{
+    return false;
+}
+
+uint32_t TargetHardware::kickGPU2D()
+{
+    return 0;
+}
+
+void TargetHardware::waitForKick(uint32_t /*kick*/)
+{
+}
+
+TargetHardware::FragmentResult TargetHardware::beginFragment(const void* /*owner*/, uint32_t /*version*/, const Rect& /*area*/)
+{
+    return FRAGMENT_UNAVAILABLE;
+}
+
+bool TargetHardware::endFragment()
+{
+    return false;
+}
+
+void TargetHardware::discardFragments(const void* /*owner*/)
+{
+}
+
+bool TargetHardware::copyPreviousFrame(const Rect& /*area*/, int16_t /*dx*/, int16_t /*dy*/)
+{
+    return false;
+}
+
+bool TargetHardware::tracksFrameBufferAge()
+{
+    return false;
+}
+
+uint32_t TargetHardware::getFrameNumber()
+{
+    return 0;
+}
+
+uint8_t TargetHardware::getClientFrameBufferAge()
+{
+    return 0;
+}
+
+bool TargetHardware::isFrameSkipped()
+{
+    return false;
+}
+
+uint16_t TargetHardware::getTileSize()
+{
+    return 0;
+}
+
+bool TargetHardware::isTileUnchanged(uint16_t /*column*/, uint16_t /*row*/)
+{
+    return false;
+}
+
+uint32_t TargetHardware::getTickDeltaUs()
+{
+    return 0;
+}
+
+uint32_t TargetHardware::getRefreshPeriodUs()
+{
+    return 0;
+}
+
+uint8_t TargetHardware::getScalePercent()
+{
+    return 100;
+}
+
+void TargetHardware::waitForAssetUploads()
+{
+}
+
+bool TargetHardware::prefetchTexture(BitmapId /*id*/)
+{
+    return false;
+}
+
+bool TargetHardware::cacheTextureRotated(BitmapId /*id*/)
+{
+    return false;
+}
+
+BitmapId TargetHardware::cacheTexturePremultiplied(BitmapId /*id*/)
+{
+    return BITMAP_INVALID;
+}
+
+void TargetHardware::clearTextureCache()
+{
+}
+
+bool TargetHardware::generateMipChain(BitmapId /*id*/)
+{
+    return false;
+}
+
+void TargetHardware::clearMipChain()
+{
+}
+
+bool TargetHardware::pinBackgroundLayer(const Bitmap& /*bitmap*/)
+{
+    return false;
+}
+
+void TargetHardware::unpinBackgroundLayer()
+{
+}
+
+colortype TargetHardware::getBackgroundColorKey()
+{
+    return 0;
+}
+
+bool TargetHardware::hasOverlayLayer()
+{
+    return false;
+}
+
+bool TargetHardware::showOverlayLayer(const Bitmap& /*bitmap*/, int16_t /*x*/, int16_t /*y*/)
+{
+    return false;
+}
+
+void TargetHardware::hideOverlayLayer()
+{
+}
+
+bool TargetHardware::prefetchGlyph(const uint8_t* /*glyphData*/, uint16_t /*width*/, uint16_t /*height*/)
+{
+    return false;
+}
+
+bool TargetHardware::drawShapedString(TypedTextId /*id*/, const Rect& /*widgetArea*/, const Rect& /*invalidatedArea*/, const LCD::StringVisuals& /*visuals*/, const Unicode::UnicodeChar* /*text*/)
+{
+    return false;
+}
+
+void TargetHardware::clearShapedText()
+{
+}
+
+uint16_t TargetHardware::getGradientStep()
+{
+    return 1;
+}
+
+void TargetHardware::disableTouchPrediction()
+{
+}
+
+uint32_t TargetHardware::widgetDrawStarted()
+{
+    return 0;
+}
+
+void TargetHardware::widgetDrawEnded(const void* /*drawable*/, uint32_t /*start*/)
+{
+}
+
+void TargetHardware::addMemoryBudget(const char* /*name*/, const void* /*base*/, uint32_t /*size*/, MemoryUsageFunction /*usage*/, const void* /*context*/)
+{
+}
+
+void TargetHardware::addSoakChannel(const char* /*name*/, SoakSampleFunction /*sample*/, const void* /*context*/, bool /*worseWhenHigher*/)
+{
+}
+
+void TargetHardware::setSoakSceneCallback(GenericCallback<>* /*callback*/)
+{
+}
+
+void TargetHardware::setBenchmarkSceneCallback(GenericCallback<>* /*callback*/)
+{
+}
+
+void TargetHardware::startModelWorker(ModelWorkFunction work, void* context, void* slots, uint32_t slotSize)
+{
+    modelWork = work;
+    modelContext = context;
+    modelSlots = static_cast<uint8_t*>(slots);
+    modelSlotSize = slotSize;
+    computedSlot = -1;
+    acquiredSlot = -1;
+}
+
+void TargetHardware::requestModelState(uint32_t tick)
+{
+    if (modelWork == 0)
+    {
+        return;
+    }
+    // Never the slot the TouchGFX task holds
+    const int slot = (acquiredSlot + 1) % 3;
+    modelWork(modelContext, modelSlots + slot * modelSlotSize, tick);
+    computedSlot = slot;
+}
+
+const void* TargetHardware::acquireModelState()
+{
+    if (computedSlot < 0)
+    {
+        return 0;
+    }
+    acquiredSlot = computedSlot;
+    computedSlot = -1;
+    return modelSlots + acquiredSlot * modelSlotSize;
+}
+
+void TargetHardware::drainModelMessages(ModelMessageFunction /*receive*/, void* /*context*/)
+{
+}
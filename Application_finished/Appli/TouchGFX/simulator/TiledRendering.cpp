@@ -0,0 +1,211 @@
+#include "TiledRendering.hpp"
+#include <stdlib.h>
+#include <string.h>
+#include <touchgfx/hal/HAL.hpp>
+#include <SDL2/SDL.h>
+
+using namespace touchgfx;
+
+namespace
+{
+SDL_sem* workReady = 0;
+SDL_sem* workDone = 0;
+SDL_atomic_t nextBand;
+TilePool::Job currentJob = 0;
+void* currentContext = 0;
+Rect currentArea;
+int currentBands = 0;
+
+bool isUncompressed(Bitmap::BitmapFormat format)
+{
+    return format == Bitmap::RGB565 || format == Bitmap::RGB888 || format == Bitmap::ARGB8888 || format == Bitmap::L8;
+}
+} // namespace
+
+int TilePool::threads = 1;
+volatile bool TilePool::active = false;
+
+void TilePool::start(int count)
+{
+    if (threads > 1 || count < 2)
+    {
+        return;
+    }
+    threads = count < TILE_POOL_MAX_THREADS ? count : TILE_POOL_MAX_THREADS;
+    workReady = SDL_CreateSemaphore(0);
+    workDone = SDL_CreateSemaphore(0);
+    for (int i = 1; i < threads; i++)
+    {
+        SDL_Thread* const thread = SDL_CreateThread(worker, "TilePool", 0);
+        assert(thread && "Unable to start the tile pool");
+        SDL_DetachThread(thread);
+    }
+}
+
+int TilePool::getThreadsFromArguments(int argc, char** argv)
+{
+    for (int i = 1; i + 1 < argc; i++)
+    {
+        if (strcmp(argv[i], "--threads") == 0)
+        {
+            return atoi(argv[i + 1]);
+        }
+    }
+    return SDL_GetCPUCount();
+}
+
+void TilePool::run(Job job, void* context, const Rect& area)
+{
+    int bands = area.height / MIN_ROWS;
+    if (bands > threads)
+    {
+        bands = threads;
+    }
+    if (bands < 2 || area.area() < MIN_PIXELS)
+    {
+        job(context, area);
+        return;
+    }
+
+    // The framebuffer is held for the threads drawing the bands
+    HAL::getInstance()->lockFrameBuffer();
+    active = true;
+
+    currentJob = job;
+    currentContext = context;
+    currentArea = area;
+    currentBands = bands;
+    SDL_AtomicSet(&nextBand, 0);
+    for (int i = 1; i < bands; i++)
+    {
+        SDL_SemPost(workReady);
+    }
+    work();
+    for (int i = 1; i < bands; i++)
+    {
+        SDL_SemWait(workDone);
+    }
+
+    active = false;
+    HAL::getInstance()->unlockFrameBuffer();
+}
+
+int TilePool::worker(void* /*data*/)
+{
+    for (;;)
+    {
+        SDL_SemWait(workReady);
+        work();
+        SDL_SemPost(workDone);
+    }
+    return 0;
+}
+
+void TilePool::work()
+{
+    for (int band = SDL_AtomicAdd(&nextBand, 1); band < currentBands; band = SDL_AtomicAdd(&nextBand, 1))
+    {
+        const int16_t top = currentArea.y + (int16_t)(currentArea.height * band / currentBands);
+        const int16_t bottom = currentArea.y + (int16_t)(currentArea.height * (band + 1) / currentBands);
+        currentJob(currentContext, Rect(currentArea.x, top, currentArea.width, bottom - top));
+    }
+}
+
+void TiledLCD16bpp::run(TilePool::Job job, Job& context, const Rect& area)
+{
+    if (area.isEmpty())
+    {
+        return;
+    }
+    context.lcd = this;
+    TilePool::run(job, &context, area);
+}
+
+void TiledLCD16bpp::drawPartialBitmap(const Bitmap& bitmap, int16_t x, int16_t y, const Rect& rect, uint8_t alpha, bool useOptimized)
+{
+    Rect area = rect & Rect(0, 0, bitmap.getWidth(), bitmap.getHeight());
+    area &= Rect(-x, -y, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT);
+    if (TilePool::isActive() || !isUncompressed(bitmap.getFormat()) || area.area() < TilePool::MIN_PIXELS)
+    {
+        LCD16bpp::drawPartialBitmap(bitmap, x, y, rect, alpha, useOptimized);
+        return;
+    }
+    Job job;
+    job.bitmap = &bitmap;
+    job.x = x;
+    job.y = y;
+    job.alpha = alpha;
+    job.flag = useOptimized;
+    run(drawPartialBitmapBand, job, area);
+}
+
+void TiledLCD16bpp::blitCopy(const uint16_t* sourceData, const Rect& source, const Rect& blitRect, uint8_t alpha, bool hasTransparentPixels)
+{
+    const Rect area = blitRect & source & Rect(0, 0, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT);
+    if (TilePool::isActive() || area.area() < TilePool::MIN_PIXELS)
+    {
+        LCD16bpp::blitCopy(sourceData, source, blitRect, alpha, hasTransparentPixels);
+        return;
+    }
+    Job job;
+    job.sourceData = sourceData;
+    job.source = source;
+    job.alpha = alpha;
+    job.flag = hasTransparentPixels;
+    run(blitCopy16Band, job, area);
+}
+
+void TiledLCD16bpp::blitCopy(const uint8_t* sourceData, Bitmap::BitmapFormat sourceFormat, const Rect& source, const Rect& blitRect, uint8_t alpha, bool hasTransparentPixels)
+{
+    const Rect area = blitRect & source & Rect(0, 0, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT);
+    if (TilePool::isActive() || !isUncompressed(sourceFormat) || area.area() < TilePool::MIN_PIXELS)
+    {
+        LCD16bpp::blitCopy(sourceData, sourceFormat, source, blitRect, alpha, hasTransparentPixels);
+        return;
+    }
+    Job job;
+    job.sourceData = sourceData;
+    job.sourceFormat = sourceFormat;
+    job.source = source;
+    job.alpha = alpha;
+    job.flag = hasTransparentPixels;
+    run(blitCopy8Band, job, area);
+}
+
+void TiledLCD16bpp::fillRect(const Rect& rect, colortype color, uint8_t alpha)
+{
+    const Rect area = rect & Rect(0, 0, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT);
+    if (TilePool::isActive() || area.area() < TilePool::MIN_PIXELS)
+    {
+        LCD16bpp::fillRect(rect, color, alpha);
+        return;
+    }
+    Job job;
+    job.color = color;
+    job.alpha = alpha;
+    run(fillRectBand, job, area);
+}
+
+void TiledLCD16bpp::drawPartialBitmapBand(void* context, const Rect& band)
+{
+    const Job& job = *static_cast<const Job*>(context);
+    job.lcd->LCD16bpp::drawPartialBitmap(*job.bitmap, job.x, job.y, band, job.alpha, job.flag);
+}
+
+void TiledLCD16bpp::blitCopy16Band(void* context, const Rect& band)
+{
+    const Job& job = *static_cast<const Job*>(context);
+    job.lcd->LCD16bpp::blitCopy(static_cast<const uint16_t*>(job.sourceData), job.source, band, job.alpha, job.flag);
+}
+
+void TiledLCD16bpp::blitCopy8Band(void* context, const Rect& band)
+{
+    const Job& job = *static_cast<const Job*>(context);
+    job.lcd->LCD16bpp::blitCopy(static_cast<const uint8_t*>(job.sourceData), job.sourceFormat, job.source, band, job.alpha, job.flag);
+}
+
+void TiledLCD16bpp::fillRectBand(void* context, const Rect& band)
+{
+    const Job& job = *static_cast<const Job*>(context);
+    job.lcd->LCD16bpp::fillRect(band, job.color, job.alpha);
+}
@@ -0,0 +1,136 @@
+#ifndef TILEDRENDERING_HPP
+#define TILEDRENDERING_HPP
+
+#include <platform/hal/simulator/sdl2/HALSDL2.hpp>
+#include <platform/driver/lcd/LCD16bpp.hpp>
+#include <touchgfx/hal/Types.hpp>
+
+/** Most threads of the TilePool, the calling thread included. */
+#ifndef TILE_POOL_MAX_THREADS
+#define TILE_POOL_MAX_THREADS 16
+#endif
+
+/**
+ * Threads drawing the bands of a rectangle in parallel, for the simulator.
+ *
+ * The simulator draws every pixel on the CPU of the host, on a single thread. The
+ * TiledLCD16bpp hands its large fills and blits to the pool, which splits the rectangle
+ * into horizontal bands, one per thread, and draws them at the same time, the calling
+ * thread taking its share. The bands do not overlap and each pixel is computed as it
+ * would be by a single thread, so the frames drawn are the same whatever the number of
+ * threads.
+ *
+ * While a rectangle is drawn the calling thread holds the framebuffer for all the
+ * threads, see TiledHAL.
+ */
+class TilePool
+{
+public:
+    /** Draws a band of a rectangle. */
+    typedef void (*Job)(void* context, const touchgfx::Rect& band);
+
+    /**
+     * Starts the worker threads.
+     *
+     * @param threads The number of threads drawing, the calling thread included. 1 to
+     *                draw on the calling thread only.
+     */
+    static void start(int threads);
+
+    /**
+     * Gets the number of threads given on the command line with `--threads <n>`, or the
+     * number of cores of the host.
+     */
+    static int getThreadsFromArguments(int argc, char** argv);
+
+    /**
+     * Draws a rectangle in bands, holding the framebuffer meanwhile. Small rectangles,
+     * below MIN_PIXELS, are drawn on the calling thread only.
+     *
+     * @param job     Draws a band.
+     * @param context The context of the job.
+     * @param area    The rectangle.
+     */
+    static void run(Job job, void* context, const touchgfx::Rect& area);
+
+    /** Is a rectangle being drawn in bands? */
+    static bool isActive()
+    {
+        return active;
+    }
+
+    static const int32_t MIN_PIXELS = 16384; ///< Smallest rectangle split in bands
+    static const int16_t MIN_ROWS = 16;      ///< Fewest rows of a band
+
+private:
+    static int worker(void* data);
+    static void work();
+
+    static int threads;
+    static volatile bool active;
+};
+
+/**
+ * An LCD16bpp drawing its large fills and blits of uncompressed bitmaps in bands on the
+ * TilePool. Glyphs, texture mapping and canvas widgets are drawn on the calling thread,
+ * and so are the primitives called by a primitive already drawing in bands.
+ */
+class TiledLCD16bpp : public touchgfx::LCD16bpp
+{
+public:
+    virtual void drawPartialBitmap(const touchgfx::Bitmap& bitmap, int16_t x, int16_t y, const touchgfx::Rect& rect, uint8_t alpha = 255, bool useOptimized = true);
+    virtual void blitCopy(const uint16_t* sourceData, const touchgfx::Rect& source, const touchgfx::Rect& blitRect, uint8_t alpha, bool hasTransparentPixels);
+    virtual void blitCopy(const uint8_t* sourceData, touchgfx::Bitmap::BitmapFormat sourceFormat, const touchgfx::Rect& source, const touchgfx::Rect& blitRect, uint8_t alpha, bool hasTransparentPixels);
+    virtual void fillRect(const touchgfx::Rect& rect, touchgfx::colortype color, uint8_t alpha = 255);
+
+private:
+    struct Job
+    {
+        TiledLCD16bpp* lcd;
+        const touchgfx::Bitmap* bitmap;
+        const void* sourceData;
+        touchgfx::Bitmap::BitmapFormat sourceFormat;
+        touchgfx::Rect source;
+        int16_t x;
+        int16_t y;
+        touchgfx::colortype color;
+        uint8_t alpha;
+        bool flag;
+    };
+
+    static void drawPartialBitmapBand(void* context, const touchgfx::Rect& band);
+    static void blitCopy16Band(void* context, const touchgfx::Rect& band);
+    static void blitCopy8Band(void* context, const touchgfx::Rect& band);
+    static void fillRectBand(void* context, const touchgfx::Rect& band);
+
+    void run(TilePool::Job job, Job& context, const touchgfx::Rect& area);
+};
+
+/**
+ * The simulator HAL used with the TiledLCD16bpp. While the TilePool draws a rectangle,
+ * the framebuffer is held by the thread which started it, and handed to the threads
+ * drawing the bands without locking it again.
+ */
+class TiledHAL : public touchgfx::HALSDL2
+{
+public:
+    TiledHAL(touchgfx::DMA_Interface& dma, touchgfx::LCD& lcd, touchgfx::TouchController& touchCtrl, uint16_t width, uint16_t height)
+        : touchgfx::HALSDL2(dma, lcd, touchCtrl, width, height)
+    {
+    }
+
+    virtual uint16_t* lockFrameBuffer()
+    {
+        return TilePool::isActive() ? getClientFrameBuffer() : touchgfx::HALSDL2::lockFrameBuffer();
+    }
+
+    virtual void unlockFrameBuffer()
+    {
+        if (!TilePool::isActive())
+        {
+            touchgfx::HALSDL2::unlockFrameBuffer();
+        }
+    }
+};
+
+#endif // TILEDRENDERING_HPP
@@ -6,6 +6,8 @@
 #include <touchgfx/lcd/LCD.hpp>
 #include <stdlib.h>
 #include <simulator/mainBase.hpp>
+#include "HeadlessRunner.hpp"
+#include "TiledRendering.hpp"
 
 using namespace touchgfx;
 
@@ -24,12 +26,37 @@ int CALLBACK WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLi
 #endif
 
     touchgfx::NoDMA dma; //For windows/linux, DMA transfers are simulated
-    LCD& lcd = setupLCD();
+
+    // Large fills and blits are drawn in bands on all the cores, see TilePool
+    static TiledLCD16bpp tiledLcd;
     touchgfx::SDL2TouchController tc;
 
-    touchgfx::HAL& hal = touchgfx::touchgfx_generic_init<touchgfx::HALSDL2>(dma, lcd, tc, SIM_WIDTH, SIM_HEIGHT, 0, 0);
+    // Benchmark and cost model modes, see HeadlessRunner
+    HeadlessRunner runner;
+    runner.parse(argc, argv);
+    if (runner.isProfiling())
+    {
+        static CountingLCD16bpp countingLcd;
+        static ScriptTouchController scriptTc;
+        touchgfx::TouchController& touch = runner.isHeadless() ? static_cast<touchgfx::TouchController&>(scriptTc) : tc;
+        HeadlessHAL& profilingHal = static_cast<HeadlessHAL&>(touchgfx::touchgfx_generic_init<HeadlessHAL>(dma, countingLcd, touch, SIM_WIDTH, SIM_HEIGHT, 0, 0));
+        if (!runner.prepare(profilingHal))
+        {
+            return EXIT_FAILURE;
+        }
+        setupSimulator(runner.isHeadless() ? 1 : argc, argv, profilingHal);
+        if (runner.isHeadless())
+        {
+            return runner.run(profilingHal, scriptTc);
+        }
+        profilingHal.taskEntry(); //Never returns
+        return EXIT_SUCCESS;
+    }
+
+    touchgfx::HAL& hal = touchgfx::touchgfx_generic_init<TiledHAL>(dma, tiledLcd, tc, SIM_WIDTH, SIM_HEIGHT, 0, 0);
 
     setupSimulator(argc, argv, hal);
+    TilePool::start(TilePool::getThreadsFromArguments(argc, argv));
 
     // Ensure there is a console window to print to using printf() or
     // std::cout, and read from using e.g. fgets or std::cin.
@@ -0,0 +1,496 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : AffineLCD16bpp.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include <AffineLCD16bpp.hpp>
+
+/* USER CODE BEGIN AffineLCD16bpp.cpp */
+#include <math.h>
+#include <OverdrawHeatmap.hpp>
+#include <QualityGovernor.hpp>
+
+#include "stm32h7rsxx.h"
+
+namespace
+{
+// Red and blue in the low half word, green in the high half word, with room between them
+// for the products of a 5-bit alpha blend
+const uint32_t RGB565_SPREAD_MASK = 0x07E0F81FU;
+
+inline uint32_t spread(uint32_t rgb565)
+{
+    return (rgb565 | (rgb565 << 16)) & RGB565_SPREAD_MASK;
+}
+
+inline uint16_t blend(uint16_t bg, uint32_t fg, uint32_t alpha5)
+{
+    const uint32_t back = spread(bg);
+    const uint32_t mixed = ((((spread(fg) - back) * alpha5) >> 5) + back) & RGB565_SPREAD_MASK;
+    return (uint16_t)(mixed | (mixed >> 16));
+}
+
+inline uint32_t toRGB565(uint32_t argb8888)
+{
+    return ((argb8888 >> 8) & 0xF800U) | ((argb8888 >> 5) & 0x07E0U) | ((argb8888 >> 3) & 0x001FU);
+}
+
+// Two framebuffer pixels in one word, the first in the low half word
+inline uint32_t pair(uint32_t first, uint32_t second)
+{
+#if defined(__ARM_FEATURE_DSP) && __ARM_FEATURE_DSP
+    return __PKHBT(first, second, 16);
+#else
+    return first | (second << 16);
+#endif
+}
+
+inline uint16_t blendARGB8888(uint16_t bg, uint32_t pixel, uint8_t alpha)
+{
+    const uint32_t pixelAlpha = (alpha == 255) ? (pixel >> 24) : touchgfx::LCD::div255((pixel >> 24) * alpha);
+    if (pixelAlpha == 255)
+    {
+        return (uint16_t)toRGB565(pixel);
+    }
+    return blend(bg, toRGB565(pixel), pixelAlpha >> 3);
+}
+
+inline uint16_t blendColor(uint16_t bg, uint32_t rgb565, uint32_t alpha)
+{
+    return (alpha == 255) ? (uint16_t)rgb565 : blend(bg, rgb565, alpha >> 3);
+}
+
+// 4bpp: the left pixel in the low nibble
+inline uint32_t nibble(const uint8_t* row, uint32_t column)
+{
+    return (row[column >> 1] >> ((column & 1U) * 4U)) & 0x0FU;
+}
+
+// The pixels of a bitmap line as ARGB8888, from the first pixel drawn
+struct ARGB8888Pixels
+{
+    const uint32_t* data;
+
+    uint32_t operator[](int32_t i) const
+    {
+        return data[i];
+    }
+};
+
+struct L8ARGB8888Pixels
+{
+    const uint8_t* indices;
+    const uint32_t* palette;
+
+    uint32_t operator[](int32_t i) const
+    {
+        return palette[indices[i]];
+    }
+};
+
+struct L8RGB888Pixels
+{
+    const uint8_t* indices;
+    const uint8_t* palette;
+
+    uint32_t operator[](int32_t i) const
+    {
+        const uint8_t* const entry = palette + indices[i] * 3U;
+        return 0xFF000000U | ((uint32_t)entry[2] << 16) | ((uint32_t)entry[1] << 8) | entry[0];
+    }
+};
+
+bool isDrawnByDMA2D(touchgfx::BlitOperations operation)
+{
+    return (touchgfx::HAL::getInstance()->getBlitCaps() & operation) != 0;
+}
+
+// The operation DMA2D would draw a bitmap format with, 0 for the formats only the CPU draws
+uint32_t copyOperation(touchgfx::Bitmap::BitmapFormat format, uint8_t alpha, bool hasTransparentPixels)
+{
+    switch (format)
+    {
+    case touchgfx::Bitmap::RGB565:
+        return (alpha < 255 || hasTransparentPixels) ? touchgfx::BLIT_OP_COPY_WITH_ALPHA : touchgfx::BLIT_OP_COPY;
+    case touchgfx::Bitmap::ARGB8888:
+        return (alpha < 255) ? touchgfx::BLIT_OP_COPY_ARGB8888_WITH_ALPHA : touchgfx::BLIT_OP_COPY_ARGB8888;
+    case touchgfx::Bitmap::L8:
+        return touchgfx::BLIT_OP_COPY_L8;
+    case touchgfx::Bitmap::A4:
+        return touchgfx::BLIT_OP_COPY_A4;
+    default:
+        return 0;
+    }
+}
+
+// Rows of the display are rows of the framebuffer, and the whole display is in it
+bool isDirectFrameBuffer()
+{
+    return touchgfx::HAL::DISPLAY_ROTATION == touchgfx::rotate0
+           && touchgfx::HAL::getInstance()->getFrameRefreshStrategy() != touchgfx::HAL::REFRESH_STRATEGY_PARTIAL_FRAMEBUFFER;
+}
+}
+
+namespace touchgfx
+{
+void AffineLCD16bpp::fillRect(const Rect& rect, colortype color, uint8_t alpha)
+{
+    countWrite(rect, (alpha < 255) ? BLIT_OP_FILL_WITH_ALPHA : BLIT_OP_FILL);
+    writeDepth++;
+    LCD16bpp::fillRect(rect, color, alpha);
+    writeDepth--;
+}
+
+void AffineLCD16bpp::blitCopy(const uint16_t* sourceData, const Rect& source, const Rect& blitRect, uint8_t alpha, bool hasTransparentPixels)
+{
+    countWrite(blitRect & source, copyOperation(Bitmap::RGB565, alpha, hasTransparentPixels));
+    writeDepth++;
+    LCD16bpp::blitCopy(sourceData, source, blitRect, alpha, hasTransparentPixels);
+    writeDepth--;
+}
+
+void AffineLCD16bpp::blitCopy(const uint8_t* sourceData, Bitmap::BitmapFormat sourceFormat, const Rect& source, const Rect& blitRect, uint8_t alpha, bool hasTransparentPixels)
+{
+    countWrite(blitRect & source, copyOperation(sourceFormat, alpha, hasTransparentPixels));
+    writeDepth++;
+    LCD16bpp::blitCopy(sourceData, sourceFormat, source, blitRect, alpha, hasTransparentPixels);
+    writeDepth--;
+}
+
+void AffineLCD16bpp::drawTextureMapTriangle(const DrawingSurface& dest, const Point3D* vertices, const TextureSurface& texture, const Rect& absoluteRect, const Rect& dirtyAreaAbsolute, RenderingVariant renderVariant, uint8_t alpha, uint16_t subDivisionSize)
+{
+    countWrite(dirtyAreaAbsolute & absoluteRect, 0);
+    writeDepth++;
+    LCD16bpp::drawTextureMapTriangle(dest, vertices, texture, absoluteRect, dirtyAreaAbsolute, renderVariant, alpha, subDivisionSize);
+    writeDepth--;
+}
+
+void AffineLCD16bpp::drawTextureMapQuad(const DrawingSurface& dest, const Point3D* vertices, const TextureSurface& texture, const Rect& absoluteRect, const Rect& dirtyAreaAbsolute, RenderingVariant renderVariant, uint8_t alpha, uint16_t subDivisionSize)
+{
+    const QualityGovernor::Settings& quality = QualityGovernor::current();
+    if (!quality.bilinear)
+    {
+        renderVariant = (RenderingVariant)(renderVariant & ~RenderingVariant_Bilinear);
+    }
+    subDivisionSize = MAX(subDivisionSize, quality.subDivisionSize);
+    countWrite(dirtyAreaAbsolute & absoluteRect, 0);
+    const Bitmap::BitmapFormat format = (Bitmap::BitmapFormat)(renderVariant >> RenderingVariant_FormatShift);
+    const bool affine = vertices[0].Z == vertices[1].Z && vertices[1].Z == vertices[2].Z && vertices[2].Z == vertices[3].Z; //lint !e777
+    if (!AFFINE_TEXTURE_MAPPER || !affine
+            || (renderVariant & RenderingVariant_Bilinear) != 0
+            || !(format == Bitmap::ARGB8888 || (format == Bitmap::RGB565 && texture.extraData == 0)))
+    {
+        writeDepth++;
+        LCD16bpp::drawTextureMapQuad(dest, vertices, texture, absoluteRect, dirtyAreaAbsolute, renderVariant, alpha, subDivisionSize);
+        writeDepth--;
+        return;
+    }
+
+    float x[4];
+    float y[4];
+    for (int i = 0; i < 4; i++)
+    {
+        x[i] = vertices[i].X / 16.0f;
+        y[i] = vertices[i].Y / 16.0f;
+    }
+
+    // Equal Z makes the quad a parallelogram, spanned by the edges from vertex 0 to 1 and 3
+    const float e1x = x[1] - x[0];
+    const float e1y = y[1] - y[0];
+    const float e2x = x[3] - x[0];
+    const float e2y = y[3] - y[0];
+    const float det = e1x * e2y - e1y * e2x;
+    if (det == 0.0f) //lint !e777
+    {
+        return;
+    }
+    const float du1 = vertices[1].U - vertices[0].U;
+    const float du2 = vertices[3].U - vertices[0].U;
+    const float dv1 = vertices[1].V - vertices[0].V;
+    const float dv2 = vertices[3].V - vertices[0].V;
+    const float dUdx = (e2y * du1 - e1y * du2) / det;
+    const float dUdy = (e1x * du2 - e2x * du1) / det;
+    const float dVdx = (e2y * dv1 - e1y * dv2) / det;
+    const float dVdy = (e1x * dv2 - e2x * dv1) / det;
+    const fixed16_16 dUdxFixed = (fixed16_16)(dUdx * 65536.0f);
+    const fixed16_16 dVdxFixed = (fixed16_16)(dVdx * 65536.0f);
+
+    // The area to draw, relative to the quad coordinates
+    Rect clip = dirtyAreaAbsolute & absoluteRect;
+    clip.x -= absoluteRect.x;
+    clip.y -= absoluteRect.y;
+    const float minY = MIN(MIN(y[0], y[1]), MIN(y[2], y[3]));
+    const float maxY = MAX(MAX(y[0], y[1]), MAX(y[2], y[3]));
+    const int32_t firstRow = MAX((int32_t)clip.y, (int32_t)ceilf(minY - 0.5f));
+    const int32_t lastRow = MIN((int32_t)clip.bottom(), (int32_t)ceilf(maxY - 0.5f));
+
+    for (int32_t row = firstRow; row < lastRow; row++)
+    {
+        // Pixel centers inside the quad on this line
+        const float centerY = row + 0.5f;
+        float left = 1e9f;
+        float right = -1e9f;
+        for (int i = 0; i < 4; i++)
+        {
+            const int next = (i + 1) & 3;
+            if ((y[i] <= centerY && centerY < y[next]) || (y[next] <= centerY && centerY < y[i]))
+            {
+                const float crossing = x[i] + (centerY - y[i]) * (x[next] - x[i]) / (y[next] - y[i]);
+                left = MIN(left, crossing);
+                right = MAX(right, crossing);
+            }
+        }
+        const int32_t first = MAX((int32_t)clip.x, (int32_t)ceilf(left - 0.5f));
+        const int32_t last = MIN((int32_t)clip.right(), (int32_t)ceilf(right - 0.5f));
+        if (first >= last)
+        {
+            continue;
+        }
+
+        const float fx = first + 0.5f - x[0];
+        const float fy = centerY - y[0];
+        const float u = vertices[0].U + fx * dUdx + fy * dUdy;
+        const float v = vertices[0].V + fx * dVdx + fy * dVdy;
+        uint16_t* const fb = dest.address + (absoluteRect.y + row) * dest.stride + absoluteRect.x + first;
+        if (format == Bitmap::ARGB8888)
+        {
+            drawAffineSpan<true>(fb, last - first, (fixed16_16)(u * 65536.0f), (fixed16_16)(v * 65536.0f), dUdxFixed, dVdxFixed, texture, alpha);
+        }
+        else
+        {
+            drawAffineSpan<false>(fb, last - first, (fixed16_16)(u * 65536.0f), (fixed16_16)(v * 65536.0f), dUdxFixed, dVdxFixed, texture, alpha);
+        }
+    }
+}
+
+void AffineLCD16bpp::drawPartialBitmap(const Bitmap& bitmap, int16_t x, int16_t y, const Rect& rect, uint8_t alpha, bool useOptimized)
+{
+    const Bitmap::BitmapFormat format = bitmap.getFormat();
+    const uint8_t* const data = bitmap.getData();
+    // The palette starts with its format and size, the format also tells the compression
+    const uint8_t* const clut = bitmap.getExtraData();
+    const uint16_t clutFormat = (format == Bitmap::L8 && clut != 0) ? *reinterpret_cast<const uint16_t*>(clut) : 0xFFFFU;
+    const bool supported = (format == Bitmap::ARGB8888 && !isDrawnByDMA2D(alpha < 255 ? BLIT_OP_COPY_ARGB8888_WITH_ALPHA : BLIT_OP_COPY_ARGB8888))
+                           || ((clutFormat == Bitmap::CLUT_FORMAT_L8_ARGB8888 || clutFormat == Bitmap::CLUT_FORMAT_L8_RGB888) && !isDrawnByDMA2D(BLIT_OP_COPY_L8));
+    Rect dest = rect & Rect(0, 0, bitmap.getWidth(), bitmap.getHeight());
+    dest.x += x;
+    dest.y += y;
+    if (!LCD16BPP_PAIRED_BLENDS || !supported || data == 0 || !isDirectFrameBuffer())
+    {
+        countWrite(dest, copyOperation(format, alpha, bitmap.hasTransparentPixels()));
+        writeDepth++;
+        LCD16bpp::drawPartialBitmap(bitmap, x, y, rect, alpha, useOptimized);
+        writeDepth--;
+        return;
+    }
+    countWrite(dest, 0);
+
+    const int32_t width = bitmap.getWidth();
+    const Rect area = dest & Rect(0, 0, HAL::FRAME_BUFFER_WIDTH, HAL::FRAME_BUFFER_HEIGHT);
+    if (alpha == 0 || area.isEmpty())
+    {
+        return;
+    }
+    uint16_t* const fb = HAL::getInstance()->lockFrameBuffer();
+    const int32_t stride = getFramebufferStride() / 2;
+    for (int32_t row = area.y; row < area.bottom(); row++)
+    {
+        uint16_t* const line = fb + row * stride + area.x;
+        const int32_t first = (row - y) * width + (area.x - x);
+        if (format == Bitmap::ARGB8888)
+        {
+            const ARGB8888Pixels pixels = { reinterpret_cast<const uint32_t*>(data) + first };
+            blendSpan(line, area.width, pixels, alpha);
+        }
+        else if (clutFormat == Bitmap::CLUT_FORMAT_L8_ARGB8888)
+        {
+            const L8ARGB8888Pixels pixels = { data + first, reinterpret_cast<const uint32_t*>(clut + 4) };
+            blendSpan(line, area.width, pixels, alpha);
+        }
+        else
+        {
+            const L8RGB888Pixels pixels = { data + first, clut + 4 };
+            blendSpan(line, area.width, pixels, alpha);
+        }
+    }
+    HAL::getInstance()->unlockFrameBuffer();
+}
+
+void AffineLCD16bpp::drawGlyph(uint16_t* wbuf16, Rect widgetArea, int16_t x, int16_t y, uint16_t offsetX, uint16_t offsetY, const Rect& invalidatedArea, const GlyphNode* glyph, const uint8_t* glyphData, uint8_t byteAlignRow, colortype color, uint8_t bitsPerPixel, uint8_t alpha, TextRotation rotation)
+{
+    if (!LCD16BPP_PAIRED_BLENDS
+            || bitsPerPixel != 4
+            || byteAlignRow == 0
+            || rotation != TEXT_ROTATE_0
+            || !isDirectFrameBuffer()
+            || isDrawnByDMA2D(BLIT_OP_COPY_A4))
+    {
+        Rect drawn = Rect(x, y, glyph->width() - offsetX, glyph->height() - offsetY) & invalidatedArea;
+        drawn.x += widgetArea.x;
+        drawn.y += widgetArea.y;
+        countWrite(drawn, (bitsPerPixel == 4) ? BLIT_OP_COPY_A4 : (bitsPerPixel == 8) ? BLIT_OP_COPY_A8 : 0);
+        writeDepth++;
+        LCD16bpp::drawGlyph(wbuf16, widgetArea, x, y, offsetX, offsetY, invalidatedArea, glyph, glyphData, byteAlignRow, color, bitsPerPixel, alpha, rotation);
+        writeDepth--;
+        return;
+    }
+
+    // The glyph is placed relative to the widget, its first offsetX columns and offsetY
+    // rows are outside of it
+    const Rect glyphArea(x, y, glyph->width() - offsetX, glyph->height() - offsetY);
+    const Rect visible = glyphArea & invalidatedArea;
+    countWrite(Rect(widgetArea.x + visible.x, widgetArea.y + visible.y, visible.width, visible.height), 0);
+    if (alpha == 0 || visible.isEmpty())
+    {
+        return;
+    }
+    uint8_t coverageAlpha[16];
+    for (uint32_t coverage = 0; coverage < 16; coverage++)
+    {
+        coverageAlpha[coverage] = (alpha == 255) ? (uint8_t)(coverage * 17U) : LCD::div255(coverage * 17U * alpha);
+    }
+    const uint32_t rgb565 = getNativeColor(color);
+    const uint32_t rowBytes = (glyph->width() + 1U) / 2U;
+    const int32_t stride = getFramebufferStride() / 2;
+    const uint32_t column = offsetX + (visible.x - x);
+    for (int32_t row = 0; row < visible.height; row++)
+    {
+        const uint8_t* const glyphRow = glyphData + (offsetY + (visible.y - y) + row) * rowBytes;
+        uint16_t* const line = wbuf16 + (widgetArea.y + visible.y + row) * stride + widgetArea.x + visible.x;
+        blendGlyphSpan(line, visible.width, glyphRow, column, rgb565, coverageAlpha);
+    }
+}
+
+void AffineLCD16bpp::countWrite(const Rect& area, uint32_t operation) const
+{
+    // Only while it draws the frame, not when benchmarked against HybridLCDGPU2D
+    if (writeDepth > 0 || &HAL::lcd() != this)
+    {
+        return;
+    }
+    const bool dma2d = operation != 0 && isDrawnByDMA2D(static_cast<BlitOperations>(operation));
+    OverdrawHeatmap::wrote(area, dma2d ? OverdrawHeatmap::BACKEND_DMA2D : OverdrawHeatmap::BACKEND_CPU);
+}
+
+template <class Pixels>
+TOUCHGFX_ITCM_FUNCTION void AffineLCD16bpp::blendSpan(uint16_t* fb, int32_t count, const Pixels& pixels, uint8_t alpha)
+{
+    int32_t i = 0;
+    // A first pixel on its own, so the pairs are words
+    if (count > 0 && (reinterpret_cast<uintptr_t>(fb) & 2U) != 0)
+    {
+        fb[0] = blendARGB8888(fb[0], pixels[0], alpha);
+        i = 1;
+    }
+    uint32_t* pairs = reinterpret_cast<uint32_t*>(fb + i);
+    for (; i + 1 < count; i += 2, pairs++)
+    {
+        const uint32_t first = pixels[i];
+        const uint32_t second = pixels[i + 1];
+        if (((first | second) >> 24) == 0)
+        {
+            continue;
+        }
+        if (alpha == 255 && (first & second) >= 0xFF000000U)
+        {
+            *pairs = pair(toRGB565(first), toRGB565(second));
+            continue;
+        }
+        const uint32_t old = *pairs;
+        *pairs = pair(blendARGB8888((uint16_t)old, first, alpha), blendARGB8888((uint16_t)(old >> 16), second, alpha));
+    }
+    if (i < count)
+    {
+        fb[i] = blendARGB8888(fb[i], pixels[i], alpha);
+    }
+}
+
+TOUCHGFX_ITCM_FUNCTION void AffineLCD16bpp::blendGlyphSpan(uint16_t* fb, int32_t count, const uint8_t* glyphRow, uint32_t column, uint32_t color, const uint8_t* coverageAlpha)
+{
+    int32_t i = 0;
+    if (count > 0 && (reinterpret_cast<uintptr_t>(fb) & 2U) != 0)
+    {
+        fb[0] = blendColor(fb[0], color, coverageAlpha[nibble(glyphRow, column)]);
+        i = 1;
+    }
+    uint32_t* pairs = reinterpret_cast<uint32_t*>(fb + i);
+    for (; i + 1 < count; i += 2, pairs++)
+    {
+        const uint32_t first = coverageAlpha[nibble(glyphRow, column + i)];
+        const uint32_t second = coverageAlpha[nibble(glyphRow, column + i + 1)];
+        if ((first | second) == 0)
+        {
+            continue;
+        }
+        if ((first & second) == 255)
+        {
+            *pairs = pair(color, color);
+            continue;
+        }
+        const uint32_t old = *pairs;
+        *pairs = pair(blendColor((uint16_t)old, color, first), blendColor((uint16_t)(old >> 16), color, second));
+    }
+    if (i < count)
+    {
+        fb[i] = blendColor(fb[i], color, coverageAlpha[nibble(glyphRow, column + i)]);
+    }
+}
+
+template <bool ARGB8888>
+TOUCHGFX_ITCM_FUNCTION void AffineLCD16bpp::drawAffineSpan(uint16_t* fb, int32_t count, fixed16_16 u, fixed16_16 v, fixed16_16 dUdx, fixed16_16 dVdx, const TextureSurface& texture, uint8_t alpha)
+{
+    const uint32_t width = (uint32_t)texture.width;
+    const uint32_t height = (uint32_t)texture.height;
+    const int32_t stride = texture.stride;
+    for (; count > 0; count--, fb++, u += dUdx, v += dVdx)
+    {
+        // Texels outside the texture, like the one texel border of the texture mappers,
+        // are transparent; negative U/V wrap to large unsigned values
+        const uint32_t texelU = (uint32_t)(u >> 16);
+        const uint32_t texelV = (uint32_t)(v >> 16);
+        if (texelU >= width || texelV >= height)
+        {
+            continue;
+        }
+        const int32_t texel = (int32_t)texelV * stride + (int32_t)texelU;
+        if (ARGB8888)
+        {
+            const uint32_t pixel = reinterpret_cast<const uint32_t*>(texture.data)[texel];
+            const uint32_t pixelAlpha = LCD::div255((pixel >> 24) * alpha);
+            if (pixelAlpha == 255)
+            {
+                *fb = (uint16_t)toRGB565(pixel);
+            }
+            else if (pixelAlpha != 0)
+            {
+                *fb = blend(*fb, toRGB565(pixel), pixelAlpha >> 3);
+            }
+        }
+        else if (alpha == 255)
+        {
+            *fb = texture.data[texel];
+        }
+        else
+        {
+            *fb = blend(*fb, texture.data[texel], alpha >> 3);
+        }
+    }
+}
+} // namespace touchgfx
+
+/* USER CODE END AffineLCD16bpp.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,124 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : AffineLCD16bpp.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef AFFINELCD16BPP_HPP
+#define AFFINELCD16BPP_HPP
+
+#include <platform/driver/lcd/LCD16bpp.hpp>
+#include <stdint.h>
+
+/* USER CODE BEGIN AffineLCD16bpp.hpp */
+
+/**
+ * Set to 0 to draw all texture mapped quads with the perspective correct scan lines of
+ * LCD16bpp.
+ */
+#ifndef AFFINE_TEXTURE_MAPPER
+#define AFFINE_TEXTURE_MAPPER 1
+#endif
+
+/**
+ * Set to 0 to blend ARGB8888 and L8 bitmaps and A4 glyphs with the per pixel loops of
+ * LCD16bpp when DMA2D does not draw them.
+ */
+#ifndef LCD16BPP_PAIRED_BLENDS
+#define LCD16BPP_PAIRED_BLENDS 1
+#endif
+
+/**
+ * Places a function in ITCM, which the startup fills from flash. Code there is fetched
+ * without wait states and is never evicted from the instruction cache by the rest of the
+ * drawing code, so it is not refetched from external flash. Define as empty to keep all
+ * code in flash.
+ */
+#ifndef TOUCHGFX_ITCM_FUNCTION
+#define TOUCHGFX_ITCM_FUNCTION __attribute__((section(".ITCMText"), noinline))
+#endif
+
+namespace touchgfx
+{
+/**
+ * @class AffineLCD16bpp
+ *
+ * @brief LCD16bpp with a fixed-point fast path for texture mapped quads without perspective.
+ *
+ *        LCD16bpp draws every texture mapped quad perspective correct: each scan line is
+ *        split into subdivisions, and U/V/Z are interpolated in float for every one of
+ *        them. A quad whose four vertices have the same Z, like a texture mapper rotated
+ *        around the z axis only, maps the texture affinely, so U and V change by the same
+ *        amount from one pixel to the next across the whole quad.
+ *
+ *        Such quads, sampled nearest neighbor from ARGB8888 or opaque RGB565 textures, are
+ *        drawn here instead. Floats are only used once per scan line to find the span and
+ *        its first texel; the inner loop steps U/V in 16.16 fixed-point and blends all
+ *        three color channels with one multiply, leaving the load/store and the fixed-point
+ *        adds free to dual-issue. Other quads are drawn by LCD16bpp.
+ *
+ *        ARGB8888 bitmaps, L8 bitmaps with an ARGB8888 or RGB888 palette and A4 glyphs
+ *        that DMA2D does not draw, with DMA acceleration disabled, are blended here two
+ *        framebuffer pixels at a time: the pair is read and written as one word, which
+ *        halves the accesses to the framebuffer in PSRAM, a pair of opaque or transparent
+ *        pixels is written or skipped without blending, and each blended pixel takes one
+ *        multiply for its three channels. Rotated displays and rotated text are left to
+ *        LCD16bpp.
+ *
+ *        While it draws the frame, the area of every fill, blit, glyph and texture mapped
+ *        triangle or quad is counted for the overdraw heatmap, by DMA2D or the CPU as
+ *        getBlitCaps() tells, see OverdrawHeatmap.
+ */
+class AffineLCD16bpp : public LCD16bpp
+{
+public:
+    AffineLCD16bpp()
+        : LCD16bpp(), writeDepth(0)
+    {
+    }
+
+    virtual void fillRect(const Rect& rect, colortype color, uint8_t alpha = 255);
+
+    virtual void blitCopy(const uint16_t* sourceData, const Rect& source, const Rect& blitRect, uint8_t alpha, bool hasTransparentPixels);
+
+    virtual void blitCopy(const uint8_t* sourceData, Bitmap::BitmapFormat sourceFormat, const Rect& source, const Rect& blitRect, uint8_t alpha, bool hasTransparentPixels);
+
+    virtual void drawTextureMapTriangle(const DrawingSurface& dest, const Point3D* vertices, const TextureSurface& texture, const Rect& absoluteRect, const Rect& dirtyAreaAbsolute, RenderingVariant renderVariant, uint8_t alpha = 255, uint16_t subDivisionSize = 12);
+
+    virtual void drawTextureMapQuad(const DrawingSurface& dest, const Point3D* vertices, const TextureSurface& texture, const Rect& absoluteRect, const Rect& dirtyAreaAbsolute, RenderingVariant renderVariant, uint8_t alpha = 255, uint16_t subDivisionSize = 12);
+
+    virtual void drawPartialBitmap(const Bitmap& bitmap, int16_t x, int16_t y, const Rect& rect, uint8_t alpha = 255, bool useOptimized = true);
+
+protected:
+    virtual void drawGlyph(uint16_t* wbuf16, Rect widgetArea, int16_t x, int16_t y, uint16_t offsetX, uint16_t offsetY, const Rect& invalidatedArea, const GlyphNode* glyph, const uint8_t* glyphData, uint8_t byteAlignRow, colortype color, uint8_t bitsPerPixel, uint8_t alpha, TextRotation rotation);
+
+private:
+    /** Counts an area written for the overdraw heatmap, drawn by DMA2D if it does operation. */
+    void countWrite(const Rect& area, uint32_t operation) const;
+
+    template <class Pixels>
+    static void blendSpan(uint16_t* fb, int32_t count, const Pixels& pixels, uint8_t alpha);
+    static void blendGlyphSpan(uint16_t* fb, int32_t count, const uint8_t* glyphRow, uint32_t column, uint32_t color, const uint8_t* coverageAlpha);
+    template <bool ARGB8888>
+    static void drawAffineSpan(uint16_t* fb, int32_t count, fixed16_16 u, fixed16_16 v, fixed16_16 dUdx, fixed16_16 dVdx, const TextureSurface& texture, uint8_t alpha);
+
+    uint8_t writeDepth; ///< Nesting of counted operations, only the outermost is counted
+};
+} // namespace touchgfx
+
+/* USER CODE END AffineLCD16bpp.hpp */
+
+#endif // AFFINELCD16BPP_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,133 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : AssetUpdate.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include <AssetUpdate.hpp>
+
+/* USER CODE BEGIN AssetUpdate.cpp */
+#include <TraceOutput.hpp>
+#include <stddef.h>
+#include <string.h>
+
+#include "stm32h7rsxx.h"
+
+namespace touchgfx
+{
+bool AssetUpdate::stage(uint32_t offset, const void* data, uint32_t size)
+{
+    if (offset > STAGING_SIZE || size > STAGING_SIZE - offset)
+    {
+        return false;
+    }
+    memcpy(reinterpret_cast<uint8_t*>(STAGING_ADDRESS) + offset, data, size);
+
+    // Only request() marks the patch to be applied
+    if (offset < sizeof(uint32_t))
+    {
+        header().magic = 0U;
+    }
+    return true;
+}
+
+bool AssetUpdate::request()
+{
+    Header& h = header();
+    const uint32_t maxBlocks = (STAGING_SIZE - sizeof(Header)) / sizeof(Block);
+
+    Header checked = h;
+    checked.magic = MAGIC;
+    if (checked.checksum != checksum(&checked, offsetof(Header, checksum))
+        || h.blockCount == 0U || h.blockCount > maxBlocks)
+    {
+        return false;
+    }
+    for (uint32_t i = 0; i < h.blockCount; i++)
+    {
+        const uint32_t address = block(i).address;
+        if (address % BLOCK_SIZE != 0U || address < REGION_START || address > REGION_END - BLOCK_SIZE
+            || (i != 0U && address <= block(i - 1U).address))
+        {
+            return false;
+        }
+    }
+    if (h.payloadChecksum != checksum(&block(0), h.blockCount * sizeof(Block)))
+    {
+        return false;
+    }
+
+    // The PSRAM keeps the patch across the reset, the D-cache does not
+    h.magic = MAGIC;
+    SCB_CleanDCache();
+    NVIC_SystemReset();
+    return true;
+}
+
+void AssetUpdate::discard()
+{
+    header().magic = 0U;
+    SCB_CleanDCache_by_Addr(reinterpret_cast<void*>(STAGING_ADDRESS), static_cast<int32_t>(sizeof(Header)));
+}
+
+void AssetUpdate::report()
+{
+    static const char* const states[] = { "none", "applying", "done", "failed", "rejected", "interrupted" };
+
+    const Record& r = record();
+    if (r.magic != RECORD_MAGIC || r.checksum != checksum(&r, offsetof(Record, checksum)) || r.state > INTERRUPTED)
+    {
+        tracePrintf("assets: no update applied by the boot loader");
+    }
+    else
+    {
+        tracePrintf("assets: update %08lx %s blocks=%lu unchanged=%lu programmed=%lu erased=%lu batches=%lu time=%lums",
+                    (unsigned long)r.patch,
+                    states[r.state],
+                    (unsigned long)r.blocks,
+                    (unsigned long)r.unchanged,
+                    (unsigned long)r.programmed,
+                    (unsigned long)r.erased,
+                    (unsigned long)r.eraseBatches,
+                    (unsigned long)r.durationMs);
+    }
+
+    if (header().magic == MAGIC)
+    {
+        tracePrintf("assets: a patch is still staged, applied on the next boot");
+    }
+}
+
+uint32_t AssetUpdate::checksum(const void* data, uint32_t size)
+{
+    // CRC-32, as BOOT_STORAGE_Checksum() of the boot loader
+    const uint8_t* ptr = static_cast<const uint8_t*>(data);
+    uint32_t crc = 0xFFFFFFFFU;
+
+    for (uint32_t i = 0; i < size; i++)
+    {
+        crc ^= ptr[i];
+        for (uint32_t bit = 0; bit < 8; bit++)
+        {
+            crc = (crc >> 1) ^ (0xEDB88320U & (0U - (crc & 1U)));
+        }
+    }
+    return ~crc;
+}
+} // namespace touchgfx
+
+/* USER CODE END AssetUpdate.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
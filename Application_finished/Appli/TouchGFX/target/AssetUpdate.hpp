@@ -0,0 +1,171 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : AssetUpdate.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef ASSETUPDATE_HPP
+#define ASSETUPDATE_HPP
+
+#include <stdint.h>
+
+/* USER CODE BEGIN AssetUpdate.hpp */
+
+namespace touchgfx
+{
+/**
+ * @class AssetUpdate
+ *
+ * @brief Updates of the images, fonts and texts in the FLASH_GFX region of the NOR
+ *        flash by block delta patches.
+ *
+ *        The application runs from the NOR flash and reads the assets in place, and
+ *        the memory cannot be read while it is erased or programmed, so the application
+ *        does not write it. A patch, built by gcc/mkassetpatch.py from the assets
+ *        flashed and the new ones, carries only the 4 KB blocks which differ. The
+ *        application receives it while the UI keeps running, stages it in the last
+ *        2 MB of the PSRAM, out of its EXTRAM region, and resets. The boot loader
+ *        applies the patch before the NOR flash is mapped, skips the blocks already up
+ *        to date, only programs the blocks found erased and erases the others by runs
+ *        of adjacent blocks, see asset_update.h of the boot loader. It keeps the
+ *        outcome in the last sector of its internal flash. The layouts of the patch and
+ *        of the record are shared with the boot loader.
+ */
+class AssetUpdate
+{
+public:
+    static const uint32_t MAGIC = 0x54415041U;           ///< "APAT", the patch is to be applied
+    static const uint32_t RECORD_MAGIC = 0x44505541U;    ///< "AUPD"
+    static const uint32_t RECORD_ADDRESS = 0x0800E300U;  ///< Boot storage, asset update record
+    static const uint32_t STAGING_ADDRESS = 0x91E00000U; ///< Last 2 MB of the PSRAM
+    static const uint32_t STAGING_SIZE = 0x00200000U;
+    static const uint32_t BLOCK_SIZE = 4096U;            ///< Smallest erase of the NOR flash
+    static const uint32_t REGION_START = 0x70200000U;    ///< FLASH_GFX
+    static const uint32_t REGION_END = 0x78000000U;
+
+    /** State of the last update, as the boot loader left it. */
+    enum State
+    {
+        APPLYING = 1, ///< Started, the boot loader resumes it on the next boot
+        DONE,         ///< Every block programmed and read back
+        FAILED,       ///< Erase, program or read back failed, the patch stays staged
+        REJECTED,     ///< The patch failed the checks of the boot loader
+        INTERRUPTED   ///< Power lost while applying, the patch must be staged again
+    };
+
+    /** Header of a patch, the blocks follow by ascending address. */
+    struct Header
+    {
+        uint32_t magic;           ///< MAGIC once requested
+        uint32_t blockCount;      ///< Number of blocks following the header
+        uint32_t payloadChecksum; ///< CRC-32 of the blocks
+        uint32_t checksum;        ///< CRC-32 of the fields above, with magic set to MAGIC
+    };
+
+    /** Block of a patch: the new content of the block. */
+    struct Block
+    {
+        uint32_t address;          ///< Mapped address, a multiple of BLOCK_SIZE
+        uint8_t data[BLOCK_SIZE];
+    };
+
+    /** Outcome of the last patch. */
+    struct Record
+    {
+        uint32_t magic; ///< RECORD_MAGIC while the record is valid
+        uint32_t state; ///< State
+        uint32_t patch; ///< Checksum of the header of the patch
+        uint32_t blocks;
+        uint32_t unchanged;    ///< Blocks which already held their new content
+        uint32_t programmed;   ///< Blocks programmed without erase
+        uint32_t erased;       ///< Blocks erased, then programmed
+        uint32_t eraseBatches; ///< Runs of adjacent blocks erased together
+        uint32_t durationMs;
+        uint32_t checksum;
+    };
+
+    /**
+     * @fn static bool AssetUpdate::stage(uint32_t offset, const void* data, uint32_t size);
+     *
+     * @brief Copies a part of a patch to the staging area.
+     *
+     *        Copies a part of a patch, as received, at its offset in the patch. The
+     *        patch is not applied until request() checks it, even if a reset occurs
+     *        meanwhile.
+     *
+     * @param  offset Offset of the part in the patch.
+     * @param  data   The part.
+     * @param  size   Size of the part.
+     *
+     * @return false if the part does not fit in the staging area.
+     */
+    static bool stage(uint32_t offset, const void* data, uint32_t size);
+
+    /**
+     * @fn static bool AssetUpdate::request();
+     *
+     * @brief Checks the staged patch and resets to have the boot loader apply it.
+     *
+     *        Checks the checksums of the patch and the addresses of its blocks, marks
+     *        it to be applied, writes it back from the D-cache and resets the system.
+     *        Does not return unless the patch is invalid.
+     *
+     * @return false if the patch is invalid.
+     */
+    static bool request();
+
+    /**
+     * @fn static void AssetUpdate::discard();
+     *
+     * @brief Discards the staged patch, applied on the next boot otherwise.
+     */
+    static void discard();
+
+    /**
+     * @fn static void AssetUpdate::report();
+     *
+     * @brief Reports the outcome of the last patch over SWO.
+     *
+     *        Reports the state of the last patch applied by the boot loader, its
+     *        blocks skipped, programmed and erased, the erase batches and the time
+     *        taken, and whether a patch is still staged. Must not be called from
+     *        interrupt context.
+     */
+    static void report();
+
+private:
+    static Header& header()
+    {
+        return *reinterpret_cast<Header*>(STAGING_ADDRESS);
+    }
+
+    static const Block& block(uint32_t index)
+    {
+        return *reinterpret_cast<const Block*>(STAGING_ADDRESS + sizeof(Header) + index * sizeof(Block));
+    }
+
+    static const Record& record()
+    {
+        return *reinterpret_cast<const Record*>(RECORD_ADDRESS);
+    }
+
+    static uint32_t checksum(const void* data, uint32_t size);
+};
+} // namespace touchgfx
+
+/* USER CODE END AssetUpdate.hpp */
+
+#endif // ASSETUPDATE_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,256 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : AssetUploadQueue.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include <AssetUploadQueue.hpp>
+
+/* USER CODE BEGIN AssetUploadQueue.cpp */
+#include <DCacheMaintenance.hpp>
+#include <touchgfx/Utils.hpp>
+#include <cassert>
+#include <string.h>
+
+namespace
+{
+// Largest HPDMA block, rounded down to the burst size
+const uint32_t MAX_BLOCK_SIZE = 0xFFE0U;
+}
+
+namespace touchgfx
+{
+AssetUploadQueue* AssetUploadQueue::instance = 0;
+
+AssetUploadQueue::AssetUploadQueue()
+    : running(-1), block(0), sequence(0), capturePriority(PRIORITY_HIGH), capturing(false)
+{
+    memset(uploads, 0, sizeof(uploads));
+    memset(&hdma, 0, sizeof(hdma));
+    resetStats();
+}
+
+void AssetUploadQueue::init()
+{
+    instance = this;
+
+    // Words in bursts of a line of the data cache, the uploads are word aligned
+    hdma.Instance = HPDMA1_Channel4;
+    hdma.Init.Request = DMA_REQUEST_SW;
+    hdma.Init.BlkHWRequest = DMA_BREQ_SINGLE_BURST;
+    hdma.Init.Direction = DMA_MEMORY_TO_MEMORY;
+    hdma.Init.SrcInc = DMA_SINC_INCREMENTED;
+    hdma.Init.DestInc = DMA_DINC_INCREMENTED;
+    hdma.Init.SrcDataWidth = DMA_SRC_DATAWIDTH_WORD;
+    hdma.Init.DestDataWidth = DMA_DEST_DATAWIDTH_WORD;
+    hdma.Init.Priority = DMA_LOW_PRIORITY_MID_WEIGHT;
+    hdma.Init.SrcBurstLength = 8;
+    hdma.Init.DestBurstLength = 8;
+    hdma.Init.TransferAllocatedPort = DMA_SRC_ALLOCATED_PORT0 | DMA_DEST_ALLOCATED_PORT1;
+    hdma.Init.TransferEventMode = DMA_TCEM_BLOCK_TRANSFER;
+    hdma.Init.Mode = DMA_NORMAL;
+    if (HAL_DMA_Init(&hdma) != HAL_OK)
+    {
+        assert(0 && "Unable to initialize asset upload DMA");
+    }
+    HAL_DMA_ConfigChannelAttributes(&hdma, DMA_CHANNEL_NPRIV);
+    HAL_DMA_RegisterCallback(&hdma, HAL_DMA_XFER_CPLT_CB_ID, &AssetUploadQueue::transferComplete);
+
+    HAL_NVIC_SetPriority(HPDMA1_Channel4_IRQn, 5, 0);
+    HAL_NVIC_EnableIRQ(HPDMA1_Channel4_IRQn);
+}
+
+bool AssetUploadQueue::upload(void* dest, const void* src, uint32_t numBytes, Priority priority, GenericCallback<void*>* done)
+{
+    uint8_t* const to = static_cast<uint8_t*>(dest);
+    const uint8_t* const from = static_cast<const uint8_t*>(src);
+    if (instance != this || numBytes < TOUCHGFX_ASSET_UPLOAD_MIN_BYTES || (((uintptr_t)to | (uintptr_t)from) & 3U) != 0)
+    {
+        stats.cpuCopies++;
+        return false;
+    }
+
+    int16_t slot = -1;
+    for (int16_t pass = 0; pass < 2 && slot < 0; pass++)
+    {
+        if (pass > 0)
+        {
+            // Completed uploads hold their slot until polled
+            poll();
+        }
+        for (int16_t i = 0; i < TOUCHGFX_ASSET_UPLOAD_QUEUE_SIZE; i++)
+        {
+            if (uploads[i].state == FREE)
+            {
+                slot = i;
+                break;
+            }
+        }
+    }
+    if (slot < 0)
+    {
+        stats.queueFull++;
+        stats.cpuCopies++;
+        return false;
+    }
+
+    // HPDMA moves whole words, the CPU the last bytes
+    const uint32_t words = numBytes & ~3U;
+    memcpy(to + words, from + words, numBytes - words);
+    // The source may be a buffer in RAM written by the CPU
+    DCacheMaintenance::clean(from, words);
+    // No dirty line may be evicted over the upload
+    DCacheMaintenance::cleanInvalidate(to, numBytes);
+
+    Upload& entry = uploads[slot];
+    entry.src = from;
+    entry.dest = to;
+    entry.length = words;
+    entry.offset = 0;
+    entry.sequence = sequence++;
+    entry.done = done;
+    entry.priority = (uint8_t)priority;
+    stats.uploads[priority]++;
+    stats.uploadBytes += words;
+
+    // The interrupt may go idle between the check and queueing the upload
+    const uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    entry.state = QUEUED;
+    if (running < 0)
+    {
+        startNext();
+    }
+    __set_PRIMASK(primask);
+    return true;
+}
+
+void AssetUploadQueue::poll()
+{
+    for (uint16_t i = 0; i < TOUCHGFX_ASSET_UPLOAD_QUEUE_SIZE; i++)
+    {
+        Upload& entry = uploads[i];
+        if (entry.state != COMPLETED)
+        {
+            continue;
+        }
+        uint8_t* const dest = entry.dest;
+        GenericCallback<void*>* const done = entry.done;
+        // Lines of the destination may have been fetched while HPDMA wrote it
+        DCacheMaintenance::invalidate(dest, entry.length);
+        entry.state = FREE;
+        if (done != 0 && done->isValid())
+        {
+            done->execute(dest);
+        }
+    }
+}
+
+void AssetUploadQueue::waitForHighPriority()
+{
+    if (hasQueued(PRIORITY_HIGH))
+    {
+        stats.waits++;
+        while (hasQueued(PRIORITY_HIGH))
+        {
+        }
+    }
+    poll();
+}
+
+void AssetUploadQueue::finish()
+{
+    while (running >= 0)
+    {
+    }
+    poll();
+}
+
+void AssetUploadQueue::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+void AssetUploadQueue::handleInterrupt()
+{
+    HAL_DMA_IRQHandler(&hdma);
+}
+
+bool AssetUploadQueue::hasQueued(uint8_t maxPriority) const
+{
+    for (uint16_t i = 0; i < TOUCHGFX_ASSET_UPLOAD_QUEUE_SIZE; i++)
+    {
+        if (uploads[i].state == QUEUED && uploads[i].priority <= maxPriority)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void AssetUploadQueue::startNext()
+{
+    // The highest priority, the oldest first
+    int16_t next = -1;
+    for (int16_t i = 0; i < TOUCHGFX_ASSET_UPLOAD_QUEUE_SIZE; i++)
+    {
+        const Upload& entry = uploads[i];
+        if (entry.state == QUEUED
+                && (next < 0 || entry.priority < uploads[next].priority
+                    || (entry.priority == uploads[next].priority && (int32_t)(entry.sequence - uploads[next].sequence) < 0)))
+        {
+            next = i;
+        }
+    }
+    if (next >= 0 && running >= 0 && next != running && uploads[running].state == QUEUED)
+    {
+        stats.overtaken++;
+    }
+    running = next;
+    if (next < 0)
+    {
+        return;
+    }
+
+    const Upload& entry = uploads[next];
+    block = MIN(entry.length - entry.offset, MAX_BLOCK_SIZE);
+    HAL_DMA_Start_IT(&hdma, (uint32_t)(entry.src + entry.offset), (uint32_t)(entry.dest + entry.offset), block);
+}
+
+void AssetUploadQueue::transferComplete(DMA_HandleTypeDef* /*hdma*/)
+{
+    AssetUploadQueue* const queue = instance;
+    Upload& entry = queue->uploads[queue->running];
+    entry.offset += queue->block;
+    if (entry.offset >= entry.length)
+    {
+        entry.state = COMPLETED;
+    }
+    queue->startNext();
+}
+} // namespace touchgfx
+
+extern "C" void AssetUploadQueue_IRQHandler(void)
+{
+    touchgfx::AssetUploadQueue* const queue = touchgfx::AssetUploadQueue::getInstance();
+    if (queue != 0)
+    {
+        queue->handleInterrupt();
+    }
+}
+
+/* USER CODE END AssetUploadQueue.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,272 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : AssetUploadQueue.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef ASSETUPLOADQUEUE_HPP
+#define ASSETUPLOADQUEUE_HPP
+
+#include <touchgfx/Callback.hpp>
+#include <stdint.h>
+
+#include <stm32h7rsxx_hal.h>
+
+/* USER CODE BEGIN AssetUploadQueue.hpp */
+
+/**
+ * Smallest upload, in bytes, queued on HPDMA. Smaller copies are done by the CPU at once.
+ */
+#ifndef TOUCHGFX_ASSET_UPLOAD_MIN_BYTES
+#define TOUCHGFX_ASSET_UPLOAD_MIN_BYTES 1024
+#endif
+
+/**
+ * Number of uploads that can be queued or completed but not yet polled.
+ */
+#ifndef TOUCHGFX_ASSET_UPLOAD_QUEUE_SIZE
+#define TOUCHGFX_ASSET_UPLOAD_QUEUE_SIZE 16
+#endif
+
+namespace touchgfx
+{
+/**
+ * @class AssetUploadQueue
+ *
+ * @brief Copies assets, like bitmaps, glyph pages and command list templates, from the
+ *        memory-mapped flash into PSRAM or AXI SRAM with HPDMA in the background.
+ *
+ *        Uploads are memory to memory transfers on HPDMA1 channel 4, a channel of its own
+ *        next to those of the video prefetch (2) and the glyph reads (3). They run in
+ *        blocks of at most 64 KB, and after every block the interrupt starts the queued
+ *        upload of the highest priority, the oldest first, so an upload needed for the
+ *        next frame overtakes a long prefetch within one block.
+ *
+ *        PRIORITY_HIGH uploads are needed by the frame being prepared:
+ *        FrontendApplication::drawCachedAreas() waits for them before anything is drawn,
+ *        so they overlap the ticks of the frame. TextureCache fills the bitmap cache this
+ *        way, by capturing with beginCapture() the copies that Bitmap::cache() asks
+ *        HAL::blockCopy() for.
+ *        Other uploads may run over several frames, and their destination must not be
+ *        used before their done callback.
+ *
+ *        The destination is cleaned and invalidated from the data cache when queued, and
+ *        invalidated again when the upload is done, as the CPU may have fetched lines of
+ *        it meanwhile. The done callbacks are called from poll(), which the HAL calls at
+ *        the start and at the end of every frame, never from the interrupt.
+ *
+ *        init() must be called before use, and AssetUploadQueue_IRQHandler() must be
+ *        called from the HPDMA1 channel 4 interrupt.
+ */
+class AssetUploadQueue
+{
+public:
+    /** The order uploads are transferred in. */
+    enum Priority
+    {
+        PRIORITY_HIGH,   ///< Needed before the next frame is drawn
+        PRIORITY_NORMAL, ///< Needed soon, like the assets of the next screen
+        PRIORITY_LOW,    ///< Prefetches that may be done whenever HPDMA is idle
+        NUMBER_OF_PRIORITIES
+    };
+
+    /** Uploads since the last reset. */
+    struct Stats
+    {
+        uint32_t uploads[NUMBER_OF_PRIORITIES]; ///< Uploads queued, per priority
+        uint32_t uploadBytes;                   ///< Bytes transferred by HPDMA
+        uint32_t cpuCopies;                     ///< Copies done by the CPU, small or queue full
+        uint32_t queueFull;                     ///< Uploads that found the queue full
+        uint32_t overtaken;                     ///< Blocks started for another upload than the previous one
+        uint32_t waits;                         ///< Frames that waited for PRIORITY_HIGH uploads
+    };
+
+    AssetUploadQueue();
+
+    /**
+     * @fn void AssetUploadQueue::init();
+     *
+     * @brief Initializes the DMA channel of the uploads.
+     */
+    void init();
+
+    /**
+     * @fn bool AssetUploadQueue::upload(void* dest, const void* src, uint32_t numBytes, Priority priority, GenericCallback<void*>* done = 0);
+     *
+     * @brief Queues an upload.
+     *
+     * @param dest     Destination, in PSRAM or AXI SRAM.
+     * @param src      Source, which must not change before the upload is done.
+     * @param numBytes Number of bytes.
+     * @param priority The priority.
+     * @param done     (Optional) Called with dest from poll() when the upload is done.
+     *
+     * @return false if the upload is too small or the queue is full, the caller copies it.
+     */
+    bool upload(void* dest, const void* src, uint32_t numBytes, Priority priority, GenericCallback<void*>* done = 0);
+
+    /**
+     * @fn void AssetUploadQueue::beginCapture(Priority priority);
+     *
+     * @brief Makes capture() queue the copies of TouchGFXHAL::blockCopy() as uploads,
+     *        until endCapture().
+     *
+     * @param priority The priority of the uploads.
+     */
+    void beginCapture(Priority priority)
+    {
+        capturePriority = priority;
+        capturing = true;
+    }
+
+    /**
+     * @fn void AssetUploadQueue::endCapture();
+     *
+     * @brief Ends beginCapture().
+     */
+    void endCapture()
+    {
+        capturing = false;
+    }
+
+    /**
+     * @fn bool AssetUploadQueue::capture(void* dest, const void* src, uint32_t numBytes);
+     *
+     * @brief Queues a block copy as an upload while capturing.
+     *
+     * @param dest     Destination.
+     * @param src      Source.
+     * @param numBytes Number of bytes.
+     *
+     * @return true if the copy was queued, false if the caller copies it.
+     */
+    bool capture(void* dest, const void* src, uint32_t numBytes)
+    {
+        return capturing && upload(dest, src, numBytes, capturePriority);
+    }
+
+    /**
+     * @fn bool AssetUploadQueue::isIdle() const;
+     *
+     * @brief Tells if all uploads are transferred.
+     *
+     * @return true if no upload is queued.
+     */
+    bool isIdle() const
+    {
+        return running < 0;
+    }
+
+    /**
+     * @fn void AssetUploadQueue::poll();
+     *
+     * @brief Completes the uploads HPDMA is done with and calls their done callbacks.
+     */
+    void poll();
+
+    /**
+     * @fn void AssetUploadQueue::waitForHighPriority();
+     *
+     * @brief Waits for the PRIORITY_HIGH uploads and completes them.
+     */
+    void waitForHighPriority();
+
+    /**
+     * @fn void AssetUploadQueue::finish();
+     *
+     * @brief Waits for all uploads and completes them.
+     */
+    void finish();
+
+    /**
+     * @fn const Stats& AssetUploadQueue::getStats() const;
+     *
+     * @brief Gets the upload statistics.
+     *
+     * @return The upload statistics.
+     */
+    const Stats& getStats() const
+    {
+        return stats;
+    }
+
+    /**
+     * @fn void AssetUploadQueue::resetStats();
+     *
+     * @brief Resets the upload statistics.
+     */
+    void resetStats();
+
+    /**
+     * @fn void AssetUploadQueue::handleInterrupt();
+     *
+     * @brief Handles the DMA channel interrupt.
+     */
+    void handleInterrupt();
+
+    /**
+     * @fn static AssetUploadQueue* AssetUploadQueue::getInstance();
+     *
+     * @brief Gets the initialized queue.
+     *
+     * @return The queue init() was last called on, or 0.
+     */
+    static AssetUploadQueue* getInstance()
+    {
+        return instance;
+    }
+
+private:
+    enum State
+    {
+        FREE,
+        QUEUED,
+        COMPLETED
+    };
+
+    struct Upload
+    {
+        const uint8_t* src;
+        uint8_t* dest;
+        uint32_t length;
+        uint32_t offset;   ///< Bytes transferred
+        uint32_t sequence; ///< Order of queueing, oldest first within a priority
+        GenericCallback<void*>* done;
+        uint8_t priority;
+        volatile uint8_t state;
+    };
+
+    bool hasQueued(uint8_t maxPriority) const;
+    void startNext();
+
+    static void transferComplete(DMA_HandleTypeDef* hdma);
+
+    Upload uploads[TOUCHGFX_ASSET_UPLOAD_QUEUE_SIZE];
+    volatile int16_t running; ///< Upload being transferred, -1 when HPDMA is idle
+    uint32_t block;           ///< Bytes of the block being transferred
+    uint32_t sequence;
+    Priority capturePriority;
+    bool capturing;
+    DMA_HandleTypeDef hdma;
+    Stats stats;
+
+    static AssetUploadQueue* instance;
+};
+} // namespace touchgfx
+
+/* USER CODE END AssetUploadQueue.hpp */
+
+#endif // ASSETUPLOADQUEUE_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
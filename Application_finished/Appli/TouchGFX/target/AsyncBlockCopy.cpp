@@ -0,0 +1,199 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : AsyncBlockCopy.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include <AsyncBlockCopy.hpp>
+
+/* USER CODE BEGIN AsyncBlockCopy.cpp */
+#include <DCacheMaintenance.hpp>
+#include <HybridLCDGPU2D.hpp>
+#include <string.h>
+
+namespace
+{
+// Words per DMA2D line of a flat copy, below the 16383 pixels of a line; 65535 lines of
+// them are 1 GB, so the line count of a flat copy never overflows
+const uint32_t FLAT_LINE_WORDS = 4096;
+const uint32_t MAX_LINE_WORDS = 16383;
+const uint32_t MAX_LINES = 65535;
+
+void copyLinesByCPU(uint8_t* dest, uint32_t destStride, const uint8_t* src, uint32_t srcStride, uint32_t lineBytes, uint16_t lines)
+{
+    for (uint16_t line = 0; line < lines; line++, dest += destStride, src += srcStride)
+    {
+        memcpy(dest, src, lineBytes);
+    }
+}
+}
+
+namespace touchgfx
+{
+AsyncBlockCopy::AsyncBlockCopy()
+    : lcd(0), pendingCount(0)
+{
+    resetStats();
+}
+
+void AsyncBlockCopy::init(HybridLCDGPU2D& hybridLCD)
+{
+    lcd = &hybridLCD;
+}
+
+bool AsyncBlockCopy::copy(void* dest, const void* src, uint32_t numBytes, GenericCallback<void*>* done)
+{
+    uint8_t* d = static_cast<uint8_t*>(dest);
+    const uint8_t* s = static_cast<const uint8_t*>(src);
+
+    if (lcd == 0 || numBytes < TOUCHGFX_BLOCK_COPY_DMA2D_MIN_BYTES || (((uintptr_t)d ^ (uintptr_t)s) & 3U) != 0)
+    {
+        memcpy(dest, src, numBytes);
+        stats.cpuCopies++;
+        stats.cpuBytes += numBytes;
+        if (done != 0 && done->isValid())
+        {
+            done->execute(dest);
+        }
+        return false;
+    }
+
+    // Up to the first word, and after the last whole line of words, by the CPU
+    const uint32_t head = (4U - ((uintptr_t)d & 3U)) & 3U;
+    memcpy(d, s, head);
+    d += head;
+    s += head;
+    numBytes -= head;
+
+    const uint32_t words = numBytes / 4U;
+    const uint32_t lines = (words >= FLAT_LINE_WORDS) ? words / FLAT_LINE_WORDS : 1U;
+    const uint32_t lineBytes = (words >= FLAT_LINE_WORDS) ? FLAT_LINE_WORDS * 4U : words * 4U;
+    const uint32_t dmaBytes = lines * lineBytes;
+    memcpy(d + dmaBytes, s + dmaBytes, numBytes - dmaBytes);
+    stats.cpuBytes += head + numBytes - dmaBytes;
+
+    return copyLines(d, lineBytes, s, lineBytes, lineBytes, (uint16_t)lines, done);
+}
+
+bool AsyncBlockCopy::copy2D(void* dest, uint32_t destStride, const void* src, uint32_t srcStride, uint32_t lineBytes, uint16_t lines, GenericCallback<void*>* done)
+{
+    uint8_t* const d = static_cast<uint8_t*>(dest);
+    const uint8_t* const s = static_cast<const uint8_t*>(src);
+
+    if (lcd == 0 || lines == 0 || lineBytes * lines < TOUCHGFX_BLOCK_COPY_DMA2D_MIN_BYTES
+            || (((uintptr_t)d | (uintptr_t)s | destStride | srcStride | lineBytes) & 3U) != 0
+            || lineBytes / 4U > MAX_LINE_WORDS || destStride < lineBytes || srcStride < lineBytes)
+    {
+        copyLinesByCPU(d, destStride, s, srcStride, lineBytes, lines);
+        stats.cpuCopies++;
+        stats.cpuBytes += lineBytes * lines;
+        if (done != 0 && done->isValid())
+        {
+            done->execute(dest);
+        }
+        return false;
+    }
+    return copyLines(d, destStride, s, srcStride, lineBytes, lines, done);
+}
+
+bool AsyncBlockCopy::copyLines(uint8_t* dest, uint32_t destStride, const uint8_t* src, uint32_t srcStride, uint32_t lineBytes, uint16_t lines, GenericCallback<void*>* done)
+{
+    if (pendingCount == TOUCHGFX_BLOCK_COPY_QUEUE_SIZE)
+    {
+        stats.waits++;
+        finish();
+    }
+
+    const uint32_t srcSize = (lines - 1) * srcStride + lineBytes;
+    const uint32_t destSize = (lines - 1) * destStride + lineBytes;
+
+    // DMA2D reads memory, so what the CPU wrote must be there, and dirty lines of the
+    // destination must not be evicted over what DMA2D writes
+    DCacheMaintenance::clean(src, srcSize);
+    DCacheMaintenance::cleanInvalidate(dest, destSize);
+
+    BlitOp op = BlitOp();
+    op.operation = BLIT_OP_COPY;
+    op.nSteps = (uint16_t)(lineBytes / 4U);
+    op.srcLoopStride = (uint16_t)(srcStride / 4U);
+    op.dstLoopStride = (uint16_t)(destStride / 4U);
+    op.alpha = 255;
+    op.srcFormat = Bitmap::ARGB8888;
+    op.dstFormat = Bitmap::ARGB8888;
+
+    // Line offsets are in pixels, so a stride of more than 65535 words is split per line
+    const uint16_t linesPerOp = (srcStride / 4U > 0xFFFFU || destStride / 4U > 0xFFFFU) ? 1 : (uint16_t)MAX_LINES;
+    for (uint32_t line = 0; line < lines; line += op.nLoops)
+    {
+        op.nLoops = (lines - line < linesPerOp) ? (uint16_t)(lines - line) : linesPerOp;
+        op.pSrc = reinterpret_cast<const uint16_t*>(src + line * srcStride);
+        op.pDst = reinterpret_cast<uint16_t*>(dest + line * destStride);
+        lcd->queueMemoryCopy(op);
+    }
+
+    Pending& p = pending[pendingCount++];
+    p.dest = dest;
+    p.size = destSize;
+    p.done = done;
+    stats.dma2dCopies++;
+    stats.dma2dBytes += lineBytes * lines;
+    return true;
+}
+
+void AsyncBlockCopy::poll()
+{
+    if (pendingCount > 0 && lcd->isDMA2DIdle())
+    {
+        complete();
+    }
+}
+
+void AsyncBlockCopy::finish()
+{
+    if (pendingCount > 0)
+    {
+        lcd->waitForDMA2D();
+        complete();
+    }
+}
+
+void AsyncBlockCopy::complete()
+{
+    // Callbacks may start another copy
+    const uint16_t count = pendingCount;
+    Pending done[TOUCHGFX_BLOCK_COPY_QUEUE_SIZE];
+    memcpy(done, pending, sizeof(done));
+    pendingCount = 0;
+
+    for (uint16_t i = 0; i < count; i++)
+    {
+        // The CPU may have speculatively fetched lines of the destination during the copy
+        DCacheMaintenance::invalidate(done[i].dest, done[i].size);
+        if (done[i].done != 0 && done[i].done->isValid())
+        {
+            done[i].done->execute(done[i].dest);
+        }
+    }
+}
+
+void AsyncBlockCopy::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+} // namespace touchgfx
+
+/* USER CODE END AsyncBlockCopy.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
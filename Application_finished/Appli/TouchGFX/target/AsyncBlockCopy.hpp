@@ -0,0 +1,193 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : AsyncBlockCopy.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef ASYNCBLOCKCOPY_HPP
+#define ASYNCBLOCKCOPY_HPP
+
+#include <touchgfx/Callback.hpp>
+#include <stdint.h>
+
+/* USER CODE BEGIN AsyncBlockCopy.hpp */
+
+/**
+ * Smallest copy, in bytes, that is moved by DMA2D. Smaller copies are done by the CPU,
+ * which is quicker than setting up DMA2D and maintaining the data cache for them.
+ */
+#ifndef TOUCHGFX_BLOCK_COPY_DMA2D_MIN_BYTES
+#define TOUCHGFX_BLOCK_COPY_DMA2D_MIN_BYTES 8192
+#endif
+
+/**
+ * Number of copies that can be in progress on DMA2D before one is waited for.
+ */
+#ifndef TOUCHGFX_BLOCK_COPY_QUEUE_SIZE
+#define TOUCHGFX_BLOCK_COPY_QUEUE_SIZE 4
+#endif
+
+namespace touchgfx
+{
+class HybridLCDGPU2D;
+
+/**
+ * @class AsyncBlockCopy
+ *
+ * @brief Copies large blocks of memory with DMA2D while the CPU goes on.
+ *
+ *        Copies of at least TOUCHGFX_BLOCK_COPY_DMA2D_MIN_BYTES, like snapshot restores,
+ *        cache fills and video buffers, are queued on DMA2D in memory to memory mode, as
+ *        32-bit pixels: the words of a flat copy are laid out as lines of 4096 pixels, and
+ *        the lines of a 2D copy are moved with the line offsets of DMA2D, so a copy out
+ *        of, or into, a larger image needs no GPU2D blit. The bytes before the first word
+ *        aligned in both buffers and after the last are copied by the CPU. Smaller copies,
+ *        and copies whose buffers are not aligned alike, are done by the CPU at once.
+ *
+ *        The copies are queued in drawing order with the fills and copies of
+ *        HybridLCDGPU2D. The source is cleaned from the data cache before the copy, the
+ *        destination cleaned and invalidated, and invalidated again when the copy is
+ *        done, as the CPU may have fetched lines of it meanwhile. The CPU must not touch
+ *        the destination before then: done is called from poll(), which the HAL calls at
+ *        the end of every frame, or from finish().
+ */
+class AsyncBlockCopy
+{
+public:
+    /** Copies made since the last reset. */
+    struct Stats
+    {
+        uint32_t dma2dCopies; ///< Copies moved by DMA2D
+        uint32_t dma2dBytes;  ///< Bytes moved by DMA2D
+        uint32_t cpuCopies;   ///< Copies done by the CPU
+        uint32_t cpuBytes;    ///< Bytes copied by the CPU
+        uint32_t waits;       ///< Times a copy had to wait for the queue to drain
+    };
+
+    AsyncBlockCopy();
+
+    /**
+     * @fn void AsyncBlockCopy::init(HybridLCDGPU2D& lcd);
+     *
+     * @brief Sets the LCD that queues the copies on DMA2D.
+     *
+     * @param lcd The LCD.
+     */
+    void init(HybridLCDGPU2D& lcd);
+
+    /**
+     * @fn bool AsyncBlockCopy::copy(void* dest, const void* src, uint32_t numBytes, GenericCallback<void*>* done = 0);
+     *
+     * @brief Copies a block of memory, with DMA2D if it is large.
+     *
+     * @param dest     Destination.
+     * @param src      Source, which must not change before the copy is done.
+     * @param numBytes Number of bytes.
+     * @param done     (Optional) Called with dest when the copy is done.
+     *
+     * @return true if the copy is in progress on DMA2D, false if it is done already.
+     */
+    bool copy(void* dest, const void* src, uint32_t numBytes, GenericCallback<void*>* done = 0);
+
+    /**
+     * @fn bool AsyncBlockCopy::copy2D(void* dest, uint32_t destStride, const void* src, uint32_t srcStride, uint32_t lineBytes, uint16_t lines, GenericCallback<void*>* done = 0);
+     *
+     * @brief Copies lines of bytes between buffers with different strides, with DMA2D if
+     *        they are large.
+     *
+     *        DMA2D is only used if the strides and the number of bytes per line are a
+     *        multiple of 4, the buffers are word aligned, and a line has at most 16383
+     *        words.
+     *
+     * @param dest       Destination of the first line.
+     * @param destStride Bytes from a line to the next in the destination.
+     * @param src        Source of the first line.
+     * @param srcStride  Bytes from a line to the next in the source.
+     * @param lineBytes  Bytes copied per line.
+     * @param lines      Number of lines.
+     * @param done       (Optional) Called with dest when the copy is done.
+     *
+     * @return true if the copy is in progress on DMA2D, false if it is done already.
+     */
+    bool copy2D(void* dest, uint32_t destStride, const void* src, uint32_t srcStride, uint32_t lineBytes, uint16_t lines, GenericCallback<void*>* done = 0);
+
+    /**
+     * @fn bool AsyncBlockCopy::isPending() const;
+     *
+     * @brief Tells if copies are in progress.
+     *
+     * @return true if copies are not done.
+     */
+    bool isPending() const
+    {
+        return pendingCount > 0;
+    }
+
+    /**
+     * @fn void AsyncBlockCopy::poll();
+     *
+     * @brief Completes the copies if DMA2D is done with them.
+     */
+    void poll();
+
+    /**
+     * @fn void AsyncBlockCopy::finish();
+     *
+     * @brief Waits for the copies in progress and completes them.
+     */
+    void finish();
+
+    /**
+     * @fn const Stats& AsyncBlockCopy::getStats() const;
+     *
+     * @brief Gets the copies made since the last call to resetStats().
+     *
+     * @return The statistics.
+     */
+    const Stats& getStats() const
+    {
+        return stats;
+    }
+
+    /**
+     * @fn void AsyncBlockCopy::resetStats();
+     *
+     * @brief Resets the statistics.
+     */
+    void resetStats();
+
+private:
+    /** A copy in progress on DMA2D. */
+    struct Pending
+    {
+        void* dest;
+        uint32_t size; ///< Bytes from dest to the end of the last line
+        GenericCallback<void*>* done;
+    };
+
+    bool copyLines(uint8_t* dest, uint32_t destStride, const uint8_t* src, uint32_t srcStride, uint32_t lineBytes, uint16_t lines, GenericCallback<void*>* done);
+    void complete();
+
+    HybridLCDGPU2D* lcd;
+    Pending pending[TOUCHGFX_BLOCK_COPY_QUEUE_SIZE];
+    uint16_t pendingCount;
+    Stats stats;
+};
+} // namespace touchgfx
+
+/* USER CODE END AsyncBlockCopy.hpp */
+
+#endif // ASYNCBLOCKCOPY_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,185 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : AsyncFontDataReader.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include <AsyncFontDataReader.hpp>
+
+/* USER CODE BEGIN AsyncFontDataReader.cpp */
+#include <cassert>
+#include <string.h>
+
+namespace
+{
+// Largest HPDMA block, rounded down to the burst size
+const uint32_t MAX_BLOCK_SIZE = 0xFFF0U;
+}
+
+namespace touchgfx
+{
+AsyncFontDataReader* AsyncFontDataReader::instance = 0;
+
+AsyncFontDataReader::AsyncFontDataReader(const uint8_t* fontData, uint32_t fontLength)
+    : data(fontData), length(fontLength), position(0), head(0), tail(0), transferOffset(0)
+{
+    memset(&hdma, 0, sizeof(hdma));
+    resetStats();
+}
+
+void AsyncFontDataReader::init()
+{
+    instance = this;
+
+    hdma.Instance = HPDMA1_Channel3;
+    hdma.Init.Request = DMA_REQUEST_SW;
+    hdma.Init.BlkHWRequest = DMA_BREQ_SINGLE_BURST;
+    hdma.Init.Direction = DMA_MEMORY_TO_MEMORY;
+    hdma.Init.SrcInc = DMA_SINC_INCREMENTED;
+    hdma.Init.DestInc = DMA_DINC_INCREMENTED;
+    hdma.Init.SrcDataWidth = DMA_SRC_DATAWIDTH_BYTE;
+    hdma.Init.DestDataWidth = DMA_DEST_DATAWIDTH_BYTE;
+    hdma.Init.Priority = DMA_LOW_PRIORITY_LOW_WEIGHT;
+    hdma.Init.SrcBurstLength = 16;
+    hdma.Init.DestBurstLength = 16;
+    hdma.Init.TransferAllocatedPort = DMA_SRC_ALLOCATED_PORT0 | DMA_DEST_ALLOCATED_PORT1;
+    hdma.Init.TransferEventMode = DMA_TCEM_BLOCK_TRANSFER;
+    hdma.Init.Mode = DMA_NORMAL;
+    if (HAL_DMA_Init(&hdma) != HAL_OK)
+    {
+        assert(0 && "Unable to initialize font DMA");
+    }
+    HAL_DMA_ConfigChannelAttributes(&hdma, DMA_CHANNEL_NPRIV);
+    HAL_DMA_RegisterCallback(&hdma, HAL_DMA_XFER_CPLT_CB_ID, &AsyncFontDataReader::transferComplete);
+
+    HAL_NVIC_SetPriority(HPDMA1_Channel3_IRQn, 5, 0);
+    HAL_NVIC_EnableIRQ(HPDMA1_Channel3_IRQn);
+}
+
+void AsyncFontDataReader::open()
+{
+    // The cache may evict or move the glyphs still being transferred to
+    waitForTransfers();
+    position = 0;
+}
+
+void AsyncFontDataReader::close()
+{
+    // Queued reads keep running, see finishTransfers()
+}
+
+void AsyncFontDataReader::setPosition(uint32_t pos)
+{
+    position = pos;
+}
+
+void AsyncFontDataReader::readData(void* out, uint32_t numberOfBytes)
+{
+    assert(position + numberOfBytes <= length && "Read outside the binary font");
+
+    const uint8_t* const src = data + position;
+    position += numberOfBytes;
+
+    if (numberOfBytes < TOUCHGFX_ASYNC_FONT_MIN_TRANSFER || instance != this)
+    {
+        memcpy(out, src, numberOfBytes);
+        stats.copied++;
+        return;
+    }
+
+    if (tail - head == TOUCHGFX_ASYNC_FONT_QUEUE_SIZE)
+    {
+        stats.queueFull++;
+        while (tail - head == TOUCHGFX_ASYNC_FONT_QUEUE_SIZE)
+        {
+        }
+    }
+
+    Transfer& transfer = queue[tail % TOUCHGFX_ASYNC_FONT_QUEUE_SIZE];
+    transfer.src = src;
+    transfer.dst = static_cast<uint8_t*>(out);
+    transfer.length = numberOfBytes;
+    stats.queued++;
+    stats.queuedBytes += numberOfBytes;
+
+    // The interrupt may drain the queue between the check and publishing the transfer
+    const uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    const bool idle = (head == tail);
+    tail = tail + 1;
+    if (idle)
+    {
+        transferOffset = 0;
+        startBlock();
+    }
+    __set_PRIMASK(primask);
+}
+
+void AsyncFontDataReader::waitForTransfers()
+{
+    while (head != tail)
+    {
+    }
+}
+
+void AsyncFontDataReader::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+void AsyncFontDataReader::handleInterrupt()
+{
+    HAL_DMA_IRQHandler(&hdma);
+}
+
+void AsyncFontDataReader::startBlock()
+{
+    const Transfer& transfer = queue[head % TOUCHGFX_ASYNC_FONT_QUEUE_SIZE];
+    const uint32_t block = MIN(transfer.length - transferOffset, MAX_BLOCK_SIZE);
+    HAL_DMA_Start_IT(&hdma, (uint32_t)(transfer.src + transferOffset), (uint32_t)(transfer.dst + transferOffset), block);
+}
+
+void AsyncFontDataReader::transferComplete(DMA_HandleTypeDef* /*hdma*/)
+{
+    AsyncFontDataReader* const reader = instance;
+    const Transfer& transfer = reader->queue[reader->head % TOUCHGFX_ASYNC_FONT_QUEUE_SIZE];
+    reader->transferOffset += MIN(transfer.length - reader->transferOffset, MAX_BLOCK_SIZE);
+    if (reader->transferOffset < transfer.length)
+    {
+        reader->startBlock();
+        return;
+    }
+
+    reader->head = reader->head + 1;
+    reader->transferOffset = 0;
+    if (reader->head != reader->tail)
+    {
+        reader->startBlock();
+    }
+}
+} // namespace touchgfx
+
+extern "C" void AsyncFontDataReader_IRQHandler(void)
+{
+    touchgfx::AsyncFontDataReader* const reader = touchgfx::AsyncFontDataReader::getInstance();
+    if (reader != 0)
+    {
+        reader->handleInterrupt();
+    }
+}
+
+/* USER CODE END AsyncFontDataReader.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,210 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : AsyncFontDataReader.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef ASYNCFONTDATAREADER_HPP
+#define ASYNCFONTDATAREADER_HPP
+
+#include <fonts/FontCache.hpp>
+#include <stdint.h>
+
+#include <stm32h7rsxx_hal.h>
+
+/* USER CODE BEGIN AsyncFontDataReader.hpp */
+
+/**
+ * Reads of at least this many bytes are queued on DMA, smaller reads are copied at once.
+ * The font caches read glyph nodes and font headers in pieces of 40 bytes at most, and use
+ * them right away, while pixel data is only used when drawing.
+ */
+#ifndef TOUCHGFX_ASYNC_FONT_MIN_TRANSFER
+#define TOUCHGFX_ASYNC_FONT_MIN_TRANSFER 64
+#endif
+
+/**
+ * Number of reads that can be queued before readData() waits for the oldest one.
+ */
+#ifndef TOUCHGFX_ASYNC_FONT_QUEUE_SIZE
+#define TOUCHGFX_ASYNC_FONT_QUEUE_SIZE 64
+#endif
+
+namespace touchgfx
+{
+/**
+ * @class AsyncFontDataReader
+ *
+ * @brief FontDataReader for a binary font in memory-mapped external flash that reads the
+ *        glyph data with DMA in the background.
+ *
+ *        FontCache and LRUFontCache read the glyph data of a string through readData(),
+ *        which would copy every glyph from flash while the render task waits. This reader
+ *        only copies the small reads of glyph nodes and font headers at once. Larger reads,
+ *        the pixel data, are queued as HPDMA memory-to-memory transfers and readData()
+ *        returns immediately, so cacheString() returns once the glyph table has been
+ *        scanned. Called when a screen transition starts, the glyphs are transferred while
+ *        the transition is drawn.
+ *
+ *        Queued data is only valid once transferred. TouchGFXHAL::beginFrame() calls
+ *        finishTransfers() before anything is drawn, which returns at once when the queue
+ *        has already drained. The destination must not be cached, as with the font cache
+ *        memory in PSRAM, since the CPU would otherwise read stale lines. open() waits for
+ *        the reads of the previous string, as the cache may then evict or move the glyphs.
+ *
+ *        init() must be called before use, and AsyncFontDataReader_IRQHandler() must be
+ *        called from the HPDMA1 channel 3 interrupt.
+ */
+class AsyncFontDataReader : public FontDataReader
+{
+public:
+    /** Reads since the last reset. */
+    struct Stats
+    {
+        uint32_t copied;      ///< Reads copied at once
+        uint32_t queued;      ///< Reads transferred by DMA
+        uint32_t queuedBytes; ///< Bytes transferred by DMA
+        uint32_t queueFull;   ///< Reads that waited for a queued read to complete
+        uint32_t waits;       ///< Calls to finishTransfers() that had to wait
+    };
+
+    /**
+     * @fn AsyncFontDataReader::AsyncFontDataReader(const uint8_t* data, uint32_t length);
+     *
+     * @brief Constructor.
+     *
+     * @param data   The memory-mapped binary font.
+     * @param length The length of the binary font in bytes.
+     */
+    AsyncFontDataReader(const uint8_t* data, uint32_t length);
+
+    /**
+     * @fn void AsyncFontDataReader::init();
+     *
+     * @brief Initializes the DMA channel the glyph data is read with.
+     */
+    void init();
+
+    virtual void open();
+
+    virtual void close();
+
+    virtual void setPosition(uint32_t position);
+
+    virtual void readData(void* out, uint32_t numberOfBytes);
+
+    /**
+     * @fn bool AsyncFontDataReader::isIdle() const;
+     *
+     * @brief Tells if all queued reads have completed.
+     *
+     * @return true if no read is queued.
+     */
+    bool isIdle() const
+    {
+        return head == tail;
+    }
+
+    /**
+     * @fn void AsyncFontDataReader::waitForTransfers();
+     *
+     * @brief Waits until all queued reads have completed.
+     */
+    void waitForTransfers();
+
+    /**
+     * @fn const Stats& AsyncFontDataReader::getStats() const;
+     *
+     * @brief Gets the read statistics.
+     *
+     * @return The read statistics.
+     */
+    const Stats& getStats() const
+    {
+        return stats;
+    }
+
+    /**
+     * @fn void AsyncFontDataReader::resetStats();
+     *
+     * @brief Resets the read statistics.
+     */
+    void resetStats();
+
+    /**
+     * @fn void AsyncFontDataReader::handleInterrupt();
+     *
+     * @brief Handles the DMA channel interrupt.
+     */
+    void handleInterrupt();
+
+    /**
+     * @fn static AsyncFontDataReader* AsyncFontDataReader::getInstance();
+     *
+     * @brief Gets the initialized reader.
+     *
+     * @return The reader init() was last called on, or 0.
+     */
+    static AsyncFontDataReader* getInstance()
+    {
+        return instance;
+    }
+
+    /**
+     * @fn static void AsyncFontDataReader::finishTransfers();
+     *
+     * @brief Waits for the queued reads of the initialized reader, if any.
+     */
+    static void finishTransfers()
+    {
+        if (instance != 0 && !instance->isIdle())
+        {
+            instance->stats.waits++;
+            instance->waitForTransfers();
+        }
+    }
+
+private:
+    struct Transfer
+    {
+        const uint8_t* src;
+        uint8_t* dst;
+        uint32_t length;
+    };
+
+    void startBlock();
+
+    static void transferComplete(DMA_HandleTypeDef* hdma);
+
+    const uint8_t* data;
+    uint32_t length;
+    uint32_t position;
+    Transfer queue[TOUCHGFX_ASYNC_FONT_QUEUE_SIZE];
+    volatile uint32_t head;           ///< Transfer running, only written by the interrupt
+    volatile uint32_t tail;           ///< Next free transfer, only written by readData()
+    volatile uint32_t transferOffset; ///< Bytes of the running transfer completed
+    DMA_HandleTypeDef hdma;
+    Stats stats;
+
+    static AsyncFontDataReader* instance;
+};
+} // namespace touchgfx
+
+extern "C" void AsyncFontDataReader_IRQHandler(void);
+
+/* USER CODE END AsyncFontDataReader.hpp */
+
+#endif // ASYNCFONTDATAREADER_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
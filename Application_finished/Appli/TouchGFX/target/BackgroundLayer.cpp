@@ -0,0 +1,214 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : BackgroundLayer.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include <BackgroundLayer.hpp>
+
+/* USER CODE BEGIN BackgroundLayer.cpp */
+#include <touchgfx/hal/HAL.hpp>
+
+#include "stm32h7rsxx_hal.h"
+
+extern "C" LTDC_HandleTypeDef hltdc;
+
+namespace
+{
+// LTDC layer 1 scans out the framebuffer, or the pinned background below layer 2
+const uint32_t BACKGROUND_LAYER_INDEX = 0;
+const uint32_t KEYED_LAYER_INDEX = 1;
+
+#if TOUCHGFX_BACKGROUND_LAYER
+bool ltdcPixelFormat(touchgfx::Bitmap::BitmapFormat format, uint32_t& pixelFormat, uint32_t& bytesPerPixel)
+{
+    switch (format)
+    {
+    case touchgfx::Bitmap::RGB565:
+        pixelFormat = LTDC_PIXEL_FORMAT_RGB565;
+        bytesPerPixel = 2;
+        return true;
+    case touchgfx::Bitmap::RGB888:
+        pixelFormat = LTDC_PIXEL_FORMAT_RGB888;
+        bytesPerPixel = 3;
+        return true;
+    case touchgfx::Bitmap::ARGB8888:
+        pixelFormat = LTDC_PIXEL_FORMAT_ARGB8888;
+        bytesPerPixel = 4;
+        return true;
+    default:
+        return false;
+    }
+}
+#endif
+}
+
+namespace touchgfx
+{
+uint32_t BackgroundLayer::frameBufferLayer = BACKGROUND_LAYER_INDEX;
+
+BackgroundLayer::BackgroundLayer()
+    : pinnedBitmap(BITMAP_INVALID), pinnedBuffer(0), pinnedArea(), pinnedFormat(0)
+{
+}
+
+bool BackgroundLayer::pin(const Bitmap& bitmap)
+{
+#if TOUCHGFX_BACKGROUND_LAYER
+    if (bitmap.getId() == pinnedBitmap)
+    {
+        return true;
+    }
+
+    uint32_t pixelFormat;
+    uint32_t bytesPerPixel;
+    if (!ltdcPixelFormat(bitmap.getFormat(), pixelFormat, bytesPerPixel)
+            || bitmap.getWidth() != HAL::DISPLAY_WIDTH || bitmap.getHeight() != HAL::DISPLAY_HEIGHT
+            || bitmap.getData() == 0)
+    {
+        return false;
+    }
+
+    if (!isPinned())
+    {
+        keyFrameBuffer();
+    }
+    else if (pinnedBuffer != 0)
+    {
+        setFullScreenWindow();
+        pinnedBuffer = 0;
+    }
+
+    // LTDC fetches the bitmap straight from the memory-mapped flash
+    HAL_LTDC_SetPixelFormat_NoReload(&hltdc, pixelFormat, BACKGROUND_LAYER_INDEX);
+    HAL_LTDC_SetAddress_NoReload(&hltdc, (uint32_t)bitmap.getData(), BACKGROUND_LAYER_INDEX);
+    HAL_LTDC_Reload(&hltdc, LTDC_RELOAD_VERTICAL_BLANKING);
+
+    pinnedBitmap = bitmap.getId();
+    return true;
+#else
+    (void)bitmap;
+    return false;
+#endif
+}
+
+void BackgroundLayer::unpin()
+{
+    if (!isPinned())
+    {
+        return;
+    }
+    const uint32_t frameBuffer = frameBufferAddressRegister();
+    frameBufferLayer = BACKGROUND_LAYER_INDEX;
+
+    if (pinnedBuffer != 0)
+    {
+        setFullScreenWindow();
+    }
+    HAL_LTDC_SetPixelFormat_NoReload(&hltdc, hltdc.LayerCfg[KEYED_LAYER_INDEX].PixelFormat, BACKGROUND_LAYER_INDEX);
+    HAL_LTDC_SetAddress_NoReload(&hltdc, frameBuffer, BACKGROUND_LAYER_INDEX);
+    applyFrameBufferPitch();
+    HAL_LTDC_DisableColorKeying_NoReload(&hltdc, KEYED_LAYER_INDEX);
+    __HAL_LTDC_LAYER_DISABLE(&hltdc, KEYED_LAYER_INDEX);
+    HAL_LTDC_Reload(&hltdc, LTDC_RELOAD_VERTICAL_BLANKING);
+    pinnedBitmap = BITMAP_INVALID;
+    pinnedBuffer = 0;
+}
+
+bool BackgroundLayer::pinBuffer(const uint8_t* data, Bitmap::BitmapFormat format, const Rect& area, uint16_t stride)
+{
+#if TOUCHGFX_BACKGROUND_LAYER
+    uint32_t pixelFormat;
+    uint32_t bytesPerPixel;
+    const Rect visible = area & Rect(0, 0, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT);
+    if (pinnedBitmap != BITMAP_INVALID || data == 0 || visible.isEmpty()
+            || !ltdcPixelFormat(format, pixelFormat, bytesPerPixel))
+    {
+        return false;
+    }
+
+    const uint32_t address = (uint32_t)(data + (visible.y - area.y) * stride + (visible.x - area.x) * bytesPerPixel);
+    if (pinnedBuffer != 0 && visible == pinnedArea && pixelFormat == pinnedFormat)
+    {
+        // The HAL setters would rewrite the line pitch, only the address changes
+        LTDC_LAYER(&hltdc, BACKGROUND_LAYER_INDEX)->CFBAR = address;
+        hltdc.LayerCfg[BACKGROUND_LAYER_INDEX].FBStartAdress = address;
+        HAL_LTDC_Reload(&hltdc, LTDC_RELOAD_VERTICAL_BLANKING);
+        pinnedBuffer = data;
+        return true;
+    }
+
+    if (!isPinned())
+    {
+        keyFrameBuffer();
+    }
+    HAL_LTDC_SetWindowSize_NoReload(&hltdc, visible.width, visible.height, BACKGROUND_LAYER_INDEX);
+    HAL_LTDC_SetWindowPosition_NoReload(&hltdc, visible.x, visible.y, BACKGROUND_LAYER_INDEX);
+    HAL_LTDC_SetPixelFormat_NoReload(&hltdc, pixelFormat, BACKGROUND_LAYER_INDEX);
+    HAL_LTDC_SetAddress_NoReload(&hltdc, address, BACKGROUND_LAYER_INDEX);
+    // Set last, the other setters reset the pitch to the width of the window
+    HAL_LTDC_SetPitch_NoReload(&hltdc, stride / bytesPerPixel, BACKGROUND_LAYER_INDEX);
+    HAL_LTDC_Reload(&hltdc, LTDC_RELOAD_VERTICAL_BLANKING);
+
+    pinnedBuffer = data;
+    pinnedArea = visible;
+    pinnedFormat = pixelFormat;
+    return true;
+#else
+    (void)data;
+    (void)format;
+    (void)area;
+    (void)stride;
+    return false;
+#endif
+}
+
+void BackgroundLayer::keyFrameBuffer()
+{
+    // Layer 2 takes over the framebuffer, keyed pixels let layer 1 through
+    LTDC_LayerCfgTypeDef layerCfg = hltdc.LayerCfg[BACKGROUND_LAYER_INDEX];
+    layerCfg.FBStartAdress = frameBufferAddressRegister();
+    HAL_LTDC_ConfigLayer_NoReload(&hltdc, &layerCfg, KEYED_LAYER_INDEX);
+    HAL_LTDC_ConfigColorKeying_NoReload(&hltdc, TOUCHGFX_BACKGROUND_COLOR_KEY, KEYED_LAYER_INDEX);
+    HAL_LTDC_EnableColorKeying_NoReload(&hltdc, KEYED_LAYER_INDEX);
+    frameBufferLayer = KEYED_LAYER_INDEX;
+    applyFrameBufferPitch();
+}
+
+void BackgroundLayer::setFullScreenWindow()
+{
+    // Also resets the line pitch of a pinned buffer
+    HAL_LTDC_SetWindowSize_NoReload(&hltdc, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT, BACKGROUND_LAYER_INDEX);
+    HAL_LTDC_SetWindowPosition_NoReload(&hltdc, 0, 0, BACKGROUND_LAYER_INDEX);
+}
+
+void BackgroundLayer::applyFrameBufferPitch()
+{
+    if (HAL::FRAME_BUFFER_WIDTH != HAL::DISPLAY_WIDTH)
+    {
+        // In pixels of the pixel format of the layer
+        HAL_LTDC_SetPitch_NoReload(&hltdc, HAL::FRAME_BUFFER_WIDTH, frameBufferLayer);
+    }
+}
+
+volatile uint32_t& BackgroundLayer::frameBufferAddressRegister()
+{
+    return LTDC_LAYER(&hltdc, frameBufferLayer)->CFBAR;
+}
+} // namespace touchgfx
+
+/* USER CODE END BackgroundLayer.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,177 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : BackgroundLayer.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef BACKGROUNDLAYER_HPP
+#define BACKGROUNDLAYER_HPP
+
+#include <touchgfx/Bitmap.hpp>
+#include <touchgfx/hal/Types.hpp>
+#include <stdint.h>
+
+/* USER CODE BEGIN BackgroundLayer.hpp */
+
+/**
+ * Set to 1 to allow a full-screen background to be scanned out from flash on LTDC layer 1.
+ * The framebuffer is then shown on layer 2 and the overlay layer is not available.
+ */
+#ifndef TOUCHGFX_BACKGROUND_LAYER
+#define TOUCHGFX_BACKGROUND_LAYER 0
+#endif
+
+/**
+ * RGB888 color of framebuffer pixels that show the pinned background. Must be exactly
+ * representable in RGB565.
+ */
+#ifndef TOUCHGFX_BACKGROUND_COLOR_KEY
+#define TOUCHGFX_BACKGROUND_COLOR_KEY 0xFF00FFU
+#endif
+
+namespace touchgfx
+{
+/**
+ * @class BackgroundLayer
+ *
+ * @brief Scans out a full-screen bitmap on LTDC layer 1, below the framebuffer.
+ *
+ *        pin() points layer 1 at the bitmap data in memory-mapped flash, without copying
+ *        it, and moves the framebuffer to layer 2 with color keying enabled. Framebuffer
+ *        pixels of the color key are transparent, so the widget tree fills its background
+ *        with getColorKey() instead of drawing the bitmap. Redrawing an area behind moving
+ *        widgets is then a fill instead of a copy from flash.
+ *
+ *        pinBuffer() scans out a buffer of any size in a window of layer 1 instead, such as
+ *        the frames of a video, which then never pass through the framebuffer.
+ *
+ *        The framebuffer is still RGB565, so partly transparent widget pixels are blended
+ *        with the color key, not with the pinned bitmap. Keep antialiased edges away from
+ *        keyed areas, or accept a fringe of the key color around them.
+ */
+class BackgroundLayer
+{
+public:
+    BackgroundLayer();
+
+    /**
+     * @fn bool BackgroundLayer::pin(const Bitmap& bitmap);
+     *
+     * @brief Shows a bitmap below the framebuffer from the next vertical blanking.
+     *
+     * @param bitmap The bitmap to show, RGB565, RGB888 or ARGB8888, the size of the display.
+     *
+     * @return false if the bitmap cannot be scanned out by LTDC.
+     */
+    bool pin(const Bitmap& bitmap);
+
+    /**
+     * @fn void BackgroundLayer::unpin();
+     *
+     * @brief Moves the framebuffer back to layer 1 from the next vertical blanking.
+     */
+    void unpin();
+
+    /**
+     * @fn bool BackgroundLayer::pinBuffer(const uint8_t* data, Bitmap::BitmapFormat format, const Rect& area, uint16_t stride);
+     *
+     * @brief Shows a buffer in an area below the framebuffer from the next vertical blanking.
+     *
+     *        Layer 1 is a window of the area, the rest of the display shows the LTDC
+     *        background color through keyed pixels. Pinning the next buffer of the same
+     *        area and format only changes the address, so the buffer shown until now is
+     *        scanned out until the next vertical blanking.
+     *
+     * @param data   The buffer, whose first pixel is shown at the top left of the area.
+     * @param format The format of the buffer, RGB565, RGB888 or ARGB8888.
+     * @param area   The area on the display, clipped to it.
+     * @param stride The bytes from one line of the buffer to the next.
+     *
+     * @return false if the buffer cannot be scanned out by LTDC, or a bitmap is pinned.
+     */
+    bool pinBuffer(const uint8_t* data, Bitmap::BitmapFormat format, const Rect& area, uint16_t stride);
+
+    /**
+     * @fn bool BackgroundLayer::isPinned() const;
+     *
+     * @brief Tells if a bitmap or a buffer is shown below the framebuffer.
+     *
+     * @return true if the framebuffer is shown on layer 2.
+     */
+    bool isPinned() const
+    {
+        return pinnedBitmap != BITMAP_INVALID || pinnedBuffer != 0;
+    }
+
+    /**
+     * @fn static colortype BackgroundLayer::getColorKey();
+     *
+     * @brief Gets the color to fill the framebuffer with where the background should show.
+     *
+     * @return The color key.
+     */
+    static colortype getColorKey()
+    {
+        return colortype(TOUCHGFX_BACKGROUND_COLOR_KEY);
+    }
+
+    /**
+     * @fn static volatile uint32_t& BackgroundLayer::frameBufferAddressRegister();
+     *
+     * @brief Gets the address register of the LTDC layer that scans out the framebuffer.
+     *
+     * @return CFBAR of layer 1, or of layer 2 while a background is pinned.
+     */
+    static volatile uint32_t& frameBufferAddressRegister();
+
+    /**
+     * @fn static uint32_t BackgroundLayer::getFrameBufferLayerIndex();
+     *
+     * @brief Gets the index of the LTDC layer that scans out the framebuffer.
+     *
+     * @return 0 for layer 1, or 1 for layer 2 while a background is pinned.
+     */
+    static uint32_t getFrameBufferLayerIndex()
+    {
+        return frameBufferLayer;
+    }
+
+    /**
+     * @fn static void BackgroundLayer::applyFrameBufferPitch();
+     *
+     * @brief Sets the line pitch of the LTDC layer that scans out the framebuffer to
+     *        HAL::FRAME_BUFFER_WIDTH, when the lines are padded past the display width. The
+     *        HAL setters of the layer reset the pitch to the width of the layer, so this is
+     *        called after them. The caller reloads the shadow registers.
+     */
+    static void applyFrameBufferPitch();
+
+private:
+    void keyFrameBuffer();
+    void setFullScreenWindow();
+
+    BitmapId pinnedBitmap;
+    const uint8_t* pinnedBuffer;
+    Rect pinnedArea;        ///< The visible part of the area of the pinned buffer
+    uint32_t pinnedFormat;  ///< The LTDC pixel format of the pinned buffer
+
+    static uint32_t frameBufferLayer;
+};
+} // namespace touchgfx
+
+/* USER CODE END BackgroundLayer.hpp */
+
+#endif // BACKGROUNDLAYER_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,385 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : BlitBenchmark.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include <BlitBenchmark.hpp>
+
+/* USER CODE BEGIN BlitBenchmark.cpp */
+#include <touchgfx/Color.hpp>
+#include <touchgfx/Font.hpp>
+#include <touchgfx/hal/HAL.hpp>
+#include <DCacheMaintenance.hpp>
+#include <HybridLCDGPU2D.hpp>
+#include <TraceOutput.hpp>
+#include <string.h>
+
+#include "stm32h7rsxx.h"
+
+namespace
+{
+const char* const operationNames[touchgfx::BlitBenchmark::NUMBER_OF_OPERATIONS] =
+{
+    "fill", "fill_alpha", "copy", "copy_alpha", "argb8888", "argb8888_alpha", "l8", "a4", "a8", "texture_nearest", "texture_bilinear"
+};
+const char* const engineNames[touchgfx::BlitBenchmark::NUMBER_OF_ENGINES] = { "cpu", "dma2d", "gpu2d" };
+
+// Sides of the squares timed. The sources are as large as the largest.
+const int16_t SIDES[touchgfx::BlitBenchmark::NUMBER_OF_SIDES] = { 4, 16, 64, 128 };
+const int16_t MAX_SIDE = 128;
+
+// The BlitOp executing each operation on DMA2D, 0 if it has none
+const uint32_t DMA2D_OPERATIONS[touchgfx::BlitBenchmark::NUMBER_OF_OPERATIONS] =
+{
+    touchgfx::BLIT_OP_FILL,
+    touchgfx::BLIT_OP_FILL_WITH_ALPHA,
+    touchgfx::BLIT_OP_COPY,
+    touchgfx::BLIT_OP_COPY_WITH_ALPHA,
+    touchgfx::BLIT_OP_COPY_ARGB8888,
+    touchgfx::BLIT_OP_COPY_ARGB8888_WITH_ALPHA,
+    touchgfx::BLIT_OP_COPY_L8,
+    touchgfx::BLIT_OP_COPY_A4,
+    touchgfx::BLIT_OP_COPY_A8,
+    0,
+    0
+};
+
+// Global alpha of the blended operations
+const uint8_t BLEND_ALPHA = 128;
+
+// The glyph of every side, placed in the glyph atlas by the address of its data
+touchgfx::GlyphNode glyphNodes[touchgfx::BlitBenchmark::NUMBER_OF_SIDES];
+
+uint8_t* carve(uint8_t*& next, uint32_t bytes)
+{
+    uint8_t* const block = next;
+    next += (bytes + 3U) & ~3U;
+    return block;
+}
+
+bool isBlended(touchgfx::BlitBenchmark::Operation operation)
+{
+    return operation == touchgfx::BlitBenchmark::FILL_ALPHA
+           || operation == touchgfx::BlitBenchmark::COPY_ALPHA
+           || operation == touchgfx::BlitBenchmark::ARGB8888_ALPHA;
+}
+} // namespace
+
+namespace touchgfx
+{
+bool BlitBenchmark::run(LCD& cpu, HybridLCDGPU2D& gpu2d, DMA_Interface& dma)
+{
+    if (HAL::DISPLAY_ROTATION != rotate0
+        || HAL::getInstance()->getFrameRefreshStrategy() == HAL::REFRESH_STRATEGY_PARTIAL_FRAMEBUFFER
+        || gpu2d.framebufferFormat() != Bitmap::RGB565)
+    {
+        return false;
+    }
+    gpu2d.finishDrawing();
+
+    uint16_t* const frameBuffer = HAL::getInstance()->lockFrameBuffer();
+    HAL::getInstance()->unlockFrameBuffer();
+    Sources sources;
+    if (!writeSources(frameBuffer, sources))
+    {
+        return false;
+    }
+
+    // Keep the fills and copies HybridLCDGPU2D dispatches by cost on GPU2D
+    HybridLCDGPU2D::EngineCost costs[HybridLCDGPU2D::NUMBER_OF_COSTED_OPERATIONS][HybridLCDGPU2D::NUMBER_OF_ENGINES];
+    const HybridLCDGPU2D::EngineCost unavailable = { HybridLCDGPU2D::UNAVAILABLE, 0 };
+    for (int operation = 0; operation < HybridLCDGPU2D::NUMBER_OF_COSTED_OPERATIONS; operation++)
+    {
+        for (int engine = 0; engine < HybridLCDGPU2D::NUMBER_OF_ENGINES; engine++)
+        {
+            costs[operation][engine] = gpu2d.getCost((HybridLCDGPU2D::CostedOperation)operation, (HybridLCDGPU2D::Engine)engine);
+            if (engine != HybridLCDGPU2D::ENGINE_GPU2D)
+            {
+                gpu2d.setCost((HybridLCDGPU2D::CostedOperation)operation, (HybridLCDGPU2D::Engine)engine, unavailable);
+            }
+        }
+    }
+
+    tracePrintf("blit bench: sides=%d,%d,%d,%d repeats=%d", SIDES[0], SIDES[1], SIDES[2], SIDES[3], BLIT_BENCHMARK_REPEATS);
+    for (int operation = 0; operation < NUMBER_OF_OPERATIONS; operation++)
+    {
+        for (int engine = 0; engine < NUMBER_OF_ENGINES; engine++)
+        {
+            if (!isAvailable((Operation)operation, (Engine)engine, dma))
+            {
+                tracePrintf("blit bench %s %s: unavailable", operationNames[operation], engineNames[engine]);
+                continue;
+            }
+            uint32_t cycles[NUMBER_OF_SIDES];
+            for (int size = 0; size < NUMBER_OF_SIDES; size++)
+            {
+                cycles[size] = time((Operation)operation, (Engine)engine, size, sources, cpu, gpu2d);
+                tracePrintf("blit bench %s %s %dx%d: cycles=%lu", operationNames[operation], engineNames[engine], SIDES[size], SIDES[size], (unsigned long)cycles[size]);
+            }
+            // Fitted as calibrateCosts() does: the cost per pixel from the smallest and the
+            // largest square, the setup cost from the smallest
+            const uint32_t first = cycles[0];
+            const uint32_t last = cycles[NUMBER_OF_SIDES - 1];
+            const uint32_t pixels0 = (uint32_t)SIDES[0] * SIDES[0];
+            const uint32_t pixels1 = (uint32_t)SIDES[NUMBER_OF_SIDES - 1] * SIDES[NUMBER_OF_SIDES - 1];
+            const uint32_t cyclesPer64Pixels = (last > first) ? (uint32_t)(((uint64_t)(last - first) * 64) / (pixels1 - pixels0)) : 0;
+            const uint32_t pixelCycles = (uint32_t)(((uint64_t)pixels0 * cyclesPer64Pixels) / 64);
+            const uint32_t setupCycles = (first > pixelCycles) ? first - pixelCycles : 0;
+            tracePrintf("blit bench %s %s: setup=%lu per64px=%lu", operationNames[operation], engineNames[engine], (unsigned long)setupCycles, (unsigned long)cyclesPer64Pixels);
+        }
+    }
+
+    for (int operation = 0; operation < HybridLCDGPU2D::NUMBER_OF_COSTED_OPERATIONS; operation++)
+    {
+        for (int engine = 0; engine < HybridLCDGPU2D::NUMBER_OF_ENGINES; engine++)
+        {
+            gpu2d.setCost((HybridLCDGPU2D::CostedOperation)operation, (HybridLCDGPU2D::Engine)engine, costs[operation][engine]);
+        }
+    }
+    tracePrintf("blit bench: done");
+    return true;
+}
+
+bool BlitBenchmark::isAvailable(Operation operation, Engine engine, DMA_Interface& dma)
+{
+    if (engine == ENGINE_DMA2D)
+    {
+        // The HAL reports no capabilities while DMA acceleration is disabled, the driver does
+        return DMA2D_OPERATIONS[operation] != 0 && (dma.getBlitCaps() & DMA2D_OPERATIONS[operation]) != 0;
+    }
+    return operation != L8;
+}
+
+bool BlitBenchmark::writeSources(uint16_t* frameBuffer, Sources& sources)
+{
+    sources.destination = frameBuffer;
+
+    uint8_t* const start = reinterpret_cast<uint8_t*>(frameBuffer + MAX_SIDE * HAL::FRAME_BUFFER_WIDTH);
+    uint8_t* next = start;
+    uint16_t* const rgb565 = reinterpret_cast<uint16_t*>(carve(next, MAX_SIDE * MAX_SIDE * 2));
+    uint8_t* const argb8888 = carve(next, MAX_SIDE * MAX_SIDE * 4);
+    uint8_t* const l8 = carve(next, MAX_SIDE * MAX_SIDE);
+    uint32_t* const clut = reinterpret_cast<uint32_t*>(carve(next, 4 + 256 * 4));
+    uint8_t* a4[NUMBER_OF_SIDES];
+    uint8_t* a8[NUMBER_OF_SIDES];
+    for (int size = 0; size < NUMBER_OF_SIDES; size++)
+    {
+        a4[size] = carve(next, (SIDES[size] + 1) / 2 * SIDES[size]);
+        a8[size] = carve(next, SIDES[size] * SIDES[size]);
+    }
+    if (next > reinterpret_cast<uint8_t*>(frameBuffer + HAL::FRAME_BUFFER_WIDTH * HAL::FRAME_BUFFER_HEIGHT))
+    {
+        return false;
+    }
+
+    // Gradients with transparent, translucent and opaque pixels, as anti-aliased assets have
+    for (int16_t y = 0; y < MAX_SIDE; y++)
+    {
+        for (int16_t x = 0; x < MAX_SIDE; x++)
+        {
+            const uint32_t i = (uint32_t)y * MAX_SIDE + x;
+            const uint32_t ramp = (uint32_t)x * 255 / (MAX_SIDE - 1);
+            rgb565[i] = (uint16_t)(((x >> 2) << 11) | ((y >> 1) << 5) | ((x + y) & 0x1F));
+            argb8888[i * 4 + 0] = (uint8_t)(y * 2);
+            argb8888[i * 4 + 1] = (uint8_t)(x * 2);
+            argb8888[i * 4 + 2] = (uint8_t)(255 - x * 2);
+            argb8888[i * 4 + 3] = (uint8_t)ramp;
+            l8[i] = (uint8_t)(x + y);
+        }
+    }
+    // The palette as the L8 bitmaps of the image converter store it
+    clut[0] = Bitmap::CLUT_FORMAT_L8_ARGB8888 | (256U << 16);
+    for (uint32_t i = 0; i < 256; i++)
+    {
+        clut[1 + i] = (i << 24) | ((255 - i) << 16) | (i << 8) | 0x40;
+    }
+    for (int size = 0; size < NUMBER_OF_SIDES; size++)
+    {
+        const int16_t side = SIDES[size];
+        const int16_t rowBytes = (side + 1) / 2;
+        for (int16_t y = 0; y < side; y++)
+        {
+            for (int16_t x = 0; x < side; x++)
+            {
+                const uint8_t ramp = (uint8_t)(x * 255 / (side - 1));
+                a8[size][y * side + x] = ramp;
+                uint8_t& pair = a4[size][y * rowBytes + x / 2];
+                pair = (x & 1) ? (uint8_t)((pair & 0x0F) | (ramp & 0xF0)) : (uint8_t)(ramp >> 4);
+            }
+        }
+        GlyphNode& node = glyphNodes[size];
+        memset(&node, 0, sizeof(node));
+        node._width = (uint8_t)side;
+        node._height = (uint8_t)side;
+        node._top = (uint8_t)side;
+        node._advance = (uint8_t)side;
+    }
+    // DMA2D and GPU2D read the sources from memory
+    DCacheMaintenance::clean(start, (uint32_t)(next - start));
+
+    sources.rgb565 = rgb565;
+    sources.argb8888 = argb8888;
+    sources.l8 = l8;
+    sources.clut = reinterpret_cast<const uint8_t*>(clut);
+    for (int size = 0; size < NUMBER_OF_SIDES; size++)
+    {
+        sources.a4[size] = a4[size];
+        sources.a8[size] = a8[size];
+    }
+    return true;
+}
+
+uint32_t BlitBenchmark::time(Operation operation, Engine engine, int size, const Sources& sources, LCD& cpu, HybridLCDGPU2D& gpu2d)
+{
+    const int16_t side = SIDES[size];
+    uint32_t best = 0xFFFFFFFFU;
+    // The first execution loads the code and the sources into the caches, and the glyphs
+    // into the glyph atlas
+    for (int repeat = 0; repeat <= BLIT_BENCHMARK_REPEATS; repeat++)
+    {
+        const uint32_t start = DWT->CYCCNT;
+        switch (engine)
+        {
+        case ENGINE_CPU:
+            draw(operation, size, sources, cpu);
+            break;
+        case ENGINE_DMA2D:
+            queue(operation, size, sources, gpu2d);
+            gpu2d.waitForDMA2D();
+            break;
+        default:
+            draw(operation, size, sources, gpu2d);
+            gpu2d.finishDrawing();
+            break;
+        }
+        const uint32_t cycles = DWT->CYCCNT - start;
+        if (engine == ENGINE_CPU)
+        {
+            // The engines blend with the pixels written, and must not find stale lines after them
+            DCacheMaintenance::cleanInvalidate(sources.destination, ((side - 1) * HAL::FRAME_BUFFER_WIDTH + side) * 2);
+        }
+        if (repeat > 0 && cycles < best)
+        {
+            best = cycles;
+        }
+    }
+    return best;
+}
+
+void BlitBenchmark::draw(Operation operation, int size, const Sources& sources, LCD& lcd)
+{
+    const int16_t side = SIDES[size];
+    const Rect area(0, 0, side, side);
+    const Rect source(0, 0, MAX_SIDE, MAX_SIDE);
+    const colortype color = Color::getColorFromRGB(0x20, 0x60, 0xA0);
+    const uint8_t alpha = isBlended(operation) ? BLEND_ALPHA : 255;
+    switch (operation)
+    {
+    case FILL:
+    case FILL_ALPHA:
+        lcd.fillRect(area, color, alpha);
+        break;
+    case COPY:
+    case COPY_ALPHA:
+        lcd.blitCopy(sources.rgb565, source, area, alpha, false);
+        break;
+    case ARGB8888:
+    case ARGB8888_ALPHA:
+        lcd.blitCopy(sources.argb8888, Bitmap::ARGB8888, source, area, alpha, true);
+        break;
+    case A4:
+    case A8:
+        {
+            // Locked around the glyphs as by LCD::drawString()
+            uint16_t* const frameBuffer = HAL::getInstance()->lockFrameBuffer();
+            Access::glyph(lcd, frameBuffer, area, &glyphNodes[size], operation == A4 ? sources.a4[size] : sources.a8[size], operation == A4 ? 4 : 8);
+            HAL::getInstance()->unlockFrameBuffer();
+        }
+        break;
+    case TEXTURE_NEAREST:
+    case TEXTURE_BILINEAR:
+        {
+            // Mapped one texel to one pixel, as a texture mapper neither scaled nor rotated
+            const Point3D vertices[4] =
+            {
+                { 0, 0, 1.0f, 0.0f, 0.0f },
+                { side * 16, 0, 1.0f, (float)side, 0.0f },
+                { side * 16, side * 16, 1.0f, (float)side, (float)side },
+                { 0, side * 16, 1.0f, 0.0f, (float)side }
+            };
+            const TextureSurface texture = { reinterpret_cast<const uint16_t*>(sources.argb8888), 0, MAX_SIDE, MAX_SIDE, MAX_SIDE };
+            const RenderingVariant variant = (RenderingVariant)((Bitmap::ARGB8888 << RenderingVariant_FormatShift)
+                                                                | RenderingVariant_Alpha
+                                                                | (operation == TEXTURE_BILINEAR ? RenderingVariant_Bilinear : RenderingVariant_NearestNeighbor));
+            uint16_t* const frameBuffer = HAL::getInstance()->lockFrameBuffer();
+            const DrawingSurface dest = { frameBuffer, HAL::FRAME_BUFFER_WIDTH };
+            lcd.drawTextureMapQuad(dest, vertices, texture, area, area, variant, 255);
+            HAL::getInstance()->unlockFrameBuffer();
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+void BlitBenchmark::queue(Operation operation, int size, const Sources& sources, HybridLCDGPU2D& gpu2d)
+{
+    const int16_t side = SIDES[size];
+    BlitOp op = BlitOp();
+    op.operation = DMA2D_OPERATIONS[operation];
+    op.color = Color::getColorFromRGB(0x20, 0x60, 0xA0);
+    op.pDst = sources.destination;
+    op.nSteps = side;
+    op.nLoops = side;
+    op.srcLoopStride = MAX_SIDE;
+    op.dstLoopStride = HAL::FRAME_BUFFER_WIDTH;
+    op.alpha = isBlended(operation) ? BLEND_ALPHA : 255;
+    op.dstFormat = Bitmap::RGB565;
+    switch (operation)
+    {
+    case COPY:
+    case COPY_ALPHA:
+        op.pSrc = sources.rgb565;
+        op.srcFormat = Bitmap::RGB565;
+        break;
+    case ARGB8888:
+    case ARGB8888_ALPHA:
+        op.pSrc = reinterpret_cast<const uint16_t*>(sources.argb8888);
+        op.srcFormat = Bitmap::ARGB8888;
+        break;
+    case L8:
+        op.pSrc = reinterpret_cast<const uint16_t*>(sources.l8);
+        op.pClut = sources.clut;
+        op.srcFormat = Bitmap::L8;
+        break;
+    case A4:
+    case A8:
+        // The glyphs are as wide as they are drawn. Their input mode is set by the
+        // operation, the source format only has to be one DMA2D reads.
+        op.pSrc = reinterpret_cast<const uint16_t*>(operation == A4 ? sources.a4[size] : sources.a8[size]);
+        op.srcLoopStride = side;
+        op.srcFormat = Bitmap::ARGB8888;
+        break;
+    default:
+        break;
+    }
+    gpu2d.queueMemoryCopy(op);
+}
+} // namespace touchgfx
+
+/* USER CODE END BlitBenchmark.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
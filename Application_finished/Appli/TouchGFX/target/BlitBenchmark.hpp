@@ -0,0 +1,158 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : BlitBenchmark.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef BLITBENCHMARK_HPP
+#define BLITBENCHMARK_HPP
+
+#include <touchgfx/hal/DMA.hpp>
+#include <touchgfx/lcd/LCD.hpp>
+#include <stdint.h>
+
+/* USER CODE BEGIN BlitBenchmark.hpp */
+
+/**
+ * Set to 1 to run the blit benchmark at the start of the first frame after startup. Used
+ * by the blit_benchmark target of the gcc makefile, see TouchGFXHAL::runBlitBenchmark().
+ */
+#ifndef TOUCHGFX_BLIT_BENCHMARK
+#define TOUCHGFX_BLIT_BENCHMARK 0
+#endif
+
+/**
+ * Number of times every operation is timed after a first execution that loads the caches.
+ * The shortest time is reported.
+ */
+#ifndef BLIT_BENCHMARK_REPEATS
+#define BLIT_BENCHMARK_REPEATS 4
+#endif
+
+namespace touchgfx
+{
+class HybridLCDGPU2D;
+
+/**
+ * @class BlitBenchmark
+ *
+ * @brief Times the blit operations of every rendering engine over a range of sizes and
+ *        reports them over SWO.
+ *
+ *        Every operation is drawn on squares of 4, 16, 64 and 128 pixels in the top left
+ *        corner of the framebuffer being drawn, on each engine that can execute it, and
+ *        timed with the cycle counter until its pixels are written:
+ *
+ *        - cpu: the LCD16bpp of the software backend, with DMA acceleration disabled as
+ *          it is in this application.
+ *        - dma2d: every BlitOperations capability of the DMA, queued as a BlitOp.
+ *        - gpu2d: the LCDGPU2D paths of HybridLCDGPU2D, with the costed fills and copies
+ *          kept on GPU2D. Bilinear texture mapping is drawn nearest neighbor while the
+ *          QualityGovernor has it disabled.
+ *
+ *        The sources are written below the measured area, at the start of the run, so
+ *        the results do not depend on the assets. L8 is only blitted by DMA2D, the LCD
+ *        classes draw it from bitmaps with a palette only. Texture mapping is not a DMA2D
+ *        operation.
+ *
+ *        Each time is reported as "blit bench <operation> <engine> <side>x<side>:
+ *        cycles=<n>", followed by the setup cost and cost per 64 pixels fitted to them,
+ *        in the units of HybridLCDGPU2D::setCost(). gcc/blitbench.py turns the report
+ *        into a CSV file, compares it with the one of another build and prints the
+ *        default cost table of HybridLCDGPU2D.
+ */
+class BlitBenchmark
+{
+public:
+    /** The operations timed. */
+    enum Operation
+    {
+        FILL,              ///< Opaque solid fill
+        FILL_ALPHA,        ///< Solid fill blended with the framebuffer
+        COPY,              ///< Opaque copy of RGB565 pixels
+        COPY_ALPHA,        ///< RGB565 pixels blended with the framebuffer
+        ARGB8888,          ///< ARGB8888 pixels blended by their alpha
+        ARGB8888_ALPHA,    ///< ARGB8888 pixels blended by their alpha and a global alpha
+        L8,                ///< L8 pixels with an ARGB8888 palette
+        A4,                ///< 4bpp glyph
+        A8,                ///< 8bpp glyph
+        TEXTURE_NEAREST,   ///< ARGB8888 texture mapped quad, nearest neighbor
+        TEXTURE_BILINEAR,  ///< ARGB8888 texture mapped quad, bilinear
+        NUMBER_OF_OPERATIONS
+    };
+
+    /** The engines the operations are timed on. */
+    enum Engine
+    {
+        ENGINE_CPU,
+        ENGINE_DMA2D,
+        ENGINE_GPU2D,
+        NUMBER_OF_ENGINES
+    };
+
+    /** Number of sizes every operation is timed on. */
+    static const int NUMBER_OF_SIDES = 4;
+
+    /**
+     * @fn static bool BlitBenchmark::run(LCD& cpu, HybridLCDGPU2D& gpu2d, DMA_Interface& dma);
+     *
+     * @brief Times every operation on every engine and reports the results over SWO.
+     *
+     *        Must be called at the start of a frame that draws the whole screen over the
+     *        pixels written, as HybridLCDGPU2D::calibrateCosts() is.
+     *
+     * @param [in,out] cpu   The software renderer.
+     * @param [in,out] gpu2d The GPU2D renderer, which the framebuffer is drawn with.
+     * @param [in,out] dma   The DMA2D driver.
+     *
+     * @return false if the framebuffer is not a full RGB565 framebuffer in landscape,
+     *         nothing is timed then.
+     */
+    static bool run(LCD& cpu, HybridLCDGPU2D& gpu2d, DMA_Interface& dma);
+
+private:
+    /** The sources of the operations, written into the framebuffer below the measured area. */
+    struct Sources
+    {
+        uint16_t* destination;   ///< The measured area
+        const uint16_t* rgb565;
+        const uint8_t* argb8888;
+        const uint8_t* l8;
+        const uint8_t* clut;     ///< Format and size of the palette, followed by its colors
+        const uint8_t* a4[NUMBER_OF_SIDES]; ///< One glyph for every side, see GlyphAtlas
+        const uint8_t* a8[NUMBER_OF_SIDES];
+    };
+
+    /** Gives access to the glyph drawing of the LCD classes, as LCD::drawString() has. */
+    struct Access : public LCD
+    {
+        static void glyph(LCD& lcd, uint16_t* frameBuffer, const Rect& area, const GlyphNode* node, const uint8_t* data, uint8_t bitsPerPixel)
+        {
+            (lcd.*(&Access::drawGlyph))(frameBuffer, area, 0, 0, 0, 0, Rect(0, 0, area.width, area.height), node, data, 1, 0, bitsPerPixel, 255, TEXT_ROTATE_0);
+        }
+    };
+
+    static bool isAvailable(Operation operation, Engine engine, DMA_Interface& dma);
+    static bool writeSources(uint16_t* frameBuffer, Sources& sources);
+    static uint32_t time(Operation operation, Engine engine, int size, const Sources& sources, LCD& cpu, HybridLCDGPU2D& gpu2d);
+    static void draw(Operation operation, int size, const Sources& sources, LCD& lcd);
+    static void queue(Operation operation, int size, const Sources& sources, HybridLCDGPU2D& gpu2d);
+};
+} // namespace touchgfx
+
+/* USER CODE END BlitBenchmark.hpp */
+
+#endif // BLITBENCHMARK_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
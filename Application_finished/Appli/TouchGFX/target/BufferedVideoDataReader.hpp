@@ -0,0 +1,82 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : BufferedVideoDataReader.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef BUFFEREDVIDEODATAREADER_HPP
+#define BUFFEREDVIDEODATAREADER_HPP
+
+#include <touchgfx/hal/VideoController.hpp>
+#include <stdint.h>
+
+/* USER CODE BEGIN BufferedVideoDataReader.hpp */
+
+namespace touchgfx
+{
+/**
+ * @class BufferedVideoDataReader
+ *
+ * @brief VideoDataReader which reads ranges of the video into its own RAM buffers in the
+ *        background.
+ *
+ *        STM32MJPEGDecoder prefetches the next frame when it starts decoding a frame
+ *        and hands the pointer returned by acquire() directly to the JPEG codec, without
+ *        copying the frame again. Implemented by PrefetchVideoDataReader for memory-mapped
+ *        flash and by SDCardVideoDataReader for the SD card.
+ */
+class BufferedVideoDataReader : public VideoDataReader
+{
+public:
+    /**
+     * @fn virtual const uint8_t* BufferedVideoDataReader::acquire(uint32_t offset, uint32_t length) = 0;
+     *
+     * @brief Gets a pointer to a range of the video data in RAM.
+     *
+     *        Waits for the range if it is still being read, or reads it at once if it was
+     *        not prefetched.
+     *
+     * @param offset The offset of the range in the video data.
+     * @param length The length of the range, at most getSlotSize().
+     *
+     * @return Pointer to the range.
+     */
+    virtual const uint8_t* acquire(uint32_t offset, uint32_t length) = 0;
+
+    /**
+     * @fn virtual void BufferedVideoDataReader::prefetch(uint32_t offset, uint32_t length) = 0;
+     *
+     * @brief Starts reading a range of the video data to RAM.
+     *
+     * @param offset The offset of the range in the video data.
+     * @param length The length of the range, clipped to getSlotSize().
+     */
+    virtual void prefetch(uint32_t offset, uint32_t length) = 0;
+
+    /**
+     * @fn virtual uint32_t BufferedVideoDataReader::getSlotSize() const = 0;
+     *
+     * @brief Gets the largest range that can be acquired or prefetched.
+     *
+     * @return The size in bytes.
+     */
+    virtual uint32_t getSlotSize() const = 0;
+};
+} // namespace touchgfx
+
+/* USER CODE END BufferedVideoDataReader.hpp */
+
+#endif // BUFFEREDVIDEODATAREADER_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
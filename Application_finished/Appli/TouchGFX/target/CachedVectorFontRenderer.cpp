@@ -0,0 +1,337 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : CachedVectorFontRenderer.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include <CachedVectorFontRenderer.hpp>
+
+/* USER CODE BEGIN CachedVectorFontRenderer.cpp */
+#include <touchgfx/Matrix3x3.hpp>
+#include <touchgfx/hal/Config.hpp>
+#include <touchgfx/hal/VectorRenderer.hpp>
+#include <string.h>
+
+#ifdef TOUCHGFX_VECTOR_FONT_SECTION
+#define VECTOR_FONT_PRAGMA LOCATION_PRAGMA_NOLOAD(TOUCHGFX_VECTOR_FONT_SECTION)
+#define VECTOR_FONT_ATTRIBUTE LOCATION_ATTRIBUTE_NOLOAD(TOUCHGFX_VECTOR_FONT_SECTION)
+#else
+#define VECTOR_FONT_PRAGMA
+#define VECTOR_FONT_ATTRIBUTE
+#endif
+
+namespace
+{
+VECTOR_FONT_PRAGMA
+float pointBuffer[TOUCHGFX_VECTOR_FONT_POINTS] VECTOR_FONT_ATTRIBUTE;
+VECTOR_FONT_PRAGMA
+uint8_t commandBuffer[TOUCHGFX_VECTOR_FONT_COMMANDS] VECTOR_FONT_ATTRIBUTE;
+#if TOUCHGFX_VECTOR_OUTLINE_CACHE_BYTES > 0
+VECTOR_FONT_PRAGMA
+uint32_t outlineCache[TOUCHGFX_VECTOR_OUTLINE_CACHE_BYTES / 4] VECTOR_FONT_ATTRIBUTE;
+#endif
+}
+
+namespace touchgfx
+{
+CachedVectorFontRenderer::CachedVectorFontRenderer()
+    : numEntries(0), used(0), overflowed(false)
+{
+    memset(index, 0, sizeof(index));
+    memset(&scratch, 0, sizeof(scratch));
+    resetStats();
+}
+
+void CachedVectorFontRenderer::drawGlyph(const Rect& canvasAreaAbs, const Rect& invalidatedAreaRel, const uint16_t* data, const Font* font, colortype color, uint8_t alpha, TextRotation rotation, int x, int y)
+{
+    VectorRenderer* const renderer = VectorRenderer::getInstance();
+    if (data == 0 || renderer == 0)
+    {
+        return;
+    }
+    const Outline* const outline = find(data);
+    if (outline == 0)
+    {
+        return;
+    }
+
+    // Same placement as VectorFontRendererImpl, the invalidated area is rotated with the glyph
+    Matrix3x3 m;
+    m.scale(font->getScaleFactor());
+    Rect area;
+    switch (rotation)
+    {
+    case TEXT_ROTATE_0:
+        renderer->setup(canvasAreaAbs, invalidatedAreaRel);
+        m.translate((float)x, (float)y);
+        break;
+    case TEXT_ROTATE_90:
+        area.x = canvasAreaAbs.width - invalidatedAreaRel.height - invalidatedAreaRel.y;
+        area.y = invalidatedAreaRel.x;
+        area.width = invalidatedAreaRel.height;
+        area.height = invalidatedAreaRel.width;
+        renderer->setup(canvasAreaAbs, area);
+        m.rotate(90.0f);
+        m.translate((float)(canvasAreaAbs.width - y), (float)x);
+        break;
+    case TEXT_ROTATE_180:
+        area.x = canvasAreaAbs.width - invalidatedAreaRel.width - invalidatedAreaRel.x;
+        area.y = canvasAreaAbs.height - invalidatedAreaRel.height - invalidatedAreaRel.y;
+        area.width = invalidatedAreaRel.width;
+        area.height = invalidatedAreaRel.height;
+        renderer->setup(canvasAreaAbs, area);
+        m.rotate(180.0f);
+        m.translate((float)(canvasAreaAbs.width - x), (float)(canvasAreaAbs.height - y));
+        break;
+    case TEXT_ROTATE_270:
+        area.x = invalidatedAreaRel.y;
+        area.y = canvasAreaAbs.height - invalidatedAreaRel.width - invalidatedAreaRel.x;
+        area.width = invalidatedAreaRel.height;
+        area.height = invalidatedAreaRel.width;
+        renderer->setup(canvasAreaAbs, area);
+        m.rotate(270.0f);
+        m.translate((float)y, (float)(canvasAreaAbs.height - x));
+        break;
+    }
+    renderer->setTransformationMatrix(m);
+    renderer->setColor(colortype((uint32_t)color | 0xFF000000U));
+    renderer->setAlpha(alpha);
+    renderer->setMode(VectorRenderer::FILL_EVEN_ODD);
+    renderer->drawPath(outline->cmds, outline->numCmds, outline->points, outline->numPoints, outline->bbox);
+    renderer->tearDown();
+}
+
+void CachedVectorFontRenderer::frameStarted()
+{
+    if (overflowed)
+    {
+        overflowed = false;
+        clear();
+        stats.clears++;
+    }
+}
+
+void CachedVectorFontRenderer::clear()
+{
+    numEntries = 0;
+    used = 0;
+    memset(index, 0, sizeof(index));
+}
+
+void CachedVectorFontRenderer::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+const CachedVectorFontRenderer::Outline* CachedVectorFontRenderer::find(const uint16_t* data)
+{
+    uint16_t i = slot(data);
+#if TOUCHGFX_VECTOR_OUTLINE_CACHE_BYTES > 0
+    while (index[i] != 0)
+    {
+        const Outline& entry = entries[index[i] - 1];
+        if (entry.data == data)
+        {
+            stats.hits++;
+            return &entry;
+        }
+        i = (i + 1) & (INDEX_SIZE - 1);
+    }
+#endif
+
+    if (!convert(data, scratch))
+    {
+        stats.tooLarge++;
+        return 0;
+    }
+    stats.converted++;
+
+#if TOUCHGFX_VECTOR_OUTLINE_CACHE_BYTES > 0
+    // Points first, as the commands do not keep floats aligned
+    const uint32_t pointBytes = scratch.numPoints * sizeof(float);
+    const uint32_t bytes = (pointBytes + scratch.numCmds + 3U) & ~3U;
+    if (numEntries == TOUCHGFX_VECTOR_OUTLINE_CACHE_ENTRIES || used + bytes > TOUCHGFX_VECTOR_OUTLINE_CACHE_BYTES)
+    {
+        overflowed = true;
+        stats.overflows++;
+        return &scratch;
+    }
+    uint8_t* const memory = reinterpret_cast<uint8_t*>(outlineCache) + used;
+    memcpy(memory, scratch.points, pointBytes);
+    memcpy(memory + pointBytes, scratch.cmds, scratch.numCmds);
+    used += bytes;
+
+    Outline& entry = entries[numEntries++];
+    entry = scratch;
+    entry.points = reinterpret_cast<const float*>(memory);
+    entry.cmds = memory + pointBytes;
+    index[i] = numEntries;
+    return &entry;
+#else
+    (void)i;
+    return &scratch;
+#endif
+}
+
+bool CachedVectorFontRenderer::convert(const uint16_t* glyph, Outline& outline)
+{
+    const uint16_t* data = glyph;
+    uint16_t numCmds = 0;
+    uint16_t numPoints = 0;
+    const uint16_t numContours = *data++;
+    for (uint16_t contour = 0; contour < numContours; contour++)
+    {
+        if (!convertContour(data, numCmds, numPoints))
+        {
+            return false;
+        }
+    }
+
+    float minX = 0.0f;
+    float minY = 0.0f;
+    float maxX = 0.0f;
+    float maxY = 0.0f;
+    // Control points are included, the curves stay inside their hull
+    for (uint16_t i = 0; i + 1 < numPoints; i += 2)
+    {
+        const float px = pointBuffer[i];
+        const float py = pointBuffer[i + 1];
+        if (i == 0 || px < minX)
+        {
+            minX = px;
+        }
+        if (i == 0 || px > maxX)
+        {
+            maxX = px;
+        }
+        if (i == 0 || py < minY)
+        {
+            minY = py;
+        }
+        if (i == 0 || py > maxY)
+        {
+            maxY = py;
+        }
+    }
+
+    outline.data = glyph;
+    outline.points = pointBuffer;
+    outline.cmds = commandBuffer;
+    outline.numPoints = numPoints;
+    outline.numCmds = numCmds;
+    outline.bbox[0] = minX;
+    outline.bbox[1] = minY;
+    outline.bbox[2] = maxX;
+    outline.bbox[3] = maxY;
+    return true;
+}
+
+bool CachedVectorFontRenderer::convertContour(const uint16_t*& data, uint16_t& numCmds, uint16_t& numPoints)
+{
+    // A contour is the number of points, one on-curve bit per point and the points
+    const uint16_t tagCount = *data++;
+    const uint16_t* tags = data;
+    const int16_t* points = reinterpret_cast<const int16_t*>(data + (tagCount + 15) / 16);
+
+    // One command per point and one to close, four floats per point at most
+    if (tagCount == 0 || numCmds + tagCount + 1 > TOUCHGFX_VECTOR_FONT_COMMANDS || numPoints + 4 * tagCount + 4 > TOUCHGFX_VECTOR_FONT_POINTS)
+    {
+        return false;
+    }
+
+    const int firstX = *points++;
+    const int firstY = *points++;
+    commandBuffer[numCmds++] = VECTOR_PRIM_MOVE;
+    pointBuffer[numPoints++] = (float)firstX;
+    pointBuffer[numPoints++] = (float)firstY;
+
+    // Two control points in a row imply an on-curve point halfway between them
+    bool prevOnCurve = true;
+    int ctrlX = 0;
+    int ctrlY = 0;
+    int lastX = firstX;
+    int lastY = firstY;
+    uint16_t tagBits = *tags;
+    uint16_t bit = 1;
+    for (uint16_t i = 1; i < tagCount; i++)
+    {
+        const bool onCurve = ((tagBits >> bit) & 1U) != 0;
+        lastX = *points++;
+        lastY = *points++;
+        if (onCurve)
+        {
+            if (prevOnCurve)
+            {
+                commandBuffer[numCmds++] = VECTOR_PRIM_LINE;
+            }
+            else
+            {
+                commandBuffer[numCmds++] = VECTOR_PRIM_BEZIER_QUAD;
+                pointBuffer[numPoints++] = (float)ctrlX;
+                pointBuffer[numPoints++] = (float)ctrlY;
+            }
+            pointBuffer[numPoints++] = (float)lastX;
+            pointBuffer[numPoints++] = (float)lastY;
+        }
+        else
+        {
+            if (!prevOnCurve)
+            {
+                commandBuffer[numCmds++] = VECTOR_PRIM_BEZIER_QUAD;
+                pointBuffer[numPoints++] = (float)ctrlX;
+                pointBuffer[numPoints++] = (float)ctrlY;
+                pointBuffer[numPoints++] = (ctrlX + lastX) / 2.0f;
+                pointBuffer[numPoints++] = (ctrlY + lastY) / 2.0f;
+            }
+            ctrlX = lastX;
+            ctrlY = lastY;
+        }
+        prevOnCurve = onCurve;
+        if (++bit == 16)
+        {
+            tagBits = *++tags;
+            bit = 0;
+        }
+    }
+
+    if (!prevOnCurve)
+    {
+        commandBuffer[numCmds++] = VECTOR_PRIM_BEZIER_QUAD;
+        pointBuffer[numPoints++] = (float)ctrlX;
+        pointBuffer[numPoints++] = (float)ctrlY;
+        pointBuffer[numPoints++] = (float)firstX;
+        pointBuffer[numPoints++] = (float)firstY;
+    }
+    else if (lastX != firstX || lastY != firstY)
+    {
+        commandBuffer[numCmds++] = VECTOR_PRIM_LINE;
+        pointBuffer[numPoints++] = (float)firstX;
+        pointBuffer[numPoints++] = (float)firstY;
+    }
+
+    data = reinterpret_cast<const uint16_t*>(points);
+    return true;
+}
+
+uint16_t CachedVectorFontRenderer::slot(const uint16_t* data) const
+{
+    // Glyph data is 2 byte aligned, Fibonacci hashing spreads the low bits
+    return (uint16_t)(((uint32_t)(uintptr_t)data * 2654435761U) >> 23);
+}
+} // namespace touchgfx
+
+/* USER CODE END CachedVectorFontRenderer.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
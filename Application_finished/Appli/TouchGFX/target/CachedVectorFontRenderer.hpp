@@ -0,0 +1,164 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : CachedVectorFontRenderer.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef CACHEDVECTORFONTRENDERER_HPP
+#define CACHEDVECTORFONTRENDERER_HPP
+
+#include <touchgfx/hal/VectorFontRenderer.hpp>
+#include <stdint.h>
+
+/* USER CODE BEGIN CachedVectorFontRenderer.hpp */
+
+/**
+ * Number of floats in the buffer a glyph outline is converted into, two per point. A glyph
+ * with more points is not drawn.
+ */
+#ifndef TOUCHGFX_VECTOR_FONT_POINTS
+#define TOUCHGFX_VECTOR_FONT_POINTS 1024
+#endif
+
+/**
+ * Number of path commands in the buffer a glyph outline is converted into.
+ */
+#ifndef TOUCHGFX_VECTOR_FONT_COMMANDS
+#define TOUCHGFX_VECTOR_FONT_COMMANDS 256
+#endif
+
+/**
+ * Bytes of converted outlines kept for the glyphs drawn again, 0 to convert every glyph
+ * each time it is drawn.
+ */
+#ifndef TOUCHGFX_VECTOR_OUTLINE_CACHE_BYTES
+#define TOUCHGFX_VECTOR_OUTLINE_CACHE_BYTES (48 * 1024)
+#endif
+
+/**
+ * Number of glyph outlines kept, less than 512.
+ */
+#ifndef TOUCHGFX_VECTOR_OUTLINE_CACHE_ENTRIES
+#define TOUCHGFX_VECTOR_OUTLINE_CACHE_ENTRIES 256
+#endif
+
+/*
+ * The buffers are in internal RAM unless TOUCHGFX_VECTOR_FONT_SECTION names the linker
+ * section to place them in, for instance "TouchGFX_Framebuffer" for PSRAM.
+ */
+
+namespace touchgfx
+{
+/**
+ * @class CachedVectorFontRenderer
+ *
+ * @brief Draws vector font glyphs with GPU2DVectorRenderer, keeping the converted outlines.
+ *
+ *        VectorFontRendererImpl converts the contours of a glyph, stored as 16 bit points
+ *        and on-curve tags, into the commands and float points of a path every time the
+ *        glyph is drawn, in buffers sized by the generated VectorFontRendererBuffers.cpp.
+ *        That file is regenerated from the fonts of the project, and has no buffers as long
+ *        as no vector font is used. This renderer has its own buffers, sized by
+ *        TOUCHGFX_VECTOR_FONT_POINTS and TOUCHGFX_VECTOR_FONT_COMMANDS.
+ *
+ *        Converted outlines are kept with their bounding box, so a glyph drawn again is
+ *        passed to drawPath() without converting it, and NemaVG does not have to compute the
+ *        bounding box. Outlines are in font units and scaled by the transformation, so one
+ *        entry serves every size and rotation of a glyph. When an outline does not fit, it
+ *        is drawn from the conversion buffer, and frameStarted() clears the cache.
+ */
+class CachedVectorFontRenderer : public VectorFontRenderer
+{
+public:
+    /** Lookups since the last reset. */
+    struct Stats
+    {
+        uint32_t hits;      ///< Glyphs drawn from a kept outline
+        uint32_t converted; ///< Glyphs converted, whether kept or not
+        uint32_t overflows; ///< Converted outlines that did not fit in the cache
+        uint32_t clears;    ///< Times the cache was cleared to make room
+        uint32_t tooLarge;  ///< Glyphs not drawn as the conversion buffers are too small
+    };
+
+    CachedVectorFontRenderer();
+
+    virtual void drawGlyph(const Rect& canvasAreaAbs, const Rect& invalidatedAreaRel, const uint16_t* data, const Font* font, colortype color, uint8_t alpha, TextRotation rotation, int x, int y);
+
+    /**
+     * @fn void CachedVectorFontRenderer::frameStarted();
+     *
+     * @brief Clears the cache if an outline did not fit in the previous frame.
+     */
+    void frameStarted();
+
+    /**
+     * @fn void CachedVectorFontRenderer::clear();
+     *
+     * @brief Removes all kept outlines.
+     */
+    void clear();
+
+    /**
+     * @fn const Stats& CachedVectorFontRenderer::getStats() const;
+     *
+     * @brief Gets the lookup statistics.
+     *
+     * @return The lookup statistics.
+     */
+    const Stats& getStats() const
+    {
+        return stats;
+    }
+
+    /**
+     * @fn void CachedVectorFontRenderer::resetStats();
+     *
+     * @brief Resets the lookup statistics.
+     */
+    void resetStats();
+
+private:
+    static const uint16_t INDEX_SIZE = 512;
+
+    /** A glyph converted into a path. */
+    struct Outline
+    {
+        const uint16_t* data; ///< The glyph data in flash
+        const float* points;
+        const uint8_t* cmds;
+        uint16_t numPoints;
+        uint16_t numCmds;
+        float bbox[4]; ///< Min x, min y, max x, max y
+    };
+
+    const Outline* find(const uint16_t* data);
+    bool convert(const uint16_t* glyph, Outline& outline);
+    bool convertContour(const uint16_t*& data, uint16_t& numCmds, uint16_t& numPoints);
+    uint16_t slot(const uint16_t* data) const;
+
+    Outline entries[TOUCHGFX_VECTOR_OUTLINE_CACHE_ENTRIES > 0 ? TOUCHGFX_VECTOR_OUTLINE_CACHE_ENTRIES : 1];
+    uint16_t index[INDEX_SIZE]; ///< Entry + 1 by hashed glyph data, 0 if free
+    uint16_t numEntries;
+    uint32_t used;   ///< Bytes of the cache taken by outlines
+    bool overflowed; ///< An outline did not fit in the current frame
+    Outline scratch; ///< The outline in the conversion buffers
+    Stats stats;
+};
+} // namespace touchgfx
+
+/* USER CODE END CachedVectorFontRenderer.hpp */
+
+#endif // CACHEDVECTORFONTRENDERER_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
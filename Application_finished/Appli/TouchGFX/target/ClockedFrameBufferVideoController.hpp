@@ -0,0 +1,551 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : ClockedFrameBufferVideoController.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef CLOCKEDFRAMEBUFFERVIDEOCONTROLLER_HPP
+#define CLOCKEDFRAMEBUFFERVIDEOCONTROLLER_HPP
+
+#include <touchgfx/widgets/VideoWidget.hpp>
+#include <MJPEGDecoder.hpp>
+#include <TouchGFXHAL.hpp>
+#include <VideoClock.hpp>
+#include <string.h>
+
+/* USER CODE BEGIN ClockedFrameBufferVideoController.hpp */
+
+/**
+ * Set to 0 to always decode the invalidated part of the frame in draw, even if the same frame
+ * was already decoded.
+ */
+#ifndef VIDEO_DECODE_CACHE
+#define VIDEO_DECODE_CACHE 1
+#endif
+
+/**
+ * Replaces the generated DirectFrameBufferVideoController, adding the decode cache and the
+ * VideoClock pacing.
+ * Strategy:
+ * Decode directly into the framebuffer in draw.
+ * Tick will decide if we are going to a new frame.
+ * If a decode cache is set, the whole frame is decoded into the cache once, and draw copies
+ * the invalidated area from it until the tick goes to a new frame.
+ * The frame to show is decided by the VideoClock of the stream, from the time between VSYNCs,
+ * so the video keeps its speed when UI frames are lost. A frame that is late is skipped
+ * without being decoded. Videos without a known frame rate, and streams without frame rate
+ * compensation, go to the next frame by the ratio of UI frames set with setFrameRate().
+ */
+template <uint32_t no_streams, touchgfx::Bitmap::BitmapFormat output_format>
+class ClockedFrameBufferVideoController : public touchgfx::VideoController
+{
+public:
+    ClockedFrameBufferVideoController()
+        : VideoController(), allowSkipFrames(true),
+          cacheBuffer(0), sizeCacheBuffer(0), cacheHandle(0), cacheFrameNumber(0), cacheValid(false)
+    {
+        assert((no_streams > 0) && "Video: Number of streams zero!");
+
+        // Clear arrays
+        memset(mjpegDecoders, 0, sizeof(mjpegDecoders));
+    }
+
+    virtual Handle registerVideoWidget(touchgfx::VideoWidget& widget)
+    {
+        // Find stream handle for Widget
+        Handle handle = getFreeHandle();
+
+        streams[handle].isActive = true;
+
+        //Set Widget buffer format and address
+        widget.setVideoBufferFormat(output_format, 0, 0);
+        widget.setVideoBuffer((uint8_t*)0);
+
+        return handle;
+    }
+
+    virtual void unregisterVideoWidget(const Handle handle)
+    {
+        streams[handle].isActive = false;
+    }
+
+    virtual void setFrameRate(const Handle handle, uint32_t ui_frames, uint32_t video_frames)
+    {
+        assert(handle < no_streams);
+        Stream& stream = streams[handle];
+
+        // Reset counters
+        stream.frameCount = 0;
+        stream.tickCount = 0;
+
+        // Save requested frame rate ratio
+        stream.frame_rate_ticks = ui_frames;
+        stream.frame_rate_video = video_frames;
+        restartClock(handle);
+    }
+
+    virtual void setVideoData(const Handle handle, const uint8_t* movie, const uint32_t length)
+    {
+        assert(handle < no_streams);
+
+        // Reset decoder to first frame
+        mjpegDecoders[handle]->setVideoData(movie, length);
+        cacheValid = false;
+
+        // Lower flag to show the first frame
+        Stream& stream = streams[handle];
+        stream.frameNumber = mjpegDecoders[handle]->getCurrentFrameNumber();
+        stream.doDecodeNextFrame = false;
+        touchgfx::VideoInformation info;
+        mjpegDecoders[handle]->getVideoInfo(&info);
+        stream.msBetweenFrames = info.ms_between_frames;
+
+        // Stop playing
+        setCommand(handle, PAUSE, 0);
+    }
+
+    virtual void setVideoData(const Handle handle, touchgfx::VideoDataReader& reader)
+    {
+        assert(handle < no_streams);
+
+        // Reset decoder to first frame
+        mjpegDecoders[handle]->setVideoData(reader);
+        cacheValid = false;
+
+        // Lower flag to show the first frame
+        Stream& stream = streams[handle];
+        stream.frameNumber = mjpegDecoders[handle]->getCurrentFrameNumber();
+        stream.doDecodeNextFrame = false;
+        touchgfx::VideoInformation info;
+        mjpegDecoders[handle]->getVideoInfo(&info);
+        stream.msBetweenFrames = info.ms_between_frames;
+
+        // Stop playing
+        setCommand(handle, PAUSE, 0);
+    }
+
+    virtual void setCommand(const Handle handle, Command cmd, uint32_t param)
+    {
+        assert(handle < no_streams);
+        Stream& stream = streams[handle];
+
+        switch (cmd)
+        {
+        case PLAY:
+            // Cannot Play without movie
+            if (mjpegDecoders[handle]->hasVideo())
+            {
+                stream.isPlaying = true;
+                stream.isShowingOneFrame = false;
+                // Reset counters
+                stream.frameCount = 0;
+                stream.tickCount = 0;
+                // If non-repeating video stopped at the end, kick to next frame
+                if (!stream.repeat)
+                {
+                    MJPEGDecoder* const decoder = mjpegDecoders[handle];
+                    if (decoder->getCurrentFrameNumber() == decoder->getNumberOfFrames())
+                    {
+                        decoder->gotoNextFrame();
+                    }
+                }
+                restartClock(handle);
+            }
+            break;
+        case PAUSE:
+            stream.isPlaying = false;
+            stream.isShowingOneFrame = false;
+            break;
+        case SEEK:
+            stream.seek_to_frame = param;
+            // Reset counters
+            stream.frameCount = 0;
+            stream.tickCount = 0;
+            break;
+        case SHOW:
+            stream.seek_to_frame = param;
+            stream.isShowingOneFrame = true;
+            stream.doDecodeNextFrame = true;
+            // Reset counters
+            stream.frameCount = 0;
+            stream.tickCount = 0;
+            break;
+        case STOP:
+            stream.isPlaying = false;
+            stream.isShowingOneFrame = false;
+            stream.seek_to_frame = 1;
+            // Reset counters
+            stream.frameCount = 0;
+            stream.tickCount = 0;
+            break;
+        case SET_REPEAT:
+            stream.repeat = (param > 0);
+            break;
+        }
+    }
+
+    virtual bool updateFrame(const Handle handle, touchgfx::VideoWidget& widget)
+    {
+        assert(handle < no_streams);
+        Stream& stream = streams[handle];
+
+        if (stream.clock.isRunning() && (stream.isPlaying || stream.isShowingOneFrame))
+        {
+            return updateFrameFromClock(handle, widget);
+        }
+
+        bool hasMoreFrames = true;
+
+        if (stream.isPlaying || stream.isShowingOneFrame)
+        {
+            // Increase tickCount
+            stream.tickCount += touchgfx::HAL::getInstance()->getLCDRefreshCount();
+
+            // Lower flag
+            stream.isShowingOneFrame = false;
+
+            if (stream.doDecodeNextFrame)
+            {
+                MJPEGDecoder* const decoder = mjpegDecoders[handle];
+                // Invalidate to get widget redrawn
+                widget.invalidate();
+                // Seek or increment video frame
+                if (stream.seek_to_frame > 0)
+                {
+                    decoder->gotoFrame(stream.seek_to_frame);
+                    hasMoreFrames = (stream.seek_to_frame < decoder->getNumberOfFrames());
+                    stream.seek_to_frame = 0;
+                    restartClock(handle);
+                }
+                else
+                {
+                    if (stream.skip_frames > 0)
+                    {
+                        decoder->gotoFrame(decoder->getCurrentFrameNumber() + stream.skip_frames);
+                        stream.frameCount += stream.skip_frames;
+                        stream.skip_frames = 0;
+                    }
+                    if (stream.repeat)
+                    {
+                        hasMoreFrames = decoder->gotoNextFrame();
+                    }
+                    else
+                    {
+                        if (decoder->getCurrentFrameNumber() < decoder->getNumberOfFrames())
+                        {
+                            hasMoreFrames = decoder->gotoNextFrame();
+                        }
+                        else
+                        {
+                            stream.isPlaying = false;
+                            hasMoreFrames = false;
+                        }
+                    }
+                }
+
+                stream.frameNumber = decoder->getCurrentFrameNumber();
+                stream.frameCount++;
+            }
+
+            // Save decode status for next frame
+            stream.doDecodeNextFrame = decodeForNextTick(stream);
+        }
+
+        return hasMoreFrames;
+    }
+
+    virtual void draw(const Handle handle, const touchgfx::Rect& invalidatedArea, const touchgfx::VideoWidget& widget)
+    {
+        assert(handle < no_streams);
+
+        if (output_format != touchgfx::Bitmap::RGB565 && output_format != touchgfx::Bitmap::RGB888 && output_format != touchgfx::Bitmap::ARGB8888)
+        {
+            return;
+        }
+
+        if (mjpegDecoders[handle]->hasVideo() && drawFromCache(handle, invalidatedArea, widget))
+        {
+            return;
+        }
+
+        if (mjpegDecoders[handle]->hasVideo())
+        {
+            uint8_t* wbuf = (uint8_t*)touchgfx::HAL::getInstance()->lockFrameBufferForRenderingMethod(touchgfx::HAL::HARDWARE);
+            const touchgfx::Rect& absolute = widget.getAbsoluteRect();
+
+            // Get frame buffer pointer to upper left of widget in framebuffer coordinates
+            switch (output_format)
+            {
+            case touchgfx::Bitmap::RGB565:
+                wbuf += (absolute.x + absolute.y * touchgfx::HAL::FRAME_BUFFER_WIDTH) * 2;
+                break;
+            case touchgfx::Bitmap::RGB888:
+                wbuf += (absolute.x + absolute.y * touchgfx::HAL::FRAME_BUFFER_WIDTH) * 3;
+                break;
+            case touchgfx::Bitmap::ARGB8888:
+                wbuf += (absolute.x + absolute.y * touchgfx::HAL::FRAME_BUFFER_WIDTH) * 4;
+                break;
+            default:
+                break;
+            }
+
+            // Decode relevant part of the frame to the framebuffer
+            mjpegDecoders[handle]->decodeFrame(invalidatedArea, wbuf, touchgfx::HAL::FRAME_BUFFER_WIDTH);
+            // Release frame buffer
+            touchgfx::HAL::getInstance()->unlockFrameBuffer();
+        }
+    }
+
+    /**
+     * Set the buffer holding the last decoded frame. The buffer must hold one frame with a
+     * stride of HAL::FRAME_BUFFER_WIDTH pixels. Only used for RGB565 output.
+     */
+    void setDecodeCache(uint8_t* buffer, size_t sizeOfBuffer)
+    {
+        cacheBuffer = buffer;
+        sizeCacheBuffer = sizeOfBuffer;
+        cacheValid = false;
+    }
+
+    void addDecoder(MJPEGDecoder& decoder, uint32_t index)
+    {
+        assert(index < no_streams);
+        mjpegDecoders[index] = &decoder;
+    }
+
+    virtual uint32_t getCurrentFrameNumber(const Handle handle)
+    {
+        assert(handle < no_streams);
+        Stream& stream = streams[handle];
+
+        return stream.frameNumber;
+    }
+
+    virtual void getVideoInformation(const Handle handle, touchgfx::VideoInformation* data)
+    {
+        assert(handle < no_streams);
+        mjpegDecoders[handle]->getVideoInfo(data);
+    }
+
+    virtual bool getIsPlaying(const Handle handle)
+    {
+        assert(handle < no_streams);
+        Stream& stream = streams[handle];
+        return stream.isPlaying;
+    }
+
+    virtual void setVideoFrameRateCompensation(const bool allow)
+    {
+        allowSkipFrames = allow;
+    }
+
+private:
+    class Stream
+    {
+    public:
+        Stream()
+            : frameCount(0), frameNumber(0), tickCount(0),
+              frame_rate_video(0), frame_rate_ticks(0),
+              seek_to_frame(0), skip_frames(0), msBetweenFrames(0),
+              isActive(false), isPlaying(false), isShowingOneFrame(false), repeat(true),
+              doDecodeNextFrame(false)
+        {
+        }
+        uint32_t frameCount;       // Video frames decoded since play
+        uint32_t frameNumber;      // Video frame showed number
+        uint32_t tickCount;        // UI frames since play
+        uint32_t frame_rate_video; // Ratio of frames wanted counter
+        uint32_t frame_rate_ticks; // Ratio of frames wanted divider
+        uint32_t seek_to_frame;    // Requested next frame number
+        uint32_t skip_frames;      // Number of frames to skip to keep frame rate
+        uint32_t msBetweenFrames;  // Frame interval of the video, 0 if unknown
+        touchgfx::VideoClock clock; // Decides the frame to show, if the frame interval is known
+        bool isActive;
+        bool isPlaying;
+        bool isShowingOneFrame;
+        bool repeat;
+        bool doDecodeNextFrame; // High if we should go to next frame in next tick
+    };
+
+    MJPEGDecoder* mjpegDecoders[no_streams];
+    Stream streams[no_streams];
+    bool allowSkipFrames;
+    uint8_t* cacheBuffer;      // Last decoded frame, or 0
+    size_t sizeCacheBuffer;    // Size in Bytes
+    Handle cacheHandle;        // Stream of the cached frame
+    uint32_t cacheFrameNumber; // Decoder frame number of the cached frame
+    bool cacheValid;
+
+    /**
+     * Copy the invalidated area from the decode cache, decoding the whole frame into the
+     * cache first if it holds another frame. Return false if the cache cannot be used.
+     */
+    bool drawFromCache(const Handle handle, const touchgfx::Rect& invalidatedArea, const touchgfx::VideoWidget& widget)
+    {
+        if (!VIDEO_DECODE_CACHE || cacheBuffer == 0 || output_format != touchgfx::Bitmap::RGB565)
+        {
+            return false;
+        }
+
+        MJPEGDecoder* const decoder = mjpegDecoders[handle];
+        touchgfx::VideoInformation info;
+        decoder->getVideoInfo(&info);
+        const uint32_t stride = touchgfx::HAL::FRAME_BUFFER_WIDTH * 2;
+        if (info.frame_width > touchgfx::HAL::FRAME_BUFFER_WIDTH || info.frame_height * stride > sizeCacheBuffer)
+        {
+            return false;
+        }
+
+        // Only run the codec when the tick went to another frame
+        const uint32_t frameNumber = decoder->getCurrentFrameNumber();
+        if (!cacheValid || cacheHandle != handle || cacheFrameNumber != frameNumber)
+        {
+            decoder->decodeFrame(touchgfx::Rect(0, 0, info.frame_width, info.frame_height), cacheBuffer, touchgfx::HAL::FRAME_BUFFER_WIDTH);
+            cacheHandle = handle;
+            cacheFrameNumber = frameNumber;
+            cacheValid = true;
+        }
+
+        touchgfx::Rect area = invalidatedArea & touchgfx::Rect(0, 0, info.frame_width, info.frame_height);
+        if (area.isEmpty())
+        {
+            return true;
+        }
+        const touchgfx::Rect source(widget.getAbsoluteRect().x, widget.getAbsoluteRect().y, touchgfx::HAL::FRAME_BUFFER_WIDTH, info.frame_height);
+        widget.translateRectToAbsolute(area);
+        touchgfx::HAL::lcd().blitCopy(reinterpret_cast<const uint16_t*>(cacheBuffer), source, area, 255, false);
+        return true;
+    }
+
+    /**
+     * Restart the clock of the stream from the current frame. The frame interval is that of
+     * the UI frame ratio, if set, else that of the video.
+     */
+    void restartClock(const Handle handle)
+    {
+        Stream& stream = streams[handle];
+        TouchGFXHAL* const hal = static_cast<TouchGFXHAL*>(touchgfx::HAL::getInstance());
+        uint32_t intervalUs = stream.msBetweenFrames * 1000;
+        if (stream.frame_rate_ticks > 0 && stream.frame_rate_video > 0)
+        {
+            intervalUs = stream.frame_rate_ticks * hal->getRefreshPeriodUs() / stream.frame_rate_video;
+        }
+        // Without frame rate compensation every frame is shown, by the UI frame ratio
+        stream.clock.start(mjpegDecoders[handle]->getCurrentFrameNumber(), allowSkipFrames ? intervalUs : 0);
+    }
+
+    /**
+     * Go to the frame due on the clock when the frame rendered in this tick is shown. Return
+     * false when the video ended or wrapped to the first frame.
+     */
+    bool updateFrameFromClock(const Handle handle, touchgfx::VideoWidget& widget)
+    {
+        // Running in UI thread
+
+        Stream& stream = streams[handle];
+        MJPEGDecoder* const decoder = mjpegDecoders[handle];
+        TouchGFXHAL* const hal = static_cast<TouchGFXHAL*>(touchgfx::HAL::getInstance());
+        const uint32_t numberOfFrames = decoder->getNumberOfFrames();
+
+        stream.isShowingOneFrame = false;
+        if (stream.seek_to_frame > 0)
+        {
+            decoder->gotoFrame(stream.seek_to_frame);
+            stream.seek_to_frame = 0;
+            restartClock(handle);
+            stream.frameNumber = decoder->getCurrentFrameNumber();
+            stream.clock.frameShown(stream.frameNumber, 0);
+            widget.invalidate();
+            return stream.frameNumber < numberOfFrames;
+        }
+        if (!stream.isPlaying)
+        {
+            return true;
+        }
+
+        stream.clock.advance(hal->getTickDeltaUs());
+        uint32_t due = stream.clock.getDueFrame(hal->getRefreshPeriodUs());
+        bool hasMoreFrames = true;
+        if (due > numberOfFrames)
+        {
+            if (stream.repeat)
+            {
+                stream.clock.rewind(numberOfFrames);
+                due = MIN(stream.clock.getDueFrame(hal->getRefreshPeriodUs()), numberOfFrames);
+            }
+            else
+            {
+                // The last frame was shown for its whole interval
+                due = numberOfFrames;
+                stream.isPlaying = false;
+            }
+            hasMoreFrames = false;
+        }
+
+        const uint32_t current = decoder->getCurrentFrameNumber();
+        if (due != current)
+        {
+            // The frames in between are late, and never decoded
+            const uint32_t skipped = due > current ? due - current - 1 : numberOfFrames - current + due - 1;
+            decoder->gotoFrame(due);
+            stream.frameNumber = due;
+            stream.clock.frameShown(due, skipped);
+            widget.invalidate();
+        }
+        return hasMoreFrames;
+    }
+
+    /**
+     * Return true, if new video frame should be decoded for the next tick (keep video decode framerate low)
+     */
+    bool decodeForNextTick(Stream& stream)
+    {
+        // Running in UI thread
+
+        // Compare tickCount/frameNumber to frame_rate_ticks/frame_rate_video
+        if ((stream.tickCount * stream.frame_rate_video) > (stream.frame_rate_ticks * stream.frameCount))
+        {
+            if (allowSkipFrames)
+            {
+                stream.skip_frames = (stream.tickCount * stream.frame_rate_video - stream.frame_rate_ticks * stream.frameCount) / stream.frame_rate_ticks;
+                if (stream.skip_frames > 0)
+                {
+                    stream.skip_frames--;
+                }
+            }
+            return true;
+        }
+        return false;
+    }
+
+    Handle getFreeHandle()
+    {
+        for (uint32_t i = 0; i < no_streams; i++)
+        {
+            if (streams[i].isActive == false)
+            {
+                return static_cast<VideoController::Handle>(i);
+            }
+        }
+
+        assert(0 && "Unable to find free video stream handle!");
+        return static_cast<VideoController::Handle>(0);
+    }
+};
+
+/* USER CODE END ClockedFrameBufferVideoController.hpp */
+
+#endif // CLOCKEDFRAMEBUFFERVIDEOCONTROLLER_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
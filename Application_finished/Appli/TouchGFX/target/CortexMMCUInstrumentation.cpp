@@ -1,10 +1,95 @@
 #include <CortexMMCUInstrumentation.hpp>
 #include <touchgfx/hal/HAL.hpp>
+#include <string.h>
+
+#include <stm32h7rsxx_hal.h>
+
+namespace
+{
+// Memory-mapped regions of the STM32H7S78-DK
+const uintptr_t PSRAM_START = 0x90000000U;
+const uintptr_t PSRAM_END = 0x92000000U;
+const uintptr_t FLASH_START = 0x70000000U;
+const uintptr_t FLASH_END = 0x78000000U;
+const uintptr_t AXI_SRAM_START = 0x24000000U;
+const uintptr_t AXI_SRAM_END = 0x24072000U;
+
+bool interruptOf(IRQn_Type irqn, touchgfx::CortexMMCUInstrumentation::Interrupt& irq)
+{
+    switch (irqn)
+    {
+    case LTDC_IRQn:
+        irq = touchgfx::CortexMMCUInstrumentation::INTERRUPT_LTDC;
+        return true;
+    case GPU2D_IRQn:
+        irq = touchgfx::CortexMMCUInstrumentation::INTERRUPT_GPU2D;
+        return true;
+    case DMA2D_IRQn:
+        irq = touchgfx::CortexMMCUInstrumentation::INTERRUPT_DMA2D;
+        return true;
+    case JPEG_IRQn:
+        irq = touchgfx::CortexMMCUInstrumentation::INTERRUPT_JPEG;
+        return true;
+    default:
+        return false;
+    }
+}
+}
+
+extern "C"
+{
+    void CortexMMCUInstrumentation_InterruptEntered(IRQn_Type irqn)
+    {
+        touchgfx::CortexMMCUInstrumentation::Interrupt irq;
+        if (interruptOf(irqn, irq))
+        {
+            touchgfx::CortexMMCUInstrumentation::interruptEntered(irq);
+        }
+    }
+
+    void CortexMMCUInstrumentation_InterruptExited(IRQn_Type irqn)
+    {
+        touchgfx::CortexMMCUInstrumentation::Interrupt irq;
+        if (interruptOf(irqn, irq))
+        {
+            touchgfx::CortexMMCUInstrumentation::interruptExited(irq);
+        }
+    }
+
+    void CortexMMCUInstrumentation_TaskWoken(IRQn_Type irqn, uint32_t waitCycles)
+    {
+        touchgfx::CortexMMCUInstrumentation::Interrupt irq;
+        if (interruptOf(irqn, irq))
+        {
+            touchgfx::CortexMMCUInstrumentation::taskWoken(irq, waitCycles);
+        }
+    }
+}
 
 namespace touchgfx
 {
+CortexMMCUInstrumentation* CortexMMCUInstrumentation::instance = 0;
+
+CortexMMCUInstrumentation::CortexMMCUInstrumentation()
+    : frameStartCycles(0), lineCycles(0)
+{
+    resetMemoryTraffic();
+    resetInterruptTiming();
+    memset(frameRead, 0, sizeof(frameRead));
+    memset(frameWritten, 0, sizeof(frameWritten));
+    memset(entryCycles, 0, sizeof(entryCycles));
+    for (int irq = 0; irq < NUMBER_OF_INTERRUPTS; irq++)
+    {
+        exitCycles[irq] = 0;
+    }
+    memset(lineStartCycles, 0, sizeof(lineStartCycles));
+    memset(lineStarts, 0xFF, sizeof(lineStarts));
+}
+
 void CortexMMCUInstrumentation::init()
 {
+    instance = this;
+
     // See: http://infocenter.arm.com/help/index.jsp?topic=/com.arm.doc.ddi0337e/CEGHJDCF.html
     //
     //      [24]  Read/write  TRCENA  This bit must be set to 1 to enable use of the trace and debug blocks:
@@ -45,4 +130,189 @@ void CortexMMCUInstrumentation::setMCUActive(bool active)
         cc_in = getCPUCycles();
     }
 }
+
+void CortexMMCUInstrumentation::frameStarted()
+{
+    memset(frameRead, 0, sizeof(frameRead));
+    memset(frameWritten, 0, sizeof(frameWritten));
+    frameStartCycles = getCPUCycles();
+}
+
+void CortexMMCUInstrumentation::frameEnded()
+{
+    uint32_t frameBytes = 0;
+    for (int region = 0; region < NUMBER_OF_REGIONS; region++)
+    {
+        traffic.bytesRead[region] += frameRead[region];
+        traffic.bytesWritten[region] += frameWritten[region];
+        frameBytes += frameRead[region] + frameWritten[region];
+    }
+    if (frameBytes > traffic.peakFrameBytes)
+    {
+        traffic.peakFrameBytes = frameBytes;
+    }
+    traffic.renderCycles += getCPUCycles() - frameStartCycles;
+    traffic.frames++;
+}
+
+void CortexMMCUInstrumentation::resetMemoryTraffic()
+{
+    memset(&traffic, 0, sizeof(traffic));
+}
+
+void CortexMMCUInstrumentation::resetInterruptTiming()
+{
+    memset(timing, 0, sizeof(timing));
+}
+
+void CortexMMCUInstrumentation::entered(Interrupt irq)
+{
+    const uint32_t now = DWT->CYCCNT;
+    entryCycles[irq] = now;
+    timing[irq].count++;
+    if (irq == INTERRUPT_LTDC)
+    {
+        const uint32_t cycles = ltdcLatencyCycles(now);
+        if (cycles != 0xFFFFFFFFU)
+        {
+            account(timing[irq].latency, timing[irq].maxLatencyUs, cycles);
+        }
+    }
+}
+
+void CortexMMCUInstrumentation::exited(Interrupt irq)
+{
+    const uint32_t now = DWT->CYCCNT;
+    account(timing[irq].duration, timing[irq].maxDurationUs, now - entryCycles[irq]);
+    exitCycles[irq] = now;
+}
+
+void CortexMMCUInstrumentation::woken(Interrupt irq, uint32_t waitCycles)
+{
+    const uint32_t now = DWT->CYCCNT;
+    const uint32_t exit = exitCycles[irq];
+    // Handled before the wait, the task did not block on it
+    if ((int32_t)(exit - waitCycles) <= 0)
+    {
+        return;
+    }
+    account(timing[irq].wake, timing[irq].maxWakeUs, now - exit);
+}
+
+uint32_t CortexMMCUInstrumentation::ltdcLatencyCycles(uint32_t now)
+{
+    // Read before the handler programs the next line
+    const uint32_t line = LTDC->LIPCR & 0x7FFU;
+    const uint32_t position = LTDC->CPSR;
+    const uint32_t row = position & 0xFFFFU;
+    const uint32_t column = position >> 16;
+    const uint32_t lines = (LTDC->TWCR & 0x7FFU) + 1;
+    const uint32_t width = ((LTDC->TWCR >> 16) & 0xFFFU) + 1;
+
+    // The line before the active area swaps the framebuffers, see HAL_LTDC_LineEventCallback()
+    const uint32_t activeLine = (LTDC->BPCR & 0x7FFU) - 1;
+    if (line == activeLine && row > activeLine + 1)
+    {
+        timing[INTERRUPT_LTDC].late++;
+    }
+
+    // The same line a frame later gives the line period
+    int slot = 0;
+    for (int i = 0; i < 3; i++)
+    {
+        if (lineStarts[i] == line)
+        {
+            slot = i;
+            break;
+        }
+        if (now - lineStartCycles[i] > now - lineStartCycles[slot])
+        {
+            slot = i;
+        }
+    }
+    if (lineStarts[slot] == line)
+    {
+        // Refreshes missed while the line was not programmed would lengthen the line
+        const uint32_t period = (now - lineStartCycles[slot]) / lines;
+        if (lineCycles == 0 || period < lineCycles * 2)
+        {
+            lineCycles = period;
+        }
+    }
+    lineStarts[slot] = (uint16_t)line;
+    lineStartCycles[slot] = now;
+
+    if (lineCycles == 0)
+    {
+        return 0xFFFFFFFFU;
+    }
+    const uint32_t rowsLate = (row + lines - line) % lines;
+    return rowsLate * lineCycles + column * lineCycles / width;
+}
+
+void CortexMMCUInstrumentation::account(uint32_t* histogram, uint32_t& maxUs, uint32_t cycles)
+{
+    const uint32_t us = cycles / (SystemCoreClock / 1000000U);
+    uint32_t bucket = (us == 0) ? 0 : 32 - __CLZ(us);
+    if (bucket >= TOUCHGFX_INTERRUPT_TIMING_BUCKETS)
+    {
+        bucket = TOUCHGFX_INTERRUPT_TIMING_BUCKETS - 1;
+    }
+    histogram[bucket]++;
+    if (us > maxUs)
+    {
+        maxUs = us;
+    }
+}
+
+CortexMMCUInstrumentation::MemoryRegion CortexMMCUInstrumentation::regionOf(const void* address)
+{
+    const uintptr_t a = (uintptr_t)address;
+    if (a >= PSRAM_START && a < PSRAM_END)
+    {
+        return REGION_PSRAM;
+    }
+    if (a >= FLASH_START && a < FLASH_END)
+    {
+        return REGION_FLASH;
+    }
+    if (a >= AXI_SRAM_START && a < AXI_SRAM_END)
+    {
+        return REGION_AXI_SRAM;
+    }
+    return REGION_OTHER;
+}
+
+uint32_t CortexMMCUInstrumentation::pixelBytes(Bitmap::BitmapFormat format, uint32_t pixels)
+{
+    uint32_t bits;
+    switch (format)
+    {
+    case Bitmap::BW:
+    case Bitmap::BW_RLE:
+        bits = 1;
+        break;
+    case Bitmap::GRAY2:
+        bits = 2;
+        break;
+    case Bitmap::GRAY4:
+    case Bitmap::A4:
+        bits = 4;
+        break;
+    case Bitmap::RGB565:
+        bits = 16;
+        break;
+    case Bitmap::RGB888:
+        bits = 24;
+        break;
+    case Bitmap::ARGB8888:
+        bits = 32;
+        break;
+    default:
+        // The 8 bpp formats, and the indexes of L8 and compressed formats
+        bits = 8;
+        break;
+    }
+    return (pixels * bits + 7) / 8;
+}
 }
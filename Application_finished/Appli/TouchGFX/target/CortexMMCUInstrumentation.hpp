@@ -2,8 +2,29 @@
 #define CORTEXMMCUINSTRUMENTATION_HPP
 
 #include <platform/core/MCUInstrumentation.hpp>
+#include <touchgfx/Bitmap.hpp>
 #include <stdint.h>
 
+/**
+ * Set to 0 to not estimate the memory traffic of rendering.
+ */
+#ifndef TOUCHGFX_MEMORY_TRAFFIC
+#define TOUCHGFX_MEMORY_TRAFFIC 1
+#endif
+
+/**
+ * Set to 0 to not time the LTDC, GPU2D, DMA2D and JPEG interrupts.
+ */
+#ifndef TOUCHGFX_INTERRUPT_TIMING
+#define TOUCHGFX_INTERRUPT_TIMING 1
+#endif
+
+/**
+ * Buckets of the interrupt timing histograms. Bucket n counts the times from 2^(n-1) up to
+ * 2^n microseconds, the first those under 1 us and the last the longer ones.
+ */
+#define TOUCHGFX_INTERRUPT_TIMING_BUCKETS 12
+
 namespace touchgfx
 {
 /**
@@ -20,6 +41,51 @@ namespace touchgfx
 class CortexMMCUInstrumentation : public MCUInstrumentation
 {
 public:
+    /** Memory regions that traffic is counted for. */
+    enum MemoryRegion
+    {
+        REGION_PSRAM,     ///< XSPI1 PSRAM, framebuffers and video buffers
+        REGION_FLASH,     ///< XSPI2 memory-mapped flash, bitmaps and fonts
+        REGION_AXI_SRAM,  ///< Internal AXI SRAM
+        REGION_OTHER,     ///< Any other memory
+        NUMBER_OF_REGIONS
+    };
+
+    /** Estimated bytes read and written by rendering since the last reset. */
+    struct MemoryTraffic
+    {
+        uint64_t bytesRead[NUMBER_OF_REGIONS];
+        uint64_t bytesWritten[NUMBER_OF_REGIONS];
+        uint64_t renderCycles;   ///< CPU cycles from the start to the end of the frames
+        uint32_t frames;         ///< Frames rendered
+        uint32_t peakFrameBytes; ///< Most bytes moved by a single frame
+    };
+
+    /** Interrupts that are timed. */
+    enum Interrupt
+    {
+        INTERRUPT_LTDC,  ///< Line interrupt, vertical synchronization and the swap
+        INTERRUPT_GPU2D, ///< Command list completion
+        INTERRUPT_DMA2D, ///< ChromART transfer completion
+        INTERRUPT_JPEG,  ///< Hardware JPEG codec
+        NUMBER_OF_INTERRUPTS
+    };
+
+    /** Timing of one interrupt since the last reset, histograms as TOUCHGFX_INTERRUPT_TIMING_BUCKETS. */
+    struct InterruptTiming
+    {
+        uint32_t count;                                        ///< Interrupts handled
+        uint32_t late;                                         ///< LTDC only, swaps entered with the active area already scanned out
+        uint32_t maxLatencyUs;
+        uint32_t maxDurationUs;
+        uint32_t maxWakeUs;
+        uint32_t latency[TOUCHGFX_INTERRUPT_TIMING_BUCKETS];  ///< LTDC only, from the line programmed to the handler
+        uint32_t duration[TOUCHGFX_INTERRUPT_TIMING_BUCKETS]; ///< From the entry to the exit of the handler
+        uint32_t wake[TOUCHGFX_INTERRUPT_TIMING_BUCKETS];     ///< LTDC and GPU2D, from the handler to the task it woke
+    };
+
+    CortexMMCUInstrumentation();
+
     /**
      * @fn virtual void CortexMMCUInstrumentation::init();
      *
@@ -68,6 +134,236 @@ public:
      * @param active If true, MCU is registered as being active, inactive otherwise.
      */
     virtual void setMCUActive(bool active);
+
+    /**
+     * @fn void CortexMMCUInstrumentation::frameStarted();
+     *
+     * @brief Starts counting the memory traffic of a frame.
+     */
+    void frameStarted();
+
+    /**
+     * @fn void CortexMMCUInstrumentation::frameEnded();
+     *
+     * @brief Adds the memory traffic counted since frameStarted() to the totals.
+     */
+    void frameEnded();
+
+    /**
+     * @fn const MemoryTraffic& CortexMMCUInstrumentation::getMemoryTraffic() const;
+     *
+     * @brief Gets the memory traffic of the frames since the last call to resetMemoryTraffic().
+     *
+     * @return The memory traffic.
+     */
+    const MemoryTraffic& getMemoryTraffic() const
+    {
+        return traffic;
+    }
+
+    /**
+     * @fn uint32_t CortexMMCUInstrumentation::getFrameBytes(MemoryRegion region) const;
+     *
+     * @brief Gets the bytes read and written in a region by the last frame, from its end
+     *        to the start of the next frame.
+     *
+     * @param region The memory region.
+     *
+     * @return The number of bytes, 0 without TOUCHGFX_MEMORY_TRAFFIC.
+     */
+    uint32_t getFrameBytes(MemoryRegion region) const
+    {
+        return frameRead[region] + frameWritten[region];
+    }
+
+    /**
+     * @fn void CortexMMCUInstrumentation::resetMemoryTraffic();
+     *
+     * @brief Resets the memory traffic totals.
+     */
+    void resetMemoryTraffic();
+
+    /**
+     * @fn static MemoryRegion CortexMMCUInstrumentation::regionOf(const void* address);
+     *
+     * @brief Gets the memory region of an address.
+     *
+     * @param address The address.
+     *
+     * @return The memory region.
+     */
+    static MemoryRegion regionOf(const void* address);
+
+    /**
+     * @fn static uint32_t CortexMMCUInstrumentation::pixelBytes(Bitmap::BitmapFormat format, uint32_t pixels);
+     *
+     * @brief Gets the number of bytes that a number of pixels in a format occupy.
+     *
+     * @param format The pixel format.
+     * @param pixels The number of pixels.
+     *
+     * @return The number of bytes, rounded up.
+     */
+    static uint32_t pixelBytes(Bitmap::BitmapFormat format, uint32_t pixels);
+
+    /**
+     * @fn static void CortexMMCUInstrumentation::countRead(const void* address, uint32_t bytes);
+     *
+     * @brief Counts bytes read from an address by a draw operation.
+     *
+     *        Called by the LCD and the DMA when an operation is issued, so the counts are an
+     *        estimate from the size of the operation and not a measurement of the bus.
+     *
+     * @param address Start of the data read.
+     * @param bytes   Number of bytes read.
+     */
+    static void countRead(const void* address, uint32_t bytes)
+    {
+#if TOUCHGFX_MEMORY_TRAFFIC
+        if (instance != 0)
+        {
+            instance->frameRead[regionOf(address)] += bytes;
+        }
+#else
+        (void)address;
+        (void)bytes;
+#endif
+    }
+
+    /**
+     * @fn static void CortexMMCUInstrumentation::countWrite(const void* address, uint32_t bytes);
+     *
+     * @brief Counts bytes written to an address by a draw operation.
+     *
+     * @param address Start of the data written.
+     * @param bytes   Number of bytes written.
+     *
+     * @see countRead
+     */
+    static void countWrite(const void* address, uint32_t bytes)
+    {
+#if TOUCHGFX_MEMORY_TRAFFIC
+        if (instance != 0)
+        {
+            instance->frameWritten[regionOf(address)] += bytes;
+        }
+#else
+        (void)address;
+        (void)bytes;
+#endif
+    }
+
+    /**
+     * @fn const InterruptTiming& CortexMMCUInstrumentation::getInterruptTiming(Interrupt irq) const;
+     *
+     * @brief Gets the timing of an interrupt since the last call to resetInterruptTiming().
+     *
+     *        The durations are measured with the DWT cycle counter from the entry to the
+     *        exit of the interrupt handler, including the handlers of higher priority that
+     *        preempted it. The latency of an interrupt is only known for LTDC, from the
+     *        position of the scanout when the handler is entered: the lines and pixels
+     *        since the line programmed, timed with the line period measured. For GPU2D the
+     *        completion waits for the task blocked in nema_wait_irq(), and for LTDC for the
+     *        TouchGFX task blocked in OSWrappers::waitForVSync(), which is measured from the
+     *        exit of the handler to the task running again.
+     *
+     * @param irq The interrupt.
+     *
+     * @return The timing.
+     */
+    const InterruptTiming& getInterruptTiming(Interrupt irq) const
+    {
+        return timing[irq];
+    }
+
+    /**
+     * @fn void CortexMMCUInstrumentation::resetInterruptTiming();
+     *
+     * @brief Resets the timing of all interrupts.
+     */
+    void resetInterruptTiming();
+
+    /**
+     * @fn static void CortexMMCUInstrumentation::interruptEntered(Interrupt irq);
+     *
+     * @brief Stamps the entry of an interrupt handler. Called first by the handler.
+     *
+     * @param irq The interrupt.
+     */
+    static void interruptEntered(Interrupt irq)
+    {
+#if TOUCHGFX_INTERRUPT_TIMING
+        if (instance != 0)
+        {
+            instance->entered(irq);
+        }
+#else
+        (void)irq;
+#endif
+    }
+
+    /**
+     * @fn static void CortexMMCUInstrumentation::interruptExited(Interrupt irq);
+     *
+     * @brief Accounts the duration of an interrupt handler. Called last by the handler.
+     *
+     * @param irq The interrupt.
+     */
+    static void interruptExited(Interrupt irq)
+    {
+#if TOUCHGFX_INTERRUPT_TIMING
+        if (instance != 0)
+        {
+            instance->exited(irq);
+        }
+#else
+        (void)irq;
+#endif
+    }
+
+    /**
+     * @fn static void CortexMMCUInstrumentation::taskWoken(Interrupt irq, uint32_t waitCycles);
+     *
+     * @brief Accounts the time a task took to run after an interrupt woke it. Called by the
+     *        task when its wait returns.
+     *
+     * @param irq        The interrupt.
+     * @param waitCycles Cycle counter when the task started waiting. A handler that
+     *                   exited before did not wake the task, nothing is accounted.
+     */
+    static void taskWoken(Interrupt irq, uint32_t waitCycles)
+    {
+#if TOUCHGFX_INTERRUPT_TIMING
+        if (instance != 0)
+        {
+            instance->woken(irq, waitCycles);
+        }
+#else
+        (void)irq;
+        (void)waitCycles;
+#endif
+    }
+
+private:
+    void entered(Interrupt irq);
+    void exited(Interrupt irq);
+    void woken(Interrupt irq, uint32_t waitCycles);
+    uint32_t ltdcLatencyCycles(uint32_t now);
+
+    static void account(uint32_t* histogram, uint32_t& maxUs, uint32_t cycles);
+
+    MemoryTraffic traffic;
+    uint32_t frameRead[NUMBER_OF_REGIONS];
+    uint32_t frameWritten[NUMBER_OF_REGIONS];
+    uint32_t frameStartCycles;
+    InterruptTiming timing[NUMBER_OF_INTERRUPTS];
+    uint32_t entryCycles[NUMBER_OF_INTERRUPTS];         ///< Cycle counter at the entry of the handler running
+    volatile uint32_t exitCycles[NUMBER_OF_INTERRUPTS]; ///< Cycle counter at the last exit of the handler
+    uint32_t lineStartCycles[3];                        ///< Entries of LTDC per line programmed, a frame apart
+    uint16_t lineStarts[3];                             ///< Lines of lineStartCycles
+    uint32_t lineCycles;                                ///< Measured time of one display line
+
+    static CortexMMCUInstrumentation* instance;
 };
 } // namespace touchgfx
 
@@ -0,0 +1,227 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : DCacheMaintenance.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include <DCacheMaintenance.hpp>
+
+/* USER CODE BEGIN DCacheMaintenance.cpp */
+#include <nema_hal_ext.h>
+#include <string.h>
+
+#include "stm32h7rsxx.h"
+
+namespace
+{
+const uintptr_t LINE_SIZE = 32;
+}
+
+namespace touchgfx
+{
+DCacheMaintenance::Stats DCacheMaintenance::stats;
+DCacheMaintenance::Region DCacheMaintenance::regions[MAX_REGIONS];
+uint32_t DCacheMaintenance::regionCount = 0;
+volatile bool DCacheMaintenance::regionsRead = false;
+
+void DCacheMaintenance::readRegions()
+{
+    const uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    uint32_t count = 0;
+    if ((MPU->CTRL & MPU_CTRL_ENABLE_Msk) != 0)
+    {
+        count = (MPU->TYPE & MPU_TYPE_DREGION_Msk) >> MPU_TYPE_DREGION_Pos;
+        if (count > MAX_REGIONS)
+        {
+            count = MAX_REGIONS;
+        }
+        for (uint32_t region = 0; region < count; region++)
+        {
+            MPU->RNR = region;
+            regions[region].rbar = MPU->RBAR;
+            regions[region].rasr = MPU->RASR;
+        }
+    }
+    regionCount = count;
+    regionsRead = true;
+    __set_PRIMASK(primask);
+}
+
+bool DCacheMaintenance::isCacheable(const void* data, uint32_t size)
+{
+    return getPolicy(data, size) != NOT_CACHED;
+}
+
+DCacheMaintenance::Policy DCacheMaintenance::getPolicy(const void* data, uint32_t size)
+{
+    if ((SCB->CCR & SCB_CCR_DC_Msk) == 0 || size == 0)
+    {
+        return NOT_CACHED;
+    }
+    if (!regionsRead)
+    {
+        readRegions();
+    }
+    const uintptr_t first = (uintptr_t)data;
+    const Policy head = getPolicy(first);
+    const Policy tail = getPolicy(first + size - 1);
+    return (head > tail) ? head : tail;
+}
+
+void DCacheMaintenance::clean(const void* data, uint32_t size)
+{
+    // GPU2D may have the previous content in its instruction cache
+    nema_hal_icache_written(data, size);
+    // Write-through lines are never dirty
+    if (!needsMaintenance(data, size, WRITE_BACK))
+    {
+        return;
+    }
+    if (size > TOUCHGFX_DCACHE_BY_ADDR_MAX_BYTES)
+    {
+        SCB_CleanDCache();
+        return;
+    }
+    const uintptr_t start = (uintptr_t)data & ~(LINE_SIZE - 1);
+    SCB_CleanDCache_by_Addr((uint32_t*)start, (int32_t)((uintptr_t)data + size - start));
+}
+
+void DCacheMaintenance::cleanInvalidate(const void* data, uint32_t size)
+{
+    nema_hal_icache_written(data, size);
+    if (!needsMaintenance(data, size, WRITE_THROUGH))
+    {
+        return;
+    }
+    if (size > TOUCHGFX_DCACHE_BY_ADDR_MAX_BYTES)
+    {
+        SCB_CleanInvalidateDCache();
+        return;
+    }
+    const uintptr_t start = (uintptr_t)data & ~(LINE_SIZE - 1);
+    SCB_CleanInvalidateDCache_by_Addr((uint32_t*)start, (int32_t)((uintptr_t)data + size - start));
+}
+
+void DCacheMaintenance::invalidate(const void* data, uint32_t size)
+{
+    if (!needsMaintenance(data, size, WRITE_THROUGH))
+    {
+        return;
+    }
+    if (size > TOUCHGFX_DCACHE_BY_ADDR_MAX_BYTES)
+    {
+        // Invalidating the whole cache would drop data the CPU has not written back
+        SCB_CleanInvalidateDCache();
+        return;
+    }
+    const uintptr_t first = (uintptr_t)data;
+    const uintptr_t end = first + size;
+    uintptr_t start = first & ~(LINE_SIZE - 1);
+    uintptr_t stop = (end + LINE_SIZE - 1) & ~(LINE_SIZE - 1);
+    if (start != first)
+    {
+        SCB_CleanInvalidateDCache_by_Addr((uint32_t*)start, (int32_t)LINE_SIZE);
+        start += LINE_SIZE;
+    }
+    if (stop != end && stop > start)
+    {
+        stop -= LINE_SIZE;
+        SCB_CleanInvalidateDCache_by_Addr((uint32_t*)stop, (int32_t)LINE_SIZE);
+    }
+    if (stop > start)
+    {
+        SCB_InvalidateDCache_by_Addr((uint32_t*)start, (int32_t)(stop - start));
+    }
+}
+
+void DCacheMaintenance::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+bool DCacheMaintenance::needsMaintenance(const void* data, uint32_t size, Policy required)
+{
+    if (getPolicy(data, size) < required)
+    {
+        stats.skipped++;
+        return false;
+    }
+    if (size > TOUCHGFX_DCACHE_BY_ADDR_MAX_BYTES)
+    {
+        stats.wholeCache++;
+    }
+    else
+    {
+        stats.byAddress++;
+        stats.lines += (uint32_t)((((uintptr_t)data & (LINE_SIZE - 1)) + size + LINE_SIZE - 1) / LINE_SIZE);
+    }
+    return true;
+}
+
+DCacheMaintenance::Policy DCacheMaintenance::getPolicy(uintptr_t address)
+{
+    // The highest numbered region containing the address sets its attributes. None were
+    // read if the MPU is disabled
+    for (uint32_t region = regionCount; region-- > 0;)
+    {
+        const uint32_t rasr = regions[region].rasr;
+        if ((rasr & MPU_RASR_ENABLE_Msk) == 0)
+        {
+            continue;
+        }
+        const uint32_t sizeBits = ((rasr & MPU_RASR_SIZE_Msk) >> MPU_RASR_SIZE_Pos) + 1;
+        const uint32_t mask = (sizeBits >= 32) ? 0xFFFFFFFFU : (1U << sizeBits) - 1U;
+        const uint32_t base = regions[region].rbar & MPU_RBAR_ADDR_Msk & ~mask;
+        const uint32_t offset = (uint32_t)address - base;
+        if (((uint32_t)address & ~mask) != base)
+        {
+            continue;
+        }
+        // Regions of 256 bytes and more have eight subregions that can be disabled
+        if (sizeBits >= 8 && ((rasr >> MPU_RASR_SRD_Pos) & (1U << (offset >> (sizeBits - 3)))) != 0)
+        {
+            continue;
+        }
+        const uint32_t tex = (rasr & MPU_RASR_TEX_Msk) >> MPU_RASR_TEX_Pos;
+        const bool c = (rasr & MPU_RASR_C_Msk) != 0;
+        const bool b = (rasr & MPU_RASR_B_Msk) != 0;
+        if ((tex & 4U) != 0)
+        {
+            // Cache policies for inner memory are in C and B: 01 and 11 write-back, 10
+            // write-through
+            return b ? WRITE_BACK : (c ? WRITE_THROUGH : NOT_CACHED);
+        }
+        if (!c)
+        {
+            // Normal non-cacheable memory is TEX 1 without C, device memory has no C either
+            return NOT_CACHED;
+        }
+        // TEX 0 C 1 is write-through without B, TEX 0 and 1 are write-back with both
+        return (tex == 0 && !b) ? WRITE_THROUGH : WRITE_BACK;
+    }
+    // The default memory map caches code, SRAM and external RAM, write-through from
+    // 0x80000000
+    if (address < 0x40000000U || (address >= 0x60000000U && address < 0x80000000U))
+    {
+        return WRITE_BACK;
+    }
+    return (address >= 0x80000000U && address < 0xA0000000U) ? WRITE_THROUGH : NOT_CACHED;
+}
+} // namespace touchgfx
+
+/* USER CODE END DCacheMaintenance.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,189 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : DCacheMaintenance.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef DCACHEMAINTENANCE_HPP
+#define DCACHEMAINTENANCE_HPP
+
+#include <stdint.h>
+
+/* USER CODE BEGIN DCacheMaintenance.hpp */
+
+/**
+ * Largest range, in bytes, maintained line by line. Larger ranges are maintained on the
+ * whole cache, which takes one operation per line of the 32 KB data cache.
+ */
+#ifndef TOUCHGFX_DCACHE_BY_ADDR_MAX_BYTES
+#define TOUCHGFX_DCACHE_BY_ADDR_MAX_BYTES (32 * 1024)
+#endif
+
+namespace touchgfx
+{
+/**
+ * @class DCacheMaintenance
+ *
+ * @brief Data cache maintenance scoped to the memory DMA2D or GPU2D accesses.
+ *
+ *        The generated HAL cleans and invalidates the whole data cache whenever rendering
+ *        switches between the CPU and DMA2D, which evicts unrelated data and costs a pass
+ *        over every line of the cache. These functions only maintain the lines of the
+ *        given range, and nothing at all when the MPU makes the range non-cacheable, as the
+ *        generated MPU_Config() does for PSRAM on XSPI1 where the framebuffers are. Ranges
+ *        that are write-through, as PSRAM with the MPUProfile of that name, are never
+ *        dirty, so they are invalidated but not cleaned.
+ *
+ *        The MPU regions are read once, by readRegions(), as reading a region means selecting
+ *        it in the MPU first. The functions may then be called from any task or interrupt.
+ */
+class DCacheMaintenance
+{
+public:
+    /** How the MPU lets the data cache hold a range. */
+    enum Policy
+    {
+        NOT_CACHED,    ///< Non-cacheable or device memory, or the cache is disabled
+        WRITE_THROUGH, ///< Cached for reads, written to memory at once
+        WRITE_BACK     ///< Cached for reads and writes
+    };
+
+    /** Maintenance operations since the last reset. */
+    struct Stats
+    {
+        uint32_t skipped;    ///< Ranges not cached by the MPU, or cleaned and write-through
+        uint32_t byAddress;  ///< Ranges maintained line by line
+        uint32_t lines;      ///< Lines maintained line by line
+        uint32_t wholeCache; ///< Ranges too large, maintained on the whole cache
+    };
+
+    /**
+     * @fn static void DCacheMaintenance::readRegions();
+     *
+     * @brief Reads the MPU regions the policies of ranges are looked up in.
+     *
+     *        Called once the MPU is configured, and again by MPUProfile::apply() after it
+     *        changes a region. Read with interrupts disabled, so no task selects another
+     *        region in between. Called by the first lookup if it has not been.
+     */
+    static void readRegions();
+
+    /**
+     * @fn static bool DCacheMaintenance::isCacheable(const void* data, uint32_t size);
+     *
+     * @brief Tells if a range may be in the data cache.
+     *
+     * @param data The first byte of the range.
+     * @param size Number of bytes.
+     *
+     * @return true if the cache is enabled and the MPU makes the first or the last byte
+     *         cacheable.
+     */
+    static bool isCacheable(const void* data, uint32_t size);
+
+    /**
+     * @fn static Policy DCacheMaintenance::getPolicy(const void* data, uint32_t size);
+     *
+     * @brief Gets how the data cache may hold a range.
+     *
+     * @param data The first byte of the range.
+     * @param size Number of bytes.
+     *
+     * @return The policy of the first or the last byte that caches the most.
+     */
+    static Policy getPolicy(const void* data, uint32_t size);
+
+    /**
+     * @fn static void DCacheMaintenance::clean(const void* data, uint32_t size);
+     *
+     * @brief Writes a range written by the CPU back to memory, before DMA2D or GPU2D reads it.
+     *
+     *        The range is also reported to nema_hal_icache_written(), so GPU2D does not read
+     *        it from its instruction cache.
+     *
+     * @param data The first byte of the range.
+     * @param size Number of bytes.
+     */
+    static void clean(const void* data, uint32_t size);
+
+    /**
+     * @fn static void DCacheMaintenance::cleanInvalidate(const void* data, uint32_t size);
+     *
+     * @brief Writes a range back to memory and drops it from the cache, before DMA2D or
+     *        GPU2D writes it.
+     *
+     *        The range is also reported to nema_hal_icache_written().
+     *
+     * @param data The first byte of the range.
+     * @param size Number of bytes.
+     */
+    static void cleanInvalidate(const void* data, uint32_t size);
+
+    /**
+     * @fn static void DCacheMaintenance::invalidate(const void* data, uint32_t size);
+     *
+     * @brief Drops a range written by DMA2D or GPU2D from the cache, before the CPU reads it.
+     *
+     *        Lines only partly in the range are cleaned as well, so the data of the CPU
+     *        sharing them is not lost.
+     *
+     * @param data The first byte of the range.
+     * @param size Number of bytes.
+     */
+    static void invalidate(const void* data, uint32_t size);
+
+    /**
+     * @fn static const Stats& DCacheMaintenance::getStats();
+     *
+     * @brief Gets the maintenance statistics.
+     *
+     * @return The maintenance statistics.
+     */
+    static const Stats& getStats()
+    {
+        return stats;
+    }
+
+    /**
+     * @fn static void DCacheMaintenance::resetStats();
+     *
+     * @brief Resets the maintenance statistics.
+     */
+    static void resetStats();
+
+private:
+    static const uint32_t MAX_REGIONS = 16;
+
+    /** An MPU region as read by readRegions(). */
+    struct Region
+    {
+        uint32_t rbar; ///< Base address register
+        uint32_t rasr; ///< Attribute and size register
+    };
+
+    static Policy getPolicy(uintptr_t address);
+    static bool needsMaintenance(const void* data, uint32_t size, Policy required);
+
+    static Stats stats;
+    static Region regions[MAX_REGIONS];
+    static uint32_t regionCount;
+    static volatile bool regionsRead;
+};
+} // namespace touchgfx
+
+/* USER CODE END DCacheMaintenance.hpp */
+
+#endif // DCACHEMAINTENANCE_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,106 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : DynamicResolution.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include <DynamicResolution.hpp>
+
+/* USER CODE BEGIN DynamicResolution.cpp */
+#include <string.h>
+
+#include "stm32h7rsxx_hal.h"
+
+namespace
+{
+const uint8_t SCALE_PERCENT[touchgfx::DynamicResolution::NUMBER_OF_LEVELS] = { 100, 75, 50 };
+}
+
+namespace touchgfx
+{
+DynamicResolution::DynamicResolution()
+    : enabled(TOUCHGFX_DYNAMIC_RESOLUTION != 0), level(0), framesWithin(0), refreshPeriodUs(0), frameStartCycles(0)
+{
+    resetStats();
+}
+
+void DynamicResolution::setEnabled(bool enable)
+{
+    enabled = enable;
+    if (!enable)
+    {
+        level = 0;
+        framesWithin = 0;
+    }
+}
+
+uint8_t DynamicResolution::getScalePercent() const
+{
+    return SCALE_PERCENT[level];
+}
+
+void DynamicResolution::frameStarted()
+{
+    frameStartCycles = DWT->CYCCNT;
+}
+
+void DynamicResolution::frameEnded()
+{
+    const uint32_t frameUs = (DWT->CYCCNT - frameStartCycles) / (SystemCoreClock / 1000000U);
+    stats.frames[level]++;
+    if (frameUs > stats.longestUs)
+    {
+        stats.longestUs = frameUs;
+    }
+    if (!enabled || refreshPeriodUs == 0)
+    {
+        return;
+    }
+
+    const uint32_t budgetUs = refreshPeriodUs * TOUCHGFX_DYNAMIC_RESOLUTION_BUDGET_PERCENT / 100U;
+    if (frameUs > budgetUs)
+    {
+        stats.overBudget++;
+        framesWithin = 0;
+        if (level + 1 < NUMBER_OF_LEVELS)
+        {
+            level++;
+            stats.lowered++;
+        }
+    }
+    else if (frameUs < budgetUs / 2 && level > 0)
+    {
+        if (++framesWithin >= TOUCHGFX_DYNAMIC_RESOLUTION_RAISE_FRAMES)
+        {
+            framesWithin = 0;
+            level--;
+            stats.raised++;
+        }
+    }
+    else
+    {
+        framesWithin = 0;
+    }
+}
+
+void DynamicResolution::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+} // namespace touchgfx
+
+/* USER CODE END DynamicResolution.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,175 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : DynamicResolution.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef DYNAMICRESOLUTION_HPP
+#define DYNAMICRESOLUTION_HPP
+
+#include <stdint.h>
+
+/* USER CODE BEGIN DynamicResolution.hpp */
+
+/**
+ * Set to 0 to render heavy widgets at full resolution always, see DynamicResolution.
+ */
+#ifndef TOUCHGFX_DYNAMIC_RESOLUTION
+#define TOUCHGFX_DYNAMIC_RESOLUTION 1
+#endif
+
+/**
+ * Part of the refresh period, in percent, a frame may take before the resolution is
+ * lowered.
+ */
+#ifndef TOUCHGFX_DYNAMIC_RESOLUTION_BUDGET_PERCENT
+#define TOUCHGFX_DYNAMIC_RESOLUTION_BUDGET_PERCENT 90
+#endif
+
+/**
+ * Number of frames in a row well within the budget before the resolution is raised again.
+ */
+#ifndef TOUCHGFX_DYNAMIC_RESOLUTION_RAISE_FRAMES
+#define TOUCHGFX_DYNAMIC_RESOLUTION_RAISE_FRAMES 30
+#endif
+
+namespace touchgfx
+{
+/**
+ * @class DynamicResolution
+ *
+ * @brief Chooses the resolution heavy widgets are rendered at from the time of the frames.
+ *
+ *        A frame longer than the refresh period is dropped, and an animation of large
+ *        texture mappers stutters. Widgets like DynamicResolutionTextureMapper render
+ *        into an offscreen bitmap at getScalePercent() of their size and have GPU2D scale
+ *        it up with one bilinear blit, which takes a quarter of the pixels at 50 percent.
+ *
+ *        The HAL times every frame, from the start of beginFrame(), which waits for GPU2D
+ *        to complete the previous frame, to the end of endFrame(). A frame over
+ *        TOUCHGFX_DYNAMIC_RESOLUTION_BUDGET_PERCENT of the refresh period lowers the scale
+ *        by a step for the next frame. The scale is raised a step once
+ *        TOUCHGFX_DYNAMIC_RESOLUTION_RAISE_FRAMES frames in a row took less than half of
+ *        the budget, as the frames at the higher scale take longer.
+ */
+class DynamicResolution
+{
+public:
+    /** Number of scales, from full resolution down. */
+    static const uint8_t NUMBER_OF_LEVELS = 3;
+
+    /** Frames rendered since the last reset. */
+    struct Stats
+    {
+        uint32_t frames[NUMBER_OF_LEVELS]; ///< Frames rendered at each scale
+        uint32_t lowered;                  ///< Times the scale was lowered
+        uint32_t raised;                   ///< Times the scale was raised
+        uint32_t overBudget;               ///< Frames over the budget
+        uint32_t longestUs;                ///< Longest frame
+    };
+
+    DynamicResolution();
+
+    /**
+     * @fn void DynamicResolution::setEnabled(bool enabled);
+     *
+     * @brief Enables or disables lowering the resolution. Disabling it restores full
+     *        resolution from the next frame.
+     *
+     * @param enabled true to lower the resolution of frames over budget.
+     */
+    void setEnabled(bool enabled);
+
+    /**
+     * @fn bool DynamicResolution::isEnabled() const;
+     *
+     * @brief Tells if the resolution is lowered under load.
+     *
+     * @return true if enabled.
+     */
+    bool isEnabled() const
+    {
+        return enabled;
+    }
+
+    /**
+     * @fn void DynamicResolution::setRefreshPeriod(uint32_t periodUs);
+     *
+     * @brief Sets the refresh period the budget is a part of. Called by the HAL with the
+     *        period measured by FramePacer.
+     *
+     * @param periodUs The refresh period in microseconds, 0 while unknown.
+     */
+    void setRefreshPeriod(uint32_t periodUs)
+    {
+        refreshPeriodUs = periodUs;
+    }
+
+    /**
+     * @fn uint8_t DynamicResolution::getScalePercent() const;
+     *
+     * @brief Gets the scale heavy widgets are rendered at in the current frame.
+     *
+     * @return 100, 75 or 50.
+     */
+    uint8_t getScalePercent() const;
+
+    /**
+     * @fn void DynamicResolution::frameStarted();
+     *
+     * @brief Starts timing a frame. Called by the HAL.
+     */
+    void frameStarted();
+
+    /**
+     * @fn void DynamicResolution::frameEnded();
+     *
+     * @brief Ends timing a frame and chooses the scale of the next. Called by the HAL.
+     */
+    void frameEnded();
+
+    /**
+     * @fn const Stats& DynamicResolution::getStats() const;
+     *
+     * @brief Gets the frames rendered since the last call to resetStats().
+     *
+     * @return The statistics.
+     */
+    const Stats& getStats() const
+    {
+        return stats;
+    }
+
+    /**
+     * @fn void DynamicResolution::resetStats();
+     *
+     * @brief Resets the statistics.
+     */
+    void resetStats();
+
+private:
+    bool enabled;
+    uint8_t level;            ///< Index of the scale, 0 for full resolution
+    uint16_t framesWithin;    ///< Frames in a row within half of the budget
+    uint32_t refreshPeriodUs;
+    uint32_t frameStartCycles;
+    Stats stats;
+};
+} // namespace touchgfx
+
+/* USER CODE END DynamicResolution.hpp */
+
+#endif // DYNAMICRESOLUTION_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
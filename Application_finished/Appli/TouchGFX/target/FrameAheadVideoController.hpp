@@ -0,0 +1,969 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : FrameAheadVideoController.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef FRAMEAHEADVIDEOCONTROLLER_HPP
+#define FRAMEAHEADVIDEOCONTROLLER_HPP
+
+#include <touchgfx/hal/VideoController.hpp>
+#include <touchgfx/widgets/VideoWidget.hpp>
+#include <STM32MJPEGDecoder.hpp>
+#include <VideoStreamScheduler.hpp>
+#include <TouchGFXHAL.hpp>
+
+#include <string.h>
+#include <stm32h7rsxx_hal.h>
+#include "rtos_pool.h"
+
+/* USER CODE BEGIN FrameAheadVideoController.hpp */
+
+/**
+ * Number of decode buffers per video stream. One buffer is shown by the VideoWidget, one is
+ * being decoded into and the rest hold frames decoded ahead of time. Set to 0 to decode
+ * directly into the framebuffer with ClockedFrameBufferVideoController instead.
+ */
+#ifndef VIDEO_FRAME_AHEAD_BUFFERS
+#define VIDEO_FRAME_AHEAD_BUFFERS 3
+#endif
+
+/**
+ * Number of VideoWidgets that can play at the same time, each with its own decoder and
+ * VIDEO_FRAME_AHEAD_BUFFERS decode buffers.
+ */
+#ifndef VIDEO_STREAMS
+#define VIDEO_STREAMS 1
+#endif
+
+/**
+ * Set to 1 to keep the decoded frames in UYVY, converted to RGB by GPU2D as they are drawn,
+ * instead of converting them to RGB565 with DMA2D after decoding. Leaves DMA2D to the UI.
+ */
+#ifndef VIDEO_GPU2D_YUV
+#define VIDEO_GPU2D_YUV 0
+#endif
+
+/**
+ * Set to 1 to scan out the frames of the first video stream on LTDC layer 1, below the
+ * framebuffer, see BackgroundLayer. Needs TOUCHGFX_BACKGROUND_LAYER.
+ */
+#ifndef VIDEO_LTDC_LAYER
+#define VIDEO_LTDC_LAYER 0
+#endif
+
+#if VIDEO_LTDC_LAYER && VIDEO_GPU2D_YUV
+#error "VIDEO_LTDC_LAYER: LTDC cannot scan out UYVY frames"
+#endif
+
+/**
+ * @class FrameAheadVideoController
+ *
+ * @brief VideoController that decodes frames ahead of time in a dedicated decoder task.
+ *
+ *        Each stream owns no_buffers decode buffers. The decoder task, see
+ *        decoderTaskEntry(), decodes the following frames into the free buffers while the UI
+ *        task renders, and the UI task only swaps the buffer shown by the VideoWidget when
+ *        the next frame is due. The UI task therefore never waits for the JPEG codec, and a
+ *        frame that took long to decode is covered by the frames decoded before it.
+ *
+ *        Unless a UI frame rate ratio is set with setFrameRate(), frames are shown at the
+ *        frame rate of the video itself, measured with HAL_GetTick(), so playback speed does
+ *        not depend on how often the UI redraws.
+ *
+ *        The streams share the JPEG codec one frame at a time. For every frame, the decoder
+ *        task picks the stream that first runs out of decoded frames, weighted by its
+ *        priority, see VideoStreamScheduler. A stream with a target frame rate below that of
+ *        its video skips the frames in between without decoding them.
+ *
+ *        With VIDEO_GPU2D_YUV, the frames are decoded to UYVY and drawn by draw() with GPU2D,
+ *        which converts them to RGB as it samples them.
+ *
+ *        With VIDEO_LTDC_LAYER, the frames of the first stream are shown by pointing LTDC
+ *        layer 1 at the shown buffer, with the framebuffer on layer 2. The VideoWidget fills
+ *        its area with the color key once, and is not invalidated for the following frames,
+ *        so the UI is only redrawn when it changes itself. The stream falls back to drawing
+ *        the frames when the layer is taken by a pinned bitmap, or the widget is hidden.
+ *
+ *        The decoder mutex is held by the decoder task for the duration of a decode, and is
+ *        only taken by the UI task when the movie or the widget is changed. The stream mutex
+ *        protects the buffer states and is only held briefly by either task.
+ *
+ * @tparam no_streams    Number of simultaneous video streams.
+ * @tparam width         Width of the decode buffers in pixels.
+ * @tparam height        Height of the decode buffers in pixels.
+ * @tparam stride        Stride of the decode buffers in bytes.
+ * @tparam output_format Pixel format of the decode buffers.
+ * @tparam no_buffers    Number of decode buffers per stream, at least two.
+ */
+template <uint32_t no_streams, uint32_t width, uint32_t height, uint32_t stride, touchgfx::Bitmap::BitmapFormat output_format, uint32_t no_buffers>
+class FrameAheadVideoController : public touchgfx::VideoController, public VideoStreamScheduler
+{
+public:
+    FrameAheadVideoController()
+        : VideoController(), bufferRGB(0), sizeBufferRGB(0), topBufferRGB(0),
+          allowSkipFrames(false), semDecode(0), mutexDecoder(0), mutexStreams(0)
+    {
+        assert((no_streams > 0) && "Video: Number of streams zero!");
+        assert((no_buffers > 1) && "Video: Frame-ahead decoding needs at least two buffers!");
+
+        memset(mjpegDecoders, 0, sizeof(mjpegDecoders));
+
+        // Initialize synchronization primitives
+        semDecode = RTOS_POOL_SemaphoreNew(1, 0, 0); // Binary semaphore
+        mutexDecoder = RTOS_POOL_MutexNew(0);
+        mutexStreams = RTOS_POOL_MutexNew(0);
+    }
+
+    virtual Handle registerVideoWidget(touchgfx::VideoWidget& widget)
+    {
+        // Running in UI thread
+
+        const uint32_t sizeOfOneDecodeBuffer = height * stride;
+
+        // Allocate all buffers for this stream, if possible
+        if (topBufferRGB + no_buffers * sizeOfOneDecodeBuffer > (bufferRGB + sizeBufferRGB))
+        {
+            assert(0 && "registerVideoWidget: Unable to allocate RGB buffers!");
+            return 0xFFFFFFFF;
+        }
+
+        MUTEX_LOCK(mutexStreams);
+        Handle handle = getFreeHandle();
+        Stream& stream = streams[handle];
+        for (uint32_t i = 0; i < no_buffers; i++)
+        {
+            stream.buffers[i].data = topBufferRGB;
+            topBufferRGB += sizeOfOneDecodeBuffer;
+        }
+        stream.widget = &widget;
+        stream.isActive = true;
+        MUTEX_UNLOCK(mutexStreams);
+
+        // Set Widget buffer format and address
+        widget.setVideoBufferFormat(output_format, width, height);
+        widget.setVideoBuffer((uint8_t*)0);
+
+        return handle;
+    }
+
+    virtual void unregisterVideoWidget(const Handle handle)
+    {
+        // Running in UI thread
+
+        assert(handle < no_streams);
+
+        // Wait for the decoder thread to finish writing the buffers of this stream
+        MUTEX_LOCK(mutexDecoder);
+        MUTEX_LOCK(mutexStreams);
+
+#if VIDEO_LTDC_LAYER
+        if (streams[handle].onLayer)
+        {
+            getBackgroundLayer().unpin();
+        }
+#endif
+        streams[handle].isActive = false;
+        streams[handle].widget = 0;
+
+        // If all handles are free, reset top pointer
+        bool oneIsActive = false;
+        for (uint32_t i = 0; i < no_streams; i++)
+        {
+            oneIsActive |= streams[i].isActive;
+        }
+        if (oneIsActive == false)
+        {
+            // Reset memory usage
+            topBufferRGB = bufferRGB;
+        }
+
+        MUTEX_UNLOCK(mutexStreams);
+        MUTEX_UNLOCK(mutexDecoder);
+    }
+
+    virtual uint32_t getCurrentFrameNumber(const Handle handle)
+    {
+        assert(handle < no_streams);
+        return streams[handle].frameNumber;
+    }
+
+    virtual void setFrameRate(const Handle handle, uint32_t ui_frames, uint32_t video_frames)
+    {
+        // Running in UI thread
+
+        assert(handle < no_streams);
+        Stream& stream = streams[handle];
+
+        resetCounters(stream);
+
+        // Save requested frame rate ratio
+        stream.frame_rate_ticks = ui_frames;
+        stream.frame_rate_video = video_frames;
+    }
+
+    virtual void setVideoData(const Handle handle, const uint8_t* movie, const uint32_t length)
+    {
+        // Running in UI thread
+
+        assert(handle < no_streams);
+        MUTEX_LOCK(mutexDecoder);
+        mjpegDecoders[handle]->setVideoData(movie, length);
+        resetStream(handle);
+        MUTEX_UNLOCK(mutexDecoder);
+    }
+
+    virtual void setVideoData(const Handle handle, touchgfx::VideoDataReader& reader)
+    {
+        // Running in UI thread
+
+        assert(handle < no_streams);
+        MUTEX_LOCK(mutexDecoder);
+        mjpegDecoders[handle]->setVideoData(reader);
+        resetStream(handle);
+        MUTEX_UNLOCK(mutexDecoder);
+    }
+
+    virtual void setCommand(const Handle handle, Command cmd, uint32_t param)
+    {
+        // Running in UI thread
+
+        assert(handle < no_streams);
+        Stream& stream = streams[handle];
+
+        MUTEX_LOCK(mutexStreams);
+        switch (cmd)
+        {
+        case PLAY:
+            // Cannot Play without movie
+            if (mjpegDecoders[handle]->hasVideo())
+            {
+                stream.isPlaying = true;
+                stream.isShowingOneFrame = false;
+                stream.endOfVideo = false; // The decoder has already wrapped to the first frame
+                resetCounters(stream);
+            }
+            break;
+        case PAUSE:
+            // Frames already decoded are kept for when playback resumes
+            stream.isPlaying = false;
+            stream.isShowingOneFrame = false;
+            break;
+        case SEEK:
+            seek(stream, param);
+            break;
+        case SHOW:
+            seek(stream, param);
+            stream.isShowingOneFrame = true;
+            break;
+        case STOP:
+            stream.isPlaying = false;
+            stream.isShowingOneFrame = false;
+            seek(stream, 1);
+            break;
+        case SET_REPEAT:
+            stream.repeat = (param > 0);
+            break;
+        }
+        MUTEX_UNLOCK(mutexStreams);
+
+        // Let the decoder start on the new position
+        SEM_POST(semDecode);
+    }
+
+    virtual bool updateFrame(const Handle handle, touchgfx::VideoWidget& widget)
+    {
+        // Running in UI thread
+
+        assert(handle < no_streams);
+        Stream& stream = streams[handle];
+
+        // Increase tickCount if playing
+        if (stream.isPlaying)
+        {
+            stream.tickCount += touchgfx::HAL::getInstance()->getLCDRefreshCount();
+        }
+
+#if VIDEO_LTDC_LAYER
+        if (stream.retired >= 0)
+        {
+            // Replaced on the layer in an earlier tick, so past a vertical blanking
+            MUTEX_LOCK(mutexStreams);
+            stream.buffers[stream.retired].state = Buffer::FREE;
+            stream.retired = -1;
+            MUTEX_UNLOCK(mutexStreams);
+            SEM_POST(semDecode);
+        }
+#endif
+
+        if (!stream.isShowingOneFrame && !(stream.isPlaying && decodeForNextTick(stream)))
+        {
+            return true;
+        }
+
+        MUTEX_LOCK(mutexStreams);
+        int32_t next = getNextReadyBuffer(stream);
+        // Drop frames decoded ahead to catch up with the video frame rate, but only if a later
+        // frame is ready to replace them
+        while (next >= 0 && stream.skip_frames > 0)
+        {
+            stream.buffers[next].state = Buffer::FREE;
+            const int32_t following = getNextReadyBuffer(stream);
+            if (following < 0)
+            {
+                stream.buffers[next].state = Buffer::READY;
+                break;
+            }
+            next = following;
+            stream.frameCount++;
+            stream.skip_frames--;
+            stream.stats.dropped++;
+        }
+        if (next >= 0)
+        {
+            // The buffer shown until now can be decoded into again
+            if (stream.shown >= 0)
+            {
+#if VIDEO_LTDC_LAYER
+                if (stream.onLayer)
+                {
+                    // LTDC scans it out until the new frame is loaded at vertical blanking
+                    stream.retired = stream.shown;
+                }
+                else
+#endif
+                {
+                    stream.buffers[stream.shown].state = Buffer::FREE;
+                }
+            }
+            stream.buffers[next].state = Buffer::SHOWN;
+            stream.shown = next;
+        }
+        MUTEX_UNLOCK(mutexStreams);
+
+        if (next < 0)
+        {
+            // Decoder is behind, show the frame as soon as it is ready
+            if (!stream.isWaiting)
+            {
+                stream.isWaiting = true;
+                stream.stats.late++;
+            }
+            return true;
+        }
+
+        const Buffer& buffer = stream.buffers[next];
+#if VIDEO_LTDC_LAYER
+        if (handle == 0 && showOnLayer(widget, buffer.data))
+        {
+            // The framebuffer only needs the color key, once
+            if (!stream.onLayer)
+            {
+                stream.onLayer = true;
+                widget.setVideoBuffer((uint8_t*)0);
+                widget.invalidate();
+            }
+        }
+        else
+#endif
+        {
+#if VIDEO_LTDC_LAYER
+            if (stream.onLayer)
+            {
+                stream.onLayer = false;
+                getBackgroundLayer().unpin();
+            }
+#endif
+#if !VIDEO_GPU2D_YUV
+            // A UYVY frame is drawn by draw(), the VideoWidget only draws RGB
+            widget.setVideoBuffer(buffer.data);
+#endif
+            widget.invalidate();
+        }
+        stream.frameNumber = buffer.frameNumber;
+        stream.frameCount++;
+        stream.skip_frames = 0;
+        stream.isShowingOneFrame = false;
+        stream.isWaiting = false;
+        stream.stats.shown++;
+        if (!buffer.hasMoreFrames && !stream.repeat)
+        {
+            stream.isPlaying = false;
+        }
+
+        // A buffer was released, let the decoder fill it
+        SEM_POST(semDecode);
+
+        return buffer.hasMoreFrames;
+    }
+
+    virtual void draw(const Handle handle, const touchgfx::Rect& invalidatedArea, const touchgfx::VideoWidget& widget)
+    {
+        // Running in UI thread
+
+        // The VideoWidget draws the shown buffer, which is never decoded into, unless UYVY
+#if VIDEO_LTDC_LAYER
+        if (handle == 0 && streams[0].onLayer)
+        {
+            // Lets layer 1 through
+            touchgfx::Rect area = invalidatedArea;
+            widget.translateRectToAbsolute(area);
+            touchgfx::HAL::lcd().fillRect(area, touchgfx::BackgroundLayer::getColorKey());
+        }
+#endif
+#if VIDEO_GPU2D_YUV
+        assert(handle < no_streams);
+        const Stream& stream = streams[handle];
+        if (stream.shown >= 0)
+        {
+            const touchgfx::Rect& absolute = widget.getAbsoluteRect();
+            touchgfx::Rect clip = invalidatedArea;
+            widget.translateRectToAbsolute(clip);
+            static_cast<TouchGFXHAL*>(touchgfx::HAL::getInstance())->drawUYVY(stream.buffers[stream.shown].data,
+                    MIN((uint32_t)absolute.width, width), MIN((uint32_t)absolute.height, height), stride, absolute.x, absolute.y, clip, 255);
+        }
+#endif
+    }
+
+    virtual void setRGBBuffer(uint8_t* buffer, size_t sizeOfBuffer)
+    {
+        // Running in UI thread / main
+
+        bufferRGB = buffer;
+        topBufferRGB = bufferRGB;
+        sizeBufferRGB = sizeOfBuffer;
+    }
+
+    void addDecoder(MJPEGDecoder& decoder, uint32_t index)
+    {
+        // Running in UI thread / main
+
+        assert(index < no_streams);
+        mjpegDecoders[index] = &decoder;
+    }
+
+    void endFrame()
+    {
+        // Running in UI thread
+
+        // Wake up the decoder thread in case a buffer became free during the frame
+        SEM_POST(semDecode);
+    }
+
+    void decoderTaskEntry()
+    {
+        // Running in Decoder thread!!
+
+        while (1)
+        {
+            // Wait for synchronisation signal from UI thread
+            SEM_WAIT(semDecode);
+
+            // Decode until all buffers of all playing streams are filled
+            while (decodeOneFrame())
+            {
+            }
+        }
+    }
+
+    virtual void getVideoInformation(const Handle handle, touchgfx::VideoInformation* data)
+    {
+        assert(handle < no_streams);
+        mjpegDecoders[handle]->getVideoInfo(data);
+    }
+
+    virtual bool getIsPlaying(const Handle handle)
+    {
+        assert(handle < no_streams);
+        return streams[handle].isPlaying;
+    }
+
+    virtual void setVideoFrameRateCompensation(bool allow)
+    {
+        allowSkipFrames = allow;
+    }
+
+    virtual void setTargetFrameRate(const touchgfx::VideoWidget& widget, uint32_t fps)
+    {
+        // Running in UI thread
+
+        MUTEX_LOCK(mutexStreams);
+        Stream* const stream = findStream(widget);
+        if (stream)
+        {
+            stream->msPerFrame = fps > 0 ? 1000 / fps : 0;
+            stream->videoTimeAhead = 0;
+            resetCounters(*stream);
+        }
+        MUTEX_UNLOCK(mutexStreams);
+    }
+
+    virtual void setPriority(const touchgfx::VideoWidget& widget, uint32_t priority)
+    {
+        // Running in UI thread
+
+        MUTEX_LOCK(mutexStreams);
+        Stream* const stream = findStream(widget);
+        if (stream)
+        {
+            stream->priority = priority > 0 ? priority : 1;
+        }
+        MUTEX_UNLOCK(mutexStreams);
+    }
+
+    virtual uint32_t getNumberOfStreams() const
+    {
+        return no_streams;
+    }
+
+    virtual bool getStats(uint32_t stream, Stats& stats) const
+    {
+        assert(stream < no_streams);
+        stats = streams[stream].stats;
+        return streams[stream].isActive;
+    }
+
+    virtual void resetStats()
+    {
+        MUTEX_LOCK(mutexStreams);
+        for (uint32_t i = 0; i < no_streams; i++)
+        {
+            memset(&streams[i].stats, 0, sizeof(Stats));
+        }
+        MUTEX_UNLOCK(mutexStreams);
+    }
+
+private:
+    class Buffer
+    {
+    public:
+        enum State
+        {
+            FREE,     // May be decoded into
+            DECODING, // Being decoded into by the decoder thread
+            READY,    // Holds a decoded frame not yet shown
+            SHOWN     // Shown by the VideoWidget
+        };
+
+        Buffer() : data(0), sequence(0), epoch(0), frameNumber(0), state(FREE), hasMoreFrames(false) {}
+        uint8_t* data;
+        uint32_t sequence;    // Decode order of the frame
+        uint32_t epoch;       // Stream epoch the frame was decoded in
+        uint32_t frameNumber; // Video frame number of the frame
+        State state;
+        bool hasMoreFrames;
+    };
+
+    class Stream
+    {
+    public:
+        Stream() : widget(0), frameNumber(0), frameCount(0), tickCount(0), frame_rate_video(0), frame_rate_ticks(0),
+            seek_to_frame(0), skip_frames(0), nextSequence(0), epoch(0), startTime(0), msBetweenFrames(0),
+            msPerFrame(0), videoTimeAhead(0), priority(1), shown(-1), retired(-1),
+            isActive(false), isPlaying(false), isShowingOneFrame(false), endOfVideo(false), repeat(true), isWaiting(false),
+            onLayer(false)
+        {
+            memset(&stats, 0, sizeof(stats));
+        }
+        const touchgfx::VideoWidget* widget;
+        uint32_t frameNumber;      // Video frame number shown
+        uint32_t frameCount;       // Video frame counter (for frame rate)
+        uint32_t tickCount;        // UI frames since play
+        uint32_t frame_rate_video; // Ratio of frames wanted counter
+        uint32_t frame_rate_ticks; // Ratio of frames wanted divider
+        uint32_t seek_to_frame;    // Requested next frame number
+        uint32_t skip_frames;      // Number of frames to skip to keep frame rate
+        uint32_t nextSequence;     // Sequence number of the next decoded frame
+        uint32_t epoch;            // Incremented when decoded frames become invalid
+        uint32_t startTime;        // HAL_GetTick() when the frame counters were reset
+        uint32_t msBetweenFrames;  // Frame interval of the video, 0 if unknown
+        uint32_t msPerFrame;       // Frame interval of the target frame rate, 0 if none
+        uint32_t videoTimeAhead;   // Video time in ms decoded past the last frame, decoder only
+        uint32_t priority;         // Divides the time left before the stream needs a frame
+        int32_t shown;             // Index of the buffer shown, or -1
+        int32_t retired;           // Index of the buffer shown on the layer until the next vertical blanking, or -1
+        bool isActive;
+        bool isPlaying;
+        bool isShowingOneFrame;
+        bool endOfVideo;           // Last frame decoded and not repeating
+        bool repeat;
+        bool isWaiting;            // A due frame was counted late and is not shown yet
+        bool onLayer;              // Shown on LTDC layer 1 instead of drawn by the widget
+        Stats stats;
+        Buffer buffers[no_buffers];
+    };
+
+    MJPEGDecoder* mjpegDecoders[no_streams];
+    Stream streams[no_streams];
+    uint8_t* bufferRGB;
+    size_t sizeBufferRGB;        // Size in Bytes
+    uint8_t* topBufferRGB;       // Pointer to unused memory in buffer
+    bool allowSkipFrames;        // Allow skipping frames to respect video frame rate
+
+    SEM_TYPE semDecode;          // Post by UI, wait by Decoder thread
+    MUTEX_TYPE mutexDecoder;     // Held by the Decoder thread while decoding
+    MUTEX_TYPE mutexStreams;     // Mutual exclusion of the stream and buffer states
+
+    /**
+     * Decode the next frame of the stream with a free buffer that needs it first. Return false
+     * if no stream needs a frame.
+     */
+    bool decodeOneFrame()
+    {
+        // Running in Decoder thread
+
+        MUTEX_LOCK(mutexDecoder);
+        MUTEX_LOCK(mutexStreams);
+
+        const uint32_t now = HAL_GetTick();
+        uint32_t index = 0;
+        int32_t slot = -1;
+        int32_t earliest = 0;
+        for (uint32_t i = 0; i < no_streams; i++)
+        {
+            Stream& stream = streams[i];
+            if (stream.isActive && !stream.endOfVideo && (stream.isPlaying || stream.isShowingOneFrame)
+                    && mjpegDecoders[i]->hasVideo())
+            {
+                const int32_t free = getFreeBuffer(stream);
+                if (free < 0)
+                {
+                    continue;
+                }
+                const int32_t deadline = getDeadline(stream, now);
+                if (slot < 0 || deadline < earliest)
+                {
+                    slot = free;
+                    index = i;
+                    earliest = deadline;
+                }
+            }
+        }
+        if (slot < 0)
+        {
+            MUTEX_UNLOCK(mutexStreams);
+            MUTEX_UNLOCK(mutexDecoder);
+            return false;
+        }
+
+        Stream& stream = streams[index];
+        Buffer& buffer = stream.buffers[slot];
+        const uint32_t seekToFrame = stream.seek_to_frame;
+        buffer.state = Buffer::DECODING;
+        buffer.epoch = stream.epoch;
+        stream.seek_to_frame = 0;
+        const uint32_t step = getFrameStep(stream);
+        MUTEX_UNLOCK(mutexStreams);
+
+        // Decode without holding the stream mutex, so the UI can keep showing frames
+        MJPEGDecoder* const decoder = mjpegDecoders[index];
+        if (seekToFrame > 0)
+        {
+            decoder->gotoFrame(seekToFrame);
+        }
+        const uint32_t startTime = HAL_GetTick();
+        const bool hasMoreFrames = decoder->decodeNextFrame(buffer.data, width, height, stride);
+        const uint32_t decodeMs = HAL_GetTick() - startTime;
+        const uint32_t frameNumber = hasMoreFrames ? decoder->getCurrentFrameNumber() - 1 : decoder->getNumberOfFrames();
+
+        // Skip the video frames between two frames of the target frame rate, up to the last
+        uint32_t skipped = 0;
+        if (hasMoreFrames && step > 1)
+        {
+            const uint32_t nextFrame = MIN(decoder->getCurrentFrameNumber() + step - 1, decoder->getNumberOfFrames());
+            skipped = nextFrame - decoder->getCurrentFrameNumber();
+            decoder->gotoFrame(nextFrame);
+        }
+
+        MUTEX_LOCK(mutexStreams);
+        stream.stats.decoded++;
+        stream.stats.decodeMs += decodeMs;
+        stream.stats.skipped += skipped;
+        if (buffer.epoch == stream.epoch)
+        {
+            buffer.state = Buffer::READY;
+            buffer.sequence = stream.nextSequence++;
+            buffer.frameNumber = frameNumber;
+            buffer.hasMoreFrames = hasMoreFrames;
+            if (!hasMoreFrames && !stream.repeat)
+            {
+                stream.endOfVideo = true;
+            }
+        }
+        else
+        {
+            // Stream was seeked or stopped while decoding
+            buffer.state = Buffer::FREE;
+        }
+        MUTEX_UNLOCK(mutexStreams);
+        MUTEX_UNLOCK(mutexDecoder);
+
+        return true;
+    }
+
+    /**
+     * Return the index of a free buffer in the stream, or -1. Mutex must be held.
+     */
+    int32_t getFreeBuffer(Stream& stream)
+    {
+        for (uint32_t i = 0; i < no_buffers; i++)
+        {
+            if (stream.buffers[i].state == Buffer::FREE)
+            {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    /**
+     * Return the index of the oldest decoded frame in the stream, or -1. Mutex must be held.
+     */
+    int32_t getNextReadyBuffer(Stream& stream)
+    {
+        int32_t next = -1;
+        for (uint32_t i = 0; i < no_buffers; i++)
+        {
+            const Buffer& buffer = stream.buffers[i];
+            if (buffer.state == Buffer::READY
+                    && (next < 0 || (int32_t)(buffer.sequence - stream.buffers[next].sequence) < 0))
+            {
+                next = i;
+            }
+        }
+        return next;
+    }
+
+    /**
+     * Discard the frames decoded ahead and continue decoding from frameNumber. Mutex must be
+     * held.
+     */
+    void seek(Stream& stream, uint32_t frameNumber)
+    {
+        for (uint32_t i = 0; i < no_buffers; i++)
+        {
+            if (stream.buffers[i].state == Buffer::READY)
+            {
+                stream.buffers[i].state = Buffer::FREE;
+            }
+        }
+        stream.epoch++; // A frame being decoded is discarded when done
+        stream.seek_to_frame = frameNumber;
+        stream.videoTimeAhead = 0;
+        stream.endOfVideo = false;
+        resetCounters(stream);
+    }
+
+    /**
+     * Discard all frames after new video data was set. Decoder mutex must be held.
+     */
+    void resetStream(const Handle handle)
+    {
+        MUTEX_LOCK(mutexStreams);
+        Stream& stream = streams[handle];
+        seek(stream, 0);
+        touchgfx::VideoInformation info;
+        mjpegDecoders[handle]->getVideoInfo(&info);
+        stream.msBetweenFrames = info.ms_between_frames;
+        stream.frameNumber = 0;
+        stream.isPlaying = false;
+        stream.isShowingOneFrame = false;
+        MUTEX_UNLOCK(mutexStreams);
+    }
+
+    /**
+     * Restart the frame rate counters from the current UI tick and time.
+     */
+    void resetCounters(Stream& stream)
+    {
+        stream.frameCount = 0;
+        stream.tickCount = 0;
+        stream.startTime = HAL_GetTick();
+    }
+
+    /**
+     * Return true, if the next video frame should be shown in this tick (keep video framerate)
+     */
+    bool decodeForNextTick(Stream& stream)
+    {
+        // Running in UI thread
+
+        if (stream.frame_rate_ticks == 0 || stream.frame_rate_video == 0)
+        {
+            return showForVideoTime(stream);
+        }
+
+        // Compare tickCount/frameCount to frame_rate_ticks/frame_rate_video
+        if ((stream.tickCount * stream.frame_rate_video) >= (stream.frame_rate_ticks * stream.frameCount))
+        {
+            if (allowSkipFrames && stream.frame_rate_ticks > 0)
+            {
+                stream.skip_frames = (stream.tickCount * stream.frame_rate_video - stream.frame_rate_ticks * stream.frameCount) / stream.frame_rate_ticks;
+                if (stream.skip_frames > 0)
+                {
+                    stream.skip_frames--;
+                }
+            }
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * Return true, if the next video frame is due according to the frame rate of the video
+     */
+    bool showForVideoTime(Stream& stream)
+    {
+        // Running in UI thread
+
+        const uint32_t interval = getFrameInterval(stream);
+        if (interval == 0)
+        {
+            // Unknown frame rate, show frames as they are decoded
+            return true;
+        }
+
+        // The first frame is due when playback starts
+        const uint32_t framesDue = (HAL_GetTick() - stream.startTime) / interval + 1;
+        if (framesDue <= stream.frameCount)
+        {
+            return false;
+        }
+        if (allowSkipFrames)
+        {
+            stream.skip_frames = framesDue - stream.frameCount - 1;
+        }
+        return true;
+    }
+
+    /**
+     * Return the time between two frames shown, the longer of the video and the target frame
+     * rate, or 0 if neither is known.
+     */
+    uint32_t getFrameInterval(const Stream& stream) const
+    {
+        return MAX(stream.msBetweenFrames, stream.msPerFrame);
+    }
+
+    /**
+     * Return the number of video frames from one decoded frame to the next, more than one if
+     * the target frame rate is below the frame rate of the video. Mutex must be held.
+     */
+    uint32_t getFrameStep(Stream& stream)
+    {
+        // Running in Decoder thread
+
+        if (stream.msPerFrame <= stream.msBetweenFrames || stream.msBetweenFrames == 0)
+        {
+            return 1;
+        }
+        // Accumulated, so a target rate that does not divide the video rate keeps its speed
+        stream.videoTimeAhead += stream.msPerFrame;
+        const uint32_t step = stream.videoTimeAhead / stream.msBetweenFrames;
+        stream.videoTimeAhead -= step * stream.msBetweenFrames;
+        return step;
+    }
+
+    /**
+     * Return the ms from now until the stream runs out of decoded frames, divided by its
+     * priority, or multiplied by it if the stream is already behind. Mutex must be held.
+     */
+    int32_t getDeadline(const Stream& stream, uint32_t now) const
+    {
+        // Running in Decoder thread
+
+        if (stream.isShowingOneFrame)
+        {
+            // Due now, the widget waits for it
+            return 0;
+        }
+
+        uint32_t ready = 0;
+        for (uint32_t i = 0; i < no_buffers; i++)
+        {
+            if (stream.buffers[i].state == Buffer::READY)
+            {
+                ready++;
+            }
+        }
+        // Streams of unknown frame rate are ranked as 25 fps
+        const uint32_t interval = getFrameInterval(stream) > 0 ? getFrameInterval(stream) : 40;
+        const int32_t slack = (int32_t)(stream.startTime + (stream.frameCount + ready) * interval - now);
+        return slack >= 0 ? slack / (int32_t)stream.priority : slack * (int32_t)stream.priority;
+    }
+
+#if VIDEO_LTDC_LAYER
+    static touchgfx::BackgroundLayer& getBackgroundLayer()
+    {
+        return static_cast<TouchGFXHAL*>(touchgfx::HAL::getInstance())->getBackgroundLayer();
+    }
+
+    /**
+     * Point LTDC layer 1 at the frame in the area of the widget. Return false if the layer
+     * cannot show it.
+     */
+    bool showOnLayer(const touchgfx::VideoWidget& widget, const uint8_t* frame)
+    {
+        // Running in UI thread
+
+        if (!widget.isVisible())
+        {
+            return false;
+        }
+        const touchgfx::Rect& absolute = widget.getAbsoluteRect();
+        const touchgfx::Rect area(absolute.x, absolute.y, MIN(absolute.width, (int16_t)width), MIN(absolute.height, (int16_t)height));
+        return getBackgroundLayer().pinBuffer(frame, output_format, area, stride);
+    }
+#endif
+
+    /**
+     * Return the stream the widget is registered for, or 0. Mutex must be held.
+     */
+    Stream* findStream(const touchgfx::VideoWidget& widget)
+    {
+        for (uint32_t i = 0; i < no_streams; i++)
+        {
+            if (streams[i].isActive && streams[i].widget == &widget)
+            {
+                return &streams[i];
+            }
+        }
+        return 0;
+    }
+
+    Handle getFreeHandle()
+    {
+        // Running in UI thread
+
+        for (uint32_t i = 0; i < no_streams; i++)
+        {
+            if (streams[i].isActive == false)
+            {
+                // Reset stream parameters
+                streams[i] = Stream();
+
+                return static_cast<VideoController::Handle>(i);
+            }
+        }
+
+        assert(0 && "Unable to find free video stream handle!");
+        return static_cast<VideoController::Handle>(0);
+    }
+};
+
+/* USER CODE END FrameAheadVideoController.hpp */
+
+#endif // FRAMEAHEADVIDEOCONTROLLER_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
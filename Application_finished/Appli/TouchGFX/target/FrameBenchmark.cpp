@@ -0,0 +1,168 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : FrameBenchmark.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include <FrameBenchmark.hpp>
+
+/* USER CODE BEGIN FrameBenchmark.cpp */
+#include <touchgfx/hal/HAL.hpp>
+#include <TraceOutput.hpp>
+#include <nema_hal_ext.h>
+
+namespace
+{
+const char* const backendNames[touchgfx::FrameBenchmark::NUMBER_OF_BACKENDS] = { "GPU2D", "LCD16bpp" };
+
+void sortSamples(uint32_t* values, uint16_t count)
+{
+    // Insertion sort, the sample set is small and only sorted once per report
+    for (uint16_t i = 1; i < count; i++)
+    {
+        const uint32_t value = values[i];
+        uint16_t j = i;
+        while (j > 0 && values[j - 1] > value)
+        {
+            values[j] = values[j - 1];
+            j--;
+        }
+        values[j] = value;
+    }
+}
+} // namespace
+
+namespace touchgfx
+{
+FrameBenchmark::FrameBenchmark()
+    : sceneCallback(0),
+      frameStart(0),
+      mcuLoadSum(0),
+      gpuWaitSum(0),
+      framesPerBackend(0),
+      recorded(0),
+      warmup(0),
+      backend(BACKEND_GPU2D),
+      running(false),
+      resetPending(false)
+{
+}
+
+void FrameBenchmark::start(uint16_t frames)
+{
+    if (frames == 0)
+    {
+        running = false;
+        return;
+    }
+    framesPerBackend = (frames > TOUCHGFX_BENCHMARK_MAX_FRAMES) ? TOUCHGFX_BENCHMARK_MAX_FRAMES : frames;
+    running = true;
+    tracePrintf("benchmark: %u frames per backend", framesPerBackend);
+    beginBackend(BACKEND_GPU2D);
+}
+
+void FrameBenchmark::beginBackend(Backend next)
+{
+    backend = next;
+    recorded = 0;
+    warmup = TOUCHGFX_BENCHMARK_WARMUP_FRAMES;
+    mcuLoadSum = 0;
+    gpuWaitSum = 0;
+    resetPending = true;
+}
+
+void FrameBenchmark::frameStarted()
+{
+    if (!running)
+    {
+        return;
+    }
+    if (resetPending)
+    {
+        resetPending = false;
+        if (sceneCallback && sceneCallback->isValid())
+        {
+            sceneCallback->execute();
+        }
+    }
+    nema_hal_reset_wait_cycles();
+    frameStart = HAL::getInstance()->getCPUCycles();
+}
+
+void FrameBenchmark::frameEnded(uint8_t mcuLoadPct)
+{
+    if (!running)
+    {
+        return;
+    }
+    const uint32_t cycles = HAL::getInstance()->getCPUCycles() - frameStart;
+    if (warmup > 0)
+    {
+        warmup--;
+        return;
+    }
+
+    samples[recorded++] = cycles;
+    mcuLoadSum += mcuLoadPct;
+    gpuWaitSum += nema_hal_get_wait_cycles();
+
+    if (recorded < framesPerBackend)
+    {
+        return;
+    }
+
+    report(backend);
+    if (backend + 1 < NUMBER_OF_BACKENDS)
+    {
+        beginBackend(static_cast<Backend>(backend + 1));
+    }
+    else
+    {
+        running = false;
+        tracePrintf("benchmark: done");
+        if (TOUCHGFX_BENCHMARK_REPEAT)
+        {
+            start(framesPerBackend);
+        }
+    }
+}
+
+void FrameBenchmark::report(Backend measured)
+{
+    sortSamples(samples, recorded);
+
+    uint64_t total = 0;
+    for (uint16_t i = 0; i < recorded; i++)
+    {
+        total += samples[i];
+    }
+    // Nearest-rank percentile: the smallest sample larger than 99% of the samples
+    const uint16_t p99Index = (uint16_t)(((uint32_t)recorded * 99U + 99U) / 100U) - 1U;
+
+    tracePrintf("benchmark %s: frames=%u min=%luus avg=%luus p99=%luus max=%luus mcu=%lu%% gpu_wait=%luus",
+                backendNames[measured],
+                recorded,
+                (unsigned long)cyclesToUs(samples[0]),
+                (unsigned long)cyclesToUs((uint32_t)(total / recorded)),
+                (unsigned long)cyclesToUs(samples[p99Index]),
+                (unsigned long)cyclesToUs(samples[recorded - 1]),
+                (unsigned long)(mcuLoadSum / recorded),
+                (unsigned long)cyclesToUs(gpuWaitSum / recorded));
+}
+} // namespace touchgfx
+
+/* USER CODE END FrameBenchmark.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,179 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : FrameBenchmark.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef FRAMEBENCHMARK_HPP
+#define FRAMEBENCHMARK_HPP
+
+#include <touchgfx/Callback.hpp>
+#include <stdint.h>
+
+/* USER CODE BEGIN FrameBenchmark.hpp */
+
+/**
+ * Number of frames to benchmark on each backend automatically after startup. Set to 0 to
+ * only run the benchmark when requested through TouchGFXHAL::startBenchmark().
+ */
+#ifndef TOUCHGFX_BENCHMARK_FRAMES
+#define TOUCHGFX_BENCHMARK_FRAMES 0
+#endif
+
+/**
+ * Set to 1 to start the benchmark again when it is done, so a trace captured at any time
+ * after startup holds complete runs. Used by the benchmark_layouts target of the gcc
+ * makefile, which attaches to SWO after flashing.
+ */
+#ifndef TOUCHGFX_BENCHMARK_REPEAT
+#define TOUCHGFX_BENCHMARK_REPEAT 0
+#endif
+
+/**
+ * Maximum number of frames that can be recorded per backend.
+ */
+#ifndef TOUCHGFX_BENCHMARK_MAX_FRAMES
+#define TOUCHGFX_BENCHMARK_MAX_FRAMES 256
+#endif
+
+/**
+ * Number of frames rendered after a backend switch before recording starts. These frames
+ * absorb the full-screen redraw caused by the scene reset.
+ */
+#ifndef TOUCHGFX_BENCHMARK_WARMUP_FRAMES
+#define TOUCHGFX_BENCHMARK_WARMUP_FRAMES 2
+#endif
+
+namespace touchgfx
+{
+/**
+ * @class FrameBenchmark
+ *
+ * @brief Records per-frame render time on the NeoChrom (GPU2D) and the software (LCD16bpp)
+ *        backend and reports the result over SWO.
+ *
+ *        The benchmark runs the currently active screen for a fixed number of frames on
+ *        each backend. Before each run an optional scene callback is executed, so the
+ *        screen can rewind its animation and both backends render identical frames. For
+ *        every backend min/avg/p99 render time, the average MCU load and the average time
+ *        the CPU was blocked waiting for GPU2D are reported.
+ *
+ *        The HAL drives the benchmark by calling frameStarted() and frameEnded() around
+ *        every frame, and selects the backend returned by getBackend().
+ */
+class FrameBenchmark
+{
+public:
+    /** The rendering backends compared by the benchmark. */
+    enum Backend
+    {
+        BACKEND_GPU2D,     ///< Rendering through LCDGPU2D_AXI (NeoChrom)
+        BACKEND_LCD16BPP,  ///< Rendering through the software LCD16bpp
+        NUMBER_OF_BACKENDS ///< Number of backends
+    };
+
+    FrameBenchmark();
+
+    /**
+     * @fn void FrameBenchmark::start(uint16_t frames);
+     *
+     * @brief Starts a benchmark.
+     *
+     *        Starts a benchmark of the given number of frames on each backend. A running
+     *        benchmark is restarted.
+     *
+     * @param frames Number of frames to record per backend. Clamped to
+     *               TOUCHGFX_BENCHMARK_MAX_FRAMES.
+     */
+    void start(uint16_t frames);
+
+    /**
+     * @fn bool FrameBenchmark::isRunning() const;
+     *
+     * @brief Query if a benchmark is in progress.
+     *
+     * @return true if a benchmark is in progress.
+     */
+    bool isRunning() const
+    {
+        return running;
+    }
+
+    /**
+     * @fn Backend FrameBenchmark::getBackend() const;
+     *
+     * @brief Gets the backend that must be used for the next frame.
+     *
+     * @return The backend under test.
+     */
+    Backend getBackend() const
+    {
+        return backend;
+    }
+
+    /**
+     * @fn void FrameBenchmark::setSceneCallback(GenericCallback<>* callback);
+     *
+     * @brief Sets the callback that resets the benchmarked scene.
+     *
+     *        Sets the callback that resets the benchmarked scene. It is executed from the
+     *        TouchGFX task before the first frame on each backend. Pass 0 to remove the
+     *        callback, e.g. when the screen is torn down.
+     *
+     * @param callback The scene reset callback.
+     */
+    void setSceneCallback(GenericCallback<>* callback)
+    {
+        sceneCallback = callback;
+    }
+
+    /**
+     * @fn void FrameBenchmark::frameStarted();
+     *
+     * @brief Must be called by the HAL when a frame begins.
+     */
+    void frameStarted();
+
+    /**
+     * @fn void FrameBenchmark::frameEnded(uint8_t mcuLoadPct);
+     *
+     * @brief Must be called by the HAL when a frame has been rendered.
+     *
+     * @param mcuLoadPct The current MCU load as reported by HAL::getMCULoadPct().
+     */
+    void frameEnded(uint8_t mcuLoadPct);
+
+private:
+    void beginBackend(Backend next);
+    void report(Backend measured);
+
+    GenericCallback<>* sceneCallback;
+    uint32_t samples[TOUCHGFX_BENCHMARK_MAX_FRAMES];
+    uint32_t frameStart;
+    uint32_t mcuLoadSum;
+    uint32_t gpuWaitSum;
+    uint16_t framesPerBackend;
+    uint16_t recorded;
+    uint16_t warmup;
+    Backend backend;
+    bool running;
+    bool resetPending;
+};
+} // namespace touchgfx
+
+/* USER CODE END FrameBenchmark.hpp */
+
+#endif // FRAMEBENCHMARK_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
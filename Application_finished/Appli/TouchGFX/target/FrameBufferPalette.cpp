@@ -0,0 +1,101 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : FrameBufferPalette.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include <FrameBufferPalette.hpp>
+
+/* USER CODE BEGIN FrameBufferPalette.cpp */
+#include "stm32h7rsxx_hal.h"
+
+extern "C" LTDC_HandleTypeDef hltdc;
+
+namespace touchgfx
+{
+FrameBufferPalette* FrameBufferPalette::instance = 0;
+
+FrameBufferPalette::FrameBufferPalette()
+    : layer(NO_LAYER), changed(false)
+{
+    reset();
+}
+
+uint8_t FrameBufferPalette::getIndex(colortype color)
+{
+    const uint32_t rgb = (uint32_t)color;
+    // Rounds each 8-bit component to the nearest of 0x00, 0x55, 0xAA and 0xFF
+    const uint32_t r = (((rgb >> 16) & 0xFFU) + 0x2AU) / 0x55U;
+    const uint32_t g = (((rgb >> 8) & 0xFFU) + 0x2AU) / 0x55U;
+    const uint32_t b = ((rgb & 0xFFU) + 0x2AU) / 0x55U;
+    return (uint8_t)(0xC0U | (r << 4) | (g << 2) | b);
+}
+
+void FrameBufferPalette::setColor(uint8_t index, colortype color)
+{
+    colors[index] = (uint32_t)color & 0xFFFFFFU;
+    changed = true;
+}
+
+void FrameBufferPalette::setColors(uint8_t first, const uint32_t* newColors, uint16_t count)
+{
+    for (uint16_t i = 0; i < count && first + i < SIZE; i++)
+    {
+        colors[first + i] = newColors[i] & 0xFFFFFFU;
+    }
+    changed = true;
+}
+
+void FrameBufferPalette::reset()
+{
+    for (uint16_t i = 0; i < SIZE; i++)
+    {
+        // Each 2-bit component is spread over 8 bits, 3 becomes 0xFF
+        const uint32_t r = ((i >> 4) & 3U) * 0x55U;
+        const uint32_t g = ((i >> 2) & 3U) * 0x55U;
+        const uint32_t b = (i & 3U) * 0x55U;
+        colors[i] = (r << 16) | (g << 8) | b;
+    }
+    changed = true;
+}
+
+void FrameBufferPalette::setActive(uint32_t layerIndex)
+{
+    if (layerIndex != layer)
+    {
+        layer = layerIndex;
+        changed = true;
+    }
+}
+
+void FrameBufferPalette::load()
+{
+    if (layer == NO_LAYER || !changed)
+    {
+        return;
+    }
+    changed = false;
+    // The CLUT is written directly, as the boot loader does for the splash
+    LTDC_Layer_TypeDef* const ltdcLayer = LTDC_LAYER(&hltdc, layer);
+    for (uint32_t i = 0; i < SIZE; i++)
+    {
+        ltdcLayer->CLUTWR = (i << 24U) | colors[i];
+    }
+}
+} // namespace touchgfx
+
+/* USER CODE END FrameBufferPalette.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,162 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : FrameBufferPalette.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef FRAMEBUFFERPALETTE_HPP
+#define FRAMEBUFFERPALETTE_HPP
+
+#include <touchgfx/hal/Types.hpp>
+#include <stdint.h>
+
+/* USER CODE BEGIN FrameBufferPalette.hpp */
+
+namespace touchgfx
+{
+/**
+ * @class FrameBufferPalette
+ *
+ * @brief The CLUT LTDC looks up the colors of an 8-bit framebuffer in.
+ *
+ *        With an ARGB2222 framebuffer, see TouchGFXHAL::setFrameBufferFormat(), LTDC scans
+ *        out the layer as L8 and looks every byte up in its CLUT of 256 RGB888 colors. The
+ *        default palette maps each ARGB2222 value to its color, the alpha bits ignored, so
+ *        what the software renderer draws is shown as is. Colors can be changed to give a
+ *        screen more than 64 colors, e.g. a ramp of the brand color instead of the nearest
+ *        ARGB2222 colors, or to recolor or dim a whole screen without drawing anything.
+ *
+ *        Changes are loaded into LTDC in the vertical blanking by vSyncFromISR(), as the
+ *        CLUT has no shadow registers.
+ */
+class FrameBufferPalette
+{
+public:
+    /** Number of colors of the palette. */
+    static const uint16_t SIZE = 256;
+
+    FrameBufferPalette();
+
+    /**
+     * @fn static uint8_t FrameBufferPalette::getIndex(colortype color);
+     *
+     * @brief Gets the ARGB2222 value, and index of the default palette, nearest to a color.
+     *
+     * @param color The color.
+     *
+     * @return The opaque ARGB2222 value of the color.
+     */
+    static uint8_t getIndex(colortype color);
+
+    /**
+     * @fn void FrameBufferPalette::setColor(uint8_t index, colortype color);
+     *
+     * @brief Changes a color, shown from the next vertical blanking.
+     *
+     * @param index The index, the ARGB2222 value drawn.
+     * @param color The RGB888 color LTDC shows for it.
+     */
+    void setColor(uint8_t index, colortype color);
+
+    /**
+     * @fn void FrameBufferPalette::setColors(uint8_t first, const uint32_t* colors, uint16_t count);
+     *
+     * @brief Changes consecutive colors, shown from the next vertical blanking.
+     *
+     * @param first  The first index.
+     * @param colors The RGB888 colors.
+     * @param count  Number of colors, clipped to the end of the palette.
+     */
+    void setColors(uint8_t first, const uint32_t* colors, uint16_t count);
+
+    /**
+     * @fn colortype FrameBufferPalette::getColor(uint8_t index) const;
+     *
+     * @brief Gets a color.
+     *
+     * @param index The index.
+     *
+     * @return The RGB888 color.
+     */
+    colortype getColor(uint8_t index) const
+    {
+        return colortype(colors[index]);
+    }
+
+    /**
+     * @fn void FrameBufferPalette::reset();
+     *
+     * @brief Restores the default palette, of the color of each ARGB2222 value.
+     */
+    void reset();
+
+    /**
+     * @fn void FrameBufferPalette::setActive(uint32_t layerIndex);
+     *
+     * @brief Sets the LTDC layer scanning out the 8-bit framebuffer, and loads the palette
+     *        into its CLUT at the next vertical blanking. Called by the HAL with the
+     *        format of the layer.
+     *
+     * @param layerIndex The LTDC layer index, or NO_LAYER if the framebuffer is not 8-bit.
+     */
+    void setActive(uint32_t layerIndex);
+
+    /**
+     * @fn void FrameBufferPalette::load();
+     *
+     * @brief Writes the palette to the CLUT of the active layer if it changed.
+     */
+    void load();
+
+    /**
+     * @fn void FrameBufferPalette::registerInstance();
+     *
+     * @brief Makes this the palette loaded by the LTDC interrupt.
+     */
+    void registerInstance()
+    {
+        instance = this;
+    }
+
+    /**
+     * @fn static void FrameBufferPalette::vSyncFromISR();
+     *
+     * @brief Calls load() on the palette of the HAL, if any. Called by the LTDC interrupt
+     *        before the active area.
+     */
+    static void vSyncFromISR()
+    {
+        if (instance != 0)
+        {
+            instance->load();
+        }
+    }
+
+    /** Layer index of setActive() when no layer is 8-bit. */
+    static const uint32_t NO_LAYER = 0xFFFFFFFFU;
+
+private:
+    uint32_t colors[SIZE];
+    uint32_t layer;
+    volatile bool changed;
+
+    static FrameBufferPalette* instance;
+};
+} // namespace touchgfx
+
+/* USER CODE END FrameBufferPalette.hpp */
+
+#endif // FRAMEBUFFERPALETTE_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
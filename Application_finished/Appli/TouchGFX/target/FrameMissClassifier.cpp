@@ -0,0 +1,177 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : FrameMissClassifier.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include <FrameMissClassifier.hpp>
+
+/* USER CODE BEGIN FrameMissClassifier.cpp */
+#include <string.h>
+#include <TraceOutput.hpp>
+#include <nema_hal_ext.h>
+
+#include "stm32h7rsxx.h"
+
+namespace touchgfx
+{
+FrameMissClassifier::FrameMissClassifier()
+    : tickLatencyUs(0), startCycles(0), cpuCycles(0), gpuWaitStart(0), gpuWaitCycles(0), semaphoreCycles(0),
+      xspiBytes(0), inFrame(false), timed(false), historyCount(0), next(0)
+{
+    memset(history, 0, sizeof(history));
+    memset(recent, 0, sizeof(recent));
+    resetStats();
+}
+
+void FrameMissClassifier::tickStarted(bool late, uint32_t latencyUs)
+{
+    if (late && timed)
+    {
+        uint32_t timesUs[NUMBER_OF_CAUSES];
+        const Cause cause = classify(timesUs);
+        stats.missed++;
+        stats.causes[cause]++;
+        const uint32_t frameUs = tickLatencyUs + cyclesToUs(cpuCycles);
+        if (frameUs > stats.worstUs)
+        {
+            stats.worstUs = frameUs;
+        }
+
+        // The oldest miss leaves the recent causes once the history is full
+        if (historyCount == FRAME_MISS_HISTORY)
+        {
+            recent[history[next]]--;
+        }
+        else
+        {
+            historyCount++;
+        }
+        history[next] = (uint8_t)cause;
+        next = (next + 1) % FRAME_MISS_HISTORY;
+        recent[cause]++;
+
+        if (FRAME_MISS_REPORTS)
+        {
+            tracePrintf("frame miss: %s frame=%luus cpu=%luus gpu=%luus xspi=%luus semaphore=%luus tick=%luus",
+                        getName(cause),
+                        (unsigned long)frameUs,
+                        (unsigned long)timesUs[CAUSE_CPU],
+                        (unsigned long)timesUs[CAUSE_GPU],
+                        (unsigned long)timesUs[CAUSE_MEMORY],
+                        (unsigned long)timesUs[CAUSE_SEMAPHORE],
+                        (unsigned long)timesUs[CAUSE_TICK]);
+        }
+    }
+    timed = false;
+    tickLatencyUs = latencyUs;
+}
+
+void FrameMissClassifier::frameStarted()
+{
+    startCycles = DWT->CYCCNT;
+    gpuWaitStart = nema_hal_get_wait_cycles();
+    semaphoreCycles = 0;
+    inFrame = true;
+}
+
+void FrameMissClassifier::frameEnded(bool drawn, uint32_t bytes)
+{
+    if (!inFrame)
+    {
+        return;
+    }
+    inFrame = false;
+    cpuCycles = DWT->CYCCNT - startCycles;
+    // FrameBenchmark resets the wait time at the start of its frames
+    const uint32_t waited = nema_hal_get_wait_cycles();
+    gpuWaitCycles = (waited >= gpuWaitStart) ? waited - gpuWaitStart : waited;
+    xspiBytes = bytes;
+    timed = drawn;
+    if (drawn)
+    {
+        stats.frames++;
+    }
+}
+
+FrameMissClassifier::Cause FrameMissClassifier::getMostFrequent() const
+{
+    Cause most = NUMBER_OF_CAUSES;
+    uint32_t count = 0;
+    for (int cause = 0; cause < NUMBER_OF_CAUSES; cause++)
+    {
+        if (recent[cause] > count)
+        {
+            count = recent[cause];
+            most = static_cast<Cause>(cause);
+        }
+    }
+    return most;
+}
+
+const char* FrameMissClassifier::getName(Cause cause)
+{
+    static const char* const names[NUMBER_OF_CAUSES] = { "cpu", "gpu", "memory", "semaphore", "tick" };
+    return cause < NUMBER_OF_CAUSES ? names[cause] : "none";
+}
+
+void FrameMissClassifier::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+FrameMissClassifier::Cause FrameMissClassifier::classify(uint32_t* timesUs) const
+{
+    // GPU2D was last reset by beginFrame() of the frame, after its wait for the frame before
+    nema_hal_gpu_stats_t gpu;
+    nema_hal_get_gpu_stats(&gpu);
+    const uint32_t frameUs = cyclesToUs(cpuCycles);
+    const uint32_t waitUs = cyclesToUs(gpuWaitCycles);
+    const uint32_t busyUs = cyclesToUs(gpu.busy_cycles);
+    const uint32_t blockedUs = waitUs + cyclesToUs(semaphoreCycles);
+
+    timesUs[CAUSE_CPU] = (frameUs > blockedUs) ? frameUs - blockedUs : 0;
+    timesUs[CAUSE_GPU] = (busyUs > waitUs) ? busyUs : waitUs;
+    timesUs[CAUSE_MEMORY] = xspiBytes / FRAME_MISS_XSPI_BYTES_PER_US;
+    timesUs[CAUSE_SEMAPHORE] = cyclesToUs(semaphoreCycles);
+    timesUs[CAUSE_TICK] = tickLatencyUs;
+
+    Cause cause = CAUSE_CPU;
+    for (int other = CAUSE_GPU; other < NUMBER_OF_CAUSES; other++)
+    {
+        if (other != CAUSE_MEMORY && timesUs[other] > timesUs[cause])
+        {
+            cause = static_cast<Cause>(other);
+        }
+    }
+    // The CPU and GPU2D times include their waits for PSRAM and flash
+    if ((cause == CAUSE_CPU || cause == CAUSE_GPU)
+            && timesUs[CAUSE_MEMORY] > 0
+            && (uint64_t)timesUs[CAUSE_MEMORY] * 100U >= (uint64_t)timesUs[cause] * FRAME_MISS_MEMORY_PCT)
+    {
+        cause = CAUSE_MEMORY;
+    }
+    return cause;
+}
+
+uint32_t FrameMissClassifier::cyclesToUs(uint32_t cycles) const
+{
+    return (uint32_t)(((uint64_t)cycles * 1000000U) / SystemCoreClock);
+}
+} // namespace touchgfx
+
+/* USER CODE END FrameMissClassifier.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,226 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : FrameMissClassifier.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef FRAMEMISSCLASSIFIER_HPP
+#define FRAMEMISSCLASSIFIER_HPP
+
+#include <stdint.h>
+
+/* USER CODE BEGIN FrameMissClassifier.hpp */
+
+/**
+ * Number of the latest missed frames the recent causes are counted over.
+ */
+#ifndef FRAME_MISS_HISTORY
+#define FRAME_MISS_HISTORY 64
+#endif
+
+/**
+ * Bytes per microsecond that XSPI1 and XSPI2 together sustain for rendering, the share
+ * of the PSRAM and flash bandwidth left by the LTDC scanout.
+ */
+#ifndef FRAME_MISS_XSPI_BYTES_PER_US
+#define FRAME_MISS_XSPI_BYTES_PER_US 200
+#endif
+
+/**
+ * How much of the time of the CPU or GPU2D, in percent, the XSPI traffic of a missed
+ * frame must take for the miss to be counted as memory-bound.
+ */
+#ifndef FRAME_MISS_MEMORY_PCT
+#define FRAME_MISS_MEMORY_PCT 75
+#endif
+
+/**
+ * Set to 1 to report every missed frame over SWO with the times it was classified by.
+ */
+#ifndef FRAME_MISS_REPORTS
+#define FRAME_MISS_REPORTS 0
+#endif
+
+namespace touchgfx
+{
+/**
+ * @class FrameMissClassifier
+ *
+ * @brief Tells why frames miss their VSYNC.
+ *
+ *        Every frame is timed from the start of its tick to the end of endFrame(): the
+ *        time the tick started after the VSYNC that released it, the time the CPU was
+ *        blocked on GPU2D, from the wait for the previous frame in beginFrame() to the
+ *        waits for ring buffer space, the time blocked on the framebuffer semaphore in
+ *        lockFrameBuffer(), and the bytes the frame moved over XSPI as counted by
+ *        CortexMMCUInstrumentation. The rest of the frame is CPU time, the draw chain and
+ *        the canvas widget renderer together.
+ *
+ *        A frame missed its VSYNC when the next tick is late, see FramePacer::isLate().
+ *        The frame is then classified by the largest of its times, the GPU2D time being
+ *        the longer of the CPU wait and the GPU2D execution of the frame. A CPU-bound or
+ *        GPU-bound frame whose XSPI traffic alone takes FRAME_MISS_MEMORY_PCT of that time
+ *        at FRAME_MISS_XSPI_BYTES_PER_US is memory-bound instead.
+ *
+ *        The causes are counted since the last reset and over the latest
+ *        FRAME_MISS_HISTORY misses, whose most frequent cause is the one to fix first.
+ */
+class FrameMissClassifier
+{
+public:
+    /** Why a frame missed its VSYNC. */
+    enum Cause
+    {
+        CAUSE_CPU,       ///< Drawing on the CPU, the draw chain or the canvas widget renderer
+        CAUSE_GPU,       ///< Command list execution on GPU2D
+        CAUSE_MEMORY,    ///< XSPI bandwidth, the CPU or GPU2D waiting for PSRAM or flash
+        CAUSE_SEMAPHORE, ///< Blocked on the framebuffer semaphore
+        CAUSE_TICK,      ///< The tick started late after the VSYNC that released it
+        NUMBER_OF_CAUSES
+    };
+
+    /** Frames and missed frames since the last reset. */
+    struct Stats
+    {
+        uint32_t frames;                   ///< Frames drawn
+        uint32_t missed;                   ///< Frames that missed their VSYNC
+        uint32_t causes[NUMBER_OF_CAUSES]; ///< Missed frames by cause
+        uint32_t worstUs;                  ///< Longest missed frame, from its VSYNC to the end of endFrame()
+    };
+
+    FrameMissClassifier();
+
+    /**
+     * @fn void FrameMissClassifier::tickStarted(bool late, uint32_t latencyUs);
+     *
+     * @brief Classifies the previous frame if it missed its VSYNC, and starts timing the
+     *        frame of this tick. Called at the start of every tick.
+     *
+     * @param late      true if the tick was released late, see FramePacer::isLate().
+     * @param latencyUs Time from the VSYNC that released the tick to its start.
+     */
+    void tickStarted(bool late, uint32_t latencyUs);
+
+    /**
+     * @fn void FrameMissClassifier::frameStarted();
+     *
+     * @brief Starts the CPU time of the frame. Called at the start of beginFrame().
+     */
+    void frameStarted();
+
+    /**
+     * @fn void FrameMissClassifier::semaphoreWaited(uint32_t cycles);
+     *
+     * @brief Adds time blocked on the framebuffer semaphore. Called by lockFrameBuffer().
+     *
+     * @param cycles The time blocked in CPU cycles.
+     */
+    void semaphoreWaited(uint32_t cycles)
+    {
+        if (inFrame)
+        {
+            semaphoreCycles += cycles;
+        }
+    }
+
+    /**
+     * @fn void FrameMissClassifier::frameEnded(bool drawn, uint32_t bytes);
+     *
+     * @brief Ends the CPU time of the frame. Called at the end of endFrame().
+     *
+     * @param drawn true if the frame flushed an area of the framebuffer, only those frames
+     *              can miss a VSYNC.
+     * @param bytes Bytes the frame read and wrote in PSRAM and flash.
+     */
+    void frameEnded(bool drawn, uint32_t bytes);
+
+    /**
+     * @fn uint32_t FrameMissClassifier::getRecent(Cause cause) const;
+     *
+     * @brief Gets how many of the latest FRAME_MISS_HISTORY missed frames had a cause.
+     *
+     * @param cause The cause.
+     *
+     * @return The number of missed frames.
+     */
+    uint32_t getRecent(Cause cause) const
+    {
+        return recent[cause];
+    }
+
+    /**
+     * @fn Cause FrameMissClassifier::getMostFrequent() const;
+     *
+     * @brief Gets the most frequent cause of the latest missed frames.
+     *
+     * @return The cause, NUMBER_OF_CAUSES if no frame missed its VSYNC.
+     */
+    Cause getMostFrequent() const;
+
+    /**
+     * @fn static const char* FrameMissClassifier::getName(Cause cause);
+     *
+     * @brief Gets the name of a cause as reported.
+     *
+     * @param cause The cause.
+     *
+     * @return The name, "none" for NUMBER_OF_CAUSES.
+     */
+    static const char* getName(Cause cause);
+
+    /**
+     * @fn const Stats& FrameMissClassifier::getStats() const;
+     *
+     * @brief Gets the missed frames since the last reset.
+     *
+     * @return The statistics.
+     */
+    const Stats& getStats() const
+    {
+        return stats;
+    }
+
+    /**
+     * @fn void FrameMissClassifier::resetStats();
+     *
+     * @brief Resets the statistics. The latest missed frames are kept.
+     */
+    void resetStats();
+
+private:
+    Cause classify(uint32_t* timesUs) const;
+    uint32_t cyclesToUs(uint32_t cycles) const;
+
+    uint32_t tickLatencyUs;   ///< Of the frame being timed
+    uint32_t startCycles;     ///< Cycle counter at the start of beginFrame()
+    uint32_t cpuCycles;       ///< From the start of beginFrame() to the end of endFrame()
+    uint32_t gpuWaitStart;    ///< nema_hal_get_wait_cycles() at the start of beginFrame()
+    uint32_t gpuWaitCycles;
+    uint32_t semaphoreCycles;
+    uint32_t xspiBytes;
+    bool inFrame;             ///< Between frameStarted() and frameEnded()
+    bool timed;               ///< A frame was drawn in the previous tick
+    uint8_t history[FRAME_MISS_HISTORY]; ///< Causes of the latest missed frames, from next on
+    uint16_t historyCount;
+    uint16_t next;
+    uint32_t recent[NUMBER_OF_CAUSES];
+    Stats stats;
+};
+} // namespace touchgfx
+
+/* USER CODE END FrameMissClassifier.hpp */
+
+#endif // FRAMEMISSCLASSIFIER_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
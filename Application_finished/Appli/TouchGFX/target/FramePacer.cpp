@@ -0,0 +1,102 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : FramePacer.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include <FramePacer.hpp>
+
+/* USER CODE BEGIN FramePacer.cpp */
+#include <string.h>
+
+#include "stm32h7rsxx.h"
+
+namespace
+{
+// Used until two VSYNCs have been seen, 60 Hz
+const uint32_t DEFAULT_REFRESH_PERIOD_US = 16667U;
+}
+
+namespace touchgfx
+{
+FramePacer* FramePacer::instance = 0;
+
+FramePacer::FramePacer()
+    : vsyncCycles(0), vsyncPeriod(0), tickCycles(0), tickDeltaUs(DEFAULT_REFRESH_PERIOD_US), tickLatencyUs(0),
+      refreshPeriodUs(DEFAULT_REFRESH_PERIOD_US), late(false), skippedLast(false)
+{
+    resetStats();
+}
+
+void FramePacer::vSync()
+{
+    const uint32_t now = DWT->CYCCNT;
+    if (vsyncCycles != 0)
+    {
+        vsyncPeriod = now - vsyncCycles;
+    }
+    vsyncCycles = now;
+}
+
+bool FramePacer::startTick()
+{
+    __disable_irq();
+    const uint32_t released = vsyncCycles;
+    const uint32_t period = vsyncPeriod;
+    __enable_irq();
+    const uint32_t now = DWT->CYCCNT;
+
+    if (period != 0)
+    {
+        refreshPeriodUs = cyclesToUs(period);
+    }
+    tickDeltaUs = (tickCycles != 0) ? cyclesToUs(released - tickCycles) : refreshPeriodUs;
+    tickCycles = released;
+    tickLatencyUs = (released != 0) ? cyclesToUs(now - released) : 0;
+
+    stats.ticks++;
+    late = tickDeltaUs > refreshPeriodUs + refreshPeriodUs / 2;
+    if (late)
+    {
+        stats.late++;
+    }
+
+    // Never skip two frames in a row, the display must keep updating under sustained load
+    const bool skip = FRAME_PACING
+                      && !skippedLast
+                      && released != 0
+                      && tickLatencyUs > (refreshPeriodUs * FRAME_PACING_SKIP_THRESHOLD_PCT) / 100;
+    skippedLast = skip;
+    if (skip)
+    {
+        stats.skipped++;
+    }
+    return skip;
+}
+
+void FramePacer::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+uint32_t FramePacer::cyclesToUs(uint32_t cycles) const
+{
+    return (uint32_t)(((uint64_t)cycles * 1000000U) / SystemCoreClock);
+}
+} // namespace touchgfx
+
+/* USER CODE END FramePacer.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
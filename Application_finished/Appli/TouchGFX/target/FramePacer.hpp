@@ -0,0 +1,198 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : FramePacer.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef FRAMEPACER_HPP
+#define FRAMEPACER_HPP
+
+#include <stdint.h>
+
+/* USER CODE BEGIN FramePacer.hpp */
+
+/**
+ * Set to 0 to advance animations by a fixed step per tick and render every tick.
+ */
+#ifndef FRAME_PACING
+#define FRAME_PACING 1
+#endif
+
+/**
+ * How late, in percent of a display refresh, a tick may start after the VSYNC that
+ * released it and still be rendered. A later tick would finish after the next VSYNC, so
+ * rendering it only delays the frames after it.
+ */
+#ifndef FRAME_PACING_SKIP_THRESHOLD_PCT
+#define FRAME_PACING_SKIP_THRESHOLD_PCT 75
+#endif
+
+namespace touchgfx
+{
+/**
+ * @class FramePacer
+ *
+ * @brief Measures the time between ticks from the LTDC line interrupt.
+ *
+ *        vSync() timestamps every display refresh with the DWT cycle counter. At the start
+ *        of every tick, startTick() takes the time since the VSYNC that released the
+ *        previous tick, so tick handlers can advance animations by elapsed time instead of
+ *        by a fixed step per tick, and keep their speed when frames are lost.
+ *
+ *        startTick() also tells whether the tick started so late that a frame rendered in it
+ *        would miss the next VSYNC as well. Such a frame is skipped, at most one in a row,
+ *        and its dirty areas are drawn by the next tick.
+ */
+class FramePacer
+{
+public:
+    /** Number of ticks that were late and that had their frame skipped. */
+    struct Stats
+    {
+        uint32_t ticks;   ///< Ticks measured
+        uint32_t late;    ///< Ticks released more than one refresh after the previous tick
+        uint32_t skipped; ///< Ticks that had their frame skipped
+    };
+
+    FramePacer();
+
+    /**
+     * @fn void FramePacer::vSync();
+     *
+     * @brief Records the time of a display refresh. Called from the LTDC line interrupt.
+     */
+    void vSync();
+
+    /**
+     * @fn bool FramePacer::startTick();
+     *
+     * @brief Measures the time since the previous tick. Called at the start of every tick.
+     *
+     * @return true if the frame of this tick should be skipped.
+     */
+    bool startTick();
+
+    /**
+     * @fn uint32_t FramePacer::getTickDeltaUs() const;
+     *
+     * @brief Gets the time between the VSYNCs that released the previous and the current tick.
+     *
+     * @return The elapsed time in microseconds.
+     */
+    uint32_t getTickDeltaUs() const
+    {
+        return tickDeltaUs;
+    }
+
+    /**
+     * @fn uint32_t FramePacer::getTickLatencyUs() const;
+     *
+     * @brief Gets the time from the VSYNC that released the current tick to its start.
+     *
+     * @return The latency in microseconds, 0 before the first VSYNC.
+     */
+    uint32_t getTickLatencyUs() const
+    {
+        return tickLatencyUs;
+    }
+
+    /**
+     * @fn bool FramePacer::isLate() const;
+     *
+     * @brief Tells if the current tick was released more than one refresh after the
+     *        previous tick, so the frame of the previous tick missed its VSYNC.
+     *
+     * @return true if the current tick is late.
+     */
+    bool isLate() const
+    {
+        return late;
+    }
+
+    /**
+     * @fn uint32_t FramePacer::getRefreshPeriodUs() const;
+     *
+     * @brief Gets the measured time between two display refreshes.
+     *
+     * @return The refresh period in microseconds.
+     */
+    uint32_t getRefreshPeriodUs() const
+    {
+        return refreshPeriodUs;
+    }
+
+    /**
+     * @fn const Stats& FramePacer::getStats() const;
+     *
+     * @brief Gets the pacing statistics.
+     *
+     * @return The pacing statistics.
+     */
+    const Stats& getStats() const
+    {
+        return stats;
+    }
+
+    /**
+     * @fn void FramePacer::resetStats();
+     *
+     * @brief Resets the pacing statistics.
+     */
+    void resetStats();
+
+    /**
+     * @fn static void FramePacer::vSyncFromISR();
+     *
+     * @brief Calls vSync() on the pacer of the HAL, if any.
+     */
+    static void vSyncFromISR()
+    {
+        if (instance != 0)
+        {
+            instance->vSync();
+        }
+    }
+
+    /**
+     * @fn void FramePacer::registerInstance();
+     *
+     * @brief Makes this the pacer that vSyncFromISR() records refreshes for.
+     */
+    void registerInstance()
+    {
+        instance = this;
+    }
+
+private:
+    uint32_t cyclesToUs(uint32_t cycles) const;
+
+    volatile uint32_t vsyncCycles;     ///< Cycle counter at the last VSYNC
+    volatile uint32_t vsyncPeriod;     ///< Cycles between the last two VSYNCs
+    uint32_t tickCycles;               ///< Cycle counter at the VSYNC that released the last tick
+    uint32_t tickDeltaUs;
+    uint32_t tickLatencyUs;
+    uint32_t refreshPeriodUs;
+    bool late;
+    bool skippedLast;
+    Stats stats;
+
+    static FramePacer* instance;
+};
+} // namespace touchgfx
+
+/* USER CODE END FramePacer.hpp */
+
+#endif // FRAMEPACER_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
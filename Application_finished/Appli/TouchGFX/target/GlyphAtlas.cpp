@@ -0,0 +1,255 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : GlyphAtlas.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include <GlyphAtlas.hpp>
+
+/* USER CODE BEGIN GlyphAtlas.cpp */
+#include <DCacheMaintenance.hpp>
+#include <HybridLCDGPU2D.hpp>
+#include <touchgfx/hal/Config.hpp>
+#include <string.h>
+
+namespace
+{
+const uint32_t PAGE_BYTES = touchgfx::GlyphAtlas::PAGE_STRIDE * TOUCHGFX_GLYPH_ATLAS_PAGE_HEIGHT;
+
+// A shelf is reused for glyphs up to this many lines lower than it
+const uint16_t SHELF_SLACK = 4;
+
+#if TOUCHGFX_GLYPH_ATLAS_PAGES > 0
+// In PSRAM, cleaned after each glyph in case an MPUProfile makes it write-back
+LOCATION_PRAGMA_NOLOAD("TouchGFX_Framebuffer")
+uint32_t atlasPages[TOUCHGFX_GLYPH_ATLAS_PAGES][PAGE_BYTES / 4] LOCATION_ATTRIBUTE_NOLOAD("TouchGFX_Framebuffer");
+#endif
+}
+
+namespace touchgfx
+{
+GlyphAtlas* GlyphAtlas::instance = 0;
+
+GlyphAtlas::GlyphAtlas()
+    : numEntries(0), frame(0), overflowed(false)
+{
+    memset(index, 0, sizeof(index));
+    memset(pages, 0, sizeof(pages));
+    resetStats();
+}
+
+void GlyphAtlas::init()
+{
+#if TOUCHGFX_GLYPH_ATLAS_PAGES > 0
+    instance = this;
+#endif
+}
+
+void GlyphAtlas::frameStarted()
+{
+    frame++;
+    if (!overflowed)
+    {
+        return;
+    }
+    overflowed = false;
+
+    uint8_t oldest = 0;
+    for (uint8_t i = 1; i < TOUCHGFX_GLYPH_ATLAS_PAGES; i++)
+    {
+        if (pages[i].lastUsed < pages[oldest].lastUsed)
+        {
+            oldest = i;
+        }
+    }
+    evict(oldest);
+    stats.evictions++;
+}
+
+void GlyphAtlas::clear()
+{
+    numEntries = 0;
+    memset(index, 0, sizeof(index));
+    memset(pages, 0, sizeof(pages));
+    overflowed = false;
+    HybridLCDGPU2D::sourcesMoved();
+}
+
+void GlyphAtlas::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+bool GlyphAtlas::find(const uint8_t* glyphData, uint16_t width, uint16_t height, Location& location)
+{
+    return instance != 0 && instance->lookup(glyphData, width, height, location);
+}
+
+bool GlyphAtlas::lookup(const uint8_t* glyphData, uint16_t width, uint16_t height, Location& location)
+{
+#if TOUCHGFX_GLYPH_ATLAS_PAGES > 0
+    uint16_t i = slot(glyphData);
+    while (index[i] != 0)
+    {
+        const Entry& entry = entries[index[i] - 1];
+        if (entry.data == glyphData)
+        {
+            pages[entry.page].lastUsed = frame;
+            location.page = reinterpret_cast<const uint8_t*>(atlasPages[entry.page]);
+            location.x = entry.x;
+            location.y = entry.y;
+            stats.hits++;
+            return true;
+        }
+        i = (i + 1) & (INDEX_SIZE - 1);
+    }
+
+    uint8_t page;
+    uint16_t x;
+    uint16_t y;
+    if (numEntries == TOUCHGFX_GLYPH_ATLAS_ENTRIES || !place(width, height, page, x, y))
+    {
+        overflowed = true;
+        stats.overflows++;
+        return false;
+    }
+
+    // Rows start on a byte in the glyph data, and glyphs start on an even pixel in the
+    // page, so every row is copied whole
+    const uint32_t rowBytes = (width + 1) / 2;
+    uint8_t* const pixels = reinterpret_cast<uint8_t*>(atlasPages[page]) + y * PAGE_STRIDE + x / 2;
+    for (uint16_t row = 0; row < height; row++)
+    {
+        memcpy(pixels + row * PAGE_STRIDE, glyphData + row * rowBytes, rowBytes);
+    }
+    DCacheMaintenance::clean(pixels, height * PAGE_STRIDE);
+
+    Entry& entry = entries[numEntries++];
+    entry.data = glyphData;
+    entry.x = x;
+    entry.y = y;
+    entry.page = page;
+    index[i] = numEntries;
+    pages[page].lastUsed = frame;
+    stats.added++;
+
+    location.page = reinterpret_cast<const uint8_t*>(atlasPages[page]);
+    location.x = x;
+    location.y = y;
+    return true;
+#else
+    (void)glyphData;
+    (void)width;
+    (void)height;
+    (void)location;
+    return false;
+#endif
+}
+
+bool GlyphAtlas::place(uint16_t width, uint16_t height, uint8_t& page, uint16_t& x, uint16_t& y)
+{
+    const uint16_t paddedWidth = (width + 1) & ~1U;
+    if (paddedWidth > TOUCHGFX_GLYPH_ATLAS_PAGE_WIDTH || height > TOUCHGFX_GLYPH_ATLAS_PAGE_HEIGHT)
+    {
+        return false;
+    }
+
+    // The shelf that wastes the fewest lines, on any page
+    Shelf* best = 0;
+    for (uint8_t p = 0; p < TOUCHGFX_GLYPH_ATLAS_PAGES; p++)
+    {
+        for (uint8_t s = 0; s < pages[p].numShelves; s++)
+        {
+            Shelf& shelf = pages[p].shelves[s];
+            if (shelf.height >= height && shelf.height <= height + SHELF_SLACK
+                && shelf.used + paddedWidth <= TOUCHGFX_GLYPH_ATLAS_PAGE_WIDTH
+                && (best == 0 || shelf.height < best->height))
+            {
+                best = &shelf;
+                page = p;
+            }
+        }
+    }
+
+    if (best == 0)
+    {
+        // Open a new shelf on the first page with room for it
+        for (uint8_t p = 0; p < TOUCHGFX_GLYPH_ATLAS_PAGES && best == 0; p++)
+        {
+            Page& candidate = pages[p];
+            if (candidate.numShelves < MAX_SHELVES && candidate.used + height <= TOUCHGFX_GLYPH_ATLAS_PAGE_HEIGHT)
+            {
+                best = &candidate.shelves[candidate.numShelves++];
+                best->y = candidate.used;
+                best->height = height;
+                best->used = 0;
+                candidate.used += height;
+                page = p;
+            }
+        }
+        if (best == 0)
+        {
+            return false;
+        }
+    }
+
+    x = best->used;
+    y = best->y;
+    best->used += paddedWidth;
+    return true;
+}
+
+void GlyphAtlas::evict(uint8_t page)
+{
+    uint16_t kept = 0;
+    for (uint16_t i = 0; i < numEntries; i++)
+    {
+        if (entries[i].page != page)
+        {
+            entries[kept++] = entries[i];
+        }
+    }
+    numEntries = kept;
+    memset(&pages[page], 0, sizeof(pages[page]));
+    pages[page].lastUsed = frame;
+    rebuildIndex();
+    // Recorded commands may draw glyphs from the page
+    HybridLCDGPU2D::sourcesMoved();
+}
+
+void GlyphAtlas::rebuildIndex()
+{
+    memset(index, 0, sizeof(index));
+    for (uint16_t e = 0; e < numEntries; e++)
+    {
+        uint16_t i = slot(entries[e].data);
+        while (index[i] != 0)
+        {
+            i = (i + 1) & (INDEX_SIZE - 1);
+        }
+        index[i] = e + 1;
+    }
+}
+
+uint16_t GlyphAtlas::slot(const uint8_t* glyphData) const
+{
+    // Glyph data is byte aligned, Fibonacci hashing spreads the low bits
+    return (uint16_t)(((uint32_t)(uintptr_t)glyphData * 2654435761U) >> 22);
+}
+} // namespace touchgfx
+
+/* USER CODE END GlyphAtlas.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,200 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : GlyphAtlas.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef GLYPHATLAS_HPP
+#define GLYPHATLAS_HPP
+
+#include <stdint.h>
+
+/* USER CODE BEGIN GlyphAtlas.hpp */
+
+/**
+ * Number of A4 texture pages in PSRAM that glyphs are packed into, 0 to draw every glyph
+ * from flash on its own.
+ */
+#ifndef TOUCHGFX_GLYPH_ATLAS_PAGES
+#define TOUCHGFX_GLYPH_ATLAS_PAGES 4
+#endif
+
+/**
+ * Size in pixels of a texture page. A 512x128 A4 page takes 32 KB of PSRAM and holds about
+ * 40 glyphs of the 40 pixel font. The width must be a multiple of 64 pixels.
+ */
+#ifndef TOUCHGFX_GLYPH_ATLAS_PAGE_WIDTH
+#define TOUCHGFX_GLYPH_ATLAS_PAGE_WIDTH 512
+#endif
+
+#ifndef TOUCHGFX_GLYPH_ATLAS_PAGE_HEIGHT
+#define TOUCHGFX_GLYPH_ATLAS_PAGE_HEIGHT 128
+#endif
+
+/**
+ * Number of glyphs kept in the atlas.
+ */
+#ifndef TOUCHGFX_GLYPH_ATLAS_ENTRIES
+#define TOUCHGFX_GLYPH_ATLAS_ENTRIES 512
+#endif
+
+namespace touchgfx
+{
+/**
+ * @class GlyphAtlas
+ *
+ * @brief Packs the glyphs drawn into texture pages, so GPU2D draws a string from one texture.
+ *
+ *        Glyphs are stored one by one in flash, so LCDGPU2D binds a new texture for every
+ *        glyph it draws. The first time a 4bpp glyph is drawn, it is copied from flash into
+ *        the free space of one of TOUCHGFX_GLYPH_ATLAS_PAGES A4 pages in PSRAM, packed on
+ *        shelves of glyphs of about the same height. HybridLCDGPU2D then draws the glyphs of
+ *        a string that are on the same page as sub-rectangles of that page, with a single
+ *        texture binding and blend setup.
+ *
+ *        Glyphs are only added while drawing, in space no recorded GPU2D command reads. When
+ *        a glyph did not fit, frameStarted() clears the least recently used page, while GPU2D
+ *        is idle, so the glyphs of the next frame can be added again.
+ */
+class GlyphAtlas
+{
+public:
+    /** Width of a page in bytes. */
+    static const uint32_t PAGE_STRIDE = TOUCHGFX_GLYPH_ATLAS_PAGE_WIDTH / 2;
+
+    /** Where a glyph is stored. */
+    struct Location
+    {
+        const uint8_t* page; ///< The A4 page, TOUCHGFX_GLYPH_ATLAS_PAGE_WIDTH pixels wide
+        uint16_t x;          ///< Left edge of the glyph in the page
+        uint16_t y;          ///< Top edge of the glyph in the page
+    };
+
+    /** Lookups and evictions since the last reset. */
+    struct Stats
+    {
+        uint32_t hits;      ///< Glyphs drawn from the atlas
+        uint32_t added;     ///< Glyphs copied into the atlas
+        uint32_t overflows; ///< Glyphs drawn from flash as the atlas was full
+        uint32_t evictions; ///< Pages cleared to make room
+    };
+
+    GlyphAtlas();
+
+    /**
+     * @fn void GlyphAtlas::init();
+     *
+     * @brief Makes this the atlas that find() uses. Called once PSRAM is mapped.
+     */
+    void init();
+
+    /**
+     * @fn void GlyphAtlas::frameStarted();
+     *
+     * @brief Clears the least recently used page if a glyph did not fit in the previous
+     *        frame. Called while GPU2D is idle, as it overwrites glyphs.
+     */
+    void frameStarted();
+
+    /**
+     * @fn void GlyphAtlas::clear();
+     *
+     * @brief Removes all glyphs. Called while GPU2D is idle.
+     */
+    void clear();
+
+    /**
+     * @fn const Stats& GlyphAtlas::getStats() const;
+     *
+     * @brief Gets the lookup statistics.
+     *
+     * @return The lookup statistics.
+     */
+    const Stats& getStats() const
+    {
+        return stats;
+    }
+
+    /**
+     * @fn void GlyphAtlas::resetStats();
+     *
+     * @brief Resets the lookup statistics.
+     */
+    void resetStats();
+
+    /**
+     * @fn static bool GlyphAtlas::find(const uint8_t* glyphData, uint16_t width, uint16_t height, Location& location);
+     *
+     * @brief Finds a glyph in the atlas, copying it in if it is not there yet.
+     *
+     * @param      glyphData The 4bpp glyph data in flash, every row starting in a new byte.
+     * @param      width     Width of the glyph.
+     * @param      height    Height of the glyph.
+     * @param [out] location Where the glyph is stored.
+     *
+     * @return false if there is no atlas or no room for the glyph.
+     */
+    static bool find(const uint8_t* glyphData, uint16_t width, uint16_t height, Location& location);
+
+private:
+    static const uint16_t INDEX_SIZE = 1024;
+    static const uint8_t MAX_SHELVES = 32;
+
+    struct Entry
+    {
+        const uint8_t* data;
+        uint16_t x;
+        uint16_t y;
+        uint8_t page;
+    };
+
+    /** A row of glyphs of about the same height. */
+    struct Shelf
+    {
+        uint16_t y;
+        uint16_t height;
+        uint16_t used; ///< Width taken by the glyphs on the shelf
+    };
+
+    struct Page
+    {
+        Shelf shelves[MAX_SHELVES];
+        uint8_t numShelves;
+        uint16_t used;     ///< Height taken by the shelves
+        uint32_t lastUsed; ///< Frame a glyph on the page was last drawn in
+    };
+
+    bool lookup(const uint8_t* glyphData, uint16_t width, uint16_t height, Location& location);
+    bool place(uint16_t width, uint16_t height, uint8_t& page, uint16_t& x, uint16_t& y);
+    void evict(uint8_t page);
+    void rebuildIndex();
+    uint16_t slot(const uint8_t* glyphData) const;
+
+    Entry entries[TOUCHGFX_GLYPH_ATLAS_ENTRIES];
+    uint16_t index[INDEX_SIZE]; ///< Entry + 1 by hashed glyph data, 0 if free
+    uint16_t numEntries;
+    Page pages[TOUCHGFX_GLYPH_ATLAS_PAGES > 0 ? TOUCHGFX_GLYPH_ATLAS_PAGES : 1];
+    uint32_t frame;
+    bool overflowed; ///< A glyph did not fit in the current frame
+    Stats stats;
+
+    static GlyphAtlas* instance;
+};
+} // namespace touchgfx
+
+/* USER CODE END GlyphAtlas.hpp */
+
+#endif // GLYPHATLAS_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
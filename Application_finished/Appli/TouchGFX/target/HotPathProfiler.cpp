@@ -0,0 +1,124 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : HotPathProfiler.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include <HotPathProfiler.hpp>
+
+/* USER CODE BEGIN HotPathProfiler.cpp */
+#include <touchgfx/hal/Config.hpp>
+#include <TraceOutput.hpp>
+#include <string.h>
+
+#include "stm32h7rsxx.h"
+
+namespace
+{
+// The code that can run: ITCM and the application part of external flash
+const uint32_t ITCM_START = ITCM_BASE;
+const uint32_t CODE_START = 0x70000000U;
+const uint32_t CODE_SIZE = 0x00200000U;
+
+const uint32_t ITCM_BUCKETS = ITCM_SIZE >> TOUCHGFX_HOTPATH_BUCKET_SHIFT;
+const uint32_t BUCKETS = ITCM_BUCKETS + (CODE_SIZE >> TOUCHGFX_HOTPATH_BUCKET_SHIFT);
+
+#if TOUCHGFX_HOTPATH_PROFILE
+// Too large for AXI SRAM, placed with the framebuffers in PSRAM
+LOCATION_PRAGMA_NOLOAD("TouchGFX_Framebuffer")
+uint32_t histogram[BUCKETS] LOCATION_ATTRIBUTE_NOLOAD("TouchGFX_Framebuffer");
+#endif
+}
+
+#if TOUCHGFX_HOTPATH_PROFILE
+extern "C" void vApplicationTickHook(void)
+{
+    // The tick has the lowest priority, so it only interrupts tasks, which stack their
+    // exception frame on the process stack; the return address is the seventh word of it
+    const uint32_t* const frame = reinterpret_cast<const uint32_t*>(__get_PSP());
+    touchgfx::HotPathProfiler::sampleFromISR(frame[6]);
+}
+#endif
+
+namespace touchgfx
+{
+HotPathProfiler* HotPathProfiler::instance = 0;
+
+HotPathProfiler::HotPathProfiler()
+    : samples(0), outside(0)
+{
+}
+
+void HotPathProfiler::sample(uint32_t pc)
+{
+#if TOUCHGFX_HOTPATH_PROFILE
+    uint32_t bucket;
+    if (pc - ITCM_START < ITCM_SIZE)
+    {
+        bucket = (pc - ITCM_START) >> TOUCHGFX_HOTPATH_BUCKET_SHIFT;
+    }
+    else if (pc - CODE_START < CODE_SIZE)
+    {
+        bucket = ITCM_BUCKETS + ((pc - CODE_START) >> TOUCHGFX_HOTPATH_BUCKET_SHIFT);
+    }
+    else
+    {
+        outside = outside + 1;
+        return;
+    }
+    histogram[bucket]++;
+    samples = samples + 1;
+#else
+    (void)pc;
+#endif
+}
+
+void HotPathProfiler::report()
+{
+#if TOUCHGFX_HOTPATH_PROFILE
+    tracePrintf("hot path: bucket=%lu samples=%lu outside=%lu",
+                (unsigned long)(1U << TOUCHGFX_HOTPATH_BUCKET_SHIFT),
+                (unsigned long)samples,
+                (unsigned long)outside);
+    for (uint32_t i = 0; i < BUCKETS; i++)
+    {
+        const uint32_t count = histogram[i];
+        if (count == 0)
+        {
+            continue;
+        }
+        const uint32_t address = (i < ITCM_BUCKETS)
+                                 ? ITCM_START + (i << TOUCHGFX_HOTPATH_BUCKET_SHIFT)
+                                 : CODE_START + ((i - ITCM_BUCKETS) << TOUCHGFX_HOTPATH_BUCKET_SHIFT);
+        tracePrintf("hot path: pc=0x%08lx samples=%lu", (unsigned long)address, (unsigned long)count);
+    }
+#endif
+    reset();
+}
+
+void HotPathProfiler::reset()
+{
+#if TOUCHGFX_HOTPATH_PROFILE
+    // A sample counted while clearing is lost or kept, both are noise in a profile
+    memset(histogram, 0, sizeof(histogram));
+    samples = 0;
+    outside = 0;
+#endif
+}
+} // namespace touchgfx
+
+/* USER CODE END HotPathProfiler.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
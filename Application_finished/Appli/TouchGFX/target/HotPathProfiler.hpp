@@ -0,0 +1,127 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : HotPathProfiler.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef HOTPATHPROFILER_HPP
+#define HOTPATHPROFILER_HPP
+
+#include <stdint.h>
+
+/* USER CODE BEGIN HotPathProfiler.hpp */
+
+/**
+ * Set to 1, for every source file including the FreeRTOS kernel, to build the instrumented
+ * firmware that samples the running code from the FreeRTOS tick. The profile it reports is
+ * turned into ITCM and DTCM placements by gcc/hotpath.py.
+ */
+#ifndef TOUCHGFX_HOTPATH_PROFILE
+#define TOUCHGFX_HOTPATH_PROFILE 0
+#endif
+
+/**
+ * Log2 of the bytes of code counted together. The histogram of 32 byte buckets covering
+ * ITCM and the application in external flash takes 264 KB of PSRAM.
+ */
+#ifndef TOUCHGFX_HOTPATH_BUCKET_SHIFT
+#define TOUCHGFX_HOTPATH_BUCKET_SHIFT 5
+#endif
+
+namespace touchgfx
+{
+/**
+ * @class HotPathProfiler
+ *
+ * @brief Statistical profile of the code run by the tasks.
+ *
+ *        Every FreeRTOS tick, the program counter stacked by the task that the tick
+ *        interrupted is counted in a histogram of code addresses in ITCM and in the
+ *        application part of external flash. Time spent in interrupt handlers is not
+ *        sampled, as the tick has the lowest priority.
+ *
+ *        report() writes the histogram over SWO. gcc/hotpath.py maps it onto the input
+ *        sections of the linker map file of the same build and generates the linker
+ *        fragments that place the hottest functions in ITCM and their constants in DTCM.
+ */
+class HotPathProfiler
+{
+public:
+    HotPathProfiler();
+
+    /**
+     * @fn void HotPathProfiler::sample(uint32_t pc);
+     *
+     * @brief Counts a program counter. Called from the FreeRTOS tick.
+     *
+     * @param pc The address of the interrupted instruction.
+     */
+    void sample(uint32_t pc);
+
+    /**
+     * @fn void HotPathProfiler::report();
+     *
+     * @brief Writes the nonzero buckets of the histogram over SWO and clears it.
+     *
+     *        The first line gives the bucket size and the number of samples, counted and
+     *        outside the profiled code. Every other line gives the start address of a
+     *        bucket and its samples.
+     */
+    void report();
+
+    /**
+     * @fn void HotPathProfiler::reset();
+     *
+     * @brief Clears the histogram.
+     */
+    void reset();
+
+    /**
+     * @fn static void HotPathProfiler::sampleFromISR(uint32_t pc);
+     *
+     * @brief Calls sample() on the profiler of the HAL, if any.
+     *
+     * @param pc The address of the interrupted instruction.
+     */
+    static void sampleFromISR(uint32_t pc)
+    {
+        if (instance != 0)
+        {
+            instance->sample(pc);
+        }
+    }
+
+    /**
+     * @fn void HotPathProfiler::registerInstance();
+     *
+     * @brief Makes this the profiler that sampleFromISR() counts samples for.
+     */
+    void registerInstance()
+    {
+        instance = this;
+    }
+
+private:
+    volatile uint32_t samples; ///< Samples counted in the histogram
+    volatile uint32_t outside; ///< Samples outside ITCM and the application code
+
+    static HotPathProfiler* instance;
+};
+} // namespace touchgfx
+
+/* USER CODE END HotPathProfiler.hpp */
+
+#endif // HOTPATHPROFILER_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
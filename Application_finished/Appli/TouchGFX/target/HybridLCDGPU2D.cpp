@@ -0,0 +1,2246 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : HybridLCDGPU2D.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include <HybridLCDGPU2D.hpp>
+
+/* USER CODE BEGIN HybridLCDGPU2D.cpp */
+#include <string.h>
+
+#include <nema_cmdlist.h>
+#include <nema_hal_ext.h>
+#include <nema_core.h>
+#include <nema_transitions.h>
+#include <nema_vg_context.h>
+#include <nema_vg_tsvg.h>
+#include <touchgfx/transforms/DisplayTransformation.hpp>
+#include <CortexMMCUInstrumentation.hpp>
+#include <DCacheMaintenance.hpp>
+#include <GlyphAtlas.hpp>
+#include <OverdrawHeatmap.hpp>
+#include <PixelConversion.hpp>
+#include <QualityGovernor.hpp>
+#include <TextureCache.hpp>
+#include <TextureMipChain.hpp>
+#include <math.h>
+
+#include "stm32h7rsxx.h"
+
+namespace
+{
+// Default costs of the operations, in CPU cycles, until calibrateCosts() measures them.
+// DMA2D takes over from GPU2D at HYBRID_BLIT_DMA2D_MIN_PIXELS, the CPU only for tiny
+// operations with nothing pending on the other engines.
+const uint32_t CPU_SETUP_CYCLES = 64;
+const uint32_t GPU2D_SETUP_CYCLES = 200;
+const uint32_t DEFAULT_SYNC_CYCLES = 3000;
+// Cycles per 64 pixels of each operation on the CPU, DMA2D and GPU2D
+const uint32_t DEFAULT_PIXEL_CYCLES[touchgfx::HybridLCDGPU2D::NUMBER_OF_COSTED_OPERATIONS][touchgfx::HybridLCDGPU2D::NUMBER_OF_ENGINES] =
+{
+    { 96, 32, 40 },  // COST_FILL
+    { 640, 0, 48 },  // COST_FILL_BLEND
+    { 160, 64, 72 }  // COST_COPY_RGB565
+};
+// Sides of the squares calibrateCosts() measures
+const int16_t CALIBRATION_SIDES[2] = { 4, 64 };
+
+uint16_t blend565(uint16_t destination, uint16_t red, uint16_t green, uint16_t blue, uint8_t alpha)
+{
+    const uint16_t inverse = 255 - alpha;
+    const uint16_t r = (red * alpha + ((destination >> 11) & 0x1F) * inverse) / 255;
+    const uint16_t g = (green * alpha + ((destination >> 5) & 0x3F) * inverse) / 255;
+    const uint16_t b = (blue * alpha + (destination & 0x1F) * inverse) / 255;
+    return (uint16_t)((r << 11) | (g << 5) | b);
+}
+} // namespace
+
+namespace touchgfx
+{
+HybridLCDGPU2D* HybridLCDGPU2D::instance = 0;
+const uint32_t HybridLCDGPU2D::UNAVAILABLE;
+
+HybridLCDGPU2D::HybridLCDGPU2D(DMA_Interface& dmaInterface)
+    : LCDGPU2D_AXI(),
+      dma(dmaInterface),
+      gpu2dSourceStart(0),
+      gpu2dSourceEnd(0),
+      syncCycles(DEFAULT_SYNC_CYCLES),
+      dma2dPending(false),
+      trafficDepth(0),
+      glyphCount(0),
+      glyphPage(0),
+      glyphColor(0),
+      glyphAlpha(255),
+      fillCount(0),
+      fillBlended(false),
+      blitCount(0),
+      blitBatchCount(0),
+      recording(0),
+      recordingArea(),
+      recordingCapacity(0),
+      recordedCount(0),
+      maskTarget(0),
+      maskFailed(false),
+      snapshotCount(0),
+      fragmentsCreated(false),
+      fragmentCount(0),
+      fragmentRecording(0),
+      fragmentCaller(0),
+      fragmentUses(0),
+      fragmentFrame(0),
+      kickCaller(0),
+      callerKick(0),
+      kicks(0),
+      kickListsCreated(false),
+      stencilTileTarget(0),
+      stencilTile(),
+      stencilTileFormat(0)
+{
+    resetStats();
+    memset(kickLists, 0, sizeof(kickLists));
+    kickOfList[0] = 0;
+    kickOfList[1] = 0;
+    for (int operation = 0; operation < NUMBER_OF_COSTED_OPERATIONS; operation++)
+    {
+        const uint32_t* const pixelCycles = DEFAULT_PIXEL_CYCLES[operation];
+        costs[operation][ENGINE_CPU].setupCycles = CPU_SETUP_CYCLES;
+        costs[operation][ENGINE_CPU].cyclesPer64Pixels = pixelCycles[ENGINE_CPU];
+        costs[operation][ENGINE_GPU2D].setupCycles = GPU2D_SETUP_CYCLES;
+        costs[operation][ENGINE_GPU2D].cyclesPer64Pixels = pixelCycles[ENGINE_GPU2D];
+        // Costs as much as GPU2D at HYBRID_BLIT_DMA2D_MIN_PIXELS, less above
+        costs[operation][ENGINE_DMA2D].setupCycles = (pixelCycles[ENGINE_DMA2D] == 0) ? UNAVAILABLE
+                                                     : GPU2D_SETUP_CYCLES + HYBRID_BLIT_DMA2D_MIN_PIXELS * (pixelCycles[ENGINE_GPU2D] - pixelCycles[ENGINE_DMA2D]) / 64;
+        costs[operation][ENGINE_DMA2D].cyclesPer64Pixels = pixelCycles[ENGINE_DMA2D];
+    }
+}
+
+void HybridLCDGPU2D::init()
+{
+    LCDGPU2D_AXI::init();
+    instance = this;
+    nema_hal_set_submit_hook(&HybridLCDGPU2D::onCommandListSubmit);
+}
+
+void HybridLCDGPU2D::bindFrameBufferTexture()
+{
+    LCDGPU2D_AXI::bindFrameBufferTexture();
+    if (stencilTileTarget != 0)
+    {
+        // Pixel 0, 0 of the destination is the top left corner of the tile, under the stencil
+        nema_bind_dst_tex((uintptr_t)stencilTileTarget, stencilTile.width, stencilTile.height, stencilTileFormat, framebufferStride());
+    }
+}
+
+void HybridLCDGPU2D::fillRect(const Rect& rect, colortype color, uint8_t alpha)
+{
+    const Rect area = rect & screenRect();
+    const Engine engine = selectEngine(alpha < 255 ? COST_FILL_BLEND : COST_FILL, area);
+    countWrite(area, engine);
+    if (engine == ENGINE_GPU2D && batchFill(area, color, alpha))
+    {
+        return;
+    }
+    flushGlyphs();
+    countTraffic(0, 0, area.area(), alpha < 255);
+    fillOn(engine, rect, area, color, alpha);
+}
+
+void HybridLCDGPU2D::fillOn(Engine engine, const Rect& rect, const Rect& area, colortype color, uint8_t alpha)
+{
+    if (engine == ENGINE_CPU)
+    {
+        cpuFill(area, color, alpha);
+        return;
+    }
+    if (engine == ENGINE_GPU2D)
+    {
+        stats.gpu2dOps++;
+        stats.gpu2dPixels += area.area();
+        trafficDepth++;
+        LCDGPU2D_AXI::fillRect(rect, color, alpha);
+        trafficDepth--;
+        return;
+    }
+
+    BlitOp op = BlitOp();
+    op.operation = BLIT_OP_FILL;
+    op.color = color;
+    op.nSteps = area.width;
+    op.nLoops = area.height;
+    op.dstLoopStride = HAL::FRAME_BUFFER_WIDTH;
+    op.alpha = 255;
+    op.dstFormat = Bitmap::RGB565;
+    queue(op, area);
+}
+
+void HybridLCDGPU2D::blitCopy(const uint16_t* sourceData, const Rect& source, const Rect& blitRect, uint8_t alpha, bool hasTransparentPixels)
+{
+    flushGlyphs();
+    const Rect area = blitRect & source & Rect(0, 0, HAL::FRAME_BUFFER_WIDTH, HAL::FRAME_BUFFER_HEIGHT);
+    const uint8_t* const data = reinterpret_cast<const uint8_t*>(sourceData);
+    const bool isGPU2DSource = data >= gpu2dSourceStart && data < gpu2dSourceEnd;
+    countTraffic(data, CortexMMCUInstrumentation::pixelBytes(Bitmap::RGB565, area.area()), area.area(), alpha < 255 || hasTransparentPixels);
+    if (hasTransparentPixels || isGPU2DSource || alpha < 255)
+    {
+        countWrite(area, ENGINE_GPU2D);
+        stats.gpu2dOps++;
+        stats.gpu2dPixels += area.area();
+        trafficDepth++;
+        LCDGPU2D_AXI::blitCopy(sourceData, source, blitRect, alpha, hasTransparentPixels);
+        trafficDepth--;
+        return;
+    }
+    const Engine engine = selectEngine(COST_COPY_RGB565, area);
+    countWrite(area, engine);
+    copyOn(engine, sourceData, source, blitRect, area);
+}
+
+void HybridLCDGPU2D::copyOn(Engine engine, const uint16_t* sourceData, const Rect& source, const Rect& blitRect, const Rect& area)
+{
+    if (engine == ENGINE_CPU)
+    {
+        cpuCopy(sourceData, source, area);
+        return;
+    }
+    if (engine == ENGINE_GPU2D)
+    {
+        stats.gpu2dOps++;
+        stats.gpu2dPixels += area.area();
+        trafficDepth++;
+        LCDGPU2D_AXI::blitCopy(sourceData, source, blitRect, 255, false);
+        trafficDepth--;
+        return;
+    }
+
+    BlitOp op = BlitOp();
+    op.operation = BLIT_OP_COPY;
+    op.pSrc = sourceData + (area.y - source.y) * source.width + (area.x - source.x);
+    op.nSteps = area.width;
+    op.nLoops = area.height;
+    op.srcLoopStride = source.width;
+    op.dstLoopStride = HAL::FRAME_BUFFER_WIDTH;
+    op.alpha = 255;
+    op.srcFormat = Bitmap::RGB565;
+    op.dstFormat = Bitmap::RGB565;
+
+    // The source may have been written by the CPU, e.g. a snapshot in cached RAM
+    DCacheMaintenance::clean(op.pSrc, ((area.height - 1) * source.width + area.width) * 2);
+    queue(op, area);
+}
+
+void HybridLCDGPU2D::blitCopy(const uint8_t* sourceData, Bitmap::BitmapFormat sourceFormat, const Rect& source, const Rect& blitRect, uint8_t alpha, bool hasTransparentPixels)
+{
+    flushGlyphs();
+    const uint32_t pixels = (blitRect & source).area();
+    countTraffic(sourceData, CortexMMCUInstrumentation::pixelBytes(sourceFormat, pixels), pixels, alpha < 255 || hasTransparentPixels);
+    countWrite(blitRect & source, ENGINE_GPU2D);
+    trafficDepth++;
+    LCDGPU2D_AXI::blitCopy(sourceData, sourceFormat, source, blitRect, alpha, hasTransparentPixels);
+    trafficDepth--;
+}
+
+void HybridLCDGPU2D::drawPartialBitmap(const Bitmap& bitmap, int16_t x, int16_t y, const Rect& rect, uint8_t alpha, bool useOptimized)
+{
+    const uint32_t pixels = (rect & Rect(0, 0, bitmap.getWidth(), bitmap.getHeight())).area();
+    uint32_t bytes = CortexMMCUInstrumentation::pixelBytes(bitmap.getFormat(), pixels);
+    if (bitmap.getExtraData() != 0 && bitmap.getFormat() == Bitmap::RGB565)
+    {
+        // Separate 8-bit alpha channel
+        bytes += pixels;
+    }
+    if (trafficDepth == 0)
+    {
+        // A QOI compressed bitmap is decoded by the CPU here, and blitted by GPU2D from
+        // its expanded copy in the cache from the next frame
+        TextureCache::sampled(bitmap.getId(), pixels);
+    }
+    countTraffic(bitmap.getData(), bytes, pixels, alpha < 255 || bitmap.hasTransparentPixels());
+    Rect drawn = rect & Rect(0, 0, bitmap.getWidth(), bitmap.getHeight());
+    drawn.x += x;
+    drawn.y += y;
+    countWrite(drawn, ENGINE_GPU2D);
+    if (batchBlit(bitmap, x, y, rect, alpha))
+    {
+        return;
+    }
+    flushGlyphs();
+    if ((bitmap.getFormat() == Bitmap::L8 || TextureCache::isPremultiplied(bitmap.getData())) && blitSource(bitmap, x, y, rect, alpha))
+    {
+        return;
+    }
+    trafficDepth++;
+    LCDGPU2D_AXI::drawPartialBitmap(bitmap, x, y, rect, alpha, useOptimized);
+    trafficDepth--;
+}
+
+bool HybridLCDGPU2D::blitSource(const Bitmap& bitmap, int16_t x, int16_t y, const Rect& rect, uint8_t alpha)
+{
+    SourceFormat source;
+    const uint8_t* const data = bitmap.getData();
+    if (data == 0 || !sourceFormat(bitmap, source))
+    {
+        return false;
+    }
+    Rect dest = rect & Rect(0, 0, bitmap.getWidth(), bitmap.getHeight());
+    dest.x += x;
+    dest.y += y;
+    const Rect area = dest & screenRect();
+    if (alpha == 0 || area.isEmpty())
+    {
+        return true;
+    }
+
+    // GPU2D reads the indices and looks the colors up in the palette, no CPU or DMA2D pass
+    bindFrameBufferTexture();
+    setClip(area);
+    bindSource(source, data, bitmap.getWidth(), bitmap.getHeight(), bitmap.getWidth(), NEMA_FILTER_PS | NEMA_TEX_CLAMP);
+    const bool blends = alpha < 255 || source.translucent;
+    setBlitBlend(source, blends, alpha);
+    blitSubrect(area, area.x - x, area.y - y);
+
+    stats.gpu2dOps++;
+    stats.gpu2dPixels += area.area();
+    if (source.palette != 0)
+    {
+        stats.indexedBitmaps++;
+    }
+    if (HAL::DISPLAY_ROTATION != rotate0)
+    {
+        stats.rotated++;
+    }
+    return true;
+}
+
+bool HybridLCDGPU2D::batchBlit(const Bitmap& bitmap, int16_t x, int16_t y, const Rect& rect, uint8_t alpha)
+{
+#if HYBRID_BLIT_SORT_SIZE > 0
+    SourceFormat source;
+    const uint8_t* const data = bitmap.getData();
+    if (HAL::getInstance()->getFrameRefreshStrategy() == HAL::REFRESH_STRATEGY_PARTIAL_FRAMEBUFFER
+            || data == 0
+            || !sourceFormat(bitmap, source))
+    {
+        return false;
+    }
+    // Opaque copies are left to the dispatch, which may give them to DMA2D or the CPU
+    if (alpha == 255 && !source.translucent)
+    {
+        return false;
+    }
+    Rect dest = rect & Rect(0, 0, bitmap.getWidth(), bitmap.getHeight());
+    dest.x += x;
+    dest.y += y;
+    const Rect area = dest & screenRect();
+    if (alpha == 0 || area.isEmpty())
+    {
+        return true;
+    }
+    if (glyphCount > 0)
+    {
+        flushGlyphs();
+    }
+    flushFills();
+
+    // The last batch of the bitmap, unless a batch after it overlaps the blit
+    int batch = -1;
+    for (int i = blitBatchCount - 1; i >= 0; i--)
+    {
+        const BlitBatch& held = blitBatches[i];
+        if (held.data == data && held.alpha == alpha)
+        {
+            batch = i;
+            break;
+        }
+        if (held.bounds.intersect(area))
+        {
+            break;
+        }
+    }
+    if (batch < 0 && blitBatchCount == HYBRID_BLIT_SORT_BATCHES)
+    {
+        flushBlits();
+    }
+    else if (blitCount == HYBRID_BLIT_SORT_SIZE)
+    {
+        flushBlits();
+        batch = -1;
+    }
+    if (batch < 0)
+    {
+        batch = blitBatchCount++;
+        BlitBatch& added = blitBatches[batch];
+        added.data = data;
+        added.source = source;
+        added.width = bitmap.getWidth();
+        added.height = bitmap.getHeight();
+        added.alpha = alpha;
+        added.bounds = area;
+        added.first = blitCount;
+    }
+    else
+    {
+        BlitBatch& joined = blitBatches[batch];
+        blitQuads[joined.last].next = blitCount;
+        joined.bounds.expandToFit(area);
+        if (batch != blitBatchCount - 1)
+        {
+            stats.reorderedBlits++;
+        }
+    }
+    blitBatches[batch].last = blitCount;
+
+    BlitQuad& quad = blitQuads[blitCount++];
+    quad.x = area.x;
+    quad.y = area.y;
+    quad.width = area.width;
+    quad.height = area.height;
+    quad.u = area.x - x;
+    quad.v = area.y - y;
+    quad.next = HYBRID_BLIT_SORT_SIZE;
+
+    stats.gpu2dOps++;
+    stats.gpu2dPixels += area.area();
+    if (source.palette != 0)
+    {
+        stats.indexedBitmaps++;
+    }
+    return true;
+#else
+    (void)bitmap;
+    (void)x;
+    (void)y;
+    (void)rect;
+    (void)alpha;
+    return false;
+#endif
+}
+
+void HybridLCDGPU2D::flushBlits()
+{
+#if HYBRID_BLIT_SORT_SIZE > 0
+    if (blitCount == 0)
+    {
+        return;
+    }
+    // Binding the framebuffer may lock it, which flushes again
+    const uint8_t count = blitCount;
+    const uint8_t batches = blitBatchCount;
+    blitCount = 0;
+    blitBatchCount = 0;
+
+    bindFrameBufferTexture();
+    nema_set_clip(0, 0, HAL::FRAME_BUFFER_WIDTH, HAL::FRAME_BUFFER_HEIGHT);
+    for (uint8_t i = 0; i < batches; i++)
+    {
+        const BlitBatch& batch = blitBatches[i];
+        bindSource(batch.source, batch.data, batch.width, batch.height, batch.width, NEMA_FILTER_PS | NEMA_TEX_CLAMP);
+        setBlitBlend(batch.source, true, batch.alpha);
+        for (uint8_t q = batch.first; q < HYBRID_BLIT_SORT_SIZE; q = blitQuads[q].next)
+        {
+            const BlitQuad& quad = blitQuads[q];
+            blitSubrect(Rect(quad.x, quad.y, quad.width, quad.height), quad.u, quad.v);
+        }
+    }
+    stats.blitBatches += batches;
+    stats.sortedBlits += count;
+    if (HAL::DISPLAY_ROTATION != rotate0)
+    {
+        stats.rotated++;
+    }
+#endif
+}
+
+uint16_t* HybridLCDGPU2D::copyFrameBufferRegionToMemory(const Rect& visRegion, const Rect& absRegion, const BitmapId bitmapId)
+{
+    uint16_t* const data = copyFrameBufferRegionToMemoryAsync(visRegion, absRegion, bitmapId);
+    finishSnapshots();
+    return data;
+}
+
+uint16_t* HybridLCDGPU2D::copyFrameBufferRegionToMemoryAsync(const Rect& visRegion, const Rect& absRegion, const BitmapId bitmapId, GenericCallback<BitmapId>* done)
+{
+    flushGlyphs();
+    const Bitmap bitmap(bitmapId);
+    uint16_t* const data = reinterpret_cast<uint16_t*>(const_cast<uint8_t*>(bitmap.getData()));
+    // The part of the bitmap covered by visRegion, clipped as LCD16bpp does
+    const Rect area = Rect(visRegion.x - absRegion.x, visRegion.y - absRegion.y, visRegion.width, visRegion.height)
+                      & Rect(0, 0, bitmap.getWidth(), bitmap.getHeight());
+    if (!HYBRID_BLIT_DISPATCH
+        || data == 0
+        || area.isEmpty()
+        || framebufferFormat() != Bitmap::RGB565
+        || !PixelConversion::isConvertedByDMA2D(Bitmap::RGB565, bitmap.getFormat())
+        || HAL::DISPLAY_ROTATION != rotate0
+        || HAL::getInstance()->getFrameRefreshStrategy() == HAL::REFRESH_STRATEGY_PARTIAL_FRAMEBUFFER)
+    {
+        uint16_t* const result = LCDGPU2D_AXI::copyFrameBufferRegionToMemory(visRegion, absRegion, bitmapId);
+        if (done != 0 && done->isValid())
+        {
+            done->execute(bitmapId);
+        }
+        return result;
+    }
+
+    if (snapshotCount == HYBRID_SNAPSHOT_QUEUE_SIZE)
+    {
+        finishSnapshots();
+    }
+
+    // The displayed framebuffer may still be drawn by the command list of the last frame,
+    // and the commands recorded so far may draw to the bitmap
+    waitForGPU2D();
+
+    // An RGB888 or ARGB8888 bitmap is converted by the copy, the alpha of ARGB8888 set to 255
+    const Bitmap::BitmapFormat format = bitmap.getFormat();
+    const uint16_t bitmapWidth = bitmap.getWidth();
+    const uint16_t* const source = HAL::getInstance()->getTFTFrameBuffer() + (absRegion.y + area.y) * HAL::FRAME_BUFFER_WIDTH + absRegion.x + area.x;
+    uint8_t* const destination = reinterpret_cast<uint8_t*>(data) + CortexMMCUInstrumentation::pixelBytes(format, area.y * bitmapWidth + area.x);
+    const uint32_t sourceBytes = ((uint32_t)(area.height - 1) * HAL::FRAME_BUFFER_WIDTH + area.width) * 2;
+    const uint32_t destinationBytes = CortexMMCUInstrumentation::pixelBytes(format, (uint32_t)(area.height - 1) * bitmapWidth + area.width);
+
+    // Only the lines of the region: pixels written by the CPU are written back before DMA2D
+    // reads them, and no dirty line of the bitmap may be evicted over what DMA2D writes
+    DCacheMaintenance::clean(source, sourceBytes);
+    DCacheMaintenance::cleanInvalidate(destination, destinationBytes);
+
+    BlitOp op = BlitOp();
+    op.operation = BLIT_OP_COPY;
+    op.pSrc = source;
+    op.pDst = reinterpret_cast<uint16_t*>(destination);
+    op.nSteps = area.width;
+    op.nLoops = area.height;
+    op.srcLoopStride = HAL::FRAME_BUFFER_WIDTH;
+    op.dstLoopStride = bitmapWidth;
+    op.alpha = 255;
+    op.srcFormat = Bitmap::RGB565;
+    op.dstFormat = format;
+
+    Snapshot& snapshot = snapshots[snapshotCount++];
+    snapshot.id = bitmapId;
+    snapshot.start = destination;
+    snapshot.size = destinationBytes;
+    snapshot.done = done;
+
+#if TOUCHGFX_MEMORY_TRAFFIC
+    CortexMMCUInstrumentation::countRead(source, area.area() * 2);
+    CortexMMCUInstrumentation::countWrite(destination, CortexMMCUInstrumentation::pixelBytes(format, area.area()));
+#endif
+    stats.dma2dOps++;
+    stats.dma2dPixels += area.area();
+    stats.snapshots++;
+    dma2dPending = true;
+    dma.addToQueue(op);
+    return data;
+}
+
+void HybridLCDGPU2D::pollSnapshots()
+{
+    if (snapshotCount > 0 && dma.isDmaQueueEmpty() && !dma.isDMARunning())
+    {
+        completeSnapshots();
+    }
+}
+
+void HybridLCDGPU2D::finishSnapshots()
+{
+    if (snapshotCount > 0)
+    {
+        waitForDMA2D();
+        completeSnapshots();
+    }
+}
+
+void HybridLCDGPU2D::drawGlyph(uint16_t* wbuf16, Rect widgetArea, int16_t x, int16_t y, uint16_t offsetX, uint16_t offsetY, const Rect& invalidatedArea, const GlyphNode* glyph, const uint8_t* glyphData, uint8_t dataFormatA4, colortype color, uint8_t bitsPerPixel, uint8_t alpha, TextRotation rotation)
+{
+    if (maskTarget != 0)
+    {
+        if (widgetArea != recordingArea || !renderGlyphMask(x, y, offsetX, offsetY, glyph, glyphData, dataFormatA4, bitsPerPixel))
+        {
+            maskFailed = true;
+        }
+        return;
+    }
+    if (recording != 0)
+    {
+        // Glyphs placed relative to another area could not be drawn again in a moved widget
+        if (recordedCount < 0)
+        {
+            return;
+        }
+        if (widgetArea != recordingArea)
+        {
+            recordedCount = -2;
+            return;
+        }
+        if (recordedCount == recordingCapacity)
+        {
+            recordedCount = -1;
+            return;
+        }
+        RecordedGlyph& recorded = recording[recordedCount++];
+        recorded.glyph = glyph;
+        recorded.data = glyphData;
+        recorded.x = x;
+        recorded.y = y;
+        recorded.offsetX = offsetX;
+        recorded.offsetY = offsetY;
+        recorded.bitsPerPixel = bitsPerPixel;
+        recorded.dataFormatA4 = dataFormatA4;
+        return;
+    }
+    Rect drawn = Rect(x, y, glyph->width() - offsetX, glyph->height() - offsetY) & invalidatedArea;
+    drawn.x += widgetArea.x;
+    drawn.y += widgetArea.y;
+    countWrite(drawn, ENGINE_GPU2D);
+    if (batchGlyph(widgetArea, x, y, offsetX, offsetY, invalidatedArea, glyph, glyphData, dataFormatA4, color, bitsPerPixel, alpha, rotation))
+    {
+        return;
+    }
+    flushGlyphs();
+
+    const uint32_t pixels = (uint32_t)glyph->width() * glyph->height();
+    const uint32_t bytes = ((uint32_t)glyph->width() * bitsPerPixel + 7) / 8 * glyph->height();
+    countTraffic(glyphData, bytes, pixels, true);
+    trafficDepth++;
+    LCDGPU2D_AXI::drawGlyph(wbuf16, widgetArea, x, y, offsetX, offsetY, invalidatedArea, glyph, glyphData, dataFormatA4, color, bitsPerPixel, alpha, rotation);
+    trafficDepth--;
+}
+
+void HybridLCDGPU2D::drawTextureMapTriangle(const DrawingSurface& dest, const Point3D* vertices, const TextureSurface& texture, const Rect& absoluteRect, const Rect& dirtyAreaAbsolute, RenderingVariant renderVariant, uint8_t alpha, uint16_t subDivisionSize)
+{
+    flushGlyphs();
+    Point3D levelVertices[3];
+    TextureSurface level;
+    const Point3D* sampled = vertices;
+    const TextureSurface* source = &texture;
+    if (TextureMipChain::select(vertices, 3, texture, levelVertices, level))
+    {
+        // Drawn smaller than the texture, sample a lower resolution level instead
+        sampled = levelVertices;
+        source = &level;
+    }
+    const QualityGovernor::Settings& quality = QualityGovernor::current();
+    if (!quality.bilinear)
+    {
+        renderVariant = (RenderingVariant)(renderVariant & ~RenderingVariant_Bilinear);
+    }
+    subDivisionSize = MAX(subDivisionSize, quality.subDivisionSize);
+    countTextureTraffic(sampled, 3, *source, absoluteRect, dirtyAreaAbsolute, renderVariant, alpha);
+    countWrite(dirtyAreaAbsolute, ENGINE_GPU2D);
+    trafficDepth++;
+    LCDGPU2D_AXI::drawTextureMapTriangle(dest, sampled, *source, absoluteRect, dirtyAreaAbsolute, renderVariant, alpha, subDivisionSize);
+    trafficDepth--;
+}
+
+void HybridLCDGPU2D::drawTextureMapQuad(const DrawingSurface& dest, const Point3D* vertices, const TextureSurface& texture, const Rect& absoluteRect, const Rect& dirtyAreaAbsolute, RenderingVariant renderVariant, uint8_t alpha, uint16_t subDivisionSize)
+{
+    flushGlyphs();
+    Point3D levelVertices[4];
+    TextureSurface level;
+    const Point3D* sampled = vertices;
+    const TextureSurface* source = &texture;
+    if (TextureMipChain::select(vertices, 4, texture, levelVertices, level))
+    {
+        // Drawn smaller than the texture, sample a lower resolution level instead
+        sampled = levelVertices;
+        source = &level;
+    }
+    const QualityGovernor::Settings& quality = QualityGovernor::current();
+    if (!quality.bilinear)
+    {
+        renderVariant = (RenderingVariant)(renderVariant & ~RenderingVariant_Bilinear);
+    }
+    subDivisionSize = MAX(subDivisionSize, quality.subDivisionSize);
+    countTextureTraffic(sampled, 4, *source, absoluteRect, dirtyAreaAbsolute, renderVariant, alpha);
+    countWrite(dirtyAreaAbsolute, ENGINE_GPU2D);
+    // The levels of a premultiplied texture are averaged from its premultiplied texels
+    if (TextureCache::isPremultiplied(texture.data) && blitPremultipliedQuad(sampled, *source, absoluteRect, dirtyAreaAbsolute, renderVariant, alpha))
+    {
+        return;
+    }
+    trafficDepth++;
+    LCDGPU2D_AXI::drawTextureMapQuad(dest, sampled, *source, absoluteRect, dirtyAreaAbsolute, renderVariant, alpha, subDivisionSize);
+    trafficDepth--;
+}
+
+bool HybridLCDGPU2D::blitPremultipliedQuad(const Point3D* vertices, const TextureSurface& texture, const Rect& absoluteRect, const Rect& dirtyAreaAbsolute, RenderingVariant renderVariant, uint8_t alpha)
+{
+    // nema_blit_quad_fit() maps the corners of the texture to the corners of the quad in
+    // this order, as TextureMapper passes them when it draws the whole bitmap
+    const float cornerU[4] = { 0.0f, (float)texture.width, (float)texture.width, 0.0f };
+    const float cornerV[4] = { 0.0f, 0.0f, (float)texture.height, (float)texture.height };
+    float x[4];
+    float y[4];
+    for (int i = 0; i < 4; i++)
+    {
+        if (fabsf(vertices[i].U - cornerU[i]) > 1.0f || fabsf(vertices[i].V - cornerV[i]) > 1.0f)
+        {
+            return false;
+        }
+        // Vertices are relative to the widget, in 28.4 fixed point
+        x[i] = absoluteRect.x + vertices[i].X / 16.0f;
+        y[i] = absoluteRect.y + vertices[i].Y / 16.0f;
+    }
+    const Rect area = absoluteRect & dirtyAreaAbsolute & screenRect();
+    if (alpha == 0 || area.isEmpty())
+    {
+        return true;
+    }
+
+    SourceFormat source;
+    source.format = NEMA_BGRA8888;
+    source.bytesPerPixel = 4;
+    source.palette = 0;
+    source.paletteFormat = 0;
+    source.translucent = true;
+    source.premultiplied = true;
+    // Filtering premultiplied texels leaves no dark fringe along the transparent edges
+    const bool bilinear = (renderVariant & RenderingVariant_Bilinear) != 0;
+    bindFrameBufferTexture();
+    setClip(area);
+    bindSource(source, reinterpret_cast<const uint8_t*>(texture.data), texture.width, texture.height, texture.stride,
+               (bilinear ? NEMA_FILTER_BL : NEMA_FILTER_PS) | NEMA_TEX_BORDER);
+    setBlitBlend(source, true, alpha);
+    blitQuad(x[0], y[0], x[1], y[1], x[2], y[2], x[3], y[3]);
+
+    stats.gpu2dOps++;
+    stats.gpu2dPixels += area.area();
+    if (HAL::DISPLAY_ROTATION != rotate0)
+    {
+        stats.rotated++;
+    }
+    return true;
+}
+
+bool HybridLCDGPU2D::drawTextureQuads(const Bitmap& bitmap, const float* corners, uint16_t count, int16_t x, int16_t y, const Rect& clip, uint8_t alpha, bool bilinear)
+{
+    SourceFormat source;
+    bilinear = bilinear && QualityGovernor::current().bilinear;
+    const uint8_t* const data = bitmap.getData();
+    if (data == 0 || !sourceFormat(bitmap, source) || (bilinear && source.palette != 0))
+    {
+        return false;
+    }
+    const Rect area = clip & screenRect();
+    if (count == 0 || alpha == 0 || area.isEmpty())
+    {
+        return true;
+    }
+
+    flushGlyphs();
+    countWrite(area, ENGINE_GPU2D);
+    bindFrameBufferTexture();
+    setClip(area);
+    bindSource(source, data, bitmap.getWidth(), bitmap.getHeight(), bitmap.getWidth(),
+               (bilinear ? NEMA_FILTER_BL : NEMA_FILTER_PS) | NEMA_TEX_BORDER);
+    const bool blends = alpha < 255 || source.translucent || bilinear;
+    setBlitBlend(source, blends, alpha);
+
+    uint32_t pixels = 0;
+    for (uint16_t i = 0; i < count; i++)
+    {
+        const float* const c = corners + i * 8;
+        blitQuad(x + c[0], y + c[1], x + c[2], y + c[3], x + c[4], y + c[5], x + c[6], y + c[7]);
+
+        const float minX = MIN(MIN(c[0], c[2]), MIN(c[4], c[6]));
+        const float maxX = MAX(MAX(c[0], c[2]), MAX(c[4], c[6]));
+        const float minY = MIN(MIN(c[1], c[3]), MIN(c[5], c[7]));
+        const float maxY = MAX(MAX(c[1], c[3]), MAX(c[5], c[7]));
+        const Rect bounds((int16_t)(x + (int16_t)minX), (int16_t)(y + (int16_t)minY), (int16_t)(maxX - minX) + 1, (int16_t)(maxY - minY) + 1);
+        pixels += (bounds & area).area();
+    }
+    TextureCache::sampled(bitmap.getId(), pixels);
+    countTraffic(data, CortexMMCUInstrumentation::pixelBytes(bitmap.getFormat(), pixels), pixels, blends);
+    stats.quadBatches++;
+    stats.quads += count;
+    if (HAL::DISPLAY_ROTATION != rotate0)
+    {
+        stats.rotated++;
+    }
+    return true;
+}
+
+bool HybridLCDGPU2D::drawScaledBitmap(const Bitmap& bitmap, const Rect& dest, const Rect& clip, uint8_t alpha, bool bilinear)
+{
+    SourceFormat source;
+    const uint8_t* data = bitmap.getData();
+    if (data == 0 || !sourceFormat(bitmap, source) || (bilinear && source.palette != 0))
+    {
+        return false;
+    }
+    const Rect area = clip & dest & screenRect();
+    if (alpha == 0 || area.isEmpty())
+    {
+        return true;
+    }
+
+    TextureSurface texture;
+    texture.data = reinterpret_cast<const uint16_t*>(data);
+    texture.extraData = 0;
+    texture.width = bitmap.getWidth();
+    texture.height = bitmap.getHeight();
+    texture.stride = bitmap.getWidth();
+    const int16_t right = dest.right();
+    const int16_t bottom = dest.bottom();
+    const Point3D corners[4] =
+    {
+        { dest.x * 16, dest.y * 16, 1.0f, 0.0f, 0.0f },
+        { right * 16, dest.y * 16, 1.0f, (float)texture.width, 0.0f },
+        { right * 16, bottom * 16, 1.0f, (float)texture.width, (float)texture.height },
+        { dest.x * 16, bottom * 16, 1.0f, 0.0f, (float)texture.height }
+    };
+    Point3D levelCorners[4];
+    TextureSurface level;
+    if (source.palette == 0 && TextureMipChain::select(corners, 4, texture, levelCorners, level))
+    {
+        // Drawn smaller than half the bitmap, the whole level is fitted instead
+        texture = level;
+        data = reinterpret_cast<const uint8_t*>(level.data);
+    }
+
+    flushGlyphs();
+    countWrite(area, ENGINE_GPU2D);
+    bindFrameBufferTexture();
+    setClip(area);
+    bindSource(source, data, texture.width, texture.height, texture.stride,
+               (bilinear ? NEMA_FILTER_BL : NEMA_FILTER_PS) | NEMA_TEX_CLAMP);
+    const bool blends = alpha < 255 || source.translucent;
+    setBlitBlend(source, blends, alpha);
+    if (HAL::DISPLAY_ROTATION == rotate0)
+    {
+        nema_blit_rect_fit(dest.x, dest.y, dest.width, dest.height);
+    }
+    else
+    {
+        blitQuad(dest.x, dest.y, right, dest.y, right, bottom, dest.x, bottom);
+        stats.rotated++;
+    }
+
+    const uint32_t pixels = area.area();
+    TextureCache::sampled(bitmap.getId(), pixels);
+    countTraffic(data, CortexMMCUInstrumentation::pixelBytes(bitmap.getFormat(), pixels), pixels, blends);
+    stats.scaledBitmaps++;
+    return true;
+}
+
+bool HybridLCDGPU2D::drawTiledBitmap(const Bitmap& bitmap, int16_t x, int16_t y, int16_t xOffset, int16_t yOffset, const Rect& clip, uint8_t alpha)
+{
+    SourceFormat source;
+    const uint8_t* const data = bitmap.getData();
+    const int16_t width = bitmap.getWidth();
+    const int16_t height = bitmap.getHeight();
+    if (data == 0 || width == 0 || height == 0 || !sourceFormat(bitmap, source))
+    {
+        return false;
+    }
+    const Rect area = clip & screenRect();
+    if (alpha == 0 || area.isEmpty())
+    {
+        return true;
+    }
+
+    // GPU2D wraps the texture coordinates of power of two textures only
+    const bool wraps = (width & (width - 1)) == 0 && (height & (height - 1)) == 0;
+    flushGlyphs();
+    countWrite(area, ENGINE_GPU2D);
+    bindFrameBufferTexture();
+    setClip(area);
+    bindSource(source, data, width, height, width, NEMA_FILTER_PS | (wraps ? NEMA_TEX_REPEAT : NEMA_TEX_CLAMP));
+    const bool blends = alpha < 255 || source.translucent;
+    setBlitBlend(source, blends, alpha);
+
+    // The texel drawn at the top left corner of the area
+    const int32_t u = (area.x - x + xOffset) % width;
+    const int32_t v = (area.y - y + yOffset) % height;
+    if (wraps)
+    {
+        blitSubrect(area, u, v);
+        stats.tiles++;
+    }
+    else
+    {
+        for (int32_t tileY = area.y - v; tileY < area.bottom(); tileY += height)
+        {
+            for (int32_t tileX = area.x - u; tileX < area.right(); tileX += width)
+            {
+                // Clipped to the area by setClip()
+                blitSubrect(Rect(tileX, tileY, width, height), 0, 0);
+                stats.tiles++;
+            }
+        }
+    }
+
+    const uint32_t pixels = area.area();
+    TextureCache::sampled(bitmap.getId(), pixels);
+    countTraffic(data, CortexMMCUInstrumentation::pixelBytes(bitmap.getFormat(), pixels), pixels, blends);
+    stats.tiledBitmaps++;
+    if (HAL::DISPLAY_ROTATION != rotate0)
+    {
+        stats.rotated++;
+    }
+    return true;
+}
+
+bool HybridLCDGPU2D::drawA8Mask(const uint8_t* mask, uint16_t width, uint16_t height, int16_t x, int16_t y, const Rect& clip, colortype color, uint8_t alpha)
+{
+    if (mask == 0 || HAL::DISPLAY_ROTATION != rotate0)
+    {
+        return false;
+    }
+    const Rect area = clip & Rect(x, y, width, height) & screenRect();
+    if (alpha == 0 || area.isEmpty())
+    {
+        return true;
+    }
+
+    flushGlyphs();
+    countWrite(area, ENGINE_GPU2D);
+    bindFrameBufferTexture();
+    setClip(area);
+    nema_bind_src_tex((uintptr_t)mask, width, height, NEMA_A8, width, NEMA_FILTER_PS | NEMA_TEX_CLAMP);
+    nema_set_const_color(nema_rgba(Color::getRed(color), Color::getGreen(color), Color::getBlue(color), alpha));
+    nema_set_blend_blit(NEMA_BL_SIMPLE | NEMA_BLOP_MODULATE_RGB | (alpha < 255 ? NEMA_BLOP_MODULATE_A : 0));
+    blitSubrect(area, area.x - x, area.y - y);
+
+    const uint32_t pixels = area.area();
+    countTraffic(mask, pixels, pixels, true);
+    stats.coverageMasks++;
+    return true;
+}
+
+bool HybridLCDGPU2D::drawMaskedBitmap(const uint8_t* mask, uint16_t width, uint16_t height, int16_t x, int16_t y, const Bitmap& bitmap, int16_t u, int16_t v, const Rect& clip, uint8_t alpha)
+{
+    SourceFormat source;
+    const uint8_t* const data = bitmap.getData();
+    // The stencil scales the alpha of a texel, not its premultiplied color
+    if (mask == 0 || data == 0 || HAL::DISPLAY_ROTATION != rotate0 || !sourceFormat(bitmap, source) || source.premultiplied)
+    {
+        return false;
+    }
+    // The bitmap is placed so that its texel (u, v) is at (x, y)
+    const Rect area = clip & Rect(x, y, width, height) & Rect(x - u, y - v, bitmap.getWidth(), bitmap.getHeight()) & screenRect();
+    if (alpha == 0 || area.isEmpty())
+    {
+        return true;
+    }
+
+    flushGlyphs();
+    countWrite(area, ENGINE_GPU2D);
+    bindFrameBufferTexture();
+    setClip(area);
+    // Both textures start at the first pixel drawn, so the texture coordinates of the
+    // bitmap address the same pixel of the mask
+    const uint32_t texel = (uint32_t)(area.y - y + v) * bitmap.getWidth() + (uint32_t)(area.x - x + u);
+    bindSource(source, data + texel * source.bytesPerPixel, area.width, area.height, bitmap.getWidth(), NEMA_FILTER_PS | NEMA_TEX_CLAMP);
+    const uint8_t* const coverage = mask + (uint32_t)(area.y - y) * width + (uint32_t)(area.x - x);
+    nema_bind_tex(NEMA_TEX3, (uintptr_t)coverage, area.width, area.height, NEMA_A8, width, NEMA_FILTER_PS | NEMA_TEX_CLAMP);
+    if (alpha < 255)
+    {
+        nema_set_const_color(nema_rgba(0, 0, 0, alpha));
+    }
+    nema_set_blend_blit(NEMA_BL_SIMPLE | NEMA_BLOP_STENCIL_TXTY | (alpha < 255 ? NEMA_BLOP_MODULATE_A : 0));
+    blitSubrect(area, 0, 0);
+
+    const uint32_t pixels = area.area();
+    countTraffic(data + texel * source.bytesPerPixel, pixels * source.bytesPerPixel, pixels, true);
+    if (source.palette != 0)
+    {
+        stats.indexedBitmaps++;
+    }
+    stats.maskedBitmaps++;
+    return true;
+}
+
+bool HybridLCDGPU2D::canSample(const Bitmap& bitmap)
+{
+    SourceFormat source;
+    return bitmap.getData() != 0 && sourceFormat(bitmap, source) && !source.premultiplied;
+}
+
+bool HybridLCDGPU2D::drawUYVY(const uint8_t* frame, uint16_t width, uint16_t height, uint32_t stride, int16_t x, int16_t y, const Rect& clip, uint8_t alpha)
+{
+    if (frame == 0 || HAL::DISPLAY_ROTATION != rotate0)
+    {
+        return false;
+    }
+    const Rect area = clip & Rect(x, y, width, height) & screenRect();
+    if (alpha == 0 || area.isEmpty())
+    {
+        return true;
+    }
+
+    flushGlyphs();
+    countWrite(area, ENGINE_GPU2D);
+    bindFrameBufferTexture();
+    setClip(area);
+    nema_bind_src_tex((uintptr_t)frame, width, height, NEMA_UYVY, stride, NEMA_FILTER_PS | NEMA_TEX_CLAMP);
+    if (alpha < 255)
+    {
+        nema_set_const_color(nema_rgba(0, 0, 0, alpha));
+    }
+    nema_set_blend_blit(alpha < 255 ? (NEMA_BL_SIMPLE | NEMA_BLOP_MODULATE_A) : NEMA_BL_SRC);
+    blitSubrect(area, area.x - x, area.y - y);
+
+    const uint32_t pixels = area.area();
+    countTraffic(frame, pixels * 2, pixels, alpha < 255);
+    stats.videoFrames++;
+    return true;
+}
+
+bool HybridLCDGPU2D::drawTransition(TransitionEffect effect, bool vertical, bool reverse, const Bitmap& from, const Bitmap& to, float step, const Rect& clip)
+{
+    uint32_t format;
+    uint32_t bytesPerPixel;
+    switch (from.getFormat())
+    {
+    case Bitmap::RGB565:
+        format = NEMA_RGB565;
+        bytesPerPixel = 2;
+        break;
+    case Bitmap::RGB888:
+        format = NEMA_BGR24;
+        bytesPerPixel = 3;
+        break;
+    case Bitmap::ARGB8888:
+        format = NEMA_BGRA8888;
+        bytesPerPixel = 4;
+        break;
+    default:
+        return false;
+    }
+    const int16_t width = HAL::FRAME_BUFFER_WIDTH;
+    const int16_t height = HAL::FRAME_BUFFER_HEIGHT;
+    if (to.getFormat() != from.getFormat() || from.getData() == 0 || to.getData() == 0 || HAL::DISPLAY_ROTATION != rotate0
+            || from.getWidth() != width || from.getHeight() != height || to.getWidth() != width || to.getHeight() != height)
+    {
+        return false;
+    }
+    const Rect area = clip & Rect(0, 0, width, height);
+    if (area.isEmpty())
+    {
+        return true;
+    }
+
+    nema_transition_t nemaEffect;
+    switch (effect)
+    {
+    case TRANSITION_CUBE:
+        nemaEffect = vertical ? NEMA_TRANS_CUBE_V : NEMA_TRANS_CUBE_H;
+        break;
+    case TRANSITION_INNER_CUBE:
+        nemaEffect = vertical ? NEMA_TRANS_INNERCUBE_V : NEMA_TRANS_INNERCUBE_H;
+        break;
+    case TRANSITION_STACK:
+        nemaEffect = vertical ? NEMA_TRANS_STACK_V : NEMA_TRANS_STACK_H;
+        break;
+    case TRANSITION_FADE_ZOOM:
+    default:
+        nemaEffect = NEMA_TRANS_FADE_ZOOM;
+        break;
+    }
+    // The effects move one way from 0 to 1, run backwards from the new screen to the old
+    const Bitmap& initial = reverse ? to : from;
+    const Bitmap& final = reverse ? from : to;
+    if (reverse)
+    {
+        step = 1.0f - step;
+    }
+
+    flushGlyphs();
+    // The area is filled black and then drawn over by the effect
+    countWrite(area, ENGINE_GPU2D);
+    countWrite(area, ENGINE_GPU2D);
+    bindFrameBufferTexture();
+    nema_set_clip(area.x, area.y, area.width, area.height);
+    nema_set_blend_fill(NEMA_BL_SRC);
+    nema_fill_rect(area.x, area.y, area.width, area.height, nema_rgba(0, 0, 0, 255));
+    nema_bind_tex(NEMA_TEX1, (uintptr_t)initial.getData(), width, height, format, width * bytesPerPixel, NEMA_FILTER_BL | NEMA_TEX_BORDER);
+    nema_bind_tex(NEMA_TEX2, (uintptr_t)final.getData(), width, height, format, width * bytesPerPixel, NEMA_FILTER_BL | NEMA_TEX_BORDER);
+    nema_transition(nemaEffect, NEMA_TEX1, NEMA_TEX2, NEMA_BL_SIMPLE, step, width, height);
+
+    // Both snapshots are read, at most once each, over the area drawn
+    const uint32_t pixels = area.area();
+    countTraffic(initial.getData(), CortexMMCUInstrumentation::pixelBytes(from.getFormat(), pixels) * 2, pixels, true);
+    stats.transitions++;
+    return true;
+}
+
+bool HybridLCDGPU2D::drawTSVG(const void* tsvg, const Matrix3x3& transform, const Rect& clip, float size)
+{
+    if (tsvg == 0)
+    {
+        return false;
+    }
+    const Rect area = clip & screenRect();
+    if (area.isEmpty())
+    {
+        return true;
+    }
+
+    nema_matrix3x3_t matrix;
+    for (int row = 0; row < 3; row++)
+    {
+        for (int column = 0; column < 3; column++)
+        {
+            matrix[row][column] = transform.getElement(row, column);
+        }
+    }
+    if (HAL::DISPLAY_ROTATION != rotate0)
+    {
+        // Followed by the turn into the framebuffer, x' = y and y' = DISPLAY_WIDTH - x
+        for (int column = 0; column < 3; column++)
+        {
+            const float x = matrix[0][column];
+            matrix[0][column] = matrix[1][column];
+            matrix[1][column] = HAL::DISPLAY_WIDTH * matrix[2][column] - x;
+        }
+        stats.rotated++;
+    }
+
+    flushGlyphs();
+    nema_vg_set_blend(NEMA_BL_SRC_OVER);
+    nema_vg_set_quality(QualityGovernor::vectorQuality(size));
+    stats.vectorAreas++;
+    countWrite(area, ENGINE_GPU2D);
+    if (!needsStencilTiles(area))
+    {
+        bindFrameBufferTexture();
+        setClip(area);
+        nema_vg_set_global_matrix(matrix);
+        nema_vg_draw_tsvg(tsvg);
+        countStencil(area);
+    }
+    else
+    {
+        Rect tile;
+        for (uint16_t i = 0; !(tile = getStencilTile(area, i)).isEmpty() && beginStencilTile(tile); i++)
+        {
+            // Followed by the move to the tile, x' = x - tile.x and y' = y - tile.y
+            nema_matrix3x3_t shifted;
+            for (int column = 0; column < 3; column++)
+            {
+                shifted[0][column] = matrix[0][column] - tile.x * matrix[2][column];
+                shifted[1][column] = matrix[1][column] - tile.y * matrix[2][column];
+                shifted[2][column] = matrix[2][column];
+            }
+            bindFrameBufferTexture();
+            nema_set_clip(0, 0, tile.width, tile.height);
+            nema_vg_set_global_matrix(shifted);
+            nema_vg_draw_tsvg(tsvg);
+            countStencil(Rect(0, 0, tile.width, tile.height));
+            endStencilTile();
+        }
+    }
+    // Other NemaVG users, the vector renderer and fonts, draw untransformed
+    nema_vg_reset_global_matrix();
+
+    // The size of the blob is not known here, only the pixels of the area are counted
+    countTraffic(tsvg, 0, area.area(), true);
+    stats.tsvgs++;
+    return true;
+}
+
+bool HybridLCDGPU2D::needsStencilTiles(const Rect& area) const
+{
+    if (NEMA_HAL_STENCIL_TILE_WIDTH == 0 || NEMA_HAL_STENCIL_TILE_HEIGHT == 0)
+    {
+        return false;
+    }
+    if (area.right() <= NEMA_HAL_STENCIL_TILE_WIDTH && area.bottom() <= NEMA_HAL_STENCIL_TILE_HEIGHT)
+    {
+        // Inside the stencil already
+        return false;
+    }
+    const Bitmap::BitmapFormat format = framebufferFormat();
+    return HAL::DISPLAY_ROTATION == rotate0 && (format == Bitmap::RGB565 || format == Bitmap::RGB888 || format == Bitmap::ARGB8888);
+}
+
+Rect HybridLCDGPU2D::getStencilTile(const Rect& area, uint16_t index)
+{
+#if (NEMA_HAL_STENCIL_TILE_WIDTH > 0) && (NEMA_HAL_STENCIL_TILE_HEIGHT > 0)
+    const uint16_t columns = (area.width + NEMA_HAL_STENCIL_TILE_WIDTH - 1) / NEMA_HAL_STENCIL_TILE_WIDTH;
+    if (columns == 0)
+    {
+        return Rect();
+    }
+    const int16_t x = area.x + (index % columns) * NEMA_HAL_STENCIL_TILE_WIDTH;
+    const int32_t y = area.y + (index / columns) * NEMA_HAL_STENCIL_TILE_HEIGHT;
+    if (y >= area.bottom())
+    {
+        return Rect();
+    }
+    return Rect(x, (int16_t)y, NEMA_HAL_STENCIL_TILE_WIDTH, NEMA_HAL_STENCIL_TILE_HEIGHT) & area;
+#else
+    // The stencil covers the whole framebuffer
+    return index == 0 ? area : Rect();
+#endif
+}
+
+bool HybridLCDGPU2D::beginStencilTile(const Rect& tile)
+{
+    uint32_t format;
+    uint32_t bytesPerPixel;
+    switch (framebufferFormat())
+    {
+    case Bitmap::RGB565:
+        format = NEMA_RGB565;
+        bytesPerPixel = 2;
+        break;
+    case Bitmap::RGB888:
+        format = NEMA_BGR24;
+        bytesPerPixel = 3;
+        break;
+    case Bitmap::ARGB8888:
+        format = NEMA_BGRA8888;
+        bytesPerPixel = 4;
+        break;
+    default:
+        return false;
+    }
+    if (HAL::DISPLAY_ROTATION != rotate0 || tile.isEmpty())
+    {
+        return false;
+    }
+    // What was collected is drawn into the whole framebuffer, before it is moved
+    flushGlyphs();
+    uint8_t* const target = reinterpret_cast<uint8_t*>(HAL::getInstance()->lockFrameBuffer());
+    HAL::getInstance()->unlockFrameBuffer();
+
+    stencilTile = tile;
+    stencilTileFormat = format;
+    stencilTileTarget = target + tile.y * framebufferStride() + tile.x * bytesPerPixel;
+    stats.stencilTiles++;
+    return true;
+}
+
+void HybridLCDGPU2D::countStencil(const Rect& area)
+{
+    if (area.isEmpty())
+    {
+        return;
+    }
+    stats.stencilPixels += area.area();
+    stats.stencilRight = MAX(stats.stencilRight, (uint32_t)MAX(area.right(), 0));
+    stats.stencilBottom = MAX(stats.stencilBottom, (uint32_t)MAX(area.bottom(), 0));
+    if (NEMA_HAL_STENCIL_TILE_WIDTH > 0 && NEMA_HAL_STENCIL_TILE_HEIGHT > 0
+        && (area.right() > NEMA_HAL_STENCIL_TILE_WIDTH || area.bottom() > NEMA_HAL_STENCIL_TILE_HEIGHT))
+    {
+        stats.stencilClipped++;
+    }
+}
+
+void HybridLCDGPU2D::setGPU2DSourceRegion(const void* start, uint32_t size)
+{
+    gpu2dSourceStart = static_cast<const uint8_t*>(start);
+    gpu2dSourceEnd = gpu2dSourceStart + size;
+}
+
+void HybridLCDGPU2D::waitForDMA2D()
+{
+    // isDmaQueueEmpty() is out of line, so isRunning is reloaded on every iteration
+    while (!dma.isDmaQueueEmpty() || dma.isDMARunning())
+    {
+    }
+    dma2dPending = false;
+}
+
+void HybridLCDGPU2D::finishDrawing()
+{
+    flushGlyphs();
+    waitForGPU2D();
+    waitForDMA2D();
+}
+
+uint32_t HybridLCDGPU2D::kickGPU2D()
+{
+    flushGlyphs();
+    nema_cmdlist_t* const cl = nema_cl_get_bound();
+    if (cl == 0 || cl->offset == 0)
+    {
+        // Nothing recorded since the last kick, which covers what came before
+        return kicks;
+    }
+    if (fragmentRecording != 0 || !createKickLists())
+    {
+        // A fragment is replayed by branching to it, it cannot be submitted on its own
+        waitForGPU2D();
+        return 0;
+    }
+
+    const uint32_t kick = ++kicks;
+    nema_cl_submit(cl);
+    int next = 0;
+    if (cl == &kickLists[0])
+    {
+        kickOfList[0] = kick;
+        next = 1;
+    }
+    else if (cl == &kickLists[1])
+    {
+        kickOfList[1] = kick;
+    }
+    else
+    {
+        kickCaller = cl;
+        callerKick = kick;
+    }
+    // The other list was submitted by the kick before, GPU2D must be done with it before
+    // it is recorded into again
+    if (kickOfList[next] != 0)
+    {
+        nema_cl_wait(&kickLists[next]);
+        kickOfList[next] = 0;
+    }
+    nema_cl_rewind(&kickLists[next]);
+    nema_cl_bind(&kickLists[next]);
+    stats.kicks++;
+    return kick;
+}
+
+void HybridLCDGPU2D::waitForKick(uint32_t kick)
+{
+    if (kick == 0)
+    {
+        return;
+    }
+    // The lists are executed in order, waiting for the latest one at or before the kick
+    // waits for all before it
+    nema_cmdlist_t* latest = 0;
+    uint32_t latestKick = 0;
+    for (int i = 0; i < 2; i++)
+    {
+        if (kickOfList[i] != 0 && kickOfList[i] <= kick && kickOfList[i] > latestKick)
+        {
+            latest = &kickLists[i];
+            latestKick = kickOfList[i];
+        }
+    }
+    if (callerKick != 0 && callerKick <= kick && callerKick > latestKick)
+    {
+        latest = kickCaller;
+        latestKick = callerKick;
+    }
+    if (latest == 0)
+    {
+        return;
+    }
+    nema_cl_wait(latest);
+    for (int i = 0; i < 2; i++)
+    {
+        if (kickOfList[i] != 0 && kickOfList[i] <= latestKick)
+        {
+            kickOfList[i] = 0;
+        }
+    }
+    if (callerKick != 0 && callerKick <= latestKick)
+    {
+        callerKick = 0;
+    }
+}
+
+void HybridLCDGPU2D::endKicks()
+{
+    if (kickCaller == 0)
+    {
+        return;
+    }
+    flushGlyphs();
+    nema_cmdlist_t* const cl = nema_cl_get_bound();
+    if (cl != 0 && cl->offset > 0)
+    {
+        // Executed after all kicked lists, so waiting for it waits for them
+        nema_cl_submit(cl);
+        nema_cl_wait(cl);
+        stats.gpu2dSyncs++;
+    }
+    waitForKick(kicks);
+    nema_cl_rewind(&kickLists[0]);
+    nema_cl_rewind(&kickLists[1]);
+    nema_cl_rewind(kickCaller);
+    nema_cl_bind(kickCaller);
+    kickCaller = 0;
+}
+
+void HybridLCDGPU2D::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+void HybridLCDGPU2D::flushGlyphs()
+{
+    // Glyphs, fills and blits are never collected at the same time, see batchFill()
+    flushFills();
+    flushBlits();
+    if (glyphCount == 0)
+    {
+        return;
+    }
+    // Binding the framebuffer may lock it, which flushes again
+    const uint16_t count = glyphCount;
+    glyphCount = 0;
+
+    bindFrameBufferTexture();
+    nema_set_clip(0, 0, HAL::FRAME_BUFFER_WIDTH, HAL::FRAME_BUFFER_HEIGHT);
+    // TouchGFX glyphs store the leftmost pixel of a byte in its low nibble
+    nema_bind_src_tex((uintptr_t)glyphPage, TOUCHGFX_GLYPH_ATLAS_PAGE_WIDTH, TOUCHGFX_GLYPH_ATLAS_PAGE_HEIGHT,
+                      NEMA_A4LE, GlyphAtlas::PAGE_STRIDE, NEMA_FILTER_PS | NEMA_TEX_CLAMP);
+    nema_set_const_color(nema_rgba(Color::getRed(glyphColor), Color::getGreen(glyphColor), Color::getBlue(glyphColor), glyphAlpha));
+    nema_set_blend_blit(NEMA_BL_SIMPLE | NEMA_BLOP_MODULATE_RGB | (glyphAlpha < 255 ? NEMA_BLOP_MODULATE_A : 0));
+    for (uint16_t i = 0; i < count; i++)
+    {
+        const GlyphQuad& quad = glyphQuads[i];
+        blitSubrect(Rect(quad.x, quad.y, quad.width, quad.height), quad.atlasX, quad.atlasY);
+    }
+    stats.glyphBatches++;
+    stats.glyphs += count;
+    if (HAL::DISPLAY_ROTATION != rotate0)
+    {
+        stats.rotated++;
+    }
+}
+
+int32_t HybridLCDGPU2D::recordString(const Rect& widgetArea, const StringVisuals& visuals, const Unicode::UnicodeChar* text, RecordedGlyph* glyphs, uint16_t capacity)
+{
+    if (visuals.font == 0 || visuals.font->isVectorBasedFont())
+    {
+        // Vector glyphs are drawn by the VectorFontRenderer, not drawGlyph()
+        return -2;
+    }
+    recording = glyphs;
+    recordingArea = widgetArea;
+    recordingCapacity = capacity;
+    recordedCount = 0;
+    // Drawn opaque, so no glyph is left out for being transparent
+    StringVisuals layout = visuals;
+    layout.alpha = 255;
+    drawString(widgetArea, Rect(0, 0, widgetArea.width, widgetArea.height), layout, text, 0, 0);
+    recording = 0;
+    return recordedCount;
+}
+
+bool HybridLCDGPU2D::renderStringMask(const Rect& widgetArea, const StringVisuals& visuals, const Unicode::UnicodeChar* text, uint8_t* mask)
+{
+    if (visuals.font == 0 || visuals.font->isVectorBasedFont() || visuals.rotation != TEXT_ROTATE_0 || mask == 0)
+    {
+        return false;
+    }
+    memset(mask, 0, (uint32_t)widgetArea.width * widgetArea.height);
+    maskTarget = mask;
+    recordingArea = widgetArea;
+    maskFailed = false;
+    // The coverage is rendered opaque, the alpha is applied when the mask is drawn
+    StringVisuals layout = visuals;
+    layout.alpha = 255;
+    drawString(widgetArea, Rect(0, 0, widgetArea.width, widgetArea.height), layout, text, 0, 0);
+    maskTarget = 0;
+    return !maskFailed;
+}
+
+void HybridLCDGPU2D::drawRecordedGlyphs(const Rect& widgetArea, const Rect& invalidatedArea, const RecordedGlyph* glyphs, uint16_t count, colortype color, uint8_t alpha, TextRotation rotation)
+{
+    if (alpha == 0 || count == 0)
+    {
+        return;
+    }
+    uint16_t* const framebuffer = HAL::getInstance()->lockFrameBuffer();
+    for (uint16_t i = 0; i < count; i++)
+    {
+        const RecordedGlyph& g = glyphs[i];
+        drawGlyph(framebuffer, widgetArea, g.x, g.y, g.offsetX, g.offsetY, invalidatedArea, g.glyph, g.data, g.dataFormatA4, color, g.bitsPerPixel, alpha, rotation);
+    }
+    HAL::getInstance()->unlockFrameBuffer();
+}
+
+bool HybridLCDGPU2D::renderGlyphMask(int16_t x, int16_t y, uint16_t offsetX, uint16_t offsetY, const GlyphNode* glyph, const uint8_t* glyphData, uint8_t dataFormatA4, uint8_t bitsPerPixel)
+{
+    const uint16_t width = glyph->width();
+    const uint16_t height = glyph->height();
+    uint32_t rowBytes;
+    if (bitsPerPixel == 4 && dataFormatA4 != 0)
+    {
+        rowBytes = (width + 1U) / 2U;
+    }
+    else if (bitsPerPixel == 8)
+    {
+        rowBytes = width;
+    }
+    else
+    {
+        // 1bpp and 2bpp glyphs are bit streams across rows
+        return false;
+    }
+
+    // As in batchGlyph(), the first offsetX columns and offsetY rows are outside of the widget
+    const Rect placed = Rect(x, y, width - offsetX, height - offsetY) & Rect(0, 0, recordingArea.width, recordingArea.height);
+    for (int16_t my = placed.y; my < placed.bottom(); my++)
+    {
+        const uint8_t* const row = glyphData + (uint32_t)(my - y + offsetY) * rowBytes;
+        uint8_t* const out = maskTarget + (uint32_t)my * recordingArea.width;
+        for (int16_t mx = placed.x; mx < placed.right(); mx++)
+        {
+            const uint32_t column = mx - x + offsetX;
+            // 4bpp: the left pixel in the low nibble
+            const uint32_t coverage = (bitsPerPixel == 4) ? ((row[column >> 1] >> ((column & 1U) * 4U)) & 0x0FU) * 17U : row[column];
+            if (coverage != 0)
+            {
+                out[mx] = (uint8_t)(out[mx] + coverage - (out[mx] * coverage + 127U) / 255U);
+            }
+        }
+    }
+    return true;
+}
+
+bool HybridLCDGPU2D::batchGlyph(const Rect& widgetArea, int16_t x, int16_t y, uint16_t offsetX, uint16_t offsetY, const Rect& invalidatedArea, const GlyphNode* glyph, const uint8_t* glyphData, uint8_t dataFormatA4, colortype color, uint8_t bitsPerPixel, uint8_t alpha, TextRotation rotation)
+{
+    if (TOUCHGFX_GLYPH_ATLAS_PAGES == 0
+        || bitsPerPixel != 4
+        || dataFormatA4 == 0
+        || rotation != TEXT_ROTATE_0
+        || HAL::getInstance()->getFrameRefreshStrategy() == HAL::REFRESH_STRATEGY_PARTIAL_FRAMEBUFFER)
+    {
+        return false;
+    }
+
+    // The glyph is placed relative to the widget, its first offsetX columns and offsetY
+    // rows are outside of it
+    const Rect glyphArea(x, y, glyph->width() - offsetX, glyph->height() - offsetY);
+    const Rect visible = glyphArea & invalidatedArea;
+    if (visible.isEmpty())
+    {
+        return true;
+    }
+
+    GlyphAtlas::Location location;
+    if (!GlyphAtlas::find(glyphData, glyph->width(), glyph->height(), location))
+    {
+        return false;
+    }
+
+    flushFills();
+    flushBlits();
+    if (glyphCount > 0 && (location.page != glyphPage || color != glyphColor || alpha != glyphAlpha || glyphCount == HYBRID_GLYPH_BATCH_SIZE))
+    {
+        flushGlyphs();
+    }
+    glyphPage = location.page;
+    glyphColor = color;
+    glyphAlpha = alpha;
+
+    GlyphQuad& quad = glyphQuads[glyphCount++];
+    quad.x = widgetArea.x + visible.x;
+    quad.y = widgetArea.y + visible.y;
+    quad.width = visible.width;
+    quad.height = visible.height;
+    quad.atlasX = location.x + offsetX + (visible.x - x);
+    quad.atlasY = location.y + offsetY + (visible.y - y);
+
+    const uint32_t pixels = (uint32_t)visible.width * visible.height;
+    countTraffic(location.page, (pixels + 1) / 2, pixels, true);
+    return true;
+}
+
+HybridLCDGPU2D::FragmentResult HybridLCDGPU2D::beginFragment(const void* owner, uint32_t version, const Rect& area)
+{
+#if HYBRID_FRAGMENTS > 0
+    nema_cmdlist_t* const caller = nema_cl_get_bound();
+    if (owner == 0 || fragmentRecording != 0 || caller == 0 || !createFragments())
+    {
+        return FRAGMENT_UNAVAILABLE;
+    }
+    // The render target is only known to the LCD classes while the framebuffer is locked
+    const void* const target = HAL::getInstance()->lockFrameBuffer();
+    HAL::getInstance()->unlockFrameBuffer();
+    const uint8_t format = (uint8_t)framebufferFormat();
+
+    Fragment* oldest = 0;
+    for (uint16_t i = 0; i < fragmentCount; i++)
+    {
+        Fragment& fragment = fragments[i];
+        if (fragment.owner == owner && fragment.version == version && fragment.target == target
+                && fragment.format == format && fragment.area == area)
+        {
+            fragment.lastUsed = ++fragmentUses;
+            fragment.lastFrame = fragmentFrame;
+            nema_cl_branch(&fragment.list);
+            stats.fragmentsReplayed++;
+            return FRAGMENT_REPLAYED;
+        }
+        // GPU2D may still have to execute a branch to a fragment used in this frame
+        if (fragment.lastFrame != fragmentFrame && (oldest == 0 || fragment.lastUsed < oldest->lastUsed))
+        {
+            oldest = &fragment;
+        }
+    }
+    if (oldest == 0)
+    {
+        return FRAGMENT_UNAVAILABLE;
+    }
+
+    oldest->owner = owner;
+    oldest->version = version;
+    oldest->target = target;
+    oldest->format = format;
+    oldest->area = area;
+    oldest->lastUsed = ++fragmentUses;
+    oldest->lastFrame = fragmentFrame;
+    // Glyphs collected so far belong before the fragment
+    flushGlyphs();
+    fragmentCaller = caller;
+    fragmentRecording = oldest;
+    nema_cl_rewind(&oldest->list);
+    nema_cl_bind(&oldest->list);
+    return FRAGMENT_RECORDING;
+#else
+    (void)owner;
+    (void)version;
+    (void)area;
+    return FRAGMENT_UNAVAILABLE;
+#endif
+}
+
+bool HybridLCDGPU2D::endFragment()
+{
+    Fragment* const fragment = fragmentRecording;
+    if (fragment == 0)
+    {
+        return false;
+    }
+    flushGlyphs();
+    // Commands that did not fit were dropped, keep a few words for the return
+    const bool fits = nema_cl_almost_full(&fragment->list) == 0;
+    if (fits)
+    {
+        nema_cl_return();
+    }
+    nema_cl_bind(fragmentCaller);
+    fragmentRecording = 0;
+    fragmentCaller = 0;
+    if (!fits)
+    {
+        fragment->owner = 0;
+        stats.fragmentOverflows++;
+        return false;
+    }
+    // Written by the CPU, read by GPU2D when branched to
+    nema_buffer_flush(&fragment->list.bo);
+    nema_cl_branch(&fragment->list);
+    stats.fragmentsRecorded++;
+    return true;
+}
+
+void HybridLCDGPU2D::discardFragments(const void* owner)
+{
+#if HYBRID_FRAGMENTS > 0
+    for (uint16_t i = 0; i < fragmentCount; i++)
+    {
+        // One being recorded is still ended by endFragment(), but not replayed
+        if (owner == 0 || fragments[i].owner == owner)
+        {
+            fragments[i].owner = 0;
+        }
+    }
+#else
+    (void)owner;
+#endif
+}
+
+void HybridLCDGPU2D::sourcesMoved()
+{
+    if (instance != 0)
+    {
+        instance->discardFragments();
+    }
+}
+
+bool HybridLCDGPU2D::createKickLists()
+{
+    if (!kickListsCreated)
+    {
+        // Expandable, allocated from the GPU2D memory pool the first time GPU2D is kicked
+        kickListsCreated = true;
+        kickLists[0] = nema_cl_create();
+        kickLists[1] = nema_cl_create();
+        if (kickLists[0].bo.base_virt == 0 || kickLists[1].bo.base_virt == 0)
+        {
+            for (int i = 0; i < 2; i++)
+            {
+                if (kickLists[i].bo.base_virt != 0)
+                {
+                    nema_cl_destroy(&kickLists[i]);
+                }
+            }
+            memset(kickLists, 0, sizeof(kickLists));
+        }
+    }
+    return kickLists[0].bo.base_virt != 0;
+}
+
+bool HybridLCDGPU2D::createFragments()
+{
+#if HYBRID_FRAGMENTS > 0
+    if (!fragmentsCreated)
+    {
+        // Allocated from the GPU2D memory pool the first time a subtree is recorded, as
+        // many as fit
+        fragmentsCreated = true;
+        while (fragmentCount < HYBRID_FRAGMENTS)
+        {
+            Fragment& fragment = fragments[fragmentCount];
+            fragment.list = nema_cl_create_sized(HYBRID_FRAGMENT_SIZE);
+            if (fragment.list.bo.base_virt == 0)
+            {
+                break;
+            }
+            fragment.owner = 0;
+            fragment.lastUsed = 0;
+            // Not branched to in this frame
+            fragment.lastFrame = fragmentFrame - 1;
+            fragmentCount++;
+        }
+    }
+#endif
+    return fragmentCount > 0;
+}
+
+bool HybridLCDGPU2D::batchFill(const Rect& area, colortype color, uint8_t alpha)
+{
+#if HYBRID_FILL_BATCH_SIZE > 0
+    if (HAL::getInstance()->getFrameRefreshStrategy() == HAL::REFRESH_STRATEGY_PARTIAL_FRAMEBUFFER)
+    {
+        return false;
+    }
+    if (alpha == 0 || area.isEmpty())
+    {
+        return true;
+    }
+    if (glyphCount > 0)
+    {
+        flushGlyphs();
+    }
+    flushBlits();
+    const bool blended = alpha < 255;
+    if (fillCount > 0 && (blended != fillBlended || fillCount == HYBRID_FILL_BATCH_SIZE))
+    {
+        flushFills();
+    }
+    fillBlended = blended;
+
+    FillQuad& quad = fillQuads[fillCount++];
+    quad.x = area.x;
+    quad.y = area.y;
+    quad.width = area.width;
+    quad.height = area.height;
+    quad.color = nema_rgba(Color::getRed(color), Color::getGreen(color), Color::getBlue(color), alpha);
+
+    countTraffic(0, 0, area.area(), blended);
+    stats.gpu2dOps++;
+    stats.gpu2dPixels += area.area();
+    return true;
+#else
+    return false;
+#endif
+}
+
+void HybridLCDGPU2D::flushFills()
+{
+#if HYBRID_FILL_BATCH_SIZE > 0
+    if (fillCount == 0)
+    {
+        return;
+    }
+    // Binding the framebuffer may lock it, which flushes again
+    const uint16_t count = fillCount;
+    fillCount = 0;
+
+    bindFrameBufferTexture();
+    nema_set_clip(0, 0, HAL::FRAME_BUFFER_WIDTH, HAL::FRAME_BUFFER_HEIGHT);
+    nema_set_blend_fill(fillBlended ? NEMA_BL_SIMPLE : NEMA_BL_SRC);
+    for (uint16_t i = 0; i < count; i++)
+    {
+        const FillQuad& quad = fillQuads[i];
+        Rect fill(quad.x, quad.y, quad.width, quad.height);
+        DisplayTransformation::transformDisplayToFrameBuffer(fill);
+        nema_fill_rect(fill.x, fill.y, fill.width, fill.height, quad.color);
+    }
+    stats.fillBatches++;
+    stats.fills += count;
+    if (HAL::DISPLAY_ROTATION != rotate0)
+    {
+        stats.rotated++;
+    }
+#endif
+}
+
+Rect HybridLCDGPU2D::screenRect()
+{
+    if (HAL::DISPLAY_ROTATION == rotate0)
+    {
+        return Rect(0, 0, HAL::FRAME_BUFFER_WIDTH, HAL::FRAME_BUFFER_HEIGHT);
+    }
+    return Rect(0, 0, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT);
+}
+
+void HybridLCDGPU2D::toFrameBuffer(float& x, float& y)
+{
+    if (HAL::DISPLAY_ROTATION != rotate0)
+    {
+        // The pixel edges of the Rect transformation: x' = y, y' = DISPLAY_WIDTH - x
+        const float displayX = x;
+        x = y;
+        y = HAL::DISPLAY_WIDTH - displayX;
+    }
+}
+
+void HybridLCDGPU2D::setClip(const Rect& area)
+{
+    Rect clip = area;
+    DisplayTransformation::transformDisplayToFrameBuffer(clip);
+    nema_set_clip(clip.x, clip.y, clip.width, clip.height);
+}
+
+void HybridLCDGPU2D::blitSubrect(const Rect& dest, int32_t u, int32_t v)
+{
+    if (HAL::DISPLAY_ROTATION == rotate0)
+    {
+        nema_blit_subrect(dest.x, dest.y, dest.width, dest.height, u, v);
+        return;
+    }
+    float x0 = dest.x;
+    float y0 = dest.y;
+    float x1 = dest.right();
+    float y1 = dest.y;
+    float x2 = dest.right();
+    float y2 = dest.bottom();
+    float x3 = dest.x;
+    float y3 = dest.bottom();
+    toFrameBuffer(x0, y0);
+    toFrameBuffer(x1, y1);
+    toFrameBuffer(x2, y2);
+    toFrameBuffer(x3, y3);
+    nema_blit_subrect_quad_fit(x0, y0, x1, y1, x2, y2, x3, y3, u, v, dest.width, dest.height);
+}
+
+bool HybridLCDGPU2D::sourceFormat(const Bitmap& bitmap, SourceFormat& source)
+{
+    source.palette = 0;
+    source.paletteFormat = 0;
+    source.translucent = false;
+    source.premultiplied = false;
+    switch (bitmap.getFormat())
+    {
+    case Bitmap::RGB565:
+        source.format = NEMA_RGB565;
+        source.bytesPerPixel = 2;
+        // A separate alpha channel is not sampled
+        return bitmap.getExtraData() == 0;
+    case Bitmap::RGB888:
+        source.format = NEMA_BGR24;
+        source.bytesPerPixel = 3;
+        return true;
+    case Bitmap::ARGB8888:
+        source.format = NEMA_BGRA8888;
+        source.bytesPerPixel = 4;
+        source.translucent = true;
+        source.premultiplied = TextureCache::isPremultiplied(bitmap.getData());
+        return true;
+    case Bitmap::L8:
+        {
+            // The palette starts with its format and size, the format also tells the
+            // compression, which GPU2D cannot decode
+            const uint8_t* const clut = bitmap.getExtraData();
+            if (clut == 0)
+            {
+                return false;
+            }
+            const uint16_t clutFormat = *reinterpret_cast<const uint16_t*>(clut);
+            if (clutFormat == Bitmap::CLUT_FORMAT_L8_ARGB8888)
+            {
+                source.paletteFormat = NEMA_BGRA8888;
+                source.translucent = true;
+            }
+            else if (clutFormat == Bitmap::CLUT_FORMAT_L8_RGB888)
+            {
+                source.paletteFormat = NEMA_BGR24;
+            }
+            else
+            {
+                return false;
+            }
+            source.format = NEMA_L8;
+            source.bytesPerPixel = 1;
+            source.palette = clut + 4;
+            return true;
+        }
+    default:
+        return false;
+    }
+}
+
+void HybridLCDGPU2D::bindSource(const SourceFormat& source, const uint8_t* data, uint16_t width, uint16_t height, uint16_t stride, uint32_t mode)
+{
+    if (source.palette != 0)
+    {
+        nema_bind_lut_tex((uintptr_t)data, width, height, source.format, stride * source.bytesPerPixel, mode,
+                          (uintptr_t)source.palette, source.paletteFormat);
+    }
+    else
+    {
+        nema_bind_src_tex((uintptr_t)data, width, height, source.format, stride * source.bytesPerPixel, mode);
+    }
+}
+
+void HybridLCDGPU2D::setBlitBlend(const SourceFormat& source, bool blends, uint8_t alpha)
+{
+    if (!blends)
+    {
+        nema_set_blend_blit(NEMA_BL_SRC);
+        return;
+    }
+    if (source.premultiplied)
+    {
+        stats.premultiplied++;
+        // The color is faded with the alpha, and blended without multiplying it by alpha
+        if (alpha < 255)
+        {
+            nema_set_const_color(nema_rgba(alpha, alpha, alpha, alpha));
+        }
+        nema_set_blend_blit(NEMA_BL_SRC_OVER | (alpha < 255 ? (NEMA_BLOP_MODULATE_RGB | NEMA_BLOP_MODULATE_A) : 0));
+        return;
+    }
+    if (alpha < 255)
+    {
+        nema_set_const_color(nema_rgba(0, 0, 0, alpha));
+    }
+    nema_set_blend_blit(NEMA_BL_SIMPLE | (alpha < 255 ? NEMA_BLOP_MODULATE_A : 0));
+}
+
+void HybridLCDGPU2D::blitQuad(float x0, float y0, float x1, float y1, float x2, float y2, float x3, float y3)
+{
+    toFrameBuffer(x0, y0);
+    toFrameBuffer(x1, y1);
+    toFrameBuffer(x2, y2);
+    toFrameBuffer(x3, y3);
+    nema_blit_quad_fit(x0, y0, x1, y1, x2, y2, x3, y3);
+}
+
+bool HybridLCDGPU2D::isDispatched() const
+{
+    return HYBRID_BLIT_DISPATCH
+           && fragmentRecording == 0
+           && HAL::DISPLAY_ROTATION == rotate0
+           && HAL::getInstance()->getFrameRefreshStrategy() != HAL::REFRESH_STRATEGY_PARTIAL_FRAMEBUFFER
+           && framebufferFormat() == Bitmap::RGB565;
+}
+
+bool HybridLCDGPU2D::isGPU2DPending() const
+{
+    const nema_cmdlist_t* const cl = nema_cl_get_bound();
+    return glyphCount > 0 || fillCount > 0 || blitCount > 0 || (cl != 0 && cl->offset > 0) || !nema_hal_fence_signaled();
+}
+
+HybridLCDGPU2D::Engine HybridLCDGPU2D::selectEngine(CostedOperation operation, const Rect& area) const
+{
+    if (!isDispatched())
+    {
+        return ENGINE_GPU2D;
+    }
+    const uint32_t pixels = area.area();
+    Engine best = ENGINE_GPU2D;
+    uint64_t bestCycles = ~(uint64_t)0;
+    for (int engine = 0; engine < NUMBER_OF_ENGINES; engine++)
+    {
+        const EngineCost& cost = costs[operation][engine];
+        if (cost.setupCycles == UNAVAILABLE)
+        {
+            continue;
+        }
+        uint64_t cycles = cost.setupCycles + ((uint64_t)pixels * cost.cyclesPer64Pixels) / 64;
+        if (engine == ENGINE_CPU && (dma2dPending || isGPU2DPending()))
+        {
+            // The CPU writes at once, after the engines are done with what came before
+            cycles += syncCycles;
+        }
+        if (cycles < bestCycles)
+        {
+            bestCycles = cycles;
+            best = (Engine)engine;
+        }
+    }
+    return best;
+}
+
+bool HybridLCDGPU2D::calibrateCosts()
+{
+    if (!isDispatched())
+    {
+        return false;
+    }
+    flushGlyphs();
+    waitForGPU2D();
+    waitForDMA2D();
+
+    const uint16_t* const sourceData = HAL::getInstance()->getTFTFrameBuffer();
+    const Rect source(0, 0, HAL::FRAME_BUFFER_WIDTH, HAL::FRAME_BUFFER_HEIGHT);
+    for (int operation = 0; operation < NUMBER_OF_COSTED_OPERATIONS; operation++)
+    {
+        for (int engine = 0; engine < NUMBER_OF_ENGINES; engine++)
+        {
+            if (costs[operation][engine].setupCycles == UNAVAILABLE)
+            {
+                continue;
+            }
+            uint32_t cycles[2];
+            // The first pass loads the code and the lines of the framebuffer into the caches
+            for (int pass = 0; pass < 2; pass++)
+            {
+                for (int size = 0; size < 2; size++)
+                {
+                    const Rect area(0, 0, CALIBRATION_SIDES[size], CALIBRATION_SIDES[size]);
+                    const uint32_t start = DWT->CYCCNT;
+                    if (operation == COST_COPY_RGB565)
+                    {
+                        copyOn((Engine)engine, sourceData, source, area, area);
+                    }
+                    else
+                    {
+                        fillOn((Engine)engine, area, area, Color::getColorFromRGB(0, 0, 0), operation == COST_FILL ? 255 : 128);
+                    }
+                    waitForGPU2D();
+                    waitForDMA2D();
+                    cycles[size] = DWT->CYCCNT - start;
+                }
+            }
+            const uint32_t pixels0 = (uint32_t)CALIBRATION_SIDES[0] * CALIBRATION_SIDES[0];
+            const uint32_t pixels1 = (uint32_t)CALIBRATION_SIDES[1] * CALIBRATION_SIDES[1];
+            EngineCost& cost = costs[operation][engine];
+            cost.cyclesPer64Pixels = (cycles[1] > cycles[0]) ? (uint32_t)(((uint64_t)(cycles[1] - cycles[0]) * 64) / (pixels1 - pixels0)) : 0;
+            const uint32_t pixelCycles = (uint32_t)(((uint64_t)pixels0 * cost.cyclesPer64Pixels) / 64);
+            cost.setupCycles = (cycles[0] > pixelCycles) ? cycles[0] - pixelCycles : 0;
+        }
+    }
+
+    // Executing a small fill recorded on GPU2D, as the CPU waits for before it writes
+    fillOn(ENGINE_GPU2D, Rect(0, 0, 1, 1), Rect(0, 0, 1, 1), Color::getColorFromRGB(0, 0, 0), 255);
+    const uint32_t start = DWT->CYCCNT;
+    waitForGPU2D();
+    syncCycles = DWT->CYCCNT - start;
+    return true;
+}
+
+void HybridLCDGPU2D::cpuFill(const Rect& area, colortype color, uint8_t alpha)
+{
+    if (alpha == 0 || area.isEmpty())
+    {
+        return;
+    }
+    // The pixels below may still be drawn by the engines
+    waitForGPU2D();
+    if (dma2dPending)
+    {
+        waitForDMA2D();
+    }
+    uint16_t* const framebuffer = HAL::getInstance()->lockFrameBuffer();
+    uint16_t* const first = framebuffer + area.y * HAL::FRAME_BUFFER_WIDTH + area.x;
+    const uint16_t red = Color::getRed(color) >> 3;
+    const uint16_t green = Color::getGreen(color) >> 2;
+    const uint16_t blue = Color::getBlue(color) >> 3;
+    const uint16_t native = (uint16_t)((red << 11) | (green << 5) | blue);
+    for (int16_t y = 0; y < area.height; y++)
+    {
+        uint16_t* const line = first + y * HAL::FRAME_BUFFER_WIDTH;
+        for (int16_t x = 0; x < area.width; x++)
+        {
+            line[x] = (alpha == 255) ? native : blend565(line[x], red, green, blue, alpha);
+        }
+    }
+    HAL::getInstance()->unlockFrameBuffer();
+    // GPU2D, DMA2D and LTDC read the framebuffer from memory
+    DCacheMaintenance::clean(first, ((area.height - 1) * HAL::FRAME_BUFFER_WIDTH + area.width) * 2);
+    stats.cpuOps++;
+    stats.cpuPixels += area.area();
+}
+
+void HybridLCDGPU2D::cpuCopy(const uint16_t* sourceData, const Rect& source, const Rect& area)
+{
+    if (area.isEmpty())
+    {
+        return;
+    }
+    waitForGPU2D();
+    if (dma2dPending)
+    {
+        waitForDMA2D();
+    }
+    uint16_t* const framebuffer = HAL::getInstance()->lockFrameBuffer();
+    uint16_t* const first = framebuffer + area.y * HAL::FRAME_BUFFER_WIDTH + area.x;
+    const uint16_t* const from = sourceData + (area.y - source.y) * source.width + (area.x - source.x);
+    for (int16_t y = 0; y < area.height; y++)
+    {
+        memcpy(first + y * HAL::FRAME_BUFFER_WIDTH, from + y * source.width, area.width * 2);
+    }
+    HAL::getInstance()->unlockFrameBuffer();
+    DCacheMaintenance::clean(first, ((area.height - 1) * HAL::FRAME_BUFFER_WIDTH + area.width) * 2);
+    stats.cpuOps++;
+    stats.cpuPixels += area.area();
+}
+
+void HybridLCDGPU2D::countTraffic(const void* source, uint32_t sourceBytes, uint32_t pixels, bool blends)
+{
+#if TOUCHGFX_MEMORY_TRAFFIC
+    if (trafficDepth > 0)
+    {
+        // Part of an operation that has already been counted
+        return;
+    }
+    if (sourceBytes > 0)
+    {
+        CortexMMCUInstrumentation::countRead(source, sourceBytes);
+    }
+    const void* const target = HAL::getInstance()->getTFTFrameBuffer();
+    const uint32_t targetBytes = (pixels * bitDepth() + 7) / 8;
+    CortexMMCUInstrumentation::countWrite(target, targetBytes);
+    if (blends)
+    {
+        CortexMMCUInstrumentation::countRead(target, targetBytes);
+    }
+#else
+    (void)source;
+    (void)sourceBytes;
+    (void)pixels;
+    (void)blends;
+#endif
+}
+
+void HybridLCDGPU2D::countWrite(const Rect& area, Engine engine)
+{
+    if (trafficDepth > 0)
+    {
+        // Part of an operation that has already been counted
+        return;
+    }
+    static const OverdrawHeatmap::Backend backends[NUMBER_OF_ENGINES] = { OverdrawHeatmap::BACKEND_CPU, OverdrawHeatmap::BACKEND_DMA2D, OverdrawHeatmap::BACKEND_GPU2D };
+    OverdrawHeatmap::wrote(area, backends[engine]);
+}
+
+void HybridLCDGPU2D::countTextureTraffic(const Point3D* vertices, int numVertices, const TextureSurface& texture, const Rect& absoluteRect, const Rect& dirtyAreaAbsolute, RenderingVariant renderVariant, uint8_t alpha)
+{
+    if (trafficDepth > 0)
+    {
+        return;
+    }
+    fixed28_4 minX = vertices[0].X;
+    fixed28_4 maxX = vertices[0].X;
+    fixed28_4 minY = vertices[0].Y;
+    fixed28_4 maxY = vertices[0].Y;
+    for (int i = 1; i < numVertices; i++)
+    {
+        minX = MIN(minX, vertices[i].X);
+        maxX = MAX(maxX, vertices[i].X);
+        minY = MIN(minY, vertices[i].Y);
+        maxY = MAX(maxY, vertices[i].Y);
+    }
+    // Vertices are relative to the widget, in 28.4 fixed point
+    const Rect bounds((int16_t)(absoluteRect.x + (minX >> 4)), (int16_t)(absoluteRect.y + (minY >> 4)),
+                      (int16_t)(((maxX - minX) >> 4) + 1), (int16_t)(((maxY - minY) >> 4) + 1));
+    uint32_t pixels = (bounds & absoluteRect & dirtyAreaAbsolute).area();
+    if (numVertices == 3)
+    {
+        // A triangle covers half of its bounding box
+        pixels /= 2;
+    }
+    TextureCache::sampled(texture.data, pixels);
+
+    // One texel is fetched per pixel drawn, bilinear filtering mostly hits the same lines
+    const Bitmap::BitmapFormat format = (Bitmap::BitmapFormat)(renderVariant >> RenderingVariant_FormatShift);
+    countTraffic(texture.data, CortexMMCUInstrumentation::pixelBytes(format, pixels), pixels,
+                 alpha < 255 || (renderVariant & RenderingVariant_Alpha) != 0);
+}
+
+void HybridLCDGPU2D::waitForGPU2D()
+{
+    nema_hal_fence_wait();
+
+    nema_cmdlist_t* cl = nema_cl_get_bound();
+    if (cl != 0 && cl->offset > 0)
+    {
+        // Execute what has been recorded so far, before DMA2D draws on top of it
+        nema_cl_submit(cl);
+        nema_cl_wait(cl);
+        nema_cl_rewind(cl);
+        stats.gpu2dSyncs++;
+    }
+}
+
+void HybridLCDGPU2D::queue(BlitOp& op, const Rect& area)
+{
+    waitForGPU2D();
+
+    // Locking the framebuffer is what gives the LCD classes access to the current
+    // render target, the DMA2D operation itself is asynchronous
+    uint16_t* const framebuffer = HAL::getInstance()->lockFrameBuffer();
+    HAL::getInstance()->unlockFrameBuffer();
+    op.pDst = framebuffer + area.y * HAL::FRAME_BUFFER_WIDTH + area.x;
+
+    stats.dma2dOps++;
+    stats.dma2dPixels += (uint32_t)op.nSteps * op.nLoops;
+    dma2dPending = true;
+    dma.addToQueue(op);
+}
+
+void HybridLCDGPU2D::queueMemoryCopy(const BlitOp& op)
+{
+    flushGlyphs();
+    waitForGPU2D();
+    stats.dma2dOps++;
+    stats.dma2dPixels += (uint32_t)op.nSteps * op.nLoops;
+    dma2dPending = true;
+    dma.addToQueue(op);
+}
+
+void HybridLCDGPU2D::completeSnapshots()
+{
+    // Callbacks may queue another snapshot
+    Snapshot completed[HYBRID_SNAPSHOT_QUEUE_SIZE];
+    const uint16_t count = snapshotCount;
+    memcpy(completed, snapshots, count * sizeof(Snapshot));
+    snapshotCount = 0;
+    for (uint16_t i = 0; i < count; i++)
+    {
+        const Snapshot& snapshot = completed[i];
+        // Lines the CPU fetched while DMA2D was writing are stale
+        DCacheMaintenance::invalidate(snapshot.start, snapshot.size);
+        if (snapshot.done != 0 && snapshot.done->isValid())
+        {
+            snapshot.done->execute(snapshot.id);
+        }
+    }
+}
+
+void HybridLCDGPU2D::onCommandListSubmit()
+{
+    // GPU2D may draw on top of the pixels written by DMA2D
+    if (instance != 0 && instance->dma2dPending)
+    {
+        instance->stats.dma2dSyncs++;
+        instance->waitForDMA2D();
+    }
+}
+} // namespace touchgfx
+
+/* USER CODE END HybridLCDGPU2D.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,1177 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : HybridLCDGPU2D.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef HYBRIDLCDGPU2D_HPP
+#define HYBRIDLCDGPU2D_HPP
+
+#include <touchgfx_nema/LCDGPU2D_AXI.hpp>
+#include <touchgfx/Callback.hpp>
+#include <touchgfx/Matrix3x3.hpp>
+#include <touchgfx/hal/DMA.hpp>
+#include <nema_cmdlist.h>
+#include <stdint.h>
+
+/* USER CODE BEGIN HybridLCDGPU2D.hpp */
+
+/**
+ * Set to 0 to render all operations on GPU2D, as LCDGPU2D_AXI does.
+ */
+#ifndef HYBRID_BLIT_DISPATCH
+#define HYBRID_BLIT_DISPATCH 1
+#endif
+
+/**
+ * Size, in pixels, from which the default costs send an operation to DMA2D rather than
+ * GPU2D. Smaller operations are cheaper to add to the GPU2D command list than to
+ * synchronize the two engines for. calibrateCosts() replaces the defaults with measured
+ * costs.
+ */
+#ifndef HYBRID_BLIT_DMA2D_MIN_PIXELS
+#define HYBRID_BLIT_DMA2D_MIN_PIXELS 4096
+#endif
+
+/**
+ * Number of glyphs from the glyph atlas drawn with one texture binding and blend setup.
+ */
+#ifndef HYBRID_GLYPH_BATCH_SIZE
+#define HYBRID_GLYPH_BATCH_SIZE 64
+#endif
+
+/**
+ * Number of solid fills drawn by GPU2D with one blend setup. 0 draws every fill on its own.
+ */
+#ifndef HYBRID_FILL_BATCH_SIZE
+#define HYBRID_FILL_BATCH_SIZE 64
+#endif
+
+/**
+ * Number of bitmap blits held back to be sorted by texture and blend state before they are
+ * recorded, see batchBlit(). 0 records every blit as it is drawn.
+ */
+#ifndef HYBRID_BLIT_SORT_SIZE
+#define HYBRID_BLIT_SORT_SIZE 32
+#endif
+
+/**
+ * Number of different textures and blend states among the blits held back.
+ */
+#ifndef HYBRID_BLIT_SORT_BATCHES
+#define HYBRID_BLIT_SORT_BATCHES 8
+#endif
+
+/**
+ * Number of framebuffer snapshots that can be queued on DMA2D before one is waited for.
+ */
+#ifndef HYBRID_SNAPSHOT_QUEUE_SIZE
+#define HYBRID_SNAPSHOT_QUEUE_SIZE 4
+#endif
+
+/**
+ * Number of recorded command list fragments kept for replay, see beginFragment(). 0
+ * disables recording.
+ */
+#ifndef HYBRID_FRAGMENTS
+#define HYBRID_FRAGMENTS 8
+#endif
+
+/**
+ * Size in bytes of the command list of a fragment. A subtree whose commands do not fit is
+ * drawn without being recorded.
+ */
+#ifndef HYBRID_FRAGMENT_SIZE
+#define HYBRID_FRAGMENT_SIZE 4096
+#endif
+
+namespace touchgfx
+{
+/**
+ * @class HybridLCDGPU2D
+ *
+ * @brief LCDGPU2D_AXI that offloads solid fills and opaque copies to DMA2D or the CPU.
+ *
+ *        Solid fills and opaque RGB565 copies are executed on the engine with the lowest
+ *        cost for their size, see selectEngine(): large ones are queued on the ChromART
+ *        (DMA2D) engine, tiny ones written by the CPU, while blends, transparent copies
+ *        and all transformations are recorded in the GPU2D command list as usual. GPU2D
+ *        only executes its command list when it is submitted, so DMA2D fills, typically
+ *        backgrounds, run while the CPU is still recording the widgets drawn on top. The
+ *        costs are set from defaults and can be measured with calibrateCosts() or changed
+ *        with setCost() at run time.
+ *
+ *        The engines are kept in drawing order: before a DMA2D operation is queued, any
+ *        recorded GPU2D commands are submitted and completed, and before GPU2D is given a
+ *        command list, outstanding DMA2D operations are completed, see
+ *        nema_hal_set_submit_hook().
+ *
+ *        Every operation also counts the bytes it reads and writes, by memory region, in
+ *        CortexMMCUInstrumentation. GPU2D operations are counted against the region of the
+ *        framebuffer shown by LTDC. Bitmaps and textures drawn are reported to TextureCache.
+ *        Texture mapped triangles and quads drawn smaller than their texture sample a level
+ *        of it from TextureMipChain when one has been generated.
+ *
+ *        4bpp glyphs are drawn from GlyphAtlas. The glyphs of a string on the same atlas
+ *        page, in the same color, are collected and drawn together when the string is done,
+ *        see flushGlyphs(), or when anything else is drawn. Strings laid out once with
+ *        recordString() are drawn again with drawRecordedGlyphs(), see ShapedTextCache.
+ *
+ *        Fills too small for DMA2D, the backgrounds and borders of Box, BoxWithBorder and
+ *        BoxProgress, are collected in the same way, whatever their color, and recorded
+ *        with one blend setup when anything else is drawn. A border of four fills costs
+ *        four nema_fill_rect() commands, not four fills each binding the framebuffer and
+ *        setting the clip and blend mode again.
+ *
+ *        Bitmaps that blend, drawn by Image and the other widgets through
+ *        drawPartialBitmap(), are held back and sorted by texture and blend state. A blit
+ *        joins the last held blit of the same bitmap and alpha if no blit held after that
+ *        one overlaps it, and is otherwise queued after them, so overlapping blits keep the
+ *        order of the widgets. When anything else is drawn, the blits are recorded one
+ *        texture at a time, each texture bound and its blend set once. The icons of a grid
+ *        drawn from the same bitmap, separated by labels or backgrounds that do not overlap
+ *        them, cost one binding instead of one per icon.
+ *
+ *        Snapshots of the displayed framebuffer, as SnapshotWidget::makeSnapshot() takes
+ *        them, are copied by DMA2D after the GPU2D commands recorded so far, see
+ *        copyFrameBufferRegionToMemoryAsync().
+ *
+ *        The commands of a subtree drawn the same way as in an earlier frame can be
+ *        replayed from a recorded fragment with one branch, see beginFragment().
+ *
+ *        L8 bitmaps with an ARGB8888 or RGB888 palette are blitted by GPU2D from where
+ *        they are stored, one byte per pixel, with the palette bound as a lookup texture,
+ *        instead of by DMA2D or the CPU of LCDGPU2D_AXI. Monochrome and few-color icons
+ *        stored as L8 take a quarter of the flash and XSPI traffic of ARGB8888. Compressed
+ *        L8 bitmaps, whose L4, RLE and LZW9 formats GPU2D cannot decode, are left to
+ *        LCDGPU2D_AXI.
+ *
+ *        In portrait, HAL::DISPLAY_ROTATION rotate90, the operations of this class take
+ *        display coordinates as in landscape and turn them into the landscape framebuffer
+ *        as they are recorded: rectangles with DisplayTransformation, blits as quads whose
+ *        corners are turned, and TSVG images with the rotation added to their matrix. GPU2D
+ *        samples the bitmaps turned, so the rotation costs nothing more than the blit, and
+ *        LTDC scans out the framebuffer as it is. Opaque copies, snapshots and screen
+ *        transitions, which DMA2D and nema_transition() cannot turn, are left to
+ *        LCDGPU2D_AXI.
+ */
+class HybridLCDGPU2D : public LCDGPU2D_AXI
+{
+public:
+    /** A glyph as placed by LCD::drawString(), relative to the widget. */
+    struct RecordedGlyph
+    {
+        const GlyphNode* glyph;
+        const uint8_t* data;
+        int16_t x;
+        int16_t y;
+        uint16_t offsetX; ///< Columns of the glyph left of the widget
+        uint16_t offsetY; ///< Rows of the glyph above the widget
+        uint8_t bitsPerPixel;
+        uint8_t dataFormatA4;
+    };
+
+    /** Screen transitions of NemaGFX, see drawTransition(). */
+    enum TransitionEffect
+    {
+        TRANSITION_CUBE,       ///< The screens are faces of a cube turning
+        TRANSITION_INNER_CUBE, ///< The screens are faces of a cube turning, seen from inside
+        TRANSITION_STACK,      ///< The old screen shrinks back as the new one slides over it
+        TRANSITION_FADE_ZOOM   ///< The new screen fades in while the old one zooms out
+    };
+
+    /** Number of operations and pixels dispatched to each engine. */
+    struct Stats
+    {
+        uint32_t dma2dOps;          ///< Operations executed by DMA2D
+        uint32_t dma2dPixels;       ///< Pixels written by DMA2D
+        uint32_t cpuOps;            ///< Fills and copies written by the CPU
+        uint32_t cpuPixels;         ///< Pixels written by the CPU
+        uint32_t gpu2dOps;          ///< Fills and copies executed by GPU2D
+        uint32_t gpu2dPixels;       ///< Pixels written by fills and copies on GPU2D
+        uint32_t gpu2dSyncs;        ///< Times DMA2D had to wait for GPU2D to complete
+        uint32_t dma2dSyncs;        ///< Times GPU2D had to wait for DMA2D to complete
+        uint32_t glyphBatches;      ///< Batches of glyphs drawn from the glyph atlas
+        uint32_t glyphs;            ///< Glyphs drawn in those batches
+        uint32_t fillBatches;       ///< Batches of solid fills drawn by GPU2D
+        uint32_t fills;             ///< Fills drawn in those batches
+        uint32_t blitBatches;       ///< Textures bound for the sorted blits, see batchBlit()
+        uint32_t sortedBlits;       ///< Blits recorded in those batches
+        uint32_t reorderedBlits;    ///< Blits moved ahead of other blits to join their texture
+        uint32_t snapshots;         ///< Snapshots copied by DMA2D
+        uint32_t quadBatches;       ///< Batches of texture mapped quads, see drawTextureQuads()
+        uint32_t quads;             ///< Quads drawn in those batches
+        uint32_t scaledBitmaps;     ///< Bitmaps drawn scaled, see drawScaledBitmap()
+        uint32_t tiledBitmaps;      ///< Bitmaps drawn tiled, see drawTiledBitmap()
+        uint32_t tiles;             ///< Blits of those, one per bitmap with a power of two size
+        uint32_t transitions;       ///< Steps of screen transitions drawn, see drawTransition()
+        uint32_t tsvgs;             ///< TSVG images drawn, see drawTSVG()
+        uint32_t coverageMasks;     ///< A8 coverage masks drawn, see drawA8Mask()
+        uint32_t maskedBitmaps;     ///< Bitmaps drawn through a coverage mask, see drawMaskedBitmap()
+        uint32_t kicks;             ///< Command lists submitted without waiting, see kickGPU2D()
+        uint32_t videoFrames;       ///< UYVY video frames drawn, see drawUYVY()
+        uint32_t indexedBitmaps;    ///< L8 bitmaps sampled with their palette by GPU2D
+        uint32_t premultiplied;     ///< Bitmaps and quads blended as premultiplied
+        uint32_t rotated;           ///< Batches, bitmaps and images above drawn turned for portrait
+        uint32_t fragmentsRecorded; ///< Fragments recorded, see beginFragment()
+        uint32_t fragmentsReplayed; ///< Fragments branched to without drawing again
+        uint32_t fragmentOverflows; ///< Subtrees too large for a fragment
+        uint32_t vectorAreas;       ///< Areas drawn with NemaVG, in one piece or in tiles
+        uint32_t stencilTiles;      ///< Tiles of the stencil those were drawn in, see beginStencilTile()
+        uint32_t stencilPixels;     ///< Pixels of the stencil touched
+        uint32_t stencilRight;      ///< Largest right edge touched in the stencil, the width it needs
+        uint32_t stencilBottom;     ///< Largest bottom edge touched in the stencil, the height it needs
+        uint32_t stencilClipped;    ///< Areas drawn past the edges of the stencil tile, and clipped by NemaVG
+    };
+
+    /** The engines a fill or copy can be executed on, see selectEngine(). */
+    enum Engine
+    {
+        ENGINE_CPU,       ///< Written by the CPU into the framebuffer
+        ENGINE_DMA2D,     ///< Queued on DMA2D
+        ENGINE_GPU2D,     ///< Recorded in the GPU2D command list
+        NUMBER_OF_ENGINES
+    };
+
+    /** The operations dispatched by their cost, see setCost(). */
+    enum CostedOperation
+    {
+        COST_FILL,        ///< Opaque solid fill
+        COST_FILL_BLEND,  ///< Solid fill blended with the framebuffer, which DMA2D does not do here
+        COST_COPY_RGB565, ///< Opaque copy of RGB565 pixels
+        NUMBER_OF_COSTED_OPERATIONS
+    };
+
+    /** Cost of an operation on an engine, in CPU cycles until its pixels are written. */
+    struct EngineCost
+    {
+        uint32_t setupCycles;       ///< Cycles whatever the size, UNAVAILABLE if the engine cannot execute it
+        uint32_t cyclesPer64Pixels; ///< Cycles for every 64 pixels
+    };
+
+    /** Setup cost of an operation an engine cannot execute. */
+    static const uint32_t UNAVAILABLE = 0xFFFFFFFFU;
+
+    /** What beginFragment() did. */
+    enum FragmentResult
+    {
+        FRAGMENT_REPLAYED,   ///< The recorded commands were added, the subtree must not be drawn
+        FRAGMENT_RECORDING,  ///< The subtree must be drawn, then endFragment() called
+        FRAGMENT_UNAVAILABLE ///< The subtree must be drawn as usual
+    };
+
+    /**
+     * @fn HybridLCDGPU2D::HybridLCDGPU2D(DMA_Interface& dma);
+     *
+     * @brief Constructor.
+     *
+     * @param dma The ChromART DMA driver used for the offloaded operations.
+     */
+    explicit HybridLCDGPU2D(DMA_Interface& dma);
+
+    virtual void init();
+
+    /**
+     * @fn static HybridLCDGPU2D* HybridLCDGPU2D::getInstance();
+     *
+     * @brief Gets the LCD, once initialized.
+     *
+     * @return The LCD, or 0 before init().
+     */
+    static HybridLCDGPU2D* getInstance()
+    {
+        return instance;
+    }
+
+    /**
+     * @fn virtual void HybridLCDGPU2D::bindFrameBufferTexture();
+     *
+     * @brief Binds the framebuffer as destination texture, or the part of it under the
+     *        stencil tile between beginStencilTile() and endStencilTile().
+     */
+    virtual void bindFrameBufferTexture();
+
+    virtual void fillRect(const Rect& rect, colortype color, uint8_t alpha = 255);
+
+    virtual void blitCopy(const uint16_t* sourceData, const Rect& source, const Rect& blitRect, uint8_t alpha, bool hasTransparentPixels);
+
+    virtual void blitCopy(const uint8_t* sourceData, Bitmap::BitmapFormat sourceFormat, const Rect& source, const Rect& blitRect, uint8_t alpha, bool hasTransparentPixels);
+
+    virtual void drawPartialBitmap(const Bitmap& bitmap, int16_t x, int16_t y, const Rect& rect, uint8_t alpha = 255, bool useOptimized = true);
+
+    /**
+     * @fn virtual uint16_t* HybridLCDGPU2D::copyFrameBufferRegionToMemory(const Rect& visRegion, const Rect& absRegion, const BitmapId bitmapId);
+     *
+     * @brief Copies part of the displayed framebuffer to a bitmap, and waits for the copy.
+     *
+     * @param visRegion The part of absRegion to copy.
+     * @param absRegion The area on screen the bitmap covers.
+     * @param bitmapId  The bitmap, a dynamic bitmap or BITMAP_ANIMATION_STORAGE.
+     *
+     * @return The pixels of the bitmap.
+     *
+     * @see copyFrameBufferRegionToMemoryAsync
+     */
+    virtual uint16_t* copyFrameBufferRegionToMemory(const Rect& visRegion, const Rect& absRegion, const BitmapId bitmapId);
+
+    /**
+     * @fn uint16_t* HybridLCDGPU2D::copyFrameBufferRegionToMemoryAsync(const Rect& visRegion, const Rect& absRegion, const BitmapId bitmapId, GenericCallback<BitmapId>* done = 0);
+     *
+     * @brief Queues a copy of part of the displayed framebuffer to a bitmap on DMA2D.
+     *
+     *        The GPU2D commands recorded so far are executed first, and GPU2D waits for
+     *        DMA2D before it executes later commands, so the bitmap can be drawn at once.
+     *        The CPU must not read the bitmap before the copy is done: done is called from
+     *        endFrame() of the frame the copy completes in, or from finishSnapshots(). Only
+     *        the data cache lines of the copied region are cleaned and invalidated.
+     *
+     *        DMA2D converts the framebuffer to an RGB888 or ARGB8888 bitmap as it copies, see
+     *        PixelConversion::isConvertedByDMA2D(). Framebuffers that DMA2D cannot copy,
+     *        rotated or not RGB565, and other bitmap formats are copied at once the way
+     *        LCDGPU2D_AXI does, and done is called before returning.
+     *
+     * @param visRegion The part of absRegion to copy.
+     * @param absRegion The area on screen the bitmap covers.
+     * @param bitmapId  The bitmap, a dynamic bitmap or BITMAP_ANIMATION_STORAGE.
+     * @param done      (Optional) Called with bitmapId when the copy is done.
+     *
+     * @return The pixels of the bitmap.
+     */
+    uint16_t* copyFrameBufferRegionToMemoryAsync(const Rect& visRegion, const Rect& absRegion, const BitmapId bitmapId, GenericCallback<BitmapId>* done = 0);
+
+    /**
+     * @fn void HybridLCDGPU2D::pollSnapshots();
+     *
+     * @brief Completes the queued snapshots if DMA2D is done with them.
+     */
+    void pollSnapshots();
+
+    /**
+     * @fn void HybridLCDGPU2D::finishSnapshots();
+     *
+     * @brief Waits for the queued snapshots and completes them.
+     */
+    void finishSnapshots();
+
+    /**
+     * @fn void HybridLCDGPU2D::setGPU2DSourceRegion(const void* start, uint32_t size);
+     *
+     * @brief Sets a memory region that copies are always executed from on GPU2D.
+     *
+     *        Used for the video decode buffers: DMA2D converts the decoded video frames, so
+     *        copying them to the framebuffer on GPU2D keeps the two from competing for DMA2D.
+     *
+     * @param start Start of the region.
+     * @param size  Size of the region in bytes, 0 to disable.
+     */
+    void setGPU2DSourceRegion(const void* start, uint32_t size);
+
+    /**
+     * @fn void HybridLCDGPU2D::waitForDMA2D();
+     *
+     * @brief Blocks until all operations queued on DMA2D have completed.
+     */
+    void waitForDMA2D();
+
+    /**
+     * @fn void HybridLCDGPU2D::finishDrawing();
+     *
+     * @brief Executes everything drawn so far, and blocks until GPU2D and DMA2D have written
+     *        it to the framebuffer.
+     *
+     * @see BlitBenchmark
+     */
+    void finishDrawing();
+
+    /**
+     * @fn uint32_t HybridLCDGPU2D::kickGPU2D();
+     *
+     * @brief Submits the commands recorded so far to GPU2D without waiting for them.
+     *
+     *        GPU2D otherwise only starts on the command list of a frame when it is
+     *        submitted at the end of the frame, or when DMA2D must draw after it. The
+     *        commands after a kick are recorded into another command list, two of which
+     *        are used in turn, so the CPU keeps preparing the next operation while GPU2D
+     *        executes the last. GPU2D executes the lists in the order they are submitted.
+     *        A buffer read by the kicked commands may be written again once
+     *        waitForKick() returns. endKicks() binds the command list of the frame again
+     *        and is called before the frame ends.
+     *
+     *        While a fragment is recorded, or when the command lists cannot be created,
+     *        the commands are executed and waited for at once.
+     *
+     * @return The kick, to pass to waitForKick(), 0 if there is nothing to wait for.
+     */
+    uint32_t kickGPU2D();
+
+    /**
+     * @fn void HybridLCDGPU2D::waitForKick(uint32_t kick);
+     *
+     * @brief Blocks until GPU2D has executed the commands of a kick and those before it.
+     *
+     * @param kick The kick returned by kickGPU2D().
+     */
+    void waitForKick(uint32_t kick);
+
+    /**
+     * @fn void HybridLCDGPU2D::endKicks();
+     *
+     * @brief Executes the commands recorded since the last kick, waits for all kicked
+     *        commands and binds the command list of the frame again.
+     */
+    void endKicks();
+
+    /**
+     * @fn void HybridLCDGPU2D::queueMemoryCopy(const BlitOp& op);
+     *
+     * @brief Queues a copy between buffers in memory on DMA2D, in drawing order.
+     *
+     *        The GPU2D commands recorded so far are executed first, as they may write the
+     *        source, and GPU2D waits for the copy before it executes later commands. The
+     *        data cache is not maintained, see AsyncBlockCopy.
+     *
+     * @param op The copy, with pSrc and pDst set.
+     */
+    void queueMemoryCopy(const BlitOp& op);
+
+    /**
+     * @fn bool HybridLCDGPU2D::isDMA2DIdle() const;
+     *
+     * @brief Tells if all operations queued on DMA2D have completed.
+     *
+     * @return true if DMA2D is idle.
+     */
+    bool isDMA2DIdle() const
+    {
+        return dma.isDmaQueueEmpty() && !dma.isDMARunning();
+    }
+
+    /**
+     * @fn void HybridLCDGPU2D::flushGlyphs();
+     *
+     * @brief Records the glyphs collected from the glyph atlas, or the fills collected, in
+     *        the GPU2D command list.
+     *
+     *        Called when the framebuffer is unlocked, which LCD::drawString() does when a
+     *        string is done, and before any other operation is drawn.
+     */
+    void flushGlyphs();
+
+    /**
+     * @fn int32_t HybridLCDGPU2D::recordString(const Rect& widgetArea, const StringVisuals& visuals, const Unicode::UnicodeChar* text, RecordedGlyph* glyphs, uint16_t capacity);
+     *
+     * @brief Lays out a string as drawString() would, without drawing it.
+     *
+     *        The whole widget is laid out, and the glyphs drawString() places are stored
+     *        instead of drawn, so drawRecordedGlyphs() can later draw any part of the
+     *        string without going over the text, kerning and line breaks again.
+     *
+     * @param       widgetArea The absolute area of the widget.
+     * @param       visuals    The string visuals, as passed to drawString().
+     * @param       text       The text.
+     * @param [out] glyphs     The placed glyphs.
+     * @param       capacity   The number of glyphs that fit in glyphs.
+     *
+     * @return The number of glyphs placed, -1 if they did not fit, or -2 if the string is
+     *         not drawn with drawGlyph().
+     */
+    int32_t recordString(const Rect& widgetArea, const StringVisuals& visuals, const Unicode::UnicodeChar* text, RecordedGlyph* glyphs, uint16_t capacity);
+
+    /**
+     * @fn bool HybridLCDGPU2D::renderStringMask(const Rect& widgetArea, const StringVisuals& visuals, const Unicode::UnicodeChar* text, uint8_t* mask);
+     *
+     * @brief Renders the coverage of a string into an A8 mask the size of the widget,
+     *        without drawing it.
+     *
+     *        The string is laid out as drawString() would, and every glyph placed is
+     *        written into the mask by the CPU, overlapping glyphs adding up their
+     *        coverage. The mask is then drawn in any color with drawA8Mask(), one blit for
+     *        the whole string. 4bpp glyphs stored in rows, as the glyph atlas takes them,
+     *        and 8bpp glyphs are rendered.
+     *
+     * @param       widgetArea The absolute area of the widget.
+     * @param       visuals    The string visuals, unrotated.
+     * @param       text       The text.
+     * @param [out] mask       widgetArea.width by widgetArea.height bytes.
+     *
+     * @return false if the string has glyphs that cannot be rendered, vector glyphs or
+     *         glyphs of another format, or is rotated.
+     */
+    bool renderStringMask(const Rect& widgetArea, const StringVisuals& visuals, const Unicode::UnicodeChar* text, uint8_t* mask);
+
+    /**
+     * @fn void HybridLCDGPU2D::drawRecordedGlyphs(const Rect& widgetArea, const Rect& invalidatedArea, const RecordedGlyph* glyphs, uint16_t count, colortype color, uint8_t alpha, TextRotation rotation);
+     *
+     * @brief Draws glyphs placed by recordString().
+     *
+     * @param widgetArea      The absolute area of the widget, the same size as when recorded.
+     * @param invalidatedArea The area to draw, relative to the widget.
+     * @param glyphs          The placed glyphs.
+     * @param count           The number of glyphs.
+     * @param color           The color of the text.
+     * @param alpha           The alpha of the text.
+     * @param rotation        The rotation of the text, as when recorded.
+     */
+    void drawRecordedGlyphs(const Rect& widgetArea, const Rect& invalidatedArea, const RecordedGlyph* glyphs, uint16_t count, colortype color, uint8_t alpha, TextRotation rotation);
+
+    /**
+     * @fn bool HybridLCDGPU2D::drawTextureQuads(const Bitmap& bitmap, const float* corners, uint16_t count, int16_t x, int16_t y, const Rect& clip, uint8_t alpha, bool bilinear);
+     *
+     * @brief Draws a bitmap mapped onto many quadrilaterals, with one texture bind.
+     *
+     *        drawTextureMapQuad() sets up the texture, the blending and the clip of every
+     *        quad it draws. Here they are set once, and every quad is one
+     *        nema_blit_quad_fit() in the command list, the whole bitmap fitted to the
+     *        corners. The corners are not divided by a depth, so the quads are drawn
+     *        without perspective.
+     *
+     * @param bitmap   The bitmap, RGB565, RGB888, ARGB8888 or L8, see sourceFormat().
+     * @param corners  Eight floats per quad, x and y of the corners that the top left, top
+     *                 right, bottom right and bottom left corner of the bitmap are drawn
+     *                 at, relative to x, y.
+     * @param count    The number of quads.
+     * @param x        The absolute x coordinate the corners are relative to.
+     * @param y        The absolute y coordinate the corners are relative to.
+     * @param clip     The absolute area to draw in.
+     * @param alpha    The alpha of the quads.
+     * @param bilinear True to sample the bitmap with bilinear filtering, false for the
+     *                 nearest texel. GPU2D samples L8 bitmaps at the nearest texel only.
+     *
+     * @return false if nothing was drawn as the bitmap or the display orientation is not
+     *         supported.
+     */
+    bool drawTextureQuads(const Bitmap& bitmap, const float* corners, uint16_t count, int16_t x, int16_t y, const Rect& clip, uint8_t alpha, bool bilinear);
+
+    /**
+     * @fn bool HybridLCDGPU2D::drawScaledBitmap(const Bitmap& bitmap, const Rect& dest, const Rect& clip, uint8_t alpha, bool bilinear);
+     *
+     * @brief Draws a bitmap scaled to a rectangle, with one nema_blit_rect_fit().
+     *
+     *        A scaled bitmap drawn by the texture mappers is split into triangles, each one
+     *        set up on its own. Here the texture is bound once and GPU2D fits it to the
+     *        rectangle. A bitmap drawn at less than half its size samples a level of
+     *        TextureMipChain, if one has been generated.
+     *
+     * @param bitmap   The bitmap, RGB565, RGB888, ARGB8888 or L8, see sourceFormat().
+     * @param dest     The absolute rectangle the whole bitmap is fitted to.
+     * @param clip     The absolute area to draw in.
+     * @param alpha    The alpha of the bitmap.
+     * @param bilinear True to sample the bitmap with bilinear filtering, false for the
+     *                 nearest texel. GPU2D samples L8 bitmaps at the nearest texel only.
+     *
+     * @return false if nothing was drawn as the bitmap or the display orientation is not
+     *         supported.
+     */
+    bool drawScaledBitmap(const Bitmap& bitmap, const Rect& dest, const Rect& clip, uint8_t alpha, bool bilinear);
+
+    /**
+     * @fn bool HybridLCDGPU2D::drawTiledBitmap(const Bitmap& bitmap, int16_t x, int16_t y, int16_t xOffset, int16_t yOffset, const Rect& clip, uint8_t alpha);
+     *
+     * @brief Draws a bitmap repeated over an area, binding the texture once.
+     *
+     *        A bitmap with a power of two width and height, the sizes GPU2D wraps, is bound
+     *        with NEMA_TEX_REPEAT and the whole area is drawn with one nema_blit_subrect(),
+     *        whatever the offset. Other bitmaps are drawn with a nema_blit_subrect() per
+     *        tile, still from the one texture bound.
+     *
+     * @param bitmap  The bitmap, RGB565, RGB888, ARGB8888 or L8, see sourceFormat().
+     * @param x       The absolute x coordinate of the tiled area, where the offset applies.
+     * @param y       The absolute y coordinate of the tiled area.
+     * @param xOffset The pixel of the bitmap at x, in 0 to the width of the bitmap - 1.
+     * @param yOffset The pixel of the bitmap at y, in 0 to the height of the bitmap - 1.
+     * @param clip    The absolute area to draw.
+     * @param alpha   The alpha of the bitmap.
+     *
+     * @return false if nothing was drawn as the bitmap or the display orientation is not
+     *         supported.
+     */
+    bool drawTiledBitmap(const Bitmap& bitmap, int16_t x, int16_t y, int16_t xOffset, int16_t yOffset, const Rect& clip, uint8_t alpha);
+
+    /**
+     * @fn bool HybridLCDGPU2D::drawA8Mask(const uint8_t* mask, uint16_t width, uint16_t height, int16_t x, int16_t y, const Rect& clip, colortype color, uint8_t alpha);
+     *
+     * @brief Draws a solid color through an A8 coverage mask.
+     *
+     *        The mask is bound as a NEMA_A8 texture and blended with one
+     *        nema_blit_subrect(), the color and alpha modulating every texel, as the
+     *        glyphs are drawn from the glyph atlas. Lets a canvas widget that was
+     *        rasterized once be drawn again without going over its outline.
+     *
+     * @param mask   The coverage, one byte per pixel, width bytes per line.
+     * @param width  The width of the mask.
+     * @param height The height of the mask.
+     * @param x      The absolute x coordinate of the mask.
+     * @param y      The absolute y coordinate of the mask.
+     * @param clip   The absolute area to draw.
+     * @param color  The color.
+     * @param alpha  The alpha, multiplied with the coverage.
+     *
+     * @return false if nothing was drawn as the display orientation is not supported.
+     */
+    bool drawA8Mask(const uint8_t* mask, uint16_t width, uint16_t height, int16_t x, int16_t y, const Rect& clip, colortype color, uint8_t alpha);
+
+    /**
+     * @fn bool HybridLCDGPU2D::drawMaskedBitmap(const uint8_t* mask, uint16_t width, uint16_t height, int16_t x, int16_t y, const Bitmap& bitmap, int16_t u, int16_t v, const Rect& clip, uint8_t alpha);
+     *
+     * @brief Draws a bitmap through an A8 coverage mask.
+     *
+     *        The bitmap is bound as the source texture and the mask as NEMA_TEX3, both
+     *        starting at the top left pixel drawn, and blended with one
+     *        nema_blit_subrect() with NEMA_BLOP_STENCIL_TXTY, which has every texel
+     *        multiplied with the coverage at the same texture coordinates. Fills the
+     *        outline of a canvas widget, rasterized into the mask, with a bitmap without
+     *        the CPU reading a texel. Pixels outside the bitmap are not drawn.
+     *
+     * @param mask   The coverage, one byte per pixel, width bytes per line.
+     * @param width  The width of the mask.
+     * @param height The height of the mask.
+     * @param x      The absolute x coordinate of the mask.
+     * @param y      The absolute y coordinate of the mask.
+     * @param bitmap The bitmap, RGB565, RGB888, ARGB8888 or L8, see canSample().
+     * @param u      The x coordinate of the texel of the bitmap drawn at x, may be negative.
+     * @param v      The y coordinate of the texel of the bitmap drawn at y, may be negative.
+     * @param clip   The absolute area to draw.
+     * @param alpha  The alpha, multiplied with the coverage.
+     *
+     * @return false if nothing was drawn as the bitmap or the display orientation is not
+     *         supported.
+     */
+    bool drawMaskedBitmap(const uint8_t* mask, uint16_t width, uint16_t height, int16_t x, int16_t y, const Bitmap& bitmap, int16_t u, int16_t v, const Rect& clip, uint8_t alpha);
+
+    /**
+     * @fn static bool HybridLCDGPU2D::canSample(const Bitmap& bitmap);
+     *
+     * @brief Tells if GPU2D samples the pixels of a bitmap, see drawMaskedBitmap().
+     *
+     * @param bitmap The bitmap.
+     *
+     * @return true for RGB565 without alpha channel, RGB888, ARGB8888 not premultiplied,
+     *         and uncompressed L8 with an ARGB8888 or RGB888 palette.
+     */
+    static bool canSample(const Bitmap& bitmap);
+
+    /**
+     * @fn bool HybridLCDGPU2D::drawUYVY(const uint8_t* frame, uint16_t width, uint16_t height, uint32_t stride, int16_t x, int16_t y, const Rect& clip, uint8_t alpha);
+     *
+     * @brief Draws a video frame decoded to UYVY, converting it to RGB as it is sampled.
+     *
+     *        The frame is bound as a NEMA_UYVY texture and copied with one
+     *        nema_blit_subrect(), so the frame is read once, by GPU2D, and never converted
+     *        to RGB565 in memory first.
+     *
+     * @param frame  The frame, U, Y, V, Y for every two pixels.
+     * @param width  The width of the frame.
+     * @param height The height of the frame.
+     * @param stride The bytes per line of the frame.
+     * @param x      The absolute x coordinate of the frame.
+     * @param y      The absolute y coordinate of the frame.
+     * @param clip   The absolute area to draw.
+     * @param alpha  The alpha of the frame.
+     *
+     * @return false if nothing was drawn as the display orientation is not supported.
+     */
+    bool drawUYVY(const uint8_t* frame, uint16_t width, uint16_t height, uint32_t stride, int16_t x, int16_t y, const Rect& clip, uint8_t alpha);
+
+    /**
+     * @fn bool HybridLCDGPU2D::drawTransition(TransitionEffect effect, bool vertical, bool reverse, const Bitmap& from, const Bitmap& to, float step, const Rect& clip);
+     *
+     * @brief Draws a step of a screen transition with nema_transition().
+     *
+     *        The two snapshots, covering the framebuffer, are bound as textures and the
+     *        effect is drawn as a few texture mapped quads, one GPU2D pass. The parts of the
+     *        display the quads leave uncovered are cleared to black first.
+     *
+     * @param effect   The effect.
+     * @param vertical True for the screens to move vertically, where the effect moves.
+     * @param reverse  True for the screens to move right or down instead of left or up.
+     * @param from     Snapshot of the old screen, RGB565, RGB888 or ARGB8888.
+     * @param to       Snapshot of the new screen, in the same format.
+     * @param step     The progress, from 0 for the old screen to 1 for the new one.
+     * @param clip     The absolute area to draw in.
+     *
+     * @return false if nothing was drawn as the snapshots or the display orientation are
+     *         not supported.
+     */
+    bool drawTransition(TransitionEffect effect, bool vertical, bool reverse, const Bitmap& from, const Bitmap& to, float step, const Rect& clip);
+
+    /**
+     * @fn bool HybridLCDGPU2D::drawTSVG(const void* tsvg, const Matrix3x3& transform, const Rect& clip, float size = 0.0f);
+     *
+     * @brief Draws an SVG precompiled to the TSVG format of NemaVG.
+     *
+     *        The paths, paints and gradients of the image are read from the blob by
+     *        nema_vg_draw_tsvg() and drawn by GPU2D, transformed by the global matrix of
+     *        NemaVG, without the CPU building any path. The quality of NemaVG is chosen
+     *        from the size of the image by QualityGovernor::vectorQuality().
+     *
+     * @param tsvg      The TSVG blob, 4-byte aligned.
+     * @param transform Transforms the coordinates of the image to absolute coordinates.
+     * @param clip      The absolute area to draw in.
+     * @param size      The larger side of the image on screen in pixels, 0 if unknown.
+     *
+     * @return false if nothing was drawn as the display orientation is not supported.
+     */
+    bool drawTSVG(const void* tsvg, const Matrix3x3& transform, const Rect& clip, float size = 0.0f);
+
+    /**
+     * @fn bool HybridLCDGPU2D::needsStencilTiles(const Rect& area) const;
+     *
+     * @brief Tells if an area drawn with NemaVG must be drawn in tiles of the stencil.
+     *
+     *        NemaVG draws inside its stencil only, from pixel 0, 0 of the destination.
+     *        When the stencil is a tile smaller than the framebuffer, see
+     *        NEMA_HAL_STENCIL_TILE_WIDTH, an area reaching past it is drawn one tile at a
+     *        time, each with the destination moved to the top left corner of the tile.
+     *        Tiles are drawn in framebuffer formats of 16 bits and more, in the landscape
+     *        orientation.
+     *
+     * @param area The absolute area.
+     *
+     * @return true if the area must be split with getStencilTile().
+     */
+    bool needsStencilTiles(const Rect& area) const;
+
+    /**
+     * @fn static Rect HybridLCDGPU2D::getStencilTile(const Rect& area, uint16_t index);
+     *
+     * @brief Gets one of the tiles of the stencil an area is split into, row by row.
+     *
+     * @param area  The absolute area.
+     * @param index The index of the tile.
+     *
+     * @return The absolute area of the tile, empty past the last tile.
+     */
+    static Rect getStencilTile(const Rect& area, uint16_t index);
+
+    /**
+     * @fn bool HybridLCDGPU2D::beginStencilTile(const Rect& tile);
+     *
+     * @brief Moves the destination of GPU2D to a tile of the stencil.
+     *
+     *        Until endStencilTile(), bindFrameBufferTexture() binds the pixels of the
+     *        framebuffer under the tile, with pixel 0, 0 at its top left corner, so what
+     *        is drawn must be moved by -tile.x, -tile.y and clipped to the size of the
+     *        tile. Glyphs and fills collected so far are drawn first.
+     *
+     * @param tile A tile from getStencilTile().
+     *
+     * @return false if tiles are not drawn in this framebuffer format or orientation.
+     */
+    bool beginStencilTile(const Rect& tile);
+
+    /**
+     * @fn void HybridLCDGPU2D::endStencilTile();
+     *
+     * @brief Binds the whole framebuffer again from the next operation on.
+     */
+    void endStencilTile()
+    {
+        stencilTileTarget = 0;
+    }
+
+    /**
+     * @fn void HybridLCDGPU2D::countStencil(const Rect& area);
+     *
+     * @brief Counts the pixels of the stencil touched by a vector area.
+     *
+     * @param area The area in the coordinates of the stencil: absolute, or relative to the
+     *             stencil tile.
+     */
+    void countStencil(const Rect& area);
+
+    /**
+     * @fn FragmentResult HybridLCDGPU2D::beginFragment(const void* owner, uint32_t version, const Rect& area);
+     *
+     * @brief Replays the commands recorded for a subtree, or starts recording them.
+     *
+     *        Every operation binds the render target and sets the clip, so what is recorded
+     *        for a subtree is only valid for the same render target, format and absolute
+     *        area. A fragment recorded with the same owner, version, render target, format
+     *        and area is branched to from the command list, and nothing is drawn. Otherwise
+     *        the least recently used fragment not used in the current frame is bound as the
+     *        command list, and everything drawn until endFragment() is recorded into it.
+     *        While recording, fills and copies stay on GPU2D and glyphs are flushed into the
+     *        fragment. With triple buffering a subtree redrawn in the same area is replayed
+     *        from the fourth frame on, once a fragment was recorded for every framebuffer.
+     *
+     *        Only GPU2D commands are recorded: the subtree must not draw with the CPU or
+     *        submit the command list, as WidgetProfiler does. Fragments sampling bitmaps
+     *        that TextureCache, TextureMipChain or GlyphAtlas move are discarded, see
+     *        sourcesMoved().
+     *
+     * @param owner   Identifies the subtree.
+     * @param version Changed by the owner whenever the subtree looks different.
+     * @param area    The absolute area the subtree is drawn in.
+     *
+     * @return What was done, and what the caller must draw.
+     */
+    FragmentResult beginFragment(const void* owner, uint32_t version, const Rect& area);
+
+    /**
+     * @fn bool HybridLCDGPU2D::endFragment();
+     *
+     * @brief Ends the recording started by beginFragment() and branches to it.
+     *
+     * @return false if the commands did not fit in the fragment, and the subtree must be
+     *         drawn again without recording.
+     */
+    bool endFragment();
+
+    /**
+     * @fn void HybridLCDGPU2D::discardFragments(const void* owner = 0);
+     *
+     * @brief Discards the fragments recorded for a subtree, when it is destroyed.
+     *
+     * @param owner The subtree, 0 for all fragments.
+     */
+    void discardFragments(const void* owner = 0);
+
+    /**
+     * @fn void HybridLCDGPU2D::frameStarted();
+     *
+     * @brief Tells that GPU2D has completed the previous frame, so the fragments it
+     *        branched to may be recorded again.
+     */
+    void frameStarted()
+    {
+        fragmentFrame++;
+    }
+
+    /**
+     * @fn static void HybridLCDGPU2D::sourcesMoved();
+     *
+     * @brief Discards all fragments, called when cached bitmaps or glyphs they may sample
+     *        are moved or overwritten.
+     */
+    static void sourcesMoved();
+
+    /**
+     * @fn const Stats& HybridLCDGPU2D::getStats() const;
+     *
+     * @brief Gets the dispatch statistics since the last call to resetStats().
+     *
+     * @return The dispatch statistics.
+     */
+    const Stats& getStats() const
+    {
+        return stats;
+    }
+
+    /**
+     * @fn Engine HybridLCDGPU2D::selectEngine(CostedOperation operation, const Rect& area) const;
+     *
+     * @brief Gets the engine with the lowest cost for an operation.
+     *
+     *        The cost of an engine is its setup cost plus its cost per pixel. Writing with
+     *        the CPU also has to wait for what GPU2D and DMA2D have not done yet, which
+     *        costs the sync cycles more. Everything is drawn by GPU2D with
+     *        HYBRID_BLIT_DISPATCH 0, while a fragment is recorded, in portrait, with the
+     *        partial framebuffer and with a framebuffer that is not RGB565.
+     *
+     * @param operation The operation.
+     * @param area      The area written, in framebuffer coordinates.
+     *
+     * @return The engine to execute the operation on.
+     */
+    Engine selectEngine(CostedOperation operation, const Rect& area) const;
+
+    /**
+     * @fn void HybridLCDGPU2D::setCost(CostedOperation operation, Engine engine, const EngineCost& cost);
+     *
+     * @brief Sets the cost of an operation on an engine, for instance from a benchmark.
+     *
+     * @param operation The operation.
+     * @param engine    The engine.
+     * @param cost      The cost. A setup cost of UNAVAILABLE keeps the operation off the engine.
+     */
+    void setCost(CostedOperation operation, Engine engine, const EngineCost& cost)
+    {
+        costs[operation][engine] = cost;
+    }
+
+    /**
+     * @fn const EngineCost& HybridLCDGPU2D::getCost(CostedOperation operation, Engine engine) const;
+     *
+     * @brief Gets the cost of an operation on an engine.
+     *
+     * @param operation The operation.
+     * @param engine    The engine.
+     *
+     * @return The cost.
+     */
+    const EngineCost& getCost(CostedOperation operation, Engine engine) const
+    {
+        return costs[operation][engine];
+    }
+
+    /**
+     * @fn void HybridLCDGPU2D::setSyncCycles(uint32_t cycles);
+     *
+     * @brief Sets the cost of waiting for GPU2D and DMA2D before the CPU writes pixels.
+     *
+     * @param cycles The cost in CPU cycles.
+     */
+    void setSyncCycles(uint32_t cycles)
+    {
+        syncCycles = cycles;
+    }
+
+    /**
+     * @fn uint32_t HybridLCDGPU2D::getSyncCycles() const;
+     *
+     * @brief Gets the cost of waiting for GPU2D and DMA2D before the CPU writes pixels.
+     *
+     * @return The cost in CPU cycles.
+     */
+    uint32_t getSyncCycles() const
+    {
+        return syncCycles;
+    }
+
+    /**
+     * @fn bool HybridLCDGPU2D::calibrateCosts();
+     *
+     * @brief Measures the costs of the operations on every engine.
+     *
+     *        Each operation is executed on each engine on 4x4 and 64x64 pixels in the top
+     *        left corner of the framebuffer drawn, and waited for, to fit its setup cost and
+     *        cost per pixel. Copies read the displayed framebuffer. Must be called at the
+     *        start of a frame that draws the whole screen over the pixels written.
+     *
+     * @return false if the operations are not dispatched, see selectEngine().
+     */
+    bool calibrateCosts();
+
+    /**
+     * @fn void HybridLCDGPU2D::resetStats();
+     *
+     * @brief Resets the dispatch statistics.
+     */
+    void resetStats();
+
+protected:
+    virtual void drawGlyph(uint16_t* wbuf16, Rect widgetArea, int16_t x, int16_t y, uint16_t offsetX, uint16_t offsetY, const Rect& invalidatedArea, const GlyphNode* glyph, const uint8_t* glyphData, uint8_t dataFormatA4, colortype color, uint8_t bitsPerPixel, uint8_t alpha, TextRotation rotation);
+
+    virtual void drawTextureMapTriangle(const DrawingSurface& dest, const Point3D* vertices, const TextureSurface& texture, const Rect& absoluteRect, const Rect& dirtyAreaAbsolute, RenderingVariant renderVariant, uint8_t alpha = 255, uint16_t subDivisionSize = 12);
+
+    virtual void drawTextureMapQuad(const DrawingSurface& dest, const Point3D* vertices, const TextureSurface& texture, const Rect& absoluteRect, const Rect& dirtyAreaAbsolute, RenderingVariant renderVariant, uint8_t alpha = 255, uint16_t subDivisionSize = 12);
+
+private:
+    /** A snapshot queued on DMA2D. */
+    struct Snapshot
+    {
+        BitmapId id;
+        uint8_t* start; ///< First byte of the bitmap written
+        uint32_t size;  ///< Bytes from start to the last byte written
+        GenericCallback<BitmapId>* done;
+    };
+
+    /** A glyph, or the visible part of it, to draw from the glyph atlas. */
+    struct GlyphQuad
+    {
+        int16_t x;
+        int16_t y;
+        int16_t width;
+        int16_t height;
+        uint16_t atlasX;
+        uint16_t atlasY;
+    };
+
+    /** A solid fill to draw with the other fills of its batch. */
+    struct FillQuad
+    {
+        int16_t x;
+        int16_t y;
+        int16_t width;
+        int16_t height;
+        uint32_t color; ///< nema_rgba() of the color and alpha
+    };
+
+    /** A recorded command list and what it was recorded for. */
+    struct Fragment
+    {
+        nema_cmdlist_t list;
+        const void* owner; ///< 0 if nothing valid is recorded
+        uint32_t version;
+        const void* target; ///< The render target
+        Rect area;
+        uint8_t format;     ///< Bitmap::BitmapFormat of the render target
+        uint32_t lastUsed;  ///< Value of fragmentUses when last recorded or replayed
+        uint32_t lastFrame; ///< Value of fragmentFrame when last recorded or replayed
+    };
+
+    /** The area operations are clipped to, in display coordinates. */
+    static Rect screenRect();
+    /** Turns a point on the edges of the pixels from display to framebuffer coordinates. */
+    static void toFrameBuffer(float& x, float& y);
+    /** Sets the clip of GPU2D to an area in display coordinates. */
+    static void setClip(const Rect& area);
+    /** Blits the texels from u, v of the bound texture to a rectangle in display coordinates. */
+    static void blitSubrect(const Rect& dest, int32_t u, int32_t v);
+    /** Blits the bound texture to a quad whose corners are in display coordinates. */
+    static void blitQuad(float x0, float y0, float x1, float y1, float x2, float y2, float x3, float y3);
+
+    /** How GPU2D samples the pixels of a bitmap where they are stored. */
+    struct SourceFormat
+    {
+        uint32_t format;         ///< NemaGFX format of the pixels
+        uint32_t bytesPerPixel;
+        const uint8_t* palette;  ///< The colors of an L8 bitmap, 0 for other formats
+        uint32_t paletteFormat;  ///< NemaGFX format of the colors
+        bool translucent;        ///< The pixels have alpha
+        bool premultiplied;      ///< The colors are multiplied by alpha, see TextureCache::cachePremultiplied()
+    };
+
+    /** A blit held back to be drawn with the other blits of its texture. */
+    struct BlitQuad
+    {
+        int16_t x;
+        int16_t y;
+        int16_t width;
+        int16_t height;
+        int16_t u;    ///< Texel drawn at x, y
+        int16_t v;
+        uint8_t next; ///< The next blit of the batch, HYBRID_BLIT_SORT_SIZE for none
+    };
+
+    /** The blits held back of one texture and blend state, in drawing order. */
+    struct BlitBatch
+    {
+        const uint8_t* data;
+        SourceFormat source;
+        uint16_t width;
+        uint16_t height;
+        uint8_t alpha;
+        Rect bounds;  ///< Of the blits of the batch, what later batches must not overlap
+        uint8_t first;
+        uint8_t last;
+    };
+
+    /**
+     * Gets how GPU2D samples a bitmap: RGB565 without alpha channel, RGB888, ARGB8888, and
+     * uncompressed L8 with an ARGB8888 or RGB888 palette, which is looked up by GPU2D.
+     *
+     * @return false if GPU2D cannot sample the bitmap.
+     */
+    static bool sourceFormat(const Bitmap& bitmap, SourceFormat& source);
+    /** Binds pixels, and the palette of L8 pixels, as the source texture. The stride is in pixels. */
+    static void bindSource(const SourceFormat& source, const uint8_t* data, uint16_t width, uint16_t height, uint16_t stride, uint32_t mode);
+    /**
+     * Sets the blend of the blits from the bound source, premultiplied or straight, faded
+     * by the alpha, and SRC when nothing blends. Counts the premultiplied blits.
+     */
+    void setBlitBlend(const SourceFormat& source, bool blends, uint8_t alpha);
+    /**
+     * Holds back a blit of a bitmap that blends, to be recorded with the other blits of
+     * the bitmap, see flushBlits().
+     *
+     * @return false if the blit is not held back and must be drawn now.
+     */
+    bool batchBlit(const Bitmap& bitmap, int16_t x, int16_t y, const Rect& rect, uint8_t alpha);
+    /** Records the blits held back, a texture at a time. */
+    void flushBlits();
+    /**
+     * Blits part of an L8 or premultiplied bitmap with GPU2D, which LCDGPU2D_AXI cannot
+     * sample or would blend as straight alpha, see drawPartialBitmap().
+     */
+    bool blitSource(const Bitmap& bitmap, int16_t x, int16_t y, const Rect& rect, uint8_t alpha);
+    /**
+     * Blits a texture mapped quad of a premultiplied texture, see drawTextureMapQuad().
+     *
+     * @return false if the vertices do not map the whole texture.
+     */
+    bool blitPremultipliedQuad(const Point3D* vertices, const TextureSurface& texture, const Rect& absoluteRect, const Rect& dirtyAreaAbsolute, RenderingVariant renderVariant, uint8_t alpha);
+
+    bool createFragments();
+    bool createKickLists();
+    bool renderGlyphMask(int16_t x, int16_t y, uint16_t offsetX, uint16_t offsetY, const GlyphNode* glyph, const uint8_t* glyphData, uint8_t dataFormatA4, uint8_t bitsPerPixel);
+    bool batchGlyph(const Rect& widgetArea, int16_t x, int16_t y, uint16_t offsetX, uint16_t offsetY, const Rect& invalidatedArea, const GlyphNode* glyph, const uint8_t* glyphData, uint8_t dataFormatA4, colortype color, uint8_t bitsPerPixel, uint8_t alpha, TextRotation rotation);
+    bool isDispatched() const;
+    bool isGPU2DPending() const;
+    void fillOn(Engine engine, const Rect& rect, const Rect& area, colortype color, uint8_t alpha);
+    void copyOn(Engine engine, const uint16_t* sourceData, const Rect& source, const Rect& blitRect, const Rect& area);
+    void cpuFill(const Rect& area, colortype color, uint8_t alpha);
+    void cpuCopy(const uint16_t* sourceData, const Rect& source, const Rect& area);
+    bool batchFill(const Rect& area, colortype color, uint8_t alpha);
+    void flushFills();
+    void countTraffic(const void* source, uint32_t sourceBytes, uint32_t pixels, bool blends);
+    void countTextureTraffic(const Point3D* vertices, int numVertices, const TextureSurface& texture, const Rect& absoluteRect, const Rect& dirtyAreaAbsolute, RenderingVariant renderVariant, uint8_t alpha);
+    /** Counts an area written by an operation for the overdraw heatmap, only the outermost. */
+    void countWrite(const Rect& area, Engine engine);
+    void waitForGPU2D();
+    void queue(BlitOp& op, const Rect& area);
+    void completeSnapshots();
+
+    static void onCommandListSubmit();
+
+    DMA_Interface& dma;
+    const uint8_t* gpu2dSourceStart;
+    const uint8_t* gpu2dSourceEnd;
+    Stats stats;
+    EngineCost costs[NUMBER_OF_COSTED_OPERATIONS][NUMBER_OF_ENGINES];
+    uint32_t syncCycles;
+    volatile bool dma2dPending;
+    uint8_t trafficDepth; ///< Nesting of counted operations, only the outermost is counted
+    GlyphQuad glyphQuads[HYBRID_GLYPH_BATCH_SIZE];
+    uint16_t glyphCount;
+    const uint8_t* glyphPage;
+    colortype glyphColor;
+    uint8_t glyphAlpha;
+#if HYBRID_FILL_BATCH_SIZE > 0
+    FillQuad fillQuads[HYBRID_FILL_BATCH_SIZE];
+#endif
+    uint16_t fillCount;
+    bool fillBlended; ///< The fills collected are blended, not copied
+#if HYBRID_BLIT_SORT_SIZE > 0
+    BlitQuad blitQuads[HYBRID_BLIT_SORT_SIZE];
+    BlitBatch blitBatches[HYBRID_BLIT_SORT_BATCHES];
+#endif
+    uint8_t blitCount;
+    uint8_t blitBatchCount;
+    RecordedGlyph* recording; ///< Glyphs are stored here instead of drawn, see recordString()
+    Rect recordingArea;
+    uint16_t recordingCapacity;
+    int32_t recordedCount;    ///< Negative once the string cannot be recorded
+    uint8_t* maskTarget;      ///< Glyphs are rendered here instead of drawn, see renderStringMask()
+    bool maskFailed;          ///< A glyph could not be rendered into the mask
+    Snapshot snapshots[HYBRID_SNAPSHOT_QUEUE_SIZE];
+    uint16_t snapshotCount;
+#if HYBRID_FRAGMENTS > 0
+    Fragment fragments[HYBRID_FRAGMENTS];
+#endif
+    bool fragmentsCreated;          ///< Creating the fragments was attempted
+    uint16_t fragmentCount;         ///< Fragments created
+    Fragment* fragmentRecording;    ///< The fragment bound as command list, 0 if none
+    nema_cmdlist_t* fragmentCaller; ///< The command list bound before recording
+    uint32_t fragmentUses;
+    uint32_t fragmentFrame;
+    nema_cmdlist_t kickLists[2];  ///< Recorded into after a kick, in turn
+    uint32_t kickOfList[2];       ///< The kick that submitted a list, 0 once it is waited for
+    nema_cmdlist_t* kickCaller;   ///< The command list of the frame, 0 outside kicks
+    uint32_t callerKick;          ///< The kick that submitted the command list of the frame
+    uint32_t kicks;               ///< Kicks so far
+    bool kickListsCreated;        ///< Creating the kick lists was attempted
+    uint8_t* stencilTileTarget; ///< First pixel under the stencil tile, 0 outside beginStencilTile()
+    Rect stencilTile;
+    uint32_t stencilTileFormat; ///< NemaGFX format of the framebuffer
+
+    static HybridLCDGPU2D* instance;
+};
+} // namespace touchgfx
+
+/* USER CODE END HybridLCDGPU2D.hpp */
+
+#endif // HYBRIDLCDGPU2D_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,146 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : IdleRefreshRate.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include <IdleRefreshRate.hpp>
+
+/* USER CODE BEGIN IdleRefreshRate.cpp */
+#include <string.h>
+#include <touchgfx/hal/HAL.hpp>
+
+#include "stm32h7rsxx_hal.h"
+
+namespace
+{
+const uint8_t MIN_DIVIDER = 2;
+const uint8_t MAX_DIVIDER = 8;
+}
+
+namespace touchgfx
+{
+IdleRefreshRate* IdleRefreshRate::instance = 0;
+
+IdleRefreshRate::IdleRefreshRate()
+    : enabled(TOUCHGFX_IDLE_REFRESH != 0), lowered(false), wakeRequested(false), divider(MIN_DIVIDER),
+      loweredDivider(1), idleTicks(0), nominalTotalHeight(0), lowerMs(0)
+{
+    setDivider(TOUCHGFX_IDLE_REFRESH_DIVIDER);
+    resetStats();
+}
+
+void IdleRefreshRate::init()
+{
+    // Also right when LTDC was adopted from the boot loader with its own timing
+    nominalTotalHeight = LTDC->TWCR & LTDC_TWCR_TOTALH;
+}
+
+void IdleRefreshRate::setEnabled(bool enable)
+{
+    if (!enable)
+    {
+        wakeUp();
+    }
+    enabled = enable;
+    idleTicks = 0;
+}
+
+void IdleRefreshRate::setDivider(uint8_t newDivider)
+{
+    divider = newDivider < MIN_DIVIDER ? MIN_DIVIDER : (newDivider > MAX_DIVIDER ? MAX_DIVIDER : newDivider);
+}
+
+bool IdleRefreshRate::tickStarted()
+{
+    if (!wakeRequested)
+    {
+        return false;
+    }
+    wakeRequested = false;
+    idleTicks = 0;
+    if (!lowered)
+    {
+        return false;
+    }
+    stats.wakeUps++;
+    setLowered(false);
+    return true;
+}
+
+bool IdleRefreshRate::tickEnded(bool drawn)
+{
+    if (drawn)
+    {
+        idleTicks = 0;
+        if (lowered)
+        {
+            setLowered(false);
+            return true;
+        }
+        return false;
+    }
+    if (!enabled || lowered || nominalTotalHeight == 0 || ++idleTicks < TOUCHGFX_IDLE_REFRESH_TICKS)
+    {
+        return false;
+    }
+    idleTicks = 0;
+    setLowered(true);
+    return true;
+}
+
+void IdleRefreshRate::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+void IdleRefreshRate::vSyncFromISR()
+{
+    if (instance == 0)
+    {
+        return;
+    }
+    HAL* const hal = HAL::getInstance();
+    for (uint8_t i = 1; i < instance->loweredDivider; i++)
+    {
+        hal->vSync();
+    }
+}
+
+void IdleRefreshRate::setLowered(bool lower)
+{
+    // TOTALH is the number of lines less one, the extra lines all go to the front porch
+    const uint32_t totalHeight = lower ? (nominalTotalHeight + 1U) * divider - 1U : nominalTotalHeight;
+    LTDC->TWCR = (LTDC->TWCR & ~LTDC_TWCR_TOTALH) | totalHeight;
+    LTDC->SRCR = (uint32_t)LTDC_SRCR_VBR;
+
+    const uint32_t now = HAL_GetTick();
+    if (lower)
+    {
+        lowerMs = now;
+        stats.lowered++;
+    }
+    else
+    {
+        stats.loweredMs += now - lowerMs;
+    }
+    loweredDivider = lower ? divider : 1;
+    lowered = lower;
+}
+} // namespace touchgfx
+
+/* USER CODE END IdleRefreshRate.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
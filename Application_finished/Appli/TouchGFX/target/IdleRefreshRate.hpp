@@ -0,0 +1,253 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : IdleRefreshRate.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef IDLEREFRESHRATE_HPP
+#define IDLEREFRESHRATE_HPP
+
+#include <stdint.h>
+
+/* USER CODE BEGIN IdleRefreshRate.hpp */
+
+/**
+ * Set to 1 to lower the refresh rate of the display from start-up while the screen is
+ * static. Can also be enabled at runtime with TouchGFXHAL::setIdleRefreshRate().
+ */
+#ifndef TOUCHGFX_IDLE_REFRESH
+#define TOUCHGFX_IDLE_REFRESH 0
+#endif
+
+/**
+ * The refresh rate while idle is the nominal rate divided by this, from 2 to 8.
+ */
+#ifndef TOUCHGFX_IDLE_REFRESH_DIVIDER
+#define TOUCHGFX_IDLE_REFRESH_DIVIDER 2
+#endif
+
+/**
+ * Number of ticks in a row that draw nothing before the refresh rate is lowered. Below
+ * TOUCHGFX_IDLE_SUSPEND_TICKS, so the display refreshes slower before the tick loop stops.
+ */
+#ifndef TOUCHGFX_IDLE_REFRESH_TICKS
+#define TOUCHGFX_IDLE_REFRESH_TICKS 10
+#endif
+
+namespace touchgfx
+{
+/**
+ * @class IdleRefreshRate
+ *
+ * @brief Lowers the refresh rate of the display while the screen is static.
+ *
+ *        LTDC reads the whole framebuffer from PSRAM over XSPI1 every refresh, and the
+ *        LTDC line interrupt wakes the TouchGFX task for every tick, even when nothing
+ *        changes. After TOUCHGFX_IDLE_REFRESH_TICKS ticks without drawing, the vertical
+ *        front porch is stretched so a refresh takes TOUCHGFX_IDLE_REFRESH_DIVIDER times
+ *        the lines, at the same pixel clock. The scanout bandwidth and the interrupts
+ *        drop by that factor, and the panel keeps its timing within a line. The total
+ *        height is reloaded in the vertical blanking, so no refresh is cut short.
+ *
+ *        Every tick then stands for TOUCHGFX_IDLE_REFRESH_DIVIDER refreshes at the
+ *        nominal rate. vSyncFromISR() counts the missing VSYNCs for the HAL, and the HAL
+ *        enables frame rate compensation while the rate is lowered, so timers and
+ *        animations counted in ticks keep their speed.
+ *
+ *        The nominal rate is restored by the first tick that draws, or at the start of
+ *        the tick after wakeUp(), which the touch controller interrupt calls. LTDC is only
+ *        reprogrammed by the TouchGFX task, in tickStarted() and tickEnded().
+ */
+class IdleRefreshRate
+{
+public:
+    /** Rate changes since the last reset. */
+    struct Stats
+    {
+        uint32_t lowered;   ///< Times the refresh rate was lowered
+        uint32_t loweredMs; ///< Time spent at the lower rate, up to the last restore
+        uint32_t wakeUps;   ///< Restores requested by wakeUp()
+    };
+
+    IdleRefreshRate();
+
+    /**
+     * @fn void IdleRefreshRate::init();
+     *
+     * @brief Reads the nominal total height from LTDC. Called by the HAL once LTDC is
+     *        running.
+     */
+    void init();
+
+    /**
+     * @fn void IdleRefreshRate::setEnabled(bool enable);
+     *
+     * @brief Enables or disables lowering the refresh rate. Disabling restores the nominal
+     *        rate at the start of the next tick.
+     *
+     * @param enable true to lower the refresh rate while the screen is static.
+     */
+    void setEnabled(bool enable);
+
+    /**
+     * @fn bool IdleRefreshRate::isEnabled() const;
+     *
+     * @brief Tells if the refresh rate is lowered while the screen is static.
+     *
+     * @return true if enabled.
+     */
+    bool isEnabled() const
+    {
+        return enabled;
+    }
+
+    /**
+     * @fn void IdleRefreshRate::setDivider(uint8_t divider);
+     *
+     * @brief Sets the factor the refresh rate is divided by while idle. Takes effect the
+     *        next time the rate is lowered.
+     *
+     * @param divider From 2 to 8, clamped.
+     */
+    void setDivider(uint8_t divider);
+
+    /**
+     * @fn uint8_t IdleRefreshRate::getDivider() const;
+     *
+     * @brief Gets the factor the refresh rate is divided by while idle.
+     *
+     * @return The divider.
+     */
+    uint8_t getDivider() const
+    {
+        return divider;
+    }
+
+    /**
+     * @fn bool IdleRefreshRate::isLowered() const;
+     *
+     * @brief Tells if the display refreshes at the lower rate.
+     *
+     * @return true if the front porch is stretched.
+     */
+    bool isLowered() const
+    {
+        return lowered;
+    }
+
+    /**
+     * @fn bool IdleRefreshRate::tickStarted();
+     *
+     * @brief Restores the nominal rate after wakeUp(). Called at the start of every tick.
+     *
+     * @return true if the rate changed.
+     */
+    bool tickStarted();
+
+    /**
+     * @fn bool IdleRefreshRate::tickEnded(bool drawn);
+     *
+     * @brief Counts idle ticks and lowers the rate, or restores it if the tick drew.
+     *        Called at the end of every tick.
+     *
+     * @param drawn true if the tick drew anything, or left a frame that is not shown yet.
+     *
+     * @return true if the rate changed.
+     */
+    bool tickEnded(bool drawn);
+
+    /**
+     * @fn void IdleRefreshRate::wakeUp();
+     *
+     * @brief Requests the nominal rate from the next tick. Can be called from tasks and
+     *        interrupts.
+     */
+    void wakeUp()
+    {
+        wakeRequested = true;
+    }
+
+    /**
+     * @fn const Stats& IdleRefreshRate::getStats() const;
+     *
+     * @brief Gets the rate change statistics.
+     *
+     * @return The statistics.
+     */
+    const Stats& getStats() const
+    {
+        return stats;
+    }
+
+    /**
+     * @fn void IdleRefreshRate::resetStats();
+     *
+     * @brief Resets the rate change statistics.
+     */
+    void resetStats();
+
+    /**
+     * @fn static void IdleRefreshRate::wakeUpFromISR();
+     *
+     * @brief Calls wakeUp() on the idle refresh rate of the HAL, if any.
+     */
+    static void wakeUpFromISR()
+    {
+        if (instance != 0)
+        {
+            instance->wakeUp();
+        }
+    }
+
+    /**
+     * @fn static void IdleRefreshRate::vSyncFromISR();
+     *
+     * @brief Counts the VSYNCs of the nominal rate that a refresh at the lower rate stands
+     *        for, less the one counted by the LTDC interrupt. Called by the LTDC interrupt
+     *        before the active area.
+     */
+    static void vSyncFromISR();
+
+    /**
+     * @fn void IdleRefreshRate::registerInstance();
+     *
+     * @brief Makes this the idle refresh rate that wakeUpFromISR() and vSyncFromISR() use.
+     */
+    void registerInstance()
+    {
+        instance = this;
+    }
+
+private:
+    void setLowered(bool lower);
+
+    bool enabled;
+    bool lowered;
+    volatile bool wakeRequested;
+    uint8_t divider;
+    uint8_t loweredDivider;   ///< Divider of the rate in use, read by the interrupt
+    uint16_t idleTicks;
+    uint32_t nominalTotalHeight; ///< TOTALH field of LTDC at the nominal rate
+    uint32_t lowerMs;
+    Stats stats;
+
+    static IdleRefreshRate* instance;
+};
+} // namespace touchgfx
+
+/* USER CODE END IdleRefreshRate.hpp */
+
+#endif // IDLEREFRESHRATE_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,147 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : IdleSuspend.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include <IdleSuspend.hpp>
+
+/* USER CODE BEGIN IdleSuspend.cpp */
+#include <string.h>
+
+#include "stm32h7rsxx_hal.h"
+
+extern "C" LTDC_HandleTypeDef hltdc;
+
+extern "C" void IdleSuspendSleep(void)
+{
+    touchgfx::IdleSuspend::sleepFromIdleHook();
+}
+
+namespace touchgfx
+{
+IdleSuspend* IdleSuspend::instance = 0;
+
+IdleSuspend::IdleSuspend()
+    : enabled(TOUCHGFX_IDLE_SUSPEND != 0), suspended(false), activity(false), measuring(false),
+      wakeMs(0), tickMeasured(false), suspendMs(0), idleTicks(0)
+{
+    resetStats();
+}
+
+void IdleSuspend::setEnabled(bool enable)
+{
+    if (!enable)
+    {
+        wakeUp();
+    }
+    enabled = enable;
+    idleTicks = 0;
+}
+
+void IdleSuspend::tickStarted()
+{
+    if (measuring && !tickMeasured)
+    {
+        tickMeasured = true;
+        const uint32_t latency = HAL_GetTick() - wakeMs;
+        if (latency > stats.tickLatencyMaxMs)
+        {
+            stats.tickLatencyMaxMs = latency;
+        }
+    }
+}
+
+void IdleSuspend::tickEnded(bool drawn)
+{
+    if (!enabled)
+    {
+        return;
+    }
+
+    // A wake-up between the last check and masking the interrupt would be lost
+    __disable_irq();
+    if (drawn || activity)
+    {
+        activity = false;
+        idleTicks = 0;
+    }
+    else if (++idleTicks >= TOUCHGFX_IDLE_SUSPEND_TICKS)
+    {
+        // LTDC keeps raising the line flag, the handler just stops running
+        __HAL_LTDC_DISABLE_IT(&hltdc, LTDC_IT_LI);
+        suspended = true;
+        suspendMs = HAL_GetTick();
+        measuring = false;
+        idleTicks = 0;
+        stats.suspends++;
+    }
+    __enable_irq();
+}
+
+void IdleSuspend::frameEnded()
+{
+    if (measuring)
+    {
+        measuring = false;
+        stats.frameLatencyLastMs = HAL_GetTick() - wakeMs;
+        if (stats.frameLatencyLastMs > stats.frameLatencyMaxMs)
+        {
+            stats.frameLatencyMaxMs = stats.frameLatencyLastMs;
+        }
+    }
+}
+
+void IdleSuspend::wakeUp()
+{
+    const uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    activity = true;
+    if (suspended)
+    {
+        const uint32_t now = HAL_GetTick();
+        stats.suspendedMs += now - suspendMs;
+        wakeMs = now;
+        measuring = true;
+        tickMeasured = false;
+        suspended = false;
+
+        // Continue with the line the handler programmed last, the flag raised while
+        // suspended is stale
+        __HAL_LTDC_CLEAR_FLAG(&hltdc, LTDC_FLAG_LI);
+        __HAL_LTDC_ENABLE_IT(&hltdc, LTDC_IT_LI);
+    }
+    __set_PRIMASK(primask);
+}
+
+void IdleSuspend::sleep()
+{
+    // An interrupt between the check and WFI delays the sleep by one kernel tick at most
+    if (suspended)
+    {
+        __DSB();
+        __WFI();
+    }
+}
+
+void IdleSuspend::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+} // namespace touchgfx
+
+/* USER CODE END IdleSuspend.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
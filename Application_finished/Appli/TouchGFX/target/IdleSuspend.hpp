@@ -0,0 +1,222 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : IdleSuspend.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef IDLESUSPEND_HPP
+#define IDLESUSPEND_HPP
+
+#include <stdint.h>
+
+/* USER CODE BEGIN IdleSuspend.hpp */
+
+/**
+ * Set to 1 to suspend the tick loop from start-up while the screen is static. Can also be
+ * enabled at runtime with TouchGFXHAL::setIdleSuspend().
+ */
+#ifndef TOUCHGFX_IDLE_SUSPEND
+#define TOUCHGFX_IDLE_SUSPEND 0
+#endif
+
+/**
+ * Number of ticks in a row that draw nothing before the tick loop is suspended. Screens
+ * that wait a number of ticks without drawing, for a timeout or before an animation,
+ * need a higher value or must keep the idle suspend disabled.
+ */
+#ifndef TOUCHGFX_IDLE_SUSPEND_TICKS
+#define TOUCHGFX_IDLE_SUSPEND_TICKS 30
+#endif
+
+namespace touchgfx
+{
+/**
+ * @class IdleSuspend
+ *
+ * @brief Stops the TouchGFX tick loop while the screen is static.
+ *
+ *        The tick loop is driven by the LTDC line interrupt, which wakes the CPU twice every
+ *        display refresh even when no tick draws anything. After TOUCHGFX_IDLE_SUSPEND_TICKS
+ *        ticks without drawing, and with no frame left on GPU2D or waiting to be shown, the
+ *        line interrupt is masked. LTDC keeps scanning out the shown framebuffer, the
+ *        TouchGFX task stays blocked waiting for VSYNC, and the idle task sleeps in WFI.
+ *
+ *        wakeUp() unmasks the line interrupt again. It is called by the touch controller
+ *        interrupt, and must be called by the model or any other task that has something
+ *        to show while the tick loop is suspended. The time from wakeUp() to the first tick
+ *        and to the end of the first frame drawn is measured in milliseconds.
+ */
+class IdleSuspend
+{
+public:
+    /** Suspensions and wake-up latencies since the last reset. */
+    struct Stats
+    {
+        uint32_t suspends;           ///< Times the tick loop was suspended
+        uint32_t suspendedMs;        ///< Time spent suspended, up to the last wake-up
+        uint32_t tickLatencyMaxMs;   ///< Longest time from a wake-up to the first tick
+        uint32_t frameLatencyLastMs; ///< Time from the last wake-up that drew to its first frame
+        uint32_t frameLatencyMaxMs;  ///< Longest time from a wake-up to its first frame
+    };
+
+    IdleSuspend();
+
+    /**
+     * @fn void IdleSuspend::setEnabled(bool enable);
+     *
+     * @brief Enables or disables suspending the tick loop. Disabling wakes it up.
+     *
+     * @param enable true to suspend the tick loop while the screen is static.
+     */
+    void setEnabled(bool enable);
+
+    /**
+     * @fn bool IdleSuspend::isEnabled() const;
+     *
+     * @brief Tells if the tick loop is suspended while the screen is static.
+     *
+     * @return true if enabled.
+     */
+    bool isEnabled() const
+    {
+        return enabled;
+    }
+
+    /**
+     * @fn bool IdleSuspend::isSuspended() const;
+     *
+     * @brief Tells if the tick loop is suspended.
+     *
+     * @return true if the LTDC line interrupt is masked.
+     */
+    bool isSuspended() const
+    {
+        return suspended;
+    }
+
+    /**
+     * @fn void IdleSuspend::tickStarted();
+     *
+     * @brief Measures the wake-up latency of the first tick. Called at the start of every tick.
+     */
+    void tickStarted();
+
+    /**
+     * @fn void IdleSuspend::tickEnded(bool drawn);
+     *
+     * @brief Counts idle ticks and suspends the tick loop. Called at the end of every tick.
+     *
+     * @param drawn true if the tick drew anything, or left a frame that is not shown yet.
+     */
+    void tickEnded(bool drawn);
+
+    /**
+     * @fn void IdleSuspend::frameEnded();
+     *
+     * @brief Measures the wake-up latency of the first frame. Called at the end of every frame.
+     */
+    void frameEnded();
+
+    /**
+     * @fn void IdleSuspend::wakeUp();
+     *
+     * @brief Resumes the tick loop from the next VSYNC, or keeps it from being suspended.
+     *
+     *        Can be called from tasks and interrupts.
+     */
+    void wakeUp();
+
+    /**
+     * @fn void IdleSuspend::sleep();
+     *
+     * @brief Sleeps until the next interrupt if the tick loop is suspended. Called from
+     *        the FreeRTOS idle hook.
+     */
+    void sleep();
+
+    /**
+     * @fn const Stats& IdleSuspend::getStats() const;
+     *
+     * @brief Gets the suspension statistics.
+     *
+     * @return The suspension statistics.
+     */
+    const Stats& getStats() const
+    {
+        return stats;
+    }
+
+    /**
+     * @fn void IdleSuspend::resetStats();
+     *
+     * @brief Resets the suspension statistics.
+     */
+    void resetStats();
+
+    /**
+     * @fn static void IdleSuspend::wakeUpFromISR();
+     *
+     * @brief Calls wakeUp() on the idle suspend of the HAL, if any.
+     */
+    static void wakeUpFromISR()
+    {
+        if (instance != 0)
+        {
+            instance->wakeUp();
+        }
+    }
+
+    /**
+     * @fn static void IdleSuspend::sleepFromIdleHook();
+     *
+     * @brief Calls sleep() on the idle suspend of the HAL, if any.
+     */
+    static void sleepFromIdleHook()
+    {
+        if (instance != 0)
+        {
+            instance->sleep();
+        }
+    }
+
+    /**
+     * @fn void IdleSuspend::registerInstance();
+     *
+     * @brief Makes this the idle suspend that wakeUpFromISR() and sleepFromIdleHook() use.
+     */
+    void registerInstance()
+    {
+        instance = this;
+    }
+
+private:
+    bool enabled;
+    volatile bool suspended;
+    volatile bool activity;   ///< wakeUp() was called since the last tick
+    volatile bool measuring;  ///< Woken up, the first frame has not ended yet
+    volatile uint32_t wakeMs; ///< Time of the last wake-up
+    bool tickMeasured;        ///< The first tick after the last wake-up has been measured
+    uint32_t suspendMs;       ///< Time the tick loop was suspended
+    uint16_t idleTicks;       ///< Ticks in a row that drew nothing
+    Stats stats;
+
+    static IdleSuspend* instance;
+};
+} // namespace touchgfx
+
+/* USER CODE END IdleSuspend.hpp */
+
+#endif // IDLESUSPEND_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,462 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : JPEGImageLoader.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include <JPEGImageLoader.hpp>
+
+/* USER CODE BEGIN JPEGImageLoader.cpp */
+#include <TouchGFXHAL.hpp>
+#include <STM32MJPEGDecoder.hpp>
+#include <DCacheMaintenance.hpp>
+#include <PixelConversion.hpp>
+#include <TraceOutput.hpp>
+#include <touchgfx/hal/Config.hpp>
+#include <cmsis_os2.h>
+#include <string.h>
+
+#include "stm32h7rsxx.h"
+
+namespace
+{
+const uint32_t WORK_FLAG = 0x1U;
+
+// Files read from the SD card, in PSRAM next to the decoded video frames
+LOCATION_PRAGMA_NOLOAD("Video_RGB_Buffer")
+uint32_t readBuffer[JPEG_LOADER_READ_BUFFER_SIZE / 4] LOCATION_ATTRIBUTE_NOLOAD("Video_RGB_Buffer");
+}
+
+namespace touchgfx
+{
+STM32MJPEGDecoder* JPEGImageLoader::decoder = 0;
+STM32MJPEGDecoder* JPEGImageLoader::thumbnailDecoder = 0;
+const void* JPEGImageLoader::thumbnailVideo = 0;
+JPEGImageLoader::Job JPEGImageLoader::jobs[JPEG_LOADER_JOBS];
+volatile uint32_t JPEGImageLoader::head = 0;
+volatile uint32_t JPEGImageLoader::tail = 0;
+volatile uint32_t JPEGImageLoader::cursor = 0;
+volatile bool JPEGImageLoader::stopping = false;
+void* volatile JPEGImageLoader::thread = 0;
+JPEGImageLoader::Stats JPEGImageLoader::stats;
+
+void JPEGImageLoader::init(STM32MJPEGDecoder& jpegDecoder, STM32MJPEGDecoder* jpegThumbnailDecoder)
+{
+    decoder = &jpegDecoder;
+    thumbnailDecoder = jpegThumbnailDecoder;
+    if (thumbnailDecoder != 0)
+    {
+        // Videos read through a reader are read into the buffer of the files, also in jpegTask
+        thumbnailDecoder->setAVIFileBuffer(reinterpret_cast<uint8_t*>(readBuffer), sizeof(readBuffer));
+    }
+}
+
+BitmapId JPEGImageLoader::load(const uint8_t* jpeg, uint32_t length, GenericCallback<BitmapId>* done, Bitmap::BitmapFormat format)
+{
+    uint16_t width;
+    uint16_t height;
+    if (decoder == 0 || !isDecodedTo(format) || !STM32MJPEGDecoder::getImageSize(jpeg, length, width, height))
+    {
+        stats.failed++;
+        return BITMAP_INVALID;
+    }
+    Job* const job = add(done);
+    if (job == 0)
+    {
+        return BITMAP_INVALID;
+    }
+    job->data = jpeg;
+    job->length = length;
+    job->width = width;
+    job->height = height;
+    job->format = format;
+    if (!createBitmap(*job))
+    {
+        stats.failed++;
+        return BITMAP_INVALID;
+    }
+
+    // The job is filled before jpegTask can see it
+    job->state = DECODE;
+    __DMB();
+    tail = tail + 1;
+    stats.loads++;
+    signal();
+    return job->bitmap;
+}
+
+bool JPEGImageLoader::load(VideoDataReader& reader, GenericCallback<BitmapId>* done, Bitmap::BitmapFormat format)
+{
+    if (!isDecodedTo(format))
+    {
+        return false;
+    }
+    Job* const job = add(done);
+    if (job == 0)
+    {
+        return false;
+    }
+    job->reader = &reader;
+    job->format = format;
+    job->state = READ;
+    __DMB();
+    tail = tail + 1;
+    stats.loads++;
+    signal();
+    return true;
+}
+
+BitmapId JPEGImageLoader::loadThumbnail(const uint8_t* video, uint32_t length, uint32_t frame, uint16_t width, uint16_t height, GenericCallback<BitmapId>* done)
+{
+    Job* const job = add(done);
+    if (job == 0)
+    {
+        return BITMAP_INVALID;
+    }
+    job->data = video;
+    job->length = length;
+    return queueThumbnail(*job, frame, width, height);
+}
+
+BitmapId JPEGImageLoader::loadThumbnail(VideoDataReader& video, uint32_t frame, uint16_t width, uint16_t height, GenericCallback<BitmapId>* done)
+{
+    Job* const job = add(done);
+    if (job == 0)
+    {
+        return BITMAP_INVALID;
+    }
+    job->reader = &video;
+    return queueThumbnail(*job, frame, width, height);
+}
+
+void JPEGImageLoader::cancel(GenericCallback<BitmapId>& done)
+{
+    for (uint32_t i = head; i != tail; i++)
+    {
+        Job& job = jobs[i % JPEG_LOADER_JOBS];
+        if (job.done == &done)
+        {
+            job.canceled = true;
+        }
+    }
+}
+
+void JPEGImageLoader::cancelAll()
+{
+    if (head == tail)
+    {
+        return;
+    }
+    stopping = true;
+    for (uint32_t i = head; i != tail; i++)
+    {
+        jobs[i % JPEG_LOADER_JOBS].canceled = true;
+    }
+    // The jobs not started are failed by jpegTask, the bitmap being decoded is finished
+    while (cursor != tail)
+    {
+        for (uint32_t i = cursor; i != tail; i++)
+        {
+            Job& job = jobs[i % JPEG_LOADER_JOBS];
+            if (job.state == SIZED)
+            {
+                job.state = FAILED;
+            }
+        }
+        signal();
+        osDelay(1);
+    }
+    poll();
+    stopping = false;
+}
+
+void JPEGImageLoader::poll()
+{
+    for (uint32_t i = head; i != tail; i++)
+    {
+        Job& job = jobs[i % JPEG_LOADER_JOBS];
+        if (job.state == SIZED)
+        {
+            job.state = (!job.canceled && createBitmap(job)) ? DECODE : FAILED;
+            signal();
+        }
+    }
+
+    while (head != tail)
+    {
+        Job& job = jobs[head % JPEG_LOADER_JOBS];
+        const uint8_t state = job.state;
+        if (state != DONE && state != FAILED)
+        {
+            // Callbacks are called in the order of the loads
+            break;
+        }
+        __DMB();
+        const BitmapId bitmap = job.bitmap;
+        GenericCallback<BitmapId>* const done = job.done;
+        const bool canceled = job.canceled;
+        job.state = FREE;
+        head = head + 1;
+
+        if (state == FAILED)
+        {
+            stats.failed++;
+        }
+        if ((canceled || state == FAILED) && bitmap != BITMAP_INVALID)
+        {
+            Bitmap::dynamicBitmapDelete(bitmap);
+        }
+        if (canceled)
+        {
+            stats.canceled++;
+        }
+        else if (done != 0 && done->isValid())
+        {
+            // May load the next image
+            done->execute(state == DONE ? bitmap : BitmapId(BITMAP_INVALID));
+        }
+    }
+}
+
+void JPEGImageLoader::run()
+{
+    thread = osThreadGetId();
+    for (;;)
+    {
+        if (cursor == tail)
+        {
+            osThreadFlagsWait(WORK_FLAG, osFlagsWaitAny, osWaitForever);
+            continue;
+        }
+        __DMB();
+        Job& job = jobs[cursor % JPEG_LOADER_JOBS];
+        switch (job.state)
+        {
+        case READ:
+            if (stopping)
+            {
+                job.state = FAILED;
+            }
+            else
+            {
+                read(job);
+            }
+            break;
+        case SIZED:
+            // The read buffer is held until the bitmap is created and the image decoded
+            osThreadFlagsWait(WORK_FLAG, osFlagsWaitAny, osWaitForever);
+            continue;
+        case DECODE:
+            if (stopping)
+            {
+                job.state = FAILED;
+            }
+            else
+            {
+                decode(job);
+            }
+            break;
+        default:
+            break;
+        }
+
+        if (job.state == DONE || job.state == FAILED)
+        {
+            cursor = cursor + 1;
+        }
+        // The callbacks are called from TouchGFXHAL::tick(), which may be suspended
+        static_cast<TouchGFXHAL*>(HAL::getInstance())->wakeUp();
+    }
+}
+
+void JPEGImageLoader::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+void JPEGImageLoader::report()
+{
+    tracePrintf("jpeg loader: loads=%lu decoded=%lu failed=%lu canceled=%lu decode last=%luus max=%luus",
+                (unsigned long)stats.loads,
+                (unsigned long)stats.decoded,
+                (unsigned long)stats.failed,
+                (unsigned long)stats.canceled,
+                (unsigned long)stats.decodeUsLast,
+                (unsigned long)stats.decodeUsMax);
+    resetStats();
+}
+
+JPEGImageLoader::Job* JPEGImageLoader::add(GenericCallback<BitmapId>* done)
+{
+    if (tail - head >= JPEG_LOADER_JOBS)
+    {
+        return 0;
+    }
+    Job& job = jobs[tail % JPEG_LOADER_JOBS];
+    memset(&job, 0, sizeof(job));
+    job.bitmap = BITMAP_INVALID;
+    job.format = Bitmap::RGB565;
+    job.done = done;
+    return &job;
+}
+
+BitmapId JPEGImageLoader::queueThumbnail(Job& job, uint32_t frame, uint16_t width, uint16_t height)
+{
+    job.thumbnail = true;
+    job.frame = frame;
+    job.width = width;
+    job.height = height;
+    if (thumbnailDecoder == 0 || !createBitmap(job))
+    {
+        stats.failed++;
+        return BITMAP_INVALID;
+    }
+
+    job.state = DECODE;
+    __DMB();
+    tail = tail + 1;
+    stats.loads++;
+    signal();
+    return job.bitmap;
+}
+
+bool JPEGImageLoader::createBitmap(Job& job)
+{
+    job.bitmap = Bitmap::dynamicBitmapCreate(job.width, job.height, static_cast<Bitmap::BitmapFormat>(job.format));
+    if (job.bitmap == BITMAP_INVALID)
+    {
+        return false;
+    }
+    // Taken here, the bitmap cache is only used by the TouchGFX task
+    job.pixels = Bitmap::dynamicBitmapGetAddress(job.bitmap);
+    return true;
+}
+
+void JPEGImageLoader::read(Job& job)
+{
+    uint8_t* const buffer = reinterpret_cast<uint8_t*>(readBuffer);
+    const uint32_t length = job.reader->getDataLength();
+    if (length == 0 || length > sizeof(readBuffer))
+    {
+        job.state = FAILED;
+        return;
+    }
+    job.reader->seek(0);
+    if (!job.reader->readData(buffer, length))
+    {
+        job.state = FAILED;
+        return;
+    }
+    // The codec reads the file with DMA
+    DCacheMaintenance::clean(buffer, length);
+
+    if (!STM32MJPEGDecoder::getImageSize(buffer, length, job.width, job.height))
+    {
+        job.state = FAILED;
+        return;
+    }
+    job.data = buffer;
+    job.length = length;
+    __DMB();
+    job.state = SIZED;
+}
+
+void JPEGImageLoader::decode(Job& job)
+{
+    const uint32_t start = DWT->CYCCNT;
+    bool decoded;
+    if (job.thumbnail)
+    {
+        // The thumbnails of the video are cached by the decoder until another video is set
+        const void* const video = job.reader != 0 ? static_cast<const void*>(job.reader) : static_cast<const void*>(job.data);
+        if (video != thumbnailVideo)
+        {
+            if (job.reader != 0)
+            {
+                thumbnailDecoder->setVideoData(*job.reader);
+            }
+            else
+            {
+                thumbnailDecoder->setVideoData(job.data, job.length);
+            }
+            thumbnailVideo = video;
+        }
+        decoded = thumbnailDecoder->hasVideo() && thumbnailDecoder->decodeThumbnail(job.frame, job.pixels, job.width, job.height);
+    }
+    else
+    {
+        decoded = decoder->decodeImage(job.data, job.length, job.pixels, job.width, job.height, job.width * 2U);
+        if (decoded && job.format != Bitmap::RGB565)
+        {
+            expand(job);
+        }
+    }
+    const uint32_t us = (uint32_t)(((uint64_t)(DWT->CYCCNT - start) * 1000000U) / SystemCoreClock);
+
+    if (decoded)
+    {
+        stats.decoded++;
+        stats.decodeUsLast = us;
+        if (us > stats.decodeUsMax)
+        {
+            stats.decodeUsMax = us;
+        }
+    }
+    // The pixels are written before the TouchGFX task sees the job done
+    __DMB();
+    job.state = decoded ? DONE : FAILED;
+}
+
+void JPEGImageLoader::expand(Job& job)
+{
+    // DMA2D wrote the RGB565 pixels at the start of the bitmap, the CPU expands them from
+    // the last, in place. DMA2D is not used, it is driven by the TouchGFX task.
+    const uint32_t pixels = (uint32_t)job.width * job.height;
+    DCacheMaintenance::invalidate(job.pixels, pixels * 2U);
+    const uint16_t* const rgb565 = reinterpret_cast<const uint16_t*>(job.pixels);
+    if (job.format == Bitmap::ARGB8888)
+    {
+        PixelConversion::rgb565ToARGB8888(rgb565, reinterpret_cast<uint32_t*>(job.pixels), pixels);
+        DCacheMaintenance::clean(job.pixels, pixels * 4U);
+    }
+    else
+    {
+        PixelConversion::rgb565ToRGB888(rgb565, job.pixels, pixels);
+        DCacheMaintenance::clean(job.pixels, pixels * 3U);
+    }
+}
+
+bool JPEGImageLoader::isDecodedTo(Bitmap::BitmapFormat format)
+{
+    return format == Bitmap::RGB565 || format == Bitmap::RGB888 || format == Bitmap::ARGB8888;
+}
+
+void JPEGImageLoader::signal()
+{
+    if (thread != 0)
+    {
+        osThreadFlagsSet(static_cast<osThreadId_t>(thread), WORK_FLAG);
+    }
+}
+} // namespace touchgfx
+
+extern "C" void JPEGImageLoader_Task(void* argument)
+{
+    touchgfx::JPEGImageLoader::run();
+}
+
+/* USER CODE END JPEGImageLoader.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
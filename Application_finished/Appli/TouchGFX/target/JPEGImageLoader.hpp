@@ -0,0 +1,306 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : JPEGImageLoader.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef JPEGIMAGELOADER_HPP
+#define JPEGIMAGELOADER_HPP
+
+#include <touchgfx/Bitmap.hpp>
+#include <touchgfx/Callback.hpp>
+#include <touchgfx/hal/VideoController.hpp>
+
+/* USER CODE BEGIN JPEGImageLoader.hpp */
+
+class STM32MJPEGDecoder;
+
+/**
+ * Number of loads which can be queued at the same time.
+ */
+#ifndef JPEG_LOADER_JOBS
+#define JPEG_LOADER_JOBS 4
+#endif
+
+/**
+ * Size of the buffer JPEG files read through a VideoDataReader are copied to, the
+ * largest file which can be loaded from the SD card.
+ */
+#ifndef JPEG_LOADER_READ_BUFFER_SIZE
+#define JPEG_LOADER_READ_BUFFER_SIZE (128 * 1024)
+#endif
+
+namespace touchgfx
+{
+/**
+ * @class JPEGImageLoader
+ *
+ * @brief Decodes JPEG still images into dynamic bitmaps with the hardware codec, in
+ *        jpegTask, out of the TouchGFX task.
+ *
+ *        The software decoder of libjpeg keeps the TouchGFX task busy for hundreds of
+ *        milliseconds per photo. load() only reads the size of the image from its frame
+ *        header and creates an RGB565 bitmap with Bitmap::dynamicBitmapCreate(), then
+ *        returns. jpegTask decodes the image with STM32MJPEGDecoder::decodeImage():
+ *        the JPEG codec decodes MCUs with DMA and DMA2D converts them from YCbCr straight
+ *        into the bitmap, as for the video frames. The codec is shared with the video and
+ *        decodes one frame or image at a time.
+ *
+ *        Images are decoded in the order they are loaded. When the decoding is done, the
+ *        callback given to load() is called from the TouchGFX task, in
+ *        TouchGFXHAL::tick() before the frame is drawn, with the bitmap, or with
+ *        BITMAP_INVALID when the image could not be read or decoded. The bitmap must not
+ *        be drawn or deleted before the callback. An image in memory mapped flash is
+ *        decoded where it is, a file read through a VideoDataReader, such as one on the
+ *        SD card, is first copied to a buffer of JPEG_LOADER_READ_BUFFER_SIZE bytes by
+ *        jpegTask.
+ *
+ *        Only baseline 4:2:0 images up to 800 pixels wide can be decoded, the width of
+ *        the MCU buffers and the subsampling DMA2D converts, see
+ *        STM32MJPEGDecoder::getImageSize(). The bitmaps are allocated in the dynamic
+ *        bitmap cache of TextureCache. TextureCache::clear() cancels all the loads
+ *        first, as it clears the cache.
+ *
+ *        loadThumbnail() queues a frame of a video, scaled down by the thumbnail decoder,
+ *        see STM32MJPEGDecoder::decodeThumbnail(). The decoder keeps the thumbnails of
+ *        the video last used, so a picker screen shown again gets them without decoding.
+ */
+class JPEGImageLoader
+{
+public:
+    /** Loads done since the last reset. */
+    struct Stats
+    {
+        uint32_t loads;        ///< Images queued
+        uint32_t decoded;      ///< Images and thumbnails decoded
+        uint32_t failed;       ///< Images not decoded: not supported, too large, out of cache
+        uint32_t canceled;     ///< Loads canceled before the callback
+        uint32_t decodeUsLast; ///< Duration of the last decoding, in jpegTask
+        uint32_t decodeUsMax;  ///< Longest decoding
+    };
+
+    /**
+     * @fn static void JPEGImageLoader::init(STM32MJPEGDecoder& decoder, STM32MJPEGDecoder* thumbnailDecoder);
+     *
+     * @brief Sets the decoders. Called by TouchGFXHAL::initialize().
+     *
+     * @param [in] decoder          The decoder of the video, which owns the codec.
+     * @param [in] thumbnailDecoder The decoder of the thumbnails, with a thumbnail buffer,
+     *                              or 0.
+     */
+    static void init(STM32MJPEGDecoder& decoder, STM32MJPEGDecoder* thumbnailDecoder);
+
+    /**
+     * @fn static BitmapId JPEGImageLoader::load(const uint8_t* jpeg, uint32_t length, GenericCallback<BitmapId>* done, Bitmap::BitmapFormat format = Bitmap::RGB565);
+     *
+     * @brief Queues the decoding of a JPEG image in memory mapped flash or RAM. Called from
+     *        the TouchGFX task.
+     *
+     *        An RGB888 or ARGB8888 bitmap, for a texture mapper or a canvas that wants
+     *        one, is decoded to RGB565 at its start by the codec and expanded in place by
+     *        jpegTask with PixelConversion, so no second buffer is needed.
+     *
+     * @param      jpeg   The JPEG file, which must stay readable until the callback.
+     * @param      length The length of the file in bytes.
+     * @param [in] done   Called with the bitmap when decoded, may be 0.
+     * @param      format (Optional) The format of the bitmap, RGB565, RGB888 or ARGB8888.
+     *
+     * @return The bitmap the image is decoded to, or BITMAP_INVALID if the image cannot
+     *         be decoded, the bitmap cannot be created or the queue is full. The callback
+     *         is not called then.
+     */
+    static BitmapId load(const uint8_t* jpeg, uint32_t length, GenericCallback<BitmapId>* done, Bitmap::BitmapFormat format = Bitmap::RGB565);
+
+    /**
+     * @fn static bool JPEGImageLoader::load(VideoDataReader& reader, GenericCallback<BitmapId>* done, Bitmap::BitmapFormat format = Bitmap::RGB565);
+     *
+     * @brief Queues the reading and decoding of a JPEG file. Called from the TouchGFX task.
+     *
+     *        The file is read from its start, in jpegTask. The bitmap is created when its
+     *        size is known, in the TouchGFX task.
+     *
+     * @param [in] reader The file, which must stay readable until the callback.
+     * @param [in] done   Called with the bitmap when decoded, or with BITMAP_INVALID.
+     * @param      format (Optional) The format of the bitmap, RGB565, RGB888 or ARGB8888.
+     *
+     * @return false if the queue is full. The callback is not called then.
+     */
+    static bool load(VideoDataReader& reader, GenericCallback<BitmapId>* done, Bitmap::BitmapFormat format = Bitmap::RGB565);
+
+    /**
+     * @fn static BitmapId JPEGImageLoader::loadThumbnail(const uint8_t* video, uint32_t length, uint32_t frame, uint16_t width, uint16_t height, GenericCallback<BitmapId>* done);
+     *
+     * @brief Queues the decoding of a thumbnail of a video in memory mapped flash. Called
+     *        from the TouchGFX task.
+     *
+     *        The frame is scaled to the size of the thumbnail, not keeping its aspect
+     *        ratio.
+     *
+     * @param      video  The AVI file, which must stay readable until the callback.
+     * @param      length The length of the file in bytes.
+     * @param      frame  The frame, from 1.
+     * @param      width  The width of the thumbnail.
+     * @param      height The height of the thumbnail.
+     * @param [in] done   Called with the bitmap when decoded, or with BITMAP_INVALID.
+     *
+     * @return The bitmap the thumbnail is decoded to, or BITMAP_INVALID if there is no
+     *         thumbnail decoder, the bitmap cannot be created or the queue is full. The
+     *         callback is not called then.
+     */
+    static BitmapId loadThumbnail(const uint8_t* video, uint32_t length, uint32_t frame, uint16_t width, uint16_t height, GenericCallback<BitmapId>* done);
+
+    /**
+     * @fn static BitmapId JPEGImageLoader::loadThumbnail(VideoDataReader& video, uint32_t frame, uint16_t width, uint16_t height, GenericCallback<BitmapId>* done);
+     *
+     * @brief Queues the decoding of a thumbnail of a video read through a reader, such as
+     *        one on the SD card. A frame must fit in JPEG_LOADER_READ_BUFFER_SIZE.
+     *
+     * @param [in] video  The AVI file, which must stay readable until the callback.
+     * @param      frame  The frame, from 1.
+     * @param      width  The width of the thumbnail.
+     * @param      height The height of the thumbnail.
+     * @param [in] done   Called with the bitmap when decoded, or with BITMAP_INVALID.
+     *
+     * @return The bitmap the thumbnail is decoded to, or BITMAP_INVALID.
+     */
+    static BitmapId loadThumbnail(VideoDataReader& video, uint32_t frame, uint16_t width, uint16_t height, GenericCallback<BitmapId>* done);
+
+    /**
+     * @fn static void JPEGImageLoader::cancel(GenericCallback<BitmapId>& done);
+     *
+     * @brief Cancels the loads with a callback, which is not called. The bitmaps of the
+     *        loads are deleted by the loader, when the codec is done with them.
+     *
+     * @param [in] done The callback given to load().
+     */
+    static void cancel(GenericCallback<BitmapId>& done);
+
+    /**
+     * @fn static void JPEGImageLoader::cancelAll();
+     *
+     * @brief Cancels all the loads and waits for the image being decoded, if any. The
+     *        bitmaps of the loads are deleted, no callback is called.
+     */
+    static void cancelAll();
+
+    /**
+     * @fn static bool JPEGImageLoader::isIdle();
+     *
+     * @brief Tells if no load is queued.
+     *
+     * @return true if no load is queued.
+     */
+    static bool isIdle()
+    {
+        return head == tail;
+    }
+
+    /**
+     * @fn static void JPEGImageLoader::poll();
+     *
+     * @brief Creates the bitmaps of the files read and calls the callbacks of the images
+     *        decoded. Called by TouchGFXHAL::tick().
+     */
+    static void poll();
+
+    /**
+     * @fn static void JPEGImageLoader::run();
+     *
+     * @brief The loop of jpegTask. Never returns.
+     */
+    static void run();
+
+    /**
+     * @fn static const Stats& JPEGImageLoader::getStats();
+     *
+     * @brief Gets the loads done since the last reset.
+     *
+     * @return The statistics.
+     */
+    static const Stats& getStats()
+    {
+        return stats;
+    }
+
+    /**
+     * @fn static void JPEGImageLoader::resetStats();
+     *
+     * @brief Resets the statistics.
+     */
+    static void resetStats();
+
+    /**
+     * @fn static void JPEGImageLoader::report();
+     *
+     * @brief Reports the loads done over SWO and resets the statistics.
+     */
+    static void report();
+
+private:
+    enum State
+    {
+        FREE,
+        READ,    ///< The file is to be read by jpegTask
+        SIZED,   ///< The file is read, its bitmap is to be created by the TouchGFX task
+        DECODE,  ///< The image is to be decoded by jpegTask
+        DONE,    ///< Decoded, the callback is to be called
+        FAILED   ///< Not decoded, the bitmap is to be deleted
+    };
+
+    struct Job
+    {
+        volatile uint8_t state;
+        bool canceled;
+        bool thumbnail;
+        uint16_t width;
+        uint16_t height;
+        uint8_t format; ///< Bitmap::BitmapFormat of the bitmap
+        BitmapId bitmap;
+        const uint8_t* data;
+        uint32_t length;
+        uint8_t* pixels;
+        VideoDataReader* reader;
+        uint32_t frame; ///< The frame of a thumbnail
+        GenericCallback<BitmapId>* done;
+    };
+
+    static Job* add(GenericCallback<BitmapId>* done);
+    static BitmapId queueThumbnail(Job& job, uint32_t frame, uint16_t width, uint16_t height);
+    static bool createBitmap(Job& job);
+    static void read(Job& job);
+    static void decode(Job& job);
+    static void expand(Job& job);
+    static bool isDecodedTo(Bitmap::BitmapFormat format);
+    static void signal();
+
+    static STM32MJPEGDecoder* decoder;
+    static STM32MJPEGDecoder* thumbnailDecoder;
+    static const void* thumbnailVideo; ///< The video set on the thumbnail decoder
+    static Job jobs[JPEG_LOADER_JOBS];
+    static volatile uint32_t head;   ///< Oldest job, advanced by the TouchGFX task
+    static volatile uint32_t tail;   ///< Next job added, advanced by the TouchGFX task
+    static volatile uint32_t cursor; ///< Job worked on, advanced by jpegTask
+    static volatile bool stopping;   ///< Jobs are failed instead of worked on
+    static void* volatile thread;
+    static Stats stats;
+};
+} // namespace touchgfx
+
+extern "C" void JPEGImageLoader_Task(void* argument);
+
+/* USER CODE END JPEGImageLoader.hpp */
+
+#endif // JPEGIMAGELOADER_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,112 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : MPUProfile.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include <MPUProfile.hpp>
+
+/* USER CODE BEGIN MPUProfile.cpp */
+#include <DCacheMaintenance.hpp>
+
+#include "stm32h7rsxx_hal.h"
+
+namespace
+{
+const uint32_t PSRAM_BASE = 0x90000000U;
+}
+
+namespace touchgfx
+{
+MPUProfile::Profile MPUProfile::current = MPUProfile::NON_CACHEABLE;
+
+void MPUProfile::apply(Profile profile)
+{
+    // Lines of PSRAM cached under the previous policy are written back and dropped
+    SCB_CleanInvalidateDCache();
+
+    MPU_Region_InitTypeDef region = { 0 };
+    region.Enable = MPU_REGION_ENABLE;
+    region.Number = MPU_REGION_NUMBER3;
+    region.BaseAddress = PSRAM_BASE;
+    region.Size = MPU_REGION_SIZE_32MB;
+    region.SubRegionDisable = 0x0;
+    region.AccessPermission = MPU_REGION_FULL_ACCESS;
+    region.DisableExec = MPU_INSTRUCTION_ACCESS_DISABLE;
+    region.IsShareable = MPU_ACCESS_NOT_SHAREABLE;
+    switch (profile)
+    {
+    case WRITE_THROUGH:
+        // Normal memory, write-through and no write-allocate
+        region.TypeExtField = MPU_TEX_LEVEL0;
+        region.IsCacheable = MPU_ACCESS_CACHEABLE;
+        region.IsBufferable = MPU_ACCESS_NOT_BUFFERABLE;
+        break;
+    case WRITE_BACK:
+        // Normal memory, write-back and write-allocate
+        region.TypeExtField = MPU_TEX_LEVEL1;
+        region.IsCacheable = MPU_ACCESS_CACHEABLE;
+        region.IsBufferable = MPU_ACCESS_BUFFERABLE;
+        break;
+    case NON_CACHEABLE:
+    default:
+        // As generated by MPU_Config()
+        region.TypeExtField = MPU_TEX_LEVEL1;
+        region.IsCacheable = MPU_ACCESS_NOT_CACHEABLE;
+        region.IsBufferable = MPU_ACCESS_NOT_BUFFERABLE;
+        profile = NON_CACHEABLE;
+        break;
+    }
+
+    // No task may select another region while this one is written
+    const uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    HAL_MPU_Disable();
+    HAL_MPU_ConfigRegion(&region);
+    HAL_MPU_Enable(MPU_PRIVILEGED_DEFAULT);
+    __set_PRIMASK(primask);
+    current = profile;
+
+    DCacheMaintenance::readRegions();
+}
+
+const char* MPUProfile::getName(Profile profile)
+{
+    switch (profile)
+    {
+    case WRITE_THROUGH:
+        return "write-through";
+    case WRITE_BACK:
+        return "write-back";
+    case NON_CACHEABLE:
+    default:
+        return "non-cacheable";
+    }
+}
+} // namespace touchgfx
+
+// Called by main() once the caches are enabled, before anything is placed in PSRAM
+extern "C" void MPUProfile_Apply(void)
+{
+#if TOUCHGFX_MPU_PROFILE != 0
+    touchgfx::MPUProfile::apply((touchgfx::MPUProfile::Profile)TOUCHGFX_MPU_PROFILE);
+#else
+    touchgfx::DCacheMaintenance::readRegions();
+#endif
+}
+
+/* USER CODE END MPUProfile.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
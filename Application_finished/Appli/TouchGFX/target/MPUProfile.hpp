@@ -0,0 +1,112 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : MPUProfile.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef MPUPROFILE_HPP
+#define MPUPROFILE_HPP
+
+#include <stdint.h>
+
+/* USER CODE BEGIN MPUProfile.hpp */
+
+/**
+ * Cache policy of the PSRAM on XSPI1 applied at startup, one of the values of
+ * touchgfx::MPUProfile::Profile: 0 keeps the non-cacheable PSRAM of the generated
+ * MPU_Config(), 1 makes it write-through and 2 write-back.
+ */
+#ifndef TOUCHGFX_MPU_PROFILE
+#define TOUCHGFX_MPU_PROFILE 0
+#endif
+
+namespace touchgfx
+{
+/**
+ * @class MPUProfile
+ *
+ * @brief Selects the MPU attributes of the memory the framebuffers and textures are in.
+ *
+ *        The generated MPU_Config() makes the 32 MB of PSRAM non-cacheable, so every CPU
+ *        access to the framebuffers, the dynamic bitmaps and the glyph atlas goes to XSPI1.
+ *        A profile reprograms the PSRAM region, number 3, to one of the policies below,
+ *        and leaves the other regions as generated:
+ *        - AXI SRAM, region 5, stays write-back, so the texture cache is read from the data
+ *          cache by the CPU and cleaned by address before GPU2D reads it.
+ *        - RAM_CMD, region 6, stays non-cacheable, so the GPU2D command lists and ring
+ *          buffer in Nemagfx_Memory_Pool_Buffer need no maintenance.
+ *
+ *        DCacheMaintenance reads the attributes back from the MPU, so the framebuffer
+ *        invalidation, the snapshot and blit maintenance of HybridLCDGPU2D and the glyph
+ *        atlas and arena follow the profile applied: nothing for non-cacheable PSRAM,
+ *        invalidation after DMA2D or GPU2D writes when write-through, and cleaning before
+ *        they read as well when write-back.
+ */
+class MPUProfile
+{
+public:
+    /** Cache policy of the PSRAM. */
+    enum Profile
+    {
+        NON_CACHEABLE = 0, ///< As generated, every access goes to PSRAM
+        WRITE_THROUGH = 1, ///< Reads are cached, writes go to PSRAM at once
+        WRITE_BACK = 2     ///< Reads and writes are cached, written back when evicted or cleaned
+    };
+
+    /**
+     * @fn static void MPUProfile::apply(Profile profile);
+     *
+     * @brief Reprograms the PSRAM region with the policy of a profile.
+     *
+     *        The data cache is cleaned and invalidated first, so no line cached under the
+     *        previous policy is lost or read stale. DMA2D and GPU2D must be idle, as between
+     *        two frames. DCacheMaintenance reads the regions again afterwards.
+     *
+     * @param profile The profile.
+     */
+    static void apply(Profile profile);
+
+    /**
+     * @fn static Profile MPUProfile::getProfile();
+     *
+     * @brief Gets the profile applied last.
+     *
+     * @return The profile, NON_CACHEABLE until one is applied.
+     */
+    static Profile getProfile()
+    {
+        return current;
+    }
+
+    /**
+     * @fn static const char* MPUProfile::getName(Profile profile);
+     *
+     * @brief Gets the name of a profile, for reports.
+     *
+     * @param profile The profile.
+     *
+     * @return The name.
+     */
+    static const char* getName(Profile profile);
+
+private:
+    static Profile current;
+};
+} // namespace touchgfx
+
+/* USER CODE END MPUProfile.hpp */
+
+#endif // MPUPROFILE_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
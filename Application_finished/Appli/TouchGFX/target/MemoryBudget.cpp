@@ -0,0 +1,247 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : MemoryBudget.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include <MemoryBudget.hpp>
+
+/* USER CODE BEGIN MemoryBudget.cpp */
+#include <TraceOutput.hpp>
+#include <string.h>
+
+// The end of what the linker placed in each memory
+#if defined(__ICCARM__)
+#pragma section = ".bss"
+#pragma section = "Nemagfx_Memory_Pool_Buffer"
+#pragma section = "TouchGFX_Framebuffer"
+#pragma section = "Video_RGB_Buffer"
+#pragma section = "Nemagfx_Stencil_Buffer"
+#pragma section = "TouchGFX_SpriteCache"
+#pragma section = "TextFlashSection"
+#pragma section = "FontFlashSection"
+#pragma section = "FontSearchFlashSection"
+#pragma section = "ExtFlashSection"
+#elif defined(__ARMCC_VERSION)
+extern "C" const uint8_t Image$$RAM_region$$ZI$$Limit[];
+extern "C" const uint8_t Image$$RAM_CMD$$ZI$$Limit[];
+extern "C" const uint8_t Image$$EXTRAM$$ZI$$Limit[];
+extern "C" const uint8_t Image$$FLASH_GFX_Section$$Limit[];
+#else
+// See STM32H7S7L8HXH_RAMxspi1_ROMxspi2_app.ld
+extern "C" const uint8_t _ebss[];
+extern "C" const uint8_t _euncached[];
+extern "C" const uint8_t _ebuffer[];
+extern "C" const uint8_t _egfxflash[];
+#endif
+
+namespace
+{
+// As in the linker scripts, which have no symbols for the size of their memories
+const touchgfx::MemoryBudget::Region MEMORIES[touchgfx::MemoryBudget::NUMBER_OF_MEMORIES] =
+{
+    { "RAM", 0x24000000U, 0x0006E000U, 0 },
+    { "RAM_CMD", 0x2406E000U, 0x00004000U, 0 },
+    { "EXTRAM", 0x90000000U, 0x01E00000U, 0 },
+    { "FLASH_GFX", 0x70200000U, 0x07E00000U, 0 }
+};
+
+#if defined(__ICCARM__)
+uintptr_t endOf(uintptr_t end, const void* sectionEnd)
+{
+    return ((uintptr_t)sectionEnd > end) ? (uintptr_t)sectionEnd : end;
+}
+#endif
+
+uintptr_t linkedEnd(touchgfx::MemoryBudget::Memory memory)
+{
+#if defined(__ICCARM__)
+    // The sections of a memory are not placed in a fixed order
+    switch (memory)
+    {
+    case touchgfx::MemoryBudget::MEMORY_RAM:
+        return (uintptr_t)__section_end(".bss");
+    case touchgfx::MemoryBudget::MEMORY_RAM_CMD:
+        return (uintptr_t)__section_end("Nemagfx_Memory_Pool_Buffer");
+    case touchgfx::MemoryBudget::MEMORY_EXTRAM:
+        return endOf(endOf(endOf((uintptr_t)__section_end("TouchGFX_Framebuffer"), __section_end("Video_RGB_Buffer")),
+                           __section_end("Nemagfx_Stencil_Buffer")),
+                     __section_end("TouchGFX_SpriteCache"));
+    case touchgfx::MemoryBudget::MEMORY_FLASH_GFX:
+        return endOf(endOf(endOf((uintptr_t)__section_end("TextFlashSection"), __section_end("FontFlashSection")),
+                           __section_end("FontSearchFlashSection")),
+                     __section_end("ExtFlashSection"));
+    default:
+        return 0;
+    }
+#elif defined(__ARMCC_VERSION)
+    switch (memory)
+    {
+    case touchgfx::MemoryBudget::MEMORY_RAM:
+        return (uintptr_t)Image$$RAM_region$$ZI$$Limit;
+    case touchgfx::MemoryBudget::MEMORY_RAM_CMD:
+        return (uintptr_t)Image$$RAM_CMD$$ZI$$Limit;
+    case touchgfx::MemoryBudget::MEMORY_EXTRAM:
+        return (uintptr_t)Image$$EXTRAM$$ZI$$Limit;
+    case touchgfx::MemoryBudget::MEMORY_FLASH_GFX:
+        return (uintptr_t)Image$$FLASH_GFX_Section$$Limit;
+    default:
+        return 0;
+    }
+#else
+    switch (memory)
+    {
+    case touchgfx::MemoryBudget::MEMORY_RAM:
+        return (uintptr_t)_ebss;
+    case touchgfx::MemoryBudget::MEMORY_RAM_CMD:
+        return (uintptr_t)_euncached;
+    case touchgfx::MemoryBudget::MEMORY_EXTRAM:
+        return (uintptr_t)_ebuffer;
+    case touchgfx::MemoryBudget::MEMORY_FLASH_GFX:
+        return (uintptr_t)_egfxflash;
+    default:
+        return 0;
+    }
+#endif
+}
+} // namespace
+
+namespace touchgfx
+{
+MemoryBudget::Consumer MemoryBudget::consumers[TOUCHGFX_MEMORY_BUDGET_CONSUMERS];
+uint16_t MemoryBudget::numberOfConsumers = 0;
+
+bool MemoryBudget::add(const char* name, const void* base, uint32_t size, UsageFunction usage, const void* context)
+{
+    uint16_t index = 0;
+    while (index < numberOfConsumers && strcmp(consumers[index].name, name) != 0)
+    {
+        index++;
+    }
+    if (index == TOUCHGFX_MEMORY_BUDGET_CONSUMERS)
+    {
+        return false;
+    }
+    if (index == numberOfConsumers)
+    {
+        numberOfConsumers++;
+    }
+    Consumer& consumer = consumers[index];
+    consumer.name = name;
+    consumer.base = base;
+    consumer.size = size;
+    consumer.memory = findMemory(base);
+    consumer.usage = usage;
+    consumer.context = context;
+    consumer.peak = 0;
+    return true;
+}
+
+void MemoryBudget::getRegion(Memory memory, Region& region)
+{
+    region = MEMORIES[memory];
+    const uintptr_t end = linkedEnd(memory);
+    region.linked = (end > region.start) ? (uint32_t)(end - region.start) : 0U;
+}
+
+MemoryBudget::Memory MemoryBudget::findMemory(const void* address)
+{
+    for (int memory = 0; memory < NUMBER_OF_MEMORIES; memory++)
+    {
+        if ((uintptr_t)address - MEMORIES[memory].start < MEMORIES[memory].size)
+        {
+            return (Memory)memory;
+        }
+    }
+    return NUMBER_OF_MEMORIES;
+}
+
+MemoryBudget::Usage MemoryBudget::getUsage(uint16_t index)
+{
+    Consumer& consumer = consumers[index];
+    Usage usage = { consumer.size, consumer.size };
+    if (consumer.usage != 0)
+    {
+        usage.used = 0;
+        usage.peak = 0;
+        consumer.usage(consumer.context, usage);
+        if (usage.peak < usage.used)
+        {
+            usage.peak = usage.used;
+        }
+    }
+    if (usage.peak > consumer.peak)
+    {
+        consumer.peak = usage.peak;
+    }
+    usage.peak = consumer.peak;
+    return usage;
+}
+
+void MemoryBudget::sample()
+{
+    for (uint16_t i = 0; i < numberOfConsumers; i++)
+    {
+        (void)getUsage(i);
+    }
+}
+
+void MemoryBudget::resetPeaks()
+{
+    for (uint16_t i = 0; i < numberOfConsumers; i++)
+    {
+        consumers[i].peak = 0;
+        (void)getUsage(i);
+    }
+}
+
+void MemoryBudget::report()
+{
+    for (int memory = 0; memory <= NUMBER_OF_MEMORIES; memory++)
+    {
+        const char* name = "other";
+        if (memory < NUMBER_OF_MEMORIES)
+        {
+            Region region;
+            getRegion((Memory)memory, region);
+            name = region.name;
+            tracePrintf("memory %s: size=%lu linked=%lu free=%lu",
+                        name,
+                        (unsigned long)region.size,
+                        (unsigned long)region.linked,
+                        (unsigned long)(region.size > region.linked ? region.size - region.linked : 0U));
+        }
+        for (uint16_t i = 0; i < numberOfConsumers; i++)
+        {
+            if (consumers[i].memory != memory)
+            {
+                continue;
+            }
+            const Usage usage = getUsage(i);
+            tracePrintf("memory %s %s: size=%lu used=%lu peak=%lu spare=%lu",
+                        name,
+                        consumers[i].name,
+                        (unsigned long)consumers[i].size,
+                        (unsigned long)usage.used,
+                        (unsigned long)usage.peak,
+                        (unsigned long)(consumers[i].size > usage.peak ? consumers[i].size - usage.peak : 0U));
+        }
+    }
+}
+} // namespace touchgfx
+
+/* USER CODE END MemoryBudget.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
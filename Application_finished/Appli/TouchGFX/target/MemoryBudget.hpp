@@ -0,0 +1,211 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : MemoryBudget.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef MEMORYBUDGET_HPP
+#define MEMORYBUDGET_HPP
+
+#include <stdint.h>
+
+/* USER CODE BEGIN MemoryBudget.hpp */
+
+/**
+ * Largest number of buffers MemoryBudget keeps the use of.
+ */
+#ifndef TOUCHGFX_MEMORY_BUDGET_CONSUMERS
+#define TOUCHGFX_MEMORY_BUDGET_CONSUMERS 16
+#endif
+
+/**
+ * Number of frames between two samples of the use of the buffers, see
+ * MemoryBudget::sample().
+ */
+#ifndef TOUCHGFX_MEMORY_BUDGET_SAMPLE_FRAMES
+#define TOUCHGFX_MEMORY_BUDGET_SAMPLE_FRAMES 16
+#endif
+
+namespace touchgfx
+{
+/**
+ * @class MemoryBudget
+ *
+ * @brief Size, use and headroom of the memories holding the graphics buffers.
+ *
+ *        The linker scripts place the framebuffers, the NemaGFX pools, the caches and the
+ *        graphics assets in the memories below by hand, and the GCC, Keil and IAR
+ *        versions must be kept in step. getRegion() tells, for each memory, its size and
+ *        the bytes the linker placed in it, read from the symbols of the toolchain, so the
+ *        memory left over can be handed to the caches that need it.
+ *
+ *        The buffers in them register with add(), with a function telling how much of
+ *        the buffer is in use. sample() records the peak use of each, and report()
+ *        writes the memories and the size, use, peak use and spare bytes of their buffers
+ *        over SWO. A buffer whose size is better spent elsewhere has a large spare.
+ */
+class MemoryBudget
+{
+public:
+    /** The memories of the linker scripts holding graphics data. */
+    enum Memory
+    {
+        MEMORY_RAM,       ///< AXI SRAM, with .data and .bss
+        MEMORY_RAM_CMD,   ///< Uncached AXI SRAM of the NemaGFX memory pool
+        MEMORY_EXTRAM,    ///< PSRAM on XSPI1, with the framebuffers and the large buffers
+        MEMORY_FLASH_GFX, ///< Flash on XSPI2, with the fonts, texts and bitmaps
+        NUMBER_OF_MEMORIES
+    };
+
+    /** A memory and what the linker placed in it. */
+    struct Region
+    {
+        const char* name; ///< Name of the memory in the linker scripts
+        uintptr_t start;  ///< First address
+        uint32_t size;    ///< Bytes of the memory
+        uint32_t linked;  ///< Bytes from the start to the end of what the linker placed
+    };
+
+    /** Use of a buffer. */
+    struct Usage
+    {
+        uint32_t used; ///< Bytes in use now
+        uint32_t peak; ///< Most bytes in use the buffer knows of, at least used
+    };
+
+    /** Tells the use of a buffer, called with the context given to add(). */
+    typedef void (*UsageFunction)(const void* context, Usage& usage);
+
+    /** A buffer registered with add(). */
+    struct Consumer
+    {
+        const char* name;
+        const void* base;
+        uint32_t size;
+        Memory memory;        ///< NUMBER_OF_MEMORIES if in none of the memories
+        UsageFunction usage;  ///< 0 if all of the buffer is always used
+        const void* context;
+        uint32_t peak;        ///< Most bytes in use when sampled
+    };
+
+    /**
+     * @fn static bool MemoryBudget::add(const char* name, const void* base, uint32_t size, UsageFunction usage = 0, const void* context = 0);
+     *
+     * @brief Registers a buffer, or changes the buffer registered with the name.
+     *
+     * @param name    Name of the buffer, kept.
+     * @param base    The first byte of the buffer, which tells the memory it is in.
+     * @param size    Bytes of the buffer.
+     * @param usage   Tells the bytes in use, 0 if all of the buffer is always used. Called
+     *                by sample(), so it must be quick.
+     * @param context Given to usage.
+     *
+     * @return false if TOUCHGFX_MEMORY_BUDGET_CONSUMERS buffers are registered already.
+     */
+    static bool add(const char* name, const void* base, uint32_t size, UsageFunction usage = 0, const void* context = 0);
+
+    /**
+     * @fn static void MemoryBudget::getRegion(Memory memory, Region& region);
+     *
+     * @brief Gets the size of a memory and the bytes the linker placed in it.
+     *
+     * @param memory      The memory.
+     * @param [out] region The size and the bytes placed.
+     */
+    static void getRegion(Memory memory, Region& region);
+
+    /**
+     * @fn static Memory MemoryBudget::findMemory(const void* address);
+     *
+     * @brief Finds the memory holding an address.
+     *
+     * @param address The address.
+     *
+     * @return The memory, or NUMBER_OF_MEMORIES if in none of them.
+     */
+    static Memory findMemory(const void* address);
+
+    /**
+     * @fn static uint16_t MemoryBudget::getNumberOfConsumers();
+     *
+     * @brief Gets the number of buffers registered.
+     *
+     * @return The number of buffers.
+     */
+    static uint16_t getNumberOfConsumers()
+    {
+        return numberOfConsumers;
+    }
+
+    /**
+     * @fn static const Consumer& MemoryBudget::getConsumer(uint16_t index);
+     *
+     * @brief Gets a buffer registered.
+     *
+     * @param index Index of the buffer, below getNumberOfConsumers().
+     *
+     * @return The buffer.
+     */
+    static const Consumer& getConsumer(uint16_t index)
+    {
+        return consumers[index];
+    }
+
+    /**
+     * @fn static Usage MemoryBudget::getUsage(uint16_t index);
+     *
+     * @brief Gets the use of a buffer now, and records its peak.
+     *
+     * @param index Index of the buffer.
+     *
+     * @return The bytes used, and the most bytes used since the last resetPeaks().
+     */
+    static Usage getUsage(uint16_t index);
+
+    /**
+     * @fn static void MemoryBudget::sample();
+     *
+     * @brief Records the peak use of every buffer. Called by the HAL every
+     *        TOUCHGFX_MEMORY_BUDGET_SAMPLE_FRAMES frames.
+     */
+    static void sample();
+
+    /**
+     * @fn static void MemoryBudget::resetPeaks();
+     *
+     * @brief Restarts the peak use of every buffer from its use now.
+     */
+    static void resetPeaks();
+
+    /**
+     * @fn static void MemoryBudget::report();
+     *
+     * @brief Reports the memories and their buffers over SWO.
+     *
+     *        For every memory, reports its size, the bytes placed by the linker and the
+     *        bytes left, then the size, use, peak use and spare bytes of each buffer in it.
+     */
+    static void report();
+
+private:
+    static Consumer consumers[TOUCHGFX_MEMORY_BUDGET_CONSUMERS];
+    static uint16_t numberOfConsumers;
+};
+} // namespace touchgfx
+
+/* USER CODE END MemoryBudget.hpp */
+
+#endif // MEMORYBUDGET_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
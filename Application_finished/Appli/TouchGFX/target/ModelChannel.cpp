@@ -0,0 +1,183 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : ModelChannel.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include <ModelChannel.hpp>
+
+/* USER CODE BEGIN ModelChannel.cpp */
+#include <TraceOutput.hpp>
+#include <cassert>
+#include <cmsis_os2.h>
+#include <rtos_pool.h>
+#include <string.h>
+
+#include "stm32h7rsxx.h"
+
+namespace
+{
+const uint32_t SPACE_FLAG = 0x1U;
+
+touchgfx::ModelChannel::Message channelRing[TOUCHGFX_MODEL_CHANNEL_SIZE];
+touchgfx::ModelChannel channel(channelRing, TOUCHGFX_MODEL_CHANNEL_SIZE);
+} // namespace
+
+namespace touchgfx
+{
+ModelChannel::ModelChannel(Message* slots, uint32_t n)
+    : ring(slots), mask(n - 1U), head(0), tail(0), coalescedTopics(0), space(0)
+{
+    assert((n & (n - 1U)) == 0U && "ModelChannel size must be a power of two");
+    memset(&stats, 0, sizeof(stats));
+}
+
+bool ModelChannel::init()
+{
+    if (space == 0)
+    {
+        space = RTOS_POOL_EventFlagsNew("modelChannel");
+    }
+    return space != 0;
+}
+
+void ModelChannel::setCoalesced(uint16_t topic, bool coalesced)
+{
+    if (topic < MAX_TOPICS)
+    {
+        const uint32_t bit = 1U << topic;
+        coalescedTopics = coalesced ? (coalescedTopics | bit) : (coalescedTopics & ~bit);
+    }
+}
+
+ModelChannel::Message* ModelChannel::claim(uint16_t topic, uint32_t timeout)
+{
+    if (tail - head > mask && timeout != 0U && space != 0)
+    {
+        // Cleared before checking again, so a drain in between is not missed
+        osEventFlagsClear(static_cast<osEventFlagsId_t>(space), SPACE_FLAG);
+        if (tail - head > mask)
+        {
+            osEventFlagsWait(static_cast<osEventFlagsId_t>(space), SPACE_FLAG, osFlagsWaitAny, timeout);
+        }
+    }
+    if (tail - head > mask)
+    {
+        stats.overruns++;
+        return 0;
+    }
+
+    Message& message = ring[tail & mask];
+    message.topic = topic;
+    message.size = 0;
+    message.timestamp = osKernelGetTickCount();
+    return &message;
+}
+
+void ModelChannel::publish()
+{
+    // The message is written before the consumer can see it
+    __DMB();
+    tail = tail + 1U;
+    stats.published++;
+}
+
+bool ModelChannel::send(uint16_t topic, const void* data, uint16_t size, uint32_t timeout)
+{
+    Message* const message = claim(topic, timeout);
+    if (message == 0)
+    {
+        return false;
+    }
+    message->size = size < PAYLOAD_SIZE ? size : (uint16_t)PAYLOAD_SIZE;
+    memcpy(message->data, data, message->size);
+    publish();
+    return true;
+}
+
+uint32_t ModelChannel::drain(Handler& handler)
+{
+    const uint32_t first = head;
+    const uint32_t end = tail;
+    __DMB();
+    if (first == end)
+    {
+        return 0;
+    }
+
+    // The last message of each coalesced topic in the batch
+    uint32_t last[MAX_TOPICS];
+    if (coalescedTopics != 0U)
+    {
+        for (uint32_t pos = first; pos != end; pos++)
+        {
+            const uint16_t topic = ring[pos & mask].topic;
+            if (topic < MAX_TOPICS)
+            {
+                last[topic] = pos;
+            }
+        }
+    }
+
+    for (uint32_t pos = first; pos != end; pos++)
+    {
+        const Message& message = ring[pos & mask];
+        if (message.topic < MAX_TOPICS && (coalescedTopics & (1U << message.topic)) != 0U && last[message.topic] != pos)
+        {
+            stats.coalesced++;
+            continue;
+        }
+        handler.handle(message);
+        stats.delivered++;
+    }
+
+    // The slots are read before the producer can reuse them
+    __DMB();
+    head = end;
+    if (space != 0)
+    {
+        osEventFlagsSet(static_cast<osEventFlagsId_t>(space), SPACE_FLAG);
+    }
+
+    const uint32_t count = end - first;
+    stats.batches++;
+    if (count > stats.batchMax)
+    {
+        stats.batchMax = count;
+    }
+    return count;
+}
+
+void ModelChannel::report()
+{
+    tracePrintf("model channel: published=%lu delivered=%lu coalesced=%lu overruns=%lu batches=%lu batch max=%lu",
+                (unsigned long)stats.published,
+                (unsigned long)stats.delivered,
+                (unsigned long)stats.coalesced,
+                (unsigned long)stats.overruns,
+                (unsigned long)stats.batches,
+                (unsigned long)stats.batchMax);
+    memset(&stats, 0, sizeof(stats));
+}
+
+ModelChannel* ModelChannel::getInstance()
+{
+    return &channel;
+}
+} // namespace touchgfx
+
+/* USER CODE END ModelChannel.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,218 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : ModelChannel.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef MODELCHANNEL_HPP
+#define MODELCHANNEL_HPP
+
+#include <stdint.h>
+
+/* USER CODE BEGIN ModelChannel.hpp */
+
+/** Number of messages of the channel returned by ModelChannel::getInstance(), a power of two. */
+#ifndef TOUCHGFX_MODEL_CHANNEL_SIZE
+#define TOUCHGFX_MODEL_CHANNEL_SIZE 256
+#endif
+
+namespace touchgfx
+{
+/**
+ * @class ModelChannel
+ *
+ * @brief A lock-free single-producer, single-consumer channel of messages from a backend
+ *        task to the model, drained once per frame.
+ *
+ *        A backend task sampling a sensor at a high rate would otherwise notify the UI
+ *        for every sample. Here it writes each message in place in a slot of the ring,
+ *        claim() then publish(), and the model drains all the messages published since
+ *        the last frame in one batch from Model::work(), reading them in place too. The
+ *        head and the tail are each written by one side only, so neither side takes a
+ *        lock. When the ring is full, claim() waits for the next drain on an event flags
+ *        object of CMSIS-OS2, or gives up after the timeout and counts an overrun.
+ *
+ *        Topics marked as coalesced carry a value that replaces the previous one, a
+ *        setting or a status: only the last message of such a topic in a batch is
+ *        handed to the handler. Messages of the other topics, samples, are all handed
+ *        over, in order.
+ *
+ *        Several backend tasks need one channel each, or must serialize their claim()
+ *        and publish().
+ */
+class ModelChannel
+{
+public:
+    static const uint32_t MAX_TOPICS = 32U;
+    static const uint32_t PAYLOAD_SIZE = 24U;
+
+    /** A message, 32 bytes. */
+    struct Message
+    {
+        uint16_t topic;                ///< Below MAX_TOPICS
+        uint16_t size;                 ///< Bytes used in data
+        uint32_t timestamp;            ///< osKernelGetTickCount() when claimed
+        uint8_t data[PAYLOAD_SIZE];
+    };
+
+    /** Receives the messages of a batch, in the consumer. */
+    class Handler
+    {
+    public:
+        virtual ~Handler()
+        {
+        }
+
+        /**
+         * @fn virtual void ModelChannel::Handler::handle(const Message& message) = 0;
+         *
+         * @brief Handles a message. The message is read in place, its slot is reused once
+         *        the batch has been drained.
+         *
+         * @param message The message.
+         */
+        virtual void handle(const Message& message) = 0;
+    };
+
+    /** Messages since the last reset. */
+    struct Stats
+    {
+        uint32_t published; ///< Messages published by the producer
+        uint32_t delivered; ///< Messages handed to the handler
+        uint32_t coalesced; ///< Messages replaced by a later one of the same topic
+        uint32_t overruns;  ///< Claims that timed out on a full ring
+        uint32_t batches;   ///< Drains which found messages
+        uint32_t batchMax;  ///< Most messages drained at once
+    };
+
+    /**
+     * @fn ModelChannel::ModelChannel(Message* slots, uint32_t n);
+     *
+     * @brief Constructor.
+     *
+     * @param slots Memory of the ring.
+     * @param n     Number of messages of the ring, a power of two.
+     */
+    ModelChannel(Message* slots, uint32_t n);
+
+    /**
+     * @fn bool ModelChannel::init();
+     *
+     * @brief Creates the event flags a full ring waits on. Called once the kernel is
+     *        initialized, before the first claim().
+     *
+     * @return false if the event flags could not be created.
+     */
+    bool init();
+
+    /**
+     * @fn void ModelChannel::setCoalesced(uint16_t topic, bool coalesced);
+     *
+     * @brief Marks a topic as carrying a value only the last of which matters.
+     *
+     * @param topic     The topic, below MAX_TOPICS.
+     * @param coalesced true to hand over only the last message of the topic in a batch.
+     */
+    void setCoalesced(uint16_t topic, bool coalesced);
+
+    /**
+     * @fn Message* ModelChannel::claim(uint16_t topic, uint32_t timeout);
+     *
+     * @brief Gets the next free slot to write a message in place. Called by the producer.
+     *
+     * @param topic   The topic of the message.
+     * @param timeout Ticks to wait for a drain if the ring is full, 0 not to wait.
+     *
+     * @return The slot, or 0 if the ring is still full.
+     */
+    Message* claim(uint16_t topic, uint32_t timeout);
+
+    /**
+     * @fn void ModelChannel::publish();
+     *
+     * @brief Hands the slot returned by the last claim() to the consumer.
+     */
+    void publish();
+
+    /**
+     * @fn bool ModelChannel::send(uint16_t topic, const void* data, uint16_t size, uint32_t timeout);
+     *
+     * @brief Claims a slot, copies a payload in it and publishes it.
+     *
+     * @param topic   The topic of the message.
+     * @param data    The payload.
+     * @param size    Size of the payload, at most PAYLOAD_SIZE.
+     * @param timeout Ticks to wait for a drain if the ring is full, 0 not to wait.
+     *
+     * @return false if the ring is still full.
+     */
+    bool send(uint16_t topic, const void* data, uint16_t size, uint32_t timeout);
+
+    /**
+     * @fn uint32_t ModelChannel::drain(Handler& handler);
+     *
+     * @brief Hands the messages published so far to a handler, without their coalesced
+     *        predecessors, and frees their slots. Called by the consumer once per frame.
+     *
+     * @param handler The handler.
+     *
+     * @return The number of messages drained, coalesced ones included.
+     */
+    uint32_t drain(Handler& handler);
+
+    /**
+     * @fn const Stats& ModelChannel::getStats() const;
+     *
+     * @brief Gets the statistics.
+     *
+     * @return The statistics.
+     */
+    const Stats& getStats() const
+    {
+        return stats;
+    }
+
+    /**
+     * @fn void ModelChannel::report();
+     *
+     * @brief Reports the statistics over SWO and resets them.
+     */
+    void report();
+
+    /**
+     * @fn static ModelChannel* ModelChannel::getInstance();
+     *
+     * @brief Gets the channel drained by the model, of TOUCHGFX_MODEL_CHANNEL_SIZE
+     *        messages, initialized by the model.
+     *
+     * @return The channel.
+     */
+    static ModelChannel* getInstance();
+
+private:
+    Message* ring;
+    uint32_t mask;
+    volatile uint32_t head; ///< Next message to drain, written by the consumer
+    volatile uint32_t tail; ///< Next slot to claim, written by the producer
+    uint32_t coalescedTopics;
+    void* space;            ///< Event flags, set when a drain frees slots
+    Stats stats;
+};
+} // namespace touchgfx
+
+/* USER CODE END ModelChannel.hpp */
+
+#endif // MODELCHANNEL_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
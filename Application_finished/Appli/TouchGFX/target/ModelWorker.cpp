@@ -0,0 +1,164 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : ModelWorker.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include <ModelWorker.hpp>
+
+/* USER CODE BEGIN ModelWorker.cpp */
+#include <TouchGFXHAL.hpp>
+#include <TraceOutput.hpp>
+#include <cmsis_os2.h>
+#include <string.h>
+
+#include "stm32h7rsxx.h"
+
+namespace
+{
+const uint32_t REQUEST_FLAG = 0x1U;
+}
+
+namespace touchgfx
+{
+ModelWorker::WorkFunction ModelWorker::workFunction = 0;
+void* ModelWorker::workContext = 0;
+uint8_t* ModelWorker::slotBase = 0;
+uint32_t ModelWorker::slotBytes = 0;
+void* volatile ModelWorker::thread = 0;
+volatile uint32_t ModelWorker::requestedTick = 0;
+volatile uint32_t ModelWorker::pending = 0;
+volatile uint32_t ModelWorker::shared = 1;
+uint32_t ModelWorker::front = 0;
+uint32_t ModelWorker::back = 2;
+ModelWorker::Stats ModelWorker::stats;
+
+void ModelWorker::init(WorkFunction work, void* context, void* slots, uint32_t slotSize)
+{
+    workContext = context;
+    slotBase = static_cast<uint8_t*>(slots);
+    slotBytes = slotSize;
+    __DMB();
+    workFunction = work;
+}
+
+void ModelWorker::request(uint32_t tick)
+{
+    stats.requests++;
+    requestedTick = tick;
+    __DMB();
+    if (pending)
+    {
+        // The worker reads the tick after clearing pending, it takes this one
+        stats.merged++;
+        return;
+    }
+    pending = 1U;
+    if (thread != 0)
+    {
+        osThreadFlagsSet(static_cast<osThreadId_t>(thread), REQUEST_FLAG);
+    }
+}
+
+const void* ModelWorker::acquire()
+{
+    if ((shared & FRESH) == 0U)
+    {
+        return 0;
+    }
+
+    // Only modelTask sets FRESH, so the slot taken is the one it published last
+    uint32_t previous;
+    do
+    {
+        previous = __LDREXW(&shared);
+    } while (__STREXW(front, &shared) != 0U);
+    front = previous & INDEX_MASK;
+    __DMB();
+
+    stats.acquired++;
+    return slot(front);
+}
+
+void ModelWorker::run()
+{
+    thread = osThreadGetId();
+    for (;;)
+    {
+        if (!pending || workFunction == 0)
+        {
+            osThreadFlagsWait(REQUEST_FLAG, osFlagsWaitAny, osWaitForever);
+            continue;
+        }
+        pending = 0U;
+        __DMB();
+        const uint32_t tick = requestedTick;
+
+        const uint32_t start = DWT->CYCCNT;
+        workFunction(workContext, slot(back), tick);
+        const uint32_t us = (uint32_t)(((uint64_t)(DWT->CYCCNT - start) * 1000000U) / SystemCoreClock);
+
+        // The slot is written before its index is handed over
+        __DMB();
+        uint32_t previous;
+        do
+        {
+            previous = __LDREXW(&shared);
+        } while (__STREXW(back | FRESH, &shared) != 0U);
+        back = previous & INDEX_MASK;
+
+        stats.runs++;
+        if ((previous & FRESH) != 0U)
+        {
+            stats.dropped++;
+        }
+        stats.workUsLast = us;
+        if (us > stats.workUsMax)
+        {
+            stats.workUsMax = us;
+        }
+
+        // Model::tick() does not run while the tick loop is suspended
+        static_cast<TouchGFXHAL*>(HAL::getInstance())->wakeUp();
+    }
+}
+
+void ModelWorker::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+void ModelWorker::report()
+{
+    tracePrintf("model worker: requests=%lu runs=%lu merged=%lu acquired=%lu dropped=%lu work last=%luus max=%luus",
+                (unsigned long)stats.requests,
+                (unsigned long)stats.runs,
+                (unsigned long)stats.merged,
+                (unsigned long)stats.acquired,
+                (unsigned long)stats.dropped,
+                (unsigned long)stats.workUsLast,
+                (unsigned long)stats.workUsMax);
+    resetStats();
+}
+} // namespace touchgfx
+
+extern "C" void ModelWorker_Task(void* argument)
+{
+    touchgfx::ModelWorker::run();
+}
+
+/* USER CODE END ModelWorker.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
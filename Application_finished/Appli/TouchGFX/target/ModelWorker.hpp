@@ -0,0 +1,174 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : ModelWorker.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef MODELWORKER_HPP
+#define MODELWORKER_HPP
+
+#include <stdint.h>
+
+/* USER CODE BEGIN ModelWorker.hpp */
+
+namespace touchgfx
+{
+/**
+ * @class ModelWorker
+ *
+ * @brief Runs the heavy part of Model::tick() in modelTask, out of the TouchGFX task.
+ *
+ *        The TouchGFX task samples the input, runs the model and the presenters, draws
+ *        and submits the frame to GPU2D and DMA2D in one loop, so any time spent
+ *        computing the model is taken from rendering. The draw traversal is in the
+ *        TouchGFX core library and cannot be moved to another task, the model work can.
+ *
+ *        Model::tick() calls request() for the next tick and acquire() for the newest
+ *        result. modelTask, at a lower priority than the TouchGFX task, runs the work
+ *        function of the model into a free slot while the TouchGFX task renders or
+ *        waits for VSYNC and GPU2D, then publishes the slot. The three slots are handed
+ *        over as a triple buffer, by exchanging their indices with LDREX/STREX: the
+ *        worker always has a slot to write, the TouchGFX task keeps the slot it acquired
+ *        until the next acquire(), and neither task ever waits for the other. Requests
+ *        made while the worker is busy are merged into one, for the latest tick.
+ *
+ *        The work function runs in modelTask and must not touch widgets or call
+ *        TouchGFX: it computes the model state, the presenters show it in the TouchGFX
+ *        task. The tick loop is woken when a state is published, in case it was
+ *        suspended while the worker ran.
+ */
+class ModelWorker
+{
+public:
+    /**
+     * Computes the model state for a tick into a slot, in modelTask.
+     *
+     * @param context The context given to init().
+     * @param slot    The slot to write, holding the state it was last written with.
+     * @param tick    The tick the state is computed for.
+     */
+    typedef void (*WorkFunction)(void* context, void* slot, uint32_t tick);
+
+    static const uint32_t SLOTS = 3U;
+
+    /** Work done since the last reset. */
+    struct Stats
+    {
+        uint32_t requests;   ///< Calls to request()
+        uint32_t runs;       ///< Runs of the work function
+        uint32_t merged;     ///< Requests merged into a later one while the worker was busy
+        uint32_t acquired;   ///< Published states acquired by the TouchGFX task
+        uint32_t dropped;    ///< Published states replaced before being acquired
+        uint32_t workUsLast; ///< Duration of the last run
+        uint32_t workUsMax;  ///< Longest run
+    };
+
+    /**
+     * @fn static void ModelWorker::init(WorkFunction work, void* context, void* slots, uint32_t slotSize);
+     *
+     * @brief Sets the work function and the slots. Called once by the model, before the
+     *        first request().
+     *
+     * @param work     The work function.
+     * @param context  Passed to the work function, the model.
+     * @param slots    SLOTS slots of slotSize bytes each, one after the other.
+     * @param slotSize Size of a slot in bytes.
+     */
+    static void init(WorkFunction work, void* context, void* slots, uint32_t slotSize);
+
+    /**
+     * @fn static void ModelWorker::request(uint32_t tick);
+     *
+     * @brief Asks modelTask to compute the state for a tick. Never blocks. Called from
+     *        the TouchGFX task.
+     *
+     * @param tick The tick to compute the state for.
+     */
+    static void request(uint32_t tick);
+
+    /**
+     * @fn static const void* ModelWorker::acquire();
+     *
+     * @brief Takes the newest state published by modelTask. Called from the TouchGFX task.
+     *
+     *        The slot acquired is not written by modelTask until the next acquire() which
+     *        returns a state.
+     *
+     * @return The newest state, or 0 if none was published since the last acquire().
+     */
+    static const void* acquire();
+
+    /**
+     * @fn static void ModelWorker::run();
+     *
+     * @brief The loop of modelTask. Never returns.
+     */
+    static void run();
+
+    /**
+     * @fn static const Stats& ModelWorker::getStats();
+     *
+     * @brief Gets the work done since the last reset.
+     *
+     * @return The statistics.
+     */
+    static const Stats& getStats()
+    {
+        return stats;
+    }
+
+    /**
+     * @fn static void ModelWorker::resetStats();
+     *
+     * @brief Resets the statistics.
+     */
+    static void resetStats();
+
+    /**
+     * @fn static void ModelWorker::report();
+     *
+     * @brief Reports the work done over SWO and resets the statistics.
+     */
+    static void report();
+
+private:
+    static const uint32_t INDEX_MASK = 0x3U;
+    static const uint32_t FRESH = 0x4U; ///< The shared slot was published and not acquired
+
+    static uint8_t* slot(uint32_t index)
+    {
+        return slotBase + index * slotBytes;
+    }
+
+    static WorkFunction workFunction;
+    static void* workContext;
+    static uint8_t* slotBase;
+    static uint32_t slotBytes;
+    static void* volatile thread;
+    static volatile uint32_t requestedTick;
+    static volatile uint32_t pending;
+    static volatile uint32_t shared; ///< Index of the shared slot and FRESH
+    static uint32_t front;           ///< Slot owned by the TouchGFX task
+    static uint32_t back;            ///< Slot owned by modelTask
+    static Stats stats;
+};
+} // namespace touchgfx
+
+extern "C" void ModelWorker_Task(void* argument);
+
+/* USER CODE END ModelWorker.hpp */
+
+#endif // MODELWORKER_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
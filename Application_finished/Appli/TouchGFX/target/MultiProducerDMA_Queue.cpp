@@ -0,0 +1,99 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : MultiProducerDMA_Queue.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include <MultiProducerDMA_Queue.hpp>
+
+/* USER CODE BEGIN MultiProducerDMA_Queue.cpp */
+#include <cassert>
+
+#include "stm32h7rsxx.h"
+
+namespace touchgfx
+{
+MultiProducerDMA_Queue::MultiProducerDMA_Queue(Slot* mem, uint32_t n)
+    : q(mem), mask(n - 1), head(0), tail(0)
+{
+    assert(n > 0 && (n & (n - 1)) == 0 && "Queue size must be a power of two");
+    for (uint32_t i = 0; i < n; i++)
+    {
+        q[i].sequence = i;
+    }
+}
+
+bool MultiProducerDMA_Queue::isEmpty()
+{
+    const uint32_t pos = head;
+    return q[pos & mask].sequence != pos + 1;
+}
+
+bool MultiProducerDMA_Queue::isFull()
+{
+    const uint32_t pos = tail;
+    return (int32_t)(q[pos & mask].sequence - pos) < 0;
+}
+
+void MultiProducerDMA_Queue::pushCopyOf(const BlitOp& op)
+{
+    uint32_t pos;
+    for (;;)
+    {
+        pos = __LDREXW(&tail);
+        const int32_t diff = (int32_t)(q[pos & mask].sequence - pos);
+        if (diff == 0)
+        {
+            // The slot is free for this position, try to claim it
+            if (__STREXW(pos + 1, &tail) == 0)
+            {
+                break;
+            }
+        }
+        else
+        {
+            // Full (diff < 0) or another producer claimed the position (diff > 0)
+            __CLREX();
+        }
+    }
+
+    Slot& slot = q[pos & mask];
+    slot.op = op;
+    __DMB();
+    slot.sequence = pos + 1;
+}
+
+void MultiProducerDMA_Queue::pop()
+{
+    const uint32_t pos = head;
+    __DMB();
+    q[pos & mask].sequence = pos + mask + 1;
+    head = pos + 1;
+}
+
+const BlitOp* MultiProducerDMA_Queue::first()
+{
+    if (isEmpty())
+    {
+        return 0;
+    }
+    __DMB();
+    return &q[head & mask].op;
+}
+} // namespace touchgfx
+
+/* USER CODE END MultiProducerDMA_Queue.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
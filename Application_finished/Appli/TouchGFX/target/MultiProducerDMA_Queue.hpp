@@ -0,0 +1,87 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : MultiProducerDMA_Queue.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef MULTIPRODUCERDMA_QUEUE_HPP
+#define MULTIPRODUCERDMA_QUEUE_HPP
+
+#include <touchgfx/hal/DMA.hpp>
+#include <stdint.h>
+
+/* USER CODE BEGIN MultiProducerDMA_Queue.hpp */
+
+namespace touchgfx
+{
+/**
+ * @class MultiProducerDMA_Queue
+ *
+ * @brief A lock-free FIFO queue of BlitOps with multiple producers and a single consumer.
+ *
+ *        Unlike LockFreeDMA_Queue, any number of tasks and interrupts may call
+ *        pushCopyOf() concurrently. Producers reserve a slot by advancing the tail with
+ *        LDREX/STREX and publish it by updating the slot's sequence number once the BlitOp
+ *        has been copied, so no producer ever blocks another. The consumer, the DMA
+ *        driver, only sees published slots in FIFO order.
+ *
+ *        pushCopyOf() waits while the queue is full, and must therefore not be called
+ *        from an interrupt with a priority equal to or higher than the consumer's.
+ *        A producer must restart the DMA after pushing, since the consumer may have gone
+ *        idle while the slot was reserved but not yet published.
+ */
+class MultiProducerDMA_Queue : public DMA_Queue
+{
+public:
+    /** A queue element: the BlitOp and the sequence number that publishes it. */
+    struct Slot
+    {
+        BlitOp op;                  ///< The queued operation
+        volatile uint32_t sequence; ///< Position the slot is ready for
+    };
+
+    /**
+     * @fn MultiProducerDMA_Queue::MultiProducerDMA_Queue(Slot* mem, uint32_t n);
+     *
+     * @brief Constructs a multi-producer queue.
+     *
+     * @param [out] mem Pointer to the memory used by the queue to store elements.
+     * @param       n   Number of elements the memory provided can contain. Must be a power
+     *                  of two.
+     */
+    MultiProducerDMA_Queue(Slot* mem, uint32_t n);
+
+    virtual bool isEmpty();
+
+    virtual bool isFull();
+
+    virtual void pushCopyOf(const BlitOp& op);
+
+protected:
+    virtual void pop();
+
+    virtual const BlitOp* first();
+
+    Slot* q;                ///< Pointer to the queue memory.
+    uint32_t mask;          ///< The number of elements the queue can contain, minus one.
+    volatile uint32_t head; ///< Position of the head element, only written by the consumer.
+    volatile uint32_t tail; ///< Position of the next free element, shared by all producers.
+};
+} // namespace touchgfx
+
+/* USER CODE END MultiProducerDMA_Queue.hpp */
+
+#endif // MULTIPRODUCERDMA_QUEUE_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
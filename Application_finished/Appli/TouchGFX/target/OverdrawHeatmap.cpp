@@ -0,0 +1,277 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : OverdrawHeatmap.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include <OverdrawHeatmap.hpp>
+
+/* USER CODE BEGIN OverdrawHeatmap.cpp */
+#include <TraceOutput.hpp>
+#include <touchgfx/hal/HAL.hpp>
+#include <string.h>
+
+#include "stm32h7rsxx_hal.h"
+
+namespace
+{
+const uint16_t TILE = TOUCHGFX_OVERDRAW_TILE_SIZE;
+const uint16_t SCALE = TOUCHGFX_OVERDRAW_OVERLAY_SCALE;
+
+// Overdraw in sixteenths up to which each color is used, and the color above the last
+const uint8_t LEVELS[] = { 16, 32, 48, 64 };
+const uint32_t COLORS[] =
+{
+    0x60000000U, // At most once, dimmed
+    0xC00040FFU, // Blue
+    0xC000C040U, // Green
+    0xD0FF8000U, // Orange
+    0xE0FF0000U  // Red
+};
+
+// Kept in AXI SRAM with the rest of .bss, copied to the overlay buffers when shown
+uint32_t heatmapPixels[TOUCHGFX_OVERDRAW_MAX_COLUMNS * SCALE * TOUCHGFX_OVERDRAW_MAX_ROWS * SCALE];
+}
+
+namespace touchgfx
+{
+OverdrawHeatmap* OverdrawHeatmap::instance = 0;
+
+OverdrawHeatmap::OverdrawHeatmap(OverlayLayer& overlayLayer)
+    : overlay(overlayLayer), mode(static_cast<Mode>(TOUCHGFX_OVERDRAW_HEATMAP)), counting(false), drew(false), streaming(false),
+      columns(0), rows(0), periodStartMs(0)
+{
+    memset(written, 0, sizeof(written));
+    memset(flushes, 0, sizeof(flushes));
+    memset(peak, 0, sizeof(peak));
+    resetStats();
+    instance = this;
+}
+
+void OverdrawHeatmap::setMode(Mode newMode)
+{
+    if (mode == MODE_OVERLAY && newMode != MODE_OVERLAY)
+    {
+        overlay.hide();
+    }
+    mode = newMode;
+    memset(peak, 0, sizeof(peak));
+}
+
+void OverdrawHeatmap::flushed(const Rect& rect)
+{
+    if (!counting)
+    {
+        return;
+    }
+    const Rect area = rect & Rect(0, 0, columns * TILE, rows * TILE);
+    if (area.isEmpty())
+    {
+        return;
+    }
+    stats.flushed += (uint32_t)area.width * area.height;
+    for (int16_t row = area.y / TILE; row <= (area.bottom() - 1) / TILE; row++)
+    {
+        for (int16_t column = area.x / TILE; column <= (area.right() - 1) / TILE; column++)
+        {
+            uint8_t& count = flushes[row * columns + column];
+            if (count < 0xFF)
+            {
+                count++;
+            }
+        }
+    }
+    drew = true;
+}
+
+void OverdrawHeatmap::frameStarted()
+{
+    counting = (mode != MODE_OFF);
+    if (!counting)
+    {
+        return;
+    }
+    // The tiles at the right and bottom edges are partial if the display is not a multiple
+    const uint16_t displayColumns = (HAL::DISPLAY_WIDTH + TILE - 1) / TILE;
+    const uint16_t displayRows = (HAL::DISPLAY_HEIGHT + TILE - 1) / TILE;
+    columns = (displayColumns < TOUCHGFX_OVERDRAW_MAX_COLUMNS) ? displayColumns : TOUCHGFX_OVERDRAW_MAX_COLUMNS;
+    rows = (displayRows < TOUCHGFX_OVERDRAW_MAX_ROWS) ? displayRows : TOUCHGFX_OVERDRAW_MAX_ROWS;
+}
+
+void OverdrawHeatmap::frameEnded(uint32_t frame)
+{
+    if (!counting)
+    {
+        return;
+    }
+    counting = false;
+    if (!drew)
+    {
+        return;
+    }
+    drew = false;
+    stats.frames++;
+
+    const bool streamed = (mode == MODE_STREAM) && isTracePortEnabled(TOUCHGFX_OVERDRAW_PORT);
+    if (!streamed)
+    {
+        streaming = false;
+    }
+    else
+    {
+        if (!streaming)
+        {
+            traceWord(TOUCHGFX_OVERDRAW_PORT, STREAM_BEGIN);
+            traceWord(TOUCHGFX_OVERDRAW_PORT, ((uint32_t)columns << 16) | rows);
+            traceWord(TOUCHGFX_OVERDRAW_PORT, TILE);
+            streaming = true;
+        }
+        traceWord(TOUCHGFX_OVERDRAW_PORT, FRAME_BEGIN);
+        traceWord(TOUCHGFX_OVERDRAW_PORT, frame);
+    }
+
+    const uint16_t tiles = columns * rows;
+    for (uint16_t tile = 0; tile < tiles; tile++)
+    {
+        if (written[tile] == 0 && flushes[tile] == 0)
+        {
+            continue;
+        }
+        const uint8_t level = overdraw(tile);
+        if (level > peak[tile])
+        {
+            peak[tile] = level;
+        }
+        if (level > stats.worst)
+        {
+            stats.worst = level;
+            stats.worstX = (tile % columns) * TILE;
+            stats.worstY = (tile / columns) * TILE;
+        }
+        if (streamed)
+        {
+            traceWord(TOUCHGFX_OVERDRAW_PORT, ((uint32_t)tile << 16) | ((uint32_t)flushes[tile] << 8) | level);
+        }
+        written[tile] = 0;
+        flushes[tile] = 0;
+    }
+
+    if (streamed)
+    {
+        traceWord(TOUCHGFX_OVERDRAW_PORT, FRAME_END);
+    }
+}
+
+void OverdrawHeatmap::tick()
+{
+    if (mode != MODE_OVERLAY)
+    {
+        return;
+    }
+    const uint32_t now = HAL_GetTick();
+    if (now - periodStartMs < TOUCHGFX_OVERDRAW_PERIOD_MS)
+    {
+        return;
+    }
+    show();
+    memset(peak, 0, sizeof(peak));
+    periodStartMs = now;
+}
+
+void OverdrawHeatmap::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+void OverdrawHeatmap::count(const Rect& rect, Backend backend)
+{
+    const Rect area = rect & Rect(0, 0, columns * TILE, rows * TILE);
+    if (area.isEmpty())
+    {
+        return;
+    }
+    stats.written[backend] += (uint32_t)area.width * area.height;
+    for (int16_t row = area.y / TILE; row <= (area.bottom() - 1) / TILE; row++)
+    {
+        const int16_t top = (row * TILE > area.y) ? row * TILE : area.y;
+        const int16_t bottom = ((row + 1) * TILE < area.bottom()) ? (row + 1) * TILE : area.bottom();
+        for (int16_t column = area.x / TILE; column <= (area.right() - 1) / TILE; column++)
+        {
+            const int16_t left = (column * TILE > area.x) ? column * TILE : area.x;
+            const int16_t right = ((column + 1) * TILE < area.right()) ? (column + 1) * TILE : area.right();
+            uint16_t& pixels = written[row * columns + column];
+            const uint32_t sum = (uint32_t)pixels + (uint32_t)(right - left) * (bottom - top);
+            pixels = (sum < 0xFFFFU) ? (uint16_t)sum : 0xFFFFU;
+        }
+    }
+    drew = true;
+}
+
+uint8_t OverdrawHeatmap::overdraw(uint16_t tile) const
+{
+    // The pixels of the tile on the display, fewer at the right and bottom edges
+    const int16_t x = (tile % columns) * TILE;
+    const int16_t y = (tile / columns) * TILE;
+    const uint32_t width = (x + TILE <= HAL::DISPLAY_WIDTH) ? TILE : HAL::DISPLAY_WIDTH - x;
+    const uint32_t height = (y + TILE <= HAL::DISPLAY_HEIGHT) ? TILE : HAL::DISPLAY_HEIGHT - y;
+    const uint32_t level = ((uint32_t)written[tile] * 16U + width * height / 2) / (width * height);
+    return (level < 0xFFU) ? (uint8_t)level : 0xFFU;
+}
+
+void OverdrawHeatmap::show()
+{
+    const uint16_t width = columns * SCALE;
+    const uint16_t height = rows * SCALE;
+    uint8_t worst = 0;
+    uint16_t worstTile = 0;
+    for (uint16_t row = 0; row < rows; row++)
+    {
+        for (uint16_t column = 0; column < columns; column++)
+        {
+            const uint16_t tile = row * columns + column;
+            uint16_t color = 0;
+            while (color < sizeof(LEVELS) && peak[tile] > LEVELS[color])
+            {
+                color++;
+            }
+            if (peak[tile] > worst)
+            {
+                worst = peak[tile];
+                worstTile = tile;
+            }
+            for (uint16_t y = 0; y < SCALE; y++)
+            {
+                uint32_t* const pixels = &heatmapPixels[(uint32_t)(row * SCALE + y) * width + column * SCALE];
+                for (uint16_t x = 0; x < SCALE; x++)
+                {
+                    pixels[x] = COLORS[color];
+                }
+            }
+        }
+    }
+
+    // Top left corner of the display, the HUD is at the top right
+    if (width > 0 && !overlay.showPixels(heatmapPixels, Bitmap::ARGB8888, width, height, 0, 0))
+    {
+        tracePrintf("overdraw: worst %u.%02u at %u,%u",
+                    (unsigned)(worst / 16), (unsigned)((worst % 16) * 100 / 16),
+                    (unsigned)((worstTile % columns) * TILE), (unsigned)((worstTile / columns) * TILE));
+    }
+}
+} // namespace touchgfx
+
+/* USER CODE END OverdrawHeatmap.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,281 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : OverdrawHeatmap.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef OVERDRAWHEATMAP_HPP
+#define OVERDRAWHEATMAP_HPP
+
+#include <touchgfx/hal/Types.hpp>
+#include <OverlayLayer.hpp>
+#include <stdint.h>
+
+/* USER CODE BEGIN OverdrawHeatmap.hpp */
+
+/**
+ * Mode of the overdraw heatmap from start-up, an OverdrawHeatmap::Mode: 0 off, 1 shown
+ * on the overlay layer, 2 streamed over SWO. See OverdrawHeatmap::setMode().
+ */
+#ifndef TOUCHGFX_OVERDRAW_HEATMAP
+#define TOUCHGFX_OVERDRAW_HEATMAP 0
+#endif
+
+/**
+ * Width and height in pixels of the tiles the writes are counted in.
+ */
+#ifndef TOUCHGFX_OVERDRAW_TILE_SIZE
+#define TOUCHGFX_OVERDRAW_TILE_SIZE 16
+#endif
+
+/**
+ * Most tiles across and down the display, those of an 800x480 display by default. Writes
+ * beyond them are not counted.
+ */
+#ifndef TOUCHGFX_OVERDRAW_MAX_COLUMNS
+#define TOUCHGFX_OVERDRAW_MAX_COLUMNS 50
+#endif
+
+#ifndef TOUCHGFX_OVERDRAW_MAX_ROWS
+#define TOUCHGFX_OVERDRAW_MAX_ROWS 30
+#endif
+
+/**
+ * Pixels per tile across and down in the heatmap shown on the overlay layer.
+ */
+#ifndef TOUCHGFX_OVERDRAW_OVERLAY_SCALE
+#define TOUCHGFX_OVERDRAW_OVERLAY_SCALE 2
+#endif
+
+#if (TOUCHGFX_OVERDRAW_MAX_COLUMNS * TOUCHGFX_OVERDRAW_OVERLAY_SCALE) * (TOUCHGFX_OVERDRAW_MAX_ROWS * TOUCHGFX_OVERDRAW_OVERLAY_SCALE) > TOUCHGFX_OVERLAY_MAX_PIXELS
+#error "The overdraw heatmap does not fit in TOUCHGFX_OVERLAY_MAX_PIXELS, lower TOUCHGFX_OVERDRAW_OVERLAY_SCALE"
+#endif
+
+/**
+ * Milliseconds between two updates of the heatmap shown on the overlay layer.
+ */
+#ifndef TOUCHGFX_OVERDRAW_PERIOD_MS
+#define TOUCHGFX_OVERDRAW_PERIOD_MS 500
+#endif
+
+/**
+ * ITM stimulus port of the streamed heatmap. Port 0 carries the text of tracePrintf().
+ */
+#ifndef TOUCHGFX_OVERDRAW_PORT
+#define TOUCHGFX_OVERDRAW_PORT 3
+#endif
+
+namespace touchgfx
+{
+/**
+ * @class OverdrawHeatmap
+ *
+ * @brief Counts how many times every tile of the display is written per frame, by all the
+ *        drawing backends, to find where the same pixels are drawn over and over.
+ *
+ *        HybridLCDGPU2D, for what it records for GPU2D, queues on DMA2D or writes with the
+ *        CPU, and AffineLCD16bpp, when it draws the frame in software, call wrote() with
+ *        the area of every fill, blit, glyph, texture mapped quad and vector image they
+ *        draw into the framebuffer. The pixels written are added up per tile of
+ *        TOUCHGFX_OVERDRAW_TILE_SIZE pixels, and so are the areas flushed by the framework,
+ *        which tell how often the tile was invalidated. The overdraw of a tile is the
+ *        pixels written in it over its size: 1 when every pixel was written once, 3 under
+ *        three stacked opaque backgrounds. Operations are counted by their area, so a
+ *        rotated texture mapped quad counts its bounding box, and widgets drawn by
+ *        CanvasWidgetRenderer, whose painters write the framebuffer directly, are not
+ *        counted.
+ *
+ *        With MODE_OVERLAY the highest overdraw of every tile over
+ *        TOUCHGFX_OVERDRAW_PERIOD_MS is shown on the overlay layer, at the top left of the
+ *        display, TOUCHGFX_OVERDRAW_OVERLAY_SCALE pixels per tile: dimmed where a tile
+ *        was drawn at most once, then blue, green, orange and red for up to two, three,
+ *        four and more times. It replaces the performance HUD while shown.
+ *
+ *        With MODE_STREAM every frame that drew is written to ITM stimulus port
+ *        TOUCHGFX_OVERDRAW_PORT: FRAME_BEGIN and the frame number, then a word per tile
+ *        written or flushed, the index of the tile, row by row, in the upper half, the
+ *        areas flushed in it in bits 15 to 8 and its overdraw in sixteenths, at most 255,
+ *        in bits 7 to 0, and FRAME_END. The stream starts with STREAM_BEGIN, the columns
+ *        and rows of tiles, columns in the upper half, and the tile size. Writing waits
+ *        for the ITM FIFO, so the frames streamed take longer, which does not change the
+ *        counts. gcc/overdraw.py turns the stream into a heatmap of the screen and a
+ *        list of the hotspots.
+ */
+class OverdrawHeatmap
+{
+public:
+    /** What is done with the counts. */
+    enum Mode
+    {
+        MODE_OFF,     ///< Nothing is counted
+        MODE_OVERLAY, ///< Shown on the overlay layer
+        MODE_STREAM   ///< Streamed over SWO
+    };
+
+    /** What wrote the pixels. */
+    enum Backend
+    {
+        BACKEND_GPU2D, ///< Recorded for GPU2D by LCDGPU2D
+        BACKEND_DMA2D, ///< Queued on DMA2D
+        BACKEND_CPU,   ///< Written by the CPU, in lcd16 or a fallback of HybridLCDGPU2D
+        NUMBER_OF_BACKENDS
+    };
+
+    /** Words starting the records of the stream. Tile words are below these. */
+    enum Marker
+    {
+        STREAM_BEGIN = 0xFFFF0000U, ///< Followed by the columns and rows, and the tile size
+        FRAME_BEGIN = 0xFFFF0001U,  ///< Followed by the frame number
+        FRAME_END = 0xFFFF0002U
+    };
+
+    /** Frames counted since the last reset. */
+    struct Stats
+    {
+        uint32_t frames;                     ///< Frames that drew
+        uint32_t written[NUMBER_OF_BACKENDS]; ///< Pixels written by each backend
+        uint32_t flushed;                    ///< Pixels of the areas flushed
+        uint8_t worst;                       ///< Highest overdraw of a tile in a frame, in sixteenths
+        uint16_t worstX;                     ///< Position of that tile in pixels
+        uint16_t worstY;
+    };
+
+    /**
+     * @fn OverdrawHeatmap::OverdrawHeatmap(OverlayLayer& overlay);
+     *
+     * @brief Constructor.
+     *
+     * @param overlay The overlay the heatmap is shown on.
+     */
+    explicit OverdrawHeatmap(OverlayLayer& overlay);
+
+    /**
+     * @fn void OverdrawHeatmap::setMode(Mode mode);
+     *
+     * @brief Starts or stops counting, and tells what is done with the counts. Counted
+     *        from the next frame.
+     *
+     * @param mode The mode.
+     */
+    void setMode(Mode mode);
+
+    /**
+     * @fn Mode OverdrawHeatmap::getMode() const;
+     *
+     * @brief Gets the mode.
+     *
+     * @return The mode.
+     */
+    Mode getMode() const
+    {
+        return mode;
+    }
+
+    /**
+     * @fn static void OverdrawHeatmap::wrote(const Rect& area, Backend backend);
+     *
+     * @brief Counts an area written into the framebuffer. Called by the LCD classes.
+     *
+     * @param area    The area, in absolute display coordinates.
+     * @param backend What wrote it.
+     */
+    static void wrote(const Rect& area, Backend backend)
+    {
+        if (instance != 0 && instance->counting)
+        {
+            instance->count(area, backend);
+        }
+    }
+
+    /**
+     * @fn void OverdrawHeatmap::flushed(const Rect& rect);
+     *
+     * @brief Counts an area flushed by the framework. Called by the HAL for each area.
+     *
+     * @param rect The area.
+     */
+    void flushed(const Rect& rect);
+
+    /**
+     * @fn void OverdrawHeatmap::frameStarted();
+     *
+     * @brief Starts counting the writes of a frame. Called by the HAL.
+     */
+    void frameStarted();
+
+    /**
+     * @fn void OverdrawHeatmap::frameEnded(uint32_t frame);
+     *
+     * @brief Ends counting the writes of a frame, and streams them in MODE_STREAM. Called
+     *        by the HAL.
+     *
+     * @param frame The frame number.
+     */
+    void frameEnded(uint32_t frame);
+
+    /**
+     * @fn void OverdrawHeatmap::tick();
+     *
+     * @brief Updates the overlay if TOUCHGFX_OVERDRAW_PERIOD_MS have passed. Called by the
+     *        HAL every tick.
+     */
+    void tick();
+
+    /**
+     * @fn const Stats& OverdrawHeatmap::getStats() const;
+     *
+     * @brief Gets the frames counted since the last reset.
+     *
+     * @return The statistics.
+     */
+    const Stats& getStats() const
+    {
+        return stats;
+    }
+
+    /**
+     * @fn void OverdrawHeatmap::resetStats();
+     *
+     * @brief Resets the statistics.
+     */
+    void resetStats();
+
+private:
+    void count(const Rect& area, Backend backend);
+    uint8_t overdraw(uint16_t tile) const;
+    void stream(uint32_t frame);
+    void show();
+
+    OverlayLayer& overlay;
+    Mode mode;
+    bool counting;  ///< Between frameStarted() and frameEnded() with a mode set
+    bool drew;      ///< Something was written in the frame
+    bool streaming; ///< STREAM_BEGIN was written since the port was enabled
+    uint16_t columns;
+    uint16_t rows;
+    uint32_t periodStartMs;
+    uint16_t written[TOUCHGFX_OVERDRAW_MAX_COLUMNS * TOUCHGFX_OVERDRAW_MAX_ROWS]; ///< Pixels written in each tile in the frame
+    uint8_t flushes[TOUCHGFX_OVERDRAW_MAX_COLUMNS * TOUCHGFX_OVERDRAW_MAX_ROWS];  ///< Areas flushed in each tile in the frame
+    uint8_t peak[TOUCHGFX_OVERDRAW_MAX_COLUMNS * TOUCHGFX_OVERDRAW_MAX_ROWS];     ///< Highest overdraw of each tile in the period
+    Stats stats;
+
+    static OverdrawHeatmap* instance;
+};
+} // namespace touchgfx
+
+/* USER CODE END OverdrawHeatmap.hpp */
+
+#endif // OVERDRAWHEATMAP_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
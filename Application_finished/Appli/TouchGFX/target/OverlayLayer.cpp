@@ -0,0 +1,145 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : OverlayLayer.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include <OverlayLayer.hpp>
+
+/* USER CODE BEGIN OverlayLayer.cpp */
+#include <DCacheMaintenance.hpp>
+#include <touchgfx/hal/HAL.hpp>
+#include <string.h>
+
+#include "stm32h7rsxx_hal.h"
+
+extern "C" LTDC_HandleTypeDef hltdc;
+
+namespace
+{
+// LTDC layer 2, layer 1 scans out the framebuffer
+const uint32_t OVERLAY_LAYER_INDEX = 1;
+
+#if TOUCHGFX_OVERLAY_LAYER
+// Kept in AXI SRAM with the rest of .bss, away from the framebuffers in PSRAM
+uint32_t overlayBuffers[2][TOUCHGFX_OVERLAY_MAX_PIXELS];
+#endif
+}
+
+namespace touchgfx
+{
+OverlayLayer::OverlayLayer()
+    : visible(false), shownBitmap(BITMAP_INVALID), shownX(0), shownY(0), backBuffer(0)
+{
+}
+
+bool OverlayLayer::show(const Bitmap& bitmap, int16_t x, int16_t y)
+{
+#if TOUCHGFX_OVERLAY_LAYER
+    if (bitmap.getId() == shownBitmap && x == shownX && y == shownY)
+    {
+        return true;
+    }
+    // The bitmap is read from external flash once, LTDC then fetches it from AXI SRAM
+    if (!configure(bitmap.getData(), bitmap.getFormat(), bitmap.getWidth(), bitmap.getHeight(), x, y))
+    {
+        return false;
+    }
+    shownBitmap = bitmap.getId();
+    shownX = x;
+    shownY = y;
+    return true;
+#else
+    (void)bitmap;
+    (void)x;
+    (void)y;
+    return false;
+#endif
+}
+
+bool OverlayLayer::showPixels(const void* pixels, Bitmap::BitmapFormat format, uint16_t width, uint16_t height, int16_t x, int16_t y)
+{
+    if (!configure(pixels, format, width, height, x, y))
+    {
+        return false;
+    }
+    shownBitmap = BITMAP_INVALID;
+    return true;
+}
+
+bool OverlayLayer::configure(const void* pixels, Bitmap::BitmapFormat format, uint16_t width, uint16_t height, int16_t x, int16_t y)
+{
+#if TOUCHGFX_OVERLAY_LAYER
+    if ((format != Bitmap::ARGB8888 && format != Bitmap::RGB565)
+            || (uint32_t)width * height > TOUCHGFX_OVERLAY_MAX_PIXELS
+            || x < 0 || y < 0 || x + width > HAL::DISPLAY_WIDTH || y + height > HAL::DISPLAY_HEIGHT
+            || pixels == 0)
+    {
+        return false;
+    }
+
+    uint32_t* const buffer = overlayBuffers[backBuffer];
+    const uint32_t bytes = (uint32_t)width * height * (format == Bitmap::ARGB8888 ? 4 : 2);
+    memcpy(buffer, pixels, bytes);
+    DCacheMaintenance::clean(buffer, bytes);
+
+    LTDC_LayerCfgTypeDef layerCfg = { 0 };
+    layerCfg.WindowX0 = x;
+    layerCfg.WindowX1 = x + width;
+    layerCfg.WindowY0 = y;
+    layerCfg.WindowY1 = y + height;
+    layerCfg.PixelFormat = (format == Bitmap::ARGB8888) ? LTDC_PIXEL_FORMAT_ARGB8888 : LTDC_PIXEL_FORMAT_RGB565;
+    layerCfg.Alpha = 255;
+    layerCfg.Alpha0 = 0;
+    layerCfg.BlendingFactor1 = LTDC_BLENDING_FACTOR1_PAxCA;
+    layerCfg.BlendingFactor2 = LTDC_BLENDING_FACTOR2_PAxCA;
+    layerCfg.FBStartAdress = (uint32_t)buffer;
+    layerCfg.ImageWidth = width;
+    layerCfg.ImageHeight = height;
+
+    // Shown from the next vertical blanking, the other buffer may still be scanned out
+    HAL_LTDC_ConfigLayer_NoReload(&hltdc, &layerCfg, OVERLAY_LAYER_INDEX);
+    HAL_LTDC_Reload(&hltdc, LTDC_RELOAD_VERTICAL_BLANKING);
+
+    backBuffer = 1 - backBuffer;
+    visible = true;
+    return true;
+#else
+    (void)pixels;
+    (void)format;
+    (void)width;
+    (void)height;
+    (void)x;
+    (void)y;
+    return false;
+#endif
+}
+
+void OverlayLayer::hide()
+{
+    if (!visible)
+    {
+        return;
+    }
+    __HAL_LTDC_LAYER_DISABLE(&hltdc, OVERLAY_LAYER_INDEX);
+    HAL_LTDC_Reload(&hltdc, LTDC_RELOAD_VERTICAL_BLANKING);
+    visible = false;
+    shownBitmap = BITMAP_INVALID;
+}
+} // namespace touchgfx
+
+/* USER CODE END OverlayLayer.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,135 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : OverlayLayer.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef OVERLAYLAYER_HPP
+#define OVERLAYLAYER_HPP
+
+#include <touchgfx/Bitmap.hpp>
+#include <BackgroundLayer.hpp>
+#include <stdint.h>
+
+/* USER CODE BEGIN OverlayLayer.hpp */
+
+/**
+ * Set to 0 to draw all widgets in the framebuffer of LTDC layer 1. LTDC layer 2 shows the
+ * framebuffer when TOUCHGFX_BACKGROUND_LAYER is enabled, so the overlay is off by default then.
+ */
+#ifndef TOUCHGFX_OVERLAY_LAYER
+#define TOUCHGFX_OVERLAY_LAYER (!TOUCHGFX_BACKGROUND_LAYER)
+#endif
+
+#if TOUCHGFX_OVERLAY_LAYER && TOUCHGFX_BACKGROUND_LAYER
+#error "TOUCHGFX_OVERLAY_LAYER and TOUCHGFX_BACKGROUND_LAYER both need LTDC layer 2"
+#endif
+
+/**
+ * Largest bitmap, in pixels, that can be shown on the overlay layer. Two ARGB8888 buffers
+ * of this size are allocated in AXI SRAM.
+ */
+#ifndef TOUCHGFX_OVERLAY_MAX_PIXELS
+#define TOUCHGFX_OVERLAY_MAX_PIXELS (160 * 64)
+#endif
+
+namespace touchgfx
+{
+/**
+ * @class OverlayLayer
+ *
+ * @brief Shows a bitmap on LTDC layer 2, composited by LTDC over the framebuffer on layer 1.
+ *
+ *        Widgets that change often but are small, like toggles and spinners, can be shown
+ *        on the overlay instead of being drawn into the framebuffer. Changing them then does
+ *        not redraw what is below them in the framebuffer in PSRAM. The bitmap is copied
+ *        into one of two buffers in AXI SRAM and shown from the next vertical blanking, so
+ *        LTDC never scans out a buffer being written. ARGB8888 bitmaps are blended using
+ *        their per-pixel alpha, RGB565 bitmaps are opaque.
+ */
+class OverlayLayer
+{
+public:
+    OverlayLayer();
+
+    /**
+     * @fn bool OverlayLayer::show(const Bitmap& bitmap, int16_t x, int16_t y);
+     *
+     * @brief Shows a bitmap on the overlay at a position on the display.
+     *
+     *        Does nothing if the bitmap is already shown at the position, so it can be
+     *        called every tick.
+     *
+     * @param bitmap The bitmap to show, ARGB8888 or RGB565, at most TOUCHGFX_OVERLAY_MAX_PIXELS.
+     * @param x      The absolute x coordinate of the bitmap.
+     * @param y      The absolute y coordinate of the bitmap.
+     *
+     * @return false if the bitmap cannot be shown on the overlay.
+     */
+    bool show(const Bitmap& bitmap, int16_t x, int16_t y);
+
+    /**
+     * @fn bool OverlayLayer::showPixels(const void* pixels, Bitmap::BitmapFormat format, uint16_t width, uint16_t height, int16_t x, int16_t y);
+     *
+     * @brief Shows pixels drawn by the CPU on the overlay, replacing what is shown.
+     *
+     *        The pixels are copied, so the caller may draw the next update into them
+     *        straight away.
+     *
+     * @param pixels The pixels, width * height of them without padding.
+     * @param format Bitmap::ARGB8888 or Bitmap::RGB565.
+     * @param width  The width of the pixels, at most TOUCHGFX_OVERLAY_MAX_PIXELS with height.
+     * @param height The height of the pixels.
+     * @param x      The absolute x coordinate of the pixels.
+     * @param y      The absolute y coordinate of the pixels.
+     *
+     * @return false if the pixels cannot be shown on the overlay.
+     */
+    bool showPixels(const void* pixels, Bitmap::BitmapFormat format, uint16_t width, uint16_t height, int16_t x, int16_t y);
+
+    /**
+     * @fn void OverlayLayer::hide();
+     *
+     * @brief Disables the overlay layer from the next vertical blanking.
+     */
+    void hide();
+
+    /**
+     * @fn bool OverlayLayer::isVisible() const;
+     *
+     * @brief Tells if a bitmap is shown on the overlay.
+     *
+     * @return true if the overlay layer is enabled.
+     */
+    bool isVisible() const
+    {
+        return visible;
+    }
+
+private:
+    bool configure(const void* pixels, Bitmap::BitmapFormat format, uint16_t width, uint16_t height, int16_t x, int16_t y);
+
+    bool visible;
+    BitmapId shownBitmap; ///< BITMAP_INVALID if nothing or pixels of showPixels() are shown
+    int16_t shownX;
+    int16_t shownY;
+    uint8_t backBuffer; ///< Buffer written by the next call to show()
+};
+} // namespace touchgfx
+
+/* USER CODE END OverlayLayer.hpp */
+
+#endif // OVERLAYLAYER_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,182 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : PerfHUD.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include <PerfHUD.hpp>
+
+/* USER CODE BEGIN PerfHUD.cpp */
+#include <TraceOutput.hpp>
+#include <touchgfx/hal/HAL.hpp>
+#include <stdio.h>
+#include <string.h>
+
+#include "stm32h7rsxx_hal.h"
+
+namespace
+{
+const uint32_t BACKGROUND_COLOR = 0xA0000000U; // Black, blended with the UI below
+const uint32_t TEXT_COLOR = 0xFFFFFFFFU;
+const uint16_t MARGIN = 2;
+const uint16_t LINE_HEIGHT = 9;
+const uint16_t CHAR_WIDTH = 6;
+
+// 5x7 glyphs, one byte per column with the top row in bit 0, of the characters below
+const char GLYPH_CHARS[] = "0123456789.%/:CDEFGIKMNPRSUX";
+const uint8_t GLYPHS[sizeof(GLYPH_CHARS) - 1][5] =
+{
+    { 0x3E, 0x51, 0x49, 0x45, 0x3E }, // 0
+    { 0x00, 0x42, 0x7F, 0x40, 0x00 }, // 1
+    { 0x42, 0x61, 0x51, 0x49, 0x46 }, // 2
+    { 0x21, 0x41, 0x45, 0x4B, 0x31 }, // 3
+    { 0x18, 0x14, 0x12, 0x7F, 0x10 }, // 4
+    { 0x27, 0x45, 0x45, 0x45, 0x39 }, // 5
+    { 0x3C, 0x4A, 0x49, 0x49, 0x30 }, // 6
+    { 0x01, 0x71, 0x09, 0x05, 0x03 }, // 7
+    { 0x36, 0x49, 0x49, 0x49, 0x36 }, // 8
+    { 0x06, 0x49, 0x49, 0x29, 0x1E }, // 9
+    { 0x00, 0x60, 0x60, 0x00, 0x00 }, // .
+    { 0x23, 0x13, 0x08, 0x64, 0x62 }, // %
+    { 0x20, 0x10, 0x08, 0x04, 0x02 }, // /
+    { 0x00, 0x36, 0x36, 0x00, 0x00 }, // :
+    { 0x3E, 0x41, 0x41, 0x41, 0x22 }, // C
+    { 0x7F, 0x41, 0x41, 0x22, 0x1C }, // D
+    { 0x7F, 0x49, 0x49, 0x49, 0x41 }, // E
+    { 0x7F, 0x09, 0x09, 0x09, 0x01 }, // F
+    { 0x3E, 0x41, 0x49, 0x49, 0x7A }, // G
+    { 0x00, 0x41, 0x7F, 0x41, 0x00 }, // I
+    { 0x7F, 0x08, 0x14, 0x22, 0x41 }, // K
+    { 0x7F, 0x02, 0x0C, 0x02, 0x7F }, // M
+    { 0x7F, 0x04, 0x08, 0x10, 0x7F }, // N
+    { 0x7F, 0x09, 0x09, 0x09, 0x06 }, // P
+    { 0x7F, 0x09, 0x19, 0x29, 0x46 }, // R
+    { 0x46, 0x49, 0x49, 0x49, 0x31 }, // S
+    { 0x3F, 0x40, 0x40, 0x40, 0x3F }, // U
+    { 0x63, 0x14, 0x08, 0x14, 0x63 }  // X
+};
+
+// Kept in AXI SRAM with the rest of .bss, copied to the overlay buffers when shown
+uint32_t hudPixels[touchgfx::PerfHUD::WIDTH * touchgfx::PerfHUD::HEIGHT];
+}
+
+namespace touchgfx
+{
+PerfHUD::PerfHUD(OverlayLayer& overlayLayer)
+    : overlay(overlayLayer), enabled(TOUCHGFX_PERF_HUD != 0), periodStartMs(0), frames(0), renderCycles(0), drawnPixels(0), frameStartCycles(0)
+{
+}
+
+void PerfHUD::setEnabled(bool enable)
+{
+    if (enabled && !enable)
+    {
+        overlay.hide();
+    }
+    enabled = enable;
+}
+
+void PerfHUD::frameStarted()
+{
+    frameStartCycles = DWT->CYCCNT;
+}
+
+void PerfHUD::drawn(const Rect& rect)
+{
+    drawnPixels += (uint32_t)rect.width * rect.height;
+}
+
+void PerfHUD::frameEnded()
+{
+    renderCycles += DWT->CYCCNT - frameStartCycles;
+    frames++;
+}
+
+void PerfHUD::tick(uint8_t mcuLoad, uint8_t gpuLoad)
+{
+    const uint32_t now = HAL_GetTick();
+    const uint32_t elapsedMs = now - periodStartMs;
+    if (elapsedMs < TOUCHGFX_PERF_HUD_PERIOD_MS)
+    {
+        return;
+    }
+    if (enabled)
+    {
+        update(elapsedMs, mcuLoad, gpuLoad);
+    }
+    periodStartMs = now;
+    frames = 0;
+    renderCycles = 0;
+    drawnPixels = 0;
+}
+
+void PerfHUD::update(uint32_t elapsedMs, uint8_t mcuLoad, uint8_t gpuLoad)
+{
+    // Tenths of frames per second and of milliseconds, printf of floats is not linked
+    const uint32_t fps10 = (frames * 10000U + elapsedMs / 2) / elapsedMs;
+    const uint32_t cyclesPerMs = SystemCoreClock / 1000U;
+    const uint32_t render10 = (frames > 0) ? (uint32_t)(((uint64_t)renderCycles * 10U) / ((uint64_t)cyclesPerMs * frames)) : 0U;
+    const uint32_t pixels = (frames > 0) ? drawnPixels / frames : 0U;
+
+    char lines[3][24];
+    snprintf(lines[0], sizeof(lines[0]), "FPS %lu.%lu MS %lu.%lu",
+             (unsigned long)(fps10 / 10), (unsigned long)(fps10 % 10),
+             (unsigned long)(render10 / 10), (unsigned long)(render10 % 10));
+    snprintf(lines[1], sizeof(lines[1]), "MCU %u%% GPU %u%%", (unsigned)mcuLoad, (unsigned)gpuLoad);
+    snprintf(lines[2], sizeof(lines[2]), "PX/F %lu", (unsigned long)pixels);
+
+    for (uint32_t i = 0; i < (uint32_t)WIDTH * HEIGHT; i++)
+    {
+        hudPixels[i] = BACKGROUND_COLOR;
+    }
+    for (uint16_t line = 0; line < 3; line++)
+    {
+        drawText(lines[line], MARGIN, MARGIN + line * LINE_HEIGHT);
+    }
+
+    // Top right corner of the display
+    if (!overlay.showPixels(hudPixels, Bitmap::ARGB8888, WIDTH, HEIGHT, HAL::DISPLAY_WIDTH - WIDTH, 0))
+    {
+        tracePrintf("hud: %s %s %s", lines[0], lines[1], lines[2]);
+    }
+}
+
+void PerfHUD::drawText(const char* text, uint16_t x, uint16_t y)
+{
+    for (; *text != 0 && x + CHAR_WIDTH <= WIDTH; text++, x += CHAR_WIDTH)
+    {
+        const char* const glyph = strchr(GLYPH_CHARS, *text);
+        if (*text == ' ' || glyph == 0)
+        {
+            continue;
+        }
+        const uint8_t* const columns = GLYPHS[glyph - GLYPH_CHARS];
+        for (uint16_t column = 0; column < 5; column++)
+        {
+            for (uint16_t row = 0; row < 7; row++)
+            {
+                if (columns[column] & (1U << row))
+                {
+                    hudPixels[(uint32_t)(y + row) * WIDTH + x + column] = TEXT_COLOR;
+                }
+            }
+        }
+    }
+}
+} // namespace touchgfx
+
+/* USER CODE END PerfHUD.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
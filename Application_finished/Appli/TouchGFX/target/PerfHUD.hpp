@@ -0,0 +1,149 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : PerfHUD.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef PERFHUD_HPP
+#define PERFHUD_HPP
+
+#include <touchgfx/hal/Types.hpp>
+#include <OverlayLayer.hpp>
+#include <stdint.h>
+
+/* USER CODE BEGIN PerfHUD.hpp */
+
+/**
+ * Set to 1 to show the performance HUD from start-up, see PerfHUD::setEnabled().
+ */
+#ifndef TOUCHGFX_PERF_HUD
+#define TOUCHGFX_PERF_HUD 0
+#endif
+
+/**
+ * Milliseconds between two updates of the performance HUD.
+ */
+#ifndef TOUCHGFX_PERF_HUD_PERIOD_MS
+#define TOUCHGFX_PERF_HUD_PERIOD_MS 250
+#endif
+
+namespace touchgfx
+{
+/**
+ * @class PerfHUD
+ *
+ * @brief Shows the frame rate, render time, MCU and GPU2D load and the pixels drawn per
+ *        frame on the overlay layer.
+ *
+ *        Application::setDebugString() and the debug printer draw into the framebuffer,
+ *        so the region of the text is invalidated and redrawn, and the numbers shown
+ *        include the cost of showing them. The HUD is drawn by the CPU with a built-in
+ *        5x7 font into a small buffer in AXI SRAM, every TOUCHGFX_PERF_HUD_PERIOD_MS, and
+ *        shown with OverlayLayer::showPixels() on LTDC layer 2, which LTDC blends over the
+ *        framebuffer. Nothing of the UI is invalidated or drawn again.
+ *
+ *        The HUD replaces what the application shows on the overlay while it is enabled.
+ *        Without TOUCHGFX_OVERLAY_LAYER the numbers are written over SWO instead.
+ */
+class PerfHUD
+{
+public:
+    /** Width of the HUD in pixels. */
+    static const uint16_t WIDTH = 132;
+    /** Height of the HUD in pixels, three lines of text. */
+    static const uint16_t HEIGHT = 30;
+
+    /**
+     * @fn PerfHUD::PerfHUD(OverlayLayer& overlay);
+     *
+     * @brief Constructor.
+     *
+     * @param overlay The overlay the HUD is shown on.
+     */
+    explicit PerfHUD(OverlayLayer& overlay);
+
+    /**
+     * @fn void PerfHUD::setEnabled(bool enabled);
+     *
+     * @brief Shows or hides the HUD. Shown from the next update.
+     *
+     * @param enabled true to show the HUD.
+     */
+    void setEnabled(bool enabled);
+
+    /**
+     * @fn bool PerfHUD::isEnabled() const;
+     *
+     * @brief Tells if the HUD is shown.
+     *
+     * @return true if enabled.
+     */
+    bool isEnabled() const
+    {
+        return enabled;
+    }
+
+    /**
+     * @fn void PerfHUD::frameStarted();
+     *
+     * @brief Starts timing the rendering of a frame. Called by the HAL.
+     */
+    void frameStarted();
+
+    /**
+     * @fn void PerfHUD::drawn(const Rect& rect);
+     *
+     * @brief Counts the pixels of an area drawn. Called by the HAL for each area flushed.
+     *
+     * @param rect The area drawn.
+     */
+    void drawn(const Rect& rect);
+
+    /**
+     * @fn void PerfHUD::frameEnded();
+     *
+     * @brief Ends timing the rendering of a frame. Called by the HAL.
+     */
+    void frameEnded();
+
+    /**
+     * @fn void PerfHUD::tick(uint8_t mcuLoad, uint8_t gpuLoad);
+     *
+     * @brief Updates the HUD if TOUCHGFX_PERF_HUD_PERIOD_MS have passed. Called by the HAL
+     *        every tick.
+     *
+     * @param mcuLoad The MCU load in percent.
+     * @param gpuLoad The GPU2D load in percent.
+     */
+    void tick(uint8_t mcuLoad, uint8_t gpuLoad);
+
+private:
+    void update(uint32_t elapsedMs, uint8_t mcuLoad, uint8_t gpuLoad);
+    void drawText(const char* text, uint16_t x, uint16_t y);
+
+    OverlayLayer& overlay;
+    bool enabled;
+    uint32_t periodStartMs;  ///< Start of the period counted
+    uint32_t frames;         ///< Frames ended in the period
+    uint32_t renderCycles;   ///< CPU cycles from the start to the end of the frames in the period
+    uint32_t drawnPixels;    ///< Pixels flushed in the period
+    uint32_t frameStartCycles;
+};
+} // namespace touchgfx
+
+/* USER CODE END PerfHUD.hpp */
+
+#endif // PERFHUD_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
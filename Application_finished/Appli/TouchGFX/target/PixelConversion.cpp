@@ -0,0 +1,420 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : PixelConversion.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include <PixelConversion.hpp>
+
+/* USER CODE BEGIN PixelConversion.cpp */
+#include <DCacheMaintenance.hpp>
+#include <string.h>
+
+#include <stm32h7rsxx_hal.h>
+
+namespace
+{
+// 0x00RRGGBB, or 0xAARRGGBB with the alpha ignored, to RGB565
+inline uint32_t toRGB565(uint32_t color)
+{
+    return ((color >> 8) & 0xF800U) | ((color >> 5) & 0x07E0U) | ((color >> 3) & 0x001FU);
+}
+
+// RGB565 to 0xFFRRGGBB, the top bits of every channel repeated in the bits added
+inline uint32_t toARGB8888(uint32_t color)
+{
+    uint32_t rb = ((color & 0xF800U) << 8) | ((color & 0x001FU) << 3);
+    rb |= (rb >> 5) & 0x00070007U;
+    uint32_t g = (color & 0x07E0U) << 5;
+    g |= (g >> 6) & 0x00000300U;
+    return 0xFF000000U | rb | g;
+}
+
+// The two bytes 0 and 2 of a word in the halfwords of the result
+inline uint32_t lanes(uint32_t word)
+{
+#if defined(__ARM_FEATURE_DSP) && __ARM_FEATURE_DSP
+    return __UXTB16(word);
+#else
+    return word & 0x00FF00FFU;
+#endif
+}
+
+// Two halfwords, each at most 255 * 255, divided by 255 and rounded
+inline uint32_t div255Lanes(uint32_t value)
+{
+    value += 0x00800080U;
+    return ((value + lanes(value >> 8)) >> 8) & 0x00FF00FFU;
+}
+
+inline void store2(uint16_t* dst, uint32_t first, uint32_t second)
+{
+#if defined(__ARM_FEATURE_DSP) && __ARM_FEATURE_DSP
+    *reinterpret_cast<uint32_t*>(dst) = __PKHBT(first, second, 16);
+#else
+    *reinterpret_cast<uint32_t*>(dst) = first | (second << 16);
+#endif
+}
+}
+
+namespace touchgfx
+{
+DMA_Interface* PixelConversion::dma = 0;
+PixelConversion::Stats PixelConversion::stats;
+
+void PixelConversion::init(DMA_Interface& dmaInterface)
+{
+    dma = &dmaInterface;
+}
+
+bool PixelConversion::canConvert(Bitmap::BitmapFormat from, Bitmap::BitmapFormat to)
+{
+    const bool fromSupported = from == Bitmap::RGB565 || from == Bitmap::RGB888 || from == Bitmap::ARGB8888 || from == Bitmap::L8;
+    const bool toSupported = to == Bitmap::RGB565 || to == Bitmap::RGB888 || to == Bitmap::ARGB8888;
+    // The only pair without a kernel, the alpha would be lost through RGB565
+    return fromSupported && toSupported && !(from == Bitmap::ARGB8888 && to == Bitmap::RGB888);
+}
+
+bool PixelConversion::isConvertedByDMA2D(Bitmap::BitmapFormat from, Bitmap::BitmapFormat to, const uint8_t* clut)
+{
+    if (!(to == Bitmap::RGB565 || to == Bitmap::RGB888 || to == Bitmap::ARGB8888))
+    {
+        return false;
+    }
+    if (from == Bitmap::L8)
+    {
+        // A palette with alpha is blended over the destination, not copied
+        return clut != 0 && *reinterpret_cast<const uint16_t*>(clut) == Bitmap::CLUT_FORMAT_L8_RGB888;
+    }
+    return from == Bitmap::RGB565 || from == Bitmap::RGB888 || from == Bitmap::ARGB8888;
+}
+
+bool PixelConversion::convert(const void* src, Bitmap::BitmapFormat srcFormat, uint32_t srcStride, const uint8_t* clut,
+                              void* dst, Bitmap::BitmapFormat dstFormat, uint32_t dstStride, uint16_t width, uint16_t height, bool allowDMA2D)
+{
+    if (!canConvert(srcFormat, dstFormat) || (srcFormat == Bitmap::L8 && clut == 0))
+    {
+        return false;
+    }
+    const uint32_t pixels = (uint32_t)width * height;
+    if (pixels == 0)
+    {
+        return true;
+    }
+    stats.conversions++;
+    const uint32_t srcBpp = bytesPerPixel(srcFormat);
+    const uint32_t dstBpp = bytesPerPixel(dstFormat);
+
+    if (allowDMA2D && dma != 0 && pixels >= TOUCHGFX_PIXEL_CONVERSION_DMA2D_PIXELS && isConvertedByDMA2D(srcFormat, dstFormat, clut))
+    {
+        const uint32_t srcBytes = ((uint32_t)(height - 1) * srcStride + width) * srcBpp;
+        const uint32_t dstBytes = ((uint32_t)(height - 1) * dstStride + width) * dstBpp;
+        // Pixels written by the CPU are written back before DMA2D reads them, and no dirty
+        // line may be evicted over what DMA2D writes
+        DCacheMaintenance::clean(src, srcBytes);
+        DCacheMaintenance::cleanInvalidate(dst, dstBytes);
+
+        BlitOp op = BlitOp();
+        op.operation = (srcFormat == Bitmap::L8) ? BLIT_OP_COPY_L8 : BLIT_OP_COPY;
+        op.pSrc = static_cast<const uint16_t*>(src);
+        op.pClut = clut;
+        op.pDst = static_cast<uint16_t*>(dst);
+        op.nSteps = width;
+        op.nLoops = height;
+        op.srcLoopStride = srcStride;
+        op.dstLoopStride = dstStride;
+        op.alpha = 255;
+        op.srcFormat = srcFormat;
+        op.dstFormat = dstFormat;
+        dma->addToQueue(op);
+        // isDmaQueueEmpty() is out of line, so isRunning is reloaded on every iteration
+        while (!dma->isDmaQueueEmpty() || dma->isDMARunning())
+        {
+        }
+        // Lines the CPU fetched speculatively while DMA2D was writing
+        DCacheMaintenance::invalidate(dst, dstBytes);
+        stats.dma2dPixels += pixels;
+        return true;
+    }
+
+    const uint8_t* srcRow = static_cast<const uint8_t*>(src);
+    uint8_t* dstRow = static_cast<uint8_t*>(dst);
+    if (srcStride == width && dstStride == width)
+    {
+        // One run, the kernels are faster on long runs
+        convertRow(srcRow, srcFormat, clut, dstRow, dstFormat, pixels);
+    }
+    else
+    {
+        for (uint16_t y = 0; y < height; y++)
+        {
+            convertRow(srcRow, srcFormat, clut, dstRow, dstFormat, width);
+            srcRow += srcStride * srcBpp;
+            dstRow += dstStride * dstBpp;
+        }
+    }
+    stats.cpuPixels += pixels;
+    return true;
+}
+
+void PixelConversion::rgb888ToRGB565(const uint8_t* src, uint16_t* dst, uint32_t pixels)
+{
+    // Pixel by pixel up to a word in both, four pixels later both are back where they were
+    for (uint32_t i = 0; i < 4 && pixels > 0 && ((((uintptr_t)src | (uintptr_t)dst) & 3U) != 0); i++)
+    {
+        *dst++ = (uint16_t)toRGB565(src[0] | (src[1] << 8) | (src[2] << 16));
+        src += 3;
+        pixels--;
+    }
+    if (((uintptr_t)src & 3U) == 0 && ((uintptr_t)dst & 3U) == 0)
+    {
+        // Four pixels in three words: B0 G0 R0 B1, G1 R1 B2 G2, R2 B3 G3 R3
+        const uint32_t* words = reinterpret_cast<const uint32_t*>(src);
+        while (pixels >= 4)
+        {
+            const uint32_t w0 = words[0];
+            const uint32_t w1 = words[1];
+            const uint32_t w2 = words[2];
+            store2(dst, toRGB565(w0), toRGB565((w0 >> 24) | (w1 << 8)));
+            store2(dst + 2, toRGB565((w1 >> 16) | (w2 << 16)), toRGB565(w2 >> 8));
+            words += 3;
+            dst += 4;
+            pixels -= 4;
+        }
+        src = reinterpret_cast<const uint8_t*>(words);
+    }
+    while (pixels > 0)
+    {
+        *dst++ = (uint16_t)toRGB565(src[0] | (src[1] << 8) | (src[2] << 16));
+        src += 3;
+        pixels--;
+    }
+}
+
+void PixelConversion::argb8888ToRGB565(const uint32_t* src, uint16_t* dst, uint32_t pixels)
+{
+    if (pixels > 0 && ((uintptr_t)dst & 3U) != 0)
+    {
+        *dst++ = (uint16_t)toRGB565(*src++);
+        pixels--;
+    }
+    while (pixels >= 2)
+    {
+        store2(dst, toRGB565(src[0]), toRGB565(src[1]));
+        src += 2;
+        dst += 2;
+        pixels -= 2;
+    }
+    if (pixels > 0)
+    {
+        *dst = (uint16_t)toRGB565(*src);
+    }
+}
+
+void PixelConversion::rgb565ToARGB8888(const uint16_t* src, uint32_t* dst, uint32_t pixels)
+{
+    // From the last pixel, so the larger pixels written never overwrite a pixel not read
+    while (pixels > 0)
+    {
+        pixels--;
+        dst[pixels] = toARGB8888(src[pixels]);
+    }
+}
+
+void PixelConversion::rgb565ToRGB888(const uint16_t* src, uint8_t* dst, uint32_t pixels)
+{
+    while (pixels > 0)
+    {
+        pixels--;
+        const uint32_t color = toARGB8888(src[pixels]);
+        uint8_t* const out = dst + pixels * 3;
+        out[0] = (uint8_t)color;
+        out[1] = (uint8_t)(color >> 8);
+        out[2] = (uint8_t)(color >> 16);
+    }
+}
+
+void PixelConversion::rgb888ToARGB8888(const uint8_t* src, uint32_t* dst, uint32_t pixels)
+{
+    while (pixels > 0)
+    {
+        pixels--;
+        const uint8_t* const in = src + pixels * 3;
+        dst[pixels] = 0xFF000000U | in[0] | (in[1] << 8) | (in[2] << 16);
+    }
+}
+
+void PixelConversion::premultiply(uint32_t* argb, uint32_t pixels)
+{
+    for (uint32_t i = 0; i < pixels; i++)
+    {
+        const uint32_t color = argb[i];
+        const uint32_t alpha = color >> 24;
+        if (alpha == 255)
+        {
+            continue;
+        }
+        // Red and blue in the halfwords of one word, green with alpha times 255 in another,
+        // none of the products carries into the next halfword
+        const uint32_t rb = div255Lanes(lanes(color) * alpha);
+        const uint32_t ga = div255Lanes((((color >> 8) & 0xFFU) | 0x00FF0000U) * alpha);
+        argb[i] = rb | (ga << 8);
+    }
+}
+
+bool PixelConversion::expandL8(const uint8_t* src, const uint8_t* clut, void* dst, Bitmap::BitmapFormat dstFormat, uint32_t pixels)
+{
+    if (clut == 0)
+    {
+        return false;
+    }
+    const uint16_t clutFormat = reinterpret_cast<const uint16_t*>(clut)[0];
+    uint32_t size = reinterpret_cast<const uint16_t*>(clut)[1];
+    if (size > 256)
+    {
+        size = 256;
+    }
+    const uint8_t* const colors = clut + 4;
+
+    // The palette in ARGB8888 first, then one lookup per pixel
+    uint32_t palette[256];
+    for (uint32_t i = 0; i < size; i++)
+    {
+        switch (clutFormat)
+        {
+        case Bitmap::CLUT_FORMAT_L8_ARGB8888:
+            palette[i] = reinterpret_cast<const uint32_t*>(colors)[i];
+            break;
+        case Bitmap::CLUT_FORMAT_L8_RGB888:
+            palette[i] = 0xFF000000U | colors[3 * i] | (colors[3 * i + 1] << 8) | (colors[3 * i + 2] << 16);
+            break;
+        case Bitmap::CLUT_FORMAT_L8_RGB565:
+            palette[i] = toARGB8888(reinterpret_cast<const uint16_t*>(colors)[i]);
+            break;
+        default:
+            return false;
+        }
+    }
+    for (uint32_t i = size; i < 256; i++)
+    {
+        palette[i] = 0;
+    }
+
+    switch (dstFormat)
+    {
+    case Bitmap::RGB565:
+        {
+            uint16_t* out = static_cast<uint16_t*>(dst);
+            for (uint32_t i = 0; i < size; i++)
+            {
+                palette[i] = toRGB565(palette[i]);
+            }
+            for (uint32_t i = 0; i < pixels; i++)
+            {
+                out[i] = (uint16_t)palette[src[i]];
+            }
+        }
+        return true;
+    case Bitmap::RGB888:
+        {
+            uint8_t* out = static_cast<uint8_t*>(dst);
+            for (uint32_t i = 0; i < pixels; i++)
+            {
+                const uint32_t color = palette[src[i]];
+                out[0] = (uint8_t)color;
+                out[1] = (uint8_t)(color >> 8);
+                out[2] = (uint8_t)(color >> 16);
+                out += 3;
+            }
+        }
+        return true;
+    case Bitmap::ARGB8888:
+        {
+            uint32_t* out = static_cast<uint32_t*>(dst);
+            for (uint32_t i = 0; i < pixels; i++)
+            {
+                out[i] = palette[src[i]];
+            }
+        }
+        return true;
+    default:
+        return false;
+    }
+}
+
+void PixelConversion::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+bool PixelConversion::convertRow(const uint8_t* src, Bitmap::BitmapFormat srcFormat, const uint8_t* clut,
+                                 uint8_t* dst, Bitmap::BitmapFormat dstFormat, uint32_t pixels)
+{
+    if (srcFormat == dstFormat)
+    {
+        memcpy(dst, src, pixels * bytesPerPixel(srcFormat));
+        return true;
+    }
+    switch (srcFormat)
+    {
+    case Bitmap::L8:
+        return expandL8(src, clut, dst, dstFormat, pixels);
+    case Bitmap::RGB888:
+        if (dstFormat == Bitmap::RGB565)
+        {
+            rgb888ToRGB565(src, reinterpret_cast<uint16_t*>(dst), pixels);
+        }
+        else
+        {
+            rgb888ToARGB8888(src, reinterpret_cast<uint32_t*>(dst), pixels);
+        }
+        return true;
+    case Bitmap::ARGB8888:
+        argb8888ToRGB565(reinterpret_cast<const uint32_t*>(src), reinterpret_cast<uint16_t*>(dst), pixels);
+        return true;
+    case Bitmap::RGB565:
+        if (dstFormat == Bitmap::RGB888)
+        {
+            rgb565ToRGB888(reinterpret_cast<const uint16_t*>(src), dst, pixels);
+        }
+        else
+        {
+            rgb565ToARGB8888(reinterpret_cast<const uint16_t*>(src), reinterpret_cast<uint32_t*>(dst), pixels);
+        }
+        return true;
+    default:
+        return false;
+    }
+}
+
+uint32_t PixelConversion::bytesPerPixel(Bitmap::BitmapFormat format)
+{
+    switch (format)
+    {
+    case Bitmap::RGB565:
+        return 2;
+    case Bitmap::RGB888:
+        return 3;
+    case Bitmap::ARGB8888:
+        return 4;
+    default:
+        return 1;
+    }
+}
+} // namespace touchgfx
+
+/* USER CODE END PixelConversion.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,212 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : PixelConversion.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef PIXELCONVERSION_HPP
+#define PIXELCONVERSION_HPP
+
+#include <touchgfx/Bitmap.hpp>
+#include <touchgfx/hal/DMA.hpp>
+#include <stdint.h>
+
+/* USER CODE BEGIN PixelConversion.hpp */
+
+/**
+ * Smallest conversion, in pixels, done by DMA2D. Below it the setup, the cache maintenance
+ * and the wait cost more than converting with the CPU.
+ */
+#ifndef TOUCHGFX_PIXEL_CONVERSION_DMA2D_PIXELS
+#define TOUCHGFX_PIXEL_CONVERSION_DMA2D_PIXELS 4096
+#endif
+
+namespace touchgfx
+{
+/**
+ * @class PixelConversion
+ *
+ * @brief Converts pixels between the RGB565, RGB888 and ARGB8888 formats and expands L8
+ *        bitmaps through their palette, for the loaders and caches that store pixels in
+ *        another format than they get them in.
+ *
+ *        convert() converts a rectangle with DMA2D, by a pixel format conversion queued
+ *        on the ChromART queue of the HAL, when it is large enough and DMA2D converts the
+ *        formats, and otherwise with the kernels below. The kernels convert a run of
+ *        pixels with the CPU, a word at a time where the formats allow it, with the
+ *        Cortex-M7 SIMD instructions where they save instructions. Those expanding a
+ *        format into a larger one convert in place when the source is at the start of the
+ *        destination.
+ *
+ *        RGB888 is stored as TouchGFX does, blue first, and ARGB8888 as 0xAARRGGBB words.
+ *        Palettes are the extra data of an L8 bitmap: its format and size, then the
+ *        colors.
+ */
+class PixelConversion
+{
+public:
+    /** Pixels converted since the last reset. */
+    struct Stats
+    {
+        uint32_t conversions; ///< Calls to convert()
+        uint32_t cpuPixels;   ///< Pixels converted by the CPU
+        uint32_t dma2dPixels; ///< Pixels converted by DMA2D
+    };
+
+    /**
+     * @fn static void PixelConversion::init(DMA_Interface& dma);
+     *
+     * @brief Sets the ChromART queue that DMA2D conversions are added to. Called by
+     *        TouchGFXHAL::initialize().
+     *
+     * @param dma The DMA of the HAL.
+     */
+    static void init(DMA_Interface& dma);
+
+    /**
+     * @fn static bool PixelConversion::canConvert(Bitmap::BitmapFormat from, Bitmap::BitmapFormat to);
+     *
+     * @brief Tells if convert() converts between two formats.
+     *
+     * @param from The source format, RGB565, RGB888, ARGB8888 or L8.
+     * @param to   The destination format.
+     *
+     * @return true if the formats are converted.
+     */
+    static bool canConvert(Bitmap::BitmapFormat from, Bitmap::BitmapFormat to);
+
+    /**
+     * @fn static bool PixelConversion::isConvertedByDMA2D(Bitmap::BitmapFormat from, Bitmap::BitmapFormat to, const uint8_t* clut = 0);
+     *
+     * @brief Tells if DMA2D converts between two formats with a copy, without blending.
+     *
+     * @param from The source format.
+     * @param to   The destination format.
+     * @param clut (Optional) The palette of an L8 source.
+     *
+     * @return true if a BLIT_OP_COPY or BLIT_OP_COPY_L8 converts the formats.
+     */
+    static bool isConvertedByDMA2D(Bitmap::BitmapFormat from, Bitmap::BitmapFormat to, const uint8_t* clut = 0);
+
+    /**
+     * @fn static bool PixelConversion::convert(const void* src, Bitmap::BitmapFormat srcFormat, uint32_t srcStride, const uint8_t* clut, void* dst, Bitmap::BitmapFormat dstFormat, uint32_t dstStride, uint16_t width, uint16_t height, bool allowDMA2D = true);
+     *
+     * @brief Converts a rectangle of pixels.
+     *
+     *        DMA2D is used from the TouchGFX task only, as it shares the ChromART queue
+     *        with rendering: other tasks pass allowDMA2D false. The conversion is done
+     *        when the call returns, the destination is up to date in the data cache.
+     *
+     * @param src        The first pixel of the source.
+     * @param srcFormat  The source format.
+     * @param srcStride  Pixels from one source row to the next.
+     * @param clut       The palette of an L8 source, else 0.
+     * @param dst        The first pixel of the destination, not overlapping the source.
+     * @param dstFormat  The destination format.
+     * @param dstStride  Pixels from one destination row to the next.
+     * @param width      Width of the rectangle.
+     * @param height     Height of the rectangle.
+     * @param allowDMA2D (Optional) false to convert with the CPU.
+     *
+     * @return false if the formats are not converted.
+     */
+    static bool convert(const void* src, Bitmap::BitmapFormat srcFormat, uint32_t srcStride, const uint8_t* clut,
+                        void* dst, Bitmap::BitmapFormat dstFormat, uint32_t dstStride, uint16_t width, uint16_t height, bool allowDMA2D = true);
+
+    /**
+     * @fn static void PixelConversion::rgb888ToRGB565(const uint8_t* src, uint16_t* dst, uint32_t pixels);
+     *
+     * @brief Converts RGB888 pixels to RGB565, four pixels from three words.
+     */
+    static void rgb888ToRGB565(const uint8_t* src, uint16_t* dst, uint32_t pixels);
+
+    /**
+     * @fn static void PixelConversion::argb8888ToRGB565(const uint32_t* src, uint16_t* dst, uint32_t pixels);
+     *
+     * @brief Converts ARGB8888 pixels to RGB565, dropping the alpha.
+     */
+    static void argb8888ToRGB565(const uint32_t* src, uint16_t* dst, uint32_t pixels);
+
+    /**
+     * @fn static void PixelConversion::rgb565ToARGB8888(const uint16_t* src, uint32_t* dst, uint32_t pixels);
+     *
+     * @brief Converts RGB565 pixels to opaque ARGB8888, in place if src is dst.
+     */
+    static void rgb565ToARGB8888(const uint16_t* src, uint32_t* dst, uint32_t pixels);
+
+    /**
+     * @fn static void PixelConversion::rgb565ToRGB888(const uint16_t* src, uint8_t* dst, uint32_t pixels);
+     *
+     * @brief Converts RGB565 pixels to RGB888, in place if src is dst.
+     */
+    static void rgb565ToRGB888(const uint16_t* src, uint8_t* dst, uint32_t pixels);
+
+    /**
+     * @fn static void PixelConversion::rgb888ToARGB8888(const uint8_t* src, uint32_t* dst, uint32_t pixels);
+     *
+     * @brief Converts RGB888 pixels to opaque ARGB8888, in place if src is dst.
+     */
+    static void rgb888ToARGB8888(const uint8_t* src, uint32_t* dst, uint32_t pixels);
+
+    /**
+     * @fn static void PixelConversion::premultiply(uint32_t* argb, uint32_t pixels);
+     *
+     * @brief Multiplies the colors of ARGB8888 pixels by their alpha, in place, for buffers
+     *        blended by GPU2D as premultiplied. Red and blue are multiplied together.
+     */
+    static void premultiply(uint32_t* argb, uint32_t pixels);
+
+    /**
+     * @fn static bool PixelConversion::expandL8(const uint8_t* src, const uint8_t* clut, void* dst, Bitmap::BitmapFormat dstFormat, uint32_t pixels);
+     *
+     * @brief Expands L8 pixels through their palette to RGB565, RGB888 or ARGB8888.
+     *
+     * @return false if the palette or the destination format is not supported.
+     */
+    static bool expandL8(const uint8_t* src, const uint8_t* clut, void* dst, Bitmap::BitmapFormat dstFormat, uint32_t pixels);
+
+    /**
+     * @fn static const Stats& PixelConversion::getStats();
+     *
+     * @brief Gets the conversions since the last reset.
+     *
+     * @return The statistics.
+     */
+    static const Stats& getStats()
+    {
+        return stats;
+    }
+
+    /**
+     * @fn static void PixelConversion::resetStats();
+     *
+     * @brief Resets the statistics.
+     */
+    static void resetStats();
+
+private:
+    static bool convertRow(const uint8_t* src, Bitmap::BitmapFormat srcFormat, const uint8_t* clut,
+                           uint8_t* dst, Bitmap::BitmapFormat dstFormat, uint32_t pixels);
+    static uint32_t bytesPerPixel(Bitmap::BitmapFormat format);
+
+    static DMA_Interface* dma;
+    static Stats stats;
+};
+} // namespace touchgfx
+
+/* USER CODE END PixelConversion.hpp */
+
+#endif // PIXELCONVERSION_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
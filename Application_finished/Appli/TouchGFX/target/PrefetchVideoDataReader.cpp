@@ -0,0 +1,237 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : PrefetchVideoDataReader.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include <PrefetchVideoDataReader.hpp>
+
+/* USER CODE BEGIN PrefetchVideoDataReader.cpp */
+#include <DCacheMaintenance.hpp>
+#include <cassert>
+#include <string.h>
+
+namespace
+{
+// Largest HPDMA block, rounded down to the burst size
+const uint32_t MAX_BLOCK_SIZE = 0xFFF0U;
+}
+
+namespace touchgfx
+{
+PrefetchVideoDataReader* PrefetchVideoDataReader::instance = 0;
+
+PrefetchVideoDataReader::PrefetchVideoDataReader(const uint8_t* videoData, uint32_t videoLength, uint8_t* buffer, uint32_t bufferSize)
+    : data(videoData), length(videoLength), position(0), slotSize((bufferSize / 2) & ~31U),
+      acquired(0), transferSlot(-1), transferOffset(0)
+{
+    assert(((uintptr_t)buffer & 31U) == 0 && "Prefetch buffer must be 32 byte aligned");
+    for (uint32_t i = 0; i < 2; i++)
+    {
+        slots[i].data = buffer + i * slotSize;
+        slots[i].offset = 0;
+        slots[i].length = 0;
+    }
+    memset(&hdma, 0, sizeof(hdma));
+    memset(&stats, 0, sizeof(stats));
+}
+
+void PrefetchVideoDataReader::init()
+{
+    instance = this;
+
+    hdma.Instance = HPDMA1_Channel2;
+    hdma.Init.Request = DMA_REQUEST_SW;
+    hdma.Init.BlkHWRequest = DMA_BREQ_SINGLE_BURST;
+    hdma.Init.Direction = DMA_MEMORY_TO_MEMORY;
+    hdma.Init.SrcInc = DMA_SINC_INCREMENTED;
+    hdma.Init.DestInc = DMA_DINC_INCREMENTED;
+    hdma.Init.SrcDataWidth = DMA_SRC_DATAWIDTH_BYTE;
+    hdma.Init.DestDataWidth = DMA_DEST_DATAWIDTH_BYTE;
+    hdma.Init.Priority = DMA_LOW_PRIORITY_HIGH_WEIGHT;
+    hdma.Init.SrcBurstLength = 16;
+    hdma.Init.DestBurstLength = 16;
+    hdma.Init.TransferAllocatedPort = DMA_SRC_ALLOCATED_PORT0 | DMA_DEST_ALLOCATED_PORT1;
+    hdma.Init.TransferEventMode = DMA_TCEM_BLOCK_TRANSFER;
+    hdma.Init.Mode = DMA_NORMAL;
+    if (HAL_DMA_Init(&hdma) != HAL_OK)
+    {
+        assert(0 && "Unable to initialize prefetch DMA");
+    }
+    HAL_DMA_ConfigChannelAttributes(&hdma, DMA_CHANNEL_NPRIV);
+    HAL_DMA_RegisterCallback(&hdma, HAL_DMA_XFER_CPLT_CB_ID, &PrefetchVideoDataReader::transferComplete);
+
+    // Same priority as the JPEG channels
+    HAL_NVIC_SetPriority(HPDMA1_Channel2_IRQn, 5, 0);
+    HAL_NVIC_EnableIRQ(HPDMA1_Channel2_IRQn);
+}
+
+void PrefetchVideoDataReader::setVideoData(const uint8_t* videoData, uint32_t videoLength)
+{
+    // The running transfer reads the previous video
+    waitForTransfer();
+
+    data = videoData;
+    length = videoLength;
+    position = 0;
+    for (uint32_t i = 0; i < 2; i++)
+    {
+        slots[i].offset = 0;
+        slots[i].length = 0;
+    }
+    acquired = 0;
+}
+
+uint32_t PrefetchVideoDataReader::getDataLength()
+{
+    return length;
+}
+
+void PrefetchVideoDataReader::seek(uint32_t pos)
+{
+    position = pos;
+}
+
+bool PrefetchVideoDataReader::readData(void* dst, uint32_t bytes)
+{
+    if (position + bytes > length)
+    {
+        return false;
+    }
+    memcpy(dst, data + position, bytes);
+    position += bytes;
+    return true;
+}
+
+const uint8_t* PrefetchVideoDataReader::acquire(uint32_t offset, uint32_t len)
+{
+    assert(len <= slotSize && "Range does not fit in a prefetch slot");
+
+    for (uint32_t i = 0; i < 2; i++)
+    {
+        if (contains(slots[i], offset, len))
+        {
+            if (transferSlot == (int32_t)i)
+            {
+                stats.waits++;
+                waitForTransfer();
+            }
+            else if (i != acquired)
+            {
+                stats.hits++;
+            }
+            acquired = i;
+            return slots[i].data + (offset - slots[i].offset);
+        }
+    }
+
+    // Not prefetched, read it into the other slot now
+    stats.misses++;
+    const uint32_t slot = 1 - acquired;
+    startTransfer(slot, offset, len);
+    waitForTransfer();
+    acquired = slot;
+    return slots[slot].data;
+}
+
+void PrefetchVideoDataReader::prefetch(uint32_t offset, uint32_t len)
+{
+    if (offset >= length)
+    {
+        return;
+    }
+    len = MIN(MIN(len, slotSize), length - offset);
+
+    for (uint32_t i = 0; i < 2; i++)
+    {
+        if (contains(slots[i], offset, len))
+        {
+            return;
+        }
+    }
+    startTransfer(1 - acquired, offset, len);
+}
+
+void PrefetchVideoDataReader::handleInterrupt()
+{
+    HAL_DMA_IRQHandler(&hdma);
+}
+
+bool PrefetchVideoDataReader::contains(const Slot& slot, uint32_t offset, uint32_t len) const
+{
+    return offset >= slot.offset && offset + len <= slot.offset + slot.length;
+}
+
+void PrefetchVideoDataReader::startTransfer(uint32_t slot, uint32_t offset, uint32_t len)
+{
+    // Only one transfer at a time, and the slot may be the target of the running one
+    waitForTransfer();
+
+    slots[slot].offset = offset;
+    slots[slot].length = len;
+    transferOffset = 0;
+    transferSlot = slot;
+    startBlock();
+}
+
+void PrefetchVideoDataReader::startBlock()
+{
+    const Slot& slot = slots[transferSlot];
+    const uint32_t block = MIN(slot.length - transferOffset, MAX_BLOCK_SIZE);
+    HAL_DMA_Start_IT(&hdma, (uint32_t)(data + slot.offset + transferOffset), (uint32_t)(slot.data + transferOffset), block);
+}
+
+void PrefetchVideoDataReader::waitForTransfer()
+{
+    if (transferSlot < 0)
+    {
+        return;
+    }
+    const Slot& slot = slots[transferSlot];
+    while (transferSlot >= 0)
+    {
+    }
+    // The CPU reads the chunk headers, drop any stale lines for the slot
+    DCacheMaintenance::invalidate(slot.data, slot.length);
+}
+
+void PrefetchVideoDataReader::transferComplete(DMA_HandleTypeDef* hdma)
+{
+    PrefetchVideoDataReader* const reader = instance;
+    const Slot& slot = reader->slots[reader->transferSlot];
+    reader->transferOffset += MIN(slot.length - reader->transferOffset, MAX_BLOCK_SIZE);
+    if (reader->transferOffset < slot.length)
+    {
+        reader->startBlock();
+    }
+    else
+    {
+        reader->transferSlot = -1;
+    }
+}
+} // namespace touchgfx
+
+extern "C" void PrefetchVideoDataReader_IRQHandler(void)
+{
+    touchgfx::PrefetchVideoDataReader* const reader = touchgfx::PrefetchVideoDataReader::getInstance();
+    if (reader != 0)
+    {
+        reader->handleInterrupt();
+    }
+}
+
+/* USER CODE END PrefetchVideoDataReader.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,196 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : PrefetchVideoDataReader.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef PREFETCHVIDEODATAREADER_HPP
+#define PREFETCHVIDEODATAREADER_HPP
+
+#include <BufferedVideoDataReader.hpp>
+#include <stdint.h>
+
+#include <stm32h7rsxx_hal.h>
+
+/* USER CODE BEGIN PrefetchVideoDataReader.hpp */
+
+namespace touchgfx
+{
+/**
+ * @class PrefetchVideoDataReader
+ *
+ * @brief VideoDataReader for memory-mapped external flash that prefetches with DMA.
+ *
+ *        The reader owns a RAM buffer split into two slots. prefetch() starts an HPDMA
+ *        memory-to-memory transfer of a range of the video into the slot that was not
+ *        acquired last, and acquire() returns a pointer into the slot holding a range,
+ *        waiting for the transfer if needed. STM32MJPEGDecoder prefetches the next frame
+ *        when it starts decoding a frame, so reading the flash overlaps the JPEG decode, and
+ *        hands the acquired pointer directly to the JPEG codec without copying it again.
+ *
+ *        A pointer returned by acquire() stays valid until the second-next call to
+ *        prefetch() or acquire() for a range that is not already in a slot.
+ *
+ *        init() must be called before use, and PrefetchVideoDataReader_IRQHandler() must be
+ *        called from the HPDMA1 channel 2 interrupt.
+ */
+class PrefetchVideoDataReader : public BufferedVideoDataReader
+{
+public:
+    /** Number of prefetched and synchronously read ranges. */
+    struct Stats
+    {
+        uint32_t hits;   ///< Acquired ranges that had been prefetched
+        uint32_t misses; ///< Acquired ranges that had to be read when acquired
+        uint32_t waits;  ///< Acquired ranges that were prefetched but still being transferred
+    };
+
+    /**
+     * @fn PrefetchVideoDataReader::PrefetchVideoDataReader(const uint8_t* data, uint32_t length, uint8_t* buffer, uint32_t bufferSize);
+     *
+     * @brief Constructor.
+     *
+     * @param data       The memory-mapped video data.
+     * @param length     The length of the video data in bytes.
+     * @param buffer     RAM buffer for the slots, 32 byte aligned.
+     * @param bufferSize Size of the buffer in bytes. Each slot, half of the buffer, must hold
+     *                   the largest frame.
+     */
+    PrefetchVideoDataReader(const uint8_t* data, uint32_t length, uint8_t* buffer, uint32_t bufferSize);
+
+    /**
+     * @fn void PrefetchVideoDataReader::init();
+     *
+     * @brief Initializes the DMA channel used for prefetching.
+     */
+    void init();
+
+    /**
+     * @fn void PrefetchVideoDataReader::setVideoData(const uint8_t* data, uint32_t length);
+     *
+     * @brief Reads another memory-mapped video, dropping the prefetched ranges.
+     *
+     * @param data   The memory-mapped video data.
+     * @param length The length of the video data in bytes.
+     */
+    void setVideoData(const uint8_t* data, uint32_t length);
+
+    virtual uint32_t getDataLength();
+
+    virtual void seek(uint32_t position);
+
+    virtual bool readData(void* dst, uint32_t bytes);
+
+    /**
+     * @fn virtual const uint8_t* PrefetchVideoDataReader::acquire(uint32_t offset, uint32_t length);
+     *
+     * @brief Gets a pointer to a range of the video data in RAM.
+     *
+     * @param offset The offset of the range in the video data.
+     * @param length The length of the range, at most getSlotSize().
+     *
+     * @return Pointer to the range.
+     */
+    virtual const uint8_t* acquire(uint32_t offset, uint32_t length);
+
+    /**
+     * @fn virtual void PrefetchVideoDataReader::prefetch(uint32_t offset, uint32_t length);
+     *
+     * @brief Starts transferring a range of the video data to RAM.
+     *
+     * @param offset The offset of the range in the video data.
+     * @param length The length of the range, clipped to getSlotSize().
+     */
+    virtual void prefetch(uint32_t offset, uint32_t length);
+
+    /**
+     * @fn virtual uint32_t PrefetchVideoDataReader::getSlotSize() const;
+     *
+     * @brief Gets the largest range that can be acquired or prefetched.
+     *
+     * @return The slot size in bytes.
+     */
+    virtual uint32_t getSlotSize() const
+    {
+        return slotSize;
+    }
+
+    /**
+     * @fn const Stats& PrefetchVideoDataReader::getStats() const;
+     *
+     * @brief Gets the prefetch statistics.
+     *
+     * @return The prefetch statistics.
+     */
+    const Stats& getStats() const
+    {
+        return stats;
+    }
+
+    /**
+     * @fn void PrefetchVideoDataReader::handleInterrupt();
+     *
+     * @brief Handles the DMA channel interrupt.
+     */
+    void handleInterrupt();
+
+    /**
+     * @fn static PrefetchVideoDataReader* PrefetchVideoDataReader::getInstance();
+     *
+     * @brief Gets the initialized reader.
+     *
+     * @return The reader init() was last called on, or 0.
+     */
+    static PrefetchVideoDataReader* getInstance()
+    {
+        return instance;
+    }
+
+private:
+    struct Slot
+    {
+        uint8_t* data;
+        uint32_t offset;
+        uint32_t length;
+    };
+
+    bool contains(const Slot& slot, uint32_t offset, uint32_t length) const;
+    void startTransfer(uint32_t slot, uint32_t offset, uint32_t length);
+    void startBlock();
+    void waitForTransfer();
+
+    static void transferComplete(DMA_HandleTypeDef* hdma);
+
+    const uint8_t* data;
+    uint32_t length;
+    uint32_t position;
+    uint32_t slotSize;
+    Slot slots[2];
+    uint32_t acquired;                 ///< Slot returned by the last acquire()
+    volatile int32_t transferSlot;     ///< Slot being transferred to, or -1
+    volatile uint32_t transferOffset;  ///< Bytes of the transfer completed
+    DMA_HandleTypeDef hdma;
+    Stats stats;
+
+    static PrefetchVideoDataReader* instance;
+};
+} // namespace touchgfx
+
+extern "C" void PrefetchVideoDataReader_IRQHandler(void);
+
+/* USER CODE END PrefetchVideoDataReader.hpp */
+
+#endif // PREFETCHVIDEODATAREADER_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,136 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : QualityGovernor.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include <QualityGovernor.hpp>
+
+/* USER CODE BEGIN QualityGovernor.cpp */
+#include <string.h>
+#include <nema_vg_context.h>
+
+#include "stm32h7rsxx_hal.h"
+
+namespace
+{
+const touchgfx::QualityGovernor::Settings SETTINGS[touchgfx::QualityGovernor::NUMBER_OF_LEVELS] =
+{
+    { true, 12, NEMA_VG_QUALITY_BETTER, 1 },
+    { true, 24, NEMA_VG_QUALITY_FASTER, 4 },
+    { false, 48, NEMA_VG_QUALITY_NON_AA, 16 }
+};
+}
+
+namespace touchgfx
+{
+QualityGovernor* QualityGovernor::instance = 0;
+
+QualityGovernor::QualityGovernor()
+    : enabled(TOUCHGFX_QUALITY_GOVERNOR != 0), level(QUALITY_HIGH), framesWithin(0), refreshPeriodUs(0), frameStartCycles(0)
+{
+    resetStats();
+}
+
+void QualityGovernor::setEnabled(bool enable)
+{
+    enabled = enable;
+    if (!enable)
+    {
+        level = QUALITY_HIGH;
+        framesWithin = 0;
+    }
+}
+
+const QualityGovernor::Settings& QualityGovernor::getSettings() const
+{
+    return SETTINGS[level];
+}
+
+const QualityGovernor::Settings& QualityGovernor::current()
+{
+    return instance != 0 ? instance->getSettings() : SETTINGS[QUALITY_HIGH];
+}
+
+uint8_t QualityGovernor::vectorQuality(float size)
+{
+    const uint8_t quality = current().vectorQuality;
+    if (instance != 0)
+    {
+        instance->stats.paths++;
+    }
+    // Faster and without anti-aliasing are both cheaper than better and maximum
+    if (size <= 0.0f || size >= (float)TOUCHGFX_VECTOR_SMALL_SIZE || (quality != NEMA_VG_QUALITY_BETTER && quality != NEMA_VG_QUALITY_MAXIMUM))
+    {
+        return quality;
+    }
+    if (instance != 0)
+    {
+        instance->stats.smallPaths++;
+    }
+    return NEMA_VG_QUALITY_FASTER;
+}
+
+void QualityGovernor::frameStarted()
+{
+    frameStartCycles = DWT->CYCCNT;
+}
+
+bool QualityGovernor::frameEnded()
+{
+    const uint32_t frameUs = (DWT->CYCCNT - frameStartCycles) / (SystemCoreClock / 1000000U);
+    stats.frames[level]++;
+    if (!enabled || refreshPeriodUs == 0)
+    {
+        return false;
+    }
+
+    if (frameUs > refreshPeriodUs * TOUCHGFX_QUALITY_GOVERNOR_BUDGET_PERCENT / 100U)
+    {
+        stats.overBudget++;
+        framesWithin = 0;
+        if (level + 1 < NUMBER_OF_LEVELS)
+        {
+            level = (Level)(level + 1);
+            stats.lowered++;
+            return true;
+        }
+    }
+    else if (frameUs < refreshPeriodUs * TOUCHGFX_QUALITY_GOVERNOR_RAISE_PERCENT / 100U && level > QUALITY_HIGH)
+    {
+        if (++framesWithin >= TOUCHGFX_QUALITY_GOVERNOR_RAISE_FRAMES)
+        {
+            framesWithin = 0;
+            level = (Level)(level - 1);
+            stats.raised++;
+            return true;
+        }
+    }
+    else
+    {
+        framesWithin = 0;
+    }
+    return false;
+}
+
+void QualityGovernor::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+} // namespace touchgfx
+
+/* USER CODE END QualityGovernor.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
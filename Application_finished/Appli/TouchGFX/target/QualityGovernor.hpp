@@ -0,0 +1,266 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : QualityGovernor.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef QUALITYGOVERNOR_HPP
+#define QUALITYGOVERNOR_HPP
+
+#include <stdint.h>
+
+/* USER CODE BEGIN QualityGovernor.hpp */
+
+/**
+ * Set to 0 to render every frame at the highest quality, see QualityGovernor.
+ */
+#ifndef TOUCHGFX_QUALITY_GOVERNOR
+#define TOUCHGFX_QUALITY_GOVERNOR 1
+#endif
+
+/**
+ * Part of the refresh period, in percent, a frame may take before the quality is lowered.
+ * Below the budget of DynamicResolution, so the cheaper settings are tried first.
+ */
+#ifndef TOUCHGFX_QUALITY_GOVERNOR_BUDGET_PERCENT
+#define TOUCHGFX_QUALITY_GOVERNOR_BUDGET_PERCENT 80
+#endif
+
+/**
+ * Part of the refresh period, in percent, frames must stay under for the quality to be
+ * raised again.
+ */
+#ifndef TOUCHGFX_QUALITY_GOVERNOR_RAISE_PERCENT
+#define TOUCHGFX_QUALITY_GOVERNOR_RAISE_PERCENT 50
+#endif
+
+/**
+ * Number of frames in a row under TOUCHGFX_QUALITY_GOVERNOR_RAISE_PERCENT before the
+ * quality is raised a level.
+ */
+#ifndef TOUCHGFX_QUALITY_GOVERNOR_RAISE_FRAMES
+#define TOUCHGFX_QUALITY_GOVERNOR_RAISE_FRAMES 60
+#endif
+
+/**
+ * Larger side, in pixels, of the bounding box on screen under which a NemaVG path or TSVG
+ * image is drawn with the faster anti-aliasing of NemaVG, see vectorQuality(). 0 to draw
+ * every path at the quality of the level.
+ */
+#ifndef TOUCHGFX_VECTOR_SMALL_SIZE
+#define TOUCHGFX_VECTOR_SMALL_SIZE 32
+#endif
+
+namespace touchgfx
+{
+/**
+ * @class QualityGovernor
+ *
+ * @brief Chooses the rendering quality of the next frame from the time of the frames.
+ *
+ *        Each level trades image quality for rendering time:
+ *        - QUALITY_HIGH: bilinear texture mapping, software texture mapping subdivided
+ *          every 12 pixels, anti-aliased NemaVG paths and full gradient ramps.
+ *        - QUALITY_MEDIUM: subdivisions of 24 pixels, the faster anti-aliasing of NemaVG
+ *          and gradient ramps interpolated every 4 entries.
+ *        - QUALITY_LOW: nearest neighbor texture mapping, subdivisions of 48 pixels,
+ *          NemaVG paths without anti-aliasing and ramps interpolated every 16 entries.
+ *
+ *        The HAL times every frame like DynamicResolution. A frame over
+ *        TOUCHGFX_QUALITY_GOVERNOR_BUDGET_PERCENT of the refresh period is close to
+ *        missing the vertical blanking, and lowers the quality a level for the next
+ *        frame. The quality is raised a level only after
+ *        TOUCHGFX_QUALITY_GOVERNOR_RAISE_FRAMES frames in a row under
+ *        TOUCHGFX_QUALITY_GOVERNOR_RAISE_PERCENT, so a frame that just fits at the lower
+ *        level does not make the quality toggle every frame.
+ *
+ *        The drawing code reads the settings of the current level with current().
+ */
+class QualityGovernor
+{
+public:
+    /** The quality levels, from the highest. */
+    enum Level
+    {
+        QUALITY_HIGH,
+        QUALITY_MEDIUM,
+        QUALITY_LOW,
+        NUMBER_OF_LEVELS
+    };
+
+    /** What is drawn at a level. */
+    struct Settings
+    {
+        bool bilinear;            ///< false to map textures nearest neighbor
+        uint16_t subDivisionSize; ///< Pixels between perspective corrections in software
+        uint8_t vectorQuality;    ///< NEMA_VG_QUALITY_* of NemaVG paths
+        uint16_t gradientStep;    ///< Gradient ramp entries between interpolated colors
+    };
+
+    /** Frames rendered since the last reset. */
+    struct Stats
+    {
+        uint32_t frames[NUMBER_OF_LEVELS]; ///< Frames rendered at each level
+        uint32_t lowered;                  ///< Times the quality was lowered
+        uint32_t raised;                   ///< Times the quality was raised
+        uint32_t overBudget;               ///< Frames over the budget
+        uint32_t smallPaths;               ///< Vector paths drawn faster for their size
+        uint32_t paths;                    ///< Vector paths given a quality by vectorQuality()
+    };
+
+    QualityGovernor();
+
+    /**
+     * @fn void QualityGovernor::setEnabled(bool enabled);
+     *
+     * @brief Enables or disables lowering the quality. Disabling it restores the highest
+     *        quality from the next frame.
+     *
+     * @param enabled true to lower the quality of frames over budget.
+     */
+    void setEnabled(bool enabled);
+
+    /**
+     * @fn bool QualityGovernor::isEnabled() const;
+     *
+     * @brief Tells if the quality is lowered under load.
+     *
+     * @return true if enabled.
+     */
+    bool isEnabled() const
+    {
+        return enabled;
+    }
+
+    /**
+     * @fn void QualityGovernor::setRefreshPeriod(uint32_t periodUs);
+     *
+     * @brief Sets the refresh period the budget is a part of. Called by the HAL with the
+     *        period measured by FramePacer.
+     *
+     * @param periodUs The refresh period in microseconds, 0 while unknown.
+     */
+    void setRefreshPeriod(uint32_t periodUs)
+    {
+        refreshPeriodUs = periodUs;
+    }
+
+    /**
+     * @fn Level QualityGovernor::getLevel() const;
+     *
+     * @brief Gets the quality of the current frame.
+     *
+     * @return The level.
+     */
+    Level getLevel() const
+    {
+        return level;
+    }
+
+    /**
+     * @fn const Settings& QualityGovernor::getSettings() const;
+     *
+     * @brief Gets the settings of the current frame.
+     *
+     * @return The settings of the level.
+     */
+    const Settings& getSettings() const;
+
+    /**
+     * @fn void QualityGovernor::frameStarted();
+     *
+     * @brief Starts timing a frame. Called by the HAL.
+     */
+    void frameStarted();
+
+    /**
+     * @fn bool QualityGovernor::frameEnded();
+     *
+     * @brief Ends timing a frame and chooses the level of the next. Called by the HAL.
+     *
+     * @return true if the level changed.
+     */
+    bool frameEnded();
+
+    /**
+     * @fn const Stats& QualityGovernor::getStats() const;
+     *
+     * @brief Gets the frames rendered since the last call to resetStats().
+     *
+     * @return The statistics.
+     */
+    const Stats& getStats() const
+    {
+        return stats;
+    }
+
+    /**
+     * @fn void QualityGovernor::resetStats();
+     *
+     * @brief Resets the statistics.
+     */
+    void resetStats();
+
+    /**
+     * @fn void QualityGovernor::registerInstance();
+     *
+     * @brief Makes this the governor read by current().
+     */
+    void registerInstance()
+    {
+        instance = this;
+    }
+
+    /**
+     * @fn static const Settings& QualityGovernor::current();
+     *
+     * @brief Gets the settings the current frame is drawn with.
+     *
+     * @return The settings of the governor of the HAL, the highest quality if none.
+     */
+    static const Settings& current();
+
+    /**
+     * @fn static uint8_t QualityGovernor::vectorQuality(float size);
+     *
+     * @brief Gets the NemaVG quality of a path or image from its size on screen.
+     *
+     *        NemaVG subdivides the curves of a path as finely whatever its size, so a small
+     *        icon or glyph costs GPU2D about as much as a large one, for detail below a
+     *        pixel. Under TOUCHGFX_VECTOR_SMALL_SIZE the faster anti-aliasing is used, as
+     *        at QUALITY_MEDIUM, unless the current level is cheaper already.
+     *
+     * @param size The larger side of the bounding box on screen in pixels, 0 if unknown.
+     *
+     * @return The NEMA_VG_QUALITY_* to draw with.
+     */
+    static uint8_t vectorQuality(float size);
+
+private:
+    bool enabled;
+    Level level;
+    uint16_t framesWithin;    ///< Frames in a row under the raise threshold
+    uint32_t refreshPeriodUs;
+    uint32_t frameStartCycles;
+    Stats stats;
+
+    static QualityGovernor* instance;
+};
+} // namespace touchgfx
+
+/* USER CODE END QualityGovernor.hpp */
+
+#endif // QUALITYGOVERNOR_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
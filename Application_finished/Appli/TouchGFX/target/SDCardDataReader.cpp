@@ -0,0 +1,427 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : SDCardDataReader.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include <SDCardDataReader.hpp>
+
+/* USER CODE BEGIN SDCardDataReader.cpp */
+#if defined(HAL_SD_MODULE_ENABLED)
+#include <DCacheMaintenance.hpp>
+#include <cassert>
+#include <string.h>
+
+#include "stm32_extmem_conf.h"
+
+namespace
+{
+// Byte address of BASE_ADDRESS on the card
+const uint32_t CARD_OFFSET = TOUCHGFX_SDCARD_START_BLOCK * touchgfx::SDCardDataReader::BLOCK_SIZE;
+
+// The SDMMC1 interrupt updates the segments and starts the queued read
+void lock()
+{
+    HAL_NVIC_DisableIRQ(SDMMC1_IRQn);
+}
+
+void unlock()
+{
+    HAL_NVIC_EnableIRQ(SDMMC1_IRQn);
+}
+} // namespace
+
+namespace touchgfx
+{
+SDCardDataReader* SDCardDataReader::instance = 0;
+
+SDCardDataReader::SDCardDataReader(uint8_t* buffer, uint32_t bufferSize, uint32_t segmentCount)
+    : segments(MIN(MAX(segmentCount, 2U), MAX_SEGMENTS)), segmentSize(0), capacity(0),
+      loading(-1), queued(-1), acquired(-1), useCount(0), lineOffset(0), lineLength(0)
+{
+    assert(((uintptr_t)buffer & 31U) == 0 && "SD card buffer must be 32 byte aligned");
+    segmentSize = (bufferSize / segments) & ~(BLOCK_SIZE - 1U);
+    assert(segmentSize > BLOCK_SIZE && "SD card buffer too small for its segments");
+    for (uint32_t i = 0; i < segments; i++)
+    {
+        segmentList[i].data = buffer + i * segmentSize;
+        segmentList[i].offset = 0;
+        segmentList[i].length = 0;
+        segmentList[i].lastUse = 0;
+        segmentList[i].state = EMPTY;
+    }
+    memset(&hsd, 0, sizeof(hsd));
+    memset(&stats, 0, sizeof(stats));
+}
+
+bool SDCardDataReader::init()
+{
+    GPIO_InitTypeDef gpio = { 0 };
+
+    __HAL_RCC_SDMMC1_CLK_ENABLE();
+    __HAL_RCC_GPIOC_CLK_ENABLE();
+    __HAL_RCC_GPIOD_CLK_ENABLE();
+
+    // PC8..PC11 D0..D3, PC12 CK, PD2 CMD of the microSD slot
+    gpio.Pin = GPIO_PIN_8 | GPIO_PIN_9 | GPIO_PIN_10 | GPIO_PIN_11 | GPIO_PIN_12;
+    gpio.Mode = GPIO_MODE_AF_PP;
+    gpio.Pull = GPIO_PULLUP;
+    gpio.Speed = GPIO_SPEED_FREQ_VERY_HIGH;
+    gpio.Alternate = GPIO_AF12_SDMMC1;
+    HAL_GPIO_Init(GPIOC, &gpio);
+    gpio.Pin = GPIO_PIN_2;
+    HAL_GPIO_Init(GPIOD, &gpio);
+
+    // 4-bit bus, from the PLL2 S kernel clock; the driver selects the bus speed below
+    hsd.Instance = SDMMC1;
+    hsd.Init.ClockEdge = SDMMC_CLOCK_EDGE_RISING;
+    hsd.Init.ClockPowerSave = SDMMC_CLOCK_POWER_SAVE_DISABLE;
+    hsd.Init.BusWide = SDMMC_BUS_WIDE_4B;
+    hsd.Init.HardwareFlowControl = SDMMC_HARDWARE_FLOW_CONTROL_ENABLE;
+    hsd.Init.ClockDiv = 2;
+    if (HAL_SD_Init(&hsd) != HAL_OK)
+    {
+        return false;
+    }
+
+    memset(&extmem_list_config[EXTMEMORY_1], 0, sizeof(extmem_list_config[EXTMEMORY_1]));
+    extmem_list_config[EXTMEMORY_1].MemType = EXTMEM_SDCARD;
+    extmem_list_config[EXTMEMORY_1].Handle = (void*)&hsd;
+    extmem_list_config[EXTMEMORY_1].SdCardObject.sdcard_public.Link = EXTMEM_DRIVER_SDCARD_LINKSD;
+    EXTMEM_DRIVER_SDCARD_InfoTypeDef info;
+    if (EXTMEM_Init(EXTMEMORY_1, HAL_RCCEx_GetPeriphCLKFreq(RCC_PERIPHCLK_SDMMC12)) != EXTMEM_OK
+        || EXTMEM_GetInfo(EXTMEMORY_1, &info) != EXTMEM_OK || info.BlockSize != BLOCK_SIZE)
+    {
+        return false;
+    }
+    const uint64_t cardSize = (uint64_t)info.BlockNbr * BLOCK_SIZE;
+    if (cardSize <= CARD_OFFSET)
+    {
+        return false;
+    }
+    capacity = (uint32_t)MIN(cardSize - CARD_OFFSET, (uint64_t)WINDOW_SIZE);
+
+    // Same priority as the DMA channels of the other readers
+    HAL_NVIC_SetPriority(SDMMC1_IRQn, 5, 0);
+    HAL_NVIC_EnableIRQ(SDMMC1_IRQn);
+
+    instance = this;
+    return true;
+}
+
+const uint8_t* SDCardDataReader::acquire(uint32_t offset, uint32_t len)
+{
+    assert(len <= getSlotSize() && "Range does not fit in an SD card segment");
+    assert(offset + len <= capacity && "Range is out of the SD card");
+
+    int32_t i = find(offset, len);
+    if (i >= 0)
+    {
+        if (segmentList[i].state == READY)
+        {
+            stats.hits++;
+        }
+        else
+        {
+            stats.waits++;
+            wait(i);
+        }
+    }
+    else
+    {
+        stats.misses++;
+        i = request(offset & ~(BLOCK_SIZE - 1U), false);
+        wait(i);
+    }
+
+    Segment& segment = segmentList[i];
+    segment.lastUse = ++useCount;
+    acquired = i;
+
+    // Sequential reads, the render task reaches the next segment soon
+    if (offset + len > segment.offset + segment.length / 2)
+    {
+        readAhead(i);
+    }
+    return segment.data + (offset - segment.offset);
+}
+
+void SDCardDataReader::prefetch(uint32_t offset, uint32_t len)
+{
+    if (offset >= capacity)
+    {
+        return;
+    }
+    len = MIN(MIN(len, getSlotSize()), capacity - offset);
+    if (find(offset, len) < 0)
+    {
+        request(offset & ~(BLOCK_SIZE - 1U), true);
+    }
+}
+
+bool SDCardDataReader::addressIsAddressable(const void* address)
+{
+    return (uintptr_t)address - BASE_ADDRESS >= WINDOW_SIZE;
+}
+
+void SDCardDataReader::copyData(const void* src, void* dst, uint32_t bytes)
+{
+    uint32_t offset = (uintptr_t)src - BASE_ADDRESS;
+    uint8_t* d = static_cast<uint8_t*>(dst);
+    while (bytes > 0)
+    {
+        const uint32_t chunk = MIN(bytes, getSlotSize());
+        memcpy(d, acquire(offset, chunk), chunk);
+        offset += chunk;
+        d += chunk;
+        bytes -= chunk;
+    }
+}
+
+void SDCardDataReader::startFlashLineRead(const void* src, uint32_t bytes)
+{
+    lineOffset = (uintptr_t)src - BASE_ADDRESS;
+    lineLength = MIN(bytes, getSlotSize());
+    prefetch(lineOffset, lineLength);
+}
+
+const uint8_t* SDCardDataReader::waitFlashReadComplete()
+{
+    return acquire(lineOffset, lineLength);
+}
+
+void SDCardDataReader::handleInterrupt()
+{
+    HAL_SD_IRQHandler(&hsd);
+}
+
+void SDCardDataReader::transferComplete(bool ok)
+{
+    if (loading < 0)
+    {
+        return;
+    }
+    Segment& segment = segmentList[loading];
+    if (ok)
+    {
+        // Drop the lines the CPU may have fetched while the IDMA wrote the segment
+        DCacheMaintenance::invalidate(segment.data, segment.length);
+        stats.kbytesRead += segment.length / 1024;
+        segment.state = READY;
+    }
+    else
+    {
+        stats.errors++;
+        segment.state = EMPTY;
+    }
+
+    loading = -1;
+    if (queued >= 0)
+    {
+        const uint32_t next = queued;
+        queued = -1;
+        start(next);
+    }
+}
+
+int32_t SDCardDataReader::find(uint32_t offset, uint32_t len) const
+{
+    for (uint32_t i = 0; i < segments; i++)
+    {
+        const Segment& segment = segmentList[i];
+        if (segment.state != EMPTY && offset >= segment.offset && offset + len <= segment.offset + segment.length)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+uint32_t SDCardDataReader::request(uint32_t offset, bool keepAcquired)
+{
+    for (;;)
+    {
+        lock();
+        // The least recently used segment which is not being read, nor still in use
+        int32_t victim = -1;
+        for (uint32_t i = 0; i < segments; i++)
+        {
+            const uint32_t state = segmentList[i].state;
+            if ((state == EMPTY || state == READY) && !(keepAcquired && (int32_t)i == acquired)
+                && (victim < 0 || segmentList[i].lastUse < segmentList[victim].lastUse))
+            {
+                victim = i;
+            }
+        }
+
+        if (victim >= 0)
+        {
+            Segment& segment = segmentList[victim];
+            segment.offset = offset;
+            segment.length = MIN(segmentSize, (capacity - offset + BLOCK_SIZE - 1U) & ~(BLOCK_SIZE - 1U));
+            segment.state = QUEUED;
+            if (loading < 0)
+            {
+                start(victim);
+            }
+            else
+            {
+                // One read waits behind the one in progress, the newest request wins
+                if (queued >= 0)
+                {
+                    segmentList[queued].state = EMPTY;
+                }
+                queued = victim;
+            }
+            unlock();
+            return victim;
+        }
+        unlock();
+
+        // Every segment is being read, wait for them
+        while (loading >= 0)
+        {
+        }
+    }
+}
+
+void SDCardDataReader::start(uint32_t i)
+{
+    Segment& segment = segmentList[i];
+    loading = i;
+    segment.state = LOADING;
+    if (HAL_SD_ReadBlocks_DMA(&hsd, segment.data, (CARD_OFFSET + segment.offset) / BLOCK_SIZE, segment.length / BLOCK_SIZE) != HAL_OK)
+    {
+        transferComplete(false);
+    }
+}
+
+void SDCardDataReader::wait(uint32_t i)
+{
+    Segment& segment = segmentList[i];
+    while (segment.state == QUEUED || segment.state == LOADING)
+    {
+    }
+    if (segment.state == READY)
+    {
+        return;
+    }
+
+    // The DMA read failed, read the segment through the driver once the card is idle
+    while (loading >= 0)
+    {
+    }
+    lock();
+    if (loading < 0 && HAL_SD_GetCardState(&hsd) == HAL_SD_CARD_TRANSFER
+        && EXTMEM_Read(EXTMEMORY_1, CARD_OFFSET + segment.offset, segment.data, segment.length) == EXTMEM_OK)
+    {
+        segment.state = READY;
+    }
+    unlock();
+    assert(segment.state == READY && "SD card read failed");
+}
+
+void SDCardDataReader::readAhead(uint32_t i)
+{
+    const uint32_t next = segmentList[i].offset + segmentList[i].length;
+    if (queued < 0 && next < capacity && find(next, BLOCK_SIZE) < 0)
+    {
+        stats.readAheads++;
+        request(next, true);
+    }
+}
+
+SDCardVideoDataReader::SDCardVideoDataReader(SDCardDataReader& sdReader, const uint8_t* video, uint32_t videoLength)
+    : reader(sdReader), base((uintptr_t)video - SDCardDataReader::BASE_ADDRESS), length(videoLength), position(0)
+{
+}
+
+uint32_t SDCardVideoDataReader::getDataLength()
+{
+    return length;
+}
+
+void SDCardVideoDataReader::seek(uint32_t pos)
+{
+    position = pos;
+}
+
+bool SDCardVideoDataReader::readData(void* dst, uint32_t bytes)
+{
+    if (position + bytes > length)
+    {
+        return false;
+    }
+    reader.copyData((const void*)(SDCardDataReader::BASE_ADDRESS + base + position), dst, bytes);
+    position += bytes;
+    return true;
+}
+
+const uint8_t* SDCardVideoDataReader::acquire(uint32_t offset, uint32_t len)
+{
+    return reader.acquire(base + offset, len);
+}
+
+void SDCardVideoDataReader::prefetch(uint32_t offset, uint32_t len)
+{
+    if (offset < length)
+    {
+        reader.prefetch(base + offset, MIN(len, length - offset));
+    }
+}
+
+uint32_t SDCardVideoDataReader::getSlotSize() const
+{
+    return reader.getSlotSize();
+}
+} // namespace touchgfx
+
+extern "C" void HAL_SD_RxCpltCallback(SD_HandleTypeDef* hsd)
+{
+    (void)hsd;
+    touchgfx::SDCardDataReader* const reader = touchgfx::SDCardDataReader::getInstance();
+    if (reader != 0)
+    {
+        reader->transferComplete(true);
+    }
+}
+
+extern "C" void HAL_SD_ErrorCallback(SD_HandleTypeDef* hsd)
+{
+    (void)hsd;
+    touchgfx::SDCardDataReader* const reader = touchgfx::SDCardDataReader::getInstance();
+    if (reader != 0)
+    {
+        reader->transferComplete(false);
+    }
+}
+
+extern "C" void SDCardDataReader_IRQHandler(void)
+{
+    touchgfx::SDCardDataReader* const reader = touchgfx::SDCardDataReader::getInstance();
+    if (reader != 0)
+    {
+        reader->handleInterrupt();
+    }
+}
+#else
+extern "C" void SDCardDataReader_IRQHandler(void)
+{
+}
+#endif // HAL_SD_MODULE_ENABLED
+
+/* USER CODE END SDCardDataReader.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,283 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : SDCardDataReader.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef SDCARDDATAREADER_HPP
+#define SDCARDDATAREADER_HPP
+
+#include <BufferedVideoDataReader.hpp>
+#include <touchgfx/hal/FlashDataReader.hpp>
+#include <stdint.h>
+
+#include <stm32h7rsxx_hal.h>
+
+/* USER CODE BEGIN SDCardDataReader.hpp */
+
+/**
+ * First block of the card holding the SDCardSection image. The image is written raw, from
+ * this block on, with no file system.
+ */
+#ifndef TOUCHGFX_SDCARD_START_BLOCK
+#define TOUCHGFX_SDCARD_START_BLOCK 0
+#endif
+
+#if defined(HAL_SD_MODULE_ENABLED)
+
+namespace touchgfx
+{
+/**
+ * @class SDCardDataReader
+ *
+ * @brief FlashDataReader for the assets linked in SDCardSection, read from the SD card on
+ *        SDMMC1 through a read-ahead cache.
+ *
+ *        The SDCARD region of the linker script is not mapped: the bitmaps, videos and
+ *        font data placed in SDCardSection get addresses from BASE_ADDRESS on, and the
+ *        section is extracted to sdcard.bin by the build and written to the card. The
+ *        reader splits its RAM buffer into segments, each holding a block aligned range
+ *        of the card. A range not in a segment is read into the least recently used one
+ *        with the IDMA of SDMMC1, and the completion interrupt starts the next queued
+ *        read, so reads overlap rendering. When a range is acquired past the middle of
+ *        its segment, the segment following it is read ahead.
+ *
+ *        The card is initialized by the SD driver of the external memory manager, which
+ *        also switches it to its fastest bus speed, and read synchronously through it
+ *        when a DMA read fails. The SAL of the manager has no asynchronous read, so the
+ *        DMA reads use the HAL SD handle it was given.
+ *
+ *        GPU2D does not read through the reader: a bitmap in SDCardSection must be put
+ *        in the bitmap cache with Bitmap::cache() before it is drawn, which copies it
+ *        with copyData(). The software renderer reads lines with startFlashLineRead().
+ *
+ *        A pointer returned by acquire() stays valid until the next call to acquire()
+ *        for a range not in a segment. The reader is used by the render task only.
+ *        init() must be called before use, and SDCardDataReader_IRQHandler() must be
+ *        called from the SDMMC1 interrupt.
+ */
+class SDCardDataReader : public FlashDataReader
+{
+public:
+    static const uint32_t BASE_ADDRESS = 0xC0000000U; ///< SDCARD region of the linker script
+    static const uint32_t WINDOW_SIZE = 0x20000000U;  ///< 512 MB, up to the system region
+    static const uint32_t BLOCK_SIZE = 512U;          ///< SD block, the unit of the reads
+    static const uint32_t MAX_SEGMENTS = 8U;
+
+    /** Number of reads since the last reset. */
+    struct Stats
+    {
+        uint32_t hits;       ///< Acquired ranges which were already read
+        uint32_t waits;      ///< Acquired ranges still being read
+        uint32_t misses;     ///< Acquired ranges read when acquired
+        uint32_t readAheads; ///< Segments read ahead of a sequential read
+        uint32_t errors;     ///< DMA reads which failed and were read again synchronously
+        uint32_t kbytesRead; ///< KB read from the card
+    };
+
+    /**
+     * @fn SDCardDataReader::SDCardDataReader(uint8_t* buffer, uint32_t bufferSize, uint32_t segments);
+     *
+     * @brief Constructor.
+     *
+     * @param buffer     RAM buffer for the segments, 32 byte aligned, in AXI SRAM or PSRAM.
+     * @param bufferSize Size of the buffer in bytes.
+     * @param segments   Number of segments, 2 to MAX_SEGMENTS. Each segment must hold the
+     *                   largest range acquired, plus a block.
+     */
+    SDCardDataReader(uint8_t* buffer, uint32_t bufferSize, uint32_t segments);
+
+    /**
+     * @fn bool SDCardDataReader::init();
+     *
+     * @brief Initializes SDMMC1 and the card.
+     *
+     * @return false if no card answers, the reader is not used then.
+     */
+    bool init();
+
+    /**
+     * @fn uint32_t SDCardDataReader::getSlotSize() const;
+     *
+     * @brief Gets the largest range that can be acquired or prefetched.
+     *
+     * @return The size in bytes.
+     */
+    uint32_t getSlotSize() const
+    {
+        return segmentSize - BLOCK_SIZE;
+    }
+
+    /**
+     * @fn const uint8_t* SDCardDataReader::acquire(uint32_t offset, uint32_t length);
+     *
+     * @brief Gets a pointer to a range of the card in RAM.
+     *
+     * @param offset The offset of the range from BASE_ADDRESS.
+     * @param length The length of the range, at most getSlotSize().
+     *
+     * @return Pointer to the range.
+     */
+    const uint8_t* acquire(uint32_t offset, uint32_t length);
+
+    /**
+     * @fn void SDCardDataReader::prefetch(uint32_t offset, uint32_t length);
+     *
+     * @brief Starts reading a range of the card, or queues it behind the read in progress.
+     *
+     * @param offset The offset of the range from BASE_ADDRESS.
+     * @param length The length of the range, clipped to getSlotSize().
+     */
+    void prefetch(uint32_t offset, uint32_t length);
+
+    virtual bool addressIsAddressable(const void* address);
+
+    virtual void copyData(const void* src, void* dst, uint32_t bytes);
+
+    virtual void startFlashLineRead(const void* src, uint32_t bytes);
+
+    virtual const uint8_t* waitFlashReadComplete();
+
+    /**
+     * @fn const Stats& SDCardDataReader::getStats() const;
+     *
+     * @brief Gets the read statistics.
+     *
+     * @return The read statistics.
+     */
+    const Stats& getStats() const
+    {
+        return stats;
+    }
+
+    /**
+     * @fn void SDCardDataReader::handleInterrupt();
+     *
+     * @brief Handles the SDMMC1 interrupt.
+     */
+    void handleInterrupt();
+
+    /**
+     * @fn void SDCardDataReader::transferComplete(bool ok);
+     *
+     * @brief Ends the DMA read in progress and starts the queued one. Called from the
+     *        SDMMC1 interrupt.
+     *
+     * @param ok false if the read failed.
+     */
+    void transferComplete(bool ok);
+
+    /**
+     * @fn static SDCardDataReader* SDCardDataReader::getInstance();
+     *
+     * @brief Gets the initialized reader.
+     *
+     * @return The reader init() last succeeded on, or 0.
+     */
+    static SDCardDataReader* getInstance()
+    {
+        return instance;
+    }
+
+private:
+    enum State
+    {
+        EMPTY,
+        QUEUED,  ///< Waiting for the read in progress
+        LOADING, ///< Being read by DMA
+        READY
+    };
+
+    struct Segment
+    {
+        uint8_t* data;
+        uint32_t offset;
+        uint32_t length;
+        uint32_t lastUse;
+        volatile uint32_t state;
+    };
+
+    int32_t find(uint32_t offset, uint32_t length) const;
+    uint32_t request(uint32_t offset, bool keepAcquired);
+    void start(uint32_t segment);
+    void wait(uint32_t segment);
+    void readAhead(uint32_t segment);
+
+    Segment segmentList[MAX_SEGMENTS];
+    uint32_t segments;
+    uint32_t segmentSize;
+    uint32_t capacity;            ///< Bytes of the card readable from BASE_ADDRESS
+    volatile int32_t loading;     ///< Segment being read by DMA, or -1
+    volatile int32_t queued;      ///< Segment read next, or -1
+    int32_t acquired;             ///< Segment returned by the last acquire()
+    uint32_t useCount;
+    uint32_t lineOffset;
+    uint32_t lineLength;
+    SD_HandleTypeDef hsd;
+    Stats stats;
+
+    static SDCardDataReader* instance;
+};
+
+/**
+ * @class SDCardVideoDataReader
+ *
+ * @brief BufferedVideoDataReader for a video linked in SDCardSection.
+ *
+ *        Frames are read through the segments of the SDCardDataReader, which must hold
+ *        the largest frame, and handed to STM32MJPEGDecoder without copying.
+ */
+class SDCardVideoDataReader : public BufferedVideoDataReader
+{
+public:
+    /**
+     * @fn SDCardVideoDataReader::SDCardVideoDataReader(SDCardDataReader& reader, const uint8_t* video, uint32_t length);
+     *
+     * @brief Constructor.
+     *
+     * @param reader The initialized SD card reader.
+     * @param video  Address of the video in SDCardSection.
+     * @param length The length of the video in bytes.
+     */
+    SDCardVideoDataReader(SDCardDataReader& reader, const uint8_t* video, uint32_t length);
+
+    virtual uint32_t getDataLength();
+
+    virtual void seek(uint32_t position);
+
+    virtual bool readData(void* dst, uint32_t bytes);
+
+    virtual const uint8_t* acquire(uint32_t offset, uint32_t length);
+
+    virtual void prefetch(uint32_t offset, uint32_t length);
+
+    virtual uint32_t getSlotSize() const;
+
+private:
+    SDCardDataReader& reader;
+    uint32_t base;
+    uint32_t length;
+    uint32_t position;
+};
+} // namespace touchgfx
+
+#endif // HAL_SD_MODULE_ENABLED
+
+extern "C" void SDCardDataReader_IRQHandler(void);
+
+/* USER CODE END SDCardDataReader.hpp */
+
+#endif // SDCARDDATAREADER_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
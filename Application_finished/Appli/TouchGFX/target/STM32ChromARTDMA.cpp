@@ -0,0 +1,1252 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : STM32ChromARTDMA.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include "stm32h7rsxx_hal.h"
+#include "stm32h7rsxx_hal_dma2d.h"
+#include "cmsis_os2.h"
+#include "rtos_pool.h"
+#include <CortexMMCUInstrumentation.hpp>
+#include <DCacheMaintenance.hpp>
+#include <STM32ChromARTDMA.hpp>
+#include <cassert>
+#include <touchgfx/Color.hpp>
+#include <touchgfx/hal/HAL.hpp>
+#include <touchgfx/hal/Paint.hpp>
+
+/* USER CODE BEGIN STM32ChromARTDMA.cpp */
+
+/* Makes touchgfx specific types and variables visible to this file */
+using namespace touchgfx;
+
+typedef struct
+{
+    const uint16_t format;
+    const uint16_t size;
+    const uint32_t* const data;
+} clutData_t;
+
+extern "C" DMA2D_HandleTypeDef hdma2d;
+
+/* The palette in the DMA2D foreground CLUT and the CLUT color mode it was loaded with. The
+ * CLUT keeps its entries between jobs, so L8 blits and painter lines with the palette loaded
+ * last do not load it again. Icons sharing a palette load it once. */
+static const clutData_t* residentClut = 0;
+static uint32_t residentClutMode = 0;
+static STM32ChromARTDMA::ClutStats clutStats = { 0, 0 };
+static STM32ChromARTDMA::ChainStats chainStats = { 0, 0 };
+
+/**
+ * @fn static void loadClut(const clutData_t* const palette, const uint32_t mode);
+ *
+ * @brief Loads a palette into the foreground CLUT unless the CLUT holds it.
+ *
+ *        The foreground CLUT address, size and color mode must be written first.
+ *
+ * @param palette The palette.
+ * @param mode    The CLUT color mode, DMA2D_CCM_ARGB8888 or DMA2D_CCM_RGB888.
+ */
+static void loadClut(const clutData_t* const palette, const uint32_t mode)
+{
+    if (palette == residentClut && mode == residentClutMode)
+    {
+        clutStats.reuses++;
+        return;
+    }
+
+    /* Enable the CLUT loading for the foreground */
+    SET_BIT(DMA2D->FGPFCCR, DMA2D_FGPFCCR_START);
+
+    residentClut = palette;
+    residentClutMode = mode;
+    clutStats.loads++;
+
+    /* Wait for load to finish */
+    while ((READ_REG(DMA2D->FGPFCCR) & DMA2D_FGPFCCR_START) != 0U);
+
+    /* Clear CLUT Transfer Complete flag */
+    DMA2D->IFCR = (DMA2D_FLAG_CTC);
+}
+
+extern "C" {
+    static void DMA2D_XferCpltCallback(DMA2D_HandleTypeDef* handle)
+    {
+        (void)handle; // Unused argument
+        HAL::getInstance()->signalDMAInterrupt();
+    }
+
+    static void DMA2D_XferErrorCallback(DMA2D_HandleTypeDef* handle)
+    {
+        (void)handle; // Unused argument
+        while (1)
+        {
+
+        }
+    }
+}
+
+STM32ChromARTDMA::STM32ChromARTDMA()
+    : DMA_Interface(dma_queue), dma_queue(queue_storage, sizeof(queue_storage) / sizeof(queue_storage[0])), started_by_external_job(false),
+      written_start(0), written_end(0), queuing_task(0), producer_mutex(0)
+{
+
+}
+
+STM32ChromARTDMA::~STM32ChromARTDMA()
+{
+    /* Disable DMA2D global Interrupt */
+    NVIC_DisableIRQ(DMA2D_IRQn);
+}
+
+void STM32ChromARTDMA::initialize()
+{
+    /* Ensure DMA2D Clock is enabled */
+    __HAL_RCC_DMA2D_CLK_ENABLE();
+    __HAL_RCC_DMA2D_FORCE_RESET();
+    __HAL_RCC_DMA2D_RELEASE_RESET();
+
+    /* The reset cleared the CLUT */
+    forgetClut();
+
+    /* Add transfer complete callback function */
+    hdma2d.XferCpltCallback = DMA2D_XferCpltCallback;
+
+    /* Add transfer error callback function */
+    hdma2d.XferErrorCallback = DMA2D_XferErrorCallback;
+
+    /* Serializes the tasks queuing BlitOps */
+    if (producer_mutex == 0)
+    {
+        producer_mutex = RTOS_POOL_MutexNew(NULL);
+    }
+
+    /* Enable DMA2D global Interrupt */
+    NVIC_EnableIRQ(DMA2D_IRQn);
+}
+
+void STM32ChromARTDMA::addToQueue(const BlitOp& op)
+{
+    const uint32_t pixels = (op.nLoops == 0) ? 0 : (uint32_t)(op.nLoops - 1) * op.dstLoopStride + op.nSteps;
+    const uint32_t bytes = CortexMMCUInstrumentation::pixelBytes((Bitmap::BitmapFormat)op.dstFormat, pixels);
+    const uintptr_t start = reinterpret_cast<uintptr_t>(op.pDst);
+
+    /* Before the scheduler runs there is only one producer */
+    const bool locked = producer_mutex != 0 && osKernelGetState() == osKernelRunning && osMutexAcquire(producer_mutex, osWaitForever) == osOK;
+
+    /* Lines the CPU wrote would be written back over the result of DMA2D when evicted */
+    DCacheMaintenance::clean(op.pDst, bytes);
+    if (written_end == 0 || start < written_start)
+    {
+        written_start = start;
+    }
+    if (start + bytes > written_end)
+    {
+        written_end = start + bytes;
+    }
+
+    /* The base class switches to hardware rendering, which calls FlushCache() */
+    queuing_task = osThreadGetId();
+    DMA_Interface::addToQueue(op);
+    queuing_task = 0;
+
+    if (locked)
+    {
+        osMutexRelease(producer_mutex);
+    }
+}
+
+void STM32ChromARTDMA::start()
+{
+    /* Tasks and the JPEG interrupt start DMA2D, which must not race its own interrupt */
+    NVIC_DisableIRQ(DMA2D_IRQn);
+    if (!queue.isEmpty() && isAllowed && !isRunning)
+    {
+        started_by_external_job = false;
+        execute();
+    }
+    else if ((Jpeg_OUT_BufferTab[JPEG_OUT_Read_BufferIndex].State == JPEG_BUFFER_FULL) && !isRunning)
+    {
+        started_by_external_job = true;
+        externalJobExecute();
+    }
+    NVIC_EnableIRQ(DMA2D_IRQn);
+}
+
+bool STM32ChromARTDMA::isQueuing() const
+{
+    return queuing_task != 0 && queuing_task == osThreadGetId();
+}
+
+void STM32ChromARTDMA::invalidateWritten()
+{
+    if (written_end != 0)
+    {
+        DCacheMaintenance::invalidate(reinterpret_cast<const void*>(written_start), written_end - written_start);
+        written_start = 0;
+        written_end = 0;
+    }
+}
+
+void STM32ChromARTDMA::forgetClut()
+{
+    residentClut = 0;
+    residentClutMode = 0;
+}
+
+const STM32ChromARTDMA::ClutStats& STM32ChromARTDMA::getClutStats()
+{
+    return clutStats;
+}
+
+void STM32ChromARTDMA::resetClutStats()
+{
+    clutStats.loads = 0;
+    clutStats.reuses = 0;
+}
+
+const STM32ChromARTDMA::ChainStats& STM32ChromARTDMA::getChainStats()
+{
+    return chainStats;
+}
+
+void STM32ChromARTDMA::resetChainStats()
+{
+    chainStats.interrupts = 0;
+    chainStats.chained = 0;
+}
+
+void STM32ChromARTDMA::chainSmallJobs()
+{
+    chainStats.interrupts++;
+    for (uint32_t jobs = 1; jobs < STM32DMA_CHAIN_MAX_JOBS && isRunning && !started_by_external_job; jobs++)
+    {
+        /* Pixels per line times lines of the job just started */
+        const uint32_t nlr = READ_REG(DMA2D->NLR);
+        const uint32_t pixels = ((nlr & DMA2D_NLR_PL) >> DMA2D_NLR_PL_Pos) * (nlr & DMA2D_NLR_NL);
+        if (pixels > STM32DMA_CHAIN_MAX_PIXELS)
+        {
+            return;
+        }
+
+        /* Wait for the job, an error is left to its interrupt */
+        while ((READ_REG(DMA2D->CR) & DMA2D_CR_START) != 0U);
+        if ((READ_REG(DMA2D->ISR) & DMA2D_FLAG_TC) == 0U)
+        {
+            return;
+        }
+        WRITE_REG(DMA2D->IFCR, DMA2D_FLAG_TC);
+        NVIC_ClearPendingIRQ(DMA2D_IRQn);
+
+        chainStats.chained++;
+        executeCompleted();
+    }
+}
+
+inline uint32_t STM32ChromARTDMA::getChromARTInputFormat(Bitmap::BitmapFormat format)
+{
+    // Default color mode set to ARGB8888
+    uint32_t dma2dColorMode = DMA2D_INPUT_ARGB8888;
+
+    switch (format)
+    {
+    case Bitmap::ARGB8888: /* DMA2D input mode set to 32bit ARGB */
+        dma2dColorMode = DMA2D_INPUT_ARGB8888;
+        break;
+    case Bitmap::RGB888: /* DMA2D input mode set to 24bit RGB */
+        dma2dColorMode = DMA2D_INPUT_RGB888;
+        break;
+    case Bitmap::RGB565: /* DMA2D input mode set to 16bit RGB */
+        dma2dColorMode = DMA2D_INPUT_RGB565;
+        break;
+    case Bitmap::ARGB2222: /* Fall through */
+    case Bitmap::ABGR2222: /* Fall through */
+    case Bitmap::RGBA2222: /* Fall through */
+    case Bitmap::BGRA2222: /* Fall through */
+    case Bitmap::L8:       /* DMA2D input mode set to 8bit Color Look up table*/
+        dma2dColorMode = DMA2D_INPUT_L8;
+        break;
+    case Bitmap::BW:     /* Fall through */
+    case Bitmap::BW_RLE: /* Fall through */
+    case Bitmap::GRAY4:  /* Fall through */
+    case Bitmap::GRAY2:  /* Fall through */
+    default:             /* Unsupported input format for DMA2D */
+        assert(0 && "Unsupported Format!");
+        break;
+    }
+
+    return dma2dColorMode;
+}
+
+inline uint32_t STM32ChromARTDMA::getChromARTOutputFormat(Bitmap::BitmapFormat format)
+{
+    // Default color mode set to ARGB8888
+    uint32_t dma2dColorMode = DMA2D_OUTPUT_ARGB8888;
+
+    switch (format)
+    {
+    case Bitmap::ARGB8888: /* DMA2D output mode set to 32bit ARGB */
+        dma2dColorMode = DMA2D_OUTPUT_ARGB8888;
+        break;
+    case Bitmap::RGB888:   /* Fall through */
+    case Bitmap::ARGB2222: /* Fall through */
+    case Bitmap::ABGR2222: /* Fall through */
+    case Bitmap::RGBA2222: /* Fall through */
+    case Bitmap::BGRA2222: /* DMA2D output mode set to 24bit RGB */
+        dma2dColorMode = DMA2D_OUTPUT_RGB888;
+        break;
+    case Bitmap::RGB565: /* DMA2D output mode set to 16bit RGB */
+        dma2dColorMode = DMA2D_OUTPUT_RGB565;
+        break;
+    case Bitmap::L8:     /* Fall through */
+    case Bitmap::BW:     /* Fall through */
+    case Bitmap::BW_RLE: /* Fall through */
+    case Bitmap::GRAY4:  /* Fall through */
+    case Bitmap::GRAY2:  /* Fall through */
+    default:             /* Unsupported output format for DMA2D */
+        assert(0 && "Unsupported Format!");
+        break;
+    }
+
+    return dma2dColorMode;
+}
+
+BlitOperations STM32ChromARTDMA::getBlitCaps()
+{
+    return static_cast<BlitOperations>(BLIT_OP_FILL
+                                       | BLIT_OP_FILL_WITH_ALPHA
+                                       | BLIT_OP_COPY
+                                       | BLIT_OP_COPY_L8
+                                       | BLIT_OP_COPY_WITH_ALPHA
+                                       | BLIT_OP_COPY_ARGB8888
+                                       | BLIT_OP_COPY_ARGB8888_WITH_ALPHA
+                                       | BLIT_OP_COPY_A4
+                                       | BLIT_OP_COPY_A8);
+}
+
+/*
+ * void STM32ChromARTDMA::setupDataCopy(const BlitOp& blitOp) handles blit operation of
+ * BLIT_OP_COPY
+ * BLIT_OP_COPY_L8
+ * BLIT_OP_COPY_WITH_ALPHA
+ * BLIT_OP_COPY_ARGB8888
+ * BLIT_OP_COPY_ARGB8888_WITH_ALPHA
+ * BLIT_OP_COPY_A4
+ * BLIT_OP_COPY_A8
+ */
+void STM32ChromARTDMA::setupDataCopy(const BlitOp& blitOp)
+{
+    uint32_t dma2dForegroundColorMode = getChromARTInputFormat(static_cast<Bitmap::BitmapFormat>(blitOp.srcFormat));
+    uint32_t dma2dBackgroundColorMode = getChromARTInputFormat(static_cast<Bitmap::BitmapFormat>(blitOp.dstFormat));
+    uint32_t dma2dOutputColorMode = getChromARTOutputFormat(static_cast<Bitmap::BitmapFormat>(blitOp.dstFormat));
+
+    /* DMA2D OOR register configuration */
+    WRITE_REG(DMA2D->OOR, blitOp.dstLoopStride - blitOp.nSteps);
+
+    /* DMA2D BGOR register configuration */
+    WRITE_REG(DMA2D->BGOR, blitOp.dstLoopStride - blitOp.nSteps);
+
+    /* DMA2D FGOR register configuration */
+    WRITE_REG(DMA2D->FGOR, blitOp.srcLoopStride - blitOp.nSteps);
+
+    /* DMA2D OPFCCR register configuration */
+    WRITE_REG(DMA2D->OPFCCR, dma2dOutputColorMode);
+
+    /* Configure DMA2D data size */
+    WRITE_REG(DMA2D->NLR, (blitOp.nLoops | (blitOp.nSteps << DMA2D_NLR_PL_Pos)));
+
+    /* Configure DMA2D destination address */
+    WRITE_REG(DMA2D->OMAR, reinterpret_cast<uint32_t>(blitOp.pDst));
+
+    /* Configure DMA2D source address */
+    WRITE_REG(DMA2D->FGMAR, reinterpret_cast<uint32_t>(blitOp.pSrc));
+
+    switch (blitOp.operation)
+    {
+    case BLIT_OP_COPY_A4:
+        /* Set DMA2D color mode and alpha mode */
+        WRITE_REG(DMA2D->FGPFCCR, DMA2D_INPUT_A4 | (DMA2D_COMBINE_ALPHA << DMA2D_FGPFCCR_AM_Pos) | (blitOp.alpha << 24));
+
+        /* set DMA2D foreground color */
+        WRITE_REG(DMA2D->FGCOLR, blitOp.color);
+
+        /* Write DMA2D BGPFCCR register */
+        WRITE_REG(DMA2D->BGPFCCR, dma2dBackgroundColorMode | (DMA2D_NO_MODIF_ALPHA << DMA2D_BGPFCCR_AM_Pos));
+
+        /* Configure DMA2D Stream source2 address */
+        WRITE_REG(DMA2D->BGMAR, reinterpret_cast<uint32_t>(blitOp.pDst));
+
+        /* Set DMA2D mode */
+        WRITE_REG(DMA2D->CR, DMA2D_M2M_BLEND | DMA2D_IT_TC | DMA2D_CR_START | DMA2D_IT_CE | DMA2D_IT_TE);
+        break;
+    case BLIT_OP_COPY_A8:
+        /* Set DMA2D color mode and alpha mode */
+        WRITE_REG(DMA2D->FGPFCCR, DMA2D_INPUT_A8 | (DMA2D_COMBINE_ALPHA << DMA2D_FGPFCCR_AM_Pos) | (blitOp.alpha << 24));
+
+        /* set DMA2D foreground color */
+        WRITE_REG(DMA2D->FGCOLR, blitOp.color);
+
+        /* Write DMA2D BGPFCCR register */
+        WRITE_REG(DMA2D->BGPFCCR, dma2dBackgroundColorMode | (DMA2D_NO_MODIF_ALPHA << DMA2D_BGPFCCR_AM_Pos));
+
+        /* Configure DMA2D Stream source2 address */
+        WRITE_REG(DMA2D->BGMAR, reinterpret_cast<uint32_t>(blitOp.pDst));
+
+        /* Set DMA2D mode */
+        WRITE_REG(DMA2D->CR, DMA2D_M2M_BLEND | DMA2D_IT_TC | DMA2D_CR_START | DMA2D_IT_CE | DMA2D_IT_TE);
+        break;
+    case BLIT_OP_COPY_WITH_ALPHA:
+        /* Set DMA2D color mode and alpha mode */
+        WRITE_REG(DMA2D->FGPFCCR, dma2dForegroundColorMode | (DMA2D_COMBINE_ALPHA << DMA2D_FGPFCCR_AM_Pos) | (blitOp.alpha << 24));
+
+        /* Write DMA2D BGPFCCR register */
+        WRITE_REG(DMA2D->BGPFCCR, dma2dBackgroundColorMode | (DMA2D_NO_MODIF_ALPHA << DMA2D_BGPFCCR_AM_Pos));
+
+        /* Configure DMA2D Stream source2 address */
+        WRITE_REG(DMA2D->BGMAR, reinterpret_cast<uint32_t>(blitOp.pDst));
+
+        /* Set DMA2D mode */
+        WRITE_REG(DMA2D->CR, DMA2D_M2M_BLEND | DMA2D_IT_TC | DMA2D_CR_START | DMA2D_IT_CE | DMA2D_IT_TE);
+        break;
+    case BLIT_OP_COPY_L8:
+        {
+            bool blend = true;
+            const clutData_t* const palette = reinterpret_cast<const clutData_t*>(blitOp.pClut);
+
+            /* Write foreground CLUT memory address */
+            WRITE_REG(DMA2D->FGCMAR, reinterpret_cast<uint32_t>(&palette->data));
+
+            /* Set DMA2D color mode and alpha mode */
+            WRITE_REG(DMA2D->FGPFCCR, dma2dForegroundColorMode | (DMA2D_COMBINE_ALPHA << DMA2D_FGPFCCR_AM_Pos) | (blitOp.alpha << 24));
+
+            /* Write DMA2D BGPFCCR register */
+            WRITE_REG(DMA2D->BGPFCCR, dma2dBackgroundColorMode | (DMA2D_NO_MODIF_ALPHA << DMA2D_BGPFCCR_AM_Pos));
+
+            /* Configure DMA2D Stream source2 address */
+            WRITE_REG(DMA2D->BGMAR, reinterpret_cast<uint32_t>(blitOp.pDst));
+
+            /* Configure CLUT */
+            uint32_t clutMode = DMA2D_CCM_ARGB8888;
+            switch ((Bitmap::ClutFormat)palette->format)
+            {
+            case Bitmap::CLUT_FORMAT_L8_ARGB8888:
+                break;
+            case Bitmap::CLUT_FORMAT_L8_RGB888:
+                if (blitOp.alpha == 255)
+                {
+                    blend = false;
+                }
+                clutMode = DMA2D_CCM_RGB888;
+                break;
+
+            case Bitmap::CLUT_FORMAT_L8_RGB565:
+            default:
+                assert(0 && "Unsupported format");
+                break;
+            }
+
+            /* Write foreground CLUT size and CLUT color mode */
+            MODIFY_REG(DMA2D->FGPFCCR, (DMA2D_FGPFCCR_CS | DMA2D_FGPFCCR_CCM), (((palette->size - 1) << DMA2D_FGPFCCR_CS_Pos) | (clutMode << DMA2D_FGPFCCR_CCM_Pos)));
+
+            /* Load the palette unless the CLUT holds it */
+            loadClut(palette, clutMode);
+
+            /* Set DMA2D mode */
+            if (blend)
+            {
+                WRITE_REG(DMA2D->CR, DMA2D_M2M_BLEND | DMA2D_IT_TC | DMA2D_CR_START | DMA2D_IT_CE | DMA2D_IT_TE);
+            }
+            else
+            {
+                WRITE_REG(DMA2D->CR, DMA2D_M2M_PFC | DMA2D_IT_TC | DMA2D_CR_START | DMA2D_IT_CE | DMA2D_IT_TE);
+            }
+        }
+        break;
+    case BLIT_OP_COPY_ARGB8888:
+    case BLIT_OP_COPY_ARGB8888_WITH_ALPHA:
+        /* Set DMA2D color mode and alpha mode */
+        WRITE_REG(DMA2D->FGPFCCR, dma2dForegroundColorMode | (DMA2D_COMBINE_ALPHA << DMA2D_FGPFCCR_AM_Pos) | (blitOp.alpha << 24));
+
+        /* Write DMA2D BGPFCCR register */
+        WRITE_REG(DMA2D->BGPFCCR, dma2dBackgroundColorMode | (DMA2D_NO_MODIF_ALPHA << DMA2D_BGPFCCR_AM_Pos));
+
+        /* Configure DMA2D Stream source2 address */
+        WRITE_REG(DMA2D->BGMAR, reinterpret_cast<uint32_t>(blitOp.pDst));
+
+        /* Set DMA2D mode */
+        WRITE_REG(DMA2D->CR, DMA2D_M2M_BLEND | DMA2D_IT_TC | DMA2D_CR_START | DMA2D_IT_CE | DMA2D_IT_TE);
+        break;
+    default: /* BLIT_OP_COPY */
+        /* Set DMA2D color mode and alpha mode */
+        WRITE_REG(DMA2D->FGPFCCR, dma2dForegroundColorMode | (DMA2D_COMBINE_ALPHA << DMA2D_FGPFCCR_AM_Pos) | (blitOp.alpha << 24));
+
+        /* Perform pixel-format-conversion (PFC) If Bitmap format is not same format as framebuffer format */
+        if (blitOp.srcFormat != blitOp.dstFormat)
+        {
+            /* Start DMA2D : PFC Mode */
+            WRITE_REG(DMA2D->CR, DMA2D_M2M_PFC | DMA2D_IT_TC | DMA2D_CR_START | DMA2D_IT_CE | DMA2D_IT_TE);
+        }
+        else
+        {
+            /* Start DMA2D : M2M Mode */
+            WRITE_REG(DMA2D->CR, DMA2D_M2M | DMA2D_IT_TC | DMA2D_CR_START | DMA2D_IT_CE | DMA2D_IT_TE);
+        }
+        break;
+    }
+}
+
+/*
+ * void STM32ChromARTDMA::setupDataFill(const BlitOp& blitOp) handles blit operation of
+ * BLIT_OP_FILL
+ * BLIT_OP_FILL_WITH_ALPHA
+ */
+void STM32ChromARTDMA::setupDataFill(const BlitOp& blitOp)
+{
+    uint32_t dma2dOutputColorMode = getChromARTOutputFormat(static_cast<Bitmap::BitmapFormat>(blitOp.dstFormat));
+
+    /* DMA2D OPFCCR register configuration */
+    WRITE_REG(DMA2D->OPFCCR, dma2dOutputColorMode);
+
+    /* Configure DMA2D data size */
+    WRITE_REG(DMA2D->NLR, (blitOp.nLoops | (blitOp.nSteps << DMA2D_NLR_PL_Pos)));
+
+    /* Configure DMA2D destination address */
+    WRITE_REG(DMA2D->OMAR, reinterpret_cast<uint32_t>(blitOp.pDst));
+
+    /* DMA2D OOR register configuration */
+    WRITE_REG(DMA2D->OOR, blitOp.dstLoopStride - blitOp.nSteps);
+
+    if (blitOp.operation == BLIT_OP_FILL_WITH_ALPHA)
+    {
+        /* DMA2D BGOR register configuration */
+        WRITE_REG(DMA2D->BGOR, blitOp.dstLoopStride - blitOp.nSteps);
+
+        /* DMA2D FGOR register configuration */
+        WRITE_REG(DMA2D->FGOR, blitOp.dstLoopStride - blitOp.nSteps);
+
+        /* Write DMA2D BGPFCCR register */
+        WRITE_REG(DMA2D->BGPFCCR, dma2dOutputColorMode | (DMA2D_NO_MODIF_ALPHA << DMA2D_BGPFCCR_AM_Pos));
+
+        /* Write DMA2D FGPFCCR register */
+        WRITE_REG(DMA2D->FGPFCCR, DMA2D_INPUT_A8 | (DMA2D_REPLACE_ALPHA << DMA2D_FGPFCCR_AM_Pos) | ((blitOp.alpha << 24) & DMA2D_FGPFCCR_ALPHA));
+
+        /* DMA2D FGCOLR register configuration */
+        WRITE_REG(DMA2D->FGCOLR, blitOp.color);
+
+        /* Configure DMA2D Stream source2 address */
+        WRITE_REG(DMA2D->BGMAR, reinterpret_cast<uint32_t>(blitOp.pDst));
+
+        /* Configure DMA2D source address */
+        WRITE_REG(DMA2D->FGMAR, reinterpret_cast<uint32_t>(blitOp.pDst));
+
+        /* Enable the Peripheral and Enable the transfer complete interrupt */
+        WRITE_REG(DMA2D->CR, (DMA2D_IT_TC | DMA2D_CR_START | DMA2D_M2M_BLEND | DMA2D_IT_CE | DMA2D_IT_TE));
+    }
+    else
+    {
+        /* Write DMA2D FGPFCCR register */
+        WRITE_REG(DMA2D->FGPFCCR, dma2dOutputColorMode | (DMA2D_NO_MODIF_ALPHA << DMA2D_FGPFCCR_AM_Pos));
+
+        /* DMA2D FGOR register configuration */
+        WRITE_REG(DMA2D->FGOR, 0);
+
+        /* Set color */
+        WRITE_REG(DMA2D->OCOLR, ((blitOp.color >> 8) & 0xF800) | ((blitOp.color >> 5) & 0x07E0) | ((blitOp.color >> 3) & 0x001F));
+
+        /* Enable the Peripheral and Enable the transfer complete interrupt */
+        WRITE_REG(DMA2D->CR, (DMA2D_IT_TC | DMA2D_CR_START | DMA2D_R2M | DMA2D_IT_CE | DMA2D_IT_TE));
+    }
+}
+
+namespace touchgfx
+{
+namespace paint
+{
+namespace
+{
+const clutData_t* L8CLUT = 0;
+uint32_t L8ClutLoaded = 0;
+
+/* Spans shorter than this are blended by the CPU. Setting up and starting DMA2D costs
+ * more than blending a few pixels, and the anti-aliased edges of CanvasWidget shapes
+ * consist mostly of short spans. Set to 0 to always use DMA2D. */
+#ifndef PAINT_DMA2D_MIN_PIXELS
+#define PAINT_DMA2D_MIN_PIXELS 16
+#endif
+
+/**
+ * @fn void waitForDMA2D();
+ *
+ * @brief Waits for the last DMA2D job, which may be writing the same pixels, to finish.
+ */
+inline void waitForDMA2D()
+{
+    while ((READ_REG(DMA2D->CR) & DMA2D_CR_START) != 0U);
+}
+
+/**
+ * @fn uint16_t blendToRGB565(const uint32_t color, const uint16_t bufpix, const uint8_t alpha);
+ *
+ * @brief Blends a 0x00RRGGBB color onto an RGB565 pixel.
+ *
+ *        Red and blue are blended in the two halfwords of one register, so two
+ *        multiplications blend all three channels. Rounds like the software painters.
+ */
+inline uint16_t blendToRGB565(const uint32_t color, const uint16_t bufpix, const uint8_t alpha)
+{
+    const uint8_t ialpha = 0xFF - alpha;
+    const uint32_t bufRB = (Color::getRedFromRGB565(bufpix) << 16) | Color::getBlueFromRGB565(bufpix);
+    const uint32_t rb = LCD::div255rb((color & 0xFF00FF) * alpha + bufRB * ialpha);
+    const uint8_t g = LCD::div255(((color >> 8) & 0xFF) * alpha + Color::getGreenFromRGB565(bufpix) * ialpha);
+    return ((rb >> 8) & 0xF800) | ((g << 3) & 0x07E0) | ((rb & 0xFF) >> 3);
+}
+
+/**
+ * @fn void paintToRGB565(uint16_t* framebuffer, const uint32_t color, const uint8_t alpha);
+ *
+ * @brief Paints a 0xAARRGGBB color with the given extra alpha onto an RGB565 pixel.
+ */
+inline void paintToRGB565(uint16_t* framebuffer, const uint32_t color, const uint8_t alpha)
+{
+    const uint8_t a = LCD::div255(alpha * (color >> 24));
+    if (a == 0xFF)
+    {
+        *framebuffer = ((color >> 8) & 0xF800) | ((color >> 5) & 0x07E0) | ((color >> 3) & 0x001F);
+    }
+    else if (a)
+    {
+        *framebuffer = blendToRGB565(color, *framebuffer, a);
+    }
+}
+} // namespace
+
+void setL8Palette(const uint8_t* const data)
+{
+    L8CLUT = reinterpret_cast<const clutData_t*>(data - offsetof(clutData_t, data));
+    L8ClutLoaded = 0;
+}
+
+/**
+ * @fn void tearDown();
+ *
+ * @brief Waits until previous DMA drawing operation has finished
+ */
+void tearDown()
+{
+    /* Wait for DMA2D to finish last run */
+    while ((READ_REG(DMA2D->CR) & DMA2D_CR_START) != 0U);
+
+    /* Clear transfer flags */
+    WRITE_REG(DMA2D->IFCR, DMA2D_FLAG_TC | DMA2D_FLAG_CE | DMA2D_FLAG_TE);
+}
+
+/** Flushes a line of pixels in the data cache if used.
+ *
+ * @brief Flushes decoded RGB pixels when rendering compressed images
+ */
+void flushLine(uint32_t* addr, int sizebytes)
+{
+    // This funciton is used when decompressing RGB images to flush
+    // the currently decoded pixels in the cache to allow the DMA2D
+    // to blend the pixels correcly.
+    if (SCB->CCR & SCB_CCR_DC_Msk)
+    {
+        SCB_CleanDCache_by_Addr(addr, sizebytes);
+    }
+}
+
+namespace rgb565
+{
+/**
+ * @fn void lineFromColor();
+ *
+ * @brief Renders Canvas Widget chunks using DMA.
+ * This functions will not generate an interrupt, and will not affect the DMA queue.
+ */
+void lineFromColor(uint16_t* const ptr, const unsigned count, const uint32_t color, const uint8_t alpha, const uint32_t color565)
+{
+    /* Wait for DMA2D to finish last run */
+    while ((READ_REG(DMA2D->CR) & DMA2D_CR_START) != 0U);
+
+    /* Clear transfer flags */
+    WRITE_REG(DMA2D->IFCR, DMA2D_FLAG_TC | DMA2D_FLAG_CE | DMA2D_FLAG_TE);
+
+    /* DMA2D OPFCCR register configuration */
+    WRITE_REG(DMA2D->OPFCCR, DMA2D_OUTPUT_RGB565);
+
+    /* Configure DMA2D data size */
+    WRITE_REG(DMA2D->NLR, (1 | (count << DMA2D_NLR_PL_Pos)));
+
+    /* Configure DMA2D destination address */
+    WRITE_REG(DMA2D->OMAR, reinterpret_cast<uint32_t>(ptr));
+
+    if (alpha < 0xFF)
+    {
+        /* Write DMA2D BGPFCCR register */
+        WRITE_REG(DMA2D->BGPFCCR, DMA2D_OUTPUT_RGB565 | (DMA2D_NO_MODIF_ALPHA << DMA2D_BGPFCCR_AM_Pos));
+
+        /* Write DMA2D FGPFCCR register */
+        WRITE_REG(DMA2D->FGPFCCR, DMA2D_INPUT_A8 | (DMA2D_REPLACE_ALPHA << DMA2D_FGPFCCR_AM_Pos) | (alpha << DMA2D_FGPFCCR_ALPHA_Pos));
+
+        /* DMA2D FGCOLR register configuration */
+        WRITE_REG(DMA2D->FGCOLR, color);
+
+        /* Configure DMA2D Stream source2 address */
+        WRITE_REG(DMA2D->BGMAR, (uint32_t)ptr);
+
+        /* Configure DMA2D source address */
+        WRITE_REG(DMA2D->FGMAR, (uint32_t)ptr);
+
+        /* Enable the Peripheral and Enable the transfer complete interrupt */
+        WRITE_REG(DMA2D->CR, (DMA2D_CR_START | DMA2D_M2M_BLEND));
+    }
+    else
+    {
+        /* Write DMA2D FGPFCCR register */
+        WRITE_REG(DMA2D->FGPFCCR, DMA2D_OUTPUT_RGB565 | (DMA2D_NO_MODIF_ALPHA << DMA2D_FGPFCCR_AM_Pos));
+
+        /* Set color */
+        WRITE_REG(DMA2D->OCOLR, color565);
+
+        /* Enable the Peripheral and Enable the transfer complete interrupt */
+        WRITE_REG(DMA2D->CR, (DMA2D_CR_START | DMA2D_R2M));
+    }
+}
+
+void lineFromRGB565(uint16_t* const ptr, const uint16_t* const data, const unsigned count, const uint8_t alpha)
+{
+    /* Wait for DMA2D to finish last run */
+    while ((READ_REG(DMA2D->CR) & DMA2D_CR_START) != 0U);
+
+    /* Clear transfer flags */
+    WRITE_REG(DMA2D->IFCR, DMA2D_FLAG_TC | DMA2D_FLAG_CE | DMA2D_FLAG_TE);
+
+    /* DMA2D OPFCCR register configuration */
+    WRITE_REG(DMA2D->OPFCCR, DMA2D_OUTPUT_RGB565);
+
+    /* Configure DMA2D data size */
+    WRITE_REG(DMA2D->NLR, (1 | (count << DMA2D_NLR_PL_Pos)));
+
+    /* Configure DMA2D destination address */
+    WRITE_REG(DMA2D->OMAR, reinterpret_cast<uint32_t>(ptr));
+
+    /* Configure DMA2D source address */
+    WRITE_REG(DMA2D->FGMAR, reinterpret_cast<uint32_t>(data));
+
+    if (alpha < 0xFF)
+    {
+        /* Set DMA2D color mode and alpha mode */
+        WRITE_REG(DMA2D->FGPFCCR, DMA2D_INPUT_RGB565 | (DMA2D_COMBINE_ALPHA << DMA2D_FGPFCCR_AM_Pos) | (alpha << DMA2D_FGPFCCR_ALPHA_Pos));
+
+        /* Write DMA2D BGPFCCR register */
+        WRITE_REG(DMA2D->BGPFCCR, DMA2D_INPUT_RGB565 | (DMA2D_NO_MODIF_ALPHA << DMA2D_BGPFCCR_AM_Pos));
+
+        /* Configure DMA2D Stream source2 address */
+        WRITE_REG(DMA2D->BGMAR, reinterpret_cast<uint32_t>(ptr));
+
+        /* Set DMA2D mode */
+        WRITE_REG(DMA2D->CR, DMA2D_M2M_BLEND | DMA2D_CR_START);
+    }
+    else
+    {
+        /* Set DMA2D color mode and alpha mode */
+        WRITE_REG(DMA2D->FGPFCCR, DMA2D_INPUT_RGB565 | (DMA2D_COMBINE_ALPHA << DMA2D_FGPFCCR_AM_Pos) | (alpha << DMA2D_FGPFCCR_ALPHA_Pos));
+
+        /* Start DMA2D : M2M Mode */
+        WRITE_REG(DMA2D->CR, DMA2D_M2M | DMA2D_CR_START);
+    }
+}
+
+void lineFromARGB8888(uint16_t* const ptr, const uint32_t* const data, const unsigned count, const uint8_t alpha)
+{
+    if (count < PAINT_DMA2D_MIN_PIXELS)
+    {
+        waitForDMA2D();
+        for (unsigned i = 0; i < count; i++)
+        {
+            paintToRGB565(ptr + i, data[i], alpha);
+        }
+        return;
+    }
+
+    /* Wait for DMA2D to finish last run */
+    while ((READ_REG(DMA2D->CR) & DMA2D_CR_START) != 0U);
+
+    /* Clear transfer flags */
+    WRITE_REG(DMA2D->IFCR, DMA2D_FLAG_TC | DMA2D_FLAG_CE | DMA2D_FLAG_TE);
+
+    /* DMA2D OPFCCR register configuration */
+    WRITE_REG(DMA2D->OPFCCR, DMA2D_OUTPUT_RGB565);
+
+    /* Configure DMA2D data size */
+    WRITE_REG(DMA2D->NLR, (1 | (count << DMA2D_NLR_PL_Pos)));
+
+    /* Configure DMA2D destination address */
+    WRITE_REG(DMA2D->OMAR, reinterpret_cast<uint32_t>(ptr));
+
+    /* Configure DMA2D source address */
+    WRITE_REG(DMA2D->FGMAR, reinterpret_cast<uint32_t>(data));
+
+    /* Set DMA2D color mode and alpha mode */
+    WRITE_REG(DMA2D->FGPFCCR, DMA2D_INPUT_ARGB8888 | (DMA2D_COMBINE_ALPHA << DMA2D_BGPFCCR_AM_Pos) | (alpha << DMA2D_FGPFCCR_ALPHA_Pos));
+
+    /* Write DMA2D BGPFCCR register */
+    WRITE_REG(DMA2D->BGPFCCR, DMA2D_INPUT_RGB565 | (DMA2D_NO_MODIF_ALPHA << DMA2D_BGPFCCR_AM_Pos));
+
+    /* Configure DMA2D Stream source2 address */
+    WRITE_REG(DMA2D->BGMAR, reinterpret_cast<uint32_t>(ptr));
+
+    /* Set DMA2D mode */
+    WRITE_REG(DMA2D->CR, DMA2D_M2M_BLEND | DMA2D_CR_START);
+}
+
+void lineFromL8RGB888(uint16_t* const ptr, const uint8_t* const data, const unsigned count, const uint8_t alpha)
+{
+    if (count < PAINT_DMA2D_MIN_PIXELS)
+    {
+        const uint8_t* const clut = reinterpret_cast<const uint8_t*>(&L8CLUT->data);
+        waitForDMA2D();
+        for (unsigned i = 0; i < count; i++)
+        {
+            const uint8_t* const entry = clut + data[i] * 3;
+            paintToRGB565(ptr + i, 0xFF000000 | (entry[2] << 16) | (entry[1] << 8) | entry[0], alpha);
+        }
+        return;
+    }
+
+    /* wait for DMA2D to finish last run */
+    while ((READ_REG(DMA2D->CR) & DMA2D_CR_START) != 0U);
+
+    /* DMA2D OPFCCR register configuration */
+    WRITE_REG(DMA2D->OPFCCR, DMA2D_OUTPUT_RGB565);
+
+    /* Configure DMA2D data size */
+    WRITE_REG(DMA2D->NLR, (1 | (count << DMA2D_NLR_PL_Pos)));
+
+    /* Configure DMA2D destination address */
+    WRITE_REG(DMA2D->OMAR, reinterpret_cast<uint32_t>(ptr));
+
+    /* Configure DMA2D source address */
+    WRITE_REG(DMA2D->FGMAR, reinterpret_cast<uint32_t>(data));
+
+    /* Configure DMA2D Stream source2 address */
+    WRITE_REG(DMA2D->BGMAR, reinterpret_cast<uint32_t>(ptr));
+
+    /* Load CLUT if not already loaded */
+    if (L8ClutLoaded == 0)
+    {
+        /* Write foreground CLUT memory address */
+        WRITE_REG(DMA2D->FGCMAR, reinterpret_cast<uint32_t>(&L8CLUT->data));
+
+        /* Set DMA2D color mode and alpha mode */
+        WRITE_REG(DMA2D->FGPFCCR, DMA2D_INPUT_L8 | (DMA2D_COMBINE_ALPHA << DMA2D_BGPFCCR_AM_Pos) | (alpha << DMA2D_FGPFCCR_ALPHA_Pos));
+
+        MODIFY_REG(DMA2D->FGPFCCR, (DMA2D_FGPFCCR_CS | DMA2D_FGPFCCR_CCM), (((L8CLUT->size - 1) << DMA2D_FGPFCCR_CS_Pos) | (DMA2D_CCM_RGB888 << DMA2D_FGPFCCR_CCM_Pos)));
+
+        /* Write DMA2D BGPFCCR register */
+        WRITE_REG(DMA2D->BGPFCCR, DMA2D_INPUT_RGB565 | (DMA2D_NO_MODIF_ALPHA << DMA2D_BGPFCCR_AM_Pos));
+
+        /* Mark CLUT loaded */
+        L8ClutLoaded = 1;
+
+        /* Load the palette unless the CLUT holds it */
+        loadClut(L8CLUT, DMA2D_CCM_RGB888);
+    }
+    else
+    {
+        /* Set correct alpha for these pixels */
+        MODIFY_REG(DMA2D->FGPFCCR, DMA2D_BGPFCCR_ALPHA_Msk, alpha << DMA2D_FGPFCCR_ALPHA_Pos);
+    }
+
+    /* Start pixel transfer in correct mode */
+    if (alpha < 0xFF)
+    {
+        /* Set DMA2D mode */
+        WRITE_REG(DMA2D->CR, DMA2D_M2M_BLEND | DMA2D_CR_START);
+    }
+    else
+    {
+        /* Set DMA2D mode */
+        WRITE_REG(DMA2D->CR, DMA2D_M2M_PFC | DMA2D_CR_START);
+    }
+}
+
+void lineFromL8ARGB8888(uint16_t* const ptr, const uint8_t* const data, const unsigned count, const uint8_t alpha)
+{
+    if (count < PAINT_DMA2D_MIN_PIXELS)
+    {
+        const uint32_t* const clut = reinterpret_cast<const uint32_t*>(&L8CLUT->data);
+        waitForDMA2D();
+        for (unsigned i = 0; i < count; i++)
+        {
+            paintToRGB565(ptr + i, clut[data[i]], alpha);
+        }
+        return;
+    }
+
+    /* wait for DMA2D to finish last run */
+    while ((READ_REG(DMA2D->CR) & DMA2D_CR_START) != 0U);
+
+    /* DMA2D OPFCCR register configuration */
+    WRITE_REG(DMA2D->OPFCCR, DMA2D_OUTPUT_RGB565);
+
+    /* Configure DMA2D data size */
+    WRITE_REG(DMA2D->NLR, (1 | (count << DMA2D_NLR_PL_Pos)));
+
+    /* Configure DMA2D destination address */
+    WRITE_REG(DMA2D->OMAR, reinterpret_cast<uint32_t>(ptr));
+
+    /* Configure DMA2D source address */
+    WRITE_REG(DMA2D->FGMAR, reinterpret_cast<uint32_t>(data));
+
+    /* Configure DMA2D Stream source2 address */
+    WRITE_REG(DMA2D->BGMAR, reinterpret_cast<uint32_t>(ptr));
+
+    /* Load CLUT if not already loaded */
+    if (L8ClutLoaded == 0)
+    {
+        /* Write foreground CLUT memory address */
+        WRITE_REG(DMA2D->FGCMAR, reinterpret_cast<uint32_t>(&L8CLUT->data));
+
+        /* Set DMA2D color mode and alpha mode */
+        WRITE_REG(DMA2D->FGPFCCR, DMA2D_INPUT_L8 | (DMA2D_COMBINE_ALPHA << DMA2D_BGPFCCR_AM_Pos) | (alpha << DMA2D_FGPFCCR_ALPHA_Pos));
+
+        MODIFY_REG(DMA2D->FGPFCCR, (DMA2D_FGPFCCR_CS | DMA2D_FGPFCCR_CCM), (((L8CLUT->size - 1) << DMA2D_FGPFCCR_CS_Pos) | (DMA2D_CCM_ARGB8888 << DMA2D_FGPFCCR_CCM_Pos)));
+
+        /* Write DMA2D BGPFCCR register */
+        WRITE_REG(DMA2D->BGPFCCR, DMA2D_INPUT_RGB565 | (DMA2D_NO_MODIF_ALPHA << DMA2D_BGPFCCR_AM_Pos));
+
+        /* Mark CLUT loaded */
+        L8ClutLoaded = 1;
+
+        /* Load the palette unless the CLUT holds it */
+        loadClut(L8CLUT, DMA2D_CCM_ARGB8888);
+    }
+    else
+    {
+        /* Set correct alpha for these pixels */
+        MODIFY_REG(DMA2D->FGPFCCR, DMA2D_BGPFCCR_ALPHA_Msk, alpha << DMA2D_FGPFCCR_ALPHA_Pos);
+    }
+
+    /* Start pixel transfer in blending mode */
+    WRITE_REG(DMA2D->CR, DMA2D_M2M_BLEND | DMA2D_CR_START);
+}
+
+} // namespace rgb565
+
+namespace argb8888
+{
+/**
+ * @fn void lineFromColor();
+ *
+ * @brief Renders Canvas Widget chunks using DMA.
+ * This function will not generate an interrupt, and will not affect the DMA queue.
+ */
+void lineFromColor(uint32_t* const ptr, const int16_t count, const uint32_t painterColor, const uint8_t alpha)
+{
+    /* Wait for DMA2D to finish last run */
+    while ((READ_REG(DMA2D->CR) & DMA2D_CR_START) != 0U);
+
+    /* Clear transfer flags */
+    WRITE_REG(DMA2D->IFCR, DMA2D_FLAG_TC | DMA2D_FLAG_CE | DMA2D_FLAG_TE);
+
+    /* DMA2D OPFCCR register configuration (set output image color format) */
+    WRITE_REG(DMA2D->OPFCCR, DMA2D_OUTPUT_ARGB8888);
+
+    /* Configure DMA2D data size (pixels per line (PL)) */
+    WRITE_REG(DMA2D->NLR, (1 | (count << DMA2D_NLR_PL_Pos)));
+
+    /* Configure DMA2D destination address */
+    WRITE_REG(DMA2D->OMAR, reinterpret_cast<uint32_t>(ptr));
+
+    if (alpha < 0xFF)
+    {
+        /* Write DMA2D BGPFCCR (background control) register */
+        WRITE_REG(DMA2D->BGPFCCR, DMA2D_OUTPUT_ARGB8888 | (DMA2D_NO_MODIF_ALPHA << DMA2D_BGPFCCR_AM_Pos));
+
+        /* Write DMA2D FGPFCCR (foreground control) register */
+        WRITE_REG(DMA2D->FGPFCCR, DMA2D_INPUT_A8 | (DMA2D_REPLACE_ALPHA << DMA2D_FGPFCCR_AM_Pos) | (alpha << DMA2D_FGPFCCR_ALPHA_Pos));
+
+        /* DMA2D FGCOLR register configuration */
+        WRITE_REG(DMA2D->FGCOLR, painterColor & (DMA2D_FGCOLR_BLUE | DMA2D_FGCOLR_GREEN | DMA2D_FGCOLR_RED));
+
+        /* Configure DMA2D Stream source2 address */
+        WRITE_REG(DMA2D->BGMAR, (uint32_t)ptr);
+
+        /* Configure DMA2D source address */
+        WRITE_REG(DMA2D->FGMAR, (uint32_t)ptr);
+
+        /* Enable the Peripheral and Enable the transfer complete interrupt */
+        WRITE_REG(DMA2D->CR, (DMA2D_CR_START | DMA2D_M2M_BLEND));
+    }
+    else
+    {
+        /* Write DMA2D FGPFCCR register */
+        WRITE_REG(DMA2D->FGPFCCR, DMA2D_OUTPUT_ARGB8888 | (DMA2D_NO_MODIF_ALPHA << DMA2D_FGPFCCR_AM_Pos));
+
+        /* Set Output Color */
+        WRITE_REG(DMA2D->OCOLR, painterColor);
+
+        /* Start DMA2D */
+        WRITE_REG(DMA2D->CR, (DMA2D_CR_START | DMA2D_R2M));
+    }
+}
+
+void lineFromRGB888(uint8_t* const ptr, const uint8_t* const data, const int16_t length, const uint8_t alpha)
+{
+    /* Wait for DMA2D to finish last run */
+    while ((READ_REG(DMA2D->CR) & DMA2D_CR_START) != 0U);
+
+    /* Clear transfer flags */
+    WRITE_REG(DMA2D->IFCR, DMA2D_FLAG_TC | DMA2D_FLAG_CE | DMA2D_FLAG_TE);
+
+    /* DMA2D OPFCCR register configuration */
+    WRITE_REG(DMA2D->OPFCCR, DMA2D_OUTPUT_ARGB8888);
+
+    /* Configure DMA2D data size */
+    WRITE_REG(DMA2D->NLR, (1 | (length << DMA2D_NLR_PL_Pos)));
+
+    /* Configure DMA2D destination address */
+    WRITE_REG(DMA2D->OMAR, reinterpret_cast<uint32_t>(ptr));
+
+    /* Configure DMA2D source address */
+    WRITE_REG(DMA2D->FGMAR, reinterpret_cast<uint32_t>(data));
+
+    if (alpha < 0xFF)
+    {
+        /* Set DMA2D color mode and alpha mode */
+        WRITE_REG(DMA2D->FGPFCCR, DMA2D_INPUT_RGB888 | (DMA2D_COMBINE_ALPHA << DMA2D_FGPFCCR_AM_Pos) | (alpha << DMA2D_FGPFCCR_ALPHA_Pos));
+
+        /* Write DMA2D BGPFCCR register */
+        WRITE_REG(DMA2D->BGPFCCR, DMA2D_INPUT_ARGB8888 | (DMA2D_NO_MODIF_ALPHA << DMA2D_BGPFCCR_AM_Pos));
+
+        /* Configure DMA2D Stream source2 address */
+        WRITE_REG(DMA2D->BGMAR, reinterpret_cast<uint32_t>(ptr));
+
+        /* Set DMA2D mode */
+        WRITE_REG(DMA2D->CR, DMA2D_M2M_BLEND | DMA2D_CR_START);
+    }
+    else
+    {
+        /* Set DMA2D color mode and alpha mode */
+        WRITE_REG(DMA2D->FGPFCCR, DMA2D_INPUT_RGB888 | (DMA2D_NO_MODIF_ALPHA << DMA2D_FGPFCCR_AM_Pos));
+
+        /* Start DMA2D : M2M Mode */
+        WRITE_REG(DMA2D->CR, DMA2D_M2M_BLEND | DMA2D_CR_START);
+    }
+}
+
+void lineFromRGB565(uint8_t* const ptr, const uint16_t* const data, const int16_t length, const uint8_t alpha)
+{
+    /* Wait for DMA2D to finish last run */
+    while ((READ_REG(DMA2D->CR) & DMA2D_CR_START) != 0U);
+
+    /* Clear transfer flags */
+    WRITE_REG(DMA2D->IFCR, DMA2D_FLAG_TC | DMA2D_FLAG_CE | DMA2D_FLAG_TE);
+
+    /* DMA2D OPFCCR register configuration */
+    WRITE_REG(DMA2D->OPFCCR, DMA2D_OUTPUT_ARGB8888);
+
+    /* Configure DMA2D data size */
+    WRITE_REG(DMA2D->NLR, (1 | (length << DMA2D_NLR_PL_Pos)));
+
+    /* Configure DMA2D destination address */
+    WRITE_REG(DMA2D->OMAR, reinterpret_cast<uint32_t>(ptr));
+
+    /* Configure DMA2D source address */
+    WRITE_REG(DMA2D->FGMAR, reinterpret_cast<uint32_t>(data));
+
+    if (alpha < 0xFF)
+    {
+        /* Set DMA2D color mode and alpha mode */
+        WRITE_REG(DMA2D->FGPFCCR, DMA2D_INPUT_RGB565 | (DMA2D_COMBINE_ALPHA << DMA2D_FGPFCCR_AM_Pos) | (alpha << DMA2D_FGPFCCR_ALPHA_Pos));
+
+        /* Write DMA2D BGPFCCR register */
+        WRITE_REG(DMA2D->BGPFCCR, DMA2D_INPUT_ARGB8888 | (DMA2D_NO_MODIF_ALPHA << DMA2D_BGPFCCR_AM_Pos));
+
+        /* Configure DMA2D Stream source2 address */
+        WRITE_REG(DMA2D->BGMAR, reinterpret_cast<uint32_t>(ptr));
+
+        /* Set DMA2D mode */
+        WRITE_REG(DMA2D->CR, DMA2D_M2M_BLEND | DMA2D_CR_START);
+    }
+    else
+    {
+        /* Set DMA2D color mode and alpha mode */
+        WRITE_REG(DMA2D->FGPFCCR, DMA2D_INPUT_RGB565 | (DMA2D_NO_MODIF_ALPHA << DMA2D_FGPFCCR_AM_Pos));
+
+        /* Start DMA2D : M2M Mode */
+        WRITE_REG(DMA2D->CR, DMA2D_M2M_BLEND | DMA2D_CR_START);
+    }
+}
+
+void lineFromARGB8888(uint8_t* const ptr, const uint32_t* const data, const int16_t length, const uint8_t alpha)
+{
+    /* Wait for DMA2D to finish last run */
+    while ((READ_REG(DMA2D->CR) & DMA2D_CR_START) != 0U);
+
+    /* Clear transfer flags */
+    WRITE_REG(DMA2D->IFCR, DMA2D_FLAG_TC | DMA2D_FLAG_CE | DMA2D_FLAG_TE);
+
+    /* DMA2D OPFCCR register configuration */
+    WRITE_REG(DMA2D->OPFCCR, DMA2D_OUTPUT_ARGB8888);
+
+    /* Configure DMA2D data size */
+    WRITE_REG(DMA2D->NLR, (1 | (length << DMA2D_NLR_PL_Pos)));
+
+    /* Configure DMA2D destination address */
+    WRITE_REG(DMA2D->OMAR, reinterpret_cast<uint32_t>(ptr));
+
+    /* Configure DMA2D source address */
+    WRITE_REG(DMA2D->FGMAR, reinterpret_cast<uint32_t>(data));
+
+    if (alpha < 0xFF)
+    {
+        /* Set DMA2D color mode and alpha mode */
+        WRITE_REG(DMA2D->FGPFCCR, DMA2D_INPUT_ARGB8888 | (DMA2D_COMBINE_ALPHA << DMA2D_FGPFCCR_AM_Pos) | (alpha << DMA2D_FGPFCCR_ALPHA_Pos));
+    }
+    else
+    {
+        /* Set DMA2D color mode and alpha mode */
+        WRITE_REG(DMA2D->FGPFCCR, DMA2D_INPUT_ARGB8888 | (DMA2D_NO_MODIF_ALPHA << DMA2D_FGPFCCR_AM_Pos));
+    }
+
+    /* Write DMA2D BGPFCCR register */
+    WRITE_REG(DMA2D->BGPFCCR, DMA2D_INPUT_ARGB8888 | (DMA2D_NO_MODIF_ALPHA << DMA2D_BGPFCCR_AM_Pos));
+
+    /* Configure DMA2D Stream source2 address */
+    WRITE_REG(DMA2D->BGMAR, reinterpret_cast<uint32_t>(ptr));
+
+    /* Start DMA2D */
+    WRITE_REG(DMA2D->CR, DMA2D_M2M_BLEND | DMA2D_CR_START);
+}
+
+void lineFromL8RGB888(uint8_t* const ptr, const uint8_t* const data, const int16_t length, const uint8_t alpha)
+{
+    /* wait for DMA2D to finish last run */
+    while ((READ_REG(DMA2D->CR) & DMA2D_CR_START) != 0U);
+
+    /* DMA2D OPFCCR register configuration */
+    WRITE_REG(DMA2D->OPFCCR, DMA2D_OUTPUT_ARGB8888);
+
+    /* Configure DMA2D data size */
+    WRITE_REG(DMA2D->NLR, (1 | (length << DMA2D_NLR_PL_Pos)));
+
+    /* Configure DMA2D destination address */
+    WRITE_REG(DMA2D->OMAR, reinterpret_cast<uint32_t>(ptr));
+
+    /* Configure DMA2D source address */
+    WRITE_REG(DMA2D->FGMAR, reinterpret_cast<uint32_t>(data));
+
+    /* Configure DMA2D Stream source2 address */
+    WRITE_REG(DMA2D->BGMAR, reinterpret_cast<uint32_t>(ptr));
+
+    /* Load CLUT if not already loaded */
+    if (L8ClutLoaded == 0)
+    {
+        /* Write foreground CLUT memory address */
+        WRITE_REG(DMA2D->FGCMAR, reinterpret_cast<uint32_t>(&L8CLUT->data));
+
+        /* Set DMA2D color mode and alpha mode */
+        WRITE_REG(DMA2D->FGPFCCR, DMA2D_INPUT_L8 | (DMA2D_COMBINE_ALPHA << DMA2D_BGPFCCR_AM_Pos) | (alpha << DMA2D_FGPFCCR_ALPHA_Pos));
+
+        MODIFY_REG(DMA2D->FGPFCCR, (DMA2D_FGPFCCR_CS | DMA2D_FGPFCCR_CCM), (((L8CLUT->size - 1) << DMA2D_FGPFCCR_CS_Pos) | (DMA2D_CCM_RGB888 << DMA2D_FGPFCCR_CCM_Pos)));
+
+        /* Write DMA2D BGPFCCR register */
+        WRITE_REG(DMA2D->BGPFCCR, DMA2D_INPUT_ARGB8888 | (DMA2D_NO_MODIF_ALPHA << DMA2D_BGPFCCR_AM_Pos));
+
+        /* Mark CLUT loaded */
+        L8ClutLoaded = 1;
+
+        /* Load the palette unless the CLUT holds it */
+        loadClut(L8CLUT, DMA2D_CCM_RGB888);
+    }
+    else
+    {
+        /* Set correct alpha for these pixels */
+        MODIFY_REG(DMA2D->FGPFCCR, DMA2D_BGPFCCR_ALPHA_Msk, alpha << DMA2D_FGPFCCR_ALPHA_Pos);
+    }
+
+    /* Start pixel transfer in correct mode */
+    if (alpha < 0xFF)
+    {
+        /* Set DMA2D mode */
+        WRITE_REG(DMA2D->CR, DMA2D_M2M_BLEND | DMA2D_CR_START);
+    }
+    else
+    {
+        /* Set DMA2D mode */
+        WRITE_REG(DMA2D->CR, DMA2D_M2M_PFC | DMA2D_CR_START);
+    }
+}
+
+void lineFromL8ARGB8888(uint8_t* const ptr, const uint8_t* const data, const int16_t length, const uint8_t alpha)
+{
+    /* wait for DMA2D to finish last run */
+    while ((READ_REG(DMA2D->CR) & DMA2D_CR_START) != 0U);
+
+    /* DMA2D OPFCCR register configuration */
+    WRITE_REG(DMA2D->OPFCCR, DMA2D_OUTPUT_ARGB8888);
+
+    /* Configure DMA2D data size */
+    WRITE_REG(DMA2D->NLR, (1 | (length << DMA2D_NLR_PL_Pos)));
+
+    /* Configure DMA2D destination address */
+    WRITE_REG(DMA2D->OMAR, reinterpret_cast<uint32_t>(ptr));
+
+    /* Configure DMA2D source address */
+    WRITE_REG(DMA2D->FGMAR, reinterpret_cast<uint32_t>(data));
+
+    /* Configure DMA2D Stream source2 address */
+    WRITE_REG(DMA2D->BGMAR, reinterpret_cast<uint32_t>(ptr));
+
+    /* Load CLUT if not already loaded */
+    if (L8ClutLoaded == 0)
+    {
+        /* Write foreground CLUT memory address */
+        WRITE_REG(DMA2D->FGCMAR, reinterpret_cast<uint32_t>(&L8CLUT->data));
+
+        /* Set DMA2D color mode and alpha mode */
+        WRITE_REG(DMA2D->FGPFCCR, DMA2D_INPUT_L8 | (DMA2D_COMBINE_ALPHA << DMA2D_BGPFCCR_AM_Pos) | (alpha << DMA2D_FGPFCCR_ALPHA_Pos));
+
+        MODIFY_REG(DMA2D->FGPFCCR, (DMA2D_FGPFCCR_CS | DMA2D_FGPFCCR_CCM), (((L8CLUT->size - 1) << DMA2D_FGPFCCR_CS_Pos) | (DMA2D_CCM_ARGB8888 << DMA2D_FGPFCCR_CCM_Pos)));
+
+        /* Write DMA2D BGPFCCR register */
+        WRITE_REG(DMA2D->BGPFCCR, DMA2D_INPUT_ARGB8888 | (DMA2D_NO_MODIF_ALPHA << DMA2D_BGPFCCR_AM_Pos));
+
+        /* Mark CLUT loaded */
+        L8ClutLoaded = 1;
+
+        /* Load the palette unless the CLUT holds it */
+        loadClut(L8CLUT, DMA2D_CCM_ARGB8888);
+    }
+    else
+    {
+        /* Set correct alpha for these pixels */
+        MODIFY_REG(DMA2D->FGPFCCR, DMA2D_BGPFCCR_ALPHA_Msk, alpha << DMA2D_FGPFCCR_ALPHA_Pos);
+    }
+
+    /* Start pixel transfer in blending mode */
+    WRITE_REG(DMA2D->CR, DMA2D_M2M_BLEND | DMA2D_CR_START);
+}
+
+} // namespace argb8888
+} // namespace paint
+} // namespace touchgfx
+
+/* USER CODE END STM32ChromARTDMA.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
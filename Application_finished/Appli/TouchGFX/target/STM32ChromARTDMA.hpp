@@ -0,0 +1,382 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : STM32ChromARTDMA.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef STM32CHROMARTDMA_HPP
+#define STM32CHROMARTDMA_HPP
+
+#include <touchgfx/Bitmap.hpp>
+#include <touchgfx/hal/DMA.hpp>
+#include <MultiProducerDMA_Queue.hpp>
+/* The JPEG output buffers the external jobs copy from */
+#include <STM32DMA.hpp>
+
+/* USER CODE BEGIN STM32ChromARTDMA.hpp */
+
+/* Blits of at most this many pixels are waited for in the DMA2D interrupt, and the next
+ * queued blit started from there, instead of taking one interrupt each. 0 to take an
+ * interrupt for every blit. */
+#ifndef STM32DMA_CHAIN_MAX_PIXELS
+#define STM32DMA_CHAIN_MAX_PIXELS 512
+#endif
+
+/* Most blits completed in one DMA2D interrupt, bounding the time spent in it. */
+#ifndef STM32DMA_CHAIN_MAX_JOBS
+#define STM32DMA_CHAIN_MAX_JOBS 32
+#endif
+
+/**
+ * @class STM32ChromARTDMA
+ *
+ * @brief This class specializes DMA_Interface for DMA2D (ChromART) on the STM32 processors.
+ *
+ *        Replaces the generated STM32DMA, which is not built. Several tasks queue
+ *        BlitOps, small blits are completed in the interrupt of the blit before them,
+ *        the foreground CLUT is reloaded only for a new palette, and short painter spans
+ *        are blended by the CPU. Shares the JPEG output buffers with the hardware decoder
+ *        as STM32DMA does.
+ *
+ * @sa touchgfx::DMA_Interface
+ */
+class STM32ChromARTDMA : public touchgfx::DMA_Interface
+{
+    /**
+     * @typedef touchgfx::DMA_Interface Base
+     *
+     * @brief Defines an alias representing the base.
+     *
+     Defines an alias representing the base.
+     */
+    typedef touchgfx::DMA_Interface Base;
+
+public:
+    /**
+     * @fn STM32ChromARTDMA::STM32ChromARTDMA();
+     *
+     * @brief Default constructor.
+     *
+     *        Default constructor.
+     */
+    STM32ChromARTDMA();
+
+    /**
+     * @fn STM32ChromARTDMA::~STM32ChromARTDMA();
+     *
+     * @brief Destructor.
+     *
+     *        Destructor.
+     */
+    virtual ~STM32ChromARTDMA();
+
+    /**
+     * @fn DMAType touchgfx::STM32ChromARTDMA::getDMAType()
+     *
+     * @brief Function for obtaining the DMA type of the concrete DMA_Interface implementation.
+     *
+     *        Function for obtaining the DMA type of the concrete DMA_Interface implementation.
+     *        As default, will return DMA_TYPE_CHROMART type value.
+     *
+     * @return a DMAType value of the concrete DMA_Interface implementation.
+     */
+    virtual touchgfx::DMAType getDMAType(void)
+    {
+        return touchgfx::DMA_TYPE_CHROMART;
+    }
+
+    /**
+     * @fn touchgfx::BlitOperations STM32ChromARTDMA::getBlitCaps();
+     *
+     * @brief Gets the blit capabilities.
+     *
+     *        Gets the blit capabilities.
+     *
+     *        This DMA supports a range of blit caps: BLIT_OP_COPY, BLIT_OP_COPY_ARGB8888,
+     *        BLIT_OP_COPY_ARGB8888_WITH_ALPHA, BLIT_OP_COPY_A4, BLIT_OP_COPY_A8.
+     *
+     *
+     * @return Currently supported blitcaps.
+     */
+    virtual touchgfx::BlitOperations getBlitCaps();
+
+    /**
+     * @fn void STM32ChromARTDMA::initialize();
+     *
+     * @brief Perform hardware specific initialization.
+     *
+     *        Perform hardware specific initialization.
+     */
+    virtual void initialize();
+
+    /**
+     * @fn void STM32ChromARTDMA::signalDMAInterrupt()
+     *
+     * @brief Raises a DMA interrupt signal.
+     *
+     *        Raises a DMA interrupt signal.
+     */
+    virtual void signalDMAInterrupt()
+    {
+        if (!started_by_external_job)
+        {
+            executeCompleted();
+            chainSmallJobs();
+
+            /* Start new external job if next buffer is full */
+            if (Jpeg_OUT_BufferTab[JPEG_OUT_Read_BufferIndex].State == JPEG_BUFFER_FULL && !DMA2D_CopyBufferEnd && !isRunning)
+            {
+                started_by_external_job = true;
+                externalJobExecute();
+            }
+        }
+        else
+        {
+            externalJobCompleted();
+
+            /* Prioritize BlitOps if there are any pending */
+            if (!queue.isEmpty() && isAllowed)
+            {
+                started_by_external_job = false;
+                execute();
+            }
+        }
+    }
+
+    /**
+     * @fn virtual void STM32ChromARTDMA::start();
+     *
+     * @brief Starts the next BlitOp, or the next external job, if DMA2D is idle.
+     *
+     *        Runs with the DMA2D interrupt masked, as the producing tasks and the JPEG
+     *        interrupt call it.
+     */
+    virtual void start();
+
+    /**
+     * @fn virtual void STM32ChromARTDMA::addToQueue(const touchgfx::BlitOp& op);
+     *
+     * @brief Queues a BlitOp from any task, keeping the data cache coherent with its
+     *        destination.
+     *
+     *        The TouchGFX task, the video task and the image decoding tasks queue BlitOps.
+     *        They take turns on a mutex, held while the base class waits for room, pushes
+     *        and starts the DMA, so the DMA is started through start() and its isAllowed
+     *        gating by one task at a time. Must not be called from an interrupt.
+     *
+     *        Lines of the destination written by the CPU are cleaned before DMA2D writes
+     *        over them, and the destination is added to the range invalidateWritten() drops
+     *        from the cache once rendering returns to the CPU.
+     *
+     * @param op The operation to add.
+     */
+    virtual void addToQueue(const touchgfx::BlitOp& op);
+
+    /**
+     * @fn bool STM32ChromARTDMA::isQueuing() const;
+     *
+     * @brief Tells if the calling task is in addToQueue().
+     *
+     *        The HAL switches to hardware rendering from addToQueue(), whose destination is
+     *        cleaned there, and before GPU2D command lists, whose destination is not known.
+     *
+     * @return true if the calling task is queuing a BlitOp.
+     */
+    bool isQueuing() const;
+
+    /**
+     * @fn void STM32ChromARTDMA::invalidateWritten();
+     *
+     * @brief Drops the destinations of the BlitOps queued since the last call from the data
+     *        cache, before the CPU reads them.
+     */
+    void invalidateWritten();
+
+    /**
+     * @struct ClutStats
+     *
+     * @brief Palette loads into the DMA2D foreground CLUT since the last reset.
+     */
+    struct ClutStats
+    {
+        uint32_t loads;  ///< Palettes loaded into the CLUT
+        uint32_t reuses; ///< L8 jobs whose palette the CLUT held already
+    };
+
+    /**
+     * @fn static void STM32ChromARTDMA::forgetClut();
+     *
+     * @brief Makes the next L8 job load its palette.
+     *
+     *        The CLUT is known by the address of the palette it was loaded from. A
+     *        palette changed in place, or a new palette at the address of a freed one,
+     *        must be followed by a call to this before it is drawn with.
+     */
+    static void forgetClut();
+
+    /**
+     * @fn static const ClutStats& STM32ChromARTDMA::getClutStats();
+     *
+     * @brief Gets the palette loads since the last reset.
+     *
+     * @return The statistics.
+     */
+    static const ClutStats& getClutStats();
+
+    /**
+     * @fn static void STM32ChromARTDMA::resetClutStats();
+     *
+     * @brief Resets the palette load statistics.
+     */
+    static void resetClutStats();
+
+    /**
+     * @struct ChainStats
+     *
+     * @brief DMA2D interrupts and the blits completed in them since the last reset.
+     */
+    struct ChainStats
+    {
+        uint32_t interrupts; ///< Transfer complete interrupts of BlitOps
+        uint32_t chained;    ///< BlitOps completed inside the interrupt of another
+    };
+
+    /**
+     * @fn static const ChainStats& STM32ChromARTDMA::getChainStats();
+     *
+     * @brief Gets the interrupts and chained blits since the last reset.
+     *
+     * @return The statistics.
+     */
+    static const ChainStats& getChainStats();
+
+    /**
+     * @fn static void STM32ChromARTDMA::resetChainStats();
+     *
+     * @brief Resets the chained blit statistics.
+     */
+    static void resetChainStats();
+
+protected:
+    /**
+     * @fn virtual void STM32ChromARTDMA::setupDataCopy(const touchgfx::BlitOp& blitOp);
+     *
+     * @brief Configures the DMA for copying data to the frame buffer.
+     *
+     *        Configures the DMA for copying data to the frame buffer.
+     *
+     * @param blitOp Details on the copy to perform.
+     */
+    virtual void setupDataCopy(const touchgfx::BlitOp& blitOp);
+
+    /**
+     * @fn virtual void STM32ChromARTDMA::setupDataFill(const touchgfx::BlitOp& blitOp);
+     *
+     * @brief Configures the DMA for "filling" the frame-buffer with a single color.
+     *
+     *        Configures the DMA for "filling" the frame-buffer with a single color.
+     *
+     * @param blitOp Details on the "fill" to perform.
+     */
+    virtual void setupDataFill(const touchgfx::BlitOp& blitOp);
+
+    /**
+     * @fn void STM32ChromARTDMA::externalJobCompleted();
+     *
+     * @brief Handle DMA2D when an external job has been executed
+     *
+     * @param None
+     */
+    void externalJobCompleted()
+    {
+        if (isRunning)
+        {
+            isRunning = false;
+            DMA2D_ExternalJobCompleted(Jpeg_OUT_BufferTab[JPEG_OUT_Read_BufferIndex]);
+        }
+    }
+
+    /**
+     * @fn void STM32ChromARTDMA::externalJobExecute();
+     *
+     * @brief Executes an external DMA2D job
+     *
+     * @param None
+     */
+    void externalJobExecute()
+    {
+        isRunning = true;
+        if (Jpeg_OUT_BufferTab[JPEG_OUT_Read_BufferIndex].DoCropping)
+        {
+            DMA2D_CropBuffer(Jpeg_OUT_BufferTab[JPEG_OUT_Read_BufferIndex]);
+        }
+        else
+        {
+            DMA2D_CopyBuffer(Jpeg_OUT_BufferTab[JPEG_OUT_Read_BufferIndex]);
+        }
+    }
+
+private:
+    /**
+     * @fn void STM32ChromARTDMA::chainSmallJobs();
+     *
+     * @brief Completes small blits in the interrupt of the blit before them.
+     *
+     *        DMA2D has no list of jobs, so each BlitOp ends with a transfer complete
+     *        interrupt, and glyphs and small fills take more time entering the interrupt
+     *        than transferring. Called from the interrupt after executeCompleted() started
+     *        the next BlitOp: while that is at most STM32ChromARTDMA_CHAIN_MAX_PIXELS, it is waited
+     *        for here, its interrupt cleared, and the queue continued, so a run of small
+     *        blits takes one interrupt. The framebuffer semaphore is released by
+     *        executeCompleted() once the queue is empty, as before.
+     */
+    void chainSmallJobs();
+
+    touchgfx::MultiProducerDMA_Queue dma_queue;
+    touchgfx::MultiProducerDMA_Queue::Slot queue_storage[128];
+    bool started_by_external_job;
+    uintptr_t written_start; /* Destinations queued since invalidateWritten(), empty if the end is 0 */
+    uintptr_t written_end;
+    void* volatile queuing_task; /* Task in addToQueue(), or 0 */
+    void* producer_mutex;        /* Taken by the tasks in addToQueue() */
+
+    /**
+     * @fn void STM32ChromARTDMA::getChromARTInputFormat()
+     *
+     * @brief Convert Bitmap format to ChromART Input format.
+     *
+     * @param format Bitmap format.
+     *
+     * @return ChromART Input format.
+     */
+
+    inline uint32_t getChromARTInputFormat(touchgfx::Bitmap::BitmapFormat format);
+
+    /**
+     * @fn void STM32ChromARTDMA::getChromARTOutputFormat()
+     *
+     * @brief Convert Bitmap format to ChromART Output format.
+     *
+     * @param format Bitmap format.
+     *
+     * @return ChromART Output format.
+     */
+    inline uint32_t getChromARTOutputFormat(touchgfx::Bitmap::BitmapFormat format);
+};
+
+/* USER CODE END STM32ChromARTDMA.hpp */
+
+#endif // STM32CHROMARTDMA_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
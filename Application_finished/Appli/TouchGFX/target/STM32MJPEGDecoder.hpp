@@ -0,0 +1,207 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : STM32MJPEGDecoder.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef STM32MJPEGDECODER_HPP
+#define STM32MJPEGDECODER_HPP
+
+#include <MJPEGDecoder.hpp>
+#include <STM32DMA.hpp>
+#include <BufferedVideoDataReader.hpp>
+#include <PrefetchVideoDataReader.hpp>
+
+#include "cmsis_os2.h"
+#if defined(osCMSIS) && (osCMSIS < 0x20000)
+#define MUTEX_CREATE() osMutexCreate(0)
+#define MUTEX_LOCK(m) osMutexWait(m, osWaitForever)
+#define MUTEX_TYPE osMutexId
+#define MUTEX_UNLOCK(m) osMutexRelease(m)
+#define SEM_CREATE() osSemaphoreCreate(0, 1)
+#define SEM_POST(s) osSemaphoreRelease(s)
+#define SEM_TYPE osSemaphoreId
+#define SEM_WAIT(s) osSemaphoreWait(s, osWaitForever)
+#else
+#define MUTEX_CREATE() osMutexNew(0)
+#define MUTEX_LOCK(m) osMutexAcquire(m, osWaitForever)
+#define MUTEX_TYPE osMutexId_t
+#define MUTEX_UNLOCK(m) osMutexRelease(m)
+#define SEM_CREATE() osSemaphoreNew(1, 0, 0)
+#define SEM_POST(s) osSemaphoreRelease(s)
+#define SEM_TYPE osSemaphoreId_t
+#define SEM_WAIT(s) osSemaphoreAcquire(s, osWaitForever)
+#endif
+
+/* USER CODE BEGIN STM32MJPEGDecoder.hpp */
+
+/* Number of video frames whose offsets are kept in the frame index */
+#ifndef VIDEO_FRAME_INDEX_ENTRIES
+#define VIDEO_FRAME_INDEX_ENTRIES 1024
+#endif
+
+/* Number of thumbnails of the current video kept in the thumbnail buffer */
+#ifndef VIDEO_THUMBNAIL_ENTRIES
+#define VIDEO_THUMBNAIL_ENTRIES 16
+#endif
+
+/* Size of the buffer of the PrefetchVideoDataReader the video decoder reads memory-mapped
+   videos through, two slots each holding a frame. Larger frames are read in place. 0 to
+   read all frames in place. */
+#ifndef VIDEO_PREFETCH_BUFFER_SIZE
+#define VIDEO_PREFETCH_BUFFER_SIZE (2 * 128 * 1024)
+#endif
+
+/* Size of the thumbnail buffer of the thumbnail decoder: a full frame, and the cached
+   thumbnails of up to 160x120 pixels. 0 to leave out the thumbnail decoder. */
+#ifndef VIDEO_THUMBNAIL_BUFFER_SIZE
+#define VIDEO_THUMBNAIL_BUFFER_SIZE (800 * 480 * 2 + VIDEO_THUMBNAIL_ENTRIES * 160 * 120 * 2)
+#endif
+
+/**
+ * MJPEG decoder on the JPEG codec, with DMA2D converting the MCUs. Replaces the generated
+ * HardwareMJPEGDecoder, which is not built: adds a frame index, reading frames through a
+ * BufferedVideoDataReader, thumbnails, UYVY output for GPU2D and still image decoding.
+ */
+class STM32MJPEGDecoder : public MJPEGDecoder
+{
+public:
+    STM32MJPEGDecoder();
+
+    //Set video data for the decoder
+    virtual void setVideoData(const uint8_t* movie, const uint32_t length);
+    virtual void setVideoData(touchgfx::VideoDataReader& reader);
+    //Set video data read through a prefetching reader, frames are handed to the codec without copying
+    void setVideoData(touchgfx::BufferedVideoDataReader& reader);
+    //Set reader that memory-mapped videos set with setVideoData(movie, length) are read
+    //through, so the next frame is copied to RAM by DMA while the current one decodes
+    void setPrefetchReader(touchgfx::PrefetchVideoDataReader* reader)
+    {
+        prefetchSource = reader;
+    }
+    virtual bool hasVideo();
+    //Increment position to next frame and decode
+    virtual bool decodeNextFrame(uint8_t* frameBuffer, uint16_t width, uint16_t height, uint32_t framebuffer_width);
+    //Increment position to next frame and decode
+    virtual bool gotoNextFrame();
+    //Decode part of the current frame
+    virtual bool decodeFrame(const touchgfx::Rect& area, uint8_t* frameBuffer, uint32_t framebuffer_width);
+    //Decode a frame scaled down to an RGB565 thumbnail, with rows of width pixels. Needs a
+    //thumbnail buffer. The position of the video is kept, but the decoder must not be
+    //decoding in another task, use a decoder of its own for the thumbnails.
+    virtual bool decodeThumbnail(uint32_t frameno, uint8_t* buffer, uint16_t width, uint16_t height);
+    virtual void gotoFrame(uint32_t frameno);
+    virtual uint32_t getCurrentFrameNumber() const
+    {
+        return frameNumber;
+    }
+    virtual uint32_t getNumberOfFrames();
+    virtual void setRepeatVideo(bool repeat);
+    virtual void getVideoInfo(touchgfx::VideoInformation* data);
+
+    void setAVIFileBuffer(uint8_t* buffer, uint32_t size)
+    {
+        aviBuffer = buffer, aviBufferLength = size;
+    }
+
+    //Set buffer for the offsets of the video frames, filled when video data is set. Frames
+    //beyond the buffer are found by walking the AVI chunks.
+    void setFrameIndexBuffer(uint32_t* buffer, uint32_t numberOfFrames)
+    {
+        frameIndex = buffer, frameIndexCapacity = numberOfFrames;
+    }
+
+    //Set buffer for decodeThumbnail(). A frame is decoded at full size at the start of the
+    //buffer, the thumbnails of the current video are cached in the rest.
+    void setThumbnailBuffer(uint8_t* buffer, uint32_t size)
+    {
+        thumbnailBuffer = buffer, thumbnailBufferSize = size, thumbnailCount = 0;
+    }
+
+    virtual AVIErrors getLastError()
+    {
+        return lastError;
+    }
+    void addDMA(touchgfx::DMA_Interface& dma)
+    {
+        this->dma = &dma;
+    }
+
+    //Make decodeNextFrame() write UYVY instead of RGB565, two bytes per pixel, for GPU2D to
+    //convert as it draws. The codec output is reordered by the CPU and DMA2D is not used.
+    //Still images, thumbnails and decodeFrame() are always RGB565.
+    void setVideoOutputUYVY(bool enable)
+    {
+        uyvyVideo = enable;
+    }
+
+    //Decode a JPEG still image into an RGB565 buffer, in the calling task. The codec is
+    //shared with the video, the call waits for a frame being decoded.
+    bool decodeImage(const uint8_t* jpeg, uint32_t length, uint8_t* buffer, uint16_t width, uint16_t height, uint32_t stride);
+    //Read the size of a JPEG still image. Fails unless the image is baseline, 4:2:0 and at
+    //most 800 pixels wide, as converted by the MCU buffers and DMA2D.
+    static bool getImageSize(const uint8_t* jpeg, uint32_t length, uint16_t& width, uint16_t& height);
+private:
+    void readVideoHeader();
+    void decodeMJPEGFrame(const uint8_t* const mjpgdata, const uint32_t length, uint8_t* buffer, uint16_t width, uint16_t height, uint32_t stride, bool uyvy = false);
+    void decodeJPEG(const uint8_t* const jpgdata, const uint32_t length, uint8_t* buffer, uint16_t width, uint16_t height, uint32_t stride, uint32_t imageWidth, uint32_t imageHeight, bool uyvy = false);
+    int compare(const uint32_t offset, const char* str, uint32_t num);
+    uint32_t getU32(const uint32_t offset);
+    uint32_t getU16(const uint32_t offset);
+    const uint8_t* readData(uint32_t offset, uint32_t length);
+    uint32_t getReadLimit() const;
+    void buildFrameIndex();
+    void prefetchFrame(uint32_t offset, uint32_t number);
+    static void scaleDown(const uint16_t* frame, uint32_t frameWidth, uint32_t frameHeight, uint16_t* thumbnail, uint32_t width, uint32_t height);
+
+    struct Thumbnail
+    {
+        uint32_t frame;
+        uint32_t offset; //In the thumbnail buffer
+        uint16_t width;
+        uint16_t height;
+    };
+
+    touchgfx::VideoInformation videoInfo;
+    uint32_t frameNumber;
+    uint32_t currentMovieOffset;
+    uint32_t indexOffset;
+    uint32_t firstFrameOffset;
+    uint32_t lastFrameEnd;
+    uint32_t movieLength;
+    const uint8_t* movieData;
+    touchgfx::VideoDataReader* reader;
+    touchgfx::BufferedVideoDataReader* prefetchReader;
+    touchgfx::PrefetchVideoDataReader* prefetchSource;
+    const uint8_t* readBuffer;
+    uint8_t* aviBuffer;
+    uint32_t aviBufferLength;
+    uint32_t aviBufferStartOffset;
+    uint32_t* frameIndex;
+    uint32_t frameIndexCapacity;
+    uint32_t frameIndexLength;
+    uint8_t* thumbnailBuffer;
+    uint32_t thumbnailBufferSize;
+    Thumbnail thumbnails[VIDEO_THUMBNAIL_ENTRIES];
+    uint32_t thumbnailCount;
+    AVIErrors lastError;
+    touchgfx::DMA_Interface* dma;
+    bool uyvyVideo;
+};
+
+/* USER CODE END STM32MJPEGDecoder.hpp */
+
+#endif // STM32MJPEGDECODER_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -24,70 +24,266 @@
 #include <touchgfx/hal/HAL.hpp>
 #include <touchgfx/hal/Types.hpp>
 #include <STM32TouchController.hpp>
+#include <IdleRefreshRate.hpp>
+#include <IdleSuspend.hpp>
+#include <TouchLatency.hpp>
 #include "main.h"
 
-volatile bool doSampleTouch = false;
-
 extern "C" I2C_HandleTypeDef hi2c1;
 
 using namespace touchgfx;
+
+namespace
+{
+const uint16_t GT911_ADDRESS = 0xBA;
+// Status, track id, x and y of the first point, read in one transfer
+const uint16_t STATUS_REG = 0x814E;
+const uint16_t REPORT_LENGTH = 6;
+const uint8_t STATUS_READY = 0x80;
+const uint8_t STATUS_TOUCHES = 0x0F;
+
+DMA_HandleTypeDef hdma;
+// Invalidated after every read, so it must not share a cache line with other data
+ALIGN_32BYTES(uint8_t report[32]);
+uint8_t zero = 0;
+}
+
 extern "C"
 {
     void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
     {
         if (GPIO_Pin == TP_IRQ_Pin)
         {
-            /* Communication with TS is done via I2C.
-            Often the sw requires ISRs (interrupt service routines) to be quick while communication
-            with I2C can be considered relatively long (depending on SW requirements).
-            Considering that the TS feature don't need immediate reaction,
-            it is suggested to use polling mode instead of EXTI mode,
-            in order to avoid blocking I2C communication on interrupt service routines */
-
-            /* Here an example of implementation is proposed which is a mix between pooling and exit mode:
-            On ISR a flag is set (exti5_received), the main loop polls on the flag rather then polling the TS;
-            Mcu communicates with TS only when the flag has been set by ISR. This is just an example:
-            the users should choose they strategy depending on their application needs.*/
-
-            doSampleTouch = true;
+            // The report is read by DMA, the interrupt only starts the transfer
+            STM32TouchController::reportReceivedFromISR();
+            // Touches are sampled by the tick loop, resume it if it is suspended
+            IdleSuspend::wakeUpFromISR();
+            IdleRefreshRate::wakeUpFromISR();
             return;
         }
     }
+
+    void HAL_I2C_MemRxCpltCallback(I2C_HandleTypeDef* hi2c)
+    {
+        if (hi2c == &hi2c1)
+        {
+            STM32TouchController::readCompletedFromISR();
+        }
+    }
+
+    void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef* hi2c)
+    {
+        if (hi2c == &hi2c1)
+        {
+            STM32TouchController::transferEndedFromISR(true);
+        }
+    }
+
+    void HAL_I2C_ErrorCallback(I2C_HandleTypeDef* hi2c)
+    {
+        if (hi2c == &hi2c1)
+        {
+            STM32TouchController::transferEndedFromISR(false);
+        }
+    }
+
+    void STM32TouchController_DMA_IRQHandler(void)
+    {
+        HAL_DMA_IRQHandler(&hdma);
+    }
 }
 
+STM32TouchController* STM32TouchController::instance = 0;
+
 void STM32TouchController::init()
 {
-    // No init needed
+    instance = this;
+
+    __HAL_RCC_GPDMA1_CLK_ENABLE();
+    hdma.Instance = GPDMA1_Channel0;
+    hdma.Init.Request = GPDMA1_REQUEST_I2C1_RX;
+    hdma.Init.BlkHWRequest = DMA_BREQ_SINGLE_BURST;
+    hdma.Init.Direction = DMA_PERIPH_TO_MEMORY;
+    hdma.Init.SrcInc = DMA_SINC_FIXED;
+    hdma.Init.DestInc = DMA_DINC_INCREMENTED;
+    hdma.Init.SrcDataWidth = DMA_SRC_DATAWIDTH_BYTE;
+    hdma.Init.DestDataWidth = DMA_DEST_DATAWIDTH_BYTE;
+    hdma.Init.Priority = DMA_LOW_PRIORITY_HIGH_WEIGHT;
+    hdma.Init.SrcBurstLength = 1;
+    hdma.Init.DestBurstLength = 1;
+    hdma.Init.TransferAllocatedPort = DMA_SRC_ALLOCATED_PORT0 | DMA_DEST_ALLOCATED_PORT1;
+    hdma.Init.TransferEventMode = DMA_TCEM_BLOCK_TRANSFER;
+    hdma.Init.Mode = DMA_NORMAL;
+    if (HAL_DMA_Init(&hdma) != HAL_OK)
+    {
+        Error_Handler();
+    }
+    HAL_DMA_ConfigChannelAttributes(&hdma, DMA_CHANNEL_NPRIV);
+    __HAL_LINKDMA(&hi2c1, hdmarx, hdma);
+
+    // Same priority as the other DMA channels, below the FreeRTOS syscall limit
+    HAL_NVIC_SetPriority(GPDMA1_Channel0_IRQn, 5, 0);
+    HAL_NVIC_EnableIRQ(GPDMA1_Channel0_IRQn);
+    HAL_NVIC_SetPriority(I2C1_EV_IRQn, 5, 0);
+    HAL_NVIC_EnableIRQ(I2C1_EV_IRQn);
+    HAL_NVIC_SetPriority(I2C1_ER_IRQn, 5, 0);
+    HAL_NVIC_EnableIRQ(I2C1_ER_IRQn);
+
+    // A report raised before the EXTI was enabled would never be acknowledged
+    HAL_NVIC_DisableIRQ(TP_IRQ_EXTI_IRQn);
+    reportReceived();
+    HAL_NVIC_EnableIRQ(TP_IRQ_EXTI_IRQn);
 }
 
 bool STM32TouchController::sampleTouch(int32_t& x, int32_t& y)
 {
-    uint8_t touches = 0;
-    uint8_t buf[6];
-    const uint16_t STATUS_REG = 0x814E;
-    const uint16_t TOUCH_POS_REG = 0x8150;
-    uint8_t ZERO = 0;
+    const uint32_t end = head;
+    uint32_t next = tail;
+    const bool wasTouched = touched;
+    bool sampled = false;
+    uint32_t irqCycles = 0;
+    uint32_t readCycles = 0;
 
-    NVIC_DisableIRQ(TP_IRQ_EXTI_IRQn);
-    if (doSampleTouch)
+    // Keep the latest position of the touch, but stop at a release that follows a press
+    // so a tap between two calls is not lost
+    while (next != end)
     {
-        HAL_I2C_Mem_Read(&hi2c1, 0xBA, STATUS_REG, 2, buf, 1, HAL_MAX_DELAY);
-        touches = (0x0F & buf[0]);
+        const Sample& sample = ring[next % TOUCH_SAMPLE_RING_SIZE];
+        if (sampled && touched && !sample.touched)
+        {
+            break;
+        }
+        if (sampled)
+        {
+            stats.coalesced++;
+        }
+        else
+        {
+            // The latency of coalesced samples is that of the oldest
+            irqCycles = sample.irqCycles;
+            readCycles = sample.readCycles;
+        }
+        if (sample.touched && touched)
+        {
+            predictor.addSample(sample.readCycles, sample.x, sample.y);
+        }
+        else
+        {
+            // A press or a release starts the fit over
+            predictor.reset();
+            if (sample.touched)
+            {
+                predictor.addSample(sample.readCycles, sample.x, sample.y);
+            }
+        }
+        touched = sample.touched;
+        lastX = sample.x;
+        lastY = sample.y;
+        lastSampleMs = sample.timeMs;
+        sampled = true;
+        next++;
+    }
+    tail = next;
+    if (sampled)
+    {
+        TouchLatency::sampledFromController(irqCycles, readCycles, lastY, touched);
+    }
 
-        HAL_I2C_Mem_Write(&hi2c1, 0xBA, STATUS_REG, 2, &ZERO, 1, HAL_MAX_DELAY);
+    if (!sampled && touched && HAL_GetTick() - lastSampleMs > TOUCH_RELEASE_TIMEOUT_MS)
+    {
+        touched = false;
+        predictor.reset();
+    }
 
-        doSampleTouch = false;
+    if (touched)
+    {
+        x = lastX;
+        y = lastY;
+        // The press is reported where it was touched, only drags are extrapolated
+        if (wasTouched)
+        {
+            predictor.predict(TouchLatency::now(), x, y);
+        }
+    }
+    return touched;
+}
 
-        if (touches > 0)
+void STM32TouchController::reportReceived()
+{
+    const uint32_t cycles = TouchLatency::now();
+    if (state != STATE_IDLE)
+    {
+        // Read when the running transfer ends
+        if (!pending)
         {
-            HAL_I2C_Mem_Read(&hi2c1, 0xBA, TOUCH_POS_REG, 2, buf, 4, HAL_MAX_DELAY);
-            x = buf[0] + (buf[1] << 8);
-            y = buf[2] + (buf[3] << 8);
+            pendingIrqCycles = cycles;
         }
+        pending = true;
+        return;
     }
-    NVIC_EnableIRQ(TP_IRQ_EXTI_IRQn);
+    irqCycles = cycles;
+    startRead();
+}
 
-    return (touches > 0);
+void STM32TouchController::readCompleted()
+{
+    SCB_InvalidateDCache_by_Addr(report, sizeof(report));
+    const uint8_t status = report[0];
+    if (status & STATUS_READY)
+    {
+        const uint32_t index = head;
+        if (index - tail < TOUCH_SAMPLE_RING_SIZE)
+        {
+            Sample& sample = ring[index % TOUCH_SAMPLE_RING_SIZE];
+            sample.timeMs = HAL_GetTick();
+            sample.irqCycles = irqCycles;
+            sample.readCycles = TouchLatency::now();
+            sample.x = report[2] | (report[3] << 8);
+            sample.y = report[4] | (report[5] << 8);
+            sample.touched = (status & STATUS_TOUCHES) > 0;
+            // Publish the sample after it is written
+            __DMB();
+            head = index + 1;
+            stats.samples++;
+        }
+        else
+        {
+            stats.overflows++;
+        }
+    }
+
+    // The GT911 does not raise the next report until the status is cleared
+    state = STATE_ACKNOWLEDGING;
+    if (HAL_I2C_Mem_Write_IT(&hi2c1, GT911_ADDRESS, STATUS_REG, I2C_MEMADD_SIZE_16BIT, &zero, 1) != HAL_OK)
+    {
+        transferEnded(false);
+    }
+}
+
+void STM32TouchController::transferEnded(bool ok)
+{
+    state = STATE_IDLE;
+    if (!ok)
+    {
+        stats.errors++;
+    }
+    if (pending)
+    {
+        pending = false;
+        irqCycles = pendingIrqCycles;
+        startRead();
+    }
+}
+
+void STM32TouchController::startRead()
+{
+    state = STATE_READING;
+    if (HAL_I2C_Mem_Read_DMA(&hi2c1, GT911_ADDRESS, STATUS_REG, I2C_MEMADD_SIZE_16BIT, report, REPORT_LENGTH) != HAL_OK)
+    {
+        // Retried by the next report
+        state = STATE_IDLE;
+        stats.errors++;
+    }
 }
 /* USER CODE END STM32TouchController */
 
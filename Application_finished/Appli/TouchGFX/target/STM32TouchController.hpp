@@ -26,12 +26,43 @@
 #define STM32TOUCHCONTROLLER_HPP
 
 #include <platform/driver/touch/TouchController.hpp>
+#include <TouchPredictor.hpp>
+#include <stdint.h>
+
+/**
+ * Number of touch samples buffered between two calls to sampleTouch(). The GT911 reports
+ * about every 10 ms, so a few samples cover a frame that takes several refreshes.
+ */
+#ifndef TOUCH_SAMPLE_RING_SIZE
+#define TOUCH_SAMPLE_RING_SIZE 16
+#endif
+
+/**
+ * Time in milliseconds without a report after which a touch is released, should the GT911
+ * report of the release be lost.
+ */
+#ifndef TOUCH_RELEASE_TIMEOUT_MS
+#define TOUCH_RELEASE_TIMEOUT_MS 100
+#endif
 
 /**
  * @class STM32TouchController
  *
  * @brief This class specializes TouchController Interface.
  *
+ *        The GT911 is read from its interrupt: the TP_IRQ EXTI starts an I2C read of the
+ *        status and first point, received by DMA, and its completion starts the write that
+ *        acknowledges the report. Every report is stored with its time in a single producer,
+ *        single consumer ring, so sampleTouch() never waits for I2C and never masks the
+ *        touch interrupt.
+ *
+ *        sampleTouch() coalesces the samples received since the last call into the latest
+ *        point. A release is kept in the ring until the touch before it has been reported,
+ *        so a tap shorter than a frame is still seen as a press and a release.
+ *
+ *        While a touch is dragged, the position reported is extrapolated by a
+ *        TouchPredictor to the scanout of the frame drawn from it.
+ *
  * @sa touchgfx::TouchController
  */
 
@@ -39,7 +70,30 @@ class STM32TouchController : public touchgfx::TouchController
 {
 public:
 
-    STM32TouchController() {}
+    /** A report of the GT911. */
+    struct Sample
+    {
+        uint32_t timeMs;     ///< HAL tick when the report was received
+        uint32_t irqCycles;  ///< Cycle counter at the EXTI that raised the report
+        uint32_t readCycles; ///< Cycle counter when the report was received
+        int16_t x;
+        int16_t y;
+        bool touched;
+    };
+
+    /** Reports received and dropped since start-up. */
+    struct Stats
+    {
+        uint32_t samples;   ///< Reports stored in the ring
+        uint32_t coalesced; ///< Reports replaced by a later one before sampleTouch()
+        uint32_t overflows; ///< Reports dropped on a full ring
+        uint32_t errors;    ///< I2C transfers that failed
+    };
+
+    STM32TouchController()
+        : head(0), tail(0), state(STATE_IDLE), pending(false), irqCycles(0), pendingIrqCycles(0), touched(false), lastX(0), lastY(0), lastSampleMs(0), stats()
+    {
+    }
 
     /**
       * @fn virtual void STM32TouchController::init() = 0;
@@ -63,6 +117,89 @@ public:
     * @return True if a touch has been detected, otherwise false.
     */
     virtual bool sampleTouch(int32_t& x, int32_t& y);
+
+    /**
+     * @fn const Stats& STM32TouchController::getStats() const;
+     *
+     * @brief Gets the number of reports received, coalesced and dropped.
+     *
+     * @return The touch statistics.
+     */
+    const Stats& getStats() const
+    {
+        return stats;
+    }
+
+    /**
+     * @fn static void STM32TouchController::reportReceivedFromISR();
+     *
+     * @brief Starts reading a report. Called from the TP_IRQ EXTI.
+     */
+    static void reportReceivedFromISR()
+    {
+        if (instance != 0)
+        {
+            instance->reportReceived();
+        }
+    }
+
+    /**
+     * @fn static void STM32TouchController::readCompletedFromISR();
+     *
+     * @brief Stores the report read and acknowledges it. Called when the I2C read completes.
+     */
+    static void readCompletedFromISR()
+    {
+        if (instance != 0)
+        {
+            instance->readCompleted();
+        }
+    }
+
+    /**
+     * @fn static void STM32TouchController::transferEndedFromISR(bool ok);
+     *
+     * @brief Starts the next read, if a report arrived meanwhile. Called when the I2C
+     *        acknowledge completes or any transfer fails.
+     *
+     * @param ok false if the transfer failed.
+     */
+    static void transferEndedFromISR(bool ok)
+    {
+        if (instance != 0)
+        {
+            instance->transferEnded(ok);
+        }
+    }
+
+private:
+    enum State
+    {
+        STATE_IDLE,
+        STATE_READING,
+        STATE_ACKNOWLEDGING
+    };
+
+    void reportReceived();
+    void readCompleted();
+    void transferEnded(bool ok);
+    void startRead();
+
+    Sample ring[TOUCH_SAMPLE_RING_SIZE];
+    volatile uint32_t head;     ///< Next sample written, by the I2C interrupts
+    volatile uint32_t tail;     ///< Next sample read, by sampleTouch()
+    volatile State state;
+    volatile bool pending;      ///< A report arrived while a transfer was running
+    uint32_t irqCycles;         ///< Cycle counter at the EXTI of the report being read
+    uint32_t pendingIrqCycles;  ///< Cycle counter at the EXTI of the pending report
+    bool touched;               ///< Reported to the framework by the last sampleTouch()
+    int16_t lastX;
+    int16_t lastY;
+    uint32_t lastSampleMs;
+    touchgfx::TouchPredictor predictor;
+    Stats stats;
+
+    static STM32TouchController* instance;
 };
 
 #endif // STM32TOUCHCONTROLLER_HPP
@@ -0,0 +1,351 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : ScreenCapture.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include <ScreenCapture.hpp>
+
+/* USER CODE BEGIN ScreenCapture.cpp */
+#include <DCacheMaintenance.hpp>
+#include <TraceOutput.hpp>
+#include <touchgfx/hal/HAL.hpp>
+#include <cmsis_os2.h>
+#include <string.h>
+
+#include "stm32h7rsxx.h"
+
+namespace
+{
+const uint32_t WORK_FLAG = 0x1U;
+const uint32_t MAX_RUN = 0x8000U;     // Count - 1 fits in 15 bits
+const uint32_t MAX_LITERAL = 0x7FFFU; // Count - 1 below 0x7FFF keeps 0xFFFF for the markers
+
+// A row encoded before it is written, at worst a literal of all its pixels
+uint32_t rowWords[TOUCHGFX_SCREEN_CAPTURE_MAX_WIDTH / 2 + 2];
+}
+
+namespace touchgfx
+{
+Rect ScreenCapture::pending[TOUCHGFX_SCREEN_CAPTURE_AREAS];
+uint8_t ScreenCapture::pendingCount = 0;
+Rect ScreenCapture::areas[TOUCHGFX_SCREEN_CAPTURE_AREAS];
+uint8_t ScreenCapture::areaCount = 0;
+int16_t ScreenCapture::resumeY = 0;
+const uint16_t* ScreenCapture::frameBuffer = 0;
+uint32_t ScreenCapture::frameNumber = 0;
+uint32_t ScreenCapture::lastStart = 0;
+bool ScreenCapture::connected = false;
+bool ScreenCapture::announce = false;
+volatile uint8_t ScreenCapture::state = ScreenCapture::IDLE;
+volatile bool ScreenCapture::torn = false;
+uint32_t ScreenCapture::budgetTick = 0;
+uint32_t ScreenCapture::budgetWords = 0;
+void* volatile ScreenCapture::thread = 0;
+ScreenCapture::Stats ScreenCapture::stats;
+
+void ScreenCapture::flushed(const Rect& rect)
+{
+    if (connected)
+    {
+        add(pending, pendingCount, rect);
+    }
+}
+
+void ScreenCapture::frameStarted(const uint16_t* completed, const uint16_t* drawn, uint32_t frame)
+{
+#if TOUCHGFX_SCREEN_CAPTURE
+    if (state == CAPTURE && drawn == frameBuffer)
+    {
+        // captureTask stops before the next row, the TouchGFX task does not wait for it
+        torn = true;
+    }
+    if (state == ABORTED)
+    {
+        for (uint8_t i = 0; i < areaCount; i++)
+        {
+            add(pending, pendingCount, areas[i]);
+        }
+        state = IDLE;
+    }
+    if (!isCaptured())
+    {
+        connected = false;
+        pendingCount = 0;
+        return;
+    }
+    if (!connected)
+    {
+        // The host has nothing to apply the areas to yet
+        connected = true;
+        announce = true;
+        pendingCount = 0;
+        resumeY = 0;
+        add(pending, pendingCount, Rect(0, 0, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT));
+    }
+    if (state != IDLE || pendingCount == 0 || completed == 0 || thread == 0)
+    {
+        return;
+    }
+    const uint32_t now = osKernelGetTickCount();
+    if (completed == drawn || now - lastStart < TOUCHGFX_SCREEN_CAPTURE_INTERVAL_MS)
+    {
+        stats.deferred++;
+        return;
+    }
+
+    memcpy(areas, pending, sizeof(Rect) * pendingCount);
+    areaCount = pendingCount;
+    pendingCount = 0;
+    frameBuffer = completed;
+    frameNumber = frame;
+    lastStart = now;
+    torn = false;
+    // The capture is filled before captureTask can see it
+    __DMB();
+    state = CAPTURE;
+    osThreadFlagsSet(static_cast<osThreadId_t>(thread), WORK_FLAG);
+#else
+    (void)completed;
+    (void)drawn;
+    (void)frame;
+#endif
+}
+
+void ScreenCapture::run()
+{
+    thread = osThreadGetId();
+    for (;;)
+    {
+        osThreadFlagsWait(WORK_FLAG, osFlagsWaitAny, osWaitForever);
+        if (state != CAPTURE)
+        {
+            continue;
+        }
+        __DMB();
+        const uint32_t start = osKernelGetTickCount();
+        capture();
+        stats.captureMs = osKernelGetTickCount() - start;
+    }
+}
+
+void ScreenCapture::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+bool ScreenCapture::isCaptured()
+{
+    return TOUCHGFX_SCREEN_CAPTURE
+           && isTracePortEnabled(TOUCHGFX_SCREEN_CAPTURE_PORT)
+           && HAL::DISPLAY_ROTATION == rotate0
+           && HAL::DISPLAY_WIDTH <= TOUCHGFX_SCREEN_CAPTURE_MAX_WIDTH
+           && HAL::lcd().framebufferFormat() == Bitmap::RGB565
+           && HAL::getInstance()->getFrameRefreshStrategy() != HAL::REFRESH_STRATEGY_PARTIAL_FRAMEBUFFER;
+}
+
+void ScreenCapture::add(Rect* list, uint8_t& count, const Rect& rect)
+{
+    const Rect area = rect & Rect(0, 0, HAL::DISPLAY_WIDTH, HAL::DISPLAY_HEIGHT);
+    if (area.isEmpty())
+    {
+        return;
+    }
+    for (uint8_t i = 0; i < count; i++)
+    {
+        if (list[i].includes(area))
+        {
+            return;
+        }
+        if (list[i].intersect(area))
+        {
+            list[i].expandToFit(area);
+            return;
+        }
+    }
+    if (count < TOUCHGFX_SCREEN_CAPTURE_AREAS)
+    {
+        list[count++] = area;
+    }
+    else
+    {
+        list[count - 1].expandToFit(area);
+    }
+}
+
+void ScreenCapture::capture()
+{
+    if (announce)
+    {
+        announce = false;
+        write(STREAM_BEGIN);
+        write(((uint32_t)HAL::DISPLAY_WIDTH << 16) | HAL::DISPLAY_HEIGHT);
+    }
+    write(FRAME_BEGIN);
+    write(frameNumber);
+
+    // The areas not sent, sent by the next capture
+    Rect rest[TOUCHGFX_SCREEN_CAPTURE_AREAS];
+    uint8_t restCount = 0;
+    bool aborted = false;
+    const int16_t fromY = resumeY;
+    for (uint8_t i = 0; i < areaCount; i++)
+    {
+        // Sent from the row the last capture stopped at, so a screen redrawn every frame
+        // is not sent from the top every time
+        const Rect& area = areas[i];
+        Rect parts[2] = { area, Rect() };
+        if (fromY > area.y && fromY < area.bottom())
+        {
+            parts[0] = Rect(area.x, fromY, area.width, area.bottom() - fromY);
+            parts[1] = Rect(area.x, area.y, area.width, fromY - area.y);
+        }
+        for (uint8_t p = 0; p < 2; p++)
+        {
+            const Rect& part = parts[p];
+            if (part.isEmpty())
+            {
+                continue;
+            }
+            if (aborted)
+            {
+                add(rest, restCount, part);
+                continue;
+            }
+            const int16_t rows = sendRows(part);
+            if (rows < part.height)
+            {
+                aborted = true;
+                resumeY = part.y + rows;
+                add(rest, restCount, Rect(part.x, resumeY, part.width, part.height - rows));
+            }
+        }
+    }
+
+    if (aborted)
+    {
+        write(FRAME_ABORT);
+        stats.aborted++;
+        memcpy(areas, rest, sizeof(Rect) * restCount);
+        areaCount = restCount;
+        __DMB();
+        state = ABORTED;
+        return;
+    }
+    write(FRAME_END);
+    stats.frames++;
+    resumeY = 0;
+    __DMB();
+    state = IDLE;
+}
+
+int16_t ScreenCapture::sendRows(const Rect& area)
+{
+    write(AREA);
+    write(((uint32_t)(uint16_t)area.x << 16) | (uint16_t)area.y);
+    write(((uint32_t)(uint16_t)area.width << 16) | (uint16_t)area.height);
+
+    const uint16_t* row = frameBuffer + (uint32_t)area.y * HAL::FRAME_BUFFER_WIDTH + area.x;
+    const uint16_t* above = 0;
+    for (int16_t y = 0; y < area.height; y++)
+    {
+        // GPU2D and DMA2D wrote the framebuffer behind the data cache
+        DCacheMaintenance::cleanInvalidate(row, (uint32_t)area.width * 2U);
+        const uint32_t count = encodeRow(row, above, area.width);
+        // The row may have been drawn into while it was encoded
+        if (torn)
+        {
+            return y;
+        }
+        for (uint32_t i = 0; i < count; i++)
+        {
+            write(rowWords[i]);
+        }
+        stats.pixels += area.width;
+        above = row;
+        row += HAL::FRAME_BUFFER_WIDTH;
+    }
+    return area.height;
+}
+
+uint32_t ScreenCapture::encodeRow(const uint16_t* row, const uint16_t* above, int16_t width)
+{
+    if (above != 0 && memcmp(row, above, (uint32_t)width * 2U) == 0)
+    {
+        rowWords[0] = ROW_REPEAT;
+        return 1;
+    }
+    uint32_t count = 0;
+    int32_t x = 0;
+    while (x < width)
+    {
+        int32_t run = 1;
+        while (x + run < width && (uint32_t)run < MAX_RUN && row[x + run] == row[x])
+        {
+            run++;
+        }
+        if (run >= 3)
+        {
+            rowWords[count++] = ((uint32_t)(run - 1) << 16) | row[x];
+            x += run;
+            continue;
+        }
+        // Literal pixels up to the next run of three
+        int32_t end = x + 1;
+        while (end < width && (uint32_t)(end - x) < MAX_LITERAL
+               && !(end + 2 < width && row[end] == row[end + 1] && row[end] == row[end + 2]))
+        {
+            end++;
+        }
+        rowWords[count++] = 0x80000000U | ((uint32_t)(end - x - 1) << 16) | row[x];
+        for (int32_t i = x + 1; i < end; i += 2)
+        {
+            const uint32_t second = (i + 1 < end) ? row[i + 1] : 0U;
+            rowWords[count++] = row[i] | (second << 16);
+        }
+        x = end;
+    }
+    return count;
+}
+
+void ScreenCapture::write(uint32_t word)
+{
+    // The ITM FIFO is not waited on, the task sleeps once the budget of the tick is spent
+    const uint32_t now = osKernelGetTickCount();
+    if (now != budgetTick)
+    {
+        budgetTick = now;
+        budgetWords = 0;
+    }
+    else if (budgetWords * 4U >= TOUCHGFX_SCREEN_CAPTURE_BYTES_PER_MS)
+    {
+        osDelay(1);
+        budgetTick = osKernelGetTickCount();
+        budgetWords = 0;
+    }
+    traceWord(TOUCHGFX_SCREEN_CAPTURE_PORT, word);
+    budgetWords++;
+    stats.bytes += 4;
+}
+} // namespace touchgfx
+
+extern "C" void ScreenCapture_Task(void* argument)
+{
+    touchgfx::ScreenCapture::run();
+}
+
+/* USER CODE END ScreenCapture.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
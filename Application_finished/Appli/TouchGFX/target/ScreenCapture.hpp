@@ -0,0 +1,226 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : ScreenCapture.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef SCREENCAPTURE_HPP
+#define SCREENCAPTURE_HPP
+
+#include <touchgfx/hal/Types.hpp>
+
+/* USER CODE BEGIN ScreenCapture.hpp */
+
+/**
+ * Set to 0 to build without the screen capture. With 1 nothing is captured until the
+ * debugger enables TOUCHGFX_SCREEN_CAPTURE_PORT.
+ */
+#ifndef TOUCHGFX_SCREEN_CAPTURE
+#define TOUCHGFX_SCREEN_CAPTURE 1
+#endif
+
+/**
+ * ITM stimulus port of the capture stream. Port 0 carries the text of tracePrintf(), port
+ * 1 the trace of WidgetProfiler.
+ */
+#ifndef TOUCHGFX_SCREEN_CAPTURE_PORT
+#define TOUCHGFX_SCREEN_CAPTURE_PORT 2
+#endif
+
+/**
+ * Shortest time in milliseconds between the starts of two captures. The areas drawn in
+ * between are sent with the next capture.
+ */
+#ifndef TOUCHGFX_SCREEN_CAPTURE_INTERVAL_MS
+#define TOUCHGFX_SCREEN_CAPTURE_INTERVAL_MS 100
+#endif
+
+/**
+ * Bytes written to the stimulus port per millisecond at most, below the SWO bandwidth so
+ * the capture task sleeps instead of waiting on the ITM FIFO.
+ */
+#ifndef TOUCHGFX_SCREEN_CAPTURE_BYTES_PER_MS
+#define TOUCHGFX_SCREEN_CAPTURE_BYTES_PER_MS 256
+#endif
+
+/**
+ * Number of separate dirty areas kept per capture. Further areas are merged into the
+ * last one.
+ */
+#ifndef TOUCHGFX_SCREEN_CAPTURE_AREAS
+#define TOUCHGFX_SCREEN_CAPTURE_AREAS 8
+#endif
+
+/**
+ * Widest display captured, the size of the row encoded before it is written.
+ */
+#ifndef TOUCHGFX_SCREEN_CAPTURE_MAX_WIDTH
+#define TOUCHGFX_SCREEN_CAPTURE_MAX_WIDTH 1024
+#endif
+
+namespace touchgfx
+{
+/**
+ * @class ScreenCapture
+ *
+ * @brief Streams what is shown on the display over SWO, only the areas that changed,
+ *        run-length encoded, from captureTask at low priority.
+ *
+ *        The areas flushed by the framework, see TouchGFXHAL::flushFrameBuffer(), are
+ *        collected in the TouchGFX task. At the start of a frame, once GPU2D has completed
+ *        the previous one, the areas drawn since the last capture are handed to
+ *        captureTask with the framebuffer that holds the completed frame, at most once
+ *        every TOUCHGFX_SCREEN_CAPTURE_INTERVAL_MS. captureTask reads the pixels of the
+ *        areas from the framebuffer while it is shown or waits to be, and writes them to
+ *        ITM stimulus port TOUCHGFX_SCREEN_CAPTURE_PORT, which the debug probe carries to
+ *        the host over USB. gcc/screencapture.py rebuilds the frames from the stream.
+ *
+ *        The TouchGFX task never waits for a capture: a capture still running when the
+ *        framework starts drawing into its framebuffer again stops at the row it reached,
+ *        and the rows not sent are sent with the next capture, starting from that row so
+ *        a screen redrawn every frame is still sent a band at a time. Every row is
+ *        encoded before it is written and dropped if the framebuffer was drawn into
+ *        meanwhile. The first capture after the debugger enables the port is the whole
+ *        screen.
+ *
+ *        The stream is words, little endian. It starts with STREAM_BEGIN and the size of
+ *        the display, width in the upper half. A capture is FRAME_BEGIN and the frame
+ *        number, then for each area AREA, its position and its size, x and width in the
+ *        upper halves, then the rows of the area, and ends with FRAME_END, or with
+ *        FRAME_ABORT after an area cut short, whose rows received are valid. A row is
+ *        ROW_REPEAT when it has the pixels of the row above in the area, else runs of
+ *        RGB565 pixels: a word with bit 31 clear is count - 1 in bits 30 to 16 and a pixel
+ *        repeated count times in bits 15 to 0, a word with bit 31 set is count - 1 of
+ *        literal pixels in bits 30 to 16 and the first pixel in bits 15 to 0, followed by
+ *        the others two per word, the first in the lower half. Markers have 0xFFFF in the
+ *        upper half, which the first word of a row never has.
+ *
+ *        Only RGB565 framebuffers in the rotate0 orientation are captured, not the
+ *        partial framebuffer mode.
+ */
+class ScreenCapture
+{
+public:
+    /** Words starting the records of the stream. */
+    enum Marker
+    {
+        STREAM_BEGIN = 0xFFFF0000U, ///< Followed by the size of the display
+        FRAME_BEGIN = 0xFFFF0001U,  ///< Followed by the frame number
+        AREA = 0xFFFF0002U,         ///< Followed by the position and size, then the rows
+        ROW_REPEAT = 0xFFFF0003U,   ///< A row with the pixels of the row above
+        FRAME_END = 0xFFFF0004U,    ///< The areas of the capture are complete
+        FRAME_ABORT = 0xFFFF0005U   ///< The last area was cut short, the rest comes later
+    };
+
+    /** Captures since the last reset. */
+    struct Stats
+    {
+        uint32_t frames;     ///< Captures sent
+        uint32_t aborted;    ///< Captures cut short, finished by the next ones
+        uint32_t deferred;   ///< Frames whose areas were left to a later capture
+        uint32_t pixels;     ///< Pixels of the areas sent
+        uint32_t bytes;      ///< Bytes written to the stimulus port
+        uint32_t captureMs;  ///< Time captureTask took for the last capture
+    };
+
+    /**
+     * @fn static void ScreenCapture::flushed(const Rect& rect);
+     *
+     * @brief Adds an area drawn by the framework, in the TouchGFX task.
+     *
+     * @param rect The absolute area.
+     */
+    static void flushed(const Rect& rect);
+
+    /**
+     * @fn static void ScreenCapture::frameStarted(const uint16_t* completed, const uint16_t* drawn, uint32_t frame);
+     *
+     * @brief Starts a capture of the completed frame when captureTask is idle and the
+     *        interval has passed, and aborts the capture running when its framebuffer is
+     *        drawn into. Called in the TouchGFX task at the start of a frame, after GPU2D
+     *        completed the previous one.
+     *
+     * @param completed The framebuffer of the last frame drawn, 0 if none.
+     * @param drawn     The framebuffer the frame starting is drawn into.
+     * @param frame     The number of the completed frame.
+     */
+    static void frameStarted(const uint16_t* completed, const uint16_t* drawn, uint32_t frame);
+
+    /**
+     * @fn static void ScreenCapture::run();
+     *
+     * @brief The loop of captureTask. Never returns.
+     */
+    static void run();
+
+    /**
+     * @fn static const Stats& ScreenCapture::getStats();
+     *
+     * @brief Gets the captures since the last reset.
+     *
+     * @return The statistics.
+     */
+    static const Stats& getStats()
+    {
+        return stats;
+    }
+
+    /**
+     * @fn static void ScreenCapture::resetStats();
+     *
+     * @brief Resets the statistics.
+     */
+    static void resetStats();
+
+private:
+    enum State
+    {
+        IDLE,    ///< Owned by the TouchGFX task
+        CAPTURE, ///< Owned by captureTask
+        ABORTED  ///< Given back by captureTask with the areas not sent
+    };
+
+    static bool isCaptured();
+    static void add(Rect* list, uint8_t& count, const Rect& rect);
+    static void capture();
+    static int16_t sendRows(const Rect& area);
+    static uint32_t encodeRow(const uint16_t* row, const uint16_t* above, int16_t width);
+    static void write(uint32_t word);
+
+    static Rect pending[TOUCHGFX_SCREEN_CAPTURE_AREAS]; ///< Drawn since the last capture
+    static uint8_t pendingCount;
+    static Rect areas[TOUCHGFX_SCREEN_CAPTURE_AREAS];   ///< Of the capture running, then not sent
+    static uint8_t areaCount;
+    static int16_t resumeY;              ///< Row the last capture cut short stopped at
+    static const uint16_t* frameBuffer;  ///< Of the capture running
+    static uint32_t frameNumber;
+    static uint32_t lastStart;           ///< Tick count of the last capture started
+    static bool connected;               ///< The port was enabled at the last frame
+    static bool announce;                ///< STREAM_BEGIN is written before the next capture
+    static volatile uint8_t state;
+    static volatile bool torn;           ///< The framebuffer of the capture is drawn into
+    static uint32_t budgetTick;          ///< Tick count the budget below is for
+    static uint32_t budgetWords;         ///< Words written in that tick
+    static void* volatile thread;
+    static Stats stats;
+};
+} // namespace touchgfx
+
+extern "C" void ScreenCapture_Task(void* argument);
+
+/* USER CODE END ScreenCapture.hpp */
+
+#endif // SCREENCAPTURE_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
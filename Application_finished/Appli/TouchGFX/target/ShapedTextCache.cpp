@@ -0,0 +1,151 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : ShapedTextCache.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include <ShapedTextCache.hpp>
+
+/* USER CODE BEGIN ShapedTextCache.cpp */
+#include <touchgfx/hal/HAL.hpp>
+#include <string.h>
+
+namespace touchgfx
+{
+ShapedTextCache* ShapedTextCache::instance = 0;
+
+ShapedTextCache::ShapedTextCache()
+    : lcd(0), numRuns(0), numGlyphs(0), overflowed(false)
+{
+    memset(index, 0, sizeof(index));
+    resetStats();
+}
+
+void ShapedTextCache::init(HybridLCDGPU2D& hybridLCD)
+{
+    lcd = &hybridLCD;
+    instance = this;
+}
+
+bool ShapedTextCache::drawString(TypedTextId id, const Rect& widgetArea, const Rect& invalidatedArea, const LCD::StringVisuals& visuals, const Unicode::UnicodeChar* text)
+{
+    // Not kept while the benchmark draws with another LCD
+    if (lcd == 0 || &HAL::lcd() != lcd || text == 0)
+    {
+        stats.uncached++;
+        return false;
+    }
+
+    Key key;
+    memset(&key, 0, sizeof(key));
+    key.text = text;
+    key.font = visuals.font;
+    key.id = id;
+    key.language = Texts::getLanguage();
+    key.width = widgetArea.width;
+    key.height = widgetArea.height;
+    key.linespace = visuals.linespace;
+    key.alignment = visuals.alignment;
+    key.textDirection = visuals.textDirection;
+    key.rotation = visuals.rotation;
+    key.indentation = visuals.indentation;
+    key.wideTextAction = visuals.wideTextAction;
+
+    uint16_t i = slot(key);
+    while (index[i] != 0)
+    {
+        const Run& run = runs[index[i] - 1];
+        if (sameKey(run.key, key))
+        {
+            stats.hits++;
+            lcd->drawRecordedGlyphs(widgetArea, invalidatedArea, &glyphs[run.first], run.count, visuals.color, visuals.alpha, visuals.rotation);
+            return true;
+        }
+        i = (i + 1) & (INDEX_SIZE - 1);
+    }
+
+    if (numRuns == TOUCHGFX_SHAPED_TEXT_RUNS || numGlyphs == TOUCHGFX_SHAPED_TEXT_GLYPHS)
+    {
+        overflowed = true;
+        stats.overflows++;
+        return false;
+    }
+    const int32_t count = lcd->recordString(widgetArea, visuals, text, &glyphs[numGlyphs], TOUCHGFX_SHAPED_TEXT_GLYPHS - numGlyphs);
+    if (count == -1)
+    {
+        overflowed = true;
+        stats.overflows++;
+        return false;
+    }
+    if (count < 0)
+    {
+        // Not drawn glyph by glyph, as with vector fonts
+        stats.uncached++;
+        return false;
+    }
+
+    Run& run = runs[numRuns++];
+    memcpy(&run.key, &key, sizeof(key));
+    run.first = numGlyphs;
+    run.count = (uint16_t)count;
+    numGlyphs += (uint16_t)count;
+    index[i] = (uint8_t)numRuns;
+    stats.recorded++;
+
+    lcd->drawRecordedGlyphs(widgetArea, invalidatedArea, &glyphs[run.first], run.count, visuals.color, visuals.alpha, visuals.rotation);
+    return true;
+}
+
+void ShapedTextCache::frameStarted()
+{
+    if (overflowed)
+    {
+        overflowed = false;
+        clear();
+    }
+}
+
+void ShapedTextCache::clear()
+{
+    if (numRuns > 0)
+    {
+        stats.clears++;
+    }
+    numRuns = 0;
+    numGlyphs = 0;
+    memset(index, 0, sizeof(index));
+}
+
+void ShapedTextCache::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+bool ShapedTextCache::sameKey(const Key& a, const Key& b)
+{
+    // Keys are zeroed and copied whole, so padding compares equal
+    return memcmp(&a, &b, sizeof(Key)) == 0;
+}
+
+uint16_t ShapedTextCache::slot(const Key& key) const
+{
+    const uint32_t h = ((uint32_t)key.id << 16) ^ ((uint32_t)key.language << 8) ^ (uint32_t)(uintptr_t)key.text ^ ((uint32_t)(uint16_t)key.width << 4);
+    return (uint16_t)((h * 2654435761U) >> 25);
+}
+} // namespace touchgfx
+
+/* USER CODE END ShapedTextCache.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
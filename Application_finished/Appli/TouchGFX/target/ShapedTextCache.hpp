@@ -0,0 +1,197 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : ShapedTextCache.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef SHAPEDTEXTCACHE_HPP
+#define SHAPEDTEXTCACHE_HPP
+
+#include <HybridLCDGPU2D.hpp>
+#include <touchgfx/Texts.hpp>
+#include <stdint.h>
+
+/* USER CODE BEGIN ShapedTextCache.hpp */
+
+/**
+ * Number of laid out strings kept, less than 128.
+ */
+#ifndef TOUCHGFX_SHAPED_TEXT_RUNS
+#define TOUCHGFX_SHAPED_TEXT_RUNS 64
+#endif
+
+/**
+ * Number of placed glyphs kept for all strings, 20 bytes each.
+ */
+#ifndef TOUCHGFX_SHAPED_TEXT_GLYPHS
+#define TOUCHGFX_SHAPED_TEXT_GLYPHS 1024
+#endif
+
+namespace touchgfx
+{
+/**
+ * @class ShapedTextCache
+ *
+ * @brief Keeps the glyphs of static texts as placed by LCD::drawString().
+ *
+ *        Every time a TextArea is drawn, drawString() walks the text, looks up every glyph
+ *        and its kerning, breaks and aligns the lines and skips the glyphs outside the
+ *        invalidated area, although a static text always ends up with the same glyphs in
+ *        the same places. drawString() lays out a text once, with
+ *        HybridLCDGPU2D::recordString(), and keeps the placed glyphs. Drawing the text again
+ *        only draws the kept glyphs, which are batched from the glyph atlas as usual.
+ *
+ *        A laid out text is found by its TypedTextId, the language, the text itself and
+ *        everything that places the glyphs: the size of the widget, font, alignment,
+ *        direction, rotation, line spacing, indentation and wide text action. Color and
+ *        alpha are applied when drawing. Texts with wildcards and vector fonts are not
+ *        kept. When a text does not fit, it is drawn as usual and frameStarted() clears
+ *        the cache.
+ *
+ *        Kept glyphs point into the fonts, so clear() must be called when glyphs of a font
+ *        cache are evicted or moved.
+ */
+class ShapedTextCache
+{
+public:
+    /** Lookups since the last reset. */
+    struct Stats
+    {
+        uint32_t hits;      ///< Texts drawn from kept glyphs
+        uint32_t recorded;  ///< Texts laid out and kept
+        uint32_t overflows; ///< Texts that did not fit in the cache
+        uint32_t clears;    ///< Times the cache was cleared
+        uint32_t uncached;  ///< Texts drawn as usual as they cannot be kept
+    };
+
+    ShapedTextCache();
+
+    /**
+     * @fn void ShapedTextCache::init(HybridLCDGPU2D& lcd);
+     *
+     * @brief Sets the LCD that texts are laid out and drawn with.
+     *
+     * @param [in] lcd The LCD.
+     */
+    void init(HybridLCDGPU2D& lcd);
+
+    /**
+     * @fn bool ShapedTextCache::drawString(TypedTextId id, const Rect& widgetArea, const Rect& invalidatedArea, const LCD::StringVisuals& visuals, const Unicode::UnicodeChar* text);
+     *
+     * @brief Draws a static text from its kept glyphs, laying it out first if needed.
+     *
+     * @param id              The TypedTextId of the text.
+     * @param widgetArea      The absolute area of the widget.
+     * @param invalidatedArea The area to draw, relative to the widget.
+     * @param visuals         The string visuals.
+     * @param text            The text, without wildcards.
+     *
+     * @return true if drawn, false if the text must be drawn with LCD::drawString().
+     */
+    bool drawString(TypedTextId id, const Rect& widgetArea, const Rect& invalidatedArea, const LCD::StringVisuals& visuals, const Unicode::UnicodeChar* text);
+
+    /**
+     * @fn void ShapedTextCache::frameStarted();
+     *
+     * @brief Clears the cache if a text did not fit in the previous frame.
+     */
+    void frameStarted();
+
+    /**
+     * @fn void ShapedTextCache::clear();
+     *
+     * @brief Removes all kept texts.
+     */
+    void clear();
+
+    /**
+     * @fn const Stats& ShapedTextCache::getStats() const;
+     *
+     * @brief Gets the lookup statistics.
+     *
+     * @return The lookup statistics.
+     */
+    const Stats& getStats() const
+    {
+        return stats;
+    }
+
+    /**
+     * @fn void ShapedTextCache::resetStats();
+     *
+     * @brief Resets the lookup statistics.
+     */
+    void resetStats();
+
+    /**
+     * @fn static ShapedTextCache* ShapedTextCache::getInstance();
+     *
+     * @brief Gets the initialized cache.
+     *
+     * @return The cache init() was last called on, or 0.
+     */
+    static ShapedTextCache* getInstance()
+    {
+        return instance;
+    }
+
+private:
+    static const uint16_t INDEX_SIZE = 128;
+
+    /** What places the glyphs of a text. */
+    struct Key
+    {
+        const Unicode::UnicodeChar* text;
+        const Font* font;
+        TypedTextId id;
+        LanguageId language;
+        int16_t width;
+        int16_t height;
+        int16_t linespace;
+        uint8_t alignment;
+        uint8_t textDirection;
+        uint8_t rotation;
+        uint8_t indentation;
+        uint8_t wideTextAction;
+    };
+
+    /** A laid out text. */
+    struct Run
+    {
+        Key key;
+        uint16_t first; ///< First glyph in the glyph pool
+        uint16_t count;
+    };
+
+    static bool sameKey(const Key& a, const Key& b);
+    uint16_t slot(const Key& key) const;
+
+    HybridLCDGPU2D* lcd;
+    Run runs[TOUCHGFX_SHAPED_TEXT_RUNS];
+    HybridLCDGPU2D::RecordedGlyph glyphs[TOUCHGFX_SHAPED_TEXT_GLYPHS];
+    uint8_t index[INDEX_SIZE]; ///< Run + 1 by hashed key, 0 if free
+    uint16_t numRuns;
+    uint16_t numGlyphs;
+    bool overflowed; ///< A text did not fit in the current frame
+    Stats stats;
+
+    static ShapedTextCache* instance;
+};
+} // namespace touchgfx
+
+/* USER CODE END ShapedTextCache.hpp */
+
+#endif // SHAPEDTEXTCACHE_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
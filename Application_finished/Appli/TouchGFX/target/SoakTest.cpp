@@ -0,0 +1,330 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : SoakTest.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include <SoakTest.hpp>
+
+/* USER CODE BEGIN SoakTest.cpp */
+#include <StartupTrace.hpp>
+#include <TraceOutput.hpp>
+#include <touchgfx/hal/HAL.hpp>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "stm32h7rsxx_hal.h"
+
+namespace touchgfx
+{
+SoakTest::Channel SoakTest::channels[TOUCHGFX_SOAK_CHANNELS];
+uint16_t SoakTest::numberOfChannels = 0;
+GenericCallback<>* SoakTest::sceneCallback = 0;
+bool SoakTest::running = false;
+uint32_t SoakTest::startMs = 0;
+uint32_t SoakTest::lastSampleMs = 0;
+uint32_t SoakTest::lastSceneMs = 0;
+uint32_t SoakTest::frameStart = 0;
+uint32_t SoakTest::frames = 0;
+uint64_t SoakTest::frameCyclesSum = 0;
+uint32_t SoakTest::frameCyclesMax = 0;
+uint32_t SoakTest::renderAverageUs = 0;
+uint32_t SoakTest::renderMaximumUs = 0;
+
+SoakTest::Log& SoakTest::log()
+{
+    return *reinterpret_cast<Log*>(StartupTrace::ADDRESS + LOG_OFFSET);
+}
+
+bool SoakTest::addChannel(const char* name, SampleFunction sample, const void* context, Trend trend)
+{
+    uint16_t index = 0;
+    while (index < numberOfChannels && strcmp(channels[index].name, name) != 0)
+    {
+        index++;
+    }
+    if (index == TOUCHGFX_SOAK_CHANNELS)
+    {
+        return false;
+    }
+    if (index == numberOfChannels)
+    {
+        numberOfChannels++;
+    }
+    Channel& channel = channels[index];
+    memset(&channel, 0, sizeof(channel));
+    channel.name = name;
+    channel.sample = sample;
+    channel.context = context;
+    channel.trend = trend;
+    return true;
+}
+
+void SoakTest::start()
+{
+    // Enabled by the boot loader, unless the application was started without it
+    __HAL_RCC_BKPRAM_CLK_ENABLE();
+    HAL_PWR_EnableBkUpAccess();
+
+    Log& l = log();
+    if (l.magic == LOG_MAGIC && l.written > 0)
+    {
+        tracePrintf("soak: log of the previous run");
+        reportLog();
+    }
+    l.magic = LOG_MAGIC;
+    l.channels = numberOfChannels;
+    l.written = 0;
+    l.sampleSeconds = TOUCHGFX_SOAK_SAMPLE_SECONDS;
+
+    for (uint16_t i = 0; i < numberOfChannels; i++)
+    {
+        Channel& channel = channels[i];
+        channel.n = channel.sumT = channel.sumY = channel.sumTT = channel.sumTY = channel.sumYY = 0.0;
+        channel.drifting = false;
+    }
+    frames = 0;
+    frameCyclesSum = 0;
+    frameCyclesMax = 0;
+    renderAverageUs = renderMaximumUs = 0;
+    startMs = lastSampleMs = lastSceneMs = HAL_GetTick();
+    running = true;
+    tracePrintf("soak: started channels=%u sample=%us scene=%us records=%lu",
+                (unsigned)numberOfChannels,
+                (unsigned)TOUCHGFX_SOAK_SAMPLE_SECONDS,
+                (unsigned)TOUCHGFX_SOAK_SCENE_SECONDS,
+                (unsigned long)LOG_RECORDS);
+}
+
+void SoakTest::frameStarted()
+{
+    if (running)
+    {
+        frameStart = HAL::getInstance()->getCPUCycles();
+    }
+}
+
+void SoakTest::frameEnded()
+{
+    if (!running)
+    {
+        return;
+    }
+    const uint32_t cycles = HAL::getInstance()->getCPUCycles() - frameStart;
+    frames++;
+    frameCyclesSum += cycles;
+    if (cycles > frameCyclesMax)
+    {
+        frameCyclesMax = cycles;
+    }
+}
+
+void SoakTest::tick()
+{
+    if (!running)
+    {
+        return;
+    }
+    const uint32_t now = HAL_GetTick();
+    if (TOUCHGFX_SOAK_SCENE_SECONDS > 0 && now - lastSceneMs >= TOUCHGFX_SOAK_SCENE_SECONDS * 1000U)
+    {
+        lastSceneMs = now;
+        if (sceneCallback && sceneCallback->isValid())
+        {
+            sceneCallback->execute();
+        }
+    }
+    if (now - lastSampleMs >= TOUCHGFX_SOAK_SAMPLE_SECONDS * 1000U)
+    {
+        // Sampled at the interval, even when a tick came late
+        lastSampleMs += TOUCHGFX_SOAK_SAMPLE_SECONDS * 1000U;
+        sample();
+    }
+}
+
+uint32_t SoakTest::getRenderAverageUs(const void* /*context*/)
+{
+    if (frames > 0)
+    {
+        renderAverageUs = (uint32_t)(frameCyclesSum / frames / (SystemCoreClock / 1000000U));
+    }
+    return renderAverageUs;
+}
+
+uint32_t SoakTest::getRenderMaximumUs(const void* /*context*/)
+{
+    if (frames > 0)
+    {
+        renderMaximumUs = frameCyclesMax / (SystemCoreClock / 1000000U);
+    }
+    return renderMaximumUs;
+}
+
+void SoakTest::sample()
+{
+    const uint32_t seconds = (lastSampleMs - startMs) / 1000U;
+    const double hours = seconds / 3600.0;
+    Log& l = log();
+    Record& record = l.records[l.written % LOG_RECORDS];
+    record.seconds = seconds;
+
+    char line[192];
+    int length = snprintf(line, sizeof(line), "soak %lus:", (unsigned long)seconds);
+    for (uint16_t i = 0; i < numberOfChannels; i++)
+    {
+        Channel& channel = channels[i];
+        const uint32_t value = channel.sample(channel.context);
+        record.values[i] = value;
+
+        const double y = (double)value;
+        channel.n += 1.0;
+        channel.sumT += hours;
+        channel.sumY += y;
+        channel.sumTT += hours * hours;
+        channel.sumTY += hours * y;
+        channel.sumYY += y * y;
+
+        if (length > 0 && length < (int)sizeof(line))
+        {
+            length += snprintf(line + length, sizeof(line) - length, " %s=%lu", channel.name, (unsigned long)value);
+        }
+    }
+    l.written++;
+    tracePrintf("%s", line);
+
+    frames = 0;
+    frameCyclesSum = 0;
+    frameCyclesMax = 0;
+
+    for (uint16_t i = 0; i < numberOfChannels; i++)
+    {
+        Channel& channel = channels[i];
+        Fit result;
+        fit(channel, result);
+        if (result.drifting && !channel.drifting)
+        {
+            tracePrintf("soak drift %s: after=%lus mean=%ld slope=%+ld/h t=%+ld change=%+ld%%",
+                        channel.name,
+                        (unsigned long)seconds,
+                        (long)result.mean,
+                        (long)result.slope,
+                        (long)result.t,
+                        (long)result.changePct);
+        }
+        channel.drifting = result.drifting;
+    }
+}
+
+void SoakTest::fit(const Channel& channel, Fit& result)
+{
+    memset(&result, 0, sizeof(result));
+    const double n = channel.n;
+    if (n < 1.0)
+    {
+        return;
+    }
+    result.mean = channel.sumY / n;
+    const double sxx = channel.sumTT - channel.sumT * channel.sumT / n;
+    if (n < 3.0 || sxx <= 0.0)
+    {
+        return;
+    }
+    const double sxy = channel.sumTY - channel.sumT * channel.sumY / n;
+    const double syy = channel.sumYY - channel.sumY * channel.sumY / n;
+    result.slope = sxy / sxx;
+
+    // Residuals around the line, rounding can take them below 0 for an exact fit
+    double residuals = syy - result.slope * sxy;
+    if (residuals < 0.0)
+    {
+        residuals = 0.0;
+    }
+    const double error = sqrt(residuals / (n - 2.0) / sxx);
+    if (error > 0.0)
+    {
+        result.t = result.slope / error;
+    }
+    else if (result.slope != 0.0)
+    {
+        // A perfectly straight slope, as significant as it gets
+        result.t = result.slope > 0.0 ? 1e9 : -1e9;
+    }
+
+    // The samples are evenly spread, the run lasts as long as the range of their times
+    const double hours = sqrt(12.0 * sxx / n);
+    if (result.mean != 0.0)
+    {
+        result.changePct = 100.0 * result.slope * hours / fabs(result.mean);
+    }
+
+    const bool worse = (channel.trend == WORSE_WHEN_HIGHER) ? (result.slope > 0.0) : (result.slope < 0.0);
+    result.drifting = worse
+                      && n >= TOUCHGFX_SOAK_MIN_SAMPLES
+                      && fabs(result.t) >= TOUCHGFX_SOAK_DRIFT_T
+                      && fabs(result.changePct) >= TOUCHGFX_SOAK_DRIFT_PERCENT;
+}
+
+void SoakTest::report()
+{
+    for (uint16_t i = 0; i < numberOfChannels; i++)
+    {
+        const Channel& channel = channels[i];
+        Fit result;
+        fit(channel, result);
+        tracePrintf("soak fit %s: samples=%lu mean=%ld slope=%+ld/h t=%+ld change=%+ld%% drift=%d",
+                    channel.name,
+                    (unsigned long)channel.n,
+                    (long)result.mean,
+                    (long)result.slope,
+                    (long)result.t,
+                    (long)result.changePct,
+                    result.drifting ? 1 : 0);
+    }
+}
+
+void SoakTest::reportLog()
+{
+    __HAL_RCC_BKPRAM_CLK_ENABLE();
+    const Log& l = log();
+    if (l.magic != LOG_MAGIC || l.channels > TOUCHGFX_SOAK_CHANNELS)
+    {
+        tracePrintf("soak log: empty");
+        return;
+    }
+    const uint32_t kept = l.written < LOG_RECORDS ? l.written : LOG_RECORDS;
+    tracePrintf("soak log: written=%lu kept=%lu sample=%lus",
+                (unsigned long)l.written,
+                (unsigned long)kept,
+                (unsigned long)l.sampleSeconds);
+    for (uint32_t i = l.written - kept; i < l.written; i++)
+    {
+        const Record& record = l.records[i % LOG_RECORDS];
+        char line[192];
+        int length = snprintf(line, sizeof(line), "soak log %lus:", (unsigned long)record.seconds);
+        for (uint32_t c = 0; c < l.channels && length > 0 && length < (int)sizeof(line); c++)
+        {
+            length += snprintf(line + length, sizeof(line) - length, " %s=%lu",
+                               c < numberOfChannels ? channels[c].name : "?",
+                               (unsigned long)record.values[c]);
+        }
+        tracePrintf("%s", line);
+    }
+}
+} // namespace touchgfx
+
+/* USER CODE END SoakTest.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,327 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : SoakTest.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef SOAKTEST_HPP
+#define SOAKTEST_HPP
+
+#include <touchgfx/Callback.hpp>
+#include <stdint.h>
+
+/* USER CODE BEGIN SoakTest.hpp */
+
+/**
+ * Set to 1 to start the soak test at startup, see TouchGFXHAL::startSoakTest().
+ */
+#ifndef TOUCHGFX_SOAK_TEST
+#define TOUCHGFX_SOAK_TEST 0
+#endif
+
+/**
+ * Seconds between two samples of the channels.
+ */
+#ifndef TOUCHGFX_SOAK_SAMPLE_SECONDS
+#define TOUCHGFX_SOAK_SAMPLE_SECONDS 60
+#endif
+
+/**
+ * Seconds between two executions of the scene callback, which moves the application on
+ * to the next scene of its script. 0 to never execute it.
+ */
+#ifndef TOUCHGFX_SOAK_SCENE_SECONDS
+#define TOUCHGFX_SOAK_SCENE_SECONDS 20
+#endif
+
+/**
+ * Largest number of channels sampled, and logged in every record of the log.
+ */
+#ifndef TOUCHGFX_SOAK_CHANNELS
+#define TOUCHGFX_SOAK_CHANNELS 8
+#endif
+
+/**
+ * Samples a channel must have before its trend is tested.
+ */
+#ifndef TOUCHGFX_SOAK_MIN_SAMPLES
+#define TOUCHGFX_SOAK_MIN_SAMPLES 30
+#endif
+
+/**
+ * Smallest t-statistic of the slope of a channel, the slope in units of its standard
+ * error, for the channel to drift.
+ */
+#ifndef TOUCHGFX_SOAK_DRIFT_T
+#define TOUCHGFX_SOAK_DRIFT_T 4
+#endif
+
+/**
+ * Smallest change of a channel over the run, in percent of its mean, for the channel to
+ * drift.
+ */
+#ifndef TOUCHGFX_SOAK_DRIFT_PERCENT
+#define TOUCHGFX_SOAK_DRIFT_PERCENT 10
+#endif
+
+namespace touchgfx
+{
+/**
+ * @class SoakTest
+ *
+ * @brief Runs the application for hours and finds the measurements that slowly get worse.
+ *
+ *        Render time, heap and pool fragmentation and cache hit rates that degrade over
+ *        hours do not show in a benchmark of a few seconds. While the soak test runs, the
+ *        channels registered with addChannel() are sampled every
+ *        TOUCHGFX_SOAK_SAMPLE_SECONDS, and the scene callback moves the application on to
+ *        its next scene every TOUCHGFX_SOAK_SCENE_SECONDS, so the scenes are entered and
+ *        left thousands of times.
+ *
+ *        Every sample is written over SWO as "soak <seconds>s: <name>=<value> ..." and
+ *        into a ring of records in backup SRAM, after the startup trace, which keeps the
+ *        last samples across a reset by the watchdog. The log of a previous run is
+ *        reported by start() before it is cleared.
+ *
+ *        A line is fitted to the samples of every channel by least squares over the
+ *        whole run. A channel drifts when the line goes the worse way for the channel,
+ *        with a t-statistic of at least TOUCHGFX_SOAK_DRIFT_T, and changes by at least
+ *        TOUCHGFX_SOAK_DRIFT_PERCENT of the mean over the run. Successive samples are not
+ *        independent, the t-statistic overstates the significance, which the large
+ *        threshold and the size of the change make up for. A channel that starts to drift
+ *        is reported as "soak drift <name>: ...".
+ *
+ *        The HAL calls frameStarted() and frameEnded() around every frame, and tick() at
+ *        every tick. The render time of the frames drawn since the previous sample is
+ *        read with getRenderAverageUs() and getRenderMaximumUs().
+ */
+class SoakTest
+{
+public:
+    /** Tells the value of a channel, called with the context given to addChannel(). */
+    typedef uint32_t (*SampleFunction)(const void* context);
+
+    /** Which way of a channel is worse. */
+    enum Trend
+    {
+        WORSE_WHEN_HIGHER, ///< For instance a render time or a fragmentation
+        WORSE_WHEN_LOWER   ///< For instance free bytes or a hit rate
+    };
+
+    /**
+     * @fn static bool SoakTest::addChannel(const char* name, SampleFunction sample, const void* context, Trend trend);
+     *
+     * @brief Registers a channel, or changes the channel registered with the name.
+     *
+     *        The channels must be registered before the soak test is started, the log
+     *        records their values in the order they were registered.
+     *
+     * @param name    Name of the channel, kept.
+     * @param sample  Tells the value of the channel. Called by tick(), so it must be quick.
+     * @param context Given to sample.
+     * @param trend   Which way of the channel is worse.
+     *
+     * @return false if TOUCHGFX_SOAK_CHANNELS channels are registered already.
+     */
+    static bool addChannel(const char* name, SampleFunction sample, const void* context, Trend trend);
+
+    /**
+     * @fn static void SoakTest::setSceneCallback(GenericCallback<>* callback);
+     *
+     * @brief Sets the callback that moves the application on to its next scene.
+     *
+     *        Executed from the TouchGFX task every TOUCHGFX_SOAK_SCENE_SECONDS while the
+     *        soak test runs. Pass 0 to remove the callback.
+     *
+     * @param callback The scene callback.
+     */
+    static void setSceneCallback(GenericCallback<>* callback)
+    {
+        sceneCallback = callback;
+    }
+
+    /**
+     * @fn static void SoakTest::start();
+     *
+     * @brief Starts the soak test, or starts it again.
+     *
+     *        Reports the log of a previous run found in backup SRAM, then clears the log
+     *        and the fitted lines.
+     */
+    static void start();
+
+    /**
+     * @fn static void SoakTest::stop();
+     *
+     * @brief Stops the soak test, the log is kept.
+     */
+    static void stop()
+    {
+        running = false;
+    }
+
+    /**
+     * @fn static bool SoakTest::isRunning();
+     *
+     * @brief Query if the soak test runs.
+     *
+     * @return true if the soak test runs.
+     */
+    static bool isRunning()
+    {
+        return running;
+    }
+
+    /**
+     * @fn static void SoakTest::frameStarted();
+     *
+     * @brief Starts the render time of a frame.
+     */
+    static void frameStarted();
+
+    /**
+     * @fn static void SoakTest::frameEnded();
+     *
+     * @brief Records the render time of a frame.
+     */
+    static void frameEnded();
+
+    /**
+     * @fn static void SoakTest::tick();
+     *
+     * @brief Executes the scene callback and samples the channels when they are due.
+     */
+    static void tick();
+
+    /**
+     * @fn static uint32_t SoakTest::getRenderAverageUs(const void* context);
+     *
+     * @brief Gets the average render time of the frames since the previous sample, a
+     *        SampleFunction.
+     *
+     * @param context Not used.
+     *
+     * @return The average render time in microseconds, the one of the previous sample if
+     *         no frame was drawn.
+     */
+    static uint32_t getRenderAverageUs(const void* context);
+
+    /**
+     * @fn static uint32_t SoakTest::getRenderMaximumUs(const void* context);
+     *
+     * @brief Gets the longest render time of the frames since the previous sample, a
+     *        SampleFunction.
+     *
+     * @param context Not used.
+     *
+     * @return The longest render time in microseconds, the one of the previous sample if
+     *         no frame was drawn.
+     */
+    static uint32_t getRenderMaximumUs(const void* context);
+
+    /**
+     * @fn static void SoakTest::report();
+     *
+     * @brief Reports the line fitted to every channel over SWO.
+     *
+     *        Reports, for every channel, the samples, the mean, the slope per hour, its
+     *        t-statistic, the change over the run in percent of the mean and whether the
+     *        channel drifts.
+     */
+    static void report();
+
+    /**
+     * @fn static void SoakTest::reportLog();
+     *
+     * @brief Reports the records of the log in backup SRAM over SWO, oldest first.
+     *
+     *        The channels are named as registered now, the log keeps their values only.
+     */
+    static void reportLog();
+
+private:
+    /** A channel registered with addChannel(), and the sums of its least squares fit. */
+    struct Channel
+    {
+        const char* name;
+        SampleFunction sample;
+        const void* context;
+        Trend trend;
+        double n;       ///< Samples
+        double sumT;    ///< Hours since the start
+        double sumY;
+        double sumTT;
+        double sumTY;
+        double sumYY;
+        bool drifting;  ///< Reported as drifting already
+    };
+
+    /** The fitted line of a channel. */
+    struct Fit
+    {
+        double mean;
+        double slope;      ///< Change per hour
+        double t;          ///< Slope in units of its standard error
+        double changePct;  ///< Change over the run in percent of the mean
+        bool drifting;
+    };
+
+    /** One sample of the channels. */
+    struct Record
+    {
+        uint32_t seconds; ///< Since the start of the run
+        uint32_t values[TOUCHGFX_SOAK_CHANNELS];
+    };
+
+    static const uint32_t LOG_MAGIC = 0x4B414F53U;   ///< "SOAK"
+    static const uint32_t LOG_OFFSET = 0x200U;       ///< After the startup trace
+    static const uint32_t BACKUP_SRAM_SIZE = 0x1000U;
+    static const uint32_t LOG_HEADER_SIZE = 16U;
+    static const uint32_t LOG_RECORDS = (BACKUP_SRAM_SIZE - LOG_OFFSET - LOG_HEADER_SIZE) / sizeof(Record);
+
+    /** The log, in backup SRAM. */
+    struct Log
+    {
+        uint32_t magic;         ///< LOG_MAGIC while the log is valid
+        uint32_t channels;      ///< Values in every record
+        uint32_t written;       ///< Records written since the start, the last LOG_RECORDS are kept
+        uint32_t sampleSeconds; ///< Seconds between two records
+        Record records[LOG_RECORDS];
+    };
+
+    static Log& log();
+    static void sample();
+    static void fit(const Channel& channel, Fit& result);
+
+    static Channel channels[TOUCHGFX_SOAK_CHANNELS];
+    static uint16_t numberOfChannels;
+    static GenericCallback<>* sceneCallback;
+    static bool running;
+    static uint32_t startMs;
+    static uint32_t lastSampleMs;
+    static uint32_t lastSceneMs;
+    static uint32_t frameStart;
+    static uint32_t frames;
+    static uint64_t frameCyclesSum;
+    static uint32_t frameCyclesMax;
+    static uint32_t renderAverageUs;
+    static uint32_t renderMaximumUs;
+};
+} // namespace touchgfx
+
+/* USER CODE END SoakTest.hpp */
+
+#endif // SOAKTEST_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
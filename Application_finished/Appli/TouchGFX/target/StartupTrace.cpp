@@ -0,0 +1,120 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : StartupTrace.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include <StartupTrace.hpp>
+
+/* USER CODE BEGIN StartupTrace.cpp */
+#include <TraceOutput.hpp>
+
+#include "stm32h7rsxx_hal.h"
+
+namespace
+{
+// Where the names of the phases are, in the internal flash of the boot loader or in the
+// octo-SPI flash of the application
+const uintptr_t BOOT_FLASH_START = 0x08000000U;
+const uintptr_t BOOT_FLASH_END = 0x08010000U;
+const uintptr_t APPLI_FLASH_START = 0x70000000U;
+const uintptr_t APPLI_FLASH_END = 0x78000000U;
+
+const char* getOwner(const char* name)
+{
+    const uintptr_t address = reinterpret_cast<uintptr_t>(name);
+    if (address >= BOOT_FLASH_START && address < BOOT_FLASH_END)
+    {
+        return "boot";
+    }
+    if (address >= APPLI_FLASH_START && address < APPLI_FLASH_END)
+    {
+        return "appli";
+    }
+    return 0;
+}
+} // namespace
+
+namespace touchgfx
+{
+void StartupTrace::mark(const char* name)
+{
+    const uint32_t cycles = DWT->CYCCNT;
+
+    // Enabled by the boot loader, unless the application was started without it
+    __HAL_RCC_BKPRAM_CLK_ENABLE();
+
+    const uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    Trace& t = trace();
+    if (t.magic == MAGIC && t.count > 0 && t.count < MAX_EVENTS)
+    {
+        Event& event = t.events[t.count];
+        event.cycles = cycles;
+        event.clockHz = t.events[t.count - 1].clockHz;
+        event.name = name;
+        t.count++;
+    }
+    __set_PRIMASK(primask);
+}
+
+bool StartupTrace::isValid()
+{
+    __HAL_RCC_BKPRAM_CLK_ENABLE();
+    const Trace& t = trace();
+    return t.magic == MAGIC && t.count > 0 && t.count <= MAX_EVENTS;
+}
+
+void StartupTrace::report()
+{
+    if (!isValid())
+    {
+        tracePrintf("startup: no trace from the boot loader");
+        return;
+    }
+
+    const Trace& t = trace();
+    uint64_t elapsedUs = 0;
+    for (uint32_t i = 1; i < t.count; i++)
+    {
+        const Event& previous = t.events[i - 1];
+        const Event& event = t.events[i];
+        // The cycles of a phase are counted at the clock set when the previous phase ended
+        const uint32_t clockHz = previous.clockHz != 0 ? previous.clockHz : SystemCoreClock;
+        const uint32_t phaseUs = (uint32_t)(((uint64_t)(event.cycles - previous.cycles) * 1000000U + clockHz / 2) / clockHz);
+        elapsedUs += phaseUs;
+
+        const char* owner = getOwner(event.name);
+        tracePrintf("startup: %-5s %-28s +%8luus at %8luus",
+                    owner != 0 ? owner : "?",
+                    owner != 0 ? event.name : "?",
+                    (unsigned long)phaseUs,
+                    (unsigned long)elapsedUs);
+    }
+    tracePrintf("startup: total=%luus phases=%lu full=%d",
+                (unsigned long)elapsedUs,
+                (unsigned long)(t.count - 1),
+                t.count == MAX_EVENTS ? 1 : 0);
+}
+} // namespace touchgfx
+
+extern "C" void StartupTrace_Mark(const char* name)
+{
+    touchgfx::StartupTrace::mark(name);
+}
+
+/* USER CODE END StartupTrace.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
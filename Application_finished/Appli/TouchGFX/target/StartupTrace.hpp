@@ -0,0 +1,127 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : StartupTrace.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef STARTUPTRACE_HPP
+#define STARTUPTRACE_HPP
+
+#include <stdint.h>
+
+/* USER CODE BEGIN StartupTrace.hpp */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Records the end of a startup phase from C code, see touchgfx::StartupTrace::mark().
+ *
+ * @param name The phase, a string literal.
+ */
+void StartupTrace_Mark(const char* name);
+
+#ifdef __cplusplus
+}
+
+namespace touchgfx
+{
+/**
+ * @class StartupTrace
+ *
+ * @brief The startup timeline, from the reset of the boot loader to the first frame.
+ *
+ *        The boot loader starts the DWT cycle counter from 0 first in main() and records
+ *        the end of each of its startup phases in backup SRAM, see startup_trace.h of the
+ *        boot loader. Backup SRAM is not cleared by the jump to the application, which
+ *        keeps the counter running and adds its own phases to the same trace, up to the
+ *        first frame shown. report() then writes the timeline over SWO.
+ *
+ *        The layout of the trace is shared with the boot loader. Events of a boot loader
+ *        built without the trace are not found, and mark() then records nothing.
+ */
+class StartupTrace
+{
+public:
+    static const uint32_t MAGIC = 0x54525453U;   ///< "STRT"
+    static const uint32_t ADDRESS = 0x38800000U; ///< Backup SRAM
+    static const uint32_t MAX_EVENTS = 32U;
+
+    /** The end of a startup phase. */
+    struct Event
+    {
+        uint32_t cycles;  ///< DWT cycle counter at the end of the phase
+        uint32_t clockHz; ///< Core clock from the end of the phase on
+        const char* name; ///< The phase, in the flash of the boot loader or of the application
+    };
+
+    /** Startup trace, at the start of backup SRAM. */
+    struct Trace
+    {
+        uint32_t magic; ///< MAGIC while the trace is valid
+        uint32_t count; ///< Number of events recorded
+        Event events[MAX_EVENTS];
+    };
+
+    /**
+     * @fn static void StartupTrace::mark(const char* name);
+     *
+     * @brief Records the end of a startup phase.
+     *
+     *        Records the end of a startup phase. The application runs at the clock the
+     *        boot loader configured, so the clock of the phase that follows is the one of
+     *        the previous event, even before SystemCoreClockUpdate(). Can be called from
+     *        interrupt context.
+     *
+     * @param name The phase, a string literal.
+     */
+    static void mark(const char* name);
+
+    /**
+     * @fn static bool StartupTrace::isValid();
+     *
+     * @brief Tells if the boot loader has started a trace.
+     *
+     * @return true if the events of the boot loader are in backup SRAM.
+     */
+    static bool isValid();
+
+    /**
+     * @fn static void StartupTrace::report();
+     *
+     * @brief Reports the startup timeline over SWO.
+     *
+     *        Reports every phase recorded with its duration and its end since the reset,
+     *        in microseconds, and whether the boot loader or the application ran it. The
+     *        time from the reset to main() of the boot loader is not included. Must not be
+     *        called from interrupt context.
+     */
+    static void report();
+
+private:
+    static Trace& trace()
+    {
+        return *reinterpret_cast<Trace*>(ADDRESS);
+    }
+};
+} // namespace touchgfx
+
+#endif
+
+/* USER CODE END StartupTrace.hpp */
+
+#endif // STARTUPTRACE_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
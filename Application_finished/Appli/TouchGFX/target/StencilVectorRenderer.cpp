@@ -0,0 +1,87 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : StencilVectorRenderer.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include <StencilVectorRenderer.hpp>
+
+/* USER CODE BEGIN StencilVectorRenderer.cpp */
+#include <touchgfx/hal/HAL.hpp>
+#include <touchgfx/transforms/DisplayTransformation.hpp>
+#include <nema_vg_context.h>
+#include <HybridLCDGPU2D.hpp>
+#include <QualityGovernor.hpp>
+
+namespace touchgfx
+{
+StencilVectorRenderer::StencilVectorRenderer()
+    : GPU2DVectorRenderer(), area(), matrix()
+{
+}
+
+void StencilVectorRenderer::setup(const Rect& canvasAreaAbs, const Rect& invalidatedAreaRel)
+{
+    area = Rect(canvasAreaAbs.x + invalidatedAreaRel.x, canvasAreaAbs.y + invalidatedAreaRel.y, invalidatedAreaRel.width, invalidatedAreaRel.height) & canvasAreaAbs;
+    if (HAL::DISPLAY_ROTATION != rotate0)
+    {
+        DisplayTransformation::transformDisplayToFrameBuffer(area);
+    }
+    GPU2DVectorRenderer::setup(canvasAreaAbs, invalidatedAreaRel);
+}
+
+void StencilVectorRenderer::drawPath(const uint8_t* cmds, uint32_t nCmds, const float* points, uint32_t nPoints, const float* bbox)
+{
+    HybridLCDGPU2D* const lcd = HybridLCDGPU2D::getInstance();
+    if (lcd != 0)
+    {
+        lcd->countStencil(area);
+    }
+    nema_vg_set_quality(QualityGovernor::vectorQuality(screenSize(bbox)));
+    GPU2DVectorRenderer::drawPath(cmds, nCmds, points, nPoints, bbox);
+}
+
+void StencilVectorRenderer::setTransformationMatrix(const Matrix3x3& m)
+{
+    matrix = m;
+    GPU2DVectorRenderer::setTransformationMatrix(m);
+}
+
+float StencilVectorRenderer::screenSize(const float* bbox) const
+{
+    if (bbox == 0)
+    {
+        return 0.0f;
+    }
+    // The corners of the bounding box, min x, min y, max x, max y, rotated or skewed
+    float minX = 0.0f;
+    float minY = 0.0f;
+    float maxX = 0.0f;
+    float maxY = 0.0f;
+    for (int corner = 0; corner < 4; corner++)
+    {
+        const Matrix3x3::Point p = matrix.affineTransform(bbox[(corner & 1) ? 2 : 0], bbox[(corner & 2) ? 3 : 1]);
+        minX = (corner == 0 || p.x < minX) ? p.x : minX;
+        minY = (corner == 0 || p.y < minY) ? p.y : minY;
+        maxX = (corner == 0 || p.x > maxX) ? p.x : maxX;
+        maxY = (corner == 0 || p.y > maxY) ? p.y : maxY;
+    }
+    return MAX(maxX - minX, maxY - minY);
+}
+} // namespace touchgfx
+
+/* USER CODE END StencilVectorRenderer.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
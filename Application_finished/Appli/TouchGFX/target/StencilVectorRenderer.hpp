@@ -0,0 +1,71 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : StencilVectorRenderer.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef STENCILVECTORRENDERER_HPP
+#define STENCILVECTORRENDERER_HPP
+
+#include <touchgfx_nema/GPU2DVectorRenderer.hpp>
+#include <touchgfx/Matrix3x3.hpp>
+
+/* USER CODE BEGIN StencilVectorRenderer.hpp */
+
+namespace touchgfx
+{
+/**
+ * @class StencilVectorRenderer
+ *
+ * @brief Draws vector widgets with GPU2DVectorRenderer, counting the stencil they need
+ *        and drawing small paths faster.
+ *
+ *        Each path touches the stencil of NemaVG over the invalidated part of its canvas,
+ *        in framebuffer coordinates. The areas are counted in the statistics of
+ *        HybridLCDGPU2D, so the largest extent reported on SWO tells how large the stencil
+ *        must be for the vector widgets of the application.
+ *
+ *        GPU2DVectorRenderer locks the framebuffer in setup() and draws from pixel 0, 0, so
+ *        its paths are not split in tiles like the TSVG images of HybridLCDGPU2D::drawTSVG().
+ *        With NEMA_HAL_STENCIL_TILE_WIDTH set, vector widgets must stay inside the tile, and
+ *        the paths reaching past it are counted as clipped.
+ *
+ *        The bounding box of each path is transformed to the screen, and the quality of
+ *        NemaVG chosen from its size by QualityGovernor::vectorQuality(), so the small
+ *        icons and glyphs of vector fonts are drawn with the faster anti-aliasing.
+ */
+class StencilVectorRenderer : public GPU2DVectorRenderer
+{
+public:
+    StencilVectorRenderer();
+
+    virtual void setup(const Rect& canvasAreaAbs, const Rect& invalidatedAreaRel);
+
+    virtual void drawPath(const uint8_t* cmds, uint32_t nCmds, const float* points, uint32_t nPoints, const float* bbox);
+
+    virtual void setTransformationMatrix(const Matrix3x3& m);
+
+private:
+    float screenSize(const float* bbox) const;
+
+    Rect area;          ///< The absolute invalidated area of the canvas
+    Matrix3x3 matrix;   ///< Transforms the points of the paths to the canvas
+};
+} // namespace touchgfx
+
+/* USER CODE END StencilVectorRenderer.hpp */
+
+#endif // STENCILVECTORRENDERER_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
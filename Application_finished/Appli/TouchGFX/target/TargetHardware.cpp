@@ -0,0 +1,439 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : TargetHardware.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include <gui/common/TargetHardware.hpp>
+
+/* USER CODE BEGIN TargetHardware.cpp */
+#include <TouchGFXHAL.hpp>
+#include <DCacheMaintenance.hpp>
+#include <GlyphAtlas.hpp>
+#include <MemoryBudget.hpp>
+#include <ModelChannel.hpp>
+#include <ModelWorker.hpp>
+#include <QualityGovernor.hpp>
+#include <ShapedTextCache.hpp>
+#include <SoakTest.hpp>
+#include <TouchPredictor.hpp>
+#include <WidgetProfiler.hpp>
+#include <string.h>
+
+#include "stm32h7rsxx.h"
+
+using namespace touchgfx;
+
+namespace
+{
+TouchGFXHAL& hal()
+{
+    return *static_cast<TouchGFXHAL*>(HAL::getInstance());
+}
+
+// The buffers of the GUI whose use is measured, by name as in MemoryBudget
+const uint16_t MEMORY_USERS = 4;
+
+struct MemoryUser
+{
+    const char* name;
+    TargetHardware::MemoryUsageFunction usage;
+    const void* context;
+};
+
+MemoryUser memoryUsers[MEMORY_USERS];
+
+void memoryUsage(const void* context, MemoryBudget::Usage& usage)
+{
+    const MemoryUser& user = *static_cast<const MemoryUser*>(context);
+    user.usage(user.context, usage.used, usage.peak);
+}
+
+struct MessageReceiver : public ModelChannel::Handler
+{
+    MessageReceiver(TargetHardware::ModelMessageFunction function, void* functionContext)
+        : receive(function), context(functionContext)
+    {
+    }
+
+    virtual void handle(const ModelChannel::Message& message)
+    {
+        receive(context, message.topic, message.data, message.size);
+    }
+
+    TargetHardware::ModelMessageFunction receive;
+    void* context;
+};
+
+HybridLCDGPU2D::TransitionEffect transitionEffect(TargetHardware::TransitionEffect effect)
+{
+    switch (effect)
+    {
+    case TargetHardware::TRANSITION_CUBE:
+        return HybridLCDGPU2D::TRANSITION_CUBE;
+    case TargetHardware::TRANSITION_INNER_CUBE:
+        return HybridLCDGPU2D::TRANSITION_INNER_CUBE;
+    case TargetHardware::TRANSITION_STACK:
+        return HybridLCDGPU2D::TRANSITION_STACK;
+    default:
+        return HybridLCDGPU2D::TRANSITION_FADE_ZOOM;
+    }
+}
+} // namespace
+
+bool TargetHardware::isAccelerated()
+{
+    return true;
+}
+
+void TargetHardware::cleanDCache(const void* data, uint32_t size)
+{
+    DCacheMaintenance::clean(data, size);
+}
+
+void TargetHardware::invalidateDCache(const void* data, uint32_t size)
+{
+    DCacheMaintenance::invalidate(data, size);
+}
+
+void TargetHardware::synchronizeCode()
+{
+    // ITCM is not cached, the copied code only has to be written before it is fetched
+    __DSB();
+    __ISB();
+}
+
+bool TargetHardware::canDrawInDynamicBitmap(Bitmap::BitmapFormat format)
+{
+    return hal().canDrawInDynamicBitmap(format);
+}
+
+bool TargetHardware::setFrameBufferFormat(Bitmap::BitmapFormat format)
+{
+    return hal().setFrameBufferFormat(format);
+}
+
+bool TargetHardware::drawScaledBitmap(const Bitmap& bitmap, const Rect& dest, const Rect& clip, uint8_t alpha, bool bilinear)
+{
+    return hal().drawScaledBitmap(bitmap, dest, clip, alpha, bilinear);
+}
+
+bool TargetHardware::drawTiledBitmap(const Bitmap& bitmap, int16_t x, int16_t y, int16_t xOffset, int16_t yOffset, const Rect& clip, uint8_t alpha)
+{
+    return hal().drawTiledBitmap(bitmap, x, y, xOffset, yOffset, clip, alpha);
+}
+
+bool TargetHardware::drawTextureQuads(const Bitmap& bitmap, const float* corners, uint16_t count, int16_t x, int16_t y, const Rect& clip, uint8_t alpha, bool bilinear)
+{
+    return hal().drawTextureQuads(bitmap, corners, count, x, y, clip, alpha, bilinear);
+}
+
+bool TargetHardware::drawA8Mask(const uint8_t* mask, uint16_t width, uint16_t height, int16_t x, int16_t y, const Rect& clip, colortype color, uint8_t alpha)
+{
+    return hal().drawA8Mask(mask, width, height, x, y, clip, color, alpha);
+}
+
+bool TargetHardware::canDrawMaskedBitmap(const Bitmap& bitmap)
+{
+    return hal().canDrawMaskedBitmap(bitmap);
+}
+
+bool TargetHardware::drawMaskedBitmap(const uint8_t* mask, uint16_t width, uint16_t height, int16_t x, int16_t y, const Bitmap& bitmap, int16_t u, int16_t v, const Rect& clip, uint8_t alpha)
+{
+    return hal().drawMaskedBitmap(mask, width, height, x, y, bitmap, u, v, clip, alpha);
+}
+
+bool TargetHardware::renderStringMask(const Rect& widgetArea, const LCD::StringVisuals& visuals, const Unicode::UnicodeChar* text, uint8_t* mask)
+{
+    return hal().renderStringMask(widgetArea, visuals, text, mask);
+}
+
+bool TargetHardware::drawTSVG(const void* tsvg, const Matrix3x3& transform, const Rect& clip, float size)
+{
+    return hal().drawTSVG(tsvg, transform, clip, size);
+}
+
+bool TargetHardware::drawTransition(TransitionEffect effect, bool vertical, bool reverse, const Bitmap& from, const Bitmap& to, float step, const Rect& clip)
+{
+    return hal().drawTransition(transitionEffect(effect), vertical, reverse, from, to, step, clip);
+}
+
+uint32_t TargetHardware::kickGPU2D()
+{
+    return hal().kickGPU2D();
+}
+
+void TargetHardware::waitForKick(uint32_t kick)
+{
+    hal().waitForKick(kick);
+}
+
+TargetHardware::FragmentResult TargetHardware::beginFragment(const void* owner, uint32_t version, const Rect& area)
+{
+    switch (hal().beginFragment(owner, version, area))
+    {
+    case HybridLCDGPU2D::FRAGMENT_REPLAYED:
+        return FRAGMENT_REPLAYED;
+    case HybridLCDGPU2D::FRAGMENT_RECORDING:
+        return FRAGMENT_RECORDING;
+    default:
+        return FRAGMENT_UNAVAILABLE;
+    }
+}
+
+bool TargetHardware::endFragment()
+{
+    return hal().endFragment();
+}
+
+void TargetHardware::discardFragments(const void* owner)
+{
+    hal().discardFragments(owner);
+}
+
+bool TargetHardware::copyPreviousFrame(const Rect& area, int16_t dx, int16_t dy)
+{
+    return hal().copyPreviousFrame(area, dx, dy);
+}
+
+bool TargetHardware::tracksFrameBufferAge()
+{
+    return true;
+}
+
+uint32_t TargetHardware::getFrameNumber()
+{
+    return hal().getFrameNumber();
+}
+
+uint8_t TargetHardware::getClientFrameBufferAge()
+{
+    return hal().getClientFrameBufferAge();
+}
+
+bool TargetHardware::isFrameSkipped()
+{
+    return hal().isFrameSkipped();
+}
+
+uint16_t TargetHardware::getTileSize()
+{
+    return TOUCHGFX_TILE_HASH ? TOUCHGFX_TILE_HASH_SIZE : 0;
+}
+
+bool TargetHardware::isTileUnchanged(uint16_t column, uint16_t row)
+{
+    return hal().isTileUnchanged(column, row);
+}
+
+uint32_t TargetHardware::getTickDeltaUs()
+{
+    return hal().getTickDeltaUs();
+}
+
+uint32_t TargetHardware::getRefreshPeriodUs()
+{
+    return hal().getRefreshPeriodUs();
+}
+
+uint8_t TargetHardware::getScalePercent()
+{
+    return hal().getDynamicResolution().getScalePercent();
+}
+
+void TargetHardware::waitForAssetUploads()
+{
+    hal().getAssetUploads().waitForHighPriority();
+}
+
+bool TargetHardware::prefetchTexture(BitmapId id)
+{
+    return hal().getTextureCache().prefetch(id);
+}
+
+bool TargetHardware::cacheTextureRotated(BitmapId id)
+{
+    return hal().getTextureCache().cacheRotated(id);
+}
+
+BitmapId TargetHardware::cacheTexturePremultiplied(BitmapId id)
+{
+    return hal().getTextureCache().cachePremultiplied(id);
+}
+
+void TargetHardware::clearTextureCache()
+{
+    hal().getTextureCache().clear();
+}
+
+bool TargetHardware::generateMipChain(BitmapId id)
+{
+    return hal().getMipChain().generate(id);
+}
+
+void TargetHardware::clearMipChain()
+{
+    hal().getMipChain().clear();
+}
+
+bool TargetHardware::pinBackgroundLayer(const Bitmap& bitmap)
+{
+#if TOUCHGFX_BACKGROUND_LAYER
+    return hal().getBackgroundLayer().pin(bitmap);
+#else
+    (void)bitmap;
+    return false;
+#endif
+}
+
+void TargetHardware::unpinBackgroundLayer()
+{
+    hal().getBackgroundLayer().unpin();
+}
+
+colortype TargetHardware::getBackgroundColorKey()
+{
+    return BackgroundLayer::getColorKey();
+}
+
+bool TargetHardware::hasOverlayLayer()
+{
+    return TOUCHGFX_OVERLAY_LAYER;
+}
+
+bool TargetHardware::showOverlayLayer(const Bitmap& bitmap, int16_t x, int16_t y)
+{
+    return hal().getOverlayLayer().show(bitmap, x, y);
+}
+
+void TargetHardware::hideOverlayLayer()
+{
+    hal().getOverlayLayer().hide();
+}
+
+bool TargetHardware::prefetchGlyph(const uint8_t* glyphData, uint16_t width, uint16_t height)
+{
+    GlyphAtlas::Location location;
+    return GlyphAtlas::find(glyphData, width, height, location);
+}
+
+bool TargetHardware::drawShapedString(TypedTextId id, const Rect& widgetArea, const Rect& invalidatedArea, const LCD::StringVisuals& visuals, const Unicode::UnicodeChar* text)
+{
+    ShapedTextCache* const cache = ShapedTextCache::getInstance();
+    return cache != 0 && cache->drawString(id, widgetArea, invalidatedArea, visuals, text);
+}
+
+void TargetHardware::clearShapedText()
+{
+    ShapedTextCache* const cache = ShapedTextCache::getInstance();
+    if (cache != 0)
+    {
+        cache->clear();
+    }
+}
+
+uint16_t TargetHardware::getGradientStep()
+{
+    return QualityGovernor::current().gradientStep;
+}
+
+void TargetHardware::disableTouchPrediction()
+{
+    TouchPredictor::disableForGesture();
+}
+
+uint32_t TargetHardware::widgetDrawStarted()
+{
+#if TOUCHGFX_WIDGET_PROFILE
+    return WidgetProfiler::drawStarted();
+#else
+    return 0;
+#endif
+}
+
+void TargetHardware::widgetDrawEnded(const void* drawable, uint32_t start)
+{
+#if TOUCHGFX_WIDGET_PROFILE
+    WidgetProfiler::drawEnded(drawable, start);
+#else
+    (void)drawable;
+    (void)start;
+#endif
+}
+
+void TargetHardware::addMemoryBudget(const char* name, const void* base, uint32_t size, MemoryUsageFunction usage, const void* context)
+{
+    if (usage == 0)
+    {
+        MemoryBudget::add(name, base, size);
+        return;
+    }
+    uint16_t index = 0;
+    while (index < MEMORY_USERS && memoryUsers[index].name != 0 && strcmp(memoryUsers[index].name, name) != 0)
+    {
+        index++;
+    }
+    if (index == MEMORY_USERS)
+    {
+        // Counted as all in use
+        MemoryBudget::add(name, base, size);
+        return;
+    }
+    MemoryUser& user = memoryUsers[index];
+    user.name = name;
+    user.usage = usage;
+    user.context = context;
+    MemoryBudget::add(name, base, size, memoryUsage, &user);
+}
+
+void TargetHardware::addSoakChannel(const char* name, SoakSampleFunction sample, const void* context, bool worseWhenHigher)
+{
+    SoakTest::addChannel(name, sample, context, worseWhenHigher ? SoakTest::WORSE_WHEN_HIGHER : SoakTest::WORSE_WHEN_LOWER);
+}
+
+void TargetHardware::setSoakSceneCallback(GenericCallback<>* callback)
+{
+    hal().setSoakSceneCallback(callback);
+}
+
+void TargetHardware::setBenchmarkSceneCallback(GenericCallback<>* callback)
+{
+    hal().setBenchmarkSceneCallback(callback);
+}
+
+void TargetHardware::startModelWorker(ModelWorkFunction work, void* context, void* slots, uint32_t slotSize)
+{
+    ModelChannel::getInstance()->init();
+    ModelWorker::init(work, context, slots, slotSize);
+}
+
+void TargetHardware::requestModelState(uint32_t tick)
+{
+    ModelWorker::request(tick);
+}
+
+const void* TargetHardware::acquireModelState()
+{
+    return ModelWorker::acquire();
+}
+
+void TargetHardware::drainModelMessages(ModelMessageFunction receive, void* context)
+{
+    MessageReceiver receiver(receive, context);
+    ModelChannel::getInstance()->drain(receiver);
+}
+/* USER CODE END TargetHardware.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
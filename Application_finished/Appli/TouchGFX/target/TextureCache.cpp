@@ -0,0 +1,505 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : TextureCache.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include <TextureCache.hpp>
+
+/* USER CODE BEGIN TextureCache.cpp */
+#include <CortexMMCUInstrumentation.hpp>
+#include <AssetUploadQueue.hpp>
+#include <DCacheMaintenance.hpp>
+#include <HybridLCDGPU2D.hpp>
+#include <JPEGImageLoader.hpp>
+#include <MemoryBudget.hpp>
+#include <PixelConversion.hpp>
+#include <string.h>
+
+namespace
+{
+#if TOUCHGFX_TEXTURE_CACHE_SIZE > 0
+// Kept in AXI SRAM with the rest of .bss
+uint16_t textureCache[TOUCHGFX_TEXTURE_CACHE_SIZE / 2];
+#endif
+
+uint32_t bitmapBytes(const touchgfx::Bitmap& bitmap)
+{
+    const uint32_t pixels = (uint32_t)bitmap.getWidth() * bitmap.getHeight();
+    switch (bitmap.getFormat())
+    {
+    case touchgfx::Bitmap::COMPRESSED_RGB565:
+        return pixels * 2;
+    case touchgfx::Bitmap::COMPRESSED_RGB888:
+        return pixels * 3;
+    case touchgfx::Bitmap::COMPRESSED_ARGB8888:
+        return pixels * 4;
+    default:
+        break;
+    }
+    uint32_t bytes = touchgfx::CortexMMCUInstrumentation::pixelBytes(bitmap.getFormat(), pixels);
+    if (bitmap.getExtraData() != 0 && bitmap.getFormat() == touchgfx::Bitmap::RGB565)
+    {
+        // Separate 8-bit alpha channel
+        bytes += pixels;
+    }
+    return bytes;
+}
+
+#if TOUCHGFX_TEXTURE_CACHE_SIZE > 0
+void cacheUsage(const void* context, touchgfx::MemoryBudget::Usage& usage)
+{
+    usage.used = static_cast<const touchgfx::TextureCache*>(context)->getCachedBytes();
+}
+#endif
+}
+
+namespace touchgfx
+{
+TextureCache* TextureCache::instance = 0;
+
+TextureCache::TextureCache()
+    : bitmapCount(0), frame(0), prefetched(BITMAP_INVALID)
+{
+    for (int i = 0; i < TOUCHGFX_TEXTURE_CACHE_ENTRIES; i++)
+    {
+        memset(&entries[i], 0, sizeof(entries[i]));
+        entries[i].id = BITMAP_INVALID;
+    }
+    for (int i = 0; i < TOUCHGFX_PREMULTIPLIED_BITMAPS; i++)
+    {
+        premultiplied[i] = BITMAP_INVALID;
+    }
+}
+
+void TextureCache::init(uint16_t numberOfBitmaps)
+{
+    bitmapCount = numberOfBitmaps;
+#if TOUCHGFX_TEXTURE_CACHE_SIZE > 0
+    Bitmap::setCache(textureCache, sizeof(textureCache), TOUCHGFX_DYNAMIC_BITMAPS);
+    instance = this;
+    MemoryBudget::add("bitmap cache", textureCache, sizeof(textureCache), cacheUsage, this);
+#endif
+}
+
+uint32_t TextureCache::getCachedBytes() const
+{
+    uint32_t bytes = 0;
+    for (uint32_t id = 0; id < (uint32_t)bitmapCount + TOUCHGFX_DYNAMIC_BITMAPS; id++)
+    {
+        const bool cached = (id < bitmapCount) ? Bitmap::cacheIsCached((BitmapId)id) : Bitmap::dynamicBitmapGetAddress((BitmapId)id) != 0;
+        if (cached)
+        {
+            bytes += bitmapBytes(Bitmap((BitmapId)id));
+        }
+    }
+    return bytes;
+}
+
+bool TextureCache::cacheRotated(BitmapId id)
+{
+    Entry* const entry = findOrAdd(id);
+    if (entry == 0 || !cacheBitmap(id))
+    {
+        return false;
+    }
+    entry->pinned = true;
+    return true;
+}
+
+BitmapId TextureCache::cacheConverted(BitmapId id, Bitmap::BitmapFormat format)
+{
+    const Bitmap bitmap(id);
+    const Bitmap::BitmapFormat from = bitmap.getFormat();
+    if (bitmap.getData() == 0 || !PixelConversion::canConvert(from, format))
+    {
+        return BITMAP_INVALID;
+    }
+    const uint16_t width = bitmap.getWidth();
+    const uint16_t height = bitmap.getHeight();
+    const BitmapId copy = Bitmap::dynamicBitmapCreate(width, height, format);
+    if (copy == BITMAP_INVALID)
+    {
+        return BITMAP_INVALID;
+    }
+    // The palette of an L8 bitmap is its extra data
+    const uint8_t* const clut = (from == Bitmap::L8) ? bitmap.getExtraData() : 0;
+    if (!PixelConversion::convert(bitmap.getData(), from, width, clut,
+                                  Bitmap::dynamicBitmapGetAddress(copy), format, width, width, height))
+    {
+        Bitmap::dynamicBitmapDelete(copy);
+        return BITMAP_INVALID;
+    }
+    return copy;
+}
+
+BitmapId TextureCache::cachePremultiplied(BitmapId id)
+{
+    const Bitmap bitmap(id);
+    if (isPremultiplied(bitmap.getData()))
+    {
+        return id;
+    }
+    int slot = -1;
+    for (int i = 0; i < TOUCHGFX_PREMULTIPLIED_BITMAPS && slot < 0; i++)
+    {
+        if (premultiplied[i] == BITMAP_INVALID)
+        {
+            slot = i;
+        }
+    }
+    if (slot < 0 || bitmap.getData() == 0 || bitmap.getFormat() != Bitmap::ARGB8888)
+    {
+        return BITMAP_INVALID;
+    }
+    const uint16_t width = bitmap.getWidth();
+    const uint16_t height = bitmap.getHeight();
+    const BitmapId copy = Bitmap::dynamicBitmapCreate(width, height, Bitmap::ARGB8888);
+    if (copy == BITMAP_INVALID)
+    {
+        return BITMAP_INVALID;
+    }
+    uint32_t* const pixels = reinterpret_cast<uint32_t*>(Bitmap::dynamicBitmapGetAddress(copy));
+    const uint32_t count = (uint32_t)width * height;
+    memcpy(pixels, bitmap.getData(), count * 4);
+    PixelConversion::premultiply(pixels, count);
+    // Written by the CPU, GPU2D reads AXI SRAM past the data cache
+    DCacheMaintenance::clean(pixels, count * 4);
+    premultiplied[slot] = copy;
+    return copy;
+}
+
+void TextureCache::releasePremultiplied(BitmapId copy)
+{
+    for (int i = 0; i < TOUCHGFX_PREMULTIPLIED_BITMAPS; i++)
+    {
+        if (premultiplied[i] == copy && copy != BITMAP_INVALID)
+        {
+            Bitmap::dynamicBitmapDelete(copy);
+            premultiplied[i] = BITMAP_INVALID;
+        }
+    }
+}
+
+bool TextureCache::prefetch(BitmapId id)
+{
+    if (id == BITMAP_INVALID || id >= bitmapCount || Bitmap::cacheIsCached(id)
+            || CortexMMCUInstrumentation::regionOf(Bitmap(id).getData()) != CortexMMCUInstrumentation::REGION_FLASH)
+    {
+        return false;
+    }
+    prefetched = id;
+    return true;
+}
+
+void TextureCache::clear()
+{
+#if TOUCHGFX_TEXTURE_CACHE_SIZE > 0
+    // An image may still be decoded into the cache
+    JPEGImageLoader::cancelAll();
+    Bitmap::clearCache();
+#endif
+    for (int i = 0; i < TOUCHGFX_TEXTURE_CACHE_ENTRIES; i++)
+    {
+        entries[i].pinned = false;
+    }
+    prefetched = BITMAP_INVALID;
+    // The dynamic bitmaps are gone with the cache
+    for (int i = 0; i < TOUCHGFX_PREMULTIPLIED_BITMAPS; i++)
+    {
+        premultiplied[i] = BITMAP_INVALID;
+    }
+    HybridLCDGPU2D::sourcesMoved();
+}
+
+void TextureCache::frameStarted()
+{
+    frame++;
+
+    Entry* hottest = 0;
+    for (int i = 0; i < TOUCHGFX_TEXTURE_CACHE_ENTRIES; i++)
+    {
+        Entry& entry = entries[i];
+        if (entry.id != BITMAP_INVALID
+                && entry.frameSamples >= TOUCHGFX_TEXTURE_CACHE_MIN_SAMPLES
+                && !Bitmap::cacheIsCached(entry.id)
+                && (hottest == 0 || entry.frameSamples > hottest->frameSamples))
+        {
+            hottest = &entry;
+        }
+    }
+    for (int i = 0; i < TOUCHGFX_TEXTURE_CACHE_ENTRIES; i++)
+    {
+        entries[i].frameSamples = 0;
+    }
+
+    if (hottest != 0)
+    {
+        if (!cacheBitmap(hottest->id))
+        {
+            // Does not fit next to the bitmaps in use, retried when they go cold
+            hottest->frameSamples = 0;
+        }
+        return;
+    }
+
+    if (prefetched != BITMAP_INVALID)
+    {
+        const BitmapId id = prefetched;
+        prefetched = BITMAP_INVALID;
+        // Counted as drawn now, so it is not the first bitmap evicted for the next one
+        Entry* const entry = findOrAdd(id);
+        if (entry != 0 && cacheBitmap(id, false))
+        {
+            entry->lastUsed = frame;
+        }
+    }
+}
+
+void TextureCache::resetStats()
+{
+    for (int i = 0; i < TOUCHGFX_TEXTURE_CACHE_ENTRIES; i++)
+    {
+        entries[i].hits = 0;
+        entries[i].misses = 0;
+    }
+}
+
+void TextureCache::sampled(BitmapId id, uint32_t pixels)
+{
+    if (instance == 0 || id == BITMAP_INVALID)
+    {
+        return;
+    }
+    const bool cached = Bitmap::cacheIsCached(id);
+    if (!cached && CortexMMCUInstrumentation::regionOf(Bitmap(id).getData()) != CortexMMCUInstrumentation::REGION_FLASH)
+    {
+        // Dynamic bitmaps and bitmaps in RAM are not worth caching
+        return;
+    }
+    Entry* const entry = instance->findOrAdd(id);
+    if (entry == 0)
+    {
+        return;
+    }
+    if (cached)
+    {
+        entry->hits += pixels;
+    }
+    else
+    {
+        entry->misses += pixels;
+    }
+    entry->frameSamples += pixels;
+    if (!cached && isCompressed(Bitmap(id)))
+    {
+        // Decoded by the CPU on every draw, worth expanding however little of it is drawn
+        entry->frameSamples = MAX(entry->frameSamples, (uint32_t)TOUCHGFX_TEXTURE_CACHE_MIN_SAMPLES);
+    }
+    entry->lastUsed = instance->frame;
+}
+
+void TextureCache::sampled(const void* data, uint32_t pixels)
+{
+#if TOUCHGFX_TEXTURE_CACHE_SIZE > 0
+    if (instance == 0)
+    {
+        return;
+    }
+    const uint8_t* const bytes = static_cast<const uint8_t*>(data);
+    const bool inCache = bytes >= (const uint8_t*)textureCache && bytes < (const uint8_t*)textureCache + sizeof(textureCache);
+    if (!inCache && CortexMMCUInstrumentation::regionOf(data) != CortexMMCUInstrumentation::REGION_FLASH)
+    {
+        return;
+    }
+
+    // Tracked bitmaps first, the database is only searched for a texture drawn the first time
+    for (int i = 0; i < TOUCHGFX_TEXTURE_CACHE_ENTRIES; i++)
+    {
+        const BitmapId id = instance->entries[i].id;
+        if (id != BITMAP_INVALID && Bitmap(id).getData() == data)
+        {
+            sampled(id, pixels);
+            return;
+        }
+    }
+    for (BitmapId id = 0; id < instance->bitmapCount; id++)
+    {
+        if (Bitmap(id).getData() == data)
+        {
+            sampled(id, pixels);
+            return;
+        }
+    }
+#else
+    (void)data;
+    (void)pixels;
+#endif
+}
+
+bool TextureCache::isPremultiplied(const void* data)
+{
+    if (instance == 0 || data == 0)
+    {
+        return false;
+    }
+    for (int i = 0; i < TOUCHGFX_PREMULTIPLIED_BITMAPS; i++)
+    {
+        // Looked up by address, as compacting the cache may move the copy
+        const BitmapId copy = instance->premultiplied[i];
+        if (copy != BITMAP_INVALID && Bitmap::dynamicBitmapGetAddress(copy) == data)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool TextureCache::isCompressed(const Bitmap& bitmap)
+{
+    switch (bitmap.getFormat())
+    {
+    case Bitmap::COMPRESSED_RGB565:
+    case Bitmap::COMPRESSED_RGB888:
+    case Bitmap::COMPRESSED_ARGB8888:
+        return !Bitmap::cacheIsCached(bitmap.getId());
+    default:
+        return false;
+    }
+}
+
+TextureCache::Entry* TextureCache::find(BitmapId id)
+{
+    for (int i = 0; i < TOUCHGFX_TEXTURE_CACHE_ENTRIES; i++)
+    {
+        if (entries[i].id == id)
+        {
+            return &entries[i];
+        }
+    }
+    return 0;
+}
+
+TextureCache::Entry* TextureCache::findOrAdd(BitmapId id)
+{
+    Entry* entry = find(id);
+    if (entry != 0)
+    {
+        return entry;
+    }
+
+    // Reuse the least recently drawn entry that does not hold a cached bitmap
+    for (int i = 0; i < TOUCHGFX_TEXTURE_CACHE_ENTRIES; i++)
+    {
+        Entry& candidate = entries[i];
+        if (candidate.id == BITMAP_INVALID)
+        {
+            entry = &candidate;
+            break;
+        }
+        if (!candidate.pinned && !Bitmap::cacheIsCached(candidate.id)
+                && (entry == 0 || candidate.lastUsed < entry->lastUsed))
+        {
+            entry = &candidate;
+        }
+    }
+    if (entry != 0)
+    {
+        memset(entry, 0, sizeof(*entry));
+        entry->id = id;
+        entry->lastUsed = frame;
+    }
+    return entry;
+}
+
+bool TextureCache::evictLeastRecentlyUsed()
+{
+    // Least recently drawn cached bitmap, never one drawn in the frame that just completed
+    Entry* victim = 0;
+    for (int i = 0; i < TOUCHGFX_TEXTURE_CACHE_ENTRIES; i++)
+    {
+        Entry& entry = entries[i];
+        if (entry.id != BITMAP_INVALID && !entry.pinned && entry.lastUsed + 1 < frame
+                && Bitmap::cacheIsCached(entry.id)
+                && (victim == 0 || entry.lastUsed < victim->lastUsed))
+        {
+            victim = &entry;
+        }
+    }
+    return victim != 0 && Bitmap::cacheRemoveBitmap(victim->id);
+}
+
+bool TextureCache::cacheBitmap(BitmapId id, bool evict)
+{
+#if TOUCHGFX_TEXTURE_CACHE_SIZE > 0
+    if (Bitmap::cacheIsCached(id))
+    {
+        return true;
+    }
+    const Bitmap bitmap(id);
+    const uint32_t bytes = bitmapBytes(bitmap);
+    if (CortexMMCUInstrumentation::regionOf(bitmap.getData()) != CortexMMCUInstrumentation::REGION_FLASH
+            || bytes > sizeof(textureCache))
+    {
+        return false;
+    }
+
+    // Both compact the cache when the free space is fragmented, which must not move a
+    // bitmap still being uploaded
+    AssetUploadQueue* const uploads = AssetUploadQueue::getInstance();
+    if (uploads != 0)
+    {
+        uploads->waitForHighPriority();
+    }
+    const bool compressed = isCompressed(bitmap);
+    bool uploading = false;
+    if (!compressed && uploads != 0)
+    {
+        // The copy is done on HPDMA while the frame ticks, and waited for before drawing
+        uploads->beginCapture(AssetUploadQueue::PRIORITY_HIGH);
+        uploading = true;
+    }
+    bool cached;
+    while (!(cached = (compressed ? Bitmap::decompressRGB(id) : Bitmap::cache(id))) && evict && evictLeastRecentlyUsed())
+    {
+    }
+    if (uploading)
+    {
+        uploads->endCapture();
+    }
+    if (!cached)
+    {
+        return false;
+    }
+
+    if (!uploading)
+    {
+        // The copy is written by the CPU, GPU2D reads AXI SRAM past the data cache
+        DCacheMaintenance::clean(Bitmap::cacheGetAddress(id), bytes);
+    }
+    // Caching may have evicted or compacted the bitmaps that recorded commands sample
+    HybridLCDGPU2D::sourcesMoved();
+    return true;
+#else
+    (void)id;
+    (void)evict;
+    return false;
+#endif
+}
+} // namespace touchgfx
+
+/* USER CODE END TextureCache.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,301 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : TextureCache.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef TEXTURECACHE_HPP
+#define TEXTURECACHE_HPP
+
+#include <touchgfx/Bitmap.hpp>
+#include <stdint.h>
+
+/* USER CODE BEGIN TextureCache.hpp */
+
+/**
+ * Size in bytes of the bitmap cache in AXI SRAM that textures are copied into, 0 to sample
+ * all textures from flash. Large enough for the 152x152 ARGB8888 logo of Screen1.
+ */
+#ifndef TOUCHGFX_TEXTURE_CACHE_SIZE
+#define TOUCHGFX_TEXTURE_CACHE_SIZE (96 * 1024)
+#endif
+
+/**
+ * Number of bitmaps that sampling is counted for.
+ */
+#ifndef TOUCHGFX_TEXTURE_CACHE_ENTRIES
+#define TOUCHGFX_TEXTURE_CACHE_ENTRIES 16
+#endif
+
+/**
+ * Pixels a flash bitmap must be sampled in one frame before it is copied into the cache.
+ * Bitmaps drawn smaller than this are cheap to read from flash.
+ */
+#ifndef TOUCHGFX_TEXTURE_CACHE_MIN_SAMPLES
+#define TOUCHGFX_TEXTURE_CACHE_MIN_SAMPLES 4096
+#endif
+
+/**
+ * Number of dynamic bitmaps the bitmap cache has room for, such as those of
+ * DynamicBitmapArena, whose pixels are elsewhere.
+ */
+#ifndef TOUCHGFX_DYNAMIC_BITMAPS
+#define TOUCHGFX_DYNAMIC_BITMAPS 16
+#endif
+
+/**
+ * Number of premultiplied copies made by TextureCache::cachePremultiplied() that can exist
+ * at a time.
+ */
+#ifndef TOUCHGFX_PREMULTIPLIED_BITMAPS
+#define TOUCHGFX_PREMULTIPLIED_BITMAPS 4
+#endif
+
+namespace touchgfx
+{
+/**
+ * @class TextureCache
+ *
+ * @brief Keeps the bitmaps that are sampled the most in a bitmap cache in AXI SRAM.
+ *
+ *        Bitmaps are read by GPU2D from the memory-mapped flash on XSPI2 through the GPU2D
+ *        instruction cache. Drawn unrotated, a bitmap is read line by line and the cache
+ *        lines are used in full. Rotated by a texture mapper, every line drawn crosses many
+ *        lines of the texture, so most texels fetched miss the cache and each miss is a
+ *        burst on XSPI2. The cache only holds data fetched by GPU2D and cannot be filled
+ *        ahead by the CPU, so such textures are instead copied into the TouchGFX bitmap
+ *        cache in AXI SRAM, where GPU2D samples them at no XSPI cost.
+ *
+ *        The LCD reports every bitmap drawn with sampled(). At the start of every frame,
+ *        frameStarted() copies the flash bitmap sampled the most in the previous frame
+ *        into the cache, evicting the least recently sampled bitmaps to make room. At most
+ *        one bitmap is copied per frame, on HPDMA by AssetUploadQueue while the frame ticks,
+ *        so filling the cache does not stall a frame for long. Bitmaps pinned with
+ *        cacheRotated() are never evicted. A frame that copies no sampled bitmap copies
+ *        the bitmap asked for with prefetch() instead, if it fits in the free space.
+ *
+ *        Bitmaps stored QOI compressed (COMPRESSED_RGB565, COMPRESSED_RGB888 and
+ *        COMPRESSED_ARGB8888) cannot be read by GPU2D or DMA2D and are decoded by the CPU
+ *        every time they are drawn from flash. They are expanded into the cache the frame
+ *        after they are first drawn, however few pixels were drawn, and are blitted by GPU2D
+ *        from the expanded copy from then on.
+ */
+class TextureCache
+{
+public:
+    /** Sampling counters of a bitmap. */
+    struct Entry
+    {
+        BitmapId id;           ///< The bitmap, BITMAP_INVALID for an unused entry
+        uint32_t hits;         ///< Pixels drawn from the copy in the cache
+        uint32_t misses;       ///< Pixels drawn from flash
+        uint32_t frameSamples; ///< Pixels drawn in the current frame
+        uint32_t lastUsed;     ///< Frame the bitmap was last drawn in
+        bool pinned;           ///< Never evicted
+    };
+
+    TextureCache();
+
+    /**
+     * @fn void TextureCache::init(uint16_t numberOfBitmaps);
+     *
+     * @brief Registers the cache memory as the TouchGFX bitmap cache.
+     *
+     * @param numberOfBitmaps Number of bitmaps in the bitmap database.
+     */
+    void init(uint16_t numberOfBitmaps);
+
+    /**
+     * @fn bool TextureCache::cacheRotated(BitmapId id);
+     *
+     * @brief Copies a bitmap that is drawn rotated into AXI SRAM and keeps it there.
+     *
+     *        Bitmap::getData() returns the copy from then on, for all widgets using the
+     *        bitmap. Bitmaps that are not in flash are already fast to sample and are left.
+     *
+     * @param id The bitmap.
+     *
+     * @return true if the bitmap is sampled from AXI SRAM.
+     */
+    bool cacheRotated(BitmapId id);
+
+    /**
+     * @fn BitmapId TextureCache::cacheConverted(BitmapId id, Bitmap::BitmapFormat format);
+     *
+     * @brief Creates a dynamic bitmap in the cache with the pixels of a bitmap converted to
+     *        another format, see PixelConversion. For example an L8 bitmap expanded for a
+     *        texture mapper, or an RGB888 bitmap stored as RGB565 to halve what is sampled.
+     *        Called from the TouchGFX task. Deleted with Bitmap::dynamicBitmapDelete().
+     *
+     * @param id     The bitmap, not compressed.
+     * @param format The format of the copy, RGB565, RGB888 or ARGB8888.
+     *
+     * @return The copy, BITMAP_INVALID if the formats are not converted or the copy does
+     *         not fit.
+     */
+    BitmapId cacheConverted(BitmapId id, Bitmap::BitmapFormat format);
+
+    /**
+     * @fn BitmapId TextureCache::cachePremultiplied(BitmapId id);
+     *
+     * @brief Creates a dynamic bitmap in the cache with the pixels of an ARGB8888 bitmap
+     *        multiplied by their alpha. Called from the TouchGFX task.
+     *
+     *        Flash assets are stored with straight alpha, which GPU2D multiplies into the
+     *        color of every pixel it blends, and which bilinear filtering bleeds into the
+     *        edges as a dark fringe when the bitmap is scaled or rotated. HybridLCDGPU2D
+     *        blends the copy as premultiplied when it draws it with GPU2D: images, texture
+     *        mappers drawing the whole bitmap, TextureMapperBatch, GPUScalableImage and
+     *        GPUTiledImage. The copy must not be given to the painters of the framework,
+     *        which blend on the CPU with straight alpha. Deleted with releasePremultiplied().
+     *
+     * @param id The bitmap, ARGB8888 and not compressed, or a premultiplied copy.
+     *
+     * @return The copy, the bitmap itself if it is a premultiplied copy, BITMAP_INVALID if
+     *         the bitmap is not ARGB8888 or the copy does not fit.
+     */
+    BitmapId cachePremultiplied(BitmapId id);
+
+    /**
+     * @fn void TextureCache::releasePremultiplied(BitmapId copy);
+     *
+     * @brief Deletes a copy made by cachePremultiplied().
+     *
+     * @param copy The copy.
+     */
+    void releasePremultiplied(BitmapId copy);
+
+    /**
+     * @fn bool TextureCache::prefetch(BitmapId id);
+     *
+     * @brief Asks for a flash bitmap to be copied into the cache before it is drawn, like
+     *        a bitmap of the screen likely entered next. It is copied by frameStarted() of
+     *        a frame that caches no hotter bitmap, only into free space of the cache, never
+     *        evicting a bitmap for it, and is evicted like the others once it goes cold.
+     *        Only the last bitmap asked for is kept.
+     *
+     * @param id The bitmap.
+     *
+     * @return false if the bitmap is cached already or is not in flash.
+     */
+    bool prefetch(BitmapId id);
+
+    /**
+     * @fn void TextureCache::clear();
+     *
+     * @brief Removes all copies, so bitmaps are sampled from flash again.
+     */
+    void clear();
+
+    /**
+     * @fn void TextureCache::frameStarted();
+     *
+     * @brief Caches the hottest flash bitmap of the previous frame. Called while GPU2D and
+     *        DMA2D are idle, as it may move cached bitmaps.
+     */
+    void frameStarted();
+
+    /**
+     * @fn const Entry* TextureCache::getEntries() const;
+     *
+     * @brief Gets the sampling counters.
+     *
+     * @return TOUCHGFX_TEXTURE_CACHE_ENTRIES entries.
+     */
+    const Entry* getEntries() const
+    {
+        return entries;
+    }
+
+    /**
+     * @fn uint32_t TextureCache::getCachedBytes() const;
+     *
+     * @brief Gets the bytes of the bitmaps in the cache, the cached bitmaps of the database
+     *        and the dynamic bitmaps. Looks at every bitmap, for reporting only.
+     *
+     * @return The bytes of the cache in use.
+     */
+    uint32_t getCachedBytes() const;
+
+    /**
+     * @fn void TextureCache::resetStats();
+     *
+     * @brief Resets the hit and miss counters.
+     */
+    void resetStats();
+
+    /**
+     * @fn static void TextureCache::sampled(BitmapId id, uint32_t pixels);
+     *
+     * @brief Counts pixels drawn from a bitmap. Called by the LCD.
+     *
+     * @param id     The bitmap.
+     * @param pixels Number of pixels drawn.
+     */
+    static void sampled(BitmapId id, uint32_t pixels);
+
+    /**
+     * @fn static void TextureCache::sampled(const void* data, uint32_t pixels);
+     *
+     * @brief Counts pixels drawn from bitmap data, for texture mappers that only pass the
+     *        data to the LCD.
+     *
+     * @param data   The pixel data of a bitmap.
+     * @param pixels Number of pixels drawn.
+     */
+    static void sampled(const void* data, uint32_t pixels);
+
+    /**
+     * @fn static bool TextureCache::isPremultiplied(const void* data);
+     *
+     * @brief Tells if pixel data is a copy made by cachePremultiplied().
+     *
+     * @param data The pixel data of a bitmap.
+     *
+     * @return true if the colors are premultiplied by alpha.
+     */
+    static bool isPremultiplied(const void* data);
+
+    /**
+     * @fn static bool TextureCache::isCompressed(const Bitmap& bitmap);
+     *
+     * @brief Tells if a bitmap is stored QOI compressed and is not expanded in the cache.
+     *
+     * @param bitmap The bitmap.
+     *
+     * @return true if the bitmap is decoded by the CPU when drawn.
+     */
+    static bool isCompressed(const Bitmap& bitmap);
+
+private:
+    Entry* find(BitmapId id);
+    Entry* findOrAdd(BitmapId id);
+    bool evictLeastRecentlyUsed();
+    bool cacheBitmap(BitmapId id, bool evict = true);
+
+    Entry entries[TOUCHGFX_TEXTURE_CACHE_ENTRIES];
+    uint16_t bitmapCount;
+    uint32_t frame;
+    BitmapId prefetched; ///< Copied by the next frameStarted() that caches nothing else
+    BitmapId premultiplied[TOUCHGFX_PREMULTIPLIED_BITMAPS]; ///< Copies by cachePremultiplied()
+
+    static TextureCache* instance;
+};
+} // namespace touchgfx
+
+/* USER CODE END TextureCache.hpp */
+
+#endif // TEXTURECACHE_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,273 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : TextureMipChain.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include <TextureMipChain.hpp>
+
+/* USER CODE BEGIN TextureMipChain.cpp */
+#include <DCacheMaintenance.hpp>
+#include <HybridLCDGPU2D.hpp>
+#include <string.h>
+
+namespace
+{
+#if TOUCHGFX_MIP_CHAIN_SIZE > 0
+// Kept in AXI SRAM with the rest of .bss
+uint32_t mipBuffer[TOUCHGFX_MIP_CHAIN_SIZE / 4];
+
+// Levels smaller than this in either direction are not worth sampling
+const uint16_t MIN_LEVEL_SIZE = 8;
+
+void downsampleARGB8888(const uint32_t* src, int32_t srcWidth, uint32_t* dst, int32_t width, int32_t height)
+{
+    for (int32_t y = 0; y < height; y++)
+    {
+        const uint32_t* const row0 = src + (2 * y) * srcWidth;
+        const uint32_t* const row1 = row0 + srcWidth;
+        for (int32_t x = 0; x < width; x++)
+        {
+            uint32_t pixel = 0;
+            for (int shift = 0; shift < 32; shift += 8)
+            {
+                const uint32_t sum = ((row0[2 * x] >> shift) & 0xFFU) + ((row0[2 * x + 1] >> shift) & 0xFFU)
+                                     + ((row1[2 * x] >> shift) & 0xFFU) + ((row1[2 * x + 1] >> shift) & 0xFFU);
+                pixel |= ((sum + 2) >> 2) << shift;
+            }
+            *dst++ = pixel;
+        }
+    }
+}
+
+void downsampleRGB565(const uint16_t* src, int32_t srcWidth, uint16_t* dst, int32_t width, int32_t height)
+{
+    for (int32_t y = 0; y < height; y++)
+    {
+        const uint16_t* const row0 = src + (2 * y) * srcWidth;
+        const uint16_t* const row1 = row0 + srcWidth;
+        for (int32_t x = 0; x < width; x++)
+        {
+            const uint32_t a = row0[2 * x];
+            const uint32_t b = row0[2 * x + 1];
+            const uint32_t c = row1[2 * x];
+            const uint32_t d = row1[2 * x + 1];
+            const uint32_t red = (((a >> 11) + (b >> 11) + (c >> 11) + (d >> 11) + 2) >> 2);
+            const uint32_t green = ((((a >> 5) & 0x3FU) + ((b >> 5) & 0x3FU) + ((c >> 5) & 0x3FU) + ((d >> 5) & 0x3FU) + 2) >> 2);
+            const uint32_t blue = (((a & 0x1FU) + (b & 0x1FU) + (c & 0x1FU) + (d & 0x1FU) + 2) >> 2);
+            *dst++ = (uint16_t)((red << 11) | (green << 5) | blue);
+        }
+    }
+}
+
+#endif
+
+// Twice the area of a polygon
+float doubleArea(const float* x, const float* y, int count)
+{
+    float area = 0.0f;
+    for (int i = 0; i < count; i++)
+    {
+        const int next = (i + 1) % count;
+        area += x[i] * y[next] - x[next] * y[i];
+    }
+    return area < 0.0f ? -area : area;
+}
+}
+
+namespace touchgfx
+{
+TextureMipChain* TextureMipChain::instance = 0;
+
+TextureMipChain::TextureMipChain()
+    : used(0)
+{
+    memset(chains, 0, sizeof(chains));
+    for (int i = 0; i < MAX_CHAINS; i++)
+    {
+        chains[i].id = BITMAP_INVALID;
+    }
+}
+
+void TextureMipChain::init()
+{
+#if TOUCHGFX_MIP_CHAIN_SIZE > 0
+    instance = this;
+#endif
+}
+
+bool TextureMipChain::generate(BitmapId id)
+{
+#if TOUCHGFX_MIP_CHAIN_SIZE > 0
+    if (contains(id))
+    {
+        return true;
+    }
+    Chain* chain = 0;
+    for (int i = 0; i < MAX_CHAINS && chain == 0; i++)
+    {
+        if (chains[i].id == BITMAP_INVALID)
+        {
+            chain = &chains[i];
+        }
+    }
+    const Bitmap bitmap(id);
+    const Bitmap::BitmapFormat format = bitmap.getFormat();
+    if (chain == 0 || bitmap.getData() == 0
+            || !(format == Bitmap::ARGB8888 || (format == Bitmap::RGB565 && bitmap.getExtraData() == 0)))
+    {
+        return false;
+    }
+
+    const uint32_t bytesPerPixel = (format == Bitmap::ARGB8888) ? 4 : 2;
+    const uint16_t* src = (const uint16_t*)bitmap.getData();
+    int32_t srcWidth = bitmap.getWidth();
+    int32_t srcHeight = bitmap.getHeight();
+    const uint32_t start = used;
+    uint8_t levels = 0;
+    while (levels < TOUCHGFX_MIP_CHAIN_LEVELS && srcWidth / 2 >= MIN_LEVEL_SIZE && srcHeight / 2 >= MIN_LEVEL_SIZE)
+    {
+        const int32_t width = srcWidth / 2;
+        const int32_t height = srcHeight / 2;
+        // Word aligned, so the ARGB8888 levels can be written a pixel at a time
+        const uint32_t bytes = (width * height * bytesPerPixel + 3U) & ~3U;
+        if (used + bytes > sizeof(mipBuffer))
+        {
+            break;
+        }
+        uint16_t* const dst = (uint16_t*)((uint8_t*)mipBuffer + used);
+        if (format == Bitmap::ARGB8888)
+        {
+            downsampleARGB8888((const uint32_t*)src, srcWidth, (uint32_t*)dst, width, height);
+        }
+        else
+        {
+            downsampleRGB565(src, srcWidth, dst, width, height);
+        }
+        chain->level[levels].data = dst;
+        chain->level[levels].width = (uint16_t)width;
+        chain->level[levels].height = (uint16_t)height;
+        levels++;
+        used += bytes;
+        src = dst;
+        srcWidth = width;
+        srcHeight = height;
+    }
+    if (levels == 0)
+    {
+        return false;
+    }
+
+    // Written by the CPU, GPU2D reads AXI SRAM past the data cache
+    DCacheMaintenance::clean((uint8_t*)mipBuffer + start, used - start);
+    chain->id = id;
+    chain->levels = levels;
+    return true;
+#else
+    (void)id;
+    return false;
+#endif
+}
+
+void TextureMipChain::clear()
+{
+    for (int i = 0; i < MAX_CHAINS; i++)
+    {
+        chains[i].id = BITMAP_INVALID;
+        chains[i].levels = 0;
+    }
+    used = 0;
+    HybridLCDGPU2D::sourcesMoved();
+}
+
+bool TextureMipChain::select(const Point3D* vertices, int count, const TextureSurface& texture, Point3D* levelVertices, TextureSurface& level)
+{
+    if (instance == 0 || texture.extraData != 0)
+    {
+        return false;
+    }
+    const Chain* chain = 0;
+    for (int i = 0; i < MAX_CHAINS && chain == 0; i++)
+    {
+        const Chain& candidate = instance->chains[i];
+        if (candidate.id != BITMAP_INVALID && Bitmap(candidate.id).getData() == (const uint8_t*)texture.data)
+        {
+            chain = &candidate;
+        }
+    }
+    if (chain == 0)
+    {
+        return false;
+    }
+
+    // Texels covered per pixel drawn, every level down quarters it
+    float x[4];
+    float y[4];
+    float u[4];
+    float v[4];
+    for (int i = 0; i < count; i++)
+    {
+        x[i] = vertices[i].X / 16.0f;
+        y[i] = vertices[i].Y / 16.0f;
+        u[i] = vertices[i].U;
+        v[i] = vertices[i].V;
+    }
+    const float drawn = doubleArea(x, y, count);
+    float texels = doubleArea(u, v, count);
+    int selected = -1;
+    while (selected + 1 < chain->levels && texels >= 4.0f * drawn)
+    {
+        texels /= 4.0f;
+        selected++;
+    }
+    if (selected < 0)
+    {
+        return false;
+    }
+
+    const Level& mip = chain->level[selected];
+    const float scaleU = (float)mip.width / (float)texture.width;
+    const float scaleV = (float)mip.height / (float)texture.height;
+    for (int i = 0; i < count; i++)
+    {
+        levelVertices[i] = vertices[i];
+        // The texture mappers extend the texture by a one texel border
+        levelVertices[i].U = (vertices[i].U + 1.0f) * scaleU - 1.0f;
+        levelVertices[i].V = (vertices[i].V + 1.0f) * scaleV - 1.0f;
+    }
+    level.data = mip.data;
+    level.extraData = 0;
+    level.width = mip.width;
+    level.height = mip.height;
+    level.stride = mip.width;
+    return true;
+}
+
+bool TextureMipChain::contains(BitmapId id) const
+{
+    for (int i = 0; i < MAX_CHAINS; i++)
+    {
+        if (chains[i].id == id)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+} // namespace touchgfx
+
+/* USER CODE END TextureMipChain.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,141 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : TextureMipChain.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef TEXTUREMIPCHAIN_HPP
+#define TEXTUREMIPCHAIN_HPP
+
+#include <touchgfx/Bitmap.hpp>
+#include <touchgfx/hal/Types.hpp>
+#include <stdint.h>
+
+/* USER CODE BEGIN TextureMipChain.hpp */
+
+/**
+ * Size in bytes of the buffer in AXI SRAM that mip levels are generated into, 0 to always
+ * sample textures at full resolution. The levels of the 152x152 ARGB8888 logo of Screen1
+ * take 30 KB.
+ */
+#ifndef TOUCHGFX_MIP_CHAIN_SIZE
+#define TOUCHGFX_MIP_CHAIN_SIZE (32 * 1024)
+#endif
+
+/**
+ * Largest number of levels below full resolution generated for a texture.
+ */
+#ifndef TOUCHGFX_MIP_CHAIN_LEVELS
+#define TOUCHGFX_MIP_CHAIN_LEVELS 4
+#endif
+
+namespace touchgfx
+{
+/**
+ * @class TextureMipChain
+ *
+ * @brief Holds half, quarter, ... resolution copies of textures drawn scaled down.
+ *
+ *        A texture mapper drawing a bitmap smaller than its size still samples the full
+ *        resolution bitmap, so with NEAREST_NEIGHBOR most texels fetched are never shown
+ *        and the ones that are alias. generate() box filters a bitmap into successively
+ *        halved levels in AXI SRAM. When the LCD draws a texture mapped quad or triangle
+ *        from the bitmap, select() compares the area covered in the texture with the area
+ *        drawn on the display and substitutes the largest level that still has at least
+ *        one texel per pixel drawn.
+ *
+ *        Levels are generated for opaque RGB565 and for ARGB8888 bitmaps.
+ */
+class TextureMipChain
+{
+public:
+    TextureMipChain();
+
+    /**
+     * @fn void TextureMipChain::init();
+     *
+     * @brief Makes this the mip chain that select() substitutes levels from.
+     */
+    void init();
+
+    /**
+     * @fn bool TextureMipChain::generate(BitmapId id);
+     *
+     * @brief Generates the levels of a bitmap, as many as fit.
+     *
+     *        The bitmap is read through Bitmap::getData(), so a bitmap cached in AXI SRAM
+     *        should be cached first. Must not be called while GPU2D may sample levels
+     *        generated earlier.
+     *
+     * @param id The bitmap.
+     *
+     * @return true if at least one level was generated.
+     */
+    bool generate(BitmapId id);
+
+    /**
+     * @fn void TextureMipChain::clear();
+     *
+     * @brief Removes the levels of all bitmaps.
+     */
+    void clear();
+
+    /**
+     * @fn static bool TextureMipChain::select(const Point3D* vertices, int count, const TextureSurface& texture, Point3D* levelVertices, TextureSurface& level);
+     *
+     * @brief Selects the level to sample for a texture mapped polygon. Called by the LCD.
+     *
+     * @param      vertices      The vertices of the triangle or quad.
+     * @param      count         The number of vertices, 3 or 4.
+     * @param      texture       The full resolution texture.
+     * @param [out] levelVertices The vertices with their texture coordinates in the level.
+     * @param [out] level         The level.
+     *
+     * @return true if a level should be sampled instead of the texture.
+     */
+    static bool select(const Point3D* vertices, int count, const TextureSurface& texture, Point3D* levelVertices, TextureSurface& level);
+
+private:
+    static const int MAX_CHAINS = 2; ///< Bitmaps that levels can be generated for
+
+    /** A generated level. */
+    struct Level
+    {
+        const uint16_t* data;
+        uint16_t width;
+        uint16_t height;
+    };
+
+    /** The levels of a bitmap. */
+    struct Chain
+    {
+        BitmapId id;
+        uint8_t levels;
+        Level level[TOUCHGFX_MIP_CHAIN_LEVELS];
+    };
+
+    bool contains(BitmapId id) const;
+
+    Chain chains[MAX_CHAINS];
+    uint32_t used; ///< Bytes of the buffer used
+
+    static TextureMipChain* instance;
+};
+} // namespace touchgfx
+
+/* USER CODE END TextureMipChain.hpp */
+
+#endif // TEXTUREMIPCHAIN_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -24,7 +24,39 @@
 
 /* USER CODE BEGIN TouchGFXHAL.cpp */
 #include "FreeRTOS.h"
-#include <platform/driver/lcd/LCD16bpp.hpp>
+#include <AffineLCD16bpp.hpp>
+#include <platform/driver/lcd/LCD24bpp.hpp>
+#include <platform/driver/lcd/LCD32bpp.hpp>
+#include <platform/driver/lcd/LCD8bpp_ARGB2222.hpp>
+#include <touchgfx/Application.hpp>
+#include <nema_hal_ext.h>
+#include <nema_cmdlist.h>
+#include <nema_vg_context.h>
+#include <TraceOutput.hpp>
+#include <touchgfx/hal/OSWrappers.hpp>
+#include <touchgfx/hal/GPIO.hpp>
+#include <StencilVectorRenderer.hpp>
+#include <STM32ChromARTDMA.hpp>
+#include <HybridLCDGPU2D.hpp>
+#include <AsyncFontDataReader.hpp>
+#include <JPEGImageLoader.hpp>
+#include <STM32MJPEGDecoder.hpp>
+#include <FrameAheadVideoController.hpp>
+#include <ClockedFrameBufferVideoController.hpp>
+#include <VideoClock.hpp>
+#include <MemoryBudget.hpp>
+#include <DCacheMaintenance.hpp>
+#include <PixelConversion.hpp>
+#include <ScreenCapture.hpp>
+#include <MPUProfile.hpp>
+#include <BitmapDatabase.hpp>
+#include <rtos_pool.h>
+#include <cmsis_os2.h>
+#include "stm32h7rsxx.h"
+#include "stm32h7rsxx_hal.h"
+#include "stm32h7rsxx_hal_ltdc.h"
+#include <cassert>
+#include <stdio.h>
 
 using namespace touchgfx;
 
@@ -33,26 +65,449 @@ void activateNeoChrom(bool active)
     ((TouchGFXHAL*)touchgfx::HAL::getInstance())->activateNeoChrom(active);
 }
 
-LCD16bpp lcd16;
+// Bytes of one framebuffer, and the framebuffers allocated in TouchGFX_Framebuffer
+#define FRAME_BUFFER_BYTES (TOUCHGFX_FRAMEBUFFER_WIDTH * 480U * (TOUCHGFX_FRAMEBUFFER_MAX_BPP / 8))
+#if TOUCHGFX_BEAM_RACING || TOUCHGFX_PARTIAL_FRAMEBUFFER
+#define FRAME_BUFFER_COUNT (TOUCHGFX_TRIPLE_BUFFERING ? 2U : 1U)
+#else
+#define FRAME_BUFFER_COUNT (TOUCHGFX_TRIPLE_BUFFERING ? 3U : 2U)
+#endif
+
+#if TOUCHGFX_TILE_HASH
+namespace
+{
+// The tiles of the 800x480 framebuffer
+const uint16_t TILE_COLUMNS = (800U + TOUCHGFX_TILE_HASH_SIZE - 1) / TOUCHGFX_TILE_HASH_SIZE;
+const uint16_t TILE_ROWS = (480U + TOUCHGFX_TILE_HASH_SIZE - 1) / TOUCHGFX_TILE_HASH_SIZE;
+
+// The CRC of each tile of each framebuffer, and the frame it held then, 0 if not hashed
+uint32_t tileHash[FRAME_BUFFER_COUNT][TILE_COLUMNS * TILE_ROWS];
+uint32_t tileHashFrame[FRAME_BUFFER_COUNT][TILE_COLUMNS * TILE_ROWS];
+
+uint32_t hashArea(const uint16_t* frameBuffer, uint16_t stride, const Rect& area)
+{
+    // 32 bit writes to the data register are fed as four bytes, 16 bit writes as two
+    CRC->CR |= CRC_CR_RESET;
+    for (int16_t y = area.y; y < area.bottom(); y++)
+    {
+        const uint16_t* pixel = frameBuffer + y * stride + area.x;
+        const uint16_t* const end = pixel + area.width;
+        DCacheMaintenance::cleanInvalidate(pixel, area.width * 2U);
+        if (((uintptr_t)pixel & 2U) != 0 && pixel < end)
+        {
+            *(volatile uint16_t*)&CRC->DR = *pixel++;
+        }
+        for (; pixel + 2 <= end; pixel += 2)
+        {
+            CRC->DR = *(const uint32_t*)pixel;
+        }
+        if (pixel < end)
+        {
+            *(volatile uint16_t*)&CRC->DR = *pixel;
+        }
+    }
+    return CRC->DR;
+}
+} // namespace
+#endif
+
+// Z-rotated texture mappers are drawn with a fixed-point affine fast path
+AffineLCD16bpp lcd16;
+#if TOUCHGFX_FRAMEBUFFER_MAX_BPP >= 24
+LCD24bpp lcd24;
+#endif
+#if TOUCHGFX_FRAMEBUFFER_MAX_BPP >= 32
+LCD32bpp lcd32;
+#endif
+#if TOUCHGFX_FRAMEBUFFER_L8
+LCD8bpp_ARGB2222 lcd8;
+#endif
+
+extern "C" LTDC_HandleTypeDef hltdc;
+
+STM32MJPEGDecoder mjpegdecoder1;
+#if VIDEO_THUMBNAIL_BUFFER_SIZE > 0
+// Decodes the thumbnails of any video in jpegTask, while mjpegdecoder1 plays one
+STM32MJPEGDecoder mjpegThumbnailDecoder;
+#endif
+
+namespace
+{
+uint32_t videoFrameIndex[VIDEO_FRAME_INDEX_ENTRIES];
+
+#if VIDEO_PREFETCH_BUFFER_SIZE > 0
+// Use the section "Video_RGB_Buffer" in the linker script to specify the placement of the buffer
+LOCATION_PRAGMA_32("Video_RGB_Buffer")
+uint8_t videoPrefetchBuffer[VIDEO_PREFETCH_BUFFER_SIZE] LOCATION_ATTRIBUTE_32("Video_RGB_Buffer");
+// Reads the memory-mapped videos of mjpegdecoder1 ahead with HPDMA1 channel 2
+PrefetchVideoDataReader videoPrefetchReader(0, 0, videoPrefetchBuffer, sizeof(videoPrefetchBuffer));
+#endif
+
+#if VIDEO_FRAME_AHEAD_BUFFERS > 0
+#if VIDEO_STREAMS > 1
+// Decoders of the streams after the first, sharing the codec with mjpegdecoder1
+STM32MJPEGDecoder videoStreamDecoders[VIDEO_STREAMS - 1];
+uint32_t videoStreamFrameIndex[VIDEO_STREAMS - 1][VIDEO_FRAME_INDEX_ENTRIES];
+#endif
+// Use the section "Video_RGB_Buffer" in the linker script to specify the placement of the buffer
+LOCATION_PRAGMA_NOLOAD("Video_RGB_Buffer")
+uint32_t videoRGBBuffer[(800 * 480 * 2 + 3) / 4 * VIDEO_FRAME_AHEAD_BUFFERS * VIDEO_STREAMS] LOCATION_ATTRIBUTE_NOLOAD("Video_RGB_Buffer");
+FrameAheadVideoController<VIDEO_STREAMS, 800, 480, 800 * 2, Bitmap::RGB565, VIDEO_FRAME_AHEAD_BUFFERS> videoController;
+#else
+#if VIDEO_DECODE_CACHE
+// Use the section "Video_RGB_Buffer" in the linker script to specify the placement of the buffer
+LOCATION_PRAGMA_NOLOAD("Video_RGB_Buffer")
+uint32_t videoRGBBuffer[(800 * 480 * 2 + 3) / 4] LOCATION_ATTRIBUTE_NOLOAD("Video_RGB_Buffer");
+#endif
+ClockedFrameBufferVideoController<1, Bitmap::RGB565> videoController;
+#endif
+#if VIDEO_THUMBNAIL_BUFFER_SIZE > 0
+// Use the section "Video_RGB_Buffer" in the linker script to specify the placement of the buffer
+LOCATION_PRAGMA_NOLOAD("Video_RGB_Buffer")
+uint32_t videoThumbnailBuffer[VIDEO_THUMBNAIL_BUFFER_SIZE / 4] LOCATION_ATTRIBUTE_NOLOAD("Video_RGB_Buffer");
+#endif
+
+// Use the section "TouchGFX_Framebuffer" in the linker script to specify the placement of the buffer
+// Aligned to a line of the data cache, like every line with TOUCHGFX_FRAMEBUFFER_STRIDE_ALIGNMENT
+LOCATION_PRAGMA_32("TouchGFX_Framebuffer")
+#if TOUCHGFX_BEAM_RACING || TOUCHGFX_PARTIAL_FRAMEBUFFER
+uint32_t frameBuf[(TOUCHGFX_FRAMEBUFFER_WIDTH * 480 * (TOUCHGFX_FRAMEBUFFER_MAX_BPP / 8) + 3) / 4] LOCATION_ATTRIBUTE_32("TouchGFX_Framebuffer");
+#else
+uint32_t frameBuf[(TOUCHGFX_FRAMEBUFFER_WIDTH * 480 * (TOUCHGFX_FRAMEBUFFER_MAX_BPP / 8) + 3) / 4 * 2] LOCATION_ATTRIBUTE_32("TouchGFX_Framebuffer");
+#endif
+uint16_t lcd_int_active_line;
+uint16_t lcd_int_porch_line;
+// Line interrupt used to wake the TouchGFX task in beam racing mode, 0 when not waiting
+volatile uint16_t lcd_int_strip_line = 0;
+osSemaphoreId_t scanline_sem = NULL;
+}
+
+//Singleton Factory
+VideoController& VideoController::getInstance()
+{
+    return videoController;
+}
+
+#if VIDEO_FRAME_AHEAD_BUFFERS > 0
+VideoStreamScheduler& VideoStreamScheduler::getInstance()
+{
+    return videoController;
+}
+#endif
+
+extern "C" void videoTaskFunc(void* argument)
+{
+#if VIDEO_FRAME_AHEAD_BUFFERS > 0
+    videoController.decoderTaskEntry();
+#else
+    osThreadExit();
+#endif
+}
+
+namespace touchgfx
+{
+VectorRenderer* VectorRenderer::getInstance()
+{
+    static StencilVectorRenderer renderer;
+
+    return &renderer;
+}
+} // namespace touchgfx
+
+namespace
+{
+// Every renderer enabled is linked from the prebuilt library, enableTextureMapperAll()
+// pulls in all formats with both filters
+template <class LCDType>
+void enableTextureMappers(LCDType& lcd)
+{
+#if TOUCHGFX_ALL_TEXTURE_MAPPERS
+    lcd.enableTextureMapperAll();
+#else
+    lcd.enableTextureMapperARGB8888_NearestNeighbor();
+#endif
+}
+
+void nemaPoolUsage(const void* context, MemoryBudget::Usage& usage)
+{
+    nema_hal_pool_stats_t stats;
+    if (nema_hal_get_pool_stats((int)(uintptr_t)context, &stats) == 0)
+    {
+        usage.used = stats.used;
+        usage.peak = stats.high_water;
+    }
+}
+
+void registerNemaPools()
+{
+    static const char* const poolNames[NEMA_HAL_NUM_POOLS] = { "nemagfx mem", "nemagfx stencil", "nemagfx fallback" };
+
+    for (int pool = 0; pool < NEMA_HAL_NUM_POOLS; pool++)
+    {
+        uint32_t capacity = 0;
+        const void* const mem = nema_hal_get_pool_memory(pool, &capacity);
+        if (mem != 0 && capacity > 0)
+        {
+            MemoryBudget::add(poolNames[pool], mem, capacity, nemaPoolUsage, (const void*)(uintptr_t)pool);
+        }
+    }
+
+    uint32_t tileSize = 0;
+    const void* const tile = nema_hal_get_stencil_tile(&tileSize);
+    if (tile != 0)
+    {
+        MemoryBudget::add("nemagfx stencil tile", tile, tileSize);
+    }
+}
+
+uint32_t rtosHeapFree(const void* /*context*/)
+{
+    RTOS_POOL_StatsTypeDef stats;
+    RTOS_POOL_GetStats(&stats);
+    return stats.HeapFree;
+}
+
+uint32_t nemaLargestFree(const void* /*context*/)
+{
+    nema_hal_pool_stats_t stats;
+    return nema_hal_get_pool_stats(NEMA_HAL_MEM_POOL, &stats) == 0 ? stats.largest_free : 0U;
+}
+
+// Counters of a cache at the previous sample of the soak test
+struct HitRate
+{
+    uint32_t hits;
+    uint32_t lookups;
+    uint32_t pct;
+};
+
+HitRate glyphAtlasHits = { 0, 0, 100 };
+HitRate textureCacheHits = { 0, 0, 100 };
+
+// The reports reset the statistics, counters below the previous sample count from 0 again.
+// Without lookups since the previous sample the rate stays as it was.
+uint32_t hitRatePct(HitRate& rate, uint32_t hits, uint32_t lookups)
+{
+    const uint32_t newHits = hits >= rate.hits ? hits - rate.hits : hits;
+    const uint32_t newLookups = lookups >= rate.lookups ? lookups - rate.lookups : lookups;
+    rate.hits = hits;
+    rate.lookups = lookups;
+    if (newLookups > 0)
+    {
+        rate.pct = (uint32_t)((uint64_t)newHits * 100U / newLookups);
+    }
+    return rate.pct;
+}
+}
+
+#if TOUCHGFX_TRIPLE_BUFFERING
+namespace
+{
+// Placed with the two framebuffers in PSRAM
+LOCATION_PRAGMA_32("TouchGFX_Framebuffer")
+uint32_t frameBuf3[(TOUCHGFX_FRAMEBUFFER_WIDTH * 480 * (TOUCHGFX_FRAMEBUFFER_MAX_BPP / 8) + 3) / 4] LOCATION_ATTRIBUTE_32("TouchGFX_Framebuffer");
+}
+#endif
+
+#if TOUCHGFX_PARTIAL_FRAMEBUFFER
+namespace
+{
+// Blocks are placed in AXI SRAM with the rest of .bss
+ManyBlockAllocator<TOUCHGFX_PARTIAL_BLOCK_SIZE, TOUCHGFX_PARTIAL_BLOCKS, 2> blockAllocator;
+bool blockTransferring = false;
+}
+#endif
 
 void TouchGFXHAL::initialize()
 {
-    // Calling parent implementation of initialize().
-    //
-    // To overwrite the generated implementation, omit call to parent function
-    // and implemented needed functionality here.
+    // The generated implementation is replaced, see TouchGFXHAL.hpp.
     // Please note, HAL::initialize() must be called to initialize the framework.
 
-    TouchGFXGeneratedHAL::initialize();
+    HALGPU2D::initialize(NEMA_HAL_CL_SIZE);
+    registerEventListener(*(Application::getInstance()));
+#if TOUCHGFX_FRAMEBUFFER_WIDTH != 800
+    setFrameBufferSize(TOUCHGFX_FRAMEBUFFER_WIDTH, 480);
+    // Set up by MX_LTDC_Init() with the pitch of the display width
+    BackgroundLayer::applyFrameBufferPitch();
+    LTDC->SRCR = (uint32_t)LTDC_SRCR_IMR;
+#endif
+#if TOUCHGFX_PARTIAL_FRAMEBUFFER
+    // Render into blocks in AXI SRAM, frameBuf is only scanned out by LTDC
+    setLTDCFrameBuffer(reinterpret_cast<uint16_t*>(frameBuf));
+    setFrameBufferAllocator(&blockAllocator);
+    setFrameRefreshStrategy(REFRESH_STRATEGY_PARTIAL_FRAMEBUFFER);
+#elif TOUCHGFX_BEAM_RACING
+    setFrameBufferStartAddresses((void*)frameBuf, (void*)0, (void*)0);
+
+    // Render just behind the LTDC scanout in the single framebuffer
+    scanline_sem = RTOS_POOL_SemaphoreNew(1, 0, NULL);
+    assert((scanline_sem != NULL) && "Creation of scanline semaphore failed");
+    registerTaskDelayFunction(&OSWrappers::taskDelay);
+    setFrameRefreshStrategy(REFRESH_STRATEGY_OPTIM_SINGLE_BUFFER_TFT_CTRL);
+#else
+    setFrameBufferStartAddresses((void*)frameBuf, (void*)(frameBuf + sizeof(frameBuf) / (sizeof(uint32_t) * 2)), (void*)0);
+#endif
+    initializeVideo();
+
     instrumentation.init();
     setMCUInstrumentation(&instrumentation);
+    pacer.registerInstance();
+    // The histogram is in PSRAM, which is not mapped yet when static objects are constructed
+    hotPath.reset();
+    hotPath.registerInstance();
+    idle.registerInstance();
+    idleRefresh.registerInstance();
+    idleRefresh.init();
+    touchLatency.registerInstance();
+    palette.registerInstance();
+    qualityGovernor.registerInstance();
+    textureCache.init(BitmapDatabase::getInstanceSize());
+    glyphAtlas.init();
+    mipChain.init();
+    // Replaces the generated VectorFontRendererImpl, which has no buffers without vector fonts
+    lcdRef.setVectorFontRenderer(&vectorFontRenderer);
+    shapedTextCache.init(static_cast<HybridLCDGPU2D&>(lcdRef));
+    widgetProfiler.init(static_cast<HybridLCDGPU2D&>(lcdRef));
+    blockCopier.init(static_cast<HybridLCDGPU2D&>(lcdRef));
+    assetUploads.init();
+    PixelConversion::init(dma);
+    // Still images are decoded by the codec of the video, one image or frame at a time
+#if VIDEO_THUMBNAIL_BUFFER_SIZE > 0
+    JPEGImageLoader::init(mjpegdecoder1, &mjpegThumbnailDecoder);
+#else
+    JPEGImageLoader::init(mjpegdecoder1, 0);
+#endif
+
+    frameBuffers[0] = frameBuffer0;
+    frameBuffers[1] = frameBuffer1;
+#if TOUCHGFX_TRIPLE_BUFFERING
+    frameBuffers[2] = reinterpret_cast<uint16_t*>(frameBuf3);
+#endif
+    latestFrameBuffer = shownFrameBuffer = getLTDCFrameBuffer();
+    setTripleBuffering(tripleBuffering);
     enableMCULoadCalculation(true);
+    // In partial framebuffer mode only the scanned out framebuffer is allocated
+    MemoryBudget::add("framebuffers", frameBuffers[0] != 0 ? (const void*)frameBuffers[0] : (const void*)getLTDCFrameBuffer(),
+                      FRAME_BUFFER_COUNT * FRAME_BUFFER_BYTES, frameBufferUsage, this);
+    registerNemaPools();
+    SoakTest::addChannel("render_avg_us", SoakTest::getRenderAverageUs, 0, SoakTest::WORSE_WHEN_HIGHER);
+    SoakTest::addChannel("render_max_us", SoakTest::getRenderMaximumUs, 0, SoakTest::WORSE_WHEN_HIGHER);
+    SoakTest::addChannel("heap_free", rtosHeapFree, 0, SoakTest::WORSE_WHEN_LOWER);
+    SoakTest::addChannel("nema_largest_free", nemaLargestFree, 0, SoakTest::WORSE_WHEN_LOWER);
+    SoakTest::addChannel("glyph_hit_pct", glyphAtlasHitRate, this, SoakTest::WORSE_WHEN_LOWER);
+    SoakTest::addChannel("texture_hit_pct", textureCacheHitRate, this, SoakTest::WORSE_WHEN_LOWER);
 
     /* The LCD instance is set as auxiliary LCD */
     setAuxiliaryLCD(&lcd16);
-    lcd16.enableTextureMapperAll();
+    enableTextureMappers(lcd16);
     activateNeoChrom(true);
     enableDMAAcceleration(false);
+#if TOUCHGFX_FRAMEBUFFER_MAX_BPP == 8
+    // The framebuffers are too small for RGB565, the first frame is rendered in ARGB2222
+    setFrameBufferFormat(Bitmap::ARGB2222);
+#endif
+
+    if (TOUCHGFX_BENCHMARK_FRAMES > 0)
+    {
+        startBenchmark(TOUCHGFX_BENCHMARK_FRAMES);
+    }
+}
+
+void TouchGFXHAL::initializeVideo()
+{
+    // Add DMA2D to hardware decoder
+    mjpegdecoder1.addDMA(dma);
+    mjpegdecoder1.setFrameIndexBuffer(videoFrameIndex, VIDEO_FRAME_INDEX_ENTRIES);
+#if VIDEO_PREFETCH_BUFFER_SIZE > 0
+    videoPrefetchReader.init();
+    mjpegdecoder1.setPrefetchReader(&videoPrefetchReader);
+#endif
+#if VIDEO_FRAME_AHEAD_BUFFERS > 0 && VIDEO_GPU2D_YUV
+    mjpegdecoder1.setVideoOutputUYVY(true);
+#endif
+#if VIDEO_THUMBNAIL_BUFFER_SIZE > 0
+    mjpegThumbnailDecoder.addDMA(dma);
+    mjpegThumbnailDecoder.setThumbnailBuffer((uint8_t*)videoThumbnailBuffer, sizeof(videoThumbnailBuffer));
+#endif
+
+    // Add hardware decoder to video controller
+    videoController.addDecoder(mjpegdecoder1, 0);
+#if VIDEO_FRAME_AHEAD_BUFFERS > 0
+#if VIDEO_STREAMS > 1
+    for (uint32_t i = 0; i < VIDEO_STREAMS - 1; i++)
+    {
+        videoStreamDecoders[i].addDMA(dma);
+        videoStreamDecoders[i].setFrameIndexBuffer(videoStreamFrameIndex[i], VIDEO_FRAME_INDEX_ENTRIES);
+        videoStreamDecoders[i].setVideoOutputUYVY(VIDEO_GPU2D_YUV);
+        videoController.addDecoder(videoStreamDecoders[i], i + 1);
+    }
+#endif
+    videoController.setRGBBuffer((uint8_t*)videoRGBBuffer, sizeof(videoRGBBuffer));
+
+    // Blit the video buffers with GPU2D, DMA2D is used by the hardware decoder
+    static_cast<HybridLCDGPU2D&>(lcdRef).setGPU2DSourceRegion(videoRGBBuffer, sizeof(videoRGBBuffer));
+#elif VIDEO_DECODE_CACHE
+    videoController.setDecodeCache((uint8_t*)videoRGBBuffer, sizeof(videoRGBBuffer));
+#endif
+}
+
+uint16_t TouchGFXHAL::getTFTCurrentLine()
+{
+    // The CPSR register (bits 15:0) specify current line of TFT controller.
+    const uint16_t curr = (uint16_t)(LTDC->CPSR & 0xFFFF);
+    const uint16_t backPorchY = (uint16_t)(LTDC->BPCR & 0x7FF) + 1;
+
+    // The semantics of the getTFTCurrentLine() function is to return a value
+    // in the range of 0-totalheight. If we are still in back porch area, return 0.
+    if (curr < backPorchY)
+    {
+        return 0;
+    }
+    return curr - backPorchY;
+}
+
+void TouchGFXHAL::taskDelay(uint16_t ms)
+{
+#if TOUCHGFX_BEAM_RACING
+    const uint16_t line = (uint16_t)(LTDC->CPSR & 0xFFFF) + TOUCHGFX_BEAM_RACING_STRIP_LINES;
+
+    // Only while the active area is scanned out, the porch interrupt is armed then
+    __disable_irq();
+    const bool armed = (LTDC->LIPCR == lcd_int_porch_line) && line < lcd_int_porch_line;
+    if (armed)
+    {
+        lcd_int_strip_line = line;
+        LTDC->LIPCR = line;
+    }
+    __enable_irq();
+
+    if (armed)
+    {
+        osSemaphoreAcquire(scanline_sem, ms);
+        lcd_int_strip_line = 0;
+        return;
+    }
+#endif
+    HALGPU2D::taskDelay(ms);
+}
+
+void TouchGFXHAL::vSyncFromISR()
+{
+    vSync();
+    IdleRefreshRate::vSyncFromISR();
+    FramePacer::vSyncFromISR();
+    TouchLatency::vSyncFromISR();
+    FrameBufferPalette::vSyncFromISR();
+    OSWrappers::signalVSync();
+
+    // Swap frame buffers immediately instead of waiting for the task to be scheduled in.
+    // Note: task will also swap when it wakes up, but that operation is guarded and will not have
+    // any effect if already swapped.
+    // A frame still being rendered by GPU2D is left for the task, which waits for it.
+    if (nema_hal_fence_signaled())
+    {
+        swapFrameBuffers();
+    }
 }
 
 /**
@@ -62,12 +517,22 @@ void TouchGFXHAL::initialize()
  */
 uint16_t* TouchGFXHAL::getTFTFrameBuffer() const
 {
-    // Calling parent implementation of getTFTFrameBuffer().
-    //
-    // To overwrite the generated implementation, omit call to parent function
-    // and implemented needed functionality here.
+    // With a frame queued for the next vertical blanking, the queued frame is the
+    // one the framework continues from
+    return latestFrameBuffer != 0 ? latestFrameBuffer : getLTDCFrameBuffer();
+}
+
+uint16_t* TouchGFXHAL::getLTDCFrameBuffer() const
+{
+    return (uint16_t*)BackgroundLayer::frameBufferAddressRegister();
+}
 
-    return TouchGFXGeneratedHAL::getTFTFrameBuffer();
+void TouchGFXHAL::setLTDCFrameBuffer(uint16_t* address)
+{
+    BackgroundLayer::frameBufferAddressRegister() = (uint32_t)address;
+
+    /* Reload immediate */
+    LTDC->SRCR = (uint32_t)LTDC_SRCR_IMR;
 }
 
 /**
@@ -77,12 +542,60 @@ uint16_t* TouchGFXHAL::getTFTFrameBuffer() const
  */
 void TouchGFXHAL::setTFTFrameBuffer(uint16_t* address)
 {
-    // Calling parent implementation of setTFTFrameBuffer(uint16_t* address).
-    //
-    // To overwrite the generated implementation, omit call to parent function
-    // and implemented needed functionality here.
+    if (indexOf(shownFrameBuffer) < 0)
+    {
+        // The first frame replaces the splash of the boot loader, an L8 image in a window
+        // of the layer, with the layer configuration of the framebuffer
+        HAL_LTDC_DisableCLUT_NoReload(&hltdc, BackgroundLayer::getFrameBufferLayerIndex());
+        ltdcFormatPending = true;
+    }
+    if (startupStage == STARTUP_RENDERING)
+    {
+        StartupTrace::mark("first frame");
+        startupStage = STARTUP_SHOWN;
+    }
+    frameCompleted(address);
+    updateShownFrameBuffer();
+    frameSwaps++;
+
+    // In the LTDC interrupt the display is in vertical blanking, show the frame right away
+    if (!tripleBuffering || __get_IPSR() != 0)
+    {
+        uint16_t* const previous = shownFrameBuffer;
+        applyLTDCPixelFormat();
+        setLTDCFrameBuffer(address);
+        latestFrameBuffer = shownFrameBuffer = address;
+        reloadPending = false;
+        touchLatency.frameSwapped(true);
+
+        // Render the next frame into the buffer that was just shown, as with double buffering
+        frameBuffer0 = address;
+        frameBuffer1 = (previous != address && indexOf(previous) >= 0) ? previous : getSpareFrameBuffer();
+        return;
+    }
+
+    if (reloadPending)
+    {
+        // Both other framebuffers hold frames that are not shown yet
+        thirdBufferWaits++;
+        while (LTDC->SRCR & LTDC_SRCR_VBR)
+        {
+        }
+        updateShownFrameBuffer();
+    }
+
+    // Show the frame at the next vertical blanking, and render the next frame into the
+    // framebuffer that is neither shown nor queued instead of waiting for it
+    applyLTDCPixelFormat();
+    BackgroundLayer::frameBufferAddressRegister() = (uint32_t)address;
+    LTDC->SRCR = (uint32_t)LTDC_SRCR_VBR;
+    latestFrameBuffer = address;
+    reloadPending = true;
+    thirdBufferFrames++;
+    touchLatency.frameSwapped(false);
 
-    TouchGFXGeneratedHAL::setTFTFrameBuffer(address);
+    frameBuffer0 = address;
+    frameBuffer1 = getSpareFrameBuffer();
 }
 
 /**
@@ -94,22 +607,90 @@ void TouchGFXHAL::setTFTFrameBuffer(uint16_t* address)
  */
 void TouchGFXHAL::flushFrameBuffer(const touchgfx::Rect& rect)
 {
-    // Calling parent implementation of flushFrameBuffer(const touchgfx::Rect& rect).
-    //
-    // To overwrite the generated implementation, omit call to parent function
-    // and implemented needed functionality here.
     // Please note, HAL::flushFrameBuffer(const touchgfx::Rect& rect) must
     // be called to notify the touchgfx framework that flush has been performed.
-    // To calculate he start adress of rect,
-    // use advanceFrameBufferToRect(uint8_t* fbPtr, const touchgfx::Rect& rect)
-    // defined in TouchGFXGeneratedHAL.cpp
 
-    TouchGFXGeneratedHAL::flushFrameBuffer(rect);
+    drawnInTick = true;
+    perfHUD.drawn(rect);
+    overdraw.flushed(rect);
+    ScreenCapture::flushed(rect);
+#if TOUCHGFX_BEAM_RACING || TOUCHGFX_PARTIAL_FRAMEBUFFER
+    // The area must be in the framebuffer before the scanout reaches it, or the partial
+    // block before DMA2D copies it, execute what GPU2D has recorded for it now instead of
+    // at the end of the frame
+    nema_cmdlist_t* cl = nema_cl_get_bound();
+    if (cl != 0 && cl->offset > 0)
+    {
+        nema_cl_submit(cl);
+        nema_cl_wait(cl);
+        nema_cl_rewind(cl);
+    }
+#endif
+    HALGPU2D::flushFrameBuffer(rect);
+}
+
+void TouchGFXHAL::transferDrawnBlocks()
+{
+#if TOUCHGFX_PARTIAL_FRAMEBUFFER
+    if (blockTransferring)
+    {
+        if (!dma.isDmaQueueEmpty() || dma.isDMARunning())
+        {
+            return;
+        }
+        blockAllocator.freeBlockAfterTransfer();
+        blockTransferring = false;
+    }
+    if (!blockAllocator.hasBlockReadyForTransfer())
+    {
+        return;
+    }
+
+    Rect rect;
+    const uint16_t* block = reinterpret_cast<const uint16_t*>(blockAllocator.getBlockForTransfer(rect));
+
+    // The block may have been drawn by the CPU
+    DCacheMaintenance::clean(block, (uint32_t)rect.width * rect.height * 2U);
+
+    BlitOp op = BlitOp();
+    op.operation = BLIT_OP_COPY;
+    op.pSrc = block;
+    op.pDst = getLTDCFrameBuffer() + rect.y * FRAME_BUFFER_WIDTH + rect.x;
+    op.nSteps = rect.width;
+    op.nLoops = rect.height;
+    op.srcLoopStride = rect.width;
+    op.dstLoopStride = FRAME_BUFFER_WIDTH;
+    op.alpha = 255;
+    op.srcFormat = Bitmap::RGB565;
+    op.dstFormat = Bitmap::RGB565;
+    blockTransferring = true;
+    dma.addToQueue(op);
+#endif
+}
+
+void TouchGFXHAL::waitForBlockTransfer()
+{
+#if TOUCHGFX_PARTIAL_FRAMEBUFFER
+    // isDmaQueueEmpty() is out of line, so isRunning is reloaded on every iteration
+    while (blockTransferring && (!dma.isDmaQueueEmpty() || dma.isDMARunning()))
+    {
+    }
+    transferDrawnBlocks();
+#endif
 }
 
 bool TouchGFXHAL::blockCopy(void* RESTRICT dest, const void* RESTRICT src, uint32_t numBytes)
 {
-    return TouchGFXGeneratedHAL::blockCopy(dest, src, numBytes);
+    // Bitmap::cache() of TextureCache, waited for before the frame is drawn
+    if (assetUploads.capture(dest, src, numBytes))
+    {
+        return true;
+    }
+    if (blockCopier.copy(dest, src, numBytes))
+    {
+        blockCopier.finish();
+    }
+    return true;
 }
 
 /**
@@ -118,12 +699,9 @@ bool TouchGFXHAL::blockCopy(void* RESTRICT dest, const void* RESTRICT src, uint3
  */
 void TouchGFXHAL::configureInterrupts()
 {
-    // Calling parent implementation of configureInterrupts().
-    //
-    // To overwrite the generated implementation, omit call to parent function
-    // and implemented needed functionality here.
-
-    TouchGFXGeneratedHAL::configureInterrupts();
+    NVIC_SetPriority(DMA2D_IRQn, 9);
+    NVIC_SetPriority(LTDC_IRQn, 9);
+    NVIC_SetPriority(GPU2D_IRQn, 9);
 }
 
 /**
@@ -131,12 +709,9 @@ void TouchGFXHAL::configureInterrupts()
  */
 void TouchGFXHAL::enableInterrupts()
 {
-    // Calling parent implementation of enableInterrupts().
-    //
-    // To overwrite the generated implementation, omit call to parent function
-    // and implemented needed functionality here.
-
-    TouchGFXGeneratedHAL::enableInterrupts();
+    NVIC_EnableIRQ(DMA2D_IRQn);
+    NVIC_EnableIRQ(LTDC_IRQn);
+    NVIC_EnableIRQ(GPU2D_IRQn);
 }
 
 /**
@@ -144,12 +719,9 @@ void TouchGFXHAL::enableInterrupts()
  */
 void TouchGFXHAL::disableInterrupts()
 {
-    // Calling parent implementation of disableInterrupts().
-    //
-    // To overwrite the generated implementation, omit call to parent function
-    // and implemented needed functionality here.
-
-    TouchGFXGeneratedHAL::disableInterrupts();
+    NVIC_DisableIRQ(DMA2D_IRQn);
+    NVIC_DisableIRQ(LTDC_IRQn);
+    NVIC_DisableIRQ(GPU2D_IRQn);
 }
 
 /**
@@ -158,22 +730,230 @@ void TouchGFXHAL::disableInterrupts()
  */
 void TouchGFXHAL::enableLCDControllerInterrupt()
 {
-    // Calling parent implementation of enableLCDControllerInterrupt().
-    //
-    // To overwrite the generated implementation, omit call to parent function
-    // and implemented needed functionality here.
+    lcd_int_active_line = (LTDC->BPCR & 0x7FF) - 1;
+    lcd_int_porch_line = (LTDC->AWCR & 0x7FF) - 1;
 
-    TouchGFXGeneratedHAL::enableLCDControllerInterrupt();
+    /* Sets the Line Interrupt position */
+    LTDC->LIPCR = lcd_int_active_line;
+    /* Line Interrupt Enable            */
+    LTDC->IER |= LTDC_IER_LIE;
+    // The task waits for the first VSYNC next
+    vsyncWaitCycles = getCPUCycles();
 }
 
 bool TouchGFXHAL::beginFrame()
 {
-    return TouchGFXGeneratedHAL::beginFrame();
+    // The wait for GPU2D below is part of the frame it delays
+    missClassifier.frameStarted();
+    // Includes the wait for GPU2D below, the frame before may have been too heavy for it
+    dynamicResolution.frameStarted();
+    qualityGovernor.frameStarted();
+    if (benchmark.isRunning())
+    {
+        // Select the backend under test before anything is drawn
+        useAuxiliaryLCD = frameBufferL8 || (benchmark.getBackend() == FrameBenchmark::BACKEND_LCD16BPP);
+    }
+
+    // The command list of the previous frame is rebound, so it must have completed
+    nema_hal_fence_wait();
+    checkGPU2DRecovery();
+    // Applies to the paths drawn by the framework as well as drawTSVG()
+    nema_vg_set_quality(qualityGovernor.getSettings().vectorQuality);
+    // Done callbacks of the uploads that completed during the previous frame
+    assetUploads.poll();
+    // Copying a bitmap into the cache reads flash, so no frame may be sampling it
+    textureCache.frameStarted();
+    glyphAtlas.frameStarted();
+    vectorFontRenderer.frameStarted();
+    shapedTextCache.frameStarted();
+    // Glyphs cached for this screen may still be transferred from flash
+    AsyncFontDataReader::finishTransfers();
+
+    if (pendingFormat != lcd().framebufferFormat())
+    {
+        applyFrameBufferFormat();
+    }
+
+    const bool begin = HALGPU2D::beginFrame();
+    if (begin)
+    {
+        // GPU2D has completed the previous frame, see nema_hal_fence_wait() above
+        static_cast<HybridLCDGPU2D&>(lcdRef).frameStarted();
+        if (calibrationPending && !useAuxiliaryLCD)
+        {
+            calibrationPending = false;
+            if (static_cast<HybridLCDGPU2D&>(lcdRef).calibrateCosts())
+            {
+                // Draws over the pixels written by the calibration
+                Application::getInstance()->invalidate();
+                reportBlitCosts();
+            }
+        }
+        if (blitBenchmarkPending && !useAuxiliaryLCD)
+        {
+            blitBenchmarkPending = false;
+            if (BlitBenchmark::run(lcd16, static_cast<HybridLCDGPU2D&>(lcdRef), dma))
+            {
+                Application::getInstance()->invalidate();
+            }
+        }
+        sampleGPU2DTiming();
+        benchmark.frameStarted();
+        SoakTest::frameStarted();
+        instrumentation.frameStarted();
+        widgetProfiler.frameStarted(getFrameNumber());
+        // GPU2D has completed the previous frame, captureTask may read it
+        ScreenCapture::frameStarted(completedFrameBuffer, getClientFrameBuffer(), completedFrame);
+        perfHUD.frameStarted();
+        overdraw.frameStarted();
+    }
+    return begin;
 }
 
 void TouchGFXHAL::endFrame()
 {
-    TouchGFXGeneratedHAL::endFrame();
+    // Before the frame can be swapped by the LTDC interrupt
+    touchLatency.frameEnded(drawnInTick);
+    // With asynchronous submission the frame's command list keeps executing on GPU2D
+    // after endFrame() returns, see nema_hal_fence_wait()
+    nema_hal_defer_cl_wait(NEMA_HAL_ASYNC_SUBMIT);
+    // The last string may still be collected, it must be in the submitted command list
+    static_cast<HybridLCDGPU2D&>(lcdRef).flushGlyphs();
+    // The command list of the frame is the one HALGPU2D::endFrame() submits
+    static_cast<HybridLCDGPU2D&>(lcdRef).endKicks();
+    if (drawnInTick)
+    {
+        // Before HALGPU2D::endFrame() swaps the framebuffers
+        completedFrameBuffer = getClientFrameBuffer();
+        completedFrame = getFrameNumber();
+    }
+#if TOUCHGFX_PARTIAL_FRAMEBUFFER
+    // All blocks must be in the scanout framebuffer before the next frame
+    while (blockTransferring || blockAllocator.hasBlockReadyForTransfer())
+    {
+        waitForBlockTransfer();
+    }
+#endif
+    HALGPU2D::endFrame();
+#if VIDEO_FRAME_AHEAD_BUFFERS > 0
+    videoController.endFrame();
+#endif
+    // Fills and copies at the end of the frame may still be running on DMA2D
+    static_cast<HybridLCDGPU2D&>(lcdRef).waitForDMA2D();
+    static_cast<HybridLCDGPU2D&>(lcdRef).pollSnapshots();
+    blockCopier.poll();
+    assetUploads.poll();
+    nema_hal_defer_cl_wait(0);
+    instrumentation.frameEnded();
+    missClassifier.frameEnded(drawnInTick, instrumentation.getFrameBytes(CortexMMCUInstrumentation::REGION_PSRAM)
+                              + instrumentation.getFrameBytes(CortexMMCUInstrumentation::REGION_FLASH));
+    widgetProfiler.frameEnded();
+    perfHUD.frameEnded();
+    overdraw.frameEnded(getFrameNumber());
+    dynamicResolution.setRefreshPeriod(pacer.getRefreshPeriodUs());
+    dynamicResolution.frameEnded();
+    qualityGovernor.setRefreshPeriod(pacer.getRefreshPeriodUs());
+    if (qualityGovernor.frameEnded())
+    {
+        // Recorded fragments replay the settings of the level they were drawn at
+        static_cast<HybridLCDGPU2D&>(lcdRef).discardFragments();
+    }
+    if ((getFrameNumber() % TOUCHGFX_MEMORY_BUDGET_SAMPLE_FRAMES) == 0)
+    {
+        MemoryBudget::sample();
+    }
+    if (startupStage == STARTUP_SHOWN)
+    {
+        // setTFTFrameBuffer() may run in the LTDC interrupt, the report is written here
+        startupStage = STARTUP_REPORTED;
+        reportStartup();
+        if (TOUCHGFX_SOAK_TEST)
+        {
+            // After the application registered its channels
+            startSoakTest();
+        }
+    }
+    if (drawnInTick)
+    {
+        idle.frameEnded();
+    }
+
+    const uint32_t ringStalls = nema_hal_get_ring_stalls();
+    if (ringStalls > 0)
+    {
+        nema_hal_reset_ring_stalls();
+        ringStallFrames++;
+        if (ringStalls > ringStallsMax)
+        {
+            ringStallsMax = ringStalls;
+        }
+    }
+
+    SoakTest::frameEnded();
+    if (benchmark.isRunning())
+    {
+        benchmark.frameEnded(getMCULoadPct());
+        if (!benchmark.isRunning())
+        {
+            // Benchmark completed, restore the backend selected by the application
+            useAuxiliaryLCD = frameBufferL8 || !neoChromActive;
+        }
+    }
+}
+
+void TouchGFXHAL::tick()
+{
+    // Benchmarked frames must all be rendered
+    frameSkipped = pacer.startTick() && !benchmark.isRunning();
+    // A late tick tells that the frame of the previous tick missed its VSYNC
+    missClassifier.tickStarted(pacer.isLate(), pacer.getTickLatencyUs());
+    idle.tickStarted();
+    if (idleRefresh.tickStarted())
+    {
+        updateFrameRateCompensation();
+    }
+    drawnInTick = false;
+    // Images decoded by jpegTask are handed to the application before the frame is drawn
+    JPEGImageLoader::poll();
+    HALGPU2D::tick();
+    // Shown on LTDC layer 2, the framebuffer is not touched
+    if (overdraw.getMode() == OverdrawHeatmap::MODE_OVERLAY)
+    {
+        overdraw.tick();
+    }
+    else
+    {
+        perfHUD.tick(getMCULoadPct(), getGPU2DLoadPct());
+    }
+    SoakTest::tick();
+
+    // Only suspended with nothing left to show, the swap to a frame still on GPU2D or
+    // queued for the next vertical blanking needs the line interrupt
+    const bool busy = drawnInTick || reloadPending || !nema_hal_fence_signaled() || benchmark.isRunning()
+                      || SoakTest::isRunning();
+    if (idleRefresh.tickEnded(busy))
+    {
+        updateFrameRateCompensation();
+    }
+    idle.tickEnded(busy);
+}
+
+void TouchGFXHAL::updateFrameRateCompensation()
+{
+    // A tick at the lower refresh rate stands for several VSYNCs at the nominal rate, which
+    // the framework only turns into ticks with compensation enabled. It is not otherwise used.
+    setFrameRateCompensation(idleRefresh.isLowered());
+}
+
+void TouchGFXHAL::backPorchExited()
+{
+    // OSWrappers::waitForVSync() has returned
+    CortexMMCUInstrumentation::taskWoken(CortexMMCUInstrumentation::INTERRUPT_LTDC, vsyncWaitCycles);
+    // Never show a frame that GPU2D is still rendering
+    nema_hal_fence_wait();
+    HALGPU2D::backPorchExited();
+    // The task waits for the next VSYNC when this returns
+    vsyncWaitCycles = getCPUCycles();
 }
 
 extern "C"
@@ -192,10 +972,1138 @@ extern "C"
     }
 }
 
-void TouchGFXHAL::activateNeoChrom(bool active)
+void TouchGFXHAL::reportGPU2DMemory()
+{
+    static const char* const poolNames[NEMA_HAL_NUM_POOLS] = { "mem", "stencil", "fallback" };
+
+    for (int pool = 0; pool < NEMA_HAL_NUM_POOLS; pool++)
+    {
+        nema_hal_pool_stats_t stats;
+        if (nema_hal_get_pool_stats(pool, &stats) == 0 && stats.size > 0)
+        {
+            tracePrintf("nema pool %s: size=%lu used=%lu high=%lu allocs=%lu failed=%lu fallback=%lu untracked=%lu alloc_max=%lu free_blocks=%lu largest_free=%lu",
+                        poolNames[pool],
+                        (unsigned long)stats.size,
+                        (unsigned long)stats.used,
+                        (unsigned long)stats.high_water,
+                        (unsigned long)stats.allocations,
+                        (unsigned long)stats.failures,
+                        (unsigned long)stats.fallbacks,
+                        (unsigned long)stats.untracked,
+                        (unsigned long)stats.alloc_cycles_max,
+                        (unsigned long)stats.free_blocks,
+                        (unsigned long)stats.largest_free);
+        }
+    }
+    tracePrintf("nema ring: size=%lu cl=%lu stalled_frames=%lu max_stalls=%lu",
+                (unsigned long)NEMA_HAL_RING_SIZE,
+                (unsigned long)NEMA_HAL_CL_SIZE,
+                (unsigned long)ringStallFrames,
+                (unsigned long)ringStallsMax);
+}
+
+void TouchGFXHAL::frameBufferUsage(const void* context, MemoryBudget::Usage& usage)
+{
+    const TouchGFXHAL* const hal = static_cast<const TouchGFXHAL*>(context);
+    uint32_t buffers = (hal->frameBuffers[1] != 0) ? 2U : 1U;
+    if (hal->tripleBuffering)
+    {
+        buffers++;
+    }
+    usage.used = buffers * FRAME_BUFFER_BYTES;
+}
+
+void TouchGFXHAL::sampleGPU2DTiming()
+{
+    nema_hal_get_gpu_stats(&gpuFrame);
+    nema_hal_reset_gpu_stats();
+
+    gpuFrames++;
+    gpuElapsedSum += gpuFrame.elapsed_cycles;
+    gpuBusySum += gpuFrame.busy_cycles;
+    if (gpuFrame.busy_cycles > gpuBusyMax)
+    {
+        gpuBusyMax = gpuFrame.busy_cycles;
+    }
+    gpuCommandLists += gpuFrame.command_lists;
+    gpuIdleGaps += gpuFrame.idle_gaps;
+    if (gpuFrame.longest_gap_cycles > gpuLongestGap)
+    {
+        gpuLongestGap = gpuFrame.longest_gap_cycles;
+    }
+}
+
+uint8_t TouchGFXHAL::getGPU2DLoadPct() const
+{
+    if (gpuFrame.elapsed_cycles == 0)
+    {
+        return 0;
+    }
+    return (uint8_t)(((uint64_t)gpuFrame.busy_cycles * 100U) / gpuFrame.elapsed_cycles);
+}
+
+void TouchGFXHAL::reportGPU2DTiming()
 {
-    useAuxiliaryLCD = !active;
+    if (gpuFrames == 0)
+    {
+        return;
+    }
+    const uint32_t load = gpuElapsedSum > 0 ? (uint32_t)((gpuBusySum * 100U) / gpuElapsedSum) : 0U;
+    tracePrintf("gpu2d timing: frames=%lu busy_avg=%luus busy_max=%luus gpu_load=%lu%% mcu_load=%d%% cl/frame=%lu.%02lu gaps/frame=%lu.%02lu longest_gap=%luus",
+                (unsigned long)gpuFrames,
+                (unsigned long)cyclesToUs((uint32_t)(gpuBusySum / gpuFrames)),
+                (unsigned long)cyclesToUs(gpuBusyMax),
+                (unsigned long)load,
+                getMCULoadPct(),
+                (unsigned long)(gpuCommandLists / gpuFrames),
+                (unsigned long)((gpuCommandLists % gpuFrames) * 100U / gpuFrames),
+                (unsigned long)(gpuIdleGaps / gpuFrames),
+                (unsigned long)((gpuIdleGaps % gpuFrames) * 100U / gpuFrames),
+                (unsigned long)cyclesToUs(gpuLongestGap));
+
+    gpuFrames = 0;
+    gpuElapsedSum = 0;
+    gpuBusySum = 0;
+    gpuBusyMax = 0;
+    gpuCommandLists = 0;
+    gpuIdleGaps = 0;
+    gpuLongestGap = 0;
+}
+
+void TouchGFXHAL::enqueueBlit(const touchgfx::BlitOp& op)
+{
+    const uint32_t pixels = (uint32_t)op.nSteps * op.nLoops;
+    if (op.operation != BLIT_OP_FILL)
+    {
+        CortexMMCUInstrumentation::countRead(op.pSrc, CortexMMCUInstrumentation::pixelBytes((Bitmap::BitmapFormat)op.srcFormat, pixels));
+    }
+    CortexMMCUInstrumentation::countWrite(op.pDst, CortexMMCUInstrumentation::pixelBytes((Bitmap::BitmapFormat)op.dstFormat, pixels));
+    dma.addToQueue(op);
 }
+
+void TouchGFXHAL::reportBlitDispatch()
+{
+    HybridLCDGPU2D& display = static_cast<HybridLCDGPU2D&>(lcdRef);
+    const HybridLCDGPU2D::Stats& stats = display.getStats();
+    const uint64_t pixels = (uint64_t)stats.dma2dPixels + stats.gpu2dPixels + stats.cpuPixels;
+
+    tracePrintf("blit dispatch: cpu ops=%lu px=%lu dma2d ops=%lu px=%lu gpu2d ops=%lu px=%lu dma2d_share=%lu%% gpu_syncs=%lu dma_syncs=%lu fill_batches=%lu fills=%lu blit_batches=%lu sorted=%lu reordered=%lu quad_batches=%lu quads=%lu scaled=%lu tiled=%lu/%lu transitions=%lu tsvgs=%lu masks=%lu masked=%lu kicks=%lu video=%lu indexed=%lu premultiplied=%lu portrait=%lu fragments rec=%lu replay=%lu overflow=%lu clut loads=%lu reuses=%lu dma2d irqs=%lu chained=%lu",
+                (unsigned long)stats.cpuOps,
+                (unsigned long)stats.cpuPixels,
+                (unsigned long)stats.dma2dOps,
+                (unsigned long)stats.dma2dPixels,
+                (unsigned long)stats.gpu2dOps,
+                (unsigned long)stats.gpu2dPixels,
+                (unsigned long)(pixels ? (stats.dma2dPixels * 100ULL) / pixels : 0),
+                (unsigned long)stats.gpu2dSyncs,
+                (unsigned long)stats.dma2dSyncs,
+                (unsigned long)stats.fillBatches,
+                (unsigned long)stats.fills,
+                (unsigned long)stats.blitBatches,
+                (unsigned long)stats.sortedBlits,
+                (unsigned long)stats.reorderedBlits,
+                (unsigned long)stats.quadBatches,
+                (unsigned long)stats.quads,
+                (unsigned long)stats.scaledBitmaps,
+                (unsigned long)stats.tiledBitmaps,
+                (unsigned long)stats.tiles,
+                (unsigned long)stats.transitions,
+                (unsigned long)stats.tsvgs,
+                (unsigned long)stats.coverageMasks,
+                (unsigned long)stats.maskedBitmaps,
+                (unsigned long)stats.kicks,
+                (unsigned long)stats.videoFrames,
+                (unsigned long)stats.indexedBitmaps,
+                (unsigned long)stats.premultiplied,
+                (unsigned long)stats.rotated,
+                (unsigned long)stats.fragmentsRecorded,
+                (unsigned long)stats.fragmentsReplayed,
+                (unsigned long)stats.fragmentOverflows,
+                (unsigned long)STM32ChromARTDMA::getClutStats().loads,
+                (unsigned long)STM32ChromARTDMA::getClutStats().reuses,
+                (unsigned long)STM32ChromARTDMA::getChainStats().interrupts,
+                (unsigned long)STM32ChromARTDMA::getChainStats().chained);
+    // The stencil the vector areas needed, against the tile or the full screen pool
+    tracePrintf("vg stencil: areas=%lu tiles=%lu px=%lu extent=%lux%lu tile=%lux%lu clipped=%lu",
+                (unsigned long)stats.vectorAreas,
+                (unsigned long)stats.stencilTiles,
+                (unsigned long)stats.stencilPixels,
+                (unsigned long)stats.stencilRight,
+                (unsigned long)stats.stencilBottom,
+                (unsigned long)NEMA_HAL_STENCIL_TILE_WIDTH,
+                (unsigned long)NEMA_HAL_STENCIL_TILE_HEIGHT,
+                (unsigned long)stats.stencilClipped);
+    display.resetStats();
+    STM32ChromARTDMA::resetClutStats();
+    STM32ChromARTDMA::resetChainStats();
+}
+
+void TouchGFXHAL::reportBlitCosts()
+{
+    static const char* const operationNames[HybridLCDGPU2D::NUMBER_OF_COSTED_OPERATIONS] = { "fill", "blend", "copy" };
+    static const char* const engineNames[HybridLCDGPU2D::NUMBER_OF_ENGINES] = { "cpu", "dma2d", "gpu2d" };
+
+    const HybridLCDGPU2D& display = static_cast<HybridLCDGPU2D&>(lcdRef);
+    for (int operation = 0; operation < HybridLCDGPU2D::NUMBER_OF_COSTED_OPERATIONS; operation++)
+    {
+        for (int engine = 0; engine < HybridLCDGPU2D::NUMBER_OF_ENGINES; engine++)
+        {
+            const HybridLCDGPU2D::EngineCost& cost = display.getCost((HybridLCDGPU2D::CostedOperation)operation, (HybridLCDGPU2D::Engine)engine);
+            if (cost.setupCycles != HybridLCDGPU2D::UNAVAILABLE)
+            {
+                tracePrintf("blit cost %s %s: setup=%lu per64px=%lu",
+                            operationNames[operation],
+                            engineNames[engine],
+                            (unsigned long)cost.setupCycles,
+                            (unsigned long)cost.cyclesPer64Pixels);
+            }
+        }
+    }
+    tracePrintf("blit cost sync: %lu", (unsigned long)display.getSyncCycles());
+}
+
+void TouchGFXHAL::reportMemoryTraffic()
+{
+    static const char* const regionNames[CortexMMCUInstrumentation::NUMBER_OF_REGIONS] = { "psram", "flash", "axi", "other" };
+
+    const CortexMMCUInstrumentation::MemoryTraffic& traffic = instrumentation.getMemoryTraffic();
+    if (traffic.frames == 0)
+    {
+        return;
+    }
+    tracePrintf("memory traffic: frames=%lu render=%luus peak=%luB",
+                (unsigned long)traffic.frames,
+                (unsigned long)(traffic.renderCycles / traffic.frames / (SystemCoreClock / 1000000U)),
+                (unsigned long)traffic.peakFrameBytes);
+    for (int region = 0; region < CortexMMCUInstrumentation::NUMBER_OF_REGIONS; region++)
+    {
+        tracePrintf("memory traffic %s: read=%luB/frame written=%luB/frame",
+                    regionNames[region],
+                    (unsigned long)(traffic.bytesRead[region] / traffic.frames),
+                    (unsigned long)(traffic.bytesWritten[region] / traffic.frames));
+    }
+    instrumentation.resetMemoryTraffic();
+}
+
+void TouchGFXHAL::reportInterruptTiming()
+{
+    static const char* const names[CortexMMCUInstrumentation::NUMBER_OF_INTERRUPTS] = { "ltdc", "gpu2d", "dma2d", "jpeg" };
+    static const IRQn_Type irqs[CortexMMCUInstrumentation::NUMBER_OF_INTERRUPTS] = { LTDC_IRQn, GPU2D_IRQn, DMA2D_IRQn, JPEG_IRQn };
+
+    for (int irq = 0; irq < CortexMMCUInstrumentation::NUMBER_OF_INTERRUPTS; irq++)
+    {
+        const CortexMMCUInstrumentation::InterruptTiming& timing = instrumentation.getInterruptTiming((CortexMMCUInstrumentation::Interrupt)irq);
+        if (timing.count == 0)
+        {
+            continue;
+        }
+        tracePrintf("irq %s: priority=%lu count=%lu duration<=%luus latency<=%luus wake<=%luus late=%lu",
+                    names[irq],
+                    (unsigned long)NVIC_GetPriority(irqs[irq]),
+                    (unsigned long)timing.count,
+                    (unsigned long)timing.maxDurationUs,
+                    (unsigned long)timing.maxLatencyUs,
+                    (unsigned long)timing.maxWakeUs,
+                    (unsigned long)timing.late);
+        const uint32_t* const histograms[3] = { timing.duration, timing.latency, timing.wake };
+        static const char* const kinds[3] = { "duration", "latency", "wake" };
+        for (int kind = 0; kind < 3; kind++)
+        {
+            char line[TOUCHGFX_INTERRUPT_TIMING_BUCKETS * 11 + 1];
+            int length = 0;
+            uint32_t total = 0;
+            for (int bucket = 0; bucket < TOUCHGFX_INTERRUPT_TIMING_BUCKETS; bucket++)
+            {
+                total += histograms[kind][bucket];
+                length += snprintf(line + length, sizeof(line) - length, " %lu", (unsigned long)histograms[kind][bucket]);
+            }
+            if (total != 0)
+            {
+                tracePrintf("irq %s %s:%s", names[irq], kinds[kind], line);
+            }
+        }
+    }
+    instrumentation.resetInterruptTiming();
+}
+
+void TouchGFXHAL::cleanDCache(const void* data, uint32_t size)
+{
+    DCacheMaintenance::clean(data, size);
+}
+
+void TouchGFXHAL::InvalidateCache()
+{
+    static_cast<STM32ChromARTDMA&>(dma).invalidateWritten();
+    if (frameBufferFlushed)
+    {
+        DCacheMaintenance::invalidate(getClientFrameBuffer(), (uint32_t)FRAME_BUFFER_WIDTH * FRAME_BUFFER_HEIGHT * lcd().bitDepth() / 8);
+        frameBufferFlushed = false;
+    }
+}
+
+void TouchGFXHAL::FlushCache()
+{
+    // The destination of a blit is cleaned as the blit is queued
+    if (static_cast<STM32ChromARTDMA&>(dma).isQueuing())
+    {
+        return;
+    }
+    // GPU2D command lists may write anywhere in the framebuffer
+    DCacheMaintenance::clean(getClientFrameBuffer(), (uint32_t)FRAME_BUFFER_WIDTH * FRAME_BUFFER_HEIGHT * lcd().bitDepth() / 8);
+    frameBufferFlushed = true;
+}
+
+void TouchGFXHAL::reportCacheMaintenance()
+{
+    const DCacheMaintenance::Stats& stats = DCacheMaintenance::getStats();
+    tracePrintf("dcache maintenance: psram=%s skipped=%lu by_addr=%lu lines=%lu whole=%lu",
+                MPUProfile::getName(MPUProfile::getProfile()),
+                (unsigned long)stats.skipped,
+                (unsigned long)stats.byAddress,
+                (unsigned long)stats.lines,
+                (unsigned long)stats.wholeCache);
+    DCacheMaintenance::resetStats();
+
+    nema_hal_icache_stats_t icache;
+    nema_hal_get_icache_stats(&icache);
+    tracePrintf("gpu2d icache: disable_holds=%lu invalidate_holds=%lu invalidations=%lu spared=%lu writes=%lu/%lu hits=%lu misses=%lu",
+                (unsigned long)icache.disable_holds,
+                (unsigned long)icache.invalidate_holds,
+                (unsigned long)icache.invalidations,
+                (unsigned long)icache.spared,
+                (unsigned long)icache.cached_writes,
+                (unsigned long)(icache.cached_writes + icache.uncached_writes),
+                (unsigned long)icache.hits,
+                (unsigned long)icache.misses);
+    nema_hal_reset_icache_stats();
+}
+
+void TouchGFXHAL::reportDynamicResolution()
+{
+    const DynamicResolution::Stats& stats = dynamicResolution.getStats();
+    tracePrintf("dynamic resolution: scale=%u%% frames=%lu/%lu/%lu over_budget=%lu lowered=%lu raised=%lu longest=%luus",
+                (unsigned)dynamicResolution.getScalePercent(),
+                (unsigned long)stats.frames[0],
+                (unsigned long)stats.frames[1],
+                (unsigned long)stats.frames[2],
+                (unsigned long)stats.overBudget,
+                (unsigned long)stats.lowered,
+                (unsigned long)stats.raised,
+                (unsigned long)stats.longestUs);
+    dynamicResolution.resetStats();
+}
+
+void TouchGFXHAL::reportQualityGovernor()
+{
+    const QualityGovernor::Stats& stats = qualityGovernor.getStats();
+    tracePrintf("quality governor: level=%u frames=%lu/%lu/%lu over_budget=%lu lowered=%lu raised=%lu small_paths=%lu/%lu",
+                (unsigned)qualityGovernor.getLevel(),
+                (unsigned long)stats.frames[QualityGovernor::QUALITY_HIGH],
+                (unsigned long)stats.frames[QualityGovernor::QUALITY_MEDIUM],
+                (unsigned long)stats.frames[QualityGovernor::QUALITY_LOW],
+                (unsigned long)stats.overBudget,
+                (unsigned long)stats.lowered,
+                (unsigned long)stats.raised,
+                (unsigned long)stats.smallPaths,
+                (unsigned long)stats.paths);
+    qualityGovernor.resetStats();
+}
+
+void TouchGFXHAL::reportBlockCopy()
+{
+    const AsyncBlockCopy::Stats& stats = blockCopier.getStats();
+    tracePrintf("block copy: dma2d=%lu/%luKB cpu=%lu/%luKB waits=%lu",
+                (unsigned long)stats.dma2dCopies,
+                (unsigned long)(stats.dma2dBytes / 1024),
+                (unsigned long)stats.cpuCopies,
+                (unsigned long)(stats.cpuBytes / 1024),
+                (unsigned long)stats.waits);
+    blockCopier.resetStats();
+}
+
+void TouchGFXHAL::reportAssetUploads()
+{
+    const AssetUploadQueue::Stats& stats = assetUploads.getStats();
+    tracePrintf("asset uploads: high=%lu normal=%lu low=%lu %luKB cpu=%lu full=%lu overtaken=%lu waits=%lu",
+                (unsigned long)stats.uploads[AssetUploadQueue::PRIORITY_HIGH],
+                (unsigned long)stats.uploads[AssetUploadQueue::PRIORITY_NORMAL],
+                (unsigned long)stats.uploads[AssetUploadQueue::PRIORITY_LOW],
+                (unsigned long)(stats.uploadBytes / 1024),
+                (unsigned long)stats.cpuCopies,
+                (unsigned long)stats.queueFull,
+                (unsigned long)stats.overtaken,
+                (unsigned long)stats.waits);
+    assetUploads.resetStats();
+}
+
+void TouchGFXHAL::reportTextureCache()
+{
+    const TextureCache::Entry* const entries = textureCache.getEntries();
+    for (int i = 0; i < TOUCHGFX_TEXTURE_CACHE_ENTRIES; i++)
+    {
+        const TextureCache::Entry& entry = entries[i];
+        if (entry.id == BITMAP_INVALID)
+        {
+            continue;
+        }
+        tracePrintf("texture cache: bitmap=%u cached=%d pinned=%d hits=%lupx misses=%lupx",
+                    (unsigned)entry.id,
+                    Bitmap::cacheIsCached(entry.id) ? 1 : 0,
+                    entry.pinned ? 1 : 0,
+                    (unsigned long)entry.hits,
+                    (unsigned long)entry.misses);
+    }
+    textureCache.resetStats();
+
+    const PixelConversion::Stats& conversions = PixelConversion::getStats();
+    tracePrintf("pixel conversion: conversions=%lu cpu=%lupx dma2d=%lupx",
+                (unsigned long)conversions.conversions,
+                (unsigned long)conversions.cpuPixels,
+                (unsigned long)conversions.dma2dPixels);
+    PixelConversion::resetStats();
+}
+
+uint32_t TouchGFXHAL::glyphAtlasHitRate(const void* context)
+{
+    const GlyphAtlas::Stats& stats = static_cast<const TouchGFXHAL*>(context)->glyphAtlas.getStats();
+    return hitRatePct(glyphAtlasHits, stats.hits, stats.hits + stats.added + stats.overflows);
+}
+
+uint32_t TouchGFXHAL::textureCacheHitRate(const void* context)
+{
+    const TextureCache::Entry* const entries = static_cast<const TouchGFXHAL*>(context)->textureCache.getEntries();
+    uint32_t hits = 0;
+    uint32_t misses = 0;
+    for (int i = 0; i < TOUCHGFX_TEXTURE_CACHE_ENTRIES; i++)
+    {
+        hits += entries[i].hits;
+        misses += entries[i].misses;
+    }
+    return hitRatePct(textureCacheHits, hits, hits + misses);
+}
+
+void TouchGFXHAL::reportGlyphAtlas()
+{
+    HybridLCDGPU2D& display = static_cast<HybridLCDGPU2D&>(lcdRef);
+    const GlyphAtlas::Stats& stats = glyphAtlas.getStats();
+    const HybridLCDGPU2D::Stats& batches = display.getStats();
+    tracePrintf("glyph atlas: hits=%lu added=%lu overflows=%lu evictions=%lu batches=%lu glyphs=%lu",
+                (unsigned long)stats.hits,
+                (unsigned long)stats.added,
+                (unsigned long)stats.overflows,
+                (unsigned long)stats.evictions,
+                (unsigned long)batches.glyphBatches,
+                (unsigned long)batches.glyphs);
+    glyphAtlas.resetStats();
+}
+
+void TouchGFXHAL::reportVectorFonts()
+{
+    const CachedVectorFontRenderer::Stats& stats = vectorFontRenderer.getStats();
+    tracePrintf("vector fonts: hits=%lu converted=%lu overflows=%lu clears=%lu too_large=%lu",
+                (unsigned long)stats.hits,
+                (unsigned long)stats.converted,
+                (unsigned long)stats.overflows,
+                (unsigned long)stats.clears,
+                (unsigned long)stats.tooLarge);
+    vectorFontRenderer.resetStats();
+}
+
+void TouchGFXHAL::reportShapedText()
+{
+    const ShapedTextCache::Stats& stats = shapedTextCache.getStats();
+    tracePrintf("shaped text: hits=%lu recorded=%lu overflows=%lu uncached=%lu clears=%lu",
+                (unsigned long)stats.hits,
+                (unsigned long)stats.recorded,
+                (unsigned long)stats.overflows,
+                (unsigned long)stats.uncached,
+                (unsigned long)stats.clears);
+    shapedTextCache.resetStats();
+}
+
+uint16_t* TouchGFXHAL::lockFrameBuffer()
+{
+    // The CPU or another operation may use what has been drawn so far
+    static_cast<HybridLCDGPU2D&>(lcdRef).flushGlyphs();
+    const uint32_t start = getCPUCycles();
+    // GPU2D may still be rendering into the framebuffer
+    nema_hal_fence_wait();
+    uint16_t* const frameBuffer = HALGPU2D::lockFrameBuffer();
+    missClassifier.semaphoreWaited(getCPUCycles() - start);
+    return frameBuffer;
+}
+
+void TouchGFXHAL::unlockFrameBuffer()
+{
+    static_cast<HybridLCDGPU2D&>(lcdRef).flushGlyphs();
+    // Marks DMA2D as no longer reserved by the framework
+    HAL::unlockFrameBuffer();
+}
+
+void TouchGFXHAL::activateNeoChrom(bool active)
+{
+    neoChromActive = active;
+    if (!benchmark.isRunning())
+    {
+        useAuxiliaryLCD = frameBufferL8 || !active;
+    }
+}
+
+void TouchGFXHAL::checkGPU2DRecovery()
+{
+    const uint32_t recoveries = nema_hal_get_recoveries();
+    if (recoveries == gpuRecoveries)
+    {
+        return;
+    }
+    gpuRecoveries = recoveries;
+    // The frames drawn since the last wait may be incomplete, all of the next one is drawn
+    Application::getInstance()->invalidate();
+    if (TOUCHGFX_GPU2D_FAULT_LIMIT > 0 && recoveries >= TOUCHGFX_GPU2D_FAULT_LIMIT && neoChromActive)
+    {
+        activateNeoChrom(false);
+        tracePrintf("gpu2d fault: reset %lu times, rendering in software", (unsigned long)recoveries);
+    }
+    else
+    {
+        tracePrintf("gpu2d fault: reset %lu times", (unsigned long)recoveries);
+    }
+}
+
+void TouchGFXHAL::reportFramePacing()
+{
+    const FramePacer::Stats& stats = pacer.getStats();
+
+    tracePrintf("frame pacing: refresh=%luus ticks=%lu late=%lu skipped=%lu",
+                (unsigned long)pacer.getRefreshPeriodUs(),
+                (unsigned long)stats.ticks,
+                (unsigned long)stats.late,
+                (unsigned long)stats.skipped);
+    pacer.resetStats();
+}
+
+void TouchGFXHAL::reportFrameMisses()
+{
+    const FrameMissClassifier::Stats& stats = missClassifier.getStats();
+
+    tracePrintf("frame misses: frames=%lu missed=%lu cpu=%lu gpu=%lu memory=%lu semaphore=%lu tick=%lu worst=%luus recent cpu=%lu gpu=%lu memory=%lu semaphore=%lu tick=%lu fix_first=%s",
+                (unsigned long)stats.frames,
+                (unsigned long)stats.missed,
+                (unsigned long)stats.causes[FrameMissClassifier::CAUSE_CPU],
+                (unsigned long)stats.causes[FrameMissClassifier::CAUSE_GPU],
+                (unsigned long)stats.causes[FrameMissClassifier::CAUSE_MEMORY],
+                (unsigned long)stats.causes[FrameMissClassifier::CAUSE_SEMAPHORE],
+                (unsigned long)stats.causes[FrameMissClassifier::CAUSE_TICK],
+                (unsigned long)stats.worstUs,
+                (unsigned long)missClassifier.getRecent(FrameMissClassifier::CAUSE_CPU),
+                (unsigned long)missClassifier.getRecent(FrameMissClassifier::CAUSE_GPU),
+                (unsigned long)missClassifier.getRecent(FrameMissClassifier::CAUSE_MEMORY),
+                (unsigned long)missClassifier.getRecent(FrameMissClassifier::CAUSE_SEMAPHORE),
+                (unsigned long)missClassifier.getRecent(FrameMissClassifier::CAUSE_TICK),
+                FrameMissClassifier::getName(missClassifier.getMostFrequent()));
+
+    // The recent causes are kept, they cover the latest misses whenever they happened
+    missClassifier.resetStats();
+}
+
+void TouchGFXHAL::reportOverdraw()
+{
+    const OverdrawHeatmap::Stats& stats = overdraw.getStats();
+    const uint32_t written = stats.written[OverdrawHeatmap::BACKEND_GPU2D] + stats.written[OverdrawHeatmap::BACKEND_DMA2D] + stats.written[OverdrawHeatmap::BACKEND_CPU];
+    // Hundredths, printf of floats is not linked
+    const uint32_t average = (stats.flushed > 0) ? (uint32_t)(((uint64_t)written * 100U) / stats.flushed) : 0U;
+
+    tracePrintf("overdraw: frames=%lu gpu2d=%lu dma2d=%lu cpu=%lu flushed=%lu average=%lu.%02lu worst=%u.%02u at %u,%u",
+                (unsigned long)stats.frames,
+                (unsigned long)stats.written[OverdrawHeatmap::BACKEND_GPU2D],
+                (unsigned long)stats.written[OverdrawHeatmap::BACKEND_DMA2D],
+                (unsigned long)stats.written[OverdrawHeatmap::BACKEND_CPU],
+                (unsigned long)stats.flushed,
+                (unsigned long)(average / 100), (unsigned long)(average % 100),
+                (unsigned)(stats.worst / 16), (unsigned)((stats.worst % 16) * 100 / 16),
+                (unsigned)stats.worstX, (unsigned)stats.worstY);
+
+    overdraw.resetStats();
+}
+
+void TouchGFXHAL::reportVideoStreams()
+{
+#if VIDEO_FRAME_AHEAD_BUFFERS > 0
+    VideoStreamScheduler& scheduler = VideoStreamScheduler::getInstance();
+    for (uint32_t i = 0; i < scheduler.getNumberOfStreams(); i++)
+    {
+        VideoStreamScheduler::Stats stats;
+        if (scheduler.getStats(i, stats))
+        {
+            tracePrintf("video stream %lu: decoded=%lu shown=%lu dropped=%lu skipped=%lu late=%lu decode=%lums",
+                        (unsigned long)i,
+                        (unsigned long)stats.decoded,
+                        (unsigned long)stats.shown,
+                        (unsigned long)stats.dropped,
+                        (unsigned long)stats.skipped,
+                        (unsigned long)stats.late,
+                        (unsigned long)stats.decodeMs);
+        }
+    }
+    scheduler.resetStats();
+#endif
+}
+
+void TouchGFXHAL::reportVideoClock()
+{
+    const VideoClock::Stats& stats = VideoClock::getStats();
+
+    tracePrintf("video clock: frames=%lu skipped=%lu late=%lu drift last=%luus max=%luus",
+                (unsigned long)stats.frames,
+                (unsigned long)stats.skipped,
+                (unsigned long)stats.late,
+                (unsigned long)stats.driftUs,
+                (unsigned long)stats.maxDriftUs);
+    VideoClock::resetStats();
+}
+
+void TouchGFXHAL::reportIdleSuspend()
+{
+    const IdleSuspend::Stats& stats = idle.getStats();
+
+    tracePrintf("idle suspend: enabled=%d suspends=%lu suspended=%lums tick latency max=%lums frame latency last=%lums max=%lums",
+                idle.isEnabled() ? 1 : 0,
+                (unsigned long)stats.suspends,
+                (unsigned long)stats.suspendedMs,
+                (unsigned long)stats.tickLatencyMaxMs,
+                (unsigned long)stats.frameLatencyLastMs,
+                (unsigned long)stats.frameLatencyMaxMs);
+    idle.resetStats();
+}
+
+void TouchGFXHAL::reportIdleRefreshRate()
+{
+    const IdleRefreshRate::Stats& stats = idleRefresh.getStats();
+
+    tracePrintf("idle refresh: enabled=%d divider=%u lowered=%d lowerings=%lu time=%lums wake-ups=%lu",
+                idleRefresh.isEnabled() ? 1 : 0,
+                (unsigned)idleRefresh.getDivider(),
+                idleRefresh.isLowered() ? 1 : 0,
+                (unsigned long)stats.lowered,
+                (unsigned long)stats.loweredMs,
+                (unsigned long)stats.wakeUps);
+    idleRefresh.resetStats();
+}
+
+void TouchGFXHAL::reportRtosMemory()
+{
+    RTOS_POOL_StatsTypeDef stats;
+    RTOS_POOL_GetStats(&stats);
+
+    tracePrintf("rtos memory: pool blocks=%lu/%lu queue bytes=%lu/%lu fallbacks=%lu heap free=%lu min=%lu of %lu",
+                (unsigned long)stats.BlocksUsed,
+                (unsigned long)RTOS_POOL_BLOCKS,
+                (unsigned long)stats.QueueBytesUsed,
+                (unsigned long)RTOS_POOL_QUEUE_BYTES,
+                (unsigned long)stats.Fallbacks,
+                (unsigned long)stats.HeapFree,
+                (unsigned long)stats.HeapMinFree,
+                (unsigned long)stats.HeapSize);
+}
+
+void TouchGFXHAL::setTripleBuffering(bool enabled)
+{
+    tripleBuffering = enabled && frameBuffers[1] != 0 && frameBuffers[2] != 0;
+}
+
+uint8_t TouchGFXHAL::getClientFrameBufferAge()
+{
+    if (frameBuffer1 == 0 || getFrameRefreshStrategy() == REFRESH_STRATEGY_PARTIAL_FRAMEBUFFER)
+    {
+        // Rendered into the pixels of the previous frame
+        return 1;
+    }
+    const int client = indexOf(getClientFrameBuffer());
+    if (client < 0 || renderedFrame[client] == 0)
+    {
+        return 0;
+    }
+    const uint32_t age = getFrameNumber() - renderedFrame[client];
+    return age > 255 ? 0 : (uint8_t)age;
+}
+
+bool TouchGFXHAL::copyPreviousFrame(const Rect& area, int16_t dx, int16_t dy)
+{
+    const uint16_t* const latest = getTFTFrameBuffer();
+    if (frameBuffer1 == 0
+        || latest == getClientFrameBuffer()
+        || indexOf(latest) < 0
+        || DISPLAY_ROTATION != rotate0
+        || lcd().framebufferFormat() != Bitmap::RGB565
+        || getFrameRefreshStrategy() == REFRESH_STRATEGY_PARTIAL_FRAMEBUFFER)
+    {
+        return false;
+    }
+    const Rect target = Rect(area.x + dx, area.y + dy, area.width, area.height) & area;
+    if (target.isEmpty())
+    {
+        return true;
+    }
+    // The whole latest framebuffer as a bitmap placed dx, dy from the display origin, opaque
+    // copies of at least HYBRID_BLIT_DMA2D_MIN_PIXELS are done by DMA2D
+    lcd().blitCopy(latest, Rect(dx, dy, FRAME_BUFFER_WIDTH, FRAME_BUFFER_HEIGHT), target, 255, false);
+    return true;
+}
+
+bool TouchGFXHAL::isTileUnchanged(uint16_t column, uint16_t row)
+{
+#if TOUCHGFX_TILE_HASH
+    const uint16_t* const latest = getTFTFrameBuffer();
+    const uint16_t* const client = getClientFrameBuffer();
+    const int latestIndex = indexOf(latest);
+    const int clientIndex = indexOf(client);
+    if (frameBuffer1 == 0
+        || latestIndex < 0
+        || clientIndex < 0
+        || latestIndex >= (int)FRAME_BUFFER_COUNT
+        || clientIndex >= (int)FRAME_BUFFER_COUNT
+        || latest == client
+        || renderedFrame[latestIndex] == 0
+        || renderedFrame[clientIndex] == 0
+        || column >= TILE_COLUMNS
+        || row >= TILE_ROWS
+        || DISPLAY_ROTATION != rotate0
+        || lcd().framebufferFormat() != Bitmap::RGB565
+        || getFrameRefreshStrategy() == REFRESH_STRATEGY_PARTIAL_FRAMEBUFFER)
+    {
+        return false;
+    }
+    if (tileFrame != getFrameNumber())
+    {
+        tileFrame = getFrameNumber();
+        tilesUnchangedFrame = 0;
+    }
+    tilesCompared++;
+
+    const Rect tile = Rect(column * TOUCHGFX_TILE_HASH_SIZE, row * TOUCHGFX_TILE_HASH_SIZE, TOUCHGFX_TILE_HASH_SIZE, TOUCHGFX_TILE_HASH_SIZE) & Rect(0, 0, FRAME_BUFFER_WIDTH, FRAME_BUFFER_HEIGHT);
+    const uint16_t index = row * TILE_COLUMNS + column;
+    const int buffers[2] = { latestIndex, clientIndex };
+    const uint16_t* const pixels[2] = { latest, client };
+    for (int i = 0; i < 2; i++)
+    {
+        // A hash taken before the framebuffer was rendered into again is out of date
+        const int buffer = buffers[i];
+        if (tileHashFrame[buffer][index] != renderedFrame[buffer])
+        {
+            tileHash[buffer][index] = hashArea(pixels[i], FRAME_BUFFER_WIDTH, tile);
+            tileHashFrame[buffer][index] = renderedFrame[buffer];
+            tileHashes++;
+        }
+    }
+    if (tileHash[latestIndex][index] != tileHash[clientIndex][index])
+    {
+        return false;
+    }
+    tilesUnchanged++;
+    tilesUnchangedFrame++;
+    tilesUnchangedMax = MAX(tilesUnchangedMax, tilesUnchangedFrame);
+    return true;
+#else
+    (void)column;
+    (void)row;
+    return false;
+#endif
+}
+
+void TouchGFXHAL::reportTileHashes()
+{
+    tracePrintf("tile hash: compared=%lu unchanged=%lu crcs=%lu last_frame=%lu max_frame=%lu",
+                (unsigned long)tilesCompared,
+                (unsigned long)tilesUnchanged,
+                (unsigned long)tileHashes,
+                (unsigned long)(tileFrame == getFrameNumber() ? tilesUnchangedFrame : 0),
+                (unsigned long)tilesUnchangedMax);
+    tilesCompared = 0;
+    tilesUnchanged = 0;
+    tileHashes = 0;
+    tilesUnchangedMax = 0;
+}
+
+void TouchGFXHAL::reportFrameBuffering()
+{
+    tracePrintf("frame buffering: triple=%d swaps=%lu third_buffer=%lu waits=%lu",
+                tripleBuffering ? 1 : 0,
+                (unsigned long)frameSwaps,
+                (unsigned long)thirdBufferFrames,
+                (unsigned long)thirdBufferWaits);
+    frameSwaps = 0;
+    thirdBufferFrames = 0;
+    thirdBufferWaits = 0;
+}
+
+void TouchGFXHAL::frameCompleted(uint16_t* frameBuffer)
+{
+    completedFrames++;
+    const int completed = indexOf(frameBuffer);
+    if (completed >= 0)
+    {
+        renderedFrame[completed] = completedFrames;
+    }
+}
+
+void TouchGFXHAL::updateShownFrameBuffer()
+{
+    // LTDC clears VBR when the queued address has been loaded at vertical blanking
+    if (reloadPending && !(LTDC->SRCR & LTDC_SRCR_VBR))
+    {
+        shownFrameBuffer = latestFrameBuffer;
+        reloadPending = false;
+    }
+}
+
+int TouchGFXHAL::indexOf(const uint16_t* frameBuffer) const
+{
+    for (int i = 0; i < 3; i++)
+    {
+        if (frameBuffers[i] != 0 && frameBuffers[i] == frameBuffer)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+uint16_t* TouchGFXHAL::getSpareFrameBuffer() const
+{
+    for (int i = 0; i < 3; i++)
+    {
+        if (frameBuffers[i] != 0 && frameBuffers[i] != latestFrameBuffer && frameBuffers[i] != shownFrameBuffer)
+        {
+            return frameBuffers[i];
+        }
+    }
+    return frameBuffer1;
+}
+
+bool TouchGFXHAL::setFrameBufferFormat(Bitmap::BitmapFormat format)
+{
+    uint8_t bpp;
+    switch (format)
+    {
+    case Bitmap::RGB565:
+        bpp = 16;
+        break;
+    case Bitmap::RGB888:
+        bpp = 24;
+        break;
+    case Bitmap::ARGB8888:
+        bpp = 32;
+        break;
+#if TOUCHGFX_FRAMEBUFFER_L8
+    case Bitmap::ARGB2222:
+        bpp = 8;
+        break;
+#endif
+    default:
+        return false;
+    }
+    if (bpp > TOUCHGFX_FRAMEBUFFER_MAX_BPP)
+    {
+        return false;
+    }
+    pendingFormat = format;
+    return true;
+}
+
+bool TouchGFXHAL::canDrawInDynamicBitmap(Bitmap::BitmapFormat format) const
+{
+    if (format == lcd().framebufferFormat())
+    {
+        return true;
+    }
+    // The auxiliary LCD renders in software, see activateNeoChrom()
+    return (format == Bitmap::RGB565 || format == Bitmap::RGB888 || format == Bitmap::ARGB8888)
+           && !useAuxiliaryLCD;
+}
+
+bool TouchGFXHAL::drawTextureQuads(const Bitmap& bitmap, const float* corners, uint16_t count, int16_t x, int16_t y, const Rect& clip, uint8_t alpha, bool bilinear)
+{
+    // The auxiliary LCD renders in software, see activateNeoChrom()
+    if (useAuxiliaryLCD)
+    {
+        return false;
+    }
+    return static_cast<HybridLCDGPU2D&>(lcdRef).drawTextureQuads(bitmap, corners, count, x, y, clip, alpha, bilinear);
+}
+
+bool TouchGFXHAL::drawTransition(HybridLCDGPU2D::TransitionEffect effect, bool vertical, bool reverse, const Bitmap& from, const Bitmap& to, float step, const Rect& clip)
+{
+    if (useAuxiliaryLCD)
+    {
+        return false;
+    }
+    return static_cast<HybridLCDGPU2D&>(lcdRef).drawTransition(effect, vertical, reverse, from, to, step, clip);
+}
+
+bool TouchGFXHAL::drawScaledBitmap(const Bitmap& bitmap, const Rect& dest, const Rect& clip, uint8_t alpha, bool bilinear)
+{
+    if (useAuxiliaryLCD)
+    {
+        return false;
+    }
+    return static_cast<HybridLCDGPU2D&>(lcdRef).drawScaledBitmap(bitmap, dest, clip, alpha, bilinear);
+}
+
+bool TouchGFXHAL::drawTiledBitmap(const Bitmap& bitmap, int16_t x, int16_t y, int16_t xOffset, int16_t yOffset, const Rect& clip, uint8_t alpha)
+{
+    if (useAuxiliaryLCD)
+    {
+        return false;
+    }
+    return static_cast<HybridLCDGPU2D&>(lcdRef).drawTiledBitmap(bitmap, x, y, xOffset, yOffset, clip, alpha);
+}
+
+bool TouchGFXHAL::drawA8Mask(const uint8_t* mask, uint16_t width, uint16_t height, int16_t x, int16_t y, const Rect& clip, colortype color, uint8_t alpha)
+{
+    if (useAuxiliaryLCD)
+    {
+        return false;
+    }
+    return static_cast<HybridLCDGPU2D&>(lcdRef).drawA8Mask(mask, width, height, x, y, clip, color, alpha);
+}
+
+bool TouchGFXHAL::drawMaskedBitmap(const uint8_t* mask, uint16_t width, uint16_t height, int16_t x, int16_t y, const Bitmap& bitmap, int16_t u, int16_t v, const Rect& clip, uint8_t alpha)
+{
+    if (useAuxiliaryLCD)
+    {
+        return false;
+    }
+    return static_cast<HybridLCDGPU2D&>(lcdRef).drawMaskedBitmap(mask, width, height, x, y, bitmap, u, v, clip, alpha);
+}
+
+bool TouchGFXHAL::canDrawMaskedBitmap(const Bitmap& bitmap) const
+{
+    return !useAuxiliaryLCD && HybridLCDGPU2D::canSample(bitmap);
+}
+
+bool TouchGFXHAL::renderStringMask(const Rect& widgetArea, const LCD::StringVisuals& visuals, const Unicode::UnicodeChar* text, uint8_t* mask)
+{
+    if (useAuxiliaryLCD)
+    {
+        return false;
+    }
+    return static_cast<HybridLCDGPU2D&>(lcdRef).renderStringMask(widgetArea, visuals, text, mask);
+}
+
+uint32_t TouchGFXHAL::kickGPU2D()
+{
+    if (useAuxiliaryLCD)
+    {
+        return 0;
+    }
+    return static_cast<HybridLCDGPU2D&>(lcdRef).kickGPU2D();
+}
+
+void TouchGFXHAL::waitForKick(uint32_t kick)
+{
+    if (!useAuxiliaryLCD)
+    {
+        static_cast<HybridLCDGPU2D&>(lcdRef).waitForKick(kick);
+    }
+}
+
+bool TouchGFXHAL::drawUYVY(const uint8_t* frame, uint16_t width, uint16_t height, uint32_t stride, int16_t x, int16_t y, const Rect& clip, uint8_t alpha)
+{
+    if (useAuxiliaryLCD)
+    {
+        return false;
+    }
+    return static_cast<HybridLCDGPU2D&>(lcdRef).drawUYVY(frame, width, height, stride, x, y, clip, alpha);
+}
+
+bool TouchGFXHAL::drawTSVG(const void* tsvg, const Matrix3x3& transform, const Rect& clip, float size)
+{
+    if (useAuxiliaryLCD)
+    {
+        return false;
+    }
+    return static_cast<HybridLCDGPU2D&>(lcdRef).drawTSVG(tsvg, transform, clip, size);
+}
+
+HybridLCDGPU2D::FragmentResult TouchGFXHAL::beginFragment(const void* owner, uint32_t version, const Rect& area)
+{
+    if (useAuxiliaryLCD)
+    {
+        return HybridLCDGPU2D::FRAGMENT_UNAVAILABLE;
+    }
+    return static_cast<HybridLCDGPU2D&>(lcdRef).beginFragment(owner, version, area);
+}
+
+bool TouchGFXHAL::endFragment()
+{
+    return static_cast<HybridLCDGPU2D&>(lcdRef).endFragment();
+}
+
+void TouchGFXHAL::discardFragments(const void* owner)
+{
+    static_cast<HybridLCDGPU2D&>(lcdRef).discardFragments(owner);
+}
+
+void TouchGFXHAL::drawDrawableInDynamicBitmap(Drawable& drawable, BitmapId bitmapId, const Rect& rect)
+{
+    const Bitmap::BitmapFormat format = Bitmap(bitmapId).getFormat();
+    const Bitmap::BitmapFormat frameBufferFormat = lcdRef.framebufferFormat();
+    if (format == lcd().framebufferFormat() || !canDrawInDynamicBitmap(format))
+    {
+        HALGPU2D::drawDrawableInDynamicBitmap(drawable, bitmapId, rect);
+        return;
+    }
+    // GPU2D takes the destination format from the LCD for every operation, so it renders
+    // in the format of the bitmap until the framebuffer format is set back
+    HybridLCDGPU2D& lcd = static_cast<HybridLCDGPU2D&>(lcdRef);
+    lcd.flushGlyphs();
+    lcd.setFrameBufferFormat(format);
+    HALGPU2D::drawDrawableInDynamicBitmap(drawable, bitmapId, rect);
+    lcd.flushGlyphs();
+    lcd.setFrameBufferFormat(frameBufferFormat);
+}
+
+void TouchGFXHAL::applyFrameBufferFormat()
+{
+    // GPU2D renders through LCDGPU2D_AXI, which has no 8-bit formats, and DMA2D cannot
+    // write them, so an ARGB2222 framebuffer is rendered by LCD8bpp_ARGB2222 alone
+    frameBufferL8 = (pendingFormat == Bitmap::ARGB2222);
+    if (!frameBufferL8)
+    {
+        static_cast<HybridLCDGPU2D&>(lcdRef).setFrameBufferFormat(pendingFormat);
+    }
+    if (frameBufferL8)
+    {
+        useAuxiliaryLCD = true;
+    }
+    else if (!benchmark.isRunning())
+    {
+        useAuxiliaryLCD = !neoChromActive;
+    }
+    switch (pendingFormat)
+    {
+#if TOUCHGFX_FRAMEBUFFER_MAX_BPP >= 24
+    case Bitmap::RGB888:
+        setAuxiliaryLCD(&lcd24);
+        enableTextureMappers(lcd24);
+        break;
+#endif
+#if TOUCHGFX_FRAMEBUFFER_MAX_BPP >= 32
+    case Bitmap::ARGB8888:
+        setAuxiliaryLCD(&lcd32);
+        enableTextureMappers(lcd32);
+        break;
+#endif
+#if TOUCHGFX_FRAMEBUFFER_L8
+    case Bitmap::ARGB2222:
+        setAuxiliaryLCD(&lcd8);
+        enableTextureMappers(lcd8);
+        break;
+#endif
+    default:
+        setAuxiliaryLCD(&lcd16);
+        break;
+    }
+
+    // Nothing drawn in the old format can be reused by any framebuffer
+    for (int i = 0; i < 3; i++)
+    {
+        renderedFrame[i] = 0;
+    }
+    Application::getInstance()->invalidate();
+    ltdcFormatPending = true;
+}
+
+void TouchGFXHAL::applyLTDCPixelFormat()
+{
+    if (!ltdcFormatPending)
+    {
+        return;
+    }
+    const uint32_t layerIndex = BackgroundLayer::getFrameBufferLayerIndex();
+    const Bitmap::BitmapFormat format = lcd().framebufferFormat();
+    uint32_t pixelFormat = LTDC_PIXEL_FORMAT_RGB565;
+    if (format == Bitmap::RGB888)
+    {
+        pixelFormat = LTDC_PIXEL_FORMAT_RGB888;
+    }
+    else if (format == Bitmap::ARGB8888)
+    {
+        pixelFormat = LTDC_PIXEL_FORMAT_ARGB8888;
+    }
+    else if (format == Bitmap::ARGB2222)
+    {
+        pixelFormat = LTDC_PIXEL_FORMAT_L8;
+    }
+    // Also rewrites the line length and pitch, the caller writes the address and reloads
+    HAL_LTDC_SetPixelFormat_NoReload(&hltdc, pixelFormat, layerIndex);
+    BackgroundLayer::applyFrameBufferPitch();
+    if (format == Bitmap::ARGB2222)
+    {
+        // The CLUT is written before the reload, in the vertical blanking or before the
+        // reload the caller requests for it
+        palette.setActive(layerIndex);
+        palette.load();
+        HAL_LTDC_EnableCLUT_NoReload(&hltdc, layerIndex);
+    }
+    else
+    {
+        palette.setActive(FrameBufferPalette::NO_LAYER);
+        HAL_LTDC_DisableCLUT_NoReload(&hltdc, layerIndex);
+    }
+    ltdcFormatPending = false;
+}
+
+#if TOUCHGFX_PARTIAL_FRAMEBUFFER
+namespace touchgfx
+{
+void FrameBufferAllocatorWaitOnTransfer()
+{
+    static_cast<TouchGFXHAL*>(HAL::getInstance())->waitForBlockTransfer();
+}
+
+void FrameBufferAllocatorSignalBlockDrawn()
+{
+    static_cast<TouchGFXHAL*>(HAL::getInstance())->transferDrawnBlocks();
+}
+} // namespace touchgfx
+#endif
+
+extern "C"
+{
+    void HAL_LTDC_LineEventCallback(LTDC_HandleTypeDef* hltdc)
+    {
+        if (!HAL::getInstance())
+        {
+            return;
+        }
+
+        if (lcd_int_strip_line != 0 && LTDC->LIPCR == lcd_int_strip_line)
+        {
+            //scanout has advanced past the strip the task waits for
+            lcd_int_strip_line = 0;
+            HAL_LTDC_ProgramLineEvent(hltdc, lcd_int_porch_line);
+            osSemaphoreRelease(scanline_sem);
+        }
+        else if (LTDC->LIPCR == lcd_int_active_line)
+        {
+            //entering active area
+            HAL_LTDC_ProgramLineEvent(hltdc, lcd_int_porch_line);
+            static_cast<TouchGFXHAL*>(HAL::getInstance())->vSyncFromISR();
+            GPIO::set(GPIO::VSYNC_FREQ);
+        }
+        else
+        {
+            //exiting active area
+            HAL_LTDC_ProgramLineEvent(hltdc, lcd_int_active_line);
+
+            // Signal to the framework that display update has finished.
+            HAL::getInstance()->frontPorchEntered();
+            GPIO::clear(GPIO::VSYNC_FREQ);
+        }
+    }
+}
+
 /* USER CODE END TouchGFXHAL.cpp */
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -24,8 +24,163 @@
 
 /* USER CODE BEGIN TouchGFXHAL.hpp */
 
-#include <TouchGFXGeneratedHAL.hpp>
+#include <touchgfx_nema/HALGPU2D.hpp>
+#include <AssetUpdate.hpp>
+#include <AssetUploadQueue.hpp>
+#include <AsyncBlockCopy.hpp>
 #include <CortexMMCUInstrumentation.hpp>
+#include <BlitBenchmark.hpp>
+#include <FrameBenchmark.hpp>
+#include <FrameBufferPalette.hpp>
+#include <FrameMissClassifier.hpp>
+#include <FramePacer.hpp>
+#include <CachedVectorFontRenderer.hpp>
+#include <DynamicResolution.hpp>
+#include <GlyphAtlas.hpp>
+#include <HotPathProfiler.hpp>
+#include <HybridLCDGPU2D.hpp>
+#include <IdleRefreshRate.hpp>
+#include <IdleSuspend.hpp>
+#include <MemoryBudget.hpp>
+#include <OverlayLayer.hpp>
+#include <OverdrawHeatmap.hpp>
+#include <PerfHUD.hpp>
+#include <QualityGovernor.hpp>
+#include <SDCardDataReader.hpp>
+#include <SoakTest.hpp>
+#include <ShapedTextCache.hpp>
+#include <StartupTrace.hpp>
+#include <TextureCache.hpp>
+#include <TextureMipChain.hpp>
+#include <TouchLatency.hpp>
+#include <WidgetProfiler.hpp>
+#include <XspiCalibration.hpp>
+#include <nema_hal_ext.h>
+#include <string.h>
+
+/**
+ * Set to 1 to render into a single framebuffer following the LTDC scanout, using the
+ * REFRESH_STRATEGY_OPTIM_SINGLE_BUFFER_TFT_CTRL strategy, instead of double buffering.
+ */
+#ifndef TOUCHGFX_BEAM_RACING
+#define TOUCHGFX_BEAM_RACING 0
+#endif
+
+/**
+ * Number of lines the scanout advances between two line interrupts while the framework
+ * waits for it in beam racing mode.
+ */
+#ifndef TOUCHGFX_BEAM_RACING_STRIP_LINES
+#define TOUCHGFX_BEAM_RACING_STRIP_LINES 48
+#endif
+
+/**
+ * Set to 1 to render into partial framebuffer blocks in AXI SRAM, which DMA2D copies into
+ * the single framebuffer in PSRAM that LTDC scans out, instead of double buffering.
+ */
+#ifndef TOUCHGFX_PARTIAL_FRAMEBUFFER
+#define TOUCHGFX_PARTIAL_FRAMEBUFFER 0
+#endif
+
+/**
+ * Size in bytes and number of the partial framebuffer blocks.
+ */
+#ifndef TOUCHGFX_PARTIAL_BLOCK_SIZE
+#define TOUCHGFX_PARTIAL_BLOCK_SIZE (800 * 32 * 2)
+#endif
+#ifndef TOUCHGFX_PARTIAL_BLOCKS
+#define TOUCHGFX_PARTIAL_BLOCKS 3
+#endif
+
+#if TOUCHGFX_BEAM_RACING && TOUCHGFX_PARTIAL_FRAMEBUFFER
+#error "TOUCHGFX_BEAM_RACING and TOUCHGFX_PARTIAL_FRAMEBUFFER cannot be combined"
+#endif
+
+/**
+ * Bits per pixel the framebuffers are sized for. 24 or 32 allows switching the framebuffer
+ * format to RGB888 or ARGB8888 at runtime, 16 keeps it RGB565 and 8 makes it ARGB2222.
+ */
+#ifndef TOUCHGFX_FRAMEBUFFER_MAX_BPP
+#define TOUCHGFX_FRAMEBUFFER_MAX_BPP ((TOUCHGFX_BEAM_RACING || TOUCHGFX_PARTIAL_FRAMEBUFFER) ? 16 : 32)
+#endif
+
+/**
+ * Bytes every line of the framebuffers starts at a multiple of, a power of two, 0 to not pad
+ * the lines. 32 is a line of the data cache, larger values the wrap bursts of the PSRAM on
+ * XSPI. The lines are padded to a multiple of as many pixels, so they stay aligned in any
+ * framebuffer format, and HAL::FRAME_BUFFER_WIDTH, the stride of the framebuffers, and the
+ * LTDC line pitch are set to the padded width.
+ */
+#ifndef TOUCHGFX_FRAMEBUFFER_STRIDE_ALIGNMENT
+#define TOUCHGFX_FRAMEBUFFER_STRIDE_ALIGNMENT 0
+#endif
+
+/**
+ * Width in pixels of a line of the framebuffers, the display width padded by
+ * TOUCHGFX_FRAMEBUFFER_STRIDE_ALIGNMENT.
+ */
+#if TOUCHGFX_FRAMEBUFFER_STRIDE_ALIGNMENT > 0
+#define TOUCHGFX_FRAMEBUFFER_WIDTH ((800 + TOUCHGFX_FRAMEBUFFER_STRIDE_ALIGNMENT - 1) / TOUCHGFX_FRAMEBUFFER_STRIDE_ALIGNMENT * TOUCHGFX_FRAMEBUFFER_STRIDE_ALIGNMENT)
+#else
+#define TOUCHGFX_FRAMEBUFFER_WIDTH 800
+#endif
+
+/**
+ * Set to 1 to allow an ARGB2222 framebuffer, scanned out by LTDC as L8 through its CLUT.
+ * Always set when the framebuffers are sized for 8 bits per pixel.
+ */
+#ifndef TOUCHGFX_FRAMEBUFFER_L8
+#define TOUCHGFX_FRAMEBUFFER_L8 (TOUCHGFX_FRAMEBUFFER_MAX_BPP == 8)
+#endif
+
+#if (TOUCHGFX_BEAM_RACING || TOUCHGFX_PARTIAL_FRAMEBUFFER) && (TOUCHGFX_FRAMEBUFFER_MAX_BPP != 16 || TOUCHGFX_FRAMEBUFFER_L8)
+#error "TOUCHGFX_BEAM_RACING and TOUCHGFX_PARTIAL_FRAMEBUFFER only support a RGB565 framebuffer"
+#endif
+
+#if TOUCHGFX_FRAMEBUFFER_MAX_BPP == 8 && !TOUCHGFX_FRAMEBUFFER_L8
+#error "8-bit framebuffers need TOUCHGFX_FRAMEBUFFER_L8"
+#endif
+
+/**
+ * Set to 0 to not allocate the third framebuffer in PSRAM. With the buffer allocated,
+ * TouchGFXHAL::setTripleBuffering() selects it at runtime. Not available with the single
+ * framebuffer of TOUCHGFX_BEAM_RACING and TOUCHGFX_PARTIAL_FRAMEBUFFER.
+ */
+#ifndef TOUCHGFX_TRIPLE_BUFFERING
+#define TOUCHGFX_TRIPLE_BUFFERING (!TOUCHGFX_BEAM_RACING && !TOUCHGFX_PARTIAL_FRAMEBUFFER)
+#endif
+
+/**
+ * Set to 1 to compare the tiles of the framebuffer being rendered with the latest frame by
+ * their CRC before they are brought up to date, see TouchGFXHAL::isTileUnchanged().
+ */
+#ifndef TOUCHGFX_TILE_HASH
+#define TOUCHGFX_TILE_HASH 0
+#endif
+
+/**
+ * Width and height in pixels of the tiles compared by TouchGFXHAL::isTileUnchanged().
+ */
+#ifndef TOUCHGFX_TILE_HASH_SIZE
+#define TOUCHGFX_TILE_HASH_SIZE 32
+#endif
+
+/**
+ * Set to 1 to link the software texture mapper for every bitmap format and filter. By
+ * default only nearest neighbor mapping of ARGB8888 bitmaps, used by the texture mappers
+ * of Screen1, is linked; other texture mappers are then not drawn on the software path.
+ */
+#ifndef TOUCHGFX_ALL_TEXTURE_MAPPERS
+#define TOUCHGFX_ALL_TEXTURE_MAPPERS 0
+#endif
+
+/**
+ * Number of GPU2D resets, after a hang or an error, after which rendering falls back to
+ * software, see TouchGFXHAL::activateNeoChrom(). Set to 0 to keep rendering on GPU2D.
+ */
+#ifndef TOUCHGFX_GPU2D_FAULT_LIMIT
+#define TOUCHGFX_GPU2D_FAULT_LIMIT 3
+#endif
 
 /**
  * @class TouchGFXHAL
@@ -34,11 +189,11 @@
  *
  * @sa HAL
  */
-class TouchGFXHAL : public TouchGFXGeneratedHAL
+class TouchGFXHAL : public touchgfx::HALGPU2D
 {
 public:
     /**
-     * @fn TouchGFXHAL::TouchGFXHAL(touchgfx::DMA_Interface& dma, touchgfx::LCD& display, touchgfx::TouchController& tc, uint16_t width, uint16_t height) : TouchGFXGeneratedHAL(dma, display, tc, width, height)
+     * @fn TouchGFXHAL::TouchGFXHAL(touchgfx::DMA_Interface& dma, touchgfx::LCD& display, touchgfx::TouchController& tc, uint16_t width, uint16_t height) : touchgfx::HALGPU2D(dma, display, tc, width, height)
      *
      * @brief Constructor.
      *
@@ -50,12 +205,91 @@ public:
      * @param width            Width of the display.
      * @param height           Height of the display.
      */
-    TouchGFXHAL(touchgfx::DMA_Interface& dma, touchgfx::LCD& display, touchgfx::TouchController& tc, uint16_t width, uint16_t height) : TouchGFXGeneratedHAL(dma, display, tc, width, height)
+    TouchGFXHAL(touchgfx::DMA_Interface& dma, touchgfx::LCD& display, touchgfx::TouchController& tc, uint16_t width, uint16_t height) : touchgfx::HALGPU2D(dma, display, tc, width, height),
+        perfHUD(overlay),
+        overdraw(overlay),
+        ringStallFrames(0),
+        ringStallsMax(0),
+        gpuRecoveries(0),
+        gpuFrames(0),
+        gpuElapsedSum(0),
+        gpuBusySum(0),
+        gpuBusyMax(0),
+        gpuCommandLists(0),
+        gpuIdleGaps(0),
+        gpuLongestGap(0),
+        neoChromActive(true),
+        frameSkipped(false),
+        drawnInTick(false),
+        completedFrameBuffer(0),
+        completedFrame(0),
+        pendingFormat(touchgfx::Bitmap::RGB565),
+        ltdcFormatPending(false),
+        frameBufferL8(false),
+        calibrationPending(false),
+        blitBenchmarkPending(TOUCHGFX_BLIT_BENCHMARK != 0),
+        frameBufferFlushed(false),
+        vsyncWaitCycles(0),
+        completedFrames(0),
+        latestFrameBuffer(0),
+        shownFrameBuffer(0),
+        reloadPending(false),
+        tripleBuffering(TOUCHGFX_TRIPLE_BUFFERING != 0),
+        frameSwaps(0),
+        thirdBufferFrames(0),
+        thirdBufferWaits(0),
+        tilesCompared(0),
+        tilesUnchanged(0),
+        tileHashes(0),
+        tilesUnchangedFrame(0),
+        tilesUnchangedMax(0),
+        tileFrame(0),
+        startupStage(STARTUP_RENDERING)
     {
+        frameBuffers[0] = frameBuffers[1] = frameBuffers[2] = 0;
+        renderedFrame[0] = renderedFrame[1] = renderedFrame[2] = 0;
+        memset(&gpuFrame, 0, sizeof(gpuFrame));
     }
 
     virtual void initialize();
 
+    /**
+     * @fn void TouchGFXHAL::vSyncFromISR();
+     *
+     * @brief Signals VSYNC to the framework and to the modules pacing on it.
+     *
+     *        Called from the LTDC line interrupt when the scanout enters the active area.
+     *        Swaps the framebuffers right away unless GPU2D is still rendering the frame,
+     *        which the TouchGFX task then waits for.
+     */
+    void vSyncFromISR();
+
+    /**
+     * @fn virtual uint16_t TouchGFXHAL::getTFTCurrentLine();
+     *
+     * @brief Gets the line of the active area currently being scanned out by LTDC.
+     *
+     *        Gets the line of the active area currently being scanned out by LTDC. Returns
+     *        0 during the back porch.
+     *
+     * @return The current line, in the range [0; display height].
+     */
+    virtual uint16_t getTFTCurrentLine();
+
+    /**
+     * @fn virtual void TouchGFXHAL::taskDelay(uint16_t ms);
+     *
+     * @brief Delays the TouchGFX task until the scanout has advanced.
+     *
+     *        In beam racing mode the framework calls this while the area it is about to draw
+     *        is still being scanned out. Instead of sleeping for whole milliseconds, a line
+     *        interrupt is programmed TOUCHGFX_BEAM_RACING_STRIP_LINES below the current line
+     *        and the task waits for it, at most for ms milliseconds.
+     *
+     * @param ms Maximum number of milliseconds to wait.
+     */
+    virtual void taskDelay(uint16_t ms);
+
     /**
      * @fn virtual void TouchGFXHAL::disableInterrupts();
      *
@@ -97,6 +331,44 @@ public:
 
     virtual void endFrame();
 
+    /**
+     * @fn virtual void TouchGFXHAL::backPorchExited();
+     *
+     * @brief Swaps the framebuffers and starts the next tick.
+     *
+     *        Swaps the framebuffers and starts the next tick. Waits for a frame still being
+     *        rendered by GPU2D before it is swapped to the display. The time from the LTDC
+     *        interrupt to the task running again is accounted to the interrupt, see
+     *        CortexMMCUInstrumentation::taskWoken.
+     */
+    virtual void backPorchExited();
+
+    /**
+     * @fn virtual uint16_t* TouchGFXHAL::lockFrameBuffer();
+     *
+     * @brief Draws the glyphs collected from the glyph atlas, then locks the framebuffer.
+     *
+     *        Any GPU2D command list still rendering into the framebuffer is completed first,
+     *        so the CPU always sees a finished frame.
+     *
+     * @return A pointer to the framebuffer drawn.
+     *
+     * @see HybridLCDGPU2D::flushGlyphs
+     */
+    virtual uint16_t* lockFrameBuffer();
+
+    /**
+     * @fn virtual void TouchGFXHAL::unlockFrameBuffer();
+     *
+     * @brief Draws the glyphs collected from the glyph atlas, then unlocks the framebuffer.
+     *
+     *        LCD::drawString() locks the framebuffer around the glyphs of a string, so the
+     *        glyphs of a string are drawn together.
+     *
+     * @see HybridLCDGPU2D::flushGlyphs
+     */
+    virtual void unlockFrameBuffer();
+
     /**
      * @fn virtual void TouchGFXHAL::flushFrameBuffer();
      *
@@ -108,7 +380,7 @@ public:
      */
     virtual void flushFrameBuffer()
     {
-        TouchGFXGeneratedHAL::flushFrameBuffer();
+        HAL::flushFrameBuffer();
     }
 
     /**
@@ -126,12 +398,36 @@ public:
      */
     virtual void flushFrameBuffer(const touchgfx::Rect& rect);
 
+    /**
+     * @fn void TouchGFXHAL::transferDrawnBlocks();
+     *
+     * @brief Starts copying the next drawn partial framebuffer block to the scanout framebuffer.
+     *
+     *        Frees the block being copied if DMA2D has completed it, and queues the copy of
+     *        the next drawn block on DMA2D. Returns without waiting. Only used with
+     *        TOUCHGFX_PARTIAL_FRAMEBUFFER.
+     */
+    void transferDrawnBlocks();
+
+    /**
+     * @fn void TouchGFXHAL::waitForBlockTransfer();
+     *
+     * @brief Waits until the partial framebuffer block being copied is free again.
+     *
+     *        Waits for the copy of the current block to complete, frees the block and starts
+     *        copying the next drawn block, if any. Only used with TOUCHGFX_PARTIAL_FRAMEBUFFER.
+     */
+    void waitForBlockTransfer();
+
     /**
      * @fn virtual bool TouchGFXHAL::blockCopy(void* RESTRICT dest, const void* RESTRICT src, uint32_t numBytes);
      *
      * @brief This function performs a platform-specific memcpy.
      *
-     *        This function performs a platform-specific memcpy, if supported by the hardware.
+     *        Copies of at least TOUCHGFX_BLOCK_COPY_DMA2D_MIN_BYTES are moved by DMA2D,
+     *        which does not evict the data cache, and waited for, as the copy must be done
+     *        on return. Smaller copies are done by the CPU. Use blockCopyAsync() to go on
+     *        while DMA2D copies.
      *
      * @param [out] dest Pointer to destination memory.
      * @param [in] src   Pointer to source memory.
@@ -141,32 +437,1434 @@ public:
      */
     virtual bool blockCopy(void* RESTRICT dest, const void* RESTRICT src, uint32_t numBytes);
 
+    /**
+     * @fn bool TouchGFXHAL::blockCopyAsync(void* dest, const void* src, uint32_t numBytes, touchgfx::GenericCallback<void*>* done = 0);
+     *
+     * @brief Copies a block of memory, with DMA2D in the background if it is large.
+     *
+     *        The destination must not be read or written, nor the source written, before
+     *        done is called, at the end of the frame at the latest.
+     *
+     * @param [out] dest Pointer to destination memory.
+     * @param [in] src   Pointer to source memory.
+     * @param numBytes   Number of bytes to copy.
+     * @param done       (Optional) Called with dest when the copy is done.
+     *
+     * @return true if the copy is in progress, false if it is done already.
+     *
+     * @see touchgfx::AsyncBlockCopy
+     */
+    bool blockCopyAsync(void* dest, const void* src, uint32_t numBytes, touchgfx::GenericCallback<void*>* done = 0)
+    {
+        return blockCopier.copy(dest, src, numBytes, done);
+    }
+
+    /**
+     * @fn touchgfx::AsyncBlockCopy& TouchGFXHAL::getBlockCopier();
+     *
+     * @brief Gets the copier of blockCopy(), which also copies lines between buffers of
+     *        different strides.
+     *
+     * @return The block copier.
+     */
+    touchgfx::AsyncBlockCopy& getBlockCopier()
+    {
+        return blockCopier;
+    }
+
+    /**
+     * @fn touchgfx::AssetUploadQueue& TouchGFXHAL::getAssetUploads();
+     *
+     * @brief Gets the queue of uploads from flash on HPDMA, for assets copied into PSRAM
+     *        or AXI SRAM in the background.
+     *
+     * @return The upload queue.
+     */
+    touchgfx::AssetUploadQueue& getAssetUploads()
+    {
+        return assetUploads;
+    }
+
+    /**
+     * @fn void TouchGFXHAL::activateNeoChrom(bool active);
+     *
+     * @brief Selects NeoChrom (GPU2D) or software (LCD16bpp) rendering.
+     *
+     *        Selects NeoChrom (GPU2D) or software (LCD16bpp) rendering. While a benchmark is
+     *        running the selection is stored and applied when the benchmark completes.
+     *
+     * @param active true to render using NeoChrom, false to render in software.
+     */
     void activateNeoChrom(bool active);
 
-protected:
     /**
-     * @fn virtual uint16_t* TouchGFXHAL::getTFTFrameBuffer() const;
+     * @fn void TouchGFXHAL::startBenchmark(uint16_t frames);
      *
-     * @brief Gets the frame buffer address used by the TFT controller.
+     * @brief Starts an A/B benchmark of the NeoChrom and the software backend.
      *
-     *        Gets the frame buffer address used by the TFT controller.
+     *        Starts an A/B benchmark of the NeoChrom and the software backend. The
+     *        current screen is rendered for the given number of frames on each backend
+     *        and the results are reported over SWO.
      *
-     * @return The address of the frame buffer currently being displayed on the TFT.
+     * @param frames Number of frames to record per backend.
+     *
+     * @see FrameBenchmark
      */
-    virtual uint16_t* getTFTFrameBuffer() const;
+    void startBenchmark(uint16_t frames)
+    {
+        // The GPU2D backend is measured with the costs of this board
+        calibrationPending = true;
+        benchmark.start(frames);
+    }
 
     /**
-     * @fn virtual void TouchGFXHAL::setTFTFrameBuffer(uint16_t* adr);
+     * @fn void TouchGFXHAL::calibrateBlitDispatch();
      *
-     * @brief Sets the frame buffer address used by the TFT controller.
+     * @brief Measures the cost of fills and copies on the CPU, DMA2D and GPU2D.
      *
-     *        Sets the frame buffer address used by the TFT controller.
+     *        The operations are measured at the start of the next frame, which then
+     *        redraws the whole screen, and the costs are reported over SWO. Fills and copies
+     *        are executed on the engine with the lowest measured cost from then on. Also
+     *        done when a benchmark is started.
      *
-     * @param [in,out] adr New frame buffer address.
+     * @see HybridLCDGPU2D::calibrateCosts(), HybridLCDGPU2D::setCost()
      */
-    virtual void setTFTFrameBuffer(uint16_t* adr);
-private:
-    touchgfx::CortexMMCUInstrumentation instrumentation;
+    void calibrateBlitDispatch()
+    {
+        calibrationPending = true;
+    }
+
+    /**
+     * @fn void TouchGFXHAL::reportBlitCosts();
+     *
+     * @brief Reports the cost of fills and copies on each engine over SWO, as setup cycles
+     *        and cycles per 64 pixels.
+     */
+    void reportBlitCosts();
+
+    /**
+     * @fn void TouchGFXHAL::runBlitBenchmark();
+     *
+     * @brief Times the blit operations of the CPU, DMA2D and GPU2D over a range of sizes.
+     *
+     *        The operations are timed at the start of the next frame rendered on GPU2D,
+     *        which then redraws the whole screen, and the times are reported over SWO.
+     *        Done at startup with TOUCHGFX_BLIT_BENCHMARK 1.
+     *
+     * @see BlitBenchmark
+     */
+    void runBlitBenchmark()
+    {
+        blitBenchmarkPending = true;
+    }
+
+    /**
+     * @fn void TouchGFXHAL::setBenchmarkSceneCallback(touchgfx::GenericCallback<>* callback);
+     *
+     * @brief Sets the callback used to rewind the benchmarked scene.
+     *
+     * @param callback The callback, or 0 to remove it.
+     *
+     * @see FrameBenchmark::setSceneCallback
+     */
+    void setBenchmarkSceneCallback(touchgfx::GenericCallback<>* callback)
+    {
+        benchmark.setSceneCallback(callback);
+    }
+
+    /**
+     * @fn void TouchGFXHAL::startSoakTest();
+     *
+     * @brief Starts the soak test, which samples render time, memory fragmentation and
+     *        cache hit rates for hours and reports the ones that drift over SWO.
+     *
+     *        The HAL registers the render time, the free FreeRTOS heap, the largest free
+     *        block of the NemaGFX pool and the hit rates of the glyph atlas and the texture
+     *        cache, the application may register more channels before. Done after the
+     *        first frame with TOUCHGFX_SOAK_TEST 1.
+     *
+     * @see touchgfx::SoakTest
+     */
+    void startSoakTest()
+    {
+        touchgfx::SoakTest::start();
+    }
+
+    /**
+     * @fn void TouchGFXHAL::setSoakSceneCallback(touchgfx::GenericCallback<>* callback);
+     *
+     * @brief Sets the callback that moves the application on to the next scene of the
+     *        soak test.
+     *
+     * @param callback The callback, or 0 to remove it.
+     *
+     * @see touchgfx::SoakTest::setSceneCallback
+     */
+    void setSoakSceneCallback(touchgfx::GenericCallback<>* callback)
+    {
+        touchgfx::SoakTest::setSceneCallback(callback);
+    }
+
+    /**
+     * @fn void TouchGFXHAL::reportSoakTest();
+     *
+     * @brief Reports the trend of every channel of the soak test over SWO.
+     *
+     * @see touchgfx::SoakTest::report
+     */
+    void reportSoakTest()
+    {
+        touchgfx::SoakTest::report();
+    }
+
+    /**
+     * @fn void TouchGFXHAL::reportGPU2DMemory();
+     *
+     * @brief Reports the usage of the NemaGFX memory pools and ring buffer over SWO.
+     *
+     *        Reports size, current usage, high-water mark and allocation failures of
+     *        every NemaGFX memory pool, with its longest allocation and, with the
+     *        NEMA_HAL_TLSF allocator, its free blocks and the largest of them, and the
+     *        ring buffer stalls per frame, over SWO.
+     *        Use it to size NEMAGFX_MEM_POOL_SIZE, NEMAGFX_STENCIL_POOL_SIZE,
+     *        NEMAGFX_FALLBACK_POOL_SIZE and NEMA_HAL_RING_SIZE.
+     */
+    void reportGPU2DMemory();
+
+    /**
+     * @fn void TouchGFXHAL::reportMemoryBudget();
+     *
+     * @brief Reports the size, use and headroom of the graphics memories over SWO.
+     *
+     *        Reports, for RAM, RAM_CMD, EXTRAM and FLASH_GFX, the size and the bytes
+     *        placed by the linker, then the size, use, peak use and spare bytes of the
+     *        framebuffers, NemaGFX pools, bitmap cache, font cache and canvas buffer in
+     *        them, see MemoryBudget. The peaks are sampled every
+     *        TOUCHGFX_MEMORY_BUDGET_SAMPLE_FRAMES frames.
+     */
+    void reportMemoryBudget()
+    {
+        touchgfx::MemoryBudget::report();
+    }
+
+    /**
+     * @fn const nema_hal_gpu_stats_t& TouchGFXHAL::getGPU2DFrameTiming() const;
+     *
+     * @brief Gets the GPU2D timing of the last frame period.
+     *
+     *        Gets how long GPU2D executed command lists, how many were submitted and how
+     *        often GPU2D ran out of work, from the start of one frame to the start of the
+     *        next. A busy time well below the frame time with the MCU load high means the
+     *        CPU does not feed GPU2D fast enough, a busy time close to the frame time that
+     *        GPU2D is the limit.
+     *
+     * @return The timing of the last frame period.
+     */
+    const nema_hal_gpu_stats_t& getGPU2DFrameTiming() const
+    {
+        return gpuFrame;
+    }
+
+    /**
+     * @fn uint8_t TouchGFXHAL::getGPU2DLoadPct() const;
+     *
+     * @brief Gets the share of the last frame period GPU2D was busy.
+     *
+     * @return The GPU2D load in percent.
+     */
+    uint8_t getGPU2DLoadPct() const;
+
+    /**
+     * @fn void TouchGFXHAL::reportGPU2DTiming();
+     *
+     * @brief Reports the GPU2D busy time, idle gaps and command lists per frame over SWO.
+     *
+     *        Reports the average and worst busy time of GPU2D per frame, its load next to
+     *        the MCU load, the command lists and idle gaps per frame and the longest gap,
+     *        since the last report.
+     */
+    void reportGPU2DTiming();
+
+    /**
+     * @fn void TouchGFXHAL::enqueueBlit(const touchgfx::BlitOp& op);
+     *
+     * @brief Queues a ChromART operation from a task other than the TouchGFX task.
+     *
+     * @param op The operation to add.
+     *
+     * @see STM32ChromARTDMA::addToQueue
+     */
+    void enqueueBlit(const touchgfx::BlitOp& op);
+
+    /**
+     * @fn void TouchGFXHAL::reportBlitDispatch();
+     *
+     * @brief Reports how fills and copies were divided between the CPU, DMA2D and GPU2D
+     *        over SWO.
+     *
+     *        Reports the number of operations and pixels executed by each engine, the share
+     *        of the pixels written by DMA2D and how often one engine had to wait for the
+     *        other, and the palettes DMA2D loaded into its CLUT or found there, since the
+     *        last report.
+     *
+     * @see HybridLCDGPU2D
+     */
+    void reportBlitDispatch();
+
+    /**
+     * @fn void TouchGFXHAL::reportMemoryTraffic();
+     *
+     * @brief Reports the estimated memory traffic per frame over SWO.
+     *
+     *        Reports the average render time and, for PSRAM on XSPI1, flash on XSPI2, AXI
+     *        SRAM and other memory, the average bytes read and written per frame since the
+     *        last report. The bytes are estimated from the draw operations and ChromART
+     *        operations issued, LTDC scanout is not included.
+     *
+     * @see CortexMMCUInstrumentation::countRead
+     */
+    void reportMemoryTraffic();
+
+    /**
+     * @fn void TouchGFXHAL::reportInterruptTiming();
+     *
+     * @brief Reports the timing of the LTDC, GPU2D, DMA2D and JPEG interrupts over SWO,
+     *        then resets it.
+     *
+     *        Reports, for every interrupt handled since the last report, its NVIC priority,
+     *        the number handled and the maximum and histogram of the handler durations, of
+     *        the LTDC latencies and of the time to wake the task waiting for LTDC or GPU2D,
+     *        and the LTDC swaps entered after the active area started. Histogram bucket n
+     *        counts the times under 2^n microseconds, see TOUCHGFX_INTERRUPT_TIMING_BUCKETS.
+     *
+     * @see CortexMMCUInstrumentation::getInterruptTiming
+     */
+    void reportInterruptTiming();
+
+    /**
+     * @fn void TouchGFXHAL::reportTextureCache();
+     *
+     * @brief Reports the bitmaps tracked by the texture cache over SWO.
+     *
+     *        Reports, for every bitmap drawn from flash, whether it is in the cache and the
+     *        pixels drawn from the cache and from flash since the last report, then the
+     *        pixels converted by PixelConversion for the loaders and the cache.
+     *
+     * @see TextureCache
+     */
+    void reportTextureCache();
+
+    /**
+     * @fn void TouchGFXHAL::reportGlyphAtlas();
+     *
+     * @brief Reports the glyphs drawn from the glyph atlas over SWO.
+     *
+     *        Reports the glyphs found in the atlas, copied into it and drawn from flash
+     *        because it was full, the pages cleared, and the batches the glyphs were drawn
+     *        in, since the last report.
+     *
+     * @see GlyphAtlas
+     */
+    void reportGlyphAtlas();
+
+    /**
+     * @fn void TouchGFXHAL::reportVectorFonts();
+     *
+     * @brief Reports the vector font glyphs drawn over SWO.
+     *
+     *        Reports the glyphs drawn from a kept outline, the glyphs converted, those that
+     *        did not fit in the outline cache or the conversion buffers, and the times the
+     *        cache was cleared, since the last report.
+     *
+     * @see CachedVectorFontRenderer
+     */
+    void reportVectorFonts();
+
+    /**
+     * @fn void TouchGFXHAL::reportShapedText();
+     *
+     * @brief Reports the static texts drawn from kept glyphs over SWO.
+     *
+     *        Reports the texts drawn from kept glyphs, the texts laid out and kept, those
+     *        that did not fit or cannot be kept, and the times the cache was cleared, since
+     *        the last report.
+     *
+     * @see ShapedTextCache
+     */
+    void reportShapedText();
+
+    /**
+     * @fn uint32_t TouchGFXHAL::getTickDeltaUs() const;
+     *
+     * @brief Gets the time that tick handlers should advance their animations by.
+     *
+     *        Gets the time between the VSYNCs that released the previous and the current
+     *        tick, measured by FramePacer. While a benchmark is running, or with FRAME_PACING
+     *        set to 0, one refresh period is returned, so every tick renders a fixed step.
+     *
+     * @return The elapsed time in microseconds.
+     */
+    uint32_t getTickDeltaUs() const
+    {
+        return (FRAME_PACING && !benchmark.isRunning()) ? pacer.getTickDeltaUs() : pacer.getRefreshPeriodUs();
+    }
+
+    /**
+     * @fn uint32_t TouchGFXHAL::getRefreshPeriodUs() const;
+     *
+     * @brief Gets the measured time between two display refreshes.
+     *
+     * @return The refresh period in microseconds.
+     */
+    uint32_t getRefreshPeriodUs() const
+    {
+        return pacer.getRefreshPeriodUs();
+    }
+
+    /**
+     * @fn bool TouchGFXHAL::isFrameSkipped() const;
+     *
+     * @brief Tells if the current tick started too late to be rendered before the next VSYNC.
+     *
+     *        The application leaves the dirty areas of a skipped frame to the next tick.
+     *
+     * @return true if the frame of the current tick should not be rendered.
+     *
+     * @see FramePacer::startTick
+     */
+    bool isFrameSkipped() const
+    {
+        return frameSkipped;
+    }
+
+    /**
+     * @fn void TouchGFXHAL::reportFramePacing();
+     *
+     * @brief Reports the number of late ticks and skipped frames over SWO.
+     *
+     *        Reports the measured refresh period, and the number of ticks, late ticks and
+     *        skipped frames since the last report.
+     *
+     * @see FramePacer
+     */
+    void reportFramePacing();
+
+    /**
+     * @fn void TouchGFXHAL::reportFrameMisses();
+     *
+     * @brief Reports why frames missed their VSYNC over SWO.
+     *
+     *        Reports the frames drawn and missed, the missed frames by cause since the
+     *        last report and over the latest FRAME_MISS_HISTORY misses, and the most
+     *        frequent recent cause, the subsystem to look at first.
+     *
+     * @see FrameMissClassifier
+     */
+    void reportFrameMisses();
+
+    /**
+     * @fn void TouchGFXHAL::reportOverdraw();
+     *
+     * @brief Reports the overdraw counted since the last report over SWO.
+     *
+     *        Reports the frames counted, the pixels written by GPU2D, DMA2D and the CPU,
+     *        the pixels flushed, how many times the flushed area was written on average,
+     *        and the tile written the most times in a frame.
+     *
+     * @see OverdrawHeatmap
+     */
+    void reportOverdraw();
+
+    /**
+     * @fn void TouchGFXHAL::reportVideoStreams();
+     *
+     * @brief Reports the frames of every playing video stream over SWO.
+     *
+     *        Reports the frames decoded, shown, dropped to catch up, skipped for the target
+     *        frame rate and shown late, and the codec time, of every stream since the last
+     *        report. Reports nothing unless the video frames are decoded ahead.
+     *
+     * @see VideoStreamScheduler
+     */
+    void reportVideoStreams();
+
+    /**
+     * @fn void TouchGFXHAL::reportVideoClock();
+     *
+     * @brief Reports the drift of the videos from their media clocks over SWO.
+     *
+     *        Reports the frames shown, skipped without decoding and shown late, and the last
+     *        and largest drift of a frame from when it was due, since the last report. Only
+     *        videos decoded into the framebuffer are paced by a media clock.
+     *
+     * @see VideoClock
+     */
+    void reportVideoClock();
+
+    /**
+     * @fn void TouchGFXHAL::reportHotPath();
+     *
+     * @brief Reports the code profile sampled since the last report over SWO.
+     *
+     *        Reports nothing unless built with TOUCHGFX_HOTPATH_PROFILE. The report is the
+     *        input of gcc/hotpath.py, together with the linker map file of the same build.
+     *
+     * @see HotPathProfiler
+     */
+    void reportHotPath()
+    {
+        hotPath.report();
+    }
+
+    /**
+     * @fn void TouchGFXHAL::setIdleSuspend(bool enabled);
+     *
+     * @brief Enables or disables suspending the tick loop while the screen is static.
+     *
+     * @param enabled true to stop ticking after TOUCHGFX_IDLE_SUSPEND_TICKS ticks that draw
+     *                nothing, until wakeUp() is called.
+     *
+     * @see IdleSuspend
+     */
+    void setIdleSuspend(bool enabled)
+    {
+        idle.setEnabled(enabled);
+    }
+
+    /**
+     * @fn void TouchGFXHAL::wakeUp();
+     *
+     * @brief Resumes the tick loop if it is suspended.
+     *
+     *        The touch controller interrupt wakes the tick loop by itself. The model and
+     *        other tasks must call this before anything they change can be shown, as
+     *        Model::tick() does not run while the tick loop is suspended. Can be called from
+     *        tasks and interrupts.
+     */
+    void wakeUp()
+    {
+        idle.wakeUp();
+        idleRefresh.wakeUp();
+    }
+
+    /**
+     * @fn void TouchGFXHAL::setIdleRefreshRate(bool enabled, uint8_t divider);
+     *
+     * @brief Enables or disables lowering the refresh rate of the display while the screen
+     *        is static.
+     *
+     * @param enabled true to divide the refresh rate by divider after
+     *                TOUCHGFX_IDLE_REFRESH_TICKS ticks that draw nothing, until a tick draws
+     *                or wakeUp() is called.
+     * @param divider From 2 to 8.
+     *
+     * @see IdleRefreshRate
+     */
+    void setIdleRefreshRate(bool enabled, uint8_t divider = TOUCHGFX_IDLE_REFRESH_DIVIDER)
+    {
+        idleRefresh.setDivider(divider);
+        idleRefresh.setEnabled(enabled);
+        if (!enabled)
+        {
+            // The nominal rate is restored by the next tick
+            idle.wakeUp();
+        }
+    }
+
+    /**
+     * @fn const touchgfx::IdleRefreshRate& TouchGFXHAL::getIdleRefreshRate() const;
+     *
+     * @brief Gets the refresh rate switching of the display while idle.
+     *
+     * @return The idle refresh rate.
+     */
+    const touchgfx::IdleRefreshRate& getIdleRefreshRate() const
+    {
+        return idleRefresh;
+    }
+
+    /**
+     * @fn void TouchGFXHAL::reportIdleSuspend();
+     *
+     * @brief Reports the suspensions of the tick loop and the wake-up latencies over SWO.
+     *
+     *        Reports the number of suspensions, the time suspended, and the time from a
+     *        wake-up to the first tick and to the end of the first frame, since the last
+     *        report.
+     *
+     * @see IdleSuspend
+     */
+    void reportIdleSuspend();
+
+    /**
+     * @fn void TouchGFXHAL::reportIdleRefreshRate();
+     *
+     * @brief Reports the times the refresh rate was lowered while idle and the time spent
+     *        at the lower rate over SWO, then resets them.
+     *
+     * @see touchgfx::IdleRefreshRate
+     */
+    void reportIdleRefreshRate();
+
+    /**
+     * @fn void TouchGFXHAL::reportTouchLatency();
+     *
+     * @brief Reports the latency from the touch interrupt to the scanout over SWO.
+     *
+     *        Reports the distribution of the latencies of all gestures and the average time
+     *        of every stage of the touch pipeline, since the last report. Each gesture is
+     *        also reported when it ends, unless TOUCH_LATENCY_GESTURE_REPORTS is 0.
+     *
+     * @see TouchLatency
+     */
+    void reportTouchLatency()
+    {
+        touchLatency.report();
+        touchLatency.resetStats();
+    }
+
+    /**
+     * @fn void TouchGFXHAL::reportRtosMemory();
+     *
+     * @brief Reports the use of the RTOS object pool and of the FreeRTOS heap over SWO.
+     *
+     *        The semaphores, mutexes and queues of the HAL, GPU2D and the video decoders
+     *        take their control blocks from the static pool of rtos_pool.c and the tasks
+     *        have static stacks, so the heap only serves the application. A fallback is
+     *        an object allocated from the heap because the pool was exhausted.
+     */
+    void reportRtosMemory();
+
+    /**
+     * @fn touchgfx::OverlayLayer& TouchGFXHAL::getOverlayLayer();
+     *
+     * @brief Gets the overlay shown on LTDC layer 2 over the framebuffer.
+     *
+     * @return The overlay layer.
+     */
+    touchgfx::OverlayLayer& getOverlayLayer()
+    {
+        return overlay;
+    }
+
+    /**
+     * @fn touchgfx::PerfHUD& TouchGFXHAL::getPerfHUD();
+     *
+     * @brief Gets the performance HUD, shown on the overlay layer when enabled.
+     *
+     * @return The performance HUD.
+     */
+    touchgfx::PerfHUD& getPerfHUD()
+    {
+        return perfHUD;
+    }
+
+    /**
+     * @fn touchgfx::OverdrawHeatmap& TouchGFXHAL::getOverdrawHeatmap();
+     *
+     * @brief Gets the overdraw heatmap, shown on the overlay layer instead of the
+     *        performance HUD or streamed over SWO when enabled.
+     *
+     * @return The overdraw heatmap.
+     */
+    touchgfx::OverdrawHeatmap& getOverdrawHeatmap()
+    {
+        return overdraw;
+    }
+
+    /**
+     * @fn touchgfx::FrameBufferPalette& TouchGFXHAL::getPalette();
+     *
+     * @brief Gets the colors LTDC shows for an ARGB2222 framebuffer.
+     *
+     * @return The palette.
+     */
+    touchgfx::FrameBufferPalette& getPalette()
+    {
+        return palette;
+    }
+
+    /**
+     * @fn touchgfx::DynamicResolution& TouchGFXHAL::getDynamicResolution();
+     *
+     * @brief Gets the scale heavy widgets are rendered at, chosen from the frame times.
+     *
+     * @return The dynamic resolution.
+     */
+    touchgfx::DynamicResolution& getDynamicResolution()
+    {
+        return dynamicResolution;
+    }
+
+    /**
+     * @fn touchgfx::QualityGovernor& TouchGFXHAL::getQualityGovernor();
+     *
+     * @brief Gets the rendering quality of the frames, chosen from the frame times.
+     *
+     * @return The quality governor.
+     */
+    touchgfx::QualityGovernor& getQualityGovernor()
+    {
+        return qualityGovernor;
+    }
+
+    /**
+     * @fn touchgfx::BackgroundLayer& TouchGFXHAL::getBackgroundLayer();
+     *
+     * @brief Gets the background scanned out on LTDC layer 1 below the framebuffer.
+     *
+     * @return The background layer.
+     */
+    touchgfx::BackgroundLayer& getBackgroundLayer()
+    {
+        return background;
+    }
+
+    /**
+     * @fn touchgfx::TextureCache& TouchGFXHAL::getTextureCache();
+     *
+     * @brief Gets the cache that rotated textures are sampled from in AXI SRAM.
+     *
+     * @return The texture cache.
+     */
+    touchgfx::TextureCache& getTextureCache()
+    {
+        return textureCache;
+    }
+
+    /**
+     * @fn touchgfx::GlyphAtlas& TouchGFXHAL::getGlyphAtlas();
+     *
+     * @brief Gets the texture pages in PSRAM that glyphs are drawn from.
+     *
+     * @return The glyph atlas.
+     */
+    touchgfx::GlyphAtlas& getGlyphAtlas()
+    {
+        return glyphAtlas;
+    }
+
+    /**
+     * @fn touchgfx::CachedVectorFontRenderer& TouchGFXHAL::getVectorFontRenderer();
+     *
+     * @brief Gets the renderer that vector font glyphs are drawn with.
+     *
+     * @return The vector font renderer.
+     */
+    touchgfx::CachedVectorFontRenderer& getVectorFontRenderer()
+    {
+        return vectorFontRenderer;
+    }
+
+    /**
+     * @fn touchgfx::ShapedTextCache& TouchGFXHAL::getShapedTextCache();
+     *
+     * @brief Gets the glyphs kept for static texts.
+     *
+     * @return The shaped text cache.
+     */
+    touchgfx::ShapedTextCache& getShapedTextCache()
+    {
+        return shapedTextCache;
+    }
+
+    /**
+     * @fn void TouchGFXHAL::cleanDCache(const void* data, uint32_t size);
+     *
+     * @brief Writes data written by the CPU back to memory, so GPU2D and DMA2D read it.
+     *
+     * @param data The first byte written.
+     * @param size Number of bytes written.
+     */
+    void cleanDCache(const void* data, uint32_t size);
+
+    /**
+     * @fn touchgfx::TextureMipChain& TouchGFXHAL::getMipChain();
+     *
+     * @brief Gets the lower resolution levels sampled for textures drawn scaled down.
+     *
+     * @return The mip chain.
+     */
+    touchgfx::TextureMipChain& getMipChain()
+    {
+        return mipChain;
+    }
+
+    /**
+     * @fn bool TouchGFXHAL::setFrameBufferFormat(touchgfx::Bitmap::BitmapFormat format);
+     *
+     * @brief Changes the framebuffer format from the next frame.
+     *
+     *        Screens that animate a lot can render in RGB565 to halve the PSRAM traffic, and
+     *        static screens in RGB888 or ARGB8888 for less banding. Call it from setupScreen().
+     *        The next frame is rendered in the new format by GPU2D and the matching LCD16bpp,
+     *        LCD24bpp or LCD32bpp software renderer, and is redrawn entirely. LTDC switches to
+     *        the new pixel format when it shows that frame. Videos decoded directly into the
+     *        framebuffer need RGB565.
+     *
+     *        With TOUCHGFX_FRAMEBUFFER_L8, simple screens can render in ARGB2222, a byte per
+     *        pixel that LTDC scans out as L8 through the colors of getPalette(). This halves
+     *        the scanout and rendering traffic of RGB565, and with TOUCHGFX_FRAMEBUFFER_MAX_BPP
+     *        8 the framebuffers take half the PSRAM. Neither GPU2D nor DMA2D write 8-bit
+     *        formats, so these frames are drawn by LCD8bpp_ARGB2222 on the CPU.
+     *
+     * @param format RGB565, RGB888, ARGB8888 or ARGB2222, at most TOUCHGFX_FRAMEBUFFER_MAX_BPP
+     *               bits per pixel.
+     *
+     * @return false if the framebuffers cannot hold the format.
+     */
+    bool setFrameBufferFormat(touchgfx::Bitmap::BitmapFormat format);
+
+    /**
+     * @fn bool TouchGFXHAL::canDrawInDynamicBitmap(touchgfx::Bitmap::BitmapFormat format) const;
+     *
+     * @brief Tells if drawDrawableInDynamicBitmap() can render into a bitmap format.
+     *
+     *        The framebuffer format always can. While GPU2D renders, so can RGB565, RGB888
+     *        and ARGB8888, as the format of HybridLCDGPU2D is switched to that of the bitmap
+     *        while rendering into it. The software renderers only draw in the framebuffer
+     *        format.
+     *
+     * @param format The format of the dynamic bitmap.
+     *
+     * @return true if drawables can be rendered into a bitmap of the format.
+     */
+    bool canDrawInDynamicBitmap(touchgfx::Bitmap::BitmapFormat format) const;
+
+    /**
+     * @fn bool TouchGFXHAL::drawTextureQuads(const touchgfx::Bitmap& bitmap, const float* corners, uint16_t count, int16_t x, int16_t y, const touchgfx::Rect& clip, uint8_t alpha, bool bilinear);
+     *
+     * @brief Draws a bitmap mapped onto many quadrilaterals in one GPU2D batch.
+     *
+     * @param bitmap   The bitmap.
+     * @param corners  Eight floats per quad, relative to x, y.
+     * @param count    The number of quads.
+     * @param x        The absolute x coordinate the corners are relative to.
+     * @param y        The absolute y coordinate the corners are relative to.
+     * @param clip     The absolute area to draw in.
+     * @param alpha    The alpha of the quads.
+     * @param bilinear True for bilinear filtering.
+     *
+     * @return false if nothing was drawn, while rendering in software or when the bitmap
+     *         cannot be drawn this way.
+     *
+     * @see HybridLCDGPU2D::drawTextureQuads
+     */
+    bool drawTextureQuads(const touchgfx::Bitmap& bitmap, const float* corners, uint16_t count, int16_t x, int16_t y, const touchgfx::Rect& clip, uint8_t alpha, bool bilinear);
+
+    /**
+     * @fn bool TouchGFXHAL::drawScaledBitmap(const touchgfx::Bitmap& bitmap, const touchgfx::Rect& dest, const touchgfx::Rect& clip, uint8_t alpha, bool bilinear);
+     *
+     * @brief Draws a bitmap scaled to a rectangle with one GPU2D blit.
+     *
+     * @param bitmap   The bitmap.
+     * @param dest     The absolute rectangle the bitmap is fitted to.
+     * @param clip     The absolute area to draw in.
+     * @param alpha    The alpha of the bitmap.
+     * @param bilinear True for bilinear filtering, false for the nearest texel.
+     *
+     * @return false if nothing was drawn, while rendering in software or when the bitmap
+     *         cannot be drawn this way.
+     *
+     * @see HybridLCDGPU2D::drawScaledBitmap
+     */
+    bool drawScaledBitmap(const touchgfx::Bitmap& bitmap, const touchgfx::Rect& dest, const touchgfx::Rect& clip, uint8_t alpha, bool bilinear);
+
+    /**
+     * @fn bool TouchGFXHAL::drawTiledBitmap(const touchgfx::Bitmap& bitmap, int16_t x, int16_t y, int16_t xOffset, int16_t yOffset, const touchgfx::Rect& clip, uint8_t alpha);
+     *
+     * @brief Draws a bitmap repeated over an area from one bound GPU2D texture.
+     *
+     * @param bitmap  The bitmap.
+     * @param x       The absolute x coordinate of the tiled area.
+     * @param y       The absolute y coordinate of the tiled area.
+     * @param xOffset The pixel of the bitmap at x.
+     * @param yOffset The pixel of the bitmap at y.
+     * @param clip    The absolute area to draw.
+     * @param alpha   The alpha of the bitmap.
+     *
+     * @return false if nothing was drawn, while rendering in software or when the bitmap
+     *         cannot be drawn this way.
+     *
+     * @see HybridLCDGPU2D::drawTiledBitmap
+     */
+    bool drawTiledBitmap(const touchgfx::Bitmap& bitmap, int16_t x, int16_t y, int16_t xOffset, int16_t yOffset, const touchgfx::Rect& clip, uint8_t alpha);
+
+    /**
+     * @fn bool TouchGFXHAL::renderStringMask(const touchgfx::Rect& widgetArea, const touchgfx::LCD::StringVisuals& visuals, const touchgfx::Unicode::UnicodeChar* text, uint8_t* mask);
+     *
+     * @brief Renders the coverage of a string into an A8 mask, to be drawn with
+     *        drawA8Mask().
+     *
+     * @param       widgetArea The absolute area of the widget.
+     * @param       visuals    The string visuals.
+     * @param       text       The text.
+     * @param [out] mask       One byte per pixel of the widget.
+     *
+     * @return false if nothing was rendered, while rendering in software or when the
+     *         string cannot be rendered this way.
+     *
+     * @see HybridLCDGPU2D::renderStringMask
+     */
+    bool renderStringMask(const touchgfx::Rect& widgetArea, const touchgfx::LCD::StringVisuals& visuals, const touchgfx::Unicode::UnicodeChar* text, uint8_t* mask);
+
+    /**
+     * @fn uint32_t TouchGFXHAL::kickGPU2D();
+     *
+     * @brief Has GPU2D start on the commands recorded so far while the CPU goes on.
+     *
+     * @return The kick to wait for, 0 if there is nothing to wait for.
+     *
+     * @see HybridLCDGPU2D::kickGPU2D
+     */
+    uint32_t kickGPU2D();
+
+    /**
+     * @fn void TouchGFXHAL::waitForKick(uint32_t kick);
+     *
+     * @brief Blocks until GPU2D has executed the commands of a kick.
+     *
+     * @param kick The kick returned by kickGPU2D().
+     *
+     * @see HybridLCDGPU2D::waitForKick
+     */
+    void waitForKick(uint32_t kick);
+
+    /**
+     * @fn bool TouchGFXHAL::drawA8Mask(const uint8_t* mask, uint16_t width, uint16_t height, int16_t x, int16_t y, const touchgfx::Rect& clip, touchgfx::colortype color, uint8_t alpha);
+     *
+     * @brief Draws a solid color through an A8 coverage mask with one GPU2D blit.
+     *
+     * @param mask   The coverage, one byte per pixel.
+     * @param width  The width of the mask.
+     * @param height The height of the mask.
+     * @param x      The absolute x coordinate of the mask.
+     * @param y      The absolute y coordinate of the mask.
+     * @param clip   The absolute area to draw.
+     * @param color  The color.
+     * @param alpha  The alpha.
+     *
+     * @return false if nothing was drawn, while rendering in software or when the display
+     *         orientation is not supported.
+     *
+     * @see HybridLCDGPU2D::drawA8Mask
+     */
+    bool drawA8Mask(const uint8_t* mask, uint16_t width, uint16_t height, int16_t x, int16_t y, const touchgfx::Rect& clip, touchgfx::colortype color, uint8_t alpha);
+
+    /**
+     * @fn bool TouchGFXHAL::drawMaskedBitmap(const uint8_t* mask, uint16_t width, uint16_t height, int16_t x, int16_t y, const touchgfx::Bitmap& bitmap, int16_t u, int16_t v, const touchgfx::Rect& clip, uint8_t alpha);
+     *
+     * @brief Draws a bitmap through an A8 coverage mask with one GPU2D blit.
+     *
+     * @param mask   The coverage, one byte per pixel.
+     * @param width  The width of the mask.
+     * @param height The height of the mask.
+     * @param x      The absolute x coordinate of the mask.
+     * @param y      The absolute y coordinate of the mask.
+     * @param bitmap The bitmap.
+     * @param u      The x coordinate of the texel of the bitmap drawn at x.
+     * @param v      The y coordinate of the texel of the bitmap drawn at y.
+     * @param clip   The absolute area to draw.
+     * @param alpha  The alpha.
+     *
+     * @return false if nothing was drawn, while rendering in software or when the bitmap
+     *         or the display orientation is not supported.
+     *
+     * @see HybridLCDGPU2D::drawMaskedBitmap
+     */
+    bool drawMaskedBitmap(const uint8_t* mask, uint16_t width, uint16_t height, int16_t x, int16_t y, const touchgfx::Bitmap& bitmap, int16_t u, int16_t v, const touchgfx::Rect& clip, uint8_t alpha);
+
+    /**
+     * @fn bool TouchGFXHAL::canDrawMaskedBitmap(const touchgfx::Bitmap& bitmap) const;
+     *
+     * @brief Tells if drawMaskedBitmap() draws a bitmap.
+     *
+     * @param bitmap The bitmap.
+     *
+     * @return false while rendering in software or if GPU2D cannot sample the bitmap.
+     *
+     * @see HybridLCDGPU2D::canSample
+     */
+    bool canDrawMaskedBitmap(const touchgfx::Bitmap& bitmap) const;
+
+    /**
+     * @fn bool TouchGFXHAL::drawUYVY(const uint8_t* frame, uint16_t width, uint16_t height, uint32_t stride, int16_t x, int16_t y, const touchgfx::Rect& clip, uint8_t alpha);
+     *
+     * @brief Draws a UYVY video frame with one GPU2D blit, converted to RGB as it is sampled.
+     *
+     * @param frame  The frame.
+     * @param width  The width of the frame.
+     * @param height The height of the frame.
+     * @param stride The bytes per line of the frame.
+     * @param x      The absolute x coordinate of the frame.
+     * @param y      The absolute y coordinate of the frame.
+     * @param clip   The absolute area to draw.
+     * @param alpha  The alpha of the frame.
+     *
+     * @return false if nothing was drawn, while rendering in software or when the display
+     *         orientation is not supported.
+     *
+     * @see HybridLCDGPU2D::drawUYVY
+     */
+    bool drawUYVY(const uint8_t* frame, uint16_t width, uint16_t height, uint32_t stride, int16_t x, int16_t y, const touchgfx::Rect& clip, uint8_t alpha);
+
+    /**
+     * @fn bool TouchGFXHAL::drawTransition(touchgfx::HybridLCDGPU2D::TransitionEffect effect, bool vertical, bool reverse, const touchgfx::Bitmap& from, const touchgfx::Bitmap& to, float step, const touchgfx::Rect& clip);
+     *
+     * @brief Draws a step of a NemaGFX screen transition between two snapshots.
+     *
+     * @param effect   The effect.
+     * @param vertical True for the screens to move vertically.
+     * @param reverse  True for the screens to move right or down.
+     * @param from     Snapshot of the old screen.
+     * @param to       Snapshot of the new screen.
+     * @param step     The progress, from 0 to 1.
+     * @param clip     The absolute area to draw in.
+     *
+     * @return false if nothing was drawn, while rendering in software or when the
+     *         snapshots cannot be drawn this way.
+     *
+     * @see HybridLCDGPU2D::drawTransition
+     */
+    bool drawTransition(touchgfx::HybridLCDGPU2D::TransitionEffect effect, bool vertical, bool reverse, const touchgfx::Bitmap& from, const touchgfx::Bitmap& to, float step, const touchgfx::Rect& clip);
+
+    /**
+     * @fn bool TouchGFXHAL::drawTSVG(const void* tsvg, const touchgfx::Matrix3x3& transform, const touchgfx::Rect& clip, float size = 0.0f);
+     *
+     * @brief Draws an SVG precompiled to TSVG with one NemaVG call.
+     *
+     * @param tsvg      The TSVG blob.
+     * @param transform Transforms the coordinates of the image to absolute coordinates.
+     * @param clip      The absolute area to draw in.
+     * @param size      The larger side of the image on screen in pixels, 0 if unknown.
+     *
+     * @return false if nothing was drawn, while rendering in software or when the display
+     *         orientation is not supported.
+     *
+     * @see HybridLCDGPU2D::drawTSVG
+     */
+    bool drawTSVG(const void* tsvg, const touchgfx::Matrix3x3& transform, const touchgfx::Rect& clip, float size = 0.0f);
+
+    /**
+     * @fn touchgfx::HybridLCDGPU2D::FragmentResult TouchGFXHAL::beginFragment(const void* owner, uint32_t version, const touchgfx::Rect& area);
+     *
+     * @brief Replays the GPU2D commands recorded for a subtree, or starts recording them.
+     *
+     * @param owner   Identifies the subtree.
+     * @param version Changed by the owner whenever the subtree looks different.
+     * @param area    The absolute area the subtree is drawn in.
+     *
+     * @return FRAGMENT_UNAVAILABLE while rendering in software, otherwise what
+     *         HybridLCDGPU2D::beginFragment() did.
+     *
+     * @see HybridLCDGPU2D::beginFragment
+     */
+    touchgfx::HybridLCDGPU2D::FragmentResult beginFragment(const void* owner, uint32_t version, const touchgfx::Rect& area);
+
+    /**
+     * @fn bool TouchGFXHAL::endFragment();
+     *
+     * @brief Ends the recording started by beginFragment().
+     *
+     * @return false if the subtree must be drawn again without recording.
+     *
+     * @see HybridLCDGPU2D::endFragment
+     */
+    bool endFragment();
+
+    /**
+     * @fn void TouchGFXHAL::discardFragments(const void* owner);
+     *
+     * @brief Discards the GPU2D commands recorded for a subtree.
+     *
+     * @param owner The subtree.
+     */
+    void discardFragments(const void* owner);
+
+    using HALGPU2D::drawDrawableInDynamicBitmap;
+
+    /**
+     * @fn virtual void TouchGFXHAL::drawDrawableInDynamicBitmap(touchgfx::Drawable& drawable, touchgfx::BitmapId bitmapId, const touchgfx::Rect& rect);
+     *
+     * @brief Renders a drawable into a dynamic bitmap, in any format canDrawInDynamicBitmap() accepts.
+     *
+     * @param [in,out] drawable The drawable to render.
+     * @param          bitmapId The dynamic bitmap rendered into.
+     * @param          rect     Region to update.
+     */
+    virtual void drawDrawableInDynamicBitmap(touchgfx::Drawable& drawable, touchgfx::BitmapId bitmapId, const touchgfx::Rect& rect);
+
+    /**
+     * @fn void TouchGFXHAL::setTripleBuffering(bool enabled);
+     *
+     * @brief Enables or disables rendering into the third framebuffer.
+     *
+     *        With triple buffering, a frame completed between two VSYNCs is queued to be
+     *        shown at the next vertical blanking, and the next frame is rendered right away
+     *        into the framebuffer that is neither shown nor queued. Without it, a completed
+     *        frame is shown immediately, as with double buffering. Has no effect if
+     *        TOUCHGFX_TRIPLE_BUFFERING is 0.
+     *
+     * @param enabled true to enable triple buffering.
+     */
+    void setTripleBuffering(bool enabled);
+
+    /**
+     * @fn uint32_t TouchGFXHAL::getFrameNumber() const;
+     *
+     * @brief Gets the number of the frame being rendered.
+     *
+     *        Frames are numbered from 1 as they complete, frames of skipped ticks and ticks
+     *        that draw nothing are not counted.
+     *
+     * @return The number of the frame being rendered.
+     */
+    uint32_t getFrameNumber() const
+    {
+        return completedFrames + 1;
+    }
+
+    /**
+     * @fn uint8_t TouchGFXHAL::getClientFrameBufferAge();
+     *
+     * @brief Gets how many frames old the framebuffer being rendered is.
+     *
+     *        An age of 1 means the framebuffer holds the previous frame, as with a single
+     *        or partial framebuffer. With double buffering it holds the frame before that,
+     *        an age of 2, and when it was the third framebuffer it may be older. The areas
+     *        damaged in the age - 1 latest frames are outdated in the framebuffer, see
+     *        FrameDamageHistory.
+     *
+     * @return The age of the framebuffer, 0 if its content is unknown, as when it was never
+     *         rendered or the framebuffer format changed.
+     */
+    uint8_t getClientFrameBufferAge();
+
+    /**
+     * @fn bool TouchGFXHAL::copyPreviousFrame(const touchgfx::Rect& area, int16_t dx, int16_t dy);
+     *
+     * @brief Copies part of the latest completed frame into the framebuffer being rendered, moved.
+     *
+     *        The pixels of the area in the latest frame, shown or queued for the next
+     *        vertical blanking, are copied dx, dy from where they were, as far as they stay
+     *        inside the area. The framebuffer being rendered may be one or two frames older,
+     *        the copied part is as recent as the latest frame once this returns. The copy is
+     *        recorded by HybridLCDGPU2D, before anything drawn after it. When the pixels
+     *        moved, the caller adds the area to the damage of the frame.
+     *
+     * @param area The area, in absolute coordinates.
+     * @param dx   The distance moved horizontally.
+     * @param dy   The distance moved vertically.
+     *
+     * @return false if nothing was copied: with a single framebuffer, a rotated display, a
+     *         framebuffer format other than RGB565 or a partial framebuffer.
+     */
+    bool copyPreviousFrame(const touchgfx::Rect& area, int16_t dx, int16_t dy);
+
+    /**
+     * @fn bool TouchGFXHAL::isTileUnchanged(uint16_t column, uint16_t row);
+     *
+     * @brief Tells if a tile of the framebuffer being rendered holds the pixels of the
+     *        latest completed frame already.
+     *
+     *        Widgets often invalidate after an update that leaves their pixels as they
+     *        were, and the framebuffer being rendered is then brought up to date with
+     *        pixels it has. With TOUCHGFX_TILE_HASH, the tile of TOUCHGFX_TILE_HASH_SIZE
+     *        pixels is hashed by the CRC unit in both framebuffers and the hashes compared.
+     *        A hash is kept with the number of the frame the framebuffer held, so the tiles
+     *        of the latest frame hashed here are not hashed again when their framebuffer is
+     *        rendered into two frames later.
+     *
+     * @param column The column of the tile.
+     * @param row    The row of the tile.
+     *
+     * @return false if the tile may differ, or with a single framebuffer, a rotated
+     *         display, a framebuffer format other than RGB565 or without TOUCHGFX_TILE_HASH.
+     */
+    bool isTileUnchanged(uint16_t column, uint16_t row);
+
+    /**
+     * @fn void TouchGFXHAL::reportTileHashes();
+     *
+     * @brief Reports the tiles compared by isTileUnchanged() over SWO.
+     *
+     *        Reports the tiles compared, those found unchanged and not brought up to date,
+     *        the CRCs computed, and the tiles skipped in the latest frame and at most in a
+     *        frame, since the last report.
+     */
+    void reportTileHashes();
+
+    /**
+     * @fn void TouchGFXHAL::reportFrameBuffering();
+     *
+     * @brief Reports how often the third framebuffer saved a frame over SWO.
+     *
+     *        Reports the number of frame swaps, the frames rendered into the third
+     *        framebuffer while the previous frame waited for VSYNC, and the frames that
+     *        still had to wait because two frames were queued, since the last report.
+     */
+    void reportFrameBuffering();
+
+    /**
+     * @fn void TouchGFXHAL::reportCacheMaintenance();
+     *
+     * @brief Reports the data cache maintenance over SWO.
+     *
+     *        Reports the ranges skipped as not cacheable, the ranges and lines maintained
+     *        line by line and the ranges maintained on the whole cache, since the last report.
+     *        Then reports the GPU2D instruction cache: the disables and invalidations NemaVG
+     *        asked for, the invalidations performed and spared, the writes reported inside
+     *        and outside the memory it serves, and its hits and misses.
+     *
+     * @see DCacheMaintenance, nema_hal_get_icache_stats()
+     */
+    void reportCacheMaintenance();
+
+    /**
+     * @fn void TouchGFXHAL::reportBlockCopy();
+     *
+     * @brief Reports the block copies done by DMA2D and by the CPU over SWO, and the
+     *        times a copy waited for the queue of copies to drain, then resets them.
+     *
+     * @see touchgfx::AsyncBlockCopy
+     */
+    void reportBlockCopy();
+
+    /**
+     * @fn void TouchGFXHAL::reportDynamicResolution();
+     *
+     * @brief Reports the scale of heavy widgets over SWO: the frames rendered at each
+     *        scale, the frames over budget, the times the scale was lowered and raised and
+     *        the longest frame, then resets them.
+     *
+     * @see touchgfx::DynamicResolution
+     */
+    void reportDynamicResolution();
+
+    /**
+     * @fn void TouchGFXHAL::reportAssetUploads();
+     *
+     * @brief Reports the uploads queued on HPDMA per priority, the bytes moved, the copies
+     *        left to the CPU, the blocks that overtook a lower priority upload and the frames
+     *        that waited for their uploads over SWO, then resets them.
+     *
+     * @see touchgfx::AssetUploadQueue
+     */
+    void reportAssetUploads();
+
+    /**
+     * @fn void TouchGFXHAL::reportQualityGovernor();
+     *
+     * @brief Reports the rendering quality over SWO: the current level, the frames
+     *        rendered at each level, the frames over budget and the times the quality was
+     *        lowered and raised, then resets them.
+     *
+     * @see touchgfx::QualityGovernor
+     */
+    void reportQualityGovernor();
+
+    /**
+     * @fn void TouchGFXHAL::reportStartup();
+     *
+     * @brief Reports the startup timeline over SWO.
+     *
+     *        Reports the duration of each startup phase of the boot loader and of the
+     *        application, up to the first frame shown, the XSPI settings the boot
+     *        loader calibrated and the last asset update it applied. Called once by
+     *        endFrame() after the first frame has been handed to LTDC.
+     *
+     * @see touchgfx::StartupTrace, touchgfx::XspiCalibration, touchgfx::AssetUpdate
+     */
+    void reportStartup()
+    {
+        touchgfx::StartupTrace::report();
+        touchgfx::XspiCalibration::report();
+        touchgfx::AssetUpdate::report();
+    }
+
+#if defined(HAL_SD_MODULE_ENABLED)
+    /**
+     * @fn virtual touchgfx::FlashDataReader* TouchGFXHAL::getFlashDataReader() const;
+     *
+     * @brief Gets the reader of the assets linked in SDCardSection.
+     *
+     * @return The SD card reader once initialized, or 0 if no card answered.
+     *
+     * @see touchgfx::SDCardDataReader
+     */
+    virtual touchgfx::FlashDataReader* getFlashDataReader() const
+    {
+        return touchgfx::SDCardDataReader::getInstance();
+    }
+#endif
+
+protected:
+    /**
+     * @fn virtual uint16_t* TouchGFXHAL::getTFTFrameBuffer() const;
+     *
+     * @brief Gets the frame buffer address used by the TFT controller.
+     *
+     *        Gets the frame buffer address used by the TFT controller.
+     *
+     * @return The address of the frame buffer currently being displayed on the TFT.
+     */
+    virtual uint16_t* getTFTFrameBuffer() const;
+
+    /**
+     * @fn virtual void TouchGFXHAL::setTFTFrameBuffer(uint16_t* adr);
+     *
+     * @brief Sets the frame buffer address used by the TFT controller.
+     *
+     *        Sets the frame buffer address used by the TFT controller.
+     *
+     * @param [in,out] adr New frame buffer address.
+     */
+    virtual void setTFTFrameBuffer(uint16_t* adr);
+
+    /**
+     * @fn uint16_t* TouchGFXHAL::getLTDCFrameBuffer() const;
+     *
+     * @brief Gets the frame buffer address programmed in the LTDC background layer.
+     *
+     * @return The address LTDC scans out, ignoring a frame queued for the next vertical blanking.
+     */
+    uint16_t* getLTDCFrameBuffer() const;
+
+    /**
+     * @fn void TouchGFXHAL::setLTDCFrameBuffer(uint16_t* address);
+     *
+     * @brief Programs the LTDC background layer to scan out a frame buffer, immediately.
+     *
+     * @param [in,out] address New frame buffer address.
+     */
+    void setLTDCFrameBuffer(uint16_t* address);
+
+    /**
+     * @fn void TouchGFXHAL::initializeVideo();
+     *
+     * @brief Adds DMA2D and the buffers to the video decoders, and the decoders to the video controller.
+     */
+    void initializeVideo();
+
+    /**
+     * @fn virtual void TouchGFXHAL::tick();
+     *
+     * @brief Measures the time since the previous tick before running the tick.
+     *
+     * @see FramePacer::startTick
+     */
+    virtual void tick();
+
+    /**
+     * @fn virtual void TouchGFXHAL::InvalidateCache();
+     *
+     * @brief Drops what DMA2D and GPU2D wrote from the data cache, before the CPU renders.
+     *
+     *        Only the destinations of the blits queued since the last call are invalidated,
+     *        see STM32ChromARTDMA::invalidateWritten(), and the framebuffer if GPU2D rendered to it.
+     *        Nothing is invalidated when the range is not cacheable.
+     */
+    virtual void InvalidateCache();
+
+    /**
+     * @fn virtual void TouchGFXHAL::FlushCache();
+     *
+     * @brief Writes what the CPU rendered back to memory, before DMA2D or GPU2D render.
+     *
+     *        A blit switching to hardware rendering has its destination cleaned as it is
+     *        queued, see STM32ChromARTDMA::addToQueue(), so nothing is cleaned here. A GPU2D command
+     *        list may write anywhere in the framebuffer, which is cleaned. Other data written
+     *        by the CPU for DMA2D to read is cleaned by the writer, see cleanDCache().
+     */
+    virtual void FlushCache();
+private:
+    void frameCompleted(uint16_t* frameBuffer);
+    void updateShownFrameBuffer();
+    int indexOf(const uint16_t* frameBuffer) const;
+    uint16_t* getSpareFrameBuffer() const;
+    void applyFrameBufferFormat();
+    void applyLTDCPixelFormat();
+    void sampleGPU2DTiming();
+    /** Redraws the screen after GPU2D was reset, its work since the last frame is lost. */
+    void checkGPU2DRecovery();
+    /** Counts the ticks a refresh at the lower idle rate stands for. */
+    void updateFrameRateCompensation();
+    static void frameBufferUsage(const void* context, touchgfx::MemoryBudget::Usage& usage);
+    /** Hit rates of the caches since the previous sample of the soak test, in percent. */
+    static uint32_t glyphAtlasHitRate(const void* context);
+    static uint32_t textureCacheHitRate(const void* context);
+
+    touchgfx::CortexMMCUInstrumentation instrumentation;
+    touchgfx::FrameBenchmark benchmark;
+    touchgfx::FramePacer pacer;
+    touchgfx::FrameMissClassifier missClassifier;
+    touchgfx::HotPathProfiler hotPath;
+    touchgfx::IdleSuspend idle;
+    touchgfx::IdleRefreshRate idleRefresh;
+    touchgfx::TouchLatency touchLatency;
+    touchgfx::OverlayLayer overlay;
+    touchgfx::BackgroundLayer background;
+    touchgfx::TextureCache textureCache;
+    touchgfx::GlyphAtlas glyphAtlas;
+    touchgfx::CachedVectorFontRenderer vectorFontRenderer;
+    touchgfx::ShapedTextCache shapedTextCache;
+    touchgfx::TextureMipChain mipChain;
+    touchgfx::WidgetProfiler widgetProfiler;
+    touchgfx::PerfHUD perfHUD;
+    touchgfx::OverdrawHeatmap overdraw;
+    touchgfx::FrameBufferPalette palette;
+    touchgfx::DynamicResolution dynamicResolution;
+    touchgfx::QualityGovernor qualityGovernor;
+    touchgfx::AsyncBlockCopy blockCopier;
+    touchgfx::AssetUploadQueue assetUploads;
+    uint32_t ringStallFrames;   ///< Number of frames that stalled on a full ring buffer
+    uint32_t ringStallsMax;     ///< Highest number of ring buffer stalls in one frame
+    uint32_t gpuRecoveries;     ///< GPU2D resets already handled, see nema_hal_get_recoveries()
+    nema_hal_gpu_stats_t gpuFrame;  ///< GPU2D timing of the last frame period
+    uint32_t gpuFrames;             ///< Frame periods timed since the last report
+    uint64_t gpuElapsedSum;         ///< Cycles of those frame periods
+    uint64_t gpuBusySum;            ///< Cycles GPU2D was busy in them
+    uint32_t gpuBusyMax;            ///< Longest busy time of one frame period
+    uint32_t gpuCommandLists;       ///< Command lists submitted in them
+    uint32_t gpuIdleGaps;           ///< Times GPU2D ran out of work in them
+    uint32_t gpuLongestGap;         ///< Longest of those idle gaps
+    bool neoChromActive;
+    bool frameSkipped;          ///< The frame of the current tick is not rendered
+    bool drawnInTick;           ///< The current tick has flushed an area of the framebuffer
+    const uint16_t* completedFrameBuffer; ///< The framebuffer of the last frame drawn, see ScreenCapture
+    uint32_t completedFrame;    ///< The number of that frame
+    touchgfx::Bitmap::BitmapFormat pendingFormat; ///< Framebuffer format of the next frame
+    bool ltdcFormatPending;     ///< LTDC must switch pixel format with the next shown frame
+    bool frameBufferL8;         ///< The framebuffer is ARGB2222, rendered by software only
+    bool calibrationPending;    ///< The blit costs are measured at the start of the next frame
+    bool blitBenchmarkPending;  ///< The blit operations are timed at the start of the next frame
+    bool frameBufferFlushed;    ///< The framebuffer was cleaned for GPU2D, and is invalidated with the blits
+    uint32_t vsyncWaitCycles;   ///< Cycle counter when the task started waiting for VSYNC
+    uint16_t* frameBuffers[3];           ///< The two framebuffers in frameBuf and the third, or 0
+    uint32_t renderedFrame[3];           ///< Number of the frame last rendered into each framebuffer, 0 if unknown
+    uint32_t completedFrames;            ///< Frames completed since start
+    uint16_t* volatile latestFrameBuffer; ///< Framebuffer of the last completed frame
+    uint16_t* volatile shownFrameBuffer;  ///< Framebuffer being scanned out by LTDC
+    volatile bool reloadPending;          ///< latestFrameBuffer is shown at the next vertical blanking
+    bool tripleBuffering;
+    uint32_t frameSwaps;        ///< Completed frames
+    uint32_t thirdBufferFrames; ///< Frames rendered into the third framebuffer
+    uint32_t thirdBufferWaits;  ///< Frames that waited for a queued frame to be shown
+    uint32_t tilesCompared;       ///< Tiles compared by isTileUnchanged()
+    uint32_t tilesUnchanged;      ///< Tiles found unchanged
+    uint32_t tileHashes;          ///< CRCs of tiles computed
+    uint32_t tilesUnchangedFrame; ///< Tiles found unchanged in the frame of tileFrame
+    uint32_t tilesUnchangedMax;   ///< Most tiles found unchanged in a frame
+    uint32_t tileFrame;           ///< Number of the frame the tiles were last compared in
+
+    /** Progress of the startup trace. */
+    enum StartupStage
+    {
+        STARTUP_RENDERING, ///< The first frame is not shown yet
+        STARTUP_SHOWN,     ///< The first frame is handed to LTDC, the trace is to be reported
+        STARTUP_REPORTED
+    };
+    volatile StartupStage startupStage;
 };
 
 /* USER CODE END TouchGFXHAL.hpp */
@@ -0,0 +1,108 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : TouchGFXTargetConfiguration.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+/* USER CODE BEGIN TouchGFXTargetConfiguration.cpp */
+
+/*
+ * Replaces the generated TouchGFXConfiguration.cpp, which is not built: the display
+ * blits with DMA2D next to GPU2D, the NemaVG stencil is allocated by nema_hal_vg_init()
+ * and the startup stages are traced.
+ */
+#include <texts/TypedTextDatabase.hpp>
+#include <fonts/ApplicationFontProvider.hpp>
+#include <gui/common/FrontendHeap.hpp>
+#include <BitmapDatabase.hpp>
+#include <touchgfx/VectorFontRendererImpl.hpp>
+#include <HybridLCDGPU2D.hpp>
+extern "C"
+{
+#include <nema_hal.h>
+#include <nema_vg.h>
+#include <nema_hal_ext.h>
+}
+#include <STM32ChromARTDMA.hpp>
+#include <TouchGFXHAL.hpp>
+#include <STM32TouchController.hpp>
+#include <StartupTrace.hpp>
+#include <stm32h7rsxx_hal.h>
+
+extern "C" void touchgfx_init();
+extern "C" void touchgfx_taskEntry();
+extern "C" void touchgfx_components_init();
+
+static STM32TouchController tc;
+static STM32ChromARTDMA dma;
+static HybridLCDGPU2D display(dma);
+static VectorFontRendererImpl vectorFontRenderer;
+static ApplicationFontProvider fontProvider;
+static Texts texts;
+static TouchGFXHAL hal(dma, display, tc, 800, 480);
+
+void touchgfx_init()
+{
+    Bitmap::registerBitmapDatabase(BitmapDatabase::getInstance(), BitmapDatabase::getInstanceSize());
+    TypedText::registerTexts(&texts);
+    Texts::setLanguage(0);
+
+    display.setFrameBufferFormat(Bitmap::RGB565);
+
+    display.setVectorFontRenderer(&vectorFontRenderer);
+
+    FontManager::setFontProvider(&fontProvider);
+
+    FrontendHeap& heap = FrontendHeap::getInstance();
+    /*
+     * we need to obtain the reference above to initialize the frontend heap.
+     */
+    (void)heap;
+    touchgfx::StartupTrace::mark("FrontendHeap");
+
+    /*
+     * Initialize TouchGFX
+     */
+    hal.initialize();
+    touchgfx::StartupTrace::mark("TouchGFXHAL::initialize");
+}
+
+void touchgfx_components_init()
+{
+    nema_init();
+    nema_hal_vg_init(800, 480);
+    nema_vg_handle_large_coords(1, 1);
+    nema_ext_hold_enable(2);
+    nema_ext_hold_irq_enable(2);
+    nema_ext_hold_enable(3);
+    nema_ext_hold_irq_enable(3);
+    touchgfx::StartupTrace::mark("nema_init, nema_hal_vg_init");
+}
+
+void touchgfx_taskEntry()
+{
+    /*
+     * Main event loop. Will wait for VSYNC signal, and then process next frame. Call
+     * this function from your GUI task.
+     *
+     * Note This function never returns
+     */
+    touchgfx::StartupTrace::mark("osKernelStart");
+    hal.taskEntry();
+}
+
+/* USER CODE END TouchGFXTargetConfiguration.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,352 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : TouchLatency.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include <TouchLatency.hpp>
+
+/* USER CODE BEGIN TouchLatency.cpp */
+#include <stdio.h>
+#include <string.h>
+#include <TraceOutput.hpp>
+
+#include "stm32h7rsxx.h"
+
+namespace
+{
+const uint32_t BUCKET_US = 1000U;
+// A frame swapped that long after the sample was rendered is not the frame that handled it
+const uint32_t STALE_US = 1000000U;
+}
+
+namespace touchgfx
+{
+TouchLatency* TouchLatency::instance = 0;
+
+TouchLatency::TouchLatency()
+    : head(0), tail(0), vsyncCycles(0), lineCycles(0), displayLatencyUs(0), gestureNumber(0), inGesture(false), gestureEnded(false)
+{
+    memset(records, 0, sizeof(records));
+    clear(gesture);
+    clear(total);
+}
+
+uint32_t TouchLatency::now()
+{
+    return DWT->CYCCNT;
+}
+
+void TouchLatency::sampled(uint32_t irqCycles, uint32_t readCycles, int16_t row, bool touched)
+{
+    if (touched && !inGesture)
+    {
+        startGesture();
+    }
+    else if (!touched)
+    {
+        if (!inGesture)
+        {
+            // A release timed out or repeated, it belongs to no gesture
+            return;
+        }
+        inGesture = false;
+        gestureEnded = true;
+    }
+
+    if (head != tail)
+    {
+        Record& newest = records[(head - 1) % TOUCH_LATENCY_RECORDS];
+        if (newest.state == STATE_SAMPLED)
+        {
+            // Handled by the same frame, the oldest sample is the latency seen
+            newest.row = row;
+            return;
+        }
+    }
+    if (head - tail >= TOUCH_LATENCY_RECORDS)
+    {
+        gesture.dropped++;
+        total.dropped++;
+        return;
+    }
+
+    Record& record = records[head % TOUCH_LATENCY_RECORDS];
+    record.stamps[0] = irqCycles;
+    record.stamps[STAGE_READ + 1] = readCycles;
+    record.stamps[STAGE_TICK + 1] = now();
+    record.gesture = gestureNumber;
+    record.row = row;
+    record.idleFrames = 0;
+    // The LTDC interrupt only looks at records whose state says they are complete
+    __DMB();
+    record.state = STATE_SAMPLED;
+    head++;
+}
+
+void TouchLatency::frameEnded(bool drawn)
+{
+    const uint32_t cycles = now();
+    for (uint32_t i = tail; i != head; i++)
+    {
+        Record& record = records[i % TOUCH_LATENCY_RECORDS];
+        if (record.state == STATE_SAMPLED)
+        {
+            if (drawn)
+            {
+                record.stamps[STAGE_RENDER + 1] = cycles;
+                __DMB();
+                record.state = STATE_RENDERED;
+            }
+            else if (++record.idleFrames > TOUCH_LATENCY_MAX_IDLE_FRAMES)
+            {
+                drop(record);
+            }
+        }
+        else if (record.state == STATE_RENDERED || record.state == STATE_QUEUED)
+        {
+            // Frames are not swapped with beam racing and the partial framebuffer
+            __disable_irq();
+            if ((record.state == STATE_RENDERED || record.state == STATE_QUEUED)
+                && cyclesToUs(cycles - record.stamps[STAGE_RENDER + 1]) > STALE_US)
+            {
+                drop(record);
+            }
+            __enable_irq();
+        }
+    }
+
+    // Account the samples in the order they were taken
+    while (tail != head)
+    {
+        Record& record = records[tail % TOUCH_LATENCY_RECORDS];
+        if (record.state == STATE_SCANNED)
+        {
+            account(record);
+            record.state = STATE_FREE;
+        }
+        else if (record.state != STATE_FREE)
+        {
+            break;
+        }
+        tail++;
+    }
+
+    if (gestureEnded && tail == head)
+    {
+        gestureEnded = false;
+#if TOUCH_LATENCY_GESTURE_REPORTS
+        char name[24];
+        snprintf(name, sizeof(name), "gesture %lu", (unsigned long)gestureNumber);
+        print(name, gesture);
+#endif
+    }
+}
+
+void TouchLatency::frameSwapped(bool immediate)
+{
+    const uint32_t cycles = now();
+    for (uint32_t i = 0; i < TOUCH_LATENCY_RECORDS; i++)
+    {
+        Record& record = records[i];
+        if (record.state != STATE_RENDERED)
+        {
+            continue;
+        }
+        record.stamps[STAGE_SWAP + 1] = cycles;
+        if (immediate)
+        {
+            record.stamps[STAGE_SCANOUT + 1] = cycles + (record.row + 1) * lineCycles;
+            __DMB();
+            record.state = STATE_SCANNED;
+        }
+        else
+        {
+            record.state = STATE_QUEUED;
+        }
+    }
+}
+
+void TouchLatency::vSync()
+{
+    const uint32_t cycles = now();
+    if (vsyncCycles != 0)
+    {
+        // Refreshes missed while the line interrupt was off would lengthen the line
+        const uint32_t lines = (LTDC->TWCR & 0x7FF) + 1;
+        const uint32_t line = (cycles - vsyncCycles) / lines;
+        if (lineCycles == 0 || line < lineCycles * 2)
+        {
+            lineCycles = line;
+        }
+    }
+    vsyncCycles = cycles;
+
+    // LTDC clears VBR when the queued address has been loaded at vertical blanking
+    if (LTDC->SRCR & LTDC_SRCR_VBR)
+    {
+        return;
+    }
+    for (uint32_t i = 0; i < TOUCH_LATENCY_RECORDS; i++)
+    {
+        Record& record = records[i];
+        if (record.state == STATE_QUEUED)
+        {
+            record.stamps[STAGE_SCANOUT + 1] = cycles + (record.row + 1) * lineCycles;
+            __DMB();
+            record.state = STATE_SCANNED;
+        }
+    }
+}
+
+void TouchLatency::resetStats()
+{
+    clear(total);
+}
+
+void TouchLatency::account(const Record& record)
+{
+    const uint32_t latencyUs = cyclesToUs(record.stamps[NUMBER_OF_STAGES] - record.stamps[0]);
+    uint32_t stageUs[NUMBER_OF_STAGES];
+    for (int stage = 0; stage < NUMBER_OF_STAGES; stage++)
+    {
+        stageUs[stage] = cyclesToUs(record.stamps[stage + 1] - record.stamps[stage]);
+    }
+    add(total, stageUs, latencyUs);
+
+    const uint32_t displayUs = stageUs[STAGE_RENDER] + stageUs[STAGE_SWAP] + stageUs[STAGE_SCANOUT];
+    displayLatencyUs = (displayLatencyUs == 0) ? displayUs : displayLatencyUs - displayLatencyUs / 8 + displayUs / 8;
+    if (record.gesture == gestureNumber)
+    {
+        add(gesture, stageUs, latencyUs);
+    }
+}
+
+void TouchLatency::drop(Record& record)
+{
+    if (record.gesture == gestureNumber)
+    {
+        gesture.dropped++;
+    }
+    total.dropped++;
+    record.state = STATE_FREE;
+}
+
+void TouchLatency::startGesture()
+{
+#if TOUCH_LATENCY_GESTURE_REPORTS
+    if (gestureEnded)
+    {
+        // Pressed again before the samples of the last gesture were accounted
+        char name[24];
+        snprintf(name, sizeof(name), "gesture %lu", (unsigned long)gestureNumber);
+        print(name, gesture);
+    }
+#endif
+    gestureEnded = false;
+    gestureNumber++;
+    inGesture = true;
+    clear(gesture);
+}
+
+void TouchLatency::print(const char* name, const Distribution& distribution) const
+{
+    if (distribution.events == 0)
+    {
+        tracePrintf("touch latency %s: events=0 dropped=%lu", name, (unsigned long)distribution.dropped);
+        return;
+    }
+
+    const uint32_t events = distribution.events;
+    tracePrintf("touch latency %s: events=%lu dropped=%lu min=%luus p50=%luus p90=%luus p99=%luus max=%luus avg=%luus"
+                " | read=%luus tick=%luus render=%luus swap=%luus scanout=%luus",
+                name,
+                (unsigned long)events,
+                (unsigned long)distribution.dropped,
+                (unsigned long)distribution.minUs,
+                (unsigned long)percentileUs(distribution, 50),
+                (unsigned long)percentileUs(distribution, 90),
+                (unsigned long)percentileUs(distribution, 99),
+                (unsigned long)distribution.maxUs,
+                (unsigned long)(distribution.sumUs / events),
+                (unsigned long)(distribution.stageSumUs[STAGE_READ] / events),
+                (unsigned long)(distribution.stageSumUs[STAGE_TICK] / events),
+                (unsigned long)(distribution.stageSumUs[STAGE_RENDER] / events),
+                (unsigned long)(distribution.stageSumUs[STAGE_SWAP] / events),
+                (unsigned long)(distribution.stageSumUs[STAGE_SCANOUT] / events));
+}
+
+void TouchLatency::clear(Distribution& distribution)
+{
+    memset(&distribution, 0, sizeof(distribution));
+    distribution.minUs = 0xFFFFFFFFU;
+}
+
+void TouchLatency::add(Distribution& distribution, const uint32_t* stageUs, uint32_t latencyUs)
+{
+    distribution.events++;
+    distribution.sumUs += latencyUs;
+    if (latencyUs < distribution.minUs)
+    {
+        distribution.minUs = latencyUs;
+    }
+    if (latencyUs > distribution.maxUs)
+    {
+        distribution.maxUs = latencyUs;
+    }
+    for (int stage = 0; stage < NUMBER_OF_STAGES; stage++)
+    {
+        distribution.stageSumUs[stage] += stageUs[stage];
+    }
+
+    const uint32_t buckets = sizeof(distribution.histogram) / sizeof(distribution.histogram[0]);
+    uint32_t bucket = latencyUs / BUCKET_US;
+    if (bucket >= buckets)
+    {
+        bucket = buckets - 1;
+    }
+    if (distribution.histogram[bucket] < 0xFFFFU)
+    {
+        distribution.histogram[bucket]++;
+    }
+}
+
+uint32_t TouchLatency::percentileUs(const Distribution& distribution, uint32_t pct)
+{
+    const uint32_t buckets = sizeof(distribution.histogram) / sizeof(distribution.histogram[0]);
+    const uint32_t rank = (distribution.events * pct + 99U) / 100U;
+    uint32_t count = 0;
+    for (uint32_t bucket = 0; bucket < buckets - 1; bucket++)
+    {
+        count += distribution.histogram[bucket];
+        if (count >= rank)
+        {
+            // The upper bound of the bucket
+            const uint32_t us = (bucket + 1) * BUCKET_US;
+            return us < distribution.maxUs ? us : distribution.maxUs;
+        }
+    }
+    return distribution.maxUs;
+}
+
+uint32_t TouchLatency::cyclesToUs(uint32_t cycles) const
+{
+    return (uint32_t)(((uint64_t)cycles * 1000000U) / SystemCoreClock);
+}
+} // namespace touchgfx
+
+/* USER CODE END TouchLatency.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
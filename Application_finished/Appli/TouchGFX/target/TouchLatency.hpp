@@ -0,0 +1,273 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : TouchLatency.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef TOUCHLATENCY_HPP
+#define TOUCHLATENCY_HPP
+
+#include <stdint.h>
+
+/* USER CODE BEGIN TouchLatency.hpp */
+
+/**
+ * Set to 0 to not report the latency of every gesture over SWO when it ends. The latency
+ * is still measured and reported by TouchGFXHAL::reportTouchLatency().
+ */
+#ifndef TOUCH_LATENCY_GESTURE_REPORTS
+#define TOUCH_LATENCY_GESTURE_REPORTS 1
+#endif
+
+/**
+ * Number of touch samples followed through the pipeline at the same time. A sample taken
+ * while all are in flight is not measured.
+ */
+#ifndef TOUCH_LATENCY_RECORDS
+#define TOUCH_LATENCY_RECORDS 4
+#endif
+
+/**
+ * Frames without a redraw after which a sample is no longer followed, as it changed
+ * nothing on the screen.
+ */
+#ifndef TOUCH_LATENCY_MAX_IDLE_FRAMES
+#define TOUCH_LATENCY_MAX_IDLE_FRAMES 3
+#endif
+
+namespace touchgfx
+{
+/**
+ * @class TouchLatency
+ *
+ * @brief Measures the latency from the touch interrupt to the touched row being scanned out.
+ *
+ *        Every stage of a touch sample is timestamped with the DWT cycle counter: the
+ *        TP_IRQ EXTI, the end of the I2C read, sampleTouch() in the tick, the end of the
+ *        frame that handled it, the swap to that frame and the start of its scanout. The
+ *        time the touched row reaches the panel is estimated from the start of the scanout
+ *        and the measured line period.
+ *
+ *        Samples coalesced into one frame are measured from the oldest, the latency a user
+ *        sees. Samples that cause no redraw within TOUCH_LATENCY_MAX_IDLE_FRAMES frames are
+ *        dropped. The latencies of a gesture, from press to release, are reported as a
+ *        distribution, with the average time spent in every stage.
+ */
+class TouchLatency
+{
+public:
+    /** Stages of the touch pipeline, each from the end of the previous one. */
+    enum Stage
+    {
+        STAGE_READ,     ///< From the EXTI to the end of the I2C read
+        STAGE_TICK,     ///< From the read to sampleTouch() in the next tick
+        STAGE_RENDER,   ///< From sampleTouch() to the end of the frame
+        STAGE_SWAP,     ///< From the end of the frame to its swap to LTDC
+        STAGE_SCANOUT,  ///< From the swap to the scanout of the touched row
+        NUMBER_OF_STAGES
+    };
+
+    /** Latencies of a gesture, or since the last report. */
+    struct Distribution
+    {
+        uint32_t events;                    ///< Samples measured to the scanout
+        uint32_t dropped;                   ///< Samples that caused no redraw, or found no record free
+        uint32_t minUs;
+        uint32_t maxUs;
+        uint64_t sumUs;
+        uint64_t stageSumUs[NUMBER_OF_STAGES];
+        uint16_t histogram[64];             ///< Latencies by millisecond, the last bucket holding the longer ones
+    };
+
+    TouchLatency();
+
+    /**
+     * @fn void TouchLatency::sampled(uint32_t irqCycles, uint32_t readCycles, int16_t row, bool touched);
+     *
+     * @brief Starts following a touch sample. Called by sampleTouch() in the tick.
+     *
+     * @param irqCycles  Cycle counter at the EXTI of the oldest sample coalesced.
+     * @param readCycles Cycle counter at the end of its I2C read.
+     * @param row        The display row touched.
+     * @param touched    false for a release.
+     */
+    void sampled(uint32_t irqCycles, uint32_t readCycles, int16_t row, bool touched);
+
+    /**
+     * @fn void TouchLatency::frameEnded(bool drawn);
+     *
+     * @brief Stamps the samples handled by the frame. Called at the end of every frame.
+     *
+     *        Also accounts the samples that reached the scanout, and reports a gesture that
+     *        ended once all its samples are accounted.
+     *
+     * @param drawn true if the frame flushed an area of the framebuffer.
+     */
+    void frameEnded(bool drawn);
+
+    /**
+     * @fn void TouchLatency::frameSwapped(bool immediate);
+     *
+     * @brief Stamps the swap of the last rendered frame. Called by setTFTFrameBuffer().
+     *
+     * @param immediate true if LTDC scans the frame out from now, false if it is queued
+     *                  for the next vertical blanking.
+     */
+    void frameSwapped(bool immediate);
+
+    /**
+     * @fn void TouchLatency::vSync();
+     *
+     * @brief Measures the line period and stamps the scanout of queued frames. Called from
+     *        the LTDC line interrupt as the active area starts.
+     */
+    void vSync();
+
+    /**
+     * @fn void TouchLatency::report() const;
+     *
+     * @brief Reports the latencies of all gestures since the last reset over SWO.
+     */
+    void report() const
+    {
+        print("all", total);
+    }
+
+    /**
+     * @fn const Distribution& TouchLatency::getStats() const;
+     *
+     * @brief Gets the latencies of all gestures since the last reset.
+     *
+     * @return The latencies.
+     */
+    const Distribution& getStats() const
+    {
+        return total;
+    }
+
+    /**
+     * @fn void TouchLatency::resetStats();
+     *
+     * @brief Resets the latencies of all gestures.
+     */
+    void resetStats();
+
+    /**
+     * @fn static void TouchLatency::sampledFromController(uint32_t irqCycles, uint32_t readCycles, int16_t row, bool touched);
+     *
+     * @brief Calls sampled() on the instance of the HAL, if any.
+     */
+    static void sampledFromController(uint32_t irqCycles, uint32_t readCycles, int16_t row, bool touched)
+    {
+        if (instance != 0)
+        {
+            instance->sampled(irqCycles, readCycles, row, touched);
+        }
+    }
+
+    /**
+     * @fn static void TouchLatency::vSyncFromISR();
+     *
+     * @brief Calls vSync() on the instance of the HAL, if any.
+     */
+    static void vSyncFromISR()
+    {
+        if (instance != 0)
+        {
+            instance->vSync();
+        }
+    }
+
+    /**
+     * @fn static uint32_t TouchLatency::getDisplayLatencyUs();
+     *
+     * @brief Gets the average time from sampleTouch() to the scanout of the touched row.
+     *
+     *        The render, swap and scanout stages of the latest samples, averaged with a
+     *        weight of 1/8 for the latest. Not cleared by resetStats().
+     *
+     * @return The time in microseconds, 0 until a sample has been measured.
+     */
+    static uint32_t getDisplayLatencyUs()
+    {
+        return instance != 0 ? instance->displayLatencyUs : 0;
+    }
+
+    /**
+     * @fn void TouchLatency::registerInstance();
+     *
+     * @brief Makes this the instance that the touch controller and the LTDC interrupt report to.
+     */
+    void registerInstance()
+    {
+        instance = this;
+    }
+
+    /**
+     * @fn static uint32_t TouchLatency::now();
+     *
+     * @brief Gets the DWT cycle counter, the time base of all stamps.
+     */
+    static uint32_t now();
+
+private:
+    /** Progress of a followed sample. */
+    enum State
+    {
+        STATE_FREE,
+        STATE_SAMPLED,  ///< Waiting for a frame that draws
+        STATE_RENDERED, ///< Waiting for the swap
+        STATE_QUEUED,   ///< Swapped, waiting for the vertical blanking
+        STATE_SCANNED   ///< Scanout stamped, to be accounted by the task
+    };
+
+    struct Record
+    {
+        uint32_t stamps[NUMBER_OF_STAGES + 1]; ///< EXTI, then the end of every stage
+        uint32_t gesture;
+        int16_t row;
+        uint8_t idleFrames;
+        volatile uint8_t state;
+    };
+
+    void account(const Record& record);
+    void drop(Record& record);
+    void startGesture();
+    void print(const char* name, const Distribution& distribution) const;
+    static void clear(Distribution& distribution);
+    static void add(Distribution& distribution, const uint32_t* stageUs, uint32_t latencyUs);
+    static uint32_t percentileUs(const Distribution& distribution, uint32_t pct);
+    uint32_t cyclesToUs(uint32_t cycles) const;
+
+    Record records[TOUCH_LATENCY_RECORDS];
+    uint32_t head;              ///< Next record allocated, by the task
+    uint32_t tail;              ///< Oldest record in flight, by the task
+    volatile uint32_t vsyncCycles;
+    volatile uint32_t lineCycles; ///< Measured time of one display line
+    uint32_t displayLatencyUs;    ///< Average of the render, swap and scanout stages
+    uint32_t gestureNumber;
+    bool inGesture;
+    bool gestureEnded;          ///< The gesture is to be reported once its samples are accounted
+    Distribution gesture;
+    Distribution total;
+
+    static TouchLatency* instance;
+};
+} // namespace touchgfx
+
+/* USER CODE END TouchLatency.hpp */
+
+#endif // TOUCHLATENCY_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,169 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : TouchPredictor.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include <TouchPredictor.hpp>
+
+/* USER CODE BEGIN TouchPredictor.cpp */
+#include <touchgfx/hal/HAL.hpp>
+#include <TouchLatency.hpp>
+#include <math.h>
+
+#include "stm32h7rsxx.h"
+
+namespace
+{
+// Two samples follow the jitter of the panel, three start to average it
+const uint8_t MIN_SAMPLES = 3;
+
+float cyclesToUs(uint32_t cycles)
+{
+    return (float)cycles * (1000000.0f / (float)SystemCoreClock);
+}
+
+int32_t clamp(int32_t value, int32_t low, int32_t high)
+{
+    return value < low ? low : (value > high ? high : value);
+}
+}
+
+namespace touchgfx
+{
+bool TouchPredictor::enabled = true;
+volatile bool TouchPredictor::gestureDisabled = false;
+
+TouchPredictor::TouchPredictor()
+    : count(0), next(0)
+{
+}
+
+void TouchPredictor::reset()
+{
+    count = 0;
+    next = 0;
+    gestureDisabled = false;
+}
+
+void TouchPredictor::addSample(uint32_t cycles, int16_t x, int16_t y)
+{
+    Point& sample = samples[next];
+    sample.cycles = cycles;
+    sample.x = x;
+    sample.y = y;
+    next = (next + 1) % TOUCH_PREDICTION_SAMPLES;
+    if (count < TOUCH_PREDICTION_SAMPLES)
+    {
+        count++;
+    }
+}
+
+bool TouchPredictor::predict(uint32_t cycles, int32_t& x, int32_t& y) const
+{
+    if (!isEnabled() || gestureDisabled || count < MIN_SAMPLES)
+    {
+        return false;
+    }
+
+    const Point& latest = samples[(next + TOUCH_PREDICTION_SAMPLES - 1) % TOUCH_PREDICTION_SAMPLES];
+    const float windowUs = TOUCH_PREDICTION_WINDOW_MS * 1000.0f;
+    const float latestAgeUs = cyclesToUs(cycles - latest.cycles);
+    if (latestAgeUs > windowUs)
+    {
+        // The finger stopped
+        return false;
+    }
+
+    // Least squares fit of x(t) and y(t), t in microseconds before the latest sample
+    float t[TOUCH_PREDICTION_SAMPLES];
+    uint8_t used = 0;
+    float tMean = 0.0f;
+    float xMean = 0.0f;
+    float yMean = 0.0f;
+    for (uint8_t i = 0; i < count; i++)
+    {
+        const float age = cyclesToUs(latest.cycles - samples[i].cycles);
+        t[i] = -age;
+        if (age <= windowUs)
+        {
+            tMean += t[i];
+            xMean += samples[i].x;
+            yMean += samples[i].y;
+            used++;
+        }
+    }
+    if (used < MIN_SAMPLES)
+    {
+        return false;
+    }
+    tMean /= used;
+    xMean /= used;
+    yMean /= used;
+
+    float tt = 0.0f;
+    float tx = 0.0f;
+    float ty = 0.0f;
+    for (uint8_t i = 0; i < count; i++)
+    {
+        if (-t[i] <= windowUs)
+        {
+            const float dt = t[i] - tMean;
+            tt += dt * dt;
+            tx += dt * (samples[i].x - xMean);
+            ty += dt * (samples[i].y - yMean);
+        }
+    }
+    if (tt <= 0.0f)
+    {
+        return false;
+    }
+
+    uint32_t leadUs = TouchLatency::getDisplayLatencyUs();
+    if (leadUs == 0)
+    {
+        leadUs = TOUCH_PREDICTION_DEFAULT_LEAD_US;
+    }
+    if (leadUs > TOUCH_PREDICTION_MAX_LEAD_US)
+    {
+        leadUs = TOUCH_PREDICTION_MAX_LEAD_US;
+    }
+    const float target = latestAgeUs + (float)leadUs - tMean;
+    float dx = xMean + (tx / tt) * target - x;
+    float dy = yMean + (ty / tt) * target - y;
+
+    // Bound the overshoot, keeping the direction
+    const float maxMove = (float)TOUCH_PREDICTION_MAX_PIXELS;
+    const float move2 = dx * dx + dy * dy;
+    if (move2 > maxMove * maxMove)
+    {
+        const float scale = maxMove / sqrtf(move2);
+        dx *= scale;
+        dy *= scale;
+    }
+    if (dx > -0.5f && dx < 0.5f && dy > -0.5f && dy < 0.5f)
+    {
+        return false;
+    }
+
+    x = clamp(x + (int32_t)(dx + (dx < 0.0f ? -0.5f : 0.5f)), 0, HAL::FRAME_BUFFER_WIDTH - 1);
+    y = clamp(y + (int32_t)(dy + (dy < 0.0f ? -0.5f : 0.5f)), 0, HAL::FRAME_BUFFER_HEIGHT - 1);
+    return true;
+}
+} // namespace touchgfx
+
+/* USER CODE END TouchPredictor.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
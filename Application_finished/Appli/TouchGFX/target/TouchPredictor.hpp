@@ -0,0 +1,177 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : TouchPredictor.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef TOUCHPREDICTOR_HPP
+#define TOUCHPREDICTOR_HPP
+
+#include <stdint.h>
+
+/* USER CODE BEGIN TouchPredictor.hpp */
+
+/**
+ * Set to 0 to not extrapolate dragged touches. TouchPredictor::setEnabled() also selects it
+ * at runtime.
+ */
+#ifndef TOUCH_PREDICTION
+#define TOUCH_PREDICTION 1
+#endif
+
+/**
+ * Number of the latest samples of a drag that its velocity is fitted to.
+ */
+#ifndef TOUCH_PREDICTION_SAMPLES
+#define TOUCH_PREDICTION_SAMPLES 4
+#endif
+
+/**
+ * Age in milliseconds of the oldest sample fitted. A finger that stopped for that long is
+ * not extrapolated.
+ */
+#ifndef TOUCH_PREDICTION_WINDOW_MS
+#define TOUCH_PREDICTION_WINDOW_MS 50
+#endif
+
+/**
+ * Time in microseconds from sampleTouch() to the scanout used until TouchLatency has
+ * measured it, and the longest time extrapolated.
+ */
+#ifndef TOUCH_PREDICTION_DEFAULT_LEAD_US
+#define TOUCH_PREDICTION_DEFAULT_LEAD_US 20000
+#endif
+#ifndef TOUCH_PREDICTION_MAX_LEAD_US
+#define TOUCH_PREDICTION_MAX_LEAD_US 40000
+#endif
+
+/**
+ * Farthest a position is moved by the prediction, in pixels, to bound the overshoot when
+ * the finger stops or turns.
+ */
+#ifndef TOUCH_PREDICTION_MAX_PIXELS
+#define TOUCH_PREDICTION_MAX_PIXELS 48
+#endif
+
+namespace touchgfx
+{
+/**
+ * @class TouchPredictor
+ *
+ * @brief Extrapolates a dragged touch to the time its frame is scanned out.
+ *
+ *        Touch is sampled once per tick, and the frame drawn from it reaches the panel one
+ *        or two refreshes later, so dragged content trails the finger. The predictor fits a
+ *        straight line, by least squares, to the latest samples of the drag, timed at the
+ *        end of their I2C read, and reports the point of that line at the expected scanout:
+ *        the time of sampleTouch() plus the render, swap and scanout time measured by
+ *        TouchLatency. The press and the release are reported where they were touched.
+ *
+ *        A widget that needs the exact finger position disables the prediction for the
+ *        gestures that start on it, see UnpredictedDrag.
+ */
+class TouchPredictor
+{
+public:
+    TouchPredictor();
+
+    /**
+     * @fn void TouchPredictor::reset();
+     *
+     * @brief Forgets the samples. Called at every press and release.
+     */
+    void reset();
+
+    /**
+     * @fn void TouchPredictor::addSample(uint32_t cycles, int16_t x, int16_t y);
+     *
+     * @brief Adds a sample of the drag.
+     *
+     * @param cycles Cycle counter when the sample was read.
+     * @param x      The x position touched.
+     * @param y      The y position touched.
+     */
+    void addSample(uint32_t cycles, int16_t x, int16_t y);
+
+    /**
+     * @fn bool TouchPredictor::predict(uint32_t cycles, int32_t& x, int32_t& y) const;
+     *
+     * @brief Extrapolates the drag to its expected scanout.
+     *
+     * @param          cycles Cycle counter now, in sampleTouch().
+     * @param [in,out] x      The latest x position, replaced by the predicted one.
+     * @param [in,out] y      The latest y position, replaced by the predicted one.
+     *
+     * @return false if the position was left as is: prediction disabled, too few recent
+     *         samples or a finger not moving.
+     */
+    bool predict(uint32_t cycles, int32_t& x, int32_t& y) const;
+
+    /**
+     * @fn static void TouchPredictor::setEnabled(bool enable);
+     *
+     * @brief Enables or disables the prediction. Has no effect if TOUCH_PREDICTION is 0.
+     *
+     * @param enable true to extrapolate dragged touches.
+     */
+    static void setEnabled(bool enable)
+    {
+        enabled = enable;
+    }
+
+    /**
+     * @fn static bool TouchPredictor::isEnabled();
+     *
+     * @brief Tells if dragged touches are extrapolated.
+     *
+     * @return true if the prediction is enabled.
+     */
+    static bool isEnabled()
+    {
+        return TOUCH_PREDICTION && enabled;
+    }
+
+    /**
+     * @fn static void TouchPredictor::disableForGesture();
+     *
+     * @brief Reports the touch as sampled until the finger is lifted. Called by a widget
+     *        as it is pressed.
+     */
+    static void disableForGesture()
+    {
+        gestureDisabled = true;
+    }
+
+private:
+    struct Point
+    {
+        uint32_t cycles;
+        int16_t x;
+        int16_t y;
+    };
+
+    Point samples[TOUCH_PREDICTION_SAMPLES];
+    uint8_t count;  ///< Samples kept, up to TOUCH_PREDICTION_SAMPLES
+    uint8_t next;   ///< Index of the next sample written
+
+    static bool enabled;
+    static volatile bool gestureDisabled;
+};
+} // namespace touchgfx
+
+/* USER CODE END TouchPredictor.hpp */
+
+#endif // TOUCHPREDICTOR_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
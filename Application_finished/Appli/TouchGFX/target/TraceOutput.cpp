@@ -0,0 +1,81 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : TraceOutput.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include <TraceOutput.hpp>
+
+/* USER CODE BEGIN TraceOutput.cpp */
+#include <stdarg.h>
+#include <stdio.h>
+
+#include "stm32h7rsxx.h"
+
+namespace touchgfx
+{
+void tracePrintf(const char* format, ...)
+{
+    char line[TRACE_OUTPUT_LINE_SIZE];
+
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(line, sizeof(line), format, args);
+    va_end(args);
+
+    if (length < 0)
+    {
+        return;
+    }
+    if (length >= (int)sizeof(line))
+    {
+        length = sizeof(line) - 1;
+    }
+
+    for (int i = 0; i < length; i++)
+    {
+        ITM_SendChar(line[i]);
+    }
+    ITM_SendChar('\n');
+}
+
+void traceWord(uint8_t port, uint32_t word)
+{
+    if (!isTracePortEnabled(port))
+    {
+        return;
+    }
+    while (ITM->PORT[port].u32 == 0UL)
+    {
+        __NOP();
+    }
+    ITM->PORT[port].u32 = word;
+}
+
+bool isTracePortEnabled(uint8_t port)
+{
+    return (ITM->TCR & ITM_TCR_ITMENA_Msk) != 0UL && (ITM->TER & (1UL << port)) != 0UL;
+}
+
+uint32_t cyclesToUs(uint32_t cycles)
+{
+    const uint32_t cyclesPerUs = SystemCoreClock / 1000000U;
+    return (cycles + cyclesPerUs / 2) / cyclesPerUs;
+}
+} // namespace touchgfx
+
+/* USER CODE END TraceOutput.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
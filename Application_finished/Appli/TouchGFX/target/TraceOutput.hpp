@@ -0,0 +1,90 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : TraceOutput.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef TRACEOUTPUT_HPP
+#define TRACEOUTPUT_HPP
+
+#include <stdint.h>
+
+/* USER CODE BEGIN TraceOutput.hpp */
+
+/**
+ * Size of the line buffer used when formatting trace output. Longer lines are truncated.
+ */
+#ifndef TRACE_OUTPUT_LINE_SIZE
+#define TRACE_OUTPUT_LINE_SIZE 128
+#endif
+
+namespace touchgfx
+{
+/**
+ * @fn void tracePrintf(const char* format, ...);
+ *
+ * @brief Writes a formatted line to the ITM stimulus port 0 (SWO).
+ *
+ *        Writes a formatted line to the ITM stimulus port 0 (SWO). The output is silently
+ *        dropped when no debugger has enabled the ITM, so calls can be left in release
+ *        builds. Must not be called from interrupt context.
+ *
+ * @param format printf style format string.
+ */
+void tracePrintf(const char* format, ...) __attribute__((format(printf, 1, 2)));
+
+/**
+ * @fn void traceWord(uint8_t port, uint32_t word);
+ *
+ * @brief Writes a 32-bit word to an ITM stimulus port.
+ *
+ *        Writes a word of binary trace data to an ITM stimulus port other than the text
+ *        output on port 0, waiting while the ITM FIFO is full. The word is dropped when
+ *        the debugger has not enabled the port.
+ *
+ * @param port The stimulus port, 1 to 31.
+ * @param word The word.
+ */
+void traceWord(uint8_t port, uint32_t word);
+
+/**
+ * @fn bool isTracePortEnabled(uint8_t port);
+ *
+ * @brief Tells if the debugger has enabled an ITM stimulus port.
+ *
+ * @param port The stimulus port.
+ *
+ * @return true if words written to the port are output over SWO.
+ */
+bool isTracePortEnabled(uint8_t port);
+
+/**
+ * @fn uint32_t cyclesToUs(uint32_t cycles);
+ *
+ * @brief Converts a number of CPU cycles to microseconds.
+ *
+ *        Converts a number of CPU cycles to microseconds, using the current core clock.
+ *
+ * @param cycles Number of CPU cycles, typically measured with the DWT cycle counter.
+ *
+ * @return The duration in microseconds.
+ */
+uint32_t cyclesToUs(uint32_t cycles);
+} // namespace touchgfx
+
+/* USER CODE END TraceOutput.hpp */
+
+#endif // TRACEOUTPUT_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
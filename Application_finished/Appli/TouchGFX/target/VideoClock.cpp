@@ -0,0 +1,85 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : VideoClock.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include <VideoClock.hpp>
+
+/* USER CODE BEGIN VideoClock.cpp */
+#include <string.h>
+
+namespace touchgfx
+{
+VideoClock::Stats VideoClock::stats;
+
+VideoClock::VideoClock()
+    : originFrame(1), elapsedUs(0), intervalUs(0), shownFrame(0)
+{
+}
+
+void VideoClock::start(uint32_t frameNumber, uint32_t frameIntervalUs)
+{
+    originFrame = frameNumber;
+    elapsedUs = 0;
+    intervalUs = frameIntervalUs;
+    shownFrame = 0;
+}
+
+void VideoClock::advance(uint32_t elapsed)
+{
+    elapsedUs += elapsed;
+
+    // The VSYNC that released this tick showed the frame rendered in the previous tick
+    if (shownFrame >= originFrame)
+    {
+        const uint32_t dueUs = (shownFrame - originFrame) * intervalUs;
+        const uint32_t drift = elapsedUs > dueUs ? elapsedUs - dueUs : 0;
+        stats.driftUs = drift;
+        if (drift > stats.maxDriftUs)
+        {
+            stats.maxDriftUs = drift;
+        }
+        if (drift >= intervalUs)
+        {
+            stats.late++;
+        }
+    }
+    shownFrame = 0;
+}
+
+void VideoClock::rewind(uint32_t numberOfFrames)
+{
+    const uint32_t lengthUs = (numberOfFrames + 1 - originFrame) * intervalUs;
+    elapsedUs = elapsedUs > lengthUs ? elapsedUs - lengthUs : 0;
+    originFrame = 1;
+}
+
+void VideoClock::frameShown(uint32_t frameNumber, uint32_t skipped)
+{
+    shownFrame = frameNumber;
+    stats.frames++;
+    stats.skipped += skipped;
+}
+
+void VideoClock::resetStats()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+} // namespace touchgfx
+
+/* USER CODE END VideoClock.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,157 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : VideoClock.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef VIDEOCLOCK_HPP
+#define VIDEOCLOCK_HPP
+
+#include <stdint.h>
+
+/* USER CODE BEGIN VideoClock.hpp */
+
+namespace touchgfx
+{
+/**
+ * @class VideoClock
+ *
+ * @brief The media clock of one video stream, advanced by the time between VSYNCs.
+ *
+ *        The clock runs from the frame shown when playback started or seeked, and is
+ *        advanced every tick by the time between the VSYNCs that released the previous and
+ *        the current tick, see TouchGFXHAL::getTickDeltaUs(). The frame to show is the frame
+ *        due when the frame rendered in the tick reaches the display, one refresh later.
+ *        Ticks that are lost to UI load therefore skip video frames instead of slowing the
+ *        video down.
+ *
+ *        The drift of a frame is the time from when it was due until the VSYNC that showed
+ *        it, measured on the tick after it was rendered. A frame is late when it was shown
+ *        after the next frame was due.
+ */
+class VideoClock
+{
+public:
+    /** Frames shown by all clocks since the last reset. */
+    struct Stats
+    {
+        uint32_t frames;     ///< Frames shown
+        uint32_t skipped;    ///< Frames never decoded as they were already late
+        uint32_t late;       ///< Frames shown after the next frame was due
+        uint32_t driftUs;    ///< Drift of the last frame
+        uint32_t maxDriftUs; ///< Largest drift of a frame
+    };
+
+    VideoClock();
+
+    /**
+     * @fn void VideoClock::start(uint32_t frameNumber, uint32_t frameIntervalUs);
+     *
+     * @brief Restarts the clock from a frame, when playback starts or the video is seeked.
+     *
+     * @param frameNumber     The frame shown.
+     * @param frameIntervalUs The time between two frames of the video.
+     */
+    void start(uint32_t frameNumber, uint32_t frameIntervalUs);
+
+    /**
+     * @fn void VideoClock::advance(uint32_t elapsedUs);
+     *
+     * @brief Advances the clock at the start of a tick, and measures the drift of the frame
+     *        shown in the previous tick.
+     *
+     * @param elapsedUs The time between the VSYNCs that released the previous and this tick.
+     */
+    void advance(uint32_t elapsedUs);
+
+    /**
+     * @fn uint32_t VideoClock::getDueFrame(uint32_t presentationDelayUs) const;
+     *
+     * @brief Gets the frame due when the frame rendered now is shown.
+     *
+     * @param presentationDelayUs The time until the frame rendered now is shown.
+     *
+     * @return The frame number, possibly beyond the last frame of the video.
+     */
+    uint32_t getDueFrame(uint32_t presentationDelayUs) const
+    {
+        return originFrame + (elapsedUs + presentationDelayUs) / intervalUs;
+    }
+
+    /**
+     * @fn void VideoClock::rewind(uint32_t numberOfFrames);
+     *
+     * @brief Continues the clock from the first frame, when a repeating video is past its
+     *        last frame.
+     *
+     * @param numberOfFrames The number of frames of the video.
+     */
+    void rewind(uint32_t numberOfFrames);
+
+    /**
+     * @fn void VideoClock::frameShown(uint32_t frameNumber, uint32_t skipped);
+     *
+     * @brief Records the frame rendered in this tick.
+     *
+     * @param frameNumber The frame.
+     * @param skipped     The frames before it that were not decoded.
+     */
+    void frameShown(uint32_t frameNumber, uint32_t skipped);
+
+    /**
+     * @fn bool VideoClock::isRunning() const;
+     *
+     * @brief Tells whether the clock was started with a known frame interval.
+     *
+     * @return true if the clock decides the frames to show.
+     */
+    bool isRunning() const
+    {
+        return intervalUs != 0;
+    }
+
+    /**
+     * @fn static const Stats& VideoClock::getStats();
+     *
+     * @brief Gets the statistics of all clocks.
+     *
+     * @return The statistics.
+     */
+    static const Stats& getStats()
+    {
+        return stats;
+    }
+
+    /**
+     * @fn static void VideoClock::resetStats();
+     *
+     * @brief Resets the statistics of all clocks.
+     */
+    static void resetStats();
+
+private:
+    uint32_t originFrame; ///< The frame shown at time 0
+    uint32_t elapsedUs;   ///< Time since originFrame was shown
+    uint32_t intervalUs;  ///< Time between two frames, 0 when stopped
+    uint32_t shownFrame;  ///< The frame rendered in the previous tick, or 0
+
+    static Stats stats;
+};
+} // namespace touchgfx
+
+/* USER CODE END VideoClock.hpp */
+
+#endif // VIDEOCLOCK_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
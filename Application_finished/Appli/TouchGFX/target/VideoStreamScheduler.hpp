@@ -0,0 +1,126 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : VideoStreamScheduler.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef VIDEOSTREAMSCHEDULER_HPP
+#define VIDEOSTREAMSCHEDULER_HPP
+
+#include <touchgfx/widgets/VideoWidget.hpp>
+
+/* USER CODE BEGIN VideoStreamScheduler.hpp */
+
+/**
+ * @class VideoStreamScheduler
+ *
+ * @brief The frame rates, priorities and statistics of video streams that share the JPEG
+ *        codec.
+ *
+ *        The streams are addressed by their VideoWidget, as the handles are private to
+ *        the widgets. Implemented by FrameAheadVideoController, whose decoder task gives
+ *        the codec to one stream for one frame at a time.
+ */
+class VideoStreamScheduler
+{
+public:
+    /** Frames of one stream since it was registered or its statistics were reset. */
+    struct Stats
+    {
+        uint32_t decoded;  ///< Frames decoded
+        uint32_t shown;    ///< Frames shown
+        uint32_t dropped;  ///< Decoded frames discarded to catch up with the video
+        uint32_t skipped;  ///< Video frames not decoded to keep the target frame rate
+        uint32_t late;     ///< Frames due before they were decoded
+        uint32_t decodeMs; ///< Codec time spent on the stream
+    };
+
+    virtual ~VideoStreamScheduler()
+    {
+    }
+
+    /**
+     * @fn static VideoStreamScheduler& VideoStreamScheduler::getInstance();
+     *
+     * @brief Gets the scheduler of the video controller.
+     *
+     *        Only available when the video controller decodes frames ahead, see
+     *        VIDEO_FRAME_AHEAD_BUFFERS.
+     *
+     * @return The scheduler.
+     */
+    static VideoStreamScheduler& getInstance();
+
+    /**
+     * @fn virtual void VideoStreamScheduler::setTargetFrameRate(const touchgfx::VideoWidget& widget, uint32_t fps) = 0;
+     *
+     * @brief Limits the frame rate of a stream.
+     *
+     *        A video with a higher frame rate is played at its own speed, showing and
+     *        decoding only the frames of the target rate, which leaves the codec to the
+     *        other streams.
+     *
+     * @param widget The widget of the stream.
+     * @param fps    The highest frame rate, or 0 for the frame rate of the video.
+     */
+    virtual void setTargetFrameRate(const touchgfx::VideoWidget& widget, uint32_t fps) = 0;
+
+    /**
+     * @fn virtual void VideoStreamScheduler::setPriority(const touchgfx::VideoWidget& widget, uint32_t priority) = 0;
+     *
+     * @brief Sets the priority of a stream, 1 by default.
+     *
+     *        The codec decodes for the stream that first runs out of decoded frames. The
+     *        time until then is divided by the priority, so a stream with priority 2 and
+     *        40 ms of frames left is decoded for before a stream with priority 1 and 30 ms.
+     *
+     * @param widget   The widget of the stream.
+     * @param priority The priority, at least 1.
+     */
+    virtual void setPriority(const touchgfx::VideoWidget& widget, uint32_t priority) = 0;
+
+    /**
+     * @fn virtual uint32_t VideoStreamScheduler::getNumberOfStreams() const = 0;
+     *
+     * @brief Gets the number of streams, registered or not.
+     *
+     * @return The number of streams.
+     */
+    virtual uint32_t getNumberOfStreams() const = 0;
+
+    /**
+     * @fn virtual bool VideoStreamScheduler::getStats(uint32_t stream, Stats& stats) const = 0;
+     *
+     * @brief Gets the statistics of a stream.
+     *
+     * @param       stream The stream, below getNumberOfStreams().
+     * @param [out] stats  The statistics.
+     *
+     * @return false if no widget is registered for the stream.
+     */
+    virtual bool getStats(uint32_t stream, Stats& stats) const = 0;
+
+    /**
+     * @fn virtual void VideoStreamScheduler::resetStats() = 0;
+     *
+     * @brief Resets the statistics of all streams.
+     */
+    virtual void resetStats() = 0;
+};
+
+/* USER CODE END VideoStreamScheduler.hpp */
+
+#endif // VIDEOSTREAMSCHEDULER_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,120 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : WidgetProfiler.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include <WidgetProfiler.hpp>
+
+/* USER CODE BEGIN WidgetProfiler.cpp */
+#include <HybridLCDGPU2D.hpp>
+#include <TraceOutput.hpp>
+#include <nema_cmdlist.h>
+
+#include "stm32h7rsxx.h"
+
+namespace touchgfx
+{
+WidgetProfiler* WidgetProfiler::instance = 0;
+
+WidgetProfiler::WidgetProfiler()
+    : lcd(0), frameStart(0), active(false), streaming(false)
+{
+}
+
+void WidgetProfiler::init(HybridLCDGPU2D& hybridLCD)
+{
+    lcd = &hybridLCD;
+    instance = this;
+}
+
+void WidgetProfiler::frameStarted(uint32_t frame)
+{
+    active = TOUCHGFX_WIDGET_PROFILE && isTracePortEnabled(TOUCHGFX_WIDGET_PROFILE_PORT);
+    if (!active)
+    {
+        streaming = false;
+        return;
+    }
+    if (!streaming)
+    {
+        traceWord(TOUCHGFX_WIDGET_PROFILE_PORT, STREAM_BEGIN);
+        traceWord(TOUCHGFX_WIDGET_PROFILE_PORT, SystemCoreClock);
+        streaming = true;
+    }
+    traceWord(TOUCHGFX_WIDGET_PROFILE_PORT, FRAME_BEGIN);
+    traceWord(TOUCHGFX_WIDGET_PROFILE_PORT, frame);
+    frameStart = DWT->CYCCNT;
+}
+
+void WidgetProfiler::frameEnded()
+{
+    if (!active)
+    {
+        return;
+    }
+    const uint32_t cycles = DWT->CYCCNT - frameStart;
+    traceWord(TOUCHGFX_WIDGET_PROFILE_PORT, FRAME_END);
+    traceWord(TOUCHGFX_WIDGET_PROFILE_PORT, cycles);
+    active = false;
+}
+
+uint32_t WidgetProfiler::drawStarted()
+{
+    if (instance == 0 || !instance->active)
+    {
+        return 0;
+    }
+    // The work of the widgets drawn before is not counted
+    instance->complete();
+    return DWT->CYCCNT;
+}
+
+void WidgetProfiler::drawEnded(const void* drawable, uint32_t start)
+{
+    if (instance == 0 || !instance->active)
+    {
+        return;
+    }
+    const uint32_t cpuCycles = DWT->CYCCNT - start;
+    const uint32_t gpuCycles = instance->complete();
+    // The vtable names the class of the widget
+    const uint32_t vtable = *static_cast<const uint32_t*>(drawable);
+    traceWord(TOUCHGFX_WIDGET_PROFILE_PORT, reinterpret_cast<uint32_t>(drawable));
+    traceWord(TOUCHGFX_WIDGET_PROFILE_PORT, vtable);
+    traceWord(TOUCHGFX_WIDGET_PROFILE_PORT, cpuCycles);
+    traceWord(TOUCHGFX_WIDGET_PROFILE_PORT, gpuCycles);
+}
+
+uint32_t WidgetProfiler::complete()
+{
+    const uint32_t start = DWT->CYCCNT;
+    // Glyphs are batched until something else is drawn
+    lcd->flushGlyphs();
+    nema_cmdlist_t* cl = nema_cl_get_bound();
+    if (cl != 0 && cl->offset > 0)
+    {
+        nema_cl_submit(cl);
+        nema_cl_wait(cl);
+        nema_cl_rewind(cl);
+    }
+    lcd->waitForDMA2D();
+    return DWT->CYCCNT - start;
+}
+} // namespace touchgfx
+
+/* USER CODE END WidgetProfiler.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
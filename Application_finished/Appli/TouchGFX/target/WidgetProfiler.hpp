@@ -0,0 +1,142 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : WidgetProfiler.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef WIDGETPROFILER_HPP
+#define WIDGETPROFILER_HPP
+
+#include <stdint.h>
+
+/* USER CODE BEGIN WidgetProfiler.hpp */
+
+/**
+ * Set to 1 to build the widgets wrapped in ProfiledDrawable with the draw timing of
+ * WidgetProfiler. With 0 the wrapper draws as the widget does.
+ */
+#ifndef TOUCHGFX_WIDGET_PROFILE
+#define TOUCHGFX_WIDGET_PROFILE 0
+#endif
+
+/**
+ * ITM stimulus port of the binary trace. Port 0 carries the text of tracePrintf().
+ */
+#ifndef TOUCHGFX_WIDGET_PROFILE_PORT
+#define TOUCHGFX_WIDGET_PROFILE_PORT 1
+#endif
+
+namespace touchgfx
+{
+class HybridLCDGPU2D;
+
+/**
+ * @class WidgetProfiler
+ *
+ * @brief Measures what every profiled widget costs to draw, CPU and GPU2D, and streams it
+ *        over SWO.
+ *
+ *        Widgets wrapped in ProfiledDrawable call drawStarted() and drawEnded() around
+ *        their draw(). The CPU time is the DWT cycles of the draw. The GPU time is the
+ *        cycles spent waiting for GPU2D to execute the command list recorded by the draw,
+ *        and for DMA2D to finish its fills and copies: the command list is submitted and
+ *        waited for before and after every profiled draw, so the GPU only runs the work of
+ *        that widget. This serializes CPU and GPU, so frames take longer than they do
+ *        without profiling, but both times are those of the widget alone.
+ *
+ *        Every draw is written as four words to ITM stimulus port
+ *        TOUCHGFX_WIDGET_PROFILE_PORT: the address of the widget, the address of its
+ *        vtable, the CPU cycles and the GPU cycles. A widget is drawn once per dirty area
+ *        it intersects. Frames are enclosed in FRAME_BEGIN, with the frame number, and
+ *        FRAME_END, with the cycles of the frame. gcc/widgetprofile.py sums the draws of
+ *        each widget per frame and names the widgets and their classes from the linker map
+ *        file.
+ *
+ *        Nothing is measured while the debugger has not enabled the port.
+ */
+class WidgetProfiler
+{
+public:
+    /** Words starting the records that are not draws. Widget addresses are below these. */
+    enum Marker
+    {
+        STREAM_BEGIN = 0xFFFF0000U, ///< Followed by the core clock in Hz
+        FRAME_BEGIN = 0xFFFF0001U,  ///< Followed by the frame number
+        FRAME_END = 0xFFFF0002U     ///< Followed by the cycles of the frame
+    };
+
+    WidgetProfiler();
+
+    /**
+     * @fn void WidgetProfiler::init(HybridLCDGPU2D& lcd);
+     *
+     * @brief Sets the LCD whose glyph batches and DMA2D operations are completed with the
+     *        draws, and makes this the profiler of the ProfiledDrawable widgets.
+     *
+     * @param [in] lcd The LCD of the HAL.
+     */
+    void init(HybridLCDGPU2D& lcd);
+
+    /**
+     * @fn void WidgetProfiler::frameStarted(uint32_t frame);
+     *
+     * @brief Starts measuring the draws of a frame, if the port is enabled.
+     *
+     * @param frame The number of the frame.
+     */
+    void frameStarted(uint32_t frame);
+
+    /**
+     * @fn void WidgetProfiler::frameEnded();
+     *
+     * @brief Ends the frame in the trace.
+     */
+    void frameEnded();
+
+    /**
+     * @fn static uint32_t WidgetProfiler::drawStarted();
+     *
+     * @brief Completes what was recorded before a profiled draw, and starts timing it.
+     *
+     * @return The DWT cycles at the start of the draw.
+     */
+    static uint32_t drawStarted();
+
+    /**
+     * @fn static void WidgetProfiler::drawEnded(const void* drawable, uint32_t start);
+     *
+     * @brief Completes what the draw recorded and writes the draw to the trace.
+     *
+     * @param drawable The widget drawn.
+     * @param start    The value returned by drawStarted().
+     */
+    static void drawEnded(const void* drawable, uint32_t start);
+
+private:
+    uint32_t complete();
+
+    HybridLCDGPU2D* lcd;
+    uint32_t frameStart; ///< DWT cycles at the start of the frame
+    bool active;         ///< Measuring the draws of the current frame
+    bool streaming;      ///< STREAM_BEGIN was written since the port was enabled
+
+    static WidgetProfiler* instance;
+};
+} // namespace touchgfx
+
+/* USER CODE END WidgetProfiler.hpp */
+
+#endif // WIDGETPROFILER_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,64 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : XspiCalibration.cpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include <XspiCalibration.hpp>
+
+/* USER CODE BEGIN XspiCalibration.cpp */
+#include <TraceOutput.hpp>
+
+#include "stm32h7rsxx.h"
+
+namespace touchgfx
+{
+void XspiCalibration::report()
+{
+    static const char* const names[MEMORIES] = { "flash", "psram" };
+
+    // The PSRAM profile the boot loader applied to XSPI1, see psram_profile.h of the boot loader
+    const uint32_t wrap = (XSPI1->DCR2 & XSPI_DCR2_WRAPSIZE) >> XSPI_DCR2_WRAPSIZE_Pos;
+    const uint32_t boundary = (XSPI1->DCR3 & XSPI_DCR3_CSBOUND) >> XSPI_DCR3_CSBOUND_Pos;
+    tracePrintf("xspi: psram wrap=%luB boundary=%luB refresh=%lu clocks",
+                (unsigned long)(wrap != 0 ? 1U << (wrap + 2) : 0U),
+                (unsigned long)(boundary != 0 ? 1U << boundary : 0U),
+                (unsigned long)(XSPI1->DCR4 & XSPI_DCR4_REFRESH));
+
+    // The checksum is checked by the boot loader, which calibrates again when it fails
+    const Record& r = record();
+    if (r.magic != MAGIC)
+    {
+        tracePrintf("xspi: not calibrated by the boot loader");
+        return;
+    }
+
+    for (uint32_t i = 0; i < MEMORIES; i++)
+    {
+        const Memory& m = r.memory[i];
+        tracePrintf("xspi: %-5s clock=%luMHz dhqc=%lu read=%luKB/s write=%luKB/s rejected=%lu",
+                    names[i],
+                    (unsigned long)(m.kernelClockHz / (m.prescaler + 1) / 1000000U),
+                    (unsigned long)m.delayHold,
+                    (unsigned long)m.readKBps,
+                    (unsigned long)m.writeKBps,
+                    (unsigned long)m.rejected);
+    }
+}
+} // namespace touchgfx
+
+/* USER CODE END XspiCalibration.cpp */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,88 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : XspiCalibration.hpp
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef XSPICALIBRATION_HPP
+#define XSPICALIBRATION_HPP
+
+#include <stdint.h>
+
+/* USER CODE BEGIN XspiCalibration.hpp */
+
+namespace touchgfx
+{
+/**
+ * @class XspiCalibration
+ *
+ * @brief The XSPI settings the boot loader calibrated for the external memories.
+ *
+ *        The boot loader tries the clock prescalers and the quarter cycle hold of the
+ *        XSPI links, keeps the fastest setting which passes its patterns, and stores it
+ *        with the throughput measured in the last sector of its internal flash, see
+ *        xspi_calibration.h of the boot loader. The layout of the record is shared with
+ *        the boot loader.
+ */
+class XspiCalibration
+{
+public:
+    static const uint32_t MAGIC = 0x4C414358U;   ///< "XCAL"
+    static const uint32_t ADDRESS = 0x0800E000U; ///< Boot storage, calibration record
+    static const uint32_t MEMORIES = 2U;         ///< The NOR flash, then the PSRAM
+
+    /** The settings kept for one memory. */
+    struct Memory
+    {
+        uint32_t kernelClockHz; ///< XSPI kernel clock
+        uint32_t prescaler;     ///< The memory clock is kernelClockHz / (prescaler + 1)
+        uint32_t delayHold;     ///< 1 if the outputs are held a quarter cycle
+        uint32_t readKBps;      ///< Read throughput measured by the boot loader
+        uint32_t writeKBps;     ///< Write throughput measured, 0 if not written
+        uint32_t rejected;      ///< Faster or equal settings which failed
+    };
+
+    /** Calibration record. */
+    struct Record
+    {
+        uint32_t magic; ///< MAGIC while the record is valid
+        Memory memory[MEMORIES];
+        uint32_t checksum;
+    };
+
+    /**
+     * @fn static void XspiCalibration::report();
+     *
+     * @brief Reports the calibrated settings over SWO.
+     *
+     *        Reports the wrap, chip select boundary and refresh of the PSRAM profile
+     *        applied to XSPI1, then the memory clock, the quarter cycle hold and the
+     *        throughput of each memory, as stored by the boot loader. Must not be called
+     *        from interrupt context.
+     */
+    static void report();
+
+private:
+    static const Record& record()
+    {
+        return *reinterpret_cast<const Record*>(ADDRESS);
+    }
+};
+} // namespace touchgfx
+
+/* USER CODE END XspiCalibration.hpp */
+
+#endif // XSPICALIBRATION_HPP
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,899 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : nema_hal_ext.c
+  * @brief             : NemaGFX Interfaces and Platform Specific APIs with FreeRTOS
+  *                      CMSISV2 support, with the application extensions declared
+  *                      in nema_hal_ext.h.
+  *                      Based on the generated nema_hal.c, which is not built.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>&copy; Copyright (c) 2020 STMicroelectronics.
+  * All rights reserved.</center></h2>
+  *
+  * This software component is licensed by ST under BSD 3-Clause license,
+  * the "License"; You may not use this file except in compliance with the
+  * License. You may obtain a copy of the License at:
+  *                        opensource.org/licenses/BSD-3-Clause
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include <touchgfx/hal/Config.hpp>
+#include <nema_sys_defs.h>
+#include <nema_core.h>
+#include <nema_vg.h>
+
+#include <assert.h>
+#include <string.h>
+
+#include <stm32h7rsxx_hal.h>
+
+#include <cmsis_os2.h>
+
+#include "tsi_malloc.h"
+#include "nema_hal_ext.h"
+#include "nema_tlsf.h"
+
+#ifndef RING_SIZE
+#define RING_SIZE                      NEMA_HAL_RING_SIZE /* Ring Buffer Size in byte */
+#endif
+#ifndef NEMAGFX_MEM_POOL_SIZE
+#define NEMAGFX_MEM_POOL_SIZE          16128 /* NemaGFX byte pool size in byte */
+#endif
+#if (NEMA_HAL_STENCIL_TILE_WIDTH > 0) && (NEMA_HAL_STENCIL_TILE_HEIGHT > 0)
+#define NEMA_HAL_STENCIL_TILED         1
+#define NEMA_HAL_STENCIL_TILE_SIZE     (((NEMA_HAL_STENCIL_TILE_WIDTH * NEMA_HAL_STENCIL_TILE_HEIGHT) + 31) & ~31) /* One byte per pixel, whole cache lines */
+#else
+#define NEMA_HAL_STENCIL_TILED         0
+#endif
+#ifndef NEMAGFX_STENCIL_POOL_SIZE
+#if NEMA_HAL_STENCIL_TILED
+#define NEMAGFX_STENCIL_POOL_SIZE      0 /* The stencil is a tile in AXI SRAM */
+#else
+#define NEMAGFX_STENCIL_POOL_SIZE      389120 /* NemaGFX stencil buffer pool size in byte */
+#endif
+#endif
+#ifndef NEMAGFX_FALLBACK_POOL_SIZE
+#define NEMAGFX_FALLBACK_POOL_SIZE     0 /* NemaGFX fallback pool size in byte, 0 to disable */
+#endif
+#ifndef NEMA_HAL_GPU_TIMEOUT_MS
+#define NEMA_HAL_GPU_TIMEOUT_MS        250 /* Longest wait for a GPU2D interrupt before GPU2D is taken as hung, 0 to wait forever */
+#endif
+#ifndef NEMA_HAL_ICACHE_START
+#define NEMA_HAL_ICACHE_START          0x70000000UL /* First address GPU2D reads through its instruction cache, the flash on XSPI2 */
+#endif
+#ifndef NEMA_HAL_ICACHE_END
+#define NEMA_HAL_ICACHE_END            0x7FFFFFFFUL /* Last address GPU2D reads through its instruction cache */
+#endif
+#ifndef NEMA_HAL_TLSF
+#define NEMA_HAL_TLSF                  1 /* Allocate from the pools with nema_tlsf.c, 0 for tsi_malloc */
+#endif
+#ifndef NEMA_HAL_MAX_WAITERS
+#define NEMA_HAL_MAX_WAITERS           4 /* Tasks waiting for GPU2D at the same time */
+#endif
+#define NEMA_HAL_IRQ_FLAG              0x00100000U /* Thread flag set on the waiting tasks by the GPU2D interrupts */
+#ifndef NEMAGFX_ALLOC_TRACK_SIZE
+#define NEMAGFX_ALLOC_TRACK_SIZE       32 /* Number of live allocations tracked for telemetry */
+#endif
+
+LOCATION_PRAGMA_NOLOAD("Nemagfx_Memory_Pool_Buffer")
+static uint8_t nemagfx_pool_mem[NEMAGFX_MEM_POOL_SIZE] LOCATION_ATTRIBUTE_NOLOAD("Nemagfx_Memory_Pool_Buffer"); /* NemaGFX memory pool */
+
+#if (NEMAGFX_STENCIL_POOL_SIZE > 0)
+LOCATION_PRAGMA_NOLOAD("Nemagfx_Stencil_Buffer")
+static uint8_t nemagfx_stencil_buffer_mem[NEMAGFX_STENCIL_POOL_SIZE] LOCATION_ATTRIBUTE_NOLOAD("Nemagfx_Stencil_Buffer"); /* NemaGFX stencil buffer memory */
+#endif
+
+#if NEMA_HAL_STENCIL_TILED
+/* In AXI SRAM with the other zero initialized data, aligned to the cache lines */
+ALIGN_32BYTES(static uint8_t nemagfx_stencil_tile_mem[NEMA_HAL_STENCIL_TILE_SIZE]);
+#endif
+
+#if (NEMAGFX_FALLBACK_POOL_SIZE > 0)
+LOCATION_PRAGMA_NOLOAD("Nemagfx_Stencil_Buffer")
+static uint8_t nemagfx_fallback_pool_mem[NEMAGFX_FALLBACK_POOL_SIZE] LOCATION_ATTRIBUTE_NOLOAD("Nemagfx_Stencil_Buffer"); /* NemaGFX fallback pool memory */
+#endif
+
+typedef struct
+{
+    uint8_t* mem;      /* Backing memory of the pool */
+    uint32_t capacity; /* Size of the backing memory */
+    uint32_t size;     /* Configured size handed to tsi_malloc */
+} nema_pool_t;
+
+static nema_pool_t nema_pools[NEMA_HAL_NUM_POOLS] =
+{
+    { nemagfx_pool_mem, NEMAGFX_MEM_POOL_SIZE, NEMAGFX_MEM_POOL_SIZE },
+#if (NEMAGFX_STENCIL_POOL_SIZE > 0)
+    { nemagfx_stencil_buffer_mem, NEMAGFX_STENCIL_POOL_SIZE, NEMAGFX_STENCIL_POOL_SIZE },
+#else
+    { NULL, 0, 0 },
+#endif
+#if (NEMAGFX_FALLBACK_POOL_SIZE > 0)
+    { nemagfx_fallback_pool_mem, NEMAGFX_FALLBACK_POOL_SIZE, NEMAGFX_FALLBACK_POOL_SIZE },
+#else
+    { NULL, 0, 0 },
+#endif
+};
+
+static nema_hal_pool_stats_t nema_pool_stats[NEMA_HAL_NUM_POOLS];
+
+typedef struct
+{
+    void* ptr;
+    uint32_t size;
+    int pool;
+} nema_alloc_t;
+
+static nema_alloc_t nema_allocs[NEMAGFX_ALLOC_TRACK_SIZE]; /* Live allocations */
+static int nema_pools_initialized = 0;
+
+static nema_ringbuffer_t ring_buffer_str;
+volatile static int last_cl_id = -1;
+volatile static int fence_cl_id = 0; /* Last command list whose completion was deferred */
+static int defer_cl_wait = 0;
+extern GPU2D_HandleTypeDef hgpu2d;
+extern void CortexMMCUInstrumentation_TaskWoken(IRQn_Type irqn, uint32_t waitCycles);
+
+static osThreadId_t volatile nema_waiters[NEMA_HAL_MAX_WAITERS]; // Tasks notified by the GPU2D interrupts
+static volatile uint32_t nema_irq_count = 0; // GPU2D interrupts since startup
+static uint32_t nema_ring_irq_count = 0; // nema_irq_count when the last wait for ring buffer space ended
+static volatile uint32_t nema_wait_cycles = 0; // CPU cycles spent waiting for GPU2D
+static volatile uint32_t nema_ring_stalls = 0; // Waits for ring buffer space
+static nema_hal_submit_hook_t nema_submit_hook = NULL; // Called before ring buffer writes
+static int nema_submitted_cl_id = 0; // Last command list written to the ring buffer
+static volatile int nema_gpu_busy = 0; // GPU2D has submitted work it has not completed
+static volatile uint32_t nema_busy_start = 0; // DWT when GPU2D became busy
+static volatile uint32_t nema_idle_start = 0; // DWT when GPU2D became idle, 0 if not since the reset
+static uint32_t nema_stats_start = 0; // DWT at the last reset of the timing
+static volatile nema_hal_gpu_stats_t nema_gpu_stats;
+static volatile int nema_gpu_fault = 0; // GPU2D reported an unrecoverable error
+static volatile uint32_t nema_gpu_recoveries = 0; // Times GPU2D was reset after a hang or an error
+static volatile nema_hal_icache_stats_t nema_icache_stats;
+static volatile int nema_icache_disabled = 0; // Disabled by NemaVG, which dropped the content of the cache
+static volatile int nema_icache_stale = 0; // Cached memory was written since the last invalidation
+
+static void nema_hal_recover(void);
+
+/* Wakes every task waiting for GPU2D, each with its own thread flag, so no waiter takes the
+   wake-up of another */
+static void nema_notify_waiters(void)
+{
+    nema_irq_count++;
+    for (int i = 0; i < NEMA_HAL_MAX_WAITERS; i++)
+    {
+        const osThreadId_t waiter = nema_waiters[i];
+        if (waiter != NULL)
+        {
+            (void)osThreadFlagsSet(waiter, NEMA_HAL_IRQ_FLAG);
+        }
+    }
+}
+
+#if (USE_HAL_GPU2D_REGISTER_CALLBACKS == 1)
+static void GPU2D_CommandListCpltCallback(GPU2D_HandleTypeDef* hgpu2d, uint32_t CmdListID)
+#else /* USE_HAL_GPU2D_REGISTER_CALLBACKS = 0 */
+void HAL_GPU2D_CommandListCpltCallback(GPU2D_HandleTypeDef* hgpu2d, uint32_t CmdListID)
+#endif /* USE_HAL_GPU2D_REGISTER_CALLBACKS = 1 */
+{
+    /* Prevent unused argument(s) compilation warning */
+    UNUSED(hgpu2d);
+
+    last_cl_id = CmdListID;
+
+    if (nema_gpu_busy && (int)CmdListID >= nema_submitted_cl_id)
+    {
+        /* The last command list submitted has completed */
+        const uint32_t now = DWT->CYCCNT;
+        nema_gpu_stats.busy_cycles += now - nema_busy_start;
+        nema_idle_start = now;
+        nema_gpu_busy = 0;
+    }
+
+    nema_notify_waiters();
+}
+
+void HAL_GPU2D_ErrorCallback(GPU2D_HandleTypeDef *hgpu2d)
+{
+    uint32_t val = nema_reg_read(GPU2D_SYS_INTERRUPT); /* clear the ER interrupt */
+    nema_reg_write(GPU2D_SYS_INTERRUPT, val);
+    if (val & ~0xFU)
+    {
+        /* unrecoverable error, GPU2D is reset by the task waiting for it */
+        nema_gpu_fault = 1;
+        nema_notify_waiters();
+        return;
+    }
+    /* external GPU2D cache maintenance */
+    if (val & (1UL << 2))
+    {
+        /* Disabling the cache starts the invalidation of its content */
+        HAL_ICACHE_Disable();
+        nema_icache_disabled = 1;
+        nema_icache_stale = 0;
+        nema_icache_stats.disable_holds++;
+        nema_ext_hold_deassert_imm(2);
+    }
+    if (val & (1UL << 3))
+    {
+        if (nema_icache_disabled)
+        {
+            /* Nothing was cached since the disable, its invalidation only has to complete */
+            (void)HAL_ICACHE_WaitForInvalidateComplete();
+            HAL_ICACHE_Enable();
+            nema_icache_stats.spared++;
+        }
+        else
+        {
+            HAL_ICACHE_Enable();
+            HAL_ICACHE_Invalidate();
+            nema_icache_stats.invalidations++;
+        }
+        nema_icache_disabled = 0;
+        nema_icache_stale = 0;
+        nema_icache_stats.invalidate_holds++;
+        nema_ext_hold_deassert_imm(3);
+    }
+}
+
+void platform_disable_cache(void)
+{
+    nema_ext_hold_assert(2, 1);
+}
+
+void platform_invalidate_cache(void)
+{
+    nema_ext_hold_assert(3, 1);
+}
+
+int32_t nema_sys_init(void)
+{
+    int error_code = 0;
+
+    /* Setup GPU2D Callback */
+#if (USE_HAL_GPU2D_REGISTER_CALLBACKS == 1)
+    /* Register Command List Comlete Callback */
+    HAL_GPU2D_RegisterCommandListCpltCallback(&hgpu2d, GPU2D_CommandListCpltCallback);
+#endif /* USE_HAL_GPU2D_REGISTER_CALLBACKS = 1 */
+
+    /* Initialise Mem Space */
+    for (int pool = 0; pool < NEMA_HAL_NUM_POOLS; pool++)
+    {
+        if (nema_pools[pool].size == 0U)
+        {
+            continue; /* Pool disabled */
+        }
+#if (NEMA_HAL_TLSF == 1)
+        error_code = nema_tlsf_init(pool, nema_pools[pool].mem, nema_pools[pool].size);
+#else
+        error_code = tsi_malloc_init_pool_aligned(pool, (void*)nema_pools[pool].mem, (uintptr_t)nema_pools[pool].mem, nema_pools[pool].size, 1, 8);
+#endif
+        assert(error_code == 0);
+        memset(&nema_pool_stats[pool], 0, sizeof(nema_pool_stats[pool]));
+        nema_pool_stats[pool].size = nema_pools[pool].size;
+    }
+    memset(nema_allocs, 0, sizeof(nema_allocs));
+    nema_pools_initialized = 1;
+
+    /* Allocate ring_buffer memory */
+    ring_buffer_str.bo = nema_buffer_create(RING_SIZE);
+    assert(ring_buffer_str.bo.base_virt);
+
+    /* Initialize Ring Buffer */
+    error_code = nema_rb_init(&ring_buffer_str, 1);
+    if (error_code < 0)
+    {
+        return error_code;
+    }
+
+    /* Reset last_cl_id counter */
+    last_cl_id = 0;
+    fence_cl_id = 0;
+
+    /* Count the hits and misses of the GPU2D instruction cache */
+    (void)HAL_ICACHE_Monitor_Start(ICACHE_MONITOR_HIT_MISS);
+
+    return error_code;
+}
+
+uint32_t nema_reg_read(uint32_t reg)
+{
+    return HAL_GPU2D_ReadRegister(&hgpu2d, reg);
+}
+
+void nema_reg_write(uint32_t reg, uint32_t value)
+{
+    HAL_GPU2D_WriteRegister(&hgpu2d, reg, value);
+}
+
+static int nema_cl_done(int cl_id)
+{
+    return last_cl_id >= cl_id;
+}
+
+static int nema_fence_done(int unused)
+{
+    return last_cl_id >= fence_cl_id;
+}
+
+static int nema_brk_done(int unused)
+{
+    return nema_reg_read(GPU2D_BREAKPOINT) != 0U;
+}
+
+static int nema_irq_done(int count)
+{
+    return nema_irq_count != (uint32_t)count;
+}
+
+/* Waits until done(arg) holds, checking it after each GPU2D interrupt. The task is
+   registered as a waiter before the first check, so an interrupt in between wakes it.
+   Returns 0 once done(arg) holds, -1 if no interrupt came within NEMA_HAL_GPU_TIMEOUT_MS or
+   GPU2D reported an error, and 1 when called from an interrupt, which cannot wait. */
+static int nema_wait_until(int (*done)(int), int arg)
+{
+    const uint32_t start = DWT->CYCCNT;
+    int slot = -1;
+    int woken = 0;
+    int status = 0;
+
+    if (done(arg))
+    {
+        return 0;
+    }
+    if (__get_IPSR() != 0U)
+    {
+        return 1;
+    }
+
+    __disable_irq();
+    for (int i = 0; i < NEMA_HAL_MAX_WAITERS && slot < 0; i++)
+    {
+        if (nema_waiters[i] == NULL)
+        {
+            nema_waiters[i] = osThreadGetId();
+            slot = i;
+        }
+    }
+    __enable_irq();
+    assert(slot >= 0 && "Increase NEMA_HAL_MAX_WAITERS");
+
+    for (;;)
+    {
+        /* A flag left from an earlier wait is dropped, the state is checked after it */
+        (void)osThreadFlagsClear(NEMA_HAL_IRQ_FLAG);
+        if (nema_gpu_fault)
+        {
+            status = -1;
+            break;
+        }
+        if (done(arg))
+        {
+            break;
+        }
+#if (NEMA_HAL_GPU_TIMEOUT_MS > 0)
+        /* A command list completes within a frame, no interrupt for this long is a hang */
+        if ((int32_t)osThreadFlagsWait(NEMA_HAL_IRQ_FLAG, osFlagsWaitAny, (NEMA_HAL_GPU_TIMEOUT_MS * osKernelGetTickFreq() + 999U) / 1000U) < 0)
+#else
+        if ((int32_t)osThreadFlagsWait(NEMA_HAL_IRQ_FLAG, osFlagsWaitAny, osWaitForever) < 0)
+#endif
+        {
+            status = -1;
+            break;
+        }
+        woken = 1;
+    }
+
+    if (slot >= 0)
+    {
+        nema_waiters[slot] = NULL;
+    }
+    nema_wait_cycles += DWT->CYCCNT - start;
+    if (woken)
+    {
+        CortexMMCUInstrumentation_TaskWoken(GPU2D_IRQn, start);
+    }
+    return status;
+}
+
+int nema_wait_irq(void)
+{
+    /* NemaGFX only waits outside of the command list waits below when the ring buffer is
+       full, in the middle of a submission. GPU2D is not recovered here, as that would reset
+       the ring buffer under it: NemaGFX waits again, and a hang is recovered by the next
+       wait for a command list. An interrupt since the last wait may have made room. */
+    nema_ring_stalls++;
+    const int status = nema_wait_until(nema_irq_done, (int)nema_ring_irq_count);
+    nema_ring_irq_count = nema_irq_count;
+    return (status == 0) ? 0 : -1;
+}
+
+/* Waits for a command list, the fence or a breakpoint, recovering GPU2D if it hung */
+static void nema_wait_cl_until(int (*done)(int), int arg)
+{
+    if (nema_wait_until(done, arg) < 0)
+    {
+        /* The work submitted is lost, the waits for it return and the ring buffer is empty */
+        nema_hal_recover();
+    }
+}
+
+static void nema_hal_recover(void)
+{
+    /* Reset GPU2D and program it again, the ring buffer and the pools are kept */
+    HAL_NVIC_DisableIRQ(GPU2D_IRQn);
+    HAL_NVIC_DisableIRQ(GPU2D_ER_IRQn);
+    __HAL_RCC_GPU2D_FORCE_RESET();
+    __HAL_RCC_GPU2D_RELEASE_RESET();
+    (void)nema_rb_init(&ring_buffer_str, 1);
+    (void)nema_reinit();
+    nema_vg_reinit();
+
+    /* Everything submitted counts as completed */
+    __disable_irq();
+    last_cl_id = nema_submitted_cl_id;
+    fence_cl_id = nema_submitted_cl_id;
+    if (nema_gpu_busy)
+    {
+        nema_gpu_stats.busy_cycles += DWT->CYCCNT - nema_busy_start;
+        nema_gpu_busy = 0;
+    }
+    nema_idle_start = DWT->CYCCNT;
+    nema_gpu_fault = 0;
+    nema_gpu_recoveries++;
+    __enable_irq();
+
+    HAL_NVIC_ClearPendingIRQ(GPU2D_IRQn);
+    HAL_NVIC_ClearPendingIRQ(GPU2D_ER_IRQn);
+    HAL_NVIC_EnableIRQ(GPU2D_IRQn);
+    HAL_NVIC_EnableIRQ(GPU2D_ER_IRQn);
+}
+
+uint32_t nema_hal_get_recoveries(void)
+{
+    return nema_gpu_recoveries;
+}
+
+uint32_t nema_hal_get_wait_cycles(void)
+{
+    return nema_wait_cycles;
+}
+
+void nema_hal_reset_wait_cycles(void)
+{
+    nema_wait_cycles = 0;
+}
+
+uint32_t nema_hal_get_ring_stalls(void)
+{
+    return nema_ring_stalls;
+}
+
+void nema_hal_reset_ring_stalls(void)
+{
+    nema_ring_stalls = 0;
+}
+
+void nema_hal_icache_written(const void* addr, uint32_t size)
+{
+    const uintptr_t first = (uintptr_t)addr;
+
+    if (size == 0U || first > NEMA_HAL_ICACHE_END || first + (size - 1U) < NEMA_HAL_ICACHE_START)
+    {
+        /* GPU2D does not read the range through the cache */
+        nema_icache_stats.uncached_writes++;
+        return;
+    }
+    nema_icache_stats.cached_writes++;
+    nema_icache_stale = 1;
+}
+
+void nema_hal_get_icache_stats(nema_hal_icache_stats_t* stats)
+{
+    __disable_irq();
+    *stats = nema_icache_stats;
+    __enable_irq();
+    stats->hits = HAL_ICACHE_Monitor_GetHitValue();
+    stats->misses = HAL_ICACHE_Monitor_GetMissValue();
+}
+
+void nema_hal_reset_icache_stats(void)
+{
+    __disable_irq();
+    memset((void*)&nema_icache_stats, 0, sizeof(nema_icache_stats));
+    __enable_irq();
+    (void)HAL_ICACHE_Monitor_Reset(ICACHE_MONITOR_HIT_MISS);
+}
+
+void nema_hal_get_gpu_stats(nema_hal_gpu_stats_t* stats)
+{
+    __disable_irq();
+    const uint32_t now = DWT->CYCCNT;
+    stats->elapsed_cycles = now - nema_stats_start;
+    stats->busy_cycles = nema_gpu_stats.busy_cycles + (nema_gpu_busy ? now - nema_busy_start : 0U);
+    stats->command_lists = nema_gpu_stats.command_lists;
+    stats->idle_gaps = nema_gpu_stats.idle_gaps;
+    stats->longest_gap_cycles = nema_gpu_stats.longest_gap_cycles;
+    __enable_irq();
+}
+
+void nema_hal_reset_gpu_stats(void)
+{
+    __disable_irq();
+    const uint32_t now = DWT->CYCCNT;
+    memset((void*)&nema_gpu_stats, 0, sizeof(nema_gpu_stats));
+    nema_stats_start = now;
+    if (nema_gpu_busy)
+    {
+        nema_busy_start = now;
+    }
+    else
+    {
+        nema_idle_start = now;
+    }
+    __enable_irq();
+}
+
+void nema_hal_set_submit_hook(nema_hal_submit_hook_t hook)
+{
+    nema_submit_hook = hook;
+}
+
+int nema_wait_irq_cl(int cl_id)
+{
+    if (defer_cl_wait)
+    {
+        /* Record the command list as the fence and let the GPU2D run in the background */
+        if (cl_id > fence_cl_id)
+        {
+            fence_cl_id = cl_id;
+        }
+        return 0;
+    }
+
+    nema_wait_cl_until(nema_cl_done, cl_id);
+
+    return 0;
+}
+
+void nema_hal_defer_cl_wait(int defer)
+{
+    defer_cl_wait = defer;
+}
+
+int nema_hal_fence_signaled(void)
+{
+    return last_cl_id >= fence_cl_id;
+}
+
+void nema_hal_fence_wait(void)
+{
+    nema_wait_cl_until(nema_fence_done, 0);
+}
+
+int nema_wait_irq_brk(int brk_id)
+{
+    nema_wait_cl_until(nema_brk_done, brk_id);
+
+    return 0;
+}
+
+static void nema_track_alloc(void* ptr, uint32_t size, int pool)
+{
+    nema_hal_pool_stats_t* stats = &nema_pool_stats[pool];
+
+    stats->used += size;
+    stats->allocations++;
+    if (stats->used > stats->high_water)
+    {
+        stats->high_water = stats->used;
+    }
+
+    for (int i = 0; i < NEMAGFX_ALLOC_TRACK_SIZE; i++)
+    {
+        if (nema_allocs[i].ptr == NULL)
+        {
+            nema_allocs[i].ptr = ptr;
+            nema_allocs[i].size = size;
+            nema_allocs[i].pool = pool;
+            return;
+        }
+    }
+    stats->untracked++; /* Table full, usage of this block is never released */
+}
+
+static void nema_track_free(void* ptr)
+{
+    for (int i = 0; i < NEMAGFX_ALLOC_TRACK_SIZE; i++)
+    {
+        if (nema_allocs[i].ptr == ptr)
+        {
+            nema_pool_stats[nema_allocs[i].pool].used -= nema_allocs[i].size;
+            nema_allocs[i].ptr = NULL;
+            return;
+        }
+    }
+}
+
+/* Allocate from a pool, recording the longest allocation */
+static void* nema_pool_malloc(int pool, int size)
+{
+    const uint32_t start = DWT->CYCCNT;
+#if (NEMA_HAL_TLSF == 1)
+    void* ptr = nema_tlsf_malloc(pool, (uint32_t)size);
+#else
+    void* ptr = tsi_malloc_pool(pool, size);
+#endif
+    const uint32_t cycles = DWT->CYCCNT - start;
+    if (cycles > nema_pool_stats[pool].alloc_cycles_max)
+    {
+        nema_pool_stats[pool].alloc_cycles_max = cycles;
+    }
+    return ptr;
+}
+
+static void nema_pool_free(void* ptr)
+{
+#if (NEMA_HAL_TLSF == 1)
+    if (nema_tlsf_find_pool(ptr) >= 0)
+    {
+        nema_tlsf_free(ptr);
+        return;
+    }
+#endif
+    tsi_free(ptr);
+}
+
+/* Allocate from the requested pool, then from the fallback pool if that is exhausted */
+static void* nema_pool_alloc(int pool, int size)
+{
+    if (pool < 0 || pool >= NEMA_HAL_NUM_POOLS)
+    {
+        return tsi_malloc_pool(pool, size); /* Pool not managed here */
+    }
+
+    void* ptr = nema_pool_malloc(pool, size);
+    if (ptr != NULL)
+    {
+        nema_track_alloc(ptr, (uint32_t)size, pool);
+        return ptr;
+    }
+
+    nema_pool_stats[pool].failures++;
+    if (pool != NEMA_HAL_FALLBACK_POOL && nema_pools[NEMA_HAL_FALLBACK_POOL].size > 0U)
+    {
+        ptr = nema_pool_malloc(NEMA_HAL_FALLBACK_POOL, size);
+        if (ptr != NULL)
+        {
+            nema_pool_stats[pool].fallbacks++;
+            nema_track_alloc(ptr, (uint32_t)size, NEMA_HAL_FALLBACK_POOL);
+        }
+        else
+        {
+            nema_pool_stats[NEMA_HAL_FALLBACK_POOL].failures++;
+        }
+    }
+    return ptr;
+}
+
+void nema_host_free(void* ptr)
+{
+    nema_track_free(ptr);
+    nema_pool_free(ptr);
+}
+
+void* nema_host_malloc(unsigned size)
+{
+    return nema_pool_alloc(NEMA_HAL_MEM_POOL, size);
+}
+
+nema_buffer_t nema_buffer_create(int size)
+{
+    nema_buffer_t bo;
+    memset(&bo, 0, sizeof(bo));
+    bo.base_virt = nema_pool_alloc(NEMA_HAL_MEM_POOL, size);
+    bo.base_phys = (uint32_t)bo.base_virt;
+    bo.size      = size;
+    assert(bo.base_virt != 0 && "Unable to allocate memory in nema_buffer_create");
+
+    return bo;
+}
+
+nema_buffer_t nema_buffer_create_pool(int pool, int size)
+{
+    nema_buffer_t bo;
+    memset(&bo, 0, sizeof(bo));
+    bo.base_virt = nema_pool_alloc(pool, size);
+    bo.base_phys = (uint32_t)bo.base_virt;
+    bo.size      = size;
+    bo.fd        = 0;
+    assert(bo.base_virt != 0 && "Unable to allocate memory in nema_buffer_create_pool");
+
+    return bo;
+}
+
+int nema_hal_set_pool_size(int pool, uint32_t size)
+{
+    if (nema_pools_initialized || pool < 0 || pool >= NEMA_HAL_NUM_POOLS || size > nema_pools[pool].capacity)
+    {
+        return -1;
+    }
+    nema_pools[pool].size = size;
+
+    return 0;
+}
+
+const void* nema_hal_get_pool_memory(int pool, uint32_t* capacity)
+{
+    if (pool < 0 || pool >= NEMA_HAL_NUM_POOLS)
+    {
+        return NULL;
+    }
+    if (capacity != NULL)
+    {
+        *capacity = nema_pools[pool].capacity;
+    }
+
+    return nema_pools[pool].mem;
+}
+
+void nema_hal_vg_init(int width, int height)
+{
+#if NEMA_HAL_STENCIL_TILED
+    (void)width;
+    (void)height;
+    /* Written by GPU2D only, the lines zeroed at startup must not be evicted over it */
+    SCB_CleanInvalidateDCache_by_Addr((void*)nemagfx_stencil_tile_mem, sizeof(nemagfx_stencil_tile_mem));
+    nema_buffer_t stencil;
+    stencil.size = (int)sizeof(nemagfx_stencil_tile_mem);
+    stencil.fd = 0;
+    stencil.base_virt = nemagfx_stencil_tile_mem;
+    stencil.base_phys = (uintptr_t)nemagfx_stencil_tile_mem;
+    nema_vg_init_stencil_prealloc(NEMA_HAL_STENCIL_TILE_WIDTH, NEMA_HAL_STENCIL_TILE_HEIGHT, stencil);
+#else
+    nema_vg_init_stencil_pool(width, height, NEMA_HAL_STENCIL_POOL);
+#endif
+}
+
+const void* nema_hal_get_stencil_tile(uint32_t* size)
+{
+#if NEMA_HAL_STENCIL_TILED
+    if (size != NULL)
+    {
+        *size = sizeof(nemagfx_stencil_tile_mem);
+    }
+    return nemagfx_stencil_tile_mem;
+#else
+    if (size != NULL)
+    {
+        *size = 0;
+    }
+    return NULL;
+#endif
+}
+
+int nema_hal_get_pool_stats(int pool, nema_hal_pool_stats_t* stats)
+{
+    if (pool < 0 || pool >= NEMA_HAL_NUM_POOLS || stats == NULL)
+    {
+        return -1;
+    }
+    *stats = nema_pool_stats[pool];
+#if (NEMA_HAL_TLSF == 1)
+    nema_tlsf_stats_t fragmentation;
+    if (nema_tlsf_get_stats(pool, &fragmentation) == 0)
+    {
+        stats->free_blocks = fragmentation.free_blocks;
+        stats->largest_free = fragmentation.largest_free;
+    }
+#endif
+
+    return 0;
+}
+
+void nema_hal_reset_pool_high_water(int pool)
+{
+    if (pool >= 0 && pool < NEMA_HAL_NUM_POOLS)
+    {
+        nema_pool_stats[pool].high_water = nema_pool_stats[pool].used;
+        nema_pool_stats[pool].alloc_cycles_max = 0;
+    }
+}
+
+void* nema_buffer_map(nema_buffer_t* bo)
+{
+    return bo->base_virt;
+}
+
+void nema_buffer_unmap(nema_buffer_t* bo)
+{
+    /* Prevent unused argument(s) compilation warning */
+    UNUSED(bo);
+}
+
+void nema_buffer_destroy(nema_buffer_t* bo)
+{
+    if (bo->fd == -1)
+    {
+        return; /* Buffer weren't allocated! */
+    }
+
+    nema_track_free(bo->base_virt);
+    nema_pool_free(bo->base_virt);
+
+    bo->base_virt = (void*)0;
+    bo->base_phys = 0;
+    bo->size      = 0;
+    bo->fd        = -1; /* Buffer not allocated */
+}
+
+uintptr_t nema_buffer_phys(nema_buffer_t* bo)
+{
+    return bo->base_phys;
+}
+
+void nema_buffer_flush(nema_buffer_t* bo)
+{
+    /* Prevent unused argument(s) compilation warning */
+    UNUSED(bo);
+}
+
+int nema_mutex_lock(int mutex_id)
+{
+    int retval = 0;
+
+    /* USER CODE BEGIN nema_mutex_lock */
+    /* The ring buffer is locked whenever GPU2D is given new work */
+    if (mutex_id == MUTEX_RB && nema_submit_hook != NULL)
+    {
+        nema_submit_hook();
+    }
+    /* The cache cannot be invalidated by address, the writes since the last submission
+       share one invalidation. A cache disabled by NemaVG holds nothing to invalidate. */
+    if (mutex_id == MUTEX_RB && nema_icache_stale && !nema_icache_disabled)
+    {
+        nema_icache_stale = 0;
+        (void)HAL_ICACHE_Invalidate();
+        nema_icache_stats.invalidations++;
+    }
+    /* USER CODE END nema_mutex_lock */
+
+    return retval;
+}
+
+int nema_mutex_unlock(int mutex_id)
+{
+    int retval = 0;
+
+    /* USER CODE BEGIN nema_mutex_unlock */
+    /* A command list was submitted if the ring buffer has a new submission id */
+    if (mutex_id == MUTEX_RB && ring_buffer_str.last_submission_id != nema_submitted_cl_id)
+    {
+        __disable_irq();
+        nema_submitted_cl_id = ring_buffer_str.last_submission_id;
+        nema_gpu_stats.command_lists++;
+        if (!nema_gpu_busy && last_cl_id < nema_submitted_cl_id)
+        {
+            const uint32_t now = DWT->CYCCNT;
+            if (nema_idle_start != 0U)
+            {
+                const uint32_t gap = now - nema_idle_start;
+                nema_gpu_stats.idle_gaps++;
+                if (gap > nema_gpu_stats.longest_gap_cycles)
+                {
+                    nema_gpu_stats.longest_gap_cycles = gap;
+                }
+            }
+            nema_busy_start = now;
+            nema_gpu_busy = 1;
+        }
+        __enable_irq();
+    }
+    /* USER CODE END nema_mutex_unlock */
+
+    return retval;
+}
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,306 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : nema_hal_ext.h
+  * @brief             : Application extensions to the NemaGFX platform layer
+  *                      implemented in nema_hal_ext.c.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef NEMA_HAL_EXT_H
+#define NEMA_HAL_EXT_H
+
+#include <stdint.h>
+
+/**
+  * Set to 1 to let the TouchGFX task return from endFrame() while the GPU2D is still
+  * executing the frame's command list. Completion is then awaited lazily, through the
+  * fence functions below, at the first point that needs the finished frame: CPU access
+  * to the framebuffer, rebinding of the command list and the framebuffer swap.
+  */
+#ifndef NEMA_HAL_ASYNC_SUBMIT
+#define NEMA_HAL_ASYNC_SUBMIT 0
+#endif
+
+/**
+  * Size in bytes of the GPU2D command list allocated by HALGPU2D. The command list is
+  * submitted to GPU2D whenever it is full, so this is also the flush threshold.
+  * Recommended values are 4-8 KB.
+  */
+#ifndef NEMA_HAL_CL_SIZE
+#define NEMA_HAL_CL_SIZE 8192
+#endif
+
+/**
+  * Size in bytes of the GPU2D ring buffer. Every command list submission and every
+  * register write issued outside a command list takes space in the ring, and the CPU
+  * stalls when it wraps onto commands GPU2D has not consumed yet. By default the ring is
+  * sized relative to the command list size; both are allocated from the RAM_CMD pool,
+  * see NEMAGFX_MEM_POOL_SIZE. Use nema_hal_get_ring_stalls() to tune it.
+  */
+#ifndef NEMA_HAL_RING_SIZE
+#define NEMA_HAL_RING_SIZE (NEMA_HAL_CL_SIZE / 4)
+#endif
+
+/**
+  * Width and height in pixels of the NemaVG stencil buffer. With 0, the default, the
+  * stencil is as large as the framebuffer and allocated from the stencil pool in EXTRAM,
+  * see NEMAGFX_STENCIL_POOL_SIZE. Otherwise the stencil is a tile of this size in AXI
+  * SRAM, the stencil pool is left empty, and TSVG images larger than the tile are drawn
+  * one tile at a time, see HybridLCDGPU2D::beginStencilTile(). Vector widgets must fit
+  * in the tile, see StencilVectorRenderer. Use the extent of the stencil touched,
+  * reported on SWO as "vg stencil", to choose the size.
+  */
+#ifndef NEMA_HAL_STENCIL_TILE_WIDTH
+#define NEMA_HAL_STENCIL_TILE_WIDTH 0
+#endif
+#ifndef NEMA_HAL_STENCIL_TILE_HEIGHT
+#define NEMA_HAL_STENCIL_TILE_HEIGHT 0
+#endif
+
+/** NemaGFX memory pools managed by nema_hal_ext.c */
+#define NEMA_HAL_MEM_POOL       0 /* Command lists and host allocations, RAM_CMD */
+#define NEMA_HAL_STENCIL_POOL   1 /* Vector graphics stencil buffer, EXTRAM */
+#define NEMA_HAL_FALLBACK_POOL  2 /* Used when another pool is exhausted, EXTRAM */
+#define NEMA_HAL_NUM_POOLS      3
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+  * @brief  Function called before work is handed to GPU2D, see nema_hal_set_submit_hook().
+  */
+typedef void (*nema_hal_submit_hook_t)(void);
+
+/**
+  * @brief  Usage statistics for a NemaGFX memory pool.
+  */
+typedef struct
+{
+    uint32_t size;        /*!< Configured size of the pool in bytes                  */
+    uint32_t used;        /*!< Bytes currently allocated                             */
+    uint32_t high_water;  /*!< Largest number of bytes allocated at the same time    */
+    uint32_t allocations; /*!< Number of successful allocations                      */
+    uint32_t failures;    /*!< Number of allocations the pool could not satisfy      */
+    uint32_t fallbacks;   /*!< Failed allocations satisfied by the fallback pool     */
+    uint32_t untracked;   /*!< Allocations that could not be tracked, see
+                               NEMAGFX_ALLOC_TRACK_SIZE. 'used' is an upper bound
+                               when this is not zero                                 */
+    uint32_t alloc_cycles_max; /*!< Longest allocation from the pool in CPU cycles   */
+    uint32_t free_blocks; /*!< Free blocks the free memory is split into, 0 when
+                               NEMA_HAL_TLSF is 0                                    */
+    uint32_t largest_free; /*!< Largest allocation that can succeed, 0 when
+                               NEMA_HAL_TLSF is 0                                    */
+} nema_hal_pool_stats_t;
+
+/**
+  * @brief  GPU2D execution timing, measured from the submission and completion of the
+  *         command lists.
+  */
+typedef struct
+{
+    uint32_t elapsed_cycles;     /*!< CPU cycles since the last reset                     */
+    uint32_t busy_cycles;        /*!< Cycles GPU2D had submitted work left to execute     */
+    uint32_t command_lists;      /*!< Command lists submitted                             */
+    uint32_t idle_gaps;          /*!< Times GPU2D ran out of work and was given more      */
+    uint32_t longest_gap_cycles; /*!< Longest of those idle gaps                          */
+} nema_hal_gpu_stats_t;
+
+/**
+  * @brief  Maintenance of the GPU2D instruction cache, which GPU2D reads the memory
+  *         between NEMA_HAL_ICACHE_START and NEMA_HAL_ICACHE_END through.
+  */
+typedef struct
+{
+    uint32_t disable_holds;    /*!< Times NemaVG had the cache disabled                    */
+    uint32_t invalidate_holds; /*!< Times NemaVG had the cache enabled and invalidated     */
+    uint32_t invalidations;    /*!< Invalidations of the whole cache performed             */
+    uint32_t spared;           /*!< Invalidations not needed, the cache was disabled since */
+    uint32_t cached_writes;    /*!< Writes reported to memory read through the cache       */
+    uint32_t uncached_writes;  /*!< Writes reported to other memory, which cost nothing    */
+    uint32_t hits;             /*!< Reads served by the cache                              */
+    uint32_t misses;           /*!< Reads the cache fetched from memory                    */
+} nema_hal_icache_stats_t;
+
+/**
+  * @brief  Get the number of CPU cycles spent blocked in nema_wait_irq() since the
+  *         last call to nema_hal_reset_wait_cycles(). This is the part of the GPU2D
+  *         execution time that the CPU could not overlap with other work.
+  * @retval Accumulated wait time in CPU cycles.
+  */
+uint32_t nema_hal_get_wait_cycles(void);
+
+/**
+  * @brief  Reset the accumulated GPU2D wait time.
+  * @retval None
+  */
+void nema_hal_reset_wait_cycles(void);
+
+/**
+  * @brief  Enable or disable deferred command list completion. While enabled,
+  *         nema_wait_irq_cl() records the command list as the pending fence and returns
+  *         immediately instead of blocking.
+  * @param  defer 1 to defer waits, 0 to block as usual.
+  * @retval None
+  */
+void nema_hal_defer_cl_wait(int defer);
+
+/**
+  * @brief  Check whether the GPU2D has completed the pending fence.
+  * @retval 1 if all deferred command lists have completed, 0 otherwise.
+  */
+int nema_hal_fence_signaled(void);
+
+/**
+  * @brief  Block until the GPU2D has completed the pending fence. Returns immediately
+  *         when no command list is outstanding. Must not be called from an ISR.
+  * @retval None
+  */
+void nema_hal_fence_wait(void);
+
+/**
+  * @brief  Set a function to call every time command lists or commands are about to be
+  *         written to the ring buffer, i.e. right before GPU2D may start executing them.
+  *         Used to complete work on other bus masters that the commands depend on. The
+  *         hook is called from the task submitting to GPU2D.
+  * @param  hook The function to call, or NULL to remove the hook.
+  * @retval None
+  */
+void nema_hal_set_submit_hook(nema_hal_submit_hook_t hook);
+
+/**
+  * @brief  Get the number of times GPU2D was reset because it reported an unrecoverable
+  *         error or no command list completed within NEMA_HAL_GPU_TIMEOUT_MS. Only a task
+  *         waiting for a command list, the fence or a breakpoint resets GPU2D, never a
+  *         wait for ring buffer space, which NemaGFX retries. The work submitted before
+  *         the reset is lost and the waits for it return.
+  * @retval Number of resets since startup.
+  */
+uint32_t nema_hal_get_recoveries(void);
+
+/**
+  * @brief  Get the number of times the CPU had to wait for ring buffer space since the
+  *         last call to nema_hal_reset_ring_stalls().
+  * @retval Number of ring buffer stalls.
+  */
+uint32_t nema_hal_get_ring_stalls(void);
+
+/**
+  * @brief  Reset the ring buffer stall counter.
+  * @retval None
+  */
+void nema_hal_reset_ring_stalls(void);
+
+/**
+  * @brief  Report that the CPU or a DMA wrote a range GPU2D may read. The instruction
+  *         cache can only be invalidated as a whole, so a range it does not serve costs
+  *         nothing, and all the writes to ranges it serves are followed by one
+  *         invalidation, right before GPU2D is given new work.
+  * @param  addr The first byte written.
+  * @param  size Number of bytes.
+  * @retval None
+  */
+void nema_hal_icache_written(const void* addr, uint32_t size);
+
+/**
+  * @brief  Get the GPU2D instruction cache maintenance and hit rate since the last call
+  *         to nema_hal_reset_icache_stats().
+  * @param  stats Receives the statistics.
+  * @retval None
+  */
+void nema_hal_get_icache_stats(nema_hal_icache_stats_t* stats);
+
+/**
+  * @brief  Reset the GPU2D instruction cache statistics.
+  * @retval None
+  */
+void nema_hal_reset_icache_stats(void);
+
+/**
+  * @brief  Get the GPU2D execution timing since the last call to
+  *         nema_hal_reset_gpu_stats(). GPU2D is busy from the submission of a command
+  *         list while it is idle until the completion interrupt of the last command list
+  *         submitted, so command lists submitted without an interrupt are counted until
+  *         the next interrupt.
+  * @param  stats Receives the timing.
+  * @retval None
+  */
+void nema_hal_get_gpu_stats(nema_hal_gpu_stats_t* stats);
+
+/**
+  * @brief  Restart the GPU2D execution timing.
+  * @retval None
+  */
+void nema_hal_reset_gpu_stats(void);
+
+/**
+  * @brief  Set the number of bytes of a pool's backing memory handed to the allocator.
+  *         Must be called before nema_init(). The size cannot exceed the static
+  *         capacity given by NEMAGFX_MEM_POOL_SIZE, NEMAGFX_STENCIL_POOL_SIZE or
+  *         NEMAGFX_FALLBACK_POOL_SIZE. Setting a size of 0 disables the pool.
+  * @param  pool One of NEMA_HAL_MEM_POOL, NEMA_HAL_STENCIL_POOL or NEMA_HAL_FALLBACK_POOL.
+  * @param  size Size in bytes.
+  * @retval 0 on success, -1 if the pool is invalid, too small or already initialized.
+  */
+int nema_hal_set_pool_size(int pool, uint32_t size);
+
+/**
+  * @brief  Get the backing memory of a pool.
+  * @param  pool     One of NEMA_HAL_MEM_POOL, NEMA_HAL_STENCIL_POOL or NEMA_HAL_FALLBACK_POOL.
+  * @param  capacity Receives the bytes of the memory, its static size, or NULL.
+  * @retval The memory, or NULL if the pool is invalid or has no memory.
+  */
+const void* nema_hal_get_pool_memory(int pool, uint32_t* capacity);
+
+/**
+  * @brief  Get the usage statistics of a pool.
+  * @param  pool  One of NEMA_HAL_MEM_POOL, NEMA_HAL_STENCIL_POOL or NEMA_HAL_FALLBACK_POOL.
+  * @param  stats Receives the statistics.
+  * @retval 0 on success, -1 if the pool is invalid.
+  */
+int nema_hal_get_pool_stats(int pool, nema_hal_pool_stats_t* stats);
+
+/**
+  * @brief  Restart the high-water mark of a pool from its current usage, and its longest
+  *         allocation.
+  * @param  pool One of NEMA_HAL_MEM_POOL, NEMA_HAL_STENCIL_POOL or NEMA_HAL_FALLBACK_POOL.
+  * @retval None
+  */
+void nema_hal_reset_pool_high_water(int pool);
+
+/**
+  * @brief  Initialize NemaVG with its stencil buffer: a tile in AXI SRAM when
+  *         NEMA_HAL_STENCIL_TILE_WIDTH and NEMA_HAL_STENCIL_TILE_HEIGHT are set,
+  *         otherwise a stencil of the framebuffer size from NEMA_HAL_STENCIL_POOL.
+  *         Called after nema_init().
+  * @param  width  Framebuffer width.
+  * @param  height Framebuffer height.
+  * @retval None
+  */
+void nema_hal_vg_init(int width, int height);
+
+/**
+  * @brief  Get the stencil tile in AXI SRAM.
+  * @param  size Receives the bytes of the tile, or NULL.
+  * @retval The tile, or NULL if the stencil is allocated from NEMA_HAL_STENCIL_POOL.
+  */
+const void* nema_hal_get_stencil_tile(uint32_t* size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NEMA_HAL_EXT_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,321 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : nema_tlsf.c
+  * @brief             : Two-level segregated fit allocator for the NemaGFX memory
+  *                      pools of nema_hal_ext.c.
+  *
+  *                      A free block is kept in the list of its size class. The first
+  *                      level of classes are the powers of two, each split into
+  *                      TLSF_SL_COUNT linear classes at the second level; sizes below
+  *                      TLSF_SMALL_SIZE are one first level class of NEMA_TLSF_ALIGN
+  *                      steps. A bitmap per level tells the lists that are not empty,
+  *                      so the smallest class sure to fit a request is found with two
+  *                      bit scans, and freeing merges a block with its neighbours in
+  *                      memory through the header of each block.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include "nema_tlsf.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#include "stm32h7rsxx.h"
+
+#define TLSF_SL_LOG2      4U
+#define TLSF_SL_COUNT     (1U << TLSF_SL_LOG2)
+#define TLSF_FL_SHIFT     (TLSF_SL_LOG2 + 3U) /* log2(TLSF_SL_COUNT * NEMA_TLSF_ALIGN) */
+#define TLSF_SMALL_SIZE   (1U << TLSF_FL_SHIFT)
+#define TLSF_MAX_LOG2     24U /* Blocks below 32 MB */
+#define TLSF_FL_COUNT     (TLSF_MAX_LOG2 - TLSF_FL_SHIFT + 2U)
+
+#define TLSF_BLOCK_FREE       1U /* In the size of a block: the block is free */
+#define TLSF_BLOCK_PREV_FREE  2U /* In the size of a block: the block before it is free */
+#define TLSF_SIZE_MASK        (~(NEMA_TLSF_ALIGN - 1U))
+
+typedef struct tlsf_block
+{
+    struct tlsf_block* prev_phys; /* Block before in memory, valid while that one is free */
+    uint32_t size;                /* Bytes after the header, and the flags above */
+    struct tlsf_block* next_free; /* Links of the free lists, in the bytes of a free block */
+    struct tlsf_block* prev_free;
+} tlsf_block_t;
+
+#define TLSF_HEADER_SIZE  ((uint32_t)offsetof(tlsf_block_t, next_free))
+#define TLSF_MIN_SIZE     ((uint32_t)sizeof(tlsf_block_t) - TLSF_HEADER_SIZE)
+#define TLSF_MAX_SIZE     ((1U << (TLSF_MAX_LOG2 + 1U)) - NEMA_TLSF_ALIGN)
+
+typedef struct
+{
+    uint8_t* start;                                     /* First block, NULL if not initialized */
+    uint8_t* end;                                       /* End of the memory of the pool */
+    uint32_t fl_bitmap;                                 /* First level classes with free blocks */
+    uint32_t sl_bitmap[TLSF_FL_COUNT];                  /* Second level classes with free blocks */
+    tlsf_block_t* heads[TLSF_FL_COUNT][TLSF_SL_COUNT];  /* Free lists */
+    uint32_t used_blocks;
+} tlsf_pool_t;
+
+static tlsf_pool_t tlsf_pools[NEMA_TLSF_POOLS];
+
+static uint32_t tlsf_msb(uint32_t value)
+{
+    return 31U - __CLZ(value);
+}
+
+static uint32_t tlsf_lsb(uint32_t value)
+{
+    return __CLZ(__RBIT(value));
+}
+
+static uint32_t tlsf_block_size(const tlsf_block_t* block)
+{
+    return block->size & TLSF_SIZE_MASK;
+}
+
+static tlsf_block_t* tlsf_next_phys(const tlsf_block_t* block)
+{
+    return (tlsf_block_t*)((uint8_t*)block + TLSF_HEADER_SIZE + tlsf_block_size(block));
+}
+
+/* Class of a free block of the given size */
+static void tlsf_mapping(uint32_t size, uint32_t* fl, uint32_t* sl)
+{
+    if (size < TLSF_SMALL_SIZE)
+    {
+        *fl = 0U;
+        *sl = size / NEMA_TLSF_ALIGN;
+    }
+    else
+    {
+        const uint32_t msb = tlsf_msb(size);
+        *fl = msb - TLSF_FL_SHIFT + 1U;
+        *sl = (size >> (msb - TLSF_SL_LOG2)) ^ TLSF_SL_COUNT;
+    }
+}
+
+/* Smallest class whose every block fits the given size */
+static void tlsf_mapping_search(uint32_t size, uint32_t* fl, uint32_t* sl)
+{
+    if (size >= TLSF_SMALL_SIZE)
+    {
+        size += (1U << (tlsf_msb(size) - TLSF_SL_LOG2)) - 1U;
+    }
+    tlsf_mapping(size, fl, sl);
+}
+
+static void tlsf_insert(tlsf_pool_t* p, tlsf_block_t* block)
+{
+    uint32_t fl;
+    uint32_t sl;
+    tlsf_mapping(tlsf_block_size(block), &fl, &sl);
+
+    block->prev_free = NULL;
+    block->next_free = p->heads[fl][sl];
+    if (block->next_free != NULL)
+    {
+        block->next_free->prev_free = block;
+    }
+    p->heads[fl][sl] = block;
+    p->fl_bitmap |= 1U << fl;
+    p->sl_bitmap[fl] |= 1U << sl;
+}
+
+static void tlsf_remove(tlsf_pool_t* p, tlsf_block_t* block)
+{
+    uint32_t fl;
+    uint32_t sl;
+    tlsf_mapping(tlsf_block_size(block), &fl, &sl);
+
+    if (block->next_free != NULL)
+    {
+        block->next_free->prev_free = block->prev_free;
+    }
+    if (block->prev_free != NULL)
+    {
+        block->prev_free->next_free = block->next_free;
+    }
+    else
+    {
+        p->heads[fl][sl] = block->next_free;
+        if (p->heads[fl][sl] == NULL)
+        {
+            p->sl_bitmap[fl] &= ~(1U << sl);
+            if (p->sl_bitmap[fl] == 0U)
+            {
+                p->fl_bitmap &= ~(1U << fl);
+            }
+        }
+    }
+}
+
+int nema_tlsf_init(int pool, void* mem, uint32_t size)
+{
+    if (pool < 0 || pool >= NEMA_TLSF_POOLS || mem == NULL)
+    {
+        return -1;
+    }
+    tlsf_pool_t* const p = &tlsf_pools[pool];
+    memset(p, 0, sizeof(*p));
+
+    uint8_t* const start = (uint8_t*)(((uintptr_t)mem + NEMA_TLSF_ALIGN - 1U) & ~(uintptr_t)(NEMA_TLSF_ALIGN - 1U));
+    const uint32_t skipped = (uint32_t)(start - (uint8_t*)mem);
+    if (size < skipped + 2U * TLSF_HEADER_SIZE + TLSF_MIN_SIZE)
+    {
+        return -1;
+    }
+    uint32_t payload = ((size - skipped) & TLSF_SIZE_MASK) - 2U * TLSF_HEADER_SIZE;
+    if (payload > TLSF_MAX_SIZE)
+    {
+        payload = TLSF_MAX_SIZE;
+    }
+
+    /* One free block, followed by an empty used block that ends the pool */
+    tlsf_block_t* const block = (tlsf_block_t*)start;
+    block->prev_phys = NULL;
+    block->size = payload | TLSF_BLOCK_FREE;
+    tlsf_block_t* const sentinel = tlsf_next_phys(block);
+    sentinel->prev_phys = block;
+    sentinel->size = TLSF_BLOCK_PREV_FREE;
+
+    p->start = start;
+    p->end = (uint8_t*)sentinel + TLSF_HEADER_SIZE;
+    tlsf_insert(p, block);
+    return 0;
+}
+
+void* nema_tlsf_malloc(int pool, uint32_t size)
+{
+    if (pool < 0 || pool >= NEMA_TLSF_POOLS || tlsf_pools[pool].start == NULL || size > TLSF_MAX_SIZE)
+    {
+        return NULL;
+    }
+    tlsf_pool_t* const p = &tlsf_pools[pool];
+    size = (size < TLSF_MIN_SIZE) ? TLSF_MIN_SIZE : (size + NEMA_TLSF_ALIGN - 1U) & TLSF_SIZE_MASK;
+
+    uint32_t fl;
+    uint32_t sl;
+    tlsf_mapping_search(size, &fl, &sl);
+    if (fl >= TLSF_FL_COUNT)
+    {
+        return NULL;
+    }
+    uint32_t sl_map = p->sl_bitmap[fl] & (~0U << sl);
+    if (sl_map == 0U)
+    {
+        const uint32_t fl_map = (fl + 1U < 32U) ? p->fl_bitmap & (~0U << (fl + 1U)) : 0U;
+        if (fl_map == 0U)
+        {
+            return NULL;
+        }
+        fl = tlsf_lsb(fl_map);
+        sl_map = p->sl_bitmap[fl];
+    }
+    sl = tlsf_lsb(sl_map);
+
+    tlsf_block_t* const block = p->heads[fl][sl];
+    tlsf_remove(p, block);
+
+    const uint32_t remaining = tlsf_block_size(block) - size;
+    if (remaining >= TLSF_HEADER_SIZE + TLSF_MIN_SIZE)
+    {
+        /* Return what is not needed to the free lists */
+        tlsf_block_t* const rest = (tlsf_block_t*)((uint8_t*)block + TLSF_HEADER_SIZE + size);
+        rest->prev_phys = block;
+        rest->size = (remaining - TLSF_HEADER_SIZE) | TLSF_BLOCK_FREE;
+        tlsf_next_phys(rest)->prev_phys = rest;
+        block->size = size | (block->size & TLSF_BLOCK_PREV_FREE);
+        tlsf_insert(p, rest);
+    }
+    else
+    {
+        tlsf_next_phys(block)->size &= ~TLSF_BLOCK_PREV_FREE;
+        block->size &= ~TLSF_BLOCK_FREE;
+    }
+    p->used_blocks++;
+
+    return (uint8_t*)block + TLSF_HEADER_SIZE;
+}
+
+void nema_tlsf_free(void* ptr)
+{
+    const int pool = nema_tlsf_find_pool(ptr);
+    if (pool < 0)
+    {
+        return;
+    }
+    tlsf_pool_t* const p = &tlsf_pools[pool];
+    tlsf_block_t* block = (tlsf_block_t*)((uint8_t*)ptr - TLSF_HEADER_SIZE);
+
+    block->size |= TLSF_BLOCK_FREE;
+    if (block->size & TLSF_BLOCK_PREV_FREE)
+    {
+        tlsf_block_t* const prev = block->prev_phys;
+        tlsf_remove(p, prev);
+        prev->size += TLSF_HEADER_SIZE + tlsf_block_size(block);
+        block = prev;
+    }
+    tlsf_block_t* next = tlsf_next_phys(block);
+    if (next->size & TLSF_BLOCK_FREE)
+    {
+        tlsf_remove(p, next);
+        block->size += TLSF_HEADER_SIZE + tlsf_block_size(next);
+        next = tlsf_next_phys(block);
+    }
+    next->prev_phys = block;
+    next->size |= TLSF_BLOCK_PREV_FREE;
+    tlsf_insert(p, block);
+    p->used_blocks--;
+}
+
+int nema_tlsf_find_pool(const void* ptr)
+{
+    for (int pool = 0; pool < NEMA_TLSF_POOLS; pool++)
+    {
+        const tlsf_pool_t* const p = &tlsf_pools[pool];
+        if ((const uint8_t*)ptr > p->start && (const uint8_t*)ptr < p->end)
+        {
+            return pool;
+        }
+    }
+    return -1;
+}
+
+int nema_tlsf_get_stats(int pool, nema_tlsf_stats_t* stats)
+{
+    if (pool < 0 || pool >= NEMA_TLSF_POOLS || tlsf_pools[pool].start == NULL || stats == NULL)
+    {
+        return -1;
+    }
+    const tlsf_pool_t* const p = &tlsf_pools[pool];
+    memset(stats, 0, sizeof(*stats));
+
+    for (const tlsf_block_t* block = (const tlsf_block_t*)p->start; tlsf_block_size(block) != 0U; block = tlsf_next_phys(block))
+    {
+        if (block->size & TLSF_BLOCK_FREE)
+        {
+            const uint32_t size = tlsf_block_size(block);
+            stats->free_bytes += size;
+            stats->free_blocks++;
+            if (size > stats->largest_free)
+            {
+                stats->largest_free = size;
+            }
+        }
+    }
+    stats->used_blocks = p->used_blocks;
+    return 0;
+}
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,106 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * File Name          : nema_tlsf.h
+  * @brief             : Two-level segregated fit allocator for the NemaGFX memory
+  *                      pools of nema_hal_ext.c.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+#ifndef NEMA_TLSF_H
+#define NEMA_TLSF_H
+
+#include <stdint.h>
+
+/**
+  * Number of pools the allocator can manage, numbered from 0.
+  */
+#ifndef NEMA_TLSF_POOLS
+#define NEMA_TLSF_POOLS 3
+#endif
+
+/**
+  * Alignment of every allocation, in bytes. Each allocation also takes a header of
+  * this size from its pool.
+  */
+#define NEMA_TLSF_ALIGN 8U
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+  * @brief  Fragmentation of a pool.
+  */
+typedef struct
+{
+    uint32_t free_bytes;   /*!< Bytes free for allocations, headers excluded           */
+    uint32_t free_blocks;  /*!< Free blocks the free bytes are split into              */
+    uint32_t largest_free; /*!< Largest allocation that can succeed                    */
+    uint32_t used_blocks;  /*!< Allocations live in the pool                           */
+} nema_tlsf_stats_t;
+
+/**
+  * @brief  Hand memory to a pool, dropping everything allocated from it before. Free
+  *         blocks are kept in lists by size class, two levels of power of two and linear
+  *         subdivisions, with a bitmap of the lists that are not empty. Allocating and
+  *         freeing then take a constant time, whatever the number of blocks, and a block
+  *         is taken from the smallest class that is sure to fit, which keeps the large
+  *         blocks whole.
+  * @param  pool Pool number, below NEMA_TLSF_POOLS.
+  * @param  mem  Memory of the pool.
+  * @param  size Bytes of memory.
+  * @retval 0 on success, -1 if the pool is invalid or the memory too small.
+  */
+int nema_tlsf_init(int pool, void* mem, uint32_t size);
+
+/**
+  * @brief  Allocate from a pool, in constant time.
+  * @param  pool Pool number.
+  * @param  size Bytes to allocate.
+  * @retval Memory aligned on NEMA_TLSF_ALIGN, or NULL if the pool has no block large
+  *         enough or is not initialized.
+  */
+void* nema_tlsf_malloc(int pool, uint32_t size);
+
+/**
+  * @brief  Free an allocation, in constant time, merging it with the free blocks next to
+  *         it.
+  * @param  ptr Memory returned by nema_tlsf_malloc(), or NULL.
+  * @retval None
+  */
+void nema_tlsf_free(void* ptr);
+
+/**
+  * @brief  Find the pool an allocation is from.
+  * @param  ptr Memory.
+  * @retval The pool number, or -1 if no pool holds the memory.
+  */
+int nema_tlsf_find_pool(const void* ptr);
+
+/**
+  * @brief  Get the fragmentation of a pool. Walks every block of the pool, for
+  *         reporting only.
+  * @param  pool  Pool number.
+  * @param  stats Receives the fragmentation.
+  * @retval 0 on success, -1 if the pool is invalid or not initialized.
+  */
+int nema_tlsf_get_stats(int pool, nema_tlsf_stats_t* stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NEMA_TLSF_H */
+
+/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,128 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file           : asset_update.h
+  * @brief          : Header for asset_update.c file.
+  *                   Block delta patches of the images, fonts and texts of the
+  *                   application in the FLASH_GFX region of the NOR flash.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __ASSET_UPDATE_H
+#define __ASSET_UPDATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+/**
+  * @brief  Set to 0 to ignore the patches staged by the application.
+  */
+#ifndef ASSET_UPDATE_ENABLE
+#define ASSET_UPDATE_ENABLE 1
+#endif
+
+#define ASSET_UPDATE_MAGIC           0x54415041U /* "APAT", a patch is staged         */
+#define ASSET_UPDATE_RECORD_MAGIC    0x44505541U /* "AUPD", boot storage record       */
+
+/**
+  * @brief  The application runs from the NOR flash and reads its assets in place, so
+  *         it cannot program it. It stages the patch in the last 2 MB of the PSRAM,
+  *         out of its EXTRAM region, and resets: the PSRAM keeps its content across
+  *         the reset and the boot loader applies the patch before the NOR flash is
+  *         mapped. See Appli/TouchGFX/target/AssetUpdate.hpp.
+  */
+#define ASSET_UPDATE_STAGING_ADDRESS 0x91E00000U
+#define ASSET_UPDATE_STAGING_SIZE    0x00200000U
+
+/**
+  * @brief  A patch carries whole blocks of the smallest erase size of the NOR flash,
+  *         and may only target the FLASH_GFX region of the application linker script.
+  */
+#define ASSET_UPDATE_BLOCK_SIZE      4096U
+#define ASSET_UPDATE_REGION_START    0x70200000U
+#define ASSET_UPDATE_REGION_END      0x78000000U
+
+/**
+  * @brief  State of the last update, in the boot storage record.
+  */
+#define ASSET_UPDATE_STATE_APPLYING    1U /* Started, set again if a reset cuts it      */
+#define ASSET_UPDATE_STATE_DONE        2U /* Every block programmed and read back       */
+#define ASSET_UPDATE_STATE_FAILED      3U /* Erase, program or read back failed         */
+#define ASSET_UPDATE_STATE_REJECTED    4U /* The patch failed its checks, none applied  */
+#define ASSET_UPDATE_STATE_INTERRUPTED 5U /* Power lost while applying, patch lost      */
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief  Header of a patch, at ASSET_UPDATE_STAGING_ADDRESS. The blocks follow, by
+  *         ascending address. gcc/mkassetpatch.py builds the patch from two images.
+  */
+typedef struct
+{
+  uint32_t Magic;           /*!< ASSET_UPDATE_MAGIC while the patch is to be applied     */
+  uint32_t BlockCount;      /*!< Number of blocks following the header                   */
+  uint32_t PayloadChecksum; /*!< CRC-32 of the blocks                                    */
+  uint32_t Checksum;        /*!< CRC-32 of the fields above                              */
+} ASSET_UPDATE_HeaderTypeDef;
+
+/**
+  * @brief  Block of a patch: the new content of the block, whatever the old one.
+  */
+typedef struct
+{
+  uint32_t Address;                       /*!< Mapped address, a multiple of the block size */
+  uint8_t  Data[ASSET_UPDATE_BLOCK_SIZE]; /*!< New content of the block                     */
+} ASSET_UPDATE_BlockTypeDef;
+
+/**
+  * @brief  Outcome of the last patch, at BOOT_STORAGE_ASSET_UPDATE_OFFSET in the boot
+  *         storage. The application reads the same layout.
+  */
+typedef struct
+{
+  uint32_t Magic;           /*!< ASSET_UPDATE_RECORD_MAGIC while the record is valid     */
+  uint32_t State;           /*!< ASSET_UPDATE_STATE_xxx                                  */
+  uint32_t Patch;           /*!< Checksum of the header of the patch                     */
+  uint32_t Blocks;          /*!< Blocks in the patch                                     */
+  uint32_t Unchanged;       /*!< Blocks which already held their new content             */
+  uint32_t Programmed;      /*!< Blocks programmed without erase, they were erased       */
+  uint32_t Erased;          /*!< Blocks erased, then programmed                          */
+  uint32_t EraseBatches;    /*!< Runs of adjacent blocks erased together                 */
+  uint32_t DurationMs;      /*!< Time taken to apply the patch                           */
+  uint32_t Checksum;        /*!< CRC-32 of the fields above                              */
+} ASSET_UPDATE_RecordTypeDef;
+
+/* Exported functions prototypes ---------------------------------------------*/
+/**
+  * @brief  Applies the patch staged in the PSRAM, if any. Blocks already holding their
+  *         new content are skipped and erased blocks are only programmed, so a patch
+  *         cut by a reset is applied again from where it stopped, without wear. The
+  *         blocks left to erase are erased by runs of adjacent blocks, which the memory
+  *         manager turns into the largest aligned erases of the NOR flash. To be called
+  *         once the memories are initialized, before they are mapped for the
+  *         application.
+  * @retval None
+  */
+void ASSET_UPDATE_Run(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ASSET_UPDATE_H */
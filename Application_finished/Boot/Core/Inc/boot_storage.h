@@ -0,0 +1,71 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file           : boot_storage.h
+  * @brief          : Header for boot_storage.c file.
+  *                   Records of the boot loader kept in the last sector of the
+  *                   internal flash across power cycles.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __BOOT_STORAGE_H
+#define __BOOT_STORAGE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+/**
+  * @brief  The last 8 KB sector of the internal flash, out of the FLASH region of the
+  *         linker scripts. The application reads the records at the same addresses.
+  */
+#define BOOT_STORAGE_ADDRESS             0x0800E000U
+#define BOOT_STORAGE_SIZE                0x00000400U /* Part of the sector in use   */
+
+/**
+  * @brief  Offsets of the records in the sector.
+  */
+#define BOOT_STORAGE_CALIBRATION_OFFSET  0x00000000U /* See xspi_calibration.h      */
+#define BOOT_STORAGE_SFDP_OFFSET         0x00000100U /* See the NOR SFDP driver     */
+#define BOOT_STORAGE_ASSET_UPDATE_OFFSET 0x00000300U /* See asset_update.h          */
+
+/* Exported functions prototypes ---------------------------------------------*/
+/**
+  * @brief  Replaces a record. The sector is erased and programmed again with the
+  *         other records kept, a record cut by a reset fails its own checksum.
+  * @param  Offset Offset of the record in the sector, one of BOOT_STORAGE_*_OFFSET.
+  * @param  Data The record.
+  * @param  Size Size of the record, it must fit before the next one.
+  * @retval 0 if the record is written, 1 otherwise
+  */
+uint32_t BOOT_STORAGE_Write(uint32_t Offset, const void *Data, uint32_t Size);
+
+/**
+  * @brief  Computes the CRC-32 of a record, the records end with theirs.
+  * @param  Data The record.
+  * @param  Size Size of the record without its checksum.
+  * @retval CRC-32 value
+  */
+uint32_t BOOT_STORAGE_Checksum(const void *Data, uint32_t Size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __BOOT_STORAGE_H */
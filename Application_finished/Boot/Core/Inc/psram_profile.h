@@ -0,0 +1,89 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file           : psram_profile.h
+  * @brief          : Header for psram_profile.c file.
+  *                   Burst, wrap and chip-select boundary profiles of the PSRAM
+  *                   on XSPI1.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __PSRAM_PROFILE_H
+#define __PSRAM_PROFILE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm32h7rsxx_hal.h"
+
+/* Exported constants --------------------------------------------------------*/
+/**
+  * @brief  Profiles. The PSRAM holds the framebuffers scanned out by LTDC and written
+  *         by GPU2D, both with long incrementing bursts which XSPI1 splits at the chip
+  *         select boundary. Only the D-cache line fills of the CPU wrap, on 32 bytes.
+  *         The XSPI1 settings can be compared on the target with the GPU2D busy time
+  *         reported by the application, which also reports the profile in use.
+  */
+#define PSRAM_PROFILE_CUBEMX 0U /* MX_XSPI1_Init(): a transaction per KB                 */
+#define PSRAM_PROFILE_ROW    1U /* A transaction per 2 KB row of the PSRAM               */
+#define PSRAM_PROFILE_LONG   2U /* Across rows, chip select released only for refresh    */
+
+#ifndef PSRAM_PROFILE
+#define PSRAM_PROFILE PSRAM_PROFILE_ROW
+#endif
+
+/**
+  * @brief  Longest time the chip select of the PSRAM may stay low (tCEM of the
+  *         APS256XX, 4 us up to 85 C), with a margin. Profiles which allow longer
+  *         transactions have XSPI1 release the chip select after this time.
+  */
+#define PSRAM_PROFILE_CS_LOW_MAX_NS 3600U
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief  XSPI1 and PSRAM settings of a profile.
+  */
+typedef struct
+{
+  uint32_t WrapSize;           /*!< HAL_XSPI_WRAP_xxx, as the burst length of the PSRAM  */
+  uint32_t ChipSelectBoundary; /*!< HAL_XSPI_BONDARYOF_xxx, in kbits                     */
+  uint32_t RefreshGuard;       /*!< 1 to release the chip select after the tCEM          */
+  uint8_t  MR8Mask;            /*!< Bits of the PSRAM MR8 register set by the profile    */
+  uint8_t  MR8Value;           /*!< Their value                                          */
+} PSRAM_PROFILE_TypeDef;
+
+/* Exported functions prototypes ---------------------------------------------*/
+/**
+  * @brief  Gets the settings of the profile selected by PSRAM_PROFILE.
+  * @retval The profile
+  */
+const PSRAM_PROFILE_TypeDef *PSRAM_PROFILE_Get(void);
+
+/**
+  * @brief  Applies the XSPI1 settings of the profile. To be called once XSPI1 is
+  *         initialized, before the PSRAM is mapped. The refresh, in memory clocks, is
+  *         computed from the prescaler configured.
+  * @param  hxspi XSPI1 handle.
+  * @retval None
+  */
+void PSRAM_PROFILE_Apply(XSPI_HandleTypeDef *hxspi);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __PSRAM_PROFILE_H */
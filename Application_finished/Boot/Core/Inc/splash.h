@@ -0,0 +1,86 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file           : splash.h
+  * @brief          : Header for splash.c file.
+  *                   Splash shown by the boot loader until the application has
+  *                   rendered its first frame.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __SPLASH_H
+#define __SPLASH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief  Splash image, written by gcc/mksplash.py into splash_image.c.
+  *         The image is centered on the display and the background color fills the
+  *         rest, both composed by LTDC while it scans the image out of flash.
+  */
+typedef struct
+{
+  uint16_t Width;          /*!< Width of the image in pixels                                */
+  uint16_t Height;         /*!< Height of the image in pixels                               */
+  uint32_t Background;     /*!< RGB888 color around the image, the image is blended on it   */
+  uint32_t ClutSize;       /*!< Number of colors in the palette, at most 256                */
+  const uint32_t *Clut;    /*!< RGB888 palette                                              */
+  const uint8_t *Pixels;   /*!< L8 indexes into the palette, Width x Height                 */
+} SPLASH_ImageTypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+/**
+  * @brief  Set to 0 to leave the display dark until the application draws its first
+  *         frame.
+  */
+#ifndef SPLASH_ENABLE
+#define SPLASH_ENABLE 1
+#endif
+
+/**
+  * @brief  Display timing, as configured for the application in MX_LTDC_Init(). The
+  *         application takes over LTDC without reprogramming it, so both must match.
+  */
+#define SPLASH_LTDC_HSYNC                4U
+#define SPLASH_LTDC_VSYNC                4U
+#define SPLASH_LTDC_ACCUMULATED_HBP      12U
+#define SPLASH_LTDC_ACCUMULATED_VBP      12U
+#define SPLASH_LTDC_ACCUMULATED_ACTIVE_W 812U
+#define SPLASH_LTDC_ACCUMULATED_ACTIVE_H 492U
+#define SPLASH_LTDC_TOTAL_WIDTH          820U
+#define SPLASH_LTDC_TOTAL_HEIGHT         506U
+
+extern const SPLASH_ImageTypeDef SPLASH_Image;
+
+/* Exported functions prototypes ---------------------------------------------*/
+/**
+  * @brief  Shows the splash image on the display and switches the display on.
+  *         LTDC keeps scanning it out after the jump to the application, which takes
+  *         over the running configuration and replaces the splash with its first frame.
+  * @retval None
+  */
+void SPLASH_Show(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SPLASH_H */
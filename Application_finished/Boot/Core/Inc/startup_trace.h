@@ -0,0 +1,82 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file           : startup_trace.h
+  * @brief          : Header for startup_trace.c file.
+  *                   DWT timestamps of the startup phases, kept in backup SRAM
+  *                   across the jump to the application.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STARTUP_TRACE_H
+#define __STARTUP_TRACE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+#define STARTUP_TRACE_MAGIC      0x54525453U /* "STRT" */
+#define STARTUP_TRACE_ADDRESS    0x38800000U /* BKPSRAM_BASE */
+#define STARTUP_TRACE_MAX_EVENTS 32U
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief  The end of a startup phase. The application reads the same layout, see
+  *         Appli/TouchGFX/target/StartupTrace.hpp.
+  */
+typedef struct
+{
+  uint32_t Cycles;         /*!< DWT cycle counter at the end of the phase             */
+  uint32_t ClockHz;        /*!< Core clock from the end of the phase on, the clock the
+                                cycles of the next phase are counted at                */
+  const char *Name;        /*!< The phase, a string in the flash of the boot loader or
+                                of the application                                     */
+} STARTUP_TRACE_EventTypeDef;
+
+/**
+  * @brief  Startup trace, at the start of backup SRAM.
+  */
+typedef struct
+{
+  uint32_t Magic;          /*!< STARTUP_TRACE_MAGIC while the trace is valid           */
+  uint32_t Count;          /*!< Number of events recorded                              */
+  STARTUP_TRACE_EventTypeDef Events[STARTUP_TRACE_MAX_EVENTS];
+} STARTUP_TRACE_TypeDef;
+
+/* Exported functions prototypes ---------------------------------------------*/
+/**
+  * @brief  Starts the DWT cycle counter from 0 and a new trace, replacing the one of
+  *         the previous boot. To be called first in main().
+  * @retval None
+  */
+void STARTUP_TRACE_Start(void);
+
+/**
+  * @brief  Records the end of a startup phase. Events past STARTUP_TRACE_MAX_EVENTS are
+  *         dropped.
+  * @param  name The phase, a string literal.
+  * @retval None
+  */
+void STARTUP_TRACE_Mark(const char *name);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __STARTUP_TRACE_H */
@@ -75,6 +75,10 @@ enum {
 #define EXTMEM_MEMORY_BOOTXIP  EXTMEMORY_1
 
 /* USER CODE BEGIN PV */
+/*
+  @brief restore the SFDP data of the NOR flash from the internal flash, see boot_storage.c
+*/
+#define EXTMEM_DRIVER_NOR_SFDP_CACHE 1
 
 /* USER CODE END PV */
 
@@ -0,0 +1,97 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file           : xspi_calibration.h
+  * @brief          : Header for xspi_calibration.c file.
+  *                   Calibration of the XSPI links of the external memories,
+  *                   kept in the boot storage.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __XSPI_CALIBRATION_H
+#define __XSPI_CALIBRATION_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported constants --------------------------------------------------------*/
+/**
+  * @brief  Set to 0 to keep the XSPI settings of MX_XSPI1_Init(), MX_XSPI2_Init() and
+  *         of the memory drivers.
+  */
+#ifndef XSPI_CALIBRATION_ENABLE
+#define XSPI_CALIBRATION_ENABLE 1
+#endif
+
+/**
+  * @brief  Set to 1 to calibrate on every boot instead of checking the stored settings.
+  */
+#ifndef XSPI_CALIBRATION_FORCE
+#define XSPI_CALIBRATION_FORCE 0
+#endif
+
+#define XSPI_CALIBRATION_MAGIC    0x4C414358U /* "XCAL" */
+#define XSPI_CALIBRATION_MEMORIES 2U          /* EXTMEMORY_1 and EXTMEMORY_2          */
+#define XSPI_CALIBRATION_STEPS    4U          /* Prescalers tried from the driver's on */
+#define XSPI_CALIBRATION_PASSES   8U          /* Patterns a setting must pass          */
+#define XSPI_CALIBRATION_BLOCK    8192U       /* Bytes tested at the start of a memory */
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief  Settings kept for one memory. The application reads the same layout, see
+  *         Appli/TouchGFX/target/XspiCalibration.hpp.
+  */
+typedef struct
+{
+  uint32_t KernelClockHz;  /*!< XSPI kernel clock the memory was calibrated at          */
+  uint32_t Prescaler;      /*!< The memory clock is KernelClockHz / (Prescaler + 1)     */
+  uint32_t DelayHold;      /*!< 1 if the outputs are held a quarter cycle (DHQC)        */
+  uint32_t ReadKBps;       /*!< Read throughput measured with the settings              */
+  uint32_t WriteKBps;      /*!< Write throughput measured, 0 for a memory not written   */
+  uint32_t Rejected;       /*!< Faster or equal settings which failed a pattern         */
+} XSPI_CALIBRATION_MemoryTypeDef;
+
+/**
+  * @brief  Calibration record, at BOOT_STORAGE_CALIBRATION_OFFSET in the boot storage.
+  */
+typedef struct
+{
+  uint32_t Magic;          /*!< XSPI_CALIBRATION_MAGIC while the record is valid        */
+  XSPI_CALIBRATION_MemoryTypeDef Memory[XSPI_CALIBRATION_MEMORIES];
+  uint32_t Checksum;       /*!< CRC-32 of the fields above                              */
+} XSPI_CALIBRATION_RecordTypeDef;
+
+/* Exported functions prototypes ---------------------------------------------*/
+/**
+  * @brief  Applies the stored settings of the XSPIs once they pass a pattern, or
+  *         calibrates both memories again and stores the result. Settings from the
+  *         prescaler of the memory driver downwards are tried, with and without DHQC,
+  *         and the fastest one passing every pattern is kept: the NOR flash is read
+  *         back against a copy read at the slowest clock, the PSRAM is written and
+  *         read back. To be called once the memories are initialized, before they
+  *         are mapped for the application.
+  * @retval None
+  */
+void XSPI_CALIBRATION_Run(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __XSPI_CALIBRATION_H */
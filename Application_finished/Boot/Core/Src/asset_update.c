@@ -0,0 +1,278 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file           : asset_update.c
+  * @brief          : Block delta patches of the images, fonts and texts of the
+  *                   application in the FLASH_GFX region of the NOR flash.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "extmem_manager.h"
+#include "boot_storage.h"
+#include "asset_update.h"
+#include <stddef.h>
+#include <string.h>
+
+#if ASSET_UPDATE_ENABLE == 1
+/* Private define ------------------------------------------------------------*/
+#define ASSET_UPDATE_HEADER ((ASSET_UPDATE_HeaderTypeDef *)ASSET_UPDATE_STAGING_ADDRESS)
+#define ASSET_UPDATE_RECORD ((const ASSET_UPDATE_RecordTypeDef *)(BOOT_STORAGE_ADDRESS + BOOT_STORAGE_ASSET_UPDATE_OFFSET))
+#define ASSET_UPDATE_MAX_BLOCKS ((ASSET_UPDATE_STAGING_SIZE - sizeof(ASSET_UPDATE_HeaderTypeDef)) / sizeof(ASSET_UPDATE_BlockTypeDef))
+
+/* The record must fit before the end of the storage */
+typedef char ASSET_UPDATE_SizeCheck[((BOOT_STORAGE_ASSET_UPDATE_OFFSET + sizeof(ASSET_UPDATE_RecordTypeDef)) <= BOOT_STORAGE_SIZE) ? 1 : -1];
+
+/* Private variables ---------------------------------------------------------*/
+/* A block of the NOR flash, read back in indirect mode */
+static uint8_t update_buffer[ASSET_UPDATE_BLOCK_SIZE] __ALIGNED(32);
+static ASSET_UPDATE_RecordTypeDef update_record;
+
+/* Private functions ---------------------------------------------------------*/
+static const ASSET_UPDATE_BlockTypeDef *update_block(uint32_t Index)
+{
+  return (const ASSET_UPDATE_BlockTypeDef *)(ASSET_UPDATE_STAGING_ADDRESS + sizeof(ASSET_UPDATE_HeaderTypeDef)
+                                             + (Index * sizeof(ASSET_UPDATE_BlockTypeDef)));
+}
+
+static void update_store(uint32_t State)
+{
+  update_record.Magic = ASSET_UPDATE_RECORD_MAGIC;
+  update_record.State = State;
+  update_record.Checksum = BOOT_STORAGE_Checksum(&update_record, offsetof(ASSET_UPDATE_RecordTypeDef, Checksum));
+  (void)BOOT_STORAGE_Write(BOOT_STORAGE_ASSET_UPDATE_OFFSET, &update_record, sizeof(update_record));
+}
+
+static uint32_t update_record_is_valid(void)
+{
+  return ((ASSET_UPDATE_RECORD->Magic == ASSET_UPDATE_RECORD_MAGIC)
+          && (ASSET_UPDATE_RECORD->Checksum == BOOT_STORAGE_Checksum(ASSET_UPDATE_RECORD, offsetof(ASSET_UPDATE_RecordTypeDef, Checksum))))
+         ? 1U : 0U;
+}
+
+/**
+  * @brief  Checks a staged patch: its checksums, and blocks aligned, in FLASH_GFX and
+  *         by strictly ascending address.
+  * @retval 1 if the patch can be applied
+  */
+static uint32_t update_is_valid(const ASSET_UPDATE_HeaderTypeDef *Header)
+{
+  uint32_t previous = 0U;
+
+  if ((Header->Checksum != BOOT_STORAGE_Checksum(Header, offsetof(ASSET_UPDATE_HeaderTypeDef, Checksum)))
+      || (Header->BlockCount == 0U) || (Header->BlockCount > ASSET_UPDATE_MAX_BLOCKS))
+  {
+    return 0U;
+  }
+  for (uint32_t index = 0U; index < Header->BlockCount; index++)
+  {
+    const uint32_t address = update_block(index)->Address;
+    if (((address % ASSET_UPDATE_BLOCK_SIZE) != 0U) || (address < ASSET_UPDATE_REGION_START)
+        || (address > (ASSET_UPDATE_REGION_END - ASSET_UPDATE_BLOCK_SIZE))
+        || ((index != 0U) && (address <= previous)))
+    {
+      return 0U;
+    }
+    previous = address;
+  }
+  return (Header->PayloadChecksum == BOOT_STORAGE_Checksum(update_block(0U), Header->BlockCount * sizeof(ASSET_UPDATE_BlockTypeDef)))
+         ? 1U : 0U;
+}
+
+static uint32_t update_is_erased(const uint8_t *Data)
+{
+  const uint32_t *word = (const uint32_t *)Data;
+
+  for (uint32_t index = 0U; index < (ASSET_UPDATE_BLOCK_SIZE / 4U); index++)
+  {
+    if (word[index] != 0xFFFFFFFFU)
+    {
+      return 0U;
+    }
+  }
+  return 1U;
+}
+
+/**
+  * @brief  Programs a block and reads it back.
+  * @retval 0 if the block holds its new content
+  */
+static uint32_t update_program(uint32_t Base, const ASSET_UPDATE_BlockTypeDef *Block)
+{
+  if ((EXTMEM_Write(EXTMEMORY_1, Block->Address - Base, Block->Data, ASSET_UPDATE_BLOCK_SIZE) != EXTMEM_OK)
+      || (EXTMEM_Read(EXTMEMORY_1, Block->Address - Base, update_buffer, ASSET_UPDATE_BLOCK_SIZE) != EXTMEM_OK))
+  {
+    return 1U;
+  }
+  return (memcmp(update_buffer, Block->Data, ASSET_UPDATE_BLOCK_SIZE) == 0) ? 0U : 1U;
+}
+
+/**
+  * @brief  Erases a run of adjacent blocks at once, then programs them.
+  * @param  Base Mapped address of the NOR flash.
+  * @param  First Index of the first block of the run.
+  * @param  Count Number of blocks in the run.
+  * @retval 0 if every block of the run holds its new content
+  */
+static uint32_t update_flush(uint32_t Base, uint32_t First, uint32_t Count)
+{
+  if (Count == 0U)
+  {
+    return 0U;
+  }
+
+  /* The memory manager erases by the largest aligned sectors which fit in the run */
+  if (EXTMEM_EraseSector(EXTMEMORY_1, update_block(First)->Address - Base, Count * ASSET_UPDATE_BLOCK_SIZE) != EXTMEM_OK)
+  {
+    return 1U;
+  }
+  update_record.EraseBatches++;
+
+  for (uint32_t index = First; index < (First + Count); index++)
+  {
+    if (update_program(Base, update_block(index)) != 0U)
+    {
+      return 1U;
+    }
+    update_record.Erased++;
+  }
+  return 0U;
+}
+
+static uint32_t update_apply(const ASSET_UPDATE_HeaderTypeDef *Header)
+{
+  uint32_t base = 0U;
+  uint32_t first = 0U;
+  uint32_t count = 0U;
+
+  if (EXTMEM_GetMapAddress(EXTMEMORY_1, &base) != EXTMEM_OK)
+  {
+    return 1U;
+  }
+
+  for (uint32_t index = 0U; index < Header->BlockCount; index++)
+  {
+    const ASSET_UPDATE_BlockTypeDef *block = update_block(index);
+
+    if (EXTMEM_Read(EXTMEMORY_1, block->Address - base, update_buffer, ASSET_UPDATE_BLOCK_SIZE) != EXTMEM_OK)
+    {
+      return 1U;
+    }
+
+    if (memcmp(update_buffer, block->Data, ASSET_UPDATE_BLOCK_SIZE) == 0)
+    {
+      /* Applied by an update cut by a reset, or not changed */
+      update_record.Unchanged++;
+    }
+    else if (update_is_erased(update_buffer) != 0U)
+    {
+      if (update_program(base, block) != 0U)
+      {
+        return 1U;
+      }
+      update_record.Programmed++;
+    }
+    else if ((count != 0U) && (block->Address == (update_block(first + count - 1U)->Address + ASSET_UPDATE_BLOCK_SIZE)))
+    {
+      count++;
+      continue;
+    }
+    else
+    {
+      if (update_flush(base, first, count) != 0U)
+      {
+        return 1U;
+      }
+      first = index;
+      count = 1U;
+      continue;
+    }
+
+    /* The block skipped or programmed ends the run, it must not be erased */
+    if (update_flush(base, first, count) != 0U)
+    {
+      return 1U;
+    }
+    count = 0U;
+  }
+  return update_flush(base, first, count);
+}
+
+/* Exported functions --------------------------------------------------------*/
+void ASSET_UPDATE_Run(void)
+{
+  ASSET_UPDATE_HeaderTypeDef *header = ASSET_UPDATE_HEADER;
+  uint32_t start;
+  uint32_t checksum;
+
+  if (EXTMEM_MemoryMappedMode(EXTMEMORY_2, EXTMEM_ENABLE) != EXTMEM_OK)
+  {
+    return;
+  }
+  SCB_InvalidateDCache_by_Addr((void *)ASSET_UPDATE_STAGING_ADDRESS, (int32_t)ASSET_UPDATE_STAGING_SIZE);
+
+  if (header->Magic != ASSET_UPDATE_MAGIC)
+  {
+    /* The PSRAM lost the patch with the power while it was applied */
+    if ((update_record_is_valid() != 0U) && (ASSET_UPDATE_RECORD->State == ASSET_UPDATE_STATE_APPLYING))
+    {
+      update_record = *ASSET_UPDATE_RECORD;
+      update_store(ASSET_UPDATE_STATE_INTERRUPTED);
+    }
+  }
+  else
+  {
+    (void)memset(&update_record, 0x0, sizeof(update_record));
+    if (update_is_valid(header) == 0U)
+    {
+      update_store(ASSET_UPDATE_STATE_REJECTED);
+      header->Magic = 0U;
+    }
+    else
+    {
+      /* A single write of the boot storage per patch, even when a reset cuts it */
+      checksum = header->Checksum;
+      if ((update_record_is_valid() == 0U) || (ASSET_UPDATE_RECORD->State != ASSET_UPDATE_STATE_APPLYING)
+          || (ASSET_UPDATE_RECORD->Patch != checksum))
+      {
+        update_record.Patch = checksum;
+        update_record.Blocks = header->BlockCount;
+        update_store(ASSET_UPDATE_STATE_APPLYING);
+      }
+
+      update_record.Patch = checksum;
+      update_record.Blocks = header->BlockCount;
+      start = HAL_GetTick();
+      if (update_apply(header) != 0U)
+      {
+        /* The patch stays staged, it is applied again on the next boot */
+        update_record.DurationMs = HAL_GetTick() - start;
+        update_store(ASSET_UPDATE_STATE_FAILED);
+      }
+      else
+      {
+        update_record.DurationMs = HAL_GetTick() - start;
+        update_store(ASSET_UPDATE_STATE_DONE);
+        header->Magic = 0U;
+      }
+    }
+    SCB_CleanDCache_by_Addr((void *)header, (int32_t)sizeof(ASSET_UPDATE_HeaderTypeDef));
+  }
+
+  /* No line of the memory may be left in the D-cache once it is not mapped */
+  SCB_CleanInvalidateDCache_by_Addr((void *)ASSET_UPDATE_STAGING_ADDRESS, (int32_t)ASSET_UPDATE_STAGING_SIZE);
+  (void)EXTMEM_MemoryMappedMode(EXTMEMORY_2, EXTMEM_DISABLE);
+}
+#endif /* ASSET_UPDATE_ENABLE == 1 */
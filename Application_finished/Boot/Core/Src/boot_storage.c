@@ -0,0 +1,120 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file           : boot_storage.c
+  * @brief          : Records of the boot loader kept in the last sector of the
+  *                   internal flash across power cycles: the SFDP data of the
+  *                   external NOR flash, the XSPI calibration and the state of
+  *                   the last asset update.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "boot_storage.h"
+#include "stm32_extmem_conf.h"
+#include "stm32_sfdp_driver_type.h"
+#include "stm32_sfdp_driver_api.h"
+#include <string.h>
+
+/* Private define ------------------------------------------------------------*/
+#define BOOT_STORAGE_SECTOR   (FLASH_SECTOR_NB - 1U)
+
+/* The flash is programmed by quad-words */
+#define BOOT_STORAGE_QUADWORD 16U
+
+/* The storage is the last sector */
+typedef char BOOT_STORAGE_SectorCheck[(BOOT_STORAGE_ADDRESS == (FLASH_BASE + (BOOT_STORAGE_SECTOR * FLASH_SECTOR_SIZE))) ? 1 : -1];
+
+/* Private variables ---------------------------------------------------------*/
+static uint32_t boot_storage_buffer[BOOT_STORAGE_SIZE / 4U];
+
+/* Exported functions --------------------------------------------------------*/
+uint32_t BOOT_STORAGE_Write(uint32_t Offset, const void *Data, uint32_t Size)
+{
+  FLASH_EraseInitTypeDef erase = {0};
+  uint32_t sector_error = 0U;
+  uint32_t offset;
+  uint32_t retr = 1U;
+
+  if ((Offset + Size) > BOOT_STORAGE_SIZE)
+  {
+    return 1U;
+  }
+
+  /* The other records are kept as they are, valid or not */
+  (void)memcpy(boot_storage_buffer, (const void *)BOOT_STORAGE_ADDRESS, BOOT_STORAGE_SIZE);
+  (void)memcpy((uint8_t *)boot_storage_buffer + Offset, Data, Size);
+
+  if (HAL_FLASH_Unlock() != HAL_OK)
+  {
+    return 1U;
+  }
+
+  erase.TypeErase = FLASH_TYPEERASE_SECTORS;
+  erase.Sector = BOOT_STORAGE_SECTOR;
+  erase.NbSectors = 1U;
+  if (HAL_FLASHEx_Erase(&erase, &sector_error) == HAL_OK)
+  {
+    retr = 0U;
+    for (offset = 0U; offset < BOOT_STORAGE_SIZE; offset += BOOT_STORAGE_QUADWORD)
+    {
+      if (HAL_FLASH_Program(FLASH_TYPEPROGRAM_QUADWORD, BOOT_STORAGE_ADDRESS + offset,
+                            (uint32_t)boot_storage_buffer + offset) != HAL_OK)
+      {
+        retr = 1U;
+        break;
+      }
+    }
+  }
+
+  (void)HAL_FLASH_Lock();
+
+  /* Later reads see the new records */
+  SCB_InvalidateDCache_by_Addr((void *)BOOT_STORAGE_ADDRESS, (int32_t)BOOT_STORAGE_SIZE);
+  return retr;
+}
+
+uint32_t BOOT_STORAGE_Checksum(const void *Data, uint32_t Size)
+{
+  const uint8_t *ptr = (const uint8_t *)Data;
+  uint32_t crc = 0xFFFFFFFFU;
+
+  for (uint32_t index = 0U; index < Size; index++)
+  {
+    crc ^= ptr[index];
+    for (uint8_t bit = 0U; bit < 8U; bit++)
+    {
+      crc = (crc >> 1U) ^ (0xEDB88320U & (0U - (crc & 1U)));
+    }
+  }
+  return ~crc;
+}
+
+#if EXTMEM_DRIVER_NOR_SFDP_CACHE == 1
+/* The SFDP cache record must fit before the asset update one */
+typedef char BOOT_STORAGE_SfdpSizeCheck[((BOOT_STORAGE_SFDP_OFFSET + sizeof(EXTMEM_DRIVER_NOR_SFDP_CacheTypeDef)) <= BOOT_STORAGE_ASSET_UPDATE_OFFSET) ? 1 : -1];
+
+EXTMEM_DRIVER_NOR_SFDP_StatusTypeDef EXTMEM_DRIVER_NOR_SFDP_CacheLoad(EXTMEM_DRIVER_NOR_SFDP_CacheTypeDef *Cache)
+{
+  /* The driver checks the record, an erased sector is not a valid one */
+  (void)memcpy(Cache, (const void *)(BOOT_STORAGE_ADDRESS + BOOT_STORAGE_SFDP_OFFSET), sizeof(EXTMEM_DRIVER_NOR_SFDP_CacheTypeDef));
+  return EXTMEM_DRIVER_NOR_SFDP_OK;
+}
+
+void EXTMEM_DRIVER_NOR_SFDP_CacheStore(const EXTMEM_DRIVER_NOR_SFDP_CacheTypeDef *Cache)
+{
+  (void)BOOT_STORAGE_Write(BOOT_STORAGE_SFDP_OFFSET, Cache, sizeof(EXTMEM_DRIVER_NOR_SFDP_CacheTypeDef));
+}
+#endif /* EXTMEM_DRIVER_NOR_SFDP_CACHE == 1 */
@@ -23,6 +23,8 @@
 #include <string.h>
 
 /* USER CODE BEGIN Includes */
+#include "psram_profile.h"
+#include "startup_trace.h"
 
 /* USER CODE END Includes */
 
@@ -84,6 +86,15 @@ void MX_EXTMEM_MANAGER_Init(void)
   extmem_list_config[1].PsramObject.psram_public.config[0].WriteValue = 0x40u;
   extmem_list_config[1].PsramObject.psram_public.config[0].REGAddress = 0x08u;
 
+  /* Burst length and row boundary crossing of the profile of XSPI1, see psram_profile.h */
+  if (PSRAM_PROFILE_Get()->MR8Mask != 0u)
+  {
+    extmem_list_config[1].PsramObject.psram_public.config[1].WriteMask = PSRAM_PROFILE_Get()->MR8Mask;
+    extmem_list_config[1].PsramObject.psram_public.config[1].WriteValue = PSRAM_PROFILE_Get()->MR8Value;
+    extmem_list_config[1].PsramObject.psram_public.config[1].REGAddress = 0x08u;
+    extmem_list_config[1].PsramObject.psram_public.NumberOfConfig = 2u;
+  }
+
   /* Memory command configuration */
   extmem_list_config[1].PsramObject.psram_public.ReadREG           = 0x40u;
   extmem_list_config[1].PsramObject.psram_public.WriteREG          = 0xC0u;
@@ -96,7 +107,10 @@ void MX_EXTMEM_MANAGER_Init(void)
   extmem_list_config[1].PsramObject.psram_public.Read_DummyCycle   = 4u;
 
   EXTMEM_Init(EXTMEMORY_1, HAL_RCCEx_GetPeriphCLKFreq(RCC_PERIPHCLK_XSPI2));
+  /* The NOR flash is configured from its SFDP tables, see EXTMEM_DRIVER_NOR_SFDP_Init() */
+  STARTUP_TRACE_Mark("EXTMEM_Init NOR SFDP");
   EXTMEM_Init(EXTMEMORY_2, HAL_RCCEx_GetPeriphCLKFreq(RCC_PERIPHCLK_XSPI1));
+  STARTUP_TRACE_Mark("EXTMEM_Init PSRAM");
 
   /* USER CODE BEGIN MX_EXTMEM_Init_PostTreatment */
 
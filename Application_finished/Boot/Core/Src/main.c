@@ -22,6 +22,11 @@
 
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "asset_update.h"
+#include "psram_profile.h"
+#include "splash.h"
+#include "startup_trace.h"
+#include "xspi_calibration.h"
 
 /* USER CODE END Includes */
 
@@ -74,6 +79,8 @@ int main(void)
 {
 
   /* USER CODE BEGIN 1 */
+  /* Startup is timed from here to the first frame of the application */
+  STARTUP_TRACE_Start();
 
   /* USER CODE END 1 */
 
@@ -98,6 +105,10 @@ int main(void)
   SystemClock_Config();
 
   /* USER CODE BEGIN SysInit */
+  STARTUP_TRACE_Mark("SystemClock_Config");
+  /* Light the display before the external memories are initialized and mapped */
+  SPLASH_Show();
+  STARTUP_TRACE_Mark("SPLASH_Show");
 
   /* USER CODE END SysInit */
 
@@ -110,6 +121,16 @@ int main(void)
   MX_SBS_Init();
   MX_EXTMEM_MANAGER_Init();
   /* USER CODE BEGIN 2 */
+#if XSPI_CALIBRATION_ENABLE == 1
+  /* Fastest stable XSPI settings, before the memories are mapped for the application */
+  XSPI_CALIBRATION_Run();
+  STARTUP_TRACE_Mark("XSPI_CALIBRATION_Run");
+#endif /* XSPI_CALIBRATION_ENABLE == 1 */
+#if ASSET_UPDATE_ENABLE == 1
+  /* The NOR flash is only written while the application does not run from it */
+  ASSET_UPDATE_Run();
+  STARTUP_TRACE_Mark("ASSET_UPDATE_Run");
+#endif /* ASSET_UPDATE_ENABLE == 1 */
 
   /* USER CODE END 2 */
 
@@ -294,6 +315,7 @@ static void MX_SBS_Init(void)
 
   /* USER CODE END SBS_Init 1 */
   /* USER CODE BEGIN SBS_Init 2 */
+  STARTUP_TRACE_Mark("MX_FLASH_Init, MX_SBS_Init");
 
   /* USER CODE END SBS_Init 2 */
 
@@ -344,6 +366,9 @@ static void MX_XSPI1_Init(void)
     Error_Handler();
   }
   /* USER CODE BEGIN XSPI1_Init 2 */
+  /* Burst, wrap and chip select boundary for the LTDC and GPU2D accesses, see psram_profile.h */
+  PSRAM_PROFILE_Apply(&hxspi1);
+  STARTUP_TRACE_Mark("MX_XSPI1_Init");
 
   /* USER CODE END XSPI1_Init 2 */
 
@@ -394,6 +419,7 @@ static void MX_XSPI2_Init(void)
     Error_Handler();
   }
   /* USER CODE BEGIN XSPI2_Init 2 */
+  STARTUP_TRACE_Mark("MX_XSPI2_Init");
 
   /* USER CODE END XSPI2_Init 2 */
 
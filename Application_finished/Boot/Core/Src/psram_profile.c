@@ -0,0 +1,71 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file           : psram_profile.c
+  * @brief          : Burst, wrap and chip-select boundary profiles of the PSRAM
+  *                   on XSPI1.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "psram_profile.h"
+
+/* Private define ------------------------------------------------------------*/
+/* APS256XX MR8: burst length on bits 1:0, row boundary crossing on bit 3 */
+#define PSRAM_MR8_BL_32_BYTES 0x01U
+#define PSRAM_MR8_BL_MASK     0x03U
+#define PSRAM_MR8_RBX         0x08U
+
+/* Private variables ---------------------------------------------------------*/
+static const PSRAM_PROFILE_TypeDef psram_profiles[] =
+{
+  /* PSRAM_PROFILE_CUBEMX */
+  { HAL_XSPI_WRAP_32_BYTES, HAL_XSPI_BONDARYOF_8KB,  0U, 0U, 0U },
+  /* PSRAM_PROFILE_ROW */
+  { HAL_XSPI_WRAP_32_BYTES, HAL_XSPI_BONDARYOF_16KB, 1U, 0U, 0U },
+  /* PSRAM_PROFILE_LONG */
+  { HAL_XSPI_WRAP_32_BYTES, HAL_XSPI_BONDARYOF_NONE, 1U,
+    (uint8_t)(PSRAM_MR8_BL_MASK | PSRAM_MR8_RBX), (uint8_t)(PSRAM_MR8_BL_32_BYTES | PSRAM_MR8_RBX) },
+};
+
+typedef char PSRAM_PROFILE_Check[(PSRAM_PROFILE < (sizeof(psram_profiles) / sizeof(psram_profiles[0]))) ? 1 : -1];
+
+/* Exported functions --------------------------------------------------------*/
+const PSRAM_PROFILE_TypeDef *PSRAM_PROFILE_Get(void)
+{
+  return &psram_profiles[PSRAM_PROFILE];
+}
+
+void PSRAM_PROFILE_Apply(XSPI_HandleTypeDef *hxspi)
+{
+  const PSRAM_PROFILE_TypeDef *profile = PSRAM_PROFILE_Get();
+  uint32_t refresh = 0U;
+
+  if (profile->RefreshGuard != 0U)
+  {
+    /* Memory clocks in the tCEM, XSPI1 releases the chip select after them */
+    const uint32_t clock = HAL_RCCEx_GetPeriphCLKFreq(RCC_PERIPHCLK_XSPI1) / (hxspi->Init.ClockPrescaler + 1U);
+    refresh = (uint32_t)(((uint64_t)clock * PSRAM_PROFILE_CS_LOW_MAX_NS) / 1000000000U);
+  }
+
+  hxspi->Init.WrapSize = profile->WrapSize;
+  hxspi->Init.ChipSelectBoundary = profile->ChipSelectBoundary;
+  hxspi->Init.Refresh = refresh;
+
+  /* XSPI1 is not mapped yet, the settings of HAL_XSPI_Init() are replaced in place */
+  MODIFY_REG(hxspi->Instance->DCR2, XSPI_DCR2_WRAPSIZE, hxspi->Init.WrapSize);
+  MODIFY_REG(hxspi->Instance->DCR3, XSPI_DCR3_CSBOUND, (hxspi->Init.ChipSelectBoundary << XSPI_DCR3_CSBOUND_Pos));
+  hxspi->Instance->DCR4 = hxspi->Init.Refresh;
+}
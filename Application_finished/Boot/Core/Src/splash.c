@@ -0,0 +1,149 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file           : splash.c
+  * @brief          : Splash shown by the boot loader until the application has
+  *                   rendered its first frame.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "splash.h"
+#include "stm32h7rsxx_hal_ltdc.h"
+
+/* Private define ------------------------------------------------------------*/
+#define SPLASH_DISPLAY_WIDTH  (SPLASH_LTDC_ACCUMULATED_ACTIVE_W - SPLASH_LTDC_ACCUMULATED_HBP)
+#define SPLASH_DISPLAY_HEIGHT (SPLASH_LTDC_ACCUMULATED_ACTIVE_H - SPLASH_LTDC_ACCUMULATED_VBP)
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  GPIO_TypeDef *Port;
+  uint32_t Pins;
+  uint32_t Alternate;
+} SPLASH_PinsTypeDef;
+
+/* Private variables ---------------------------------------------------------*/
+/* The LTDC pins of HAL_LTDC_MspInit() in the application */
+static const SPLASH_PinsTypeDef splash_pins[] =
+{
+  { GPIOF, GPIO_PIN_0, GPIO_AF11_LTDC },
+  { GPIOF, GPIO_PIN_7 | GPIO_PIN_9 | GPIO_PIN_15, GPIO_AF13_LTDC },
+  { GPIOF, GPIO_PIN_10 | GPIO_PIN_11, GPIO_AF14_LTDC },
+  { GPIOG, GPIO_PIN_0 | GPIO_PIN_1 | GPIO_PIN_2 | GPIO_PIN_13 | GPIO_PIN_14, GPIO_AF13_LTDC },
+  { GPIOB, GPIO_PIN_3 | GPIO_PIN_4 | GPIO_PIN_11 | GPIO_PIN_12 | GPIO_PIN_14, GPIO_AF13_LTDC },
+  { GPIOB, GPIO_PIN_13 | GPIO_PIN_15, GPIO_AF10_LTDC },
+  { GPIOE, GPIO_PIN_11, GPIO_AF11_LTDC },
+  { GPIOA, GPIO_PIN_0 | GPIO_PIN_1 | GPIO_PIN_8 | GPIO_PIN_11 | GPIO_PIN_12 | GPIO_PIN_15, GPIO_AF13_LTDC },
+  { GPIOA, GPIO_PIN_9 | GPIO_PIN_10, GPIO_AF14_LTDC },
+  { GPIOA, GPIO_PIN_6, GPIO_AF12_LTDC },
+};
+
+/* Private function prototypes -----------------------------------------------*/
+static void SPLASH_InitPins(void);
+
+/* Exported functions --------------------------------------------------------*/
+void SPLASH_Show(void)
+{
+#if SPLASH_ENABLE
+  const SPLASH_ImageTypeDef *image = &SPLASH_Image;
+  RCC_PeriphCLKInitTypeDef PeriphClkInit = {0};
+  uint32_t x0;
+  uint32_t y0;
+  uint32_t i;
+
+  if ((image->Width == 0U) || (image->Width > SPLASH_DISPLAY_WIDTH) ||
+      (image->Height == 0U) || (image->Height > SPLASH_DISPLAY_HEIGHT))
+  {
+    return;
+  }
+
+  /* Pixel clock from PLL3R, configured by SystemClock_Config() */
+  PeriphClkInit.PeriphClockSelection = RCC_PERIPHCLK_LTDC;
+  PeriphClkInit.LtdcClockSelection = RCC_LTDCCLKSOURCE_PLL3R;
+  if (HAL_RCCEx_PeriphCLKConfig(&PeriphClkInit) != HAL_OK)
+  {
+    return;
+  }
+  __HAL_RCC_LTDC_CLK_ENABLE();
+  SPLASH_InitPins();
+
+  /* Timing of the application, all signals active low */
+  LTDC->SSCR = (SPLASH_LTDC_HSYNC << 16U) | SPLASH_LTDC_VSYNC;
+  LTDC->BPCR = (SPLASH_LTDC_ACCUMULATED_HBP << 16U) | SPLASH_LTDC_ACCUMULATED_VBP;
+  LTDC->AWCR = (SPLASH_LTDC_ACCUMULATED_ACTIVE_W << 16U) | SPLASH_LTDC_ACCUMULATED_ACTIVE_H;
+  LTDC->TWCR = (SPLASH_LTDC_TOTAL_WIDTH << 16U) | SPLASH_LTDC_TOTAL_HEIGHT;
+  LTDC->GCR &= ~(LTDC_GCR_HSPOL | LTDC_GCR_VSPOL | LTDC_GCR_DEPOL | LTDC_GCR_PCPOL);
+  /* LTDC fills the display around the image */
+  LTDC->BCCR = image->Background & 0xFFFFFFU;
+
+  /* Layer 1 scans the image out of this flash, centered, in the window of its size */
+  x0 = (SPLASH_DISPLAY_WIDTH - image->Width) / 2U;
+  y0 = (SPLASH_DISPLAY_HEIGHT - image->Height) / 2U;
+  LTDC_Layer1->WHPCR = ((x0 + image->Width + SPLASH_LTDC_ACCUMULATED_HBP) << 16U) | (x0 + SPLASH_LTDC_ACCUMULATED_HBP + 1U);
+  LTDC_Layer1->WVPCR = ((y0 + image->Height + SPLASH_LTDC_ACCUMULATED_VBP) << 16U) | (y0 + SPLASH_LTDC_ACCUMULATED_VBP + 1U);
+  LTDC_Layer1->PFCR = LTDC_PIXEL_FORMAT_L8;
+  LTDC_Layer1->DCCR = 0U;
+  LTDC_Layer1->CACR = 255U;
+  LTDC_Layer1->BFCR = LTDC_BLENDING_FACTOR1_CA | LTDC_BLENDING_FACTOR2_CA;
+  LTDC_Layer1->CFBAR = (uint32_t)image->Pixels;
+  LTDC_Layer1->CFBLR = ((uint32_t)image->Width << 16U) | (image->Width + 7U);
+  LTDC_Layer1->CFBLNR = image->Height;
+  for (i = 0U; (i < image->ClutSize) && (i < 256U); i++)
+  {
+    LTDC_Layer1->CLUTWR = (i << 24U) | (image->Clut[i] & 0xFFFFFFU);
+  }
+  LTDC_Layer1->CR |= LTDC_LxCR_CLUTEN | LTDC_LxCR_LEN;
+  LTDC->SRCR = LTDC_SRCR_IMR;
+  LTDC->GCR |= LTDC_GCR_LTDCEN;
+
+  /* The panel shows the first frame LTDC sends, the splash */
+  HAL_GPIO_WritePin(LCD_EN_GPIO_Port, LCD_EN_Pin, GPIO_PIN_SET);
+  HAL_GPIO_WritePin(LCD_BL_CTRL_GPIO_Port, LCD_BL_CTRL_Pin, GPIO_PIN_SET);
+#endif /* SPLASH_ENABLE */
+}
+
+/* Private functions ---------------------------------------------------------*/
+static void SPLASH_InitPins(void)
+{
+  GPIO_InitTypeDef GPIO_InitStruct = {0};
+  uint32_t i;
+
+  __HAL_RCC_GPIOA_CLK_ENABLE();
+  __HAL_RCC_GPIOB_CLK_ENABLE();
+  __HAL_RCC_GPIOE_CLK_ENABLE();
+  __HAL_RCC_GPIOF_CLK_ENABLE();
+  __HAL_RCC_GPIOG_CLK_ENABLE();
+
+  GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
+  GPIO_InitStruct.Pull = GPIO_NOPULL;
+  GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
+  for (i = 0U; i < (sizeof(splash_pins) / sizeof(splash_pins[0])); i++)
+  {
+    GPIO_InitStruct.Pin = splash_pins[i].Pins;
+    GPIO_InitStruct.Alternate = splash_pins[i].Alternate;
+    HAL_GPIO_Init(splash_pins[i].Port, &GPIO_InitStruct);
+  }
+
+  /* Display enable and backlight, switched on once LTDC runs */
+  HAL_GPIO_WritePin(LCD_EN_GPIO_Port, LCD_EN_Pin, GPIO_PIN_RESET);
+  HAL_GPIO_WritePin(LCD_BL_CTRL_GPIO_Port, LCD_BL_CTRL_Pin, GPIO_PIN_RESET);
+  GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_PP;
+  GPIO_InitStruct.Alternate = 0U;
+  GPIO_InitStruct.Pin = LCD_EN_Pin;
+  HAL_GPIO_Init(LCD_EN_GPIO_Port, &GPIO_InitStruct);
+  GPIO_InitStruct.Pin = LCD_BL_CTRL_Pin;
+  HAL_GPIO_Init(LCD_BL_CTRL_GPIO_Port, &GPIO_InitStruct);
+}
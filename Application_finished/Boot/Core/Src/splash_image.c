@@ -0,0 +1,1500 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file           : splash_image.c
+  * @brief          : Splash shown by the boot loader, written by gcc/mksplash.py
+  *                   from alternate_theme_images_logos_touchgfx_gradient_smooth.png
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+#include "splash.h"
+
+static const uint32_t splash_clut[256] =
+{
+  0xC0C8D2U, 0x000000U, 0x3193C4U, 0x3297C8U, 0x287FAEU, 0x0A345EU, 0x052750U, 0x124873U,
+  0x144E78U, 0x16527DU, 0x1C608CU, 0x1A5D8AU, 0x09335CU, 0xACBBC9U, 0x0A355FU, 0x052A52U,
+  0x175580U, 0x1B5F8CU, 0x16517DU, 0x083059U, 0x113B57U, 0x287FAFU, 0x2D8BBBU, 0x0E3E68U,
+  0x175480U, 0x2E8EBEU, 0x2A83B2U, 0x1A5B87U, 0x124872U, 0x052951U, 0x2373A2U, 0x134C77U,
+  0x15507CU, 0x2373A1U, 0x114570U, 0x1C628FU, 0x0B3861U, 0x1D6390U, 0x10436EU, 0x277CABU,
+  0x267AA9U, 0x15517DU, 0x0D3C66U, 0x0D3D67U, 0x072E57U, 0x95AEC1U, 0x14486BU, 0x124772U,
+  0x1E6592U, 0x144F7BU, 0x1C5E8AU, 0x1B608CU, 0x277DACU, 0x287EADU, 0x1A5D89U, 0x5A86A5U,
+  0x5D91B2U, 0x2B87B7U, 0x185884U, 0x195884U, 0x144E7AU, 0x2981B0U, 0x2D8ABAU, 0x2B85B5U,
+  0x85A3BAU, 0x2475A4U, 0x2576A5U, 0x0B3760U, 0x123C59U, 0x22709DU, 0x22709EU, 0x040E13U,
+  0x04131FU, 0x23638DU, 0x6D93AFU, 0x6E9BB8U, 0x062B53U, 0x124A75U, 0x1A5270U, 0x0C3862U,
+  0x0C3963U, 0x21709DU, 0x134873U, 0x0F406AU, 0x0F406BU, 0x144D79U, 0x144E79U, 0x195A86U,
+  0x195A87U, 0x09325BU, 0x154E7AU, 0x154F7AU, 0x2678A7U, 0xADBECDU, 0xB6C2CEU, 0x0C3A64U,
+  0x0C3B65U, 0x0B3660U, 0x0B3761U, 0x052850U, 0x10364FU, 0x17547FU, 0x0F416BU, 0x0F416CU,
+  0x27769EU, 0x2474A2U, 0x1A5A86U, 0x195B87U, 0x185682U, 0x185783U, 0x1D6491U, 0x1D6592U,
+  0x051A30U, 0x032144U, 0x1F6795U, 0x1F6895U, 0x062A52U, 0x0F3752U, 0x2578A6U, 0x2578A7U,
+  0x114771U, 0x114772U, 0x1C638FU, 0x2880AFU, 0x2A7FAEU, 0x206997U, 0x1B5F8BU, 0x062C55U,
+  0x072D56U, 0x0C2D43U, 0x0C304DU, 0x175682U, 0x2A82B2U, 0x0E3F69U, 0x0E4069U, 0x144C77U,
+  0x144D78U, 0x2E6C95U, 0x2C739EU, 0x2A84B4U, 0x2A84B5U, 0x2C88B8U, 0x2D88B6U, 0x206C99U,
+  0x216C9AU, 0x206A97U, 0x206A98U, 0x1B5C89U, 0x2D8CBCU, 0x2E8DBDU, 0x1B5C86U, 0x1A5C89U,
+  0x2980AFU, 0x2980B0U, 0x154F7BU, 0x15507BU, 0x0D3A64U, 0x0D3B65U, 0x15517CU, 0x16507BU,
+  0x1E6593U, 0x1E6693U, 0x1D628FU, 0x1C6290U, 0x2F8FC0U, 0x3090C1U, 0x22719FU, 0x23719FU,
+  0x1C618DU, 0x1C618EU, 0x1B5E8AU, 0x1B5E8BU, 0x206B98U, 0x206B99U, 0x216D9AU, 0x216D9BU,
+  0x226F9CU, 0x226F9DU, 0x297CABU, 0x2B81ACU, 0x08315AU, 0x09315AU, 0x195986U, 0x134A76U,
+  0x134B76U, 0x124973U, 0x124974U, 0x17537FU, 0x16547FU, 0x1F6996U, 0x206996U, 0x39769DU,
+  0x44799DU, 0x5083A6U, 0x4B8AB0U, 0x2B85B5U, 0x2B86B6U, 0x114670U, 0x114671U, 0x175581U,
+  0x175681U, 0x2577A5U, 0x2577A6U, 0x3091C1U, 0x3092C3U, 0x2679A8U, 0x267AA8U, 0x1E6794U,
+  0x1F6694U, 0x226D9BU, 0x1B608DU, 0x1C608DU, 0x1A5B88U, 0x1A5C88U, 0x10446EU, 0x11446FU,
+  0x2371A0U, 0x2372A0U, 0x245D81U, 0x2B6088U, 0x082F58U, 0x083058U, 0x1F6896U, 0x206895U,
+  0x216E9BU, 0x216E9CU, 0x267BAAU, 0x277BAAU, 0x2474A3U, 0x2475A3U, 0x062C54U, 0x0F3753U,
+  0x1D6490U, 0x1D6491U, 0x10426CU, 0x10426DU, 0x134974U, 0x134A75U, 0x2981B1U, 0x2A82B1U,
+  0x2C628AU, 0x2E668DU, 0x195885U, 0x195985U, 0x15527EU, 0x16527EU, 0x010407U, 0x01070CU,
+  0x9EB4C5U, 0xA9B9C7U, 0x2C89B9U, 0x2D89B9U, 0x799BB4U, 0x76A0BAU, 0x16537FU, 0x17527EU,
+};
+
+static const uint8_t splash_pixels[23104] =
+{
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xF7, 0x64, 0xDA, 0x68, 0x8E, 0xCB,
+  0xCB, 0xA5, 0xA5, 0x19, 0x19, 0xA4, 0x19, 0x19, 0x19, 0x95, 0x95, 0x94, 0x94, 0x16, 0x16, 0x16,
+  0x16, 0x3E, 0xFA, 0xFA, 0xFA, 0x8D, 0x8D, 0x39, 0x39, 0xC4, 0xC4, 0xC4, 0x3F, 0x3F, 0x3F, 0x8B,
+  0x8B, 0x1A, 0x84, 0x1A, 0x84, 0xEE, 0x84, 0xEF, 0x7B, 0x99, 0x99, 0x98, 0x98, 0x15, 0x04, 0x04,
+  0x35, 0x35, 0x34, 0x27, 0x27, 0x27, 0xE2, 0xE3, 0xE2, 0x28, 0x28, 0x28, 0xCD, 0x5C, 0xCD, 0xCD,
+  0xCA, 0xCA, 0x42, 0xC9, 0xC9, 0x42, 0x42, 0x42, 0xE5, 0xE5, 0xE4, 0x1E, 0x1E, 0x21, 0x21, 0xD9,
+  0xD8, 0xD8, 0xA6, 0xA7, 0x46, 0x46, 0x51, 0xB1, 0x51, 0xE1, 0xE1, 0xE0, 0xAF, 0xAF, 0x90, 0x90,
+  0xAD, 0xAD, 0xAD, 0xAC, 0x92, 0x7D, 0xBD, 0xBD, 0xDE, 0xBD, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6F,
+  0xA1, 0x30, 0x30, 0x6E, 0x6E, 0x6E, 0x25, 0x25, 0xA2, 0x96, 0x08, 0x44, 0x70, 0xF6, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x48, 0x4E, 0x8E, 0xCC, 0xCB, 0xA5, 0xCB, 0xA4, 0xA5, 0xA4, 0xA4, 0xA4, 0x19, 0x19, 0x19, 0x19,
+  0x95, 0x95, 0x94, 0x94, 0x16, 0x16, 0x16, 0x3E, 0x3E, 0x3E, 0xFA, 0xFA, 0x8D, 0x39, 0x8D, 0x39,
+  0x39, 0x39, 0x3F, 0x3F, 0x8C, 0x8B, 0x3F, 0x1A, 0x1A, 0x1A, 0x1A, 0xEE, 0xEE, 0x84, 0xEE, 0xEE,
+  0x3D, 0x99, 0x98, 0x98, 0x04, 0x04, 0x35, 0x35, 0x35, 0x34, 0x34, 0x34, 0x27, 0x27, 0x27, 0xE2,
+  0x28, 0x28, 0xCD, 0xCE, 0xCD, 0x5C, 0x5C, 0xCA, 0x76, 0xC9, 0xC9, 0x42, 0x42, 0x42, 0x41, 0x41,
+  0xE5, 0xE5, 0x1E, 0x69, 0x21, 0x21, 0xD9, 0xD9, 0xA7, 0xA7, 0xA7, 0x46, 0x45, 0x46, 0x45, 0xB1,
+  0xB1, 0xE1, 0xE0, 0xAF, 0xAF, 0x8F, 0x90, 0x8F, 0xAD, 0xAC, 0x92, 0x91, 0x92, 0xBD, 0xBD, 0xDE,
+  0xBE, 0x72, 0x73, 0xCF, 0x72, 0xA1, 0xA1, 0xA1, 0x30, 0x30, 0x6E, 0x6E, 0x25, 0x25, 0x25, 0x25,
+  0xA2, 0xA2, 0xA9, 0xA9, 0xD2, 0xA9, 0x14, 0x47, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xF7, 0x4E, 0x02, 0xCC, 0xCC, 0xCC, 0xCC, 0xCB, 0xA4, 0xA4,
+  0xA4, 0xA4, 0xA4, 0xA4, 0x19, 0x19, 0x19, 0x95, 0x95, 0x94, 0x94, 0x16, 0x16, 0x16, 0x3E, 0x3E,
+  0xFA, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x39, 0x39, 0x39, 0x3F, 0x3F, 0x3F, 0x3F, 0x8B, 0x3F, 0x8B,
+  0x1A, 0x1A, 0x1A, 0xEE, 0x99, 0x3D, 0x3D, 0x99, 0x7B, 0x15, 0x15, 0x04, 0x04, 0x04, 0x34, 0x35,
+  0x34, 0x27, 0x27, 0x27, 0x27, 0xE3, 0xE3, 0x28, 0x28, 0xCD, 0xCE, 0xCD, 0x77, 0x76, 0x76, 0x76,
+  0xCA, 0xC9, 0xC9, 0x42, 0x41, 0x41, 0xE5, 0x69, 0x1E, 0x1E, 0x21, 0x21, 0x21, 0xD9, 0xD9, 0xA7,
+  0xA7, 0xA7, 0xA7, 0x46, 0x45, 0xB1, 0x45, 0xB1, 0xE1, 0xE1, 0xE0, 0x8F, 0x90, 0x8F, 0x90, 0xAC,
+  0xAD, 0x92, 0x91, 0x91, 0x7D, 0xBD, 0x73, 0xDE, 0x73, 0xCF, 0xCF, 0xA1, 0xA1, 0x72, 0x6F, 0x30,
+  0x6E, 0x30, 0x6E, 0x25, 0x25, 0x25, 0x25, 0xA2, 0xA2, 0xA2, 0xA9, 0xD3, 0xD2, 0xD3, 0x33, 0x7E,
+  0x64, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x48, 0xB3, 0xCC,
+  0x02, 0xCB, 0xCC, 0xCB, 0xCB, 0xCB, 0xA4, 0xA4, 0x19, 0x19, 0xA4, 0x19, 0x19, 0x19, 0x94, 0x95,
+  0x94, 0x94, 0x94, 0x16, 0x16, 0x3E, 0x3E, 0xFA, 0xFB, 0xFA, 0x8D, 0x8D, 0x39, 0x39, 0x39, 0x3F,
+  0xC4, 0xC4, 0x3F, 0x8B, 0x8B, 0x8B, 0x8B, 0x1A, 0x1A, 0x1A, 0xEE, 0x99, 0xEF, 0x99, 0x15, 0x3D,
+  0x15, 0x98, 0x04, 0x04, 0x35, 0x35, 0x34, 0x34, 0x34, 0x27, 0x27, 0x27, 0xE3, 0x28, 0xE3, 0x28,
+  0xCE, 0x28, 0xCD, 0xCD, 0x77, 0x5C, 0xCA, 0xCA, 0x42, 0xC9, 0x42, 0x41, 0x41, 0x42, 0xE5, 0x69,
+  0x1E, 0x21, 0x21, 0x1E, 0xD9, 0xD9, 0xD8, 0xA6, 0xA7, 0x46, 0x46, 0xB1, 0x51, 0xB0, 0xE1, 0xE1,
+  0xAF, 0xE0, 0x8F, 0x90, 0x90, 0x8F, 0xAD, 0xAC, 0xAC, 0x92, 0x92, 0xBD, 0xBE, 0xDE, 0xDE, 0x73,
+  0x72, 0xCF, 0xA1, 0xA1, 0xA1, 0xA1, 0x30, 0x30, 0x6E, 0x6E, 0x6E, 0x25, 0x23, 0xA2, 0xA2, 0xA9,
+  0x23, 0xA9, 0xA9, 0xA9, 0xD3, 0x33, 0x7E, 0xAB, 0xAB, 0x9F, 0x47, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x70, 0xB3, 0xCC, 0xCC, 0xCC, 0xCB, 0xCB, 0xCB, 0xCB, 0xA5, 0xA4, 0xA4,
+  0x19, 0x19, 0xA4, 0x19, 0x19, 0x95, 0x94, 0x16, 0x94, 0x16, 0x94, 0x16, 0x16, 0xFA, 0xFA, 0xFB,
+  0xFB, 0x8D, 0x8D, 0x8D, 0x39, 0x39, 0x39, 0x3F, 0x3F, 0x3F, 0x8B, 0x3F, 0x8B, 0x84, 0x1A, 0x84,
+  0x84, 0xEE, 0x99, 0xEF, 0x99, 0x98, 0x15, 0x04, 0x98, 0x98, 0x04, 0x35, 0x35, 0x35, 0x27, 0x34,
+  0x27, 0x27, 0xE3, 0xE2, 0x28, 0x28, 0x28, 0x28, 0x28, 0xCE, 0x5C, 0x77, 0xCA, 0xCA, 0xCA, 0xC9,
+  0xC9, 0x41, 0x41, 0xE5, 0xE5, 0xE5, 0x1E, 0x1E, 0x21, 0xD9, 0x21, 0xD9, 0xD9, 0xA7, 0xA6, 0xA7,
+  0x46, 0x46, 0x51, 0x46, 0x51, 0xE1, 0xE0, 0xE1, 0xAF, 0xE0, 0xAE, 0x90, 0x8F, 0xAD, 0xAC, 0x91,
+  0x92, 0x91, 0xBD, 0xBD, 0xBD, 0xDE, 0x73, 0x72, 0xCF, 0xA1, 0xA1, 0xA1, 0xA1, 0x6F, 0xA1, 0x6E,
+  0x6E, 0x25, 0x6E, 0x25, 0xA2, 0xA2, 0xA2, 0x23, 0xA9, 0xA8, 0x33, 0xD3, 0x7E, 0x33, 0x11, 0xAB,
+  0x0B, 0xAA, 0x9F, 0x48, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x48, 0xB3, 0x02, 0xCC, 0xCC,
+  0xCC, 0xCB, 0xCB, 0xA4, 0xA4, 0x19, 0xA4, 0xA4, 0x19, 0x19, 0x19, 0x19, 0x95, 0x95, 0x94, 0x94,
+  0x16, 0x16, 0x16, 0x3E, 0x3E, 0xFA, 0xFA, 0xFB, 0x8D, 0x8D, 0x8D, 0x8D, 0x39, 0xC4, 0xC4, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x8B, 0x1A, 0x1A, 0xEE, 0xEE, 0xEE, 0xEF, 0xEF, 0x3D, 0x98, 0x98, 0x98,
+  0x7B, 0x04, 0x35, 0x35, 0x35, 0x35, 0x27, 0x34, 0x27, 0x27, 0xE2, 0xE3, 0xE3, 0x28, 0x28, 0xCD,
+  0xCD, 0x77, 0x5C, 0xCA, 0xCA, 0xC9, 0x42, 0x42, 0x41, 0x41, 0x41, 0xE5, 0xE5, 0xE4, 0x69, 0x1E,
+  0x21, 0x21, 0xD9, 0xD9, 0xA7, 0xA6, 0x46, 0x46, 0x46, 0x46, 0x51, 0xB1, 0xB0, 0xE0, 0xE0, 0xAF,
+  0xAF, 0x90, 0x90, 0xAD, 0xAD, 0x92, 0x92, 0x92, 0x91, 0x7D, 0xBD, 0xBD, 0x73, 0xDE, 0x73, 0xCF,
+  0x72, 0xA1, 0xA1, 0xA0, 0x30, 0x6E, 0x6E, 0x25, 0x6E, 0x25, 0x25, 0xA2, 0xA2, 0xA9, 0xA2, 0xA9,
+  0xD2, 0xD3, 0x33, 0x11, 0x0A, 0x11, 0x7E, 0xAB, 0xAA, 0x0B, 0x36, 0x9F, 0x47, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0xF7, 0xB3, 0xCC, 0xCC, 0xCC, 0xCB, 0xCB, 0xCB, 0xA5, 0xA4, 0xA4, 0xA4, 0x19, 0x19,
+  0x19, 0x19, 0x19, 0x95, 0x95, 0x94, 0x94, 0x16, 0x16, 0x16, 0xFA, 0x3E, 0x3E, 0xFB, 0x8D, 0x8D,
+  0x8D, 0x39, 0x39, 0x39, 0xC4, 0xC4, 0xC4, 0x3F, 0x8B, 0x8B, 0x8B, 0x8B, 0x84, 0x1A, 0x1A, 0xEF,
+  0x84, 0x99, 0xEF, 0x15, 0x98, 0x98, 0x15, 0x04, 0x04, 0x04, 0x35, 0x35, 0x34, 0x27, 0x34, 0x27,
+  0xE2, 0x27, 0xE2, 0xE3, 0x28, 0xCE, 0x28, 0xCD, 0x77, 0x77, 0x77, 0x76, 0xCA, 0x41, 0xCA, 0x42,
+  0x41, 0x42, 0xE5, 0xE5, 0x69, 0x69, 0x21, 0x1E, 0x21, 0xD9, 0xD9, 0xA7, 0x46, 0xA7, 0x46, 0x46,
+  0x45, 0xB1, 0x45, 0xE1, 0xE1, 0xE1, 0xAE, 0x8F, 0x90, 0xAE, 0x90, 0x90, 0xAC, 0x91, 0xAC, 0x91,
+  0x91, 0x7D, 0xDE, 0xDE, 0xBE, 0x73, 0x72, 0xA1, 0x72, 0xA1, 0xA1, 0xA1, 0x30, 0x30, 0x6E, 0x6E,
+  0x25, 0x7A, 0x23, 0x23, 0xA9, 0xA9, 0xA9, 0xD3, 0xD2, 0xD3, 0xD3, 0x11, 0x11, 0x0B, 0xAB, 0x0B,
+  0x0B, 0x36, 0xD5, 0xD5, 0x5B, 0xF6, 0x01, 0x01, 0x01, 0x01, 0x4E, 0xCC, 0xCC, 0xCC, 0xCB, 0xCB,
+  0xA5, 0xCB, 0xA4, 0xA4, 0x19, 0xA5, 0x19, 0x19, 0x19, 0x95, 0x95, 0x94, 0x94, 0x94, 0x16, 0x16,
+  0x16, 0x3E, 0x3E, 0xFA, 0x3E, 0x8D, 0x8D, 0x8D, 0x8D, 0x8D, 0x39, 0xC4, 0xC4, 0x3F, 0x8B, 0x3F,
+  0x3F, 0x8B, 0x84, 0x1A, 0x1A, 0x84, 0xEE, 0x84, 0xEE, 0x7B, 0x3D, 0x99, 0x04, 0x98, 0x15, 0x04,
+  0x04, 0x35, 0x34, 0x34, 0x34, 0x34, 0x27, 0xE3, 0xE2, 0xE3, 0x28, 0x28, 0xCD, 0xCD, 0x77, 0x5C,
+  0x77, 0x76, 0x76, 0x76, 0xC9, 0x42, 0x41, 0x41, 0xE5, 0xE5, 0x69, 0xE5, 0x69, 0x21, 0x21, 0x21,
+  0xD9, 0xD9, 0xA7, 0xA6, 0xA7, 0x46, 0xA7, 0x46, 0x46, 0xB1, 0xE1, 0xE1, 0xE1, 0xAF, 0xE0, 0xAF,
+  0x90, 0x90, 0x8F, 0x92, 0xAC, 0xAC, 0x7D, 0xBD, 0xBD, 0xBD, 0x73, 0x73, 0xDF, 0xCF, 0xA1, 0xA1,
+  0xA1, 0x6F, 0x6F, 0x6E, 0x6E, 0x6E, 0x6E, 0x25, 0x25, 0x23, 0x23, 0xA2, 0xA9, 0xD3, 0xD3, 0xA8,
+  0xD3, 0x33, 0x11, 0xAB, 0xAB, 0x0B, 0xAA, 0xAA, 0x97, 0x97, 0xD5, 0xD5, 0xD4, 0x64, 0x01, 0x01,
+  0x01, 0x48, 0x02, 0xCC, 0xCC, 0xCB, 0xCB, 0xCB, 0xA4, 0xA4, 0xA4, 0xA4, 0x19, 0x19, 0x19, 0x19,
+  0x19, 0x95, 0x94, 0x94, 0x94, 0x16, 0x16, 0x16, 0x3E, 0xFA, 0xFA, 0xFA, 0xFB, 0x39, 0x39, 0x8D,
+  0x39, 0x39, 0xC4, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x1A, 0x1A, 0x84, 0x1A, 0x84, 0x84, 0x99, 0xEF,
+  0xEE, 0xEE, 0x99, 0x04, 0x7B, 0x98, 0x35, 0x04, 0x35, 0x35, 0x34, 0x27, 0x27, 0x34, 0x27, 0xE3,
+  0x28, 0x28, 0x28, 0x28, 0xCD, 0xCD, 0x77, 0x77, 0x76, 0xCA, 0xC9, 0xC9, 0xC9, 0x41, 0x41, 0x42,
+  0xE5, 0xE5, 0x1E, 0x69, 0x1E, 0x21, 0xD9, 0xD9, 0xD9, 0xA6, 0xA7, 0x46, 0x46, 0x46, 0x45, 0x51,
+  0x45, 0xE1, 0xAF, 0xAF, 0xE0, 0x8F, 0x90, 0x90, 0x8F, 0xAD, 0xAD, 0xAC, 0x92, 0x91, 0x7D, 0x7D,
+  0xBE, 0xBE, 0xDE, 0x73, 0x72, 0x72, 0x72, 0xA1, 0x30, 0x6F, 0x6E, 0x30, 0x6E, 0x25, 0x25, 0x23,
+  0x23, 0x23, 0xA9, 0xA9, 0xA9, 0xA9, 0xD3, 0x33, 0x0A, 0x0A, 0x11, 0x7E, 0xAA, 0xAA, 0xAA, 0x97,
+  0x97, 0x97, 0x6B, 0xD5, 0x6B, 0x58, 0x47, 0x01, 0x01, 0xDA, 0xCC, 0xCB, 0xCB, 0xCB, 0xA5, 0xA5,
+  0xA4, 0xA5, 0xA4, 0xA4, 0x19, 0x19, 0x95, 0x95, 0x19, 0x94, 0x16, 0x94, 0x94, 0x16, 0x16, 0x3E,
+  0x3E, 0x3E, 0xFB, 0xFB, 0x8D, 0x8D, 0x8D, 0x8D, 0x39, 0x3F, 0x3F, 0x3F, 0x3F, 0x8B, 0x8B, 0x1A,
+  0x1A, 0x84, 0x1A, 0x1A, 0xEE, 0x84, 0xEF, 0x99, 0x99, 0x3D, 0x98, 0x7B, 0x04, 0x04, 0x04, 0x35,
+  0x34, 0x35, 0x34, 0x27, 0x27, 0x27, 0xE3, 0x27, 0x28, 0xE3, 0x28, 0xCD, 0xCD, 0x77, 0x77, 0x5C,
+  0xCA, 0xCA, 0xC9, 0x42, 0x42, 0x41, 0xE5, 0x41, 0xE5, 0x69, 0x69, 0x21, 0x21, 0x21, 0xD9, 0xD9,
+  0xA6, 0xA6, 0x46, 0x46, 0x46, 0x45, 0x45, 0xE1, 0xB1, 0xB0, 0xAF, 0xAF, 0xAF, 0x8F, 0x90, 0x8F,
+  0xAC, 0xAD, 0x92, 0x91, 0x92, 0x7D, 0xBD, 0xBE, 0xBE, 0x73, 0x72, 0x72, 0xA1, 0xA1, 0xA1, 0xA1,
+  0x30, 0x6E, 0x6E, 0x6E, 0x25, 0x25, 0x25, 0xA2, 0x23, 0x23, 0xA2, 0xA9, 0xA9, 0xD3, 0xD3, 0x33,
+  0x11, 0xAB, 0xAB, 0x0B, 0xAA, 0xAA, 0x0B, 0x97, 0xD5, 0xD5, 0xD5, 0xD4, 0x57, 0x57, 0x82, 0x01,
+  0xF7, 0xCC, 0xCC, 0xCB, 0xCB, 0xCB, 0xA5, 0xA4, 0xA5, 0xA4, 0x19, 0xA4, 0x19, 0x19, 0x19, 0x95,
+  0x94, 0x94, 0x94, 0x16, 0x16, 0x16, 0x3E, 0x3E, 0x3E, 0xFA, 0x8D, 0x8D, 0x8D, 0x39, 0x39, 0x3F,
+  0x39, 0xC4, 0x8C, 0x3F, 0x3F, 0x3F, 0x1A, 0x8B, 0x8B, 0x1A, 0x84, 0xEE, 0xEE, 0xEE, 0x99, 0x15,
+  0x98, 0x04, 0x04, 0x15, 0x04, 0x35, 0x35, 0x35, 0x34, 0x34, 0x27, 0x27, 0xE2, 0xE2, 0xE2, 0x28,
+  0x28, 0xCD, 0xCE, 0x5C, 0x5C, 0x76, 0x76, 0x76, 0xCA, 0xC9, 0xC9, 0x42, 0x41, 0x41, 0x41, 0xE5,
+  0xE4, 0x1E, 0x69, 0x21, 0x21, 0xD9, 0xD9, 0xA6, 0xA6, 0x46, 0x46, 0x46, 0x46, 0xB1, 0xB1, 0xE1,
+  0xB0, 0xAF, 0xAF, 0xAF, 0x90, 0x90, 0xAD, 0x8F, 0xAD, 0x91, 0x91, 0x91, 0x91, 0x7D, 0xBD, 0xDE,
+  0xDE, 0xCF, 0x72, 0xA1, 0x72, 0xA1, 0xA0, 0x30, 0x6F, 0x6E, 0x6E, 0x6E, 0x25, 0x23, 0x25, 0xA2,
+  0x23, 0xA9, 0xA9, 0xD3, 0xD3, 0xD3, 0x7E, 0x0A, 0xAB, 0xAB, 0xAB, 0xAB, 0x0B, 0x0B, 0x97, 0xD5,
+  0xD5, 0xD4, 0xD4, 0x57, 0x57, 0x1B, 0x65, 0xF6, 0x64, 0xCB, 0xCC, 0xCB, 0xA5, 0xCB, 0xA4, 0xA4,
+  0x19, 0xA4, 0xA4, 0x19, 0x19, 0x19, 0x94, 0x94, 0x95, 0x16, 0x94, 0x16, 0x16, 0x3E, 0x3E, 0xFA,
+  0xFA, 0x8D, 0x39, 0x8D, 0x8D, 0x39, 0x39, 0xC4, 0xC4, 0xC4, 0x3F, 0x3F, 0x3F, 0x8B, 0x8B, 0x8B,
+  0x1A, 0x1A, 0xEE, 0xEE, 0xEE, 0xEE, 0x3D, 0x15, 0x15, 0x04, 0x98, 0x04, 0x04, 0x35, 0x35, 0x34,
+  0x27, 0x27, 0x27, 0x27, 0xE3, 0xE2, 0x28, 0x28, 0xCE, 0x28, 0xCD, 0x5C, 0x77, 0x76, 0x76, 0xCA,
+  0xC9, 0x41, 0x42, 0x41, 0xE5, 0xE5, 0x69, 0x1E, 0x69, 0x69, 0x21, 0x21, 0xD9, 0xD9, 0xA6, 0xA7,
+  0xA7, 0x46, 0x46, 0x45, 0x45, 0xB1, 0xB0, 0xB0, 0xE1, 0xAF, 0xAE, 0xAF, 0x8F, 0x8F, 0x8F, 0x92,
+  0x92, 0x92, 0x91, 0x91, 0xBD, 0xDE, 0x73, 0x73, 0x72, 0x72, 0x72, 0xCF, 0xA1, 0xA1, 0x6F, 0x30,
+  0x6E, 0x6E, 0x6E, 0x25, 0x25, 0x25, 0x23, 0xA9, 0xA9, 0xA8, 0xD3, 0xD3, 0xD3, 0x11, 0x11, 0xAB,
+  0xAB, 0xAB, 0x0B, 0xAA, 0x97, 0x36, 0x97, 0xD5, 0xD5, 0x58, 0x6B, 0x57, 0x57, 0xF3, 0x3B, 0x70,
+  0xDA, 0xCB, 0xA5, 0xA5, 0xA5, 0xA4, 0xA4, 0xA4, 0x19, 0xA4, 0x19, 0x19, 0x19, 0x95, 0x95, 0x94,
+  0x94, 0x16, 0x3E, 0x3E, 0x3E, 0x3E, 0xFA, 0xFA, 0xFA, 0x8D, 0x8D, 0x8D, 0x39, 0x39, 0x3F, 0xC4,
+  0x3F, 0x3F, 0x3F, 0x8B, 0x8B, 0x8B, 0x8B, 0x1A, 0x1A, 0x84, 0x99, 0xEE, 0xEE, 0x3D, 0x99, 0x04,
+  0x7B, 0x04, 0x04, 0x04, 0x35, 0x34, 0x34, 0x34, 0x34, 0x27, 0xE2, 0x27, 0xE2, 0x28, 0x28, 0x28,
+  0x28, 0xCD, 0x5C, 0x77, 0x77, 0xCA, 0xC9, 0xC9, 0x42, 0x41, 0x42, 0x41, 0xE4, 0xE5, 0xE4, 0x1E,
+  0x21, 0x21, 0x21, 0xD9, 0xD9, 0xA6, 0xA7, 0xA6, 0x46, 0x51, 0x46, 0x45, 0x51, 0xE1, 0xB0, 0xE0,
+  0xAF, 0x8F, 0x90, 0x90, 0x90, 0xAD, 0xAC, 0x92, 0x91, 0x92, 0x91, 0xDE, 0xBE, 0xBE, 0x73, 0x73,
+  0xCF, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0x6E, 0x30, 0x30, 0x25, 0x25, 0x25, 0xA2, 0x23, 0xA9, 0xA2,
+  0xA9, 0xA8, 0x33, 0x33, 0x0A, 0x11, 0xAB, 0x0B, 0xAB, 0xAA, 0xAA, 0x97, 0x97, 0xD5, 0xD4, 0x1B,
+  0x6B, 0x1B, 0x57, 0x57, 0xB6, 0xF3, 0x3A, 0x75, 0x68, 0xCB, 0xA5, 0xCB, 0xA5, 0xA5, 0xA4, 0xA4,
+  0x19, 0x19, 0x19, 0x19, 0x95, 0x94, 0x94, 0x94, 0x16, 0x16, 0x16, 0xFA, 0x3E, 0xFA, 0xFA, 0xFA,
+  0x39, 0x39, 0x8D, 0x39, 0x39, 0xC4, 0x39, 0x3F, 0x8C, 0x3F, 0x3F, 0x1A, 0x84, 0x1A, 0xEE, 0x84,
+  0x84, 0xEE, 0xEE, 0x3D, 0x3D, 0x3D, 0x7B, 0x04, 0x04, 0x04, 0x35, 0x35, 0x35, 0x34, 0x34, 0x34,
+  0x27, 0xE2, 0xE2, 0xE3, 0x28, 0x28, 0x28, 0x28, 0xCD, 0x5C, 0x77, 0x77, 0xC9, 0x42, 0xC9, 0xC9,
+  0x41, 0x42, 0x41, 0x1E, 0xE5, 0x69, 0x21, 0x21, 0x21, 0xD9, 0xD9, 0xD9, 0xA6, 0xA7, 0xA7, 0x46,
+  0x46, 0xB1, 0xB1, 0xB1, 0xE1, 0xE1, 0xE0, 0x8F, 0xAF, 0x8F, 0x8F, 0x90, 0x8F, 0xAC, 0x92, 0xAC,
+  0x92, 0xBD, 0x7D, 0xBE, 0xBE, 0x73, 0xCF, 0x72, 0xA1, 0xA1, 0xA1, 0x6F, 0x6F, 0x6F, 0x6E, 0x6E,
+  0x25, 0x25, 0x25, 0xA2, 0x23, 0xA2, 0xA9, 0xD2, 0xA9, 0xA8, 0xD3, 0x33, 0x7E, 0x11, 0xAB, 0xAB,
+  0xAA, 0x0B, 0x0B, 0x97, 0x97, 0xD4, 0xD4, 0x6B, 0x6B, 0x57, 0xF3, 0x57, 0x3B, 0x3A, 0xF3, 0x2E,
+  0x8E, 0xA5, 0xA5, 0xA5, 0xA5, 0xA4, 0xA4, 0x19, 0x19, 0x95, 0x95, 0x95, 0x95, 0x94, 0x94, 0x94,
+  0x16, 0x16, 0x3E, 0x3E, 0xFA, 0xFA, 0x8D, 0xFB, 0x39, 0x8D, 0x8D, 0x3F, 0xC4, 0xC4, 0x3F, 0x3F,
+  0x8B, 0x3F, 0x8B, 0x84, 0x1A, 0x1A, 0xEE, 0x84, 0x99, 0x99, 0x15, 0x99, 0x3D, 0x98, 0x7B, 0x04,
+  0x04, 0x04, 0x35, 0x34, 0x34, 0x34, 0x34, 0xE2, 0xE2, 0x27, 0x27, 0xE3, 0x28, 0x28, 0xCD, 0x77,
+  0xCD, 0x77, 0x5C, 0x76, 0xC9, 0xC9, 0xC9, 0x42, 0x41, 0x41, 0xE5, 0xE5, 0x69, 0x69, 0x1E, 0x21,
+  0xD9, 0xD9, 0xA6, 0xA7, 0xA6, 0x46, 0xA7, 0x46, 0x51, 0x45, 0xB1, 0xE1, 0xE1, 0xE1, 0xAF, 0xAF,
+  0x8F, 0x90, 0x8F, 0xAD, 0xAC, 0x92, 0x92, 0x91, 0x7D, 0xDE, 0xDE, 0xDE, 0x73, 0x72, 0xCF, 0x72,
+  0xA1, 0xA1, 0xA1, 0x6F, 0x30, 0x6E, 0x6E, 0x25, 0x25, 0x25, 0x25, 0x25, 0xA2, 0xA9, 0xD2, 0xD3,
+  0x33, 0xD2, 0xD3, 0x11, 0x7E, 0xAB, 0xAB, 0xAA, 0x36, 0x36, 0x97, 0xD5, 0xD4, 0x1B, 0x1B, 0x6B,
+  0x57, 0x1B, 0x3A, 0xF3, 0x3A, 0x3B, 0x3A, 0x09, 0xA5, 0xCB, 0xA4, 0xA4, 0x19, 0xA4, 0xA4, 0x19,
+  0x19, 0x19, 0x94, 0x95, 0x95, 0x94, 0x94, 0x16, 0x3E, 0x16, 0x3E, 0x3E, 0xFB, 0xFA, 0x8D, 0x8D,
+  0x39, 0x39, 0x39, 0xC4, 0xC4, 0xC4, 0x8C, 0x3F, 0x8B, 0x3F, 0x84, 0x1A, 0x84, 0x1A, 0x1A, 0xEE,
+  0xEE, 0x99, 0x15, 0x98, 0x15, 0x7B, 0x04, 0x04, 0x04, 0x35, 0x34, 0x34, 0x34, 0x27, 0x27, 0xE2,
+  0xE3, 0xE3, 0x28, 0x28, 0x28, 0x28, 0xCD, 0xCD, 0x77, 0x77, 0xCA, 0xC9, 0xC9, 0xC9, 0x41, 0x42,
+  0x42, 0xE5, 0xE5, 0xE4, 0x69, 0x1E, 0x21, 0x21, 0xD9, 0xD9, 0xA7, 0xA7, 0xA7, 0x46, 0x46, 0x46,
+  0x45, 0xE1, 0xE1, 0xE1, 0xAF, 0xAF, 0xAF, 0x8F, 0x8F, 0xAD, 0xAD, 0xAD, 0xAC, 0x92, 0x91, 0x91,
+  0xBD, 0xBD, 0x73, 0xDF, 0x73, 0xCF, 0xA1, 0xA1, 0x6F, 0xA0, 0x6F, 0x6F, 0x6E, 0x6E, 0x25, 0x25,
+  0x23, 0x23, 0xA9, 0x23, 0xA9, 0xA9, 0xD2, 0xD2, 0xD3, 0x33, 0x0A, 0xAB, 0xAB, 0xAB, 0x36, 0x0B,
+  0x0B, 0xD5, 0x97, 0xD4, 0x6B, 0x58, 0x6B, 0x57, 0x57, 0x57, 0xF3, 0x3A, 0x3A, 0xF2, 0x3A, 0x6C,
+  0xA5, 0xCB, 0xA4, 0xA4, 0xA4, 0xA4, 0x19, 0x19, 0x19, 0x19, 0x94, 0x95, 0x94, 0x16, 0x16, 0x3E,
+  0x3E, 0x3E, 0xFA, 0xFA, 0xFA, 0x8D, 0x8D, 0x8D, 0x39, 0x39, 0x39, 0x39, 0x3F, 0x8C, 0x3F, 0x8B,
+  0x8B, 0x84, 0x1A, 0x1A, 0x84, 0x84, 0x84, 0x3D, 0x3D, 0x15, 0x15, 0x98, 0x7B, 0x04, 0x04, 0x04,
+  0x35, 0x35, 0x34, 0x34, 0x34, 0x27, 0xE3, 0xE2, 0xE3, 0x28, 0x28, 0xCD, 0xCE, 0xCE, 0x5C, 0x76,
+  0x5C, 0x76, 0xC9, 0x5C, 0xC9, 0x41, 0x41, 0xE5, 0xE5, 0x1E, 0x69, 0x69, 0x21, 0x1E, 0x21, 0xD9,
+  0xD9, 0xA7, 0xA7, 0x46, 0x46, 0x46, 0xB1, 0xB0, 0xE1, 0xB0, 0xE1, 0xB0, 0xAF, 0xAE, 0x90, 0xAE,
+  0x90, 0xAD, 0xAC, 0x92, 0x91, 0x91, 0x7D, 0xDE, 0xBD, 0xBE, 0x73, 0x72, 0xCF, 0xA1, 0xA1, 0xA1,
+  0xA1, 0x30, 0x30, 0x6E, 0x6E, 0x6E, 0x25, 0xE8, 0xA2, 0xA2, 0xA2, 0xA2, 0xA8, 0xA8, 0xD3, 0xD3,
+  0x33, 0x7E, 0xAB, 0x7E, 0xAA, 0xAA, 0x0B, 0x97, 0x97, 0x97, 0xD5, 0xD4, 0x58, 0x1B, 0x57, 0xB6,
+  0xF3, 0xF3, 0x3A, 0xF3, 0x3A, 0x3A, 0x83, 0x6D, 0xA4, 0xA5, 0xA4, 0xA4, 0x19, 0x19, 0x19, 0x19,
+  0x95, 0x94, 0x94, 0x94, 0x16, 0x16, 0x16, 0x3E, 0x3E, 0xFA, 0xFB, 0xFA, 0x8D, 0x8D, 0x8D, 0x39,
+  0x39, 0x3F, 0x3F, 0x8C, 0x3F, 0x3F, 0x3F, 0x1A, 0x8B, 0x84, 0x1A, 0x84, 0xEE, 0xEE, 0x99, 0xEE,
+  0x15, 0x3D, 0x98, 0x15, 0x15, 0x04, 0x04, 0x35, 0x35, 0x27, 0x34, 0x27, 0x27, 0x27, 0x27, 0xE2,
+  0x28, 0x28, 0xCD, 0xCE, 0xCD, 0x77, 0x77, 0x77, 0xCA, 0xC9, 0x42, 0x42, 0x41, 0x41, 0x42, 0xE5,
+  0xE5, 0xE5, 0xE4, 0x21, 0x21, 0x21, 0xD9, 0xD8, 0xA6, 0xA6, 0xA7, 0xA7, 0x46, 0x51, 0xB1, 0xB1,
+  0xE1, 0xE1, 0xE1, 0xAF, 0xAF, 0x90, 0xAE, 0xAD, 0x90, 0xAD, 0x92, 0x91, 0x92, 0x91, 0x91, 0xBD,
+  0x73, 0x73, 0x73, 0x72, 0xA1, 0x72, 0xA1, 0xA1, 0x30, 0x6F, 0x6E, 0x6E, 0x25, 0x25, 0x25, 0x23,
+  0xA2, 0x23, 0xA9, 0xA9, 0xD2, 0xD2, 0x33, 0x33, 0x11, 0x7E, 0xAB, 0x7E, 0xAA, 0x0B, 0x97, 0x36,
+  0x97, 0xD5, 0xD5, 0x6B, 0x57, 0x57, 0x57, 0xF3, 0xF3, 0x3B, 0xF3, 0x3B, 0x3A, 0x6C, 0x6D, 0x6D,
+  0xA4, 0x19, 0xA4, 0xA4, 0x19, 0x19, 0x19, 0x19, 0x95, 0x94, 0x94, 0x16, 0x16, 0x16, 0x3E, 0x3E,
+  0x3E, 0xFA, 0xFA, 0x8D, 0x39, 0x39, 0x39, 0x3F, 0xC4, 0xC4, 0x3F, 0x3F, 0x8B, 0x8B, 0x8B, 0x8B,
+  0x1A, 0x8B, 0x1A, 0xEF, 0x84, 0xEF, 0x3D, 0x3D, 0x15, 0x15, 0x98, 0x04, 0x04, 0x35, 0x35, 0x35,
+  0x35, 0x34, 0x34, 0x27, 0xE2, 0xE3, 0x28, 0x28, 0xCE, 0xCD, 0xCE, 0xCE, 0x77, 0x77, 0x77, 0xCA,
+  0xCA, 0x42, 0xC9, 0x42, 0x41, 0xE5, 0xE5, 0x1E, 0x69, 0x1E, 0x21, 0x21, 0x21, 0xD9, 0xD9, 0x46,
+  0xA6, 0x46, 0x46, 0x45, 0x46, 0xB1, 0x51, 0xB0, 0xE1, 0xAF, 0xAE, 0xAF, 0xAF, 0x90, 0x8F, 0x8F,
+  0xAD, 0xAC, 0x92, 0x92, 0x7D, 0xBD, 0xBE, 0xDE, 0x73, 0x72, 0xCF, 0xA1, 0xA1, 0xA1, 0xA0, 0xA1,
+  0x30, 0x6E, 0x6E, 0x6E, 0x25, 0x25, 0x23, 0xA2, 0x23, 0xA9, 0xA9, 0xD3, 0xD3, 0x33, 0x11, 0x33,
+  0x7E, 0xAB, 0x0B, 0x0B, 0x0B, 0x36, 0x36, 0x6B, 0x6B, 0xD5, 0x6B, 0x58, 0x57, 0x57, 0xF3, 0xF3,
+  0xF2, 0xF3, 0x3A, 0x83, 0x6D, 0x6D, 0x6D, 0x6C, 0xA4, 0xA4, 0xA4, 0x19, 0x19, 0x19, 0x95, 0x95,
+  0x94, 0x94, 0x16, 0x16, 0x16, 0x16, 0x3E, 0x3E, 0x8D, 0x8D, 0x8D, 0x39, 0x39, 0x39, 0x39, 0xC4,
+  0x3F, 0x3F, 0x3F, 0x8B, 0x8B, 0x1A, 0x8B, 0x84, 0x1A, 0x1A, 0xEE, 0x84, 0xEE, 0xEE, 0x3D, 0x98,
+  0x04, 0x98, 0x04, 0x04, 0x35, 0x35, 0x35, 0x35, 0x34, 0x27, 0x27, 0xE3, 0xE3, 0xE3, 0x28, 0x28,
+  0x28, 0xCD, 0xCD, 0x5C, 0x5C, 0xCA, 0xCA, 0xC9, 0x42, 0xC9, 0x42, 0x41, 0xE5, 0xE5, 0x1E, 0x1E,
+  0x21, 0x21, 0x21, 0xD9, 0x21, 0xD8, 0xA6, 0xA6, 0xA6, 0xA7, 0x46, 0x45, 0x51, 0xE1, 0xE1, 0xB0,
+  0xE0, 0xAF, 0xAE, 0x90, 0x8F, 0x90, 0xAD, 0xAC, 0x92, 0x92, 0x7D, 0x91, 0x91, 0xBD, 0x73, 0x73,
+  0x72, 0xCF, 0x72, 0xA1, 0x72, 0xA1, 0x30, 0x30, 0x6E, 0x6E, 0x25, 0x25, 0x25, 0x25, 0x23, 0x23,
+  0xA2, 0xA9, 0xA9, 0xD2, 0x33, 0x0A, 0x11, 0x11, 0xAB, 0xAA, 0x0B, 0x36, 0x36, 0xD5, 0xD5, 0xD4,
+  0xD5, 0x1B, 0x6B, 0x58, 0x57, 0xF3, 0xF3, 0xF2, 0x3A, 0x3A, 0x3B, 0xC8, 0x6D, 0x83, 0x10, 0x6C,
+  0x19, 0x19, 0x19, 0x19, 0x19, 0x95, 0x94, 0x94, 0x94, 0x16, 0x16, 0x16, 0x3E, 0x3E, 0xFB, 0xFA,
+  0x8D, 0x39, 0x39, 0x39, 0x8D, 0x39, 0x39, 0x3F, 0x3F, 0x8C, 0x8B, 0x8B, 0x84, 0x8B, 0x1A, 0x1A,
+  0x1A, 0xEE, 0xEE, 0xEE, 0x3D, 0x3D, 0x15, 0x98, 0x04, 0x15, 0x04, 0x35, 0x04, 0x35, 0x34, 0x34,
+  0x27, 0x27, 0xE2, 0xE2, 0x28, 0x28, 0x28, 0x28, 0xCE, 0xCD, 0x5C, 0x77, 0x76, 0x76, 0xCA, 0xC9,
+  0x42, 0x42, 0x41, 0x41, 0xE5, 0xE5, 0x1E, 0x69, 0x1E, 0x21, 0x21, 0x21, 0xD9, 0xA6, 0xA6, 0xA7,
+  0x46, 0x51, 0x46, 0xB1, 0x51, 0xE1, 0xB0, 0xB0, 0xAF, 0xAF, 0xAE, 0x8F, 0x8F, 0xAC, 0xAC, 0x92,
+  0x92, 0x92, 0x7D, 0x7D, 0xBD, 0xBE, 0x73, 0xCF, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0x30, 0x30, 0x6E,
+  0x6E, 0x6E, 0x25, 0x23, 0x25, 0x23, 0x23, 0xA9, 0xA9, 0xA9, 0xA9, 0xD3, 0x33, 0x11, 0xAB, 0xAB,
+  0xAB, 0xAB, 0x36, 0x97, 0x36, 0x97, 0xD5, 0x6B, 0x6B, 0x6B, 0x57, 0xF3, 0xF3, 0xF3, 0x3B, 0x3A,
+  0x3A, 0x3B, 0x6C, 0x6D, 0x6C, 0x83, 0xC8, 0x10, 0x19, 0x19, 0x19, 0x19, 0x19, 0x94, 0x95, 0x94,
+  0x16, 0x16, 0x16, 0x3E, 0x3E, 0x3E, 0xFA, 0x8D, 0x8D, 0x8D, 0x8D, 0x39, 0x39, 0xC4, 0x8C, 0x3F,
+  0x3F, 0x8B, 0x8B, 0x1A, 0x8B, 0x8B, 0x84, 0x1A, 0x1A, 0xEE, 0xEE, 0xEF, 0x3D, 0x99, 0x7B, 0x04,
+  0x04, 0x04, 0x35, 0x35, 0x35, 0x35, 0x34, 0x34, 0x27, 0x27, 0xE2, 0x28, 0x28, 0x28, 0x28, 0xCD,
+  0xCD, 0xCD, 0x5C, 0x76, 0x76, 0xCA, 0x42, 0x42, 0x41, 0xE5, 0x41, 0xE5, 0xE5, 0x1E, 0x1E, 0x21,
+  0x21, 0x21, 0xD9, 0xD9, 0xD9, 0x46, 0x46, 0x46, 0xA7, 0xB1, 0xB1, 0xB1, 0xB0, 0xE0, 0xE1, 0xAF,
+  0xAF, 0x90, 0xAD, 0x8F, 0xAC, 0xAC, 0xAC, 0x92, 0x92, 0x7D, 0x7D, 0xBE, 0xDE, 0xBE, 0xCF, 0x72,
+  0x72, 0xA1, 0xA1, 0xA0, 0x30, 0x6E, 0x6E, 0x6E, 0x25, 0x25, 0x25, 0x23, 0xA2, 0xA9, 0xA2, 0xA9,
+  0xD3, 0xD3, 0xD3, 0x11, 0x0A, 0x11, 0x7E, 0xAB, 0xAA, 0x0B, 0x36, 0x36, 0x97, 0xD5, 0x6B, 0x1B,
+  0x1B, 0x57, 0x57, 0x3A, 0xF3, 0xF2, 0xF2, 0x3B, 0x6C, 0x6C, 0x6D, 0x6C, 0x83, 0x83, 0xC7, 0x65,
+  0x19, 0x19, 0x19, 0x95, 0x95, 0x94, 0x94, 0x16, 0x16, 0x16, 0x3E, 0x3E, 0x3E, 0xFA, 0xFA, 0x8D,
+  0x8D, 0x8D, 0x39, 0x39, 0x3F, 0x3F, 0x3F, 0x8C, 0x3F, 0x3F, 0x8B, 0x8B, 0x84, 0x1A, 0x1A, 0x1A,
+  0xEE, 0xEF, 0x3D, 0x3D, 0x98, 0x98, 0x04, 0x04, 0x04, 0x04, 0x35, 0x34, 0x35, 0x34, 0x27, 0x27,
+  0xE3, 0xE2, 0xE3, 0xE3, 0x28, 0x28, 0xCD, 0x77, 0x5C, 0x77, 0xCA, 0xCA, 0xCA, 0xC9, 0xC9, 0x41,
+  0x41, 0xE5, 0x41, 0xE5, 0x1E, 0x69, 0x21, 0x21, 0xD9, 0x21, 0xD9, 0xD8, 0xA6, 0xA6, 0x46, 0x51,
+  0xB1, 0x51, 0xE1, 0xB1, 0xAF, 0xE1, 0xAF, 0xAE, 0x90, 0x90, 0x8F, 0x8F, 0xAC, 0xAC, 0x92, 0x91,
+  0x91, 0xBD, 0xBE, 0xBD, 0xDE, 0x73, 0x72, 0xCF, 0xA1, 0xA1, 0xA1, 0x30, 0x6F, 0x6E, 0x6E, 0x25,
+  0x25, 0xE8, 0x23, 0x23, 0xA9, 0xA9, 0xD2, 0xA9, 0xD3, 0xA8, 0x33, 0xAB, 0xAB, 0x7E, 0x0B, 0xAA,
+  0x0B, 0x36, 0x36, 0xD5, 0xD5, 0x6B, 0x58, 0x57, 0x1B, 0xB6, 0x3A, 0xB6, 0xF3, 0xF2, 0x3A, 0x6D,
+  0x6D, 0x6D, 0x6C, 0x6C, 0xC7, 0x6C, 0xBC, 0x10, 0x19, 0x95, 0x95, 0x95, 0x94, 0x94, 0x16, 0x16,
+  0x16, 0x3E, 0x3E, 0xFA, 0xFA, 0x8D, 0x8D, 0x39, 0x39, 0x39, 0x39, 0xC4, 0xC4, 0x8C, 0x3F, 0x3F,
+  0x8B, 0x8B, 0x84, 0x1A, 0x1A, 0x84, 0x84, 0xEF, 0x99, 0x3D, 0x3D, 0x99, 0x98, 0x7B, 0x04, 0x04,
+  0x35, 0x35, 0x35, 0x34, 0x34, 0x34, 0xE2, 0x27, 0x27, 0xE3, 0x28, 0xE3, 0xCE, 0xCD, 0x5C, 0x5C,
+  0x77, 0x77, 0x5C, 0xCA, 0x42, 0xC9, 0x41, 0x41, 0x41, 0x41, 0xE5, 0xE4, 0xE4, 0x21, 0x69, 0x21,
+  0xD9, 0xD9, 0xD8, 0xA6, 0xA6, 0x46, 0x46, 0x46, 0xB1, 0xB1, 0xE1, 0xE1, 0xAF, 0xAE, 0xAE, 0x90,
+  0x90, 0x8F, 0xAC, 0xAC, 0x92, 0x92, 0x91, 0x7D, 0x7D, 0xDE, 0x73, 0x73, 0x72, 0x72, 0xA1, 0xA1,
+  0xA1, 0xA1, 0x30, 0x6F, 0x6E, 0x6E, 0x6E, 0x25, 0x23, 0x23, 0x23, 0x23, 0xA9, 0xA9, 0xD3, 0xD3,
+  0xD3, 0x33, 0x11, 0x7E, 0x7E, 0xAB, 0xAA, 0x0B, 0x36, 0x97, 0xD5, 0xD5, 0xD4, 0xD5, 0x6B, 0x57,
+  0xB6, 0xB6, 0x3B, 0xF3, 0x3A, 0x3A, 0x3A, 0x6C, 0x6D, 0xC8, 0xC8, 0x10, 0xC7, 0x10, 0x10, 0x18,
+  0x95, 0x19, 0x95, 0x94, 0x16, 0x94, 0x16, 0x16, 0x3E, 0x3E, 0xFA, 0xFA, 0x8D, 0x8D, 0x8D, 0x8D,
+  0x39, 0x3F, 0x39, 0x39, 0xC4, 0x3F, 0x3F, 0x3F, 0x8B, 0x8B, 0x1A, 0x1A, 0x84, 0xEE, 0x99, 0xEE,
+  0x3D, 0x99, 0x3D, 0x98, 0x04, 0x04, 0x04, 0x04, 0x35, 0x34, 0x34, 0x34, 0x27, 0x27, 0x27, 0x27,
+  0xE3, 0x28, 0x28, 0x28, 0xCD, 0x5C, 0x77, 0xCA, 0x77, 0x5C, 0xC9, 0xC9, 0x41, 0x42, 0x41, 0x41,
+  0xE5, 0xE5, 0x69, 0x69, 0x1E, 0x21, 0xD9, 0xD9, 0xD9, 0xA6, 0xA7, 0x46, 0x46, 0x45, 0xB1, 0xB1,
+  0xB0, 0xE1, 0xE1, 0xE1, 0xAF, 0xAF, 0x90, 0x8F, 0xAE, 0xAC, 0xAD, 0xAD, 0x92, 0x92, 0x7D, 0x7D,
+  0xDE, 0xDE, 0x72, 0x73, 0x72, 0xA1, 0xA1, 0xA1, 0xA1, 0x6F, 0x6E, 0x30, 0x6E, 0x25, 0x25, 0x25,
+  0x25, 0x25, 0xA2, 0xA2, 0xA8, 0xA9, 0xD2, 0x33, 0x0A, 0x7E, 0xAB, 0x7E, 0xAB, 0xAA, 0x0B, 0x36,
+  0x97, 0x97, 0xD5, 0xD4, 0x6B, 0x57, 0x57, 0x3A, 0xB6, 0x57, 0x3A, 0xF2, 0x3A, 0x3B, 0x6D, 0x6D,
+  0x83, 0xC8, 0xC7, 0x6C, 0xC7, 0xC7, 0x18, 0x18, 0x19, 0x95, 0x94, 0x94, 0x94, 0x16, 0x16, 0x3E,
+  0x3E, 0xFA, 0xFB, 0x8D, 0x8D, 0x8D, 0x39, 0x39, 0x39, 0x3F, 0xC4, 0x3F, 0xC4, 0x3F, 0x8B, 0x1A,
+  0x8B, 0x84, 0x1A, 0x1A, 0xEE, 0xEF, 0xEE, 0x3D, 0x3D, 0x3D, 0x99, 0x04, 0x04, 0x04, 0x04, 0x35,
+  0x34, 0x35, 0x34, 0x34, 0x27, 0x27, 0xE3, 0xE2, 0x28, 0x28, 0x28, 0xCE, 0x5C, 0xCD, 0x77, 0x5C,
+  0x76, 0xC9, 0xC9, 0x42, 0x41, 0x42, 0xE5, 0xE5, 0xE5, 0x1E, 0x1E, 0x21, 0x21, 0x21, 0xD9, 0xA6,
+  0xD9, 0xA7, 0xA7, 0x46, 0x46, 0x45, 0xB1, 0xE1, 0xB0, 0xE1, 0xAF, 0xAF, 0xAE, 0x90, 0xAE, 0x8F,
+  0xAD, 0xAC, 0x92, 0x92, 0x92, 0x7D, 0xBD, 0xBD, 0xDE, 0xDE, 0x73, 0xCF, 0xA1, 0xA1, 0xD0, 0xA1,
+  0x30, 0x30, 0x6E, 0x30, 0x25, 0xA3, 0x6E, 0x25, 0x23, 0xA2, 0xA9, 0xA9, 0xA9, 0xD3, 0xD3, 0xD3,
+  0x11, 0xAB, 0x7E, 0xAA, 0xAA, 0x36, 0x0B, 0x36, 0xD5, 0xD5, 0x6B, 0x6B, 0x6B, 0x57, 0xF3, 0x57,
+  0xF3, 0xF3, 0xF2, 0xF2, 0x3A, 0x6C, 0x6C, 0xC8, 0xC8, 0x10, 0x10, 0xC7, 0xBC, 0x18, 0x65, 0xFE,
+  0x95, 0x94, 0x94, 0x16, 0x16, 0x16, 0x3E, 0x3E, 0x3E, 0xFA, 0x8D, 0x8D, 0x39, 0x8D, 0x8D, 0x39,
+  0x3F, 0xC4, 0x3F, 0xC4, 0x3F, 0x8B, 0x8B, 0x8B, 0x1A, 0x1A, 0xEE, 0xEE, 0x99, 0xEE, 0x3D, 0x3D,
+  0x15, 0x7B, 0x15, 0x04, 0x04, 0x04, 0x34, 0x34, 0x4B, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D,
+  0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0x5D, 0xF8, 0x38, 0xE5, 0xE5, 0xE4, 0xE4,
+  0xE4, 0xE4, 0x21, 0x21, 0x21, 0xD9, 0xD9, 0xD8, 0xA6, 0x46, 0x46, 0x45, 0x45, 0x46, 0x45, 0xB1,
+  0xE1, 0xAF, 0xAF, 0xAF, 0x8F, 0x8F, 0x90, 0xAD, 0xAC, 0xAC, 0x92, 0x91, 0xE3, 0xFB, 0xCC, 0xCB,
+  0xCC, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xA5, 0xA5, 0xA5, 0xA5, 0x3E,
+  0x73, 0x23, 0xA9, 0xD3, 0xD3, 0x33, 0x33, 0x0A, 0xAB, 0xAB, 0xAA, 0xAA, 0x36, 0x36, 0x0B, 0x97,
+  0x6B, 0x6B, 0x6B, 0xD4, 0x57, 0xF3, 0x6A, 0xF3, 0x3A, 0xF2, 0x3A, 0x83, 0x6D, 0x6D, 0x6D, 0x6C,
+  0x6C, 0x10, 0x10, 0x18, 0x18, 0xBB, 0xFE, 0xFE, 0x94, 0x94, 0x94, 0x16, 0x3E, 0x16, 0x3E, 0x3E,
+  0xFA, 0x8D, 0x8D, 0x8D, 0x39, 0x39, 0x39, 0x39, 0xC4, 0xC4, 0x3F, 0x3F, 0x8B, 0x1A, 0x84, 0x84,
+  0x84, 0x84, 0x84, 0xEE, 0xEE, 0x3D, 0x15, 0x99, 0x15, 0x04, 0x04, 0x04, 0x04, 0x35, 0x34, 0x38,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xF9, 0xE5, 0xE5, 0x69, 0x69, 0x1E, 0x21, 0xD9, 0x21, 0x21, 0xD8, 0xA6,
+  0xA7, 0x46, 0x45, 0xB1, 0x45, 0xE1, 0xE1, 0xE0, 0xE0, 0xAF, 0xAF, 0xAE, 0x8F, 0x8F, 0xAD, 0x92,
+  0xAC, 0x7D, 0x92, 0x94, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x6E, 0xD2, 0xD3, 0xD3, 0x0A, 0x11, 0x7E,
+  0xAB, 0xAB, 0x0B, 0x0B, 0x36, 0x0B, 0xD5, 0xD5, 0x6B, 0x1B, 0x1B, 0x1B, 0xF3, 0xB6, 0xF3, 0xB6,
+  0x3B, 0x6C, 0x3A, 0xC8, 0x6C, 0x6D, 0x83, 0x10, 0xC7, 0xC7, 0x10, 0x18, 0xBB, 0xFE, 0xBB, 0xF5,
+  0x16, 0x16, 0x16, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x8D, 0x8D, 0x39, 0x8D, 0x39, 0x39, 0xC4, 0x3F,
+  0x8C, 0x3F, 0x3F, 0x3F, 0x8B, 0x8B, 0x8B, 0xEE, 0x1A, 0x84, 0xEE, 0x99, 0x3D, 0x15, 0x99, 0x15,
+  0x15, 0x04, 0x04, 0x35, 0x35, 0x34, 0x34, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x69, 0x69,
+  0x21, 0x1E, 0x21, 0xD9, 0xD9, 0xA6, 0xD9, 0xA6, 0x46, 0x46, 0xB1, 0xB1, 0x45, 0xE1, 0xB0, 0xE1,
+  0xAF, 0xAE, 0x8F, 0x90, 0x8F, 0x90, 0xAC, 0x92, 0x92, 0x7D, 0xE3, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0xE1, 0xD3, 0x33, 0x0A, 0x7E, 0x11, 0xAB, 0x0B, 0x0B, 0x0B, 0x97, 0x97, 0xD5, 0xD5, 0xD5,
+  0x1B, 0x57, 0x57, 0xB6, 0x3B, 0x3B, 0x3B, 0x3A, 0x3B, 0x6C, 0x6D, 0xC8, 0xC8, 0x6C, 0xC7, 0xC7,
+  0xC7, 0x10, 0xBC, 0xBB, 0xF5, 0x65, 0xF5, 0xF5, 0x16, 0x16, 0x16, 0x3E, 0x3E, 0xFA, 0xFA, 0x8D,
+  0x8D, 0x8D, 0x8D, 0x39, 0x39, 0xC4, 0x3F, 0x3F, 0x3F, 0x8B, 0x8B, 0x8B, 0x8B, 0x84, 0x1A, 0xEE,
+  0xEE, 0x99, 0xEF, 0xEE, 0x3D, 0x15, 0x7B, 0x7B, 0x98, 0x04, 0x35, 0x04, 0x35, 0x34, 0x34, 0x4B,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0x69, 0x21, 0x21, 0x21, 0xD9, 0xD9, 0x46, 0xA6, 0x46, 0x46,
+  0x46, 0x45, 0x51, 0xB1, 0xB1, 0xE1, 0xAF, 0xAF, 0xAE, 0x90, 0x8F, 0x8F, 0xAD, 0xAD, 0xAC, 0x92,
+  0x7D, 0x91, 0xCB, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x72, 0xD3, 0x33, 0x11, 0x11, 0xAB, 0xAB,
+  0x32, 0x36, 0x36, 0x97, 0x97, 0xD5, 0xD4, 0x58, 0x57, 0x57, 0x57, 0x57, 0xF3, 0x3A, 0x3A, 0x3A,
+  0x3B, 0x3B, 0x6C, 0x6C, 0x6C, 0xC7, 0x10, 0x65, 0xBC, 0xBC, 0xFE, 0xFE, 0xBB, 0xF5, 0x29, 0xF5,
+  0x3E, 0x3E, 0x3E, 0xFA, 0x3E, 0x3E, 0xFA, 0x8D, 0x8D, 0x8D, 0x39, 0x39, 0xC4, 0xC4, 0x8C, 0xC4,
+  0x3F, 0x8B, 0x8B, 0x8B, 0x8B, 0x1A, 0x1A, 0x1A, 0xEE, 0x99, 0xEF, 0x3D, 0x7B, 0x98, 0x98, 0x04,
+  0x04, 0x35, 0x34, 0x35, 0x34, 0x27, 0x34, 0xB3, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0x21,
+  0x21, 0xD9, 0xA7, 0xA6, 0x46, 0x46, 0x46, 0x46, 0x51, 0x46, 0xB1, 0xE1, 0xB0, 0xAF, 0xAF, 0xAF,
+  0x90, 0x90, 0x8F, 0xAD, 0xAD, 0x92, 0x91, 0x92, 0x7D, 0xE3, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x04, 0x33, 0x33, 0x0A, 0x11, 0x0B, 0x0B, 0xAA, 0x0B, 0x36, 0x97, 0xD5, 0xD5, 0xD5, 0x1B, 0x6B,
+  0x57, 0x3A, 0x57, 0xF3, 0x3A, 0xF2, 0x3A, 0x6C, 0x6C, 0xC8, 0x6C, 0xC8, 0xC7, 0x10, 0xC7, 0x18,
+  0x18, 0x18, 0xFE, 0xF5, 0xF5, 0xF5, 0x12, 0x09, 0x16, 0x3E, 0x3E, 0xFA, 0xFA, 0xFA, 0x8D, 0x39,
+  0x39, 0x8D, 0x39, 0x39, 0xC4, 0x3F, 0x8B, 0x8B, 0x3F, 0x8B, 0x8B, 0x1A, 0x1A, 0x1A, 0xEE, 0x99,
+  0xEE, 0x3D, 0x15, 0x98, 0x98, 0x04, 0x98, 0x04, 0x04, 0x35, 0x34, 0x34, 0x34, 0x27, 0x27, 0x27,
+  0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x8A, 0x21, 0xA6, 0xA6, 0xA6, 0x46, 0xA7, 0x46, 0x46,
+  0xB1, 0xE1, 0xE1, 0xE1, 0xE1, 0xAF, 0xAF, 0x90, 0x90, 0xAD, 0xAD, 0xAD, 0xAC, 0x92, 0x7D, 0x7D,
+  0xB1, 0xCB, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xA4, 0xCF, 0x33, 0x7E, 0x11, 0xAB, 0xAB, 0xAA, 0x0B,
+  0x36, 0x36, 0x97, 0xD5, 0x6B, 0x6B, 0x1B, 0x58, 0x3A, 0xF3, 0xF3, 0x3A, 0x3A, 0x3B, 0x6C, 0x6D,
+  0x6C, 0x6C, 0x6C, 0x6C, 0xC7, 0x10, 0xBC, 0x65, 0xBB, 0xFE, 0xF5, 0xF5, 0xBB, 0x29, 0x9E, 0x9E,
+  0x3E, 0x3E, 0xFA, 0x8D, 0x8D, 0x8D, 0xFB, 0x8D, 0x8D, 0x8D, 0xC4, 0x3F, 0xC4, 0x3F, 0x8B, 0x3F,
+  0x8B, 0x8B, 0x1A, 0x1A, 0x1A, 0xEE, 0xEE, 0x3D, 0xEE, 0x99, 0x3D, 0x98, 0x04, 0x98, 0x35, 0x04,
+  0x35, 0x35, 0x34, 0x27, 0x27, 0x27, 0x27, 0xE3, 0xB3, 0x5D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B,
+  0xD9, 0xA7, 0xA7, 0xA7, 0x46, 0x46, 0x46, 0x46, 0xB1, 0xB1, 0xE1, 0xAF, 0xAF, 0xAF, 0x90, 0x8F,
+  0x90, 0xAD, 0xAC, 0xAC, 0x91, 0x91, 0x91, 0xBD, 0x98, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xE3,
+  0x33, 0x0A, 0x0A, 0x0B, 0xAB, 0xAA, 0x0B, 0x36, 0x36, 0xD5, 0xD5, 0x6B, 0x58, 0x1B, 0x57, 0x3A,
+  0x57, 0x3A, 0x3B, 0xF2, 0x3A, 0x3B, 0x6D, 0xC8, 0x6C, 0x6D, 0x6C, 0x10, 0xC7, 0x10, 0x65, 0x65,
+  0x65, 0xFE, 0xF5, 0xF5, 0x29, 0x09, 0x9E, 0x12, 0x3E, 0xFA, 0xFA, 0xFA, 0x8D, 0x8D, 0x39, 0x39,
+  0x39, 0xC4, 0x3F, 0x8C, 0x3F, 0x3F, 0x8B, 0x1A, 0x8B, 0x1A, 0x84, 0x1A, 0x84, 0x99, 0xEF, 0xEF,
+  0x15, 0x3D, 0x04, 0x98, 0x04, 0x04, 0x35, 0x35, 0x35, 0x34, 0x34, 0x34, 0x27, 0xE2, 0xE2, 0xE3,
+  0x28, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x8A, 0xA6, 0xA7, 0x46, 0x51, 0x45, 0x46, 0xB1,
+  0xE1, 0xAF, 0xE1, 0xAF, 0x90, 0x90, 0x8F, 0x8F, 0xAC, 0xAD, 0xAC, 0x91, 0x91, 0x91, 0xBD, 0xB0,
+  0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xA4, 0x0A, 0x0A, 0x11, 0xAB, 0xAB, 0xAA, 0xAA, 0x36, 0x36,
+  0x97, 0xD4, 0x6B, 0x1B, 0x6B, 0x57, 0xF3, 0x57, 0xF3, 0xF2, 0xF3, 0x3A, 0x3A, 0x6D, 0x6D, 0x6C,
+  0x6C, 0xC7, 0x6C, 0xC7, 0x18, 0xFE, 0xFE, 0xFE, 0xFE, 0xF5, 0xF5, 0xF5, 0x09, 0x20, 0x20, 0x20,
+  0xFA, 0xFA, 0xFA, 0x39, 0x8D, 0x8D, 0x39, 0x39, 0xC4, 0x3F, 0x3F, 0xC4, 0x3F, 0x3F, 0x8B, 0x8B,
+  0x1A, 0x84, 0x1A, 0x1A, 0x99, 0xEF, 0x15, 0x3D, 0x15, 0x98, 0x04, 0x04, 0x04, 0x35, 0x35, 0x35,
+  0x34, 0x27, 0x34, 0x27, 0xE2, 0x27, 0xE3, 0x28, 0xCE, 0x28, 0x5D, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4B, 0xA6, 0xA7, 0x46, 0x46, 0xE1, 0xE1, 0xE1, 0xE1, 0xE0, 0xB0, 0xAF, 0x8F, 0x8F, 0x8F, 0xAC,
+  0x92, 0x91, 0xAC, 0x91, 0xBD, 0x91, 0xDE, 0x3F, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x69, 0x7E,
+  0x7E, 0xAB, 0x0B, 0x0B, 0x0B, 0x0B, 0xD5, 0xD5, 0x97, 0xD5, 0x1B, 0x57, 0x57, 0x57, 0xB6, 0x57,
+  0x3A, 0x6D, 0x3A, 0x6C, 0x6D, 0xC8, 0x6D, 0xC7, 0xC7, 0x10, 0xBC, 0x18, 0x18, 0xFE, 0xFE, 0xF5,
+  0xBB, 0x09, 0x09, 0x12, 0x20, 0x20, 0x9B, 0x9B, 0xFB, 0x8D, 0x39, 0x8D, 0x8D, 0x39, 0x39, 0xC4,
+  0xC4, 0x8C, 0x8B, 0x3F, 0x8B, 0x8B, 0x8B, 0x84, 0x1A, 0xEE, 0x84, 0xEE, 0xEE, 0x3D, 0x15, 0x15,
+  0x98, 0x98, 0x15, 0x04, 0x35, 0x35, 0x35, 0x35, 0x27, 0x27, 0x27, 0x27, 0xE3, 0xE2, 0xE3, 0x28,
+  0x28, 0x28, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x8A, 0x46, 0x51, 0xB1, 0xB1, 0xE1, 0xE1,
+  0xE1, 0xAF, 0xAE, 0xAF, 0x8F, 0x8F, 0x8F, 0xAC, 0x91, 0xAC, 0x7D, 0x7D, 0xBD, 0xBD, 0xB0, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0xA4, 0x33, 0x11, 0xAB, 0xAA, 0x0B, 0x36, 0x36, 0x36, 0xD5, 0xD4,
+  0xD4, 0x58, 0x6B, 0x57, 0x6A, 0x3B, 0xF3, 0x3B, 0x3A, 0x3A, 0x6D, 0x6C, 0xC8, 0x6C, 0x6C, 0xC7,
+  0xC7, 0x65, 0x10, 0xFE, 0x18, 0x65, 0xBB, 0xF5, 0xF5, 0x29, 0x12, 0x09, 0x12, 0x20, 0x9B, 0x31,
+  0xFA, 0x8D, 0x8D, 0x8D, 0x39, 0x3F, 0x3F, 0x3F, 0x3F, 0x8C, 0x8B, 0x8B, 0x8B, 0x8B, 0x8B, 0xEE,
+  0x1A, 0x84, 0x99, 0x99, 0xEE, 0x15, 0x15, 0x3D, 0x98, 0x04, 0x04, 0x04, 0x35, 0x34, 0x34, 0x34,
+  0x34, 0x27, 0x27, 0xE3, 0x28, 0xE3, 0x28, 0x28, 0xCD, 0xCD, 0x77, 0x5D, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x4B, 0x46, 0x51, 0xB1, 0xB0, 0xB0, 0xAF, 0xB0, 0xAF, 0xAE, 0xAE, 0xAD, 0xAD, 0xAC, 0xAC,
+  0x91, 0x7D, 0x92, 0xDE, 0x73, 0x73, 0x3F, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x69, 0x11, 0x7E,
+  0xAB, 0xAA, 0x36, 0x0B, 0x97, 0xD5, 0xD4, 0xD4, 0x6B, 0x57, 0x57, 0x57, 0xF3, 0xF3, 0x3A, 0x3A,
+  0x6C, 0x6D, 0x6D, 0x6D, 0x6C, 0x10, 0x6C, 0x6C, 0xC7, 0x65, 0x18, 0x18, 0xFE, 0xF5, 0xBB, 0xF5,
+  0x29, 0x12, 0x9E, 0x12, 0x9B, 0x20, 0x9B, 0x9A, 0x8D, 0x8D, 0x39, 0x8D, 0x3F, 0xC4, 0x8C, 0x3F,
+  0x3F, 0x3F, 0x8B, 0x3F, 0x8B, 0x8B, 0x1A, 0x1A, 0xEE, 0x84, 0x99, 0x3D, 0x3D, 0x98, 0x7B, 0x04,
+  0x04, 0x04, 0x35, 0x35, 0x35, 0x35, 0x34, 0x34, 0x27, 0x27, 0x27, 0xE2, 0x28, 0x28, 0xCD, 0xCD,
+  0xCD, 0x77, 0x5C, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x8A, 0xB1, 0xB0, 0xE1, 0xAF, 0xAF,
+  0xAF, 0x90, 0x8F, 0x8F, 0xAD, 0xAD, 0x92, 0x92, 0x91, 0x7D, 0xDE, 0xBD, 0x73, 0xE1, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0xA4, 0x11, 0x7E, 0x0B, 0xAA, 0x0B, 0x0B, 0x36, 0xD5, 0xD5, 0x6B, 0xD4,
+  0x58, 0x58, 0x57, 0xF3, 0xF3, 0x3A, 0x3A, 0x6D, 0x3A, 0xC8, 0x6D, 0xC8, 0xC8, 0xC7, 0xC7, 0xC7,
+  0xBC, 0x18, 0x18, 0x18, 0xF5, 0xF5, 0x09, 0xF5, 0x29, 0x12, 0x20, 0x12, 0x9B, 0x9B, 0x9A, 0x31,
+  0x8D, 0x8D, 0x8D, 0x3F, 0x39, 0xC4, 0xC4, 0x3F, 0x3F, 0x3F, 0x8B, 0x84, 0x1A, 0xEE, 0x1A, 0x1A,
+  0xEE, 0xEE, 0x3D, 0x99, 0x99, 0x98, 0x98, 0x04, 0x04, 0x35, 0x35, 0x35, 0x34, 0x27, 0x34, 0xE2,
+  0xE2, 0xE3, 0xE3, 0x28, 0x28, 0x28, 0xCE, 0xCD, 0x77, 0x5C, 0x5C, 0x76, 0xF8, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x4B, 0xB0, 0xE1, 0xB0, 0xE0, 0x90, 0xAF, 0x90, 0x8F, 0xAD, 0xAC, 0x92, 0x91, 0x91,
+  0x91, 0xDE, 0xBD, 0xBE, 0x73, 0x8D, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x8F, 0x0B, 0xAA, 0x0B,
+  0x36, 0x36, 0x36, 0x97, 0xD4, 0xD4, 0x58, 0x58, 0x58, 0x6A, 0xF3, 0xF3, 0xF3, 0x3A, 0x3A, 0x6D,
+  0x6D, 0xC8, 0x6C, 0xC8, 0xC7, 0x10, 0x10, 0x18, 0x18, 0x65, 0xFE, 0xF5, 0xFE, 0xF5, 0x12, 0x29,
+  0x09, 0x20, 0x20, 0x9B, 0x9B, 0x9A, 0x5B, 0x56, 0x8D, 0x39, 0x39, 0xC4, 0x3F, 0x3F, 0x3F, 0x8B,
+  0x8B, 0x8B, 0x8B, 0x8B, 0x84, 0x8B, 0xEE, 0xEE, 0xEE, 0x3D, 0x3D, 0x3D, 0x98, 0x7B, 0x15, 0x04,
+  0x35, 0x35, 0x34, 0x34, 0x34, 0x27, 0x27, 0x27, 0xE2, 0xE3, 0x28, 0x28, 0x28, 0xCD, 0xCD, 0x77,
+  0xCA, 0x77, 0xCA, 0x76, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x8A, 0xE1, 0xAF, 0xAF, 0x90,
+  0x8F, 0x8F, 0xAD, 0xAC, 0x92, 0x92, 0x92, 0x7D, 0xBE, 0xBE, 0xDE, 0xDF, 0x69, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0xEE, 0x7E, 0xAB, 0xAA, 0x36, 0x36, 0x97, 0xD5, 0xD5, 0x1B, 0x1B, 0x1B, 0x1B,
+  0x57, 0x6A, 0x57, 0xF3, 0xF2, 0x3A, 0x6C, 0x6D, 0x6C, 0x83, 0xC8, 0x83, 0xC7, 0x10, 0x10, 0x18,
+  0xFE, 0xBB, 0xBB, 0xF5, 0xF5, 0x09, 0x29, 0x12, 0x20, 0x20, 0x9B, 0x9B, 0x9A, 0x5B, 0x3C, 0x56,
+  0x39, 0x39, 0xC4, 0x3F, 0xC4, 0x3F, 0x8B, 0x3F, 0x1A, 0x8B, 0x1A, 0xEE, 0x1A, 0x1A, 0x84, 0x99,
+  0x3D, 0x3D, 0x98, 0x98, 0x04, 0x04, 0x04, 0x04, 0x35, 0x35, 0x34, 0x35, 0x34, 0x27, 0x27, 0xE3,
+  0xE2, 0xE3, 0x28, 0x28, 0xCD, 0x5C, 0x5C, 0x5C, 0x76, 0xCA, 0xC9, 0xC9, 0xC9, 0xF8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4B, 0xAF, 0xAF, 0x8F, 0xAE, 0x8F, 0x8F, 0xAC, 0x91, 0x92, 0x7D, 0x7D, 0x91,
+  0xBD, 0x73, 0x73, 0x73, 0xCB, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x6F, 0xAA, 0xAA, 0x0B, 0x0B,
+  0x36, 0x97, 0xD5, 0x1B, 0x1B, 0x6B, 0x57, 0x57, 0x3B, 0xF3, 0x3A, 0x3A, 0x3A, 0x6D, 0x6D, 0x6D,
+  0xC8, 0x83, 0xC7, 0x10, 0xC7, 0x18, 0x18, 0xFE, 0xFE, 0xFE, 0xBB, 0x09, 0x12, 0x09, 0x9E, 0x20,
+  0x9B, 0x9B, 0x9B, 0x5A, 0x31, 0x5A, 0x56, 0x55, 0x39, 0xC4, 0xC4, 0xC4, 0x8C, 0x3F, 0x8B, 0x8B,
+  0x8B, 0x84, 0x1A, 0xEE, 0xEE, 0xEF, 0x3D, 0xEE, 0x99, 0x15, 0x98, 0x15, 0x04, 0x04, 0x04, 0x35,
+  0x35, 0x34, 0x34, 0x34, 0x27, 0xE3, 0x27, 0xE2, 0x28, 0x28, 0xCD, 0x28, 0x5C, 0xCD, 0x77, 0x5C,
+  0x76, 0x5C, 0x42, 0xC9, 0x42, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x8A, 0x8F, 0x8F, 0x8F,
+  0xAD, 0xAD, 0xAC, 0x92, 0x7D, 0x7D, 0xBD, 0x73, 0xBE, 0xDE, 0x72, 0xCD, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x99, 0xAB, 0xAA, 0x36, 0x0B, 0x97, 0xD5, 0xD5, 0x1B, 0x1B, 0x1B, 0x57, 0x1B, 0x3A,
+  0xF3, 0x3A, 0x3A, 0x6C, 0x6D, 0x6D, 0x6C, 0x6C, 0x6C, 0xC7, 0x6C, 0xC7, 0x10, 0x18, 0x65, 0x65,
+  0xF5, 0xBB, 0xF5, 0x12, 0x09, 0x12, 0x20, 0x20, 0x9B, 0x31, 0x9B, 0x3C, 0x56, 0x56, 0x88, 0x88,
+  0x39, 0xC4, 0x3F, 0x3F, 0x8B, 0x8B, 0x8B, 0x8B, 0x84, 0x1A, 0x1A, 0x1A, 0xEE, 0xEE, 0x3D, 0x15,
+  0x15, 0x98, 0x98, 0x04, 0x04, 0x04, 0x35, 0x35, 0x34, 0x34, 0x34, 0x27, 0xE2, 0xE3, 0xE3, 0xE3,
+  0x28, 0x28, 0xCD, 0xCD, 0xCD, 0x5C, 0x5C, 0x76, 0xC9, 0xC9, 0xC9, 0x41, 0x41, 0xE4, 0xF8, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4B, 0x90, 0xAD, 0xAD, 0xAC, 0x92, 0x92, 0x7D, 0x91, 0x7D, 0xDE, 0xDE,
+  0xDE, 0x72, 0x72, 0xCB, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xA1, 0xAB, 0x0B, 0x36, 0x36, 0xD5,
+  0xD5, 0x6B, 0xD5, 0x6B, 0x1B, 0xB6, 0xF3, 0xF3, 0x3A, 0xF2, 0x6C, 0x6D, 0x6D, 0x6D, 0xC8, 0x6C,
+  0x83, 0xC7, 0x10, 0x10, 0xBC, 0x65, 0xF5, 0xF5, 0xF5, 0x29, 0xF5, 0x29, 0x9E, 0x12, 0x9B, 0x9B,
+  0x31, 0x31, 0x5B, 0x3C, 0x56, 0x88, 0x56, 0x88, 0x3F, 0xC4, 0x8C, 0x8B, 0x3F, 0x8B, 0x8B, 0x1A,
+  0x1A, 0xEE, 0xEF, 0x84, 0x99, 0x99, 0x15, 0x7B, 0x04, 0x04, 0x04, 0x04, 0x04, 0x34, 0x35, 0x34,
+  0x34, 0x27, 0x27, 0xE3, 0x27, 0xE3, 0x28, 0x28, 0xCD, 0x28, 0xCD, 0x77, 0x77, 0x5C, 0x5C, 0xCA,
+  0xC9, 0xCA, 0x41, 0x42, 0xE5, 0xE5, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x8A, 0x8F, 0xAC,
+  0x92, 0x91, 0x92, 0x7D, 0xDE, 0xBE, 0xBE, 0x73, 0xCF, 0x72, 0xCD, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0xEE, 0xAA, 0x0B, 0x36, 0x36, 0xD5, 0x6B, 0xD4, 0x58, 0x57, 0x57, 0x57, 0x6A, 0xF3, 0xF2,
+  0x3B, 0x3B, 0x6C, 0x6C, 0x6C, 0x6C, 0x10, 0x83, 0xC7, 0xBC, 0xC7, 0x18, 0x65, 0xFE, 0xFE, 0xF5,
+  0xF5, 0x09, 0x12, 0x9E, 0x9E, 0x20, 0x12, 0x9B, 0x9B, 0x5B, 0x56, 0x55, 0x55, 0x56, 0x1F, 0x88,
+  0x8C, 0x3F, 0x8B, 0x3F, 0x3F, 0x8B, 0x1A, 0x1A, 0x1A, 0x1A, 0x84, 0x3D, 0x3D, 0x99, 0x99, 0x15,
+  0x04, 0x98, 0x04, 0x35, 0x35, 0x35, 0x34, 0x34, 0x27, 0x27, 0x27, 0x27, 0xE3, 0xE3, 0x28, 0xCE,
+  0xCD, 0x77, 0x77, 0x77, 0xCA, 0x76, 0xC9, 0x42, 0xC9, 0x42, 0x41, 0x42, 0xE5, 0xE5, 0x69, 0xF8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0xAC, 0x92, 0x91, 0x91, 0x7D, 0xBE, 0xDE, 0xBD, 0xBE, 0x72,
+  0x73, 0xCF, 0xCB, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xA4, 0x30, 0x36, 0x36, 0x97, 0x97, 0xD4, 0xD5,
+  0x1B, 0x58, 0x1B, 0x57, 0x3B, 0xF3, 0x3A, 0x6D, 0x3A, 0x6C, 0x6C, 0x6D, 0x6C, 0x6C, 0x6C, 0xC7,
+  0xC7, 0x65, 0x18, 0x18, 0xBB, 0xFE, 0xBB, 0xF5, 0x29, 0x29, 0x29, 0x9B, 0x20, 0x20, 0x9B, 0x5B,
+  0x56, 0x3C, 0x56, 0x56, 0x88, 0x88, 0x88, 0x87, 0x3F, 0x8B, 0x3F, 0x8B, 0x8B, 0x84, 0x8B, 0x1A,
+  0x1A, 0xEE, 0xEE, 0x3D, 0x99, 0x3D, 0x15, 0x98, 0x04, 0x35, 0x04, 0x35, 0x34, 0x34, 0x34, 0x27,
+  0xE2, 0x27, 0xE2, 0xE3, 0x28, 0x28, 0x28, 0xCE, 0xCD, 0x77, 0x77, 0xCA, 0x76, 0x76, 0xC9, 0x42,
+  0x41, 0x41, 0xE5, 0xE5, 0xE5, 0xE5, 0x1E, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0x92, 0x91,
+  0x91, 0x91, 0xBD, 0xBD, 0xBE, 0x73, 0xCF, 0xCF, 0xA1, 0x04, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x28, 0x0B, 0xAA, 0x97, 0xD5, 0xD5, 0x6B, 0x6B, 0x6B, 0x57, 0x57, 0xF3, 0xF3, 0xF3, 0xF3, 0x6C,
+  0x3B, 0x6D, 0x6D, 0xC8, 0x83, 0xC7, 0xC7, 0xC7, 0x18, 0x65, 0x18, 0xBB, 0xF5, 0xFE, 0xF5, 0x29,
+  0xF5, 0x9E, 0x20, 0x9B, 0x9A, 0x9B, 0x5B, 0x5B, 0x3C, 0x56, 0x56, 0x88, 0x88, 0x1F, 0x87, 0x1F,
+  0x8B, 0x8B, 0x8B, 0x8B, 0x84, 0x1A, 0xEE, 0xEE, 0xEE, 0xEE, 0x3D, 0x99, 0x3D, 0x98, 0x98, 0x04,
+  0x04, 0x35, 0x35, 0x35, 0x34, 0x34, 0x27, 0x27, 0xE2, 0xE2, 0xE3, 0xE3, 0xCE, 0x28, 0xCD, 0x77,
+  0xCD, 0x76, 0xCA, 0x5C, 0x42, 0xC9, 0xC9, 0x41, 0x41, 0x41, 0x42, 0xE5, 0x69, 0x69, 0x1E, 0x21,
+  0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0D, 0x8A, 0x92, 0x7D, 0x91, 0xBD, 0xBE, 0xDE, 0x73, 0xCF, 0xCF, 0xCF,
+  0x8F, 0xCB, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xA4, 0x36, 0x36, 0x0B, 0xD5, 0x6B, 0x1B, 0xD4, 0x1B,
+  0x57, 0xF3, 0xF3, 0xF3, 0x3A, 0x3A, 0x6C, 0x3A, 0x6D, 0x6D, 0x6C, 0x10, 0xC7, 0x6C, 0xC7, 0x10,
+  0x18, 0x65, 0xFE, 0xF5, 0xF5, 0x29, 0xF5, 0x12, 0x9E, 0x20, 0x9B, 0x9B, 0x9A, 0x5B, 0x3C, 0x56,
+  0x56, 0x56, 0x88, 0x88, 0x88, 0x1F, 0xB8, 0xB8, 0x3F, 0x8B, 0x8B, 0x1A, 0x1A, 0x1A, 0xEF, 0xEE,
+  0x3D, 0x3D, 0x3D, 0x15, 0x04, 0x98, 0x04, 0x04, 0x04, 0x35, 0x35, 0x34, 0x34, 0x27, 0x27, 0xE3,
+  0xE3, 0xE3, 0x28, 0x28, 0x28, 0xCD, 0xCD, 0x5C, 0x77, 0x76, 0x76, 0xCA, 0xC9, 0xC9, 0x42, 0x41,
+  0xE5, 0xE5, 0xE4, 0xE4, 0x1E, 0x21, 0x21, 0x21, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xAC, 0x92, 0xBD,
+  0xBD, 0xBD, 0xBE, 0xBE, 0x73, 0x72, 0xA1, 0xA1, 0x3F, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x21,
+  0x36, 0x97, 0x6B, 0xD5, 0xD4, 0x6B, 0x1B, 0x57, 0x6A, 0x3B, 0xF3, 0x3B, 0xF2, 0x3A, 0x3A, 0x6D,
+  0x6D, 0xC8, 0x6C, 0xC7, 0x6C, 0x18, 0xBC, 0x65, 0xBB, 0xFE, 0xF5, 0xF5, 0xF5, 0x29, 0x12, 0x29,
+  0x12, 0x20, 0x20, 0x9A, 0x9A, 0x3C, 0x3C, 0x55, 0x56, 0x88, 0x56, 0x87, 0x1F, 0xB8, 0xB8, 0xB8,
+  0x8B, 0x8B, 0x84, 0x1A, 0x1A, 0xEE, 0xEE, 0x99, 0x3D, 0x3D, 0x98, 0x7B, 0x15, 0x04, 0x04, 0x04,
+  0x35, 0x34, 0x35, 0x34, 0x27, 0x27, 0xE2, 0xE3, 0x28, 0x28, 0xCE, 0x28, 0xCE, 0xCD, 0xCD, 0x5C,
+  0x77, 0xCA, 0xCA, 0x42, 0x42, 0x42, 0x42, 0x41, 0xE5, 0xE5, 0xE4, 0x69, 0x1E, 0x21, 0xD9, 0xD9,
+  0xD9, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0D, 0xBF, 0x7D, 0x7D, 0xBD, 0xBD, 0x73, 0x72, 0xDF, 0xCF, 0xCF, 0xA1, 0x8F,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xA4, 0x36, 0x97, 0x97, 0x6B, 0x1B, 0x58, 0x1B, 0x57, 0xB6,
+  0x3A, 0x3B, 0xF2, 0xF2, 0x3B, 0x6C, 0x6D, 0x6C, 0xC8, 0x6C, 0x83, 0xC7, 0xC7, 0x18, 0xBC, 0xBB,
+  0x65, 0xF5, 0xF5, 0xF5, 0x12, 0x12, 0x12, 0x9E, 0x9B, 0x9B, 0x9B, 0x5B, 0x9A, 0x5A, 0x55, 0x56,
+  0x56, 0x56, 0x1F, 0x1F, 0x1F, 0xB8, 0xB8, 0xED, 0x8B, 0x1A, 0x1A, 0x84, 0x1A, 0x84, 0xEE, 0x3D,
+  0x3D, 0x99, 0x15, 0x15, 0x98, 0x04, 0x04, 0x35, 0x35, 0x35, 0x34, 0x34, 0x27, 0xE3, 0xE2, 0xE2,
+  0x28, 0x28, 0xCD, 0xCD, 0xCD, 0x77, 0x5C, 0x77, 0xCA, 0x5C, 0x42, 0xC9, 0x42, 0x42, 0x41, 0xE4,
+  0x69, 0x1E, 0x1E, 0x21, 0x21, 0x21, 0xD9, 0xD9, 0xD8, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x92, 0xBD, 0x7D, 0xBD,
+  0xBE, 0x72, 0x72, 0xCF, 0xA1, 0xA1, 0xA1, 0x3F, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x21, 0x36,
+  0xD5, 0xD5, 0x6B, 0x58, 0x57, 0xF3, 0x57, 0x3A, 0xF3, 0x3A, 0x3A, 0x3A, 0x6D, 0x6C, 0x6D, 0x6D,
+  0xC8, 0x10, 0xC7, 0xC7, 0x65, 0xFE, 0x18, 0xBB, 0xFE, 0xFE, 0xF5, 0x29, 0x12, 0x9E, 0x9B, 0x9B,
+  0x9B, 0x31, 0x5B, 0x5B, 0x5A, 0x5A, 0x55, 0x56, 0x88, 0x87, 0x1F, 0x1F, 0x87, 0xB8, 0xED, 0x4D,
+  0x8B, 0x1A, 0x84, 0x1A, 0xEE, 0x3D, 0x99, 0x99, 0x15, 0x7B, 0x15, 0x04, 0x04, 0x04, 0x35, 0x35,
+  0x34, 0x34, 0x27, 0x27, 0xE2, 0xE3, 0xE2, 0x28, 0x28, 0x28, 0xCE, 0xCD, 0x77, 0x76, 0x77, 0x76,
+  0xC9, 0x42, 0xC9, 0x41, 0x42, 0x41, 0xE5, 0xE5, 0xE5, 0x69, 0x21, 0x21, 0x21, 0x21, 0xA6, 0xD8,
+  0xA6, 0x46, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0D, 0x91, 0x91, 0x7D, 0xBD, 0xDE, 0xDE, 0xCF, 0xCF, 0x72, 0xA1, 0xA1, 0x90, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0xA4, 0xD5, 0x97, 0x6B, 0x6B, 0x1B, 0x1B, 0x57, 0xB6, 0xF3, 0xF3,
+  0xF3, 0x3A, 0x3A, 0x6D, 0x6D, 0xC8, 0x83, 0x6C, 0x6C, 0x65, 0x65, 0xC7, 0xFE, 0xFE, 0xFE, 0xFE,
+  0xBB, 0xF5, 0xF5, 0x12, 0x12, 0x12, 0x20, 0x9B, 0x9B, 0x5B, 0x5B, 0x56, 0x5A, 0x55, 0x88, 0x1F,
+  0x88, 0x87, 0xB8, 0xB8, 0xB8, 0xB7, 0x4D, 0xBA, 0x1A, 0x1A, 0x84, 0xEE, 0xEF, 0x3D, 0x3D, 0x99,
+  0x98, 0x7B, 0x04, 0x35, 0x04, 0x35, 0x35, 0x34, 0x34, 0x27, 0x27, 0x27, 0xE2, 0xE3, 0xE3, 0x28,
+  0x28, 0x28, 0xCE, 0xCD, 0x77, 0x76, 0x76, 0xC9, 0xC9, 0x42, 0x42, 0x41, 0x41, 0xE5, 0xE5, 0xE4,
+  0x69, 0x21, 0x21, 0x21, 0xD9, 0xA6, 0xA7, 0xA6, 0xA7, 0xA7, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x91, 0xDE, 0xDE, 0xBE, 0xDE,
+  0xCF, 0xCF, 0x72, 0xA1, 0xD0, 0xA1, 0x8B, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xAC, 0xD5, 0xD5,
+  0xD4, 0x6B, 0x57, 0x57, 0x57, 0x57, 0xF3, 0xF2, 0x3A, 0x3A, 0x3A, 0x6D, 0xC8, 0x6C, 0x6C, 0xC7,
+  0x6C, 0xC7, 0xC7, 0x65, 0x65, 0xFE, 0xFE, 0xF5, 0xF5, 0xFF, 0x12, 0x9E, 0x20, 0x20, 0x31, 0x9B,
+  0x5B, 0x9A, 0x5A, 0x55, 0x88, 0x88, 0x88, 0x1F, 0x1F, 0x1F, 0xB8, 0xB8, 0xB8, 0x4D, 0xBA, 0xBA,
+  0x1A, 0xEE, 0x1A, 0xEE, 0x3D, 0x99, 0x98, 0x98, 0x04, 0x04, 0x04, 0x35, 0x04, 0x35, 0x34, 0x34,
+  0x34, 0x27, 0x27, 0x27, 0xE3, 0x28, 0x28, 0xCE, 0xCD, 0x5C, 0x5C, 0x5C, 0x76, 0xCA, 0xCA, 0xC9,
+  0x41, 0x41, 0x41, 0x42, 0xE5, 0x1E, 0x69, 0x1E, 0x1E, 0x21, 0x21, 0xD9, 0xD9, 0xD8, 0xA6, 0x46,
+  0x46, 0xA7, 0x46, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0D, 0x91, 0xBE, 0xBE, 0xDE, 0x73, 0x73, 0x73, 0xA1, 0xA1, 0xA1, 0xA1, 0xD9, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x3D, 0xD5, 0xD5, 0xD5, 0x6B, 0xD5, 0x57, 0x57, 0x6A, 0xF3, 0xF3, 0xF2,
+  0x3B, 0x6C, 0x6D, 0x6D, 0x6C, 0x6C, 0x6C, 0xC7, 0xBC, 0x10, 0x18, 0xFE, 0x65, 0xFE, 0xF5, 0xFF,
+  0x09, 0x09, 0x12, 0x20, 0x31, 0x9B, 0x9B, 0x5B, 0x5B, 0x56, 0x55, 0x56, 0x88, 0x1F, 0x1F, 0x87,
+  0x1F, 0xB8, 0xED, 0xB7, 0xED, 0xED, 0xED, 0xED, 0x84, 0xEE, 0xEE, 0x3D, 0x3D, 0x3D, 0x98, 0x98,
+  0x04, 0x04, 0x35, 0x35, 0x35, 0x34, 0x34, 0x27, 0x27, 0xE2, 0x27, 0xE3, 0x28, 0x28, 0xCD, 0xCE,
+  0xCD, 0x77, 0x5C, 0xCA, 0x76, 0xCA, 0xC9, 0xC9, 0x42, 0x41, 0x41, 0xE5, 0x1E, 0xE4, 0x1E, 0x21,
+  0x21, 0x21, 0xD9, 0xD9, 0xA7, 0xA7, 0x46, 0x46, 0x46, 0xB1, 0x51, 0x8A, 0x5E, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x7D, 0x73, 0x73, 0x73, 0x73, 0x72,
+  0xCF, 0xA1, 0xA1, 0xA1, 0x30, 0x19, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x25, 0xD5, 0x6B, 0x6B,
+  0x57, 0x57, 0x57, 0x57, 0xF3, 0xF2, 0x3A, 0x3A, 0x6C, 0x6D, 0x6D, 0x6C, 0x10, 0x6C, 0xC7, 0xC7,
+  0x65, 0x18, 0xFE, 0xBB, 0xF5, 0xBB, 0xF5, 0xF5, 0x29, 0x9E, 0x20, 0x9B, 0x9B, 0x9B, 0x5B, 0x5B,
+  0x56, 0x56, 0x55, 0x56, 0x55, 0x1F, 0x1F, 0x1F, 0x1F, 0xB8, 0xED, 0x4D, 0xBA, 0xBA, 0xBA, 0xBA,
+  0x99, 0x3D, 0x15, 0x15, 0x15, 0x3D, 0x04, 0x04, 0x04, 0x35, 0x35, 0x35, 0x34, 0x34, 0x27, 0x27,
+  0x27, 0xE2, 0xE3, 0xE3, 0x28, 0xCE, 0x28, 0x5C, 0xCD, 0x5C, 0x76, 0x76, 0xCA, 0xC9, 0x42, 0x42,
+  0x41, 0x41, 0xE5, 0xE5, 0x1E, 0x69, 0x21, 0x1E, 0x21, 0x21, 0xD9, 0xD9, 0xA6, 0xA7, 0xA7, 0xA7,
+  0x46, 0x45, 0x45, 0xE1, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0D, 0x7D, 0xBD, 0xBE, 0x73, 0x73, 0xCF, 0xA1, 0xA1, 0xA1, 0xA0, 0x6F, 0x5C, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x99, 0x6B, 0x6B, 0xD4, 0x58, 0x57, 0x57, 0xB6, 0xF3, 0xF2, 0xF3, 0xF3, 0x6C,
+  0x6D, 0xC8, 0x6C, 0x83, 0xC7, 0x10, 0xC7, 0x18, 0x18, 0xBB, 0xBB, 0xF5, 0xBB, 0xF5, 0x12, 0x09,
+  0x12, 0x20, 0x20, 0x9B, 0x9B, 0x5B, 0x5B, 0x56, 0x5A, 0x56, 0x56, 0x87, 0x88, 0x1F, 0x87, 0xB8,
+  0xB8, 0xED, 0xBA, 0xBA, 0xBA, 0xBA, 0xEC, 0x07, 0xEE, 0xEE, 0x99, 0x99, 0x98, 0x7B, 0x04, 0x04,
+  0x04, 0x35, 0x35, 0x34, 0x27, 0x27, 0x27, 0x27, 0x27, 0xE3, 0xE3, 0x28, 0x28, 0xCE, 0xCD, 0x5C,
+  0x5C, 0x76, 0xC9, 0xCA, 0xC9, 0xC9, 0x42, 0x41, 0x41, 0xE5, 0xE5, 0x69, 0xE4, 0x21, 0x21, 0x21,
+  0xD9, 0xD9, 0xD9, 0xA7, 0x46, 0xA7, 0x46, 0xB1, 0xE1, 0x51, 0xB0, 0xE1, 0x8A, 0x5E, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xBD, 0xBE, 0x72, 0x72, 0xCF, 0xA1, 0xA1,
+  0xA1, 0xA1, 0x30, 0x30, 0xCB, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x25, 0xD5, 0x1B, 0x58, 0x57,
+  0x57, 0x57, 0xB6, 0xF3, 0x3B, 0x3A, 0x6C, 0x6D, 0x6D, 0x6D, 0x10, 0x6C, 0xC7, 0xC7, 0x10, 0x65,
+  0x65, 0x65, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0x12, 0x12, 0x9B, 0x9B, 0x31, 0x5B, 0x5B, 0x56, 0x56,
+  0x56, 0x88, 0x88, 0x88, 0x1F, 0xB8, 0xB8, 0xB8, 0xED, 0xED, 0xBA, 0xED, 0xEC, 0xBA, 0x07, 0x07,
+  0xEE, 0x99, 0x99, 0x04, 0x7B, 0x04, 0x04, 0x04, 0x04, 0x34, 0x34, 0x34, 0x34, 0x27, 0xE3, 0xE2,
+  0xE3, 0xE3, 0x28, 0x28, 0xCD, 0xCD, 0x77, 0x5C, 0x76, 0xCA, 0xC9, 0xC9, 0xC9, 0x42, 0x41, 0x42,
+  0xE5, 0x1E, 0x1E, 0x1E, 0x21, 0x21, 0x21, 0x21, 0xD9, 0xA7, 0xA6, 0x46, 0x46, 0x46, 0x46, 0xB1,
+  0xB1, 0xB1, 0xAF, 0xB0, 0xAF, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D,
+  0xDE, 0x73, 0x73, 0x73, 0x72, 0xA1, 0xA1, 0xA1, 0xA0, 0x30, 0x30, 0x76, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x99, 0xD5, 0x58, 0x57, 0x57, 0xF3, 0xF3, 0x3A, 0x3B, 0xF3, 0x3A, 0x3B, 0x6D, 0x6C,
+  0x6C, 0x83, 0xC7, 0xC7, 0x65, 0xBC, 0x18, 0xFE, 0xFE, 0xFE, 0xF5, 0xF5, 0x09, 0x29, 0x12, 0x9B,
+  0x20, 0x9B, 0x9B, 0x31, 0x5B, 0x5B, 0x56, 0x56, 0x88, 0x87, 0x88, 0x1F, 0xB8, 0xB8, 0xB8, 0x4D,
+  0xED, 0xBA, 0xEC, 0xBA, 0x07, 0x07, 0x1C, 0x79, 0xEE, 0x7B, 0x7B, 0x04, 0x04, 0x04, 0x04, 0x35,
+  0x34, 0x35, 0x35, 0x27, 0x27, 0x27, 0x27, 0x28, 0x28, 0x28, 0x28, 0xCE, 0xCE, 0xCD, 0x77, 0x5C,
+  0xCA, 0xC9, 0xC9, 0xC9, 0x42, 0x41, 0xE5, 0xE4, 0xE5, 0x69, 0x1E, 0x69, 0x21, 0x21, 0xD9, 0xD8,
+  0xD8, 0xA6, 0xA7, 0xA7, 0x45, 0x46, 0xB1, 0xB0, 0xE1, 0xB0, 0xE0, 0xAF, 0xAF, 0x8A, 0x5E, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x73, 0xCF, 0x73, 0x72, 0xCF, 0xA1, 0xA1, 0xA1,
+  0x30, 0x6F, 0x6E, 0xCB, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xA4, 0x25, 0x1B, 0x57, 0x58, 0xB6, 0x6A,
+  0xF3, 0x3B, 0xF3, 0x3A, 0x6D, 0x6D, 0x6C, 0xC8, 0x6C, 0x6C, 0x6C, 0xC7, 0x65, 0x18, 0xBB, 0xBB,
+  0xF5, 0xF5, 0xF5, 0xFF, 0x12, 0x9E, 0x9E, 0x20, 0x9B, 0x9B, 0x5B, 0x9B, 0x3C, 0x56, 0x56, 0x88,
+  0x88, 0x88, 0x1F, 0xB8, 0x87, 0xB8, 0xED, 0xB8, 0xED, 0xEC, 0xBA, 0xB9, 0x07, 0x1C, 0x79, 0x2F,
+  0x3D, 0x98, 0x04, 0x15, 0x04, 0x04, 0x35, 0x35, 0x34, 0x27, 0x34, 0xE2, 0xE2, 0x27, 0xE3, 0xE3,
+  0x28, 0xCD, 0xCD, 0xCD, 0x77, 0x77, 0x76, 0xCA, 0xC9, 0x42, 0xC9, 0x42, 0x41, 0x41, 0xE5, 0xE4,
+  0x69, 0x1E, 0x69, 0x21, 0x21, 0xD9, 0xD9, 0x46, 0xA7, 0xA6, 0x46, 0x46, 0x46, 0x51, 0xB1, 0xB0,
+  0xE1, 0xAF, 0xAF, 0xAE, 0x90, 0x8F, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x73,
+  0xBE, 0x73, 0xCF, 0x72, 0x72, 0x72, 0xA1, 0x30, 0x6E, 0x6E, 0xCA, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0xCD, 0xD4, 0x6B, 0x57, 0xF3, 0xB6, 0xF3, 0x3A, 0x3A, 0x3B, 0x6D, 0x83, 0x6D, 0xC8, 0xC8,
+  0xC7, 0x10, 0xC7, 0x18, 0x18, 0xFE, 0xFE, 0xFE, 0xF5, 0x09, 0x09, 0x12, 0x9E, 0x20, 0x20, 0x9B,
+  0x9B, 0x9B, 0x5B, 0x56, 0x5A, 0x56, 0x88, 0x88, 0x1F, 0x87, 0x1F, 0xB8, 0xB8, 0xED, 0xED, 0xED,
+  0xBA, 0xED, 0x07, 0x07, 0x1C, 0x2F, 0x2F, 0x78, 0x15, 0x04, 0x04, 0x04, 0x04, 0x35, 0x35, 0x34,
+  0x27, 0x27, 0x27, 0xE2, 0x27, 0xE2, 0x28, 0xE3, 0xCE, 0xCE, 0xCD, 0x5C, 0x77, 0x76, 0x76, 0xCA,
+  0xC9, 0xC9, 0x42, 0x41, 0xE5, 0xE4, 0x69, 0xE4, 0x69, 0x21, 0x21, 0x21, 0xD9, 0xD9, 0xD8, 0xA6,
+  0xA7, 0x46, 0x46, 0xB1, 0x45, 0xB1, 0xE1, 0xE1, 0xE0, 0xAF, 0xAE, 0xD1, 0x8F, 0x8F, 0x8A, 0x5E,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x73, 0x72, 0xA1, 0x72, 0xA1, 0xA1, 0x30, 0x6F, 0x30,
+  0x6E, 0xAC, 0xCB, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xA4, 0x7E, 0x58, 0x57, 0xF3, 0xF3, 0x57, 0xF3,
+  0x3A, 0x6C, 0x3A, 0x6C, 0x6D, 0x6D, 0xC8, 0xC7, 0xC7, 0xC7, 0x10, 0x10, 0x65, 0xBB, 0xBB, 0xF5,
+  0xF5, 0xF5, 0x29, 0x29, 0x20, 0x20, 0x9B, 0x9B, 0x5B, 0x5B, 0x56, 0x5A, 0x88, 0x08, 0x88, 0x88,
+  0x1F, 0x1F, 0x87, 0xB8, 0xB8, 0x4D, 0xED, 0xBA, 0xBA, 0xB9, 0x07, 0x07, 0x79, 0x79, 0xC6, 0xC6,
+  0x7B, 0x04, 0x04, 0x04, 0x35, 0x34, 0x35, 0x34, 0x34, 0x27, 0xE2, 0xE3, 0xE3, 0x28, 0x28, 0xCE,
+  0xCE, 0x5C, 0x5C, 0x5C, 0x76, 0xCA, 0xCA, 0xCA, 0xC9, 0x41, 0x41, 0x41, 0xE5, 0x69, 0x1E, 0x69,
+  0x1E, 0x21, 0x21, 0x21, 0xD9, 0xA7, 0xA7, 0x46, 0x46, 0x46, 0xB1, 0x45, 0xB0, 0xE1, 0xE1, 0xE1,
+  0xAF, 0xAF, 0x8F, 0x8F, 0x90, 0xAD, 0xAC, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x73, 0x72,
+  0xCF, 0x72, 0x72, 0xA0, 0xA1, 0x30, 0xA1, 0x30, 0x6E, 0x35, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0xA7, 0x6B, 0x58, 0x57, 0xF3, 0xF3, 0xF2, 0x3B, 0xF2, 0x3A, 0x6D, 0x6D, 0xC8, 0x6C, 0x10, 0xC7,
+  0xBC, 0x18, 0xFE, 0xFE, 0xF5, 0xF5, 0xF5, 0xF5, 0x09, 0x12, 0x9E, 0x20, 0x20, 0x20, 0x9B, 0x5B,
+  0x5B, 0x56, 0x55, 0x88, 0x88, 0x88, 0x88, 0x87, 0xB8, 0xB8, 0xB8, 0xB8, 0xED, 0xED, 0xEC, 0x07,
+  0xEC, 0x07, 0x2F, 0x2F, 0x2F, 0xC6, 0xC6, 0xC6, 0x04, 0x04, 0x04, 0x35, 0x35, 0x34, 0x27, 0x27,
+  0x27, 0x27, 0xE3, 0x28, 0x28, 0xE3, 0xCD, 0xCE, 0x77, 0xCD, 0x77, 0x76, 0x76, 0xC9, 0xC9, 0x42,
+  0x42, 0x41, 0xE5, 0xE5, 0xE5, 0x69, 0x1E, 0x21, 0x21, 0x21, 0xD9, 0xD9, 0xD8, 0xA7, 0x46, 0x46,
+  0x46, 0x51, 0xB1, 0xB1, 0xB0, 0xE1, 0xE1, 0xAF, 0xAF, 0xAF, 0x90, 0xAD, 0x8F, 0xAC, 0xAC, 0x8A,
+  0x5E, 0x00, 0x00, 0x00, 0x00, 0x38, 0x73, 0x72, 0xA1, 0x72, 0xA1, 0xA1, 0x6F, 0x6F, 0x30, 0x6E,
+  0xAC, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xA4, 0x57, 0xF3, 0x57, 0xB6, 0xF3, 0x3A, 0x3A, 0x3A,
+  0x3A, 0x6D, 0x6D, 0x6C, 0x6C, 0x6C, 0xC7, 0x65, 0x18, 0xBC, 0xFE, 0xFE, 0xFE, 0xFE, 0x09, 0x29,
+  0x29, 0x20, 0x9E, 0x9B, 0x20, 0x9A, 0x5B, 0x5B, 0x56, 0x55, 0x56, 0x88, 0x88, 0x87, 0x87, 0x1F,
+  0x1F, 0xB8, 0xED, 0xBA, 0xED, 0xEC, 0xBA, 0x07, 0x07, 0x79, 0x07, 0x2F, 0x79, 0xC6, 0xC6, 0xC5,
+  0x04, 0x04, 0x34, 0x34, 0x34, 0x34, 0x27, 0x27, 0x27, 0x27, 0xE3, 0xE3, 0x28, 0x28, 0xCD, 0x5C,
+  0x77, 0x5C, 0x76, 0x76, 0xCA, 0xC9, 0xC9, 0x42, 0x41, 0x41, 0x42, 0x69, 0xE4, 0x1E, 0x69, 0x21,
+  0x21, 0xD9, 0xD9, 0xD8, 0x46, 0x46, 0x46, 0x46, 0x45, 0x51, 0x51, 0xE1, 0xB0, 0xB0, 0xAF, 0x8F,
+  0x8F, 0x90, 0x8F, 0xAD, 0xAD, 0xAC, 0xAC, 0x7D, 0x4B, 0x00, 0x00, 0x00, 0x0D, 0x73, 0x72, 0xA1,
+  0xCF, 0x6F, 0xA1, 0x30, 0x6E, 0x6E, 0x30, 0x6E, 0x8B, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xA7,
+  0x57, 0xB6, 0xF3, 0x3B, 0xF2, 0x3A, 0x3A, 0x3B, 0x6C, 0x6C, 0x6C, 0xC8, 0xC7, 0xC7, 0xBC, 0xC7,
+  0x65, 0xFE, 0xFE, 0xF5, 0xF5, 0xF5, 0x09, 0x12, 0x9E, 0x20, 0x9B, 0x9B, 0x5B, 0x9B, 0x5B, 0x3C,
+  0x56, 0x88, 0x88, 0x88, 0x88, 0x1F, 0x87, 0xB8, 0xB8, 0x4D, 0xED, 0x4D, 0xBA, 0xBA, 0xBA, 0x79,
+  0x1C, 0x2F, 0x2F, 0x2F, 0xC5, 0xC6, 0xC5, 0x22, 0x04, 0x35, 0x35, 0x34, 0x27, 0x27, 0x27, 0x27,
+  0x27, 0xE3, 0xE3, 0xCD, 0xCE, 0xCD, 0xCD, 0x77, 0x77, 0x5C, 0xCA, 0xCA, 0xC9, 0xC9, 0x41, 0x42,
+  0xE5, 0xE5, 0xE5, 0xE4, 0x69, 0x21, 0x21, 0x21, 0x21, 0xD9, 0xA6, 0xA6, 0x46, 0x46, 0x46, 0xB1,
+  0xB1, 0xE1, 0xE1, 0xE1, 0xAF, 0xAF, 0xAF, 0xAF, 0x8F, 0xAD, 0xAD, 0x92, 0x92, 0x92, 0x91, 0x7D,
+  0x7D, 0xFD, 0x00, 0xF8, 0x8A, 0x72, 0xCF, 0xA1, 0xA1, 0xA1, 0x30, 0x6F, 0x30, 0x6E, 0x25, 0x91,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xA4, 0x57, 0x57, 0xF3, 0xF3, 0xF3, 0x3A, 0x3A, 0x3A, 0x6D,
+  0x6D, 0x6C, 0x83, 0xC7, 0x10, 0xC7, 0x18, 0x18, 0x65, 0xBB, 0xFE, 0xF5, 0x09, 0x09, 0x09, 0x9E,
+  0x20, 0x12, 0x20, 0x9B, 0x9B, 0x3C, 0x5A, 0x56, 0x56, 0x88, 0x1F, 0x1F, 0x1F, 0x1F, 0xB8, 0xB8,
+  0xED, 0xB8, 0xED, 0xBA, 0xBA, 0x07, 0x07, 0x07, 0x2F, 0x79, 0xC6, 0xC6, 0xC6, 0x22, 0x22, 0x22,
+  0x04, 0x34, 0x34, 0x27, 0x27, 0x27, 0xE3, 0x27, 0xE3, 0x28, 0x28, 0x28, 0xCE, 0x5C, 0x77, 0x5C,
+  0x76, 0x76, 0xCA, 0x42, 0x42, 0x42, 0x41, 0x42, 0xE5, 0x69, 0xE4, 0x69, 0x69, 0x21, 0x21, 0xA6,
+  0xA7, 0xA6, 0xA7, 0xA7, 0x46, 0x46, 0x46, 0x45, 0x51, 0xB0, 0xAF, 0xE0, 0xAF, 0xAF, 0x90, 0x8F,
+  0xAD, 0xAD, 0xAC, 0xAC, 0xAC, 0x91, 0x7D, 0x7D, 0xBD, 0xDE, 0x73, 0x72, 0xA1, 0xA1, 0x72, 0x6F,
+  0xA1, 0x30, 0x30, 0x30, 0x6E, 0x6E, 0x25, 0x8B, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xAF, 0x57,
+  0x6A, 0x3A, 0xF2, 0xF2, 0x3A, 0x3A, 0x6C, 0xC8, 0x83, 0x6C, 0x10, 0xC7, 0xC7, 0x10, 0xFE, 0x65,
+  0xFE, 0xFE, 0xF5, 0x09, 0xF5, 0x09, 0x09, 0x20, 0x9B, 0x9B, 0x9B, 0x9A, 0x5B, 0x5B, 0x56, 0x56,
+  0x88, 0x88, 0x1F, 0x1F, 0x1F, 0xB8, 0xED, 0xB7, 0xED, 0xED, 0xBA, 0x07, 0xEC, 0x07, 0x07, 0x79,
+  0x2F, 0xC6, 0xC6, 0xC6, 0x22, 0x22, 0x22, 0xD6, 0x34, 0x35, 0x34, 0x27, 0xE2, 0xE2, 0x27, 0x28,
+  0x28, 0x28, 0xCE, 0xCE, 0xCD, 0x77, 0x77, 0xCA, 0x76, 0xCA, 0x42, 0xC9, 0x42, 0x42, 0x42, 0xE4,
+  0xE5, 0xE4, 0x69, 0x69, 0x21, 0xD9, 0x21, 0xA6, 0xD9, 0xA6, 0xA7, 0xA7, 0x46, 0x46, 0xB1, 0xB0,
+  0xE1, 0xE0, 0xE0, 0xAF, 0xAE, 0x8F, 0x90, 0x90, 0xAC, 0xAC, 0x91, 0x91, 0x91, 0x91, 0xBD, 0x73,
+  0xDE, 0x73, 0x73, 0xCF, 0x72, 0xA1, 0x72, 0xA1, 0x6F, 0x6E, 0x6E, 0x6E, 0x6E, 0x25, 0x91, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x8D, 0x57, 0x57, 0x6A, 0x3A, 0x3A, 0x3B, 0x3A, 0x83, 0x6D, 0x6C,
+  0x6C, 0x6C, 0xC7, 0xC7, 0x10, 0x18, 0xBB, 0xBB, 0xFE, 0xF5, 0xF5, 0x12, 0x09, 0x29, 0x20, 0x9B,
+  0x9B, 0x9B, 0x31, 0x9A, 0x56, 0x56, 0x55, 0x88, 0x1F, 0x1F, 0x87, 0x1F, 0xB8, 0xED, 0xED, 0x4D,
+  0xBA, 0xBA, 0xED, 0x07, 0x07, 0x07, 0x1C, 0x2F, 0x2F, 0xC6, 0xC6, 0x22, 0x22, 0xD6, 0x22, 0xD6,
+  0x34, 0x34, 0x27, 0x27, 0x27, 0xE2, 0xE2, 0x28, 0xE3, 0x28, 0xCD, 0xCD, 0x5C, 0x77, 0x5C, 0x5C,
+  0xC9, 0x42, 0xC9, 0x41, 0x42, 0x42, 0xE4, 0xE5, 0x1E, 0x1E, 0x21, 0x21, 0xD9, 0x21, 0xA6, 0xD8,
+  0xA6, 0x46, 0x46, 0x46, 0x46, 0xB1, 0xB0, 0xE1, 0xE1, 0xAF, 0xAF, 0xAE, 0xAE, 0x90, 0x90, 0xAD,
+  0xAC, 0x92, 0xAC, 0x7D, 0x7D, 0x7D, 0xBD, 0x73, 0x73, 0x72, 0x72, 0xA1, 0xA1, 0xA1, 0x6F, 0x30,
+  0x30, 0x6E, 0x6E, 0x6E, 0x25, 0x25, 0x3E, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xA2, 0x57, 0xF3,
+  0xF2, 0x3A, 0x3B, 0x3B, 0x6D, 0x6D, 0x6C, 0x10, 0x6C, 0xC7, 0x10, 0xC7, 0x18, 0xBB, 0xFE, 0xF5,
+  0xBB, 0xF5, 0x09, 0x12, 0x9E, 0x12, 0x12, 0x9B, 0x9A, 0x5B, 0x3C, 0x56, 0x56, 0x56, 0x88, 0x88,
+  0x88, 0x1F, 0x87, 0xB8, 0xB8, 0xB8, 0xED, 0xED, 0xBA, 0xB9, 0xBA, 0x07, 0x07, 0x1C, 0x79, 0x79,
+  0xC6, 0xC6, 0x22, 0x22, 0x22, 0xD7, 0xD7, 0xD6, 0x34, 0x27, 0x27, 0xE2, 0xE3, 0xE3, 0xE3, 0x28,
+  0xCD, 0xCD, 0xCD, 0x5C, 0x5C, 0xCA, 0xCA, 0x5C, 0xCA, 0x42, 0x41, 0x41, 0xE5, 0xE5, 0xE5, 0x1E,
+  0x69, 0x21, 0x21, 0x21, 0xD9, 0xD9, 0xA6, 0xA6, 0x46, 0x46, 0x46, 0x46, 0xB1, 0x51, 0xB1, 0xAF,
+  0xE1, 0xAF, 0xAF, 0xAE, 0x8F, 0x8F, 0x8F, 0xAD, 0x92, 0x92, 0x91, 0x91, 0x7D, 0x73, 0xDE, 0x73,
+  0xCF, 0x72, 0x72, 0xA0, 0xA1, 0xA1, 0x6F, 0x30, 0x6E, 0x6E, 0x25, 0x6E, 0x7A, 0xC9, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x7B, 0xF3, 0xF3, 0xF3, 0x3A, 0x3A, 0x3A, 0x6D, 0xC8, 0x6C, 0x10, 0x10,
+  0x65, 0xC7, 0x10, 0x18, 0xBB, 0xFE, 0xFE, 0xF5, 0xF5, 0x09, 0x29, 0x20, 0x20, 0x9B, 0x9B, 0x31,
+  0x9A, 0x5B, 0x3C, 0x56, 0x56, 0x88, 0x87, 0x88, 0x1F, 0x1F, 0xB8, 0xB8, 0xB8, 0xED, 0xED, 0xBA,
+  0xEC, 0xB9, 0xB9, 0x2F, 0x79, 0x79, 0x78, 0x2F, 0xC6, 0x22, 0xC5, 0x22, 0xD6, 0xD6, 0xD6, 0xD7,
+  0x27, 0x27, 0x27, 0xE3, 0x28, 0x28, 0x28, 0xCD, 0x28, 0x77, 0x5C, 0x76, 0x76, 0x76, 0x42, 0x42,
+  0xCA, 0x42, 0x41, 0x41, 0xE5, 0xE5, 0x69, 0x1E, 0x21, 0x21, 0x21, 0xD9, 0xD9, 0xA6, 0xA6, 0x46,
+  0x46, 0x46, 0x46, 0xB1, 0xB0, 0xE1, 0xE1, 0xB0, 0xAF, 0xAF, 0x90, 0xAE, 0x90, 0xAD, 0xAC, 0xAC,
+  0xAD, 0x7D, 0x7D, 0xBE, 0xBE, 0xBE, 0x73, 0x72, 0x72, 0xA1, 0x72, 0xA1, 0xA1, 0x30, 0x6E, 0x6E,
+  0x6E, 0x25, 0x25, 0x25, 0x25, 0xCB, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xD2, 0x6A, 0xF3, 0xF2,
+  0x3A, 0x3A, 0x6C, 0x6C, 0x6C, 0x6C, 0x83, 0xC7, 0xC7, 0x18, 0x18, 0x65, 0xFE, 0xFE, 0xF5, 0x09,
+  0x29, 0x20, 0x12, 0x12, 0x9B, 0x9B, 0x9B, 0x5B, 0x5B, 0x56, 0x56, 0x55, 0x88, 0x88, 0x1F, 0x1F,
+  0x1F, 0xB8, 0xB8, 0xB8, 0xED, 0x4D, 0xBA, 0xBA, 0x07, 0x07, 0x79, 0x78, 0x79, 0x2F, 0xC6, 0x22,
+  0xC5, 0x22, 0x22, 0x22, 0xD7, 0xD6, 0x26, 0xEB, 0x27, 0x27, 0xE3, 0xE3, 0x28, 0x28, 0xCD, 0xCE,
+  0xCD, 0x5C, 0x76, 0xCA, 0x5C, 0x5C, 0x42, 0xC9, 0x41, 0x42, 0xE5, 0xE5, 0xE4, 0xE4, 0x1E, 0x21,
+  0x21, 0xD9, 0xD9, 0xD9, 0xA7, 0xA7, 0x46, 0x46, 0x46, 0x51, 0xB1, 0xE1, 0xE1, 0xB0, 0xAF, 0xAE,
+  0xAE, 0xAF, 0x8F, 0x90, 0xAD, 0xAC, 0x92, 0x91, 0x92, 0x7D, 0xBD, 0x73, 0xDE, 0x72, 0x73, 0xCF,
+  0xA1, 0xA1, 0xA1, 0xA0, 0x30, 0x6E, 0x6E, 0x6E, 0x25, 0x25, 0x25, 0x23, 0xC9, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x7B, 0xF3, 0x3A, 0x3A, 0x3B, 0x6D, 0x6D, 0x6D, 0xC8, 0x83, 0x10, 0x6C, 0x10,
+  0x10, 0x18, 0xFE, 0xFE, 0xF5, 0xF5, 0xF5, 0x09, 0x29, 0x09, 0x9E, 0x12, 0x20, 0x9B, 0x5B, 0x5B,
+  0x3C, 0x56, 0x88, 0x88, 0x88, 0x88, 0x87, 0x1F, 0x1F, 0xB8, 0xB7, 0xED, 0xBA, 0xBA, 0xEC, 0x07,
+  0x07, 0x1C, 0x1C, 0x78, 0xC6, 0x78, 0xC6, 0x22, 0x22, 0xD6, 0xD6, 0x26, 0xD6, 0x26, 0x26, 0x26,
+  0x27, 0xE3, 0xE3, 0x28, 0xE3, 0xCE, 0xCE, 0xCD, 0xCD, 0x5C, 0x76, 0xCA, 0xCA, 0xC9, 0xC9, 0x42,
+  0x42, 0x42, 0xE5, 0xE5, 0x69, 0x69, 0x21, 0x21, 0x21, 0xD9, 0xD9, 0xD8, 0xA7, 0xA6, 0xA7, 0x46,
+  0x46, 0x51, 0x45, 0xB0, 0xE0, 0xAF, 0xAF, 0xAF, 0x90, 0x8F, 0x8F, 0x8F, 0xAD, 0xAC, 0x92, 0x7D,
+  0x7D, 0xBD, 0xBD, 0xBD, 0x73, 0xBE, 0x73, 0xCF, 0xA1, 0x6F, 0x6F, 0x6F, 0x30, 0x6E, 0x6E, 0x25,
+  0x25, 0x25, 0x25, 0xA2, 0xCB, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0xD3, 0x3A, 0x3A, 0x3A, 0x6D,
+  0x6D, 0x6C, 0x6C, 0x83, 0xC7, 0xC7, 0xC7, 0xBC, 0x18, 0x65, 0xFE, 0xF5, 0xF5, 0xF5, 0x09, 0x09,
+  0x12, 0x9E, 0x9B, 0x9B, 0x9B, 0x5B, 0x5B, 0x56, 0x56, 0x55, 0x88, 0x87, 0x88, 0x87, 0x1F, 0xB8,
+  0xB8, 0xB7, 0xED, 0xED, 0xEC, 0x07, 0xBA, 0x07, 0x07, 0x2F, 0x79, 0x2F, 0xC6, 0x22, 0xC6, 0x22,
+  0xD6, 0xD6, 0xD6, 0xD6, 0x26, 0x26, 0x26, 0xEB, 0xE2, 0xE2, 0xE3, 0xE3, 0x28, 0xCE, 0x77, 0xCD,
+  0x76, 0x76, 0xCA, 0x76, 0xC9, 0xC9, 0x42, 0x41, 0x41, 0xE4, 0xE5, 0x69, 0x69, 0x1E, 0x69, 0x21,
+  0xD9, 0xA6, 0xA6, 0xA6, 0xA6, 0x46, 0x46, 0x51, 0xB1, 0xB1, 0xB0, 0xE0, 0xE1, 0xAF, 0xAF, 0x90,
+  0x8F, 0x8F, 0xAD, 0xAD, 0xAC, 0x91, 0x92, 0x91, 0xBE, 0x7D, 0x73, 0x73, 0xCF, 0x72, 0xCF, 0xA1,
+  0xD0, 0xD0, 0x30, 0x30, 0x6E, 0x6E, 0x25, 0x25, 0x25, 0x23, 0x23, 0x42, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0xCA, 0x3A, 0x3A, 0x3A, 0x6C, 0xC8, 0x6D, 0x6C, 0xC8, 0x10, 0x6C, 0xC7, 0x65, 0x18,
+  0xFE, 0xBB, 0xF5, 0xF5, 0xF5, 0x29, 0x09, 0x9E, 0x20, 0x20, 0x9B, 0x31, 0x9B, 0x5B, 0x5B, 0x56,
+  0x56, 0x88, 0x1F, 0x88, 0x1F, 0x87, 0xB8, 0xB8, 0xB7, 0x4D, 0xED, 0xBA, 0xB9, 0xBA, 0x07, 0x07,
+  0x07, 0x78, 0xC6, 0x2F, 0xC5, 0xC5, 0x22, 0xD6, 0xD6, 0xD6, 0x26, 0x26, 0x26, 0xEB, 0xEB, 0x66,
+  0xE3, 0x28, 0x28, 0x28, 0xCE, 0xCD, 0xCD, 0x5C, 0x76, 0xC9, 0xC9, 0x42, 0xC9, 0x42, 0x42, 0x41,
+  0xE5, 0xE5, 0x69, 0x69, 0x21, 0x21, 0x21, 0xD9, 0xD9, 0xD9, 0xA6, 0x46, 0xA6, 0x46, 0x45, 0x51,
+  0xB0, 0xB0, 0xAF, 0xAF, 0xAF, 0xAF, 0x8F, 0x8F, 0x90, 0xAD, 0xAC, 0x92, 0x92, 0x91, 0xBD, 0x7D,
+  0xBE, 0xDE, 0xBE, 0x73, 0x72, 0xA1, 0xA1, 0xA1, 0x6F, 0x30, 0x6F, 0x6E, 0x25, 0x6E, 0x25, 0x23,
+  0x23, 0xA2, 0xA1, 0xCB, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xA4, 0xD3, 0xF2, 0x3A, 0x3A, 0x6D, 0x6D,
+  0x6C, 0x83, 0x10, 0x6C, 0xC7, 0xC7, 0x65, 0xFE, 0xFE, 0xFE, 0xF5, 0xF5, 0xF5, 0x12, 0x12, 0x12,
+  0x20, 0x9B, 0x31, 0x5B, 0x31, 0x3C, 0x56, 0x56, 0x88, 0x88, 0x88, 0x87, 0x1F, 0x1F, 0xED, 0xED,
+  0xB8, 0xED, 0xBA, 0x07, 0x07, 0x07, 0x07, 0x2F, 0x79, 0x79, 0xC6, 0x22, 0x22, 0x22, 0xD6, 0xD6,
+  0xD6, 0x26, 0x26, 0x26, 0xEB, 0xEA, 0xEA, 0xEA, 0xE3, 0x28, 0x28, 0xCE, 0xCD, 0x77, 0x77, 0xCA,
+  0x5C, 0xCA, 0xC9, 0x42, 0x41, 0x41, 0x41, 0xE5, 0xE5, 0xE4, 0xE4, 0x21, 0x21, 0x21, 0xD9, 0xD9,
+  0xA6, 0xA6, 0x46, 0x46, 0x46, 0x46, 0x45, 0xB1, 0xE1, 0xB0, 0xE1, 0xE0, 0xAF, 0x8F, 0x90, 0xAD,
+  0x8F, 0xAC, 0x92, 0x91, 0x91, 0x7D, 0x91, 0xDE, 0x73, 0x73, 0x73, 0xCF, 0xCF, 0xA1, 0xD0, 0xA1,
+  0x30, 0x30, 0x6E, 0x6E, 0x25, 0x6E, 0x25, 0x23, 0x25, 0xA2, 0x34, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x46, 0xF3, 0x3A, 0x6C, 0x6D, 0x6D, 0xC8, 0x10, 0x83, 0xC7, 0x18, 0x18, 0x18, 0x18, 0xFE,
+  0xFE, 0xF5, 0xF5, 0x09, 0x09, 0x12, 0x20, 0x20, 0x9B, 0x31, 0x3C, 0x5B, 0x5A, 0x55, 0x56, 0x88,
+  0x88, 0x87, 0x87, 0x1F, 0xB8, 0x87, 0xED, 0x4D, 0xBA, 0xBA, 0x07, 0xBA, 0xBA, 0x79, 0x1C, 0x78,
+  0x78, 0x2F, 0x2F, 0xC6, 0x22, 0x22, 0x22, 0x22, 0x26, 0x26, 0x26, 0x26, 0x67, 0x66, 0x66, 0x66,
+  0x28, 0x28, 0xCD, 0xCD, 0xCD, 0x5C, 0x76, 0xCA, 0xCA, 0x42, 0x42, 0x42, 0x42, 0xE5, 0xE5, 0xE5,
+  0xE5, 0x69, 0x21, 0x21, 0x21, 0xD9, 0xD9, 0xD8, 0xA6, 0x46, 0x46, 0x51, 0x45, 0x45, 0x45, 0xE1,
+  0xE1, 0xAF, 0xAF, 0xAE, 0x90, 0xAE, 0x90, 0x8F, 0xAD, 0x92, 0x92, 0x7D, 0xBD, 0xBD, 0xBE, 0x73,
+  0x73, 0x73, 0xCF, 0x72, 0xA1, 0xA1, 0xA1, 0x6F, 0xA1, 0x6E, 0x6E, 0x25, 0xE8, 0x25, 0xA2, 0xA2,
+  0xA2, 0xA9, 0xCB, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x3A, 0x6C, 0x6D, 0x6D, 0x3B, 0x6C, 0x83,
+  0x6C, 0x6C, 0x65, 0x18, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xF5, 0xF5, 0x9E, 0x09, 0x20, 0x12, 0x9B,
+  0x9B, 0x5A, 0x5B, 0x5A, 0x55, 0x55, 0x88, 0x1F, 0x88, 0x1F, 0x1F, 0x1F, 0xB8, 0xB8, 0xED, 0xED,
+  0xEC, 0xBA, 0x07, 0x07, 0x52, 0x79, 0x2F, 0x78, 0xC6, 0xC6, 0x22, 0x22, 0x22, 0xD6, 0xD6, 0xD6,
+  0xD6, 0x26, 0x26, 0xEA, 0x67, 0x67, 0x67, 0x53, 0xCD, 0xCE, 0xCD, 0x77, 0x77, 0xCA, 0xCA, 0xCA,
+  0xCA, 0xC9, 0x42, 0x41, 0x41, 0xE5, 0xE5, 0x69, 0x1E, 0x69, 0x21, 0xD9, 0xD9, 0xD9, 0xA6, 0xD9,
+  0xA6, 0x46, 0x46, 0xB1, 0x51, 0xB1, 0xE1, 0xE0, 0xAF, 0xAF, 0xD1, 0x90, 0x90, 0x8F, 0x8F, 0xAC,
+  0x92, 0x91, 0x7D, 0x7D, 0xBD, 0xBD, 0x73, 0x73, 0x73, 0xCF, 0x72, 0xA1, 0xA1, 0x6F, 0x30, 0x6E,
+  0x6E, 0x25, 0x6E, 0x25, 0x25, 0x25, 0xA2, 0xA9, 0xA9, 0x73, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x39, 0x3A, 0x3B, 0x6C, 0x6D, 0x6C, 0x6C, 0xC7, 0xC7, 0x10, 0x10, 0x18, 0xBB, 0xBB, 0xFE, 0xBB,
+  0xF5, 0x09, 0x12, 0x09, 0x12, 0x9B, 0x9B, 0x31, 0x5B, 0x3C, 0x5B, 0x56, 0x88, 0x56, 0x88, 0x88,
+  0x87, 0x87, 0xB8, 0xB8, 0xED, 0x4D, 0xBA, 0xBA, 0xEC, 0xBA, 0x07, 0x07, 0x2F, 0x2F, 0x2F, 0xC6,
+  0xC5, 0x22, 0x22, 0xD6, 0xD6, 0xD6, 0xD6, 0x26, 0x26, 0xEB, 0xEB, 0xEA, 0x66, 0x66, 0x54, 0x66,
+  0xCE, 0xCD, 0x5C, 0x77, 0x77, 0xCA, 0xCA, 0xC9, 0xC9, 0x41, 0x41, 0xE5, 0xE5, 0xE4, 0x1E, 0xE4,
+  0x21, 0x69, 0x21, 0xA6, 0xD9, 0xD8, 0xA6, 0xA7, 0x46, 0x46, 0x45, 0x46, 0xE1, 0xE1, 0xE0, 0xAF,
+  0xAF, 0xD1, 0x90, 0x8F, 0xAD, 0xAD, 0x92, 0xAD, 0x91, 0x91, 0x7D, 0x7D, 0xBE, 0xBD, 0x73, 0x73,
+  0xCF, 0xA1, 0xA1, 0xA1, 0xA1, 0x30, 0x30, 0x30, 0x6E, 0x25, 0x25, 0x25, 0x25, 0xA2, 0xA9, 0xA9,
+  0xA9, 0x6E, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x16, 0x3A, 0x6D, 0xC8, 0x6C, 0x6D, 0x10, 0x10,
+  0xC7, 0x18, 0x65, 0x18, 0xFE, 0xFE, 0xF5, 0xF5, 0x29, 0x12, 0x12, 0x20, 0x9E, 0x31, 0x9B, 0x5B,
+  0x3C, 0x5A, 0x56, 0x55, 0x88, 0x88, 0x87, 0x87, 0xB8, 0xB8, 0xB8, 0xB8, 0xED, 0xED, 0xBA, 0xBA,
+  0xBA, 0x07, 0x1C, 0x2F, 0x2F, 0x2F, 0xC6, 0xC5, 0x22, 0xC5, 0x22, 0xD6, 0x22, 0xD7, 0x26, 0xEB,
+  0xEB, 0xEB, 0xEA, 0x67, 0x67, 0x66, 0x53, 0x53, 0xCD, 0x77, 0x5C, 0x76, 0xC9, 0xCA, 0xC9, 0xC9,
+  0x42, 0x41, 0x41, 0x1E, 0xE5, 0xE4, 0x1E, 0x1E, 0x21, 0x21, 0xD9, 0xD9, 0xD9, 0xA6, 0xA6, 0x46,
+  0x46, 0x46, 0x45, 0xB1, 0xE1, 0xE1, 0xAF, 0xAF, 0xAF, 0x90, 0x90, 0xAD, 0x8F, 0xAC, 0xAC, 0x92,
+  0x92, 0x7D, 0xBE, 0xBE, 0x73, 0xBE, 0x73, 0x72, 0x72, 0xA1, 0xA1, 0xA1, 0x30, 0x6F, 0x30, 0x30,
+  0x25, 0x25, 0x25, 0xA2, 0xA9, 0x23, 0xD2, 0xA9, 0xA9, 0xA9, 0x95, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x6B, 0x6D, 0x6C, 0x6C, 0x83, 0x10, 0x10, 0x10, 0x18, 0x65, 0xF5, 0xF5, 0xF5, 0xF5, 0x09,
+  0x12, 0x12, 0x9E, 0x20, 0x9B, 0x9B, 0x5B, 0x3C, 0x3C, 0x56, 0x56, 0x88, 0x88, 0x1F, 0x1F, 0x1F,
+  0xB8, 0xB7, 0x4D, 0x4D, 0xED, 0xBA, 0xBA, 0x07, 0x07, 0x2F, 0x2F, 0x79, 0xC6, 0x2F, 0xC6, 0xC5,
+  0x22, 0xD6, 0xD6, 0xD7, 0x26, 0x26, 0x26, 0xEB, 0xEA, 0xEA, 0x67, 0x66, 0x66, 0x53, 0x53, 0x85,
+  0x77, 0x5C, 0x5C, 0xCA, 0xCA, 0x42, 0x41, 0x41, 0x41, 0xE5, 0xE4, 0xE5, 0x1E, 0x69, 0x21, 0x21,
+  0xD9, 0xD9, 0xD9, 0xD8, 0xA6, 0xA7, 0x46, 0x46, 0x46, 0x51, 0xB1, 0xB1, 0xAF, 0xE0, 0xAF, 0xAF,
+  0xAE, 0x90, 0x90, 0x8F, 0xAD, 0x92, 0x92, 0x92, 0x91, 0xBE, 0xBD, 0x73, 0x72, 0xCF, 0x72, 0xCF,
+  0xA1, 0xA1, 0xA0, 0x6F, 0x30, 0x6E, 0x6E, 0x6E, 0x25, 0x25, 0x25, 0x23, 0xA2, 0x23, 0xA9, 0xA9,
+  0xD3, 0xD3, 0xE4, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xCA, 0xC8, 0x6C, 0xC7, 0xC7, 0xC7, 0x10,
+  0x18, 0xFE, 0xBB, 0xF5, 0xF5, 0xBB, 0x29, 0x12, 0x12, 0x9E, 0x20, 0x20, 0x9B, 0x5B, 0x3C, 0x3C,
+  0x56, 0x88, 0x88, 0x88, 0x87, 0x1F, 0x1F, 0xB8, 0xED, 0xED, 0x4D, 0xBA, 0xEC, 0xBA, 0x07, 0x07,
+  0x79, 0x79, 0x79, 0xC6, 0xC6, 0xC5, 0x22, 0xC5, 0xD6, 0xD6, 0x26, 0xD6, 0x26, 0x26, 0xEA, 0xEB,
+  0xEA, 0x66, 0x54, 0x54, 0x54, 0x86, 0x53, 0x85, 0x5C, 0x76, 0x76, 0xC9, 0xC9, 0x42, 0x41, 0x41,
+  0x41, 0xE5, 0xE4, 0x1E, 0x69, 0x21, 0x21, 0xD9, 0xD9, 0xD9, 0xD9, 0x46, 0x46, 0x46, 0x46, 0x45,
+  0xB1, 0xB1, 0xE1, 0xE1, 0xE1, 0xAF, 0x8F, 0x90, 0xAD, 0xAE, 0xAC, 0xAC, 0x91, 0x91, 0x91, 0xBD,
+  0x7D, 0xBE, 0x73, 0x73, 0x73, 0xCF, 0xA1, 0xA1, 0xD0, 0x6F, 0x30, 0x6F, 0x30, 0x6E, 0x6E, 0x25,
+  0x6E, 0xA2, 0xA2, 0xA9, 0xA9, 0xD3, 0xA9, 0xA8, 0x33, 0x33, 0x11, 0xFA, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0xCC, 0xAB, 0xC7, 0x10, 0xC7, 0x18, 0x18, 0x65, 0xFE, 0xBB, 0xBB, 0xF5, 0xF5, 0x09, 0x9E,
+  0x20, 0x9B, 0x9B, 0x9B, 0x9A, 0x9A, 0x3C, 0x88, 0x56, 0x88, 0x88, 0x88, 0x87, 0x87, 0x1F, 0x87,
+  0xED, 0xED, 0xBA, 0xBA, 0xBA, 0xEC, 0xB9, 0x07, 0x2F, 0xC6, 0x79, 0x78, 0xC6, 0x22, 0x22, 0x22,
+  0x22, 0xD6, 0x26, 0x26, 0xEB, 0x26, 0xEA, 0x67, 0x67, 0x54, 0x54, 0x53, 0x85, 0x85, 0x17, 0x85,
+  0xCA, 0xC9, 0xC9, 0xC9, 0xC9, 0x42, 0x41, 0x41, 0xE5, 0x1E, 0x1E, 0x69, 0x21, 0x1E, 0xD9, 0xD9,
+  0xD9, 0xD9, 0xA7, 0x46, 0xA7, 0x46, 0xB1, 0xB0, 0xB1, 0xB1, 0xE1, 0xE1, 0xE0, 0x8F, 0x90, 0x90,
+  0x8F, 0x8F, 0xAC, 0x92, 0x91, 0x91, 0x91, 0xBD, 0x7D, 0x73, 0xDE, 0x73, 0xCF, 0xA1, 0x72, 0xD0,
+  0xA1, 0x30, 0x6F, 0x6E, 0x6E, 0x6E, 0x25, 0x25, 0x23, 0x23, 0xA2, 0xA9, 0xA2, 0xA8, 0x33, 0x33,
+  0x33, 0x7E, 0xAB, 0xAE, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xEE, 0xC7, 0x6C, 0x18, 0x18, 0xFE,
+  0xBB, 0xBB, 0xF5, 0xF5, 0xF5, 0x9E, 0x9E, 0x9B, 0x20, 0x9B, 0x9B, 0x9A, 0x5B, 0x3C, 0x56, 0x55,
+  0x55, 0x88, 0x88, 0x87, 0xB8, 0x1F, 0xB8, 0xB8, 0xED, 0xBA, 0xED, 0xBA, 0x07, 0x07, 0x07, 0x07,
+  0x79, 0xC6, 0xC6, 0x22, 0x22, 0xD6, 0x22, 0xD6, 0xD6, 0xD6, 0x26, 0x26, 0x67, 0xEA, 0x67, 0x66,
+  0x66, 0x53, 0x53, 0x53, 0x86, 0x53, 0x17, 0x17, 0x76, 0xC9, 0xC9, 0x42, 0x42, 0xE5, 0xE5, 0xE5,
+  0x1E, 0x1E, 0x69, 0x21, 0x21, 0xD9, 0xD9, 0xD9, 0xD8, 0x46, 0xA6, 0xA7, 0x46, 0xB1, 0x45, 0xE1,
+  0xB0, 0xE0, 0xE1, 0xE0, 0xAF, 0x90, 0x8F, 0x8F, 0xAD, 0xAD, 0xAC, 0x92, 0x7D, 0x7D, 0x7D, 0xDE,
+  0xBD, 0xDF, 0xCF, 0xCF, 0x72, 0xA1, 0xA1, 0xA0, 0x30, 0x6E, 0x6E, 0x6E, 0x25, 0x25, 0x25, 0x23,
+  0xA2, 0xA2, 0x23, 0xA9, 0xA9, 0xD3, 0x33, 0x33, 0x0A, 0x11, 0x0A, 0x0B, 0x8D, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x30, 0x18, 0xFE, 0xFE, 0xFE, 0xBB, 0xF5, 0xF5, 0x12, 0x12, 0x12, 0x9E, 0x9B,
+  0x9B, 0x9B, 0x5B, 0x9A, 0x56, 0x56, 0x56, 0x88, 0x88, 0x88, 0x87, 0x1F, 0xB8, 0xB8, 0xED, 0xED,
+  0xBA, 0xBA, 0x07, 0xEC, 0xB9, 0x79, 0x1C, 0x79, 0x2F, 0xC6, 0xC6, 0xC5, 0xC5, 0xD6, 0xD6, 0xD7,
+  0x26, 0x26, 0xEB, 0xEA, 0xEA, 0xEA, 0x67, 0x66, 0x66, 0x53, 0x54, 0x85, 0x53, 0x85, 0x17, 0x17,
+  0xCA, 0xC9, 0x42, 0x41, 0x41, 0x41, 0x41, 0xE5, 0xE4, 0x1E, 0x1E, 0x1E, 0xD9, 0x21, 0xD9, 0xA6,
+  0xA6, 0xA6, 0x46, 0x46, 0x46, 0x46, 0xB1, 0xE1, 0xE1, 0xE0, 0xAF, 0x8F, 0xAE, 0x90, 0xAD, 0xAD,
+  0xAC, 0x92, 0x7D, 0x91, 0xBD, 0xDE, 0xDE, 0xBE, 0x72, 0x72, 0x72, 0xA1, 0xA1, 0xA1, 0x30, 0x6F,
+  0x6F, 0x6E, 0x30, 0x6E, 0x25, 0x25, 0x25, 0xA2, 0x23, 0xA9, 0xA2, 0xA8, 0xD3, 0xD3, 0xD3, 0x0A,
+  0xAB, 0xAB, 0xAB, 0xAA, 0x6F, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xC4, 0x18, 0x65, 0xFE, 0xFE,
+  0xF5, 0xF5, 0xF5, 0x09, 0x12, 0x12, 0x9B, 0x9B, 0x9B, 0x5B, 0x31, 0x5B, 0x56, 0x55, 0x08, 0x88,
+  0x1F, 0x87, 0x87, 0xB8, 0xB8, 0xB8, 0xED, 0xED, 0xBA, 0x07, 0xBA, 0x07, 0x07, 0x07, 0x1C, 0xC6,
+  0xC6, 0xC5, 0xC5, 0xC5, 0xD6, 0xD6, 0xD7, 0xD7, 0x26, 0x26, 0x26, 0x67, 0x67, 0x66, 0x66, 0x53,
+  0x53, 0x53, 0x85, 0x85, 0x17, 0x17, 0x17, 0x2B, 0xC9, 0x42, 0x41, 0x42, 0x41, 0xE5, 0xE5, 0xE4,
+  0x69, 0x21, 0x1E, 0x21, 0xD9, 0xD9, 0xD8, 0xA6, 0xA7, 0x46, 0x46, 0xB1, 0x45, 0xE1, 0xE1, 0xB0,
+  0xAF, 0xAF, 0xAE, 0x90, 0xAD, 0x8F, 0xAD, 0xAC, 0xAC, 0x91, 0x91, 0x7D, 0x7D, 0xBD, 0x73, 0x73,
+  0x72, 0x72, 0x72, 0xA1, 0xA1, 0xA0, 0x6F, 0xA0, 0x6E, 0x6E, 0x25, 0x25, 0x25, 0xA2, 0x25, 0xA9,
+  0x23, 0xA9, 0xD2, 0xD3, 0xD3, 0x33, 0x0A, 0xAB, 0xAA, 0xAA, 0xAA, 0x36, 0x36, 0x28, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0xBD, 0xFE, 0xFE, 0xFE, 0x09, 0x09, 0x09, 0x12, 0x20, 0x20, 0x20, 0x9B,
+  0x5B, 0x31, 0x56, 0x56, 0x56, 0x88, 0x88, 0x88, 0x1F, 0x1F, 0xB8, 0xB7, 0xED, 0xED, 0xED, 0xBA,
+  0xBA, 0xB9, 0xBA, 0x07, 0x79, 0x2F, 0x1C, 0xC6, 0xC6, 0xC5, 0x22, 0x22, 0xD6, 0x26, 0x26, 0x26,
+  0xEB, 0xEB, 0xEB, 0xEA, 0x67, 0x66, 0x54, 0x54, 0x53, 0x85, 0x85, 0x17, 0x17, 0x17, 0x2B, 0x2B,
+  0x41, 0x42, 0x41, 0x41, 0xE5, 0xE5, 0x69, 0x1E, 0x21, 0x21, 0x21, 0xD9, 0xD9, 0xD8, 0x46, 0xA7,
+  0x46, 0x45, 0x45, 0x45, 0xB1, 0xB1, 0xB0, 0xAF, 0xE0, 0xAE, 0xAF, 0x90, 0xAD, 0x8F, 0xAC, 0x91,
+  0x91, 0xAC, 0x7D, 0xBD, 0xBE, 0x73, 0x73, 0xCF, 0x72, 0x72, 0xA1, 0xD0, 0xA1, 0xA1, 0x6E, 0x6E,
+  0x6E, 0x6E, 0x25, 0x25, 0xA2, 0xA2, 0xA9, 0xA2, 0xA9, 0xA8, 0xD2, 0xD3, 0x11, 0x11, 0x7E, 0xAB,
+  0x0B, 0xAA, 0x36, 0x36, 0x36, 0x0A, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xA4, 0x6D, 0xF5, 0xF5,
+  0x09, 0x09, 0x9E, 0x9E, 0x9B, 0x9B, 0x9B, 0x9F, 0x5B, 0x5B, 0x56, 0x88, 0x88, 0x88, 0x88, 0x87,
+  0x87, 0xB8, 0xB8, 0xB7, 0xED, 0xED, 0xEC, 0xBA, 0xBA, 0x07, 0x07, 0x79, 0x2F, 0xC6, 0xC6, 0x22,
+  0x22, 0x22, 0xD6, 0x22, 0xD7, 0xD6, 0x26, 0xEB, 0xEB, 0xEB, 0x67, 0x66, 0x66, 0x67, 0x53, 0x53,
+  0x53, 0x85, 0x85, 0x17, 0x17, 0x2B, 0x2B, 0x2B, 0x42, 0x41, 0xE5, 0xE5, 0xE5, 0x69, 0x1E, 0x21,
+  0x21, 0x21, 0xD9, 0xD9, 0xD8, 0xA7, 0xA6, 0x46, 0x46, 0xB1, 0xB1, 0x45, 0xB1, 0xE1, 0xAF, 0xAE,
+  0x90, 0x90, 0x8F, 0x90, 0xAD, 0xAC, 0x92, 0x92, 0x7D, 0x7D, 0xBE, 0xBE, 0x73, 0x73, 0xCF, 0xCF,
+  0xA1, 0xA1, 0xA1, 0xA1, 0x30, 0x30, 0x6E, 0x25, 0x25, 0x25, 0x25, 0x25, 0xA2, 0x23, 0xA9, 0xA8,
+  0xA9, 0xD2, 0x0A, 0x33, 0x0A, 0x11, 0xAB, 0x0B, 0x0B, 0x36, 0x97, 0x97, 0xD4, 0xD5, 0x41, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0xE5, 0xF5, 0x09, 0x29, 0x9E, 0x12, 0x20, 0x9B, 0x9B, 0x9A, 0x3C,
+  0x56, 0x56, 0x55, 0x88, 0x87, 0x87, 0x1F, 0x1F, 0xB8, 0xB7, 0xB8, 0x4D, 0xED, 0x07, 0xBA, 0x07,
+  0x07, 0x79, 0x2F, 0x79, 0x2F, 0x78, 0xC6, 0x22, 0x22, 0xD6, 0xD6, 0xD7, 0xD6, 0x26, 0x26, 0xEB,
+  0xEB, 0x66, 0x66, 0x67, 0x54, 0x53, 0x53, 0x53, 0x53, 0x17, 0x17, 0x17, 0x2B, 0x17, 0x2B, 0x2A,
+  0x41, 0xE5, 0xE4, 0xE4, 0xE4, 0x69, 0x21, 0xD9, 0x21, 0x21, 0xA6, 0xD8, 0xA7, 0x46, 0xA7, 0x46,
+  0xB1, 0xE1, 0xB1, 0xB0, 0xE1, 0xAF, 0xE0, 0xAF, 0xAF, 0x90, 0x8F, 0xAC, 0xAD, 0x92, 0x92, 0x91,
+  0x91, 0x7D, 0xBD, 0xBD, 0x72, 0xCF, 0x72, 0xA1, 0xA1, 0xA1, 0x6F, 0x6F, 0x6F, 0x6E, 0x6E, 0x25,
+  0x25, 0x25, 0x23, 0x23, 0x23, 0xA9, 0xA9, 0xD2, 0xD3, 0xD3, 0x33, 0x0A, 0xAB, 0xAB, 0x0B, 0xAA,
+  0x0B, 0x36, 0x97, 0x36, 0xD4, 0x6B, 0x6B, 0xA4, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xCC, 0x83, 0x09,
+  0x9E, 0x20, 0x20, 0x9B, 0x9B, 0x3C, 0x5B, 0x5B, 0x5A, 0x56, 0x55, 0x88, 0x1F, 0x1F, 0x87, 0xB8,
+  0xB8, 0xB8, 0xB8, 0x4D, 0xBA, 0x07, 0xEC, 0x07, 0x07, 0x79, 0x78, 0xC6, 0xC6, 0x22, 0x22, 0x22,
+  0x22, 0xD6, 0xD7, 0xD6, 0x26, 0xEB, 0xEA, 0xEA, 0xEA, 0xEA, 0x54, 0x54, 0x53, 0x53, 0x53, 0x53,
+  0x85, 0x85, 0x17, 0x2B, 0x2B, 0x2B, 0x2A, 0x2A, 0x41, 0xE5, 0xE5, 0x69, 0x69, 0x21, 0x21, 0xD9,
+  0xD9, 0xD9, 0xD9, 0xA6, 0x46, 0xA6, 0x46, 0x46, 0xB0, 0xB1, 0xB0, 0xB0, 0xE1, 0xAF, 0x8F, 0x90,
+  0x90, 0x8F, 0xAD, 0x92, 0xAC, 0x92, 0x7D, 0x7D, 0xBE, 0xDE, 0xBD, 0x73, 0x73, 0x72, 0x72, 0xA1,
+  0xA1, 0xA1, 0x30, 0x30, 0x30, 0x6E, 0x25, 0x25, 0xE8, 0x23, 0x23, 0xA2, 0xA9, 0xA9, 0xD3, 0xD3,
+  0xD3, 0x49, 0xC0, 0xAB, 0x0A, 0x0B, 0xAA, 0x0B, 0x36, 0x97, 0x93, 0xD5, 0x6B, 0x1B, 0x1B, 0x7D,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x5C, 0x12, 0x12, 0x20, 0x9B, 0x9A, 0x5B, 0x31, 0x3C, 0x56,
+  0x88, 0x88, 0x1F, 0x1F, 0x87, 0x1F, 0xB8, 0xB8, 0xB8, 0x4D, 0xED, 0xBA, 0xBA, 0x07, 0x07, 0x07,
+  0x2F, 0x2F, 0x78, 0xC5, 0xC6, 0x22, 0x22, 0x22, 0x22, 0xD6, 0xD6, 0x26, 0xEB, 0x67, 0xEB, 0x67,
+  0xEA, 0x66, 0x66, 0x54, 0x53, 0x53, 0x85, 0x17, 0x17, 0x17, 0x2B, 0x2B, 0x2B, 0x2A, 0x2A, 0x60,
+  0x41, 0xE5, 0xE4, 0x69, 0x21, 0x21, 0x21, 0xD9, 0xD9, 0xA7, 0xA7, 0xA6, 0x46, 0x46, 0x46, 0xB1,
+  0xB1, 0xE1, 0xB0, 0xB0, 0xAF, 0xAE, 0x90, 0x90, 0x8F, 0xAC, 0xAC, 0xAC, 0x92, 0x91, 0x7D, 0xBD,
+  0xDE, 0xDE, 0xBE, 0x72, 0xCF, 0x72, 0xA1, 0xA1, 0xA1, 0x30, 0x6E, 0x6E, 0x25, 0x25, 0x25, 0x7A,
+  0xA2, 0x23, 0xA9, 0xA9, 0xA9, 0xA8, 0xD3, 0x33, 0xC1, 0x5E, 0x00, 0x0D, 0x89, 0x0B, 0x36, 0x36,
+  0x36, 0xD5, 0xD5, 0x1B, 0x1B, 0x6B, 0x1B, 0x57, 0x8D, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x1B,
+  0x9B, 0x9B, 0x9B, 0x9A, 0x3C, 0x5A, 0x56, 0x56, 0x88, 0x88, 0x88, 0x87, 0xB8, 0xB8, 0xB8, 0xED,
+  0xED, 0xED, 0xBA, 0xEC, 0xB9, 0x07, 0x07, 0x78, 0x78, 0x78, 0x2F, 0x22, 0xC5, 0x22, 0x22, 0x22,
+  0x26, 0xD6, 0x26, 0x26, 0xEB, 0xEA, 0x67, 0x67, 0x66, 0x53, 0x53, 0x53, 0x85, 0x53, 0x17, 0x2B,
+  0x17, 0x17, 0x2B, 0x2B, 0x2A, 0x2A, 0x2A, 0x5F, 0xE5, 0xE4, 0x1E, 0x21, 0xD9, 0x21, 0xD9, 0xA6,
+  0xD8, 0xA7, 0x46, 0x46, 0x46, 0x51, 0xB1, 0xB1, 0xE1, 0xE1, 0xAF, 0xAF, 0xAF, 0x90, 0x90, 0x8F,
+  0x8F, 0xAD, 0x92, 0x92, 0x92, 0x7D, 0x7D, 0xBE, 0x73, 0x73, 0x73, 0x72, 0xA1, 0xA1, 0xA1, 0xA1,
+  0x30, 0x30, 0x30, 0x6E, 0x6E, 0x25, 0x25, 0xA2, 0xA2, 0xA9, 0x23, 0xA9, 0xD3, 0xD2, 0xD2, 0x49,
+  0x0D, 0x00, 0x00, 0x00, 0x40, 0xAA, 0xAA, 0x97, 0x36, 0xD4, 0x6B, 0x1B, 0x6B, 0x57, 0x1B, 0x57,
+  0xDE, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x3F, 0x9B, 0x9B, 0x5B, 0x3C, 0x3C, 0x5A, 0x55, 0x1F,
+  0x88, 0x88, 0x1F, 0xB8, 0xB8, 0xB8, 0xB8, 0xED, 0xBA, 0xBA, 0x07, 0xEC, 0x79, 0x07, 0x79, 0x2F,
+  0x79, 0x2F, 0xC6, 0xC6, 0x22, 0xD6, 0x22, 0x26, 0xD6, 0x26, 0x26, 0xEB, 0x67, 0x67, 0x67, 0x66,
+  0x66, 0x54, 0x86, 0x53, 0x85, 0x17, 0x2B, 0x17, 0x17, 0x2B, 0x2B, 0x2A, 0x2A, 0x2A, 0x9D, 0x9D,
+  0x69, 0x21, 0x1E, 0x21, 0x21, 0xD9, 0xD9, 0xA7, 0xA7, 0xA6, 0x46, 0x51, 0xB1, 0xB1, 0xB1, 0xE1,
+  0xE1, 0xAF, 0xAF, 0xAE, 0x90, 0x90, 0x8F, 0xAD, 0xAD, 0x92, 0x91, 0x7D, 0x7D, 0x7D, 0xDE, 0xBD,
+  0x73, 0xCF, 0x73, 0xCF, 0xA1, 0xA1, 0xA1, 0x30, 0x30, 0x6E, 0x6E, 0x25, 0x25, 0x25, 0x23, 0x23,
+  0xA9, 0xA9, 0xA9, 0xD3, 0xD3, 0xD2, 0xD3, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x36, 0xD5,
+  0xD5, 0x1B, 0x1B, 0x1B, 0x57, 0x57, 0x3A, 0x57, 0xF3, 0x04, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0xA9, 0x9B, 0x5B, 0x5B, 0x56, 0x88, 0x55, 0x55, 0x87, 0x1F, 0x1F, 0xB8, 0xB8, 0xB8, 0xED, 0xED,
+  0xBA, 0xBA, 0x07, 0x07, 0x07, 0x2F, 0x2F, 0xC6, 0x2F, 0xC5, 0x22, 0x22, 0x22, 0xD6, 0xD6, 0xD6,
+  0x26, 0x26, 0xEA, 0xEB, 0xEA, 0xEA, 0x66, 0x54, 0x54, 0x85, 0x53, 0x85, 0x85, 0x17, 0x17, 0x2B,
+  0x2B, 0x2B, 0x2A, 0x2A, 0x2A, 0x2A, 0x9D, 0x5F, 0x69, 0x69, 0x21, 0x21, 0xD9, 0xD9, 0xD8, 0xA7,
+  0x46, 0x46, 0x46, 0x51, 0x46, 0xB1, 0xE1, 0xB0, 0xB0, 0xAF, 0xAF, 0x8F, 0x90, 0x8F, 0x8F, 0xAC,
+  0xAD, 0x91, 0x7D, 0xBD, 0x91, 0xBE, 0x73, 0x73, 0x73, 0xA1, 0xA1, 0xA1, 0xA1, 0xA0, 0x30, 0x6E,
+  0x30, 0x6E, 0x6E, 0x25, 0x25, 0x23, 0xA2, 0xA9, 0xA9, 0xA9, 0xD3, 0xD3, 0x33, 0x33, 0x89, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x6B, 0xD5, 0x6B, 0x58, 0x1B, 0x57, 0x57, 0xB6, 0xB6, 0xF3,
+  0x3A, 0xD4, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xFA, 0x5B, 0x5B, 0x88, 0x55, 0x88, 0x1F, 0x1F,
+  0x87, 0x1F, 0xB8, 0xB8, 0xED, 0xED, 0xED, 0xBA, 0xBA, 0xBA, 0x07, 0x2F, 0x2F, 0x1C, 0x78, 0xC6,
+  0xC6, 0x22, 0xC5, 0x22, 0x22, 0x22, 0xD6, 0x26, 0x26, 0x67, 0x26, 0xEA, 0x67, 0x66, 0x66, 0x53,
+  0x53, 0x53, 0x85, 0x85, 0x17, 0x17, 0x2B, 0x2B, 0x2B, 0x2A, 0x2A, 0x2A, 0x60, 0x9D, 0x5F, 0x9C,
+  0x21, 0x21, 0x21, 0xD9, 0xD9, 0xD9, 0xA7, 0xA6, 0x46, 0x51, 0x46, 0xB1, 0xB0, 0xE1, 0xE0, 0xE1,
+  0xAF, 0xAF, 0xAE, 0xAD, 0x8F, 0xAD, 0xAD, 0xAC, 0x91, 0x92, 0x7D, 0xBE, 0xBE, 0xDE, 0x73, 0xCF,
+  0x72, 0xA1, 0xA1, 0x72, 0xA1, 0xA0, 0x6E, 0x30, 0x30, 0x25, 0x6E, 0x25, 0x25, 0x23, 0x23, 0xA9,
+  0xA8, 0xD2, 0xD3, 0x33, 0x0A, 0x7E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xD4,
+  0x58, 0x6B, 0x1B, 0xF3, 0x57, 0x3B, 0x3A, 0x3A, 0x3A, 0x3A, 0xCA, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0xB1, 0x56, 0x56, 0x88, 0x88, 0x88, 0x1F, 0xB8, 0xB8, 0xB7, 0x4D, 0xED, 0xED, 0xBA, 0xBA,
+  0xB9, 0x07, 0x79, 0x2F, 0x2F, 0x79, 0xC5, 0xC5, 0xC5, 0x22, 0x22, 0xD6, 0xD6, 0xD6, 0xD6, 0x26,
+  0xEB, 0xEB, 0xEB, 0x66, 0x66, 0x66, 0x66, 0x53, 0x53, 0x85, 0x17, 0x17, 0x17, 0x2B, 0x2B, 0x2A,
+  0x2A, 0x2A, 0x9D, 0x2A, 0x5F, 0x5F, 0x5F, 0x50, 0x21, 0x21, 0x21, 0xD8, 0x46, 0xA7, 0xA7, 0x46,
+  0x46, 0x46, 0xB1, 0xB1, 0xB0, 0xE1, 0xE0, 0xAF, 0xAF, 0x90, 0x8F, 0xAE, 0x8F, 0x92, 0xAC, 0x92,
+  0x92, 0x91, 0xBE, 0xBD, 0xBE, 0x73, 0x73, 0x73, 0xA1, 0xA1, 0xA1, 0xA1, 0x30, 0x30, 0x30, 0x6E,
+  0x6E, 0x25, 0x25, 0x23, 0xA2, 0xA9, 0xA9, 0xA9, 0xA9, 0xD3, 0xD3, 0x0A, 0x7E, 0x89, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x58, 0x57, 0x57, 0x57, 0xF3, 0x3A, 0x3A, 0x3A, 0x3A,
+  0x6C, 0x6D, 0x1B, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xCC, 0xF5, 0x88, 0x88, 0x88, 0x1F, 0x87,
+  0xB8, 0xB8, 0xED, 0xED, 0xED, 0xBA, 0xBA, 0xB9, 0x07, 0x07, 0x79, 0x79, 0xC6, 0xC6, 0xC6, 0xC5,
+  0x22, 0x22, 0xD6, 0x26, 0xD6, 0x26, 0x26, 0xEB, 0x67, 0xEA, 0x66, 0x66, 0x53, 0x53, 0x53, 0x53,
+  0x85, 0x17, 0x17, 0x17, 0x17, 0x2B, 0x2B, 0x2A, 0x2A, 0x2A, 0x60, 0x5F, 0x9C, 0x50, 0x50, 0x24,
+  0xD9, 0xD9, 0xA6, 0xA6, 0xA6, 0x46, 0x46, 0x46, 0x46, 0xB1, 0x45, 0xB1, 0xE1, 0xB0, 0xAF, 0xAF,
+  0xAF, 0x90, 0x8F, 0xAC, 0xAD, 0x92, 0x91, 0x91, 0x91, 0xBD, 0x7D, 0xDE, 0x73, 0xCF, 0x72, 0xA1,
+  0xCF, 0xA1, 0x6F, 0x30, 0x6E, 0x6E, 0x6E, 0x25, 0x25, 0x25, 0x23, 0xA2, 0x23, 0xA9, 0xA8, 0xA9,
+  0xD3, 0xA8, 0xD3, 0x7E, 0x11, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37,
+  0x58, 0xF3, 0xB6, 0xF3, 0x3A, 0xF3, 0x3A, 0x3A, 0x6D, 0x6D, 0x6C, 0xE1, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0xD9, 0x88, 0x87, 0x1F, 0x1F, 0x1F, 0xB7, 0x4D, 0xBA, 0xBA, 0xBA, 0xBA, 0x07, 0x07,
+  0x79, 0x1C, 0x2F, 0x2F, 0xC5, 0xC6, 0xC5, 0x22, 0x22, 0xD6, 0xD6, 0x26, 0x26, 0x26, 0xEB, 0x26,
+  0xEA, 0x66, 0x67, 0x66, 0x53, 0x53, 0x53, 0x85, 0x17, 0x85, 0x17, 0x2B, 0x2B, 0x2B, 0x2A, 0x2A,
+  0x2A, 0x9D, 0x60, 0x5F, 0x5F, 0x50, 0x50, 0x50, 0x21, 0xA6, 0xD8, 0xA7, 0x46, 0x46, 0x46, 0x46,
+  0xB1, 0xB1, 0xB1, 0xE1, 0xE1, 0xAF, 0x8F, 0x90, 0x90, 0x8F, 0xAD, 0xAC, 0xAC, 0x92, 0x91, 0x7D,
+  0x7D, 0xDE, 0x73, 0x72, 0x72, 0xCF, 0x72, 0xA1, 0xA1, 0xA1, 0x30, 0x6E, 0x6E, 0x6E, 0x6E, 0x25,
+  0x25, 0x23, 0xA2, 0x23, 0x23, 0xA8, 0xD2, 0xD2, 0x33, 0x11, 0x11, 0x11, 0x37, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x49, 0xB6, 0xF3, 0xF2, 0x3A, 0x3B, 0x6D, 0x6D,
+  0x6C, 0x83, 0x6C, 0x6C, 0x39, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xCC, 0x6C, 0x1F, 0x1F, 0xB8, 0xB8,
+  0xB8, 0xED, 0xED, 0xED, 0xBA, 0xB9, 0x07, 0x79, 0x79, 0x79, 0xC6, 0xC6, 0x22, 0x22, 0x22, 0x22,
+  0x22, 0xD7, 0xD7, 0x26, 0x26, 0xEB, 0xEB, 0xEA, 0x67, 0x67, 0x66, 0x53, 0x53, 0x86, 0x85, 0x85,
+  0x17, 0x2B, 0x2B, 0x2B, 0x2A, 0x2A, 0x2A, 0x60, 0x9D, 0x9D, 0x9C, 0x5F, 0x50, 0x50, 0x50, 0x4F,
+  0xD9, 0xA6, 0xA7, 0xA6, 0x46, 0xA7, 0x46, 0x45, 0xB1, 0xE1, 0xE1, 0xE0, 0xAF, 0xAE, 0x90, 0x8F,
+  0x90, 0xAD, 0xAC, 0xAD, 0x92, 0x91, 0x91, 0x7D, 0xDE, 0x73, 0x72, 0x73, 0x73, 0xA1, 0xA1, 0xA1,
+  0xA1, 0x30, 0x30, 0x6E, 0x6E, 0x6E, 0x25, 0x25, 0xA2, 0x23, 0x23, 0xA9, 0xA9, 0xD2, 0xD2, 0x33,
+  0x0A, 0x11, 0x7E, 0xAB, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4A, 0x3A, 0xF2, 0x3A, 0x3A, 0x6D, 0x6D, 0x6D, 0x83, 0xC8, 0x83, 0xC7, 0xA1, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0xE3, 0x1F, 0xB8, 0xED, 0xB7, 0x4D, 0xED, 0xBA, 0xBA, 0x07, 0x07, 0x07, 0x79,
+  0x78, 0x2F, 0xC6, 0xC6, 0x22, 0x22, 0x22, 0xD6, 0xD6, 0xD6, 0xD6, 0x26, 0xEB, 0x67, 0x66, 0xEA,
+  0x67, 0x54, 0x53, 0x53, 0x86, 0x85, 0x85, 0x17, 0x17, 0x17, 0x2A, 0x2B, 0x2A, 0x9D, 0x9D, 0x9D,
+  0x5F, 0x5F, 0x9C, 0x50, 0x50, 0x24, 0x4F, 0x24, 0xD9, 0xD9, 0x46, 0x46, 0x45, 0x45, 0xB1, 0x45,
+  0xB0, 0xE1, 0xB0, 0xE0, 0xAF, 0x90, 0x90, 0x90, 0xAD, 0x92, 0x92, 0x92, 0x7D, 0x7D, 0x7D, 0xBE,
+  0x73, 0x73, 0xCF, 0x72, 0xCF, 0xA1, 0xA1, 0xA0, 0x30, 0x6E, 0x30, 0x6E, 0x6E, 0x25, 0x25, 0xA2,
+  0x23, 0xA2, 0xA9, 0xA9, 0xA9, 0x33, 0xD3, 0x33, 0x0A, 0xAB, 0x7E, 0x37, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x49, 0x3A, 0x3A, 0x6D, 0x6D, 0xC8, 0xC8,
+  0x6C, 0xC7, 0xC7, 0x10, 0x10, 0x39, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xAB, 0xB8, 0x4D, 0x4D,
+  0xED, 0xBA, 0xBA, 0xBA, 0xEC, 0x07, 0x2F, 0x2F, 0x79, 0xC6, 0xC6, 0x22, 0x22, 0x22, 0xD6, 0xD6,
+  0x26, 0x26, 0xEB, 0xEB, 0xEA, 0xEA, 0x67, 0x67, 0x66, 0x53, 0x53, 0x53, 0x85, 0x85, 0x17, 0x17,
+  0x17, 0x2B, 0x2B, 0x2A, 0x2A, 0x2A, 0x9D, 0x9D, 0x9D, 0x5F, 0x50, 0x9C, 0x4F, 0x4F, 0x4F, 0x24,
+  0xA7, 0xA7, 0x46, 0x46, 0x46, 0xB1, 0x45, 0xE1, 0xE1, 0xE1, 0xAF, 0x90, 0x8F, 0xAD, 0xAD, 0xAD,
+  0x8F, 0x92, 0x92, 0x7D, 0x91, 0xBE, 0xBE, 0xDE, 0x72, 0x73, 0x72, 0xCF, 0xD0, 0xA1, 0xA1, 0x30,
+  0xA1, 0x30, 0x6E, 0x6E, 0x6E, 0x25, 0x23, 0x23, 0x23, 0xA2, 0xA9, 0xA8, 0xD2, 0xD3, 0x0A, 0x0A,
+  0x11, 0xAB, 0x49, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x40, 0x3A, 0x6D, 0x3B, 0x6D, 0x6C, 0x6C, 0x6C, 0xC7, 0x10, 0x65, 0x65, 0x97, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x8B, 0xB7, 0x4D, 0xED, 0xBA, 0xBA, 0xB9, 0x07, 0x2F, 0x1C, 0x79, 0x79,
+  0x2F, 0x22, 0x22, 0x22, 0x22, 0xD6, 0xD6, 0xD6, 0xD6, 0x26, 0x67, 0x67, 0xEA, 0x67, 0x66, 0x66,
+  0x66, 0x53, 0x85, 0x17, 0x17, 0x17, 0x17, 0x2B, 0x2B, 0x2A, 0x2A, 0x2A, 0x9D, 0x9D, 0x9D, 0x9D,
+  0x50, 0x50, 0x50, 0x50, 0x24, 0x24, 0x62, 0x62, 0x46, 0x46, 0x46, 0x46, 0x45, 0xB1, 0xE1, 0xE0,
+  0xAF, 0xE0, 0xAF, 0x8F, 0x8F, 0x8F, 0x8F, 0xAC, 0x92, 0x92, 0x7D, 0x91, 0xBD, 0xBE, 0xDE, 0x72,
+  0x73, 0xCF, 0xA1, 0xA1, 0xA1, 0xA1, 0x30, 0x30, 0x6E, 0x6E, 0x25, 0x25, 0x25, 0x25, 0x23, 0xA2,
+  0xA9, 0xA9, 0xA9, 0x33, 0x11, 0xD3, 0x33, 0x11, 0xAB, 0xAA, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x6D, 0x6C, 0xC8, 0x6C, 0xC7,
+  0xC7, 0x10, 0x10, 0x18, 0x18, 0x65, 0xE5, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x0B, 0xED, 0xBA,
+  0xBA, 0xBA, 0xB9, 0x1C, 0x79, 0x2F, 0xC6, 0xC6, 0xC5, 0x22, 0xC5, 0xD6, 0xD6, 0xD6, 0x26, 0x26,
+  0x26, 0xEB, 0x67, 0xEA, 0xEA, 0x66, 0x66, 0x54, 0x53, 0x85, 0x17, 0x85, 0x17, 0x85, 0x2B, 0x2B,
+  0x2A, 0x2B, 0x2A, 0x9D, 0x5F, 0x9D, 0x5F, 0x9D, 0x50, 0x50, 0x4F, 0x4F, 0x24, 0x24, 0x62, 0x62,
+  0x46, 0x46, 0x46, 0xB1, 0xB1, 0xE1, 0xB0, 0xAF, 0xAF, 0xD1, 0xD1, 0x90, 0xAD, 0xAD, 0xAC, 0xAC,
+  0x92, 0x92, 0x7D, 0xBD, 0xBE, 0x73, 0x73, 0x73, 0x72, 0xA1, 0xA1, 0xA1, 0x30, 0x30, 0x6E, 0x6E,
+  0x30, 0x25, 0x25, 0x25, 0x23, 0x23, 0x23, 0xA9, 0xA9, 0xA8, 0xD2, 0x33, 0x0A, 0x7E, 0x7E, 0x7E,
+  0xAB, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x2D, 0x6C, 0x6C, 0xC8, 0x83, 0x10, 0xBC, 0xC7, 0x18, 0x65, 0xFE, 0xF5, 0x6C, 0x02,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x19, 0x5A, 0xBA, 0xBA, 0x07, 0x07, 0x07, 0x79, 0xC6, 0xC6, 0xC5,
+  0x22, 0x22, 0x22, 0xD6, 0xD6, 0x26, 0x26, 0x26, 0xEA, 0x67, 0xEA, 0xEA, 0x54, 0x66, 0x53, 0x53,
+  0x53, 0x85, 0x17, 0x17, 0x17, 0x17, 0x2B, 0x2A, 0x2A, 0x2A, 0x2A, 0x9D, 0x9D, 0x9C, 0x5F, 0x5F,
+  0x50, 0x50, 0x24, 0x4F, 0x24, 0x24, 0x43, 0x61, 0x46, 0x46, 0xE1, 0xB1, 0xE1, 0xB1, 0xE1, 0xAF,
+  0xAF, 0x90, 0x8F, 0x90, 0xAD, 0xAC, 0xAC, 0x91, 0x91, 0x7D, 0xDE, 0x7D, 0xDE, 0x73, 0x72, 0xCF,
+  0xCF, 0xA1, 0xA0, 0xA1, 0x30, 0x30, 0x30, 0x6E, 0x6E, 0x25, 0x25, 0x25, 0x25, 0xA9, 0xA9, 0xA9,
+  0xD3, 0xD3, 0xD3, 0x0A, 0x33, 0x11, 0x0B, 0xAA, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x10, 0xC7, 0x10, 0xC7,
+  0xC7, 0x18, 0xFE, 0xFE, 0xFE, 0xF5, 0xF5, 0xE5, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x46, 0x07,
+  0x07, 0x79, 0x1C, 0xC6, 0x2F, 0xC6, 0xC5, 0xC5, 0xD6, 0x22, 0xD7, 0xD6, 0xD6, 0x26, 0x26, 0x67,
+  0xEB, 0x26, 0x67, 0x66, 0x66, 0x53, 0x53, 0x53, 0x85, 0x17, 0x17, 0x17, 0x17, 0x2B, 0x17, 0x2A,
+  0x2A, 0x2A, 0x60, 0x9D, 0x5F, 0x5F, 0x50, 0x50, 0x50, 0x4F, 0x4F, 0x24, 0x24, 0x62, 0x61, 0x0E,
+  0xB1, 0xB1, 0xB1, 0xB1, 0xB0, 0xAF, 0xAF, 0x90, 0x90, 0xAE, 0xAD, 0xAD, 0xAD, 0xAC, 0x92, 0x92,
+  0xBD, 0xDE, 0xDE, 0x73, 0xDE, 0x72, 0xCF, 0xCF, 0xA1, 0xA1, 0xA1, 0xA1, 0x30, 0x6E, 0x6E, 0x6E,
+  0x25, 0x25, 0x23, 0xA2, 0xA2, 0xA2, 0xA9, 0xD3, 0xD2, 0x33, 0x33, 0x11, 0x0A, 0xAB, 0x7E, 0x0B,
+  0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xF8, 0x10, 0x6C, 0xC7, 0xC7, 0x18, 0xFE, 0xFE, 0xF5, 0xF5, 0xF5, 0x09, 0x12,
+  0x19, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xCC, 0x88, 0x79, 0x79, 0x2F, 0x78, 0xC6, 0xC6, 0x22, 0x22,
+  0x22, 0x22, 0x26, 0xD6, 0xD6, 0x26, 0x26, 0xEA, 0x66, 0x67, 0x66, 0x66, 0x53, 0x53, 0x86, 0x85,
+  0x17, 0x85, 0x17, 0x2B, 0x2B, 0x2B, 0x2B, 0x2A, 0x9D, 0x9D, 0x5F, 0x5F, 0x50, 0x50, 0x50, 0x50,
+  0x4F, 0x24, 0x24, 0x24, 0x43, 0x62, 0x61, 0x0E, 0xB1, 0xB0, 0xE1, 0xAF, 0xE1, 0xAF, 0xAE, 0x90,
+  0x90, 0xAD, 0x8F, 0xAD, 0x91, 0x91, 0x7D, 0x7D, 0x7D, 0xBE, 0xDE, 0x73, 0xCF, 0xCF, 0xA1, 0xA1,
+  0xA1, 0xA1, 0x30, 0x30, 0x30, 0x6E, 0x6E, 0x25, 0x23, 0x25, 0xA2, 0x23, 0xA9, 0xA9, 0xD3, 0xD2,
+  0xD3, 0x33, 0x33, 0x7E, 0xAB, 0xAB, 0x0B, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x10, 0x18, 0x18,
+  0x18, 0xFE, 0xFE, 0xF5, 0xF5, 0x09, 0x29, 0x20, 0xA2, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xE5,
+  0x79, 0x79, 0x78, 0xC6, 0x22, 0xC5, 0x22, 0xD6, 0xD6, 0xD7, 0xD6, 0xD6, 0xEB, 0xEB, 0xEA, 0x66,
+  0x67, 0x66, 0x54, 0x53, 0x53, 0x53, 0x85, 0x85, 0x17, 0x17, 0x17, 0x2B, 0x2A, 0x2A, 0x2A, 0x2A,
+  0x60, 0x9D, 0x9D, 0x5F, 0x5F, 0x24, 0x4F, 0x4F, 0x24, 0x62, 0x24, 0x61, 0x43, 0x61, 0x61, 0x05,
+  0xB1, 0xB1, 0xE1, 0xAF, 0xAF, 0xAE, 0xAE, 0x90, 0x8F, 0xAD, 0xAD, 0x92, 0x92, 0x7D, 0x7D, 0xDE,
+  0x7D, 0x73, 0x73, 0x73, 0xCF, 0xA1, 0x72, 0xA1, 0xA0, 0x30, 0x6F, 0x6E, 0x6E, 0x6E, 0x25, 0x25,
+  0x25, 0x23, 0x23, 0xA9, 0xA9, 0xA8, 0xD3, 0xD3, 0x33, 0x11, 0x7E, 0x7E, 0xAB, 0xAA, 0x36, 0x37,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x5E, 0x65, 0xFE, 0xFE, 0xBB, 0xFE, 0xF5, 0xBB, 0x12, 0x12, 0x12, 0x12,
+  0x20, 0x3F, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x12, 0xC6, 0x2F, 0xC6, 0xC5, 0x22, 0x22, 0x22,
+  0xD6, 0xD6, 0x26, 0x26, 0x26, 0x67, 0x67, 0x67, 0x66, 0x66, 0x53, 0x53, 0x85, 0x85, 0x85, 0x17,
+  0x17, 0x17, 0x2B, 0x2A, 0x2A, 0x2A, 0x9D, 0x2A, 0x9D, 0x9D, 0x9C, 0x50, 0x50, 0x50, 0x4F, 0x24,
+  0x24, 0x24, 0x43, 0x43, 0x61, 0x0E, 0x0E, 0x05, 0xB1, 0xB0, 0xE0, 0xAF, 0xAF, 0x90, 0x90, 0x90,
+  0x8F, 0x92, 0xAC, 0x91, 0x92, 0x91, 0xBD, 0xBE, 0xBD, 0x73, 0x73, 0x72, 0xA1, 0xA1, 0xA1, 0xA1,
+  0x30, 0x6F, 0x6E, 0x6E, 0x6E, 0x25, 0x25, 0x25, 0x25, 0xA2, 0xA9, 0xA9, 0xA8, 0xD3, 0xD3, 0x33,
+  0x11, 0xAB, 0xAB, 0xAA, 0x0B, 0x0B, 0x36, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDB, 0xFE, 0xBB,
+  0xF5, 0xFE, 0xF5, 0x09, 0x12, 0x12, 0x20, 0x12, 0x20, 0x23, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x1A, 0xC6, 0xC5, 0xC5, 0x22, 0x22, 0xD6, 0xD6, 0xD6, 0x26, 0xEB, 0xEB, 0xEA, 0xEA, 0xEA, 0x67,
+  0x54, 0x66, 0x53, 0x53, 0x85, 0x17, 0x17, 0x2B, 0x17, 0x2B, 0x2A, 0x2A, 0x2A, 0x2A, 0x9D, 0x5F,
+  0x9C, 0x5F, 0x50, 0x50, 0x50, 0x4F, 0x24, 0x24, 0x62, 0x62, 0x61, 0x61, 0x0E, 0x61, 0x61, 0x05,
+  0xE0, 0xE1, 0xE0, 0xAF, 0x8F, 0x8F, 0x8F, 0xAD, 0xAD, 0x92, 0x92, 0x7D, 0xBD, 0xBD, 0x73, 0xDE,
+  0x73, 0x72, 0x72, 0xA1, 0xA1, 0xA1, 0xA1, 0x6F, 0x30, 0x6E, 0x6E, 0x6E, 0x25, 0x25, 0x25, 0x23,
+  0xA9, 0xA9, 0xA8, 0xD3, 0xA8, 0xD3, 0x11, 0x7E, 0x11, 0xAB, 0xAA, 0xAA, 0x36, 0x36, 0x37, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xBB, 0xF5, 0xF5, 0xF5, 0x09, 0x12, 0x12, 0x9E, 0x20, 0x9B,
+  0x31, 0x5B, 0xE2, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x1B, 0x22, 0x22, 0xD6, 0xD7, 0xD6, 0xD7,
+  0x26, 0x26, 0x26, 0xEA, 0x67, 0x67, 0x67, 0x66, 0x66, 0x53, 0x86, 0x53, 0x85, 0x85, 0x17, 0x17,
+  0x2B, 0x2B, 0x2A, 0x2A, 0x9D, 0x9D, 0x9D, 0x9D, 0x5F, 0x50, 0x50, 0x9C, 0x4F, 0x24, 0x24, 0x62,
+  0x43, 0x43, 0x0E, 0x0E, 0x0E, 0x05, 0x05, 0x05, 0xB0, 0xAF, 0xAF, 0xAF, 0x90, 0xAD, 0xAD, 0xAD,
+  0x91, 0xAC, 0x91, 0xBD, 0xBE, 0xBD, 0xDE, 0x73, 0xCF, 0xCF, 0x72, 0xA1, 0x6F, 0xA1, 0xA0, 0x6E,
+  0x6E, 0x6E, 0x25, 0x25, 0x25, 0x25, 0x25, 0xA2, 0xA9, 0xA8, 0xD3, 0x33, 0xD3, 0x33, 0x11, 0x11,
+  0xAB, 0xAB, 0xAA, 0xAA, 0x0B, 0x49, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFE, 0xBB, 0xF5,
+  0xF5, 0x29, 0x12, 0x12, 0x12, 0x20, 0x9B, 0x9B, 0x9A, 0x5B, 0x3A, 0xCC, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x84, 0x22, 0x22, 0xD6, 0xD6, 0xD6, 0x26, 0xEB, 0x67, 0xEA, 0xEA, 0xEA, 0x67, 0x54, 0x53,
+  0x53, 0x85, 0x53, 0x85, 0x17, 0x2B, 0x17, 0x2B, 0x2A, 0x2A, 0x2A, 0x2A, 0x9D, 0x60, 0x5F, 0x5F,
+  0x50, 0x24, 0x50, 0x4F, 0x24, 0x24, 0x62, 0x61, 0x61, 0x61, 0x0E, 0x0E, 0x0E, 0x05, 0x05, 0x05,
+  0xAF, 0x90, 0x90, 0x90, 0xAD, 0xAD, 0xAD, 0x91, 0x92, 0x92, 0x7D, 0xBE, 0xDE, 0xBE, 0x73, 0xCF,
+  0x72, 0xA1, 0xA1, 0xA1, 0xA0, 0x30, 0x6E, 0x30, 0x6E, 0x25, 0x25, 0xA2, 0x25, 0xA2, 0xA2, 0xA9,
+  0xA9, 0xA8, 0xD3, 0xD2, 0x0A, 0x11, 0x7E, 0xAB, 0xAB, 0xAA, 0xAA, 0x36, 0x36, 0x4A, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x37, 0xF5, 0xF5, 0xBB, 0xF5, 0x12, 0x12, 0x20, 0x20, 0x20, 0x9B, 0x9B,
+  0x5B, 0x5B, 0x5A, 0x21, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x6E, 0xD6, 0xD6, 0xD6, 0x26, 0x26,
+  0xEB, 0xEB, 0x67, 0x67, 0x66, 0x54, 0x53, 0x53, 0x53, 0x85, 0x17, 0x17, 0x17, 0x2B, 0x2B, 0x2A,
+  0x2B, 0x2A, 0x2A, 0x60, 0x9D, 0x5F, 0x5F, 0x50, 0x50, 0x4F, 0x4F, 0x4F, 0x62, 0x62, 0x61, 0x61,
+  0x43, 0x61, 0x05, 0x0E, 0x0E, 0x05, 0x0C, 0x05, 0x90, 0xAE, 0xAE, 0xAD, 0x8F, 0xAD, 0x92, 0x92,
+  0x92, 0xBD, 0xBE, 0xDE, 0x73, 0x72, 0x73, 0xCF, 0xA1, 0xA1, 0xA1, 0x6F, 0x30, 0x30, 0x30, 0x6E,
+  0x25, 0x25, 0x25, 0x25, 0x23, 0xA9, 0xA9, 0xA9, 0xD2, 0xD3, 0x33, 0x33, 0x11, 0x0A, 0x7E, 0x7E,
+  0x0B, 0x97, 0x36, 0xD5, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFE, 0xBB, 0xBB, 0xF5,
+  0x12, 0x12, 0x20, 0x31, 0x9B, 0x9B, 0x5B, 0x56, 0x5A, 0x56, 0x56, 0x9E, 0x02, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0xCC, 0xBA, 0xD6, 0xD6, 0x26, 0xEB, 0xEA, 0xEA, 0x67, 0x66, 0x66, 0x66, 0x53, 0x53,
+  0x85, 0x17, 0x17, 0x17, 0x17, 0x2B, 0x2B, 0x2A, 0x2A, 0x2A, 0x9D, 0x5F, 0x5F, 0x9C, 0x50, 0x50,
+  0x24, 0x4F, 0x24, 0x24, 0x62, 0x62, 0x61, 0x61, 0x0E, 0x0E, 0x61, 0x05, 0x05, 0x05, 0x05, 0x0C,
+  0x8F, 0x8F, 0x8F, 0xAD, 0x92, 0x92, 0x92, 0x7D, 0xBD, 0xBD, 0xBE, 0x73, 0x73, 0xCF, 0xCF, 0xCF,
+  0xA1, 0xA0, 0xA0, 0x30, 0xA0, 0x6E, 0x25, 0x25, 0x25, 0x25, 0x23, 0x23, 0x23, 0xA9, 0xA9, 0xA8,
+  0xA8, 0x33, 0x11, 0x0A, 0xAB, 0xAB, 0xAA, 0xAA, 0x0B, 0x97, 0x36, 0xD4, 0x40, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xDB, 0xF4, 0xF5, 0x29, 0x29, 0x12, 0x12, 0x20, 0x9B, 0x9B, 0x5B, 0x5B, 0x3C,
+  0x56, 0x56, 0x88, 0x1F, 0xDE, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xAF, 0x26, 0x26, 0xEB, 0xEB,
+  0xEA, 0x66, 0x66, 0x53, 0x53, 0x53, 0x53, 0x53, 0x17, 0x17, 0x2B, 0x2B, 0x2B, 0x17, 0x2A, 0x2A,
+  0x2A, 0x60, 0x60, 0x9D, 0x5F, 0x9C, 0x50, 0x4F, 0x50, 0x4F, 0x24, 0x24, 0x24, 0x43, 0x43, 0x61,
+  0x0E, 0x05, 0x05, 0x05, 0x05, 0x0C, 0x0C, 0x0C, 0xAD, 0x8F, 0xAD, 0x92, 0xAC, 0x91, 0x7D, 0x7D,
+  0x7D, 0xBE, 0xBD, 0xDE, 0x73, 0xCF, 0xA1, 0xA1, 0xD0, 0x6F, 0x30, 0x6F, 0x30, 0x25, 0x25, 0x25,
+  0x25, 0x23, 0x23, 0xA9, 0xA9, 0xA9, 0xD3, 0xD2, 0xD3, 0x33, 0x7E, 0x7E, 0xAB, 0xAB, 0xAA, 0x0B,
+  0xAA, 0x36, 0x6B, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xF5, 0xF5, 0x09, 0x09, 0x9E,
+  0x20, 0x20, 0x20, 0x9B, 0x9B, 0x5A, 0x5B, 0x5A, 0x88, 0x56, 0x88, 0x88, 0x1F, 0x8B, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0xCC, 0x55, 0xEB, 0xEA, 0xEA, 0x67, 0x66, 0x66, 0x53, 0x53, 0x85, 0x53, 0x17,
+  0x85, 0x17, 0x2B, 0x2B, 0x2B, 0x2A, 0x2A, 0x2A, 0x60, 0x9D, 0x5F, 0x5F, 0x50, 0x50, 0x50, 0x4F,
+  0x62, 0x24, 0x24, 0x62, 0x61, 0x61, 0x0E, 0x0E, 0x05, 0x05, 0x05, 0x05, 0x0C, 0x0C, 0x0C, 0x59,
+  0xAD, 0xAD, 0x92, 0xAC, 0x91, 0x91, 0x7D, 0xBE, 0xBE, 0x73, 0xDE, 0xCF, 0x73, 0xA1, 0xA1, 0xA1,
+  0x30, 0x30, 0x6E, 0x30, 0x6E, 0x6E, 0x25, 0x25, 0x23, 0xA9, 0xA9, 0xA9, 0xA9, 0xA8, 0xD3, 0x33,
+  0x0A, 0x11, 0xAB, 0xAB, 0xAB, 0xAA, 0x0B, 0x36, 0x97, 0xD5, 0xD5, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xDB, 0xF5, 0x29, 0x09, 0x12, 0x20, 0x20, 0x31, 0x9B, 0x5B, 0x5B, 0x56, 0x5A, 0x56,
+  0x56, 0x88, 0x88, 0x1F, 0xB8, 0xAB, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xCA, 0xEA, 0xEA, 0xEA,
+  0x54, 0x54, 0x66, 0x53, 0x86, 0x17, 0x17, 0x17, 0x17, 0x17, 0x2B, 0x2A, 0x2A, 0x2B, 0x60, 0x9D,
+  0x60, 0x9C, 0x5F, 0x50, 0x50, 0x50, 0x4F, 0x4F, 0x62, 0x62, 0x43, 0x43, 0x61, 0x61, 0x05, 0x0E,
+  0x05, 0x05, 0x05, 0x0C, 0x0C, 0x0C, 0x59, 0x59, 0x8F, 0xAD, 0xAC, 0x92, 0x91, 0x91, 0x7D, 0xBE,
+  0x73, 0x73, 0xCF, 0x72, 0x72, 0xA1, 0xA1, 0xA0, 0xA1, 0x6E, 0x6E, 0x6E, 0x25, 0x6E, 0x23, 0xA2,
+  0x23, 0xA9, 0xA9, 0xA9, 0xA8, 0xD2, 0xD3, 0x33, 0x11, 0x11, 0xAB, 0xAA, 0xAB, 0x36, 0x0B, 0x97,
+  0x36, 0xD4, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0xF5, 0x29, 0x12, 0x09, 0x20, 0x20,
+  0x9B, 0x9B, 0x9A, 0x56, 0x3C, 0x5A, 0x56, 0x1F, 0x88, 0x1F, 0x88, 0xB8, 0xB8, 0xB8, 0x8B, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x3A, 0x67, 0x54, 0x53, 0x53, 0x54, 0x85, 0x17, 0x17, 0x17, 0x2B,
+  0x17, 0x2B, 0x2B, 0x2A, 0x60, 0x2A, 0x5F, 0x9D, 0x5F, 0x50, 0x50, 0x50, 0x4F, 0x4F, 0x4F, 0x62,
+  0x62, 0x62, 0x61, 0x0E, 0x61, 0x61, 0x05, 0x05, 0x05, 0x05, 0x05, 0x0C, 0x0C, 0x59, 0x59, 0x59,
+  0x8F, 0x92, 0x92, 0x91, 0xBE, 0x91, 0xDE, 0x73, 0x73, 0x73, 0x73, 0x72, 0xA1, 0xA1, 0xA0, 0x30,
+  0x30, 0x30, 0x6E, 0x6E, 0x25, 0x23, 0xA2, 0x23, 0xA9, 0xA9, 0xA9, 0xA9, 0xD3, 0x33, 0x33, 0x11,
+  0xAB, 0xAA, 0x0B, 0x0B, 0x0B, 0x36, 0x36, 0xD5, 0x6B, 0x6B, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xF9, 0xDB, 0xF5, 0x09, 0x9E, 0x9E, 0x20, 0x9B, 0x9B, 0x5B, 0x5B, 0x5A, 0x56, 0x55, 0x88, 0x88,
+  0x1F, 0x87, 0x1F, 0xB8, 0xB8, 0xB8, 0x18, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xEE, 0x66, 0x53,
+  0x53, 0x53, 0x85, 0x53, 0x17, 0x17, 0x17, 0x17, 0x2B, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x9D, 0x5F,
+  0x5F, 0x50, 0x50, 0x4F, 0x50, 0x62, 0x4F, 0x62, 0x61, 0x61, 0x61, 0x61, 0x0E, 0x0E, 0x05, 0x05,
+  0x05, 0x0C, 0x0C, 0x59, 0x59, 0x59, 0x59, 0x13, 0x91, 0x92, 0x91, 0x7D, 0xBD, 0xBE, 0xDE, 0x73,
+  0x72, 0x72, 0xA1, 0xA1, 0xA1, 0xA0, 0x30, 0x30, 0x30, 0x6E, 0x6E, 0x25, 0x25, 0x25, 0xA2, 0xA9,
+  0xA9, 0xA9, 0xD3, 0xD3, 0xD3, 0x11, 0x0A, 0x7E, 0xAB, 0xAB, 0xAA, 0x0B, 0x36, 0x36, 0xD5, 0xD5,
+  0xD4, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0x09, 0x09, 0x9E, 0x12, 0x20, 0x9B, 0x9B,
+  0x9A, 0x5B, 0x5B, 0x55, 0x55, 0x88, 0x1F, 0x88, 0x1F, 0xB8, 0x1F, 0xB8, 0xED, 0xED, 0xB8, 0xE4,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x6C, 0x53, 0x53, 0x85, 0x85, 0x17, 0x17, 0x2B, 0x17, 0x2B,
+  0x2B, 0x2A, 0x60, 0x9D, 0x9D, 0x9D, 0x5F, 0x50, 0x50, 0x50, 0x50, 0x4F, 0x24, 0x24, 0x62, 0x43,
+  0x43, 0x0E, 0x0E, 0x0E, 0x61, 0x05, 0x05, 0x05, 0x0C, 0x0C, 0x0C, 0x59, 0x59, 0x59, 0xB4, 0xB5,
+  0x92, 0x91, 0x7D, 0xBD, 0xBE, 0x73, 0x73, 0x73, 0xCF, 0xA1, 0x72, 0xA1, 0xA1, 0x30, 0x6E, 0x6E,
+  0x25, 0x6E, 0x25, 0x23, 0x25, 0x23, 0xA2, 0xA9, 0xA9, 0xA8, 0xD3, 0xD3, 0xD3, 0x11, 0x11, 0xAB,
+  0x0B, 0x36, 0x36, 0x36, 0x0B, 0xD5, 0xD5, 0xD4, 0x49, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9,
+  0xFF, 0x09, 0x9E, 0x20, 0x20, 0x12, 0x31, 0x5B, 0x3C, 0x56, 0x55, 0x55, 0x55, 0x88, 0x1F, 0x87,
+  0xB8, 0xB8, 0xB8, 0xB7, 0xED, 0xED, 0xBA, 0x56, 0xCC, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x94, 0x53,
+  0x53, 0x85, 0x17, 0x17, 0x85, 0x17, 0x17, 0x2A, 0x2A, 0x2A, 0x9D, 0x2A, 0x9D, 0x9C, 0x5F, 0x5F,
+  0x50, 0x4F, 0x4F, 0x4F, 0x24, 0x62, 0x62, 0x62, 0x0E, 0x0E, 0x61, 0x0E, 0x05, 0x05, 0x05, 0x05,
+  0x05, 0x0C, 0x59, 0x59, 0x59, 0xB4, 0x13, 0x13, 0x7D, 0x91, 0xDE, 0xBE, 0x73, 0x72, 0x73, 0x72,
+  0x72, 0xA1, 0xA1, 0xA1, 0x30, 0x30, 0x6E, 0x6E, 0x6E, 0x25, 0x25, 0x25, 0x23, 0xA9, 0xA9, 0xA9,
+  0xD3, 0xD3, 0xD3, 0x11, 0x0A, 0xAB, 0xAB, 0xAB, 0xAA, 0x97, 0x0B, 0x97, 0xD5, 0xD5, 0xD4, 0x1B,
+  0x4A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0x09, 0x9E, 0x20, 0x9B, 0x9B, 0x9B, 0x5B, 0x5B,
+  0x56, 0x55, 0x56, 0x08, 0x88, 0x88, 0x87, 0x1F, 0xB8, 0xB8, 0xED, 0x4D, 0xED, 0xED, 0xBA, 0xBA,
+  0x45, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xAD, 0x85, 0x17, 0x2B, 0x17, 0x2B, 0x2B, 0x2A, 0x2A,
+  0x2A, 0x9D, 0x9D, 0x9D, 0x5F, 0x5F, 0x5F, 0x50, 0x50, 0x24, 0x24, 0x62, 0x62, 0x62, 0x43, 0x61,
+  0x61, 0x05, 0x0E, 0x05, 0x05, 0x05, 0x0C, 0x0C, 0x0C, 0x0C, 0xB4, 0xB4, 0x59, 0xB5, 0x13, 0x13,
+  0x91, 0x91, 0xDE, 0x73, 0xDE, 0x72, 0x72, 0xCF, 0xA1, 0xA1, 0xA1, 0x30, 0x6F, 0x6E, 0x25, 0x25,
+  0x25, 0x23, 0x25, 0xA2, 0xA9, 0xA9, 0xA9, 0xA8, 0xD2, 0x33, 0x11, 0x11, 0x7E, 0xAB, 0xAA, 0x0B,
+  0x36, 0x36, 0x97, 0x97, 0xD5, 0x6B, 0x58, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x12,
+  0x12, 0x12, 0x20, 0x20, 0x9B, 0x9A, 0x5B, 0x5A, 0x56, 0x55, 0x88, 0x88, 0x88, 0x1F, 0x1F, 0x1F,
+  0xB8, 0x4D, 0xED, 0xED, 0xBA, 0xBA, 0xEC, 0x07, 0x88, 0x95, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xCB,
+  0xD6, 0x17, 0x17, 0x17, 0x2B, 0x2B, 0x2B, 0x2A, 0x2A, 0x9D, 0x9D, 0x5F, 0x50, 0x50, 0x24, 0x50,
+  0x24, 0x24, 0x4F, 0x43, 0x62, 0x43, 0x61, 0x61, 0x0E, 0x61, 0x05, 0x05, 0x05, 0x0C, 0x0C, 0x0C,
+  0x59, 0x59, 0x59, 0x59, 0xB5, 0x13, 0x13, 0x13, 0xBE, 0xDE, 0xDE, 0xDE, 0xCF, 0x73, 0x72, 0xD0,
+  0xA1, 0xA1, 0x30, 0x30, 0x30, 0x6E, 0x25, 0x25, 0x25, 0x25, 0x23, 0x23, 0xA9, 0xD2, 0xA9, 0xA9,
+  0x33, 0x0A, 0xAB, 0x7E, 0xAB, 0xAB, 0xAA, 0xAA, 0x0B, 0x36, 0xD5, 0xD5, 0xD4, 0x1B, 0x6B, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDB, 0x9E, 0x9E, 0x9B, 0x31, 0x9B, 0x5B, 0x56, 0x5B, 0x56,
+  0x56, 0x56, 0x88, 0x1F, 0x1F, 0x87, 0xB8, 0xB8, 0xED, 0xED, 0xED, 0xBA, 0xEC, 0xB9, 0xEC, 0x1C,
+  0x78, 0xD4, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xAC, 0x2B, 0x17, 0x2B, 0x2A, 0x2A, 0x2A, 0x60,
+  0x9D, 0x5F, 0x5F, 0x5F, 0x5F, 0x50, 0x24, 0x4F, 0x4F, 0x62, 0x62, 0x61, 0x61, 0x61, 0x61, 0x61,
+  0x05, 0x05, 0x05, 0x0C, 0x05, 0x05, 0x0C, 0x0C, 0x59, 0x59, 0xB4, 0xB4, 0x13, 0xDD, 0x13, 0xDD,
+  0xDE, 0x73, 0x72, 0x73, 0x73, 0xA1, 0xA1, 0xA1, 0xA0, 0x30, 0x6F, 0x30, 0x6E, 0x25, 0x25, 0x25,
+  0x25, 0xA2, 0x23, 0xA2, 0xA2, 0xA8, 0xD2, 0xD3, 0x33, 0x11, 0x7E, 0xAB, 0xAB, 0xAA, 0x36, 0x97,
+  0x36, 0x97, 0xD4, 0xD4, 0x58, 0x6B, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x29, 0x12,
+  0x9B, 0x31, 0x9B, 0x5B, 0x5B, 0x3C, 0x5B, 0x56, 0x88, 0x1F, 0x1F, 0x87, 0x87, 0x1F, 0x4D, 0xB7,
+  0xED, 0xBA, 0xBA, 0xBA, 0xBA, 0x07, 0x79, 0x79, 0x78, 0xC6, 0x1A, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0xBA, 0x2A, 0x2B, 0x2A, 0x2A, 0x9D, 0x2A, 0x9D, 0x9C, 0x5F, 0x50, 0x50, 0x24, 0x4F, 0x24,
+  0x24, 0x43, 0x43, 0x43, 0x0E, 0x61, 0x61, 0x61, 0x05, 0x05, 0x05, 0x0C, 0x0C, 0x0C, 0x59, 0x59,
+  0x59, 0xB4, 0xB5, 0x13, 0x13, 0x13, 0xDD, 0xDC, 0xDE, 0x73, 0xCF, 0x72, 0x72, 0x72, 0xA1, 0x30,
+  0x30, 0x30, 0x6E, 0x6E, 0x25, 0x25, 0x25, 0x25, 0x23, 0x23, 0xA9, 0xA9, 0xD3, 0xD3, 0x33, 0x11,
+  0x0A, 0x11, 0x7E, 0x0B, 0x0B, 0x36, 0x0B, 0xD5, 0x97, 0xD4, 0xD4, 0x6B, 0x1B, 0x57, 0x2D, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xDB, 0x12, 0x20, 0x9B, 0x9B, 0x31, 0x56, 0x3C, 0x56, 0x56, 0x88,
+  0x88, 0x1F, 0x1F, 0xB8, 0x87, 0xB7, 0xED, 0x4D, 0xED, 0xBA, 0x07, 0x07, 0x07, 0x1C, 0x79, 0x79,
+  0x79, 0xC6, 0x57, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x99, 0x2B, 0x2A, 0x2A, 0x2A, 0x60, 0x5F,
+  0x5F, 0x5F, 0x9C, 0x50, 0x50, 0x4F, 0x24, 0x62, 0x24, 0x62, 0x61, 0x61, 0x61, 0x0E, 0x05, 0x05,
+  0x05, 0x05, 0x05, 0x05, 0x0C, 0x0C, 0x0C, 0x59, 0xB5, 0xB4, 0x13, 0x13, 0x13, 0x13, 0xDC, 0x2C,
+  0x73, 0x73, 0x72, 0x72, 0xA1, 0xA1, 0xA0, 0x6F, 0x6E, 0x30, 0x6E, 0x6E, 0x25, 0x25, 0x25, 0xA2,
+  0xA9, 0xA2, 0xA2, 0xD2, 0xD2, 0x33, 0x33, 0x7E, 0x0A, 0xAB, 0xAB, 0xAA, 0x0B, 0xAA, 0x36, 0xD5,
+  0xD4, 0x1B, 0x58, 0x1B, 0x57, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x9E, 0x9B, 0x9B,
+  0x31, 0x9A, 0x5B, 0x3C, 0x56, 0x56, 0x88, 0x88, 0x1F, 0x1F, 0x1F, 0x4D, 0xB8, 0xB8, 0x4D, 0x4D,
+  0xBA, 0xEC, 0xBA, 0xBA, 0x2F, 0x79, 0x2F, 0xC6, 0xC6, 0xC6, 0xC6, 0x77, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x2A, 0x2A, 0x9D, 0x9D, 0x5F, 0x5F, 0x50, 0x5F, 0x24, 0x4F, 0x4F, 0x62, 0x24, 0x62,
+  0x62, 0x61, 0x61, 0x61, 0x61, 0x0E, 0x05, 0x05, 0x05, 0x05, 0x0C, 0x59, 0x0C, 0x59, 0x59, 0x59,
+  0xB5, 0xB5, 0x13, 0x13, 0xDD, 0xDC, 0xDC, 0x2C, 0x73, 0xCF, 0x72, 0xA1, 0xD0, 0x6F, 0x6F, 0x6F,
+  0x30, 0x6E, 0x6E, 0x25, 0x23, 0x23, 0x25, 0xA9, 0xA2, 0xA9, 0xA8, 0x33, 0x0A, 0x33, 0x7E, 0x11,
+  0x7E, 0xAA, 0xAA, 0xAA, 0x36, 0x97, 0xD5, 0x6B, 0xD4, 0x6B, 0x57, 0x57, 0x57, 0xB6, 0x0D, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xF9, 0xDA, 0x20, 0x9B, 0x31, 0x5B, 0x31, 0x5A, 0x56, 0x56, 0x88, 0x88, 0x87,
+  0x87, 0x1F, 0xB8, 0xB8, 0xB8, 0xED, 0xED, 0xBA, 0x07, 0x07, 0x07, 0x2F, 0x2F, 0x79, 0x79, 0x2F,
+  0x22, 0x22, 0x22, 0x9A, 0x95, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x16, 0x2A, 0x2A, 0x2A, 0x5F, 0x5F, 0x5F,
+  0x5F, 0x50, 0x50, 0x24, 0x4F, 0x24, 0x24, 0x43, 0x61, 0x61, 0x0E, 0x0E, 0x0E, 0x05, 0x05, 0x05,
+  0x05, 0x0C, 0x0C, 0x0C, 0x0C, 0x59, 0xB5, 0x13, 0xB5, 0x13, 0x13, 0xDD, 0xDC, 0xDC, 0x2C, 0x80,
+  0x72, 0x72, 0xA1, 0xA1, 0xA0, 0x30, 0x30, 0x6F, 0x6E, 0x25, 0x6E, 0x25, 0x25, 0xA2, 0x23, 0xA9,
+  0xA9, 0xA8, 0xD3, 0x33, 0x33, 0x33, 0x0A, 0xAB, 0x0B, 0x0B, 0x0B, 0x36, 0x97, 0x36, 0xD5, 0xD4,
+  0x1B, 0x1B, 0x57, 0x57, 0xB6, 0xF3, 0x89, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x4A, 0x3B, 0x9B, 0x9B, 0x9B, 0x3C,
+  0x3C, 0x56, 0x56, 0x56, 0x56, 0x88, 0x1F, 0x88, 0x87, 0xB8, 0xB8, 0xB8, 0x4D, 0xBA, 0xBA, 0x07,
+  0xEC, 0x07, 0x07, 0x07, 0x79, 0xC6, 0xC6, 0xC6, 0xC6, 0x22, 0x22, 0xD6, 0x5B, 0x5C, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x16, 0x08, 0x2A, 0x9D, 0x5F, 0x5F, 0x9C, 0x50, 0x9C, 0x24, 0x50, 0x4F, 0x24, 0x62, 0x43, 0x43,
+  0x61, 0x61, 0x61, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x0C, 0x0C, 0x59, 0xB4, 0xB4, 0x59, 0xB5,
+  0xB5, 0x13, 0xDC, 0x2C, 0xDC, 0x2C, 0x80, 0x80, 0xA1, 0xA1, 0xA0, 0xA1, 0x6F, 0x6E, 0x6E, 0x6E,
+  0x6E, 0x25, 0x25, 0x23, 0x23, 0xA2, 0xA9, 0xA8, 0xA8, 0xD3, 0xD3, 0x33, 0x0A, 0xAB, 0x7E, 0x0B,
+  0xAB, 0x0B, 0x36, 0x36, 0xD5, 0x6B, 0xD4, 0x6B, 0x1B, 0x1B, 0x57, 0xF3, 0xF3, 0xF3, 0x3B, 0x3A,
+  0xF1, 0xF1, 0xF0, 0xF1, 0xF0, 0xF1, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xDB, 0xDB, 0xDB, 0xDB, 0xDB,
+  0xDB, 0x20, 0x20, 0x9B, 0x9B, 0x9B, 0x9F, 0x9A, 0x5B, 0x5B, 0x88, 0x1F, 0x88, 0x1F, 0x87, 0x1F,
+  0xB8, 0xB8, 0xED, 0xED, 0xBA, 0xEC, 0xBA, 0xBA, 0x07, 0x07, 0x2F, 0x79, 0x78, 0xC6, 0xC6, 0x22,
+  0x22, 0x22, 0xD6, 0xD6, 0xD6, 0x26, 0x26, 0x87, 0x88, 0x1F, 0x87, 0xB8, 0xB8, 0x4D, 0x4D, 0xED,
+  0x4D, 0xBA, 0x07, 0xBA, 0xBA, 0x07, 0x07, 0x07, 0x2A, 0x9D, 0x9D, 0x5F, 0x5F, 0x50, 0x50, 0x50,
+  0x24, 0x24, 0x24, 0x24, 0x43, 0x62, 0x61, 0x61, 0x61, 0x0E, 0x0E, 0x05, 0x05, 0x05, 0x05, 0x0C,
+  0x0C, 0x59, 0xB4, 0x59, 0xB5, 0xB5, 0xB5, 0x13, 0x13, 0xDD, 0xDC, 0x2C, 0x2C, 0x2C, 0x80, 0x80,
+  0xA1, 0xA1, 0x6F, 0x30, 0x30, 0x6E, 0x6E, 0x25, 0x25, 0x25, 0x23, 0x23, 0x23, 0xA9, 0xA9, 0xA9,
+  0xD2, 0xD3, 0x0A, 0x7E, 0x11, 0xAB, 0xAB, 0xAA, 0x0B, 0x97, 0x97, 0xD5, 0x97, 0xD4, 0x1B, 0x57,
+  0x58, 0xF3, 0x57, 0xF3, 0xF2, 0x3A, 0x6C, 0x6D, 0x6C, 0x6D, 0x6D, 0x83, 0xC8, 0x10, 0xC7, 0xBC,
+  0x18, 0xFE, 0xFE, 0xF5, 0xF5, 0x09, 0xF5, 0x09, 0x12, 0x20, 0x20, 0x9B, 0x9B, 0x3C, 0x5B, 0x3C,
+  0x88, 0x56, 0x88, 0x88, 0x88, 0x1F, 0xB8, 0xB8, 0xB8, 0xB8, 0x4D, 0xBA, 0xED, 0xEC, 0x07, 0x07,
+  0x2F, 0x2F, 0x2F, 0xC6, 0xC6, 0xC6, 0x22, 0x22, 0x22, 0xD6, 0xD6, 0x26, 0x26, 0x26, 0x26, 0x67,
+  0xEA, 0x67, 0x66, 0x53, 0x54, 0x53, 0x53, 0x85, 0x17, 0x17, 0x17, 0x17, 0x2B, 0x2B, 0x2A, 0x2A,
+  0x9D, 0x5F, 0x5F, 0x5F, 0x9C, 0x5F, 0x50, 0x4F, 0x4F, 0x24, 0x24, 0x62, 0x61, 0x43, 0x61, 0x61,
+  0x0E, 0x05, 0x05, 0x05, 0x05, 0x05, 0x0C, 0x0C, 0x59, 0x59, 0x59, 0xB4, 0xB4, 0x13, 0x13, 0x13,
+  0xDD, 0xDC, 0xDC, 0x2C, 0x2C, 0x2C, 0x80, 0x80, 0xA0, 0xA1, 0x30, 0x6E, 0x6E, 0x30, 0x6E, 0x6E,
+  0x23, 0x25, 0xA2, 0xA9, 0xA9, 0xA9, 0xA9, 0xD2, 0xD3, 0x33, 0x11, 0x11, 0x7E, 0xAB, 0xAA, 0x36,
+  0x36, 0xD5, 0xD5, 0xD5, 0x6B, 0x6B, 0x57, 0x57, 0x57, 0x3A, 0x3A, 0xF2, 0xF3, 0x3A, 0x6D, 0x6D,
+  0x6D, 0xC8, 0xC8, 0xC7, 0x10, 0x18, 0x10, 0x18, 0xFE, 0xF5, 0xFE, 0xF5, 0x29, 0x09, 0x12, 0x9E,
+  0x9E, 0x9B, 0x12, 0x31, 0x5B, 0x3C, 0x56, 0x56, 0x56, 0x08, 0x88, 0x88, 0x1F, 0x87, 0xB8, 0x87,
+  0xED, 0xED, 0xBA, 0xBA, 0xEC, 0xB9, 0x07, 0x07, 0x79, 0x2F, 0xC6, 0xC6, 0xC5, 0x22, 0x22, 0x22,
+  0xD6, 0x26, 0x26, 0x26, 0x26, 0xEB, 0xEA, 0x67, 0x67, 0x66, 0x53, 0x53, 0x53, 0x53, 0x85, 0x17,
+  0x17, 0x2B, 0x2B, 0x2B, 0x2B, 0x2A, 0x2B, 0x2A, 0x60, 0x60, 0x5F, 0x50, 0x50, 0x24, 0x24, 0x24,
+  0x4F, 0x4F, 0x24, 0x43, 0x61, 0x61, 0x0E, 0x0E, 0x0E, 0x05, 0x05, 0x05, 0x05, 0x0C, 0x0C, 0x59,
+  0x59, 0x59, 0xB5, 0xB5, 0x13, 0xB5, 0xDC, 0x13, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x80, 0x80, 0x7F,
+  0xA1, 0x30, 0x6E, 0x6E, 0x6E, 0x6E, 0x25, 0x25, 0x23, 0x23, 0xA2, 0xA9, 0xA9, 0xA9, 0xA8, 0xA8,
+  0x33, 0x11, 0x11, 0x11, 0x0B, 0x0B, 0xAA, 0x36, 0xD5, 0x97, 0xD4, 0xD4, 0x1B, 0x57, 0x57, 0x57,
+  0x3A, 0x57, 0xF3, 0x3A, 0x3A, 0x6D, 0x3B, 0x6D, 0x6C, 0xC8, 0x6C, 0x10, 0xC7, 0xBC, 0xBC, 0x65,
+  0x65, 0xBB, 0xF5, 0xF5, 0x09, 0x9E, 0x12, 0x12, 0x20, 0x20, 0x9B, 0x5B, 0x5B, 0x56, 0x56, 0x55,
+  0x88, 0x88, 0x87, 0x1F, 0x1F, 0xB8, 0xB8, 0xB7, 0xED, 0xED, 0xBA, 0xBA, 0xB9, 0x07, 0x07, 0x07,
+  0x78, 0x79, 0x2F, 0xC6, 0x22, 0x22, 0x22, 0x26, 0xD6, 0xD6, 0xD6, 0x26, 0xEB, 0xEA, 0x67, 0x66,
+  0x54, 0x53, 0x53, 0x53, 0x85, 0x17, 0x17, 0x17, 0x17, 0x2B, 0x2B, 0x2B, 0x2A, 0x2A, 0x9D, 0x9D,
+  0x9D, 0x9D, 0x5F, 0x5F, 0x50, 0x4F, 0x4F, 0x4F, 0x4F, 0x62, 0x62, 0x61, 0x61, 0x61, 0x61, 0x05,
+  0x05, 0x05, 0x05, 0x05, 0x0C, 0x0C, 0x59, 0x59, 0x59, 0x59, 0xB5, 0x13, 0x13, 0xDC, 0x13, 0xDC,
+  0xDC, 0x2C, 0x2C, 0x2C, 0x7F, 0x80, 0x7F, 0x7F, 0x30, 0x6F, 0x6E, 0x6E, 0x6E, 0x25, 0x23, 0xA2,
+  0x25, 0x23, 0xA9, 0xA9, 0xD2, 0xD3, 0xD3, 0x33, 0x11, 0x0A, 0x0B, 0x0B, 0xAA, 0x97, 0x0B, 0x97,
+  0xD5, 0xD4, 0x6B, 0x6B, 0x57, 0x6A, 0xF3, 0x57, 0xF3, 0x3A, 0xF3, 0x3A, 0x6D, 0x3B, 0x83, 0x6C,
+  0x10, 0xC7, 0xC7, 0xC7, 0x18, 0x65, 0xBB, 0xFE, 0xF5, 0xF5, 0xF5, 0xF5, 0x9E, 0x9E, 0x9E, 0x20,
+  0x20, 0x9B, 0x31, 0x3C, 0x56, 0x56, 0x88, 0x88, 0x88, 0x87, 0x87, 0x1F, 0x87, 0xB8, 0xB7, 0xED,
+  0x4D, 0xBA, 0xEC, 0xEC, 0x07, 0x07, 0x79, 0x2F, 0xC6, 0xC6, 0xC6, 0x22, 0x22, 0x22, 0xD6, 0xD7,
+  0xD6, 0x26, 0xEB, 0xEB, 0x26, 0x66, 0x66, 0x66, 0x53, 0x66, 0x53, 0x86, 0x53, 0x17, 0x17, 0x17,
+  0x17, 0x2B, 0x2B, 0x2A, 0x2A, 0x2A, 0x9D, 0x9D, 0x5F, 0x9C, 0x50, 0x50, 0x50, 0x4F, 0x24, 0x62,
+  0x62, 0x61, 0x61, 0x61, 0x0E, 0x0E, 0x05, 0x05, 0x05, 0x05, 0x05, 0x0C, 0x0C, 0x59, 0x59, 0x59,
+  0xB4, 0xB5, 0x13, 0x13, 0x13, 0xDC, 0xDC, 0x2C, 0xDC, 0x2C, 0x2C, 0x80, 0x80, 0x80, 0x7F, 0xE6,
+  0x30, 0x6E, 0x6E, 0x6E, 0x25, 0x23, 0x25, 0x23, 0xA9, 0xA2, 0xA9, 0xA8, 0xD3, 0xD3, 0x33, 0x7E,
+  0x0A, 0xAB, 0x0B, 0xAA, 0x36, 0x36, 0x97, 0xD5, 0xD4, 0xD4, 0x1B, 0x57, 0x57, 0x57, 0xB6, 0x57,
+  0xF2, 0xF2, 0x3A, 0x6D, 0x6D, 0x6C, 0x6C, 0x83, 0x10, 0xC7, 0xC7, 0x10, 0x18, 0x18, 0xF5, 0xF5,
+  0xBB, 0x29, 0x09, 0x12, 0x12, 0x12, 0x9B, 0x9B, 0x9B, 0x5B, 0x3C, 0x5B, 0x56, 0x55, 0x88, 0x88,
+  0x88, 0x1F, 0xB8, 0xB8, 0xB8, 0x4D, 0xB7, 0xED, 0xBA, 0xBA, 0x07, 0xEC, 0x07, 0x2F, 0x79, 0x78,
+  0xC6, 0xC6, 0xC5, 0x22, 0xD6, 0xD6, 0xD6, 0xD7, 0xD6, 0x26, 0xEB, 0xEA, 0x67, 0xEA, 0x67, 0x54,
+  0x53, 0x53, 0x53, 0x53, 0x17, 0x17, 0x2B, 0x2B, 0x2A, 0x2A, 0x2A, 0x60, 0x2A, 0x2A, 0x9D, 0x5F,
+  0x5F, 0x50, 0x24, 0x24, 0x4F, 0x24, 0x24, 0x62, 0x62, 0x61, 0x61, 0x61, 0x0E, 0x0E, 0x05, 0x05,
+  0x05, 0x0C, 0x0C, 0x0C, 0x59, 0x59, 0x59, 0xB4, 0x59, 0x13, 0x13, 0x13, 0xDC, 0xDC, 0xDC, 0x2C,
+  0x2C, 0x2C, 0x7F, 0x7F, 0xE6, 0x4C, 0x4C, 0x4C, 0x6E, 0x6E, 0x6E, 0x25, 0x25, 0x25, 0xA2, 0xA9,
+  0xA9, 0xA9, 0xD2, 0xD3, 0x11, 0x33, 0x0A, 0x11, 0xAB, 0x0B, 0xAA, 0x0B, 0x36, 0xD5, 0xD5, 0xD5,
+  0xD5, 0x1B, 0x57, 0x57, 0x57, 0xF3, 0xF3, 0x3A, 0x3A, 0x3A, 0x6D, 0x6D, 0x6D, 0x83, 0x6D, 0x10,
+  0x10, 0xC7, 0xC7, 0x18, 0x65, 0xBB, 0xFE, 0xF5, 0xF5, 0x12, 0x12, 0x12, 0x20, 0x9B, 0x9B, 0x9A,
+  0x5B, 0x31, 0x3C, 0x56, 0x56, 0x08, 0x1F, 0x1F, 0x1F, 0x1F, 0xB8, 0xB8, 0xB8, 0xED, 0xBA, 0xBA,
+  0xBA, 0xB9, 0xB9, 0x79, 0x2F, 0x79, 0x78, 0xC6, 0xC5, 0x22, 0x22, 0x22, 0xD7, 0xD6, 0x26, 0x26,
+  0x26, 0xEB, 0xEA, 0xEA, 0x67, 0x54, 0x54, 0x53, 0x53, 0x53, 0x85, 0x17, 0x17, 0x17, 0x2B, 0x2B,
+  0x2A, 0x2A, 0x2A, 0x9D, 0x60, 0x5F, 0x5F, 0x9C, 0x5F, 0x50, 0x24, 0x4F, 0x24, 0x24, 0x62, 0x43,
+  0x61, 0x61, 0x61, 0x61, 0x0E, 0x05, 0x05, 0x05, 0x05, 0x05, 0x0C, 0x59, 0x59, 0x59, 0x59, 0x59,
+  0xB5, 0x13, 0xDC, 0x13, 0xDC, 0xDC, 0x2C, 0x2C, 0x2C, 0x2C, 0x7F, 0x7F, 0x7F, 0x7F, 0x4C, 0x4C,
+  0x6E, 0x6E, 0x25, 0x25, 0xA2, 0xA2, 0x23, 0xA9, 0xA9, 0xD3, 0xD3, 0xD2, 0x33, 0x0A, 0xAB, 0xAB,
+  0xAB, 0x0B, 0x0B, 0x0B, 0x36, 0xD5, 0xD5, 0xD4, 0x1B, 0x57, 0x57, 0x3A, 0xF3, 0xF3, 0xF3, 0x3A,
+  0x3A, 0x6D, 0x6D, 0xC8, 0x6D, 0x83, 0x10, 0xC7, 0x18, 0x18, 0x18, 0xFE, 0xBB, 0xFE, 0xFE, 0x09,
+  0x09, 0x9E, 0x20, 0x12, 0x20, 0x20, 0x9B, 0x5B, 0x5B, 0x56, 0x56, 0x56, 0x08, 0x88, 0x88, 0x1F,
+  0x1F, 0xB8, 0xED, 0x4D, 0x4D, 0xED, 0xBA, 0x07, 0x07, 0x07, 0x1C, 0x1C, 0x1C, 0xC6, 0xC6, 0xC6,
+  0xC5, 0xC5, 0x22, 0xD6, 0xD7, 0x26, 0xD6, 0x26, 0xEB, 0xEA, 0xEA, 0x67, 0x66, 0x54, 0x54, 0x53,
+  0x53, 0x85, 0x85, 0x17, 0x2B, 0x2B, 0x2B, 0x2B, 0x2A, 0x60, 0x2A, 0x2A, 0x5F, 0x5F, 0x5F, 0x50,
+  0x50, 0x24, 0x24, 0x4F, 0x62, 0x62, 0x43, 0x43, 0x0E, 0x61, 0x61, 0x05, 0x05, 0x05, 0x05, 0x05,
+  0x05, 0x0C, 0x0C, 0xB4, 0xB4, 0xB4, 0xB5, 0x13, 0x13, 0x13, 0xDC, 0x2C, 0x2C, 0x2C, 0x2C, 0x80,
+  0x80, 0x80, 0x80, 0xE6, 0x4C, 0x4C, 0x4C, 0x4C, 0x25, 0x25, 0x25, 0x23, 0x23, 0xA2, 0xA2, 0xA9,
+  0xA9, 0xD3, 0xD3, 0x0A, 0x7E, 0xAB, 0xAB, 0xAB, 0xAA, 0x0B, 0x36, 0x97, 0x97, 0xD5, 0x1B, 0x6B,
+  0x1B, 0x57, 0x57, 0x3B, 0xF3, 0xF3, 0x3A, 0x3A, 0x6C, 0x6D, 0x6D, 0xC8, 0xC8, 0x6C, 0xC7, 0xC7,
+  0x18, 0xFE, 0xFE, 0xBB, 0xF5, 0xBB, 0xF5, 0xF5, 0x09, 0x12, 0x20, 0x9B, 0x9B, 0x31, 0x5B, 0x3C,
+  0x5A, 0x56, 0x56, 0x88, 0x1F, 0x88, 0x87, 0x1F, 0x4D, 0xB8, 0xB8, 0x4D, 0xED, 0xED, 0xBA, 0xB9,
+  0xB9, 0x1C, 0x79, 0x79, 0xC6, 0x2F, 0xC6, 0xC5, 0x22, 0x22, 0xD6, 0xD6, 0x22, 0xD6, 0x26, 0xEB,
+  0xEB, 0x67, 0x67, 0x67, 0x53, 0x54, 0x53, 0x53, 0x85, 0x17, 0x17, 0x17, 0x2B, 0x2B, 0x2B, 0x2A,
+  0x2A, 0x2A, 0x9D, 0x5F, 0x5F, 0x5F, 0x50, 0x50, 0x4F, 0x4F, 0x4F, 0x24, 0x24, 0x62, 0x61, 0x0E,
+  0x61, 0x0E, 0x0E, 0x05, 0x05, 0x0C, 0x05, 0x05, 0x0C, 0x59, 0xB4, 0xB4, 0x59, 0x13, 0x13, 0x13,
+  0x13, 0xDC, 0x2C, 0x2C, 0x2C, 0x2C, 0x80, 0x80, 0x80, 0x7F, 0xE6, 0x4C, 0xE6, 0x4C, 0x0F, 0x4C,
+  0x25, 0x25, 0xA2, 0x23, 0xA2, 0xA9, 0xA9, 0xA9, 0xD2, 0xD3, 0x0A, 0x33, 0x7E, 0xAB, 0x0B, 0xAA,
+  0xAA, 0x0B, 0x36, 0xD5, 0xD5, 0x1B, 0x1B, 0x1B, 0x57, 0x3B, 0xF3, 0xF3, 0xF3, 0x3A, 0x3A, 0x6C,
+  0x6D, 0xC8, 0x6C, 0x10, 0x83, 0x10, 0xC7, 0xBC, 0x18, 0xFE, 0xF5, 0xF5, 0xF5, 0xF5, 0xF5, 0x12,
+  0x20, 0x12, 0x12, 0x9B, 0x9B, 0x9B, 0x31, 0x3C, 0x55, 0x56, 0x55, 0x88, 0x1F, 0x1F, 0x1F, 0xB8,
+  0xB7, 0xB7, 0x4D, 0xBA, 0xBA, 0xBA, 0x07, 0x07, 0x07, 0x79, 0xC6, 0xC6, 0xC6, 0xC6, 0xC5, 0x22,
+  0x22, 0xD6, 0xD7, 0x26, 0x26, 0x26, 0xEB, 0x67, 0x67, 0x67, 0x54, 0x54, 0x53, 0x86, 0x53, 0x85,
+  0x17, 0x17, 0x17, 0x17, 0x2B, 0x2A, 0x2A, 0x2A, 0x2A, 0x60, 0x60, 0x5F, 0x9C, 0x9C, 0x50, 0x50,
+  0x4F, 0x4F, 0x62, 0x62, 0x62, 0x43, 0x61, 0x61, 0x05, 0x0E, 0x05, 0x05, 0x05, 0x0C, 0x0C, 0x0C,
+  0x59, 0x59, 0x59, 0x59, 0xB5, 0x13, 0x13, 0xDC, 0xDC, 0xDC, 0xDC, 0x2C, 0x2C, 0x80, 0x80, 0x80,
+  0x7F, 0x7F, 0x7F, 0x4C, 0x4C, 0x4C, 0x74, 0x4C, 0x23, 0x25, 0x23, 0xA9, 0xA9, 0xA9, 0xA8, 0xD3,
+  0x33, 0xD3, 0x7E, 0x11, 0x7E, 0xAB, 0x0B, 0x0B, 0x36, 0x97, 0x6B, 0xD5, 0xD4, 0x6B, 0x6B, 0x57,
+  0x3B, 0xF3, 0xB6, 0xF2, 0xF2, 0x3A, 0x6D, 0x6D, 0x6D, 0x6C, 0x6C, 0x6C, 0x10, 0xC7, 0x65, 0x18,
+  0xBB, 0xBB, 0xBB, 0xF5, 0xF5, 0x09, 0x12, 0x12, 0x20, 0x20, 0x9B, 0x9B, 0x9A, 0x3C, 0x5A, 0x56,
+  0x55, 0x88, 0x88, 0x87, 0x87, 0x87, 0xB8, 0xB8, 0x4D, 0xED, 0xED, 0xBA, 0xB9, 0x07, 0x07, 0x79,
+  0x07, 0x2F, 0x78, 0x2F, 0xC6, 0x22, 0x22, 0x22, 0xD7, 0xD6, 0xD7, 0x26, 0x26, 0xEA, 0xEB, 0x67,
+  0x66, 0x66, 0x66, 0x54, 0x53, 0x53, 0x85, 0x17, 0x17, 0x17, 0x2B, 0x2B, 0x2B, 0x2A, 0x2A, 0x2A,
+  0x9D, 0x9D, 0x9D, 0x50, 0x9C, 0x50, 0x50, 0x24, 0x24, 0x62, 0x62, 0x24, 0x43, 0x61, 0x0E, 0x61,
+  0x0E, 0x05, 0x05, 0x0C, 0x0C, 0x05, 0x0C, 0x59, 0xB4, 0xB4, 0xB4, 0xB5, 0xB5, 0x13, 0x13, 0x13,
+  0x13, 0xDC, 0x2C, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x74,
+  0xA2, 0xA9, 0xA9, 0xA9, 0xA8, 0xD3, 0xD3, 0x0A, 0x11, 0x7E, 0x11, 0xAB, 0xAB, 0x0B, 0x0B, 0x36,
+  0x97, 0xD5, 0x6B, 0x1B, 0x58, 0x6B, 0x58, 0x57, 0xF3, 0x3A, 0xF3, 0x3A, 0x6C, 0x6C, 0x6D, 0x6C,
+  0x6C, 0xC8, 0x10, 0xC7, 0x6C, 0xC7, 0x18, 0x18, 0xBB, 0xF5, 0xF5, 0xF5, 0x09, 0x12, 0x12, 0x20,
+  0x9B, 0x9B, 0x9A, 0x5B, 0x5B, 0x3C, 0x56, 0x56, 0x88, 0x88, 0x87, 0x87, 0x1F, 0xB8, 0xB8, 0xED,
+  0xED, 0xBA, 0xBA, 0xBA, 0xBA, 0x07, 0x1C, 0x2F, 0x79, 0x78, 0xC6, 0xC6, 0xC5, 0x22, 0x22, 0xD6,
+  0xD6, 0x26, 0x26, 0x26, 0xEB, 0x26, 0xEA, 0x67, 0x66, 0x66, 0x54, 0x53, 0x53, 0x85, 0x17, 0x17,
+  0x17, 0x17, 0x2B, 0x2B, 0x2B, 0x2A, 0x2A, 0x60, 0x9D, 0x9D, 0x5F, 0x50, 0x50, 0x4F, 0x4F, 0x24,
+  0x62, 0x62, 0x62, 0x61, 0x0E, 0x0E, 0x0E, 0x0E, 0x05, 0x05, 0x05, 0x05, 0x0C, 0x0C, 0x0C, 0x59,
+  0x0C, 0x59, 0x13, 0x13, 0x13, 0xDD, 0xDC, 0xDC, 0x2C, 0x2C, 0x2C, 0x80, 0x7F, 0x80, 0x7F, 0x7F,
+  0xE6, 0x4C, 0x4C, 0x0F, 0x74, 0x74, 0x1D, 0x1D, 0x96, 0x23, 0x23, 0xA9, 0xD2, 0xD2, 0x33, 0x33,
+  0x11, 0x11, 0xAB, 0xAB, 0xAA, 0xAA, 0x97, 0x36, 0x97, 0xD5, 0xD4, 0x6B, 0x1B, 0x58, 0xB6, 0x57,
+  0xF3, 0x3A, 0x3A, 0x3A, 0x83, 0x6D, 0x6D, 0x6C, 0xC8, 0x10, 0x10, 0x65, 0x18, 0x18, 0x65, 0xBB,
+  0xBB, 0xF5, 0xF5, 0x09, 0x09, 0x12, 0x12, 0x12, 0x9B, 0x9B, 0x3C, 0x31, 0x5B, 0x5A, 0x55, 0x88,
+  0x56, 0x88, 0x1F, 0x1F, 0xB8, 0xB8, 0xB8, 0xED, 0xBA, 0xBA, 0x07, 0xB9, 0x07, 0x07, 0x1C, 0x2F,
+  0x79, 0xC6, 0x22, 0xC6, 0x22, 0xD6, 0xD6, 0x26, 0xD6, 0x26, 0x26, 0xEB, 0xEA, 0xEA, 0xEA, 0x67,
+  0x66, 0x66, 0x53, 0x53, 0x53, 0x17, 0x17, 0x17, 0x2B, 0x2B, 0x2A, 0x2B, 0x2A, 0x9D, 0x2A, 0x9D,
+  0x9D, 0x5F, 0x5F, 0x50, 0x50, 0x4F, 0x4F, 0x24, 0x62, 0x43, 0x43, 0x61, 0x43, 0x61, 0x05, 0x05,
+  0x05, 0x05, 0x05, 0x0C, 0x0C, 0x0C, 0x59, 0x59, 0xB5, 0xB5, 0x13, 0x13, 0x13, 0x13, 0x2C, 0x2C,
+  0x2C, 0x2C, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x4C, 0x4C, 0x4C, 0x0F, 0x74, 0x74, 0x1D, 0x06,
+  0x08, 0xA9, 0xA9, 0xA9, 0xD3, 0x33, 0x11, 0x11, 0xAB, 0xAB, 0xAB, 0x0B, 0x0B, 0x36, 0x36, 0x36,
+  0xD5, 0xD5, 0x6B, 0x1B, 0x57, 0x57, 0x3B, 0xF3, 0x3B, 0xF2, 0x3A, 0x3B, 0x3B, 0x6D, 0x6D, 0x6C,
+  0x6C, 0x6C, 0x10, 0x10, 0x18, 0x18, 0xBB, 0xF5, 0xF5, 0xF5, 0x09, 0x12, 0x12, 0x20, 0x9B, 0x20,
+  0x9B, 0x5B, 0x3C, 0x5B, 0x5A, 0x55, 0x88, 0x88, 0x88, 0x87, 0x1F, 0xB8, 0xB8, 0xED, 0xB8, 0xED,
+  0xED, 0xBA, 0xB9, 0x79, 0x1C, 0x78, 0x79, 0x78, 0x78, 0xC5, 0x22, 0x22, 0x22, 0xD7, 0x26, 0xD7,
+  0x26, 0x26, 0xEB, 0xEA, 0x67, 0x66, 0x67, 0x54, 0x54, 0x53, 0x85, 0x85, 0x85, 0x17, 0x17, 0x2B,
+  0x2B, 0x2B, 0x2A, 0x2A, 0x2A, 0x9D, 0x60, 0x5F, 0x9C, 0x50, 0x24, 0x50, 0x4F, 0x4F, 0x24, 0x62,
+  0x43, 0x61, 0x61, 0x0E, 0x0E, 0x05, 0x05, 0x05, 0x05, 0x0C, 0x0C, 0x0C, 0x0C, 0x59, 0xB4, 0x59,
+  0xB5, 0x13, 0x13, 0x13, 0xDD, 0xDC, 0xDC, 0x2C, 0x2C, 0x80, 0x2C, 0x80, 0x7F, 0x7F, 0x4C, 0x4C,
+  0x4C, 0x4C, 0x74, 0x74, 0x0F, 0x1D, 0x1D, 0x71, 0x44, 0xD3, 0xD3, 0xA8, 0x33, 0xD3, 0x0A, 0x11,
+  0xAB, 0x0B, 0xAA, 0x36, 0x36, 0x97, 0x97, 0xD4, 0x6B, 0x1B, 0x6B, 0x1B, 0x6A, 0x57, 0xF3, 0xF2,
+  0x3A, 0x3A, 0x6D, 0x6D, 0x6C, 0x6C, 0x83, 0x83, 0x6C, 0xC7, 0x18, 0x18, 0x65, 0x65, 0xFE, 0xF5,
+  0xF5, 0xF5, 0x12, 0x12, 0x20, 0x20, 0x31, 0x9B, 0x5B, 0x5B, 0x5B, 0x56, 0x56, 0x08, 0x88, 0x88,
+  0x1F, 0xB8, 0xB8, 0xB8, 0xED, 0xED, 0x4D, 0xBA, 0xBA, 0x07, 0x79, 0x2F, 0x2F, 0x2F, 0x79, 0xC6,
+  0x22, 0x22, 0xC5, 0xC5, 0xD6, 0xD6, 0x26, 0xD6, 0x26, 0x26, 0xEA, 0x67, 0x66, 0x67, 0x54, 0x53,
+  0x53, 0x53, 0x86, 0x17, 0x17, 0x17, 0x17, 0x2B, 0x2B, 0x2B, 0x2A, 0x9D, 0x9D, 0x5F, 0x5F, 0x5F,
+  0x50, 0x50, 0x50, 0x24, 0x24, 0x24, 0x43, 0x62, 0x61, 0x61, 0x61, 0x0E, 0x0E, 0x05, 0x05, 0x05,
+  0x05, 0x05, 0x0C, 0x59, 0x59, 0xB4, 0x59, 0xB5, 0x13, 0x13, 0xDD, 0xDC, 0xDC, 0x2C, 0x2C, 0x2C,
+  0x80, 0x80, 0x7F, 0x7F, 0x7F, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x0F, 0x0F, 0x1D, 0x63, 0x1D, 0x70,
+  0x70, 0xA9, 0xA8, 0x33, 0x33, 0x7E, 0xAB, 0xAB, 0xAB, 0x0B, 0x0B, 0x36, 0xD5, 0x6B, 0xD5, 0x6B,
+  0x1B, 0x57, 0x57, 0x3A, 0x3B, 0xB6, 0xF3, 0x3A, 0x3B, 0x6D, 0x6D, 0x6D, 0x6C, 0x6C, 0x10, 0xC7,
+  0xC7, 0x18, 0x65, 0xFE, 0xBB, 0xFE, 0xF5, 0xBB, 0xF5, 0x12, 0x29, 0x20, 0x20, 0x9B, 0x9B, 0x5B,
+  0x5B, 0x56, 0x56, 0x55, 0x88, 0x88, 0x1F, 0x87, 0x87, 0xB8, 0xB8, 0xB8, 0xED, 0xED, 0xBA, 0x07,
+  0xBA, 0x07, 0x52, 0x2F, 0x79, 0x79, 0xC5, 0x22, 0xC5, 0xC5, 0x22, 0xD6, 0xD6, 0xD6, 0x26, 0x26,
+  0xEB, 0x26, 0xEA, 0x67, 0x54, 0x66, 0x54, 0x85, 0x53, 0x86, 0x17, 0x2B, 0x17, 0x17, 0x2B, 0x2B,
+  0x2A, 0x2A, 0x2A, 0x60, 0x5F, 0x9D, 0x50, 0x50, 0x50, 0x4F, 0x4F, 0x4F, 0x62, 0x4F, 0x43, 0x43,
+  0x61, 0x61, 0x0E, 0x05, 0x05, 0x05, 0x05, 0x0C, 0x0C, 0x05, 0x0C, 0x59, 0x59, 0xB5, 0xB5, 0x13,
+  0x13, 0x13, 0xDD, 0xDC, 0xDC, 0x2C, 0x2C, 0x80, 0x80, 0x80, 0x80, 0x7F, 0x4C, 0x4C, 0x4C, 0x0F,
+  0x74, 0x0F, 0x74, 0x1D, 0x1D, 0x63, 0x63, 0x48, 0xF6, 0x6A, 0x33, 0xD3, 0x33, 0x11, 0xAB, 0x0B,
+  0xAA, 0x0B, 0x36, 0x97, 0xD5, 0xD5, 0x6B, 0x1B, 0x58, 0x57, 0x57, 0x57, 0xF3, 0x3A, 0x3B, 0x3B,
+  0x6D, 0x6D, 0xC8, 0x6C, 0x83, 0x6C, 0xC7, 0xC7, 0xC7, 0x18, 0xBB, 0xBB, 0xF5, 0xF5, 0xF5, 0x12,
+  0x09, 0x9E, 0x9E, 0x20, 0x31, 0x31, 0x9A, 0x5B, 0x56, 0x5B, 0x88, 0x56, 0x1F, 0x87, 0x88, 0xB8,
+  0x87, 0xB8, 0x4D, 0xED, 0xED, 0xBA, 0xBA, 0xB9, 0x07, 0x79, 0x79, 0x2F, 0x78, 0xC6, 0xC6, 0x22,
+  0x22, 0x22, 0x22, 0xD6, 0x26, 0x26, 0xEB, 0xEB, 0xEA, 0x67, 0x66, 0x67, 0x54, 0x54, 0x53, 0x85,
+  0x85, 0x17, 0x85, 0x17, 0x2B, 0x2B, 0x2B, 0x2A, 0x60, 0x60, 0x9D, 0x9D, 0x5F, 0x9C, 0x50, 0x50,
+  0x9C, 0x4F, 0x24, 0x24, 0x62, 0x43, 0x61, 0x61, 0x0E, 0x61, 0x0E, 0x05, 0x05, 0x05, 0x05, 0x0C,
+  0x0C, 0x59, 0x59, 0x59, 0xB5, 0xB5, 0x13, 0x13, 0xDC, 0xDC, 0xDC, 0xDC, 0x2C, 0x2C, 0x80, 0x80,
+  0x80, 0x80, 0x7F, 0x4C, 0x4C, 0x4C, 0x4C, 0x74, 0x0F, 0x1D, 0x74, 0x1D, 0x63, 0x06, 0x06, 0xF6,
+  0x01, 0x64, 0x0A, 0x11, 0x0A, 0xAB, 0x0B, 0x0B, 0x0B, 0x97, 0x97, 0x97, 0x6B, 0xD4, 0x6B, 0x1B,
+  0x57, 0x3A, 0xF3, 0xB6, 0xF3, 0xF3, 0x3A, 0x6C, 0xC8, 0xC8, 0xC8, 0x10, 0x10, 0xC7, 0x10, 0x18,
+  0x18, 0x18, 0x65, 0xFE, 0xF5, 0xF5, 0xF5, 0x12, 0x12, 0x20, 0x9B, 0x20, 0x9B, 0x5B, 0x56, 0x3C,
+  0x56, 0x88, 0x88, 0x88, 0x87, 0x87, 0x1F, 0xB8, 0xED, 0xB7, 0xED, 0xED, 0xBA, 0xEC, 0xBA, 0x07,
+  0x79, 0x79, 0x79, 0xC6, 0xC6, 0x22, 0xC5, 0x22, 0xD6, 0x22, 0x26, 0xD6, 0x26, 0x26, 0xEB, 0xEB,
+  0xEA, 0x67, 0x66, 0x66, 0x53, 0x53, 0x53, 0x17, 0x17, 0x85, 0x2B, 0x17, 0x2B, 0x2A, 0x2A, 0x2A,
+  0x60, 0x9D, 0x60, 0x5F, 0x9C, 0x5F, 0x50, 0x50, 0x50, 0x24, 0x62, 0x62, 0x43, 0x43, 0x61, 0x0E,
+  0x61, 0x0E, 0x05, 0x05, 0x05, 0x0C, 0x0C, 0x0C, 0x0C, 0x59, 0xB4, 0xB4, 0xB5, 0xB5, 0xB5, 0x13,
+  0x13, 0x2C, 0x2C, 0x80, 0x2C, 0x80, 0x80, 0x80, 0x7F, 0x4C, 0xE6, 0x4C, 0x4C, 0x4C, 0x0F, 0x0F,
+  0x74, 0x74, 0x1D, 0x63, 0x63, 0x06, 0x70, 0x01, 0x01, 0x47, 0x7E, 0x11, 0xAB, 0x0B, 0x36, 0x36,
+  0xAA, 0xD5, 0x97, 0x97, 0x1B, 0x1B, 0x6B, 0x57, 0x57, 0x3B, 0xF3, 0xF2, 0x3B, 0x3A, 0x3B, 0x83,
+  0xC8, 0xC8, 0x83, 0xC7, 0xC7, 0xC7, 0x18, 0x18, 0xFE, 0xFE, 0xFE, 0xF5, 0xF5, 0x09, 0x9E, 0x12,
+  0x9E, 0x20, 0x9B, 0x9B, 0x9A, 0x5B, 0x56, 0x56, 0x88, 0x88, 0x87, 0x1F, 0x1F, 0x1F, 0xB8, 0xB8,
+  0xED, 0xED, 0x4D, 0xBA, 0x07, 0xBA, 0x07, 0x1C, 0x1C, 0x2F, 0x79, 0xC6, 0xC6, 0x22, 0x22, 0x22,
+  0x22, 0xD6, 0xD6, 0x26, 0x26, 0x67, 0xEA, 0x67, 0x67, 0x54, 0x54, 0x53, 0x53, 0x85, 0x85, 0x17,
+  0x17, 0x17, 0x17, 0x2B, 0x2A, 0x2A, 0x2A, 0x2A, 0x5F, 0x9D, 0x9D, 0x5F, 0x50, 0x24, 0x4F, 0x50,
+  0x4F, 0x24, 0x24, 0x62, 0x61, 0x61, 0x0E, 0x0E, 0x05, 0x05, 0x05, 0x05, 0x05, 0x0C, 0x0C, 0x0C,
+  0x59, 0x59, 0x59, 0xB5, 0x13, 0x13, 0x13, 0xDC, 0xDD, 0x2C, 0x2C, 0x2C, 0x80, 0x80, 0x80, 0x7F,
+  0x7F, 0x4C, 0x4C, 0x4C, 0x4C, 0x74, 0x74, 0x74, 0x1D, 0x1D, 0x63, 0x63, 0x06, 0x63, 0xF6, 0x01,
+  0x01, 0x01, 0x64, 0xAB, 0xAB, 0xAA, 0x36, 0x0B, 0x97, 0xD5, 0xD5, 0xD5, 0x6B, 0x58, 0x1B, 0x57,
+  0xB6, 0xF3, 0xF3, 0x3A, 0x3A, 0x3A, 0x6D, 0x6D, 0x83, 0x6C, 0x10, 0xC7, 0x18, 0x10, 0x18, 0xFE,
+  0xFE, 0xF5, 0xF5, 0xF5, 0x09, 0x12, 0x9E, 0x20, 0x20, 0x9B, 0x9B, 0x9B, 0x3C, 0x3C, 0x56, 0x55,
+  0x88, 0x1F, 0x88, 0x1F, 0x1F, 0x1F, 0xB8, 0xB8, 0xBA, 0xED, 0xBA, 0x07, 0x07, 0x07, 0x2F, 0x2F,
+  0x2F, 0xC6, 0xC6, 0xC5, 0x22, 0x22, 0x22, 0xD6, 0xD6, 0x22, 0x26, 0x26, 0x26, 0x26, 0xEA, 0x66,
+  0x66, 0x66, 0x54, 0x53, 0x53, 0x17, 0x17, 0x17, 0x17, 0x2B, 0x2B, 0x2A, 0x2A, 0x2A, 0x2A, 0x60,
+  0x5F, 0x5F, 0x5F, 0x50, 0x24, 0x50, 0x4F, 0x24, 0x62, 0x24, 0x62, 0x43, 0x0E, 0x0E, 0x61, 0x61,
+  0x05, 0x05, 0x05, 0x0C, 0x0C, 0x0C, 0x59, 0x59, 0x59, 0xB4, 0xB4, 0x13, 0x13, 0x13, 0x13, 0xDC,
+  0xDC, 0x2C, 0x2C, 0x80, 0x80, 0x80, 0x7F, 0x7F, 0x4C, 0x4C, 0x4C, 0x4C, 0x74, 0x74, 0x74, 0x1D,
+  0x1D, 0x63, 0x63, 0x06, 0x06, 0x70, 0x01, 0x01, 0x01, 0x01, 0xF6, 0x9F, 0x0B, 0x36, 0x36, 0x97,
+  0x97, 0xD5, 0x1B, 0x1B, 0x6B, 0xF3, 0x57, 0x3A, 0xF3, 0xF2, 0x3A, 0x3A, 0x6D, 0x6D, 0x6D, 0xC8,
+  0xC8, 0xC7, 0xC7, 0x10, 0xBC, 0xBC, 0x65, 0xBB, 0xFE, 0xFE, 0xF5, 0x09, 0x12, 0x12, 0x12, 0x9B,
+  0x20, 0x9A, 0x5B, 0x3C, 0x5B, 0x56, 0x55, 0x55, 0x88, 0x88, 0x1F, 0x87, 0xB8, 0xB8, 0x4D, 0xBA,
+  0xED, 0xBA, 0xBA, 0x07, 0xB9, 0x1C, 0x07, 0x2F, 0x2F, 0x78, 0xC5, 0x22, 0x22, 0x22, 0xD6, 0xD6,
+  0xD6, 0xEB, 0x26, 0xEB, 0xEA, 0x67, 0xEA, 0x54, 0x66, 0x54, 0x53, 0x53, 0x85, 0x85, 0x17, 0x17,
+  0x17, 0x17, 0x2A, 0x2B, 0x2A, 0x2A, 0x9D, 0x60, 0x5F, 0x5F, 0x50, 0x50, 0x50, 0x24, 0x24, 0x62,
+  0x62, 0x62, 0x43, 0x61, 0x61, 0x0E, 0x05, 0x05, 0x05, 0x0C, 0x05, 0x0C, 0x0C, 0x59, 0x59, 0x59,
+  0xB5, 0xB5, 0xB4, 0x13, 0x13, 0xDC, 0xDD, 0x2C, 0x2C, 0x2C, 0x80, 0x80, 0x80, 0x80, 0x4C, 0x7F,
+  0x4C, 0x4C, 0x4C, 0x74, 0x0F, 0x0F, 0x1D, 0x1D, 0x63, 0x63, 0x06, 0x06, 0x71, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x47, 0x9F, 0x36, 0x97, 0xD5, 0xD5, 0x6B, 0x1B, 0x1B, 0x57, 0x57, 0x3A, 0xF3,
+  0x3A, 0x3A, 0x3A, 0x6D, 0x6C, 0x6D, 0x6D, 0x6C, 0xC7, 0xC7, 0x65, 0x18, 0x65, 0xFE, 0xBB, 0xBB,
+  0xF5, 0xF5, 0x09, 0x12, 0x9E, 0x20, 0x9B, 0x9B, 0x9B, 0x9A, 0x5B, 0x3C, 0x5A, 0x56, 0x88, 0x88,
+  0x88, 0xB8, 0x87, 0xB8, 0xB8, 0xED, 0x4D, 0xED, 0xED, 0xBA, 0x07, 0x07, 0x07, 0x07, 0x79, 0xC6,
+  0xC6, 0xC6, 0xC6, 0x22, 0x22, 0xD6, 0xD7, 0xD6, 0x26, 0x26, 0xEB, 0xEA, 0xEA, 0x67, 0x66, 0x54,
+  0x53, 0x53, 0x53, 0x85, 0x17, 0x17, 0x17, 0x17, 0x2B, 0x2A, 0x2A, 0x2A, 0x60, 0x60, 0x5F, 0x5F,
+  0x5F, 0x5F, 0x50, 0x50, 0x24, 0x24, 0x4F, 0x62, 0x62, 0x43, 0x61, 0x61, 0x61, 0x0E, 0x05, 0x05,
+  0x05, 0x0C, 0x0C, 0x05, 0x59, 0x59, 0x59, 0xB4, 0xB5, 0x13, 0x13, 0xDD, 0xDC, 0xDC, 0x2C, 0x2C,
+  0x2C, 0x80, 0x80, 0x7F, 0x7F, 0x4C, 0xE6, 0x4C, 0x4C, 0x0F, 0x74, 0x74, 0x0F, 0x1D, 0x1D, 0x1D,
+  0x63, 0x06, 0x06, 0x71, 0xF6, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x48, 0x08, 0xD5, 0xD5,
+  0x6B, 0x58, 0x6B, 0x57, 0x57, 0x3B, 0xF3, 0x3A, 0x3A, 0x3B, 0x6C, 0x6D, 0x6D, 0x6C, 0x6C, 0x10,
+  0xC7, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFE, 0xF5, 0xF5, 0xF5, 0x12, 0x9E, 0x20, 0x20, 0x9B, 0x9A,
+  0x5B, 0x3C, 0x56, 0x56, 0x56, 0x88, 0x88, 0x1F, 0x87, 0xB8, 0x87, 0xB7, 0xB8, 0x4D, 0xBA, 0xBA,
+  0xBA, 0x07, 0x07, 0x1C, 0x07, 0x79, 0xC6, 0xC6, 0xC6, 0x22, 0x22, 0xD6, 0xD6, 0xD6, 0xD6, 0x26,
+  0x26, 0xEB, 0xEA, 0xEA, 0x66, 0x66, 0x54, 0x53, 0x85, 0x85, 0x85, 0x85, 0x17, 0x2B, 0x17, 0x2B,
+  0x2B, 0x2B, 0x2A, 0x9D, 0x9D, 0x9D, 0x9D, 0x9C, 0x50, 0x50, 0x50, 0x24, 0x24, 0x24, 0x62, 0x62,
+  0x62, 0x43, 0x0E, 0x61, 0x0E, 0x05, 0x05, 0x05, 0x0C, 0x0C, 0x0C, 0x59, 0xB4, 0x59, 0xB4, 0xB4,
+  0x13, 0x13, 0x13, 0xDC, 0xDC, 0x2C, 0xDC, 0x2C, 0x2C, 0x80, 0x7F, 0xE6, 0x7F, 0xE6, 0x4C, 0xE6,
+  0x4C, 0x4C, 0x0F, 0x1D, 0x1D, 0x63, 0x1D, 0x63, 0x63, 0x06, 0x71, 0xF7, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x47, 0x08, 0xD4, 0x1B, 0x1B, 0x57, 0x57, 0x57, 0xF3, 0xF2, 0xF3,
+  0x3A, 0x3A, 0x6D, 0x6D, 0x6C, 0x83, 0x6C, 0xC7, 0x18, 0x10, 0x18, 0xFE, 0xBB, 0xF5, 0xF5, 0x09,
+  0x09, 0x9E, 0x12, 0x20, 0x20, 0x9B, 0x9B, 0x9B, 0x5B, 0x5A, 0x56, 0x56, 0x88, 0x88, 0x1F, 0x1F,
+  0x87, 0x87, 0xB8, 0xB8, 0xED, 0x4D, 0xED, 0x07, 0x07, 0xB9, 0x1C, 0x79, 0x2F, 0x79, 0xC6, 0xC6,
+  0xC5, 0x22, 0x22, 0xD6, 0xD6, 0xD6, 0x26, 0xEB, 0x26, 0xEB, 0x66, 0x66, 0x67, 0x54, 0x53, 0x53,
+  0x85, 0x85, 0x17, 0x17, 0x17, 0x2B, 0x2B, 0x2A, 0x2B, 0x2A, 0x9D, 0x9D, 0x9D, 0x5F, 0x5F, 0x50,
+  0x50, 0x50, 0x50, 0x4F, 0x4F, 0x24, 0x62, 0x43, 0x61, 0x61, 0x0E, 0x0E, 0x05, 0x05, 0x05, 0x0C,
+  0x05, 0x59, 0x59, 0xB4, 0x59, 0x59, 0x13, 0xB5, 0x13, 0x13, 0x13, 0xDC, 0xDC, 0x2C, 0x2C, 0x2C,
+  0x2C, 0x80, 0x7F, 0xE6, 0x4C, 0x4C, 0x0F, 0x4C, 0x0F, 0x0F, 0x0F, 0x0F, 0x1D, 0x1D, 0x06, 0x06,
+  0x06, 0x71, 0xF6, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x64,
+  0x57, 0x57, 0x57, 0x57, 0xF3, 0xF3, 0xF2, 0x3A, 0x3A, 0x6D, 0xC8, 0x6C, 0x6C, 0xC7, 0x10, 0xC7,
+  0x65, 0x18, 0x65, 0xBB, 0xBB, 0xF5, 0xF5, 0x12, 0x12, 0x9E, 0x12, 0x20, 0x9B, 0x9B, 0x5B, 0x5B,
+  0x56, 0x56, 0x56, 0x88, 0x88, 0x88, 0x1F, 0x1F, 0xB8, 0x87, 0xED, 0xED, 0x4D, 0xBA, 0xBA, 0xBA,
+  0x07, 0x79, 0x79, 0x78, 0xC6, 0xC6, 0x22, 0xC5, 0xC5, 0x22, 0xD6, 0xD6, 0x26, 0x26, 0x26, 0x26,
+  0x67, 0xEA, 0x67, 0x66, 0x53, 0x53, 0x85, 0x53, 0x85, 0x17, 0x17, 0x17, 0x2B, 0x2B, 0x2A, 0x2A,
+  0x2A, 0x9D, 0x2A, 0x9D, 0x5F, 0x5F, 0x50, 0x24, 0x24, 0x24, 0x62, 0x24, 0x43, 0x43, 0x24, 0x61,
+  0x61, 0x61, 0x05, 0x05, 0x05, 0x05, 0x05, 0x0C, 0x0C, 0x59, 0x59, 0xB4, 0xB4, 0xB4, 0xB5, 0x13,
+  0x13, 0xDD, 0xDC, 0x2C, 0x2C, 0x2C, 0x80, 0x80, 0x7F, 0x80, 0x7F, 0xE6, 0x4C, 0x4C, 0x4C, 0x74,
+  0x74, 0x1D, 0x1D, 0x63, 0x1D, 0x63, 0x06, 0x06, 0x70, 0xF6, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x47, 0xE7, 0x3A, 0x3A, 0xF3, 0xF3, 0x6C, 0x6C,
+  0x6D, 0x6D, 0x6D, 0x83, 0x83, 0x10, 0x65, 0xC7, 0xBC, 0xBB, 0xFE, 0xFE, 0xF5, 0xF5, 0x09, 0x09,
+  0x12, 0x9E, 0x20, 0x9B, 0x9B, 0x9A, 0x5B, 0x55, 0x56, 0x55, 0x88, 0x88, 0x1F, 0x1F, 0x1F, 0xB8,
+  0xB8, 0xED, 0xB8, 0xED, 0xBA, 0x07, 0xBA, 0xB9, 0x07, 0x2F, 0x78, 0x79, 0xC6, 0xC6, 0x22, 0x22,
+  0x22, 0xD6, 0x26, 0xD6, 0x26, 0x26, 0xEB, 0xEA, 0x67, 0x66, 0x66, 0x54, 0x53, 0x54, 0x85, 0x85,
+  0x17, 0x17, 0x17, 0x2B, 0x2B, 0x2B, 0x2A, 0x2A, 0x2A, 0x9D, 0x9D, 0x5F, 0x5F, 0x5F, 0x50, 0x50,
+  0x24, 0x4F, 0x24, 0x43, 0x43, 0x61, 0x61, 0x61, 0x0E, 0x05, 0x05, 0x05, 0x0C, 0x0C, 0x0C, 0x0C,
+  0x59, 0x59, 0x59, 0xB4, 0x13, 0xB5, 0x13, 0x13, 0xDC, 0xDC, 0x2C, 0x2C, 0x80, 0x80, 0x80, 0x80,
+  0x7F, 0x7F, 0xE6, 0x4C, 0x4C, 0x4C, 0x4C, 0x0F, 0x1D, 0x1D, 0x1D, 0x63, 0x63, 0x06, 0x70, 0xF7,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0xF6, 0x70, 0xE7, 0x2E, 0x9E, 0x6D, 0x6C, 0x83, 0x83, 0x10, 0xC7, 0xC7, 0xBC, 0x18,
+  0x65, 0xFE, 0xFE, 0xF5, 0x09, 0x09, 0x09, 0x12, 0x12, 0x9B, 0x9B, 0x9B, 0x9B, 0x31, 0x5A, 0x56,
+  0x56, 0x88, 0x88, 0x88, 0x1F, 0xB8, 0xB8, 0xB8, 0xED, 0xED, 0xBA, 0xBA, 0xBA, 0x07, 0x07, 0x1C,
+  0x2F, 0x2F, 0x79, 0xC6, 0x22, 0x22, 0x22, 0x22, 0xD7, 0xD6, 0xD6, 0x26, 0x26, 0x26, 0xEA, 0x67,
+  0x66, 0x54, 0x66, 0x53, 0x53, 0x86, 0x85, 0x17, 0x85, 0x17, 0x17, 0x2B, 0x2B, 0x2A, 0x2A, 0x9D,
+  0x2A, 0x5F, 0x60, 0x50, 0x50, 0x50, 0x4F, 0x24, 0x4F, 0x24, 0x24, 0x43, 0x61, 0x0E, 0x0E, 0x0E,
+  0x0E, 0x05, 0x05, 0x05, 0x0C, 0x0C, 0x0C, 0x0C, 0x59, 0x59, 0x59, 0x13, 0x13, 0x13, 0xDC, 0xDC,
+  0xDD, 0x2C, 0x2C, 0x2C, 0x2C, 0x80, 0x80, 0x80, 0x7F, 0x4C, 0x4C, 0x4C, 0x0F, 0x0F, 0x0F, 0x74,
+  0x0F, 0x06, 0x71, 0x70, 0x48, 0xF6, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+};
+
+const SPLASH_ImageTypeDef SPLASH_Image =
+{
+  152U, 152U, 0x000000U, 256U, splash_clut, splash_pixels
+};
@@ -0,0 +1,61 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file           : startup_trace.c
+  * @brief          : DWT timestamps of the startup phases, kept in backup SRAM
+  *                   across the jump to the application.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "startup_trace.h"
+
+/* Private define ------------------------------------------------------------*/
+#define STARTUP_TRACE ((STARTUP_TRACE_TypeDef *)STARTUP_TRACE_ADDRESS)
+
+/* Exported functions --------------------------------------------------------*/
+void STARTUP_TRACE_Start(void)
+{
+  /* Backup SRAM is write protected with the rest of the backup domain */
+  HAL_PWR_EnableBkUpAccess();
+  __HAL_RCC_BKPRAM_CLK_ENABLE();
+
+  /* The application keeps the counter running, it times the whole startup */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->LAR = 0xC5ACCE55U;
+  DWT->CYCCNT = 0U;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  STARTUP_TRACE->Magic = STARTUP_TRACE_MAGIC;
+  STARTUP_TRACE->Count = 0U;
+  STARTUP_TRACE_Mark("reset");
+}
+
+void STARTUP_TRACE_Mark(const char *name)
+{
+  STARTUP_TRACE_TypeDef *trace = STARTUP_TRACE;
+  const uint32_t primask = __get_PRIMASK();
+  const uint32_t cycles = DWT->CYCCNT;
+
+  __disable_irq();
+  if ((trace->Magic == STARTUP_TRACE_MAGIC) && (trace->Count < STARTUP_TRACE_MAX_EVENTS))
+  {
+    trace->Events[trace->Count].Cycles = cycles;
+    trace->Events[trace->Count].ClockHz = SystemCoreClock;
+    trace->Events[trace->Count].Name = name;
+    trace->Count++;
+  }
+  __set_PRIMASK(primask);
+}
@@ -0,0 +1,320 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file           : xspi_calibration.c
+  * @brief          : Calibration of the XSPI links of the external memories,
+  *                   kept in the boot storage.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+/* Includes ------------------------------------------------------------------*/
+#include "main.h"
+#include "extmem_manager.h"
+#include "boot_storage.h"
+#include "xspi_calibration.h"
+#include <stddef.h>
+#include <string.h>
+
+#if XSPI_CALIBRATION_ENABLE == 1
+/* Private define ------------------------------------------------------------*/
+#define XSPI_CALIBRATION ((const XSPI_CALIBRATION_RecordTypeDef *)(BOOT_STORAGE_ADDRESS + BOOT_STORAGE_CALIBRATION_OFFSET))
+#define XSPI_CALIBRATION_WORDS (XSPI_CALIBRATION_BLOCK / 4U)
+
+/* The record must fit before the SFDP cache */
+typedef char XSPI_CALIBRATION_SizeCheck[((BOOT_STORAGE_CALIBRATION_OFFSET + sizeof(XSPI_CALIBRATION_RecordTypeDef)) <= BOOT_STORAGE_SFDP_OFFSET) ? 1 : -1];
+
+/* Private variables ---------------------------------------------------------*/
+/* The NOR flash read at the slowest clock, the reference of the faster ones */
+static uint32_t calib_reference[XSPI_CALIBRATION_WORDS] __ALIGNED(32);
+static XSPI_CALIBRATION_RecordTypeDef calib_record;
+
+/* Private functions ---------------------------------------------------------*/
+static XSPI_HandleTypeDef *calib_handle(uint32_t MemId)
+{
+  return (XSPI_HandleTypeDef *)extmem_list_config[MemId].Handle;
+}
+
+static uint32_t calib_writable(uint32_t MemId)
+{
+  return (extmem_list_config[MemId].MemType == EXTMEM_PSRAM) ? 1U : 0U;
+}
+
+static uint32_t calib_kernel_clock(uint32_t MemId)
+{
+  return HAL_RCCEx_GetPeriphCLKFreq((calib_handle(MemId)->Instance == XSPI1) ? RCC_PERIPHCLK_XSPI1 : RCC_PERIPHCLK_XSPI2);
+}
+
+static uint32_t calib_pattern(uint32_t Pass, uint32_t Index)
+{
+  /* Every line toggles from one word to the next, and the words change with the pass */
+  uint32_t value = ((Index + 1U) * 0x9E3779B9U) ^ (Pass * 0x85EBCA6BU);
+  return ((Index & 1U) != 0U) ? ~value : value;
+}
+
+static uint32_t calib_apply(uint32_t MemId, uint32_t Prescaler, uint32_t DelayHold)
+{
+  XSPI_HandleTypeDef *hxspi = calib_handle(MemId);
+  const uint32_t previous = hxspi->Init.ClockPrescaler;
+
+  /* Setting the prescaler calibrates the DLL of the high-speed interface again */
+  if (HAL_XSPI_SetClockPrescaler(hxspi, Prescaler) != HAL_OK)
+  {
+    return 1U;
+  }
+  /* The refresh is a number of memory clocks, its duration is kept, see psram_profile.h */
+  hxspi->Init.Refresh = (hxspi->Init.Refresh * (previous + 1U)) / (Prescaler + 1U);
+  hxspi->Instance->DCR4 = hxspi->Init.Refresh;
+  hxspi->Init.DelayHoldQuarterCycle = (DelayHold != 0U) ? HAL_XSPI_DHQC_ENABLE : HAL_XSPI_DHQC_DISABLE;
+  MODIFY_REG(hxspi->Instance->TCR, XSPI_TCR_DHQC, hxspi->Init.DelayHoldQuarterCycle);
+  return 0U;
+}
+
+/**
+  * @brief  Checks the memory with the settings applied, and measures its throughput.
+  * @param  MemId The memory.
+  * @param  Passes Number of patterns checked.
+  * @param  Result Throughput measured when every pattern passes, NULL to not measure.
+  * @retval Words wrong, or 1 if the memory could not be mapped
+  */
+static uint32_t calib_check(uint32_t MemId, uint32_t Passes, XSPI_CALIBRATION_MemoryTypeDef *Result)
+{
+  volatile uint32_t *memory;
+  uint32_t address = 0U;
+  uint32_t errors = 0U;
+  uint32_t sum = 0U;
+  uint32_t cycles;
+
+  if ((EXTMEM_GetMapAddress(MemId, &address) != EXTMEM_OK)
+      || (EXTMEM_MemoryMappedMode(MemId, EXTMEM_ENABLE) != EXTMEM_OK))
+  {
+    return 1U;
+  }
+  memory = (volatile uint32_t *)address;
+
+  for (uint32_t pass = 0U; pass < Passes; pass++)
+  {
+    if (calib_writable(MemId) != 0U)
+    {
+      for (uint32_t index = 0U; index < XSPI_CALIBRATION_WORDS; index++)
+      {
+        memory[index] = calib_pattern(pass, index);
+      }
+      SCB_CleanInvalidateDCache_by_Addr((void *)address, (int32_t)XSPI_CALIBRATION_BLOCK);
+      for (uint32_t index = 0U; index < XSPI_CALIBRATION_WORDS; index++)
+      {
+        errors += (memory[index] != calib_pattern(pass, index)) ? 1U : 0U;
+      }
+    }
+    else
+    {
+      SCB_InvalidateDCache_by_Addr((void *)address, (int32_t)XSPI_CALIBRATION_BLOCK);
+      for (uint32_t index = 0U; index < XSPI_CALIBRATION_WORDS; index++)
+      {
+        errors += (memory[index] != calib_reference[index]) ? 1U : 0U;
+      }
+    }
+  }
+
+  if ((errors == 0U) && (Result != NULL))
+  {
+    /* Line fills, as the application reads the memory through the D-cache */
+    SCB_InvalidateDCache_by_Addr((void *)address, (int32_t)XSPI_CALIBRATION_BLOCK);
+    cycles = DWT->CYCCNT;
+    for (uint32_t index = 0U; index < XSPI_CALIBRATION_WORDS; index += 8U)
+    {
+      sum += memory[index];
+    }
+    cycles = DWT->CYCCNT - cycles;
+    Result->ReadKBps = (uint32_t)(((uint64_t)XSPI_CALIBRATION_BLOCK * SystemCoreClock) / ((uint64_t)(cycles + 1U) * 1024U));
+
+    if (calib_writable(MemId) != 0U)
+    {
+      /* Line evictions, the cleaning writes the whole block back */
+      cycles = DWT->CYCCNT;
+      for (uint32_t index = 0U; index < XSPI_CALIBRATION_WORDS; index++)
+      {
+        memory[index] = sum + index;
+      }
+      SCB_CleanDCache_by_Addr((void *)address, (int32_t)XSPI_CALIBRATION_BLOCK);
+      cycles = DWT->CYCCNT - cycles;
+      Result->WriteKBps = (uint32_t)(((uint64_t)XSPI_CALIBRATION_BLOCK * SystemCoreClock) / ((uint64_t)(cycles + 1U) * 1024U));
+    }
+  }
+
+  /* No line of the memory may be left in the D-cache once it is not mapped */
+  SCB_CleanInvalidateDCache_by_Addr((void *)address, (int32_t)XSPI_CALIBRATION_BLOCK);
+  if (EXTMEM_MemoryMappedMode(MemId, EXTMEM_DISABLE) != EXTMEM_OK)
+  {
+    errors++;
+  }
+  return errors;
+}
+
+/**
+  * @brief  Reads the NOR flash at the slowest clock of the sweep, twice to be sure.
+  * @param  MemId The memory.
+  * @param  Prescaler The prescaler of the memory driver.
+  * @retval 0 if the reference is read
+  */
+static uint32_t calib_read_reference(uint32_t MemId, uint32_t Prescaler)
+{
+  uint32_t address = 0U;
+
+  if ((calib_apply(MemId, Prescaler + XSPI_CALIBRATION_STEPS - 1U, 1U) != 0U)
+      || (EXTMEM_GetMapAddress(MemId, &address) != EXTMEM_OK)
+      || (EXTMEM_MemoryMappedMode(MemId, EXTMEM_ENABLE) != EXTMEM_OK))
+  {
+    return 1U;
+  }
+  SCB_InvalidateDCache_by_Addr((void *)address, (int32_t)XSPI_CALIBRATION_BLOCK);
+  (void)memcpy(calib_reference, (const void *)address, XSPI_CALIBRATION_BLOCK);
+  SCB_InvalidateDCache_by_Addr((void *)address, (int32_t)XSPI_CALIBRATION_BLOCK);
+  (void)EXTMEM_MemoryMappedMode(MemId, EXTMEM_DISABLE);
+
+  return calib_check(MemId, 1U, NULL);
+}
+
+/**
+  * @brief  Tries the settings from the prescaler of the memory driver downwards, and
+  *         applies the fastest one passing every pattern.
+  * @param  MemId The memory.
+  * @param  Result The settings kept.
+  * @retval 0 if settings are kept, otherwise those of the memory driver are restored
+  */
+static uint32_t calib_sweep(uint32_t MemId, XSPI_CALIBRATION_MemoryTypeDef *Result)
+{
+  const uint32_t prescaler = calib_handle(MemId)->Init.ClockPrescaler;
+  const uint32_t delayHold = (calib_handle(MemId)->Init.DelayHoldQuarterCycle != HAL_XSPI_DHQC_DISABLE) ? 1U : 0U;
+  XSPI_CALIBRATION_MemoryTypeDef candidate;
+  uint32_t found = 0U;
+
+  (void)memset(Result, 0x0, sizeof(XSPI_CALIBRATION_MemoryTypeDef));
+  Result->KernelClockHz = calib_kernel_clock(MemId);
+
+  if ((calib_writable(MemId) == 0U) && (calib_read_reference(MemId, prescaler) != 0U))
+  {
+    (void)calib_apply(MemId, prescaler, delayHold);
+    return 1U;
+  }
+
+  for (uint32_t step = 0U; (step < XSPI_CALIBRATION_STEPS) && (found == 0U); step++)
+  {
+    /* The setting of MX_XSPIx_Init() first, it is kept on a tie */
+    for (uint32_t option = 0U; option < 2U; option++)
+    {
+      (void)memset(&candidate, 0x0, sizeof(candidate));
+      candidate.Prescaler = prescaler + step;
+      candidate.DelayHold = delayHold ^ option;
+      if ((calib_apply(MemId, candidate.Prescaler, candidate.DelayHold) == 0U)
+          && (calib_check(MemId, XSPI_CALIBRATION_PASSES, &candidate) == 0U))
+      {
+        if ((found == 0U) || (candidate.ReadKBps > Result->ReadKBps))
+        {
+          Result->Prescaler = candidate.Prescaler;
+          Result->DelayHold = candidate.DelayHold;
+          Result->ReadKBps = candidate.ReadKBps;
+          Result->WriteKBps = candidate.WriteKBps;
+        }
+        found = 1U;
+      }
+      else
+      {
+        Result->Rejected++;
+      }
+    }
+  }
+
+  if (found == 0U)
+  {
+    (void)calib_apply(MemId, prescaler, delayHold);
+    return 1U;
+  }
+  return calib_apply(MemId, Result->Prescaler, Result->DelayHold);
+}
+
+static uint32_t calib_is_valid(const XSPI_CALIBRATION_RecordTypeDef *Record)
+{
+  if ((Record->Magic != XSPI_CALIBRATION_MAGIC)
+      || (Record->Checksum != BOOT_STORAGE_Checksum(Record, offsetof(XSPI_CALIBRATION_RecordTypeDef, Checksum))))
+  {
+    return 0U;
+  }
+  for (uint32_t MemId = 0U; MemId < XSPI_CALIBRATION_MEMORIES; MemId++)
+  {
+    /* Calibrated at another clock */
+    if (Record->Memory[MemId].KernelClockHz != calib_kernel_clock(MemId))
+    {
+      return 0U;
+    }
+  }
+  return 1U;
+}
+
+/* Exported functions --------------------------------------------------------*/
+void XSPI_CALIBRATION_Run(void)
+{
+  uint32_t prescaler[XSPI_CALIBRATION_MEMORIES];
+  uint32_t delayHold[XSPI_CALIBRATION_MEMORIES];
+  uint32_t failed = 0U;
+  uint32_t MemId;
+
+  /* Started by the startup trace, unless it is not built */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  for (MemId = 0U; MemId < XSPI_CALIBRATION_MEMORIES; MemId++)
+  {
+    prescaler[MemId] = calib_handle(MemId)->Init.ClockPrescaler;
+    delayHold[MemId] = (calib_handle(MemId)->Init.DelayHoldQuarterCycle != HAL_XSPI_DHQC_DISABLE) ? 1U : 0U;
+  }
+
+  /* The stored settings, as long as they still pass */
+  if ((XSPI_CALIBRATION_FORCE == 0) && (calib_is_valid(XSPI_CALIBRATION) != 0U))
+  {
+    for (MemId = 0U; (MemId < XSPI_CALIBRATION_MEMORIES) && (failed == 0U); MemId++)
+    {
+      const XSPI_CALIBRATION_MemoryTypeDef *memory = &XSPI_CALIBRATION->Memory[MemId];
+      if (((calib_writable(MemId) == 0U) && (calib_read_reference(MemId, prescaler[MemId]) != 0U))
+          || (calib_apply(MemId, memory->Prescaler, memory->DelayHold) != 0U)
+          || (calib_check(MemId, 1U, NULL) != 0U))
+      {
+        failed = 1U;
+      }
+    }
+    if (failed == 0U)
+    {
+      return;
+    }
+    for (MemId = 0U; MemId < XSPI_CALIBRATION_MEMORIES; MemId++)
+    {
+      (void)calib_apply(MemId, prescaler[MemId], delayHold[MemId]);
+    }
+  }
+
+  (void)memset(&calib_record, 0x0, sizeof(calib_record));
+  failed = 0U;
+  for (MemId = 0U; MemId < XSPI_CALIBRATION_MEMORIES; MemId++)
+  {
+    failed |= calib_sweep(MemId, &calib_record.Memory[MemId]);
+  }
+
+  /* Calibrated again on the next boot otherwise */
+  if (failed == 0U)
+  {
+    calib_record.Magic = XSPI_CALIBRATION_MAGIC;
+    calib_record.Checksum = BOOT_STORAGE_Checksum(&calib_record, offsetof(XSPI_CALIBRATION_RecordTypeDef, Checksum));
+    (void)BOOT_STORAGE_Write(BOOT_STORAGE_CALIBRATION_OFFSET, &calib_record, sizeof(calib_record));
+  }
+}
+#endif /* XSPI_CALIBRATION_ENABLE == 1 */
@@ -987,6 +987,23 @@ typedef union {
   } Param_DWORD;
 } SFPD_JEDEC_SCCR_Map; /* contains the command codes used in 8D-8D-8D protocol mode */
 
+/**
+ * @brief SFDP data saved and restored by SFDP_SaveData and SFDP_RestoreData
+ */
+typedef struct {
+  SFPD_HeaderTypeDef             Header;          /*!< SFDP header */
+  SFDP_JEDECBasic_Params         Basic;           /*!< JEDEC basic table */
+  SFDP_JEDEC4ByteAddress_Params  Address4Bit;     /*!< JEDEC 4-byte address table */
+  SFPD_JEDEC_XSPI10              XSPI10;          /*!< JEDEC XSPI V1.0 table */
+  SFPD_JEDEC_SCCR_Map            SCCR_Map;        /*!< JEDEC SCCR table */
+  SFPD_JEDEC_OCTALDDR            OctalDdr;        /*!< JEDEC octal DDR table */
+  uint32_t                       Sfdp_table_mask; /*!< tables available */
+  uint32_t                       Reset_info;      /*!< JEDEC Basic 16 Reset/Rescue info */
+} SFDP_SavedDataTypeDef;
+
+/* EXTMEM_DRIVER_NOR_SFDP_DATA_SIZE must hold the saved data */
+typedef char SFDP_SavedDataSizeCheck[(sizeof(SFDP_SavedDataTypeDef) <= EXTMEM_DRIVER_NOR_SFDP_DATA_SIZE) ? 1 : -1];
+
 /**
   * @}
   */
@@ -1790,6 +1807,40 @@ error :
   return retr;
 }
 
+void SFDP_SaveData(const EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef *Object, uint8_t *Data)
+{
+  SFDP_SavedDataTypeDef saved;
+  SFDP_DEBUG_STR(__func__);
+
+  (void)memset(Data, 0x0, EXTMEM_DRIVER_NOR_SFDP_DATA_SIZE);
+  (void)memset(&saved, 0x0, sizeof(saved));
+  saved.Header          = JEDEC_SFDP_Header;
+  saved.Basic           = JEDEC_Basic;
+  saved.Address4Bit     = JEDEC_Address4Bit;
+  saved.XSPI10          = JEDEC_XSPI10;
+  saved.SCCR_Map        = JEDEC_SCCR_Map;
+  saved.OctalDdr        = JEDEC_OctalDdr;
+  saved.Sfdp_table_mask = Object->sfpd_private.Sfdp_table_mask;
+  saved.Reset_info      = Object->sfpd_private.Reset_info;
+  (void)memcpy(Data, &saved, sizeof(saved));
+}
+
+void SFDP_RestoreData(EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef *Object, const uint8_t *Data)
+{
+  SFDP_SavedDataTypeDef saved;
+  SFDP_DEBUG_STR(__func__);
+
+  (void)memcpy(&saved, Data, sizeof(saved));
+  JEDEC_SFDP_Header = saved.Header;
+  JEDEC_Basic       = saved.Basic;
+  JEDEC_Address4Bit = saved.Address4Bit;
+  JEDEC_XSPI10      = saved.XSPI10;
+  JEDEC_SCCR_Map    = saved.SCCR_Map;
+  JEDEC_OctalDdr    = saved.OctalDdr;
+  Object->sfpd_private.Sfdp_table_mask = saved.Sfdp_table_mask;
+  Object->sfpd_private.Reset_info      = saved.Reset_info;
+}
+
 /**
   * @}
   */
@@ -114,6 +114,20 @@ SFDP_StatusTypeDef SFDP_MemoryReset(EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef *Object
  */
 SFDP_StatusTypeDef SFDP_BuildGenericDriver(EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef *Object);
 
+/**
+ * @brief save the SFDP data collected by SFDP_CollectData
+ * @param Object memory instance
+ * @param Data buffer of EXTMEM_DRIVER_NOR_SFDP_DATA_SIZE bytes
+ */
+void SFDP_SaveData(const EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef *Object, uint8_t *Data);
+
+/**
+ * @brief restore SFDP data saved by SFDP_SaveData, in place of SFDP_CollectData
+ * @param Object memory instance
+ * @param Data buffer of EXTMEM_DRIVER_NOR_SFDP_DATA_SIZE bytes
+ */
+void SFDP_RestoreData(EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef *Object, const uint8_t *Data);
+
 /**
   * @}
   */
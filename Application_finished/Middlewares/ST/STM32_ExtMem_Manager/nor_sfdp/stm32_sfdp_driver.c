@@ -27,6 +27,7 @@
 #include <stdio.h>
 #endif /* EXTMEM_DRIVER_NOR_SFDP_DEBUG_LEVEL != 0 && defined(EXTMEM_MACRO_DEBUG) */
 #include <string.h>
+#include <stddef.h>
 
 /** @defgroup NOR_SFDP NOR SFDP driver
   * @ingroup EXTMEM_DRIVER
@@ -54,6 +55,11 @@
  */
 #define DRIVER_DEFAULT_TIMEOUT 300
 
+/**
+ * @brief delay after the memory reset before the SFDP is read, in ms
+ */
+#define DRIVER_RESET_DELAY 10u
+
 
 /**
  * @brief DEBUG macro
@@ -112,6 +118,12 @@
 
 /* Private typedefs ---------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
+#if EXTMEM_DRIVER_NOR_SFDP_CACHE == 1
+/**
+ * @brief cache record loaded on init, and the record stored when it is not valid
+ */
+static EXTMEM_DRIVER_NOR_SFDP_CacheTypeDef sfdp_cache;
+#endif /* EXTMEM_DRIVER_NOR_SFDP_CACHE == 1 */
 /* Private functions ---------------------------------------------------------*/
 
 /** @defgroup DRIVER_SFDP_Private_Functions DRIVER SFDP Private Functions
@@ -120,6 +132,11 @@
 static EXTMEM_DRIVER_NOR_SFDP_StatusTypeDef driver_check_FlagBUSY(EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef *SFDPObject, uint32_t timeout);
 static EXTMEM_DRIVER_NOR_SFDP_StatusTypeDef driver_set_FlagWEL(EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef *SFDPObject, uint32_t timeout);
 __weak void EXTMEM_MemCopy( uint32_t* destination_Address, const uint8_t* ptrData, uint32_t DataSize);
+#if EXTMEM_DRIVER_NOR_SFDP_CACHE == 1
+static uint32_t driver_cache_checksum(const EXTMEM_DRIVER_NOR_SFDP_CacheTypeDef *Cache);
+static EXTMEM_DRIVER_NOR_SFDP_StatusTypeDef driver_cache_restore(EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef *SFDPObject);
+static void driver_cache_save(const EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef *SFDPObject, const uint8_t *DataID);
+#endif /* EXTMEM_DRIVER_NOR_SFDP_CACHE == 1 */
 
 /**
   * @}
@@ -182,8 +199,24 @@ EXTMEM_DRIVER_NOR_SFDP_StatusTypeDef EXTMEM_DRIVER_NOR_SFDP_Init(void *IP, EXTME
     SFDP_DEBUG_STR("ERROR::on the call of SFDP_MemoryReset but no error returned")
   }
 
+#if EXTMEM_DRIVER_NOR_SFDP_CACHE == 1
+  /* restore the SFDP data of the previous boot, once the memory answers its ID again */
+  SFDP_DEBUG_STR("restore the SFDP data from the cache")
+  if (EXTMEM_DRIVER_NOR_SFDP_OK == driver_cache_restore(SFDPObject))
+  {
+    SFDP_DEBUG_STR("build the generic driver information from the cache")
+    if(EXTMEM_SFDP_OK == SFDP_BuildGenericDriver(SFDPObject))
+    {
+      goto control_mode;
+    }
+    /* the cache no longer matches the memory, collect the SFDP data again */
+    SFDP_DEBUG_STR("ERROR::the cache is not valid for the memory")
+    (void)SFDP_MemoryReset(SFDPObject);
+  }
+#endif /* EXTMEM_DRIVER_NOR_SFDP_CACHE == 1 */
+
   /* wait few ms after the reset operation, this is done to avoid issue on SFDP read */
-  HAL_Delay(10);
+  HAL_Delay(DRIVER_RESET_DELAY);
 
   /* analyse the SFPD structure to get driver information after the reset */
   SFDP_DEBUG_STR("analyse the SFPD structure to get driver information")
@@ -212,6 +245,11 @@ EXTMEM_DRIVER_NOR_SFDP_StatusTypeDef EXTMEM_DRIVER_NOR_SFDP_Init(void *IP, EXTME
     goto error;
   }
 
+#if EXTMEM_DRIVER_NOR_SFDP_CACHE == 1
+  /* keep the SFDP data for the next boot */
+  driver_cache_save(SFDPObject, DataID);
+#endif /* EXTMEM_DRIVER_NOR_SFDP_CACHE == 1 */
+
   /* setup the generic driver information and prepare the physical layer */
   SFDP_DEBUG_STR("build the generic driver information and prepare the physical layer")
   if(EXTMEM_SFDP_OK !=  SFDP_BuildGenericDriver(SFDPObject))
@@ -221,6 +259,9 @@ EXTMEM_DRIVER_NOR_SFDP_StatusTypeDef EXTMEM_DRIVER_NOR_SFDP_Init(void *IP, EXTME
     goto error;
   }
 
+#if EXTMEM_DRIVER_NOR_SFDP_CACHE == 1
+control_mode:
+#endif /* EXTMEM_DRIVER_NOR_SFDP_CACHE == 1 */
   SFDP_DEBUG_STR("read the flash ID to control if the selected mode is functional")
   (void)memset(DataID, 0xAA, sizeof(DataID));
   (void)SAL_XSPI_GetId(&SFDPObject->sfpd_private.SALObject, DataID, 3);
@@ -666,6 +707,119 @@ __weak void EXTMEM_MemCopy(uint32_t* destination_Address, const uint8_t* ptrData
   }
 }
 
+#if EXTMEM_DRIVER_NOR_SFDP_CACHE == 1
+/**
+ * @brief this function computes the CRC-32 of a cache record, checksum excluded
+ *
+ * @param Cache cache record
+ * @return CRC-32 value
+ **/
+static uint32_t driver_cache_checksum(const EXTMEM_DRIVER_NOR_SFDP_CacheTypeDef *Cache)
+{
+  const uint8_t *ptr = (const uint8_t *)Cache;
+  uint32_t crc = 0xFFFFFFFFu;
+
+  for (uint32_t index = 0u; index < offsetof(EXTMEM_DRIVER_NOR_SFDP_CacheTypeDef, Checksum); index++)
+  {
+    crc ^= ptr[index];
+    for (uint8_t bit = 0u; bit < 8u; bit++)
+    {
+      crc = (crc >> 1u) ^ (0xEDB88320u & (0u - (crc & 1u)));
+    }
+  }
+  return ~crc;
+}
+
+/**
+ * @brief this function restores the SFDP data from the cache, after the memory reset.
+ *        The reset delay is replaced by polling the memory ID, which the memory answers
+ *        once it has recovered from the reset
+ *
+ * @param SFDPObject memory object
+ * @return @ref EXTMEM_DRIVER_NOR_SFDP_OK if the SFDP data has been restored
+ **/
+static EXTMEM_DRIVER_NOR_SFDP_StatusTypeDef driver_cache_restore(EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef *SFDPObject)
+{
+  uint8_t DataID[6];
+  uint32_t tickstart;
+
+  (void)memset(&sfdp_cache, 0x0, sizeof(sfdp_cache));
+  if ((EXTMEM_DRIVER_NOR_SFDP_OK != EXTMEM_DRIVER_NOR_SFDP_CacheLoad(&sfdp_cache))
+      || (EXTMEM_DRIVER_NOR_SFDP_CACHE_MAGIC != sfdp_cache.Magic)
+      || (EXTMEM_DRIVER_NOR_SFDP_DATA_SIZE != sfdp_cache.Size)
+      || (driver_cache_checksum(&sfdp_cache) != sfdp_cache.Checksum))
+  {
+    SFDP_DEBUG_STR("no valid cache")
+    sfdp_cache.Magic = 0u;
+    return EXTMEM_DRIVER_NOR_SFDP_ERROR;
+  }
+
+  /* the memory is in 1S1S1S mode after the reset */
+  SFDPObject->sfpd_private.DriverInfo.SpiPhyLink = PHY_LINK_1S1S1S;
+  if (HAL_OK != SAL_XSPI_MemoryConfig(&SFDPObject->sfpd_private.SALObject, PARAM_PHY_LINK, &SFDPObject->sfpd_private.DriverInfo.SpiPhyLink))
+  {
+    return EXTMEM_DRIVER_NOR_SFDP_ERROR;
+  }
+
+  tickstart = HAL_GetTick();
+  do
+  {
+    (void)memset(DataID, 0xAA, sizeof(DataID));
+    (void)SAL_XSPI_GetId(&SFDPObject->sfpd_private.SALObject, DataID, 3);
+    if (0 == memcmp(DataID, sfdp_cache.FlashId, 3u))
+    {
+      DEBUG_ID(DataID);
+      SFDP_RestoreData(SFDPObject, sfdp_cache.Data);
+      return EXTMEM_DRIVER_NOR_SFDP_OK;
+    }
+  } while ((HAL_GetTick() - tickstart) <= DRIVER_RESET_DELAY);
+
+  /* another memory, or still not ready: the SFDP is read after the remaining delay */
+  SFDP_DEBUG_STR("the memory ID does not match the cache")
+  return EXTMEM_DRIVER_NOR_SFDP_ERROR;
+}
+
+/**
+ * @brief this function stores the SFDP data in the cache, unless the cache already holds it
+ *
+ * @param SFDPObject memory object
+ * @param DataID memory ID read in 1S1S1S mode after the reset
+ **/
+static void driver_cache_save(const EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef *SFDPObject, const uint8_t *DataID)
+{
+  EXTMEM_DRIVER_NOR_SFDP_CacheTypeDef *cache = &sfdp_cache;
+  uint8_t data[EXTMEM_DRIVER_NOR_SFDP_DATA_SIZE];
+
+  SFDP_SaveData(SFDPObject, data);
+  if ((EXTMEM_DRIVER_NOR_SFDP_CACHE_MAGIC == cache->Magic)
+      && (0 == memcmp(cache->FlashId, DataID, 3u))
+      && (0 == memcmp(cache->Data, data, sizeof(data))))
+  {
+    /* the cache is valid and holds the same data, avoid wearing its storage */
+    return;
+  }
+
+  (void)memset(cache, 0x0, sizeof(EXTMEM_DRIVER_NOR_SFDP_CacheTypeDef));
+  cache->Magic = EXTMEM_DRIVER_NOR_SFDP_CACHE_MAGIC;
+  cache->Size = EXTMEM_DRIVER_NOR_SFDP_DATA_SIZE;
+  (void)memcpy(cache->FlashId, DataID, 3u);
+  (void)memcpy(cache->Data, data, sizeof(data));
+  cache->Checksum = driver_cache_checksum(cache);
+  EXTMEM_DRIVER_NOR_SFDP_CacheStore(cache);
+}
+
+__weak EXTMEM_DRIVER_NOR_SFDP_StatusTypeDef EXTMEM_DRIVER_NOR_SFDP_CacheLoad(EXTMEM_DRIVER_NOR_SFDP_CacheTypeDef *Cache)
+{
+  (void)Cache;
+  return EXTMEM_DRIVER_NOR_SFDP_ERROR;
+}
+
+__weak void EXTMEM_DRIVER_NOR_SFDP_CacheStore(const EXTMEM_DRIVER_NOR_SFDP_CacheTypeDef *Cache)
+{
+  (void)Cache;
+}
+#endif /* EXTMEM_DRIVER_NOR_SFDP_CACHE == 1 */
+
 /**
   * @}
   */
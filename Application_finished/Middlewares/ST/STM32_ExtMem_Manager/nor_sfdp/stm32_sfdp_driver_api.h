@@ -32,6 +32,19 @@
   */
 
 /* Exported constants --------------------------------------------------------*/
+/**
+ * @brief set EXTMEM_DRIVER_NOR_SFDP_CACHE to 1 to restore the SFDP data of the memory
+ *        with EXTMEM_DRIVER_NOR_SFDP_CacheLoad instead of reading it on each init
+ */
+#ifndef EXTMEM_DRIVER_NOR_SFDP_CACHE
+#define EXTMEM_DRIVER_NOR_SFDP_CACHE 0
+#endif /* EXTMEM_DRIVER_NOR_SFDP_CACHE */
+
+/**
+ * @brief magic number of a valid cache record, changed with the record layout
+ */
+#define EXTMEM_DRIVER_NOR_SFDP_CACHE_MAGIC 0x53464431u
+
 /* Exported types ------------------------------------------------------------*/
 
 /** @defgroup DRIVER_SFDP_Exported_Types DRIVER SFDP Memory Exported Types
@@ -174,6 +187,25 @@ EXTMEM_DRIVER_NOR_SFDP_StatusTypeDef EXTMEM_DRIVER_NOR_SFDP_Enable_MemoryMappedM
  **/
 EXTMEM_DRIVER_NOR_SFDP_StatusTypeDef EXTMEM_DRIVER_NOR_SFDP_Disable_MemoryMappedMode(EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef *SFDPObject);
 
+/**
+ * @brief this function loads the SFDP data cached by EXTMEM_DRIVER_NOR_SFDP_CacheStore,
+ *        called on init when EXTMEM_DRIVER_NOR_SFDP_CACHE is 1. The weak implementation
+ *        has no cache
+ *
+ * @param Cache cache record to fill, checked by the driver
+ * @return @ref EXTMEM_DRIVER_NOR_SFDP_OK if a record has been loaded
+ **/
+EXTMEM_DRIVER_NOR_SFDP_StatusTypeDef EXTMEM_DRIVER_NOR_SFDP_CacheLoad(EXTMEM_DRIVER_NOR_SFDP_CacheTypeDef *Cache);
+
+/**
+ * @brief this function stores the SFDP data read from the memory, called on init when
+ *        EXTMEM_DRIVER_NOR_SFDP_CACHE is 1 and the cache has not been used. The weak
+ *        implementation does nothing
+ *
+ * @param Cache cache record to keep
+ **/
+void EXTMEM_DRIVER_NOR_SFDP_CacheStore(const EXTMEM_DRIVER_NOR_SFDP_CacheTypeDef *Cache);
+
 /**
   * @}
   */
@@ -32,6 +32,11 @@
   */
 
 /* Exported constants --------------------------------------------------------*/
+/**
+ * @brief size of the SFDP tables kept in @ref EXTMEM_DRIVER_NOR_SFDP_CacheTypeDef
+ */
+#define EXTMEM_DRIVER_NOR_SFDP_DATA_SIZE  320u
+
 /* Exported types ------------------------------------------------------------*/
 
 /** @defgroup DRIVER_SFDP_Exported_Types DRIVER SFDP Memory Exported Types
@@ -102,6 +107,18 @@ typedef struct {
   } sfpd_private;
 } EXTMEM_DRIVER_NOR_SFDP_ObjectTypeDef;
 
+/**
+ * @brief SFDP data of a memory, kept between boots to skip the SFDP discovery,
+ *        see EXTMEM_DRIVER_NOR_SFDP_CacheLoad and EXTMEM_DRIVER_NOR_SFDP_CacheStore
+ */
+typedef struct {
+  uint32_t Magic;                                  /*!< EXTMEM_DRIVER_NOR_SFDP_CACHE_MAGIC */
+  uint32_t Size;                                   /*!< size of the data saved */
+  uint8_t  FlashId[4];                             /*!< ID of the memory the data was read from */
+  uint8_t  Data[EXTMEM_DRIVER_NOR_SFDP_DATA_SIZE]; /*!< SFDP tables collected */
+  uint32_t Checksum;                               /*!< CRC-32 of the fields above */
+} EXTMEM_DRIVER_NOR_SFDP_CacheTypeDef;
+
 /**
   * @}
   */
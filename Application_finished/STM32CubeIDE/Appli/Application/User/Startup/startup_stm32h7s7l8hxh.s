@@ -41,6 +41,18 @@ defined in linker script */
 .word  _sbss
 /* end address for the .bss section. defined in linker script */
 .word  _ebss
+/* start address for the initialization values of the ITCM code. defined in linker script */
+.word  _siitcm
+/* start address for the ITCM code. defined in linker script */
+.word  _sitcm
+/* end address for the ITCM code. defined in linker script */
+.word  _eitcm
+/* start address for the initialization values of the DTCM constants. defined in linker script */
+.word  _sidtcm
+/* start address for the DTCM constants. defined in linker script */
+.word  _sdtcm
+/* end address for the DTCM constants. defined in linker script */
+.word  _edtcm
 
 /**
  * @brief  This is the code that gets called when the processor first
@@ -77,6 +89,40 @@ LoopCopyDataInit:
   cmp r4, r1
   bcc CopyDataInit
 
+/* Copy the time critical code from flash to ITCM */
+  ldr r0, =_sitcm
+  ldr r1, =_eitcm
+  ldr r2, =_siitcm
+  movs r3, #0
+  b LoopCopyItcmInit
+
+CopyItcmInit:
+  ldr r4, [r2, r3]
+  str r4, [r0, r3]
+  adds r3, r3, #4
+
+LoopCopyItcmInit:
+  adds r4, r0, r3
+  cmp r4, r1
+  bcc CopyItcmInit
+
+/* Copy the constants of the time critical code from flash to DTCM */
+  ldr r0, =_sdtcm
+  ldr r1, =_edtcm
+  ldr r2, =_sidtcm
+  movs r3, #0
+  b LoopCopyDtcmInit
+
+CopyDtcmInit:
+  ldr r4, [r2, r3]
+  str r4, [r0, r3]
+  adds r3, r3, #4
+
+LoopCopyDtcmInit:
+  adds r4, r0, r3
+  cmp r4, r1
+  bcc CopyDtcmInit
+
 /* Zero fill the bss segment. */
   ldr r2, =_sbss
   ldr r4, =_ebss
@@ -0,0 +1,155 @@
+#!/usr/bin/env python3
+"""Turns the SWO report of the blit benchmark into cost tables and regression data.
+
+The blit_benchmark target of makefile_appli builds the application with the blit benchmark
+of BlitBenchmark run at startup, flashes it and saves its SWO trace. This script reads the
+"blit bench" lines of the trace and writes:
+
+  - a CSV file with the cycles of every operation, engine and size, and the setup cost and
+    cost per 64 pixels fitted to them,
+  - the DEFAULT_PIXEL_CYCLES table and setup costs of HybridLCDGPU2D.cpp, from the fills
+    and copies, ready to paste,
+  - with --reference, the operations that got slower or faster than in the CSV file of
+    another build, for instance of the previous TouchGFX release.
+
+Usage:
+  make -f makefile_appli blit_benchmark [blit_reference=<old csv>]
+  blitbench.py --log swo.log [--csv blitbench.csv] [--reference old.csv] [--tolerance 10]
+"""
+
+import argparse
+import csv
+import re
+import sys
+
+BEGIN = re.compile(r"blit bench: sides=([\d,]+)")
+END = re.compile(r"blit bench: done")
+TIME = re.compile(r"blit bench (\w+) (\w+) (\d+)x\d+: cycles=(\d+)")
+FIT = re.compile(r"blit bench (\w+) (\w+): setup=(\d+) per64px=(\d+)")
+
+ENGINES = ("cpu", "dma2d", "gpu2d")
+# The operations HybridLCDGPU2D dispatches by cost, in the order of CostedOperation
+COSTED = (("fill", "COST_FILL"), ("fill_alpha", "COST_FILL_BLEND"), ("copy", "COST_COPY_RGB565"))
+
+
+def read_report(path):
+    """Returns the sides and the results of the last complete report of a trace."""
+    report = None
+    current = None
+    with open(path, errors="replace") as trace:
+        for line in trace:
+            match = BEGIN.search(line)
+            if match:
+                current = {"sides": [int(side) for side in match.group(1).split(",")], "results": {}}
+                continue
+            if current is None:
+                continue
+            match = TIME.search(line)
+            if match:
+                result = current["results"].setdefault((match.group(1), match.group(2)), {"cycles": {}})
+                result["cycles"][int(match.group(3))] = int(match.group(4))
+                continue
+            match = FIT.search(line)
+            if match:
+                result = current["results"].setdefault((match.group(1), match.group(2)), {"cycles": {}})
+                result["setup"] = int(match.group(3))
+                result["per64"] = int(match.group(4))
+                continue
+            if END.search(line):
+                report = current
+                current = None
+    return report
+
+
+def write_csv(report, path):
+    sides = report["sides"]
+    with open(path, "w", newline="") as out:
+        writer = csv.writer(out)
+        writer.writerow(["operation", "engine", "setup_cycles", "cycles_per_64px"] + ["side_%d" % side for side in sides])
+        for (operation, engine), result in report["results"].items():
+            writer.writerow([operation, engine, result.get("setup", ""), result.get("per64", "")]
+                            + [result["cycles"].get(side, "") for side in sides])
+
+
+def read_csv(path):
+    results = {}
+    with open(path, newline="") as table:
+        for row in csv.DictReader(table):
+            for key, value in row.items():
+                if key.startswith("side_") and value:
+                    results[(row["operation"], row["engine"], int(key[len("side_"):]))] = int(value)
+    return results
+
+
+def cost_table(report):
+    """Returns the costed operations as the constants of HybridLCDGPU2D.cpp."""
+    results = report["results"]
+    lines = ["// Cycles per 64 pixels of each operation on the CPU, DMA2D and GPU2D"]
+    lines.append("const uint32_t DEFAULT_PIXEL_CYCLES[touchgfx::HybridLCDGPU2D::NUMBER_OF_COSTED_OPERATIONS]"
+                 "[touchgfx::HybridLCDGPU2D::NUMBER_OF_ENGINES] =")
+    lines.append("{")
+    rows = []
+    for operation, name in COSTED:
+        cells = []
+        for engine in ENGINES:
+            # HybridLCDGPU2D only queues opaque fills on DMA2D, 0 keeps blends off it
+            result = results.get((operation, engine))
+            unused = result is None or (operation == "fill_alpha" and engine == "dma2d")
+            cells.append("0" if unused else str(max(result["per64"], 1)))
+        rows.append("    { %s }" % ", ".join(cells) + "%s  // %s" % ("," if operation != COSTED[-1][0] else "", name))
+    lines.extend(rows)
+    lines.append("};")
+    for engine, constant in (("cpu", "CPU_SETUP_CYCLES"), ("gpu2d", "GPU2D_SETUP_CYCLES")):
+        setups = sorted(results[(operation, engine)]["setup"] for operation, _ in COSTED if (operation, engine) in results)
+        if setups:
+            lines.append("const uint32_t %s = %d;" % (constant, setups[len(setups) // 2]))
+    return "\n".join(lines) + "\n"
+
+
+def compare(report, reference, tolerance):
+    """Prints the times that changed by more than tolerance percent, returns the slower ones."""
+    slower = 0
+    for (operation, engine), result in sorted(report["results"].items()):
+        for side, cycles in sorted(result["cycles"].items()):
+            old = reference.get((operation, engine, side))
+            if not old:
+                continue
+            change = 100.0 * (cycles - old) / old
+            if abs(change) > tolerance:
+                print("%-16s %-5s %3dx%-3d %8d -> %8d cycles  %+6.1f%%" % (operation, engine, side, side, old, cycles, change))
+                if change > 0:
+                    slower += 1
+    return slower
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--log", required=True, help="SWO trace with the blit benchmark report")
+    parser.add_argument("--csv", help="file to write the results to")
+    parser.add_argument("--reference", help="CSV file of another build to compare with")
+    parser.add_argument("--tolerance", type=float, default=10.0,
+                        help="change in percent below which a time is not reported, 10 by default")
+    args = parser.parse_args()
+
+    try:
+        report = read_report(args.log)
+    except OSError as error:
+        sys.stderr.write("%s\n" % error)
+        return 1
+    if report is None:
+        sys.stderr.write("%s has no complete blit benchmark report\n" % args.log)
+        return 1
+
+    if args.csv:
+        write_csv(report, args.csv)
+    sys.stdout.write(cost_table(report))
+    if args.reference:
+        slower = compare(report, read_csv(args.reference), args.tolerance)
+        if slower:
+            sys.stderr.write("%d times slower than %s by more than %.0f%%\n" % (slower, args.reference, args.tolerance))
+            return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
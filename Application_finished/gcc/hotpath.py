@@ -0,0 +1,197 @@
+#!/usr/bin/env python3
+"""Places the hottest code of a profiled build in ITCM and its constants in DTCM.
+
+The firmware built with -DTOUCHGFX_HOTPATH_PROFILE=1 samples the running code from the
+FreeRTOS tick, and TouchGFXHAL::reportHotPath() writes the histogram over SWO. This script
+maps the histogram onto the input sections listed in the linker map file of the same build
+and writes two linker script fragments, included by the .itcm_text and .dtcm_data output
+sections of the linker scripts of the GCC builds:
+
+  hotpath_itcm.ld  the code sections with the most samples per byte that fit in ITCM
+  hotpath_dtcm.ld  the constant sections of the objects of that code that fit in DTCM
+
+The TouchGFX and NemaGFX libraries are built with one section per function, so their
+painters, rasterizer and glyph renderers are placed function by function.
+
+Usage:
+  hotpath.py --map build/bin/application.map --profile swo.log
+"""
+
+import argparse
+import bisect
+import os
+import re
+import sys
+
+ITCM_SIZE = 0x10000
+# Long branch veneers between flash and ITCM are added by the linker
+VENEER_RESERVE = 0x400
+
+FLASH_START = 0x70000000
+FLASH_END = 0x70200000
+
+# Run before the startup has copied the fragments into ITCM and DTCM
+EXCLUDED_OBJECTS = ("startup_", "system_stm32")
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+DEFAULT_OUTPUT_DIRS = (SCRIPT_DIR, os.path.join(SCRIPT_DIR, "..", "STM32CubeIDE", "Appli"))
+
+
+class Section:
+    def __init__(self, name, address, size, origin):
+        self.name = name
+        self.address = address
+        self.size = size
+        self.origin = origin
+        self.samples = 0.0
+
+    def pattern(self):
+        """The input section description selecting only this section."""
+        match = re.match(r"(.*)\((.+)\)$", self.origin)
+        if match:
+            return "*%s:%s(%s)" % (os.path.basename(match.group(1)), match.group(2), self.name)
+        return "*%s(%s)" % (os.path.basename(self.origin), self.name)
+
+    def object_name(self):
+        return os.path.basename(self.origin)
+
+
+def read_map(path):
+    """Returns the allocated input sections of a GNU ld map file, sorted by address."""
+    sections = []
+    in_memory_map = False
+    pending = None
+    with open(path, errors="replace") as lines:
+        for line in lines:
+            line = line.rstrip("\n")
+            if not in_memory_map:
+                in_memory_map = line.startswith("Linker script and memory map")
+                continue
+            if pending is not None:
+                match = re.match(r"^\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*)$", line)
+                if match:
+                    sections.append(Section(pending, int(match.group(1), 16), int(match.group(2), 16), match.group(3).strip()))
+                pending = None
+                continue
+            match = re.match(r"^ (\.\S+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*)$", line)
+            if match:
+                sections.append(Section(match.group(1), int(match.group(2), 16), int(match.group(3), 16), match.group(4).strip()))
+                continue
+            match = re.match(r"^ (\.\S+)$", line)
+            if match:
+                pending = match.group(1)
+    sections = [s for s in sections if s.size > 0]
+    sections.sort(key=lambda s: s.address)
+    return sections
+
+
+def read_profile(path):
+    """Returns the bucket size and the samples per bucket address of one or more reports."""
+    bucket = None
+    buckets = {}
+    with open(path, errors="replace") as lines:
+        for line in lines:
+            match = re.search(r"hot path: bucket=(\d+)", line)
+            if match:
+                if bucket is not None and bucket != int(match.group(1)):
+                    sys.exit("%s: reports with different bucket sizes" % path)
+                bucket = int(match.group(1))
+                continue
+            match = re.search(r"hot path: pc=0x([0-9a-fA-F]+) samples=(\d+)", line)
+            if match:
+                address = int(match.group(1), 16)
+                buckets[address] = buckets.get(address, 0) + int(match.group(2))
+    if bucket is None:
+        sys.exit("%s: no hot path report found" % path)
+    return bucket, buckets
+
+
+def attribute(code, bucket, buckets):
+    """Shares the samples of every bucket between the code sections overlapping it."""
+    starts = [s.address for s in code]
+    for address, samples in buckets.items():
+        end = address + bucket
+        index = max(bisect.bisect_right(starts, address) - 1, 0)
+        while index < len(code) and code[index].address < end:
+            section = code[index]
+            overlap = min(end, section.address + section.size) - max(address, section.address)
+            if overlap > 0:
+                section.samples += samples * overlap / bucket
+            index += 1
+
+
+def select(candidates, budget, key):
+    """Greedily takes the candidates in the order of key until the budget is used."""
+    chosen = []
+    used = 0
+    for section in sorted(candidates, key=key, reverse=True):
+        size = (section.size + 7) & ~7
+        if used + size <= budget:
+            chosen.append(section)
+            used += size
+    return chosen, used
+
+
+def write_fragment(directories, name, profile, sections):
+    text = "/* Generated by hotpath.py from %s, do not edit */\n" % os.path.basename(profile)
+    text += "".join("    %s\n" % s.pattern() for s in sections)
+    for directory in directories:
+        with open(os.path.join(directory, name), "w", newline="\n") as fragment:
+            fragment.write(text)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--map", required=True, help="linker map file of the profiled build")
+    parser.add_argument("--profile", required=True, help="SWO log with the hot path report")
+    parser.add_argument("--itcm-budget", type=int, help="bytes of ITCM to fill, default all that is free")
+    parser.add_argument("--dtcm-budget", type=int, default=2048, help="bytes of DTCM to fill, default 2048")
+    parser.add_argument("--out", action="append", help="directory to write the fragments to, default both GCC builds")
+    args = parser.parse_args()
+
+    sections = read_map(args.map)
+    bucket, buckets = read_profile(args.profile)
+
+    def runs_from_code_memory(s):
+        return s.address < ITCM_SIZE or FLASH_START <= s.address < FLASH_END
+
+    code = [s for s in sections if runs_from_code_memory(s) and (s.name.startswith(".text") or s.name.startswith(".ITCMText"))]
+    attribute(code, bucket, buckets)
+
+    fixed = sum(s.size for s in code if s.name.startswith(".ITCMText"))
+    # The screens share the ITCM after .itcm_text for their overlays, see ScreenOverlay.hpp
+    overlays = {}
+    for s in sections:
+        if s.name.startswith(".OverlayText."):
+            screen = s.name.split(".")[2]
+            overlays[screen] = overlays.get(screen, 0) + s.size
+    fixed += max(overlays.values()) if overlays else 0
+    itcm_budget = args.itcm_budget if args.itcm_budget is not None else ITCM_SIZE - VENEER_RESERVE - fixed
+    candidates = [s for s in code
+                  if s.name.startswith(".text") and s.samples > 0
+                  and not any(s.object_name().startswith(e) for e in EXCLUDED_OBJECTS)]
+    itcm, itcm_used = select(candidates, itcm_budget, lambda s: s.samples / s.size)
+
+    # Constants go with the objects of the placed code, the hottest object first
+    hotness = {}
+    for section in itcm:
+        hotness[section.origin] = hotness.get(section.origin, 0.0) + section.samples
+    constants = [s for s in sections
+                 if s.origin in hotness and s.name.startswith(".rodata") and FLASH_START <= s.address < FLASH_END]
+    dtcm, dtcm_used = select(constants, args.dtcm_budget, lambda s: (hotness[s.origin], -s.size))
+
+    directories = args.out if args.out else DEFAULT_OUTPUT_DIRS
+    write_fragment(directories, "hotpath_itcm.ld", args.profile, itcm)
+    write_fragment(directories, "hotpath_dtcm.ld", args.profile, dtcm)
+
+    total = sum(buckets.values())
+    covered = sum(s.samples for s in itcm)
+    print("ITCM: %d sections, %d of %d bytes, %.1f%% of %d samples"
+          % (len(itcm), itcm_used, itcm_budget, 100.0 * covered / total if total else 0.0, total))
+    print("DTCM: %d sections, %d of %d bytes" % (len(dtcm), dtcm_used, args.dtcm_budget))
+    for section in sorted(itcm, key=lambda s: s.samples, reverse=True)[:20]:
+        print("  %6.0f %6d %s" % (section.samples, section.size, section.name))
+
+
+if __name__ == "__main__":
+    main()
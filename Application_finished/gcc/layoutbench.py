@@ -0,0 +1,106 @@
+#!/usr/bin/env python3
+"""Compares the renderer benchmark of the application built for several memory layouts.
+
+The benchmark_layouts target of makefile_appli builds the application once per app linker
+script, STM32H7S7L8HXH_<layout>_app.ld, with the renderer benchmark of FrameBenchmark
+started at boot and repeated, flashes it and saves the SWO trace of every layout. This
+script reads the traces and writes one report: for every layout and backend, the frame
+rate the render time allows, the average and p99 render time and the MCU load, as the
+median of the complete benchmark runs in the trace.
+
+Usage:
+  make -f makefile_appli benchmark_layouts
+  layoutbench.py --log RAMxspi1_ROMxspi2=swo.log [--log <layout>=<trace> ...] [--out report.md]
+"""
+
+import argparse
+import re
+import statistics
+import sys
+
+RUN_BEGIN = re.compile(r"benchmark: (\d+) frames per backend")
+RUN_END = re.compile(r"benchmark: done")
+RESULT = re.compile(r"benchmark (\S+): frames=(\d+) min=(\d+)us avg=(\d+)us p99=(\d+)us max=(\d+)us "
+                    r"mcu=(\d+)% gpu_wait=(\d+)us")
+
+
+def read_runs(path):
+    """Returns the complete runs of a trace, each a dict of backend to its result."""
+    runs = []
+    current = None
+    try:
+        with open(path, errors="replace") as trace:
+            for line in trace:
+                if RUN_BEGIN.search(line):
+                    current = {}
+                    continue
+                match = RESULT.search(line)
+                if match and current is not None:
+                    current[match.group(1)] = {
+                        "avg": int(match.group(4)),
+                        "p99": int(match.group(5)),
+                        "mcu": int(match.group(7)),
+                        "gpu_wait": int(match.group(8)),
+                    }
+                    continue
+                if RUN_END.search(line) and current:
+                    runs.append(current)
+                    current = None
+    except OSError:
+        pass
+    return runs
+
+
+def summarize(runs):
+    """Returns the median result of every backend over the runs."""
+    backends = {}
+    for run in runs:
+        for backend, result in run.items():
+            backends.setdefault(backend, []).append(result)
+    summary = {}
+    for backend, results in backends.items():
+        summary[backend] = dict((key, statistics.median(r[key] for r in results)) for key in results[0])
+    return summary
+
+
+def report(layouts):
+    lines = ["| Layout | Backend | Runs | fps | avg (us) | p99 (us) | MCU (%) | GPU wait (us) |",
+             "|---|---|---:|---:|---:|---:|---:|---:|"]
+    for layout, runs in layouts:
+        summary = summarize(runs)
+        if not summary:
+            lines.append("| %s | - | 0 | - | - | - | - | - |" % layout)
+            continue
+        for backend in sorted(summary):
+            result = summary[backend]
+            fps = 1000000.0 / result["avg"] if result["avg"] > 0 else 0.0
+            lines.append("| %s | %s | %d | %.1f | %.0f | %.0f | %.0f | %.0f |"
+                         % (layout, backend, len(runs), fps, result["avg"], result["p99"], result["mcu"], result["gpu_wait"]))
+    return "\n".join(lines) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--log", action="append", required=True, metavar="LAYOUT=TRACE",
+                        help="SWO trace of the benchmark of a layout")
+    parser.add_argument("--out", help="file to write the report to, as well as the console")
+    args = parser.parse_args()
+
+    layouts = []
+    for entry in args.log:
+        layout, _, path = entry.partition("=")
+        if not path:
+            parser.error("--log takes LAYOUT=TRACE, not %s" % entry)
+        layouts.append((layout, read_runs(path)))
+
+    text = report(layouts)
+    sys.stdout.write(text)
+    if args.out:
+        with open(args.out, "w") as out:
+            out.write(text)
+    # Layouts without a complete run failed to build, flash or start
+    return 0 if all(runs for _, runs in layouts) else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,89 @@
+#!/usr/bin/env python3
+"""Builds a block delta patch of the assets of the application in the NOR flash.
+
+The images, fonts and texts of the application are linked in FLASH_GFX, in the sections
+ExtFlashSection, FontFlashSection and TextFlashSection. This script compares these
+sections in the application flashed and in the new one, 4 KB block by 4 KB block, the
+smallest erase of the NOR flash, and writes a patch with the new content of the blocks
+which differ. Bytes out of the sections are taken as erased.
+
+The application stages the patch in the PSRAM with touchgfx::AssetUpdate and resets, the
+boot loader applies it, see Boot/Core/Inc/asset_update.h for the format. Only the assets
+are patched: the code of the new application must be the code flashed, or its bitmap and
+font tables would not match the assets any more.
+
+Usage:
+  mkassetpatch.py --old flashed/target.elf --new build/bin/target.elf --output assets.patch
+"""
+
+import argparse
+import struct
+import sys
+import zlib
+
+MAGIC = 0x54415041  # "APAT"
+BLOCK_SIZE = 4096
+REGION_START = 0x70200000
+REGION_END = 0x78000000
+STAGING_SIZE = 0x00200000
+HEADER_SIZE = 16
+SECTIONS = (b"ExtFlashSection", b"FontFlashSection", b"TextFlashSection")
+
+
+def read_assets(path):
+    """Returns the blocks of the asset sections of an ELF file, by address."""
+    with open(path, "rb") as elf:
+        data = elf.read()
+    if data[:4] != b"\x7fELF" or data[4] != 1 or data[5] != 1:
+        sys.exit("%s: not a 32-bit little endian ELF file" % path)
+    shoff, = struct.unpack_from("<I", data, 0x20)
+    shentsize, shnum, shstrndx = struct.unpack_from("<HHH", data, 0x2E)
+    headers = [struct.unpack_from("<IIIIIIIIII", data, shoff + index * shentsize) for index in range(shnum)]
+    names = headers[shstrndx][4]
+
+    blocks = {}
+    for name, kind, _, addr, offset, size, _, _, _, _ in headers:
+        label = data[names + name:data.index(b"\0", names + name)]
+        if label not in SECTIONS or kind == 8 or size == 0:
+            continue
+        if addr < REGION_START or addr + size > REGION_END:
+            sys.exit("%s: %s is out of FLASH_GFX" % (path, label.decode()))
+        content = data[offset:offset + size]
+        for address in range(addr - addr % BLOCK_SIZE, addr + size, BLOCK_SIZE):
+            block = blocks.setdefault(address, bytearray(b"\xff" * BLOCK_SIZE))
+            start = max(address, addr)
+            end = min(address + BLOCK_SIZE, addr + size)
+            block[start - address:end - address] = content[start - addr:end - addr]
+    return blocks
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("--old", required=True, help="application flashed, ELF")
+    parser.add_argument("--new", required=True, help="new application, ELF")
+    parser.add_argument("--output", required=True, help="patch to write")
+    args = parser.parse_args()
+
+    old = read_assets(args.old)
+    new = read_assets(args.new)
+    erased = b"\xff" * BLOCK_SIZE
+    changed = [address for address in sorted(new) if bytes(new[address]) != bytes(old.get(address, erased))]
+    if not changed:
+        sys.exit("%s: the assets are the same, no patch written" % args.output)
+
+    payload = b"".join(struct.pack("<I", address) + bytes(new[address]) for address in changed)
+    if HEADER_SIZE + len(payload) > STAGING_SIZE:
+        sys.exit("%s: %d blocks changed, more than the %d KB of the staging area, split the update"
+                 % (args.output, len(changed), STAGING_SIZE // 1024))
+
+    fields = struct.pack("<III", MAGIC, len(changed), zlib.crc32(payload))
+    with open(args.output, "wb") as patch:
+        patch.write(fields + struct.pack("<I", zlib.crc32(fields)) + payload)
+
+    programmed = sum(1 for address in changed if address not in old)
+    print("%s: %d of %d blocks changed, %d in flash never written, %d bytes"
+          % (args.output, len(changed), len(new), programmed, HEADER_SIZE + len(payload)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,161 @@
+#!/usr/bin/env python3
+"""Bakes the static layers at the bottom of every screen into one background bitmap.
+
+Every area TouchGFX invalidates is drawn back to front, so the background Box and the full
+screen images of a screen are drawn again below whatever changed. This script takes, for
+each screen of the TouchGFX project, the run of Box and Image widgets from the bottom of
+the screen up to the first other widget, stopping at a widget that an interaction acts on
+or triggers, that has a mixin, or that is named with --keep, as those change at runtime.
+The widgets of the run are composed, with their alpha, into an opaque PNG of the size of
+the display, assets/images/baked/<screen>.png, which the image converter turns into
+BITMAP_BAKED_<SCREEN>_ID. The generated gui/<screen>_screen/<Screen>Baked.hpp names the
+bitmap and the widgets, for BakedBackground::bake():
+
+  touchgfx::Drawable* const layers[] = { SCREEN1_BAKED_LAYERS };
+  baked.bake(container, touchgfx::Bitmap(SCREEN1_BAKED_BITMAP), layers, sizeof(layers) / sizeof(layers[0]));
+
+A screen is only baked when its run has more than one widget. The designer puts a black
+full screen Box, __background, at the bottom of every screen. Images must be 8-bit RGB or
+RGBA PNGs without interlacing.
+
+Usage:
+  mkbake.py [--project ../Appli/TouchGFX/MyApplication_11.touchgfx] [--keep Screen1.image2]
+"""
+
+import argparse
+import json
+import os
+import struct
+import zlib
+
+from mksplash import read_png
+
+BAKED_TYPES = ("Box", "Image")
+
+
+def write_png(path, width, height, rgb):
+    """Writes 8-bit RGB pixels, row by row, as a PNG."""
+    def chunk(kind, data):
+        return struct.pack(">I", len(data)) + kind + data + struct.pack(">I", zlib.crc32(kind + data) & 0xFFFFFFFF)
+    raw = bytearray()
+    for y in range(height):
+        raw.append(0)
+        raw += rgb[y * width * 3:(y + 1) * width * 3]
+    with open(path, "wb") as png:
+        png.write(b"\x89PNG\r\n\x1a\n")
+        png.write(chunk(b"IHDR", struct.pack(">IIBBBBB", width, height, 8, 2, 0, 0, 0)))
+        png.write(chunk(b"IDAT", zlib.compress(bytes(raw), 9)))
+        png.write(chunk(b"IEND", b""))
+
+
+def changed_widgets(screen):
+    """Returns the names of the widgets the interactions of a screen act on or are triggered by."""
+    names = set()
+    for interaction in screen.get("Interactions", []):
+        for part in (interaction.get("Trigger", {}), interaction.get("Action", {})):
+            for key, value in part.items():
+                if key.endswith("Component") and isinstance(value, str):
+                    names.add(value)
+    return names
+
+
+def static_layers(screen, width, height, keep):
+    """Returns the widgets at the bottom of a screen that never change, bottom first."""
+    changed = changed_widgets(screen) | keep
+    layers = [{"Type": "Box", "Name": "__background", "Width": width, "Height": height}]
+    if "__background" in changed:
+        return []
+    for widget in screen.get("Components", []):
+        if widget.get("Type") not in BAKED_TYPES or widget.get("Name") in changed or widget.get("Mixins"):
+            break
+        layers.append(widget)
+    return layers
+
+
+def compose(layers, width, height, images):
+    """Returns the RGB pixels of the layers drawn on black, bottom first."""
+    rgb = bytearray(width * height * 3)
+    for widget in layers:
+        if widget.get("Visible", True) is False:
+            continue
+        alpha = widget.get("Alpha", 255)
+        left = widget.get("X", 0)
+        top = widget.get("Y", 0)
+        if widget["Type"] == "Box":
+            color = widget.get("Color", {})
+            source = (color.get("Red", 0), color.get("Green", 0), color.get("Blue", 0), 255)
+            w, h = widget.get("Width", 0), widget.get("Height", 0)
+            pixel = lambda x, y: source
+        else:
+            if "RelativeFilename" not in widget:
+                continue
+            path = os.path.join(images, *widget["RelativeFilename"].replace("\\", "/").split("/"))
+            w, h, pixels = read_png(path)
+            pixel = lambda x, y: pixels[y * w + x]
+        for y in range(max(top, 0), min(top + h, height)):
+            for x in range(max(left, 0), min(left + w, width)):
+                r, g, b, a = pixel(x - left, y - top)
+                a = a * alpha // 255
+                offset = (y * width + x) * 3
+                for c, value in enumerate((r, g, b)):
+                    rgb[offset + c] = (value * a + rgb[offset + c] * (255 - a) + 127) // 255
+    return rgb
+
+
+def write_header(path, screen, layers, project):
+    upper = screen.upper()
+    guard = "%sBAKED_HPP" % upper
+    lines = []
+    lines.append("// Written by gcc/mkbake.py from %s, do not edit" % os.path.basename(project))
+    lines.append("#ifndef %s" % guard)
+    lines.append("#define %s" % guard)
+    lines.append("")
+    lines.append("#include <images/BitmapDatabase.hpp>")
+    lines.append("")
+    lines.append("/** The widgets of %sViewBase composed into %s_BAKED_BITMAP, bottom first. */" % (screen, upper))
+    lines.append("#define %s_BAKED_LAYERS %s" % (upper, ", ".join("&" + widget["Name"] for widget in layers)))
+    lines.append("")
+    lines.append("/** The baked bitmap. */")
+    lines.append("#define %s_BAKED_BITMAP BITMAP_BAKED_%s_ID" % (upper, upper))
+    lines.append("")
+    lines.append("#endif // %s" % guard)
+    lines.append("")
+    with open(path, "w", newline="\n") as output:
+        output.write("\n".join(lines))
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    touchgfx = os.path.join(here, "..", "Appli", "TouchGFX")
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--project", default=os.path.join(touchgfx, "MyApplication_11.touchgfx"),
+                        help="TouchGFX project, default Appli/TouchGFX/MyApplication_11.touchgfx")
+    parser.add_argument("--keep", action="append", default=[],
+                        help="Screen.widget changed by user code, left out with the widgets above it")
+    args = parser.parse_args()
+
+    with open(args.project, encoding="utf-8-sig") as project:
+        application = json.load(project)["Application"]
+    root = os.path.dirname(os.path.abspath(args.project))
+    images = os.path.join(root, "assets", "images")
+    width = application["Resolution"]["Width"]
+    height = application["Resolution"]["Height"]
+
+    for screen in application["Screens"]:
+        name = screen["Name"]
+        keep = set(item.split(".", 1)[1] for item in args.keep if item.split(".", 1)[0] == name)
+        layers = static_layers(screen, width, height, keep)
+        if len(layers) < 2:
+            print("%s: nothing to bake" % name)
+            continue
+        rgb = compose(layers, width, height, images)
+        os.makedirs(os.path.join(images, "baked"), exist_ok=True)
+        png = os.path.join(images, "baked", name.lower() + ".png")
+        write_png(png, width, height, rgb)
+        header = os.path.join(root, "gui", "include", "gui", name.lower() + "_screen", name + "Baked.hpp")
+        write_header(header, name, layers, args.project)
+        print("%s: %s baked into %s" % (name, ", ".join(widget["Name"] for widget in layers), png))
+
+
+if __name__ == "__main__":
+    main()
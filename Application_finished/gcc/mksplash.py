@@ -0,0 +1,189 @@
+#!/usr/bin/env python3
+"""Converts an image into the splash the boot loader shows while the application starts.
+
+The boot loader scans the splash out of its internal flash with LTDC, before the external
+memories are mapped. The 64 KB of that flash only leave room for a logo, not for a whole
+frame, so the frame is composed by LTDC: the image is centered on the display, in a layer
+window, and the background color of LTDC fills the rest. The image is stored as L8, 8-bit
+indexes into a palette of up to 256 colors, which LTDC expands through its CLUT. The alpha
+of the image is blended on the background color here, as the CLUT has no alpha.
+
+This script reads a PNG, 8-bit RGB or RGBA and not interlaced, reduces its colors to the
+palette and writes Boot/Core/Src/splash_image.c.
+
+Usage:
+  mksplash.py --image logo.png --background 000000 [--output ../Boot/Core/Src/splash_image.c]
+"""
+
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+MAX_PIXELS = 40 * 1024
+
+
+def read_png(path):
+    """Returns the width, the height and the RGBA pixels of an 8-bit PNG, row by row."""
+    with open(path, "rb") as png:
+        data = png.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        sys.exit("%s: not a PNG" % path)
+    offset = 8
+    idat = b""
+    width = height = depth = color = interlace = None
+    while offset < len(data):
+        length, kind = struct.unpack(">I4s", data[offset:offset + 8])
+        chunk = data[offset + 8:offset + 8 + length]
+        offset += 12 + length
+        if kind == b"IHDR":
+            width, height, depth, color, _, _, interlace = struct.unpack(">IIBBBBB", chunk)
+        elif kind == b"IDAT":
+            idat += chunk
+        elif kind == b"IEND":
+            break
+    if depth != 8 or color not in (2, 6) or interlace != 0:
+        sys.exit("%s: only 8-bit RGB and RGBA PNGs without interlacing are read" % path)
+    channels = 4 if color == 6 else 3
+    raw = zlib.decompress(idat)
+    stride = width * channels
+    rows = []
+    previous = bytearray(stride)
+    for y in range(height):
+        start = y * (stride + 1)
+        kind = raw[start]
+        row = bytearray(raw[start + 1:start + 1 + stride])
+        for x in range(stride):
+            a = row[x - channels] if x >= channels else 0
+            b = previous[x]
+            c = previous[x - channels] if x >= channels else 0
+            if kind == 1:
+                row[x] = (row[x] + a) & 0xFF
+            elif kind == 2:
+                row[x] = (row[x] + b) & 0xFF
+            elif kind == 3:
+                row[x] = (row[x] + ((a + b) >> 1)) & 0xFF
+            elif kind == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                predictor = a if pa <= pb and pa <= pc else (b if pb <= pc else c)
+                row[x] = (row[x] + predictor) & 0xFF
+        rows.append(row)
+        previous = row
+    pixels = []
+    for row in rows:
+        for x in range(width):
+            pixel = row[x * channels:(x + 1) * channels]
+            pixels.append(tuple(pixel) if channels == 4 else tuple(pixel) + (255,))
+    return width, height, pixels
+
+
+def blend(pixels, background):
+    """Returns the RGB pixels of the image drawn on the background color."""
+    result = []
+    for r, g, b, a in pixels:
+        result.append(tuple((c * a + k * (255 - a) + 127) // 255 for c, k in zip((r, g, b), background)))
+    return result
+
+
+def median_cut(colors, size):
+    """Returns a palette of at most size colors for the {color: count} of the image."""
+    boxes = [list(colors.items())]
+    while len(boxes) < size:
+        # Split the box with the widest range of one channel, weighted by its pixels
+        best = None
+        for index, box in enumerate(boxes):
+            if len(box) < 2:
+                continue
+            for channel in range(3):
+                values = [color[channel] for color, _ in box]
+                extent = (max(values) - min(values)) * sum(count for _, count in box)
+                if best is None or extent > best[0]:
+                    best = (extent, index, channel)
+        if best is None or best[0] == 0:
+            break
+        _, index, channel = best
+        box = sorted(boxes.pop(index), key=lambda item: item[0][channel])
+        half = sum(count for _, count in box) / 2.0
+        total = 0
+        split = 1
+        for split in range(1, len(box)):
+            total += box[split - 1][1]
+            if total >= half:
+                break
+        boxes.append(box[:split])
+        boxes.append(box[split:])
+    palette = []
+    for box in boxes:
+        total = sum(count for _, count in box)
+        palette.append(tuple(int(round(sum(color[c] * count for color, count in box) / float(total))) for c in range(3)))
+    return palette
+
+
+def nearest(palette, color):
+    return min(range(len(palette)), key=lambda i: sum((p - c) * (p - c) for p, c in zip(palette[i], color)))
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--image", required=True, help="PNG of the splash")
+    parser.add_argument("--background", default="000000", help="RGB888 hex color around the image, default 000000")
+    parser.add_argument("--output", default=os.path.join(here, "..", "Boot", "Core", "Src", "splash_image.c"),
+                        help="C file written, default Boot/Core/Src/splash_image.c")
+    args = parser.parse_args()
+
+    background = int(args.background, 16)
+    width, height, pixels = read_png(args.image)
+    if width * height > MAX_PIXELS:
+        sys.exit("%s: %dx%d is more than the %d pixels that fit in the boot loader flash"
+                 % (args.image, width, height, MAX_PIXELS))
+    rgb = blend(pixels, ((background >> 16) & 0xFF, (background >> 8) & 0xFF, background & 0xFF))
+
+    colors = {}
+    for color in rgb:
+        colors[color] = colors.get(color, 0) + 1
+    palette = median_cut(colors, 256)
+    indexes = {}
+    for color in colors:
+        indexes[color] = nearest(palette, color)
+
+    lines = []
+    lines.append("/* USER CODE BEGIN Header */")
+    lines.append("/**")
+    lines.append("  ******************************************************************************")
+    lines.append("  * @file           : splash_image.c")
+    lines.append("  * @brief          : Splash shown by the boot loader, written by gcc/mksplash.py")
+    lines.append("  *                   from %s" % os.path.basename(args.image))
+    lines.append("  ******************************************************************************")
+    lines.append("  */")
+    lines.append("/* USER CODE END Header */")
+    lines.append("")
+    lines.append("#include \"splash.h\"")
+    lines.append("")
+    lines.append("static const uint32_t splash_clut[%d] =" % len(palette))
+    lines.append("{")
+    for i in range(0, len(palette), 8):
+        lines.append("  " + ", ".join("0x%06XU" % ((r << 16) | (g << 8) | b) for r, g, b in palette[i:i + 8]) + ",")
+    lines.append("};")
+    lines.append("")
+    lines.append("static const uint8_t splash_pixels[%d] =" % (width * height))
+    lines.append("{")
+    data = [indexes[color] for color in rgb]
+    for i in range(0, len(data), 16):
+        lines.append("  " + ", ".join("0x%02X" % v for v in data[i:i + 16]) + ",")
+    lines.append("};")
+    lines.append("")
+    lines.append("const SPLASH_ImageTypeDef SPLASH_Image =")
+    lines.append("{")
+    lines.append("  %dU, %dU, 0x%06XU, %dU, splash_clut, splash_pixels" % (width, height, background, len(palette)))
+    lines.append("};")
+    lines.append("")
+    with open(args.output, "w", newline="\n") as output:
+        output.write("\n".join(lines))
+    print("%s: %dx%d, %d colors" % (args.output, width, height, len(palette)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,154 @@
+#!/usr/bin/env python3
+"""Stores SVGs precompiled to TSVG in the external flash, for TSVGImage.
+
+The imageconverter of TouchGFX stores SVGs as VGData, the commands and points of their
+paths, which SVGImage turns into NemaVG paths and paints every time it is drawn. NemaVG
+also draws its own precompiled format, TSVG, with a single nema_vg_draw_tsvg() that reads
+the paths, paints and gradients from the blob. This script takes the .tsvg files written
+by the TSVG converter of NemaVG and stores them as arrays in ExtFlashSection, which the
+linker scripts place in FLASH_GFX with the images, aligned as GPU2D reads them.
+
+Every file becomes an entry of TSVGDatabase, TSVG_<NAME> in the TSVGImages enum, in the
+order of the file names. The size of an image is read from the width and height, or the
+viewBox, of the .svg next to the .tsvg when there is one, and is 0 otherwise.
+
+Usage:
+  mktsvg.py [--input ../Appli/TouchGFX/assets/tsvg] [--header ...] [--source ...]
+"""
+
+import argparse
+import os
+import re
+import sys
+import xml.etree.ElementTree as ElementTree
+
+
+def identifier(name):
+    """Returns the C identifier of a file name, upper case for the enum."""
+    return re.sub(r"[^0-9A-Za-z]", "_", os.path.splitext(name)[0]).upper()
+
+
+def svg_size(path):
+    """Returns the width and height of an SVG, rounded up, or 0, 0 if not known."""
+    if not os.path.exists(path):
+        return 0, 0
+    root = ElementTree.parse(path).getroot()
+    width = root.get("width")
+    height = root.get("height")
+    if width is not None and height is not None and "%" not in width + height:
+        number = re.compile(r"[0-9.]+")
+        return int(-(-float(number.match(width).group(0)) // 1)), int(-(-float(number.match(height).group(0)) // 1))
+    box = root.get("viewBox")
+    if box is not None:
+        values = [float(v) for v in re.split(r"[ ,]+", box.strip())]
+        if len(values) == 4:
+            return int(-(-values[2] // 1)), int(-(-values[3] // 1))
+    return 0, 0
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    gui = os.path.join(here, "..", "Appli", "TouchGFX", "gui")
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--input", default=os.path.join(here, "..", "Appli", "TouchGFX", "assets", "tsvg"),
+                        help="directory of the .tsvg files, default Appli/TouchGFX/assets/tsvg")
+    parser.add_argument("--header", default=os.path.join(gui, "include", "gui", "common", "TSVGDatabase.hpp"),
+                        help="header written, default gui/include/gui/common/TSVGDatabase.hpp")
+    parser.add_argument("--source", default=os.path.join(gui, "src", "common", "TSVGDatabase.cpp"),
+                        help="source written, default gui/src/common/TSVGDatabase.cpp")
+    args = parser.parse_args()
+
+    names = []
+    if os.path.isdir(args.input):
+        names = sorted(name for name in os.listdir(args.input) if name.lower().endswith(".tsvg"))
+    images = []
+    for name in names:
+        with open(os.path.join(args.input, name), "rb") as tsvg:
+            data = tsvg.read()
+        if len(data) == 0:
+            sys.exit("%s: empty" % name)
+        width, height = svg_size(os.path.join(args.input, os.path.splitext(name)[0] + ".svg"))
+        images.append((identifier(name), data, width, height))
+
+    lines = []
+    lines.append("// Generated by gcc/mktsvg.py. Please, do not edit!")
+    lines.append("")
+    lines.append("#ifndef TSVGDATABASE_HPP")
+    lines.append("#define TSVGDATABASE_HPP")
+    lines.append("")
+    lines.append("#include <touchgfx/hal/Types.hpp>")
+    lines.append("")
+    lines.append("enum TSVGImages")
+    lines.append("{")
+    for index, (ident, _, _, _) in enumerate(images):
+        lines.append("    TSVG_%s = %d," % (ident, index))
+    lines.append("    NUMBER_OF_TSVG_IMAGES = %d" % len(images))
+    lines.append("};")
+    lines.append("")
+    lines.append("namespace TSVGDatabase")
+    lines.append("{")
+    lines.append("/** A TSVG blob, and the size of the SVG it was compiled from. */")
+    lines.append("struct TSVGData")
+    lines.append("{")
+    lines.append("    const uint8_t* data;")
+    lines.append("    uint32_t size;   ///< Bytes of the blob")
+    lines.append("    uint16_t width;  ///< Width of the SVG, 0 if not known")
+    lines.append("    uint16_t height; ///< Height of the SVG, 0 if not known")
+    lines.append("};")
+    lines.append("")
+    lines.append("const TSVGData* getInstance();")
+    lines.append("uint16_t getInstanceSize();")
+    lines.append("} // namespace TSVGDatabase")
+    lines.append("")
+    lines.append("#endif // TSVGDATABASE_HPP")
+    lines.append("")
+    with open(args.header, "w", newline="\n") as output:
+        output.write("\n".join(lines))
+
+    lines = []
+    lines.append("// Generated by gcc/mktsvg.py. Please, do not edit!")
+    lines.append("")
+    lines.append("#include <gui/common/TSVGDatabase.hpp>")
+    lines.append("#include <touchgfx/hal/Config.hpp>")
+    lines.append("")
+    for ident, data, width, height in images:
+        lines.append("LOCATION_PRAGMA_32(\"ExtFlashSection\")")
+        lines.append("KEEP extern const uint8_t tsvg_%s[] LOCATION_ATTRIBUTE_32(\"ExtFlashSection\") = // %dx%d"
+                     % (ident.lower(), width, height))
+        lines.append("{")
+        for i in range(0, len(data), 12):
+            lines.append("    " + ", ".join("0x%02x" % v for v in data[i:i + 12]) + ",")
+        lines.append("};")
+        lines.append("")
+    lines.append("namespace")
+    lines.append("{")
+    if images:
+        lines.append("const TSVGDatabase::TSVGData tsvgDatabase[] =")
+        lines.append("{")
+        for ident, data, width, height in images:
+            lines.append("    { tsvg_%s, %d, %d, %d }," % (ident.lower(), len(data), width, height))
+        lines.append("};")
+    else:
+        lines.append("const TSVGDatabase::TSVGData tsvgDatabase[] = { { 0, 0, 0, 0 } };")
+    lines.append("} // namespace")
+    lines.append("")
+    lines.append("namespace TSVGDatabase")
+    lines.append("{")
+    lines.append("const TSVGData* getInstance()")
+    lines.append("{")
+    lines.append("    return tsvgDatabase;")
+    lines.append("}")
+    lines.append("")
+    lines.append("uint16_t getInstanceSize()")
+    lines.append("{")
+    lines.append("    return NUMBER_OF_TSVG_IMAGES;")
+    lines.append("}")
+    lines.append("} // namespace TSVGDatabase")
+    lines.append("")
+    with open(args.source, "w", newline="\n") as output:
+        output.write("\n".join(lines))
+    print("%s: %d images, %d bytes" % (args.source, len(images), sum(len(data) for _, data, _, _ in images)))
+
+
+if __name__ == "__main__":
+    main()
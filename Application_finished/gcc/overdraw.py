@@ -0,0 +1,143 @@
+#!/usr/bin/env python3
+"""Draws heatmaps of the overdraw and invalidations streamed by OverdrawHeatmap.
+
+With TOUCHGFX_OVERDRAW_HEATMAP set to 2, or the heatmap set to MODE_STREAM, the firmware
+writes, for every frame drawn while the debugger enables ITM stimulus port 3, how many times
+each tile of the display was written, in sixteenths of the tile, and how many flushed areas
+covered it. This script reads the raw payload of that port, as saved by the SWO viewer of the
+debugger, averages the tiles over the frames and writes:
+
+  <prefix>overdraw.png, the average overdraw of every tile over the frames, dark up to once,
+                        then blue, green, orange and red up to two, three, four and more times
+  <prefix>invalidation.png, how often every tile was flushed, from black for never to white
+                        for every frame
+
+and prints the tiles written the most times, where stacked backgrounds and widgets hidden
+behind others are drawn for nothing.
+
+Usage:
+  overdraw.py --trace swo_port3.bin --out overdraw/screen1_ --top 10
+"""
+
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+STREAM_BEGIN = 0xFFFF0000
+FRAME_BEGIN = 0xFFFF0001
+FRAME_END = 0xFFFF0002
+
+# Overdraw in sixteenths up to which each color is used, and the color above the last, as on
+# the overlay layer
+LEVELS = (16, 32, 48, 64)
+COLORS = ((40, 40, 40), (0, 64, 255), (0, 192, 64), (255, 128, 0), (255, 0, 0))
+
+
+def write_png(path, width, height, pixels):
+    raw = bytearray()
+    for y in range(height):
+        raw.append(0)
+        for pixel in pixels[y * width:(y + 1) * width]:
+            raw += bytes(pixel)
+
+    def chunk(kind, data):
+        return struct.pack(">I", len(data)) + kind + data + struct.pack(">I", zlib.crc32(kind + data) & 0xFFFFFFFF)
+
+    with open(path, "wb") as png:
+        png.write(b"\x89PNG\r\n\x1a\n")
+        png.write(chunk(b"IHDR", struct.pack(">IIBBBBB", width, height, 8, 2, 0, 0, 0)))
+        png.write(chunk(b"IDAT", zlib.compress(bytes(raw), 6)))
+        png.write(chunk(b"IEND", b""))
+
+
+def scaled(columns, rows, tile, colors):
+    """Returns the pixels of the screen with every tile in its color."""
+    pixels = []
+    for row in range(rows):
+        line = []
+        for column in range(columns):
+            line.extend([colors[row * columns + column]] * tile)
+        pixels.extend(line * tile)
+    return pixels
+
+
+def overdraw_color(level):
+    for index, limit in enumerate(LEVELS):
+        if level <= limit:
+            return COLORS[index]
+    return COLORS[-1]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--trace", required=True, help="raw payload of ITM stimulus port 3")
+    parser.add_argument("--out", default="", help="prefix of the files written, default none")
+    parser.add_argument("--top", type=int, default=10, help="tiles written the most times to print, default 10")
+    args = parser.parse_args()
+
+    with open(args.trace, "rb") as trace:
+        data = trace.read()
+    words = struct.unpack("<%dI" % (len(data) // 4), data[:len(data) // 4 * 4])
+
+    directory = os.path.dirname(args.out)
+    if directory:
+        os.makedirs(directory, exist_ok=True)
+
+    columns = rows = tile = 0
+    levels = flushes = peaks = None
+    frames = 0
+    frame = None
+    i = 0
+    try:
+        while i < len(words):
+            word = words[i]
+            i += 1
+            if word == STREAM_BEGIN:
+                columns, rows = words[i] >> 16, words[i] & 0xFFFF
+                tile = words[i + 1]
+                i += 2
+                levels = [0] * (columns * rows)
+                flushes = [0] * (columns * rows)
+                peaks = [0] * (columns * rows)
+                frames = 0
+                frame = None
+            elif word == FRAME_BEGIN and levels is not None:
+                frame = words[i]
+                i += 1
+            elif word == FRAME_END and frame is not None:
+                frames += 1
+                frame = None
+            elif frame is not None and (word >> 16) < columns * rows:
+                index = word >> 16
+                level = word & 0xFF
+                levels[index] += level
+                flushes[index] += 1 if (word >> 8) & 0xFF else 0
+                peaks[index] = max(peaks[index], level)
+    except IndexError as error:
+        print("%s: stream ends or is corrupt at word %d: %s" % (args.trace, i, error), file=sys.stderr)
+
+    if not frames:
+        sys.exit("%s: no frame, was STREAM_BEGIN recorded?" % args.trace)
+
+    width, height = columns * tile, rows * tile
+    average = [level / frames for level in levels]
+    write_png("%soverdraw.png" % args.out, width, height, scaled(columns, rows, tile, [overdraw_color(level) for level in average]))
+    write_png("%sinvalidation.png" % args.out, width, height,
+              scaled(columns, rows, tile, [(255 * count // frames,) * 3 for count in flushes]))
+
+    drawn = [level for level in average if level > 0]
+    print("%d frames of %dx%d tiles of %d pixels, average overdraw %.2f where drawn"
+          % (frames, columns, rows, tile, sum(drawn) / len(drawn) / 16 if drawn else 0))
+    print("%10s %9s %7s %9s" % ("tile", "average", "worst", "flushed"))
+    hotspots = sorted(range(columns * rows), key=lambda index: average[index], reverse=True)
+    for index in hotspots[:args.top]:
+        if average[index] == 0:
+            break
+        print("%4d,%-5d %9.2f %7.2f %8d%%" % ((index % columns) * tile, (index // columns) * tile,
+                                              average[index] / 16, peaks[index] / 16, 100 * flushes[index] // frames))
+
+
+if __name__ == "__main__":
+    main()
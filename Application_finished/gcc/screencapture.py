@@ -0,0 +1,145 @@
+#!/usr/bin/env python3
+"""Rebuilds the frames shown on the display from the stream of ScreenCapture.
+
+The firmware writes the areas of the screen drawn since its last capture, run-length encoded,
+to ITM stimulus port 2 once the debugger enables the port, at most every 100 ms. This script
+reads the raw payload of that port, as saved by the SWO viewer of the debugger, applies the
+areas to an image of the screen and writes the screen after every capture as a PNG file:
+
+  <prefix>00000.png, <prefix>00001.png, ... named by the order of the captures
+  <prefix>frames.txt, the frame number of the firmware of every image
+
+A capture cut short, because the framework drew into the framebuffer while it was sent, is
+written with the rows received, the others come with the next capture.
+
+Usage:
+  screencapture.py --trace swo_port2.bin --out capture/screen_
+"""
+
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+STREAM_BEGIN = 0xFFFF0000
+FRAME_BEGIN = 0xFFFF0001
+AREA = 0xFFFF0002
+ROW_REPEAT = 0xFFFF0003
+FRAME_END = 0xFFFF0004
+FRAME_ABORT = 0xFFFF0005
+
+
+def is_marker(word):
+    return (word >> 16) == 0xFFFF
+
+
+def decode_row(words, i, width):
+    """Returns the pixels of a row and the index of the word after it."""
+    pixels = []
+    while len(pixels) < width:
+        word = words[i]
+        i += 1
+        count = ((word >> 16) & 0x7FFF) + 1
+        if word & 0x80000000:
+            pixels.append(word & 0xFFFF)
+            for _ in range(count // 2):
+                pair = words[i]
+                i += 1
+                pixels.append(pair & 0xFFFF)
+                pixels.append(pair >> 16)
+            if count % 2 == 0:
+                pixels.pop()
+        else:
+            pixels.extend([word & 0xFFFF] * count)
+    if len(pixels) != width:
+        raise ValueError("row of %d pixels in an area %d wide" % (len(pixels), width))
+    return pixels, i
+
+
+def write_png(path, width, height, screen):
+    raw = bytearray()
+    for y in range(height):
+        raw.append(0)
+        for pixel in screen[y * width:(y + 1) * width]:
+            r = (pixel >> 11) & 0x1F
+            g = (pixel >> 5) & 0x3F
+            b = pixel & 0x1F
+            raw += bytes(((r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2)))
+
+    def chunk(kind, data):
+        return struct.pack(">I", len(data)) + kind + data + struct.pack(">I", zlib.crc32(kind + data) & 0xFFFFFFFF)
+
+    with open(path, "wb") as png:
+        png.write(b"\x89PNG\r\n\x1a\n")
+        png.write(chunk(b"IHDR", struct.pack(">IIBBBBB", width, height, 8, 2, 0, 0, 0)))
+        png.write(chunk(b"IDAT", zlib.compress(bytes(raw), 6)))
+        png.write(chunk(b"IEND", b""))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--trace", required=True, help="raw payload of ITM stimulus port 2")
+    parser.add_argument("--out", default="screen_", help="prefix of the files written, default screen_")
+    args = parser.parse_args()
+
+    with open(args.trace, "rb") as trace:
+        data = trace.read()
+    words = struct.unpack("<%dI" % (len(data) // 4), data[:len(data) // 4 * 4])
+
+    directory = os.path.dirname(args.out)
+    if directory:
+        os.makedirs(directory, exist_ok=True)
+
+    width = height = 0
+    screen = None
+    frame = None
+    images = []
+    aborted = 0
+    i = 0
+    try:
+        while i < len(words):
+            word = words[i]
+            i += 1
+            if word == STREAM_BEGIN:
+                width, height = words[i] >> 16, words[i] & 0xFFFF
+                i += 1
+                screen = [0] * (width * height)
+            elif word == FRAME_BEGIN:
+                frame = words[i]
+                i += 1
+            elif word == AREA and screen is not None:
+                x, y = words[i] >> 16, words[i] & 0xFFFF
+                w, h = words[i + 1] >> 16, words[i + 1] & 0xFFFF
+                i += 2
+                above = None
+                for row in range(h):
+                    # A capture cut short ends the area before its last row
+                    if i >= len(words) or (is_marker(words[i]) and words[i] != ROW_REPEAT):
+                        break
+                    if words[i] == ROW_REPEAT:
+                        i += 1
+                        pixels = above
+                    else:
+                        pixels, i = decode_row(words, i, w)
+                    start = (y + row) * width + x
+                    screen[start:start + w] = pixels
+                    above = pixels
+            elif word in (FRAME_END, FRAME_ABORT) and screen is not None and frame is not None:
+                aborted += word == FRAME_ABORT
+                write_png("%s%05d.png" % (args.out, len(images)), width, height, screen)
+                images.append(frame)
+                frame = None
+    except (IndexError, TypeError, ValueError) as error:
+        print("%s: stream ends or is corrupt at word %d: %s" % (args.trace, i, error), file=sys.stderr)
+
+    if not images:
+        sys.exit("%s: no capture, was STREAM_BEGIN recorded?" % args.trace)
+    with open("%sframes.txt" % args.out, "w") as index:
+        for number, frame in enumerate(images):
+            index.write("%05d %d\n" % (number, frame))
+    print("%d captures of %dx%d written, %d cut short" % (len(images), width, height, aborted))
+
+
+if __name__ == "__main__":
+    main()
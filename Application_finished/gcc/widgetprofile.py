@@ -0,0 +1,184 @@
+#!/usr/bin/env python3
+"""Shows which widgets take the frame time, from the trace of WidgetProfiler.
+
+The firmware built with -DTOUCHGFX_WIDGET_PROFILE=1 times every widget declared as a
+ProfiledDrawable and writes each draw to ITM stimulus port 1: the address of the widget, the
+address of its vtable, and the CPU and GPU cycles of the draw. This script reads the raw
+payload of that port, as saved by the SWO viewer of the debugger, sums the draws of every
+widget per frame and prints:
+
+  the widgets with the most time per frame, on average and at worst
+  the frames over the budget, with the widgets that took most of them
+
+With the linker map file of the same build the widgets are named by their class, from the
+vtable, and by where they are, from the object that holds them, like the FrontendHeap.
+
+Usage:
+  widgetprofile.py --trace swo_port1.bin --map build/bin/application.map
+"""
+
+import argparse
+import bisect
+import re
+import shutil
+import struct
+import subprocess
+import sys
+
+STREAM_BEGIN = 0xFFFF0000
+FRAME_BEGIN = 0xFFFF0001
+FRAME_END = 0xFFFF0002
+
+
+class Widget:
+    def __init__(self, address, vtable):
+        self.address = address
+        self.vtable = vtable
+        self.frames = 0
+        self.draws = 0
+        self.cpu = 0
+        self.gpu = 0
+        self.worst = 0
+
+
+class Frame:
+    def __init__(self, number):
+        self.number = number
+        self.cycles = 0
+        self.widgets = {}
+
+
+def read_trace(path):
+    """Returns the core clock and the frames of the trace."""
+    with open(path, "rb") as trace:
+        data = trace.read()
+    words = struct.unpack("<%dI" % (len(data) // 4), data[:len(data) // 4 * 4])
+    clock = None
+    frames = []
+    frame = None
+    i = 0
+    while i < len(words):
+        word = words[i]
+        if word == STREAM_BEGIN and i + 1 < len(words):
+            clock = words[i + 1]
+            frame = None
+            i += 2
+        elif word == FRAME_BEGIN and i + 1 < len(words):
+            frame = Frame(words[i + 1])
+            i += 2
+        elif word == FRAME_END and i + 1 < len(words):
+            if frame is not None:
+                frame.cycles = words[i + 1]
+                frames.append(frame)
+            frame = None
+            i += 2
+        elif i + 3 < len(words):
+            if frame is not None:
+                key = (word, words[i + 1])
+                cpu, gpu, draws = frame.widgets.get(key, (0, 0, 0))
+                frame.widgets[key] = (cpu + words[i + 2], gpu + words[i + 3], draws + 1)
+            i += 4
+        else:
+            break
+    if clock is None:
+        sys.exit("%s: no profile stream found" % path)
+    return clock, frames
+
+
+def read_symbols(path):
+    """Returns the allocated input sections of a GNU ld map file as (address, size, name)."""
+    symbols = []
+    pending = None
+    with open(path, errors="replace") as lines:
+        for line in lines:
+            line = line.rstrip("\n")
+            if pending is not None:
+                match = re.match(r"^\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s", line)
+                if match:
+                    symbols.append((int(match.group(1), 16), int(match.group(2), 16), pending))
+                pending = None
+                continue
+            match = re.match(r"^ (\.\S+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s", line)
+            if match:
+                symbols.append((int(match.group(2), 16), int(match.group(3), 16), match.group(1)))
+                continue
+            match = re.match(r"^ (\.\S+)$", line)
+            if match:
+                pending = match.group(1)
+    symbols = [s for s in symbols if s[1] > 0]
+    symbols.sort()
+    return symbols
+
+
+def demangle(names):
+    if not names or shutil.which("c++filt") is None:
+        return dict((n, n) for n in names)
+    output = subprocess.run(["c++filt"], input="\n".join(names), capture_output=True, text=True).stdout
+    return dict(zip(names, output.splitlines()))
+
+
+def namer(symbols):
+    """Returns a function naming an address by the section holding it and the offset."""
+    starts = [s[0] for s in symbols]
+    mangled = [re.sub(r"^\.[a-z]+\.", "", s[2]) for s in symbols]
+    names = demangle(mangled)
+
+    def name(address, vtable=False):
+        index = bisect.bisect_right(starts, address) - 1
+        if index < 0 or address >= symbols[index][0] + symbols[index][1]:
+            return "0x%08x" % address
+        text = names[mangled[index]]
+        if vtable:
+            return text.replace("vtable for ", "")
+        offset = address - symbols[index][0]
+        return "%s+0x%x" % (text, offset) if offset else text
+
+    return name
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--trace", required=True, help="raw payload of ITM stimulus port 1")
+    parser.add_argument("--map", help="linker map file of the profiled build")
+    parser.add_argument("--budget-ms", type=float, default=16.6, help="frame time budget, default 16.6")
+    parser.add_argument("--top", type=int, default=15, help="widgets listed, default 15")
+    args = parser.parse_args()
+
+    clock, frames = read_trace(args.trace)
+    if not frames:
+        sys.exit("%s: no complete frame" % args.trace)
+    name = namer(read_symbols(args.map)) if args.map else (lambda a, vtable=False: "0x%08x" % a)
+
+    def ms(cycles):
+        return 1000.0 * cycles / clock
+
+    widgets = {}
+    for frame in frames:
+        for key, (cpu, gpu, draws) in frame.widgets.items():
+            widget = widgets.setdefault(key, Widget(*key))
+            widget.frames += 1
+            widget.draws += draws
+            widget.cpu += cpu
+            widget.gpu += gpu
+            widget.worst = max(widget.worst, cpu + gpu)
+
+    print("%d frames, %.2f ms average, %.2f ms worst"
+          % (len(frames), ms(sum(f.cycles for f in frames)) / len(frames), ms(max(f.cycles for f in frames))))
+    print("%8s %8s %8s %6s  %s" % ("cpu ms", "gpu ms", "worst", "draws", "widget"))
+    for widget in sorted(widgets.values(), key=lambda w: (w.cpu + w.gpu) / w.frames, reverse=True)[:args.top]:
+        print("%8.3f %8.3f %8.3f %6.1f  %s %s"
+              % (ms(widget.cpu) / widget.frames, ms(widget.gpu) / widget.frames, ms(widget.worst),
+                 float(widget.draws) / widget.frames, name(widget.vtable, True), name(widget.address)))
+
+    over = [f for f in frames if ms(f.cycles) > args.budget_ms]
+    print("%d frames over %.1f ms" % (len(over), args.budget_ms))
+    for frame in sorted(over, key=lambda f: f.cycles, reverse=True)[:args.top]:
+        print("frame %d: %.2f ms" % (frame.number, ms(frame.cycles)))
+        costs = sorted(frame.widgets.items(), key=lambda item: item[1][0] + item[1][1], reverse=True)
+        for (address, vtable), (cpu, gpu, draws) in costs[:3]:
+            print("  %8.3f cpu %8.3f gpu %3d draws  %s %s"
+                  % (ms(cpu), ms(gpu), draws, name(vtable, True), name(address)))
+
+
+if __name__ == "__main__":
+    main()